@@ -0,0 +1,276 @@
+/*
+ * TLCS-900 Assembler - Benchmark
+ *
+ * Generates a synthetic source and times assembling it:
+ *
+ *   bench [-n LINES] [-r RUNS] [-s SEED] [-j N] [-d DIR]
+ *   bench --generate [-n LINES] [-s SEED] [-d DIR]
+ *
+ * The source (DIR/bench.asm) has one labelled statement per pair of
+ * lines, mixing every operand form the parser accepts: registers of each
+ * size, immediates, (reg), (reg+d), (reg-d), (reg+reg), (reg+), (-reg),
+ * direct addresses, condition codes and control registers.  About half
+ * of all label references point forward, some far enough to keep pass 1
+ * relaxing.  Macros and constants come from DIR/bench.inc and blocks of
+ * DIR/bench.bin are pulled in with BINCLUDE.
+ *
+ * The generator uses its own PRNG, so a given LINES and SEED produce the
+ * same source on every machine; the figures are best-of-RUNS.  With
+ * --generate the files are written and nothing is assembled, for use
+ * with a profiler.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <sys/stat.h>
+#include "../include/tlcs900.h"
+
+#define BINCLUDE_SIZE 32
+#define BLOCK_STATEMENTS 500
+
+static uint64_t rng_state;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+static int rng_range(int lo, int hi) {
+    return lo + (int)(rng() % (uint32_t)(hi - lo + 1));
+}
+
+#define PICK(array) (array[rng() % (sizeof(array) / sizeof(array[0]))])
+
+static const char *const r8[] = { "A", "W", "B", "C", "D", "E", "H", "L" };
+static const char *const r16[] = { "WA", "BC", "DE", "HL", "IX", "IY", "IZ" };
+static const char *const r32[] = { "XWA", "XBC", "XDE", "XHL", "XIX", "XIY", "XIZ" };
+static const char *const alu[] = { "ADD", "ADC", "SUB", "SBC", "AND", "OR", "XOR", "CP" };
+static const char *const shift[] = { "RLC", "RRC", "RL", "RR", "SLA", "SRA", "SLL", "SRL" };
+static const char *const bitop[] = { "BIT", "SET", "RES", "TSET", "CHG" };
+static const char *const memory_bitop[] = { "BIT", "SET", "RES" };
+static const char *const cc[] = { "Z", "NZ", "C", "NC", "T", "MI", "PL", "GT", "LE", "OV" };
+static const char *const control[] = { "DMAS0", "DMAD0", "DMAC0", "DMAM0" };
+static const char *const simple[] = { "NOP", "EI 0", "DI", "RET", "RETI", "LDIR", "HALT", "SCF", "RCF" };
+
+/* Any register of any size */
+static const char *any_reg(void) {
+    switch (rng() % 3) {
+        case 0:  return PICK(r8);
+        case 1:  return PICK(r16);
+        default: return PICK(r32);
+    }
+}
+
+/* A label near statement i, for relative jumps */
+static int near_label(int i, int count) {
+    int target = i + rng_range(-4, 4);
+    if (target < 0) target = 0;
+    if (target >= count) target = count - 1;
+    return target;
+}
+
+/* A label anywhere, biased forward, for absolute references */
+static int far_label(int i, int count) {
+    if (rng() % 4 == 0) return (int)(rng() % (uint32_t)count);
+    return near_label(i, count);
+}
+
+/* A memory operand in one of the parser's addressing modes */
+static void memory_operand(char *out, size_t size, int i, int count) {
+    switch (rng() % 9) {
+        case 0:  snprintf(out, size, "(%s)", PICK(r32)); break;
+        case 1:  snprintf(out, size, "(%s+)", PICK(r32)); break;
+        case 2:  snprintf(out, size, "(-%s)", PICK(r32)); break;
+        case 3:  snprintf(out, size, "(%s+%d)", PICK(r32), rng_range(0, 100)); break;
+        case 4:  snprintf(out, size, "(%s-%d)", PICK(r32), rng_range(1, 100)); break;
+        case 5:  snprintf(out, size, "(XIX+%d)", rng_range(200, 3000)); break;
+        case 6:  snprintf(out, size, "(XWA+%s)", rng() % 2 ? "B" : "BC"); break;
+        case 7:  snprintf(out, size, "(%s)", PICK(((const char *const[]){ "P0", "BIGREG", "FAR" }))); break;
+        default: snprintf(out, size, "(L%d)", far_label(i, count)); break;
+    }
+}
+
+static void write_statement(FILE *fp, int i, int count) {
+    char m[64];
+    memory_operand(m, sizeof(m), i, count);
+    /* Arithmetic takes no (reg+) or (-reg) */
+    char am[64];
+    do {
+        memory_operand(am, sizeof(am), i, count);
+    } while (strchr(am, '-') == am + 1 || strstr(am, "+)"));
+
+    switch (rng() % 33) {
+        case 0:  fprintf(fp, "\tLD %s, %s\n", PICK(r8), PICK(r8)); break;
+        case 1:  fprintf(fp, "\tLD %s, %d\n", PICK(r8), rng_range(0, 255)); break;
+        case 2:  fprintf(fp, "\tLD %s, %d\n", PICK(r16), rng_range(0, 65535)); break;
+        case 3:  fprintf(fp, "\tLD %s, L%d\n", PICK(r32), far_label(i, count)); break;
+        case 4:  fprintf(fp, "\tLD %s, %s\n", rng() % 2 ? PICK(r8) : PICK(r16), m); break;
+        case 5:  fprintf(fp, "\tLD %s, %s\n", m, rng() % 2 ? PICK(r8) : PICK(r16)); break;
+        case 6:  fprintf(fp, "\tLD %s, %s\n", PICK(r32), m); break;
+        case 7:  fprintf(fp, "\tLDA %s, (XIX+%d)\n", PICK(r32), rng_range(0, 100)); break;
+        case 8:  fprintf(fp, "\t%s %s, %s\n", PICK(alu), PICK(r8), PICK(r8)); break;
+        case 9:  fprintf(fp, "\t%s %s, %d\n", PICK(alu), PICK(r8), rng_range(0, 255)); break;
+        case 10: fprintf(fp, "\t%s %s, %d\n", PICK(alu), PICK(r16), rng_range(0, 65535)); break;
+        case 11: fprintf(fp, "\t%s %s, %s\n", PICK(alu), PICK(r32), PICK(r32)); break;
+        case 12: fprintf(fp, "\t%s %s, %s\n", PICK(alu), PICK(r8), am); break;
+        case 13: fprintf(fp, "\t%s %s, %s\n", PICK(alu), am, PICK(r8)); break;
+        case 14: fprintf(fp, "\t%s %d, %s\n", rng() % 2 ? "INC" : "DEC", rng_range(1, 8), any_reg()); break;
+        case 15: fprintf(fp, "\t%s %d, %s\n", PICK(shift), rng_range(1, 15), any_reg()); break;
+        case 16: fprintf(fp, "\t%s %d, %s\n", PICK(bitop), rng_range(0, 7), PICK(r8)); break;
+        case 17: fprintf(fp, "\tPUSH %s\n", rng() % 2 ? PICK(r16) : PICK(r32)); break;
+        case 18: fprintf(fp, "\tPOP %s\n", rng() % 2 ? PICK(r16) : PICK(r32)); break;
+        case 19: fprintf(fp, "\tJR %s, L%d\n", PICK(cc), near_label(i, count)); break;
+        case 20: fprintf(fp, "\tJRL L%d\n", far_label(i, count)); break;
+        case 21: fprintf(fp, "\tJP %s, L%d\n", PICK(cc), far_label(i, count)); break;
+        case 22: fprintf(fp, "\tCALL L%d\n", far_label(i, count)); break;
+        case 23: fprintf(fp, "\tDJNZ B, L%d\n", near_label(i, count)); break;
+        case 24: fprintf(fp, "\t%s\n", PICK(simple)); break;
+        case 25: fprintf(fp, "\tEXTZ %s\n", rng() % 2 ? PICK(r16) : PICK(r32)); break;
+        case 26: fprintf(fp, "\tMUL %s, %d\n", PICK(((const char *const[]){ "WA", "BC", "DE", "HL" })),
+                         rng_range(0, 255)); break;
+        case 27: fprintf(fp, "\tLDC %s, %s\n", PICK(control), PICK(r32)); break;
+        case 28: fprintf(fp, "\tDB %d, %d, \"s%d\"\n", rng_range(0, 255), rng_range(0, 255), i % 10); break;
+        case 29: fprintf(fp, "\tDW L%d, L%d-L%d\n", far_label(i, count), near_label(i, count),
+                         near_label(i, count)); break;
+        case 30: fprintf(fp, "\t%s %d, (XHL)\n", PICK(memory_bitop), rng_range(0, 7)); break;
+        case 31: fprintf(fp, "\tLOADADD %s, %d\n", PICK(r8), rng_range(0, 255)); break;
+        default: fprintf(fp, "\tSAVEALL\n"); break;
+    }
+}
+
+/* Write DIR/bench.asm and its include files; returns the line count */
+static long generate(const char *dir, int statements, uint64_t seed) {
+    char path[1024];
+    rng_state = seed * 0x9E3779B97F4A7C15ull + 1;
+
+    snprintf(path, sizeof(path), "%s/bench.inc", dir);
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        fprintf(stderr, "Error: cannot write '%s'\n", path);
+        return -1;
+    }
+    fprintf(fp, "P0\tEQU 0000h\nBIGREG\tEQU 1234h\nFAR\tEQU 20EFFh\n");
+    fprintf(fp, "LOADADD\tMACRO r, v\n\tLD r, v\n\tADD r, 1\n\tENDM\n");
+    fprintf(fp, "SAVEALL\tMACRO\n\tPUSH XWA\n\tPUSH XBC\n\tPOP XBC\n\tPOP XWA\n\tENDM\n");
+    fclose(fp);
+
+    snprintf(path, sizeof(path), "%s/bench.bin", dir);
+    fp = fopen(path, "wb");
+    if (!fp) {
+        fprintf(stderr, "Error: cannot write '%s'\n", path);
+        return -1;
+    }
+    for (int i = 0; i < 4096; i++) {
+        fputc((int)(rng() & 0xFF), fp);
+    }
+    fclose(fp);
+
+    snprintf(path, sizeof(path), "%s/bench.asm", dir);
+    fp = fopen(path, "w");
+    if (!fp) {
+        fprintf(stderr, "Error: cannot write '%s'\n", path);
+        return -1;
+    }
+    fprintf(fp, "\tCPU 96C141\n\tORG 0FE0000h\n\tINCLUDE \"bench.inc\"\n");
+    long lines = 3;
+    for (int i = 0; i < statements; i++) {
+        fprintf(fp, "L%d:\n", i);
+        write_statement(fp, i, statements);
+        lines += 2;
+        if (i % BLOCK_STATEMENTS == BLOCK_STATEMENTS / 2) {
+            fprintf(fp, "\tBINCLUDE \"bench.bin\", %d, %d\n",
+                    (i / BLOCK_STATEMENTS) % (4096 / BINCLUDE_SIZE) * BINCLUDE_SIZE, BINCLUDE_SIZE);
+            lines++;
+        }
+    }
+    fprintf(fp, "\tEND\n");
+    lines++;
+    fclose(fp);
+    return lines;
+}
+
+static void usage(const char *progname) {
+    fprintf(stderr, "Usage: %s [--generate] [-n LINES] [-r RUNS] [-s SEED] [-j N] [-d DIR]\n", progname);
+}
+
+int main(int argc, char *argv[]) {
+    long target_lines = 200000;
+    int runs = 3;
+    int threads = 1;
+    uint64_t seed = 1;
+    const char *dir = "bench-src";
+    bool generate_only = false;
+
+    static const struct option long_options[] = {
+        {"generate", no_argument, NULL, 'g'},
+        {NULL, 0, NULL, 0}
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "n:r:s:j:d:h", long_options, NULL)) != -1) {
+        switch (opt) {
+            case 'n': target_lines = atol(optarg); break;
+            case 'r': runs = atoi(optarg); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'j': threads = atoi(optarg); break;
+            case 'd': dir = optarg; break;
+            case 'g': generate_only = true; break;
+            case 'h': usage(argv[0]); return 0;
+            default:  usage(argv[0]); return 1;
+        }
+    }
+    if (target_lines < 100 || runs < 1 || threads < 1 || threads > 256) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    mkdir(dir, 0755);
+    long lines = generate(dir, (int)(target_lines / 2), seed);
+    if (lines < 0) return 1;
+
+    char source[1024];
+    snprintf(source, sizeof(source), "%s/bench.asm", dir);
+    if (generate_only) {
+        printf("Wrote %s (%ld lines)\n", source, lines);
+        return 0;
+    }
+
+    AssemblyStats best = {0};
+    double best_total = 0;
+    size_t bytes = 0;
+    for (int run = 0; run < runs; run++) {
+        Assembler *as = assembler_new();
+        if (!as) return 1;
+        as->threads = threads;
+
+        double start = assembler_clock();
+        bool ok = assembler_assemble_file(as, source);
+        double total = assembler_clock() - start;
+        if (!ok) {
+            fprintf(stderr, "Error: %s did not assemble\n", source);
+            assembler_free(as);
+            return 1;
+        }
+        if (run == 0 || total < best_total) {
+            best_total = total;
+            best = as->stats;
+        }
+        bytes = as->output_size;
+        assembler_free(as);
+    }
+
+    printf("source       %s (seed %llu, -j %d)\n", source, (unsigned long long)seed, threads);
+    printf("lines        %ld\n", lines);
+    printf("bytes        %zu\n", bytes);
+    printf("iterations   %d\n", best.iterations);
+    printf("pass 1       %.1f ms\n", best.pass1_seconds * 1e3);
+    printf("pass 2       %.1f ms\n", best.pass2_seconds * 1e3);
+    printf("total        %.1f ms (best of %d)\n", best_total * 1e3, runs);
+    printf("lines/sec    %.0f\n", lines / best_total);
+    printf("bytes/sec    %.0f\n", bytes / best_total);
+    return 0;
+}
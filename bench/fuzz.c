@@ -0,0 +1,650 @@
+/*
+ * TLCS-900 Assembler - Fuzz and Throughput Harness
+ *
+ * Cross-checks the operand parser and the encoders, and measures them:
+ *
+ *   fuzz [-n COUNT] [-r RUNS] [-s SEED] [-m LINES] [-c CORPUS] [-d DIR]
+ *
+ * For each mnemonic family, DIR/FAMILY.asm gets COUNT random
+ * instructions of that family, in every operand form the parser
+ * accepts, including (reg+), (-reg), (reg+d:8) and direct addresses
+ * with a size suffix.  Each source is assembled three ways: parsing
+ * every line on every pass, replaying the recorded statements (the
+ * normal path), and replaying with pass 2 on four threads.  The three
+ * images and the three sets of messages must be identical; the first
+ * differing byte is reported with the line that produced it.
+ *
+ * A table of reference encodings is then checked one instruction at a
+ * time, and a table of sources that once broke one of the paths is
+ * assembled the three ways, and compared (as --compare does) with its
+ * own image.  Finally LINES lines are made by mutating generated lines,
+ * or lines of CORPUS when one is given (an existing source), and
+ * assembled the three ways as well: broken input must give the same
+ * bytes and messages on every path, and must not crash.
+ *
+ * Throughput is reported per family as instructions per second for the
+ * whole assembly, and the nanoseconds per instruction spent parsing
+ * operands and encoding, best of RUNS.  The exit status is non-zero if
+ * any check failed.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <getopt.h>
+#include <sys/stat.h>
+#include "../include/tlcs900.h"
+
+#define MAX_CORPUS_LINES 100000
+
+static uint64_t rng_state;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (uint32_t)(rng_state >> 16);
+}
+
+static int rng_range(int lo, int hi) {
+    return lo + (int)(rng() % (uint32_t)(hi - lo + 1));
+}
+
+#define PICK(array) (array[rng() % (sizeof(array) / sizeof(array[0]))])
+
+static const char *const r8[] = { "A", "W", "B", "C", "D", "E", "H", "L" };
+static const char *const r16[] = { "WA", "BC", "DE", "HL", "IX", "IY", "IZ" };
+static const char *const r32[] = { "XWA", "XBC", "XDE", "XHL", "XIX", "XIY", "XIZ" };
+static const char *const alu[] = { "ADD", "ADC", "SUB", "SBC", "AND", "OR", "XOR", "CP" };
+static const char *const shift[] = { "RLC", "RRC", "RL", "RR", "SLA", "SRA", "SLL", "SRL" };
+static const char *const bitop[] = { "BIT", "SET", "RES", "TSET", "CHG" };
+static const char *const memory_bitop[] = { "BIT", "SET", "RES" };
+static const char *const cc[] = { "Z", "NZ", "C", "NC", "T", "MI", "PL", "GT", "LE", "OV" };
+static const char *const control[] = { "DMAS0", "DMAD0", "DMAC0", "DMAM0" };
+static const char *const simple[] = { "NOP", "EI 0", "DI", "RET", "RETI", "LDIR", "HALT", "SCF", "RCF" };
+static const char *const constants[] = { "P0", "BIGREG", "FAR" };
+
+static const char *any_reg(void) {
+    switch (rng() % 3) {
+        case 0:  return PICK(r8);
+        case 1:  return PICK(r16);
+        default: return PICK(r32);
+    }
+}
+
+static int near_label(int i, int count) {
+    int target = i + rng_range(-4, 4);
+    if (target < 0) target = 0;
+    if (target >= count) target = count - 1;
+    return target;
+}
+
+static int far_label(int i, int count) {
+    return rng() % 4 == 0 ? (int)(rng() % (uint32_t)count) : near_label(i, count);
+}
+
+/* A memory operand; arith leaves out (reg+) and (-reg) */
+static void memory_operand(char *out, size_t size, int i, int count, bool arith) {
+    for (;;) {
+        switch (rng() % 12) {
+            case 0:  snprintf(out, size, "(%s)", PICK(r32)); return;
+            case 1:  if (arith) continue;
+                     snprintf(out, size, "(%s+)", PICK(r32)); return;
+            case 2:  if (arith) continue;
+                     snprintf(out, size, "(-%s)", PICK(r32)); return;
+            case 3:  snprintf(out, size, "(%s+%d)", PICK(r32), rng_range(0, 100)); return;
+            case 4:  snprintf(out, size, "(%s-%d)", PICK(r32), rng_range(1, 100)); return;
+            case 5:  snprintf(out, size, "(XIX+%d)", rng_range(200, 3000)); return;
+            case 6:  snprintf(out, size, "(%s+%d:8)", PICK(r32), rng_range(0, 127)); return;
+            case 7:  snprintf(out, size, "(%s+%d:16)", PICK(r32), rng_range(0, 30000)); return;
+            case 8:  snprintf(out, size, "(XWA+%s)", rng() % 2 ? "B" : "BC"); return;
+            case 9:  snprintf(out, size, "(%s)", PICK(constants)); return;
+            case 10: snprintf(out, size, "(L%d:24)", far_label(i, count)); return;
+            default: snprintf(out, size, "(L%d)", far_label(i, count)); return;
+        }
+    }
+}
+
+static void gen_load(char *out, size_t size, int i, int count) {
+    char m[64];
+    memory_operand(m, sizeof(m), i, count, false);
+    switch (rng() % 8) {
+        case 0:  snprintf(out, size, "LD %s, %s", PICK(r8), PICK(r8)); break;
+        case 1:  snprintf(out, size, "LD %s, %d", PICK(r8), rng_range(0, 255)); break;
+        case 2:  snprintf(out, size, "LD %s, %d", PICK(r16), rng_range(0, 65535)); break;
+        case 3:  snprintf(out, size, "LD %s, L%d", PICK(r32), far_label(i, count)); break;
+        case 4:  snprintf(out, size, "LD %s, %s", rng() % 2 ? PICK(r8) : PICK(r16), m); break;
+        case 5:  snprintf(out, size, "LD %s, %s", m, rng() % 2 ? PICK(r8) : PICK(r16)); break;
+        case 6:  snprintf(out, size, "LD %s, %s", PICK(r32), m); break;
+        default: snprintf(out, size, "LDA %s, (XIX+%d)", PICK(r32), rng_range(0, 100)); break;
+    }
+}
+
+static void gen_arith(char *out, size_t size, int i, int count) {
+    char m[64];
+    memory_operand(m, sizeof(m), i, count, true);
+    switch (rng() % 6) {
+        case 0:  snprintf(out, size, "%s %s, %s", PICK(alu), PICK(r8), PICK(r8)); break;
+        case 1:  snprintf(out, size, "%s %s, %d", PICK(alu), PICK(r8), rng_range(0, 255)); break;
+        case 2:  snprintf(out, size, "%s %s, %d", PICK(alu), PICK(r16), rng_range(0, 65535)); break;
+        case 3:  snprintf(out, size, "%s %s, %s", PICK(alu), PICK(r32), PICK(r32)); break;
+        case 4:  snprintf(out, size, "%s %s, %s", PICK(alu), PICK(r8), m); break;
+        default: snprintf(out, size, "%s %s, %s", PICK(alu), m, PICK(r8)); break;
+    }
+}
+
+static void gen_incdec(char *out, size_t size, int i, int count) {
+    (void)i;
+    (void)count;
+    snprintf(out, size, "%s %d, %s", rng() % 2 ? "INC" : "DEC", rng_range(1, 8), any_reg());
+}
+
+static void gen_shift(char *out, size_t size, int i, int count) {
+    (void)i;
+    (void)count;
+    snprintf(out, size, "%s %d, %s", PICK(shift), rng_range(1, 15), any_reg());
+}
+
+static void gen_bit(char *out, size_t size, int i, int count) {
+    (void)i;
+    (void)count;
+    if (rng() % 2) {
+        snprintf(out, size, "%s %d, %s", PICK(bitop), rng_range(0, 7), PICK(r8));
+    } else {
+        snprintf(out, size, "%s %d, (XHL)", PICK(memory_bitop), rng_range(0, 7));
+    }
+}
+
+static void gen_stack(char *out, size_t size, int i, int count) {
+    (void)i;
+    (void)count;
+    snprintf(out, size, "%s %s", rng() % 2 ? "PUSH" : "POP", rng() % 2 ? PICK(r16) : PICK(r32));
+}
+
+static void gen_branch(char *out, size_t size, int i, int count) {
+    switch (rng() % 5) {
+        case 0:  snprintf(out, size, "JR %s, L%d", PICK(cc), near_label(i, count)); break;
+        case 1:  snprintf(out, size, "JRL L%d", far_label(i, count)); break;
+        case 2:  snprintf(out, size, "JP %s, L%d", PICK(cc), far_label(i, count)); break;
+        case 3:  snprintf(out, size, "CALL L%d", far_label(i, count)); break;
+        default: snprintf(out, size, "DJNZ B, L%d", near_label(i, count)); break;
+    }
+}
+
+static void gen_misc(char *out, size_t size, int i, int count) {
+    (void)i;
+    (void)count;
+    switch (rng() % 4) {
+        case 0:  snprintf(out, size, "%s", PICK(simple)); break;
+        case 1:  snprintf(out, size, "EXTZ %s", rng() % 2 ? PICK(r16) : PICK(r32)); break;
+        case 2:  snprintf(out, size, "MUL %s, %d", PICK(((const char *const[]){ "WA", "BC", "DE", "HL" })),
+                          rng_range(0, 255)); break;
+        default: snprintf(out, size, "LDC %s, %s", PICK(control), PICK(r32)); break;
+    }
+}
+
+static void gen_data(char *out, size_t size, int i, int count) {
+    if (rng() % 2) {
+        snprintf(out, size, "DB %d, %d, \"s%d\"", rng_range(0, 255), rng_range(0, 255), i % 10);
+    } else {
+        snprintf(out, size, "DW L%d, L%d-L%d", far_label(i, count), near_label(i, count),
+                 near_label(i, count));
+    }
+}
+
+typedef void (*Generator)(char *out, size_t size, int i, int count);
+
+static const struct {
+    const char *name;
+    Generator generate;
+} families[] = {
+    { "load",    gen_load },
+    { "arith",   gen_arith },
+    { "incdec",  gen_incdec },
+    { "shift",   gen_shift },
+    { "bit",     gen_bit },
+    { "stack",   gen_stack },
+    { "branch",  gen_branch },
+    { "misc",    gen_misc },
+    { "data",    gen_data },
+};
+
+#define FAMILY_COUNT (sizeof(families) / sizeof(families[0]))
+
+/* Encodings checked by hand against the TLCS-900/H manual, maximum mode */
+static const struct {
+    const char *source;
+    int length;
+    uint8_t bytes[8];
+} references[] = {
+    { "NOP",                    1, { 0x00 } },
+    { "HALT",                   1, { 0x05 } },
+    { "RETI",                   1, { 0x07 } },
+    { "RET",                    1, { 0x0E } },
+    { "LD A, 12h",              2, { 0x21, 0x12 } },
+    { "LD WA, 1234h",           3, { 0x30, 0x34, 0x12 } },
+    { "LD XWA, 12345678h",      5, { 0x40, 0x78, 0x56, 0x34, 0x12 } },
+    { "PUSH BC",                1, { 0x29 } },
+    { "PUSH XIX",               1, { 0x3C } },
+    { "POP HL",                 1, { 0x4B } },
+    { "POP XHL",                1, { 0x5B } },
+    { "JR T, $",                2, { 0x68, 0xFE } },
+    { "JR Z, $+2",              2, { 0x66, 0x00 } },
+    { "JRL T, $",               3, { 0x78, 0xFD, 0xFF } },
+    { "ADD A, 5",               3, { 0xC9, 0xC8, 0x05 } },
+    { "CP A, 5",                3, { 0xC9, 0xCF, 0x05 } },
+};
+
+#define REFERENCE_COUNT (sizeof(references) / sizeof(references[0]))
+
+/* Sources that once assembled differently on the replay path */
+static const struct {
+    const char *name;
+    const char *text;
+} regressions[] = {
+    /*
+     * The ORG back to 0F00h writes below the first byte; compared with
+     * its own image, the reference must still start at 0F00h.
+     */
+    { "backward-org",
+      "\tCPU 96C141\n\tORG 1000h\n"
+      "START:\n\tLD XWA,(TABLE)\n"
+      "\tJP LOWER\n"
+      "\tDB 1,2,3\n"
+      "\tORG 0F00h\n"
+      "LOWER:\n\tLD A,(START)\n"
+      "\tJP START\n"
+      "TABLE:\n\tDD START,LOWER\n" },
+    /*
+     * LD A,(L4) only grows to a 24-bit address on the third sweep, the
+     * first that visits just the worklist; everything after it must move.
+     */
+    { "late-growth",
+      "\tCPU 96C141\n\tORG 0FFDCh\n"
+      "\tDD L0,L1,L2,L3,L4,L5\n"
+      "L0:\n\tLD A,(L4)\n"
+      "L1:\n\tLD (L1),WA\n"
+      "L2:\n\tJP L3\n"
+      "L3:\n\tDS 6\n"
+      "L4:\n\tLD XWA,(L1)\n"
+      "L5:\n\tDS 1\n"
+      "\tDD L0,L1,L2,L3,L4,L5\n" },
+};
+
+#define REGRESSION_COUNT (sizeof(regressions) / sizeof(regressions[0]))
+
+/* ---- Assembling ---- */
+
+typedef enum { PATH_PARSE, PATH_REPLAY, PATH_PARALLEL, PATH_COUNT } AsmPath;
+
+static const char *const path_names[] = { "parse", "replay", "replay -j 4" };
+
+typedef struct {
+    Assembler *as;
+    uint8_t *image;
+    size_t size;
+    uint32_t base;
+    bool matched;               /* No differences from the reference */
+    DiagBuffer diags;
+} Result;
+
+/* Assemble source one way; with a reference, compare against it too */
+static void assemble(const char *source, AsmPath path, const char *reference, Result *r) {
+    memset(r, 0, sizeof(*r));
+    r->as = assembler_new();
+    if (!r->as) exit(1);
+    r->as->threads = path == PATH_PARALLEL ? 4 : 1;
+    r->as->reparse = path == PATH_PARSE;
+    r->as->diag_buffer = &r->diags;
+    r->as->stats.enabled = true;
+    if (reference && !compare_open(r->as, reference, 10)) {
+        fprintf(stderr, "Error: cannot open reference '%s'\n", reference);
+        exit(1);
+    }
+
+    assembler_assemble_file(r->as, source);
+    r->matched = compare_close(r->as);
+    r->image = output_flatten(r->as);
+    r->size = r->as->output_size;
+    r->base = r->as->output_base;
+}
+
+static void result_free(Result *r) {
+    assembler_free(r->as);
+    free(r->image);
+    free(r->diags.text);
+}
+
+/* The recorded statement that wrote addr, for reporting */
+static const Stmt *stmt_at(const Assembler *as, uint32_t addr) {
+    for (size_t i = 0; as->ir.valid && i < as->ir.count; i++) {
+        const Stmt *st = &as->ir.stmts[i];
+        if (st->kind != STMT_LABEL && addr >= st->start_pc && addr - st->start_pc < st->size) {
+            return st;
+        }
+    }
+    return NULL;
+}
+
+/* Compare two results; prints the first difference */
+static bool same_result(const char *source, const Result *a, const Result *b, AsmPath pa, AsmPath pb,
+                        const Result *replay) {
+    if (a->base != b->base || a->size != b->size) {
+        printf("  %s: %s gives %zu bytes at %06X, %s %zu bytes at %06X\n", source,
+               path_names[pa], a->size, a->base, path_names[pb], b->size, b->base);
+        return false;
+    }
+    for (size_t i = 0; i < a->size; i++) {
+        if (a->image[i] == b->image[i]) continue;
+        uint32_t addr = a->base + (uint32_t)i;
+        const Stmt *st = stmt_at(replay->as, addr);
+        printf("  %s: %s and %s differ at %06X (%02X vs %02X)", source, path_names[pa],
+               path_names[pb], addr, a->image[i], b->image[i]);
+        if (st) {
+            printf(", line %d: %s", st->line, st->text);
+        }
+        printf("\n");
+        return false;
+    }
+
+    size_t la = a->diags.length;
+    size_t lb = b->diags.length;
+    if (la != lb || (la && memcmp(a->diags.text, b->diags.text, la) != 0)) {
+        printf("  %s: %s and %s report different messages\n", source, path_names[pa], path_names[pb]);
+        return false;
+    }
+    return true;
+}
+
+/* Assemble a source every way and compare; errors gets the replay path's count */
+static bool cross_check(const char *source, size_t *errors) {
+    Result results[PATH_COUNT];
+    for (int p = 0; p < PATH_COUNT; p++) {
+        assemble(source, (AsmPath)p, NULL, &results[p]);
+    }
+    bool ok = same_result(source, &results[PATH_PARSE], &results[PATH_REPLAY],
+                          PATH_PARSE, PATH_REPLAY, &results[PATH_REPLAY]) &&
+              same_result(source, &results[PATH_REPLAY], &results[PATH_PARALLEL],
+                          PATH_REPLAY, PATH_PARALLEL, &results[PATH_REPLAY]);
+    *errors = (size_t)results[PATH_REPLAY].as->error_count;
+    for (int p = 0; p < PATH_COUNT; p++) {
+        result_free(&results[p]);
+    }
+    return ok;
+}
+
+/* ---- Sources ---- */
+
+static FILE *open_source(const char *path) {
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        fprintf(stderr, "Error: cannot write '%s'\n", path);
+        exit(1);
+    }
+    fprintf(fp, "\tCPU 96C141\n\tORG 0FE0000h\n");
+    fprintf(fp, "P0\tEQU 0000h\nBIGREG\tEQU 1234h\nFAR\tEQU 20EFFh\n");
+    return fp;
+}
+
+static void write_family(const char *path, Generator generate, int count) {
+    FILE *fp = open_source(path);
+    char line[256];
+    for (int i = 0; i < count; i++) {
+        generate(line, sizeof(line), i, count);
+        fprintf(fp, "L%d:\n\t%s\n", i, line);
+    }
+    fclose(fp);
+}
+
+/* Lines that would change what the rest of the file means */
+static bool harmful(const char *line) {
+    static const char *const words[] = { "INCLUDE", "MACRO", "ENDM", "ORG", "END", "CPU", "MAXMODE" };
+    for (const char *p = line; *p; p++) {
+        for (size_t w = 0; w < sizeof(words) / sizeof(words[0]); w++) {
+            if (strncasecmp(p, words[w], strlen(words[w])) == 0) return true;
+        }
+    }
+    return false;
+}
+
+/* Apply one to three random edits */
+static void mutate(char *line, size_t size) {
+    static const char alphabet[] = "()+-,:#$'\" XWABCDEHLIYZ0123456789hL";
+    int edits = rng_range(1, 3);
+    for (int e = 0; e < edits; e++) {
+        size_t len = strlen(line);
+        size_t pos = len ? rng() % (len + 1) : 0;
+        switch (rng() % 3) {
+            case 0:
+                if (pos < len) memmove(line + pos, line + pos + 1, len - pos);
+                break;
+            case 1:
+                if (len + 1 < size) {
+                    memmove(line + pos + 1, line + pos, len - pos + 1);
+                    line[pos] = alphabet[rng() % (sizeof(alphabet) - 1)];
+                }
+                break;
+            default:
+                if (pos < len) line[pos] = alphabet[rng() % (sizeof(alphabet) - 1)];
+                break;
+        }
+    }
+}
+
+static char **read_corpus(const char *path, int *count) {
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        fprintf(stderr, "Error: cannot open corpus '%s'\n", path);
+        exit(1);
+    }
+    char **lines = malloc(MAX_CORPUS_LINES * sizeof(char *));
+    char line[MAX_LINE_LENGTH];
+    *count = 0;
+    while (lines && *count < MAX_CORPUS_LINES && fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        /* Instruction lines only: indented, not comments or directives that nest */
+        if ((line[0] == ' ' || line[0] == '\t') && line[strspn(line, " \t")] != ';' &&
+            line[strspn(line, " \t")] != '\0' && !harmful(line)) {
+            lines[(*count)++] = strdup(line);
+        }
+    }
+    fclose(fp);
+    return lines;
+}
+
+static void write_mutants(const char *path, char **corpus, int corpus_count, int count) {
+    FILE *fp = open_source(path);
+    char line[MAX_LINE_LENGTH];
+    for (int i = 0; i < count; i++) {
+        if (corpus_count > 0) {
+            snprintf(line, sizeof(line), "%s", corpus[rng() % (uint32_t)corpus_count]);
+        } else {
+            line[0] = '\t';
+            families[rng() % FAMILY_COUNT].generate(line + 1, sizeof(line) - 1, i, count);
+        }
+        mutate(line, sizeof(line));
+        if (harmful(line)) {
+            snprintf(line, sizeof(line), "\tNOP");
+        }
+        fprintf(fp, "L%d:\n%s\n", i, line);
+    }
+    fclose(fp);
+}
+
+/* ---- Reference encodings ---- */
+
+static int check_references(const char *dir) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/reference.asm", dir);
+    int failed = 0;
+    for (size_t i = 0; i < REFERENCE_COUNT; i++) {
+        FILE *fp = fopen(path, "w");
+        if (!fp) {
+            fprintf(stderr, "Error: cannot write '%s'\n", path);
+            exit(1);
+        }
+        fprintf(fp, "\tCPU 96C141\n\tORG 1000h\n\t%s\n", references[i].source);
+        fclose(fp);
+
+        Result r;
+        assemble(path, PATH_REPLAY, NULL, &r);
+        if (r.size != (size_t)references[i].length ||
+            memcmp(r.image, references[i].bytes, r.size) != 0) {
+            printf("  %-24s expected", references[i].source);
+            for (int b = 0; b < references[i].length; b++) printf(" %02X", references[i].bytes[b]);
+            printf(", assembled");
+            for (size_t b = 0; b < r.size; b++) printf(" %02X", r.image[b]);
+            printf("\n");
+            failed++;
+        }
+        result_free(&r);
+    }
+    return failed;
+}
+
+/* ---- Regressions ---- */
+
+static int check_regressions(const char *dir) {
+    int failed = 0;
+    for (size_t i = 0; i < REGRESSION_COUNT; i++) {
+        char path[1024];
+        snprintf(path, sizeof(path), "%s/%s.asm", dir, regressions[i].name);
+        FILE *fp = fopen(path, "w");
+        if (!fp) {
+            fprintf(stderr, "Error: cannot write '%s'\n", path);
+            exit(1);
+        }
+        fputs(regressions[i].text, fp);
+        fclose(fp);
+
+        size_t errors;
+        bool ok = cross_check(path, &errors);
+        if (errors) {
+            printf("  %s: %zu errors\n", path, errors);
+        }
+
+        /* Compared with its own image, nothing may differ */
+        char rom[1100];
+        snprintf(rom, sizeof(rom), "%s.rom", path);
+        Result image;
+        assemble(path, PATH_REPLAY, NULL, &image);
+        fp = fopen(rom, "wb");
+        if (!fp || fwrite(image.image, 1, image.size, fp) != image.size) {
+            fprintf(stderr, "Error: cannot write '%s'\n", rom);
+            exit(1);
+        }
+        fclose(fp);
+        result_free(&image);
+        for (AsmPath p = PATH_REPLAY; p < PATH_COUNT; p++) {
+            Result r;
+            assemble(path, p, rom, &r);
+            if (!r.matched) {
+                printf("  %s: %s differs from its own image\n%.*s", path, path_names[p],
+                       (int)r.diags.length, r.diags.text ? r.diags.text : "");
+                ok = false;
+            }
+            result_free(&r);
+        }
+        if (!ok || errors) failed++;
+    }
+    return failed;
+}
+
+static void usage(const char *progname) {
+    fprintf(stderr, "Usage: %s [-n COUNT] [-r RUNS] [-s SEED] [-m LINES] [-c CORPUS] [-d DIR]\n", progname);
+}
+
+int main(int argc, char *argv[]) {
+    int count = 20000;
+    int runs = 3;
+    int mutants = 20000;
+    uint64_t seed = 1;
+    const char *corpus_path = NULL;
+    const char *dir = "fuzz-src";
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:r:s:m:c:d:h")) != -1) {
+        switch (opt) {
+            case 'n': count = atoi(optarg); break;
+            case 'r': runs = atoi(optarg); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'm': mutants = atoi(optarg); break;
+            case 'c': corpus_path = optarg; break;
+            case 'd': dir = optarg; break;
+            case 'h': usage(argv[0]); return 0;
+            default:  usage(argv[0]); return 1;
+        }
+    }
+    if (count < 10 || runs < 1 || mutants < 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    mkdir(dir, 0755);
+    rng_state = seed * 0x9E3779B97F4A7C15ull + 1;
+    int failed = 0;
+
+    /* Families: cross-check, then time the normal path */
+    printf("%-8s %8s %12s %10s %10s\n", "family", "insns", "insns/sec", "parse ns", "encode ns");
+    for (size_t f = 0; f < FAMILY_COUNT; f++) {
+        char source[1024];
+        snprintf(source, sizeof(source), "%s/%s.asm", dir, families[f].name);
+        write_family(source, families[f].generate, count);
+
+        AssemblyStats best = {0};
+        double best_total = 0;
+        for (int run = 0; run < runs; run++) {
+            Result r;
+            double start = assembler_clock();
+            assemble(source, PATH_REPLAY, NULL, &r);
+            double total = assembler_clock() - start;
+            if (run == 0 || total < best_total) {
+                best_total = total;
+                best = r.as->stats;
+            }
+            result_free(&r);
+        }
+        size_t errors;
+        if (!cross_check(source, &errors)) failed++;
+        if (errors) {
+            printf("  %s: %zu errors in generated code\n", source, errors);
+            failed++;
+        }
+        printf("%-8s %8d %12.0f %10.1f %10.1f\n", families[f].name, count, count / best_total,
+               best.phase_seconds[PHASE_OPERANDS] * 1e9 / count,
+               best.phase_seconds[PHASE_ENCODE] * 1e9 / count);
+    }
+
+    int reference_failures = check_references(dir);
+    printf("reference encodings: %zu checked, %d wrong\n", REFERENCE_COUNT, reference_failures);
+    failed += reference_failures;
+
+    int regression_failures = check_regressions(dir);
+    printf("regressions: %zu checked, %d failed\n", REGRESSION_COUNT, regression_failures);
+    failed += regression_failures;
+
+    if (mutants > 0) {
+        char **corpus = NULL;
+        int corpus_count = 0;
+        if (corpus_path) {
+            corpus = read_corpus(corpus_path, &corpus_count);
+        }
+        char source[1024];
+        snprintf(source, sizeof(source), "%s/mutants.asm", dir);
+        write_mutants(source, corpus, corpus_count, mutants);
+        size_t errors;
+        bool ok = cross_check(source, &errors);
+        printf("mutants: %d lines%s%s, %zu errors, paths %s\n", mutants,
+               corpus_path ? " from " : "", corpus_path ? corpus_path : "", errors,
+               ok ? "agree" : "disagree");
+        if (!ok) failed++;
+        for (int i = 0; i < corpus_count; i++) free(corpus[i]);
+        free(corpus);
+    }
+
+    if (failed) {
+        printf("%d checks failed\n", failed);
+    }
+    return failed ? 1 : 0;
+}
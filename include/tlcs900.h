@@ -6,6 +6,7 @@
 #ifndef TLCS900_H
 #define TLCS900_H
 
+#include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -52,24 +53,90 @@ typedef enum {
     TOK_AT,
 } TokenType;
 
+/* Interned string (see intern.c) */
+typedef struct {
+    uint32_t hash;          /* Case-folded FNV-1a hash */
+    uint32_t length;
+    char text[];
+} Atom;
+
+typedef struct StringBlock {
+    struct StringBlock *next;
+    char data[];
+} StringBlock;
+
+/* String pool: atom id -> text, deduplicated */
+typedef struct {
+    Atom **atoms;           /* Indexed by atom id (0 = empty string) */
+    uint32_t *exact_hash;   /* Case-sensitive hash per atom id */
+    uint32_t atom_count;
+    uint32_t atom_capacity;
+    uint32_t *table;        /* Open-addressed id table */
+    size_t table_size;
+    StringBlock *block;     /* Current storage block (blocks never move) */
+    size_t block_size;
+    size_t block_used;
+} StringPool;
+
 /* Token structure */
 typedef struct {
     TokenType type;
-    char text[MAX_IDENTIFIER];
+    const char *text;       /* Interned token text */
+    uint32_t atom;          /* Atom id of text */
     int64_t value;          /* For numbers */
     int line;
     int column;
 } Token;
 
+/* Compact pre-tokenized form of a token, replayed by the lexer */
+typedef struct {
+    uint8_t type;           /* TokenType */
+    uint16_t column;
+    uint32_t atom;          /* Atom id of text */
+    int64_t value;          /* Pre-parsed number/char value */
+} LineToken;
+
+/* Growable array of line tokens */
+typedef struct {
+    LineToken *tokens;
+    size_t count;
+    size_t capacity;
+} TokenBuffer;
+
 /* Lexer state for save/restore */
 typedef struct {
-    const char *pos;
+    int pos;
     int line;
-    int column;
     Token peeked;
     bool has_peeked;
 } LexerState;
 
+/* Token replay state for the line being parsed (see lexer.c) */
+typedef struct {
+    const StringPool *pool;
+    const LineToken *tokens;
+    int count;
+    int pos;
+    int line;
+    Token peeked;
+    bool has_peeked;
+} LexerContext;
+
+/* Macro definition being collected and expansion nesting (see macros.c) */
+typedef struct {
+    bool collecting;
+    char name[MAX_IDENTIFIER];
+    char *params[MAX_MACRO_PARAMS];
+    int param_count;
+    char **body;
+    int body_count;
+    int body_capacity;
+    int depth;
+    /* Token buffers per nesting level, reused across expansions */
+    TokenBuffer arg_buffers[MAX_MACRO_DEPTH];
+    TokenBuffer line_buffers[MAX_MACRO_DEPTH];
+} MacroContext;
+
 /* Register types */
 typedef enum {
     REG_NONE = 0,
@@ -143,6 +210,68 @@ typedef enum {
     CC_UGE = CC_NC,
 } ConditionCode;
 
+/* Bump arena (see arena.c) */
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+    char data[];
+} ArenaBlock;
+
+typedef struct {
+    ArenaBlock *head;           /* Current block */
+    ArenaBlock *spare;          /* Released blocks kept for reuse */
+} Arena;
+
+typedef struct {
+    ArenaBlock *block;
+    size_t used;
+} ArenaMark;
+
+/* Expression tree operators */
+typedef enum {
+    EXPR_NUMBER = 0,
+    EXPR_SYMBOL,
+    EXPR_PC,
+    /* Unary */
+    EXPR_NEG, EXPR_NOT, EXPR_LNOT,
+    EXPR_HIGH, EXPR_LOW, EXPR_BANK,
+    /* Binary */
+    EXPR_LOR, EXPR_LAND,
+    EXPR_OR, EXPR_XOR, EXPR_AND,
+    EXPR_EQ, EXPR_NE, EXPR_LT, EXPR_LE, EXPR_GT, EXPR_GE,
+    EXPR_SHL, EXPR_SHR,
+    EXPR_ADD, EXPR_SUB,
+    EXPR_MUL, EXPR_DIV, EXPR_MOD,
+    /* Compiled code only: a symbol folded into the next number */
+    EXPR_REF,
+} ExprOp;
+
+/* Expression tree node */
+typedef struct ExprNode {
+    uint8_t op;                 /* ExprOp */
+    uint32_t atom;              /* EXPR_SYMBOL: symbol name */
+    int64_t value;              /* EXPR_NUMBER: literal value */
+    struct ExprNode *left;
+    struct ExprNode *right;
+} ExprNode;
+
+/* Compiled expression: postfix code run over a value stack */
+typedef struct {
+    uint8_t op;                 /* ExprOp */
+    uint32_t atom;              /* EXPR_SYMBOL, EXPR_REF: symbol name */
+    int64_t value;              /* EXPR_NUMBER: value */
+} ExprInsn;
+
+#define EXPR_STACK_DEPTH 64
+
+typedef struct {
+    uint16_t count;
+    bool constant;              /* Folded to a single number */
+    bool uses_pc;               /* Refers to $ */
+    ExprInsn insns[];
+} ExprCode;
+
 /* Operand structure */
 typedef struct {
     AddressingMode mode;
@@ -152,8 +281,9 @@ typedef struct {
     int64_t value;              /* Immediate/displacement value */
     bool value_known;           /* Is value resolved? */
     bool is_constant;           /* True if value from literal/EQU, false if from label */
-    char symbol[MAX_IDENTIFIER]; /* Unresolved symbol name */
+    uint32_t symbol;            /* Atom of a control register name, 0 if none */
     int addr_size;              /* :8, :16, :24 suffix */
+    const ExprCode *expr;       /* Value expression, NULL if none */
 } Operand;
 
 /* Instruction table entry */
@@ -173,38 +303,344 @@ typedef enum {
     SYM_SECTION,
 } SymbolType;
 
+/* Parameter reference inside a macro body line */
+typedef struct {
+    uint32_t offset;        /* Start of the parameter name in the line */
+    uint16_t length;        /* Length of the name as written */
+    uint16_t param;         /* Parameter index */
+    int token;              /* Index of the name's token in the line */
+} MacroSlot;
+
+/* Macro body line compiled into literal text and parameter slots */
+typedef struct {
+    MacroSlot *slots;
+    int slot_count;
+    size_t length;          /* Length of the body line */
+    TokenBuffer tokens;     /* The body line, tokenized once */
+    int token_count;
+    bool splice_tokens;     /* Every slot is a whole identifier token */
+} MacroLine;
+
+/* Macro definition, kept apart from the symbol so labels stay small */
+typedef struct MacroDef {
+    char **body;
+    int body_lines;
+    char **params;
+    int param_count;
+    MacroLine *lines;       /* Compiled body, NULL if compiling failed */
+    uint64_t hash;          /* Content hash for the build cache, 0 until needed */
+    struct MacroDef *prev;  /* Replaced definition, kept until symbols_free */
+} MacroDef;
+
 /* Symbol entry */
 typedef struct Symbol {
-    char name[MAX_IDENTIFIER];
+    const char *name;       /* Interned in the string pool */
+    uint32_t atom;          /* String pool id of name */
+    uint32_t hash;          /* Case-folded hash of name */
     SymbolType type;
     int64_t value;
     bool defined;
     bool referenced;
+    bool fixed;             /* EQU folded from literals and fixed EQUs only */
     int definition_line;
     const char *definition_file;
+    uint32_t stamp;         /* Change counter value when value last changed */
+    uint32_t defined_sweep; /* Pass sweep of the last definition */
+    bool duplicate;         /* Label defined more than once in a sweep */
+    bool seeded;            /* Value preloaded from the build cache, not yet defined */
+    uint32_t cache_ref;     /* Build cache frame that last noted a reference */
+    uint32_t cache_def;     /* Build cache frame that last noted a definition */
+    uint32_t users;         /* First of the instructions using it in StmtList.users */
+    uint32_t user_count;
     struct Symbol *next;    /* For hash chain */
-    /* For macros */
-    char **macro_body;
-    int macro_body_lines;
-    char **macro_params;
-    int macro_param_count;
+    MacroDef *macro;        /* For macros, NULL otherwise */
 } Symbol;
 
-/* Assembler state */
+/* Statement kinds recorded for replay (see ir.c) */
+typedef enum {
+    STMT_LABEL,                 /* Define label at current PC */
+    STMT_INSN,                  /* Re-evaluate operands and encode */
+    STMT_LINE,                  /* Replay the line through the parser */
+    STMT_INCLUDE,               /* Start of an included file */
+    STMT_INCLUDE_END,           /* End of an included file's statements */
+} StmtKind;
+
+/* Recorded operand: fixed addressing shape plus value expression */
+typedef struct {
+    uint8_t mode;               /* AddressingMode */
+    uint8_t size;               /* OperandSize */
+    uint8_t reg;                /* RegisterType */
+    uint8_t index_reg;          /* RegisterType */
+    int32_t addr_size;
+    int32_t pinned_size;        /* Grown direct address size, 0 if not pinned */
+    uint32_t symbol;            /* Atom of control register name, 0 if none */
+    int64_t value;              /* Value when expr is NULL */
+    bool value_known;
+    bool is_constant;
+    const ExprCode *expr;
+} StmtOperand;
+
+/* Recorded DB/DW/DD value: a string's bytes or an expression */
 typedef struct {
+    uint8_t width;              /* Bytes per value, 0 for a string */
+    uint32_t length;            /* String length */
+    const char *text;           /* String bytes, interned */
+    const ExprCode *code;
+} DataItem;
+
+struct Assembler;
+typedef bool (*EncoderFunc)(struct Assembler *, Operand *, int);
+
+/* Directive identifiers (see directives.c) */
+typedef enum {
+    DIR_NONE = 0,
+    DIR_ORG, DIR_EQU, DIR_SET,
+    DIR_DB, DIR_DW, DIR_DD, DIR_DS, DIR_ALIGN,
+    DIR_INCLUDE, DIR_BINCLUDE,
+    DIR_CPU, DIR_MAXMODE, DIR_END, DIR_PAGE, DIR_LISTING,
+    DIR_MACRO, DIR_ENDM,
+} DirectiveId;
+
+/* Operand keyword classes (a name may be several, e.g. C) */
+#define KW_REGISTER     0x01
+#define KW_CONDITION    0x02
+#define KW_CTRL_REG     0x04
+
+/* Keyword: mnemonic (directive and/or instruction) or operand name */
+typedef struct {
+    const char *name;
+    uint32_t hash;              /* Case-folded hash (strpool_hash_folded) */
+    uint8_t directive;          /* DirectiveId, DIR_NONE if not a directive */
+    uint8_t operand;            /* KW_* operand classes */
+    uint8_t reg;                /* RegisterType if KW_REGISTER */
+    uint8_t size;               /* OperandSize if KW_REGISTER */
+    uint8_t cc;                 /* ConditionCode if KW_CONDITION */
+    EncoderFunc encoder;        /* NULL if not an instruction */
+} Keyword;
+
+/* Recorded statement */
+typedef struct {
+    uint8_t kind;               /* StmtKind */
+    uint8_t operand_count;
+    bool has_label;             /* Line also defined a label (STMT_INSN) */
+    uint32_t name;              /* Label atom or mnemonic atom */
+    int line;
+    const char *file;
+    const char *text;           /* Source line for parser replay */
+    const LineToken *tokens;
+    int token_count;
+    EncoderFunc encoder;
+    StmtOperand *operands;
+    /* Relaxation state (STMT_INSN) */
+    Symbol **deps;              /* Symbols the operand values depend on */
+    int dep_count;
+    bool always_eval;           /* Depends on $, SET or unresolved symbols */
+    bool size_valid;            /* size is from a previous sweep */
+    bool size_fixed;            /* size depends only on operand modes */
+    uint32_t size;              /* Bytes taken in the last pass 1 sweep (STMT_INSN: encoded size) */
+    uint32_t eval_stamp;        /* Change counter when size was computed */
+    /* STMT_INCLUDE: text is the resolved path */
+    uint32_t end;               /* Index of the STMT_INCLUDE_END, 0 if not recorded */
+    uint8_t directive;          /* STMT_LINE: DirectiveId, DIR_NONE if not a directive */
+    uint32_t start_pc;          /* PC at this statement in the last pass 1 sweep */
+    /* STMT_LINE DB/DW/DD: compiled values, size is their byte count */
+    const DataItem *data;       /* NULL if the line must be reparsed */
+    uint32_t data_count;
+} Stmt;
+
+/* Statement list built on the first pass 1 iteration */
+typedef struct {
+    Stmt *stmts;
+    size_t count;
+    size_t capacity;
+    Arena arena;                /* Compiled expressions and operands */
+    DataItem *data;             /* Values of the data line being recorded */
+    size_t data_count;
+    size_t data_capacity;
+    bool data_ready;            /* data holds the whole line */
+    /* Worklist sweeps (see ir_sweep) */
+    uint32_t *users;            /* Instructions using each symbol, by Symbol.users */
+    uint64_t *always;           /* Statements replayed on every sweep */
+    uint64_t *dirty;            /* Instructions whose symbols changed */
+    uint32_t end_pc;            /* PC after the last sweep */
+    bool worklist;              /* start_pc and size are current for every statement */
+    bool recording;
+    int suspend;                /* >0 while inside macro expansions */
+    bool valid;                 /* Replay is usable for later passes */
+    bool grow_only;             /* Direct address sizes may only grow */
+} StmtList;
+
+/* Line index entry into a cached source file */
+typedef struct {
+    uint32_t offset;            /* Start of line within data */
+    uint32_t length;            /* Length without CR/LF */
+    uint32_t first_token;       /* Index into SourceFile tokens */
+    uint32_t token_count;
+} SourceLine;
+
+/* Source file loaded once and shared by all passes */
+typedef struct SourceFile {
+    char *path;                 /* Resolved path (cache key) */
+    char *data;                 /* File contents, lines NUL-terminated in place */
+    size_t size;
+    SourceLine *lines;
+    int line_count;
+    TokenBuffer tokens;         /* Pre-tokenized lines */
+    bool tokenized;             /* tokens and line token ranges are filled in */
+    uint64_t hash;              /* FNV-1a of the file as read */
+    struct SourceFile *next;
+} SourceFile;
+
+/* Bytes captured instead of written to the image (see output.c) */
+typedef struct {
+    uint32_t addr;
+    uint32_t length;
+    size_t offset;              /* Into the capture's data */
+} OutputRun;
+
+typedef struct {
+    OutputRun *runs;
+    size_t run_count;
+    size_t run_capacity;
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+    Arena *arena;               /* Where runs and data grow, NULL for the heap */
+} OutputCapture;
+
+/* Diagnostics held back to be printed later, in order (see errors.c) */
+typedef struct {
+    char *text;
+    size_t length;
+    size_t capacity;
+} DiagBuffer;
+
+typedef enum {
+    DIAG_ERROR,
+    DIAG_WARNING,
+    DIAG_MESSAGE                /* Build status, no source position */
+} DiagKind;
+
+/* One diagnostic as collected during assembly */
+typedef struct {
+    uint32_t file;              /* Index into the list's files; unused for messages */
+    int line;
+    uint8_t kind;               /* DiagKind */
+    uint32_t seq;               /* Order reported */
+    uint64_t hash;              /* Of file, line, kind and text, for de-duplication */
+    const char *text;           /* In the list's arena */
+} Diagnostic;
+
+/* Diagnostics collected and de-duplicated until they are printed */
+typedef struct {
+    Diagnostic *items;
+    size_t count;
+    size_t capacity;
+    const char **files;         /* File names, in the list's arena */
+    size_t file_count;
+    size_t file_capacity;
+    uint32_t *slots;            /* Open-addressed set of item index + 1 */
+    size_t slot_count;
+    Arena arena;
+} DiagList;
+
+/* Build cache state (see cache.c) */
+typedef struct BuildCache BuildCache;
+
+/* Output file formats (see output.c) */
+typedef enum {
+    OUTPUT_BINARY,              /* Flat image, gaps padded with 0xFF */
+    OUTPUT_IHEX,                /* Intel HEX, gaps skipped */
+    OUTPUT_SREC                 /* Motorola S-records, gaps skipped */
+} OutputFormat;
+
+/* Listing being written during pass 2 (see listing.c) */
+typedef struct Listing Listing;
+
+/* Reference image pass 2 output is checked against (see compare.c) */
+typedef struct Compare Compare;
+
+/* Pass 1 sweeps before giving up on convergence */
+#define MAX_PASS1_ITERATIONS 10
+
+/* What --stats splits assembly time into (see stats.c) */
+typedef enum {
+    PHASE_OTHER = 0,            /* Directives, symbols, replay bookkeeping */
+    PHASE_LEX,
+    PHASE_OPERANDS,
+    PHASE_EXPR,
+    PHASE_ENCODE,
+    PHASE_OUTPUT,
+    PHASE_COUNT
+} StatsPhase;
+
+typedef struct {
+    double seconds;
+    uint32_t definitions;       /* Symbols defined for the first time */
+    uint32_t symbol_changes;    /* Label/EQU values that moved */
+    uint32_t size_changes;      /* Replayed instructions whose size changed */
+    uint32_t visited;           /* Statements a worklist sweep replayed */
+    uint64_t allocations;       /* Heap allocations during the sweep */
+} IterationStats;
+
+/* Where the last assembly spent its time */
+typedef struct {
+    int iterations;             /* Pass 1 sweeps */
+    double pass1_seconds;
+    double pass2_seconds;
+
+    /* Timed only with --stats, which costs a clock read per phase change */
+    bool enabled;
+    IterationStats iteration[MAX_PASS1_ITERATIONS];
+    double phase_seconds[PHASE_COUNT];
+    StatsPhase phase;
+    double phase_start;
+
+    /* Always counted */
+    uint64_t symbol_lookups;    /* Hash table searches (memoized hits excluded) */
+    uint64_t symbol_probes;     /* Chain entries compared that didn't match */
+    uint64_t memo_hits;         /* Lookups answered by the atom memo */
+    uint64_t macro_expansions;
+    uint64_t bytes_emitted;     /* Pass 2 bytes written, overwrites included */
+    uint64_t pass2_allocations; /* Heap allocations in pass 2, workers included */
+} AssemblyStats;
+
+/* Assembler state */
+typedef struct Assembler {
     /* Current position */
     uint32_t pc;                /* Program counter */
     uint32_t org;               /* Current origin */
 
-    /* Output buffer */
-    uint8_t *output;
-    size_t output_size;
-    size_t output_capacity;
+    /* Output image (see output.c) */
+    uint8_t **output_pages;     /* 64 KiB pages, NULL until written */
+    size_t output_page_count;   /* Entries in output_pages */
+    size_t output_size;         /* Bytes from output_base to highest written */
     uint32_t output_base;       /* Base address for output */
+    uint64_t output_end;        /* One past highest address written */
 
     /* Symbol table */
     Symbol **symbols;
     size_t symbol_table_size;
+    size_t symbol_count;
+    Arena symbol_arena;         /* Symbol storage */
+    Symbol **atom_symbols;      /* Memoized lookups, indexed by atom */
+    size_t atom_symbols_size;
+    uint32_t symbol_stamp;      /* Counts label/EQU value changes */
+    uint32_t sweep;             /* Counts passes over the source */
+
+    /* Source file cache */
+    SourceFile *sources;
+    SourceFile *shared_sources; /* Tokenized for a whole batch, read-only */
+
+    /* Interned token text and scratch tokens for uncached lines */
+    StringPool strings;
+    TokenBuffer line_tokens;
+
+    /* Recorded statements and expression storage */
+    StmtList ir;
+    Arena scratch;              /* Temporary expression trees */
+    Arena *expr_arena;          /* Where compiled operand expressions go */
+    Arena pass_arena;           /* Strings needed until the end of the pass, reset each pass */
 
     /* Current file context */
     const char *current_file;
@@ -218,8 +654,27 @@ typedef struct {
     } include_stack[MAX_INCLUDE_DEPTH];
     int include_depth;
 
-    /* Macro expansion */
-    int macro_depth;
+    /* Parsing state, one per assembler (and per pass 2 worker) */
+    LexerContext lexer;
+    MacroContext macro;
+
+    /* Pass 2 worker state (see parallel.c) */
+    struct ParallelPass2 *parallel; /* Chunks encoded ahead by workers */
+    OutputCapture *output_capture; /* Writes go here instead of the image */
+    Listing *listing;           /* Pass 2 writes are listed here too */
+    Compare *compare;           /* Pass 2 writes are checked against a reference */
+    DiagBuffer *diag_buffer;    /* Diagnostics go here instead of stderr */
+    DiagList *diag_list;        /* Collecting: diagnostics go here first */
+    DiagList diags;             /* This assembler's collection */
+    bool worker;                /* Symbols are shared and must not change */
+    bool worker_tainted;        /* Worker met something only a serial pass can do */
+
+    /* Build cache, NULL when disabled */
+    BuildCache *cache;
+    bool cache_tracking;        /* Pass 2 is inside a file being recorded */
+
+    /* Precompiled headers looked up so far (see pch.c) */
+    struct PchFile *pch;
 
     /* Pass tracking */
     int pass;                   /* 1 or 2 */
@@ -227,55 +682,262 @@ typedef struct {
     bool errors;
     int error_count;
     int warning_count;
+    int diag_suppress;          /* >0 while diagnostics are discarded */
+    bool stop;                  /* Abandon the pass (--compare saw enough) */
+    AssemblyStats stats;
 
     /* Options */
     bool max_mode;              /* MAXMODE directive */
     bool verbose;
-    bool list_enabled;
+    bool list_enabled;          /* LISTING ON (the default) or OFF */
+    int threads;                /* Pass 2 worker threads, 1 for serial */
+    OutputFormat output_format;
+    uint32_t bank_size;         /* Split the image into files this large, 0 for one */
+    bool layout_only;           /* Stop once pass 1 converges (--symbols-only) */
+    bool reparse;               /* Parse every pass, never replay (cross-checks) */
 } Assembler;
 
+/* Charge time to phase until stats_leave; free unless --stats is on */
+StatsPhase stats_switch(Assembler *as, StatsPhase phase);
+
+static inline StatsPhase stats_enter(Assembler *as, StatsPhase phase) {
+    return as->stats.enabled ? stats_switch(as, phase) : PHASE_OTHER;
+}
+
+static inline void stats_leave(Assembler *as, StatsPhase prev) {
+    if (as->stats.enabled) stats_switch(as, prev);
+}
+
 /* Function prototypes - will be expanded */
 
+/* String pool */
+void strpool_init(StringPool *pool);
+void strpool_init_from(StringPool *pool, const StringPool *base);
+void strpool_free(StringPool *pool);
+uint32_t strpool_intern(StringPool *pool, const char *s, size_t len);
+uint32_t strpool_hash_folded(const char *s, size_t len);
+
+static inline const char *strpool_text(const StringPool *pool, uint32_t id) {
+    return pool->atoms[id]->text;
+}
+
+/* Keywords */
+void keywords_init(void);
+void keyword_add(const char *name, DirectiveId directive, EncoderFunc encoder);
+void keyword_add_operand(const char *name, int operand_class, int value, int size);
+const Keyword *keyword_find(const char *name, uint32_t hash);
+const Keyword *keyword_lookup(const char *name);
+
 /* Lexer */
-void lexer_init(const char *input);
-Token lexer_next(void);
-Token lexer_peek(void);
-void lexer_push_back(Token tok);
-void lexer_set_line(int line);
-void lexer_save_state(LexerState *state);
-void lexer_restore_state(const LexerState *state);
+int lexer_tokenize(StringPool *pool, const char *input, TokenBuffer *buf);
+void lexer_init_tokens(LexerContext *lx, const StringPool *pool, const LineToken *tokens, int count);
+Token lexer_next(LexerContext *lx);
+Token lexer_peek(LexerContext *lx);
+void lexer_push_back(LexerContext *lx, Token tok);
+void lexer_set_line(LexerContext *lx, int line);
+void lexer_save_state(const LexerContext *lx, LexerState *state);
+void lexer_restore_state(LexerContext *lx, const LexerState *state);
+
+/* Macros */
+void macro_context_free(MacroContext *mc);
+void macro_begin_pass(Assembler *as);
 
 /* Symbols */
 void symbols_init(Assembler *as);
 void symbols_free(Assembler *as);
 Symbol *symbol_lookup(Assembler *as, const char *name);
+Symbol *symbol_lookup_atom(Assembler *as, uint32_t atom);
 Symbol *symbol_define(Assembler *as, const char *name, SymbolType type, int64_t value);
+Symbol *symbol_define_fixed(Assembler *as, const char *name, int64_t value, bool folded);
+Symbol *symbol_define_atom(Assembler *as, uint32_t atom, SymbolType type, int64_t value);
 bool symbol_is_defined(Assembler *as, const char *name);
+Symbol *symbol_seed(Assembler *as, const char *name, SymbolType type, int64_t value);
+void symbols_drop_seeds(Assembler *as);
+
+/* Source cache */
+SourceFile *source_load(Assembler *as, const char *path);
+SourceFile *source_open(Assembler *as, const char *path);
+void source_forget(Assembler *as, const char *path);
+void source_free_all(Assembler *as);
+
+/* Counted heap allocation (see alloc.c) */
+void *as_malloc(size_t size);
+void *as_calloc(size_t count, size_t size);
+void *as_realloc(void *ptr, size_t size);
+char *as_strdup(const char *s);
+uint64_t alloc_count(void);
+
+/* Arena */
+void arena_init(Arena *arena);
+void *arena_alloc(Arena *arena, size_t size);
+char *arena_strdup(Arena *arena, const char *s);
+ArenaMark arena_mark(Arena *arena);
+void arena_release(Arena *arena, ArenaMark mark);
+void arena_reset(Arena *arena);
+void arena_free(Arena *arena);
 
 /* Expressions */
 bool expr_parse(Assembler *as, int64_t *result, bool *known, bool *is_constant);
+bool expr_parse_folded(Assembler *as, int64_t *result, bool *known, bool *is_constant, bool *folded);
+ExprNode *expr_parse_tree(Assembler *as, Arena *arena);
+ExprNode *expr_negate(Arena *arena, ExprNode *tree);
+ExprCode *expr_compile(Assembler *as, Arena *arena, const ExprNode *tree);
+const ExprCode *expr_parse_code(Assembler *as, Arena *arena);
+bool expr_eval(Assembler *as, const ExprCode *code, int64_t *result, bool *known, bool *is_constant);
+
+/* Statement recording and replay */
+void ir_begin(Assembler *as);
+void ir_free(Assembler *as);
+bool ir_is_recording(Assembler *as);
+void ir_record_label(Assembler *as, const char *name);
+void ir_record_line(Assembler *as, DirectiveId directive, const char *line,
+                    const LineToken *tokens, int count);
+void ir_data_begin(Assembler *as);
+void ir_data_add(Assembler *as, uint8_t width, const char *text, size_t length,
+                 const ExprCode *code);
+void ir_data_end(Assembler *as);
+size_t ir_record_include(Assembler *as, const char *path);
+void ir_record_include_end(Assembler *as, size_t include);
+void ir_record_insn(Assembler *as, const char *mnemonic, EncoderFunc encoder,
+                    const Operand *operands, int operand_count, bool has_label,
+                    uint32_t size, const char *line, const LineToken *tokens, int count);
+void ir_invalidate(Assembler *as);
+void ir_finish_recording(Assembler *as);
+void ir_set_grow_only(Assembler *as);
+void ir_touch(Assembler *as, const Symbol *sym);
+bool ir_replay(Assembler *as);
+void ir_replay_range(Assembler *as, size_t first, size_t end);
+
+/* Parallel pass 2 */
+void parallel_encode(Assembler *as);
+bool parallel_take(Assembler *as, size_t *index);
+void parallel_free(Assembler *as);
 
 /* Parser */
 bool parse_line(Assembler *as, const char *line);
+bool parse_line_tokens(Assembler *as, const char *line, const LineToken *tokens, int count);
 bool parse_operand(Assembler *as, Operand *op);
+bool parse_unencoded(Assembler *as, const char *mnemonic, bool has_label,
+                     Operand *operands, int operand_count, bool *bare_label);
+bool is_register_name(const char *name);
+void parser_register_keywords(void);
 
 /* Code generation */
 void emit_byte(Assembler *as, uint8_t b);
 void emit_word(Assembler *as, uint16_t w);
 void emit_long(Assembler *as, uint32_t l);
+void emit_bytes(Assembler *as, const uint8_t *data, size_t len);
+void emit_fill_block(Assembler *as, size_t count, uint8_t value);
+uint8_t *output_flatten(Assembler *as);
+const char *output_format_extension(OutputFormat format);
+void output_capture_init(OutputCapture *cap, Arena *arena, size_t size);
+void output_capture_add(OutputCapture *cap, uint32_t addr, const uint8_t *data, uint8_t fill, size_t len);
+void output_capture_replay(Assembler *as, const OutputCapture *cap);
+void output_capture_free(OutputCapture *cap);
 bool encode_instruction(Assembler *as, const char *mnemonic, Operand *operands, int operand_count);
+EncoderFunc encode_lookup(const char *mnemonic);
+void encode_register_keywords(void);
+int direct_addr_size(const Operand *op);
+bool encode_size_fixed(EncoderFunc encoder, const Operand *ops, int count);
 
 /* Directives */
 bool handle_directive(Assembler *as, const char *directive, const char *args);
+bool handle_directive_id(Assembler *as, DirectiveId id, const char *label);
+void directives_register_keywords(void);
 
 /* Main assembler */
 Assembler *assembler_new(void);
+Assembler *assembler_new_shared(const Assembler *base);
 void assembler_free(Assembler *as);
+double assembler_clock(void);
+void stats_print(Assembler *as);
 bool assembler_assemble_file(Assembler *as, const char *filename);
 bool assembler_write_output(Assembler *as, const char *filename);
+bool assembler_include_file(Assembler *as, const char *filename);
+bool assembler_include_path(Assembler *as, const char *path);
+bool assembler_resolve_include(const char *current_file, const char *filename,
+                               char *resolved_path, size_t size);
+
+/* Listing and symbol map (see listing.c) */
+bool listing_open(Assembler *as, const char *filename);
+void listing_emit(Assembler *as, uint32_t addr, const uint8_t *data, uint8_t fill, size_t len);
+void listing_capture(Assembler *as, const OutputCapture *cap, uint32_t lo, uint32_t hi);
+bool listing_close(Assembler *as);
+bool map_write(Assembler *as, const char *filename);
+bool sizemap_write(Assembler *as, const char *filename);
+
+/* Reference comparison (see compare.c) */
+bool compare_open(Assembler *as, const char *reference, int limit);
+void compare_emit(Assembler *as, uint32_t addr, const uint8_t *data, uint8_t fill, size_t len);
+void compare_capture(Assembler *as, const OutputCapture *cap, uint32_t lo, uint32_t hi);
+bool compare_close(Assembler *as);
+
+/* Building targets (see batch.c) */
+typedef struct {
+    bool verbose;
+    bool use_cache;
+    int threads;                /* Pass 2 threads per target */
+    bool stats;                 /* Report timings and counters */
+    bool listing;               /* Write output.lst */
+    bool map;                   /* Write output.map */
+    OutputFormat format;
+    uint32_t bank_size;         /* Split output into banks this large */
+    bool symbols_only;          /* Write output.sym instead of an image */
+    const char *compare;        /* Reference image to check pass 2 against */
+    int compare_limit;          /* Differing lines reported before stopping */
+} BuildOptions;
+
+void build_default_output(const BuildOptions *opt, const char *input, char *output, size_t size);
+void build_sibling_path(const char *path, const char *ext, char *sibling, size_t size);
+bool build_target(const BuildOptions *opt, const char *input, const char *output,
+                  const Assembler *shared, DiagBuffer *diags);
+int build_batch(const BuildOptions *opt, const char *manifest, int jobs);
+bool build_scan_include(const char *line, const char *directive, char *name, size_t size);
+int build_watch(const BuildOptions *opt, const char *input, const char *output);
+
+/* Little-endian binary files (see binfile.c) */
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    size_t pos;
+    bool ok;                    /* False once a read ran past the data */
+} BinReader;
+
+bool bin_load(const char *path, BinReader *r);
+bool bin_read_bytes(BinReader *r, void *out, size_t len);
+uint32_t bin_read_u32(BinReader *r);
+uint64_t bin_read_u64(BinReader *r);
+char *bin_read_string(BinReader *r);
+size_t bin_read_count(BinReader *r, size_t min_size);
+void bin_write_u32(FILE *fp, uint32_t v);
+void bin_write_u64(FILE *fp, uint64_t v);
+void bin_write_string(FILE *fp, const char *s);
+
+/* Precompiled headers */
+bool pch_emit(const char *header, bool verbose);
+bool pch_apply(Assembler *as, SourceFile *src);
+void pch_free(Assembler *as);
+
+/* Build cache */
+void cache_begin(Assembler *as);
+bool cache_load(Assembler *as, const char *path);
+bool cache_save(Assembler *as, const char *path);
+void cache_free(Assembler *as);
+bool cache_enter(Assembler *as, SourceFile *src);
+void cache_leave(Assembler *as);
+void cache_note_ref(Assembler *as, Symbol *sym);
+void cache_note_def(Assembler *as, Symbol *sym);
+void cache_note_macro(Assembler *as, Symbol *macro);
+void cache_note_output(Assembler *as, uint32_t addr, const uint8_t *data, uint8_t fill, size_t len);
+void cache_note_volatile(Assembler *as);
 
 /* Error reporting */
 void error(Assembler *as, const char *fmt, ...);
 void warning(Assembler *as, const char *fmt, ...);
+void diag_message(Assembler *as, const char *fmt, ...);
+void diag_begin(Assembler *as);
+void diag_finish(Assembler *as);
+void diag_flush(Assembler *as, const DiagList *list);
+void diag_list_free(DiagList *list);
 
 #endif /* TLCS900_H */
@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	XOR B, 149
+L1:
+	AND C, (XHL-40)
+L2:
+	CP DE, 6454
+L3:
+	ADD C, E
+L4:
+	SBC DE, 18341
+L5:
+	AND D, W
+L6:
+	OR IY, 51914
+L7:
+	ADD DE, 37518
+L8:
+	XOR H, (XIY+87:8)
+L9:
+	ADC E, 175
+L10:
+	AND C, 2
+L11:
+	SUB XWA, XIX
+L12:
+	ADD L, W
+L13:
+	AND L, 118
+L14:
+	CP DE, 54957
+L15:
+	SBC W, (XDE+1619:16)
+L16:
+	CP B, (L13)
+L17:
+	ADD E, B
+L18:
+	AND W, 205
+L19:
+	OR L, 83
+L20:
+	OR (FAR), W
+L21:
+	SBC A, (FAR)
+L22:
+	SBC C, L
+L23:
+	ADC IZ, 26945
+L24:
+	AND (XHL+89), B
+L25:
+	CP (XIZ+36:8), D
+L26:
+	AND E, (XIZ+29618:16)
+L27:
+	ADC H, (FAR)
+L28:
+	ADC IX, 33610
+L29:
+	ADC XBC, XBC
+L30:
+	SBC WA, 16282
+L31:
+	SUB A, 101
+L32:
+	SBC IX, 45814
+L33:
+	AND BC, 61705
+L34:
+	CP XIX, XDE
+L35:
+	ADC L, C
+L36:
+	AND E, (L38)
+L37:
+	OR XIX, XWA
+L38:
+	CP B, 161
+L39:
+	ADC HL, 22839
+L40:
+	SBC XHL, XIZ
+L41:
+	XOR E, 131
+L42:
+	ADC (XIX+123:8), C
+L43:
+	OR D, 33
+L44:
+	SBC (XIZ+28191:16), L
+L45:
+	OR HL, 21733
+L46:
+	ADC B, (XWA+B)
+L47:
+	SUB HL, 19944
+L48:
+	AND C, 58
+L49:
+	OR L, 8
+L50:
+	ADC H, D
+L51:
+	CP IY, 32033
+L52:
+	ADC IZ, 10821
+L53:
+	SBC E, (XIX-8)
+L54:
+	XOR XHL, XWA
+L55:
+	XOR C, H
+L56:
+	OR (L59), A
+L57:
+	XOR WA, 36976
+L58:
+	ADD XIZ, XIY
+L59:
+	ADC L, B
+L60:
+	ADD B, E
+L61:
+	OR L, 148
+L62:
+	SBC L, A
+L63:
+	CP WA, 39539
+L64:
+	XOR W, (L65:24)
+L65:
+	AND XIY, XBC
+L66:
+	AND WA, 4413
+L67:
+	CP B, (BIGREG)
+L68:
+	SBC C, W
+L69:
+	SUB W, C
+L70:
+	XOR D, E
+L71:
+	CP IZ, 40384
+L72:
+	OR W, (L1132)
+L73:
+	SUB W, 122
+L74:
+	SUB XWA, XWA
+L75:
+	ADD D, (XBC+56)
+L76:
+	SUB W, 28
+L77:
+	ADC (XWA+BC), B
+L78:
+	XOR B, E
+L79:
+	OR E, 64
+L80:
+	ADD L, (P0)
+L81:
+	OR XWA, XIZ
+L82:
+	AND (XIX+50), A
+L83:
+	ADD C, (XIX+2545)
+L84:
+	XOR D, L
+L85:
+	AND C, (XIY-47)
+L86:
+	XOR L, 107
+L87:
+	OR H, (XBC+23:8)
+L88:
+	ADD XHL, XIX
+L89:
+	CP L, B
+L90:
+	SUB IZ, 52354
+L91:
+	OR IY, 18656
+L92:
+	ADD HL, 48669
+L93:
+	XOR D, (L96)
+L94:
+	ADD IX, 13957
+L95:
+	SBC E, A
+L96:
+	OR L, (XDE-17)
+L97:
+	ADD XBC, XIY
+L98:
+	SUB (XHL+27716:16), E
+L99:
+	CP IX, 42572
+L100:
+	XOR (L96:24), E
+L101:
+	ADC B, (XIZ+96:8)
+L102:
+	ADC XWA, XIY
+L103:
+	OR B, (XWA+BC)
+L104:
+	ADD (XBC), H
+L105:
+	XOR HL, 39400
+L106:
+	SBC XIY, XIX
+L107:
+	ADD IZ, 3371
+L108:
+	CP C, 201
+L109:
+	XOR XBC, XHL
+L110:
+	OR IX, 13672
+L111:
+	ADC C, 43
+L112:
+	SBC A, 165
+L113:
+	OR C, H
+L114:
+	CP D, 91
+L115:
+	OR IZ, 26509
+L116:
+	SBC (XIX+1742), C
+L117:
+	CP L, (L214:24)
+L118:
+	ADD A, 70
+L119:
+	CP W, (L122)
+L120:
+	OR E, B
+L121:
+	AND IX, 26532
+L122:
+	SUB BC, 12798
+L123:
+	XOR A, C
+L124:
+	SBC XDE, XIZ
+L125:
+	ADD D, (XDE+95)
+L126:
+	SUB C, (XWA+BC)
+L127:
+	ADD C, (XIZ+24350:16)
+L128:
+	CP XWA, XHL
+L129:
+	SBC A, (L29:24)
+L130:
+	OR XWA, XDE
+L131:
+	SUB XWA, XDE
+L132:
+	OR (L130), W
+L133:
+	SUB W, B
+L134:
+	CP XIZ, XIY
+L135:
+	XOR XDE, XWA
+L136:
+	OR XWA, XIZ
+L137:
+	ADC XHL, XWA
+L138:
+	CP A, D
+L139:
+	SBC BC, 25226
+L140:
+	ADD C, 209
+L141:
+	ADC D, D
+L142:
+	ADD W, 176
+L143:
+	XOR H, 224
+L144:
+	XOR (XIY), A
+L145:
+	SBC A, (BIGREG)
+L146:
+	ADC A, (L142)
+L147:
+	XOR C, (XWA+BC)
+L148:
+	AND B, (XHL+102:8)
+L149:
+	SUB E, H
+L150:
+	XOR H, (XDE)
+L151:
+	SUB H, (XWA+58)
+L152:
+	ADD XBC, XBC
+L153:
+	ADD D, 179
+L154:
+	SUB E, E
+L155:
+	SBC H, (XIX+497)
+L156:
+	AND H, (XDE-31)
+L157:
+	OR IY, 38954
+L158:
+	AND W, (XIX+928)
+L159:
+	ADC (XWA+B), H
+L160:
+	XOR DE, 42814
+L161:
+	AND D, (XBC-31)
+L162:
+	XOR L, C
+L163:
+	CP C, (XWA+19251:16)
+L164:
+	XOR H, 117
+L165:
+	AND XIY, XIX
+L166:
+	ADD (L2842:24), B
+L167:
+	AND L, B
+L168:
+	AND XHL, XBC
+L169:
+	SBC BC, 22795
+L170:
+	CP XBC, XBC
+L171:
+	ADC XBC, XDE
+L172:
+	ADD W, (XBC)
+L173:
+	CP C, (XWA+BC)
+L174:
+	XOR XIY, XIX
+L175:
+	CP E, 35
+L176:
+	AND XIY, XIZ
+L177:
+	SBC L, E
+L178:
+	SBC (XIX-70), H
+L179:
+	SUB C, 39
+L180:
+	ADC D, (L181)
+L181:
+	AND IX, 44199
+L182:
+	ADD C, 0
+L183:
+	SUB D, (XIZ+24072:16)
+L184:
+	CP B, W
+L185:
+	ADC D, A
+L186:
+	SBC B, 230
+L187:
+	AND IZ, 64395
+L188:
+	ADD XDE, XHL
+L189:
+	XOR BC, 47823
+L190:
+	SBC (XIZ+80), B
+L191:
+	AND D, (XDE+79:8)
+L192:
+	SBC XDE, XHL
+L193:
+	OR W, (XWA-95)
+L194:
+	AND IY, 5352
+L195:
+	SBC D, 2
+L196:
+	SUB L, (P0)
+L197:
+	ADC (XDE), E
+L198:
+	ADD H, B
+L199:
+	AND H, W
+L200:
+	SUB E, D
+L201:
+	ADC H, 255
+L202:
+	ADC XIY, XHL
+L203:
+	SUB L, 238
+L204:
+	SUB A, 189
+L205:
+	SBC D, B
+L206:
+	SUB XWA, XHL
+L207:
+	SBC B, 60
+L208:
+	XOR (FAR), D
+L209:
+	CP HL, 10075
+L210:
+	SBC BC, 3614
+L211:
+	CP B, (XIZ)
+L212:
+	CP BC, 18787
+L213:
+	OR XHL, XIZ
+L214:
+	XOR IY, 37095
+L215:
+	AND W, (XIZ+64)
+L216:
+	ADD H, 14
+L217:
+	ADD A, (XWA+B)
+L218:
+	CP C, (FAR)
+L219:
+	SBC L, D
+L220:
+	XOR XDE, XIX
+L221:
+	XOR A, (L223:24)
+L222:
+	OR D, (XIX+11707:16)
+L223:
+	CP C, 131
+L224:
+	SUB A, (BIGREG)
+L225:
+	ADC D, 128
+L226:
+	ADC W, (L2221)
+L227:
+	XOR D, L
+L228:
+	ADC D, (XDE+53:8)
+L229:
+	SUB XBC, XIY
+L230:
+	XOR (XIX+22349:16), A
+L231:
+	SUB C, A
+L232:
+	SUB XIY, XIX
+L233:
+	XOR XDE, XIX
+L234:
+	SUB IX, 47334
+L235:
+	ADC D, 197
+L236:
+	ADD C, 154
+L237:
+	SUB BC, 29493
+L238:
+	ADC L, 57
+L239:
+	CP (XDE+61:8), B
+L240:
+	ADC IZ, 19505
+L241:
+	AND L, 219
+L242:
+	XOR IX, 53359
+L243:
+	XOR L, 108
+L244:
+	OR DE, 48322
+L245:
+	AND A, 183
+L246:
+	XOR W, W
+L247:
+	OR B, (L2169)
+L248:
+	CP (L251), C
+L249:
+	ADD A, A
+L250:
+	OR W, (XIY+11:8)
+L251:
+	OR (XIX+2244), D
+L252:
+	SBC HL, 36134
+L253:
+	AND (XIZ), D
+L254:
+	CP XWA, XWA
+L255:
+	ADC XBC, XBC
+L256:
+	SBC B, B
+L257:
+	CP W, C
+L258:
+	XOR C, (XDE+9109:16)
+L259:
+	XOR HL, 33424
+L260:
+	ADD L, (XIX+560)
+L261:
+	SUB H, (XIZ)
+L262:
+	OR XHL, XIY
+L263:
+	SBC XBC, XIZ
+L264:
+	XOR IZ, 65311
+L265:
+	SUB XHL, XIY
+L266:
+	AND (BIGREG), D
+L267:
+	CP H, 205
+L268:
+	SUB C, W
+L269:
+	AND (XWA), C
+L270:
+	SUB C, (P0)
+L271:
+	XOR XIZ, XDE
+L272:
+	ADD XDE, XBC
+L273:
+	XOR L, (XHL+9006:16)
+L274:
+	ADC XIX, XIZ
+L275:
+	ADD A, A
+L276:
+	XOR DE, 48532
+L277:
+	ADD D, (L275:24)
+L278:
+	SUB L, 241
+L279:
+	OR (XWA+77), H
+L280:
+	AND (P0), D
+L281:
+	ADC BC, 50490
+L282:
+	ADC A, 168
+L283:
+	CP D, L
+L284:
+	OR XIZ, XDE
+L285:
+	SUB (XWA+BC), C
+L286:
+	SUB L, (XHL-59)
+L287:
+	ADD H, 35
+L288:
+	ADC H, C
+L289:
+	SUB XIY, XBC
+L290:
+	ADC (L287:24), A
+L291:
+	CP D, (L291)
+L292:
+	SBC IX, 11307
+L293:
+	ADD E, 16
+L294:
+	ADD L, 218
+L295:
+	ADC (P0), B
+L296:
+	OR L, D
+L297:
+	ADC XIZ, XIY
+L298:
+	CP DE, 26225
+L299:
+	ADC XHL, XHL
+L300:
+	SBC IX, 48906
+L301:
+	XOR W, (XIZ+82)
+L302:
+	SBC XIY, XIZ
+L303:
+	ADD B, (XWA+BC)
+L304:
+	SUB IZ, 47260
+L305:
+	AND XBC, XIZ
+L306:
+	OR XDE, XIY
+L307:
+	AND XWA, XBC
+L308:
+	ADD D, L
+L309:
+	XOR H, (XBC-83)
+L310:
+	OR XIY, XWA
+L311:
+	SBC IX, 49080
+L312:
+	SUB (L314:24), B
+L313:
+	AND IX, 29997
+L314:
+	AND IY, 53295
+L315:
+	OR D, (XIZ)
+L316:
+	OR H, B
+L317:
+	AND C, E
+L318:
+	AND E, D
+L319:
+	OR (XWA-32), B
+L320:
+	ADC D, (XWA+BC)
+L321:
+	AND C, 56
+L322:
+	SBC XIZ, XWA
+L323:
+	ADD XIX, XDE
+L324:
+	XOR B, (XIX+1106)
+L325:
+	CP (XIX+2057), E
+L326:
+	OR B, 238
+L327:
+	ADC C, 74
+L328:
+	ADD E, (XIX-67)
+L329:
+	SUB (L331), B
+L330:
+	ADD B, B
+L331:
+	AND A, 205
+L332:
+	CP (XWA+24), A
+L333:
+	SUB L, (XIY+85:8)
+L334:
+	SBC W, E
+L335:
+	AND XBC, XBC
+L336:
+	SBC E, (XIY-96)
+L337:
+	SUB W, 223
+L338:
+	SUB B, D
+L339:
+	CP C, (XDE-7)
+L340:
+	ADC H, H
+L341:
+	OR XIY, XIX
+L342:
+	AND (FAR), D
+L343:
+	SBC E, 126
+L344:
+	OR W, (XIX+1825)
+L345:
+	OR C, E
+L346:
+	SUB (FAR), H
+L347:
+	SUB IY, 55115
+L348:
+	ADC D, (L345)
+L349:
+	OR (XDE), E
+L350:
+	ADC B, B
+L351:
+	OR XDE, XHL
+L352:
+	SUB E, H
+L353:
+	SBC XBC, XIZ
+L354:
+	OR C, B
+L355:
+	AND (XWA+102:8), H
+L356:
+	XOR D, (XIZ-8)
+L357:
+	ADD BC, 54791
+L358:
+	ADD D, 233
+L359:
+	SBC XIY, XIX
+L360:
+	OR XWA, XDE
+L361:
+	SUB C, L
+L362:
+	SUB XHL, XWA
+L363:
+	OR E, B
+L364:
+	OR L, L
+L365:
+	AND (XIY+971:16), B
+L366:
+	ADC E, E
+L367:
+	SUB D, 42
+L368:
+	ADD XDE, XWA
+L369:
+	SUB D, A
+L370:
+	OR XIY, XIX
+L371:
+	SBC H, A
+L372:
+	SUB A, C
+L373:
+	SUB XHL, XBC
+L374:
+	AND BC, 21680
+L375:
+	XOR L, A
+L376:
+	ADD H, 172
+L377:
+	ADC (L373:24), W
+L378:
+	OR (BIGREG), C
+L379:
+	OR A, (XIX+1855)
+L380:
+	OR XIZ, XWA
+L381:
+	SBC W, 1
+L382:
+	CP L, (XIX-83)
+L383:
+	ADD A, 193
+L384:
+	OR B, (FAR)
+L385:
+	ADC XBC, XHL
+L386:
+	OR HL, 59214
+L387:
+	OR XIY, XIX
+L388:
+	XOR E, 22
+L389:
+	CP C, B
+L390:
+	ADC H, 191
+L391:
+	ADC W, D
+L392:
+	SBC W, 129
+L393:
+	ADC (XWA), C
+L394:
+	SUB XIZ, XIY
+L395:
+	SBC L, B
+L396:
+	CP WA, 4146
+L397:
+	XOR XIY, XIZ
+L398:
+	CP DE, 28583
+L399:
+	XOR L, 62
+L400:
+	AND (L4946), E
+L401:
+	SUB L, (BIGREG)
+L402:
+	AND D, 241
+L403:
+	AND XIY, XBC
+L404:
+	SUB D, 10
+L405:
+	ADC W, (XBC+123:8)
+L406:
+	OR XIX, XIZ
+L407:
+	ADD (BIGREG), A
+L408:
+	ADD XBC, XHL
+L409:
+	XOR XIY, XBC
+L410:
+	SUB (XIY+23:8), B
+L411:
+	SUB (L4249:24), A
+L412:
+	ADD W, 70
+L413:
+	SUB (XIZ+0:8), E
+L414:
+	CP XIZ, XHL
+L415:
+	CP A, (XWA)
+L416:
+	SBC DE, 60360
+L417:
+	XOR HL, 24947
+L418:
+	ADD XIY, XHL
+L419:
+	SBC E, 155
+L420:
+	ADD BC, 24483
+L421:
+	AND C, (XWA+BC)
+L422:
+	SUB XDE, XDE
+L423:
+	ADC E, 158
+L424:
+	OR C, 241
+L425:
+	AND C, (L1430:24)
+L426:
+	AND D, A
+L427:
+	AND XWA, XHL
+L428:
+	SBC XBC, XIY
+L429:
+	SUB H, (XHL)
+L430:
+	SUB XIY, XHL
+L431:
+	CP XHL, XIY
+L432:
+	CP L, (XIZ+50:8)
+L433:
+	SUB XBC, XWA
+L434:
+	OR D, 223
+L435:
+	XOR XWA, XHL
+L436:
+	XOR IZ, 44023
+L437:
+	OR (XWA+B), B
+L438:
+	ADC IZ, 30404
+L439:
+	XOR (XWA+BC), W
+L440:
+	CP (XBC+35), W
+L441:
+	ADD XHL, XBC
+L442:
+	ADC C, 129
+L443:
+	OR B, 0
+L444:
+	XOR (L448), W
+L445:
+	OR A, 161
+L446:
+	SUB C, (XIX-5)
+L447:
+	SBC XIX, XIY
+L448:
+	OR (XIX+71), H
+L449:
+	XOR (L4361:24), E
+L450:
+	SBC H, 20
+L451:
+	ADD (XIX+1798), D
+L452:
+	XOR H, (L448)
+L453:
+	AND XWA, XBC
+L454:
+	ADC IZ, 8511
+L455:
+	ADD (XDE+25532:16), A
+L456:
+	SBC XWA, XIZ
+L457:
+	SBC XDE, XIZ
+L458:
+	ADD A, C
+L459:
+	CP W, 137
+L460:
+	AND BC, 5812
+L461:
+	OR (XIX), E
+L462:
+	SBC XIX, XIY
+L463:
+	SUB C, (L462)
+L464:
+	CP IX, 52120
+L465:
+	OR (XWA+126:8), E
+L466:
+	CP B, A
+L467:
+	ADC W, 229
+L468:
+	ADD XIY, XBC
+L469:
+	ADD L, D
+L470:
+	SUB (XIY+15940:16), W
+L471:
+	AND DE, 9293
+L472:
+	CP H, (XIY-1)
+L473:
+	OR B, E
+L474:
+	ADC L, E
+L475:
+	CP B, (FAR)
+L476:
+	CP W, E
+L477:
+	CP C, C
+L478:
+	ADC L, A
+L479:
+	SUB IX, 65157
+L480:
+	SBC D, L
+L481:
+	ADC DE, 13719
+L482:
+	AND IY, 40465
+L483:
+	SUB (XIZ+17077:16), A
+L484:
+	SBC A, L
+L485:
+	XOR HL, 17309
+L486:
+	ADC D, (XDE+53:8)
+L487:
+	ADC HL, 49013
+L488:
+	OR XWA, XIZ
+L489:
+	AND (XIX+2545), D
+L490:
+	XOR (XIX+1218), H
+L491:
+	OR WA, 38923
+L492:
+	AND E, 103
+L493:
+	AND A, (XWA)
+L494:
+	OR D, W
+L495:
+	AND D, A
+L496:
+	AND XWA, XWA
+L497:
+	XOR C, C
+L498:
+	SBC L, 197
+L499:
+	AND XHL, XBC
+L500:
+	CP E, 27
+L501:
+	AND XHL, XIZ
+L502:
+	CP C, (XIZ+45:8)
+L503:
+	AND (XIZ+41), B
+L504:
+	OR B, (XBC-60)
+L505:
+	CP BC, 22422
+L506:
+	OR W, A
+L507:
+	ADC XDE, XIZ
+L508:
+	ADD (XIX+78:8), L
+L509:
+	XOR H, A
+L510:
+	ADD IX, 27677
+L511:
+	ADD E, (XIZ+17685:16)
+L512:
+	ADC E, W
+L513:
+	AND E, 94
+L514:
+	AND XIX, XWA
+L515:
+	OR WA, 9857
+L516:
+	SUB C, L
+L517:
+	ADC (XBC), L
+L518:
+	AND A, A
+L519:
+	CP XIX, XWA
+L520:
+	CP IX, 28108
+L521:
+	ADD IY, 58733
+L522:
+	ADD BC, 55526
+L523:
+	OR D, 32
+L524:
+	XOR IX, 13756
+L525:
+	CP XHL, XDE
+L526:
+	OR (XWA+B), C
+L527:
+	CP D, 206
+L528:
+	XOR E, C
+L529:
+	SBC H, (L4979)
+L530:
+	CP E, (L4584:24)
+L531:
+	AND B, (BIGREG)
+L532:
+	SUB D, A
+L533:
+	SBC BC, 15812
+L534:
+	CP XIY, XHL
+L535:
+	AND A, 163
+L536:
+	OR C, L
+L537:
+	ADC IX, 55468
+L538:
+	CP (XDE-59), D
+L539:
+	OR (XDE+101:8), A
+L540:
+	ADD D, L
+L541:
+	SBC (XWA+B), B
+L542:
+	SUB XBC, XIZ
+L543:
+	ADC H, 149
+L544:
+	OR (XIY+95), A
+L545:
+	SUB (XIX+1152), L
+L546:
+	ADC (XWA-31), H
+L547:
+	ADD E, D
+L548:
+	ADD D, (L548)
+L549:
+	SUB XWA, XWA
+L550:
+	XOR H, 27
+L551:
+	SBC BC, 44801
+L552:
+	SBC E, D
+L553:
+	SUB WA, 2155
+L554:
+	XOR IY, 17105
+L555:
+	XOR E, (XWA+BC)
+L556:
+	XOR (XBC+98:8), A
+L557:
+	SBC C, (XIX+1046)
+L558:
+	ADC C, (XWA+95:8)
+L559:
+	OR A, D
+L560:
+	CP E, (L560:24)
+L561:
+	ADD XIY, XHL
+L562:
+	SUB IZ, 58861
+L563:
+	AND WA, 47934
+L564:
+	OR E, 204
+L565:
+	SUB (BIGREG), W
+L566:
+	SUB HL, 65040
+L567:
+	AND WA, 65102
+L568:
+	SUB L, (XWA+8:8)
+L569:
+	XOR W, (XIX+2419)
+L570:
+	CP WA, 4981
+L571:
+	XOR IX, 30888
+L572:
+	ADD XWA, XBC
+L573:
+	SUB (XIZ+90), B
+L574:
+	ADD (P0), A
+L575:
+	ADD IY, 35583
+L576:
+	XOR HL, 55963
+L577:
+	SUB XIY, XWA
+L578:
+	ADC (XWA+B), B
+L579:
+	XOR XIX, XIZ
+L580:
+	CP D, B
+L581:
+	CP D, E
+L582:
+	ADC D, (XIX+2582)
+L583:
+	AND XIX, XIZ
+L584:
+	SUB IZ, 23063
+L585:
+	SUB XIX, XIZ
+L586:
+	CP C, 199
+L587:
+	SBC BC, 33631
+L588:
+	SUB XIX, XIZ
+L589:
+	ADD (BIGREG), B
+L590:
+	SUB B, L
+L591:
+	SBC (XIZ+47), C
+L592:
+	ADD D, E
+L593:
+	ADC E, 196
+L594:
+	OR BC, 43677
+L595:
+	SUB XIX, XWA
+L596:
+	CP C, B
+L597:
+	SBC A, (XHL+42)
+L598:
+	OR XBC, XWA
+L599:
+	OR W, W
+L600:
+	AND IZ, 11138
+L601:
+	ADC DE, 60375
+L602:
+	XOR (XHL+3), A
+L603:
+	SUB B, 218
+L604:
+	ADC XDE, XIX
+L605:
+	OR L, H
+L606:
+	CP IZ, 62565
+L607:
+	OR (XIZ+6322:16), D
+L608:
+	ADC W, C
+L609:
+	SBC L, H
+L610:
+	ADD W, (XDE)
+L611:
+	SBC E, (L614)
+L612:
+	XOR E, 243
+L613:
+	ADC IX, 39477
+L614:
+	XOR XWA, XIY
+L615:
+	ADC L, (L619:24)
+L616:
+	AND (XIX+1701:16), B
+L617:
+	AND (XIZ+41:8), A
+L618:
+	SBC A, (XHL+1858:16)
+L619:
+	AND L, (FAR)
+L620:
+	SBC W, (L623:24)
+L621:
+	ADD (XIX-90), C
+L622:
+	SUB XIY, XHL
+L623:
+	ADC (XWA+BC), H
+L624:
+	CP IZ, 43113
+L625:
+	XOR XHL, XDE
+L626:
+	CP L, B
+L627:
+	CP IY, 48631
+L628:
+	XOR L, (L625:24)
+L629:
+	OR D, 199
+L630:
+	XOR XBC, XIZ
+L631:
+	XOR (XIZ+21148:16), L
+L632:
+	SBC (XIX+1937), H
+L633:
+	AND XIX, XWA
+L634:
+	ADC B, (L632:24)
+L635:
+	ADD (XIY), E
+L636:
+	XOR XHL, XIZ
+L637:
+	SBC HL, 62329
+L638:
+	OR E, (L640)
+L639:
+	ADD XIY, XBC
+L640:
+	ADD (XDE), H
+L641:
+	XOR W, 226
+L642:
+	ADD XHL, XDE
+L643:
+	AND E, 116
+L644:
+	OR IX, 48189
+L645:
+	XOR (XDE), E
+L646:
+	OR E, H
+L647:
+	ADC A, 171
+L648:
+	XOR W, (XBC+100)
+L649:
+	XOR L, 161
+L650:
+	CP (XBC+14984:16), H
+L651:
+	SBC L, 135
+L652:
+	XOR XIY, XWA
+L653:
+	ADC L, 251
+L654:
+	SUB (XIX+2919), W
+L655:
+	SBC B, D
+L656:
+	SUB (XBC-86), A
+L657:
+	XOR A, W
+L658:
+	AND B, 55
+L659:
+	AND XHL, XIX
+L660:
+	OR E, A
+L661:
+	AND WA, 36842
+L662:
+	CP (XIX), D
+L663:
+	AND A, W
+L664:
+	XOR W, 190
+L665:
+	ADD XHL, XBC
+L666:
+	ADC E, 171
+L667:
+	XOR XWA, XIY
+L668:
+	ADD XHL, XDE
+L669:
+	SBC XIZ, XIZ
+L670:
+	ADD W, C
+L671:
+	AND W, (XIX+62)
+L672:
+	SBC XBC, XBC
+L673:
+	ADC XBC, XBC
+L674:
+	ADC D, 11
+L675:
+	OR A, W
+L676:
+	SUB E, (L679:24)
+L677:
+	ADC (XIY+51:8), D
+L678:
+	CP D, 41
+L679:
+	ADD E, (L35:24)
+L680:
+	SBC XWA, XHL
+L681:
+	SUB WA, 21960
+L682:
+	SUB D, (XIX+25286:16)
+L683:
+	OR A, 198
+L684:
+	SUB XDE, XWA
+L685:
+	ADD L, A
+L686:
+	OR (XIY-75), E
+L687:
+	ADD (XWA+BC), E
+L688:
+	SUB E, 154
+L689:
+	AND WA, 62921
+L690:
+	ADD XBC, XHL
+L691:
+	CP A, (XWA+67:8)
+L692:
+	CP B, W
+L693:
+	ADC B, (FAR)
+L694:
+	ADD IX, 20132
+L695:
+	CP XWA, XBC
+L696:
+	ADD A, B
+L697:
+	XOR L, E
+L698:
+	XOR (XIY+8926:16), D
+L699:
+	OR E, (XDE+82:8)
+L700:
+	SUB B, E
+L701:
+	ADD IZ, 8820
+L702:
+	XOR C, 96
+L703:
+	SUB WA, 33727
+L704:
+	ADD L, (L701:24)
+L705:
+	SUB WA, 59528
+L706:
+	XOR HL, 15957
+L707:
+	SBC H, (XDE+17529:16)
+L708:
+	SUB A, D
+L709:
+	SBC E, 67
+L710:
+	SUB B, 213
+L711:
+	ADD L, 94
+L712:
+	OR B, (XHL+51)
+L713:
+	SUB (XDE-17), E
+L714:
+	SUB (XDE-11), W
+L715:
+	SUB E, 101
+L716:
+	SBC A, (XWA+B)
+L717:
+	SUB (L715), L
+L718:
+	OR B, (P0)
+L719:
+	XOR IY, 33277
+L720:
+	CP XHL, XWA
+L721:
+	SBC (XIX+335), E
+L722:
+	ADC DE, 1124
+L723:
+	SBC H, 47
+L724:
+	SUB A, A
+L725:
+	SBC HL, 8108
+L726:
+	CP B, E
+L727:
+	CP IZ, 32144
+L728:
+	SBC (FAR), L
+L729:
+	SBC XDE, XWA
+L730:
+	CP D, 118
+L731:
+	SBC BC, 19124
+L732:
+	SUB E, 89
+L733:
+	OR WA, 56866
+L734:
+	SUB B, A
+L735:
+	SBC A, (XWA+BC)
+L736:
+	ADC D, (XIX+1824)
+L737:
+	CP XIX, XDE
+L738:
+	AND L, D
+L739:
+	OR XIZ, XIZ
+L740:
+	SUB XHL, XWA
+L741:
+	OR L, (L2249)
+L742:
+	ADD D, E
+L743:
+	ADD IZ, 17573
+L744:
+	OR XWA, XIX
+L745:
+	CP (L1096), C
+L746:
+	SBC E, (XIX+445)
+L747:
+	ADD (XDE), H
+L748:
+	AND BC, 6759
+L749:
+	SBC (XIX+1272), D
+L750:
+	OR L, W
+L751:
+	SBC B, 22
+L752:
+	CP (XIX+1381), D
+L753:
+	CP C, (XHL+17)
+L754:
+	AND C, (XIY)
+L755:
+	ADD A, E
+L756:
+	SBC (P0), A
+L757:
+	SUB H, (XWA+BC)
+L758:
+	XOR (L762), L
+L759:
+	CP B, E
+L760:
+	XOR WA, 38653
+L761:
+	XOR (XIX-28), B
+L762:
+	CP B, H
+L763:
+	XOR (XDE), D
+L764:
+	ADD IZ, 24467
+L765:
+	SUB D, W
+L766:
+	CP E, 185
+L767:
+	ADC XIZ, XIZ
+L768:
+	ADC (XDE+12), A
+L769:
+	ADC A, E
+L770:
+	XOR E, C
+L771:
+	SUB (XIX+32), H
+L772:
+	XOR A, 40
+L773:
+	SBC XDE, XIY
+L774:
+	SBC B, E
+L775:
+	SBC H, C
+L776:
+	SBC (XIZ-87), L
+L777:
+	XOR (XWA+101:8), A
+L778:
+	SUB H, (FAR)
+L779:
+	OR XIY, XWA
+L780:
+	ADC WA, 39317
+L781:
+	OR XBC, XIY
+L782:
+	OR (XIX+1173), D
+L783:
+	SBC L, 45
+L784:
+	OR (XWA+BC), B
+L785:
+	SUB E, W
+L786:
+	ADC E, (BIGREG)
+L787:
+	ADC E, 227
+L788:
+	OR IX, 41660
+L789:
+	SBC E, H
+L790:
+	SBC DE, 35001
+L791:
+	AND L, (XWA-99)
+L792:
+	OR W, (XWA+B)
+L793:
+	ADD E, C
+L794:
+	SBC XHL, XHL
+L795:
+	SBC L, (XIX-80)
+L796:
+	OR C, (L794)
+L797:
+	OR E, (XWA+BC)
+L798:
+	ADD H, A
+L799:
+	XOR A, (XWA+BC)
+L800:
+	SUB XDE, XBC
+L801:
+	ADC (XIZ+35:8), W
+L802:
+	SBC C, L
+L803:
+	SUB B, (XHL)
+L804:
+	CP E, 234
+L805:
+	XOR XIY, XIX
+L806:
+	CP A, (P0)
+L807:
+	CP IZ, 11510
+L808:
+	ADD D, D
+L809:
+	ADD (XWA+BC), L
+L810:
+	OR (XBC+26), W
+L811:
+	OR L, 174
+L812:
+	SBC E, 246
+L813:
+	XOR IY, 32013
+L814:
+	XOR IZ, 56181
+L815:
+	SUB DE, 3320
+L816:
+	ADC W, 212
+L817:
+	ADD XIZ, XIY
+L818:
+	XOR A, (XWA+18240:16)
+L819:
+	ADD L, 210
+L820:
+	SBC E, H
+L821:
+	SBC XDE, XIY
+L822:
+	CP L, D
+L823:
+	OR W, 235
+L824:
+	ADD IY, 52118
+L825:
+	SBC H, (XIX+2002)
+L826:
+	XOR B, 240
+L827:
+	CP WA, 58466
+L828:
+	XOR (L829), A
+L829:
+	AND (XWA+B), C
+L830:
+	CP L, (XIX+1176)
+L831:
+	OR (XHL+10908:16), C
+L832:
+	AND L, 198
+L833:
+	ADD A, 189
+L834:
+	SUB A, L
+L835:
+	ADC (BIGREG), D
+L836:
+	SBC D, 213
+L837:
+	SBC XIY, XWA
+L838:
+	SUB BC, 7794
+L839:
+	AND L, (XIZ)
+L840:
+	SBC L, W
+L841:
+	ADD E, H
+L842:
+	ADD E, 144
+L843:
+	SBC H, (XIZ)
+L844:
+	OR BC, 21330
+L845:
+	AND H, (L842)
+L846:
+	ADC XIY, XDE
+L847:
+	OR E, E
+L848:
+	AND XIZ, XIZ
+L849:
+	CP D, (L845)
+L850:
+	ADD IX, 40185
+L851:
+	AND XIX, XBC
+L852:
+	XOR L, B
+L853:
+	ADD XHL, XDE
+L854:
+	ADC B, B
+L855:
+	CP (XHL-32), A
+L856:
+	SUB (XIX+388), L
+L857:
+	XOR H, 30
+L858:
+	XOR XIY, XIY
+L859:
+	SUB XIX, XBC
+L860:
+	ADD (XHL+3918:16), H
+L861:
+	ADC C, (XIY-15)
+L862:
+	ADD IY, 12505
+L863:
+	SBC E, B
+L864:
+	XOR XBC, XIZ
+L865:
+	XOR DE, 44015
+L866:
+	XOR (XIZ+14), E
+L867:
+	ADC IY, 55130
+L868:
+	ADC (XDE+28:8), C
+L869:
+	XOR A, A
+L870:
+	OR BC, 10899
+L871:
+	XOR HL, 43752
+L872:
+	OR (XIX+202), E
+L873:
+	XOR C, (XBC+97:8)
+L874:
+	CP WA, 2753
+L875:
+	ADC C, (XIX+942)
+L876:
+	XOR XBC, XIX
+L877:
+	AND XIX, XWA
+L878:
+	ADC IZ, 28579
+L879:
+	ADD XDE, XIY
+L880:
+	ADC C, (XWA+72)
+L881:
+	SUB C, C
+L882:
+	SBC H, H
+L883:
+	ADD E, (XHL-82)
+L884:
+	CP IY, 1409
+L885:
+	ADD E, (XWA+BC)
+L886:
+	AND H, (XWA+B)
+L887:
+	XOR (L890), W
+L888:
+	CP IX, 42145
+L889:
+	ADC L, (XBC+29865:16)
+L890:
+	ADD (L891:24), E
+L891:
+	SBC W, (XHL+16152:16)
+L892:
+	SUB B, 153
+L893:
+	SBC XIZ, XBC
+L894:
+	ADC L, (XBC+87:8)
+L895:
+	CP IY, 58893
+L896:
+	CP XIX, XWA
+L897:
+	OR H, (P0)
+L898:
+	SUB A, H
+L899:
+	OR DE, 7863
+L900:
+	XOR L, L
+L901:
+	ADC (P0), A
+L902:
+	XOR XWA, XIY
+L903:
+	SBC IZ, 47458
+L904:
+	SUB XBC, XIY
+L905:
+	SBC WA, 6185
+L906:
+	CP (L902:24), C
+L907:
+	ADC XIZ, XIZ
+L908:
+	AND XDE, XIX
+L909:
+	ADD C, (XIX+1233)
+L910:
+	OR L, E
+L911:
+	SUB (L3621), W
+L912:
+	OR L, H
+L913:
+	SBC DE, 33838
+L914:
+	XOR WA, 16611
+L915:
+	XOR C, (XWA)
+L916:
+	SUB (XIX), L
+L917:
+	SUB XDE, XDE
+L918:
+	ADC L, A
+L919:
+	SUB IX, 35096
+L920:
+	OR IX, 44640
+L921:
+	SUB C, (L918:24)
+L922:
+	SUB DE, 21380
+L923:
+	SBC B, (XIY+123:8)
+L924:
+	OR D, B
+L925:
+	OR L, A
+L926:
+	OR XDE, XDE
+L927:
+	ADC D, (L928)
+L928:
+	SBC E, E
+L929:
+	ADC L, (L930:24)
+L930:
+	SUB L, W
+L931:
+	ADC L, (XWA-10)
+L932:
+	AND IY, 7625
+L933:
+	SUB H, (XIX+101:8)
+L934:
+	ADD IX, 18738
+L935:
+	SBC XIY, XBC
+L936:
+	AND IX, 10433
+L937:
+	ADC (XIX+5:8), C
+L938:
+	AND XIZ, XWA
+L939:
+	SUB IX, 9951
+L940:
+	CP WA, 35215
+L941:
+	OR BC, 47785
+L942:
+	XOR B, (L944)
+L943:
+	SBC L, (XIX+1185)
+L944:
+	XOR E, 216
+L945:
+	SUB D, 52
+L946:
+	XOR IY, 27678
+L947:
+	ADD A, (P0)
+L948:
+	OR H, 197
+L949:
+	XOR (L953), A
+L950:
+	ADC (XIX+2228), W
+L951:
+	SBC XHL, XIX
+L952:
+	AND C, E
+L953:
+	ADC W, (FAR)
+L954:
+	CP XWA, XDE
+L955:
+	OR IY, 58253
+L956:
+	XOR IY, 12377
+L957:
+	SUB H, 223
+L958:
+	AND H, (XIX+2662)
+L959:
+	XOR BC, 29524
+L960:
+	SUB E, 242
+L961:
+	AND A, E
+L962:
+	SBC W, W
+L963:
+	XOR B, (FAR)
+L964:
+	SUB L, 214
+L965:
+	AND XIY, XIX
+L966:
+	SBC XHL, XHL
+L967:
+	SBC D, (L970)
+L968:
+	ADC C, 174
+L969:
+	ADD B, 78
+L970:
+	CP XIY, XIZ
+L971:
+	OR A, (XHL+98)
+L972:
+	SUB B, B
+L973:
+	AND H, 161
+L974:
+	ADD L, (XIX+1862:16)
+L975:
+	CP WA, 21283
+L976:
+	OR WA, 56413
+L977:
+	ADD (L1097), A
+L978:
+	XOR W, E
+L979:
+	SUB B, 132
+L980:
+	SBC L, (XWA+13508:16)
+L981:
+	AND HL, 57500
+L982:
+	ADD IZ, 41203
+L983:
+	SUB IY, 17201
+L984:
+	ADD C, (XIX+59:8)
+L985:
+	AND (L986:24), E
+L986:
+	SBC L, 32
+L987:
+	AND XBC, XDE
+L988:
+	SBC L, B
+L989:
+	ADC (XIX+8204:16), E
+L990:
+	OR L, (XWA+B)
+L991:
+	SBC XHL, XIY
+L992:
+	SBC (XIY+23975:16), A
+L993:
+	ADD (XIY+47), W
+L994:
+	CP IZ, 26392
+L995:
+	ADC B, (BIGREG)
+L996:
+	SBC W, B
+L997:
+	ADD (XIX+2011), L
+L998:
+	ADD (XIY+10160:16), A
+L999:
+	CP A, (XIX)
+L1000:
+	AND C, (L1003:24)
+L1001:
+	XOR A, 239
+L1002:
+	OR L, L
+L1003:
+	SUB BC, 51658
+L1004:
+	CP IZ, 45338
+L1005:
+	ADC B, (XWA-73)
+L1006:
+	ADD (XWA+78), A
+L1007:
+	SBC (P0), A
+L1008:
+	ADC XWA, XHL
+L1009:
+	XOR (XIX-13), C
+L1010:
+	OR E, 40
+L1011:
+	ADC (XWA+BC), D
+L1012:
+	AND XHL, XIY
+L1013:
+	ADC E, L
+L1014:
+	SBC XDE, XDE
+L1015:
+	SBC (FAR), H
+L1016:
+	ADD A, 55
+L1017:
+	ADC C, (XDE)
+L1018:
+	ADD HL, 1020
+L1019:
+	ADD XIX, XDE
+L1020:
+	SUB XIZ, XIX
+L1021:
+	XOR IZ, 12145
+L1022:
+	AND (XIX+108:8), C
+L1023:
+	ADC W, (XWA+49)
+L1024:
+	XOR A, 125
+L1025:
+	XOR (XHL+90), B
+L1026:
+	ADC C, 102
+L1027:
+	XOR L, (L1030:24)
+L1028:
+	OR L, (XIX)
+L1029:
+	ADD C, 52
+L1030:
+	OR XIY, XIY
+L1031:
+	OR (XIY), B
+L1032:
+	AND HL, 33006
+L1033:
+	AND (XDE-30), C
+L1034:
+	SUB E, 14
+L1035:
+	XOR XIY, XBC
+L1036:
+	SBC WA, 59282
+L1037:
+	CP (XHL+92), W
+L1038:
+	XOR XIZ, XDE
+L1039:
+	SUB IZ, 59645
+L1040:
+	SUB XIZ, XWA
+L1041:
+	SBC WA, 26154
+L1042:
+	SBC W, B
+L1043:
+	SBC (XWA+BC), E
+L1044:
+	ADD A, (L1048)
+L1045:
+	SUB W, E
+L1046:
+	AND C, 45
+L1047:
+	ADC B, (L1048)
+L1048:
+	SUB A, W
+L1049:
+	CP E, (XIX+9282:16)
+L1050:
+	ADC C, C
+L1051:
+	CP B, 228
+L1052:
+	ADC A, A
+L1053:
+	ADC E, 244
+L1054:
+	ADD W, 136
+L1055:
+	ADC (L1054), B
+L1056:
+	ADD WA, 54883
+L1057:
+	AND H, B
+L1058:
+	XOR XIY, XIY
+L1059:
+	CP HL, 49332
+L1060:
+	ADD H, 248
+L1061:
+	XOR W, (XIY-18)
+L1062:
+	SUB E, 125
+L1063:
+	OR W, 181
+L1064:
+	CP L, E
+L1065:
+	ADC W, E
+L1066:
+	AND L, 42
+L1067:
+	CP (XDE), B
+L1068:
+	SBC W, 139
+L1069:
+	ADC XIZ, XIX
+L1070:
+	AND L, L
+L1071:
+	ADD L, (XIY+2156:16)
+L1072:
+	CP D, (XBC+94)
+L1073:
+	XOR W, (XHL+2431:16)
+L1074:
+	ADD XWA, XIY
+L1075:
+	ADC L, H
+L1076:
+	CP WA, 59831
+L1077:
+	CP DE, 18519
+L1078:
+	SUB XIY, XWA
+L1079:
+	SUB XDE, XIX
+L1080:
+	SUB D, (XIZ+2144:16)
+L1081:
+	AND (XIZ+25), L
+L1082:
+	ADD L, (XIX+95:8)
+L1083:
+	OR D, B
+L1084:
+	ADC B, 121
+L1085:
+	AND IY, 23345
+L1086:
+	ADC D, D
+L1087:
+	XOR B, A
+L1088:
+	ADC IY, 26343
+L1089:
+	ADC XIY, XWA
+L1090:
+	SBC H, L
+L1091:
+	OR C, 167
+L1092:
+	CP (BIGREG), E
+L1093:
+	AND A, H
+L1094:
+	ADD BC, 61753
+L1095:
+	OR BC, 1994
+L1096:
+	AND (FAR), H
+L1097:
+	XOR E, 42
+L1098:
+	CP (XIY-48), B
+L1099:
+	OR (L1100:24), W
+L1100:
+	CP (L1102), C
+L1101:
+	CP (XHL+87:8), C
+L1102:
+	AND HL, 46568
+L1103:
+	SBC HL, 47165
+L1104:
+	SBC DE, 59446
+L1105:
+	ADD (XIY+61:8), W
+L1106:
+	SBC H, 123
+L1107:
+	SBC XIX, XBC
+L1108:
+	XOR B, 249
+L1109:
+	SUB W, (L1106)
+L1110:
+	ADD XIZ, XIY
+L1111:
+	SBC (XWA-87), A
+L1112:
+	SUB XIY, XBC
+L1113:
+	XOR IZ, 7532
+L1114:
+	XOR W, L
+L1115:
+	OR (L1119:24), W
+L1116:
+	ADD H, (XBC+97:8)
+L1117:
+	SBC HL, 60216
+L1118:
+	SUB E, C
+L1119:
+	CP H, 109
+L1120:
+	AND C, 192
+L1121:
+	CP D, L
+L1122:
+	OR B, (XIY-38)
+L1123:
+	XOR (L1120:24), C
+L1124:
+	CP H, W
+L1125:
+	SUB D, L
+L1126:
+	OR C, (XIX+1770)
+L1127:
+	ADC XHL, XIX
+L1128:
+	XOR B, (L1127)
+L1129:
+	OR XIY, XBC
+L1130:
+	SBC (XWA+BC), C
+L1131:
+	XOR IX, 62612
+L1132:
+	SUB B, E
+L1133:
+	XOR C, (L1136:24)
+L1134:
+	ADC H, (XWA+16246:16)
+L1135:
+	ADC IX, 64823
+L1136:
+	SUB IZ, 7873
+L1137:
+	CP B, 224
+L1138:
+	ADC (FAR), D
+L1139:
+	ADD (XBC-90), L
+L1140:
+	ADD XIY, XIY
+L1141:
+	AND XIY, XBC
+L1142:
+	AND A, 100
+L1143:
+	SBC H, A
+L1144:
+	SUB XHL, XDE
+L1145:
+	CP XDE, XWA
+L1146:
+	ADD D, (L3018)
+L1147:
+	ADD XBC, XWA
+L1148:
+	ADD (XWA+B), A
+L1149:
+	SBC (FAR), E
+L1150:
+	SUB XBC, XWA
+L1151:
+	XOR A, (L654:24)
+L1152:
+	CP IY, 59538
+L1153:
+	XOR D, 29
+L1154:
+	OR H, C
+L1155:
+	OR XIZ, XBC
+L1156:
+	SBC HL, 7921
+L1157:
+	OR A, (XIX+2235)
+L1158:
+	SUB XIY, XIZ
+L1159:
+	CP (P0), B
+L1160:
+	XOR XIZ, XIZ
+L1161:
+	XOR B, 105
+L1162:
+	AND XDE, XDE
+L1163:
+	SBC (XHL+12143:16), C
+L1164:
+	SUB IY, 12387
+L1165:
+	XOR (XBC+25125:16), E
+L1166:
+	ADC (XWA+28055:16), H
+L1167:
+	CP B, 30
+L1168:
+	ADD (XWA+50), H
+L1169:
+	SBC D, 234
+L1170:
+	ADD E, (XIY+2962:16)
+L1171:
+	XOR XHL, XIX
+L1172:
+	XOR A, (L612:24)
+L1173:
+	SUB (XWA+BC), C
+L1174:
+	ADC (XDE-28), H
+L1175:
+	AND BC, 64990
+L1176:
+	SBC (XWA+BC), A
+L1177:
+	AND B, 11
+L1178:
+	SBC C, 156
+L1179:
+	CP B, B
+L1180:
+	ADC C, 45
+L1181:
+	ADC XIZ, XWA
+L1182:
+	SUB BC, 39714
+L1183:
+	ADC B, 156
+L1184:
+	XOR DE, 11905
+L1185:
+	AND B, (XHL+19:8)
+L1186:
+	SUB D, H
+L1187:
+	SUB A, 171
+L1188:
+	AND XIY, XIX
+L1189:
+	CP A, D
+L1190:
+	ADD XHL, XIX
+L1191:
+	CP BC, 18492
+L1192:
+	SUB XIX, XBC
+L1193:
+	XOR B, (XWA+B)
+L1194:
+	SUB C, B
+L1195:
+	CP IX, 14890
+L1196:
+	ADD D, L
+L1197:
+	ADC XWA, XWA
+L1198:
+	CP XBC, XDE
+L1199:
+	OR L, (XIY+80)
+L1200:
+	ADD (XIX+553), E
+L1201:
+	SUB (XWA+BC), H
+L1202:
+	SBC C, L
+L1203:
+	OR IX, 54002
+L1204:
+	SBC A, (XIX+1304)
+L1205:
+	XOR E, 174
+L1206:
+	AND H, 71
+L1207:
+	SBC DE, 39034
+L1208:
+	SUB B, D
+L1209:
+	CP A, C
+L1210:
+	ADD HL, 25189
+L1211:
+	ADD E, L
+L1212:
+	AND E, D
+L1213:
+	ADC XIY, XBC
+L1214:
+	CP (XIZ), B
+L1215:
+	ADC (L1214:24), D
+L1216:
+	OR D, L
+L1217:
+	ADD B, 94
+L1218:
+	XOR XIX, XIX
+L1219:
+	XOR (XWA+BC), L
+L1220:
+	AND D, (FAR)
+L1221:
+	ADC D, A
+L1222:
+	CP XDE, XHL
+L1223:
+	OR A, 127
+L1224:
+	SBC H, 212
+L1225:
+	OR XBC, XBC
+L1226:
+	ADC XHL, XIY
+L1227:
+	ADC A, 148
+L1228:
+	XOR (FAR), E
+L1229:
+	SBC (XHL+22:8), W
+L1230:
+	ADC E, (XWA)
+L1231:
+	SBC XWA, XIZ
+L1232:
+	OR H, C
+L1233:
+	ADC H, 157
+L1234:
+	OR W, B
+L1235:
+	CP XIZ, XBC
+L1236:
+	XOR (XIX+1092), H
+L1237:
+	ADD XDE, XWA
+L1238:
+	SUB E, (L1241:24)
+L1239:
+	ADC WA, 18869
+L1240:
+	XOR IX, 35597
+L1241:
+	XOR B, W
+L1242:
+	SUB (XIX+1666), E
+L1243:
+	SBC XWA, XWA
+L1244:
+	XOR D, (FAR)
+L1245:
+	CP IY, 32459
+L1246:
+	OR D, (XBC)
+L1247:
+	SUB L, H
+L1248:
+	SBC B, 58
+L1249:
+	CP C, 13
+L1250:
+	SUB (XWA+BC), C
+L1251:
+	CP (XHL+22), L
+L1252:
+	SUB D, E
+L1253:
+	OR HL, 40028
+L1254:
+	ADC (XIZ+87:8), W
+L1255:
+	SBC H, (XIX+23)
+L1256:
+	SBC (L1253:24), C
+L1257:
+	CP D, H
+L1258:
+	OR L, B
+L1259:
+	XOR W, C
+L1260:
+	ADD B, 52
+L1261:
+	AND (XWA+BC), D
+L1262:
+	AND IX, 15336
+L1263:
+	SBC (XHL+30:8), B
+L1264:
+	OR XIX, XBC
+L1265:
+	OR IZ, 40768
+L1266:
+	CP HL, 23100
+L1267:
+	SUB BC, 4028
+L1268:
+	SBC W, (XIX+24666:16)
+L1269:
+	SUB BC, 50966
+L1270:
+	CP (L1274:24), E
+L1271:
+	CP H, B
+L1272:
+	SBC H, 138
+L1273:
+	ADD IZ, 27605
+L1274:
+	SBC D, (XWA+34)
+L1275:
+	AND L, 167
+L1276:
+	XOR (XDE+88), B
+L1277:
+	SBC L, 253
+L1278:
+	AND E, 139
+L1279:
+	SBC IY, 50585
+L1280:
+	XOR L, 205
+L1281:
+	XOR D, (XIX+2105)
+L1282:
+	AND W, 121
+L1283:
+	CP L, L
+L1284:
+	ADC (XWA+87), D
+L1285:
+	CP XIY, XBC
+L1286:
+	AND IY, 46819
+L1287:
+	CP W, (XIX+1983)
+L1288:
+	CP (XWA+BC), D
+L1289:
+	OR (XIX+53), C
+L1290:
+	SUB XWA, XDE
+L1291:
+	AND (XWA+44:8), D
+L1292:
+	SBC (FAR), C
+L1293:
+	AND (L1296:24), H
+L1294:
+	OR B, A
+L1295:
+	SBC (FAR), H
+L1296:
+	CP XIZ, XBC
+L1297:
+	ADD (L2164:24), C
+L1298:
+	SUB (L1295:24), H
+L1299:
+	OR (XIX+122:8), A
+L1300:
+	ADC (XHL), A
+L1301:
+	CP (XWA+B), H
+L1302:
+	SBC IZ, 8311
+L1303:
+	AND XWA, XIZ
+L1304:
+	OR D, (XHL+85)
+L1305:
+	SBC D, E
+L1306:
+	ADD W, 95
+L1307:
+	ADC XIZ, XHL
+L1308:
+	ADC (XDE+26:8), H
+L1309:
+	SUB HL, 43665
+L1310:
+	CP XDE, XIY
+L1311:
+	ADC A, (L1312:24)
+L1312:
+	OR W, (XWA+B)
+L1313:
+	ADC XDE, XIY
+L1314:
+	XOR (XWA+13), A
+L1315:
+	AND W, 88
+L1316:
+	SBC C, 213
+L1317:
+	ADD E, C
+L1318:
+	CP (XWA-66), W
+L1319:
+	SBC (XBC+395:16), D
+L1320:
+	AND C, 0
+L1321:
+	ADC D, C
+L1322:
+	ADD IZ, 45319
+L1323:
+	SUB D, 124
+L1324:
+	CP IZ, 15121
+L1325:
+	OR IZ, 51471
+L1326:
+	CP XIX, XIZ
+L1327:
+	ADC L, (L4041:24)
+L1328:
+	OR IZ, 21655
+L1329:
+	AND XWA, XWA
+L1330:
+	ADD E, (L3803)
+L1331:
+	ADD B, 133
+L1332:
+	OR XIY, XDE
+L1333:
+	OR (XIX+79), C
+L1334:
+	AND XIZ, XBC
+L1335:
+	ADD (XWA+104:8), H
+L1336:
+	AND H, 231
+L1337:
+	AND XHL, XIY
+L1338:
+	SUB XIX, XIY
+L1339:
+	AND (FAR), W
+L1340:
+	XOR D, B
+L1341:
+	XOR E, L
+L1342:
+	ADD E, 31
+L1343:
+	ADC XWA, XIY
+L1344:
+	ADD H, B
+L1345:
+	XOR (XBC+19644:16), A
+L1346:
+	AND (L1348), E
+L1347:
+	SBC B, D
+L1348:
+	XOR XHL, XWA
+L1349:
+	AND C, D
+L1350:
+	ADC B, (L1350)
+L1351:
+	XOR E, A
+L1352:
+	SUB XWA, XWA
+L1353:
+	ADC XIY, XBC
+L1354:
+	ADD BC, 60616
+L1355:
+	OR BC, 38058
+L1356:
+	CP B, E
+L1357:
+	XOR A, A
+L1358:
+	OR (XBC-58), D
+L1359:
+	ADD IY, 50784
+L1360:
+	SUB E, (XWA+75)
+L1361:
+	XOR D, (BIGREG)
+L1362:
+	ADD (XWA-45), B
+L1363:
+	ADC (L1360), W
+L1364:
+	XOR HL, 3553
+L1365:
+	XOR (XIX), H
+L1366:
+	CP WA, 51864
+L1367:
+	ADD (L3798:24), H
+L1368:
+	SBC D, 209
+L1369:
+	ADD L, W
+L1370:
+	ADD B, 38
+L1371:
+	ADC L, 58
+L1372:
+	OR A, (L4255:24)
+L1373:
+	SBC L, B
+L1374:
+	ADD (XIX+1925), H
+L1375:
+	SUB D, (BIGREG)
+L1376:
+	SUB (P0), H
+L1377:
+	ADD A, B
+L1378:
+	OR W, W
+L1379:
+	XOR A, 70
+L1380:
+	OR XDE, XIX
+L1381:
+	ADC DE, 49153
+L1382:
+	SBC IZ, 10045
+L1383:
+	AND D, E
+L1384:
+	SUB BC, 45048
+L1385:
+	OR W, W
+L1386:
+	CP XIZ, XIZ
+L1387:
+	ADD W, (XWA+BC)
+L1388:
+	SBC A, (L1392:24)
+L1389:
+	OR W, (XIY+8)
+L1390:
+	SUB IY, 51178
+L1391:
+	SBC XIY, XBC
+L1392:
+	CP C, 149
+L1393:
+	CP XBC, XBC
+L1394:
+	AND E, B
+L1395:
+	SUB L, D
+L1396:
+	AND W, A
+L1397:
+	SUB L, E
+L1398:
+	SUB D, 102
+L1399:
+	AND BC, 402
+L1400:
+	CP A, (XDE)
+L1401:
+	OR A, 151
+L1402:
+	ADC A, (XIZ+52:8)
+L1403:
+	SUB DE, 52251
+L1404:
+	ADC A, D
+L1405:
+	XOR C, D
+L1406:
+	SUB D, 67
+L1407:
+	AND L, (XWA+B)
+L1408:
+	AND W, E
+L1409:
+	SUB E, 234
+L1410:
+	SBC L, 206
+L1411:
+	ADD L, A
+L1412:
+	ADC W, (BIGREG)
+L1413:
+	CP DE, 8093
+L1414:
+	SUB D, E
+L1415:
+	ADD L, 35
+L1416:
+	ADD XHL, XBC
+L1417:
+	SUB E, H
+L1418:
+	ADD XIZ, XHL
+L1419:
+	CP D, (L1417)
+L1420:
+	XOR BC, 52061
+L1421:
+	ADC (L1424:24), H
+L1422:
+	CP XIZ, XBC
+L1423:
+	SUB L, 2
+L1424:
+	AND L, 106
+L1425:
+	AND (XIX+366), D
+L1426:
+	ADD XHL, XIY
+L1427:
+	ADD XDE, XDE
+L1428:
+	AND (L4641), C
+L1429:
+	CP D, E
+L1430:
+	SUB W, 130
+L1431:
+	ADC A, (XWA+B)
+L1432:
+	SBC XIZ, XIX
+L1433:
+	SBC WA, 62157
+L1434:
+	ADD B, H
+L1435:
+	XOR (L1431), W
+L1436:
+	OR (XIY+26), A
+L1437:
+	SUB XWA, XIY
+L1438:
+	ADC (XBC+95:8), D
+L1439:
+	CP DE, 65497
+L1440:
+	ADC (XHL-99), D
+L1441:
+	XOR L, A
+L1442:
+	SUB IZ, 43256
+L1443:
+	ADC XHL, XBC
+L1444:
+	ADD XHL, XDE
+L1445:
+	OR E, W
+L1446:
+	AND XIZ, XIZ
+L1447:
+	CP IX, 30248
+L1448:
+	ADD L, (XBC-89)
+L1449:
+	AND L, D
+L1450:
+	SUB E, 208
+L1451:
+	AND W, (XWA+BC)
+L1452:
+	ADC E, 237
+L1453:
+	AND (XHL-64), E
+L1454:
+	ADD IZ, 62460
+L1455:
+	ADD A, 107
+L1456:
+	SBC A, 105
+L1457:
+	ADD (XIY+17161:16), D
+L1458:
+	AND B, 255
+L1459:
+	XOR (XDE-35), W
+L1460:
+	SBC H, C
+L1461:
+	CP BC, 57739
+L1462:
+	SUB (XWA+46:8), D
+L1463:
+	CP XBC, XIY
+L1464:
+	XOR IY, 36109
+L1465:
+	ADC (XBC+13698:16), H
+L1466:
+	ADC H, 60
+L1467:
+	SUB XIY, XIX
+L1468:
+	XOR C, (FAR)
+L1469:
+	AND D, (XWA)
+L1470:
+	OR D, L
+L1471:
+	CP XIX, XWA
+L1472:
+	AND XHL, XIY
+L1473:
+	OR HL, 16716
+L1474:
+	OR XHL, XBC
+L1475:
+	XOR IX, 52250
+L1476:
+	SUB A, H
+L1477:
+	AND A, 203
+L1478:
+	XOR (BIGREG), W
+L1479:
+	SBC L, 236
+L1480:
+	XOR XBC, XIY
+L1481:
+	AND D, 56
+L1482:
+	ADC W, (XHL+257:16)
+L1483:
+	ADD W, 212
+L1484:
+	AND (XBC+23274:16), H
+L1485:
+	CP D, 113
+L1486:
+	ADD XWA, XIZ
+L1487:
+	XOR XBC, XBC
+L1488:
+	XOR (L2586), L
+L1489:
+	CP DE, 32504
+L1490:
+	XOR A, W
+L1491:
+	OR (XBC), W
+L1492:
+	XOR L, A
+L1493:
+	ADC XWA, XIY
+L1494:
+	AND L, 30
+L1495:
+	ADD H, 80
+L1496:
+	ADD A, (XIX+2984)
+L1497:
+	ADC XIY, XDE
+L1498:
+	ADC H, (XIX+91)
+L1499:
+	ADC D, 74
+L1500:
+	ADC L, (XIX+721)
+L1501:
+	AND A, (XIY)
+L1502:
+	OR E, (XIX+1099)
+L1503:
+	SUB (XWA), W
+L1504:
+	CP WA, 42374
+L1505:
+	CP XHL, XIY
+L1506:
+	CP (XIY), D
+L1507:
+	SUB XWA, XBC
+L1508:
+	CP D, (XWA)
+L1509:
+	CP XBC, XBC
+L1510:
+	ADD W, (BIGREG)
+L1511:
+	OR (XHL+24985:16), L
+L1512:
+	ADD E, (XIX+2556)
+L1513:
+	AND E, 7
+L1514:
+	SBC D, (XIX-71)
+L1515:
+	XOR IY, 22610
+L1516:
+	ADD B, C
+L1517:
+	ADC D, D
+L1518:
+	CP W, (XIY)
+L1519:
+	SUB A, 190
+L1520:
+	SBC W, (XIX)
+L1521:
+	ADC XBC, XDE
+L1522:
+	OR XHL, XIX
+L1523:
+	OR H, D
+L1524:
+	XOR H, (XIZ+82:8)
+L1525:
+	SUB WA, 53206
+L1526:
+	OR D, E
+L1527:
+	ADC A, 58
+L1528:
+	ADD C, (XWA+B)
+L1529:
+	SBC (L1529:24), L
+L1530:
+	XOR W, (XWA+BC)
+L1531:
+	OR D, 252
+L1532:
+	OR HL, 61250
+L1533:
+	XOR (XWA+46), H
+L1534:
+	SBC C, 204
+L1535:
+	SBC H, (XIX+17)
+L1536:
+	ADD B, E
+L1537:
+	ADC (XBC+83), E
+L1538:
+	OR XBC, XBC
+L1539:
+	OR H, 149
+L1540:
+	ADD B, L
+L1541:
+	SUB (XWA+BC), W
+L1542:
+	SBC (L1539:24), E
+L1543:
+	AND H, E
+L1544:
+	CP B, (XBC+5429:16)
+L1545:
+	ADC DE, 59039
+L1546:
+	ADD W, 212
+L1547:
+	XOR (XIX+21669:16), D
+L1548:
+	ADC W, L
+L1549:
+	SBC IZ, 44403
+L1550:
+	SBC B, (XWA+B)
+L1551:
+	ADC XBC, XIY
+L1552:
+	CP IZ, 22713
+L1553:
+	OR D, 124
+L1554:
+	XOR D, 200
+L1555:
+	SBC H, D
+L1556:
+	ADC B, (XIY+52)
+L1557:
+	CP H, 20
+L1558:
+	SUB H, (XIZ-85)
+L1559:
+	ADD L, 43
+L1560:
+	SUB XIX, XBC
+L1561:
+	OR (L1562), B
+L1562:
+	CP H, 40
+L1563:
+	SUB D, (XBC+115:8)
+L1564:
+	CP C, 65
+L1565:
+	ADD B, (XIX+1313)
+L1566:
+	SBC L, A
+L1567:
+	SBC H, (L1563:24)
+L1568:
+	SUB C, 53
+L1569:
+	SBC D, 27
+L1570:
+	ADD BC, 29716
+L1571:
+	ADC HL, 25114
+L1572:
+	AND L, (L2973:24)
+L1573:
+	ADD B, (XIX+26314:16)
+L1574:
+	ADD IZ, 26356
+L1575:
+	CP XWA, XBC
+L1576:
+	SBC XBC, XDE
+L1577:
+	AND WA, 2286
+L1578:
+	SUB IX, 35237
+L1579:
+	ADC IY, 19248
+L1580:
+	SBC XDE, XDE
+L1581:
+	OR H, B
+L1582:
+	SBC HL, 8351
+L1583:
+	AND XIY, XIX
+L1584:
+	SBC IX, 33520
+L1585:
+	XOR (XIX+49:8), C
+L1586:
+	SUB E, (XIZ)
+L1587:
+	OR IZ, 25656
+L1588:
+	SUB C, W
+L1589:
+	XOR L, 80
+L1590:
+	ADD IY, 47108
+L1591:
+	SUB IX, 54641
+L1592:
+	XOR B, (XHL+99)
+L1593:
+	ADC C, A
+L1594:
+	CP H, (XDE+30:8)
+L1595:
+	ADD C, (BIGREG)
+L1596:
+	AND A, H
+L1597:
+	OR HL, 647
+L1598:
+	XOR W, 196
+L1599:
+	ADD L, 58
+L1600:
+	ADC A, 41
+L1601:
+	SBC H, 206
+L1602:
+	OR XIZ, XIX
+L1603:
+	ADD IZ, 48850
+L1604:
+	SBC XDE, XHL
+L1605:
+	AND L, (XIX+48:8)
+L1606:
+	ADD XWA, XIZ
+L1607:
+	AND (L1606), E
+L1608:
+	OR WA, 62588
+L1609:
+	OR (L3721:24), E
+L1610:
+	AND XWA, XHL
+L1611:
+	SUB (XIX+95:8), A
+L1612:
+	SBC XWA, XIY
+L1613:
+	AND DE, 50370
+L1614:
+	OR XDE, XDE
+L1615:
+	ADC XDE, XBC
+L1616:
+	AND XDE, XBC
+L1617:
+	CP A, (XIZ+67:8)
+L1618:
+	XOR (XIX+791), A
+L1619:
+	SUB C, E
+L1620:
+	AND A, H
+L1621:
+	AND IX, 15698
+L1622:
+	CP XDE, XBC
+L1623:
+	CP C, 38
+L1624:
+	SBC L, (XWA-2)
+L1625:
+	XOR XIY, XBC
+L1626:
+	CP HL, 29972
+L1627:
+	SBC (P0), L
+L1628:
+	OR BC, 46684
+L1629:
+	XOR E, (L1630:24)
+L1630:
+	SUB D, B
+L1631:
+	ADD L, (XHL+19774:16)
+L1632:
+	ADD (L1630:24), L
+L1633:
+	ADC XIY, XIY
+L1634:
+	ADC HL, 50272
+L1635:
+	ADD XIZ, XWA
+L1636:
+	CP XBC, XWA
+L1637:
+	ADC (L955), H
+L1638:
+	SBC E, (XHL-47)
+L1639:
+	ADD (XHL+24207:16), C
+L1640:
+	SBC XIX, XIZ
+L1641:
+	OR A, E
+L1642:
+	SBC W, B
+L1643:
+	SUB H, 16
+L1644:
+	AND H, W
+L1645:
+	XOR IZ, 15589
+L1646:
+	ADD XWA, XWA
+L1647:
+	CP C, 242
+L1648:
+	AND XDE, XDE
+L1649:
+	ADD L, 175
+L1650:
+	SUB HL, 23611
+L1651:
+	OR WA, 17825
+L1652:
+	OR W, (XIX)
+L1653:
+	ADD B, C
+L1654:
+	OR HL, 32149
+L1655:
+	ADC BC, 56747
+L1656:
+	ADD L, (XIZ+2961:16)
+L1657:
+	SBC E, (XIX+816)
+L1658:
+	ADD IY, 60282
+L1659:
+	OR B, 177
+L1660:
+	SUB XIX, XWA
+L1661:
+	XOR XIY, XIX
+L1662:
+	XOR W, C
+L1663:
+	SBC XWA, XWA
+L1664:
+	SUB DE, 51896
+L1665:
+	ADC A, (L2546)
+L1666:
+	SUB C, (XWA-69)
+L1667:
+	XOR B, (BIGREG)
+L1668:
+	AND E, (XWA+B)
+L1669:
+	XOR XDE, XIX
+L1670:
+	SUB A, A
+L1671:
+	XOR XDE, XBC
+L1672:
+	ADC H, 242
+L1673:
+	ADD C, 56
+L1674:
+	OR (XHL+61), A
+L1675:
+	SBC XBC, XHL
+L1676:
+	AND W, D
+L1677:
+	OR L, 205
+L1678:
+	CP XIZ, XDE
+L1679:
+	ADD XIY, XIZ
+L1680:
+	ADD XIZ, XHL
+L1681:
+	OR L, 148
+L1682:
+	AND H, 211
+L1683:
+	OR C, 66
+L1684:
+	CP A, (XDE-83)
+L1685:
+	OR H, 201
+L1686:
+	ADC DE, 64706
+L1687:
+	AND XWA, XHL
+L1688:
+	CP C, (XIZ+58)
+L1689:
+	AND C, H
+L1690:
+	OR H, 163
+L1691:
+	SUB L, 120
+L1692:
+	CP C, B
+L1693:
+	AND (BIGREG), H
+L1694:
+	XOR IY, 18495
+L1695:
+	OR BC, 15131
+L1696:
+	AND XIX, XHL
+L1697:
+	ADD B, 58
+L1698:
+	ADC D, (P0)
+L1699:
+	AND XDE, XHL
+L1700:
+	SBC A, 163
+L1701:
+	ADD (L1705:24), D
+L1702:
+	SBC E, (XWA+B)
+L1703:
+	SUB XHL, XWA
+L1704:
+	CP XIY, XWA
+L1705:
+	AND A, L
+L1706:
+	AND B, L
+L1707:
+	SUB L, 124
+L1708:
+	ADD XDE, XWA
+L1709:
+	AND L, L
+L1710:
+	SBC A, (L4495:24)
+L1711:
+	SUB H, 56
+L1712:
+	CP L, 50
+L1713:
+	OR IX, 43005
+L1714:
+	OR WA, 28262
+L1715:
+	SUB XWA, XDE
+L1716:
+	ADD B, (XIX+682)
+L1717:
+	ADC L, L
+L1718:
+	SBC DE, 7386
+L1719:
+	SUB W, (XIX+2992)
+L1720:
+	ADC HL, 55252
+L1721:
+	OR E, 164
+L1722:
+	ADD D, E
+L1723:
+	OR E, L
+L1724:
+	SBC WA, 49016
+L1725:
+	CP L, D
+L1726:
+	ADD XIZ, XIZ
+L1727:
+	ADC XBC, XBC
+L1728:
+	ADD H, C
+L1729:
+	ADD W, 226
+L1730:
+	ADC C, E
+L1731:
+	ADD (L1730), A
+L1732:
+	SBC D, (L1729:24)
+L1733:
+	AND C, (XIY+76)
+L1734:
+	ADC XIX, XBC
+L1735:
+	AND E, 89
+L1736:
+	CP B, 3
+L1737:
+	OR HL, 41459
+L1738:
+	ADC (L1741:24), C
+L1739:
+	ADC (FAR), D
+L1740:
+	ADD L, 177
+L1741:
+	SUB W, 54
+L1742:
+	ADD D, D
+L1743:
+	CP D, (XIX+36:8)
+L1744:
+	ADD IX, 58443
+L1745:
+	SUB D, (XDE-66)
+L1746:
+	XOR D, C
+L1747:
+	OR H, 121
+L1748:
+	AND B, D
+L1749:
+	AND (XWA), W
+L1750:
+	AND (L1747:24), D
+L1751:
+	SUB E, (XWA+B)
+L1752:
+	SUB DE, 25095
+L1753:
+	AND XIZ, XIY
+L1754:
+	ADC L, A
+L1755:
+	SBC B, (XIX)
+L1756:
+	CP XDE, XWA
+L1757:
+	AND (XIX+214), B
+L1758:
+	CP XIY, XIZ
+L1759:
+	ADC XBC, XIZ
+L1760:
+	CP DE, 37957
+L1761:
+	SBC (L4738), H
+L1762:
+	ADD W, A
+L1763:
+	ADD D, (XIY+860:16)
+L1764:
+	SUB E, 3
+L1765:
+	OR (XIY-62), H
+L1766:
+	OR (XBC+41), D
+L1767:
+	ADD D, D
+L1768:
+	ADC E, (L1772:24)
+L1769:
+	OR XBC, XIY
+L1770:
+	CP (XHL), W
+L1771:
+	SBC E, B
+L1772:
+	CP L, 130
+L1773:
+	OR XIY, XBC
+L1774:
+	ADD L, A
+L1775:
+	ADC D, (XWA+BC)
+L1776:
+	OR XWA, XIY
+L1777:
+	ADC E, (XIY)
+L1778:
+	ADC E, 23
+L1779:
+	ADC E, (XIZ+24002:16)
+L1780:
+	CP (XBC), H
+L1781:
+	OR IZ, 61770
+L1782:
+	AND (L1778), H
+L1783:
+	ADD D, (XWA+B)
+L1784:
+	AND (XIX+55), C
+L1785:
+	CP WA, 4995
+L1786:
+	CP A, (L1782:24)
+L1787:
+	AND XDE, XBC
+L1788:
+	SBC A, 10
+L1789:
+	SBC (L2647), D
+L1790:
+	XOR BC, 53332
+L1791:
+	SBC (XDE-89), H
+L1792:
+	ADD D, D
+L1793:
+	ADC H, 149
+L1794:
+	OR C, 147
+L1795:
+	ADC L, (L1795)
+L1796:
+	XOR IZ, 20184
+L1797:
+	OR C, W
+L1798:
+	ADC XDE, XIZ
+L1799:
+	ADC (XWA+B), D
+L1800:
+	SBC E, C
+L1801:
+	ADD B, H
+L1802:
+	XOR XIX, XDE
+L1803:
+	CP H, 188
+L1804:
+	ADC BC, 13044
+L1805:
+	OR L, 170
+L1806:
+	SBC A, 62
+L1807:
+	AND H, (XHL+22:8)
+L1808:
+	ADC H, (FAR)
+L1809:
+	SUB W, B
+L1810:
+	ADD (XIX+1694), B
+L1811:
+	ADC IZ, 58737
+L1812:
+	XOR XWA, XIX
+L1813:
+	SBC XIX, XHL
+L1814:
+	ADD W, L
+L1815:
+	ADD XIX, XWA
+L1816:
+	ADD (XWA+B), H
+L1817:
+	ADD XIZ, XBC
+L1818:
+	CP (XWA+24459:16), C
+L1819:
+	SBC A, (XDE+37)
+L1820:
+	SUB XIX, XIX
+L1821:
+	XOR E, (XDE+59:8)
+L1822:
+	AND HL, 2088
+L1823:
+	ADC C, 1
+L1824:
+	OR (XWA+17:8), E
+L1825:
+	OR BC, 177
+L1826:
+	SUB B, (BIGREG)
+L1827:
+	SUB XIZ, XIX
+L1828:
+	OR W, (BIGREG)
+L1829:
+	SUB IX, 18808
+L1830:
+	CP DE, 18831
+L1831:
+	OR XHL, XIY
+L1832:
+	CP (XWA-72), L
+L1833:
+	SBC H, W
+L1834:
+	AND D, E
+L1835:
+	OR D, (XIX+468)
+L1836:
+	AND W, H
+L1837:
+	ADC XIZ, XWA
+L1838:
+	SBC C, E
+L1839:
+	OR C, 48
+L1840:
+	XOR (XWA+23:8), D
+L1841:
+	OR XHL, XWA
+L1842:
+	ADC IY, 16113
+L1843:
+	ADD (XIX+9271:16), D
+L1844:
+	XOR D, 147
+L1845:
+	ADD (XIX+92), C
+L1846:
+	CP (L1333), L
+L1847:
+	XOR HL, 18433
+L1848:
+	SUB W, C
+L1849:
+	ADC XIZ, XDE
+L1850:
+	SBC IZ, 51539
+L1851:
+	SBC XWA, XWA
+L1852:
+	ADC XHL, XBC
+L1853:
+	SBC E, L
+L1854:
+	OR W, L
+L1855:
+	AND C, B
+L1856:
+	XOR H, (XIX+844)
+L1857:
+	CP C, 104
+L1858:
+	XOR A, (XBC-69)
+L1859:
+	CP C, (XIX+741)
+L1860:
+	OR BC, 30231
+L1861:
+	CP DE, 30200
+L1862:
+	ADC A, C
+L1863:
+	ADC B, (XBC+27:8)
+L1864:
+	ADC XIZ, XIZ
+L1865:
+	ADC A, L
+L1866:
+	SUB XIY, XWA
+L1867:
+	OR L, B
+L1868:
+	SBC (XIX+487), B
+L1869:
+	XOR E, (XBC-59)
+L1870:
+	ADD (XWA+B), L
+L1871:
+	XOR IY, 44049
+L1872:
+	ADC XIX, XIX
+L1873:
+	OR XDE, XHL
+L1874:
+	ADC E, A
+L1875:
+	SUB B, 182
+L1876:
+	SBC B, H
+L1877:
+	OR (XWA+18), C
+L1878:
+	AND B, (L1874:24)
+L1879:
+	ADC XHL, XBC
+L1880:
+	AND L, W
+L1881:
+	ADC (XBC-41), D
+L1882:
+	AND A, (XWA-2)
+L1883:
+	OR XWA, XDE
+L1884:
+	OR IX, 35030
+L1885:
+	XOR L, 58
+L1886:
+	AND D, H
+L1887:
+	ADC B, L
+L1888:
+	SBC WA, 4384
+L1889:
+	SBC (XBC+10:8), E
+L1890:
+	SBC WA, 42455
+L1891:
+	SUB L, W
+L1892:
+	SUB W, 136
+L1893:
+	ADD H, (P0)
+L1894:
+	ADC B, (XWA)
+L1895:
+	AND XIX, XIZ
+L1896:
+	AND IZ, 63211
+L1897:
+	ADC A, 92
+L1898:
+	XOR W, (XIX+99:8)
+L1899:
+	XOR E, 33
+L1900:
+	SUB B, (XWA+BC)
+L1901:
+	CP L, (XIZ+93:8)
+L1902:
+	ADD XIZ, XDE
+L1903:
+	SBC IX, 65331
+L1904:
+	ADC (FAR), E
+L1905:
+	OR W, 74
+L1906:
+	SUB (XWA+19), W
+L1907:
+	XOR H, B
+L1908:
+	ADD XIY, XIY
+L1909:
+	OR B, 150
+L1910:
+	AND XBC, XBC
+L1911:
+	SUB A, (L1913)
+L1912:
+	CP WA, 15133
+L1913:
+	CP W, H
+L1914:
+	ADC XBC, XDE
+L1915:
+	XOR W, 207
+L1916:
+	CP XHL, XHL
+L1917:
+	XOR H, (XHL)
+L1918:
+	SBC IX, 57201
+L1919:
+	CP HL, 42326
+L1920:
+	XOR WA, 35961
+L1921:
+	AND IY, 5126
+L1922:
+	ADD B, L
+L1923:
+	OR L, (XWA+122:8)
+L1924:
+	SBC (XIY+30:8), B
+L1925:
+	ADD E, B
+L1926:
+	XOR A, (XIY+32:8)
+L1927:
+	ADC (XIY+47), C
+L1928:
+	OR HL, 33129
+L1929:
+	ADD E, 26
+L1930:
+	ADC A, H
+L1931:
+	OR XHL, XDE
+L1932:
+	AND IX, 63882
+L1933:
+	CP (XIY), L
+L1934:
+	CP A, A
+L1935:
+	AND IZ, 27057
+L1936:
+	AND (XBC-5), L
+L1937:
+	ADC B, (FAR)
+L1938:
+	ADD XDE, XIY
+L1939:
+	CP DE, 24499
+L1940:
+	XOR XWA, XHL
+L1941:
+	XOR IX, 33786
+L1942:
+	SBC XHL, XIZ
+L1943:
+	XOR (BIGREG), L
+L1944:
+	OR (L1945), D
+L1945:
+	OR E, 28
+L1946:
+	SBC L, 114
+L1947:
+	SUB HL, 27644
+L1948:
+	AND C, 125
+L1949:
+	CP XIZ, XWA
+L1950:
+	OR L, W
+L1951:
+	SBC HL, 8809
+L1952:
+	ADC BC, 46135
+L1953:
+	XOR L, D
+L1954:
+	XOR (XIX+2534), W
+L1955:
+	XOR A, (XIZ+23960:16)
+L1956:
+	AND B, D
+L1957:
+	ADC E, (XIY)
+L1958:
+	ADD XBC, XIY
+L1959:
+	AND BC, 21348
+L1960:
+	CP WA, 54241
+L1961:
+	OR B, (XWA+BC)
+L1962:
+	XOR H, (XIX+6675:16)
+L1963:
+	XOR E, D
+L1964:
+	ADD C, 251
+L1965:
+	SUB (XWA+B), B
+L1966:
+	AND E, D
+L1967:
+	SBC C, 137
+L1968:
+	CP BC, 9763
+L1969:
+	XOR H, E
+L1970:
+	OR (FAR), W
+L1971:
+	XOR E, 155
+L1972:
+	SBC XBC, XDE
+L1973:
+	OR B, (XDE-3)
+L1974:
+	CP C, 81
+L1975:
+	XOR H, 248
+L1976:
+	SUB A, 188
+L1977:
+	SUB (L24:24), C
+L1978:
+	XOR E, 143
+L1979:
+	SBC B, 57
+L1980:
+	ADD (XIX+2114), A
+L1981:
+	AND XWA, XIY
+L1982:
+	ADC H, L
+L1983:
+	CP (XIX), C
+L1984:
+	ADC XIZ, XBC
+L1985:
+	ADD E, 18
+L1986:
+	OR L, (XIZ+14497:16)
+L1987:
+	AND E, C
+L1988:
+	OR D, 227
+L1989:
+	SUB B, (FAR)
+L1990:
+	SBC E, B
+L1991:
+	CP (XHL+6), C
+L1992:
+	XOR L, (XWA+B)
+L1993:
+	AND L, 185
+L1994:
+	ADC XIZ, XIY
+L1995:
+	SBC W, (XWA+BC)
+L1996:
+	SBC (XWA+BC), E
+L1997:
+	AND L, (XDE+97)
+L1998:
+	SUB WA, 17835
+L1999:
+	AND XIZ, XIZ
+L2000:
+	AND B, (XIZ+13047:16)
+L2001:
+	SUB XDE, XIZ
+L2002:
+	ADD C, 218
+L2003:
+	SBC (XIZ+48), D
+L2004:
+	CP L, A
+L2005:
+	AND DE, 2314
+L2006:
+	XOR A, (XIY+53:8)
+L2007:
+	SUB WA, 62892
+L2008:
+	OR XIY, XDE
+L2009:
+	CP H, 64
+L2010:
+	XOR H, (XIY)
+L2011:
+	SUB W, (L2008:24)
+L2012:
+	SUB XIZ, XHL
+L2013:
+	XOR (XIZ+27076:16), D
+L2014:
+	SUB IY, 26445
+L2015:
+	CP (XWA-59), L
+L2016:
+	CP D, (XWA+16:8)
+L2017:
+	ADD (XDE-97), B
+L2018:
+	SBC IZ, 33331
+L2019:
+	ADC XIY, XIY
+L2020:
+	XOR C, (XBC)
+L2021:
+	ADD W, A
+L2022:
+	CP W, 227
+L2023:
+	AND WA, 10558
+L2024:
+	SBC C, W
+L2025:
+	SUB (P0), W
+L2026:
+	SUB (XIX+1337), H
+L2027:
+	ADD D, (XIX+115:8)
+L2028:
+	AND HL, 48991
+L2029:
+	ADD XWA, XBC
+L2030:
+	ADC A, 221
+L2031:
+	CP C, W
+L2032:
+	SUB D, (XHL-94)
+L2033:
+	AND E, (FAR)
+L2034:
+	SUB A, 69
+L2035:
+	SBC XDE, XIZ
+L2036:
+	XOR D, 246
+L2037:
+	XOR XIY, XBC
+L2038:
+	CP WA, 7475
+L2039:
+	SUB XIX, XIY
+L2040:
+	AND W, 120
+L2041:
+	XOR A, C
+L2042:
+	ADD L, 139
+L2043:
+	ADD (XHL-73), L
+L2044:
+	OR W, 102
+L2045:
+	SUB WA, 60705
+L2046:
+	AND DE, 20283
+L2047:
+	XOR C, 62
+L2048:
+	ADC H, 206
+L2049:
+	OR (XIX+2262), L
+L2050:
+	SUB B, (XIY+12062:16)
+L2051:
+	ADD E, 240
+L2052:
+	CP XIZ, XIY
+L2053:
+	OR C, (XBC)
+L2054:
+	SUB H, 226
+L2055:
+	AND (XIX+2313), W
+L2056:
+	XOR E, 11
+L2057:
+	XOR (L2055:24), H
+L2058:
+	SBC XHL, XDE
+L2059:
+	SBC DE, 13643
+L2060:
+	SBC XIY, XHL
+L2061:
+	ADC IX, 18878
+L2062:
+	SUB A, (L1720)
+L2063:
+	SBC IX, 1591
+L2064:
+	AND C, 41
+L2065:
+	SBC B, 250
+L2066:
+	OR XBC, XHL
+L2067:
+	CP BC, 31469
+L2068:
+	OR XBC, XDE
+L2069:
+	ADD XWA, XIY
+L2070:
+	XOR B, H
+L2071:
+	SUB B, W
+L2072:
+	SBC (XIZ+33), B
+L2073:
+	ADC B, 203
+L2074:
+	CP (XIX+87:8), E
+L2075:
+	CP H, (XIY-14)
+L2076:
+	SUB BC, 61229
+L2077:
+	CP D, C
+L2078:
+	SBC C, L
+L2079:
+	ADC E, 254
+L2080:
+	SUB B, H
+L2081:
+	ADD E, (L2080)
+L2082:
+	SUB DE, 41510
+L2083:
+	SUB H, 202
+L2084:
+	CP BC, 18613
+L2085:
+	AND C, 248
+L2086:
+	OR IX, 41891
+L2087:
+	CP D, (XWA+BC)
+L2088:
+	SBC E, 253
+L2089:
+	SBC (XHL-52), H
+L2090:
+	XOR L, W
+L2091:
+	AND (L2095), A
+L2092:
+	SBC W, 129
+L2093:
+	AND DE, 21445
+L2094:
+	CP L, 145
+L2095:
+	OR H, H
+L2096:
+	CP IZ, 15100
+L2097:
+	CP H, 94
+L2098:
+	CP WA, 19515
+L2099:
+	SUB W, B
+L2100:
+	CP A, (BIGREG)
+L2101:
+	ADC C, (XIZ+101:8)
+L2102:
+	XOR (L2907:24), D
+L2103:
+	SUB D, H
+L2104:
+	ADD L, (XWA)
+L2105:
+	AND H, (L2107)
+L2106:
+	ADD A, (XIY+24401:16)
+L2107:
+	OR W, (XWA)
+L2108:
+	OR H, B
+L2109:
+	ADC DE, 4577
+L2110:
+	SUB W, B
+L2111:
+	OR IZ, 43326
+L2112:
+	SUB XDE, XIZ
+L2113:
+	OR IZ, 19213
+L2114:
+	OR XIZ, XIX
+L2115:
+	OR DE, 19091
+L2116:
+	ADD D, 117
+L2117:
+	CP XIZ, XIY
+L2118:
+	XOR E, C
+L2119:
+	CP (L2119:24), L
+L2120:
+	OR XIX, XIX
+L2121:
+	XOR (XWA-58), A
+L2122:
+	SUB E, L
+L2123:
+	CP B, 125
+L2124:
+	ADD B, (L3907)
+L2125:
+	OR BC, 33332
+L2126:
+	SUB WA, 7057
+L2127:
+	XOR DE, 9374
+L2128:
+	ADC L, 93
+L2129:
+	XOR H, W
+L2130:
+	ADC A, (XDE-51)
+L2131:
+	SBC H, B
+L2132:
+	SBC DE, 29358
+L2133:
+	SUB H, 131
+L2134:
+	XOR (L731:24), L
+L2135:
+	ADC (L1570), C
+L2136:
+	ADD E, 85
+L2137:
+	SUB IX, 22415
+L2138:
+	AND (XWA+B), D
+L2139:
+	ADC XIX, XBC
+L2140:
+	AND A, 38
+L2141:
+	ADC XDE, XWA
+L2142:
+	AND (P0), W
+L2143:
+	CP XDE, XDE
+L2144:
+	SUB XHL, XDE
+L2145:
+	ADD H, L
+L2146:
+	XOR E, 1
+L2147:
+	XOR C, (XIZ-8)
+L2148:
+	SBC HL, 64955
+L2149:
+	SUB A, 23
+L2150:
+	OR H, (XHL+15392:16)
+L2151:
+	ADD IY, 28036
+L2152:
+	ADD E, (XWA+B)
+L2153:
+	ADC WA, 20111
+L2154:
+	SBC IY, 58302
+L2155:
+	OR (XWA+B), B
+L2156:
+	OR E, E
+L2157:
+	OR WA, 26748
+L2158:
+	OR C, E
+L2159:
+	ADC B, H
+L2160:
+	XOR L, (L2160:24)
+L2161:
+	CP XIY, XBC
+L2162:
+	SBC H, D
+L2163:
+	CP D, E
+L2164:
+	ADC L, (XBC)
+L2165:
+	ADD BC, 42577
+L2166:
+	ADC (XBC-64), H
+L2167:
+	SUB W, (XWA+BC)
+L2168:
+	SUB E, 255
+L2169:
+	CP (XDE+77:8), H
+L2170:
+	ADC XWA, XBC
+L2171:
+	ADD (XIZ+26:8), C
+L2172:
+	SBC (XWA), D
+L2173:
+	OR HL, 1417
+L2174:
+	AND E, (XWA+B)
+L2175:
+	ADC W, H
+L2176:
+	ADD (L1705:24), D
+L2177:
+	CP W, 30
+L2178:
+	ADD L, A
+L2179:
+	ADC W, (XIX+1969)
+L2180:
+	AND E, (XWA+B)
+L2181:
+	CP D, 2
+L2182:
+	OR E, B
+L2183:
+	ADC C, H
+L2184:
+	CP W, (XBC+75)
+L2185:
+	SBC C, (XHL+48:8)
+L2186:
+	XOR W, (FAR)
+L2187:
+	AND C, W
+L2188:
+	AND A, C
+L2189:
+	CP H, A
+L2190:
+	SUB XIX, XIX
+L2191:
+	ADD L, (XIX+122:8)
+L2192:
+	OR C, W
+L2193:
+	XOR L, (FAR)
+L2194:
+	CP IZ, 21916
+L2195:
+	OR B, (XIZ)
+L2196:
+	ADC XHL, XHL
+L2197:
+	SUB W, (L4198)
+L2198:
+	ADD E, (FAR)
+L2199:
+	ADD (XBC-19), H
+L2200:
+	SBC D, L
+L2201:
+	SUB XHL, XIX
+L2202:
+	XOR XIY, XIY
+L2203:
+	OR (L2203), W
+L2204:
+	OR E, C
+L2205:
+	XOR B, H
+L2206:
+	ADC IY, 19767
+L2207:
+	ADC IZ, 31264
+L2208:
+	XOR HL, 29497
+L2209:
+	XOR H, B
+L2210:
+	AND D, 65
+L2211:
+	CP H, H
+L2212:
+	ADC W, (XDE-37)
+L2213:
+	ADC IY, 15547
+L2214:
+	SUB XWA, XHL
+L2215:
+	XOR XWA, XIY
+L2216:
+	XOR E, 18
+L2217:
+	SBC W, 139
+L2218:
+	SBC (XDE+44), D
+L2219:
+	XOR XIZ, XWA
+L2220:
+	SUB B, W
+L2221:
+	OR W, (XDE+68)
+L2222:
+	SUB XIX, XIX
+L2223:
+	ADD W, C
+L2224:
+	ADC (L2228:24), D
+L2225:
+	ADC WA, 58947
+L2226:
+	OR B, W
+L2227:
+	ADD IY, 35788
+L2228:
+	CP BC, 18904
+L2229:
+	CP D, (FAR)
+L2230:
+	CP XIY, XHL
+L2231:
+	ADC D, L
+L2232:
+	AND D, 117
+L2233:
+	ADD B, L
+L2234:
+	CP XWA, XIZ
+L2235:
+	ADC L, (XWA+B)
+L2236:
+	XOR IX, 50350
+L2237:
+	SUB (XWA+BC), A
+L2238:
+	ADD IY, 1441
+L2239:
+	CP E, E
+L2240:
+	SBC (L3346:24), B
+L2241:
+	ADD XHL, XDE
+L2242:
+	ADC E, (XIY+70)
+L2243:
+	OR IZ, 24809
+L2244:
+	ADD XBC, XBC
+L2245:
+	XOR C, D
+L2246:
+	ADC DE, 13376
+L2247:
+	SBC D, B
+L2248:
+	ADC B, W
+L2249:
+	XOR IX, 5053
+L2250:
+	ADC A, W
+L2251:
+	SUB IZ, 58603
+L2252:
+	AND XDE, XIX
+L2253:
+	SUB W, (XIX+8:8)
+L2254:
+	OR HL, 44648
+L2255:
+	CP XHL, XDE
+L2256:
+	SUB XHL, XIX
+L2257:
+	ADD A, D
+L2258:
+	ADD W, (L2259)
+L2259:
+	SBC (L2263), E
+L2260:
+	OR (XWA+27784:16), D
+L2261:
+	XOR B, 93
+L2262:
+	SBC (XIX+2685), A
+L2263:
+	ADD XHL, XDE
+L2264:
+	ADD H, 189
+L2265:
+	ADC DE, 18641
+L2266:
+	SUB BC, 18695
+L2267:
+	SBC B, A
+L2268:
+	CP D, 4
+L2269:
+	ADC WA, 31848
+L2270:
+	OR (XIY+11429:16), C
+L2271:
+	ADD DE, 4715
+L2272:
+	CP C, C
+L2273:
+	XOR IX, 32632
+L2274:
+	SBC C, E
+L2275:
+	CP A, 255
+L2276:
+	AND WA, 16673
+L2277:
+	CP BC, 29804
+L2278:
+	SUB IX, 37906
+L2279:
+	ADC L, D
+L2280:
+	ADD C, D
+L2281:
+	SBC D, B
+L2282:
+	ADD XIX, XWA
+L2283:
+	ADC W, (XBC)
+L2284:
+	SBC D, L
+L2285:
+	XOR (XIX+2997), D
+L2286:
+	ADD B, 158
+L2287:
+	ADD IY, 36101
+L2288:
+	SBC W, (XIX+992)
+L2289:
+	OR IX, 17357
+L2290:
+	SUB (L2293), W
+L2291:
+	SUB (XWA+B), A
+L2292:
+	AND C, 137
+L2293:
+	SUB A, L
+L2294:
+	SBC E, 234
+L2295:
+	ADC (XBC+5), L
+L2296:
+	ADC D, 97
+L2297:
+	AND B, 106
+L2298:
+	SBC (XIY), D
+L2299:
+	ADC H, (XWA+BC)
+L2300:
+	CP DE, 25414
+L2301:
+	OR C, (XWA+B)
+L2302:
+	ADD (XDE), B
+L2303:
+	SUB A, 76
+L2304:
+	SUB L, B
+L2305:
+	CP XDE, XDE
+L2306:
+	XOR (XBC+88:8), B
+L2307:
+	XOR H, 116
+L2308:
+	OR L, 29
+L2309:
+	SUB (XWA+BC), E
+L2310:
+	ADC DE, 60374
+L2311:
+	XOR E, (P0)
+L2312:
+	AND A, (L4603:24)
+L2313:
+	SBC W, 228
+L2314:
+	SBC DE, 62599
+L2315:
+	ADD IX, 21529
+L2316:
+	ADD (L2312:24), A
+L2317:
+	SBC L, W
+L2318:
+	ADC A, 188
+L2319:
+	AND WA, 43051
+L2320:
+	AND (XIX+208), C
+L2321:
+	OR IZ, 64438
+L2322:
+	CP D, 135
+L2323:
+	ADD XIY, XIX
+L2324:
+	ADC (L2328:24), E
+L2325:
+	SBC HL, 28965
+L2326:
+	SBC B, A
+L2327:
+	SUB E, A
+L2328:
+	XOR L, (L2326:24)
+L2329:
+	ADD D, (XWA+BC)
+L2330:
+	ADC L, W
+L2331:
+	SUB B, H
+L2332:
+	SBC A, 181
+L2333:
+	OR L, D
+L2334:
+	ADD XIZ, XDE
+L2335:
+	OR L, (XHL+88:8)
+L2336:
+	OR L, D
+L2337:
+	XOR H, 89
+L2338:
+	AND XIY, XDE
+L2339:
+	XOR H, 11
+L2340:
+	ADD BC, 46649
+L2341:
+	ADD XDE, XIY
+L2342:
+	ADD B, 132
+L2343:
+	SUB BC, 18307
+L2344:
+	SBC C, 184
+L2345:
+	ADD D, (XDE)
+L2346:
+	XOR A, (XWA)
+L2347:
+	AND XIZ, XHL
+L2348:
+	SUB XBC, XWA
+L2349:
+	XOR (L2352:24), L
+L2350:
+	SUB XIZ, XHL
+L2351:
+	OR H, 121
+L2352:
+	AND D, (XDE)
+L2353:
+	OR (XBC), H
+L2354:
+	ADD (XIZ+28861:16), B
+L2355:
+	SUB W, 97
+L2356:
+	XOR E, 119
+L2357:
+	ADD IZ, 989
+L2358:
+	SBC HL, 60981
+L2359:
+	ADD A, (XIZ+14)
+L2360:
+	XOR XWA, XIX
+L2361:
+	SBC XBC, XHL
+L2362:
+	OR D, W
+L2363:
+	SBC D, W
+L2364:
+	OR (P0), D
+L2365:
+	ADD (XIX-21), D
+L2366:
+	AND H, A
+L2367:
+	SBC E, W
+L2368:
+	ADC IX, 22591
+L2369:
+	OR D, (L2372:24)
+L2370:
+	ADC D, L
+L2371:
+	SBC IY, 44986
+L2372:
+	OR XBC, XDE
+L2373:
+	XOR A, (XDE+29144:16)
+L2374:
+	OR A, B
+L2375:
+	CP (P0), B
+L2376:
+	ADC IX, 39727
+L2377:
+	ADD (XWA), C
+L2378:
+	ADC DE, 61146
+L2379:
+	XOR E, C
+L2380:
+	ADD XIX, XIZ
+L2381:
+	CP DE, 58523
+L2382:
+	SBC BC, 38343
+L2383:
+	ADC IY, 9515
+L2384:
+	AND W, H
+L2385:
+	AND XIZ, XWA
+L2386:
+	SUB HL, 32336
+L2387:
+	CP A, (XIY+16418:16)
+L2388:
+	ADC (XWA+BC), C
+L2389:
+	SUB (BIGREG), W
+L2390:
+	ADC (L2389), W
+L2391:
+	CP (XHL+69), E
+L2392:
+	OR H, 248
+L2393:
+	SUB H, (XWA+BC)
+L2394:
+	ADD B, A
+L2395:
+	SUB W, W
+L2396:
+	AND XBC, XDE
+L2397:
+	ADC A, 14
+L2398:
+	SUB W, 113
+L2399:
+	AND XDE, XBC
+L2400:
+	XOR (XBC), B
+L2401:
+	ADC B, 247
+L2402:
+	XOR (L2406), L
+L2403:
+	OR (XWA+85), D
+L2404:
+	OR L, L
+L2405:
+	ADD (XIZ+24), L
+L2406:
+	SUB (L2404:24), H
+L2407:
+	XOR IX, 53900
+L2408:
+	AND XDE, XIX
+L2409:
+	AND XIY, XIY
+L2410:
+	SBC A, D
+L2411:
+	SBC IX, 56963
+L2412:
+	SBC WA, 1381
+L2413:
+	ADD D, 138
+L2414:
+	ADC XWA, XWA
+L2415:
+	ADC C, 218
+L2416:
+	SBC W, D
+L2417:
+	SUB XWA, XBC
+L2418:
+	SBC XIX, XWA
+L2419:
+	OR A, 78
+L2420:
+	ADD XWA, XIZ
+L2421:
+	SBC (XDE-31), C
+L2422:
+	SUB (XIZ+84), E
+L2423:
+	OR A, (P0)
+L2424:
+	OR IZ, 37817
+L2425:
+	SUB W, L
+L2426:
+	AND (XIX-50), D
+L2427:
+	XOR (P0), H
+L2428:
+	AND XIX, XWA
+L2429:
+	SBC C, (L2430:24)
+L2430:
+	SUB (L2432), L
+L2431:
+	CP XDE, XIY
+L2432:
+	XOR H, C
+L2433:
+	SUB XIZ, XDE
+L2434:
+	ADC XIY, XWA
+L2435:
+	AND XDE, XHL
+L2436:
+	SUB IY, 60670
+L2437:
+	ADC WA, 13975
+L2438:
+	AND (XWA+BC), A
+L2439:
+	SBC C, 79
+L2440:
+	XOR BC, 51660
+L2441:
+	OR H, B
+L2442:
+	XOR XIX, XWA
+L2443:
+	XOR XBC, XDE
+L2444:
+	SBC D, 222
+L2445:
+	ADD L, 46
+L2446:
+	SUB (XHL), D
+L2447:
+	XOR B, (XBC)
+L2448:
+	OR D, E
+L2449:
+	CP A, 115
+L2450:
+	SBC L, (XBC+24004:16)
+L2451:
+	SBC H, A
+L2452:
+	OR IX, 756
+L2453:
+	OR A, B
+L2454:
+	ADD IY, 35180
+L2455:
+	AND D, L
+L2456:
+	OR (XIZ+92), H
+L2457:
+	CP XIY, XHL
+L2458:
+	OR A, (XWA+26:8)
+L2459:
+	OR C, A
+L2460:
+	OR E, 25
+L2461:
+	SBC IY, 49182
+L2462:
+	XOR DE, 24000
+L2463:
+	XOR HL, 24486
+L2464:
+	SUB C, (XIZ+99)
+L2465:
+	SBC B, (XBC+77)
+L2466:
+	SUB L, 177
+L2467:
+	SUB H, (XWA-93)
+L2468:
+	ADD E, B
+L2469:
+	SBC IZ, 57565
+L2470:
+	SUB IZ, 3824
+L2471:
+	XOR (XWA+B), C
+L2472:
+	AND B, C
+L2473:
+	ADD (L2469), H
+L2474:
+	AND XHL, XDE
+L2475:
+	SUB C, C
+L2476:
+	SBC B, 159
+L2477:
+	ADC D, (XIY+9110:16)
+L2478:
+	OR A, L
+L2479:
+	OR W, 48
+L2480:
+	AND B, B
+L2481:
+	OR A, (L2482:24)
+L2482:
+	CP H, 172
+L2483:
+	SBC HL, 51517
+L2484:
+	ADD D, 109
+L2485:
+	ADD (XIX+2864), E
+L2486:
+	XOR XDE, XHL
+L2487:
+	CP XWA, XHL
+L2488:
+	AND XBC, XIX
+L2489:
+	XOR XHL, XIX
+L2490:
+	SBC IY, 30756
+L2491:
+	XOR H, (XWA+B)
+L2492:
+	XOR XBC, XHL
+L2493:
+	ADC (XIX+2709), C
+L2494:
+	CP XHL, XIY
+L2495:
+	OR XIX, XWA
+L2496:
+	ADD XIY, XDE
+L2497:
+	AND IX, 41460
+L2498:
+	OR XIY, XDE
+L2499:
+	ADD XIZ, XWA
+L2500:
+	SUB E, (XWA+BC)
+L2501:
+	OR (XIY+19144:16), C
+L2502:
+	XOR IX, 12474
+L2503:
+	XOR (XIY-19), D
+L2504:
+	CP (XIX+2218), L
+L2505:
+	OR W, 60
+L2506:
+	ADC L, (L2507:24)
+L2507:
+	XOR H, 229
+L2508:
+	CP W, C
+L2509:
+	SBC XDE, XIX
+L2510:
+	XOR (XIX-56), L
+L2511:
+	OR W, 183
+L2512:
+	CP DE, 27311
+L2513:
+	AND H, (L2514)
+L2514:
+	ADC IX, 54617
+L2515:
+	OR D, (FAR)
+L2516:
+	ADC (XIY+69), W
+L2517:
+	OR (XDE+19:8), E
+L2518:
+	AND XIZ, XHL
+L2519:
+	OR XDE, XIX
+L2520:
+	XOR D, 158
+L2521:
+	ADC H, E
+L2522:
+	SUB WA, 34271
+L2523:
+	SBC WA, 54326
+L2524:
+	OR C, H
+L2525:
+	SBC D, (XHL+89:8)
+L2526:
+	OR L, E
+L2527:
+	AND IZ, 11544
+L2528:
+	ADC L, 121
+L2529:
+	OR B, 145
+L2530:
+	ADD A, (XHL)
+L2531:
+	OR W, C
+L2532:
+	OR XIZ, XHL
+L2533:
+	SBC W, W
+L2534:
+	ADC XIZ, XWA
+L2535:
+	CP XIY, XBC
+L2536:
+	SUB (XIZ+31:8), H
+L2537:
+	XOR E, B
+L2538:
+	SUB A, (P0)
+L2539:
+	XOR WA, 36991
+L2540:
+	OR BC, 52822
+L2541:
+	AND C, 199
+L2542:
+	AND H, (XDE-6)
+L2543:
+	CP A, (FAR)
+L2544:
+	ADC (XWA+95), W
+L2545:
+	SUB L, (XIX+2671)
+L2546:
+	XOR C, 224
+L2547:
+	AND WA, 31771
+L2548:
+	OR C, (XIZ+29578:16)
+L2549:
+	ADC A, 155
+L2550:
+	XOR (L2547:24), W
+L2551:
+	CP XDE, XBC
+L2552:
+	CP (XHL-90), B
+L2553:
+	ADC DE, 55320
+L2554:
+	CP E, 169
+L2555:
+	XOR A, 19
+L2556:
+	CP (XDE), E
+L2557:
+	AND XIZ, XIZ
+L2558:
+	ADC (XBC), B
+L2559:
+	AND A, W
+L2560:
+	AND (XIX+2560), D
+L2561:
+	ADC XBC, XIX
+L2562:
+	OR E, (L2559)
+L2563:
+	CP (XBC+17:8), A
+L2564:
+	CP IX, 23057
+L2565:
+	SBC C, (XHL+22:8)
+L2566:
+	SUB HL, 41880
+L2567:
+	ADC IY, 40549
+L2568:
+	ADC (BIGREG), W
+L2569:
+	SUB WA, 55711
+L2570:
+	AND E, 193
+L2571:
+	AND A, W
+L2572:
+	SBC A, 26
+L2573:
+	ADC D, C
+L2574:
+	ADD (L2100:24), A
+L2575:
+	SBC L, 109
+L2576:
+	OR IZ, 58226
+L2577:
+	ADD C, (FAR)
+L2578:
+	CP HL, 14123
+L2579:
+	ADC (L2576:24), L
+L2580:
+	ADC BC, 20338
+L2581:
+	OR E, 145
+L2582:
+	OR B, 7
+L2583:
+	XOR IX, 5569
+L2584:
+	ADD B, W
+L2585:
+	ADC C, 224
+L2586:
+	SUB IZ, 5479
+L2587:
+	OR BC, 34882
+L2588:
+	ADD H, (BIGREG)
+L2589:
+	AND XIX, XWA
+L2590:
+	OR B, 188
+L2591:
+	ADD XIY, XHL
+L2592:
+	SUB C, (XIX+121:8)
+L2593:
+	ADC H, 86
+L2594:
+	ADD IY, 47220
+L2595:
+	XOR XBC, XHL
+L2596:
+	ADD L, (XWA+BC)
+L2597:
+	ADC B, W
+L2598:
+	OR D, (XIX+24023:16)
+L2599:
+	ADC XDE, XBC
+L2600:
+	ADD W, (XDE+10)
+L2601:
+	ADD HL, 47812
+L2602:
+	SUB (L4212), L
+L2603:
+	ADC E, A
+L2604:
+	XOR (P0), H
+L2605:
+	AND B, 133
+L2606:
+	XOR (XIX+10), L
+L2607:
+	AND XBC, XHL
+L2608:
+	OR H, 168
+L2609:
+	ADD W, (XIX-11)
+L2610:
+	CP W, W
+L2611:
+	ADD BC, 22293
+L2612:
+	SBC XWA, XBC
+L2613:
+	XOR H, (XWA+BC)
+L2614:
+	XOR B, E
+L2615:
+	SUB H, 109
+L2616:
+	ADD IY, 53833
+L2617:
+	ADD A, E
+L2618:
+	CP WA, 37216
+L2619:
+	XOR XWA, XWA
+L2620:
+	ADD E, (XHL-62)
+L2621:
+	SBC W, H
+L2622:
+	XOR XHL, XIY
+L2623:
+	SBC XHL, XHL
+L2624:
+	AND D, 215
+L2625:
+	AND BC, 16567
+L2626:
+	SUB IX, 20645
+L2627:
+	SBC E, 9
+L2628:
+	XOR XWA, XIZ
+L2629:
+	SBC (XBC-89), B
+L2630:
+	OR (L2627), D
+L2631:
+	SBC C, A
+L2632:
+	CP L, 11
+L2633:
+	ADD L, (XWA+45)
+L2634:
+	ADD D, H
+L2635:
+	ADD XHL, XIZ
+L2636:
+	ADD (XHL+93), C
+L2637:
+	OR A, C
+L2638:
+	SBC WA, 34143
+L2639:
+	OR A, A
+L2640:
+	CP C, L
+L2641:
+	AND HL, 1509
+L2642:
+	ADC L, D
+L2643:
+	XOR XDE, XDE
+L2644:
+	SUB WA, 15596
+L2645:
+	XOR A, E
+L2646:
+	AND (L2644), H
+L2647:
+	CP H, 9
+L2648:
+	AND XBC, XHL
+L2649:
+	SBC H, C
+L2650:
+	AND XBC, XIY
+L2651:
+	AND B, 92
+L2652:
+	AND L, (L2653)
+L2653:
+	AND (XIX), C
+L2654:
+	CP E, 190
+L2655:
+	SBC H, (XIX+489)
+L2656:
+	ADC H, 197
+L2657:
+	CP E, 108
+L2658:
+	OR XHL, XBC
+L2659:
+	AND XHL, XDE
+L2660:
+	OR B, (XWA+56)
+L2661:
+	SUB L, 207
+L2662:
+	ADC WA, 15208
+L2663:
+	AND (XDE+70), H
+L2664:
+	OR (XBC+95), L
+L2665:
+	AND XHL, XBC
+L2666:
+	XOR (XWA+BC), H
+L2667:
+	AND XHL, XBC
+L2668:
+	OR A, (XIX)
+L2669:
+	XOR L, 82
+L2670:
+	CP WA, 60276
+L2671:
+	XOR E, E
+L2672:
+	OR IX, 8770
+L2673:
+	AND XBC, XBC
+L2674:
+	AND D, (XBC-32)
+L2675:
+	ADC XDE, XIY
+L2676:
+	SBC L, 76
+L2677:
+	AND IY, 20782
+L2678:
+	AND H, 106
+L2679:
+	SUB E, (P0)
+L2680:
+	ADC XWA, XHL
+L2681:
+	SUB XWA, XHL
+L2682:
+	ADD W, (XDE+17253:16)
+L2683:
+	ADD (XWA+B), A
+L2684:
+	ADC E, (XWA-8)
+L2685:
+	ADD WA, 46325
+L2686:
+	XOR W, (XIX+2182)
+L2687:
+	XOR (L2684:24), E
+L2688:
+	ADC C, D
+L2689:
+	OR XDE, XIX
+L2690:
+	XOR XIY, XIZ
+L2691:
+	SBC C, 171
+L2692:
+	OR B, 67
+L2693:
+	OR H, (XWA-36)
+L2694:
+	ADC E, 200
+L2695:
+	ADC IZ, 14934
+L2696:
+	CP A, (XWA+99:8)
+L2697:
+	CP E, 212
+L2698:
+	CP C, E
+L2699:
+	CP HL, 35369
+L2700:
+	CP BC, 33841
+L2701:
+	XOR DE, 32192
+L2702:
+	ADD (XHL+18014:16), D
+L2703:
+	SUB (L4797), C
+L2704:
+	SBC E, A
+L2705:
+	SUB XIX, XDE
+L2706:
+	SUB BC, 8355
+L2707:
+	CP IZ, 14461
+L2708:
+	CP D, A
+L2709:
+	ADC E, (FAR)
+L2710:
+	ADC (L2714), L
+L2711:
+	SBC XWA, XBC
+L2712:
+	CP A, (FAR)
+L2713:
+	SUB (L2711), B
+L2714:
+	CP D, 148
+L2715:
+	CP H, 168
+L2716:
+	SUB (XHL+39), A
+L2717:
+	OR C, C
+L2718:
+	ADC BC, 19350
+L2719:
+	AND XIZ, XDE
+L2720:
+	CP HL, 63132
+L2721:
+	SUB (XDE+25:8), B
+L2722:
+	SBC A, 22
+L2723:
+	CP WA, 23352
+L2724:
+	OR A, B
+L2725:
+	OR E, L
+L2726:
+	SBC D, (L2727)
+L2727:
+	SUB XDE, XBC
+L2728:
+	CP XIZ, XBC
+L2729:
+	XOR (XIX), W
+L2730:
+	XOR XIY, XIZ
+L2731:
+	XOR HL, 20378
+L2732:
+	XOR C, L
+L2733:
+	OR A, (XIY)
+L2734:
+	AND L, 73
+L2735:
+	CP (XBC+49:8), E
+L2736:
+	SBC D, 125
+L2737:
+	ADD A, 241
+L2738:
+	CP (XWA+B), C
+L2739:
+	ADD WA, 75
+L2740:
+	AND (L3571:24), D
+L2741:
+	ADC D, H
+L2742:
+	SUB L, L
+L2743:
+	XOR (XWA+BC), W
+L2744:
+	SUB HL, 28818
+L2745:
+	OR B, B
+L2746:
+	ADD XIY, XBC
+L2747:
+	SBC XIX, XIY
+L2748:
+	ADC XDE, XDE
+L2749:
+	CP C, (XDE+61:8)
+L2750:
+	OR XIY, XDE
+L2751:
+	OR (XWA+B), W
+L2752:
+	ADD H, 75
+L2753:
+	XOR WA, 27616
+L2754:
+	SBC W, C
+L2755:
+	XOR E, 49
+L2756:
+	CP H, W
+L2757:
+	ADD L, (XIZ+25705:16)
+L2758:
+	SUB XIY, XIX
+L2759:
+	ADC E, (XIY+13224:16)
+L2760:
+	OR HL, 48815
+L2761:
+	ADC IY, 9310
+L2762:
+	SUB H, 65
+L2763:
+	ADC HL, 37956
+L2764:
+	OR B, B
+L2765:
+	SBC A, (XIZ)
+L2766:
+	ADC C, (XWA+BC)
+L2767:
+	ADC XIX, XIX
+L2768:
+	XOR XWA, XIZ
+L2769:
+	ADD L, E
+L2770:
+	CP (XIY), L
+L2771:
+	XOR XBC, XIY
+L2772:
+	SUB (XIX+17), C
+L2773:
+	SUB A, D
+L2774:
+	ADD D, H
+L2775:
+	SUB W, (XWA+12)
+L2776:
+	SUB D, (BIGREG)
+L2777:
+	OR XDE, XDE
+L2778:
+	ADC C, A
+L2779:
+	ADD DE, 26334
+L2780:
+	AND XBC, XIZ
+L2781:
+	SBC W, (XIY+125:8)
+L2782:
+	SBC A, B
+L2783:
+	SBC B, 52
+L2784:
+	SBC E, L
+L2785:
+	AND H, (XBC-60)
+L2786:
+	AND (BIGREG), D
+L2787:
+	ADC E, C
+L2788:
+	SBC XWA, XIY
+L2789:
+	SBC H, C
+L2790:
+	XOR D, (P0)
+L2791:
+	ADD A, 105
+L2792:
+	ADC W, 234
+L2793:
+	CP XHL, XBC
+L2794:
+	ADD A, W
+L2795:
+	SUB (XWA-33), E
+L2796:
+	ADD W, 44
+L2797:
+	OR XIY, XWA
+L2798:
+	ADC XIX, XHL
+L2799:
+	SBC XHL, XDE
+L2800:
+	ADD W, (XHL+106:8)
+L2801:
+	SUB IY, 53506
+L2802:
+	AND H, (XIX+2840)
+L2803:
+	SBC XBC, XDE
+L2804:
+	ADC A, (XIY+3996:16)
+L2805:
+	SUB H, H
+L2806:
+	CP IY, 13607
+L2807:
+	SUB W, D
+L2808:
+	ADD H, 113
+L2809:
+	ADC (BIGREG), H
+L2810:
+	SBC HL, 18095
+L2811:
+	SBC W, 1
+L2812:
+	SUB W, 23
+L2813:
+	SUB XBC, XIZ
+L2814:
+	OR (XIX), W
+L2815:
+	SUB C, (XBC)
+L2816:
+	SUB BC, 29690
+L2817:
+	SBC B, (L1728:24)
+L2818:
+	CP A, D
+L2819:
+	OR L, (XIZ+28527:16)
+L2820:
+	OR W, (XWA+B)
+L2821:
+	SBC W, E
+L2822:
+	AND B, (XDE-9)
+L2823:
+	CP C, 79
+L2824:
+	SBC XIX, XIZ
+L2825:
+	XOR W, (XDE-77)
+L2826:
+	ADD E, H
+L2827:
+	AND (L3427:24), L
+L2828:
+	SBC L, (XHL-20)
+L2829:
+	ADC A, (XWA+BC)
+L2830:
+	XOR D, 167
+L2831:
+	ADD WA, 14395
+L2832:
+	CP (L2836), B
+L2833:
+	ADD HL, 24158
+L2834:
+	ADD D, (L2836)
+L2835:
+	XOR D, W
+L2836:
+	XOR L, D
+L2837:
+	XOR (L2836:24), E
+L2838:
+	XOR C, (XHL)
+L2839:
+	ADD W, (XIY+24439:16)
+L2840:
+	CP XIX, XBC
+L2841:
+	XOR XHL, XWA
+L2842:
+	SUB L, (XHL+16147:16)
+L2843:
+	XOR WA, 40458
+L2844:
+	OR H, (XWA+BC)
+L2845:
+	ADC (XBC-25), H
+L2846:
+	CP (XIY-79), H
+L2847:
+	SUB A, 145
+L2848:
+	SUB H, (L2849:24)
+L2849:
+	ADC BC, 6460
+L2850:
+	CP XBC, XBC
+L2851:
+	AND DE, 44819
+L2852:
+	SUB BC, 26623
+L2853:
+	SBC C, 216
+L2854:
+	ADC A, (L2855:24)
+L2855:
+	SUB XDE, XIZ
+L2856:
+	CP L, (L2860:24)
+L2857:
+	ADD XIY, XIY
+L2858:
+	OR (XIX+108:8), C
+L2859:
+	CP XIX, XIY
+L2860:
+	OR L, (XWA+B)
+L2861:
+	SBC H, (XWA+73:8)
+L2862:
+	ADD (L2858), L
+L2863:
+	SUB BC, 48394
+L2864:
+	XOR (BIGREG), E
+L2865:
+	XOR DE, 21850
+L2866:
+	ADC XIZ, XDE
+L2867:
+	SBC A, (XHL+16986:16)
+L2868:
+	SUB IZ, 10819
+L2869:
+	SBC XIX, XIY
+L2870:
+	ADC L, 37
+L2871:
+	ADD (XWA-15), B
+L2872:
+	XOR E, B
+L2873:
+	ADC D, (XIZ-93)
+L2874:
+	OR (XWA+BC), B
+L2875:
+	SBC XBC, XIX
+L2876:
+	SUB IX, 42685
+L2877:
+	SUB IZ, 63175
+L2878:
+	SBC A, 144
+L2879:
+	SBC B, 98
+L2880:
+	XOR L, 152
+L2881:
+	ADD C, (XIX+2710)
+L2882:
+	OR B, 219
+L2883:
+	AND H, 138
+L2884:
+	OR H, 147
+L2885:
+	OR E, W
+L2886:
+	CP XBC, XIY
+L2887:
+	AND (L158), H
+L2888:
+	XOR L, E
+L2889:
+	OR DE, 40861
+L2890:
+	OR A, 23
+L2891:
+	ADD H, 11
+L2892:
+	OR H, A
+L2893:
+	SUB XIZ, XIZ
+L2894:
+	AND W, (XBC+95)
+L2895:
+	XOR B, (XDE)
+L2896:
+	SBC B, (XWA+B)
+L2897:
+	SUB XWA, XIX
+L2898:
+	SBC XWA, XHL
+L2899:
+	OR DE, 65333
+L2900:
+	ADD XIX, XWA
+L2901:
+	ADD D, (XIY+26449:16)
+L2902:
+	CP (XIZ+115:8), A
+L2903:
+	CP IY, 17102
+L2904:
+	OR (XIY+1), D
+L2905:
+	CP IY, 52787
+L2906:
+	OR IX, 50349
+L2907:
+	ADC L, B
+L2908:
+	SUB XIX, XBC
+L2909:
+	ADD WA, 64397
+L2910:
+	ADD (XIZ), B
+L2911:
+	SUB L, A
+L2912:
+	SUB L, D
+L2913:
+	ADC B, W
+L2914:
+	SBC XBC, XBC
+L2915:
+	ADC D, 121
+L2916:
+	ADD (XWA+B), W
+L2917:
+	SBC D, 100
+L2918:
+	CP (L1272:24), B
+L2919:
+	AND C, B
+L2920:
+	ADC C, H
+L2921:
+	OR E, 169
+L2922:
+	XOR W, 41
+L2923:
+	OR XWA, XHL
+L2924:
+	XOR (L2926), E
+L2925:
+	SBC H, (BIGREG)
+L2926:
+	ADC E, (XWA+B)
+L2927:
+	ADC (XWA+48), C
+L2928:
+	ADC E, C
+L2929:
+	SBC W, 149
+L2930:
+	SBC A, A
+L2931:
+	ADC XWA, XIX
+L2932:
+	ADC BC, 47275
+L2933:
+	ADC B, (XDE-81)
+L2934:
+	ADC (L1724:24), A
+L2935:
+	ADD XBC, XDE
+L2936:
+	XOR IY, 29549
+L2937:
+	CP IX, 53728
+L2938:
+	CP L, C
+L2939:
+	AND L, (XHL-3)
+L2940:
+	SBC C, (L2936:24)
+L2941:
+	ADC WA, 45838
+L2942:
+	CP HL, 30988
+L2943:
+	SUB (XHL+97:8), L
+L2944:
+	XOR L, 122
+L2945:
+	ADD XBC, XIY
+L2946:
+	ADD D, 228
+L2947:
+	OR B, (L2944)
+L2948:
+	CP (XIX+1557), H
+L2949:
+	ADC L, (XBC+74)
+L2950:
+	SUB L, 172
+L2951:
+	OR H, (L2951:24)
+L2952:
+	CP B, 169
+L2953:
+	SUB IZ, 16301
+L2954:
+	ADC (XBC+98:8), W
+L2955:
+	CP C, (FAR)
+L2956:
+	SBC W, E
+L2957:
+	AND L, (FAR)
+L2958:
+	ADD XWA, XHL
+L2959:
+	XOR (L2963:24), H
+L2960:
+	AND XWA, XIY
+L2961:
+	SBC XDE, XHL
+L2962:
+	OR D, (L3295)
+L2963:
+	ADD BC, 53838
+L2964:
+	XOR (L2960:24), A
+L2965:
+	AND (P0), C
+L2966:
+	ADC XIY, XIY
+L2967:
+	XOR IX, 38037
+L2968:
+	ADC (L2972:24), D
+L2969:
+	SBC WA, 33992
+L2970:
+	XOR (P0), L
+L2971:
+	AND W, 254
+L2972:
+	SBC H, 114
+L2973:
+	OR W, H
+L2974:
+	XOR A, 101
+L2975:
+	OR XHL, XIX
+L2976:
+	SBC HL, 55043
+L2977:
+	AND (BIGREG), B
+L2978:
+	AND C, B
+L2979:
+	ADC DE, 33752
+L2980:
+	XOR W, (XWA+BC)
+L2981:
+	CP XIZ, XWA
+L2982:
+	SBC BC, 45917
+L2983:
+	ADC B, 245
+L2984:
+	OR B, 70
+L2985:
+	AND H, 125
+L2986:
+	SBC A, 164
+L2987:
+	ADC (XIX+5), L
+L2988:
+	ADD W, (L2987)
+L2989:
+	ADC C, E
+L2990:
+	CP XIY, XIX
+L2991:
+	CP D, 22
+L2992:
+	XOR BC, 33261
+L2993:
+	AND XIX, XIX
+L2994:
+	CP A, (XIX+2905)
+L2995:
+	XOR IX, 16317
+L2996:
+	XOR W, (XIX+85)
+L2997:
+	OR W, D
+L2998:
+	SUB W, 243
+L2999:
+	SUB XIZ, XIX
+L3000:
+	ADC B, C
+L3001:
+	OR E, H
+L3002:
+	ADD C, C
+L3003:
+	CP IZ, 16785
+L3004:
+	XOR (XIY), C
+L3005:
+	SUB C, E
+L3006:
+	XOR XIX, XIZ
+L3007:
+	ADD (FAR), L
+L3008:
+	CP W, 75
+L3009:
+	ADC C, A
+L3010:
+	ADD L, D
+L3011:
+	ADD XHL, XDE
+L3012:
+	ADC W, (L3016:24)
+L3013:
+	ADD W, A
+L3014:
+	CP HL, 21323
+L3015:
+	CP E, (XIZ+25938:16)
+L3016:
+	CP B, H
+L3017:
+	CP C, 127
+L3018:
+	AND L, 2
+L3019:
+	CP (XWA+BC), W
+L3020:
+	ADD E, (XIX+2011)
+L3021:
+	AND E, (XDE)
+L3022:
+	SBC (XIX+2683), C
+L3023:
+	SBC HL, 19823
+L3024:
+	XOR IX, 35472
+L3025:
+	CP H, (XIZ-30)
+L3026:
+	AND B, 214
+L3027:
+	XOR IZ, 29840
+L3028:
+	ADD A, 13
+L3029:
+	SUB D, (XIZ)
+L3030:
+	CP XIY, XIX
+L3031:
+	AND E, (XDE+39:8)
+L3032:
+	ADD L, A
+L3033:
+	ADD XWA, XIX
+L3034:
+	CP H, (XDE+45:8)
+L3035:
+	SUB XHL, XIX
+L3036:
+	SBC (XIY+34:8), L
+L3037:
+	ADD D, A
+L3038:
+	OR C, (L3036)
+L3039:
+	XOR (XHL+12:8), W
+L3040:
+	AND IX, 6295
+L3041:
+	SUB E, 245
+L3042:
+	SBC D, (XDE+70:8)
+L3043:
+	AND XDE, XIY
+L3044:
+	SUB D, 29
+L3045:
+	AND IZ, 26551
+L3046:
+	AND HL, 32111
+L3047:
+	AND C, (XIX+2922)
+L3048:
+	CP IY, 45333
+L3049:
+	SUB W, (L4988:24)
+L3050:
+	AND W, (P0)
+L3051:
+	XOR IZ, 27805
+L3052:
+	OR (BIGREG), C
+L3053:
+	XOR (XIY-62), W
+L3054:
+	ADC H, C
+L3055:
+	SUB IZ, 16853
+L3056:
+	OR IY, 9730
+L3057:
+	ADD H, H
+L3058:
+	CP L, D
+L3059:
+	AND XDE, XWA
+L3060:
+	ADD XWA, XIY
+L3061:
+	SBC HL, 7531
+L3062:
+	ADC H, 41
+L3063:
+	SUB (XWA+18681:16), C
+L3064:
+	CP C, 118
+L3065:
+	ADD XHL, XIY
+L3066:
+	ADC XIZ, XIZ
+L3067:
+	OR H, (XBC+67:8)
+L3068:
+	AND (XIY-16), D
+L3069:
+	XOR IY, 3241
+L3070:
+	OR XDE, XBC
+L3071:
+	CP XDE, XIZ
+L3072:
+	OR D, (L2681)
+L3073:
+	AND XWA, XIX
+L3074:
+	CP (XHL+71), D
+L3075:
+	ADD C, 152
+L3076:
+	AND E, (L1112:24)
+L3077:
+	ADD XDE, XBC
+L3078:
+	AND XIY, XIZ
+L3079:
+	XOR (L3081:24), B
+L3080:
+	CP (XDE), C
+L3081:
+	ADD H, 172
+L3082:
+	OR (XIX+125:8), B
+L3083:
+	XOR D, (XWA+BC)
+L3084:
+	AND L, 218
+L3085:
+	XOR E, C
+L3086:
+	XOR W, L
+L3087:
+	XOR XDE, XIX
+L3088:
+	AND D, L
+L3089:
+	AND H, 205
+L3090:
+	XOR (XIY+47), W
+L3091:
+	ADC WA, 27092
+L3092:
+	AND H, 52
+L3093:
+	OR IY, 16032
+L3094:
+	AND B, 194
+L3095:
+	XOR L, 39
+L3096:
+	SUB W, B
+L3097:
+	SBC L, (L3244:24)
+L3098:
+	AND C, H
+L3099:
+	XOR B, (L643:24)
+L3100:
+	CP W, 88
+L3101:
+	SUB B, 17
+L3102:
+	OR BC, 55861
+L3103:
+	AND DE, 53475
+L3104:
+	ADC E, (FAR)
+L3105:
+	SBC D, (XIY+15436:16)
+L3106:
+	SBC DE, 12717
+L3107:
+	ADD E, 204
+L3108:
+	CP (XBC+15638:16), W
+L3109:
+	ADC H, L
+L3110:
+	CP D, (XWA+B)
+L3111:
+	AND XIX, XIY
+L3112:
+	CP D, W
+L3113:
+	SUB XWA, XIX
+L3114:
+	SUB B, C
+L3115:
+	OR E, 129
+L3116:
+	OR A, A
+L3117:
+	CP IX, 922
+L3118:
+	XOR IZ, 2333
+L3119:
+	SBC BC, 1655
+L3120:
+	ADC C, D
+L3121:
+	CP C, W
+L3122:
+	XOR BC, 4635
+L3123:
+	OR IY, 8581
+L3124:
+	ADC A, (L3122)
+L3125:
+	ADD DE, 33319
+L3126:
+	OR B, (XIX+2466)
+L3127:
+	ADC HL, 31077
+L3128:
+	ADC DE, 63585
+L3129:
+	AND B, L
+L3130:
+	SBC (XIX+249), W
+L3131:
+	CP (L3132), C
+L3132:
+	ADD L, 108
+L3133:
+	CP (XWA+52), D
+L3134:
+	ADD XDE, XIZ
+L3135:
+	ADD B, C
+L3136:
+	SUB H, C
+L3137:
+	CP (XWA+11:8), L
+L3138:
+	CP C, (L3135:24)
+L3139:
+	ADC XIX, XHL
+L3140:
+	SUB IX, 62952
+L3141:
+	SBC D, E
+L3142:
+	AND A, (XIZ+2569:16)
+L3143:
+	ADC E, 67
+L3144:
+	SUB WA, 1442
+L3145:
+	SBC A, 242
+L3146:
+	ADD XHL, XDE
+L3147:
+	CP (XIX+127:8), W
+L3148:
+	OR L, 192
+L3149:
+	OR XBC, XDE
+L3150:
+	ADD (L3149), E
+L3151:
+	ADC IX, 58175
+L3152:
+	SBC (XWA+B), C
+L3153:
+	ADD (XWA+B), B
+L3154:
+	CP IX, 46588
+L3155:
+	SUB IZ, 48574
+L3156:
+	OR H, B
+L3157:
+	ADC IY, 37891
+L3158:
+	OR D, (XWA)
+L3159:
+	ADD W, W
+L3160:
+	ADC A, 123
+L3161:
+	SBC IX, 39264
+L3162:
+	SUB IZ, 11668
+L3163:
+	XOR IY, 57961
+L3164:
+	SBC C, (FAR)
+L3165:
+	SUB D, 95
+L3166:
+	OR XHL, XWA
+L3167:
+	OR BC, 53675
+L3168:
+	CP XIX, XHL
+L3169:
+	CP (XIX+874), D
+L3170:
+	CP W, C
+L3171:
+	ADD XHL, XIZ
+L3172:
+	ADD (XDE+90:8), W
+L3173:
+	CP (XWA+BC), C
+L3174:
+	XOR E, H
+L3175:
+	ADD XBC, XIX
+L3176:
+	AND (XHL+8636:16), E
+L3177:
+	SBC L, D
+L3178:
+	SBC H, A
+L3179:
+	ADD (XWA+B), E
+L3180:
+	AND (L3179), D
+L3181:
+	XOR E, (XWA+B)
+L3182:
+	OR E, (XDE+123:8)
+L3183:
+	OR (XIX+3551:16), H
+L3184:
+	AND (XWA+BC), H
+L3185:
+	CP A, (L3189:24)
+L3186:
+	ADC B, (XIX+2097)
+L3187:
+	SBC IY, 25735
+L3188:
+	XOR IX, 50418
+L3189:
+	SUB C, A
+L3190:
+	SUB (XHL+18:8), L
+L3191:
+	SUB W, 247
+L3192:
+	AND B, L
+L3193:
+	AND XHL, XBC
+L3194:
+	CP C, D
+L3195:
+	SUB E, 215
+L3196:
+	SBC (XIX+2499), L
+L3197:
+	SUB D, (XIX+2712)
+L3198:
+	ADD E, 75
+L3199:
+	SUB (XWA), W
+L3200:
+	XOR B, (XIX+2548)
+L3201:
+	SUB H, E
+L3202:
+	SBC XIX, XWA
+L3203:
+	AND C, A
+L3204:
+	AND L, 125
+L3205:
+	AND L, (XIX-36)
+L3206:
+	SBC C, (L103:24)
+L3207:
+	SBC H, L
+L3208:
+	XOR WA, 47730
+L3209:
+	AND XIX, XIY
+L3210:
+	ADD B, 185
+L3211:
+	SUB A, 151
+L3212:
+	ADD A, H
+L3213:
+	SUB B, (L3215)
+L3214:
+	CP XDE, XWA
+L3215:
+	SBC (BIGREG), H
+L3216:
+	OR L, 120
+L3217:
+	XOR L, B
+L3218:
+	CP B, D
+L3219:
+	AND (L3218:24), H
+L3220:
+	SUB C, (BIGREG)
+L3221:
+	SUB L, 116
+L3222:
+	CP XIZ, XIX
+L3223:
+	ADD E, 201
+L3224:
+	XOR (XWA+B), E
+L3225:
+	AND BC, 23724
+L3226:
+	SUB L, C
+L3227:
+	CP D, (XWA-32)
+L3228:
+	AND B, (XIX+104:8)
+L3229:
+	ADC E, (XIY)
+L3230:
+	ADD B, (BIGREG)
+L3231:
+	CP C, 3
+L3232:
+	SUB (L3228), W
+L3233:
+	AND IY, 55000
+L3234:
+	XOR XDE, XIY
+L3235:
+	XOR HL, 20085
+L3236:
+	ADC B, (XWA+B)
+L3237:
+	OR C, E
+L3238:
+	SBC D, 94
+L3239:
+	OR (L3239:24), E
+L3240:
+	SUB IX, 25417
+L3241:
+	ADC D, (XIX+9644:16)
+L3242:
+	ADC XIX, XIZ
+L3243:
+	XOR W, (XIX-55)
+L3244:
+	XOR XHL, XIZ
+L3245:
+	ADC A, D
+L3246:
+	XOR XWA, XIY
+L3247:
+	ADC XWA, XWA
+L3248:
+	OR XHL, XWA
+L3249:
+	AND XWA, XIZ
+L3250:
+	ADC (XIX+20:8), B
+L3251:
+	OR (XIX+57), E
+L3252:
+	OR XDE, XIZ
+L3253:
+	XOR A, L
+L3254:
+	XOR B, C
+L3255:
+	XOR L, 130
+L3256:
+	XOR C, D
+L3257:
+	ADC (XBC+99:8), D
+L3258:
+	ADD (XWA+28604:16), E
+L3259:
+	SBC H, 131
+L3260:
+	CP XIX, XBC
+L3261:
+	ADD D, 14
+L3262:
+	SUB XIZ, XDE
+L3263:
+	XOR (XBC+955:16), B
+L3264:
+	XOR H, 136
+L3265:
+	ADD (XIX+91), W
+L3266:
+	ADD XBC, XIX
+L3267:
+	ADD W, (XIZ+28984:16)
+L3268:
+	XOR B, (L3265)
+L3269:
+	SBC IZ, 32021
+L3270:
+	XOR D, A
+L3271:
+	OR XWA, XHL
+L3272:
+	OR BC, 37272
+L3273:
+	XOR D, L
+L3274:
+	OR D, (XBC)
+L3275:
+	AND (XIY+14706:16), D
+L3276:
+	AND E, B
+L3277:
+	AND B, 122
+L3278:
+	AND (XIX+2298), B
+L3279:
+	XOR XDE, XHL
+L3280:
+	XOR H, (XIZ-23)
+L3281:
+	CP H, (XDE+7097:16)
+L3282:
+	ADC A, (XHL+14)
+L3283:
+	CP L, 51
+L3284:
+	SUB D, (XIZ)
+L3285:
+	XOR (XIX+2579), E
+L3286:
+	SBC (XBC+106:8), D
+L3287:
+	SBC H, H
+L3288:
+	OR (XIZ), W
+L3289:
+	OR B, L
+L3290:
+	ADC L, B
+L3291:
+	ADD D, 122
+L3292:
+	ADC HL, 27102
+L3293:
+	OR DE, 60607
+L3294:
+	XOR W, 83
+L3295:
+	XOR H, 228
+L3296:
+	OR XIY, XIZ
+L3297:
+	CP (XIX+2402), H
+L3298:
+	ADC H, C
+L3299:
+	ADD B, 155
+L3300:
+	ADD HL, 42535
+L3301:
+	OR (L3304:24), H
+L3302:
+	CP HL, 18671
+L3303:
+	OR A, 95
+L3304:
+	AND XDE, XHL
+L3305:
+	ADC W, 76
+L3306:
+	ADD W, (XWA+BC)
+L3307:
+	XOR XIY, XIZ
+L3308:
+	SUB XHL, XIZ
+L3309:
+	SBC (XWA+B), E
+L3310:
+	SUB XWA, XWA
+L3311:
+	SBC H, (P0)
+L3312:
+	XOR (XIZ-42), D
+L3313:
+	OR (XIZ+74), E
+L3314:
+	XOR E, B
+L3315:
+	AND A, C
+L3316:
+	XOR WA, 39377
+L3317:
+	CP BC, 4219
+L3318:
+	ADC A, 75
+L3319:
+	SUB IY, 27889
+L3320:
+	OR W, B
+L3321:
+	ADC (XIX+2159), B
+L3322:
+	ADD C, 110
+L3323:
+	CP (BIGREG), C
+L3324:
+	SBC (XWA+BC), W
+L3325:
+	XOR XHL, XIY
+L3326:
+	ADC D, 204
+L3327:
+	AND (XIY), W
+L3328:
+	XOR IZ, 59653
+L3329:
+	ADC DE, 5689
+L3330:
+	ADD IZ, 51559
+L3331:
+	ADC (XIX+1045), A
+L3332:
+	ADC XIZ, XIZ
+L3333:
+	OR (XIX+1362), A
+L3334:
+	ADC (XHL), E
+L3335:
+	ADC E, 90
+L3336:
+	SUB (XWA+BC), H
+L3337:
+	CP C, A
+L3338:
+	ADC C, B
+L3339:
+	SUB BC, 20113
+L3340:
+	ADC IY, 28079
+L3341:
+	ADC C, (XWA+17066:16)
+L3342:
+	CP E, (XWA+B)
+L3343:
+	CP IZ, 21886
+L3344:
+	ADC A, 215
+L3345:
+	SUB IY, 51283
+L3346:
+	CP IX, 42822
+L3347:
+	ADD H, A
+L3348:
+	XOR (XWA-84), W
+L3349:
+	CP B, 126
+L3350:
+	ADD D, 25
+L3351:
+	CP DE, 57971
+L3352:
+	OR XHL, XIZ
+L3353:
+	CP A, 171
+L3354:
+	ADC (XIX+592), W
+L3355:
+	ADD A, (L1728:24)
+L3356:
+	CP A, A
+L3357:
+	AND L, (XIZ-16)
+L3358:
+	CP XWA, XIY
+L3359:
+	ADD C, 126
+L3360:
+	CP E, D
+L3361:
+	SUB XBC, XHL
+L3362:
+	CP XIY, XIZ
+L3363:
+	SUB E, L
+L3364:
+	CP D, 137
+L3365:
+	OR XIX, XIY
+L3366:
+	SUB (XDE+27:8), D
+L3367:
+	ADD L, B
+L3368:
+	AND L, (XIX+101:8)
+L3369:
+	SBC XIZ, XIX
+L3370:
+	AND D, L
+L3371:
+	ADC (XIY+5416:16), B
+L3372:
+	ADD XIX, XDE
+L3373:
+	SBC XHL, XDE
+L3374:
+	CP XBC, XHL
+L3375:
+	ADC XDE, XBC
+L3376:
+	SBC XDE, XWA
+L3377:
+	CP L, W
+L3378:
+	AND W, L
+L3379:
+	CP (XIY-100), L
+L3380:
+	SUB (FAR), A
+L3381:
+	OR E, (L698)
+L3382:
+	SBC BC, 26644
+L3383:
+	SUB L, W
+L3384:
+	ADC XHL, XIZ
+L3385:
+	SBC D, L
+L3386:
+	AND WA, 39430
+L3387:
+	SBC BC, 37086
+L3388:
+	SBC E, 112
+L3389:
+	CP IY, 57592
+L3390:
+	XOR L, B
+L3391:
+	SBC A, A
+L3392:
+	SBC XIX, XHL
+L3393:
+	SUB HL, 51849
+L3394:
+	ADC BC, 40849
+L3395:
+	ADC HL, 42009
+L3396:
+	XOR A, L
+L3397:
+	OR B, 91
+L3398:
+	SUB C, 217
+L3399:
+	CP DE, 20098
+L3400:
+	XOR C, 110
+L3401:
+	OR D, H
+L3402:
+	SUB XIZ, XWA
+L3403:
+	ADD W, (XHL+2604:16)
+L3404:
+	ADD D, D
+L3405:
+	SUB C, L
+L3406:
+	SBC D, D
+L3407:
+	CP (XIX+24), E
+L3408:
+	SUB W, (L1725)
+L3409:
+	SUB L, L
+L3410:
+	AND (XWA-50), A
+L3411:
+	OR XBC, XIZ
+L3412:
+	SBC WA, 53834
+L3413:
+	SBC DE, 22839
+L3414:
+	CP C, (XDE+89)
+L3415:
+	SBC E, (XIX+541)
+L3416:
+	XOR A, L
+L3417:
+	ADD (XIX+1537), C
+L3418:
+	SUB E, 249
+L3419:
+	SBC XIZ, XWA
+L3420:
+	ADC XBC, XDE
+L3421:
+	SUB C, H
+L3422:
+	ADC D, 226
+L3423:
+	SBC (XIX+1130), H
+L3424:
+	ADC XIX, XHL
+L3425:
+	ADD (XWA), W
+L3426:
+	OR XWA, XIX
+L3427:
+	SUB (FAR), A
+L3428:
+	AND B, (XDE+21)
+L3429:
+	OR (XHL-36), D
+L3430:
+	SUB C, 214
+L3431:
+	XOR D, (L3435:24)
+L3432:
+	SUB XIY, XHL
+L3433:
+	SUB A, (XIZ+12791:16)
+L3434:
+	XOR A, 14
+L3435:
+	XOR A, (XIY-61)
+L3436:
+	AND W, (XBC)
+L3437:
+	CP IY, 50958
+L3438:
+	SUB B, 207
+L3439:
+	ADD XIZ, XDE
+L3440:
+	CP XDE, XDE
+L3441:
+	ADD D, 164
+L3442:
+	SUB B, A
+L3443:
+	SBC XBC, XWA
+L3444:
+	AND A, 24
+L3445:
+	CP H, C
+L3446:
+	OR IX, 59460
+L3447:
+	SUB E, 175
+L3448:
+	ADD XIZ, XWA
+L3449:
+	OR W, A
+L3450:
+	SUB D, H
+L3451:
+	SBC E, D
+L3452:
+	SBC C, B
+L3453:
+	CP IY, 39199
+L3454:
+	SUB B, (XWA+BC)
+L3455:
+	OR E, 254
+L3456:
+	OR W, C
+L3457:
+	CP A, D
+L3458:
+	ADD D, 192
+L3459:
+	AND XIY, XDE
+L3460:
+	ADD H, 237
+L3461:
+	ADC L, 186
+L3462:
+	ADC HL, 16458
+L3463:
+	OR WA, 6435
+L3464:
+	XOR (L231), B
+L3465:
+	ADC D, (XWA+B)
+L3466:
+	SBC XWA, XHL
+L3467:
+	SUB W, L
+L3468:
+	ADC W, W
+L3469:
+	CP (XWA-2), B
+L3470:
+	ADC (XIX+96), W
+L3471:
+	ADC E, 172
+L3472:
+	SBC XIZ, XWA
+L3473:
+	ADC XWA, XHL
+L3474:
+	AND W, W
+L3475:
+	ADC B, 151
+L3476:
+	AND A, W
+L3477:
+	ADD A, 157
+L3478:
+	XOR B, B
+L3479:
+	SBC XDE, XIX
+L3480:
+	OR A, D
+L3481:
+	ADD (L3481:24), L
+L3482:
+	SUB BC, 27973
+L3483:
+	ADC (XWA-37), C
+L3484:
+	SUB (XWA-40), C
+L3485:
+	ADC B, E
+L3486:
+	XOR D, (XWA+13)
+L3487:
+	AND B, 169
+L3488:
+	SUB W, D
+L3489:
+	ADD XBC, XWA
+L3490:
+	CP H, 150
+L3491:
+	SUB XHL, XDE
+L3492:
+	ADC W, (L3900)
+L3493:
+	AND D, (L3492)
+L3494:
+	SBC L, H
+L3495:
+	XOR (XBC+91:8), W
+L3496:
+	SUB XWA, XIZ
+L3497:
+	CP XWA, XDE
+L3498:
+	SBC (XWA), W
+L3499:
+	AND A, D
+L3500:
+	CP A, (FAR)
+L3501:
+	SBC E, L
+L3502:
+	CP W, 178
+L3503:
+	AND D, C
+L3504:
+	OR D, L
+L3505:
+	XOR C, A
+L3506:
+	XOR XIZ, XWA
+L3507:
+	ADD (XWA+B), A
+L3508:
+	SBC IX, 14503
+L3509:
+	ADC C, (L1185)
+L3510:
+	ADC E, (L3507:24)
+L3511:
+	ADC (XIZ-44), B
+L3512:
+	AND IZ, 28217
+L3513:
+	SBC C, A
+L3514:
+	XOR WA, 18850
+L3515:
+	XOR XBC, XIZ
+L3516:
+	SUB A, 148
+L3517:
+	CP BC, 47839
+L3518:
+	SBC W, (XIX)
+L3519:
+	XOR (XWA-72), D
+L3520:
+	AND D, 12
+L3521:
+	SBC B, D
+L3522:
+	SUB XDE, XIZ
+L3523:
+	ADC C, (BIGREG)
+L3524:
+	SUB E, (XWA+12533:16)
+L3525:
+	CP (XDE+77), H
+L3526:
+	OR B, C
+L3527:
+	CP H, (XIX+2085)
+L3528:
+	ADD E, (XIX+2131)
+L3529:
+	ADD (XIY), C
+L3530:
+	SBC L, H
+L3531:
+	CP D, C
+L3532:
+	AND XIY, XIY
+L3533:
+	XOR A, 193
+L3534:
+	AND D, 243
+L3535:
+	SBC (XIX+1783), B
+L3536:
+	ADC B, (XWA+B)
+L3537:
+	ADC C, 93
+L3538:
+	XOR (L1295), H
+L3539:
+	OR XIZ, XIY
+L3540:
+	SUB XBC, XIX
+L3541:
+	AND A, E
+L3542:
+	OR L, L
+L3543:
+	OR H, (XHL+27:8)
+L3544:
+	ADC H, W
+L3545:
+	CP C, 137
+L3546:
+	ADC H, (XWA+45)
+L3547:
+	SBC L, 131
+L3548:
+	OR C, 176
+L3549:
+	AND D, 100
+L3550:
+	CP (XWA+27152:16), C
+L3551:
+	AND H, 55
+L3552:
+	CP D, L
+L3553:
+	SUB D, (L3555)
+L3554:
+	OR L, (XIX)
+L3555:
+	OR W, D
+L3556:
+	ADC (XBC+53), B
+L3557:
+	SBC B, 157
+L3558:
+	XOR D, 229
+L3559:
+	SUB D, (XIZ+14128:16)
+L3560:
+	OR C, B
+L3561:
+	SUB XIZ, XIY
+L3562:
+	SBC XIY, XDE
+L3563:
+	SUB (L3907), L
+L3564:
+	ADC W, (XIX+586)
+L3565:
+	SUB XWA, XBC
+L3566:
+	XOR IZ, 22866
+L3567:
+	OR (XBC+8939:16), L
+L3568:
+	ADD HL, 39721
+L3569:
+	AND (XBC+8646:16), C
+L3570:
+	ADC H, L
+L3571:
+	AND XHL, XDE
+L3572:
+	ADD E, D
+L3573:
+	SUB XIY, XIY
+L3574:
+	SUB DE, 395
+L3575:
+	SUB XIZ, XHL
+L3576:
+	SBC H, 214
+L3577:
+	XOR C, 131
+L3578:
+	AND E, (XHL+81:8)
+L3579:
+	CP WA, 65326
+L3580:
+	XOR W, 53
+L3581:
+	SUB DE, 16428
+L3582:
+	CP W, H
+L3583:
+	AND BC, 21751
+L3584:
+	SUB D, D
+L3585:
+	CP H, 9
+L3586:
+	SBC A, (XDE-63)
+L3587:
+	XOR E, E
+L3588:
+	AND (XDE), A
+L3589:
+	ADC H, (XWA+BC)
+L3590:
+	AND H, (FAR)
+L3591:
+	AND A, 240
+L3592:
+	ADC D, (XDE+62)
+L3593:
+	ADC XDE, XIX
+L3594:
+	XOR L, B
+L3595:
+	OR XIZ, XBC
+L3596:
+	AND (XWA+18413:16), W
+L3597:
+	ADD (XWA+1:8), D
+L3598:
+	SBC C, (XIY+94)
+L3599:
+	ADD W, 124
+L3600:
+	ADC XHL, XIZ
+L3601:
+	XOR (XBC-77), A
+L3602:
+	AND XIZ, XIZ
+L3603:
+	XOR (XBC+7965:16), H
+L3604:
+	AND A, (XDE+12:8)
+L3605:
+	SBC BC, 33500
+L3606:
+	SBC XIY, XIY
+L3607:
+	SBC XDE, XIY
+L3608:
+	SUB HL, 59370
+L3609:
+	CP XDE, XIY
+L3610:
+	AND (XWA+B), A
+L3611:
+	OR IY, 13929
+L3612:
+	SUB (L3610:24), B
+L3613:
+	AND XIZ, XBC
+L3614:
+	SUB W, D
+L3615:
+	OR XBC, XHL
+L3616:
+	AND D, 172
+L3617:
+	CP C, 225
+L3618:
+	OR DE, 63074
+L3619:
+	ADC XIY, XIX
+L3620:
+	SUB D, 254
+L3621:
+	AND A, W
+L3622:
+	SBC W, (XIZ+33)
+L3623:
+	AND DE, 58855
+L3624:
+	CP DE, 51214
+L3625:
+	AND (L3625:24), L
+L3626:
+	SUB BC, 14011
+L3627:
+	OR E, B
+L3628:
+	ADD (L221:24), A
+L3629:
+	ADD H, (XWA+90:8)
+L3630:
+	CP (XIX+22113:16), W
+L3631:
+	OR A, 48
+L3632:
+	ADC XHL, XWA
+L3633:
+	SUB H, D
+L3634:
+	AND (XWA+BC), H
+L3635:
+	SBC B, E
+L3636:
+	ADD (XWA+BC), C
+L3637:
+	CP A, (L3637)
+L3638:
+	XOR (L3635:24), B
+L3639:
+	SUB (L3635), L
+L3640:
+	SUB DE, 37826
+L3641:
+	ADC W, 43
+L3642:
+	CP E, (XIX)
+L3643:
+	CP BC, 49389
+L3644:
+	ADC XHL, XIZ
+L3645:
+	CP E, (XWA+BC)
+L3646:
+	ADC DE, 23396
+L3647:
+	OR B, (L3651)
+L3648:
+	XOR E, (L1759:24)
+L3649:
+	AND XHL, XIX
+L3650:
+	OR H, (L3653:24)
+L3651:
+	XOR H, (L3652:24)
+L3652:
+	ADC H, (XWA+BC)
+L3653:
+	SUB (XIZ+20026:16), B
+L3654:
+	ADD D, (XWA+B)
+L3655:
+	OR B, B
+L3656:
+	ADD D, (XHL+20062:16)
+L3657:
+	ADD (L3660), B
+L3658:
+	OR D, W
+L3659:
+	ADD IZ, 24952
+L3660:
+	CP (XIX+98:8), L
+L3661:
+	CP IZ, 7435
+L3662:
+	AND XIX, XWA
+L3663:
+	ADC WA, 3662
+L3664:
+	CP C, (L4398)
+L3665:
+	ADD BC, 2788
+L3666:
+	ADC D, 38
+L3667:
+	CP E, 218
+L3668:
+	ADC (FAR), D
+L3669:
+	OR XBC, XIZ
+L3670:
+	SBC XBC, XBC
+L3671:
+	SUB XIX, XIX
+L3672:
+	OR C, 176
+L3673:
+	CP (XHL), E
+L3674:
+	AND D, (L3675)
+L3675:
+	ADC E, (XBC+62:8)
+L3676:
+	AND WA, 17628
+L3677:
+	ADC XIX, XBC
+L3678:
+	ADC B, B
+L3679:
+	ADC DE, 23033
+L3680:
+	CP B, 163
+L3681:
+	CP BC, 53104
+L3682:
+	XOR WA, 4234
+L3683:
+	XOR (L2515), W
+L3684:
+	SUB C, 252
+L3685:
+	SBC A, L
+L3686:
+	ADC A, B
+L3687:
+	SBC BC, 57152
+L3688:
+	XOR XDE, XIY
+L3689:
+	SUB XHL, XIZ
+L3690:
+	CP XHL, XIZ
+L3691:
+	AND L, (XWA+26209:16)
+L3692:
+	SBC BC, 60434
+L3693:
+	ADC C, 200
+L3694:
+	XOR (XBC), L
+L3695:
+	XOR (XIX+23), C
+L3696:
+	XOR HL, 5485
+L3697:
+	XOR XIX, XWA
+L3698:
+	CP D, B
+L3699:
+	OR (XIX+1549), B
+L3700:
+	CP DE, 21993
+L3701:
+	XOR HL, 20164
+L3702:
+	XOR L, 141
+L3703:
+	ADC L, D
+L3704:
+	SBC D, L
+L3705:
+	OR IZ, 57359
+L3706:
+	CP H, 162
+L3707:
+	ADD IX, 25921
+L3708:
+	ADD (XHL+9), L
+L3709:
+	AND (XWA+15), L
+L3710:
+	ADC D, (XIZ+51:8)
+L3711:
+	CP (XDE+58:8), B
+L3712:
+	CP (XDE+1209:16), C
+L3713:
+	SBC H, C
+L3714:
+	XOR XWA, XIZ
+L3715:
+	ADD L, (BIGREG)
+L3716:
+	SBC C, A
+L3717:
+	SUB C, L
+L3718:
+	SBC (XIX), H
+L3719:
+	AND XIY, XBC
+L3720:
+	ADC (L3723), L
+L3721:
+	SBC W, 165
+L3722:
+	ADD B, 45
+L3723:
+	SUB BC, 42095
+L3724:
+	ADC W, (XIX+2718)
+L3725:
+	OR C, 204
+L3726:
+	SBC B, C
+L3727:
+	ADD D, (L3724)
+L3728:
+	CP XBC, XWA
+L3729:
+	CP E, B
+L3730:
+	ADC XBC, XHL
+L3731:
+	SUB XIY, XIX
+L3732:
+	AND XDE, XIX
+L3733:
+	ADC (XIX+318), E
+L3734:
+	CP A, 178
+L3735:
+	AND C, H
+L3736:
+	AND XBC, XIZ
+L3737:
+	CP BC, 47863
+L3738:
+	OR WA, 45916
+L3739:
+	OR D, L
+L3740:
+	ADC (XIX+95), C
+L3741:
+	AND XIZ, XWA
+L3742:
+	XOR L, (XWA)
+L3743:
+	XOR IY, 49990
+L3744:
+	AND D, L
+L3745:
+	SUB (XIZ+53:8), C
+L3746:
+	SBC D, W
+L3747:
+	ADC L, (L3745:24)
+L3748:
+	XOR W, A
+L3749:
+	SBC D, A
+L3750:
+	XOR WA, 7444
+L3751:
+	XOR HL, 49967
+L3752:
+	SUB (XIZ+91), W
+L3753:
+	OR E, D
+L3754:
+	ADD A, 58
+L3755:
+	XOR H, 253
+L3756:
+	SBC WA, 42389
+L3757:
+	AND WA, 40191
+L3758:
+	SUB L, 110
+L3759:
+	XOR IY, 18567
+L3760:
+	ADC A, (XWA+52)
+L3761:
+	XOR XHL, XDE
+L3762:
+	AND XIY, XBC
+L3763:
+	OR XWA, XIX
+L3764:
+	ADD L, A
+L3765:
+	ADD C, 152
+L3766:
+	OR E, B
+L3767:
+	AND IY, 31000
+L3768:
+	SBC XIY, XHL
+L3769:
+	SUB IZ, 13126
+L3770:
+	AND D, A
+L3771:
+	ADC C, 10
+L3772:
+	SBC XBC, XBC
+L3773:
+	SBC (L3777:24), B
+L3774:
+	ADC XBC, XIX
+L3775:
+	XOR A, 35
+L3776:
+	OR C, (L4120:24)
+L3777:
+	SUB L, L
+L3778:
+	XOR HL, 36135
+L3779:
+	XOR H, B
+L3780:
+	SUB W, 221
+L3781:
+	OR A, W
+L3782:
+	ADC IX, 8914
+L3783:
+	ADD (XIX-98), H
+L3784:
+	SUB (XIY+127:8), C
+L3785:
+	OR C, (L4509)
+L3786:
+	ADD IY, 57659
+L3787:
+	ADD XIY, XIY
+L3788:
+	ADC A, (L1804:24)
+L3789:
+	OR (L3792:24), A
+L3790:
+	ADC D, 125
+L3791:
+	ADD L, (XIX+1838)
+L3792:
+	SBC L, (XDE)
+L3793:
+	AND XDE, XDE
+L3794:
+	SUB B, D
+L3795:
+	SUB IZ, 6947
+L3796:
+	AND L, H
+L3797:
+	ADC IZ, 60447
+L3798:
+	XOR XBC, XDE
+L3799:
+	ADC (XIX+34:8), H
+L3800:
+	OR XIY, XHL
+L3801:
+	CP L, 225
+L3802:
+	ADD (XBC+16887:16), C
+L3803:
+	OR A, L
+L3804:
+	XOR H, L
+L3805:
+	CP B, 239
+L3806:
+	ADD (XWA+23:8), C
+L3807:
+	SUB C, L
+L3808:
+	OR XDE, XWA
+L3809:
+	CP XIY, XIY
+L3810:
+	CP A, D
+L3811:
+	OR HL, 42080
+L3812:
+	CP XBC, XWA
+L3813:
+	XOR XDE, XIY
+L3814:
+	ADD L, 169
+L3815:
+	OR D, 139
+L3816:
+	AND C, (XIX)
+L3817:
+	AND D, 149
+L3818:
+	CP B, E
+L3819:
+	SBC A, (XIY+11466:16)
+L3820:
+	ADD L, W
+L3821:
+	OR (XIY+85), A
+L3822:
+	ADD IY, 58948
+L3823:
+	AND (XIX+1525), A
+L3824:
+	ADD E, C
+L3825:
+	AND XDE, XIZ
+L3826:
+	XOR E, 77
+L3827:
+	ADD XDE, XDE
+L3828:
+	OR B, (XWA+75:8)
+L3829:
+	XOR IX, 57827
+L3830:
+	AND XIX, XDE
+L3831:
+	XOR (XWA+BC), L
+L3832:
+	ADC XBC, XIZ
+L3833:
+	SUB A, B
+L3834:
+	SBC XIY, XHL
+L3835:
+	SBC W, 53
+L3836:
+	XOR L, (XWA+B)
+L3837:
+	ADD D, 61
+L3838:
+	SBC XIZ, XIX
+L3839:
+	SBC (XIX+1367), E
+L3840:
+	ADD E, C
+L3841:
+	ADC (XDE+0), C
+L3842:
+	OR W, 35
+L3843:
+	ADC E, 234
+L3844:
+	CP W, (XIY+14637:16)
+L3845:
+	SBC D, (XIY+62:8)
+L3846:
+	ADC L, (XWA+BC)
+L3847:
+	AND (L3845:24), A
+L3848:
+	ADC D, 213
+L3849:
+	ADD DE, 52808
+L3850:
+	OR XHL, XDE
+L3851:
+	OR WA, 40809
+L3852:
+	OR IY, 11914
+L3853:
+	AND E, (XIX+548)
+L3854:
+	SUB E, L
+L3855:
+	SUB XWA, XIY
+L3856:
+	ADC E, 125
+L3857:
+	ADD A, (BIGREG)
+L3858:
+	ADC W, A
+L3859:
+	CP C, E
+L3860:
+	XOR A, 81
+L3861:
+	SUB A, E
+L3862:
+	ADC XHL, XBC
+L3863:
+	SUB W, W
+L3864:
+	AND XWA, XHL
+L3865:
+	OR XIY, XWA
+L3866:
+	XOR C, (XIX)
+L3867:
+	SBC H, D
+L3868:
+	SUB B, 91
+L3869:
+	OR H, D
+L3870:
+	AND BC, 2932
+L3871:
+	OR B, 248
+L3872:
+	CP H, 14
+L3873:
+	ADD B, W
+L3874:
+	SBC XIZ, XWA
+L3875:
+	XOR E, 166
+L3876:
+	ADD D, 38
+L3877:
+	ADC (XIY-87), C
+L3878:
+	AND A, D
+L3879:
+	AND W, C
+L3880:
+	SUB C, 5
+L3881:
+	SBC DE, 2512
+L3882:
+	ADC C, 36
+L3883:
+	AND XWA, XIX
+L3884:
+	CP L, 44
+L3885:
+	AND WA, 41771
+L3886:
+	ADC C, (XDE+35:8)
+L3887:
+	SUB HL, 12388
+L3888:
+	OR (L3892), L
+L3889:
+	SBC D, 2
+L3890:
+	CP IY, 2138
+L3891:
+	SUB E, 194
+L3892:
+	ADD H, A
+L3893:
+	ADD W, E
+L3894:
+	CP BC, 54827
+L3895:
+	OR DE, 19243
+L3896:
+	SUB XDE, XBC
+L3897:
+	ADD WA, 58218
+L3898:
+	SBC W, 58
+L3899:
+	XOR D, (L3895:24)
+L3900:
+	AND E, (P0)
+L3901:
+	ADC (P0), L
+L3902:
+	ADD B, (XBC+41:8)
+L3903:
+	SBC L, (L3905:24)
+L3904:
+	XOR E, L
+L3905:
+	ADC (XIZ+1:8), B
+L3906:
+	ADD W, W
+L3907:
+	SUB XIZ, XDE
+L3908:
+	ADC HL, 22573
+L3909:
+	CP BC, 4474
+L3910:
+	OR XWA, XBC
+L3911:
+	CP XIY, XBC
+L3912:
+	ADD XIZ, XBC
+L3913:
+	AND XWA, XHL
+L3914:
+	ADC B, 255
+L3915:
+	SBC (XDE), L
+L3916:
+	OR H, E
+L3917:
+	ADC D, (FAR)
+L3918:
+	OR BC, 58524
+L3919:
+	OR XWA, XWA
+L3920:
+	ADC B, 224
+L3921:
+	AND XWA, XIZ
+L3922:
+	OR (L3924), W
+L3923:
+	AND (L1003), B
+L3924:
+	SBC D, (XWA+B)
+L3925:
+	OR XDE, XIZ
+L3926:
+	CP (XIY+76), D
+L3927:
+	ADC XHL, XWA
+L3928:
+	SBC BC, 38794
+L3929:
+	CP D, 182
+L3930:
+	SBC D, 64
+L3931:
+	ADD B, (XBC+50)
+L3932:
+	ADC E, 133
+L3933:
+	XOR A, (XWA+BC)
+L3934:
+	OR L, L
+L3935:
+	ADD (XBC+86:8), E
+L3936:
+	SBC A, (XWA+BC)
+L3937:
+	AND (XBC+16:8), L
+L3938:
+	ADC W, 101
+L3939:
+	CP C, 174
+L3940:
+	ADC L, (XBC)
+L3941:
+	OR E, (FAR)
+L3942:
+	SBC XWA, XIX
+L3943:
+	ADC B, (XIX+1971)
+L3944:
+	CP (XWA+BC), D
+L3945:
+	ADC XBC, XBC
+L3946:
+	ADC L, 133
+L3947:
+	XOR XIY, XWA
+L3948:
+	SUB C, B
+L3949:
+	OR XBC, XDE
+L3950:
+	CP E, 117
+L3951:
+	CP (L3950), W
+L3952:
+	SUB DE, 42096
+L3953:
+	SUB A, W
+L3954:
+	SUB BC, 22673
+L3955:
+	OR (XBC+27677:16), L
+L3956:
+	ADD IX, 53559
+L3957:
+	ADD XIX, XIY
+L3958:
+	AND IZ, 17970
+L3959:
+	OR L, E
+L3960:
+	OR BC, 34756
+L3961:
+	AND D, C
+L3962:
+	SBC A, (XIX+2126)
+L3963:
+	AND H, (L3960:24)
+L3964:
+	XOR L, L
+L3965:
+	CP (XWA+BC), A
+L3966:
+	AND IY, 4584
+L3967:
+	OR XDE, XIY
+L3968:
+	SUB A, 221
+L3969:
+	OR H, 4
+L3970:
+	OR (XWA+28962:16), H
+L3971:
+	AND (XIX+628), E
+L3972:
+	OR IX, 8973
+L3973:
+	CP BC, 19225
+L3974:
+	OR WA, 63026
+L3975:
+	XOR A, 134
+L3976:
+	SUB H, 85
+L3977:
+	XOR W, E
+L3978:
+	XOR L, 17
+L3979:
+	CP H, (XWA+B)
+L3980:
+	AND IZ, 19630
+L3981:
+	SUB (XIY+61), L
+L3982:
+	SUB (XIX+2839), C
+L3983:
+	ADD IX, 62822
+L3984:
+	SBC C, A
+L3985:
+	XOR XWA, XDE
+L3986:
+	OR IZ, 20760
+L3987:
+	XOR IX, 59258
+L3988:
+	SUB B, H
+L3989:
+	ADD (XWA+BC), C
+L3990:
+	AND (XWA+BC), C
+L3991:
+	ADD C, 243
+L3992:
+	OR H, H
+L3993:
+	OR (XIX+25), B
+L3994:
+	ADD L, 84
+L3995:
+	SUB D, 142
+L3996:
+	AND H, (XIX+20578:16)
+L3997:
+	AND XWA, XIY
+L3998:
+	XOR (XIZ+18570:16), H
+L3999:
+	ADD L, (XHL+64:8)
+L4000:
+	SUB XHL, XDE
+L4001:
+	ADC XHL, XHL
+L4002:
+	AND XHL, XIX
+L4003:
+	AND BC, 4031
+L4004:
+	ADC B, 251
+L4005:
+	ADD XDE, XHL
+L4006:
+	AND C, 242
+L4007:
+	AND IZ, 47232
+L4008:
+	AND H, 64
+L4009:
+	ADD XIZ, XHL
+L4010:
+	SUB D, 152
+L4011:
+	OR DE, 36129
+L4012:
+	XOR IZ, 20230
+L4013:
+	CP C, B
+L4014:
+	OR W, (P0)
+L4015:
+	CP W, (XIY-50)
+L4016:
+	SBC IX, 2812
+L4017:
+	ADD IY, 24745
+L4018:
+	ADC WA, 22030
+L4019:
+	CP (XIY-66), C
+L4020:
+	ADD H, 23
+L4021:
+	OR H, (XIX+2531)
+L4022:
+	XOR D, 239
+L4023:
+	AND IZ, 16222
+L4024:
+	XOR DE, 22660
+L4025:
+	OR E, C
+L4026:
+	ADC WA, 40518
+L4027:
+	SBC W, E
+L4028:
+	SUB B, (XIX+870)
+L4029:
+	ADC IZ, 57196
+L4030:
+	XOR IX, 4897
+L4031:
+	XOR L, 243
+L4032:
+	CP IZ, 26862
+L4033:
+	AND C, (XIY+11875:16)
+L4034:
+	CP XWA, XIY
+L4035:
+	XOR W, (XBC+19)
+L4036:
+	XOR WA, 2830
+L4037:
+	CP H, E
+L4038:
+	ADC L, 14
+L4039:
+	ADD (XIX+97), A
+L4040:
+	SUB L, W
+L4041:
+	XOR (XBC), B
+L4042:
+	CP XDE, XIZ
+L4043:
+	SBC H, (XIY+42:8)
+L4044:
+	XOR (L4046), W
+L4045:
+	ADD (XIX+2709), C
+L4046:
+	OR D, 156
+L4047:
+	ADC B, 139
+L4048:
+	ADD L, 49
+L4049:
+	SUB XBC, XBC
+L4050:
+	CP XIZ, XIZ
+L4051:
+	ADC E, L
+L4052:
+	OR A, W
+L4053:
+	XOR XBC, XIY
+L4054:
+	XOR W, D
+L4055:
+	SUB E, (L4051)
+L4056:
+	ADD E, 93
+L4057:
+	OR HL, 58463
+L4058:
+	CP W, (P0)
+L4059:
+	SBC H, C
+L4060:
+	AND XDE, XIY
+L4061:
+	SUB C, L
+L4062:
+	ADD B, (FAR)
+L4063:
+	OR IX, 7839
+L4064:
+	SUB (XIZ+75:8), A
+L4065:
+	SBC (XIZ), C
+L4066:
+	OR XHL, XBC
+L4067:
+	AND A, (L4923:24)
+L4068:
+	AND A, 82
+L4069:
+	OR H, E
+L4070:
+	XOR E, (L1901:24)
+L4071:
+	ADD W, W
+L4072:
+	ADC E, (XIX+90:8)
+L4073:
+	OR C, D
+L4074:
+	ADC L, 179
+L4075:
+	XOR IX, 57475
+L4076:
+	ADD W, 13
+L4077:
+	ADD XDE, XDE
+L4078:
+	SUB C, 59
+L4079:
+	CP L, 58
+L4080:
+	OR XIX, XIY
+L4081:
+	SUB XIY, XWA
+L4082:
+	OR E, (XIX+1666)
+L4083:
+	OR A, (XIY+46)
+L4084:
+	ADD A, 50
+L4085:
+	ADC D, 143
+L4086:
+	CP H, 214
+L4087:
+	AND L, (XWA+BC)
+L4088:
+	SUB E, 190
+L4089:
+	ADD C, 253
+L4090:
+	AND (L4094), W
+L4091:
+	ADC (BIGREG), W
+L4092:
+	SBC E, 83
+L4093:
+	AND (XIX+1114), L
+L4094:
+	SBC D, D
+L4095:
+	OR E, L
+L4096:
+	SBC L, (XIX+7845:16)
+L4097:
+	CP (XIZ), A
+L4098:
+	XOR XDE, XIY
+L4099:
+	CP D, B
+L4100:
+	OR (XIZ), H
+L4101:
+	CP L, D
+L4102:
+	CP E, 71
+L4103:
+	SUB XIX, XWA
+L4104:
+	ADC B, 110
+L4105:
+	CP D, D
+L4106:
+	XOR D, (XDE-48)
+L4107:
+	AND H, (XHL+100:8)
+L4108:
+	SUB IX, 59455
+L4109:
+	OR A, L
+L4110:
+	XOR (XIX+16542:16), A
+L4111:
+	AND XWA, XIZ
+L4112:
+	XOR XBC, XDE
+L4113:
+	ADC (XIZ+54), L
+L4114:
+	SUB D, (XWA+BC)
+L4115:
+	CP A, (XIX-24)
+L4116:
+	OR E, W
+L4117:
+	ADC IX, 7125
+L4118:
+	XOR XBC, XBC
+L4119:
+	SBC E, (L4121:24)
+L4120:
+	ADD XHL, XIX
+L4121:
+	CP DE, 55654
+L4122:
+	CP H, (XWA+BC)
+L4123:
+	CP E, 50
+L4124:
+	OR XBC, XHL
+L4125:
+	CP IZ, 45429
+L4126:
+	OR A, 74
+L4127:
+	CP W, 76
+L4128:
+	AND A, 159
+L4129:
+	OR W, (L4127)
+L4130:
+	ADD (XIZ+68), W
+L4131:
+	ADC C, W
+L4132:
+	AND H, 20
+L4133:
+	OR W, C
+L4134:
+	SUB H, D
+L4135:
+	SBC IY, 20060
+L4136:
+	AND (XIX+2855), A
+L4137:
+	ADC (XDE), W
+L4138:
+	ADC (L4138), W
+L4139:
+	ADD (XIX), C
+L4140:
+	AND XHL, XHL
+L4141:
+	XOR BC, 64539
+L4142:
+	ADD XIY, XIZ
+L4143:
+	ADD DE, 44218
+L4144:
+	SBC XBC, XWA
+L4145:
+	AND IZ, 55024
+L4146:
+	XOR BC, 28270
+L4147:
+	XOR IY, 29630
+L4148:
+	OR (XHL), A
+L4149:
+	AND IX, 13024
+L4150:
+	AND XHL, XWA
+L4151:
+	CP XHL, XDE
+L4152:
+	OR WA, 47220
+L4153:
+	OR L, 134
+L4154:
+	ADD (XIY+5091:16), W
+L4155:
+	ADD XIX, XIZ
+L4156:
+	AND (XIZ+114:8), E
+L4157:
+	XOR (XDE+92:8), W
+L4158:
+	ADD XIX, XWA
+L4159:
+	SBC (XWA+BC), A
+L4160:
+	XOR XIZ, XBC
+L4161:
+	SUB L, B
+L4162:
+	ADC C, 19
+L4163:
+	XOR E, 82
+L4164:
+	CP IZ, 9121
+L4165:
+	ADC XDE, XBC
+L4166:
+	ADC L, (XWA+BC)
+L4167:
+	ADD XHL, XBC
+L4168:
+	ADD C, 122
+L4169:
+	SBC HL, 59066
+L4170:
+	XOR (XDE+37:8), A
+L4171:
+	SBC H, L
+L4172:
+	XOR W, 213
+L4173:
+	SUB XBC, XIX
+L4174:
+	ADD B, (XHL-71)
+L4175:
+	ADC IY, 49689
+L4176:
+	AND IZ, 39584
+L4177:
+	SBC A, E
+L4178:
+	ADD (XDE-50), D
+L4179:
+	ADC E, 208
+L4180:
+	SBC B, D
+L4181:
+	CP D, (XHL)
+L4182:
+	ADC E, (XIY)
+L4183:
+	OR IY, 14853
+L4184:
+	CP DE, 3347
+L4185:
+	SBC L, (XIX-28)
+L4186:
+	AND DE, 24358
+L4187:
+	SUB DE, 4330
+L4188:
+	ADC IZ, 25634
+L4189:
+	XOR (P0), W
+L4190:
+	AND W, A
+L4191:
+	SBC DE, 33857
+L4192:
+	XOR WA, 65046
+L4193:
+	CP (L4191:24), E
+L4194:
+	OR XIY, XBC
+L4195:
+	ADD (XBC+19788:16), B
+L4196:
+	CP XIZ, XIZ
+L4197:
+	AND A, W
+L4198:
+	ADD A, E
+L4199:
+	ADD (P0), E
+L4200:
+	XOR (XWA+BC), L
+L4201:
+	ADC W, L
+L4202:
+	AND D, (XIX)
+L4203:
+	ADD C, L
+L4204:
+	SBC H, 208
+L4205:
+	CP (XHL), H
+L4206:
+	ADC XIZ, XIX
+L4207:
+	XOR A, (XWA+21020:16)
+L4208:
+	OR DE, 5271
+L4209:
+	SUB H, (XWA)
+L4210:
+	SUB D, (FAR)
+L4211:
+	SUB HL, 21981
+L4212:
+	ADD D, (XWA+B)
+L4213:
+	CP A, 139
+L4214:
+	XOR BC, 16192
+L4215:
+	ADD (XIY+35), W
+L4216:
+	CP XIZ, XDE
+L4217:
+	AND (FAR), E
+L4218:
+	OR XIZ, XDE
+L4219:
+	XOR B, (XIZ+28711:16)
+L4220:
+	XOR XIY, XIZ
+L4221:
+	CP L, (L4223)
+L4222:
+	SBC XBC, XIZ
+L4223:
+	SUB C, E
+L4224:
+	ADD XIX, XIX
+L4225:
+	SBC (P0), A
+L4226:
+	ADD XWA, XHL
+L4227:
+	SBC D, (XWA+78)
+L4228:
+	SBC HL, 18859
+L4229:
+	ADD (XWA+B), H
+L4230:
+	CP IY, 58431
+L4231:
+	ADD XWA, XHL
+L4232:
+	SBC E, (L4234:24)
+L4233:
+	OR L, (XWA+B)
+L4234:
+	CP (FAR), A
+L4235:
+	XOR (XIX-39), A
+L4236:
+	XOR BC, 19139
+L4237:
+	SBC WA, 12788
+L4238:
+	ADC (XIX+1553), C
+L4239:
+	OR DE, 46907
+L4240:
+	ADC A, (XDE-68)
+L4241:
+	ADD B, D
+L4242:
+	XOR H, 100
+L4243:
+	XOR H, B
+L4244:
+	ADD E, 109
+L4245:
+	XOR H, (XWA-2)
+L4246:
+	SUB L, (L4250)
+L4247:
+	AND IZ, 58069
+L4248:
+	OR XWA, XIZ
+L4249:
+	AND XIZ, XIX
+L4250:
+	XOR D, 235
+L4251:
+	XOR A, D
+L4252:
+	OR L, (P0)
+L4253:
+	SBC L, 201
+L4254:
+	ADC XWA, XIX
+L4255:
+	CP W, 4
+L4256:
+	OR HL, 56378
+L4257:
+	AND XIX, XIZ
+L4258:
+	SBC C, 73
+L4259:
+	SUB E, 33
+L4260:
+	CP B, (L4259:24)
+L4261:
+	AND XHL, XIY
+L4262:
+	SBC XIZ, XIY
+L4263:
+	SBC XIY, XHL
+L4264:
+	XOR B, (XWA+B)
+L4265:
+	ADD H, 29
+L4266:
+	SBC WA, 28796
+L4267:
+	ADC E, C
+L4268:
+	OR L, (XIX+1577)
+L4269:
+	OR (XIX+1653), W
+L4270:
+	ADC H, (L4274:24)
+L4271:
+	SBC B, D
+L4272:
+	OR WA, 5059
+L4273:
+	SBC BC, 40148
+L4274:
+	CP H, D
+L4275:
+	OR (L4278:24), B
+L4276:
+	ADD WA, 25176
+L4277:
+	ADD E, A
+L4278:
+	SBC B, (XWA+32:8)
+L4279:
+	SUB XIY, XHL
+L4280:
+	ADD XDE, XWA
+L4281:
+	AND (XHL), A
+L4282:
+	SUB IX, 65201
+L4283:
+	CP XIZ, XIX
+L4284:
+	CP XIZ, XBC
+L4285:
+	XOR DE, 29743
+L4286:
+	OR E, D
+L4287:
+	ADC XHL, XIY
+L4288:
+	OR (XWA+27188:16), D
+L4289:
+	XOR B, (XIZ+71:8)
+L4290:
+	OR D, H
+L4291:
+	SUB XIZ, XIX
+L4292:
+	SBC D, (FAR)
+L4293:
+	XOR L, 95
+L4294:
+	CP W, (L4296)
+L4295:
+	SUB D, 179
+L4296:
+	AND E, L
+L4297:
+	SUB B, C
+L4298:
+	ADD (L4295:24), W
+L4299:
+	CP XHL, XHL
+L4300:
+	ADC XIZ, XDE
+L4301:
+	ADC BC, 47999
+L4302:
+	SBC A, (XIZ)
+L4303:
+	CP B, 74
+L4304:
+	AND W, 149
+L4305:
+	ADC A, L
+L4306:
+	SBC DE, 37990
+L4307:
+	AND A, 68
+L4308:
+	ADD XIY, XWA
+L4309:
+	SBC (XBC+100), H
+L4310:
+	ADD D, 15
+L4311:
+	ADD (XHL-4), L
+L4312:
+	ADC A, C
+L4313:
+	OR L, L
+L4314:
+	SUB XIZ, XIX
+L4315:
+	AND XHL, XWA
+L4316:
+	ADD B, L
+L4317:
+	SBC (L4317), E
+L4318:
+	SBC XIZ, XIY
+L4319:
+	AND E, (XIZ-28)
+L4320:
+	SUB D, (XIX+96)
+L4321:
+	SBC IZ, 4760
+L4322:
+	CP A, 27
+L4323:
+	SBC E, 97
+L4324:
+	ADC A, 136
+L4325:
+	ADC L, (XWA-5)
+L4326:
+	CP H, 175
+L4327:
+	AND H, E
+L4328:
+	XOR E, 125
+L4329:
+	XOR IX, 7504
+L4330:
+	SUB (P0), H
+L4331:
+	CP D, 32
+L4332:
+	XOR B, H
+L4333:
+	AND C, 59
+L4334:
+	CP XDE, XBC
+L4335:
+	AND (XIY+99:8), C
+L4336:
+	XOR (XWA+B), L
+L4337:
+	SBC DE, 46645
+L4338:
+	AND L, (XIX+51)
+L4339:
+	CP L, L
+L4340:
+	XOR (L1613), E
+L4341:
+	SUB (XIX+2167), W
+L4342:
+	OR L, 254
+L4343:
+	AND XIZ, XDE
+L4344:
+	XOR XWA, XIY
+L4345:
+	XOR B, E
+L4346:
+	ADD XIX, XIZ
+L4347:
+	CP XIX, XDE
+L4348:
+	ADC H, 43
+L4349:
+	AND HL, 51089
+L4350:
+	ADD D, W
+L4351:
+	SBC (XIY), D
+L4352:
+	OR A, W
+L4353:
+	OR (L4350), D
+L4354:
+	ADC (L4354:24), A
+L4355:
+	SBC L, D
+L4356:
+	OR C, (FAR)
+L4357:
+	SUB IY, 9618
+L4358:
+	ADD B, 243
+L4359:
+	ADD A, 176
+L4360:
+	ADD W, E
+L4361:
+	SUB D, H
+L4362:
+	SBC D, H
+L4363:
+	CP XBC, XIY
+L4364:
+	ADD HL, 34886
+L4365:
+	XOR XIX, XDE
+L4366:
+	AND W, (FAR)
+L4367:
+	SUB D, 221
+L4368:
+	CP BC, 24854
+L4369:
+	SUB W, (XWA+B)
+L4370:
+	SUB D, 54
+L4371:
+	CP D, B
+L4372:
+	XOR (L4373:24), A
+L4373:
+	XOR E, (L4373)
+L4374:
+	XOR A, L
+L4375:
+	OR E, (XHL+100:8)
+L4376:
+	ADD (XBC+96), L
+L4377:
+	XOR C, L
+L4378:
+	XOR A, (XBC+76)
+L4379:
+	CP XIX, XIY
+L4380:
+	OR B, 207
+L4381:
+	ADD (L4377:24), H
+L4382:
+	XOR W, 84
+L4383:
+	ADC H, (XIX+13:8)
+L4384:
+	XOR L, 244
+L4385:
+	SBC (XBC+22452:16), W
+L4386:
+	AND L, (BIGREG)
+L4387:
+	CP XIX, XIZ
+L4388:
+	SUB D, (XWA-38)
+L4389:
+	ADD D, (XWA+BC)
+L4390:
+	CP C, B
+L4391:
+	OR DE, 39742
+L4392:
+	SBC XDE, XHL
+L4393:
+	OR A, (XIZ+43:8)
+L4394:
+	AND XIX, XIZ
+L4395:
+	ADC XDE, XWA
+L4396:
+	SUB IZ, 7360
+L4397:
+	SUB C, (XIZ)
+L4398:
+	XOR IZ, 2443
+L4399:
+	CP D, (BIGREG)
+L4400:
+	ADC IY, 16905
+L4401:
+	ADC XIZ, XIZ
+L4402:
+	CP E, C
+L4403:
+	AND E, W
+L4404:
+	OR (P0), W
+L4405:
+	ADD XIY, XIX
+L4406:
+	ADC B, W
+L4407:
+	XOR XHL, XIY
+L4408:
+	ADD W, (XBC+2)
+L4409:
+	SUB IZ, 9341
+L4410:
+	CP IY, 23976
+L4411:
+	ADD (XDE+29), H
+L4412:
+	XOR (L4409), L
+L4413:
+	OR A, 228
+L4414:
+	ADC DE, 30657
+L4415:
+	ADC D, (L2197)
+L4416:
+	SUB L, 132
+L4417:
+	SUB BC, 55958
+L4418:
+	SBC (XHL), E
+L4419:
+	AND DE, 49243
+L4420:
+	SBC XDE, XIY
+L4421:
+	SUB BC, 1693
+L4422:
+	ADD W, (XIY+5663:16)
+L4423:
+	XOR W, (L4427:24)
+L4424:
+	SUB (L4428:24), C
+L4425:
+	ADC XBC, XBC
+L4426:
+	OR XHL, XBC
+L4427:
+	ADD XBC, XWA
+L4428:
+	XOR BC, 41540
+L4429:
+	SUB DE, 27032
+L4430:
+	ADC A, L
+L4431:
+	XOR H, A
+L4432:
+	XOR XHL, XBC
+L4433:
+	SBC C, 69
+L4434:
+	XOR W, (XIX+12:8)
+L4435:
+	SUB H, (XWA+BC)
+L4436:
+	XOR XIX, XHL
+L4437:
+	XOR C, L
+L4438:
+	ADD (XIX+8696:16), D
+L4439:
+	XOR L, C
+L4440:
+	CP E, H
+L4441:
+	ADC H, E
+L4442:
+	CP XHL, XBC
+L4443:
+	CP L, (XBC)
+L4444:
+	ADD (XIX-42), W
+L4445:
+	ADC B, B
+L4446:
+	SUB XHL, XIZ
+L4447:
+	SUB W, 114
+L4448:
+	AND XIX, XIZ
+L4449:
+	ADC (XHL), D
+L4450:
+	OR DE, 25
+L4451:
+	CP WA, 3075
+L4452:
+	CP XHL, XBC
+L4453:
+	ADC XIX, XHL
+L4454:
+	OR DE, 49405
+L4455:
+	CP (XIX+2259), E
+L4456:
+	ADD A, (L4454)
+L4457:
+	ADD XWA, XWA
+L4458:
+	ADC XBC, XDE
+L4459:
+	SUB DE, 46628
+L4460:
+	CP E, (XDE)
+L4461:
+	OR (XWA-89), H
+L4462:
+	SBC C, B
+L4463:
+	AND D, 88
+L4464:
+	CP WA, 17443
+L4465:
+	XOR (XHL+15895:16), E
+L4466:
+	XOR XDE, XIX
+L4467:
+	SUB D, (XIX+83)
+L4468:
+	OR WA, 37398
+L4469:
+	CP W, (L4471)
+L4470:
+	ADC IY, 53198
+L4471:
+	SBC (XIX), D
+L4472:
+	ADC C, 231
+L4473:
+	SBC L, (XIX-31)
+L4474:
+	SBC XIY, XIX
+L4475:
+	SUB XIX, XIY
+L4476:
+	OR L, 255
+L4477:
+	ADD H, H
+L4478:
+	AND (FAR), B
+L4479:
+	SUB XWA, XBC
+L4480:
+	SUB (XIX+1749), A
+L4481:
+	ADC XIX, XIX
+L4482:
+	SBC XDE, XIX
+L4483:
+	SUB WA, 13731
+L4484:
+	OR XIY, XIX
+L4485:
+	ADD L, (XBC-84)
+L4486:
+	AND B, 162
+L4487:
+	CP (L4488:24), H
+L4488:
+	SBC H, (BIGREG)
+L4489:
+	OR (XIY+6), A
+L4490:
+	OR XBC, XBC
+L4491:
+	XOR IZ, 27357
+L4492:
+	ADC H, W
+L4493:
+	SUB XWA, XIX
+L4494:
+	XOR W, E
+L4495:
+	SBC W, 246
+L4496:
+	ADD XIZ, XHL
+L4497:
+	AND L, H
+L4498:
+	CP A, D
+L4499:
+	CP XIY, XIZ
+L4500:
+	OR L, (XIZ+11461:16)
+L4501:
+	SUB D, (FAR)
+L4502:
+	SBC W, 197
+L4503:
+	SBC B, 254
+L4504:
+	SUB (XHL+6437:16), C
+L4505:
+	CP E, B
+L4506:
+	AND BC, 36238
+L4507:
+	ADC (XIY), L
+L4508:
+	ADC A, B
+L4509:
+	XOR (XBC+18), C
+L4510:
+	AND (XWA+B), C
+L4511:
+	XOR E, 24
+L4512:
+	XOR XDE, XIX
+L4513:
+	ADC IZ, 7244
+L4514:
+	SUB DE, 47542
+L4515:
+	ADC (XDE+94:8), L
+L4516:
+	SUB XDE, XHL
+L4517:
+	OR A, 128
+L4518:
+	SBC IX, 35812
+L4519:
+	XOR (XWA+B), W
+L4520:
+	XOR H, (L3432:24)
+L4521:
+	CP (XIY+85:8), H
+L4522:
+	AND (XWA+78), C
+L4523:
+	CP (XWA+B), H
+L4524:
+	ADC XHL, XHL
+L4525:
+	OR H, 16
+L4526:
+	SBC C, (XIX+44:8)
+L4527:
+	SUB (XIZ), H
+L4528:
+	SUB (XDE+22098:16), D
+L4529:
+	SBC C, 33
+L4530:
+	SBC (XWA+13902:16), E
+L4531:
+	CP L, 251
+L4532:
+	SUB E, (P0)
+L4533:
+	AND W, (XWA+BC)
+L4534:
+	AND W, (XHL+65:8)
+L4535:
+	XOR E, 244
+L4536:
+	ADD L, E
+L4537:
+	OR W, (L4541)
+L4538:
+	XOR L, (XHL+102:8)
+L4539:
+	AND HL, 17118
+L4540:
+	AND XBC, XIX
+L4541:
+	ADD (L4545), A
+L4542:
+	SBC IY, 18355
+L4543:
+	SUB A, 230
+L4544:
+	OR (XWA+14613:16), L
+L4545:
+	AND L, (L356:24)
+L4546:
+	ADC (L4542), D
+L4547:
+	CP IY, 46813
+L4548:
+	ADD D, E
+L4549:
+	ADD C, H
+L4550:
+	CP H, 176
+L4551:
+	SBC BC, 23830
+L4552:
+	ADD BC, 17776
+L4553:
+	CP (L4552:24), B
+L4554:
+	ADC L, (XIY+2420:16)
+L4555:
+	OR W, (XWA+68:8)
+L4556:
+	OR XIX, XDE
+L4557:
+	OR (P0), L
+L4558:
+	SBC (XBC-2), B
+L4559:
+	SBC A, (L4563)
+L4560:
+	CP XIX, XIY
+L4561:
+	AND (XHL-58), D
+L4562:
+	AND (FAR), C
+L4563:
+	CP (XDE), A
+L4564:
+	ADC XWA, XWA
+L4565:
+	XOR DE, 11806
+L4566:
+	ADC W, (XIX+862)
+L4567:
+	CP H, (XBC+53)
+L4568:
+	AND H, (XBC)
+L4569:
+	ADD (XIX), D
+L4570:
+	AND XIX, XIZ
+L4571:
+	ADD (XBC-20), A
+L4572:
+	SBC W, (XIX-56)
+L4573:
+	CP XBC, XBC
+L4574:
+	ADD H, (L3900:24)
+L4575:
+	OR (XDE), A
+L4576:
+	XOR A, (L1445:24)
+L4577:
+	XOR L, 146
+L4578:
+	ADD XDE, XDE
+L4579:
+	ADD (XIX+29937:16), C
+L4580:
+	ADD HL, 21898
+L4581:
+	ADD XDE, XIZ
+L4582:
+	SUB XWA, XHL
+L4583:
+	OR E, (XIZ+111:8)
+L4584:
+	SUB W, 130
+L4585:
+	ADD DE, 37092
+L4586:
+	SUB E, 151
+L4587:
+	OR D, 170
+L4588:
+	XOR XIY, XIY
+L4589:
+	ADC XWA, XBC
+L4590:
+	SBC XBC, XDE
+L4591:
+	XOR XHL, XIZ
+L4592:
+	ADC XIX, XWA
+L4593:
+	SUB (XDE-72), W
+L4594:
+	ADC B, B
+L4595:
+	SUB A, (XWA+BC)
+L4596:
+	AND D, 81
+L4597:
+	SBC XBC, XDE
+L4598:
+	SBC XIX, XWA
+L4599:
+	CP W, 227
+L4600:
+	ADD WA, 63899
+L4601:
+	OR IZ, 58954
+L4602:
+	XOR W, 173
+L4603:
+	ADC (XIX+2777), A
+L4604:
+	SUB D, 54
+L4605:
+	AND H, 93
+L4606:
+	AND (XWA), W
+L4607:
+	ADD XIZ, XHL
+L4608:
+	XOR E, 143
+L4609:
+	OR (FAR), W
+L4610:
+	ADD (XIY), L
+L4611:
+	ADC XIZ, XIZ
+L4612:
+	XOR B, 159
+L4613:
+	XOR H, (XBC-20)
+L4614:
+	ADC HL, 11511
+L4615:
+	ADD (XIZ+16662:16), H
+L4616:
+	OR W, 85
+L4617:
+	SUB (XHL), C
+L4618:
+	SBC HL, 26813
+L4619:
+	AND IY, 29773
+L4620:
+	AND XIX, XIZ
+L4621:
+	XOR A, C
+L4622:
+	AND C, A
+L4623:
+	CP C, A
+L4624:
+	ADC (XHL+12284:16), D
+L4625:
+	XOR A, (XDE-69)
+L4626:
+	AND E, 85
+L4627:
+	CP (XBC), E
+L4628:
+	SBC XDE, XBC
+L4629:
+	XOR XIX, XIZ
+L4630:
+	SUB XHL, XIZ
+L4631:
+	XOR IY, 60895
+L4632:
+	SBC (XDE+1369:16), L
+L4633:
+	AND E, (L4637)
+L4634:
+	OR A, 197
+L4635:
+	ADC E, D
+L4636:
+	XOR B, H
+L4637:
+	ADD A, B
+L4638:
+	SBC D, 254
+L4639:
+	SBC E, 137
+L4640:
+	ADD DE, 13284
+L4641:
+	CP D, (XIY+33:8)
+L4642:
+	ADC D, 143
+L4643:
+	CP D, 247
+L4644:
+	XOR WA, 16278
+L4645:
+	SUB XHL, XBC
+L4646:
+	AND D, (XIX+2562)
+L4647:
+	AND XIZ, XBC
+L4648:
+	OR (XDE+19:8), B
+L4649:
+	SUB XIZ, XIY
+L4650:
+	ADC IZ, 28437
+L4651:
+	SBC DE, 7948
+L4652:
+	AND A, A
+L4653:
+	SBC W, (BIGREG)
+L4654:
+	OR D, (XIX+465)
+L4655:
+	SBC (BIGREG), A
+L4656:
+	SBC H, (XWA+45:8)
+L4657:
+	OR E, H
+L4658:
+	ADD XIZ, XDE
+L4659:
+	XOR E, (XWA)
+L4660:
+	AND C, H
+L4661:
+	ADC XIY, XIX
+L4662:
+	OR (L4658), H
+L4663:
+	XOR B, 222
+L4664:
+	CP A, (XDE-93)
+L4665:
+	SUB DE, 41737
+L4666:
+	XOR C, (XIZ+95:8)
+L4667:
+	XOR BC, 39108
+L4668:
+	XOR (XWA+93:8), L
+L4669:
+	OR IY, 55407
+L4670:
+	CP (XIY+90), E
+L4671:
+	ADD E, (L4669:24)
+L4672:
+	ADC H, A
+L4673:
+	AND B, D
+L4674:
+	SBC C, 24
+L4675:
+	OR IY, 6161
+L4676:
+	ADD D, 33
+L4677:
+	ADC W, W
+L4678:
+	SBC XIZ, XDE
+L4679:
+	SBC B, 64
+L4680:
+	ADC XDE, XDE
+L4681:
+	SBC XIY, XIY
+L4682:
+	SBC (P0), E
+L4683:
+	OR C, C
+L4684:
+	ADD (XHL+48), A
+L4685:
+	SBC XWA, XIY
+L4686:
+	OR BC, 31450
+L4687:
+	XOR H, 238
+L4688:
+	SUB W, 40
+L4689:
+	AND L, 190
+L4690:
+	SUB D, (XIZ+2:8)
+L4691:
+	SBC (XIX), D
+L4692:
+	ADD B, (L28)
+L4693:
+	ADC XBC, XIZ
+L4694:
+	AND DE, 7318
+L4695:
+	CP WA, 7504
+L4696:
+	SUB D, (L4692:24)
+L4697:
+	ADC XWA, XBC
+L4698:
+	SUB E, 126
+L4699:
+	SUB (XDE-56), C
+L4700:
+	AND E, 7
+L4701:
+	XOR D, L
+L4702:
+	CP (XIZ+10:8), W
+L4703:
+	SBC (XWA+BC), E
+L4704:
+	SBC IX, 20668
+L4705:
+	ADC E, 157
+L4706:
+	ADD W, (BIGREG)
+L4707:
+	CP XIY, XIX
+L4708:
+	XOR A, (XIZ-69)
+L4709:
+	SBC XHL, XIZ
+L4710:
+	OR H, 8
+L4711:
+	ADC XIZ, XIX
+L4712:
+	XOR D, (XWA+55:8)
+L4713:
+	CP (XIY-60), D
+L4714:
+	SUB D, 121
+L4715:
+	ADD A, (XWA+89)
+L4716:
+	SBC (XHL-42), A
+L4717:
+	OR B, W
+L4718:
+	XOR H, 114
+L4719:
+	ADD (XWA), W
+L4720:
+	CP IX, 8257
+L4721:
+	SBC (XIY+81:8), H
+L4722:
+	AND XWA, XHL
+L4723:
+	AND A, 129
+L4724:
+	XOR L, W
+L4725:
+	CP IZ, 9797
+L4726:
+	SBC XBC, XBC
+L4727:
+	OR XIX, XDE
+L4728:
+	AND A, 107
+L4729:
+	ADD IZ, 25613
+L4730:
+	ADD (XDE+100:8), D
+L4731:
+	XOR C, 138
+L4732:
+	ADC W, 240
+L4733:
+	SUB WA, 12722
+L4734:
+	ADD XDE, XWA
+L4735:
+	XOR (P0), D
+L4736:
+	SUB A, 193
+L4737:
+	ADD XWA, XIY
+L4738:
+	ADC W, A
+L4739:
+	ADD L, 143
+L4740:
+	SBC BC, 10658
+L4741:
+	XOR (XWA+B), L
+L4742:
+	SUB L, B
+L4743:
+	ADD E, E
+L4744:
+	CP IX, 42607
+L4745:
+	CP XIZ, XHL
+L4746:
+	SUB (XBC-31), L
+L4747:
+	XOR E, L
+L4748:
+	XOR (XBC+1347:16), E
+L4749:
+	XOR IX, 35768
+L4750:
+	XOR L, L
+L4751:
+	ADD (XWA+B), E
+L4752:
+	ADC (XWA+BC), E
+L4753:
+	SUB XIX, XIZ
+L4754:
+	CP W, 157
+L4755:
+	ADC WA, 16563
+L4756:
+	XOR (XHL+23:8), C
+L4757:
+	XOR C, (XWA+BC)
+L4758:
+	XOR (XIX+47:8), W
+L4759:
+	OR (XIX+1997), B
+L4760:
+	AND H, 23
+L4761:
+	OR (XIX+2791), W
+L4762:
+	SUB (XHL-91), C
+L4763:
+	ADD E, E
+L4764:
+	OR A, (XIX+14687:16)
+L4765:
+	ADC XIZ, XIY
+L4766:
+	ADC D, (XWA+15)
+L4767:
+	CP E, 19
+L4768:
+	XOR E, 144
+L4769:
+	OR XIY, XHL
+L4770:
+	ADC C, 215
+L4771:
+	SUB XWA, XBC
+L4772:
+	AND XBC, XDE
+L4773:
+	OR IY, 24584
+L4774:
+	SBC XDE, XHL
+L4775:
+	ADD C, 50
+L4776:
+	OR XBC, XHL
+L4777:
+	SBC (FAR), E
+L4778:
+	XOR (L4774:24), D
+L4779:
+	XOR A, (XIX+75)
+L4780:
+	CP (XWA+17), E
+L4781:
+	SUB XBC, XWA
+L4782:
+	ADC XWA, XDE
+L4783:
+	SBC XIZ, XBC
+L4784:
+	XOR XIX, XIZ
+L4785:
+	SUB H, 22
+L4786:
+	CP A, (L2684)
+L4787:
+	ADD XWA, XWA
+L4788:
+	OR A, 129
+L4789:
+	ADD H, 65
+L4790:
+	AND C, E
+L4791:
+	SBC XIZ, XBC
+L4792:
+	AND E, 15
+L4793:
+	AND B, W
+L4794:
+	AND XDE, XIX
+L4795:
+	AND E, W
+L4796:
+	ADC (XWA+B), W
+L4797:
+	AND (XIY), C
+L4798:
+	XOR XIX, XIY
+L4799:
+	ADC W, (L4797:24)
+L4800:
+	XOR C, 67
+L4801:
+	ADD XIX, XDE
+L4802:
+	SUB W, (XWA+BC)
+L4803:
+	ADD C, H
+L4804:
+	OR DE, 51102
+L4805:
+	SBC A, (XIX+2006)
+L4806:
+	SBC XIY, XWA
+L4807:
+	OR WA, 13923
+L4808:
+	OR E, (XIX+2129)
+L4809:
+	SBC (XIZ), L
+L4810:
+	ADD W, 104
+L4811:
+	CP XBC, XIX
+L4812:
+	AND BC, 40919
+L4813:
+	SBC A, 217
+L4814:
+	SUB E, 51
+L4815:
+	XOR C, A
+L4816:
+	OR D, (L4195)
+L4817:
+	ADD B, W
+L4818:
+	AND L, (XIX+2601)
+L4819:
+	OR XHL, XWA
+L4820:
+	ADD (L4705:24), A
+L4821:
+	XOR A, (L4820:24)
+L4822:
+	SBC IX, 24405
+L4823:
+	AND C, 236
+L4824:
+	ADC XIZ, XWA
+L4825:
+	ADC A, 227
+L4826:
+	SBC (XWA+B), D
+L4827:
+	CP (P0), A
+L4828:
+	ADD D, D
+L4829:
+	SUB (L4830), E
+L4830:
+	AND (L2915), B
+L4831:
+	SUB XHL, XIZ
+L4832:
+	CP H, (P0)
+L4833:
+	SBC L, D
+L4834:
+	OR H, H
+L4835:
+	ADD DE, 38338
+L4836:
+	CP (XIY+12385:16), C
+L4837:
+	CP XWA, XBC
+L4838:
+	AND B, L
+L4839:
+	SUB L, (L4835)
+L4840:
+	ADD XBC, XHL
+L4841:
+	ADC B, W
+L4842:
+	ADC W, A
+L4843:
+	AND C, 178
+L4844:
+	ADD (XHL+365:16), L
+L4845:
+	CP C, (BIGREG)
+L4846:
+	AND (XDE+76), D
+L4847:
+	ADD XDE, XIZ
+L4848:
+	CP A, L
+L4849:
+	OR A, (L3383)
+L4850:
+	CP (XIX+109:8), L
+L4851:
+	ADC XIY, XHL
+L4852:
+	CP D, (XWA+18660:16)
+L4853:
+	ADC (XWA), B
+L4854:
+	ADD A, 15
+L4855:
+	CP XBC, XDE
+L4856:
+	ADC D, 12
+L4857:
+	CP XBC, XWA
+L4858:
+	OR WA, 20465
+L4859:
+	ADC (XIX+61), H
+L4860:
+	ADC W, (BIGREG)
+L4861:
+	AND (XIZ+69), A
+L4862:
+	CP XHL, XHL
+L4863:
+	ADC (XIZ-29), H
+L4864:
+	SBC W, 218
+L4865:
+	ADC XIX, XIX
+L4866:
+	XOR L, 116
+L4867:
+	ADC XDE, XWA
+L4868:
+	OR H, 65
+L4869:
+	CP WA, 45415
+L4870:
+	ADC A, (XHL+94:8)
+L4871:
+	AND (XWA+BC), H
+L4872:
+	ADD IY, 54454
+L4873:
+	SBC IY, 16951
+L4874:
+	ADC XIX, XIX
+L4875:
+	ADD L, H
+L4876:
+	SBC (XIX+278), D
+L4877:
+	ADD E, (XWA+BC)
+L4878:
+	AND HL, 65384
+L4879:
+	XOR (XWA+BC), L
+L4880:
+	ADD XIZ, XIY
+L4881:
+	AND DE, 33224
+L4882:
+	OR BC, 21352
+L4883:
+	AND D, 163
+L4884:
+	ADD XHL, XWA
+L4885:
+	XOR W, E
+L4886:
+	OR BC, 61306
+L4887:
+	ADD E, 236
+L4888:
+	ADD (XIX-45), C
+L4889:
+	CP (XIX+929), H
+L4890:
+	CP B, 128
+L4891:
+	SBC H, C
+L4892:
+	ADD L, 72
+L4893:
+	SBC (XWA+B), E
+L4894:
+	SBC XWA, XIY
+L4895:
+	XOR E, 185
+L4896:
+	OR DE, 45772
+L4897:
+	CP WA, 2053
+L4898:
+	ADD A, C
+L4899:
+	ADD (XIZ), W
+L4900:
+	XOR A, L
+L4901:
+	XOR D, (XBC+16767:16)
+L4902:
+	SBC (XBC+13), C
+L4903:
+	ADC A, (XWA+BC)
+L4904:
+	SUB C, (XIX+699)
+L4905:
+	ADC H, (XHL+61:8)
+L4906:
+	OR A, 246
+L4907:
+	CP (XWA+B), D
+L4908:
+	OR (L4904:24), D
+L4909:
+	XOR D, B
+L4910:
+	CP B, (XDE+40)
+L4911:
+	AND D, 182
+L4912:
+	SBC IY, 5761
+L4913:
+	SUB A, L
+L4914:
+	ADD E, (L2637:24)
+L4915:
+	OR H, D
+L4916:
+	CP B, D
+L4917:
+	OR D, (XIX+9:8)
+L4918:
+	SUB C, (XWA+BC)
+L4919:
+	XOR H, (L4916:24)
+L4920:
+	ADC D, (L2987:24)
+L4921:
+	ADD W, L
+L4922:
+	ADC XBC, XIY
+L4923:
+	SUB (XIX-78), L
+L4924:
+	XOR H, 48
+L4925:
+	SUB XDE, XBC
+L4926:
+	SBC IX, 3503
+L4927:
+	ADD C, (P0)
+L4928:
+	XOR C, E
+L4929:
+	CP (XHL-34), A
+L4930:
+	ADC H, L
+L4931:
+	ADD B, 62
+L4932:
+	ADC C, 16
+L4933:
+	OR E, (XWA+17463:16)
+L4934:
+	XOR (L2934:24), A
+L4935:
+	ADD W, 104
+L4936:
+	ADC W, L
+L4937:
+	AND L, (XWA+BC)
+L4938:
+	OR A, 71
+L4939:
+	XOR D, A
+L4940:
+	OR (L4940:24), C
+L4941:
+	XOR (XIX+2512), L
+L4942:
+	ADC C, (XIX+111:8)
+L4943:
+	ADD H, W
+L4944:
+	SBC BC, 44529
+L4945:
+	SBC HL, 10388
+L4946:
+	ADC H, B
+L4947:
+	CP C, A
+L4948:
+	XOR E, D
+L4949:
+	SBC (XIY+6), E
+L4950:
+	SUB A, (L4952)
+L4951:
+	SUB W, W
+L4952:
+	OR E, B
+L4953:
+	SUB IZ, 46893
+L4954:
+	SUB C, 54
+L4955:
+	OR A, (XIX+2955)
+L4956:
+	CP L, C
+L4957:
+	OR L, 70
+L4958:
+	XOR B, A
+L4959:
+	AND L, L
+L4960:
+	ADC XIY, XDE
+L4961:
+	OR A, 83
+L4962:
+	ADD A, 128
+L4963:
+	CP (XHL+105:8), W
+L4964:
+	CP XIX, XIX
+L4965:
+	SUB (XWA), W
+L4966:
+	XOR W, (XHL+7864:16)
+L4967:
+	OR W, C
+L4968:
+	SUB (L2702), L
+L4969:
+	ADC XIY, XBC
+L4970:
+	SBC (XHL), D
+L4971:
+	ADD (L4684:24), L
+L4972:
+	AND (L4969:24), E
+L4973:
+	AND XIX, XIZ
+L4974:
+	XOR IZ, 21684
+L4975:
+	OR DE, 44806
+L4976:
+	SBC (XIX+915), W
+L4977:
+	SUB C, (XIY+11165:16)
+L4978:
+	ADC (BIGREG), A
+L4979:
+	OR A, (XIX+1945)
+L4980:
+	ADD C, (XIX+24487:16)
+L4981:
+	OR W, B
+L4982:
+	OR (XIX+4724:16), C
+L4983:
+	SUB XIZ, XIY
+L4984:
+	AND W, D
+L4985:
+	AND C, (XDE)
+L4986:
+	CP C, A
+L4987:
+	ADD (L4984:24), H
+L4988:
+	ADC W, 196
+L4989:
+	SBC (XWA+B), A
+L4990:
+	SUB C, (XIZ)
+L4991:
+	SBC A, (FAR)
+L4992:
+	ADD C, 99
+L4993:
+	XOR (XHL+14605:16), A
+L4994:
+	SUB C, (L1887:24)
+L4995:
+	AND W, E
+L4996:
+	ADC A, 224
+L4997:
+	ADC A, H
+L4998:
+	XOR L, 129
+L4999:
+	ADD H, 174
@@ -0,0 +1,12 @@
+	CPU 96C141
+	ORG 1000h
+START:
+	LD XWA,(TABLE)
+	JP LOWER
+	DB 1,2,3
+	ORG 0F00h
+LOWER:
+	LD A,(START)
+	JP START
+TABLE:
+	DD START,LOWER
@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	BIT 2, H
+L1:
+	BIT 1, (XHL)
+L2:
+	RES 0, (XHL)
+L3:
+	RES 7, (XHL)
+L4:
+	BIT 7, (XHL)
+L5:
+	RES 0, D
+L6:
+	RES 3, (XHL)
+L7:
+	RES 2, (XHL)
+L8:
+	SET 2, (XHL)
+L9:
+	RES 6, (XHL)
+L10:
+	CHG 7, H
+L11:
+	RES 3, (XHL)
+L12:
+	RES 1, (XHL)
+L13:
+	RES 6, C
+L14:
+	RES 0, (XHL)
+L15:
+	RES 2, (XHL)
+L16:
+	CHG 4, W
+L17:
+	SET 2, A
+L18:
+	RES 4, A
+L19:
+	SET 5, E
+L20:
+	BIT 3, H
+L21:
+	BIT 2, (XHL)
+L22:
+	CHG 3, C
+L23:
+	BIT 1, (XHL)
+L24:
+	RES 6, (XHL)
+L25:
+	CHG 2, H
+L26:
+	TSET 4, A
+L27:
+	CHG 5, E
+L28:
+	RES 5, L
+L29:
+	BIT 3, (XHL)
+L30:
+	RES 3, (XHL)
+L31:
+	SET 2, (XHL)
+L32:
+	SET 7, (XHL)
+L33:
+	SET 5, (XHL)
+L34:
+	RES 4, C
+L35:
+	CHG 5, E
+L36:
+	SET 4, D
+L37:
+	TSET 1, D
+L38:
+	SET 7, (XHL)
+L39:
+	RES 4, (XHL)
+L40:
+	BIT 5, (XHL)
+L41:
+	SET 6, D
+L42:
+	SET 1, (XHL)
+L43:
+	SET 1, W
+L44:
+	TSET 5, A
+L45:
+	SET 2, (XHL)
+L46:
+	BIT 6, (XHL)
+L47:
+	CHG 3, D
+L48:
+	CHG 0, D
+L49:
+	CHG 2, E
+L50:
+	SET 6, (XHL)
+L51:
+	SET 3, (XHL)
+L52:
+	CHG 1, C
+L53:
+	SET 3, E
+L54:
+	SET 3, E
+L55:
+	BIT 1, B
+L56:
+	BIT 0, (XHL)
+L57:
+	TSET 7, H
+L58:
+	BIT 6, A
+L59:
+	BIT 7, (XHL)
+L60:
+	RES 0, (XHL)
+L61:
+	BIT 4, (XHL)
+L62:
+	BIT 3, C
+L63:
+	SET 4, C
+L64:
+	CHG 6, E
+L65:
+	RES 4, (XHL)
+L66:
+	BIT 7, (XHL)
+L67:
+	SET 1, (XHL)
+L68:
+	BIT 6, (XHL)
+L69:
+	RES 4, C
+L70:
+	TSET 6, B
+L71:
+	RES 3, (XHL)
+L72:
+	SET 0, (XHL)
+L73:
+	RES 6, (XHL)
+L74:
+	TSET 0, B
+L75:
+	SET 4, L
+L76:
+	SET 2, (XHL)
+L77:
+	TSET 2, E
+L78:
+	BIT 7, (XHL)
+L79:
+	RES 3, W
+L80:
+	BIT 2, (XHL)
+L81:
+	TSET 0, L
+L82:
+	BIT 7, (XHL)
+L83:
+	SET 4, (XHL)
+L84:
+	SET 4, (XHL)
+L85:
+	RES 0, A
+L86:
+	CHG 1, W
+L87:
+	TSET 7, B
+L88:
+	CHG 2, W
+L89:
+	BIT 6, E
+L90:
+	CHG 6, L
+L91:
+	RES 5, H
+L92:
+	TSET 1, B
+L93:
+	TSET 6, C
+L94:
+	RES 4, (XHL)
+L95:
+	TSET 2, A
+L96:
+	RES 7, (XHL)
+L97:
+	BIT 1, (XHL)
+L98:
+	SET 2, (XHL)
+L99:
+	SET 7, (XHL)
+L100:
+	TSET 2, B
+L101:
+	BIT 0, (XHL)
+L102:
+	CHG 6, L
+L103:
+	RES 1, L
+L104:
+	TSET 0, E
+L105:
+	RES 4, E
+L106:
+	SET 4, L
+L107:
+	SET 1, (XHL)
+L108:
+	BIT 1, (XHL)
+L109:
+	CHG 5, B
+L110:
+	TSET 0, D
+L111:
+	CHG 6, L
+L112:
+	TSET 5, W
+L113:
+	RES 3, H
+L114:
+	BIT 1, (XHL)
+L115:
+	RES 0, (XHL)
+L116:
+	RES 1, H
+L117:
+	RES 4, (XHL)
+L118:
+	BIT 4, (XHL)
+L119:
+	SET 2, (XHL)
+L120:
+	RES 3, (XHL)
+L121:
+	BIT 0, W
+L122:
+	SET 1, (XHL)
+L123:
+	BIT 4, (XHL)
+L124:
+	SET 7, (XHL)
+L125:
+	SET 3, (XHL)
+L126:
+	BIT 1, (XHL)
+L127:
+	BIT 4, (XHL)
+L128:
+	CHG 5, A
+L129:
+	SET 3, (XHL)
+L130:
+	BIT 7, (XHL)
+L131:
+	BIT 5, (XHL)
+L132:
+	SET 6, (XHL)
+L133:
+	RES 1, (XHL)
+L134:
+	RES 1, (XHL)
+L135:
+	SET 0, (XHL)
+L136:
+	TSET 2, D
+L137:
+	RES 1, (XHL)
+L138:
+	BIT 6, A
+L139:
+	TSET 7, A
+L140:
+	SET 5, (XHL)
+L141:
+	RES 4, (XHL)
+L142:
+	SET 5, (XHL)
+L143:
+	SET 6, A
+L144:
+	RES 2, (XHL)
+L145:
+	SET 0, (XHL)
+L146:
+	BIT 0, B
+L147:
+	SET 6, (XHL)
+L148:
+	SET 1, E
+L149:
+	CHG 6, C
+L150:
+	SET 4, B
+L151:
+	SET 4, (XHL)
+L152:
+	SET 3, D
+L153:
+	SET 5, (XHL)
+L154:
+	RES 0, E
+L155:
+	RES 4, (XHL)
+L156:
+	SET 4, (XHL)
+L157:
+	SET 4, A
+L158:
+	RES 5, (XHL)
+L159:
+	RES 2, (XHL)
+L160:
+	SET 3, (XHL)
+L161:
+	CHG 2, C
+L162:
+	BIT 5, H
+L163:
+	RES 6, W
+L164:
+	RES 2, (XHL)
+L165:
+	SET 0, (XHL)
+L166:
+	RES 4, (XHL)
+L167:
+	RES 3, D
+L168:
+	CHG 0, B
+L169:
+	SET 6, D
+L170:
+	SET 6, (XHL)
+L171:
+	TSET 2, H
+L172:
+	RES 1, (XHL)
+L173:
+	BIT 5, (XHL)
+L174:
+	CHG 4, H
+L175:
+	BIT 6, (XHL)
+L176:
+	SET 1, (XHL)
+L177:
+	BIT 1, (XHL)
+L178:
+	TSET 1, L
+L179:
+	RES 3, (XHL)
+L180:
+	SET 3, H
+L181:
+	RES 5, D
+L182:
+	RES 2, (XHL)
+L183:
+	SET 2, (XHL)
+L184:
+	TSET 3, D
+L185:
+	TSET 3, B
+L186:
+	BIT 4, H
+L187:
+	BIT 0, (XHL)
+L188:
+	RES 4, (XHL)
+L189:
+	SET 3, (XHL)
+L190:
+	CHG 5, E
+L191:
+	RES 7, (XHL)
+L192:
+	SET 2, A
+L193:
+	SET 0, (XHL)
+L194:
+	TSET 5, A
+L195:
+	SET 3, B
+L196:
+	SET 3, (XHL)
+L197:
+	RES 4, D
+L198:
+	BIT 6, (XHL)
+L199:
+	BIT 3, E
+L200:
+	BIT 7, (XHL)
+L201:
+	BIT 4, (XHL)
+L202:
+	BIT 4, (XHL)
+L203:
+	SET 2, L
+L204:
+	RES 6, (XHL)
+L205:
+	TSET 6, B
+L206:
+	BIT 5, (XHL)
+L207:
+	SET 4, (XHL)
+L208:
+	BIT 3, (XHL)
+L209:
+	RES 7, E
+L210:
+	SET 1, (XHL)
+L211:
+	RES 1, (XHL)
+L212:
+	TSET 4, D
+L213:
+	RES 6, (XHL)
+L214:
+	SET 2, (XHL)
+L215:
+	SET 4, (XHL)
+L216:
+	SET 7, A
+L217:
+	RES 4, B
+L218:
+	SET 2, B
+L219:
+	CHG 5, C
+L220:
+	SET 4, (XHL)
+L221:
+	CHG 4, B
+L222:
+	SET 6, E
+L223:
+	RES 5, (XHL)
+L224:
+	RES 0, (XHL)
+L225:
+	TSET 2, L
+L226:
+	RES 0, (XHL)
+L227:
+	SET 3, (XHL)
+L228:
+	RES 6, (XHL)
+L229:
+	CHG 7, A
+L230:
+	BIT 1, (XHL)
+L231:
+	BIT 6, (XHL)
+L232:
+	SET 1, B
+L233:
+	CHG 2, B
+L234:
+	RES 3, (XHL)
+L235:
+	CHG 5, A
+L236:
+	CHG 4, L
+L237:
+	RES 2, (XHL)
+L238:
+	RES 1, B
+L239:
+	BIT 3, H
+L240:
+	BIT 0, E
+L241:
+	SET 7, (XHL)
+L242:
+	TSET 3, D
+L243:
+	RES 7, L
+L244:
+	SET 2, W
+L245:
+	CHG 1, L
+L246:
+	RES 2, W
+L247:
+	CHG 0, A
+L248:
+	SET 0, W
+L249:
+	RES 6, (XHL)
+L250:
+	BIT 3, (XHL)
+L251:
+	RES 3, B
+L252:
+	TSET 0, A
+L253:
+	BIT 3, (XHL)
+L254:
+	BIT 0, (XHL)
+L255:
+	SET 2, (XHL)
+L256:
+	TSET 5, W
+L257:
+	BIT 3, L
+L258:
+	BIT 1, (XHL)
+L259:
+	BIT 1, (XHL)
+L260:
+	RES 7, (XHL)
+L261:
+	RES 7, H
+L262:
+	CHG 3, W
+L263:
+	SET 7, (XHL)
+L264:
+	CHG 2, C
+L265:
+	BIT 0, L
+L266:
+	TSET 0, A
+L267:
+	SET 4, L
+L268:
+	TSET 6, L
+L269:
+	RES 2, (XHL)
+L270:
+	CHG 2, D
+L271:
+	RES 5, (XHL)
+L272:
+	CHG 4, H
+L273:
+	RES 5, (XHL)
+L274:
+	CHG 1, B
+L275:
+	CHG 4, E
+L276:
+	BIT 6, L
+L277:
+	RES 2, (XHL)
+L278:
+	BIT 7, H
+L279:
+	BIT 4, (XHL)
+L280:
+	CHG 0, B
+L281:
+	BIT 6, (XHL)
+L282:
+	RES 4, (XHL)
+L283:
+	BIT 1, H
+L284:
+	TSET 7, H
+L285:
+	TSET 1, E
+L286:
+	SET 6, H
+L287:
+	BIT 0, A
+L288:
+	CHG 4, B
+L289:
+	TSET 5, A
+L290:
+	BIT 7, (XHL)
+L291:
+	RES 7, W
+L292:
+	SET 1, L
+L293:
+	SET 4, (XHL)
+L294:
+	BIT 1, H
+L295:
+	BIT 4, (XHL)
+L296:
+	SET 2, D
+L297:
+	BIT 7, H
+L298:
+	BIT 4, (XHL)
+L299:
+	SET 2, C
+L300:
+	BIT 1, (XHL)
+L301:
+	SET 6, (XHL)
+L302:
+	RES 6, (XHL)
+L303:
+	CHG 1, D
+L304:
+	SET 5, A
+L305:
+	RES 5, (XHL)
+L306:
+	BIT 0, (XHL)
+L307:
+	BIT 0, (XHL)
+L308:
+	SET 4, (XHL)
+L309:
+	SET 1, B
+L310:
+	CHG 0, C
+L311:
+	SET 0, (XHL)
+L312:
+	SET 4, (XHL)
+L313:
+	SET 3, (XHL)
+L314:
+	CHG 3, A
+L315:
+	BIT 0, B
+L316:
+	RES 0, (XHL)
+L317:
+	BIT 1, (XHL)
+L318:
+	SET 2, (XHL)
+L319:
+	CHG 6, L
+L320:
+	RES 6, (XHL)
+L321:
+	BIT 3, (XHL)
+L322:
+	SET 7, (XHL)
+L323:
+	RES 1, (XHL)
+L324:
+	BIT 5, C
+L325:
+	SET 4, D
+L326:
+	SET 2, W
+L327:
+	SET 6, (XHL)
+L328:
+	BIT 4, B
+L329:
+	TSET 7, A
+L330:
+	BIT 2, (XHL)
+L331:
+	BIT 0, C
+L332:
+	RES 4, (XHL)
+L333:
+	SET 6, W
+L334:
+	RES 0, (XHL)
+L335:
+	RES 3, (XHL)
+L336:
+	SET 7, (XHL)
+L337:
+	TSET 5, C
+L338:
+	BIT 5, W
+L339:
+	BIT 6, (XHL)
+L340:
+	RES 3, (XHL)
+L341:
+	TSET 7, A
+L342:
+	BIT 2, (XHL)
+L343:
+	CHG 4, W
+L344:
+	RES 5, B
+L345:
+	TSET 6, E
+L346:
+	SET 6, C
+L347:
+	BIT 6, E
+L348:
+	SET 6, L
+L349:
+	CHG 6, W
+L350:
+	TSET 4, E
+L351:
+	SET 1, A
+L352:
+	SET 1, (XHL)
+L353:
+	SET 3, (XHL)
+L354:
+	RES 2, H
+L355:
+	RES 4, C
+L356:
+	CHG 5, D
+L357:
+	RES 7, (XHL)
+L358:
+	TSET 3, E
+L359:
+	TSET 2, D
+L360:
+	BIT 2, (XHL)
+L361:
+	BIT 3, (XHL)
+L362:
+	BIT 5, B
+L363:
+	TSET 5, A
+L364:
+	SET 0, (XHL)
+L365:
+	SET 4, (XHL)
+L366:
+	BIT 4, (XHL)
+L367:
+	BIT 3, (XHL)
+L368:
+	CHG 2, L
+L369:
+	TSET 0, L
+L370:
+	BIT 2, D
+L371:
+	SET 2, L
+L372:
+	RES 4, (XHL)
+L373:
+	BIT 1, L
+L374:
+	TSET 6, B
+L375:
+	BIT 2, (XHL)
+L376:
+	BIT 6, (XHL)
+L377:
+	SET 5, (XHL)
+L378:
+	TSET 1, H
+L379:
+	BIT 5, A
+L380:
+	SET 0, (XHL)
+L381:
+	RES 1, (XHL)
+L382:
+	SET 7, (XHL)
+L383:
+	RES 4, W
+L384:
+	RES 0, (XHL)
+L385:
+	RES 6, H
+L386:
+	TSET 3, E
+L387:
+	SET 5, A
+L388:
+	TSET 2, E
+L389:
+	BIT 0, (XHL)
+L390:
+	RES 6, (XHL)
+L391:
+	SET 2, L
+L392:
+	RES 5, E
+L393:
+	BIT 2, (XHL)
+L394:
+	RES 6, (XHL)
+L395:
+	SET 2, (XHL)
+L396:
+	RES 2, (XHL)
+L397:
+	BIT 4, (XHL)
+L398:
+	RES 5, B
+L399:
+	RES 0, (XHL)
+L400:
+	BIT 0, (XHL)
+L401:
+	CHG 6, W
+L402:
+	RES 2, (XHL)
+L403:
+	TSET 7, D
+L404:
+	TSET 2, D
+L405:
+	BIT 7, H
+L406:
+	TSET 4, L
+L407:
+	BIT 5, (XHL)
+L408:
+	RES 0, (XHL)
+L409:
+	CHG 2, E
+L410:
+	RES 1, (XHL)
+L411:
+	SET 4, L
+L412:
+	SET 0, (XHL)
+L413:
+	TSET 2, H
+L414:
+	BIT 7, L
+L415:
+	BIT 1, (XHL)
+L416:
+	BIT 1, E
+L417:
+	CHG 7, A
+L418:
+	TSET 3, A
+L419:
+	TSET 3, L
+L420:
+	TSET 6, C
+L421:
+	SET 6, (XHL)
+L422:
+	CHG 7, C
+L423:
+	BIT 4, (XHL)
+L424:
+	RES 7, (XHL)
+L425:
+	SET 2, L
+L426:
+	BIT 2, C
+L427:
+	BIT 0, L
+L428:
+	BIT 4, (XHL)
+L429:
+	SET 0, W
+L430:
+	SET 5, (XHL)
+L431:
+	BIT 4, H
+L432:
+	RES 1, (XHL)
+L433:
+	BIT 0, B
+L434:
+	BIT 3, (XHL)
+L435:
+	TSET 3, D
+L436:
+	RES 5, H
+L437:
+	TSET 4, A
+L438:
+	TSET 5, L
+L439:
+	BIT 7, C
+L440:
+	BIT 5, (XHL)
+L441:
+	SET 4, B
+L442:
+	SET 6, (XHL)
+L443:
+	TSET 1, W
+L444:
+	CHG 5, A
+L445:
+	SET 2, C
+L446:
+	RES 7, (XHL)
+L447:
+	SET 0, E
+L448:
+	TSET 0, H
+L449:
+	TSET 1, H
+L450:
+	TSET 0, L
+L451:
+	RES 1, B
+L452:
+	TSET 7, A
+L453:
+	RES 0, (XHL)
+L454:
+	RES 5, (XHL)
+L455:
+	SET 7, (XHL)
+L456:
+	CHG 0, W
+L457:
+	SET 5, (XHL)
+L458:
+	BIT 6, W
+L459:
+	RES 4, (XHL)
+L460:
+	RES 3, E
+L461:
+	RES 4, C
+L462:
+	RES 7, (XHL)
+L463:
+	RES 6, (XHL)
+L464:
+	SET 0, (XHL)
+L465:
+	RES 6, (XHL)
+L466:
+	BIT 1, L
+L467:
+	BIT 5, L
+L468:
+	RES 2, (XHL)
+L469:
+	RES 7, B
+L470:
+	CHG 7, L
+L471:
+	BIT 4, (XHL)
+L472:
+	BIT 4, W
+L473:
+	BIT 0, (XHL)
+L474:
+	CHG 6, A
+L475:
+	SET 1, (XHL)
+L476:
+	SET 1, D
+L477:
+	RES 4, D
+L478:
+	RES 4, (XHL)
+L479:
+	RES 2, H
+L480:
+	BIT 2, (XHL)
+L481:
+	BIT 5, B
+L482:
+	SET 4, (XHL)
+L483:
+	SET 7, (XHL)
+L484:
+	SET 2, (XHL)
+L485:
+	CHG 7, W
+L486:
+	BIT 6, (XHL)
+L487:
+	RES 2, H
+L488:
+	SET 0, (XHL)
+L489:
+	RES 0, (XHL)
+L490:
+	CHG 0, E
+L491:
+	TSET 3, A
+L492:
+	RES 7, (XHL)
+L493:
+	RES 3, (XHL)
+L494:
+	SET 3, (XHL)
+L495:
+	BIT 5, H
+L496:
+	SET 6, (XHL)
+L497:
+	SET 7, (XHL)
+L498:
+	BIT 4, (XHL)
+L499:
+	BIT 1, B
+L500:
+	SET 6, A
+L501:
+	RES 6, A
+L502:
+	RES 5, (XHL)
+L503:
+	BIT 1, (XHL)
+L504:
+	RES 5, E
+L505:
+	SET 6, (XHL)
+L506:
+	BIT 1, (XHL)
+L507:
+	BIT 0, A
+L508:
+	RES 2, C
+L509:
+	SET 1, E
+L510:
+	BIT 3, (XHL)
+L511:
+	SET 1, (XHL)
+L512:
+	RES 3, (XHL)
+L513:
+	RES 5, A
+L514:
+	BIT 6, (XHL)
+L515:
+	RES 3, E
+L516:
+	SET 3, (XHL)
+L517:
+	RES 2, (XHL)
+L518:
+	BIT 2, (XHL)
+L519:
+	BIT 2, L
+L520:
+	BIT 2, (XHL)
+L521:
+	SET 2, L
+L522:
+	RES 0, (XHL)
+L523:
+	RES 2, E
+L524:
+	TSET 5, C
+L525:
+	RES 1, (XHL)
+L526:
+	BIT 3, E
+L527:
+	CHG 4, H
+L528:
+	SET 1, E
+L529:
+	SET 2, A
+L530:
+	BIT 1, (XHL)
+L531:
+	TSET 6, W
+L532:
+	BIT 0, H
+L533:
+	BIT 7, (XHL)
+L534:
+	BIT 1, C
+L535:
+	SET 1, (XHL)
+L536:
+	SET 4, (XHL)
+L537:
+	BIT 1, B
+L538:
+	CHG 6, D
+L539:
+	SET 1, (XHL)
+L540:
+	SET 1, (XHL)
+L541:
+	RES 3, B
+L542:
+	RES 4, (XHL)
+L543:
+	SET 5, E
+L544:
+	TSET 5, B
+L545:
+	CHG 3, C
+L546:
+	BIT 4, (XHL)
+L547:
+	RES 4, (XHL)
+L548:
+	RES 4, (XHL)
+L549:
+	SET 4, (XHL)
+L550:
+	RES 6, (XHL)
+L551:
+	BIT 0, (XHL)
+L552:
+	RES 7, (XHL)
+L553:
+	RES 2, L
+L554:
+	CHG 3, B
+L555:
+	RES 3, C
+L556:
+	BIT 2, (XHL)
+L557:
+	RES 6, (XHL)
+L558:
+	TSET 1, W
+L559:
+	SET 2, L
+L560:
+	RES 3, (XHL)
+L561:
+	RES 1, H
+L562:
+	TSET 0, H
+L563:
+	SET 5, (XHL)
+L564:
+	CHG 6, B
+L565:
+	RES 4, B
+L566:
+	BIT 2, H
+L567:
+	BIT 5, B
+L568:
+	TSET 4, B
+L569:
+	SET 2, (XHL)
+L570:
+	RES 1, (XHL)
+L571:
+	TSET 2, A
+L572:
+	RES 1, (XHL)
+L573:
+	BIT 7, (XHL)
+L574:
+	SET 1, W
+L575:
+	RES 0, (XHL)
+L576:
+	BIT 5, (XHL)
+L577:
+	SET 2, C
+L578:
+	RES 6, A
+L579:
+	RES 2, (XHL)
+L580:
+	RES 3, C
+L581:
+	RES 6, (XHL)
+L582:
+	CHG 4, W
+L583:
+	BIT 4, (XHL)
+L584:
+	CHG 4, D
+L585:
+	RES 5, (XHL)
+L586:
+	BIT 4, (XHL)
+L587:
+	RES 2, D
+L588:
+	SET 0, (XHL)
+L589:
+	SET 1, A
+L590:
+	TSET 6, B
+L591:
+	RES 6, (XHL)
+L592:
+	SET 2, B
+L593:
+	RES 5, W
+L594:
+	TSET 1, E
+L595:
+	BIT 2, (XHL)
+L596:
+	SET 4, (XHL)
+L597:
+	BIT 6, W
+L598:
+	RES 7, (XHL)
+L599:
+	TSET 1, A
+L600:
+	BIT 2, (XHL)
+L601:
+	SET 2, (XHL)
+L602:
+	CHG 0, L
+L603:
+	CHG 3, B
+L604:
+	CHG 0, W
+L605:
+	RES 4, E
+L606:
+	SET 1, (XHL)
+L607:
+	CHG 2, L
+L608:
+	RES 5, (XHL)
+L609:
+	RES 7, (XHL)
+L610:
+	SET 0, A
+L611:
+	SET 2, (XHL)
+L612:
+	SET 6, C
+L613:
+	RES 4, C
+L614:
+	CHG 0, C
+L615:
+	TSET 1, E
+L616:
+	CHG 4, B
+L617:
+	SET 7, (XHL)
+L618:
+	RES 3, (XHL)
+L619:
+	RES 2, C
+L620:
+	SET 4, D
+L621:
+	SET 3, (XHL)
+L622:
+	SET 2, (XHL)
+L623:
+	TSET 0, W
+L624:
+	BIT 5, (XHL)
+L625:
+	BIT 4, (XHL)
+L626:
+	BIT 3, (XHL)
+L627:
+	RES 4, (XHL)
+L628:
+	CHG 0, E
+L629:
+	TSET 7, E
+L630:
+	BIT 4, (XHL)
+L631:
+	BIT 5, W
+L632:
+	TSET 3, B
+L633:
+	RES 4, (XHL)
+L634:
+	SET 1, A
+L635:
+	RES 5, (XHL)
+L636:
+	RES 5, (XHL)
+L637:
+	BIT 2, (XHL)
+L638:
+	RES 2, (XHL)
+L639:
+	BIT 5, (XHL)
+L640:
+	RES 7, (XHL)
+L641:
+	BIT 6, A
+L642:
+	SET 4, A
+L643:
+	CHG 4, A
+L644:
+	RES 4, (XHL)
+L645:
+	BIT 2, (XHL)
+L646:
+	SET 1, (XHL)
+L647:
+	RES 2, (XHL)
+L648:
+	RES 6, (XHL)
+L649:
+	RES 1, H
+L650:
+	RES 5, (XHL)
+L651:
+	RES 7, B
+L652:
+	RES 3, (XHL)
+L653:
+	RES 0, (XHL)
+L654:
+	RES 3, (XHL)
+L655:
+	SET 0, (XHL)
+L656:
+	SET 6, D
+L657:
+	TSET 2, H
+L658:
+	SET 2, H
+L659:
+	RES 0, C
+L660:
+	RES 5, (XHL)
+L661:
+	SET 7, (XHL)
+L662:
+	SET 5, W
+L663:
+	SET 7, (XHL)
+L664:
+	BIT 5, (XHL)
+L665:
+	RES 4, H
+L666:
+	SET 1, W
+L667:
+	SET 2, (XHL)
+L668:
+	TSET 2, B
+L669:
+	RES 7, H
+L670:
+	TSET 7, W
+L671:
+	RES 4, (XHL)
+L672:
+	BIT 7, W
+L673:
+	RES 0, (XHL)
+L674:
+	TSET 3, C
+L675:
+	CHG 7, D
+L676:
+	SET 5, (XHL)
+L677:
+	BIT 5, (XHL)
+L678:
+	SET 2, (XHL)
+L679:
+	RES 5, A
+L680:
+	CHG 7, B
+L681:
+	SET 1, B
+L682:
+	CHG 6, E
+L683:
+	TSET 6, C
+L684:
+	TSET 1, W
+L685:
+	RES 0, C
+L686:
+	RES 7, (XHL)
+L687:
+	TSET 5, W
+L688:
+	RES 2, B
+L689:
+	SET 5, (XHL)
+L690:
+	RES 3, (XHL)
+L691:
+	CHG 7, W
+L692:
+	SET 7, (XHL)
+L693:
+	TSET 7, E
+L694:
+	TSET 3, E
+L695:
+	RES 7, (XHL)
+L696:
+	RES 6, (XHL)
+L697:
+	RES 7, E
+L698:
+	BIT 4, L
+L699:
+	RES 1, B
+L700:
+	BIT 4, A
+L701:
+	SET 3, C
+L702:
+	TSET 7, A
+L703:
+	BIT 6, A
+L704:
+	SET 6, (XHL)
+L705:
+	SET 6, C
+L706:
+	SET 5, H
+L707:
+	SET 2, H
+L708:
+	SET 5, (XHL)
+L709:
+	CHG 1, C
+L710:
+	RES 1, (XHL)
+L711:
+	BIT 5, C
+L712:
+	RES 5, A
+L713:
+	SET 5, (XHL)
+L714:
+	SET 7, W
+L715:
+	BIT 4, H
+L716:
+	TSET 6, A
+L717:
+	BIT 4, (XHL)
+L718:
+	RES 0, (XHL)
+L719:
+	BIT 3, (XHL)
+L720:
+	BIT 6, (XHL)
+L721:
+	BIT 4, A
+L722:
+	RES 4, (XHL)
+L723:
+	SET 5, (XHL)
+L724:
+	SET 0, (XHL)
+L725:
+	TSET 2, E
+L726:
+	BIT 7, (XHL)
+L727:
+	TSET 7, H
+L728:
+	TSET 3, H
+L729:
+	SET 4, (XHL)
+L730:
+	BIT 1, (XHL)
+L731:
+	BIT 6, C
+L732:
+	BIT 3, (XHL)
+L733:
+	SET 1, (XHL)
+L734:
+	SET 7, (XHL)
+L735:
+	BIT 3, L
+L736:
+	SET 1, D
+L737:
+	CHG 4, W
+L738:
+	RES 3, (XHL)
+L739:
+	BIT 6, (XHL)
+L740:
+	BIT 7, (XHL)
+L741:
+	RES 7, (XHL)
+L742:
+	CHG 3, L
+L743:
+	BIT 7, E
+L744:
+	BIT 4, B
+L745:
+	TSET 5, D
+L746:
+	BIT 1, B
+L747:
+	BIT 2, (XHL)
+L748:
+	RES 6, (XHL)
+L749:
+	BIT 4, A
+L750:
+	SET 3, L
+L751:
+	BIT 0, (XHL)
+L752:
+	SET 2, (XHL)
+L753:
+	SET 3, A
+L754:
+	SET 0, (XHL)
+L755:
+	TSET 5, E
+L756:
+	BIT 1, (XHL)
+L757:
+	RES 0, (XHL)
+L758:
+	TSET 6, H
+L759:
+	SET 1, (XHL)
+L760:
+	RES 3, (XHL)
+L761:
+	SET 5, (XHL)
+L762:
+	SET 2, (XHL)
+L763:
+	RES 3, A
+L764:
+	BIT 5, (XHL)
+L765:
+	SET 6, H
+L766:
+	SET 6, (XHL)
+L767:
+	CHG 4, E
+L768:
+	TSET 1, H
+L769:
+	SET 6, (XHL)
+L770:
+	RES 3, B
+L771:
+	TSET 3, C
+L772:
+	TSET 3, E
+L773:
+	TSET 7, E
+L774:
+	BIT 0, (XHL)
+L775:
+	BIT 7, (XHL)
+L776:
+	RES 3, A
+L777:
+	CHG 2, B
+L778:
+	BIT 5, (XHL)
+L779:
+	RES 7, (XHL)
+L780:
+	BIT 5, C
+L781:
+	SET 2, (XHL)
+L782:
+	RES 6, (XHL)
+L783:
+	RES 6, (XHL)
+L784:
+	BIT 4, (XHL)
+L785:
+	SET 5, (XHL)
+L786:
+	BIT 6, (XHL)
+L787:
+	CHG 0, C
+L788:
+	BIT 3, (XHL)
+L789:
+	RES 3, B
+L790:
+	BIT 2, E
+L791:
+	SET 1, (XHL)
+L792:
+	BIT 1, (XHL)
+L793:
+	BIT 7, H
+L794:
+	BIT 6, (XHL)
+L795:
+	SET 1, L
+L796:
+	RES 4, E
+L797:
+	RES 6, H
+L798:
+	RES 4, H
+L799:
+	CHG 5, E
+L800:
+	SET 5, (XHL)
+L801:
+	BIT 6, E
+L802:
+	SET 5, (XHL)
+L803:
+	SET 1, H
+L804:
+	SET 3, (XHL)
+L805:
+	BIT 0, (XHL)
+L806:
+	BIT 7, (XHL)
+L807:
+	SET 2, (XHL)
+L808:
+	SET 4, W
+L809:
+	SET 3, (XHL)
+L810:
+	RES 3, (XHL)
+L811:
+	CHG 6, D
+L812:
+	TSET 7, W
+L813:
+	SET 5, (XHL)
+L814:
+	BIT 2, (XHL)
+L815:
+	SET 1, C
+L816:
+	TSET 3, A
+L817:
+	RES 0, A
+L818:
+	RES 3, E
+L819:
+	SET 1, B
+L820:
+	SET 6, A
+L821:
+	TSET 3, H
+L822:
+	BIT 7, H
+L823:
+	BIT 0, (XHL)
+L824:
+	RES 7, L
+L825:
+	BIT 4, A
+L826:
+	BIT 5, C
+L827:
+	TSET 6, A
+L828:
+	SET 1, (XHL)
+L829:
+	SET 5, W
+L830:
+	SET 5, (XHL)
+L831:
+	RES 4, (XHL)
+L832:
+	BIT 0, (XHL)
+L833:
+	TSET 4, H
+L834:
+	RES 0, (XHL)
+L835:
+	BIT 5, (XHL)
+L836:
+	RES 7, (XHL)
+L837:
+	SET 6, (XHL)
+L838:
+	BIT 0, H
+L839:
+	SET 6, (XHL)
+L840:
+	BIT 0, A
+L841:
+	SET 4, C
+L842:
+	SET 1, (XHL)
+L843:
+	BIT 7, (XHL)
+L844:
+	RES 7, E
+L845:
+	CHG 0, H
+L846:
+	BIT 5, (XHL)
+L847:
+	BIT 1, (XHL)
+L848:
+	SET 0, D
+L849:
+	BIT 5, D
+L850:
+	SET 0, (XHL)
+L851:
+	BIT 1, (XHL)
+L852:
+	SET 1, (XHL)
+L853:
+	BIT 7, (XHL)
+L854:
+	SET 3, (XHL)
+L855:
+	TSET 2, B
+L856:
+	TSET 4, A
+L857:
+	SET 2, (XHL)
+L858:
+	SET 6, (XHL)
+L859:
+	BIT 5, (XHL)
+L860:
+	RES 4, (XHL)
+L861:
+	RES 7, (XHL)
+L862:
+	RES 7, (XHL)
+L863:
+	TSET 1, H
+L864:
+	BIT 1, (XHL)
+L865:
+	BIT 6, (XHL)
+L866:
+	RES 5, A
+L867:
+	TSET 1, D
+L868:
+	RES 4, W
+L869:
+	BIT 7, A
+L870:
+	TSET 4, H
+L871:
+	RES 2, W
+L872:
+	RES 2, (XHL)
+L873:
+	BIT 6, (XHL)
+L874:
+	BIT 2, (XHL)
+L875:
+	SET 2, (XHL)
+L876:
+	CHG 5, L
+L877:
+	SET 5, (XHL)
+L878:
+	SET 2, (XHL)
+L879:
+	SET 7, (XHL)
+L880:
+	CHG 4, H
+L881:
+	RES 1, (XHL)
+L882:
+	SET 7, (XHL)
+L883:
+	RES 4, A
+L884:
+	BIT 7, (XHL)
+L885:
+	BIT 0, (XHL)
+L886:
+	TSET 1, W
+L887:
+	BIT 4, (XHL)
+L888:
+	CHG 0, C
+L889:
+	RES 7, (XHL)
+L890:
+	SET 4, (XHL)
+L891:
+	SET 5, W
+L892:
+	BIT 1, (XHL)
+L893:
+	BIT 2, (XHL)
+L894:
+	CHG 5, B
+L895:
+	TSET 4, H
+L896:
+	BIT 1, (XHL)
+L897:
+	BIT 5, (XHL)
+L898:
+	RES 1, (XHL)
+L899:
+	RES 0, (XHL)
+L900:
+	RES 3, B
+L901:
+	BIT 2, E
+L902:
+	BIT 4, (XHL)
+L903:
+	BIT 5, L
+L904:
+	BIT 3, (XHL)
+L905:
+	BIT 1, (XHL)
+L906:
+	TSET 4, H
+L907:
+	BIT 5, E
+L908:
+	TSET 6, L
+L909:
+	BIT 2, A
+L910:
+	SET 3, (XHL)
+L911:
+	BIT 1, (XHL)
+L912:
+	TSET 6, W
+L913:
+	BIT 2, (XHL)
+L914:
+	SET 1, (XHL)
+L915:
+	SET 6, (XHL)
+L916:
+	SET 0, (XHL)
+L917:
+	BIT 6, E
+L918:
+	BIT 5, H
+L919:
+	RES 5, (XHL)
+L920:
+	RES 6, (XHL)
+L921:
+	RES 0, C
+L922:
+	RES 2, D
+L923:
+	SET 6, (XHL)
+L924:
+	TSET 7, E
+L925:
+	CHG 5, L
+L926:
+	SET 3, (XHL)
+L927:
+	SET 3, A
+L928:
+	CHG 7, C
+L929:
+	RES 1, (XHL)
+L930:
+	RES 1, E
+L931:
+	RES 4, (XHL)
+L932:
+	RES 4, (XHL)
+L933:
+	SET 6, W
+L934:
+	SET 3, L
+L935:
+	RES 3, (XHL)
+L936:
+	BIT 0, D
+L937:
+	CHG 4, A
+L938:
+	BIT 6, (XHL)
+L939:
+	RES 0, H
+L940:
+	SET 4, (XHL)
+L941:
+	BIT 3, C
+L942:
+	BIT 7, (XHL)
+L943:
+	BIT 3, (XHL)
+L944:
+	RES 1, D
+L945:
+	RES 3, W
+L946:
+	TSET 6, L
+L947:
+	CHG 5, D
+L948:
+	RES 4, C
+L949:
+	BIT 1, (XHL)
+L950:
+	SET 1, (XHL)
+L951:
+	SET 0, (XHL)
+L952:
+	RES 4, (XHL)
+L953:
+	BIT 2, E
+L954:
+	BIT 7, D
+L955:
+	BIT 7, L
+L956:
+	BIT 4, E
+L957:
+	TSET 6, H
+L958:
+	RES 3, (XHL)
+L959:
+	RES 4, W
+L960:
+	TSET 1, A
+L961:
+	SET 2, (XHL)
+L962:
+	TSET 0, D
+L963:
+	BIT 0, B
+L964:
+	BIT 6, E
+L965:
+	TSET 1, A
+L966:
+	TSET 2, L
+L967:
+	SET 7, (XHL)
+L968:
+	SET 7, (XHL)
+L969:
+	RES 0, (XHL)
+L970:
+	TSET 4, H
+L971:
+	TSET 2, H
+L972:
+	RES 0, D
+L973:
+	RES 1, W
+L974:
+	BIT 3, (XHL)
+L975:
+	TSET 2, C
+L976:
+	RES 2, C
+L977:
+	RES 7, A
+L978:
+	BIT 6, (XHL)
+L979:
+	TSET 6, A
+L980:
+	RES 4, C
+L981:
+	BIT 3, (XHL)
+L982:
+	BIT 5, (XHL)
+L983:
+	CHG 7, A
+L984:
+	SET 4, C
+L985:
+	CHG 3, W
+L986:
+	SET 2, (XHL)
+L987:
+	BIT 6, (XHL)
+L988:
+	BIT 4, D
+L989:
+	RES 7, (XHL)
+L990:
+	CHG 7, H
+L991:
+	SET 0, (XHL)
+L992:
+	CHG 0, H
+L993:
+	SET 5, (XHL)
+L994:
+	RES 3, (XHL)
+L995:
+	SET 6, (XHL)
+L996:
+	RES 0, (XHL)
+L997:
+	RES 4, (XHL)
+L998:
+	BIT 4, H
+L999:
+	SET 5, (XHL)
+L1000:
+	CHG 5, B
+L1001:
+	SET 4, (XHL)
+L1002:
+	CHG 7, W
+L1003:
+	SET 1, H
+L1004:
+	TSET 7, D
+L1005:
+	SET 0, (XHL)
+L1006:
+	RES 6, (XHL)
+L1007:
+	CHG 1, A
+L1008:
+	SET 3, (XHL)
+L1009:
+	TSET 0, E
+L1010:
+	RES 0, A
+L1011:
+	CHG 5, L
+L1012:
+	SET 6, D
+L1013:
+	BIT 5, (XHL)
+L1014:
+	RES 3, (XHL)
+L1015:
+	RES 5, C
+L1016:
+	CHG 4, E
+L1017:
+	BIT 2, (XHL)
+L1018:
+	SET 6, (XHL)
+L1019:
+	BIT 3, D
+L1020:
+	TSET 1, E
+L1021:
+	RES 2, (XHL)
+L1022:
+	BIT 0, A
+L1023:
+	BIT 3, (XHL)
+L1024:
+	SET 3, (XHL)
+L1025:
+	BIT 4, C
+L1026:
+	SET 0, (XHL)
+L1027:
+	SET 5, (XHL)
+L1028:
+	BIT 1, (XHL)
+L1029:
+	BIT 2, (XHL)
+L1030:
+	TSET 2, B
+L1031:
+	BIT 2, W
+L1032:
+	BIT 6, D
+L1033:
+	RES 7, A
+L1034:
+	RES 6, B
+L1035:
+	SET 2, (XHL)
+L1036:
+	BIT 0, (XHL)
+L1037:
+	BIT 1, E
+L1038:
+	RES 2, D
+L1039:
+	CHG 7, E
+L1040:
+	RES 4, (XHL)
+L1041:
+	BIT 3, (XHL)
+L1042:
+	BIT 0, (XHL)
+L1043:
+	CHG 0, D
+L1044:
+	RES 1, (XHL)
+L1045:
+	CHG 2, D
+L1046:
+	SET 7, A
+L1047:
+	CHG 3, B
+L1048:
+	RES 2, A
+L1049:
+	RES 4, (XHL)
+L1050:
+	TSET 5, D
+L1051:
+	CHG 4, B
+L1052:
+	SET 7, A
+L1053:
+	BIT 2, H
+L1054:
+	TSET 0, A
+L1055:
+	RES 4, (XHL)
+L1056:
+	SET 4, (XHL)
+L1057:
+	CHG 4, E
+L1058:
+	RES 7, (XHL)
+L1059:
+	CHG 2, A
+L1060:
+	CHG 5, E
+L1061:
+	RES 1, C
+L1062:
+	SET 3, (XHL)
+L1063:
+	BIT 6, (XHL)
+L1064:
+	TSET 0, D
+L1065:
+	BIT 0, B
+L1066:
+	TSET 4, L
+L1067:
+	CHG 7, C
+L1068:
+	SET 4, L
+L1069:
+	BIT 4, (XHL)
+L1070:
+	BIT 7, L
+L1071:
+	BIT 5, (XHL)
+L1072:
+	TSET 5, E
+L1073:
+	TSET 5, D
+L1074:
+	SET 6, (XHL)
+L1075:
+	CHG 4, W
+L1076:
+	SET 3, (XHL)
+L1077:
+	RES 7, (XHL)
+L1078:
+	RES 1, (XHL)
+L1079:
+	RES 7, L
+L1080:
+	BIT 5, (XHL)
+L1081:
+	RES 7, A
+L1082:
+	BIT 3, (XHL)
+L1083:
+	SET 7, (XHL)
+L1084:
+	BIT 5, C
+L1085:
+	TSET 1, A
+L1086:
+	SET 7, (XHL)
+L1087:
+	BIT 2, L
+L1088:
+	RES 7, (XHL)
+L1089:
+	RES 0, A
+L1090:
+	BIT 5, (XHL)
+L1091:
+	RES 6, (XHL)
+L1092:
+	RES 1, (XHL)
+L1093:
+	SET 2, (XHL)
+L1094:
+	RES 2, (XHL)
+L1095:
+	RES 0, (XHL)
+L1096:
+	TSET 4, E
+L1097:
+	TSET 7, L
+L1098:
+	RES 3, A
+L1099:
+	SET 3, (XHL)
+L1100:
+	TSET 5, L
+L1101:
+	RES 1, (XHL)
+L1102:
+	CHG 0, W
+L1103:
+	SET 5, (XHL)
+L1104:
+	RES 4, (XHL)
+L1105:
+	RES 6, (XHL)
+L1106:
+	RES 4, (XHL)
+L1107:
+	TSET 2, C
+L1108:
+	BIT 2, (XHL)
+L1109:
+	SET 7, (XHL)
+L1110:
+	BIT 3, W
+L1111:
+	BIT 2, A
+L1112:
+	RES 3, (XHL)
+L1113:
+	BIT 3, (XHL)
+L1114:
+	BIT 1, L
+L1115:
+	SET 4, (XHL)
+L1116:
+	RES 0, B
+L1117:
+	SET 6, (XHL)
+L1118:
+	RES 6, (XHL)
+L1119:
+	CHG 5, B
+L1120:
+	CHG 2, C
+L1121:
+	BIT 2, (XHL)
+L1122:
+	SET 2, (XHL)
+L1123:
+	SET 6, A
+L1124:
+	SET 3, (XHL)
+L1125:
+	RES 3, A
+L1126:
+	SET 5, (XHL)
+L1127:
+	SET 7, (XHL)
+L1128:
+	BIT 1, C
+L1129:
+	SET 2, H
+L1130:
+	TSET 2, C
+L1131:
+	RES 5, A
+L1132:
+	RES 4, L
+L1133:
+	TSET 2, B
+L1134:
+	SET 5, D
+L1135:
+	BIT 1, W
+L1136:
+	BIT 0, A
+L1137:
+	RES 1, B
+L1138:
+	RES 6, (XHL)
+L1139:
+	TSET 0, E
+L1140:
+	CHG 2, B
+L1141:
+	BIT 0, (XHL)
+L1142:
+	SET 2, (XHL)
+L1143:
+	CHG 2, A
+L1144:
+	SET 1, E
+L1145:
+	TSET 0, A
+L1146:
+	SET 5, (XHL)
+L1147:
+	BIT 0, H
+L1148:
+	SET 3, (XHL)
+L1149:
+	RES 3, H
+L1150:
+	BIT 2, (XHL)
+L1151:
+	SET 6, L
+L1152:
+	BIT 4, A
+L1153:
+	RES 7, (XHL)
+L1154:
+	SET 6, E
+L1155:
+	SET 1, (XHL)
+L1156:
+	RES 3, (XHL)
+L1157:
+	TSET 4, L
+L1158:
+	SET 6, (XHL)
+L1159:
+	SET 5, (XHL)
+L1160:
+	SET 7, (XHL)
+L1161:
+	BIT 0, L
+L1162:
+	BIT 1, B
+L1163:
+	SET 5, (XHL)
+L1164:
+	RES 6, (XHL)
+L1165:
+	CHG 5, W
+L1166:
+	CHG 1, L
+L1167:
+	RES 5, (XHL)
+L1168:
+	TSET 4, W
+L1169:
+	RES 3, H
+L1170:
+	BIT 3, W
+L1171:
+	CHG 2, L
+L1172:
+	SET 5, (XHL)
+L1173:
+	SET 2, W
+L1174:
+	BIT 0, (XHL)
+L1175:
+	SET 1, (XHL)
+L1176:
+	BIT 0, A
+L1177:
+	RES 7, D
+L1178:
+	TSET 2, B
+L1179:
+	SET 3, (XHL)
+L1180:
+	BIT 4, W
+L1181:
+	BIT 2, (XHL)
+L1182:
+	RES 6, B
+L1183:
+	BIT 4, B
+L1184:
+	RES 2, (XHL)
+L1185:
+	SET 0, (XHL)
+L1186:
+	SET 4, (XHL)
+L1187:
+	SET 7, (XHL)
+L1188:
+	SET 6, (XHL)
+L1189:
+	BIT 0, (XHL)
+L1190:
+	TSET 3, H
+L1191:
+	RES 5, B
+L1192:
+	BIT 0, H
+L1193:
+	TSET 0, A
+L1194:
+	SET 1, (XHL)
+L1195:
+	RES 5, (XHL)
+L1196:
+	TSET 5, B
+L1197:
+	RES 5, E
+L1198:
+	SET 4, (XHL)
+L1199:
+	RES 3, B
+L1200:
+	SET 0, (XHL)
+L1201:
+	CHG 3, D
+L1202:
+	BIT 5, D
+L1203:
+	RES 1, W
+L1204:
+	CHG 0, E
+L1205:
+	SET 3, C
+L1206:
+	SET 4, W
+L1207:
+	SET 5, (XHL)
+L1208:
+	RES 2, (XHL)
+L1209:
+	TSET 4, H
+L1210:
+	RES 2, (XHL)
+L1211:
+	TSET 3, E
+L1212:
+	CHG 2, L
+L1213:
+	BIT 4, (XHL)
+L1214:
+	TSET 5, H
+L1215:
+	SET 2, B
+L1216:
+	BIT 3, L
+L1217:
+	RES 4, (XHL)
+L1218:
+	CHG 2, B
+L1219:
+	RES 7, (XHL)
+L1220:
+	RES 6, (XHL)
+L1221:
+	BIT 0, W
+L1222:
+	SET 6, (XHL)
+L1223:
+	RES 2, (XHL)
+L1224:
+	TSET 3, B
+L1225:
+	RES 3, A
+L1226:
+	BIT 4, (XHL)
+L1227:
+	SET 4, (XHL)
+L1228:
+	BIT 7, H
+L1229:
+	BIT 4, (XHL)
+L1230:
+	BIT 5, (XHL)
+L1231:
+	BIT 3, (XHL)
+L1232:
+	SET 4, A
+L1233:
+	BIT 2, B
+L1234:
+	SET 6, (XHL)
+L1235:
+	CHG 4, H
+L1236:
+	RES 7, (XHL)
+L1237:
+	BIT 3, D
+L1238:
+	RES 0, (XHL)
+L1239:
+	CHG 0, W
+L1240:
+	SET 1, (XHL)
+L1241:
+	TSET 7, L
+L1242:
+	RES 4, H
+L1243:
+	BIT 6, (XHL)
+L1244:
+	TSET 4, W
+L1245:
+	SET 4, (XHL)
+L1246:
+	SET 4, (XHL)
+L1247:
+	SET 1, (XHL)
+L1248:
+	BIT 2, L
+L1249:
+	TSET 3, D
+L1250:
+	SET 6, (XHL)
+L1251:
+	RES 2, H
+L1252:
+	SET 6, (XHL)
+L1253:
+	SET 0, (XHL)
+L1254:
+	RES 3, (XHL)
+L1255:
+	RES 3, (XHL)
+L1256:
+	SET 1, C
+L1257:
+	BIT 7, (XHL)
+L1258:
+	SET 5, (XHL)
+L1259:
+	SET 2, (XHL)
+L1260:
+	BIT 5, B
+L1261:
+	CHG 2, L
+L1262:
+	SET 4, (XHL)
+L1263:
+	RES 0, B
+L1264:
+	RES 2, A
+L1265:
+	SET 6, H
+L1266:
+	SET 2, (XHL)
+L1267:
+	RES 0, L
+L1268:
+	SET 1, (XHL)
+L1269:
+	RES 1, E
+L1270:
+	BIT 1, (XHL)
+L1271:
+	RES 1, (XHL)
+L1272:
+	BIT 2, B
+L1273:
+	RES 4, (XHL)
+L1274:
+	SET 2, B
+L1275:
+	SET 3, (XHL)
+L1276:
+	TSET 2, H
+L1277:
+	SET 5, (XHL)
+L1278:
+	RES 3, (XHL)
+L1279:
+	CHG 0, B
+L1280:
+	CHG 1, B
+L1281:
+	RES 4, (XHL)
+L1282:
+	CHG 5, C
+L1283:
+	TSET 4, C
+L1284:
+	SET 2, (XHL)
+L1285:
+	BIT 3, E
+L1286:
+	RES 2, C
+L1287:
+	CHG 4, D
+L1288:
+	TSET 4, E
+L1289:
+	BIT 5, (XHL)
+L1290:
+	TSET 1, H
+L1291:
+	SET 7, C
+L1292:
+	RES 4, (XHL)
+L1293:
+	TSET 6, C
+L1294:
+	BIT 2, (XHL)
+L1295:
+	TSET 0, A
+L1296:
+	CHG 7, A
+L1297:
+	BIT 6, D
+L1298:
+	RES 2, (XHL)
+L1299:
+	TSET 3, A
+L1300:
+	BIT 2, W
+L1301:
+	BIT 3, (XHL)
+L1302:
+	BIT 5, (XHL)
+L1303:
+	CHG 6, B
+L1304:
+	SET 0, H
+L1305:
+	BIT 1, (XHL)
+L1306:
+	CHG 3, H
+L1307:
+	SET 7, (XHL)
+L1308:
+	BIT 1, C
+L1309:
+	BIT 0, (XHL)
+L1310:
+	TSET 3, A
+L1311:
+	SET 4, (XHL)
+L1312:
+	TSET 6, B
+L1313:
+	BIT 1, (XHL)
+L1314:
+	BIT 2, (XHL)
+L1315:
+	TSET 1, A
+L1316:
+	RES 6, E
+L1317:
+	SET 4, A
+L1318:
+	SET 1, (XHL)
+L1319:
+	BIT 0, (XHL)
+L1320:
+	SET 3, (XHL)
+L1321:
+	BIT 1, E
+L1322:
+	BIT 5, C
+L1323:
+	BIT 7, (XHL)
+L1324:
+	SET 7, D
+L1325:
+	BIT 3, D
+L1326:
+	RES 2, (XHL)
+L1327:
+	BIT 6, A
+L1328:
+	RES 7, (XHL)
+L1329:
+	BIT 0, (XHL)
+L1330:
+	SET 7, (XHL)
+L1331:
+	RES 6, (XHL)
+L1332:
+	RES 1, (XHL)
+L1333:
+	SET 4, (XHL)
+L1334:
+	RES 5, H
+L1335:
+	TSET 5, W
+L1336:
+	BIT 4, (XHL)
+L1337:
+	RES 1, (XHL)
+L1338:
+	RES 5, C
+L1339:
+	RES 7, (XHL)
+L1340:
+	SET 2, D
+L1341:
+	TSET 2, C
+L1342:
+	RES 1, (XHL)
+L1343:
+	BIT 5, (XHL)
+L1344:
+	SET 4, H
+L1345:
+	BIT 6, L
+L1346:
+	CHG 0, W
+L1347:
+	SET 1, A
+L1348:
+	BIT 2, (XHL)
+L1349:
+	TSET 0, B
+L1350:
+	CHG 5, W
+L1351:
+	SET 2, (XHL)
+L1352:
+	RES 4, (XHL)
+L1353:
+	BIT 3, H
+L1354:
+	BIT 4, A
+L1355:
+	BIT 3, (XHL)
+L1356:
+	CHG 0, W
+L1357:
+	BIT 7, W
+L1358:
+	BIT 5, (XHL)
+L1359:
+	SET 7, (XHL)
+L1360:
+	RES 0, (XHL)
+L1361:
+	SET 7, (XHL)
+L1362:
+	BIT 3, (XHL)
+L1363:
+	RES 4, (XHL)
+L1364:
+	BIT 0, A
+L1365:
+	SET 4, (XHL)
+L1366:
+	BIT 4, L
+L1367:
+	SET 6, (XHL)
+L1368:
+	SET 0, C
+L1369:
+	SET 5, (XHL)
+L1370:
+	BIT 3, (XHL)
+L1371:
+	SET 3, H
+L1372:
+	CHG 3, E
+L1373:
+	CHG 1, L
+L1374:
+	CHG 4, D
+L1375:
+	RES 7, C
+L1376:
+	CHG 2, B
+L1377:
+	RES 6, (XHL)
+L1378:
+	SET 0, (XHL)
+L1379:
+	CHG 1, B
+L1380:
+	BIT 1, (XHL)
+L1381:
+	CHG 2, W
+L1382:
+	SET 0, H
+L1383:
+	RES 0, (XHL)
+L1384:
+	CHG 4, W
+L1385:
+	SET 1, (XHL)
+L1386:
+	TSET 6, B
+L1387:
+	SET 1, A
+L1388:
+	BIT 1, (XHL)
+L1389:
+	RES 0, B
+L1390:
+	CHG 5, E
+L1391:
+	RES 0, L
+L1392:
+	SET 7, E
+L1393:
+	RES 1, E
+L1394:
+	SET 2, A
+L1395:
+	CHG 6, B
+L1396:
+	RES 5, D
+L1397:
+	SET 4, C
+L1398:
+	BIT 2, (XHL)
+L1399:
+	RES 4, (XHL)
+L1400:
+	BIT 4, (XHL)
+L1401:
+	RES 4, (XHL)
+L1402:
+	RES 0, C
+L1403:
+	CHG 7, W
+L1404:
+	CHG 0, A
+L1405:
+	SET 0, E
+L1406:
+	TSET 0, W
+L1407:
+	BIT 1, L
+L1408:
+	RES 3, (XHL)
+L1409:
+	BIT 1, (XHL)
+L1410:
+	BIT 6, (XHL)
+L1411:
+	RES 0, (XHL)
+L1412:
+	SET 6, (XHL)
+L1413:
+	RES 6, (XHL)
+L1414:
+	SET 0, (XHL)
+L1415:
+	SET 2, W
+L1416:
+	TSET 0, L
+L1417:
+	TSET 7, W
+L1418:
+	SET 5, H
+L1419:
+	RES 2, (XHL)
+L1420:
+	RES 1, H
+L1421:
+	BIT 4, (XHL)
+L1422:
+	BIT 0, (XHL)
+L1423:
+	BIT 0, (XHL)
+L1424:
+	RES 6, (XHL)
+L1425:
+	RES 1, H
+L1426:
+	RES 5, E
+L1427:
+	RES 7, (XHL)
+L1428:
+	SET 4, D
+L1429:
+	SET 3, (XHL)
+L1430:
+	SET 6, (XHL)
+L1431:
+	TSET 1, E
+L1432:
+	BIT 2, (XHL)
+L1433:
+	BIT 7, E
+L1434:
+	BIT 2, (XHL)
+L1435:
+	SET 6, (XHL)
+L1436:
+	TSET 5, H
+L1437:
+	RES 5, A
+L1438:
+	CHG 5, H
+L1439:
+	RES 1, (XHL)
+L1440:
+	RES 3, A
+L1441:
+	CHG 5, B
+L1442:
+	BIT 2, (XHL)
+L1443:
+	SET 6, (XHL)
+L1444:
+	SET 6, (XHL)
+L1445:
+	CHG 0, W
+L1446:
+	TSET 3, A
+L1447:
+	SET 4, (XHL)
+L1448:
+	RES 0, (XHL)
+L1449:
+	RES 5, (XHL)
+L1450:
+	RES 2, C
+L1451:
+	CHG 2, B
+L1452:
+	TSET 3, D
+L1453:
+	BIT 3, C
+L1454:
+	RES 6, (XHL)
+L1455:
+	RES 3, W
+L1456:
+	BIT 4, W
+L1457:
+	BIT 4, (XHL)
+L1458:
+	SET 0, (XHL)
+L1459:
+	RES 4, L
+L1460:
+	BIT 1, (XHL)
+L1461:
+	RES 2, A
+L1462:
+	SET 3, W
+L1463:
+	RES 6, (XHL)
+L1464:
+	SET 2, (XHL)
+L1465:
+	SET 5, W
+L1466:
+	SET 2, H
+L1467:
+	BIT 1, (XHL)
+L1468:
+	TSET 2, W
+L1469:
+	SET 0, B
+L1470:
+	SET 1, (XHL)
+L1471:
+	CHG 5, L
+L1472:
+	TSET 6, C
+L1473:
+	RES 1, (XHL)
+L1474:
+	RES 2, (XHL)
+L1475:
+	SET 1, (XHL)
+L1476:
+	BIT 7, (XHL)
+L1477:
+	TSET 0, H
+L1478:
+	BIT 2, (XHL)
+L1479:
+	RES 0, H
+L1480:
+	CHG 3, D
+L1481:
+	BIT 4, (XHL)
+L1482:
+	TSET 2, H
+L1483:
+	BIT 7, B
+L1484:
+	SET 4, (XHL)
+L1485:
+	CHG 7, D
+L1486:
+	BIT 5, (XHL)
+L1487:
+	RES 0, (XHL)
+L1488:
+	BIT 2, (XHL)
+L1489:
+	BIT 2, (XHL)
+L1490:
+	SET 6, E
+L1491:
+	SET 3, (XHL)
+L1492:
+	SET 3, B
+L1493:
+	SET 3, B
+L1494:
+	SET 5, (XHL)
+L1495:
+	SET 5, (XHL)
+L1496:
+	CHG 0, W
+L1497:
+	SET 0, (XHL)
+L1498:
+	TSET 5, L
+L1499:
+	SET 3, L
+L1500:
+	BIT 2, W
+L1501:
+	RES 3, (XHL)
+L1502:
+	CHG 5, W
+L1503:
+	SET 0, W
+L1504:
+	CHG 5, L
+L1505:
+	SET 6, (XHL)
+L1506:
+	TSET 3, E
+L1507:
+	BIT 2, (XHL)
+L1508:
+	RES 0, W
+L1509:
+	SET 4, C
+L1510:
+	SET 5, (XHL)
+L1511:
+	SET 1, (XHL)
+L1512:
+	BIT 5, L
+L1513:
+	SET 3, A
+L1514:
+	BIT 0, B
+L1515:
+	TSET 3, L
+L1516:
+	SET 7, (XHL)
+L1517:
+	RES 1, (XHL)
+L1518:
+	RES 2, (XHL)
+L1519:
+	RES 7, (XHL)
+L1520:
+	SET 5, (XHL)
+L1521:
+	BIT 5, E
+L1522:
+	RES 2, A
+L1523:
+	BIT 4, B
+L1524:
+	BIT 2, (XHL)
+L1525:
+	CHG 2, H
+L1526:
+	CHG 2, W
+L1527:
+	TSET 7, L
+L1528:
+	SET 3, (XHL)
+L1529:
+	RES 2, L
+L1530:
+	RES 6, (XHL)
+L1531:
+	RES 3, W
+L1532:
+	SET 7, (XHL)
+L1533:
+	RES 7, (XHL)
+L1534:
+	BIT 4, (XHL)
+L1535:
+	CHG 6, L
+L1536:
+	BIT 6, D
+L1537:
+	RES 5, E
+L1538:
+	BIT 7, (XHL)
+L1539:
+	BIT 3, (XHL)
+L1540:
+	TSET 5, H
+L1541:
+	BIT 3, (XHL)
+L1542:
+	TSET 7, C
+L1543:
+	SET 3, A
+L1544:
+	SET 0, (XHL)
+L1545:
+	BIT 6, C
+L1546:
+	RES 5, (XHL)
+L1547:
+	TSET 1, L
+L1548:
+	RES 0, (XHL)
+L1549:
+	RES 2, C
+L1550:
+	BIT 3, A
+L1551:
+	SET 5, (XHL)
+L1552:
+	RES 4, A
+L1553:
+	CHG 5, B
+L1554:
+	CHG 7, H
+L1555:
+	SET 6, B
+L1556:
+	SET 5, H
+L1557:
+	BIT 6, (XHL)
+L1558:
+	SET 3, (XHL)
+L1559:
+	RES 0, (XHL)
+L1560:
+	BIT 3, (XHL)
+L1561:
+	BIT 7, C
+L1562:
+	BIT 0, (XHL)
+L1563:
+	BIT 6, (XHL)
+L1564:
+	RES 0, H
+L1565:
+	BIT 0, E
+L1566:
+	RES 0, B
+L1567:
+	SET 4, (XHL)
+L1568:
+	CHG 3, H
+L1569:
+	SET 2, L
+L1570:
+	SET 5, A
+L1571:
+	BIT 7, (XHL)
+L1572:
+	BIT 5, (XHL)
+L1573:
+	SET 3, E
+L1574:
+	SET 0, (XHL)
+L1575:
+	TSET 5, B
+L1576:
+	RES 4, D
+L1577:
+	RES 7, C
+L1578:
+	BIT 1, (XHL)
+L1579:
+	BIT 3, A
+L1580:
+	RES 6, H
+L1581:
+	BIT 3, (XHL)
+L1582:
+	BIT 2, E
+L1583:
+	BIT 2, (XHL)
+L1584:
+	SET 2, A
+L1585:
+	SET 0, (XHL)
+L1586:
+	SET 2, (XHL)
+L1587:
+	BIT 7, (XHL)
+L1588:
+	SET 5, (XHL)
+L1589:
+	TSET 4, W
+L1590:
+	SET 3, D
+L1591:
+	SET 7, (XHL)
+L1592:
+	RES 4, (XHL)
+L1593:
+	SET 6, (XHL)
+L1594:
+	BIT 4, (XHL)
+L1595:
+	CHG 0, B
+L1596:
+	SET 1, (XHL)
+L1597:
+	RES 4, A
+L1598:
+	SET 7, (XHL)
+L1599:
+	SET 0, C
+L1600:
+	BIT 5, D
+L1601:
+	BIT 2, (XHL)
+L1602:
+	BIT 3, (XHL)
+L1603:
+	SET 6, (XHL)
+L1604:
+	SET 5, (XHL)
+L1605:
+	SET 2, A
+L1606:
+	SET 2, E
+L1607:
+	SET 4, (XHL)
+L1608:
+	RES 0, (XHL)
+L1609:
+	BIT 4, B
+L1610:
+	TSET 2, B
+L1611:
+	BIT 0, C
+L1612:
+	SET 7, (XHL)
+L1613:
+	RES 6, (XHL)
+L1614:
+	TSET 6, H
+L1615:
+	SET 2, C
+L1616:
+	CHG 4, W
+L1617:
+	RES 4, H
+L1618:
+	RES 4, (XHL)
+L1619:
+	BIT 4, (XHL)
+L1620:
+	RES 1, W
+L1621:
+	BIT 5, (XHL)
+L1622:
+	TSET 7, B
+L1623:
+	RES 1, (XHL)
+L1624:
+	RES 5, B
+L1625:
+	BIT 7, (XHL)
+L1626:
+	RES 1, (XHL)
+L1627:
+	BIT 7, (XHL)
+L1628:
+	SET 6, (XHL)
+L1629:
+	RES 4, E
+L1630:
+	SET 7, (XHL)
+L1631:
+	SET 1, (XHL)
+L1632:
+	RES 2, A
+L1633:
+	TSET 1, L
+L1634:
+	SET 6, (XHL)
+L1635:
+	SET 1, D
+L1636:
+	SET 6, (XHL)
+L1637:
+	BIT 2, (XHL)
+L1638:
+	BIT 6, C
+L1639:
+	SET 4, L
+L1640:
+	SET 3, C
+L1641:
+	TSET 4, W
+L1642:
+	BIT 5, B
+L1643:
+	BIT 6, A
+L1644:
+	SET 7, (XHL)
+L1645:
+	SET 4, B
+L1646:
+	TSET 0, L
+L1647:
+	SET 4, (XHL)
+L1648:
+	CHG 7, E
+L1649:
+	SET 2, D
+L1650:
+	RES 3, (XHL)
+L1651:
+	CHG 5, A
+L1652:
+	SET 2, (XHL)
+L1653:
+	BIT 1, H
+L1654:
+	SET 0, E
+L1655:
+	TSET 5, B
+L1656:
+	SET 3, H
+L1657:
+	CHG 7, B
+L1658:
+	RES 6, B
+L1659:
+	CHG 3, H
+L1660:
+	RES 3, (XHL)
+L1661:
+	SET 4, (XHL)
+L1662:
+	RES 6, E
+L1663:
+	RES 2, (XHL)
+L1664:
+	RES 3, (XHL)
+L1665:
+	BIT 2, (XHL)
+L1666:
+	BIT 7, D
+L1667:
+	RES 1, E
+L1668:
+	SET 1, (XHL)
+L1669:
+	TSET 4, H
+L1670:
+	SET 0, B
+L1671:
+	RES 4, C
+L1672:
+	BIT 2, B
+L1673:
+	BIT 1, (XHL)
+L1674:
+	BIT 0, B
+L1675:
+	CHG 6, B
+L1676:
+	RES 3, (XHL)
+L1677:
+	SET 5, W
+L1678:
+	BIT 3, (XHL)
+L1679:
+	RES 6, H
+L1680:
+	RES 3, (XHL)
+L1681:
+	BIT 3, (XHL)
+L1682:
+	SET 3, (XHL)
+L1683:
+	RES 3, W
+L1684:
+	TSET 6, H
+L1685:
+	BIT 3, L
+L1686:
+	CHG 3, H
+L1687:
+	SET 3, W
+L1688:
+	BIT 0, (XHL)
+L1689:
+	RES 1, (XHL)
+L1690:
+	SET 5, E
+L1691:
+	SET 0, D
+L1692:
+	SET 3, H
+L1693:
+	BIT 2, D
+L1694:
+	RES 3, (XHL)
+L1695:
+	TSET 6, D
+L1696:
+	RES 7, D
+L1697:
+	CHG 3, W
+L1698:
+	RES 5, (XHL)
+L1699:
+	RES 7, H
+L1700:
+	CHG 4, H
+L1701:
+	BIT 7, (XHL)
+L1702:
+	SET 7, (XHL)
+L1703:
+	TSET 4, H
+L1704:
+	SET 1, W
+L1705:
+	TSET 5, B
+L1706:
+	BIT 1, (XHL)
+L1707:
+	BIT 7, (XHL)
+L1708:
+	SET 2, A
+L1709:
+	CHG 0, A
+L1710:
+	RES 4, (XHL)
+L1711:
+	SET 4, C
+L1712:
+	CHG 0, H
+L1713:
+	BIT 2, L
+L1714:
+	SET 1, (XHL)
+L1715:
+	CHG 4, D
+L1716:
+	RES 3, (XHL)
+L1717:
+	BIT 2, (XHL)
+L1718:
+	SET 5, (XHL)
+L1719:
+	RES 6, (XHL)
+L1720:
+	RES 5, (XHL)
+L1721:
+	RES 4, D
+L1722:
+	SET 6, A
+L1723:
+	SET 5, E
+L1724:
+	BIT 1, A
+L1725:
+	RES 4, (XHL)
+L1726:
+	RES 1, (XHL)
+L1727:
+	SET 3, (XHL)
+L1728:
+	BIT 2, L
+L1729:
+	BIT 0, C
+L1730:
+	BIT 3, (XHL)
+L1731:
+	SET 7, (XHL)
+L1732:
+	TSET 1, C
+L1733:
+	BIT 3, (XHL)
+L1734:
+	TSET 4, W
+L1735:
+	BIT 3, (XHL)
+L1736:
+	RES 3, B
+L1737:
+	RES 1, (XHL)
+L1738:
+	BIT 6, (XHL)
+L1739:
+	BIT 5, C
+L1740:
+	RES 0, (XHL)
+L1741:
+	RES 3, (XHL)
+L1742:
+	SET 4, (XHL)
+L1743:
+	CHG 0, B
+L1744:
+	SET 1, (XHL)
+L1745:
+	SET 4, (XHL)
+L1746:
+	SET 1, (XHL)
+L1747:
+	CHG 6, C
+L1748:
+	RES 3, (XHL)
+L1749:
+	RES 5, (XHL)
+L1750:
+	BIT 6, C
+L1751:
+	BIT 6, (XHL)
+L1752:
+	TSET 6, B
+L1753:
+	BIT 6, H
+L1754:
+	BIT 5, (XHL)
+L1755:
+	BIT 6, (XHL)
+L1756:
+	TSET 5, D
+L1757:
+	TSET 5, C
+L1758:
+	BIT 3, (XHL)
+L1759:
+	BIT 2, (XHL)
+L1760:
+	RES 7, (XHL)
+L1761:
+	BIT 6, A
+L1762:
+	TSET 6, E
+L1763:
+	RES 4, (XHL)
+L1764:
+	SET 7, (XHL)
+L1765:
+	RES 4, E
+L1766:
+	RES 3, E
+L1767:
+	CHG 6, E
+L1768:
+	SET 5, C
+L1769:
+	BIT 2, (XHL)
+L1770:
+	TSET 2, H
+L1771:
+	BIT 1, (XHL)
+L1772:
+	SET 2, (XHL)
+L1773:
+	SET 7, (XHL)
+L1774:
+	TSET 1, E
+L1775:
+	BIT 6, (XHL)
+L1776:
+	TSET 5, E
+L1777:
+	SET 7, C
+L1778:
+	RES 5, A
+L1779:
+	BIT 0, (XHL)
+L1780:
+	BIT 6, (XHL)
+L1781:
+	SET 0, (XHL)
+L1782:
+	BIT 7, (XHL)
+L1783:
+	BIT 5, A
+L1784:
+	BIT 3, (XHL)
+L1785:
+	BIT 6, (XHL)
+L1786:
+	CHG 3, L
+L1787:
+	BIT 7, (XHL)
+L1788:
+	SET 3, E
+L1789:
+	BIT 6, B
+L1790:
+	RES 3, (XHL)
+L1791:
+	RES 2, (XHL)
+L1792:
+	BIT 4, (XHL)
+L1793:
+	RES 0, E
+L1794:
+	RES 4, (XHL)
+L1795:
+	SET 0, (XHL)
+L1796:
+	BIT 0, (XHL)
+L1797:
+	SET 5, (XHL)
+L1798:
+	RES 2, L
+L1799:
+	SET 4, (XHL)
+L1800:
+	RES 0, (XHL)
+L1801:
+	SET 5, D
+L1802:
+	CHG 5, C
+L1803:
+	SET 7, (XHL)
+L1804:
+	BIT 4, (XHL)
+L1805:
+	RES 6, (XHL)
+L1806:
+	SET 0, H
+L1807:
+	BIT 3, (XHL)
+L1808:
+	BIT 0, W
+L1809:
+	TSET 7, D
+L1810:
+	BIT 6, (XHL)
+L1811:
+	SET 7, L
+L1812:
+	RES 7, L
+L1813:
+	SET 3, (XHL)
+L1814:
+	BIT 2, (XHL)
+L1815:
+	TSET 2, A
+L1816:
+	SET 5, (XHL)
+L1817:
+	CHG 1, L
+L1818:
+	TSET 2, D
+L1819:
+	RES 0, C
+L1820:
+	BIT 6, L
+L1821:
+	RES 1, H
+L1822:
+	SET 0, (XHL)
+L1823:
+	CHG 6, C
+L1824:
+	BIT 0, (XHL)
+L1825:
+	BIT 2, A
+L1826:
+	SET 5, C
+L1827:
+	BIT 6, (XHL)
+L1828:
+	BIT 0, (XHL)
+L1829:
+	CHG 2, L
+L1830:
+	RES 3, (XHL)
+L1831:
+	RES 0, (XHL)
+L1832:
+	BIT 2, (XHL)
+L1833:
+	TSET 5, L
+L1834:
+	BIT 0, (XHL)
+L1835:
+	BIT 1, E
+L1836:
+	BIT 1, (XHL)
+L1837:
+	BIT 1, (XHL)
+L1838:
+	RES 6, (XHL)
+L1839:
+	RES 2, (XHL)
+L1840:
+	SET 1, B
+L1841:
+	CHG 6, D
+L1842:
+	RES 4, (XHL)
+L1843:
+	BIT 2, (XHL)
+L1844:
+	BIT 3, (XHL)
+L1845:
+	TSET 4, E
+L1846:
+	SET 1, L
+L1847:
+	SET 6, (XHL)
+L1848:
+	BIT 0, (XHL)
+L1849:
+	RES 6, B
+L1850:
+	BIT 6, (XHL)
+L1851:
+	SET 0, (XHL)
+L1852:
+	CHG 5, W
+L1853:
+	BIT 7, A
+L1854:
+	BIT 4, (XHL)
+L1855:
+	RES 0, (XHL)
+L1856:
+	RES 1, E
+L1857:
+	SET 5, (XHL)
+L1858:
+	RES 5, E
+L1859:
+	SET 3, (XHL)
+L1860:
+	RES 2, D
+L1861:
+	BIT 1, E
+L1862:
+	RES 5, (XHL)
+L1863:
+	CHG 7, A
+L1864:
+	RES 0, D
+L1865:
+	RES 1, A
+L1866:
+	RES 0, (XHL)
+L1867:
+	RES 0, W
+L1868:
+	SET 0, H
+L1869:
+	RES 2, (XHL)
+L1870:
+	RES 6, (XHL)
+L1871:
+	CHG 0, A
+L1872:
+	BIT 6, (XHL)
+L1873:
+	BIT 1, (XHL)
+L1874:
+	RES 4, E
+L1875:
+	BIT 1, (XHL)
+L1876:
+	SET 7, W
+L1877:
+	BIT 0, (XHL)
+L1878:
+	SET 2, (XHL)
+L1879:
+	SET 4, B
+L1880:
+	BIT 4, W
+L1881:
+	BIT 5, C
+L1882:
+	RES 5, (XHL)
+L1883:
+	RES 3, C
+L1884:
+	TSET 4, A
+L1885:
+	BIT 6, (XHL)
+L1886:
+	SET 7, (XHL)
+L1887:
+	SET 5, (XHL)
+L1888:
+	SET 1, W
+L1889:
+	SET 7, (XHL)
+L1890:
+	BIT 6, (XHL)
+L1891:
+	SET 1, (XHL)
+L1892:
+	TSET 2, D
+L1893:
+	BIT 2, H
+L1894:
+	RES 0, (XHL)
+L1895:
+	RES 0, (XHL)
+L1896:
+	SET 7, H
+L1897:
+	RES 5, (XHL)
+L1898:
+	BIT 2, (XHL)
+L1899:
+	BIT 2, E
+L1900:
+	SET 3, (XHL)
+L1901:
+	TSET 5, B
+L1902:
+	BIT 7, (XHL)
+L1903:
+	SET 4, (XHL)
+L1904:
+	RES 6, (XHL)
+L1905:
+	RES 2, L
+L1906:
+	BIT 0, (XHL)
+L1907:
+	RES 6, (XHL)
+L1908:
+	BIT 3, (XHL)
+L1909:
+	SET 1, C
+L1910:
+	RES 7, D
+L1911:
+	SET 3, D
+L1912:
+	SET 5, B
+L1913:
+	TSET 2, D
+L1914:
+	TSET 1, A
+L1915:
+	RES 5, D
+L1916:
+	SET 1, L
+L1917:
+	RES 1, (XHL)
+L1918:
+	TSET 6, H
+L1919:
+	CHG 2, C
+L1920:
+	SET 1, W
+L1921:
+	RES 4, E
+L1922:
+	TSET 7, H
+L1923:
+	SET 5, (XHL)
+L1924:
+	RES 0, (XHL)
+L1925:
+	RES 2, (XHL)
+L1926:
+	SET 0, (XHL)
+L1927:
+	RES 3, (XHL)
+L1928:
+	SET 0, (XHL)
+L1929:
+	SET 1, (XHL)
+L1930:
+	TSET 6, D
+L1931:
+	RES 3, (XHL)
+L1932:
+	BIT 0, (XHL)
+L1933:
+	BIT 4, (XHL)
+L1934:
+	SET 4, L
+L1935:
+	BIT 4, W
+L1936:
+	RES 5, (XHL)
+L1937:
+	BIT 2, (XHL)
+L1938:
+	CHG 5, H
+L1939:
+	RES 7, C
+L1940:
+	SET 0, (XHL)
+L1941:
+	RES 1, W
+L1942:
+	SET 4, (XHL)
+L1943:
+	SET 1, E
+L1944:
+	RES 2, (XHL)
+L1945:
+	SET 2, C
+L1946:
+	SET 0, (XHL)
+L1947:
+	BIT 1, (XHL)
+L1948:
+	RES 2, (XHL)
+L1949:
+	SET 4, (XHL)
+L1950:
+	CHG 4, W
+L1951:
+	TSET 2, B
+L1952:
+	BIT 3, B
+L1953:
+	TSET 3, L
+L1954:
+	CHG 0, W
+L1955:
+	CHG 6, E
+L1956:
+	BIT 0, D
+L1957:
+	BIT 6, (XHL)
+L1958:
+	BIT 2, W
+L1959:
+	BIT 2, (XHL)
+L1960:
+	BIT 5, (XHL)
+L1961:
+	SET 7, (XHL)
+L1962:
+	SET 6, B
+L1963:
+	BIT 5, (XHL)
+L1964:
+	RES 5, E
+L1965:
+	RES 2, D
+L1966:
+	RES 5, (XHL)
+L1967:
+	CHG 0, L
+L1968:
+	SET 5, L
+L1969:
+	BIT 5, D
+L1970:
+	BIT 6, (XHL)
+L1971:
+	SET 4, E
+L1972:
+	BIT 0, (XHL)
+L1973:
+	BIT 3, L
+L1974:
+	SET 0, L
+L1975:
+	BIT 1, A
+L1976:
+	BIT 3, (XHL)
+L1977:
+	BIT 7, B
+L1978:
+	CHG 7, B
+L1979:
+	BIT 2, (XHL)
+L1980:
+	RES 2, (XHL)
+L1981:
+	TSET 4, A
+L1982:
+	TSET 5, H
+L1983:
+	BIT 2, H
+L1984:
+	SET 6, H
+L1985:
+	BIT 0, (XHL)
+L1986:
+	RES 1, (XHL)
+L1987:
+	SET 0, D
+L1988:
+	SET 0, W
+L1989:
+	RES 1, (XHL)
+L1990:
+	RES 5, (XHL)
+L1991:
+	BIT 3, (XHL)
+L1992:
+	CHG 6, L
+L1993:
+	RES 7, (XHL)
+L1994:
+	SET 0, (XHL)
+L1995:
+	TSET 0, E
+L1996:
+	BIT 7, E
+L1997:
+	BIT 6, D
+L1998:
+	TSET 3, A
+L1999:
+	RES 2, C
+L2000:
+	SET 6, B
+L2001:
+	RES 7, A
+L2002:
+	TSET 4, A
+L2003:
+	CHG 5, B
+L2004:
+	RES 7, (XHL)
+L2005:
+	SET 5, (XHL)
+L2006:
+	TSET 7, C
+L2007:
+	SET 3, E
+L2008:
+	BIT 5, (XHL)
+L2009:
+	BIT 3, (XHL)
+L2010:
+	RES 5, (XHL)
+L2011:
+	TSET 5, W
+L2012:
+	BIT 4, (XHL)
+L2013:
+	BIT 4, E
+L2014:
+	BIT 2, B
+L2015:
+	BIT 1, (XHL)
+L2016:
+	RES 5, (XHL)
+L2017:
+	BIT 2, B
+L2018:
+	RES 5, W
+L2019:
+	BIT 3, A
+L2020:
+	SET 6, (XHL)
+L2021:
+	BIT 4, (XHL)
+L2022:
+	BIT 4, D
+L2023:
+	RES 4, (XHL)
+L2024:
+	SET 1, (XHL)
+L2025:
+	RES 0, (XHL)
+L2026:
+	BIT 3, (XHL)
+L2027:
+	RES 6, (XHL)
+L2028:
+	RES 1, W
+L2029:
+	RES 2, (XHL)
+L2030:
+	TSET 2, L
+L2031:
+	BIT 1, (XHL)
+L2032:
+	RES 7, (XHL)
+L2033:
+	BIT 5, L
+L2034:
+	SET 0, A
+L2035:
+	BIT 2, L
+L2036:
+	RES 4, (XHL)
+L2037:
+	BIT 2, A
+L2038:
+	TSET 7, C
+L2039:
+	SET 2, (XHL)
+L2040:
+	TSET 4, C
+L2041:
+	SET 1, A
+L2042:
+	SET 5, (XHL)
+L2043:
+	BIT 0, (XHL)
+L2044:
+	SET 6, E
+L2045:
+	BIT 6, E
+L2046:
+	TSET 2, W
+L2047:
+	RES 1, D
+L2048:
+	BIT 2, (XHL)
+L2049:
+	RES 5, D
+L2050:
+	RES 3, (XHL)
+L2051:
+	BIT 2, L
+L2052:
+	TSET 4, H
+L2053:
+	SET 3, (XHL)
+L2054:
+	BIT 7, (XHL)
+L2055:
+	SET 5, (XHL)
+L2056:
+	RES 6, B
+L2057:
+	SET 7, W
+L2058:
+	BIT 2, D
+L2059:
+	BIT 0, (XHL)
+L2060:
+	RES 1, (XHL)
+L2061:
+	BIT 5, D
+L2062:
+	BIT 2, (XHL)
+L2063:
+	BIT 4, D
+L2064:
+	SET 6, (XHL)
+L2065:
+	RES 4, (XHL)
+L2066:
+	BIT 0, (XHL)
+L2067:
+	RES 6, (XHL)
+L2068:
+	CHG 1, H
+L2069:
+	SET 1, W
+L2070:
+	BIT 4, (XHL)
+L2071:
+	SET 3, (XHL)
+L2072:
+	SET 6, (XHL)
+L2073:
+	SET 7, (XHL)
+L2074:
+	BIT 0, (XHL)
+L2075:
+	SET 6, C
+L2076:
+	CHG 7, B
+L2077:
+	RES 2, (XHL)
+L2078:
+	SET 1, (XHL)
+L2079:
+	CHG 4, D
+L2080:
+	RES 6, H
+L2081:
+	BIT 6, (XHL)
+L2082:
+	CHG 4, E
+L2083:
+	SET 4, (XHL)
+L2084:
+	BIT 4, B
+L2085:
+	SET 4, L
+L2086:
+	BIT 6, (XHL)
+L2087:
+	CHG 2, L
+L2088:
+	RES 5, (XHL)
+L2089:
+	CHG 6, A
+L2090:
+	TSET 6, C
+L2091:
+	CHG 3, B
+L2092:
+	SET 7, (XHL)
+L2093:
+	SET 1, (XHL)
+L2094:
+	RES 3, (XHL)
+L2095:
+	BIT 2, (XHL)
+L2096:
+	RES 6, A
+L2097:
+	BIT 4, L
+L2098:
+	TSET 4, H
+L2099:
+	RES 4, (XHL)
+L2100:
+	TSET 4, E
+L2101:
+	SET 2, H
+L2102:
+	SET 1, B
+L2103:
+	RES 3, (XHL)
+L2104:
+	SET 5, (XHL)
+L2105:
+	SET 3, B
+L2106:
+	SET 2, B
+L2107:
+	RES 5, (XHL)
+L2108:
+	TSET 5, H
+L2109:
+	BIT 5, E
+L2110:
+	TSET 7, D
+L2111:
+	RES 6, (XHL)
+L2112:
+	SET 3, (XHL)
+L2113:
+	SET 7, (XHL)
+L2114:
+	BIT 0, (XHL)
+L2115:
+	BIT 7, (XHL)
+L2116:
+	BIT 6, (XHL)
+L2117:
+	RES 6, (XHL)
+L2118:
+	SET 6, (XHL)
+L2119:
+	RES 5, A
+L2120:
+	BIT 5, (XHL)
+L2121:
+	CHG 7, D
+L2122:
+	RES 0, (XHL)
+L2123:
+	CHG 4, L
+L2124:
+	CHG 7, L
+L2125:
+	BIT 2, (XHL)
+L2126:
+	SET 1, (XHL)
+L2127:
+	BIT 4, (XHL)
+L2128:
+	TSET 4, H
+L2129:
+	BIT 5, (XHL)
+L2130:
+	RES 3, (XHL)
+L2131:
+	SET 0, (XHL)
+L2132:
+	RES 7, B
+L2133:
+	SET 1, (XHL)
+L2134:
+	RES 4, (XHL)
+L2135:
+	RES 0, (XHL)
+L2136:
+	BIT 0, C
+L2137:
+	RES 2, E
+L2138:
+	SET 6, (XHL)
+L2139:
+	BIT 1, B
+L2140:
+	SET 3, (XHL)
+L2141:
+	RES 1, (XHL)
+L2142:
+	CHG 2, B
+L2143:
+	SET 1, (XHL)
+L2144:
+	RES 2, (XHL)
+L2145:
+	BIT 2, (XHL)
+L2146:
+	SET 0, (XHL)
+L2147:
+	SET 1, (XHL)
+L2148:
+	RES 7, (XHL)
+L2149:
+	RES 2, A
+L2150:
+	RES 7, (XHL)
+L2151:
+	BIT 5, (XHL)
+L2152:
+	SET 2, H
+L2153:
+	CHG 4, H
+L2154:
+	SET 6, (XHL)
+L2155:
+	SET 5, (XHL)
+L2156:
+	RES 7, (XHL)
+L2157:
+	CHG 0, W
+L2158:
+	RES 1, (XHL)
+L2159:
+	BIT 2, (XHL)
+L2160:
+	TSET 3, A
+L2161:
+	RES 7, W
+L2162:
+	CHG 5, D
+L2163:
+	RES 0, (XHL)
+L2164:
+	CHG 4, W
+L2165:
+	RES 3, (XHL)
+L2166:
+	SET 2, E
+L2167:
+	BIT 6, (XHL)
+L2168:
+	RES 4, H
+L2169:
+	RES 5, (XHL)
+L2170:
+	SET 5, (XHL)
+L2171:
+	BIT 3, (XHL)
+L2172:
+	BIT 5, H
+L2173:
+	SET 6, E
+L2174:
+	SET 5, (XHL)
+L2175:
+	RES 5, (XHL)
+L2176:
+	BIT 7, (XHL)
+L2177:
+	CHG 5, A
+L2178:
+	BIT 0, (XHL)
+L2179:
+	BIT 5, (XHL)
+L2180:
+	RES 2, (XHL)
+L2181:
+	BIT 7, (XHL)
+L2182:
+	SET 5, (XHL)
+L2183:
+	RES 2, D
+L2184:
+	RES 0, (XHL)
+L2185:
+	CHG 1, H
+L2186:
+	SET 0, (XHL)
+L2187:
+	SET 1, (XHL)
+L2188:
+	RES 0, (XHL)
+L2189:
+	SET 3, (XHL)
+L2190:
+	SET 4, W
+L2191:
+	SET 3, (XHL)
+L2192:
+	TSET 2, B
+L2193:
+	BIT 1, D
+L2194:
+	CHG 6, E
+L2195:
+	BIT 6, D
+L2196:
+	RES 3, (XHL)
+L2197:
+	SET 0, (XHL)
+L2198:
+	SET 2, B
+L2199:
+	CHG 4, L
+L2200:
+	BIT 2, (XHL)
+L2201:
+	BIT 0, (XHL)
+L2202:
+	RES 4, E
+L2203:
+	BIT 6, (XHL)
+L2204:
+	BIT 4, (XHL)
+L2205:
+	SET 5, (XHL)
+L2206:
+	RES 5, (XHL)
+L2207:
+	SET 0, (XHL)
+L2208:
+	SET 0, E
+L2209:
+	SET 7, A
+L2210:
+	CHG 1, L
+L2211:
+	BIT 7, (XHL)
+L2212:
+	CHG 6, C
+L2213:
+	RES 1, (XHL)
+L2214:
+	RES 7, (XHL)
+L2215:
+	SET 7, (XHL)
+L2216:
+	TSET 7, B
+L2217:
+	RES 7, W
+L2218:
+	CHG 5, W
+L2219:
+	RES 6, (XHL)
+L2220:
+	BIT 2, (XHL)
+L2221:
+	TSET 0, A
+L2222:
+	TSET 4, H
+L2223:
+	RES 4, (XHL)
+L2224:
+	BIT 2, (XHL)
+L2225:
+	BIT 4, (XHL)
+L2226:
+	TSET 3, D
+L2227:
+	RES 7, (XHL)
+L2228:
+	BIT 2, (XHL)
+L2229:
+	SET 2, D
+L2230:
+	CHG 5, W
+L2231:
+	SET 0, (XHL)
+L2232:
+	BIT 1, (XHL)
+L2233:
+	TSET 5, B
+L2234:
+	SET 4, (XHL)
+L2235:
+	SET 1, L
+L2236:
+	SET 6, (XHL)
+L2237:
+	SET 1, (XHL)
+L2238:
+	SET 2, (XHL)
+L2239:
+	SET 2, (XHL)
+L2240:
+	CHG 1, C
+L2241:
+	BIT 3, (XHL)
+L2242:
+	BIT 1, A
+L2243:
+	SET 4, L
+L2244:
+	SET 4, (XHL)
+L2245:
+	RES 1, (XHL)
+L2246:
+	BIT 1, (XHL)
+L2247:
+	SET 2, E
+L2248:
+	TSET 0, E
+L2249:
+	BIT 6, (XHL)
+L2250:
+	SET 2, (XHL)
+L2251:
+	BIT 5, (XHL)
+L2252:
+	BIT 2, (XHL)
+L2253:
+	TSET 0, D
+L2254:
+	RES 1, (XHL)
+L2255:
+	SET 2, B
+L2256:
+	RES 1, (XHL)
+L2257:
+	RES 7, (XHL)
+L2258:
+	TSET 5, H
+L2259:
+	BIT 6, (XHL)
+L2260:
+	CHG 5, B
+L2261:
+	TSET 7, D
+L2262:
+	RES 7, (XHL)
+L2263:
+	SET 6, (XHL)
+L2264:
+	RES 2, (XHL)
+L2265:
+	TSET 2, A
+L2266:
+	RES 0, (XHL)
+L2267:
+	RES 2, (XHL)
+L2268:
+	RES 3, (XHL)
+L2269:
+	SET 6, (XHL)
+L2270:
+	SET 5, (XHL)
+L2271:
+	RES 4, (XHL)
+L2272:
+	SET 3, (XHL)
+L2273:
+	RES 4, (XHL)
+L2274:
+	SET 3, (XHL)
+L2275:
+	SET 6, (XHL)
+L2276:
+	BIT 2, (XHL)
+L2277:
+	CHG 2, B
+L2278:
+	RES 4, (XHL)
+L2279:
+	BIT 4, (XHL)
+L2280:
+	RES 0, (XHL)
+L2281:
+	SET 2, (XHL)
+L2282:
+	CHG 1, A
+L2283:
+	BIT 3, A
+L2284:
+	CHG 3, C
+L2285:
+	RES 3, A
+L2286:
+	BIT 3, D
+L2287:
+	SET 2, (XHL)
+L2288:
+	BIT 3, (XHL)
+L2289:
+	RES 1, (XHL)
+L2290:
+	TSET 5, A
+L2291:
+	SET 5, H
+L2292:
+	CHG 3, D
+L2293:
+	BIT 7, (XHL)
+L2294:
+	RES 6, (XHL)
+L2295:
+	BIT 0, (XHL)
+L2296:
+	RES 1, E
+L2297:
+	SET 5, W
+L2298:
+	BIT 6, (XHL)
+L2299:
+	SET 6, A
+L2300:
+	RES 5, W
+L2301:
+	RES 3, D
+L2302:
+	TSET 1, L
+L2303:
+	BIT 5, D
+L2304:
+	TSET 3, C
+L2305:
+	BIT 2, (XHL)
+L2306:
+	RES 1, W
+L2307:
+	BIT 0, (XHL)
+L2308:
+	SET 5, D
+L2309:
+	RES 5, L
+L2310:
+	TSET 0, E
+L2311:
+	RES 7, H
+L2312:
+	BIT 7, (XHL)
+L2313:
+	BIT 6, B
+L2314:
+	RES 7, (XHL)
+L2315:
+	RES 1, (XHL)
+L2316:
+	SET 4, (XHL)
+L2317:
+	RES 6, (XHL)
+L2318:
+	RES 4, (XHL)
+L2319:
+	TSET 4, D
+L2320:
+	RES 6, (XHL)
+L2321:
+	RES 2, L
+L2322:
+	RES 7, H
+L2323:
+	RES 3, W
+L2324:
+	CHG 5, D
+L2325:
+	RES 2, (XHL)
+L2326:
+	RES 4, (XHL)
+L2327:
+	BIT 6, (XHL)
+L2328:
+	RES 1, (XHL)
+L2329:
+	BIT 2, (XHL)
+L2330:
+	RES 6, (XHL)
+L2331:
+	RES 3, (XHL)
+L2332:
+	BIT 5, (XHL)
+L2333:
+	RES 1, (XHL)
+L2334:
+	BIT 4, (XHL)
+L2335:
+	CHG 4, L
+L2336:
+	TSET 7, L
+L2337:
+	BIT 6, (XHL)
+L2338:
+	SET 0, (XHL)
+L2339:
+	BIT 1, D
+L2340:
+	SET 3, H
+L2341:
+	SET 7, (XHL)
+L2342:
+	SET 7, (XHL)
+L2343:
+	SET 0, (XHL)
+L2344:
+	SET 0, C
+L2345:
+	SET 1, (XHL)
+L2346:
+	TSET 0, D
+L2347:
+	RES 6, L
+L2348:
+	BIT 4, (XHL)
+L2349:
+	SET 1, H
+L2350:
+	BIT 2, (XHL)
+L2351:
+	RES 5, W
+L2352:
+	CHG 7, D
+L2353:
+	BIT 3, (XHL)
+L2354:
+	SET 0, D
+L2355:
+	BIT 3, A
+L2356:
+	BIT 2, (XHL)
+L2357:
+	TSET 5, C
+L2358:
+	BIT 7, D
+L2359:
+	BIT 4, W
+L2360:
+	SET 7, (XHL)
+L2361:
+	SET 5, C
+L2362:
+	RES 2, B
+L2363:
+	BIT 2, E
+L2364:
+	RES 7, W
+L2365:
+	SET 6, W
+L2366:
+	RES 4, (XHL)
+L2367:
+	BIT 2, D
+L2368:
+	SET 0, (XHL)
+L2369:
+	BIT 1, (XHL)
+L2370:
+	RES 2, C
+L2371:
+	RES 6, (XHL)
+L2372:
+	SET 6, L
+L2373:
+	BIT 5, (XHL)
+L2374:
+	SET 6, (XHL)
+L2375:
+	BIT 7, (XHL)
+L2376:
+	SET 3, H
+L2377:
+	BIT 3, (XHL)
+L2378:
+	RES 1, C
+L2379:
+	RES 4, (XHL)
+L2380:
+	TSET 2, L
+L2381:
+	RES 5, C
+L2382:
+	RES 4, L
+L2383:
+	BIT 5, (XHL)
+L2384:
+	RES 6, (XHL)
+L2385:
+	CHG 6, C
+L2386:
+	SET 2, (XHL)
+L2387:
+	TSET 4, C
+L2388:
+	SET 3, (XHL)
+L2389:
+	RES 2, (XHL)
+L2390:
+	BIT 5, C
+L2391:
+	CHG 3, B
+L2392:
+	SET 5, W
+L2393:
+	CHG 0, E
+L2394:
+	BIT 6, (XHL)
+L2395:
+	TSET 4, A
+L2396:
+	RES 3, W
+L2397:
+	TSET 3, B
+L2398:
+	BIT 0, E
+L2399:
+	CHG 6, W
+L2400:
+	BIT 2, (XHL)
+L2401:
+	RES 5, W
+L2402:
+	RES 4, (XHL)
+L2403:
+	SET 4, B
+L2404:
+	BIT 3, (XHL)
+L2405:
+	SET 6, (XHL)
+L2406:
+	SET 3, (XHL)
+L2407:
+	SET 6, (XHL)
+L2408:
+	CHG 6, B
+L2409:
+	SET 1, H
+L2410:
+	BIT 4, (XHL)
+L2411:
+	RES 2, (XHL)
+L2412:
+	RES 5, (XHL)
+L2413:
+	BIT 6, (XHL)
+L2414:
+	BIT 1, W
+L2415:
+	RES 1, (XHL)
+L2416:
+	TSET 7, D
+L2417:
+	TSET 1, W
+L2418:
+	RES 4, E
+L2419:
+	SET 3, H
+L2420:
+	SET 2, (XHL)
+L2421:
+	BIT 7, A
+L2422:
+	RES 4, B
+L2423:
+	RES 3, C
+L2424:
+	RES 7, B
+L2425:
+	SET 7, (XHL)
+L2426:
+	SET 2, L
+L2427:
+	CHG 7, W
+L2428:
+	BIT 5, H
+L2429:
+	RES 7, (XHL)
+L2430:
+	RES 4, (XHL)
+L2431:
+	RES 6, (XHL)
+L2432:
+	CHG 7, W
+L2433:
+	BIT 6, C
+L2434:
+	CHG 3, L
+L2435:
+	RES 4, (XHL)
+L2436:
+	BIT 2, A
+L2437:
+	RES 1, E
+L2438:
+	SET 3, (XHL)
+L2439:
+	RES 4, (XHL)
+L2440:
+	TSET 4, B
+L2441:
+	BIT 0, L
+L2442:
+	BIT 4, H
+L2443:
+	RES 1, A
+L2444:
+	BIT 7, (XHL)
+L2445:
+	RES 2, H
+L2446:
+	RES 3, (XHL)
+L2447:
+	SET 1, D
+L2448:
+	BIT 0, (XHL)
+L2449:
+	CHG 3, L
+L2450:
+	BIT 7, (XHL)
+L2451:
+	TSET 1, E
+L2452:
+	RES 2, L
+L2453:
+	BIT 6, (XHL)
+L2454:
+	BIT 0, (XHL)
+L2455:
+	SET 0, B
+L2456:
+	RES 2, W
+L2457:
+	SET 0, (XHL)
+L2458:
+	RES 6, (XHL)
+L2459:
+	TSET 3, W
+L2460:
+	BIT 2, (XHL)
+L2461:
+	SET 6, (XHL)
+L2462:
+	RES 7, W
+L2463:
+	RES 5, (XHL)
+L2464:
+	CHG 7, A
+L2465:
+	BIT 6, (XHL)
+L2466:
+	SET 5, (XHL)
+L2467:
+	RES 0, (XHL)
+L2468:
+	CHG 0, C
+L2469:
+	TSET 3, E
+L2470:
+	RES 2, (XHL)
+L2471:
+	RES 0, (XHL)
+L2472:
+	TSET 4, H
+L2473:
+	RES 5, E
+L2474:
+	RES 6, (XHL)
+L2475:
+	BIT 0, D
+L2476:
+	SET 2, (XHL)
+L2477:
+	RES 6, L
+L2478:
+	BIT 3, (XHL)
+L2479:
+	BIT 2, (XHL)
+L2480:
+	CHG 5, H
+L2481:
+	SET 2, (XHL)
+L2482:
+	RES 4, (XHL)
+L2483:
+	SET 3, A
+L2484:
+	BIT 3, (XHL)
+L2485:
+	TSET 5, C
+L2486:
+	RES 5, (XHL)
+L2487:
+	SET 3, (XHL)
+L2488:
+	BIT 0, (XHL)
+L2489:
+	SET 7, (XHL)
+L2490:
+	BIT 1, (XHL)
+L2491:
+	TSET 5, H
+L2492:
+	SET 5, (XHL)
+L2493:
+	CHG 0, E
+L2494:
+	CHG 1, D
+L2495:
+	SET 1, (XHL)
+L2496:
+	RES 0, (XHL)
+L2497:
+	CHG 7, W
+L2498:
+	SET 1, (XHL)
+L2499:
+	SET 7, H
+L2500:
+	SET 5, (XHL)
+L2501:
+	TSET 2, W
+L2502:
+	BIT 5, (XHL)
+L2503:
+	BIT 5, (XHL)
+L2504:
+	BIT 5, A
+L2505:
+	CHG 6, C
+L2506:
+	BIT 7, (XHL)
+L2507:
+	SET 7, (XHL)
+L2508:
+	BIT 2, (XHL)
+L2509:
+	SET 6, L
+L2510:
+	SET 7, (XHL)
+L2511:
+	TSET 0, E
+L2512:
+	SET 1, (XHL)
+L2513:
+	SET 1, D
+L2514:
+	SET 2, W
+L2515:
+	TSET 5, W
+L2516:
+	BIT 7, (XHL)
+L2517:
+	SET 2, C
+L2518:
+	BIT 6, H
+L2519:
+	BIT 3, (XHL)
+L2520:
+	BIT 7, D
+L2521:
+	BIT 2, (XHL)
+L2522:
+	RES 7, (XHL)
+L2523:
+	RES 1, (XHL)
+L2524:
+	SET 4, L
+L2525:
+	BIT 5, (XHL)
+L2526:
+	TSET 4, L
+L2527:
+	BIT 3, (XHL)
+L2528:
+	SET 5, (XHL)
+L2529:
+	RES 2, (XHL)
+L2530:
+	SET 6, A
+L2531:
+	RES 1, L
+L2532:
+	SET 5, (XHL)
+L2533:
+	BIT 1, C
+L2534:
+	RES 3, (XHL)
+L2535:
+	RES 4, D
+L2536:
+	SET 0, (XHL)
+L2537:
+	BIT 3, (XHL)
+L2538:
+	BIT 4, E
+L2539:
+	SET 1, (XHL)
+L2540:
+	BIT 3, H
+L2541:
+	SET 0, L
+L2542:
+	RES 6, (XHL)
+L2543:
+	SET 5, (XHL)
+L2544:
+	SET 7, (XHL)
+L2545:
+	RES 5, D
+L2546:
+	CHG 3, E
+L2547:
+	RES 4, L
+L2548:
+	TSET 7, A
+L2549:
+	RES 7, (XHL)
+L2550:
+	SET 5, (XHL)
+L2551:
+	BIT 0, (XHL)
+L2552:
+	RES 4, (XHL)
+L2553:
+	RES 2, (XHL)
+L2554:
+	SET 3, (XHL)
+L2555:
+	RES 6, E
+L2556:
+	BIT 0, (XHL)
+L2557:
+	CHG 1, H
+L2558:
+	RES 2, (XHL)
+L2559:
+	RES 1, (XHL)
+L2560:
+	SET 6, (XHL)
+L2561:
+	BIT 0, (XHL)
+L2562:
+	BIT 7, (XHL)
+L2563:
+	TSET 5, C
+L2564:
+	CHG 3, L
+L2565:
+	SET 7, B
+L2566:
+	SET 6, (XHL)
+L2567:
+	SET 1, (XHL)
+L2568:
+	SET 2, (XHL)
+L2569:
+	SET 5, A
+L2570:
+	RES 7, (XHL)
+L2571:
+	RES 6, E
+L2572:
+	BIT 0, (XHL)
+L2573:
+	BIT 1, E
+L2574:
+	RES 0, (XHL)
+L2575:
+	BIT 2, C
+L2576:
+	SET 6, D
+L2577:
+	RES 2, (XHL)
+L2578:
+	CHG 3, D
+L2579:
+	BIT 0, (XHL)
+L2580:
+	RES 7, B
+L2581:
+	TSET 2, H
+L2582:
+	CHG 1, E
+L2583:
+	CHG 7, W
+L2584:
+	CHG 4, W
+L2585:
+	RES 5, (XHL)
+L2586:
+	RES 3, (XHL)
+L2587:
+	SET 0, (XHL)
+L2588:
+	RES 3, L
+L2589:
+	RES 4, (XHL)
+L2590:
+	RES 4, (XHL)
+L2591:
+	BIT 7, (XHL)
+L2592:
+	BIT 3, (XHL)
+L2593:
+	RES 1, (XHL)
+L2594:
+	RES 7, A
+L2595:
+	SET 1, W
+L2596:
+	RES 1, L
+L2597:
+	RES 6, H
+L2598:
+	SET 0, (XHL)
+L2599:
+	RES 5, D
+L2600:
+	BIT 5, (XHL)
+L2601:
+	BIT 7, (XHL)
+L2602:
+	RES 2, (XHL)
+L2603:
+	RES 1, (XHL)
+L2604:
+	RES 2, C
+L2605:
+	RES 5, (XHL)
+L2606:
+	SET 0, (XHL)
+L2607:
+	BIT 6, (XHL)
+L2608:
+	RES 7, (XHL)
+L2609:
+	RES 6, A
+L2610:
+	BIT 3, (XHL)
+L2611:
+	SET 5, (XHL)
+L2612:
+	RES 4, (XHL)
+L2613:
+	BIT 1, (XHL)
+L2614:
+	RES 6, L
+L2615:
+	BIT 3, E
+L2616:
+	CHG 1, W
+L2617:
+	BIT 1, (XHL)
+L2618:
+	BIT 0, (XHL)
+L2619:
+	SET 1, D
+L2620:
+	RES 7, B
+L2621:
+	RES 2, A
+L2622:
+	SET 6, E
+L2623:
+	RES 5, A
+L2624:
+	BIT 5, (XHL)
+L2625:
+	RES 6, (XHL)
+L2626:
+	BIT 6, D
+L2627:
+	SET 4, L
+L2628:
+	CHG 3, D
+L2629:
+	RES 3, (XHL)
+L2630:
+	SET 7, (XHL)
+L2631:
+	RES 4, C
+L2632:
+	BIT 1, W
+L2633:
+	RES 3, (XHL)
+L2634:
+	RES 6, (XHL)
+L2635:
+	SET 3, (XHL)
+L2636:
+	SET 4, (XHL)
+L2637:
+	RES 3, (XHL)
+L2638:
+	SET 6, (XHL)
+L2639:
+	SET 2, (XHL)
+L2640:
+	RES 3, E
+L2641:
+	BIT 0, D
+L2642:
+	SET 7, L
+L2643:
+	BIT 3, (XHL)
+L2644:
+	BIT 3, (XHL)
+L2645:
+	SET 6, D
+L2646:
+	SET 2, H
+L2647:
+	TSET 6, H
+L2648:
+	BIT 4, (XHL)
+L2649:
+	SET 0, E
+L2650:
+	BIT 3, (XHL)
+L2651:
+	BIT 3, (XHL)
+L2652:
+	BIT 7, (XHL)
+L2653:
+	RES 7, (XHL)
+L2654:
+	TSET 7, H
+L2655:
+	BIT 7, (XHL)
+L2656:
+	RES 6, (XHL)
+L2657:
+	RES 5, (XHL)
+L2658:
+	BIT 6, (XHL)
+L2659:
+	SET 2, (XHL)
+L2660:
+	SET 1, B
+L2661:
+	BIT 1, W
+L2662:
+	BIT 5, (XHL)
+L2663:
+	CHG 0, E
+L2664:
+	BIT 2, (XHL)
+L2665:
+	SET 6, (XHL)
+L2666:
+	BIT 0, D
+L2667:
+	RES 5, (XHL)
+L2668:
+	SET 1, W
+L2669:
+	BIT 2, (XHL)
+L2670:
+	RES 2, (XHL)
+L2671:
+	TSET 5, W
+L2672:
+	SET 5, (XHL)
+L2673:
+	BIT 6, (XHL)
+L2674:
+	SET 1, L
+L2675:
+	RES 4, (XHL)
+L2676:
+	SET 3, (XHL)
+L2677:
+	SET 3, H
+L2678:
+	SET 1, (XHL)
+L2679:
+	SET 1, (XHL)
+L2680:
+	RES 1, (XHL)
+L2681:
+	RES 1, A
+L2682:
+	BIT 5, (XHL)
+L2683:
+	RES 1, (XHL)
+L2684:
+	SET 1, W
+L2685:
+	RES 1, (XHL)
+L2686:
+	CHG 3, W
+L2687:
+	RES 0, (XHL)
+L2688:
+	TSET 3, L
+L2689:
+	RES 1, A
+L2690:
+	RES 6, (XHL)
+L2691:
+	RES 5, (XHL)
+L2692:
+	SET 6, (XHL)
+L2693:
+	RES 2, B
+L2694:
+	BIT 2, (XHL)
+L2695:
+	RES 7, (XHL)
+L2696:
+	BIT 0, B
+L2697:
+	TSET 6, C
+L2698:
+	SET 5, (XHL)
+L2699:
+	BIT 5, L
+L2700:
+	TSET 0, E
+L2701:
+	RES 0, (XHL)
+L2702:
+	BIT 2, B
+L2703:
+	RES 6, (XHL)
+L2704:
+	TSET 4, C
+L2705:
+	TSET 2, L
+L2706:
+	RES 5, W
+L2707:
+	SET 7, A
+L2708:
+	SET 0, (XHL)
+L2709:
+	SET 3, (XHL)
+L2710:
+	TSET 7, E
+L2711:
+	RES 7, A
+L2712:
+	RES 6, W
+L2713:
+	RES 3, W
+L2714:
+	SET 1, (XHL)
+L2715:
+	BIT 6, (XHL)
+L2716:
+	BIT 7, W
+L2717:
+	BIT 2, (XHL)
+L2718:
+	SET 4, (XHL)
+L2719:
+	BIT 1, (XHL)
+L2720:
+	SET 3, E
+L2721:
+	RES 7, D
+L2722:
+	SET 1, (XHL)
+L2723:
+	SET 6, (XHL)
+L2724:
+	BIT 0, (XHL)
+L2725:
+	CHG 4, C
+L2726:
+	RES 6, C
+L2727:
+	CHG 2, B
+L2728:
+	RES 2, L
+L2729:
+	BIT 1, (XHL)
+L2730:
+	BIT 2, L
+L2731:
+	BIT 5, (XHL)
+L2732:
+	BIT 2, (XHL)
+L2733:
+	BIT 1, E
+L2734:
+	BIT 2, (XHL)
+L2735:
+	SET 5, B
+L2736:
+	RES 3, H
+L2737:
+	CHG 5, L
+L2738:
+	CHG 5, H
+L2739:
+	CHG 7, B
+L2740:
+	SET 6, (XHL)
+L2741:
+	RES 7, W
+L2742:
+	RES 1, (XHL)
+L2743:
+	BIT 1, (XHL)
+L2744:
+	BIT 0, W
+L2745:
+	RES 6, (XHL)
+L2746:
+	SET 3, C
+L2747:
+	RES 7, H
+L2748:
+	BIT 6, (XHL)
+L2749:
+	TSET 7, E
+L2750:
+	SET 4, (XHL)
+L2751:
+	TSET 0, C
+L2752:
+	BIT 4, H
+L2753:
+	SET 4, (XHL)
+L2754:
+	SET 2, H
+L2755:
+	SET 3, (XHL)
+L2756:
+	RES 5, (XHL)
+L2757:
+	BIT 4, (XHL)
+L2758:
+	SET 0, (XHL)
+L2759:
+	BIT 1, L
+L2760:
+	BIT 6, (XHL)
+L2761:
+	BIT 3, W
+L2762:
+	BIT 6, (XHL)
+L2763:
+	SET 1, (XHL)
+L2764:
+	BIT 0, E
+L2765:
+	BIT 4, (XHL)
+L2766:
+	RES 2, (XHL)
+L2767:
+	RES 6, W
+L2768:
+	BIT 4, (XHL)
+L2769:
+	BIT 2, H
+L2770:
+	RES 5, (XHL)
+L2771:
+	SET 7, (XHL)
+L2772:
+	RES 3, C
+L2773:
+	SET 2, (XHL)
+L2774:
+	SET 7, (XHL)
+L2775:
+	SET 5, (XHL)
+L2776:
+	SET 0, (XHL)
+L2777:
+	BIT 5, (XHL)
+L2778:
+	RES 0, (XHL)
+L2779:
+	CHG 5, C
+L2780:
+	RES 6, E
+L2781:
+	BIT 2, (XHL)
+L2782:
+	SET 5, (XHL)
+L2783:
+	BIT 1, E
+L2784:
+	SET 6, D
+L2785:
+	RES 4, A
+L2786:
+	SET 2, E
+L2787:
+	RES 2, (XHL)
+L2788:
+	SET 4, (XHL)
+L2789:
+	CHG 3, E
+L2790:
+	BIT 0, E
+L2791:
+	TSET 4, C
+L2792:
+	RES 3, C
+L2793:
+	BIT 5, (XHL)
+L2794:
+	SET 0, H
+L2795:
+	BIT 0, (XHL)
+L2796:
+	SET 5, (XHL)
+L2797:
+	RES 6, (XHL)
+L2798:
+	RES 6, (XHL)
+L2799:
+	BIT 7, E
+L2800:
+	SET 1, L
+L2801:
+	SET 3, C
+L2802:
+	CHG 0, W
+L2803:
+	BIT 6, C
+L2804:
+	BIT 2, A
+L2805:
+	BIT 2, E
+L2806:
+	CHG 4, E
+L2807:
+	RES 2, (XHL)
+L2808:
+	RES 3, D
+L2809:
+	RES 5, (XHL)
+L2810:
+	SET 3, D
+L2811:
+	SET 1, (XHL)
+L2812:
+	SET 0, (XHL)
+L2813:
+	SET 2, (XHL)
+L2814:
+	SET 3, (XHL)
+L2815:
+	BIT 1, A
+L2816:
+	BIT 0, (XHL)
+L2817:
+	BIT 3, (XHL)
+L2818:
+	BIT 3, (XHL)
+L2819:
+	SET 0, E
+L2820:
+	RES 3, (XHL)
+L2821:
+	BIT 3, (XHL)
+L2822:
+	SET 3, H
+L2823:
+	RES 2, E
+L2824:
+	RES 6, B
+L2825:
+	SET 0, C
+L2826:
+	RES 2, (XHL)
+L2827:
+	BIT 5, W
+L2828:
+	CHG 1, L
+L2829:
+	CHG 7, A
+L2830:
+	RES 4, (XHL)
+L2831:
+	BIT 0, W
+L2832:
+	RES 3, E
+L2833:
+	TSET 1, C
+L2834:
+	RES 3, (XHL)
+L2835:
+	BIT 0, (XHL)
+L2836:
+	RES 4, A
+L2837:
+	BIT 5, B
+L2838:
+	SET 7, (XHL)
+L2839:
+	RES 2, D
+L2840:
+	SET 0, (XHL)
+L2841:
+	BIT 0, (XHL)
+L2842:
+	RES 1, H
+L2843:
+	RES 6, C
+L2844:
+	SET 1, (XHL)
+L2845:
+	RES 6, E
+L2846:
+	SET 5, A
+L2847:
+	BIT 4, L
+L2848:
+	CHG 4, C
+L2849:
+	RES 3, L
+L2850:
+	TSET 4, D
+L2851:
+	TSET 4, B
+L2852:
+	BIT 7, (XHL)
+L2853:
+	RES 1, (XHL)
+L2854:
+	BIT 2, (XHL)
+L2855:
+	TSET 5, L
+L2856:
+	SET 1, (XHL)
+L2857:
+	RES 3, (XHL)
+L2858:
+	SET 2, (XHL)
+L2859:
+	BIT 5, (XHL)
+L2860:
+	BIT 0, (XHL)
+L2861:
+	BIT 4, (XHL)
+L2862:
+	TSET 1, H
+L2863:
+	BIT 5, (XHL)
+L2864:
+	BIT 5, (XHL)
+L2865:
+	RES 0, B
+L2866:
+	BIT 7, (XHL)
+L2867:
+	TSET 1, A
+L2868:
+	RES 3, (XHL)
+L2869:
+	RES 1, (XHL)
+L2870:
+	SET 5, (XHL)
+L2871:
+	SET 7, L
+L2872:
+	BIT 2, (XHL)
+L2873:
+	BIT 2, B
+L2874:
+	RES 4, (XHL)
+L2875:
+	RES 7, (XHL)
+L2876:
+	BIT 2, (XHL)
+L2877:
+	CHG 6, E
+L2878:
+	BIT 3, (XHL)
+L2879:
+	BIT 2, (XHL)
+L2880:
+	RES 7, (XHL)
+L2881:
+	BIT 4, (XHL)
+L2882:
+	RES 1, (XHL)
+L2883:
+	RES 3, H
+L2884:
+	TSET 6, C
+L2885:
+	CHG 3, B
+L2886:
+	BIT 2, (XHL)
+L2887:
+	TSET 6, D
+L2888:
+	SET 6, W
+L2889:
+	CHG 0, D
+L2890:
+	SET 1, D
+L2891:
+	SET 2, L
+L2892:
+	BIT 0, (XHL)
+L2893:
+	BIT 4, (XHL)
+L2894:
+	SET 5, (XHL)
+L2895:
+	RES 7, (XHL)
+L2896:
+	CHG 3, E
+L2897:
+	CHG 6, W
+L2898:
+	TSET 6, D
+L2899:
+	BIT 6, (XHL)
+L2900:
+	RES 4, (XHL)
+L2901:
+	RES 5, W
+L2902:
+	SET 7, W
+L2903:
+	SET 5, (XHL)
+L2904:
+	SET 7, (XHL)
+L2905:
+	RES 3, D
+L2906:
+	BIT 6, C
+L2907:
+	SET 1, (XHL)
+L2908:
+	BIT 1, (XHL)
+L2909:
+	BIT 3, W
+L2910:
+	BIT 1, D
+L2911:
+	CHG 6, D
+L2912:
+	BIT 3, (XHL)
+L2913:
+	RES 0, (XHL)
+L2914:
+	BIT 2, C
+L2915:
+	SET 7, (XHL)
+L2916:
+	SET 5, (XHL)
+L2917:
+	CHG 5, A
+L2918:
+	CHG 3, B
+L2919:
+	SET 6, (XHL)
+L2920:
+	SET 3, C
+L2921:
+	BIT 0, (XHL)
+L2922:
+	SET 2, (XHL)
+L2923:
+	BIT 4, B
+L2924:
+	RES 5, D
+L2925:
+	RES 3, (XHL)
+L2926:
+	BIT 1, D
+L2927:
+	BIT 2, (XHL)
+L2928:
+	SET 0, (XHL)
+L2929:
+	RES 4, (XHL)
+L2930:
+	SET 7, D
+L2931:
+	SET 2, (XHL)
+L2932:
+	TSET 6, L
+L2933:
+	BIT 3, E
+L2934:
+	BIT 6, (XHL)
+L2935:
+	RES 5, (XHL)
+L2936:
+	BIT 2, (XHL)
+L2937:
+	SET 3, (XHL)
+L2938:
+	SET 5, (XHL)
+L2939:
+	RES 2, (XHL)
+L2940:
+	RES 6, (XHL)
+L2941:
+	RES 5, (XHL)
+L2942:
+	RES 2, C
+L2943:
+	BIT 1, (XHL)
+L2944:
+	BIT 3, (XHL)
+L2945:
+	RES 5, (XHL)
+L2946:
+	RES 4, (XHL)
+L2947:
+	BIT 1, B
+L2948:
+	SET 6, C
+L2949:
+	BIT 1, C
+L2950:
+	CHG 3, B
+L2951:
+	BIT 4, L
+L2952:
+	SET 1, A
+L2953:
+	CHG 5, W
+L2954:
+	SET 0, (XHL)
+L2955:
+	BIT 7, B
+L2956:
+	SET 2, (XHL)
+L2957:
+	SET 0, (XHL)
+L2958:
+	TSET 7, C
+L2959:
+	TSET 6, W
+L2960:
+	SET 7, (XHL)
+L2961:
+	SET 4, (XHL)
+L2962:
+	BIT 0, B
+L2963:
+	RES 2, (XHL)
+L2964:
+	CHG 2, A
+L2965:
+	SET 3, (XHL)
+L2966:
+	BIT 2, (XHL)
+L2967:
+	BIT 0, (XHL)
+L2968:
+	BIT 3, A
+L2969:
+	RES 4, H
+L2970:
+	SET 0, B
+L2971:
+	SET 7, (XHL)
+L2972:
+	BIT 2, D
+L2973:
+	RES 2, (XHL)
+L2974:
+	BIT 7, W
+L2975:
+	RES 4, (XHL)
+L2976:
+	RES 1, (XHL)
+L2977:
+	SET 4, (XHL)
+L2978:
+	SET 2, (XHL)
+L2979:
+	BIT 6, (XHL)
+L2980:
+	CHG 1, D
+L2981:
+	CHG 0, D
+L2982:
+	RES 2, (XHL)
+L2983:
+	SET 0, L
+L2984:
+	RES 0, (XHL)
+L2985:
+	BIT 7, B
+L2986:
+	TSET 3, A
+L2987:
+	SET 0, A
+L2988:
+	SET 6, (XHL)
+L2989:
+	RES 2, (XHL)
+L2990:
+	BIT 3, W
+L2991:
+	RES 0, A
+L2992:
+	BIT 7, (XHL)
+L2993:
+	BIT 3, (XHL)
+L2994:
+	BIT 0, W
+L2995:
+	SET 0, (XHL)
+L2996:
+	RES 1, (XHL)
+L2997:
+	BIT 0, (XHL)
+L2998:
+	RES 5, (XHL)
+L2999:
+	BIT 0, (XHL)
+L3000:
+	SET 0, B
+L3001:
+	BIT 3, B
+L3002:
+	RES 2, (XHL)
+L3003:
+	BIT 3, (XHL)
+L3004:
+	RES 2, W
+L3005:
+	SET 6, A
+L3006:
+	RES 1, (XHL)
+L3007:
+	BIT 2, (XHL)
+L3008:
+	RES 2, B
+L3009:
+	CHG 3, A
+L3010:
+	BIT 1, E
+L3011:
+	SET 3, (XHL)
+L3012:
+	TSET 3, L
+L3013:
+	TSET 1, A
+L3014:
+	RES 2, (XHL)
+L3015:
+	RES 5, (XHL)
+L3016:
+	TSET 0, A
+L3017:
+	RES 3, W
+L3018:
+	BIT 0, A
+L3019:
+	RES 0, L
+L3020:
+	SET 0, (XHL)
+L3021:
+	BIT 0, B
+L3022:
+	SET 2, B
+L3023:
+	BIT 7, D
+L3024:
+	CHG 0, H
+L3025:
+	TSET 4, L
+L3026:
+	BIT 0, E
+L3027:
+	SET 1, A
+L3028:
+	BIT 6, (XHL)
+L3029:
+	SET 7, (XHL)
+L3030:
+	CHG 1, D
+L3031:
+	TSET 1, H
+L3032:
+	TSET 5, W
+L3033:
+	SET 5, L
+L3034:
+	RES 1, (XHL)
+L3035:
+	BIT 0, (XHL)
+L3036:
+	CHG 7, A
+L3037:
+	SET 4, (XHL)
+L3038:
+	BIT 2, B
+L3039:
+	BIT 7, (XHL)
+L3040:
+	RES 3, (XHL)
+L3041:
+	TSET 4, W
+L3042:
+	SET 2, H
+L3043:
+	BIT 0, (XHL)
+L3044:
+	BIT 3, (XHL)
+L3045:
+	RES 7, (XHL)
+L3046:
+	BIT 4, E
+L3047:
+	CHG 7, L
+L3048:
+	BIT 6, (XHL)
+L3049:
+	SET 7, (XHL)
+L3050:
+	SET 1, (XHL)
+L3051:
+	BIT 7, (XHL)
+L3052:
+	BIT 2, (XHL)
+L3053:
+	CHG 3, C
+L3054:
+	RES 7, (XHL)
+L3055:
+	TSET 6, L
+L3056:
+	BIT 5, A
+L3057:
+	SET 6, E
+L3058:
+	RES 0, (XHL)
+L3059:
+	RES 4, C
+L3060:
+	RES 1, H
+L3061:
+	SET 6, (XHL)
+L3062:
+	TSET 2, C
+L3063:
+	BIT 1, (XHL)
+L3064:
+	BIT 0, (XHL)
+L3065:
+	SET 5, D
+L3066:
+	SET 6, (XHL)
+L3067:
+	SET 5, C
+L3068:
+	SET 4, A
+L3069:
+	SET 0, (XHL)
+L3070:
+	BIT 0, (XHL)
+L3071:
+	RES 5, (XHL)
+L3072:
+	BIT 2, W
+L3073:
+	TSET 1, A
+L3074:
+	BIT 4, C
+L3075:
+	TSET 0, H
+L3076:
+	SET 7, W
+L3077:
+	SET 5, D
+L3078:
+	TSET 5, H
+L3079:
+	RES 6, (XHL)
+L3080:
+	SET 7, A
+L3081:
+	CHG 2, C
+L3082:
+	RES 6, (XHL)
+L3083:
+	CHG 2, D
+L3084:
+	SET 0, (XHL)
+L3085:
+	RES 4, (XHL)
+L3086:
+	RES 4, H
+L3087:
+	RES 7, (XHL)
+L3088:
+	TSET 5, B
+L3089:
+	RES 4, (XHL)
+L3090:
+	RES 2, D
+L3091:
+	RES 7, C
+L3092:
+	RES 5, (XHL)
+L3093:
+	SET 5, D
+L3094:
+	CHG 1, H
+L3095:
+	SET 6, (XHL)
+L3096:
+	CHG 4, W
+L3097:
+	SET 5, (XHL)
+L3098:
+	CHG 3, B
+L3099:
+	SET 7, C
+L3100:
+	SET 7, H
+L3101:
+	BIT 7, (XHL)
+L3102:
+	BIT 6, B
+L3103:
+	SET 4, (XHL)
+L3104:
+	RES 3, (XHL)
+L3105:
+	TSET 4, C
+L3106:
+	BIT 4, (XHL)
+L3107:
+	RES 5, A
+L3108:
+	RES 2, (XHL)
+L3109:
+	BIT 3, (XHL)
+L3110:
+	RES 0, D
+L3111:
+	RES 3, A
+L3112:
+	SET 6, L
+L3113:
+	SET 5, (XHL)
+L3114:
+	SET 3, (XHL)
+L3115:
+	BIT 3, (XHL)
+L3116:
+	CHG 3, W
+L3117:
+	SET 7, W
+L3118:
+	RES 6, (XHL)
+L3119:
+	SET 2, H
+L3120:
+	RES 2, H
+L3121:
+	CHG 2, H
+L3122:
+	RES 0, C
+L3123:
+	RES 1, (XHL)
+L3124:
+	BIT 2, D
+L3125:
+	SET 7, L
+L3126:
+	RES 3, (XHL)
+L3127:
+	RES 7, (XHL)
+L3128:
+	BIT 4, (XHL)
+L3129:
+	SET 3, (XHL)
+L3130:
+	RES 3, A
+L3131:
+	RES 3, (XHL)
+L3132:
+	SET 5, H
+L3133:
+	SET 1, D
+L3134:
+	RES 5, (XHL)
+L3135:
+	SET 0, (XHL)
+L3136:
+	BIT 4, H
+L3137:
+	RES 4, D
+L3138:
+	CHG 3, H
+L3139:
+	TSET 2, W
+L3140:
+	TSET 4, C
+L3141:
+	BIT 6, C
+L3142:
+	TSET 7, C
+L3143:
+	RES 0, (XHL)
+L3144:
+	CHG 5, E
+L3145:
+	BIT 2, (XHL)
+L3146:
+	TSET 1, B
+L3147:
+	BIT 5, (XHL)
+L3148:
+	SET 5, (XHL)
+L3149:
+	SET 3, A
+L3150:
+	BIT 3, (XHL)
+L3151:
+	SET 4, (XHL)
+L3152:
+	CHG 5, L
+L3153:
+	SET 4, (XHL)
+L3154:
+	SET 6, (XHL)
+L3155:
+	RES 2, (XHL)
+L3156:
+	RES 0, C
+L3157:
+	RES 0, A
+L3158:
+	RES 1, (XHL)
+L3159:
+	RES 2, (XHL)
+L3160:
+	BIT 1, (XHL)
+L3161:
+	SET 1, (XHL)
+L3162:
+	SET 5, (XHL)
+L3163:
+	SET 3, D
+L3164:
+	RES 1, (XHL)
+L3165:
+	BIT 7, H
+L3166:
+	RES 2, (XHL)
+L3167:
+	RES 1, L
+L3168:
+	RES 2, C
+L3169:
+	RES 7, (XHL)
+L3170:
+	RES 2, B
+L3171:
+	CHG 2, L
+L3172:
+	SET 2, E
+L3173:
+	SET 4, A
+L3174:
+	RES 4, W
+L3175:
+	SET 6, (XHL)
+L3176:
+	BIT 3, (XHL)
+L3177:
+	RES 0, (XHL)
+L3178:
+	SET 2, (XHL)
+L3179:
+	SET 2, (XHL)
+L3180:
+	SET 7, D
+L3181:
+	SET 7, (XHL)
+L3182:
+	RES 7, D
+L3183:
+	BIT 1, (XHL)
+L3184:
+	RES 5, (XHL)
+L3185:
+	CHG 7, A
+L3186:
+	SET 0, (XHL)
+L3187:
+	BIT 2, (XHL)
+L3188:
+	SET 5, A
+L3189:
+	BIT 5, (XHL)
+L3190:
+	SET 4, D
+L3191:
+	SET 7, (XHL)
+L3192:
+	BIT 3, (XHL)
+L3193:
+	SET 2, (XHL)
+L3194:
+	SET 4, (XHL)
+L3195:
+	RES 0, B
+L3196:
+	RES 4, (XHL)
+L3197:
+	BIT 1, (XHL)
+L3198:
+	SET 5, A
+L3199:
+	SET 4, (XHL)
+L3200:
+	TSET 0, C
+L3201:
+	CHG 7, H
+L3202:
+	SET 1, (XHL)
+L3203:
+	TSET 2, W
+L3204:
+	BIT 1, (XHL)
+L3205:
+	BIT 1, (XHL)
+L3206:
+	BIT 0, (XHL)
+L3207:
+	SET 1, A
+L3208:
+	SET 1, (XHL)
+L3209:
+	SET 0, E
+L3210:
+	BIT 7, (XHL)
+L3211:
+	SET 0, (XHL)
+L3212:
+	RES 1, H
+L3213:
+	RES 5, D
+L3214:
+	RES 0, (XHL)
+L3215:
+	SET 6, (XHL)
+L3216:
+	SET 6, (XHL)
+L3217:
+	RES 3, (XHL)
+L3218:
+	RES 4, (XHL)
+L3219:
+	RES 2, (XHL)
+L3220:
+	SET 0, E
+L3221:
+	SET 0, W
+L3222:
+	BIT 1, (XHL)
+L3223:
+	RES 3, W
+L3224:
+	SET 1, (XHL)
+L3225:
+	SET 7, C
+L3226:
+	CHG 6, D
+L3227:
+	CHG 6, W
+L3228:
+	BIT 5, (XHL)
+L3229:
+	RES 5, E
+L3230:
+	RES 3, (XHL)
+L3231:
+	SET 1, (XHL)
+L3232:
+	RES 5, C
+L3233:
+	SET 5, (XHL)
+L3234:
+	RES 4, (XHL)
+L3235:
+	TSET 5, L
+L3236:
+	RES 6, C
+L3237:
+	SET 4, (XHL)
+L3238:
+	SET 0, (XHL)
+L3239:
+	BIT 7, H
+L3240:
+	SET 6, (XHL)
+L3241:
+	CHG 5, A
+L3242:
+	SET 3, (XHL)
+L3243:
+	RES 4, E
+L3244:
+	BIT 0, (XHL)
+L3245:
+	RES 0, (XHL)
+L3246:
+	SET 5, (XHL)
+L3247:
+	BIT 5, W
+L3248:
+	RES 1, E
+L3249:
+	RES 2, (XHL)
+L3250:
+	TSET 3, D
+L3251:
+	SET 1, D
+L3252:
+	SET 1, D
+L3253:
+	BIT 1, (XHL)
+L3254:
+	SET 2, (XHL)
+L3255:
+	RES 4, H
+L3256:
+	SET 1, (XHL)
+L3257:
+	SET 5, E
+L3258:
+	SET 3, (XHL)
+L3259:
+	TSET 2, H
+L3260:
+	BIT 0, (XHL)
+L3261:
+	CHG 0, L
+L3262:
+	RES 6, (XHL)
+L3263:
+	BIT 0, B
+L3264:
+	RES 6, (XHL)
+L3265:
+	RES 5, (XHL)
+L3266:
+	BIT 7, (XHL)
+L3267:
+	RES 6, (XHL)
+L3268:
+	CHG 0, B
+L3269:
+	SET 7, (XHL)
+L3270:
+	BIT 5, (XHL)
+L3271:
+	BIT 0, W
+L3272:
+	SET 3, (XHL)
+L3273:
+	RES 4, (XHL)
+L3274:
+	TSET 3, L
+L3275:
+	TSET 3, C
+L3276:
+	SET 3, B
+L3277:
+	BIT 2, (XHL)
+L3278:
+	SET 4, D
+L3279:
+	RES 4, C
+L3280:
+	RES 2, (XHL)
+L3281:
+	RES 3, (XHL)
+L3282:
+	BIT 7, (XHL)
+L3283:
+	CHG 7, H
+L3284:
+	TSET 2, C
+L3285:
+	SET 4, (XHL)
+L3286:
+	RES 6, (XHL)
+L3287:
+	RES 5, (XHL)
+L3288:
+	TSET 0, L
+L3289:
+	RES 3, (XHL)
+L3290:
+	CHG 4, L
+L3291:
+	TSET 4, B
+L3292:
+	RES 3, C
+L3293:
+	CHG 7, E
+L3294:
+	RES 5, (XHL)
+L3295:
+	RES 0, (XHL)
+L3296:
+	RES 7, (XHL)
+L3297:
+	SET 7, (XHL)
+L3298:
+	TSET 0, C
+L3299:
+	BIT 2, A
+L3300:
+	RES 0, (XHL)
+L3301:
+	RES 7, (XHL)
+L3302:
+	SET 4, E
+L3303:
+	BIT 6, (XHL)
+L3304:
+	BIT 3, (XHL)
+L3305:
+	BIT 4, (XHL)
+L3306:
+	SET 2, (XHL)
+L3307:
+	RES 7, (XHL)
+L3308:
+	SET 2, B
+L3309:
+	SET 4, (XHL)
+L3310:
+	RES 7, (XHL)
+L3311:
+	RES 3, L
+L3312:
+	TSET 1, B
+L3313:
+	RES 5, E
+L3314:
+	SET 5, E
+L3315:
+	RES 0, (XHL)
+L3316:
+	RES 0, C
+L3317:
+	CHG 3, E
+L3318:
+	BIT 0, B
+L3319:
+	TSET 3, B
+L3320:
+	SET 5, C
+L3321:
+	BIT 5, B
+L3322:
+	BIT 0, (XHL)
+L3323:
+	TSET 3, A
+L3324:
+	RES 6, (XHL)
+L3325:
+	BIT 1, D
+L3326:
+	RES 4, (XHL)
+L3327:
+	RES 2, (XHL)
+L3328:
+	RES 3, (XHL)
+L3329:
+	CHG 1, L
+L3330:
+	RES 5, (XHL)
+L3331:
+	TSET 3, L
+L3332:
+	RES 6, (XHL)
+L3333:
+	RES 5, (XHL)
+L3334:
+	BIT 0, (XHL)
+L3335:
+	SET 2, B
+L3336:
+	RES 6, W
+L3337:
+	SET 0, (XHL)
+L3338:
+	SET 3, (XHL)
+L3339:
+	CHG 0, D
+L3340:
+	RES 7, D
+L3341:
+	BIT 5, D
+L3342:
+	RES 4, (XHL)
+L3343:
+	BIT 5, (XHL)
+L3344:
+	CHG 0, W
+L3345:
+	BIT 5, (XHL)
+L3346:
+	BIT 3, E
+L3347:
+	RES 3, (XHL)
+L3348:
+	BIT 4, W
+L3349:
+	BIT 7, (XHL)
+L3350:
+	BIT 5, W
+L3351:
+	BIT 1, (XHL)
+L3352:
+	SET 5, (XHL)
+L3353:
+	SET 2, (XHL)
+L3354:
+	SET 7, A
+L3355:
+	CHG 3, H
+L3356:
+	RES 6, W
+L3357:
+	SET 6, (XHL)
+L3358:
+	SET 7, (XHL)
+L3359:
+	BIT 7, B
+L3360:
+	RES 6, (XHL)
+L3361:
+	RES 3, (XHL)
+L3362:
+	RES 2, (XHL)
+L3363:
+	CHG 6, C
+L3364:
+	BIT 5, (XHL)
+L3365:
+	BIT 0, (XHL)
+L3366:
+	CHG 6, C
+L3367:
+	BIT 6, A
+L3368:
+	TSET 5, B
+L3369:
+	TSET 1, A
+L3370:
+	BIT 3, L
+L3371:
+	TSET 6, B
+L3372:
+	SET 1, D
+L3373:
+	BIT 2, H
+L3374:
+	RES 0, (XHL)
+L3375:
+	RES 0, H
+L3376:
+	TSET 2, W
+L3377:
+	RES 4, (XHL)
+L3378:
+	CHG 7, L
+L3379:
+	CHG 4, E
+L3380:
+	CHG 3, B
+L3381:
+	BIT 0, (XHL)
+L3382:
+	RES 3, (XHL)
+L3383:
+	RES 5, (XHL)
+L3384:
+	BIT 1, E
+L3385:
+	BIT 2, C
+L3386:
+	TSET 4, C
+L3387:
+	RES 7, (XHL)
+L3388:
+	BIT 2, E
+L3389:
+	BIT 4, A
+L3390:
+	SET 1, (XHL)
+L3391:
+	BIT 5, L
+L3392:
+	BIT 4, (XHL)
+L3393:
+	SET 2, L
+L3394:
+	RES 3, (XHL)
+L3395:
+	TSET 0, E
+L3396:
+	RES 1, W
+L3397:
+	BIT 5, (XHL)
+L3398:
+	BIT 1, (XHL)
+L3399:
+	RES 6, (XHL)
+L3400:
+	SET 2, (XHL)
+L3401:
+	BIT 7, (XHL)
+L3402:
+	SET 7, C
+L3403:
+	RES 6, (XHL)
+L3404:
+	RES 2, (XHL)
+L3405:
+	SET 0, C
+L3406:
+	BIT 1, L
+L3407:
+	BIT 0, (XHL)
+L3408:
+	RES 3, H
+L3409:
+	RES 7, D
+L3410:
+	BIT 7, (XHL)
+L3411:
+	BIT 5, H
+L3412:
+	SET 6, (XHL)
+L3413:
+	SET 0, (XHL)
+L3414:
+	RES 3, (XHL)
+L3415:
+	BIT 2, B
+L3416:
+	TSET 3, C
+L3417:
+	BIT 2, (XHL)
+L3418:
+	BIT 3, (XHL)
+L3419:
+	BIT 1, (XHL)
+L3420:
+	CHG 4, B
+L3421:
+	CHG 5, E
+L3422:
+	RES 5, (XHL)
+L3423:
+	RES 5, (XHL)
+L3424:
+	SET 1, (XHL)
+L3425:
+	BIT 3, (XHL)
+L3426:
+	SET 4, (XHL)
+L3427:
+	BIT 4, A
+L3428:
+	SET 7, (XHL)
+L3429:
+	TSET 1, E
+L3430:
+	BIT 7, (XHL)
+L3431:
+	CHG 0, A
+L3432:
+	BIT 7, (XHL)
+L3433:
+	SET 4, H
+L3434:
+	BIT 7, (XHL)
+L3435:
+	BIT 0, (XHL)
+L3436:
+	BIT 7, (XHL)
+L3437:
+	TSET 2, D
+L3438:
+	SET 6, (XHL)
+L3439:
+	BIT 5, (XHL)
+L3440:
+	CHG 4, B
+L3441:
+	BIT 7, A
+L3442:
+	RES 0, (XHL)
+L3443:
+	TSET 6, L
+L3444:
+	TSET 7, A
+L3445:
+	SET 0, (XHL)
+L3446:
+	BIT 7, (XHL)
+L3447:
+	BIT 5, A
+L3448:
+	RES 4, H
+L3449:
+	RES 0, (XHL)
+L3450:
+	SET 6, (XHL)
+L3451:
+	RES 0, W
+L3452:
+	RES 3, (XHL)
+L3453:
+	CHG 5, H
+L3454:
+	RES 4, A
+L3455:
+	SET 4, (XHL)
+L3456:
+	SET 1, L
+L3457:
+	RES 5, (XHL)
+L3458:
+	BIT 0, A
+L3459:
+	RES 3, (XHL)
+L3460:
+	BIT 2, (XHL)
+L3461:
+	BIT 7, C
+L3462:
+	CHG 5, L
+L3463:
+	BIT 4, C
+L3464:
+	BIT 2, (XHL)
+L3465:
+	TSET 5, E
+L3466:
+	RES 3, H
+L3467:
+	TSET 2, C
+L3468:
+	BIT 5, D
+L3469:
+	RES 1, L
+L3470:
+	RES 2, L
+L3471:
+	SET 1, (XHL)
+L3472:
+	BIT 2, C
+L3473:
+	RES 0, E
+L3474:
+	RES 1, (XHL)
+L3475:
+	BIT 7, (XHL)
+L3476:
+	SET 7, (XHL)
+L3477:
+	BIT 2, (XHL)
+L3478:
+	CHG 4, W
+L3479:
+	RES 0, (XHL)
+L3480:
+	SET 6, (XHL)
+L3481:
+	RES 3, B
+L3482:
+	BIT 7, (XHL)
+L3483:
+	RES 0, (XHL)
+L3484:
+	BIT 7, L
+L3485:
+	CHG 2, W
+L3486:
+	BIT 2, (XHL)
+L3487:
+	SET 6, (XHL)
+L3488:
+	SET 3, E
+L3489:
+	SET 2, W
+L3490:
+	BIT 3, (XHL)
+L3491:
+	BIT 3, (XHL)
+L3492:
+	BIT 2, (XHL)
+L3493:
+	BIT 0, C
+L3494:
+	RES 7, (XHL)
+L3495:
+	SET 1, (XHL)
+L3496:
+	TSET 3, E
+L3497:
+	CHG 4, E
+L3498:
+	SET 3, (XHL)
+L3499:
+	SET 5, (XHL)
+L3500:
+	RES 5, (XHL)
+L3501:
+	RES 7, W
+L3502:
+	BIT 0, (XHL)
+L3503:
+	RES 7, W
+L3504:
+	RES 4, D
+L3505:
+	SET 6, (XHL)
+L3506:
+	RES 5, (XHL)
+L3507:
+	TSET 5, W
+L3508:
+	SET 2, (XHL)
+L3509:
+	SET 1, W
+L3510:
+	SET 5, H
+L3511:
+	TSET 4, H
+L3512:
+	BIT 5, D
+L3513:
+	TSET 2, W
+L3514:
+	SET 0, (XHL)
+L3515:
+	SET 3, C
+L3516:
+	TSET 5, L
+L3517:
+	RES 2, (XHL)
+L3518:
+	RES 0, H
+L3519:
+	CHG 7, D
+L3520:
+	TSET 2, A
+L3521:
+	SET 5, (XHL)
+L3522:
+	TSET 3, A
+L3523:
+	BIT 4, (XHL)
+L3524:
+	BIT 1, H
+L3525:
+	BIT 4, (XHL)
+L3526:
+	TSET 2, H
+L3527:
+	RES 5, (XHL)
+L3528:
+	SET 6, (XHL)
+L3529:
+	TSET 4, E
+L3530:
+	BIT 7, W
+L3531:
+	TSET 5, C
+L3532:
+	BIT 5, (XHL)
+L3533:
+	BIT 3, (XHL)
+L3534:
+	SET 7, (XHL)
+L3535:
+	SET 5, C
+L3536:
+	SET 1, (XHL)
+L3537:
+	SET 6, D
+L3538:
+	BIT 2, (XHL)
+L3539:
+	TSET 5, A
+L3540:
+	SET 6, A
+L3541:
+	CHG 2, H
+L3542:
+	BIT 7, H
+L3543:
+	CHG 4, W
+L3544:
+	BIT 7, (XHL)
+L3545:
+	SET 7, (XHL)
+L3546:
+	BIT 1, D
+L3547:
+	CHG 3, E
+L3548:
+	CHG 4, C
+L3549:
+	RES 0, W
+L3550:
+	BIT 0, (XHL)
+L3551:
+	BIT 3, (XHL)
+L3552:
+	CHG 0, E
+L3553:
+	BIT 6, (XHL)
+L3554:
+	RES 7, (XHL)
+L3555:
+	SET 6, (XHL)
+L3556:
+	BIT 1, (XHL)
+L3557:
+	TSET 5, H
+L3558:
+	RES 3, D
+L3559:
+	SET 4, (XHL)
+L3560:
+	BIT 3, (XHL)
+L3561:
+	SET 2, B
+L3562:
+	CHG 6, B
+L3563:
+	BIT 6, (XHL)
+L3564:
+	CHG 0, W
+L3565:
+	RES 3, W
+L3566:
+	BIT 2, (XHL)
+L3567:
+	SET 6, (XHL)
+L3568:
+	CHG 7, L
+L3569:
+	BIT 3, (XHL)
+L3570:
+	RES 0, (XHL)
+L3571:
+	TSET 5, W
+L3572:
+	TSET 0, D
+L3573:
+	BIT 7, C
+L3574:
+	SET 5, (XHL)
+L3575:
+	RES 5, (XHL)
+L3576:
+	RES 7, H
+L3577:
+	BIT 1, A
+L3578:
+	BIT 4, (XHL)
+L3579:
+	RES 7, (XHL)
+L3580:
+	BIT 3, (XHL)
+L3581:
+	BIT 2, H
+L3582:
+	RES 6, (XHL)
+L3583:
+	RES 7, (XHL)
+L3584:
+	BIT 1, (XHL)
+L3585:
+	RES 4, (XHL)
+L3586:
+	SET 2, (XHL)
+L3587:
+	SET 6, B
+L3588:
+	BIT 0, (XHL)
+L3589:
+	SET 1, (XHL)
+L3590:
+	CHG 5, L
+L3591:
+	SET 3, (XHL)
+L3592:
+	TSET 0, A
+L3593:
+	SET 2, (XHL)
+L3594:
+	TSET 0, A
+L3595:
+	RES 2, E
+L3596:
+	RES 4, (XHL)
+L3597:
+	RES 7, (XHL)
+L3598:
+	TSET 7, L
+L3599:
+	BIT 3, (XHL)
+L3600:
+	RES 7, (XHL)
+L3601:
+	BIT 0, (XHL)
+L3602:
+	RES 4, (XHL)
+L3603:
+	TSET 6, W
+L3604:
+	BIT 2, (XHL)
+L3605:
+	CHG 3, B
+L3606:
+	CHG 1, E
+L3607:
+	SET 3, (XHL)
+L3608:
+	BIT 6, (XHL)
+L3609:
+	BIT 5, (XHL)
+L3610:
+	TSET 5, B
+L3611:
+	CHG 1, W
+L3612:
+	CHG 3, H
+L3613:
+	BIT 2, L
+L3614:
+	SET 4, W
+L3615:
+	TSET 1, C
+L3616:
+	RES 0, A
+L3617:
+	BIT 5, W
+L3618:
+	SET 1, H
+L3619:
+	BIT 5, (XHL)
+L3620:
+	RES 1, L
+L3621:
+	BIT 0, H
+L3622:
+	SET 7, (XHL)
+L3623:
+	BIT 6, (XHL)
+L3624:
+	RES 3, (XHL)
+L3625:
+	SET 1, E
+L3626:
+	BIT 0, (XHL)
+L3627:
+	RES 1, (XHL)
+L3628:
+	BIT 1, W
+L3629:
+	BIT 6, (XHL)
+L3630:
+	TSET 2, W
+L3631:
+	RES 4, (XHL)
+L3632:
+	SET 6, (XHL)
+L3633:
+	RES 0, L
+L3634:
+	SET 5, (XHL)
+L3635:
+	BIT 4, (XHL)
+L3636:
+	CHG 5, B
+L3637:
+	SET 7, D
+L3638:
+	TSET 5, H
+L3639:
+	SET 6, (XHL)
+L3640:
+	CHG 6, A
+L3641:
+	CHG 4, W
+L3642:
+	BIT 6, (XHL)
+L3643:
+	SET 0, B
+L3644:
+	TSET 0, E
+L3645:
+	BIT 5, L
+L3646:
+	SET 7, E
+L3647:
+	BIT 0, (XHL)
+L3648:
+	RES 7, D
+L3649:
+	BIT 5, W
+L3650:
+	SET 5, (XHL)
+L3651:
+	TSET 3, H
+L3652:
+	CHG 3, W
+L3653:
+	SET 2, (XHL)
+L3654:
+	BIT 1, E
+L3655:
+	SET 4, B
+L3656:
+	SET 7, (XHL)
+L3657:
+	RES 1, (XHL)
+L3658:
+	TSET 3, D
+L3659:
+	SET 3, D
+L3660:
+	BIT 3, (XHL)
+L3661:
+	TSET 0, C
+L3662:
+	SET 0, (XHL)
+L3663:
+	BIT 7, (XHL)
+L3664:
+	BIT 3, (XHL)
+L3665:
+	RES 3, (XHL)
+L3666:
+	RES 7, D
+L3667:
+	SET 3, (XHL)
+L3668:
+	BIT 4, (XHL)
+L3669:
+	CHG 4, B
+L3670:
+	BIT 2, L
+L3671:
+	CHG 7, H
+L3672:
+	SET 2, (XHL)
+L3673:
+	BIT 0, (XHL)
+L3674:
+	SET 1, D
+L3675:
+	TSET 7, D
+L3676:
+	CHG 3, E
+L3677:
+	RES 6, (XHL)
+L3678:
+	SET 0, B
+L3679:
+	RES 7, L
+L3680:
+	RES 0, H
+L3681:
+	CHG 7, A
+L3682:
+	RES 1, (XHL)
+L3683:
+	RES 5, (XHL)
+L3684:
+	BIT 0, (XHL)
+L3685:
+	RES 0, (XHL)
+L3686:
+	CHG 7, W
+L3687:
+	RES 3, (XHL)
+L3688:
+	BIT 1, (XHL)
+L3689:
+	SET 5, W
+L3690:
+	RES 2, (XHL)
+L3691:
+	SET 4, (XHL)
+L3692:
+	BIT 0, L
+L3693:
+	BIT 7, B
+L3694:
+	SET 6, (XHL)
+L3695:
+	CHG 0, L
+L3696:
+	TSET 7, B
+L3697:
+	CHG 2, W
+L3698:
+	SET 3, C
+L3699:
+	CHG 5, A
+L3700:
+	RES 3, (XHL)
+L3701:
+	BIT 6, B
+L3702:
+	RES 1, A
+L3703:
+	SET 7, A
+L3704:
+	RES 1, (XHL)
+L3705:
+	RES 5, B
+L3706:
+	RES 3, (XHL)
+L3707:
+	SET 1, (XHL)
+L3708:
+	SET 1, W
+L3709:
+	RES 3, W
+L3710:
+	RES 4, (XHL)
+L3711:
+	RES 3, B
+L3712:
+	BIT 7, E
+L3713:
+	RES 2, L
+L3714:
+	RES 4, C
+L3715:
+	RES 7, (XHL)
+L3716:
+	BIT 6, (XHL)
+L3717:
+	RES 0, A
+L3718:
+	BIT 5, (XHL)
+L3719:
+	BIT 3, (XHL)
+L3720:
+	RES 4, (XHL)
+L3721:
+	CHG 6, W
+L3722:
+	RES 3, B
+L3723:
+	CHG 2, A
+L3724:
+	RES 6, L
+L3725:
+	RES 2, (XHL)
+L3726:
+	BIT 7, D
+L3727:
+	TSET 0, A
+L3728:
+	RES 7, B
+L3729:
+	RES 4, (XHL)
+L3730:
+	SET 5, (XHL)
+L3731:
+	SET 4, W
+L3732:
+	BIT 4, (XHL)
+L3733:
+	BIT 3, (XHL)
+L3734:
+	RES 7, (XHL)
+L3735:
+	BIT 7, (XHL)
+L3736:
+	RES 5, D
+L3737:
+	RES 1, (XHL)
+L3738:
+	TSET 1, H
+L3739:
+	RES 5, (XHL)
+L3740:
+	BIT 7, (XHL)
+L3741:
+	TSET 0, A
+L3742:
+	RES 7, C
+L3743:
+	RES 1, (XHL)
+L3744:
+	TSET 5, W
+L3745:
+	BIT 5, (XHL)
+L3746:
+	SET 4, C
+L3747:
+	BIT 7, B
+L3748:
+	BIT 6, (XHL)
+L3749:
+	TSET 1, A
+L3750:
+	TSET 6, W
+L3751:
+	RES 1, B
+L3752:
+	SET 1, (XHL)
+L3753:
+	SET 2, (XHL)
+L3754:
+	RES 4, (XHL)
+L3755:
+	TSET 2, A
+L3756:
+	CHG 0, B
+L3757:
+	TSET 6, C
+L3758:
+	SET 1, (XHL)
+L3759:
+	BIT 1, (XHL)
+L3760:
+	RES 7, (XHL)
+L3761:
+	BIT 7, (XHL)
+L3762:
+	TSET 2, H
+L3763:
+	BIT 4, B
+L3764:
+	SET 5, E
+L3765:
+	RES 1, C
+L3766:
+	BIT 0, (XHL)
+L3767:
+	CHG 1, B
+L3768:
+	BIT 2, C
+L3769:
+	CHG 0, B
+L3770:
+	BIT 7, (XHL)
+L3771:
+	SET 4, D
+L3772:
+	RES 3, (XHL)
+L3773:
+	BIT 0, (XHL)
+L3774:
+	BIT 0, (XHL)
+L3775:
+	BIT 4, (XHL)
+L3776:
+	BIT 4, (XHL)
+L3777:
+	SET 7, (XHL)
+L3778:
+	RES 2, (XHL)
+L3779:
+	SET 2, W
+L3780:
+	SET 3, C
+L3781:
+	SET 5, A
+L3782:
+	SET 0, D
+L3783:
+	SET 2, W
+L3784:
+	BIT 4, (XHL)
+L3785:
+	TSET 0, D
+L3786:
+	SET 0, (XHL)
+L3787:
+	SET 2, (XHL)
+L3788:
+	RES 3, (XHL)
+L3789:
+	SET 5, C
+L3790:
+	SET 0, (XHL)
+L3791:
+	RES 5, (XHL)
+L3792:
+	BIT 6, B
+L3793:
+	RES 6, B
+L3794:
+	TSET 6, D
+L3795:
+	RES 6, (XHL)
+L3796:
+	RES 6, (XHL)
+L3797:
+	RES 3, (XHL)
+L3798:
+	BIT 1, E
+L3799:
+	SET 6, (XHL)
+L3800:
+	RES 3, B
+L3801:
+	SET 1, (XHL)
+L3802:
+	BIT 7, (XHL)
+L3803:
+	RES 5, (XHL)
+L3804:
+	BIT 1, C
+L3805:
+	TSET 6, W
+L3806:
+	BIT 6, (XHL)
+L3807:
+	SET 7, (XHL)
+L3808:
+	BIT 6, (XHL)
+L3809:
+	RES 4, (XHL)
+L3810:
+	RES 4, B
+L3811:
+	RES 0, (XHL)
+L3812:
+	BIT 0, W
+L3813:
+	BIT 0, C
+L3814:
+	BIT 0, (XHL)
+L3815:
+	SET 1, (XHL)
+L3816:
+	SET 6, A
+L3817:
+	BIT 6, (XHL)
+L3818:
+	RES 6, W
+L3819:
+	BIT 4, (XHL)
+L3820:
+	SET 4, (XHL)
+L3821:
+	RES 1, (XHL)
+L3822:
+	RES 7, E
+L3823:
+	SET 7, D
+L3824:
+	CHG 6, E
+L3825:
+	SET 4, (XHL)
+L3826:
+	CHG 3, L
+L3827:
+	CHG 1, W
+L3828:
+	CHG 1, W
+L3829:
+	SET 5, L
+L3830:
+	RES 0, (XHL)
+L3831:
+	BIT 7, (XHL)
+L3832:
+	TSET 0, E
+L3833:
+	RES 5, (XHL)
+L3834:
+	BIT 4, E
+L3835:
+	CHG 0, B
+L3836:
+	RES 2, B
+L3837:
+	TSET 0, D
+L3838:
+	SET 4, (XHL)
+L3839:
+	SET 6, (XHL)
+L3840:
+	SET 5, (XHL)
+L3841:
+	BIT 0, L
+L3842:
+	TSET 1, B
+L3843:
+	BIT 2, (XHL)
+L3844:
+	RES 0, C
+L3845:
+	SET 2, (XHL)
+L3846:
+	SET 6, E
+L3847:
+	BIT 7, H
+L3848:
+	BIT 7, A
+L3849:
+	RES 5, (XHL)
+L3850:
+	SET 5, (XHL)
+L3851:
+	RES 0, (XHL)
+L3852:
+	CHG 6, W
+L3853:
+	RES 6, (XHL)
+L3854:
+	CHG 5, D
+L3855:
+	SET 5, A
+L3856:
+	SET 0, (XHL)
+L3857:
+	BIT 1, (XHL)
+L3858:
+	RES 6, B
+L3859:
+	RES 7, (XHL)
+L3860:
+	BIT 4, (XHL)
+L3861:
+	SET 7, (XHL)
+L3862:
+	BIT 0, L
+L3863:
+	RES 2, (XHL)
+L3864:
+	BIT 5, (XHL)
+L3865:
+	BIT 7, (XHL)
+L3866:
+	BIT 0, (XHL)
+L3867:
+	BIT 4, L
+L3868:
+	BIT 2, (XHL)
+L3869:
+	SET 5, (XHL)
+L3870:
+	RES 0, A
+L3871:
+	BIT 4, (XHL)
+L3872:
+	CHG 6, H
+L3873:
+	RES 5, B
+L3874:
+	BIT 3, (XHL)
+L3875:
+	BIT 6, (XHL)
+L3876:
+	TSET 7, W
+L3877:
+	TSET 6, B
+L3878:
+	BIT 3, E
+L3879:
+	SET 0, (XHL)
+L3880:
+	RES 2, (XHL)
+L3881:
+	RES 4, (XHL)
+L3882:
+	CHG 0, H
+L3883:
+	CHG 0, E
+L3884:
+	TSET 6, B
+L3885:
+	SET 5, W
+L3886:
+	RES 5, (XHL)
+L3887:
+	CHG 2, W
+L3888:
+	BIT 7, (XHL)
+L3889:
+	BIT 4, (XHL)
+L3890:
+	TSET 2, A
+L3891:
+	BIT 5, (XHL)
+L3892:
+	SET 5, C
+L3893:
+	RES 7, (XHL)
+L3894:
+	RES 1, (XHL)
+L3895:
+	SET 6, (XHL)
+L3896:
+	RES 5, (XHL)
+L3897:
+	SET 0, (XHL)
+L3898:
+	RES 1, W
+L3899:
+	TSET 1, A
+L3900:
+	SET 4, (XHL)
+L3901:
+	RES 7, (XHL)
+L3902:
+	SET 3, (XHL)
+L3903:
+	TSET 0, C
+L3904:
+	RES 0, A
+L3905:
+	SET 0, (XHL)
+L3906:
+	CHG 6, C
+L3907:
+	TSET 6, E
+L3908:
+	TSET 0, H
+L3909:
+	SET 0, D
+L3910:
+	RES 4, L
+L3911:
+	BIT 1, (XHL)
+L3912:
+	BIT 5, L
+L3913:
+	BIT 2, L
+L3914:
+	RES 0, (XHL)
+L3915:
+	RES 2, (XHL)
+L3916:
+	CHG 3, L
+L3917:
+	RES 5, (XHL)
+L3918:
+	SET 0, (XHL)
+L3919:
+	SET 0, (XHL)
+L3920:
+	BIT 1, W
+L3921:
+	RES 0, L
+L3922:
+	CHG 4, H
+L3923:
+	SET 2, E
+L3924:
+	RES 7, (XHL)
+L3925:
+	BIT 4, A
+L3926:
+	CHG 5, C
+L3927:
+	CHG 1, B
+L3928:
+	SET 2, (XHL)
+L3929:
+	BIT 3, L
+L3930:
+	RES 5, (XHL)
+L3931:
+	CHG 3, H
+L3932:
+	RES 4, L
+L3933:
+	BIT 4, (XHL)
+L3934:
+	SET 5, (XHL)
+L3935:
+	BIT 1, E
+L3936:
+	RES 5, (XHL)
+L3937:
+	SET 3, B
+L3938:
+	BIT 5, (XHL)
+L3939:
+	SET 3, A
+L3940:
+	CHG 2, D
+L3941:
+	RES 1, W
+L3942:
+	RES 4, (XHL)
+L3943:
+	RES 0, (XHL)
+L3944:
+	RES 3, (XHL)
+L3945:
+	RES 7, (XHL)
+L3946:
+	TSET 2, D
+L3947:
+	TSET 7, E
+L3948:
+	RES 0, (XHL)
+L3949:
+	RES 0, D
+L3950:
+	RES 2, (XHL)
+L3951:
+	SET 1, C
+L3952:
+	CHG 5, A
+L3953:
+	SET 6, (XHL)
+L3954:
+	SET 7, (XHL)
+L3955:
+	BIT 2, C
+L3956:
+	BIT 5, (XHL)
+L3957:
+	RES 1, E
+L3958:
+	SET 0, E
+L3959:
+	SET 6, D
+L3960:
+	BIT 2, W
+L3961:
+	SET 7, (XHL)
+L3962:
+	CHG 0, L
+L3963:
+	CHG 3, E
+L3964:
+	SET 4, (XHL)
+L3965:
+	CHG 4, E
+L3966:
+	SET 0, D
+L3967:
+	BIT 7, D
+L3968:
+	CHG 1, B
+L3969:
+	RES 5, L
+L3970:
+	RES 0, D
+L3971:
+	RES 6, (XHL)
+L3972:
+	BIT 1, (XHL)
+L3973:
+	RES 4, W
+L3974:
+	RES 4, D
+L3975:
+	CHG 5, A
+L3976:
+	SET 3, (XHL)
+L3977:
+	SET 3, (XHL)
+L3978:
+	SET 2, L
+L3979:
+	RES 2, (XHL)
+L3980:
+	TSET 7, C
+L3981:
+	BIT 3, (XHL)
+L3982:
+	RES 7, E
+L3983:
+	RES 3, W
+L3984:
+	SET 7, B
+L3985:
+	SET 7, L
+L3986:
+	BIT 2, A
+L3987:
+	BIT 3, (XHL)
+L3988:
+	SET 3, (XHL)
+L3989:
+	TSET 6, D
+L3990:
+	TSET 4, W
+L3991:
+	SET 3, (XHL)
+L3992:
+	SET 1, (XHL)
+L3993:
+	TSET 7, W
+L3994:
+	TSET 0, A
+L3995:
+	BIT 6, E
+L3996:
+	RES 6, H
+L3997:
+	BIT 5, (XHL)
+L3998:
+	RES 4, (XHL)
+L3999:
+	RES 1, H
+L4000:
+	RES 5, (XHL)
+L4001:
+	BIT 1, (XHL)
+L4002:
+	TSET 6, H
+L4003:
+	BIT 4, H
+L4004:
+	CHG 0, E
+L4005:
+	TSET 3, A
+L4006:
+	RES 5, (XHL)
+L4007:
+	BIT 4, (XHL)
+L4008:
+	BIT 3, C
+L4009:
+	SET 3, (XHL)
+L4010:
+	RES 0, (XHL)
+L4011:
+	BIT 7, (XHL)
+L4012:
+	SET 7, (XHL)
+L4013:
+	RES 6, (XHL)
+L4014:
+	RES 1, (XHL)
+L4015:
+	RES 6, W
+L4016:
+	BIT 2, H
+L4017:
+	RES 4, (XHL)
+L4018:
+	TSET 4, C
+L4019:
+	SET 0, (XHL)
+L4020:
+	RES 5, (XHL)
+L4021:
+	BIT 6, (XHL)
+L4022:
+	RES 1, (XHL)
+L4023:
+	SET 5, (XHL)
+L4024:
+	RES 2, (XHL)
+L4025:
+	RES 0, B
+L4026:
+	SET 2, (XHL)
+L4027:
+	SET 0, (XHL)
+L4028:
+	RES 1, B
+L4029:
+	CHG 6, C
+L4030:
+	RES 0, E
+L4031:
+	SET 4, (XHL)
+L4032:
+	SET 6, (XHL)
+L4033:
+	BIT 6, W
+L4034:
+	RES 5, (XHL)
+L4035:
+	RES 7, B
+L4036:
+	RES 6, (XHL)
+L4037:
+	BIT 4, (XHL)
+L4038:
+	TSET 4, L
+L4039:
+	RES 6, C
+L4040:
+	CHG 1, C
+L4041:
+	CHG 6, L
+L4042:
+	SET 2, L
+L4043:
+	CHG 7, C
+L4044:
+	SET 0, D
+L4045:
+	TSET 5, E
+L4046:
+	SET 4, (XHL)
+L4047:
+	SET 5, E
+L4048:
+	SET 7, (XHL)
+L4049:
+	SET 2, E
+L4050:
+	TSET 4, B
+L4051:
+	SET 0, (XHL)
+L4052:
+	RES 7, (XHL)
+L4053:
+	RES 4, (XHL)
+L4054:
+	BIT 0, (XHL)
+L4055:
+	TSET 6, B
+L4056:
+	RES 3, (XHL)
+L4057:
+	RES 5, (XHL)
+L4058:
+	RES 3, B
+L4059:
+	TSET 5, W
+L4060:
+	CHG 3, E
+L4061:
+	CHG 0, L
+L4062:
+	SET 5, D
+L4063:
+	RES 6, (XHL)
+L4064:
+	RES 3, (XHL)
+L4065:
+	BIT 7, D
+L4066:
+	SET 5, H
+L4067:
+	CHG 1, A
+L4068:
+	RES 6, (XHL)
+L4069:
+	SET 3, (XHL)
+L4070:
+	SET 6, (XHL)
+L4071:
+	SET 6, A
+L4072:
+	BIT 5, (XHL)
+L4073:
+	BIT 6, W
+L4074:
+	BIT 2, A
+L4075:
+	SET 0, (XHL)
+L4076:
+	RES 4, A
+L4077:
+	BIT 4, D
+L4078:
+	RES 0, (XHL)
+L4079:
+	TSET 7, A
+L4080:
+	RES 2, (XHL)
+L4081:
+	BIT 0, (XHL)
+L4082:
+	TSET 0, C
+L4083:
+	TSET 3, A
+L4084:
+	SET 0, A
+L4085:
+	BIT 6, W
+L4086:
+	BIT 1, L
+L4087:
+	RES 1, (XHL)
+L4088:
+	RES 3, W
+L4089:
+	SET 7, E
+L4090:
+	SET 2, (XHL)
+L4091:
+	BIT 6, (XHL)
+L4092:
+	BIT 6, (XHL)
+L4093:
+	RES 2, D
+L4094:
+	BIT 2, D
+L4095:
+	RES 1, L
+L4096:
+	BIT 2, B
+L4097:
+	RES 6, D
+L4098:
+	RES 1, (XHL)
+L4099:
+	RES 1, (XHL)
+L4100:
+	SET 0, (XHL)
+L4101:
+	RES 7, (XHL)
+L4102:
+	SET 0, (XHL)
+L4103:
+	SET 6, E
+L4104:
+	RES 5, E
+L4105:
+	BIT 0, D
+L4106:
+	RES 0, H
+L4107:
+	RES 1, (XHL)
+L4108:
+	RES 6, (XHL)
+L4109:
+	CHG 4, D
+L4110:
+	BIT 7, (XHL)
+L4111:
+	SET 5, (XHL)
+L4112:
+	BIT 2, A
+L4113:
+	SET 5, E
+L4114:
+	TSET 2, L
+L4115:
+	RES 3, (XHL)
+L4116:
+	BIT 3, (XHL)
+L4117:
+	SET 7, (XHL)
+L4118:
+	SET 5, (XHL)
+L4119:
+	BIT 3, E
+L4120:
+	BIT 5, B
+L4121:
+	SET 4, (XHL)
+L4122:
+	SET 4, (XHL)
+L4123:
+	SET 2, (XHL)
+L4124:
+	TSET 3, C
+L4125:
+	RES 7, (XHL)
+L4126:
+	CHG 4, D
+L4127:
+	BIT 5, A
+L4128:
+	BIT 4, (XHL)
+L4129:
+	BIT 1, (XHL)
+L4130:
+	SET 1, (XHL)
+L4131:
+	CHG 7, L
+L4132:
+	RES 5, (XHL)
+L4133:
+	SET 3, (XHL)
+L4134:
+	BIT 2, (XHL)
+L4135:
+	BIT 1, (XHL)
+L4136:
+	SET 7, L
+L4137:
+	SET 3, (XHL)
+L4138:
+	TSET 3, W
+L4139:
+	BIT 6, (XHL)
+L4140:
+	BIT 7, (XHL)
+L4141:
+	CHG 7, D
+L4142:
+	RES 5, B
+L4143:
+	RES 4, H
+L4144:
+	RES 6, (XHL)
+L4145:
+	SET 5, (XHL)
+L4146:
+	BIT 3, (XHL)
+L4147:
+	RES 4, (XHL)
+L4148:
+	SET 0, (XHL)
+L4149:
+	RES 2, (XHL)
+L4150:
+	BIT 0, E
+L4151:
+	SET 4, W
+L4152:
+	BIT 2, (XHL)
+L4153:
+	RES 1, C
+L4154:
+	SET 5, E
+L4155:
+	SET 5, W
+L4156:
+	TSET 1, B
+L4157:
+	RES 6, (XHL)
+L4158:
+	RES 1, (XHL)
+L4159:
+	BIT 3, (XHL)
+L4160:
+	CHG 2, E
+L4161:
+	BIT 4, B
+L4162:
+	BIT 3, H
+L4163:
+	BIT 7, (XHL)
+L4164:
+	SET 0, L
+L4165:
+	BIT 5, (XHL)
+L4166:
+	RES 1, D
+L4167:
+	RES 0, (XHL)
+L4168:
+	SET 7, (XHL)
+L4169:
+	BIT 2, E
+L4170:
+	RES 0, W
+L4171:
+	TSET 3, C
+L4172:
+	TSET 7, L
+L4173:
+	BIT 1, (XHL)
+L4174:
+	SET 4, A
+L4175:
+	TSET 0, L
+L4176:
+	BIT 1, (XHL)
+L4177:
+	RES 7, W
+L4178:
+	SET 0, D
+L4179:
+	BIT 3, A
+L4180:
+	SET 5, (XHL)
+L4181:
+	RES 1, B
+L4182:
+	BIT 4, (XHL)
+L4183:
+	BIT 1, W
+L4184:
+	BIT 1, (XHL)
+L4185:
+	RES 1, B
+L4186:
+	BIT 1, E
+L4187:
+	CHG 0, A
+L4188:
+	SET 7, E
+L4189:
+	TSET 1, D
+L4190:
+	RES 7, (XHL)
+L4191:
+	CHG 2, C
+L4192:
+	SET 2, (XHL)
+L4193:
+	CHG 2, H
+L4194:
+	BIT 5, D
+L4195:
+	RES 7, (XHL)
+L4196:
+	BIT 2, (XHL)
+L4197:
+	BIT 0, (XHL)
+L4198:
+	TSET 2, B
+L4199:
+	RES 3, (XHL)
+L4200:
+	RES 7, C
+L4201:
+	BIT 0, W
+L4202:
+	BIT 0, (XHL)
+L4203:
+	BIT 6, C
+L4204:
+	SET 7, D
+L4205:
+	RES 6, D
+L4206:
+	TSET 3, A
+L4207:
+	SET 1, B
+L4208:
+	SET 5, (XHL)
+L4209:
+	BIT 0, (XHL)
+L4210:
+	SET 1, (XHL)
+L4211:
+	SET 5, (XHL)
+L4212:
+	TSET 3, A
+L4213:
+	RES 0, (XHL)
+L4214:
+	SET 5, A
+L4215:
+	BIT 6, L
+L4216:
+	SET 5, L
+L4217:
+	SET 2, (XHL)
+L4218:
+	TSET 7, D
+L4219:
+	SET 0, (XHL)
+L4220:
+	RES 5, (XHL)
+L4221:
+	SET 2, (XHL)
+L4222:
+	RES 5, (XHL)
+L4223:
+	CHG 6, L
+L4224:
+	RES 5, (XHL)
+L4225:
+	RES 0, (XHL)
+L4226:
+	BIT 1, A
+L4227:
+	SET 3, (XHL)
+L4228:
+	BIT 1, B
+L4229:
+	RES 0, (XHL)
+L4230:
+	RES 3, (XHL)
+L4231:
+	SET 7, E
+L4232:
+	SET 6, W
+L4233:
+	TSET 1, A
+L4234:
+	BIT 3, (XHL)
+L4235:
+	RES 1, (XHL)
+L4236:
+	RES 2, C
+L4237:
+	BIT 5, (XHL)
+L4238:
+	RES 3, H
+L4239:
+	SET 7, (XHL)
+L4240:
+	TSET 3, C
+L4241:
+	RES 5, E
+L4242:
+	SET 2, (XHL)
+L4243:
+	BIT 4, (XHL)
+L4244:
+	CHG 7, H
+L4245:
+	SET 1, E
+L4246:
+	RES 0, C
+L4247:
+	BIT 6, C
+L4248:
+	CHG 2, B
+L4249:
+	SET 2, E
+L4250:
+	RES 3, (XHL)
+L4251:
+	BIT 1, (XHL)
+L4252:
+	RES 2, (XHL)
+L4253:
+	RES 7, (XHL)
+L4254:
+	CHG 2, C
+L4255:
+	BIT 3, (XHL)
+L4256:
+	RES 3, (XHL)
+L4257:
+	BIT 6, (XHL)
+L4258:
+	BIT 6, (XHL)
+L4259:
+	BIT 5, D
+L4260:
+	BIT 7, A
+L4261:
+	BIT 3, (XHL)
+L4262:
+	RES 6, (XHL)
+L4263:
+	BIT 7, (XHL)
+L4264:
+	SET 0, L
+L4265:
+	SET 5, (XHL)
+L4266:
+	SET 0, H
+L4267:
+	RES 1, (XHL)
+L4268:
+	SET 3, (XHL)
+L4269:
+	BIT 7, H
+L4270:
+	SET 5, A
+L4271:
+	BIT 1, (XHL)
+L4272:
+	RES 1, (XHL)
+L4273:
+	RES 4, E
+L4274:
+	SET 2, C
+L4275:
+	BIT 4, (XHL)
+L4276:
+	SET 7, (XHL)
+L4277:
+	RES 3, W
+L4278:
+	TSET 0, A
+L4279:
+	RES 5, (XHL)
+L4280:
+	RES 0, E
+L4281:
+	TSET 7, C
+L4282:
+	TSET 7, D
+L4283:
+	RES 1, H
+L4284:
+	RES 7, (XHL)
+L4285:
+	TSET 1, D
+L4286:
+	BIT 7, (XHL)
+L4287:
+	RES 3, (XHL)
+L4288:
+	BIT 7, (XHL)
+L4289:
+	BIT 3, (XHL)
+L4290:
+	SET 5, (XHL)
+L4291:
+	BIT 6, (XHL)
+L4292:
+	CHG 2, L
+L4293:
+	RES 6, (XHL)
+L4294:
+	RES 2, (XHL)
+L4295:
+	CHG 5, W
+L4296:
+	BIT 5, C
+L4297:
+	BIT 1, H
+L4298:
+	CHG 4, A
+L4299:
+	SET 2, (XHL)
+L4300:
+	SET 0, L
+L4301:
+	BIT 3, (XHL)
+L4302:
+	SET 7, (XHL)
+L4303:
+	SET 7, (XHL)
+L4304:
+	SET 2, H
+L4305:
+	SET 0, (XHL)
+L4306:
+	RES 4, H
+L4307:
+	BIT 6, (XHL)
+L4308:
+	TSET 0, C
+L4309:
+	RES 4, (XHL)
+L4310:
+	RES 1, (XHL)
+L4311:
+	BIT 7, E
+L4312:
+	RES 4, (XHL)
+L4313:
+	BIT 6, B
+L4314:
+	CHG 2, D
+L4315:
+	BIT 3, (XHL)
+L4316:
+	CHG 3, D
+L4317:
+	CHG 0, E
+L4318:
+	BIT 5, (XHL)
+L4319:
+	TSET 6, W
+L4320:
+	SET 0, (XHL)
+L4321:
+	RES 4, (XHL)
+L4322:
+	BIT 5, (XHL)
+L4323:
+	BIT 0, (XHL)
+L4324:
+	RES 3, (XHL)
+L4325:
+	SET 0, D
+L4326:
+	RES 2, (XHL)
+L4327:
+	SET 6, (XHL)
+L4328:
+	CHG 5, C
+L4329:
+	SET 1, (XHL)
+L4330:
+	TSET 0, A
+L4331:
+	RES 7, (XHL)
+L4332:
+	BIT 1, (XHL)
+L4333:
+	SET 6, (XHL)
+L4334:
+	RES 1, (XHL)
+L4335:
+	RES 6, (XHL)
+L4336:
+	RES 0, (XHL)
+L4337:
+	BIT 1, (XHL)
+L4338:
+	BIT 0, (XHL)
+L4339:
+	CHG 5, L
+L4340:
+	RES 6, (XHL)
+L4341:
+	BIT 2, (XHL)
+L4342:
+	SET 5, (XHL)
+L4343:
+	BIT 5, (XHL)
+L4344:
+	BIT 7, C
+L4345:
+	TSET 4, W
+L4346:
+	CHG 5, B
+L4347:
+	RES 5, C
+L4348:
+	BIT 0, D
+L4349:
+	RES 5, (XHL)
+L4350:
+	SET 5, E
+L4351:
+	SET 7, L
+L4352:
+	TSET 5, C
+L4353:
+	BIT 6, (XHL)
+L4354:
+	SET 7, (XHL)
+L4355:
+	BIT 1, (XHL)
+L4356:
+	SET 2, (XHL)
+L4357:
+	RES 5, A
+L4358:
+	BIT 3, (XHL)
+L4359:
+	TSET 5, A
+L4360:
+	BIT 4, B
+L4361:
+	RES 2, (XHL)
+L4362:
+	TSET 0, L
+L4363:
+	CHG 1, H
+L4364:
+	SET 1, (XHL)
+L4365:
+	BIT 0, (XHL)
+L4366:
+	BIT 0, (XHL)
+L4367:
+	SET 1, (XHL)
+L4368:
+	BIT 4, C
+L4369:
+	SET 1, C
+L4370:
+	BIT 1, (XHL)
+L4371:
+	TSET 7, E
+L4372:
+	BIT 3, (XHL)
+L4373:
+	RES 1, W
+L4374:
+	RES 6, (XHL)
+L4375:
+	TSET 3, A
+L4376:
+	SET 6, B
+L4377:
+	CHG 1, B
+L4378:
+	BIT 5, W
+L4379:
+	BIT 2, (XHL)
+L4380:
+	CHG 1, C
+L4381:
+	BIT 0, C
+L4382:
+	BIT 7, (XHL)
+L4383:
+	TSET 7, D
+L4384:
+	BIT 6, (XHL)
+L4385:
+	BIT 2, (XHL)
+L4386:
+	BIT 2, (XHL)
+L4387:
+	BIT 0, (XHL)
+L4388:
+	TSET 3, W
+L4389:
+	RES 2, (XHL)
+L4390:
+	CHG 7, W
+L4391:
+	BIT 6, (XHL)
+L4392:
+	SET 5, (XHL)
+L4393:
+	RES 4, (XHL)
+L4394:
+	BIT 6, (XHL)
+L4395:
+	SET 3, (XHL)
+L4396:
+	SET 1, (XHL)
+L4397:
+	SET 5, D
+L4398:
+	RES 2, (XHL)
+L4399:
+	SET 4, (XHL)
+L4400:
+	RES 2, D
+L4401:
+	BIT 2, (XHL)
+L4402:
+	BIT 0, (XHL)
+L4403:
+	SET 4, A
+L4404:
+	SET 4, (XHL)
+L4405:
+	BIT 2, A
+L4406:
+	TSET 6, H
+L4407:
+	SET 1, D
+L4408:
+	BIT 2, L
+L4409:
+	RES 0, A
+L4410:
+	BIT 7, W
+L4411:
+	SET 0, B
+L4412:
+	BIT 7, (XHL)
+L4413:
+	SET 3, C
+L4414:
+	BIT 1, (XHL)
+L4415:
+	BIT 1, (XHL)
+L4416:
+	SET 3, (XHL)
+L4417:
+	RES 6, (XHL)
+L4418:
+	CHG 6, H
+L4419:
+	RES 0, (XHL)
+L4420:
+	CHG 5, C
+L4421:
+	SET 7, (XHL)
+L4422:
+	RES 6, W
+L4423:
+	SET 4, L
+L4424:
+	SET 7, E
+L4425:
+	BIT 2, (XHL)
+L4426:
+	TSET 3, D
+L4427:
+	RES 1, (XHL)
+L4428:
+	SET 0, W
+L4429:
+	BIT 6, (XHL)
+L4430:
+	SET 5, H
+L4431:
+	RES 1, C
+L4432:
+	SET 2, (XHL)
+L4433:
+	RES 4, E
+L4434:
+	RES 6, C
+L4435:
+	BIT 2, (XHL)
+L4436:
+	CHG 6, B
+L4437:
+	RES 1, (XHL)
+L4438:
+	BIT 2, E
+L4439:
+	BIT 3, (XHL)
+L4440:
+	RES 2, D
+L4441:
+	RES 5, H
+L4442:
+	SET 6, (XHL)
+L4443:
+	CHG 3, B
+L4444:
+	BIT 3, (XHL)
+L4445:
+	BIT 7, W
+L4446:
+	SET 7, (XHL)
+L4447:
+	BIT 6, (XHL)
+L4448:
+	SET 4, A
+L4449:
+	BIT 4, A
+L4450:
+	SET 6, (XHL)
+L4451:
+	RES 1, (XHL)
+L4452:
+	RES 7, B
+L4453:
+	RES 0, B
+L4454:
+	RES 7, H
+L4455:
+	TSET 4, W
+L4456:
+	CHG 7, B
+L4457:
+	TSET 1, W
+L4458:
+	SET 6, (XHL)
+L4459:
+	RES 4, (XHL)
+L4460:
+	RES 7, (XHL)
+L4461:
+	BIT 1, (XHL)
+L4462:
+	SET 6, (XHL)
+L4463:
+	RES 3, (XHL)
+L4464:
+	BIT 5, D
+L4465:
+	RES 0, (XHL)
+L4466:
+	SET 7, (XHL)
+L4467:
+	CHG 6, C
+L4468:
+	RES 3, (XHL)
+L4469:
+	SET 1, (XHL)
+L4470:
+	RES 6, (XHL)
+L4471:
+	TSET 4, A
+L4472:
+	BIT 7, A
+L4473:
+	BIT 7, (XHL)
+L4474:
+	CHG 6, C
+L4475:
+	TSET 7, B
+L4476:
+	SET 0, E
+L4477:
+	RES 3, (XHL)
+L4478:
+	BIT 1, L
+L4479:
+	SET 2, A
+L4480:
+	SET 1, (XHL)
+L4481:
+	RES 1, L
+L4482:
+	SET 1, (XHL)
+L4483:
+	CHG 3, C
+L4484:
+	TSET 3, B
+L4485:
+	BIT 5, (XHL)
+L4486:
+	CHG 2, C
+L4487:
+	SET 2, B
+L4488:
+	SET 4, (XHL)
+L4489:
+	TSET 3, E
+L4490:
+	RES 6, (XHL)
+L4491:
+	SET 4, E
+L4492:
+	TSET 6, D
+L4493:
+	SET 2, (XHL)
+L4494:
+	TSET 2, W
+L4495:
+	RES 5, C
+L4496:
+	SET 6, E
+L4497:
+	RES 5, (XHL)
+L4498:
+	SET 7, (XHL)
+L4499:
+	RES 2, H
+L4500:
+	RES 3, B
+L4501:
+	RES 7, (XHL)
+L4502:
+	SET 2, (XHL)
+L4503:
+	RES 2, (XHL)
+L4504:
+	RES 6, (XHL)
+L4505:
+	SET 7, (XHL)
+L4506:
+	TSET 4, A
+L4507:
+	BIT 1, W
+L4508:
+	SET 7, L
+L4509:
+	TSET 6, A
+L4510:
+	BIT 4, B
+L4511:
+	RES 7, (XHL)
+L4512:
+	SET 3, H
+L4513:
+	SET 3, (XHL)
+L4514:
+	BIT 5, B
+L4515:
+	TSET 1, C
+L4516:
+	RES 3, (XHL)
+L4517:
+	CHG 1, W
+L4518:
+	BIT 2, (XHL)
+L4519:
+	SET 5, (XHL)
+L4520:
+	BIT 3, (XHL)
+L4521:
+	RES 1, (XHL)
+L4522:
+	CHG 1, H
+L4523:
+	RES 7, (XHL)
+L4524:
+	RES 4, H
+L4525:
+	SET 0, (XHL)
+L4526:
+	BIT 6, A
+L4527:
+	SET 4, (XHL)
+L4528:
+	BIT 2, (XHL)
+L4529:
+	SET 2, (XHL)
+L4530:
+	RES 6, (XHL)
+L4531:
+	BIT 4, H
+L4532:
+	SET 4, C
+L4533:
+	SET 0, E
+L4534:
+	BIT 4, E
+L4535:
+	SET 2, B
+L4536:
+	BIT 4, A
+L4537:
+	BIT 5, (XHL)
+L4538:
+	BIT 4, (XHL)
+L4539:
+	TSET 5, A
+L4540:
+	BIT 7, D
+L4541:
+	RES 7, D
+L4542:
+	RES 3, (XHL)
+L4543:
+	RES 1, W
+L4544:
+	RES 7, (XHL)
+L4545:
+	RES 3, (XHL)
+L4546:
+	BIT 7, (XHL)
+L4547:
+	RES 4, (XHL)
+L4548:
+	RES 5, W
+L4549:
+	SET 6, E
+L4550:
+	RES 7, C
+L4551:
+	SET 6, (XHL)
+L4552:
+	CHG 7, L
+L4553:
+	BIT 5, H
+L4554:
+	TSET 2, W
+L4555:
+	SET 7, (XHL)
+L4556:
+	BIT 1, C
+L4557:
+	TSET 4, D
+L4558:
+	SET 7, (XHL)
+L4559:
+	SET 2, (XHL)
+L4560:
+	SET 6, C
+L4561:
+	BIT 4, A
+L4562:
+	BIT 1, (XHL)
+L4563:
+	BIT 6, (XHL)
+L4564:
+	RES 3, (XHL)
+L4565:
+	TSET 7, W
+L4566:
+	SET 1, (XHL)
+L4567:
+	RES 6, B
+L4568:
+	SET 0, (XHL)
+L4569:
+	SET 1, (XHL)
+L4570:
+	CHG 5, H
+L4571:
+	RES 0, (XHL)
+L4572:
+	SET 1, C
+L4573:
+	RES 6, E
+L4574:
+	BIT 0, (XHL)
+L4575:
+	CHG 0, D
+L4576:
+	SET 0, (XHL)
+L4577:
+	SET 6, (XHL)
+L4578:
+	RES 4, E
+L4579:
+	BIT 0, L
+L4580:
+	SET 3, W
+L4581:
+	BIT 5, (XHL)
+L4582:
+	SET 1, L
+L4583:
+	SET 0, W
+L4584:
+	RES 2, W
+L4585:
+	RES 2, D
+L4586:
+	SET 7, B
+L4587:
+	BIT 5, (XHL)
+L4588:
+	SET 4, H
+L4589:
+	BIT 7, W
+L4590:
+	CHG 2, C
+L4591:
+	SET 1, A
+L4592:
+	RES 4, (XHL)
+L4593:
+	BIT 2, (XHL)
+L4594:
+	BIT 7, (XHL)
+L4595:
+	RES 7, (XHL)
+L4596:
+	SET 0, (XHL)
+L4597:
+	RES 6, (XHL)
+L4598:
+	RES 6, H
+L4599:
+	RES 3, (XHL)
+L4600:
+	RES 5, C
+L4601:
+	BIT 6, C
+L4602:
+	SET 3, (XHL)
+L4603:
+	RES 1, (XHL)
+L4604:
+	SET 0, (XHL)
+L4605:
+	SET 2, (XHL)
+L4606:
+	TSET 2, B
+L4607:
+	SET 3, W
+L4608:
+	RES 1, C
+L4609:
+	SET 2, H
+L4610:
+	SET 7, L
+L4611:
+	RES 5, L
+L4612:
+	SET 0, (XHL)
+L4613:
+	SET 7, (XHL)
+L4614:
+	RES 0, A
+L4615:
+	RES 5, H
+L4616:
+	SET 7, A
+L4617:
+	SET 7, (XHL)
+L4618:
+	RES 4, A
+L4619:
+	RES 7, C
+L4620:
+	BIT 4, W
+L4621:
+	RES 7, (XHL)
+L4622:
+	BIT 3, (XHL)
+L4623:
+	RES 3, W
+L4624:
+	RES 7, (XHL)
+L4625:
+	RES 4, (XHL)
+L4626:
+	BIT 3, L
+L4627:
+	CHG 4, D
+L4628:
+	SET 4, L
+L4629:
+	BIT 7, W
+L4630:
+	BIT 5, (XHL)
+L4631:
+	SET 0, A
+L4632:
+	RES 7, (XHL)
+L4633:
+	CHG 0, A
+L4634:
+	TSET 5, C
+L4635:
+	CHG 1, C
+L4636:
+	RES 2, (XHL)
+L4637:
+	BIT 7, (XHL)
+L4638:
+	CHG 1, B
+L4639:
+	BIT 6, (XHL)
+L4640:
+	BIT 2, (XHL)
+L4641:
+	BIT 5, C
+L4642:
+	CHG 3, E
+L4643:
+	RES 4, (XHL)
+L4644:
+	BIT 5, (XHL)
+L4645:
+	SET 6, L
+L4646:
+	SET 6, (XHL)
+L4647:
+	RES 1, (XHL)
+L4648:
+	RES 0, (XHL)
+L4649:
+	SET 7, W
+L4650:
+	BIT 7, (XHL)
+L4651:
+	CHG 2, L
+L4652:
+	RES 3, C
+L4653:
+	SET 3, (XHL)
+L4654:
+	RES 4, (XHL)
+L4655:
+	RES 4, (XHL)
+L4656:
+	BIT 7, (XHL)
+L4657:
+	BIT 3, (XHL)
+L4658:
+	CHG 5, D
+L4659:
+	SET 3, L
+L4660:
+	RES 5, B
+L4661:
+	TSET 2, A
+L4662:
+	BIT 2, (XHL)
+L4663:
+	RES 1, (XHL)
+L4664:
+	BIT 7, A
+L4665:
+	RES 6, W
+L4666:
+	TSET 7, E
+L4667:
+	CHG 0, E
+L4668:
+	BIT 2, B
+L4669:
+	SET 0, D
+L4670:
+	BIT 1, B
+L4671:
+	RES 0, (XHL)
+L4672:
+	TSET 4, E
+L4673:
+	SET 1, C
+L4674:
+	SET 1, (XHL)
+L4675:
+	SET 2, (XHL)
+L4676:
+	RES 6, C
+L4677:
+	RES 5, (XHL)
+L4678:
+	RES 2, (XHL)
+L4679:
+	TSET 7, W
+L4680:
+	RES 7, L
+L4681:
+	SET 6, (XHL)
+L4682:
+	RES 0, D
+L4683:
+	CHG 6, L
+L4684:
+	BIT 6, (XHL)
+L4685:
+	CHG 5, H
+L4686:
+	BIT 4, D
+L4687:
+	BIT 6, (XHL)
+L4688:
+	BIT 1, A
+L4689:
+	BIT 0, (XHL)
+L4690:
+	CHG 7, W
+L4691:
+	BIT 4, W
+L4692:
+	SET 1, (XHL)
+L4693:
+	BIT 0, H
+L4694:
+	TSET 4, L
+L4695:
+	TSET 3, H
+L4696:
+	BIT 0, (XHL)
+L4697:
+	CHG 1, E
+L4698:
+	RES 4, (XHL)
+L4699:
+	BIT 6, (XHL)
+L4700:
+	RES 3, (XHL)
+L4701:
+	CHG 7, D
+L4702:
+	SET 4, H
+L4703:
+	BIT 3, B
+L4704:
+	TSET 3, A
+L4705:
+	RES 2, B
+L4706:
+	SET 6, B
+L4707:
+	SET 3, H
+L4708:
+	TSET 3, C
+L4709:
+	RES 1, W
+L4710:
+	RES 5, (XHL)
+L4711:
+	CHG 7, H
+L4712:
+	SET 3, (XHL)
+L4713:
+	TSET 5, W
+L4714:
+	SET 7, C
+L4715:
+	CHG 3, C
+L4716:
+	SET 2, (XHL)
+L4717:
+	SET 3, A
+L4718:
+	BIT 2, (XHL)
+L4719:
+	BIT 5, (XHL)
+L4720:
+	RES 7, E
+L4721:
+	TSET 3, D
+L4722:
+	CHG 0, B
+L4723:
+	TSET 3, L
+L4724:
+	SET 7, (XHL)
+L4725:
+	SET 5, (XHL)
+L4726:
+	TSET 7, B
+L4727:
+	CHG 2, D
+L4728:
+	SET 0, (XHL)
+L4729:
+	TSET 3, C
+L4730:
+	SET 0, E
+L4731:
+	SET 3, B
+L4732:
+	BIT 1, (XHL)
+L4733:
+	RES 3, (XHL)
+L4734:
+	RES 2, (XHL)
+L4735:
+	BIT 5, (XHL)
+L4736:
+	SET 3, D
+L4737:
+	BIT 0, (XHL)
+L4738:
+	CHG 7, A
+L4739:
+	BIT 6, (XHL)
+L4740:
+	RES 1, (XHL)
+L4741:
+	SET 5, (XHL)
+L4742:
+	BIT 3, D
+L4743:
+	RES 2, E
+L4744:
+	SET 5, (XHL)
+L4745:
+	RES 4, C
+L4746:
+	BIT 4, (XHL)
+L4747:
+	SET 4, L
+L4748:
+	SET 0, A
+L4749:
+	BIT 3, (XHL)
+L4750:
+	RES 3, (XHL)
+L4751:
+	RES 2, D
+L4752:
+	BIT 5, (XHL)
+L4753:
+	RES 1, D
+L4754:
+	RES 6, H
+L4755:
+	BIT 4, L
+L4756:
+	TSET 2, D
+L4757:
+	TSET 6, H
+L4758:
+	BIT 4, (XHL)
+L4759:
+	BIT 7, W
+L4760:
+	BIT 3, (XHL)
+L4761:
+	RES 6, (XHL)
+L4762:
+	BIT 1, (XHL)
+L4763:
+	SET 5, E
+L4764:
+	SET 2, (XHL)
+L4765:
+	RES 0, (XHL)
+L4766:
+	TSET 1, L
+L4767:
+	CHG 3, B
+L4768:
+	RES 6, C
+L4769:
+	BIT 4, (XHL)
+L4770:
+	BIT 6, D
+L4771:
+	SET 6, (XHL)
+L4772:
+	SET 2, W
+L4773:
+	RES 1, (XHL)
+L4774:
+	RES 1, L
+L4775:
+	CHG 6, A
+L4776:
+	SET 4, (XHL)
+L4777:
+	SET 6, E
+L4778:
+	BIT 5, B
+L4779:
+	RES 2, (XHL)
+L4780:
+	CHG 7, W
+L4781:
+	TSET 0, C
+L4782:
+	RES 6, (XHL)
+L4783:
+	BIT 6, (XHL)
+L4784:
+	RES 4, (XHL)
+L4785:
+	BIT 5, A
+L4786:
+	BIT 6, (XHL)
+L4787:
+	BIT 1, (XHL)
+L4788:
+	SET 7, E
+L4789:
+	CHG 3, B
+L4790:
+	TSET 3, A
+L4791:
+	BIT 0, (XHL)
+L4792:
+	BIT 0, (XHL)
+L4793:
+	SET 7, (XHL)
+L4794:
+	SET 1, D
+L4795:
+	SET 4, (XHL)
+L4796:
+	RES 4, (XHL)
+L4797:
+	RES 4, (XHL)
+L4798:
+	BIT 6, (XHL)
+L4799:
+	SET 6, (XHL)
+L4800:
+	RES 4, (XHL)
+L4801:
+	BIT 7, (XHL)
+L4802:
+	RES 7, (XHL)
+L4803:
+	TSET 0, D
+L4804:
+	BIT 5, (XHL)
+L4805:
+	SET 1, (XHL)
+L4806:
+	SET 6, (XHL)
+L4807:
+	RES 5, (XHL)
+L4808:
+	SET 2, (XHL)
+L4809:
+	RES 0, (XHL)
+L4810:
+	SET 6, (XHL)
+L4811:
+	SET 6, (XHL)
+L4812:
+	RES 6, (XHL)
+L4813:
+	BIT 1, (XHL)
+L4814:
+	RES 2, B
+L4815:
+	BIT 5, C
+L4816:
+	RES 6, (XHL)
+L4817:
+	BIT 1, W
+L4818:
+	BIT 4, (XHL)
+L4819:
+	TSET 0, H
+L4820:
+	BIT 5, E
+L4821:
+	CHG 0, H
+L4822:
+	BIT 1, (XHL)
+L4823:
+	RES 0, (XHL)
+L4824:
+	TSET 1, L
+L4825:
+	SET 4, (XHL)
+L4826:
+	RES 0, B
+L4827:
+	RES 1, D
+L4828:
+	CHG 6, B
+L4829:
+	SET 6, (XHL)
+L4830:
+	RES 3, H
+L4831:
+	RES 1, (XHL)
+L4832:
+	CHG 3, E
+L4833:
+	SET 7, (XHL)
+L4834:
+	BIT 6, B
+L4835:
+	BIT 0, L
+L4836:
+	SET 6, (XHL)
+L4837:
+	RES 4, C
+L4838:
+	SET 4, (XHL)
+L4839:
+	SET 4, L
+L4840:
+	SET 3, (XHL)
+L4841:
+	CHG 6, D
+L4842:
+	TSET 4, L
+L4843:
+	RES 3, (XHL)
+L4844:
+	CHG 2, D
+L4845:
+	RES 4, (XHL)
+L4846:
+	RES 0, (XHL)
+L4847:
+	BIT 0, (XHL)
+L4848:
+	TSET 7, C
+L4849:
+	SET 4, (XHL)
+L4850:
+	SET 5, (XHL)
+L4851:
+	SET 2, D
+L4852:
+	TSET 3, H
+L4853:
+	RES 2, (XHL)
+L4854:
+	RES 4, E
+L4855:
+	BIT 5, (XHL)
+L4856:
+	BIT 3, (XHL)
+L4857:
+	BIT 5, (XHL)
+L4858:
+	CHG 1, D
+L4859:
+	TSET 1, A
+L4860:
+	TSET 6, B
+L4861:
+	BIT 3, W
+L4862:
+	CHG 4, C
+L4863:
+	SET 0, (XHL)
+L4864:
+	BIT 5, (XHL)
+L4865:
+	RES 7, (XHL)
+L4866:
+	RES 3, (XHL)
+L4867:
+	SET 7, (XHL)
+L4868:
+	SET 2, E
+L4869:
+	BIT 3, (XHL)
+L4870:
+	SET 5, (XHL)
+L4871:
+	TSET 3, B
+L4872:
+	RES 7, (XHL)
+L4873:
+	BIT 6, (XHL)
+L4874:
+	BIT 0, (XHL)
+L4875:
+	SET 3, (XHL)
+L4876:
+	RES 1, (XHL)
+L4877:
+	RES 5, (XHL)
+L4878:
+	BIT 7, (XHL)
+L4879:
+	BIT 7, (XHL)
+L4880:
+	BIT 2, (XHL)
+L4881:
+	RES 1, (XHL)
+L4882:
+	RES 6, E
+L4883:
+	CHG 1, W
+L4884:
+	TSET 5, B
+L4885:
+	BIT 7, (XHL)
+L4886:
+	BIT 3, (XHL)
+L4887:
+	RES 5, (XHL)
+L4888:
+	RES 0, (XHL)
+L4889:
+	RES 2, (XHL)
+L4890:
+	TSET 0, W
+L4891:
+	RES 0, D
+L4892:
+	BIT 5, (XHL)
+L4893:
+	SET 1, W
+L4894:
+	RES 4, (XHL)
+L4895:
+	RES 5, L
+L4896:
+	SET 2, (XHL)
+L4897:
+	RES 2, B
+L4898:
+	SET 1, A
+L4899:
+	TSET 3, D
+L4900:
+	SET 3, H
+L4901:
+	SET 6, B
+L4902:
+	CHG 1, H
+L4903:
+	RES 3, (XHL)
+L4904:
+	RES 5, B
+L4905:
+	SET 0, (XHL)
+L4906:
+	BIT 2, (XHL)
+L4907:
+	TSET 7, L
+L4908:
+	BIT 5, (XHL)
+L4909:
+	SET 3, (XHL)
+L4910:
+	RES 4, (XHL)
+L4911:
+	CHG 1, W
+L4912:
+	SET 3, (XHL)
+L4913:
+	SET 3, (XHL)
+L4914:
+	SET 0, (XHL)
+L4915:
+	RES 6, B
+L4916:
+	SET 3, (XHL)
+L4917:
+	BIT 4, (XHL)
+L4918:
+	RES 7, (XHL)
+L4919:
+	RES 3, E
+L4920:
+	SET 2, A
+L4921:
+	BIT 2, (XHL)
+L4922:
+	BIT 3, (XHL)
+L4923:
+	SET 1, C
+L4924:
+	BIT 6, B
+L4925:
+	RES 6, C
+L4926:
+	SET 3, (XHL)
+L4927:
+	RES 2, (XHL)
+L4928:
+	TSET 7, E
+L4929:
+	RES 4, D
+L4930:
+	TSET 0, H
+L4931:
+	RES 0, B
+L4932:
+	RES 3, E
+L4933:
+	SET 0, (XHL)
+L4934:
+	TSET 7, E
+L4935:
+	BIT 5, (XHL)
+L4936:
+	SET 5, D
+L4937:
+	TSET 5, D
+L4938:
+	CHG 2, B
+L4939:
+	BIT 2, (XHL)
+L4940:
+	SET 4, (XHL)
+L4941:
+	SET 7, E
+L4942:
+	SET 0, (XHL)
+L4943:
+	RES 6, (XHL)
+L4944:
+	SET 4, (XHL)
+L4945:
+	CHG 2, C
+L4946:
+	SET 4, (XHL)
+L4947:
+	SET 2, (XHL)
+L4948:
+	SET 2, (XHL)
+L4949:
+	SET 2, (XHL)
+L4950:
+	RES 6, (XHL)
+L4951:
+	RES 6, (XHL)
+L4952:
+	SET 6, (XHL)
+L4953:
+	RES 3, B
+L4954:
+	RES 7, A
+L4955:
+	RES 3, A
+L4956:
+	RES 5, (XHL)
+L4957:
+	RES 4, (XHL)
+L4958:
+	RES 7, (XHL)
+L4959:
+	SET 0, (XHL)
+L4960:
+	TSET 5, E
+L4961:
+	TSET 1, L
+L4962:
+	RES 0, L
+L4963:
+	RES 1, (XHL)
+L4964:
+	BIT 0, A
+L4965:
+	CHG 4, L
+L4966:
+	CHG 3, A
+L4967:
+	CHG 5, C
+L4968:
+	RES 4, (XHL)
+L4969:
+	RES 1, D
+L4970:
+	RES 7, D
+L4971:
+	TSET 4, A
+L4972:
+	RES 6, (XHL)
+L4973:
+	SET 1, B
+L4974:
+	SET 0, (XHL)
+L4975:
+	RES 6, (XHL)
+L4976:
+	BIT 0, (XHL)
+L4977:
+	BIT 6, (XHL)
+L4978:
+	RES 4, (XHL)
+L4979:
+	CHG 2, A
+L4980:
+	SET 4, (XHL)
+L4981:
+	TSET 2, B
+L4982:
+	SET 0, (XHL)
+L4983:
+	RES 5, (XHL)
+L4984:
+	BIT 2, (XHL)
+L4985:
+	CHG 6, L
+L4986:
+	RES 6, C
+L4987:
+	SET 7, (XHL)
+L4988:
+	BIT 0, (XHL)
+L4989:
+	TSET 3, C
+L4990:
+	RES 1, (XHL)
+L4991:
+	RES 0, D
+L4992:
+	SET 6, (XHL)
+L4993:
+	SET 7, (XHL)
+L4994:
+	BIT 2, (XHL)
+L4995:
+	SET 1, (XHL)
+L4996:
+	TSET 0, H
+L4997:
+	SET 1, (XHL)
+L4998:
+	RES 1, (XHL)
+L4999:
+	SET 5, B
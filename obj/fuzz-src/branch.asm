@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	JRL L1
+L1:
+	JRL L0
+L2:
+	JR OV, L2
+L3:
+	JP NZ, L0
+L4:
+	JP PL, L4859
+L5:
+	DJNZ B, L6
+L6:
+	JRL L10
+L7:
+	JP GT, L7
+L8:
+	JR Z, L12
+L9:
+	CALL L13
+L10:
+	JR MI, L14
+L11:
+	DJNZ B, L10
+L12:
+	JRL L10
+L13:
+	JP NZ, L14
+L14:
+	DJNZ B, L15
+L15:
+	CALL L16
+L16:
+	JP NZ, L1599
+L17:
+	JRL L19
+L18:
+	DJNZ B, L14
+L19:
+	JR C, L16
+L20:
+	JP LE, L18
+L21:
+	JP PL, L17
+L22:
+	JP Z, L24
+L23:
+	JP Z, L4533
+L24:
+	JP Z, L20
+L25:
+	CALL L21
+L26:
+	JRL L4896
+L27:
+	JR LE, L29
+L28:
+	DJNZ B, L30
+L29:
+	JRL L27
+L30:
+	CALL L3805
+L31:
+	JRL L1891
+L32:
+	CALL L30
+L33:
+	JR NC, L31
+L34:
+	CALL L34
+L35:
+	CALL L3014
+L36:
+	JP Z, L37
+L37:
+	JRL L41
+L38:
+	JR GT, L36
+L39:
+	JR GT, L42
+L40:
+	JR NZ, L39
+L41:
+	DJNZ B, L42
+L42:
+	DJNZ B, L44
+L43:
+	DJNZ B, L42
+L44:
+	JP PL, L42
+L45:
+	DJNZ B, L47
+L46:
+	JP C, L2115
+L47:
+	JR OV, L49
+L48:
+	CALL L49
+L49:
+	JP OV, L4391
+L50:
+	DJNZ B, L50
+L51:
+	JR T, L53
+L52:
+	JP Z, L56
+L53:
+	DJNZ B, L50
+L54:
+	JR GT, L53
+L55:
+	JP T, L51
+L56:
+	DJNZ B, L60
+L57:
+	JR MI, L61
+L58:
+	DJNZ B, L58
+L59:
+	JR C, L63
+L60:
+	JP NZ, L57
+L61:
+	JP PL, L4748
+L62:
+	JP NZ, L4668
+L63:
+	JRL L59
+L64:
+	JRL L61
+L65:
+	CALL L539
+L66:
+	DJNZ B, L66
+L67:
+	JR NC, L71
+L68:
+	JRL L134
+L69:
+	JP NC, L70
+L70:
+	JR NZ, L69
+L71:
+	JR Z, L70
+L72:
+	JP NZ, L71
+L73:
+	JR NZ, L76
+L74:
+	JP NZ, L71
+L75:
+	DJNZ B, L76
+L76:
+	DJNZ B, L74
+L77:
+	CALL L80
+L78:
+	CALL L75
+L79:
+	JR NZ, L82
+L80:
+	JRL L2186
+L81:
+	CALL L79
+L82:
+	DJNZ B, L85
+L83:
+	CALL L87
+L84:
+	JP LE, L85
+L85:
+	JRL L4233
+L86:
+	DJNZ B, L88
+L87:
+	JRL L1700
+L88:
+	CALL L90
+L89:
+	JRL L92
+L90:
+	JR PL, L91
+L91:
+	JR LE, L87
+L92:
+	DJNZ B, L95
+L93:
+	JRL L96
+L94:
+	DJNZ B, L95
+L95:
+	JP LE, L99
+L96:
+	DJNZ B, L99
+L97:
+	JRL L93
+L98:
+	JP NC, L94
+L99:
+	JP C, L99
+L100:
+	CALL L98
+L101:
+	JRL L104
+L102:
+	CALL L102
+L103:
+	JRL L107
+L104:
+	JRL L107
+L105:
+	JR T, L103
+L106:
+	DJNZ B, L109
+L107:
+	CALL L107
+L108:
+	DJNZ B, L106
+L109:
+	JRL L109
+L110:
+	JRL L110
+L111:
+	JR NC, L110
+L112:
+	DJNZ B, L108
+L113:
+	JP GT, L111
+L114:
+	JR NC, L118
+L115:
+	JRL L112
+L116:
+	CALL L120
+L117:
+	JR C, L115
+L118:
+	JR Z, L118
+L119:
+	JRL L115
+L120:
+	JR OV, L122
+L121:
+	JR NC, L125
+L122:
+	JRL L124
+L123:
+	DJNZ B, L123
+L124:
+	JP OV, L127
+L125:
+	CALL L128
+L126:
+	JR OV, L130
+L127:
+	CALL L124
+L128:
+	CALL L131
+L129:
+	CALL L3523
+L130:
+	JRL L2484
+L131:
+	JP NC, L135
+L132:
+	DJNZ B, L131
+L133:
+	DJNZ B, L137
+L134:
+	JRL L4581
+L135:
+	JP LE, L135
+L136:
+	DJNZ B, L134
+L137:
+	JRL L3096
+L138:
+	JRL L138
+L139:
+	JR GT, L137
+L140:
+	CALL L136
+L141:
+	JP T, L4344
+L142:
+	JP C, L4078
+L143:
+	JR NZ, L145
+L144:
+	JRL L142
+L145:
+	CALL L149
+L146:
+	JR C, L149
+L147:
+	JP MI, L149
+L148:
+	JRL L3804
+L149:
+	DJNZ B, L147
+L150:
+	DJNZ B, L150
+L151:
+	JP LE, L147
+L152:
+	JP NC, L156
+L153:
+	CALL L152
+L154:
+	CALL L158
+L155:
+	JP GT, L151
+L156:
+	JRL L751
+L157:
+	CALL L156
+L158:
+	JRL L158
+L159:
+	JR GT, L160
+L160:
+	JR C, L161
+L161:
+	CALL L806
+L162:
+	JRL L166
+L163:
+	DJNZ B, L166
+L164:
+	CALL L165
+L165:
+	JP PL, L89
+L166:
+	CALL L3467
+L167:
+	JP LE, L3386
+L168:
+	JR NC, L167
+L169:
+	CALL L167
+L170:
+	JP PL, L168
+L171:
+	CALL L4182
+L172:
+	JP C, L3387
+L173:
+	JP OV, L4272
+L174:
+	CALL L178
+L175:
+	CALL L2586
+L176:
+	JR GT, L178
+L177:
+	JP OV, L277
+L178:
+	DJNZ B, L175
+L179:
+	CALL L177
+L180:
+	JR NZ, L176
+L181:
+	JP NC, L184
+L182:
+	JP PL, L179
+L183:
+	JRL L181
+L184:
+	JR C, L183
+L185:
+	JR GT, L189
+L186:
+	CALL L190
+L187:
+	CALL L188
+L188:
+	DJNZ B, L188
+L189:
+	DJNZ B, L185
+L190:
+	DJNZ B, L194
+L191:
+	JR NC, L187
+L192:
+	DJNZ B, L190
+L193:
+	DJNZ B, L194
+L194:
+	CALL L195
+L195:
+	JRL L4184
+L196:
+	JP PL, L199
+L197:
+	JP NC, L3226
+L198:
+	JP C, L200
+L199:
+	JRL L199
+L200:
+	JR GT, L197
+L201:
+	JR C, L200
+L202:
+	JR NC, L205
+L203:
+	DJNZ B, L207
+L204:
+	CALL L204
+L205:
+	JP LE, L206
+L206:
+	JRL L2264
+L207:
+	JR MI, L205
+L208:
+	DJNZ B, L209
+L209:
+	JR OV, L212
+L210:
+	CALL L3020
+L211:
+	JP C, L215
+L212:
+	JR GT, L210
+L213:
+	JRL L215
+L214:
+	JP MI, L217
+L215:
+	JR PL, L212
+L216:
+	JP GT, L3025
+L217:
+	DJNZ B, L217
+L218:
+	JRL L221
+L219:
+	JRL L219
+L220:
+	DJNZ B, L219
+L221:
+	DJNZ B, L221
+L222:
+	CALL L222
+L223:
+	JRL L224
+L224:
+	JRL L222
+L225:
+	JR GT, L229
+L226:
+	JRL L223
+L227:
+	CALL L4251
+L228:
+	DJNZ B, L226
+L229:
+	JP OV, L2114
+L230:
+	JRL L229
+L231:
+	DJNZ B, L234
+L232:
+	DJNZ B, L230
+L233:
+	JR GT, L235
+L234:
+	JP T, L236
+L235:
+	CALL L233
+L236:
+	JR MI, L236
+L237:
+	JR MI, L236
+L238:
+	CALL L237
+L239:
+	JR T, L237
+L240:
+	DJNZ B, L237
+L241:
+	JRL L243
+L242:
+	DJNZ B, L243
+L243:
+	JP NC, L2070
+L244:
+	CALL L240
+L245:
+	JP Z, L1604
+L246:
+	CALL L244
+L247:
+	JRL L247
+L248:
+	JP OV, L252
+L249:
+	JP MI, L252
+L250:
+	JR NC, L246
+L251:
+	JRL L250
+L252:
+	JRL L255
+L253:
+	CALL L4486
+L254:
+	JR MI, L256
+L255:
+	JR C, L255
+L256:
+	JP MI, L258
+L257:
+	JRL L256
+L258:
+	DJNZ B, L262
+L259:
+	JRL L263
+L260:
+	DJNZ B, L256
+L261:
+	DJNZ B, L264
+L262:
+	JRL L266
+L263:
+	JR NC, L261
+L264:
+	JP NZ, L263
+L265:
+	CALL L1112
+L266:
+	DJNZ B, L269
+L267:
+	CALL L269
+L268:
+	JRL L270
+L269:
+	CALL L265
+L270:
+	CALL L3
+L271:
+	DJNZ B, L271
+L272:
+	DJNZ B, L274
+L273:
+	JRL L269
+L274:
+	DJNZ B, L276
+L275:
+	JR NZ, L271
+L276:
+	JR T, L273
+L277:
+	CALL L281
+L278:
+	JR LE, L280
+L279:
+	JR PL, L276
+L280:
+	CALL L280
+L281:
+	JP PL, L3298
+L282:
+	JR LE, L280
+L283:
+	JP T, L1355
+L284:
+	CALL L288
+L285:
+	JRL L2181
+L286:
+	JP Z, L765
+L287:
+	JR T, L289
+L288:
+	JP LE, L2219
+L289:
+	JR C, L292
+L290:
+	JP Z, L291
+L291:
+	JRL L290
+L292:
+	JR T, L294
+L293:
+	JP OV, L2560
+L294:
+	DJNZ B, L295
+L295:
+	JR LE, L293
+L296:
+	JR Z, L297
+L297:
+	DJNZ B, L294
+L298:
+	JP Z, L3377
+L299:
+	CALL L302
+L300:
+	JP OV, L297
+L301:
+	JRL L300
+L302:
+	CALL L2039
+L303:
+	DJNZ B, L299
+L304:
+	CALL L303
+L305:
+	DJNZ B, L306
+L306:
+	JRL L314
+L307:
+	JR GT, L308
+L308:
+	JP Z, L4800
+L309:
+	JP T, L3600
+L310:
+	CALL L308
+L311:
+	DJNZ B, L308
+L312:
+	CALL L312
+L313:
+	JP MI, L2077
+L314:
+	JR NZ, L310
+L315:
+	DJNZ B, L314
+L316:
+	JRL L248
+L317:
+	JRL L321
+L318:
+	JR NC, L317
+L319:
+	JP NC, L318
+L320:
+	JRL L323
+L321:
+	JRL L318
+L322:
+	DJNZ B, L322
+L323:
+	JP NC, L1597
+L324:
+	JP C, L328
+L325:
+	CALL L328
+L326:
+	CALL L324
+L327:
+	JP OV, L2350
+L328:
+	JR C, L327
+L329:
+	JRL L330
+L330:
+	JP NZ, L334
+L331:
+	CALL L327
+L332:
+	CALL L4254
+L333:
+	CALL L336
+L334:
+	JP NZ, L331
+L335:
+	JR T, L338
+L336:
+	DJNZ B, L340
+L337:
+	JP LE, L2614
+L338:
+	JP NC, L339
+L339:
+	JP MI, L337
+L340:
+	CALL L4638
+L341:
+	JR NZ, L339
+L342:
+	DJNZ B, L345
+L343:
+	JR PL, L342
+L344:
+	DJNZ B, L344
+L345:
+	JP OV, L348
+L346:
+	DJNZ B, L344
+L347:
+	JR Z, L344
+L348:
+	JP LE, L352
+L349:
+	JRL L353
+L350:
+	JRL L354
+L351:
+	JP MI, L348
+L352:
+	CALL L355
+L353:
+	JR C, L350
+L354:
+	JP PL, L4948
+L355:
+	DJNZ B, L357
+L356:
+	JRL L352
+L357:
+	JRL L354
+L358:
+	JRL L360
+L359:
+	JP GT, L359
+L360:
+	JP MI, L363
+L361:
+	JP OV, L116
+L362:
+	DJNZ B, L358
+L363:
+	JR OV, L363
+L364:
+	JR NC, L365
+L365:
+	CALL L366
+L366:
+	JRL L2422
+L367:
+	JR NZ, L367
+L368:
+	DJNZ B, L368
+L369:
+	CALL L372
+L370:
+	CALL L366
+L371:
+	JRL L372
+L372:
+	CALL L368
+L373:
+	JR Z, L372
+L374:
+	JR LE, L370
+L375:
+	JRL L375
+L376:
+	JP NC, L373
+L377:
+	JP OV, L4487
+L378:
+	DJNZ B, L381
+L379:
+	JR NZ, L380
+L380:
+	CALL L381
+L381:
+	JR NZ, L380
+L382:
+	DJNZ B, L380
+L383:
+	DJNZ B, L382
+L384:
+	DJNZ B, L387
+L385:
+	DJNZ B, L383
+L386:
+	JRL L385
+L387:
+	JRL L388
+L388:
+	JRL L2161
+L389:
+	CALL L391
+L390:
+	CALL L386
+L391:
+	JR PL, L390
+L392:
+	JR PL, L392
+L393:
+	JRL L391
+L394:
+	JR C, L392
+L395:
+	JR GT, L395
+L396:
+	CALL L395
+L397:
+	JP PL, L1236
+L398:
+	JP T, L3209
+L399:
+	DJNZ B, L395
+L400:
+	CALL L396
+L401:
+	JRL L4694
+L402:
+	JR NC, L399
+L403:
+	JP LE, L402
+L404:
+	JR C, L405
+L405:
+	JRL L407
+L406:
+	CALL L409
+L407:
+	JRL L405
+L408:
+	JR PL, L404
+L409:
+	DJNZ B, L406
+L410:
+	JR MI, L413
+L411:
+	JRL L409
+L412:
+	JR GT, L415
+L413:
+	CALL L413
+L414:
+	JP Z, L417
+L415:
+	DJNZ B, L411
+L416:
+	JRL L416
+L417:
+	JR LE, L419
+L418:
+	JRL L414
+L419:
+	JP OV, L419
+L420:
+	CALL L423
+L421:
+	JP GT, L417
+L422:
+	JR MI, L420
+L423:
+	JRL L419
+L424:
+	DJNZ B, L421
+L425:
+	JP NC, L423
+L426:
+	CALL L429
+L427:
+	CALL L3303
+L428:
+	CALL L1526
+L429:
+	DJNZ B, L430
+L430:
+	CALL L522
+L431:
+	DJNZ B, L430
+L432:
+	JR C, L434
+L433:
+	JRL L436
+L434:
+	CALL L438
+L435:
+	JP Z, L436
+L436:
+	JP OV, L3788
+L437:
+	CALL L438
+L438:
+	JP OV, L2089
+L439:
+	DJNZ B, L440
+L440:
+	JRL L438
+L441:
+	DJNZ B, L443
+L442:
+	CALL L441
+L443:
+	JRL L446
+L444:
+	JR NC, L446
+L445:
+	DJNZ B, L443
+L446:
+	DJNZ B, L449
+L447:
+	JP C, L446
+L448:
+	JRL L451
+L449:
+	DJNZ B, L453
+L450:
+	JRL L4687
+L451:
+	JR NC, L453
+L452:
+	CALL L454
+L453:
+	JRL L450
+L454:
+	CALL L451
+L455:
+	JP Z, L1834
+L456:
+	JR LE, L456
+L457:
+	JP NC, L2690
+L458:
+	JRL L459
+L459:
+	JRL L461
+L460:
+	DJNZ B, L464
+L461:
+	CALL L458
+L462:
+	CALL L501
+L463:
+	JR LE, L465
+L464:
+	JRL L1735
+L465:
+	JR NC, L464
+L466:
+	JRL L786
+L467:
+	CALL L463
+L468:
+	JRL L1959
+L469:
+	CALL L470
+L470:
+	JR OV, L470
+L471:
+	JRL L2975
+L472:
+	DJNZ B, L474
+L473:
+	JRL L470
+L474:
+	JR C, L478
+L475:
+	JP NZ, L478
+L476:
+	JRL L333
+L477:
+	DJNZ B, L478
+L478:
+	JP C, L479
+L479:
+	DJNZ B, L478
+L480:
+	JP NZ, L476
+L481:
+	DJNZ B, L477
+L482:
+	CALL L479
+L483:
+	JR Z, L481
+L484:
+	CALL L487
+L485:
+	JP MI, L482
+L486:
+	DJNZ B, L488
+L487:
+	DJNZ B, L485
+L488:
+	JR LE, L491
+L489:
+	CALL L485
+L490:
+	JR T, L489
+L491:
+	JRL L495
+L492:
+	JP T, L496
+L493:
+	JR C, L496
+L494:
+	JR Z, L493
+L495:
+	JR LE, L497
+L496:
+	JR C, L495
+L497:
+	JP C, L497
+L498:
+	DJNZ B, L501
+L499:
+	JP NC, L498
+L500:
+	JR GT, L501
+L501:
+	JR NC, L500
+L502:
+	JR PL, L506
+L503:
+	JP GT, L505
+L504:
+	CALL L508
+L505:
+	DJNZ B, L506
+L506:
+	DJNZ B, L508
+L507:
+	JR T, L504
+L508:
+	JRL L1136
+L509:
+	CALL L512
+L510:
+	JP MI, L507
+L511:
+	DJNZ B, L512
+L512:
+	CALL L4529
+L513:
+	JP T, L514
+L514:
+	JP MI, L514
+L515:
+	JR Z, L516
+L516:
+	DJNZ B, L512
+L517:
+	DJNZ B, L517
+L518:
+	DJNZ B, L521
+L519:
+	JRL L4411
+L520:
+	JR PL, L523
+L521:
+	CALL L1158
+L522:
+	JRL L519
+L523:
+	JP T, L1920
+L524:
+	CALL L2754
+L525:
+	JP NZ, L525
+L526:
+	JRL L527
+L527:
+	JR T, L523
+L528:
+	JP OV, L531
+L529:
+	CALL L532
+L530:
+	DJNZ B, L530
+L531:
+	JRL L534
+L532:
+	CALL L536
+L533:
+	JRL L533
+L534:
+	JR C, L538
+L535:
+	JRL L455
+L536:
+	CALL L537
+L537:
+	JR GT, L539
+L538:
+	JP NZ, L536
+L539:
+	JR PL, L539
+L540:
+	JRL L181
+L541:
+	CALL L4407
+L542:
+	DJNZ B, L539
+L543:
+	JP GT, L543
+L544:
+	JR NC, L544
+L545:
+	JP LE, L543
+L546:
+	JP Z, L542
+L547:
+	JR NZ, L551
+L548:
+	JRL L545
+L549:
+	JR PL, L548
+L550:
+	JRL L553
+L551:
+	DJNZ B, L549
+L552:
+	JP NC, L412
+L553:
+	JP Z, L551
+L554:
+	DJNZ B, L553
+L555:
+	DJNZ B, L554
+L556:
+	DJNZ B, L554
+L557:
+	DJNZ B, L555
+L558:
+	CALL L556
+L559:
+	JP MI, L561
+L560:
+	JP GT, L563
+L561:
+	DJNZ B, L565
+L562:
+	JR GT, L565
+L563:
+	JRL L1579
+L564:
+	CALL L562
+L565:
+	JR T, L561
+L566:
+	JRL L567
+L567:
+	JRL L567
+L568:
+	JR NZ, L568
+L569:
+	JR NC, L571
+L570:
+	JR GT, L574
+L571:
+	CALL L1621
+L572:
+	JR NC, L570
+L573:
+	DJNZ B, L575
+L574:
+	JRL L570
+L575:
+	JP PL, L572
+L576:
+	JP NC, L575
+L577:
+	CALL L575
+L578:
+	JR MI, L575
+L579:
+	JR T, L581
+L580:
+	CALL L582
+L581:
+	JP GT, L581
+L582:
+	JR OV, L579
+L583:
+	CALL L583
+L584:
+	DJNZ B, L585
+L585:
+	JRL L1603
+L586:
+	JR T, L584
+L587:
+	CALL L899
+L588:
+	CALL L591
+L589:
+	CALL L585
+L590:
+	JRL L591
+L591:
+	DJNZ B, L593
+L592:
+	JR OV, L589
+L593:
+	JP Z, L591
+L594:
+	CALL L597
+L595:
+	JR Z, L592
+L596:
+	DJNZ B, L599
+L597:
+	JR OV, L596
+L598:
+	DJNZ B, L596
+L599:
+	DJNZ B, L601
+L600:
+	JRL L600
+L601:
+	JR NC, L601
+L602:
+	CALL L601
+L603:
+	CALL L604
+L604:
+	JP MI, L606
+L605:
+	CALL L604
+L606:
+	JR T, L606
+L607:
+	DJNZ B, L611
+L608:
+	DJNZ B, L612
+L609:
+	DJNZ B, L612
+L610:
+	JRL L3199
+L611:
+	JRL L607
+L612:
+	CALL L739
+L613:
+	DJNZ B, L614
+L614:
+	JR PL, L618
+L615:
+	JR OV, L611
+L616:
+	CALL L619
+L617:
+	CALL L1658
+L618:
+	JP LE, L622
+L619:
+	JR NC, L615
+L620:
+	JP MI, L620
+L621:
+	CALL L624
+L622:
+	JR NZ, L622
+L623:
+	JR PL, L620
+L624:
+	DJNZ B, L622
+L625:
+	JRL L628
+L626:
+	JRL L629
+L627:
+	DJNZ B, L625
+L628:
+	JP OV, L625
+L629:
+	JR MI, L630
+L630:
+	JP C, L1433
+L631:
+	DJNZ B, L635
+L632:
+	CALL L631
+L633:
+	JR MI, L636
+L634:
+	CALL L631
+L635:
+	CALL L632
+L636:
+	JRL L2764
+L637:
+	JR Z, L641
+L638:
+	JP NZ, L642
+L639:
+	JRL L643
+L640:
+	JR NC, L641
+L641:
+	CALL L3175
+L642:
+	JP OV, L638
+L643:
+	DJNZ B, L642
+L644:
+	JR GT, L644
+L645:
+	JRL L644
+L646:
+	CALL L650
+L647:
+	JR NZ, L648
+L648:
+	JRL L645
+L649:
+	JP PL, L645
+L650:
+	JR C, L650
+L651:
+	JP LE, L653
+L652:
+	CALL L4818
+L653:
+	DJNZ B, L652
+L654:
+	JR T, L658
+L655:
+	CALL L651
+L656:
+	JRL L654
+L657:
+	JRL L659
+L658:
+	JR NZ, L655
+L659:
+	CALL L1652
+L660:
+	JR MI, L659
+L661:
+	CALL L663
+L662:
+	CALL L659
+L663:
+	JRL L4957
+L664:
+	DJNZ B, L667
+L665:
+	DJNZ B, L665
+L666:
+	JR NZ, L670
+L667:
+	DJNZ B, L667
+L668:
+	JRL L670
+L669:
+	JR T, L666
+L670:
+	DJNZ B, L671
+L671:
+	JP Z, L668
+L672:
+	DJNZ B, L675
+L673:
+	JR T, L670
+L674:
+	JRL L674
+L675:
+	CALL L676
+L676:
+	DJNZ B, L675
+L677:
+	JR MI, L677
+L678:
+	CALL L678
+L679:
+	CALL L1958
+L680:
+	JP OV, L678
+L681:
+	JRL L677
+L682:
+	CALL L680
+L683:
+	DJNZ B, L683
+L684:
+	JR PL, L686
+L685:
+	JRL L4140
+L686:
+	JP Z, L4157
+L687:
+	DJNZ B, L683
+L688:
+	JRL L689
+L689:
+	CALL L1683
+L690:
+	DJNZ B, L692
+L691:
+	JRL L675
+L692:
+	JR Z, L690
+L693:
+	CALL L692
+L694:
+	JP OV, L691
+L695:
+	JRL L697
+L696:
+	JP LE, L4460
+L697:
+	JR NZ, L695
+L698:
+	CALL L701
+L699:
+	JR OV, L703
+L700:
+	JRL L701
+L701:
+	DJNZ B, L697
+L702:
+	CALL L4970
+L703:
+	JRL L700
+L704:
+	JR OV, L704
+L705:
+	JRL L706
+L706:
+	JR MI, L707
+L707:
+	DJNZ B, L703
+L708:
+	JR NC, L712
+L709:
+	JP Z, L4002
+L710:
+	JR Z, L707
+L711:
+	JR LE, L714
+L712:
+	JRL L711
+L713:
+	JRL L714
+L714:
+	DJNZ B, L715
+L715:
+	DJNZ B, L716
+L716:
+	DJNZ B, L714
+L717:
+	CALL L721
+L718:
+	JRL L718
+L719:
+	CALL L4958
+L720:
+	JR C, L722
+L721:
+	CALL L724
+L722:
+	JP OV, L1686
+L723:
+	JR NZ, L720
+L724:
+	JRL L722
+L725:
+	JR NC, L729
+L726:
+	DJNZ B, L725
+L727:
+	JRL L724
+L728:
+	JP LE, L3439
+L729:
+	JR NZ, L728
+L730:
+	JRL L730
+L731:
+	JP Z, L735
+L732:
+	JP LE, L728
+L733:
+	CALL L84
+L734:
+	JR OV, L730
+L735:
+	DJNZ B, L733
+L736:
+	CALL L740
+L737:
+	JRL L3418
+L738:
+	JR LE, L735
+L739:
+	JRL L737
+L740:
+	CALL L739
+L741:
+	JP GT, L740
+L742:
+	JP NC, L745
+L743:
+	JP GT, L743
+L744:
+	JRL L746
+L745:
+	JP OV, L746
+L746:
+	DJNZ B, L742
+L747:
+	JRL L2785
+L748:
+	CALL L748
+L749:
+	JR NC, L751
+L750:
+	JR T, L753
+L751:
+	JRL L749
+L752:
+	JR T, L754
+L753:
+	JP NZ, L750
+L754:
+	DJNZ B, L757
+L755:
+	CALL L759
+L756:
+	CALL L3290
+L757:
+	JRL L757
+L758:
+	JR LE, L762
+L759:
+	JR NC, L763
+L760:
+	DJNZ B, L759
+L761:
+	CALL L2708
+L762:
+	JR MI, L759
+L763:
+	CALL L4309
+L764:
+	JR LE, L765
+L765:
+	DJNZ B, L763
+L766:
+	CALL L1970
+L767:
+	JRL L764
+L768:
+	JRL L768
+L769:
+	JR C, L770
+L770:
+	JRL L766
+L771:
+	JR T, L773
+L772:
+	CALL L768
+L773:
+	CALL L772
+L774:
+	JP LE, L4934
+L775:
+	JR C, L775
+L776:
+	JP NC, L773
+L777:
+	DJNZ B, L774
+L778:
+	JP PL, L778
+L779:
+	JRL L775
+L780:
+	DJNZ B, L784
+L781:
+	JP Z, L781
+L782:
+	JRL L3216
+L783:
+	JRL L780
+L784:
+	JP NZ, L1783
+L785:
+	JR T, L789
+L786:
+	CALL L787
+L787:
+	DJNZ B, L789
+L788:
+	JP NZ, L1735
+L789:
+	JRL L787
+L790:
+	JRL L794
+L791:
+	CALL L1020
+L792:
+	JRL L796
+L793:
+	JR LE, L791
+L794:
+	JP Z, L792
+L795:
+	JP PL, L797
+L796:
+	DJNZ B, L800
+L797:
+	JP NC, L799
+L798:
+	DJNZ B, L799
+L799:
+	JRL L4760
+L800:
+	JRL L802
+L801:
+	JRL L803
+L802:
+	JRL L801
+L803:
+	JRL L4101
+L804:
+	CALL L803
+L805:
+	JR NC, L803
+L806:
+	DJNZ B, L805
+L807:
+	JR T, L811
+L808:
+	JR Z, L809
+L809:
+	CALL L812
+L810:
+	JP T, L806
+L811:
+	JP C, L813
+L812:
+	JRL L816
+L813:
+	DJNZ B, L811
+L814:
+	CALL L4032
+L815:
+	JR C, L813
+L816:
+	DJNZ B, L814
+L817:
+	JP OV, L3933
+L818:
+	DJNZ B, L821
+L819:
+	JRL L823
+L820:
+	CALL L821
+L821:
+	JP NZ, L821
+L822:
+	JRL L824
+L823:
+	JP PL, L819
+L824:
+	CALL L4167
+L825:
+	JR PL, L828
+L826:
+	CALL L826
+L827:
+	JRL L827
+L828:
+	JR T, L831
+L829:
+	JRL L829
+L830:
+	CALL L829
+L831:
+	JP Z, L835
+L832:
+	JRL L4202
+L833:
+	CALL L836
+L834:
+	DJNZ B, L831
+L835:
+	JR PL, L839
+L836:
+	JR NZ, L833
+L837:
+	JP C, L840
+L838:
+	JP C, L2452
+L839:
+	DJNZ B, L842
+L840:
+	JP NZ, L842
+L841:
+	JRL L649
+L842:
+	DJNZ B, L839
+L843:
+	JR MI, L844
+L844:
+	JR T, L843
+L845:
+	CALL L3515
+L846:
+	JRL L849
+L847:
+	JR C, L851
+L848:
+	JR LE, L845
+L849:
+	JR Z, L847
+L850:
+	JP T, L3803
+L851:
+	JP NZ, L851
+L852:
+	CALL L854
+L853:
+	DJNZ B, L852
+L854:
+	DJNZ B, L855
+L855:
+	CALL L858
+L856:
+	JR PL, L859
+L857:
+	DJNZ B, L859
+L858:
+	JR OV, L861
+L859:
+	DJNZ B, L861
+L860:
+	DJNZ B, L863
+L861:
+	JRL L4144
+L862:
+	CALL L864
+L863:
+	CALL L862
+L864:
+	JRL L862
+L865:
+	JRL L868
+L866:
+	DJNZ B, L864
+L867:
+	CALL L314
+L868:
+	JRL L4883
+L869:
+	DJNZ B, L873
+L870:
+	JR Z, L870
+L871:
+	CALL L870
+L872:
+	JP GT, L869
+L873:
+	JR LE, L871
+L874:
+	JP NZ, L873
+L875:
+	JP NC, L4953
+L876:
+	JP LE, L856
+L877:
+	JRL L2451
+L878:
+	JR GT, L882
+L879:
+	CALL L974
+L880:
+	JR Z, L882
+L881:
+	JRL L880
+L882:
+	JRL L882
+L883:
+	JR MI, L887
+L884:
+	JP NZ, L883
+L885:
+	JRL L882
+L886:
+	JP NZ, L888
+L887:
+	DJNZ B, L886
+L888:
+	JP NC, L892
+L889:
+	DJNZ B, L886
+L890:
+	DJNZ B, L887
+L891:
+	JR Z, L892
+L892:
+	DJNZ B, L890
+L893:
+	CALL L896
+L894:
+	JRL L2718
+L895:
+	JP NC, L891
+L896:
+	JP LE, L899
+L897:
+	CALL L893
+L898:
+	DJNZ B, L899
+L899:
+	JR C, L896
+L900:
+	JP Z, L896
+L901:
+	JR NZ, L904
+L902:
+	DJNZ B, L906
+L903:
+	CALL L905
+L904:
+	DJNZ B, L906
+L905:
+	DJNZ B, L903
+L906:
+	JR MI, L910
+L907:
+	JRL L911
+L908:
+	DJNZ B, L908
+L909:
+	DJNZ B, L912
+L910:
+	JR OV, L911
+L911:
+	JP MI, L908
+L912:
+	JP MI, L915
+L913:
+	JR MI, L912
+L914:
+	JR NZ, L913
+L915:
+	DJNZ B, L919
+L916:
+	JP GT, L919
+L917:
+	JP GT, L1538
+L918:
+	JRL L4474
+L919:
+	JR LE, L921
+L920:
+	JRL L916
+L921:
+	CALL L1004
+L922:
+	JP OV, L924
+L923:
+	JR PL, L924
+L924:
+	JR C, L923
+L925:
+	CALL L925
+L926:
+	DJNZ B, L925
+L927:
+	CALL L923
+L928:
+	DJNZ B, L924
+L929:
+	JRL L927
+L930:
+	CALL L930
+L931:
+	DJNZ B, L931
+L932:
+	DJNZ B, L933
+L933:
+	JR MI, L931
+L934:
+	JR NZ, L935
+L935:
+	JR GT, L933
+L936:
+	JRL L932
+L937:
+	CALL L938
+L938:
+	JRL L939
+L939:
+	JP T, L943
+L940:
+	JP PL, L938
+L941:
+	JR Z, L939
+L942:
+	JP NC, L941
+L943:
+	JR NC, L944
+L944:
+	JRL L2624
+L945:
+	JP C, L945
+L946:
+	DJNZ B, L948
+L947:
+	JP OV, L4788
+L948:
+	CALL L947
+L949:
+	CALL L949
+L950:
+	JRL L948
+L951:
+	JP OV, L955
+L952:
+	JRL L955
+L953:
+	JRL L954
+L954:
+	JP Z, L1100
+L955:
+	JP NC, L954
+L956:
+	JRL L956
+L957:
+	DJNZ B, L959
+L958:
+	JR NC, L961
+L959:
+	CALL L956
+L960:
+	JRL L3518
+L961:
+	CALL L960
+L962:
+	CALL L966
+L963:
+	JRL L966
+L964:
+	JR GT, L968
+L965:
+	CALL L964
+L966:
+	DJNZ B, L968
+L967:
+	JR LE, L966
+L968:
+	CALL L971
+L969:
+	CALL L3466
+L970:
+	JRL L973
+L971:
+	DJNZ B, L973
+L972:
+	DJNZ B, L969
+L973:
+	CALL L974
+L974:
+	JRL L974
+L975:
+	JP NC, L974
+L976:
+	DJNZ B, L972
+L977:
+	CALL L977
+L978:
+	CALL L982
+L979:
+	JRL L982
+L980:
+	JP NZ, L1899
+L981:
+	DJNZ B, L977
+L982:
+	JR T, L981
+L983:
+	DJNZ B, L984
+L984:
+	CALL L984
+L985:
+	JRL L983
+L986:
+	JR C, L990
+L987:
+	CALL L990
+L988:
+	JRL L987
+L989:
+	CALL L986
+L990:
+	CALL L991
+L991:
+	JP C, L3683
+L992:
+	JR LE, L992
+L993:
+	JR T, L997
+L994:
+	CALL L990
+L995:
+	JRL L998
+L996:
+	JR MI, L996
+L997:
+	JRL L996
+L998:
+	DJNZ B, L1002
+L999:
+	JR T, L1003
+L1000:
+	CALL L1001
+L1001:
+	CALL L1005
+L1002:
+	JRL L4379
+L1003:
+	JRL L999
+L1004:
+	CALL L1004
+L1005:
+	JR LE, L1005
+L1006:
+	JRL L1010
+L1007:
+	DJNZ B, L1005
+L1008:
+	DJNZ B, L1010
+L1009:
+	JP T, L1012
+L1010:
+	JP PL, L1007
+L1011:
+	JRL L1007
+L1012:
+	DJNZ B, L1015
+L1013:
+	CALL L2100
+L1014:
+	DJNZ B, L1011
+L1015:
+	CALL L1013
+L1016:
+	JRL L1020
+L1017:
+	DJNZ B, L1019
+L1018:
+	JR MI, L1015
+L1019:
+	JR LE, L1019
+L1020:
+	JRL L1022
+L1021:
+	JRL L1017
+L1022:
+	CALL L1026
+L1023:
+	CALL L1027
+L1024:
+	DJNZ B, L1022
+L1025:
+	CALL L1026
+L1026:
+	DJNZ B, L1030
+L1027:
+	JRL L757
+L1028:
+	JP OV, L1031
+L1029:
+	CALL L1025
+L1030:
+	JR T, L1032
+L1031:
+	JR PL, L1031
+L1032:
+	JRL L2020
+L1033:
+	JRL L1029
+L1034:
+	JP T, L1036
+L1035:
+	CALL L1035
+L1036:
+	CALL L3711
+L1037:
+	JRL L946
+L1038:
+	JRL L4519
+L1039:
+	JP Z, L1042
+L1040:
+	JP MI, L1044
+L1041:
+	JR NC, L1043
+L1042:
+	JRL L3400
+L1043:
+	JR MI, L1046
+L1044:
+	JR NZ, L1042
+L1045:
+	JR Z, L1047
+L1046:
+	DJNZ B, L1047
+L1047:
+	JP LE, L1051
+L1048:
+	DJNZ B, L1051
+L1049:
+	JR MI, L1050
+L1050:
+	JP C, L1053
+L1051:
+	JR C, L1049
+L1052:
+	CALL L1848
+L1053:
+	JR Z, L1050
+L1054:
+	DJNZ B, L1050
+L1055:
+	JR PL, L1051
+L1056:
+	JR MI, L1057
+L1057:
+	JRL L1060
+L1058:
+	JRL L1054
+L1059:
+	CALL L1056
+L1060:
+	JP LE, L1062
+L1061:
+	CALL L1065
+L1062:
+	CALL L1058
+L1063:
+	JR C, L1060
+L1064:
+	CALL L1068
+L1065:
+	JRL L1062
+L1066:
+	CALL L1063
+L1067:
+	JRL L3889
+L1068:
+	CALL L1072
+L1069:
+	CALL L433
+L1070:
+	JRL L1074
+L1071:
+	JR NZ, L1070
+L1072:
+	JR GT, L1071
+L1073:
+	JRL L2661
+L1074:
+	JR PL, L1071
+L1075:
+	JP NZ, L1077
+L1076:
+	JP T, L3788
+L1077:
+	JP C, L1074
+L1078:
+	JR LE, L1080
+L1079:
+	DJNZ B, L1079
+L1080:
+	DJNZ B, L1077
+L1081:
+	JRL L1081
+L1082:
+	CALL L1083
+L1083:
+	JRL L1079
+L1084:
+	JP NZ, L1088
+L1085:
+	JP LE, L1084
+L1086:
+	DJNZ B, L1090
+L1087:
+	JRL L2065
+L1088:
+	DJNZ B, L1087
+L1089:
+	CALL L1091
+L1090:
+	CALL L1087
+L1091:
+	JR Z, L1092
+L1092:
+	DJNZ B, L1096
+L1093:
+	CALL L1091
+L1094:
+	JP OV, L1094
+L1095:
+	DJNZ B, L1097
+L1096:
+	CALL L1092
+L1097:
+	JP Z, L1095
+L1098:
+	CALL L1101
+L1099:
+	JRL L1101
+L1100:
+	JP Z, L366
+L1101:
+	JP T, L1097
+L1102:
+	JRL L1102
+L1103:
+	JP NC, L1103
+L1104:
+	CALL L313
+L1105:
+	CALL L1107
+L1106:
+	JR OV, L1106
+L1107:
+	JRL L4825
+L1108:
+	JR LE, L1112
+L1109:
+	DJNZ B, L1110
+L1110:
+	JRL L1111
+L1111:
+	JRL L1107
+L1112:
+	JRL L1111
+L1113:
+	JRL L1115
+L1114:
+	CALL L1112
+L1115:
+	JP Z, L1813
+L1116:
+	JR Z, L1119
+L1117:
+	JP T, L1116
+L1118:
+	JR OV, L1116
+L1119:
+	JP MI, L1119
+L1120:
+	DJNZ B, L1116
+L1121:
+	CALL L1123
+L1122:
+	JRL L1122
+L1123:
+	DJNZ B, L1127
+L1124:
+	JP GT, L1146
+L1125:
+	JP PL, L1124
+L1126:
+	JP PL, L1128
+L1127:
+	JR T, L1126
+L1128:
+	CALL L1127
+L1129:
+	JR Z, L1126
+L1130:
+	CALL L1131
+L1131:
+	JRL L2046
+L1132:
+	JR NZ, L1129
+L1133:
+	JRL L1134
+L1134:
+	JR LE, L1133
+L1135:
+	JRL L1139
+L1136:
+	DJNZ B, L1139
+L1137:
+	JR LE, L1134
+L1138:
+	DJNZ B, L1141
+L1139:
+	JR Z, L1141
+L1140:
+	DJNZ B, L1138
+L1141:
+	JP GT, L1139
+L1142:
+	JP Z, L1145
+L1143:
+	DJNZ B, L1146
+L1144:
+	JR GT, L1145
+L1145:
+	CALL L1143
+L1146:
+	JR MI, L1148
+L1147:
+	JP NC, L4610
+L1148:
+	CALL L1147
+L1149:
+	JP T, L1148
+L1150:
+	CALL L1150
+L1151:
+	DJNZ B, L1149
+L1152:
+	JRL L1150
+L1153:
+	JRL L1155
+L1154:
+	JP T, L4375
+L1155:
+	CALL L1151
+L1156:
+	DJNZ B, L1153
+L1157:
+	DJNZ B, L1155
+L1158:
+	JRL L1162
+L1159:
+	CALL L1162
+L1160:
+	JP C, L1164
+L1161:
+	DJNZ B, L1162
+L1162:
+	JP T, L2631
+L1163:
+	JRL L1166
+L1164:
+	JRL L1164
+L1165:
+	DJNZ B, L1164
+L1166:
+	JP LE, L1162
+L1167:
+	DJNZ B, L1170
+L1168:
+	JR NC, L1170
+L1169:
+	JR Z, L1173
+L1170:
+	DJNZ B, L1174
+L1171:
+	JR NC, L1173
+L1172:
+	CALL L1170
+L1173:
+	JR MI, L1176
+L1174:
+	JP T, L1174
+L1175:
+	JP NZ, L2796
+L1176:
+	JR Z, L1174
+L1177:
+	JRL L3840
+L1178:
+	JR T, L1178
+L1179:
+	JR OV, L1177
+L1180:
+	JR NZ, L1176
+L1181:
+	CALL L1184
+L1182:
+	JRL L1182
+L1183:
+	DJNZ B, L1179
+L1184:
+	CALL L1187
+L1185:
+	JP Z, L451
+L1186:
+	JP PL, L1576
+L1187:
+	JR NZ, L1185
+L1188:
+	JR Z, L1192
+L1189:
+	JR T, L1192
+L1190:
+	JR NC, L1188
+L1191:
+	DJNZ B, L1195
+L1192:
+	CALL L1193
+L1193:
+	JRL L1190
+L1194:
+	JR NC, L1195
+L1195:
+	JP NC, L1193
+L1196:
+	DJNZ B, L1192
+L1197:
+	JR T, L1196
+L1198:
+	JP NZ, L1498
+L1199:
+	JP PL, L1198
+L1200:
+	DJNZ B, L1198
+L1201:
+	CALL L1199
+L1202:
+	DJNZ B, L1206
+L1203:
+	DJNZ B, L1205
+L1204:
+	CALL L1206
+L1205:
+	CALL L4713
+L1206:
+	DJNZ B, L1203
+L1207:
+	JR NZ, L1206
+L1208:
+	JR LE, L1204
+L1209:
+	DJNZ B, L1209
+L1210:
+	DJNZ B, L1214
+L1211:
+	CALL L2366
+L1212:
+	JP Z, L2071
+L1213:
+	JRL L1216
+L1214:
+	JRL L1217
+L1215:
+	JR OV, L1219
+L1216:
+	JRL L1218
+L1217:
+	CALL L150
+L1218:
+	CALL L1216
+L1219:
+	JRL L3469
+L1220:
+	JRL L1223
+L1221:
+	CALL L1225
+L1222:
+	JRL L1222
+L1223:
+	CALL L1223
+L1224:
+	DJNZ B, L1226
+L1225:
+	DJNZ B, L1222
+L1226:
+	JRL L1222
+L1227:
+	JP C, L1401
+L1228:
+	JP Z, L853
+L1229:
+	DJNZ B, L1233
+L1230:
+	JP NC, L1231
+L1231:
+	CALL L1230
+L1232:
+	JR OV, L1236
+L1233:
+	CALL L970
+L1234:
+	CALL L1231
+L1235:
+	JRL L1237
+L1236:
+	CALL L1238
+L1237:
+	JR OV, L1241
+L1238:
+	JR OV, L1241
+L1239:
+	CALL L1241
+L1240:
+	JRL L1239
+L1241:
+	JRL L1244
+L1242:
+	JP GT, L1242
+L1243:
+	JR Z, L1246
+L1244:
+	JP MI, L1242
+L1245:
+	JR OV, L1243
+L1246:
+	JRL L1246
+L1247:
+	CALL L1251
+L1248:
+	JP MI, L1247
+L1249:
+	JR MI, L1246
+L1250:
+	DJNZ B, L1252
+L1251:
+	JR PL, L1255
+L1252:
+	CALL L1252
+L1253:
+	JR PL, L1249
+L1254:
+	DJNZ B, L1256
+L1255:
+	JRL L3737
+L1256:
+	JRL L1252
+L1257:
+	CALL L1260
+L1258:
+	JRL L1259
+L1259:
+	DJNZ B, L1263
+L1260:
+	CALL L1260
+L1261:
+	JRL L1259
+L1262:
+	JP Z, L1260
+L1263:
+	JP C, L1260
+L1264:
+	JRL L1260
+L1265:
+	CALL L1269
+L1266:
+	CALL L3581
+L1267:
+	JRL L5
+L1268:
+	JR NZ, L1268
+L1269:
+	CALL L1272
+L1270:
+	JP LE, L1271
+L1271:
+	CALL L1271
+L1272:
+	JR PL, L1268
+L1273:
+	JP T, L1276
+L1274:
+	CALL L1277
+L1275:
+	DJNZ B, L1279
+L1276:
+	JP LE, L1275
+L1277:
+	JP LE, L1279
+L1278:
+	JRL L1282
+L1279:
+	JP C, L1277
+L1280:
+	JP Z, L1279
+L1281:
+	JR NC, L1283
+L1282:
+	JR PL, L1284
+L1283:
+	JP T, L3896
+L1284:
+	CALL L1283
+L1285:
+	JP PL, L1288
+L1286:
+	JRL L1286
+L1287:
+	DJNZ B, L1288
+L1288:
+	JP MI, L1157
+L1289:
+	JR Z, L1285
+L1290:
+	JR C, L1291
+L1291:
+	JRL L1294
+L1292:
+	CALL L1294
+L1293:
+	DJNZ B, L1296
+L1294:
+	JP LE, L1298
+L1295:
+	JP T, L1292
+L1296:
+	JR OV, L1295
+L1297:
+	JRL L1296
+L1298:
+	CALL L1299
+L1299:
+	JRL L1298
+L1300:
+	JR MI, L1298
+L1301:
+	JRL L1303
+L1302:
+	JP LE, L1300
+L1303:
+	JRL L1300
+L1304:
+	JP OV, L1302
+L1305:
+	JRL L1398
+L1306:
+	CALL L1309
+L1307:
+	JRL L1309
+L1308:
+	DJNZ B, L1308
+L1309:
+	JRL L1310
+L1310:
+	JR OV, L1309
+L1311:
+	JR Z, L1310
+L1312:
+	JR T, L1308
+L1313:
+	JRL L1309
+L1314:
+	JP NC, L1314
+L1315:
+	DJNZ B, L1319
+L1316:
+	DJNZ B, L1318
+L1317:
+	JP NC, L1318
+L1318:
+	CALL L1316
+L1319:
+	DJNZ B, L1319
+L1320:
+	CALL L571
+L1321:
+	CALL L2343
+L1322:
+	JR OV, L1325
+L1323:
+	DJNZ B, L1320
+L1324:
+	JR OV, L1321
+L1325:
+	JP NZ, L1326
+L1326:
+	JRL L1327
+L1327:
+	JRL L837
+L1328:
+	CALL L1326
+L1329:
+	CALL L3609
+L1330:
+	DJNZ B, L1327
+L1331:
+	JP C, L1333
+L1332:
+	JRL L1328
+L1333:
+	CALL L1335
+L1334:
+	CALL L1337
+L1335:
+	JRL L4696
+L1336:
+	CALL L1338
+L1337:
+	CALL L1336
+L1338:
+	DJNZ B, L1340
+L1339:
+	DJNZ B, L1338
+L1340:
+	JRL L1337
+L1341:
+	JRL L1340
+L1342:
+	JRL L4744
+L1343:
+	JRL L1341
+L1344:
+	CALL L1344
+L1345:
+	JR T, L1348
+L1346:
+	JP C, L1348
+L1347:
+	JP OV, L1346
+L1348:
+	JR NZ, L1344
+L1349:
+	JR T, L1351
+L1350:
+	JR LE, L1348
+L1351:
+	JRL L1486
+L1352:
+	DJNZ B, L1352
+L1353:
+	JRL L1441
+L1354:
+	DJNZ B, L1350
+L1355:
+	JP T, L1351
+L1356:
+	JRL L1360
+L1357:
+	JP LE, L1358
+L1358:
+	DJNZ B, L1360
+L1359:
+	JR C, L1355
+L1360:
+	JRL L1364
+L1361:
+	JP GT, L1357
+L1362:
+	CALL L1366
+L1363:
+	DJNZ B, L1361
+L1364:
+	DJNZ B, L1368
+L1365:
+	JP C, L1366
+L1366:
+	JR GT, L1365
+L1367:
+	CALL L1370
+L1368:
+	JR PL, L1367
+L1369:
+	JP Z, L1367
+L1370:
+	DJNZ B, L1372
+L1371:
+	DJNZ B, L1372
+L1372:
+	JRL L1272
+L1373:
+	JR NZ, L1371
+L1374:
+	JR MI, L1370
+L1375:
+	JP LE, L1372
+L1376:
+	JR T, L1376
+L1377:
+	JR PL, L1378
+L1378:
+	DJNZ B, L1380
+L1379:
+	JR MI, L1379
+L1380:
+	JP Z, L1377
+L1381:
+	CALL L1379
+L1382:
+	CALL L2626
+L1383:
+	JP NC, L3008
+L1384:
+	JP NC, L1384
+L1385:
+	JR Z, L1385
+L1386:
+	JP NC, L1384
+L1387:
+	JP LE, L1391
+L1388:
+	DJNZ B, L1385
+L1389:
+	DJNZ B, L1391
+L1390:
+	DJNZ B, L1393
+L1391:
+	JRL L1392
+L1392:
+	CALL L1394
+L1393:
+	CALL L750
+L1394:
+	JRL L1392
+L1395:
+	JR C, L1399
+L1396:
+	JP MI, L4850
+L1397:
+	JRL L1394
+L1398:
+	CALL L1401
+L1399:
+	DJNZ B, L1397
+L1400:
+	CALL L1404
+L1401:
+	CALL L1402
+L1402:
+	JRL L58
+L1403:
+	CALL L1407
+L1404:
+	JP MI, L1408
+L1405:
+	JRL L1406
+L1406:
+	JR MI, L1407
+L1407:
+	CALL L1410
+L1408:
+	JR GT, L1409
+L1409:
+	JRL L1408
+L1410:
+	DJNZ B, L1408
+L1411:
+	DJNZ B, L1407
+L1412:
+	JP LE, L1415
+L1413:
+	DJNZ B, L1414
+L1414:
+	JR MI, L1414
+L1415:
+	JP PL, L1418
+L1416:
+	JRL L1415
+L1417:
+	JP Z, L465
+L1418:
+	CALL L1418
+L1419:
+	JRL L2000
+L1420:
+	JP NC, L1418
+L1421:
+	JRL L1421
+L1422:
+	JRL L1418
+L1423:
+	JRL L3950
+L1424:
+	CALL L1423
+L1425:
+	JP MI, L2212
+L1426:
+	JRL L1422
+L1427:
+	JP LE, L1430
+L1428:
+	CALL L2637
+L1429:
+	JR NZ, L1431
+L1430:
+	JR LE, L1428
+L1431:
+	CALL L1433
+L1432:
+	CALL L1431
+L1433:
+	DJNZ B, L1435
+L1434:
+	DJNZ B, L1438
+L1435:
+	JRL L1434
+L1436:
+	JP GT, L1432
+L1437:
+	JP NZ, L1436
+L1438:
+	JRL L1442
+L1439:
+	JRL L1442
+L1440:
+	DJNZ B, L1444
+L1441:
+	JRL L1440
+L1442:
+	CALL L1444
+L1443:
+	JRL L1442
+L1444:
+	JRL L4819
+L1445:
+	JP OV, L3065
+L1446:
+	JRL L1442
+L1447:
+	DJNZ B, L1450
+L1448:
+	DJNZ B, L1446
+L1449:
+	CALL L1451
+L1450:
+	DJNZ B, L1448
+L1451:
+	JRL L3009
+L1452:
+	CALL L1455
+L1453:
+	JR T, L1449
+L1454:
+	JRL L1455
+L1455:
+	CALL L1451
+L1456:
+	DJNZ B, L1460
+L1457:
+	CALL L1457
+L1458:
+	JR Z, L1455
+L1459:
+	DJNZ B, L1459
+L1460:
+	CALL L1464
+L1461:
+	DJNZ B, L1459
+L1462:
+	JP OV, L4686
+L1463:
+	JRL L4803
+L1464:
+	JR PL, L1465
+L1465:
+	JRL L1463
+L1466:
+	CALL L3030
+L1467:
+	CALL L1471
+L1468:
+	JRL L1466
+L1469:
+	JP OV, L785
+L1470:
+	JP T, L1474
+L1471:
+	DJNZ B, L1472
+L1472:
+	JP T, L1474
+L1473:
+	JRL L1473
+L1474:
+	JP LE, L394
+L1475:
+	DJNZ B, L1472
+L1476:
+	DJNZ B, L1479
+L1477:
+	JR LE, L1475
+L1478:
+	DJNZ B, L1474
+L1479:
+	CALL L1475
+L1480:
+	CALL L1719
+L1481:
+	DJNZ B, L1477
+L1482:
+	JP GT, L1481
+L1483:
+	DJNZ B, L1485
+L1484:
+	JP T, L1487
+L1485:
+	DJNZ B, L1488
+L1486:
+	CALL L1482
+L1487:
+	JR NC, L1490
+L1488:
+	JP C, L1489
+L1489:
+	JRL L1487
+L1490:
+	JR Z, L1488
+L1491:
+	CALL L1493
+L1492:
+	CALL L1488
+L1493:
+	JP MI, L1495
+L1494:
+	JP C, L1494
+L1495:
+	JRL L1491
+L1496:
+	DJNZ B, L1498
+L1497:
+	DJNZ B, L1499
+L1498:
+	JRL L1501
+L1499:
+	JR NZ, L1500
+L1500:
+	JRL L1500
+L1501:
+	CALL L1505
+L1502:
+	JP OV, L1499
+L1503:
+	CALL L1502
+L1504:
+	JP C, L1508
+L1505:
+	JRL L1502
+L1506:
+	JP LE, L93
+L1507:
+	JRL L1503
+L1508:
+	JP T, L105
+L1509:
+	CALL L1510
+L1510:
+	JRL L838
+L1511:
+	DJNZ B, L1512
+L1512:
+	JRL L4448
+L1513:
+	DJNZ B, L1509
+L1514:
+	CALL L4124
+L1515:
+	JR OV, L1514
+L1516:
+	JR C, L1516
+L1517:
+	CALL L1513
+L1518:
+	JRL L1517
+L1519:
+	JP MI, L1518
+L1520:
+	JP OV, L1523
+L1521:
+	DJNZ B, L1520
+L1522:
+	JRL L4899
+L1523:
+	JP OV, L1522
+L1524:
+	CALL L2100
+L1525:
+	CALL L1521
+L1526:
+	JP OV, L732
+L1527:
+	CALL L1524
+L1528:
+	JR MI, L1526
+L1529:
+	JR NC, L1528
+L1530:
+	DJNZ B, L1530
+L1531:
+	CALL L1530
+L1532:
+	JR LE, L1531
+L1533:
+	JP OV, L1536
+L1534:
+	JRL L1531
+L1535:
+	CALL L1535
+L1536:
+	JP PL, L1534
+L1537:
+	CALL L1539
+L1538:
+	CALL L2783
+L1539:
+	CALL L1536
+L1540:
+	JP OV, L2258
+L1541:
+	JP MI, L1539
+L1542:
+	CALL L1541
+L1543:
+	DJNZ B, L1544
+L1544:
+	DJNZ B, L1543
+L1545:
+	CALL L1543
+L1546:
+	CALL L304
+L1547:
+	JRL L1548
+L1548:
+	JP GT, L1545
+L1549:
+	CALL L4224
+L1550:
+	CALL L1549
+L1551:
+	CALL L1555
+L1552:
+	CALL L1459
+L1553:
+	JRL L1551
+L1554:
+	JP MI, L1557
+L1555:
+	DJNZ B, L1555
+L1556:
+	JR MI, L1557
+L1557:
+	DJNZ B, L1556
+L1558:
+	JRL L1557
+L1559:
+	CALL L1558
+L1560:
+	CALL L1561
+L1561:
+	DJNZ B, L1557
+L1562:
+	JP T, L1564
+L1563:
+	JP GT, L1567
+L1564:
+	CALL L1564
+L1565:
+	CALL L3114
+L1566:
+	CALL L1570
+L1567:
+	JR Z, L1567
+L1568:
+	CALL L1565
+L1569:
+	DJNZ B, L1571
+L1570:
+	CALL L1567
+L1571:
+	JR GT, L1574
+L1572:
+	DJNZ B, L1575
+L1573:
+	DJNZ B, L1570
+L1574:
+	JR Z, L1571
+L1575:
+	JR NC, L1577
+L1576:
+	DJNZ B, L1572
+L1577:
+	CALL L1577
+L1578:
+	CALL L4594
+L1579:
+	JR LE, L1579
+L1580:
+	JP OV, L1578
+L1581:
+	DJNZ B, L1579
+L1582:
+	DJNZ B, L1582
+L1583:
+	JR T, L1579
+L1584:
+	JRL L2279
+L1585:
+	CALL L1582
+L1586:
+	CALL L1582
+L1587:
+	DJNZ B, L1587
+L1588:
+	JP Z, L1584
+L1589:
+	CALL L1589
+L1590:
+	DJNZ B, L1592
+L1591:
+	DJNZ B, L1594
+L1592:
+	JP Z, L1591
+L1593:
+	DJNZ B, L1594
+L1594:
+	DJNZ B, L1593
+L1595:
+	JRL L1593
+L1596:
+	DJNZ B, L1592
+L1597:
+	JR LE, L1596
+L1598:
+	CALL L1599
+L1599:
+	DJNZ B, L1599
+L1600:
+	JRL L1601
+L1601:
+	CALL L1603
+L1602:
+	JRL L1603
+L1603:
+	JRL L126
+L1604:
+	JRL L1608
+L1605:
+	JR NC, L1604
+L1606:
+	CALL L1610
+L1607:
+	JRL L1603
+L1608:
+	JR C, L1610
+L1609:
+	DJNZ B, L1610
+L1610:
+	DJNZ B, L1611
+L1611:
+	CALL L1610
+L1612:
+	JRL L270
+L1613:
+	JR PL, L1611
+L1614:
+	DJNZ B, L1618
+L1615:
+	CALL L3283
+L1616:
+	JRL L1617
+L1617:
+	DJNZ B, L1618
+L1618:
+	JRL L1615
+L1619:
+	DJNZ B, L1623
+L1620:
+	JP GT, L1621
+L1621:
+	DJNZ B, L1618
+L1622:
+	JRL L1619
+L1623:
+	JR T, L1622
+L1624:
+	JRL L1625
+L1625:
+	JRL L1627
+L1626:
+	DJNZ B, L1625
+L1627:
+	JR Z, L1629
+L1628:
+	JP OV, L1627
+L1629:
+	JR NC, L1633
+L1630:
+	JP C, L1631
+L1631:
+	CALL L1757
+L1632:
+	CALL L1628
+L1633:
+	JRL L1631
+L1634:
+	CALL L1637
+L1635:
+	JRL L1632
+L1636:
+	JRL L3762
+L1637:
+	CALL L1640
+L1638:
+	DJNZ B, L1642
+L1639:
+	DJNZ B, L1641
+L1640:
+	DJNZ B, L1640
+L1641:
+	JP MI, L1638
+L1642:
+	JP C, L1640
+L1643:
+	DJNZ B, L1641
+L1644:
+	JRL L1645
+L1645:
+	DJNZ B, L1642
+L1646:
+	JRL L1642
+L1647:
+	JR Z, L1650
+L1648:
+	JR Z, L1649
+L1649:
+	JRL L2601
+L1650:
+	CALL L1647
+L1651:
+	JRL L1652
+L1652:
+	JP PL, L1648
+L1653:
+	JP PL, L1652
+L1654:
+	JP T, L1655
+L1655:
+	CALL L458
+L1656:
+	CALL L1655
+L1657:
+	CALL L977
+L1658:
+	JR T, L1654
+L1659:
+	CALL L1657
+L1660:
+	DJNZ B, L1663
+L1661:
+	DJNZ B, L1663
+L1662:
+	DJNZ B, L1661
+L1663:
+	JR PL, L1667
+L1664:
+	CALL L1663
+L1665:
+	JP PL, L1662
+L1666:
+	JRL L1663
+L1667:
+	CALL L1787
+L1668:
+	CALL L1664
+L1669:
+	JR T, L1667
+L1670:
+	CALL L1874
+L1671:
+	JP NZ, L1668
+L1672:
+	CALL L1672
+L1673:
+	JRL L1674
+L1674:
+	CALL L4335
+L1675:
+	CALL L1679
+L1676:
+	CALL L1095
+L1677:
+	JRL L1679
+L1678:
+	JP NZ, L1676
+L1679:
+	CALL L1679
+L1680:
+	DJNZ B, L1681
+L1681:
+	JR NC, L1677
+L1682:
+	JRL L1685
+L1683:
+	JRL L2345
+L1684:
+	JRL L1687
+L1685:
+	JRL L1600
+L1686:
+	DJNZ B, L1682
+L1687:
+	JR NC, L1687
+L1688:
+	CALL L1684
+L1689:
+	JR OV, L1687
+L1690:
+	JP Z, L1686
+L1691:
+	JP LE, L1694
+L1692:
+	JR Z, L1694
+L1693:
+	DJNZ B, L1695
+L1694:
+	JR PL, L1693
+L1695:
+	DJNZ B, L1692
+L1696:
+	JP OV, L3868
+L1697:
+	JRL L1694
+L1698:
+	CALL L4259
+L1699:
+	DJNZ B, L1696
+L1700:
+	JR C, L1697
+L1701:
+	DJNZ B, L1705
+L1702:
+	DJNZ B, L1698
+L1703:
+	JR PL, L1701
+L1704:
+	JRL L1700
+L1705:
+	JRL L1296
+L1706:
+	JR GT, L1706
+L1707:
+	JP NZ, L1705
+L1708:
+	CALL L1707
+L1709:
+	DJNZ B, L1711
+L1710:
+	JR OV, L1714
+L1711:
+	JRL L1709
+L1712:
+	JR NZ, L1715
+L1713:
+	JR PL, L1710
+L1714:
+	JRL L1713
+L1715:
+	DJNZ B, L1711
+L1716:
+	JR MI, L1718
+L1717:
+	CALL L1717
+L1718:
+	DJNZ B, L1715
+L1719:
+	JP LE, L1723
+L1720:
+	DJNZ B, L1722
+L1721:
+	CALL L1718
+L1722:
+	JRL L3359
+L1723:
+	JP C, L1727
+L1724:
+	JP PL, L1723
+L1725:
+	JR NZ, L1722
+L1726:
+	CALL L1723
+L1727:
+	CALL L1730
+L1728:
+	DJNZ B, L1725
+L1729:
+	CALL L1732
+L1730:
+	CALL L1733
+L1731:
+	JR C, L1728
+L1732:
+	DJNZ B, L1735
+L1733:
+	DJNZ B, L1735
+L1734:
+	CALL L1733
+L1735:
+	JP C, L1892
+L1736:
+	JRL L1887
+L1737:
+	DJNZ B, L1734
+L1738:
+	JR Z, L1739
+L1739:
+	JP NC, L1738
+L1740:
+	JR T, L1736
+L1741:
+	JP PL, L3803
+L1742:
+	JRL L1741
+L1743:
+	DJNZ B, L1742
+L1744:
+	JRL L1747
+L1745:
+	CALL L1160
+L1746:
+	CALL L4778
+L1747:
+	DJNZ B, L1750
+L1748:
+	JRL L1746
+L1749:
+	JRL L2273
+L1750:
+	DJNZ B, L1751
+L1751:
+	JRL L1751
+L1752:
+	DJNZ B, L1749
+L1753:
+	JP MI, L1757
+L1754:
+	JP C, L1756
+L1755:
+	JR Z, L1754
+L1756:
+	JRL L1760
+L1757:
+	JP NZ, L1807
+L1758:
+	JRL L1755
+L1759:
+	CALL L1762
+L1760:
+	CALL L1756
+L1761:
+	JRL L1761
+L1762:
+	JRL L1764
+L1763:
+	CALL L1767
+L1764:
+	JR Z, L1768
+L1765:
+	JP Z, L2347
+L1766:
+	CALL L1770
+L1767:
+	JR NZ, L1769
+L1768:
+	JP PL, L1767
+L1769:
+	DJNZ B, L1769
+L1770:
+	CALL L1766
+L1771:
+	JP LE, L1769
+L1772:
+	JP GT, L801
+L1773:
+	DJNZ B, L1772
+L1774:
+	JR LE, L1771
+L1775:
+	JR MI, L1771
+L1776:
+	JP LE, L1994
+L1777:
+	JR T, L1779
+L1778:
+	JRL L1775
+L1779:
+	CALL L1782
+L1780:
+	JR MI, L1776
+L1781:
+	DJNZ B, L1784
+L1782:
+	CALL L1784
+L1783:
+	JR PL, L1787
+L1784:
+	CALL L1786
+L1785:
+	CALL L653
+L1786:
+	DJNZ B, L1783
+L1787:
+	JRL L26
+L1788:
+	JRL L1789
+L1789:
+	JR NC, L1789
+L1790:
+	DJNZ B, L1794
+L1791:
+	CALL L1792
+L1792:
+	CALL L1788
+L1793:
+	CALL L1796
+L1794:
+	DJNZ B, L1792
+L1795:
+	JP Z, L1793
+L1796:
+	DJNZ B, L1797
+L1797:
+	JRL L1795
+L1798:
+	JRL L1801
+L1799:
+	DJNZ B, L1798
+L1800:
+	JRL L3874
+L1801:
+	JRL L1803
+L1802:
+	JR GT, L1800
+L1803:
+	JP OV, L1801
+L1804:
+	JRL L1804
+L1805:
+	JR C, L1806
+L1806:
+	DJNZ B, L1808
+L1807:
+	CALL L1808
+L1808:
+	JP MI, L1809
+L1809:
+	JR GT, L1809
+L1810:
+	JP NC, L2923
+L1811:
+	JR GT, L1813
+L1812:
+	JR Z, L1811
+L1813:
+	JRL L1810
+L1814:
+	DJNZ B, L1810
+L1815:
+	JRL L1816
+L1816:
+	JR MI, L1814
+L1817:
+	DJNZ B, L1820
+L1818:
+	DJNZ B, L1814
+L1819:
+	JP GT, L1822
+L1820:
+	DJNZ B, L1822
+L1821:
+	JP OV, L1822
+L1822:
+	CALL L1157
+L1823:
+	CALL L1824
+L1824:
+	CALL L1825
+L1825:
+	JP NZ, L1821
+L1826:
+	JR NZ, L1826
+L1827:
+	JR GT, L1828
+L1828:
+	DJNZ B, L1824
+L1829:
+	JRL L2950
+L1830:
+	JP MI, L1829
+L1831:
+	DJNZ B, L1829
+L1832:
+	JRL L1832
+L1833:
+	CALL L1834
+L1834:
+	JR LE, L1833
+L1835:
+	CALL L3768
+L1836:
+	DJNZ B, L1840
+L1837:
+	JP T, L1835
+L1838:
+	CALL L1841
+L1839:
+	DJNZ B, L1842
+L1840:
+	CALL L1837
+L1841:
+	CALL L1842
+L1842:
+	JP MI, L1839
+L1843:
+	JP OV, L1846
+L1844:
+	JRL L1846
+L1845:
+	JP GT, L4799
+L1846:
+	JP NZ, L1123
+L1847:
+	JP Z, L1169
+L1848:
+	JP NC, L1844
+L1849:
+	CALL L1850
+L1850:
+	JRL L1851
+L1851:
+	DJNZ B, L1850
+L1852:
+	DJNZ B, L1849
+L1853:
+	JR LE, L1850
+L1854:
+	DJNZ B, L1857
+L1855:
+	JP LE, L1853
+L1856:
+	JP PL, L1858
+L1857:
+	JP MI, L206
+L1858:
+	DJNZ B, L1861
+L1859:
+	JR NC, L1855
+L1860:
+	JR MI, L1856
+L1861:
+	CALL L1864
+L1862:
+	JP C, L1088
+L1863:
+	DJNZ B, L1861
+L1864:
+	DJNZ B, L1866
+L1865:
+	CALL L1173
+L1866:
+	DJNZ B, L1868
+L1867:
+	JRL L1871
+L1868:
+	CALL L1872
+L1869:
+	JP LE, L2858
+L1870:
+	CALL L1866
+L1871:
+	JR OV, L1869
+L1872:
+	JR T, L1874
+L1873:
+	JR NC, L1874
+L1874:
+	DJNZ B, L1878
+L1875:
+	JRL L1871
+L1876:
+	JP LE, L1872
+L1877:
+	JR PL, L1874
+L1878:
+	JR LE, L1874
+L1879:
+	JRL L1883
+L1880:
+	JR Z, L1883
+L1881:
+	DJNZ B, L1883
+L1882:
+	JP GT, L1886
+L1883:
+	JP T, L1883
+L1884:
+	DJNZ B, L1884
+L1885:
+	JRL L2210
+L1886:
+	DJNZ B, L1889
+L1887:
+	JRL L1890
+L1888:
+	JRL L1892
+L1889:
+	JR LE, L1887
+L1890:
+	JRL L1890
+L1891:
+	JRL L1891
+L1892:
+	CALL L1895
+L1893:
+	DJNZ B, L1894
+L1894:
+	JRL L1898
+L1895:
+	JP OV, L1894
+L1896:
+	DJNZ B, L1894
+L1897:
+	JR T, L1894
+L1898:
+	JP MI, L1895
+L1899:
+	DJNZ B, L1895
+L1900:
+	CALL L584
+L1901:
+	JP T, L1621
+L1902:
+	CALL L701
+L1903:
+	JRL L1906
+L1904:
+	JRL L1901
+L1905:
+	JR OV, L1901
+L1906:
+	JRL L1909
+L1907:
+	JRL L1903
+L1908:
+	JRL L1912
+L1909:
+	JP GT, L1909
+L1910:
+	JP LE, L1911
+L1911:
+	DJNZ B, L1907
+L1912:
+	JP NC, L1914
+L1913:
+	DJNZ B, L1917
+L1914:
+	CALL L1917
+L1915:
+	JR OV, L1915
+L1916:
+	JRL L1912
+L1917:
+	DJNZ B, L1920
+L1918:
+	JP T, L1916
+L1919:
+	JR C, L1916
+L1920:
+	JP GT, L470
+L1921:
+	JRL L1919
+L1922:
+	JP PL, L1923
+L1923:
+	JP T, L1921
+L1924:
+	JR PL, L1922
+L1925:
+	JRL L1924
+L1926:
+	JP NZ, L978
+L1927:
+	JRL L1929
+L1928:
+	DJNZ B, L1931
+L1929:
+	CALL L3210
+L1930:
+	CALL L1927
+L1931:
+	JRL L847
+L1932:
+	DJNZ B, L1930
+L1933:
+	JRL L1933
+L1934:
+	JR C, L1933
+L1935:
+	JR LE, L1934
+L1936:
+	JRL L793
+L1937:
+	CALL L1937
+L1938:
+	JRL L1936
+L1939:
+	JR T, L1943
+L1940:
+	JRL L1963
+L1941:
+	JP PL, L1944
+L1942:
+	DJNZ B, L1939
+L1943:
+	JP T, L1942
+L1944:
+	JR GT, L1943
+L1945:
+	JP NC, L1948
+L1946:
+	JR T, L1947
+L1947:
+	CALL L3148
+L1948:
+	DJNZ B, L1949
+L1949:
+	CALL L1951
+L1950:
+	DJNZ B, L1952
+L1951:
+	CALL L4424
+L1952:
+	JP C, L1952
+L1953:
+	JR OV, L1957
+L1954:
+	DJNZ B, L1955
+L1955:
+	DJNZ B, L1955
+L1956:
+	JRL L563
+L1957:
+	JR C, L1957
+L1958:
+	JRL L1952
+L1959:
+	CALL L1963
+L1960:
+	DJNZ B, L1959
+L1961:
+	JR NZ, L1961
+L1962:
+	JRL L1958
+L1963:
+	CALL L1964
+L1964:
+	JP PL, L1967
+L1965:
+	JR T, L1965
+L1966:
+	JR C, L1970
+L1967:
+	DJNZ B, L1965
+L1968:
+	JRL L1971
+L1969:
+	DJNZ B, L1969
+L1970:
+	JRL L1970
+L1971:
+	JRL L1968
+L1972:
+	JP Z, L4220
+L1973:
+	DJNZ B, L1972
+L1974:
+	DJNZ B, L1971
+L1975:
+	JRL L1972
+L1976:
+	DJNZ B, L1972
+L1977:
+	JRL L1980
+L1978:
+	JRL L1974
+L1979:
+	JR NC, L1978
+L1980:
+	DJNZ B, L1984
+L1981:
+	DJNZ B, L1979
+L1982:
+	JP MI, L1984
+L1983:
+	DJNZ B, L1979
+L1984:
+	DJNZ B, L1988
+L1985:
+	JP OV, L1987
+L1986:
+	DJNZ B, L1988
+L1987:
+	JP Z, L4147
+L1988:
+	JR NZ, L1992
+L1989:
+	DJNZ B, L1985
+L1990:
+	DJNZ B, L1994
+L1991:
+	DJNZ B, L1987
+L1992:
+	JP T, L1990
+L1993:
+	CALL L1994
+L1994:
+	JP C, L1990
+L1995:
+	JR Z, L1995
+L1996:
+	JR C, L2000
+L1997:
+	JP T, L4494
+L1998:
+	JR Z, L1994
+L1999:
+	JRL L1995
+L2000:
+	JRL L946
+L2001:
+	JR NC, L2002
+L2002:
+	JR NZ, L2003
+L2003:
+	CALL L4916
+L2004:
+	DJNZ B, L2001
+L2005:
+	CALL L2002
+L2006:
+	DJNZ B, L2004
+L2007:
+	JRL L2005
+L2008:
+	CALL L2008
+L2009:
+	JP LE, L2006
+L2010:
+	JR NZ, L2007
+L2011:
+	JR PL, L2009
+L2012:
+	DJNZ B, L2011
+L2013:
+	CALL L2009
+L2014:
+	DJNZ B, L2012
+L2015:
+	DJNZ B, L2013
+L2016:
+	JP OV, L4953
+L2017:
+	JP PL, L2015
+L2018:
+	JRL L2014
+L2019:
+	DJNZ B, L2015
+L2020:
+	DJNZ B, L2018
+L2021:
+	CALL L2021
+L2022:
+	CALL L2023
+L2023:
+	CALL L2024
+L2024:
+	JRL L1318
+L2025:
+	JRL L2025
+L2026:
+	JRL L2024
+L2027:
+	JR NZ, L2029
+L2028:
+	CALL L2028
+L2029:
+	JR C, L2030
+L2030:
+	JRL L2031
+L2031:
+	JR LE, L2029
+L2032:
+	JR MI, L2033
+L2033:
+	DJNZ B, L2031
+L2034:
+	JRL L2038
+L2035:
+	DJNZ B, L2036
+L2036:
+	CALL L2038
+L2037:
+	JP PL, L2036
+L2038:
+	JR T, L2042
+L2039:
+	JP PL, L3127
+L2040:
+	JR T, L2040
+L2041:
+	JP C, L1601
+L2042:
+	JR GT, L2042
+L2043:
+	JR MI, L2046
+L2044:
+	CALL L2043
+L2045:
+	JRL L2047
+L2046:
+	CALL L2042
+L2047:
+	CALL L2701
+L2048:
+	JP NZ, L3603
+L2049:
+	CALL L2050
+L2050:
+	JP LE, L2053
+L2051:
+	CALL L1549
+L2052:
+	JRL L3283
+L2053:
+	DJNZ B, L2057
+L2054:
+	DJNZ B, L2055
+L2055:
+	DJNZ B, L2056
+L2056:
+	JR NZ, L2054
+L2057:
+	DJNZ B, L2058
+L2058:
+	JP T, L2054
+L2059:
+	DJNZ B, L2059
+L2060:
+	JR LE, L2064
+L2061:
+	JP C, L4938
+L2062:
+	JR NC, L2061
+L2063:
+	JP NZ, L2060
+L2064:
+	JP C, L2064
+L2065:
+	CALL L2063
+L2066:
+	JRL L2067
+L2067:
+	JR C, L2068
+L2068:
+	JR NC, L2065
+L2069:
+	CALL L2073
+L2070:
+	DJNZ B, L2066
+L2071:
+	DJNZ B, L2067
+L2072:
+	JR PL, L2073
+L2073:
+	JP OV, L2701
+L2074:
+	CALL L2070
+L2075:
+	JRL L2078
+L2076:
+	JP NZ, L4847
+L2077:
+	CALL L2076
+L2078:
+	CALL L2077
+L2079:
+	JR Z, L2082
+L2080:
+	JP NZ, L2076
+L2081:
+	CALL L2082
+L2082:
+	DJNZ B, L2080
+L2083:
+	CALL L2080
+L2084:
+	DJNZ B, L2085
+L2085:
+	JR OV, L2086
+L2086:
+	JP C, L2088
+L2087:
+	JP Z, L2807
+L2088:
+	JP PL, L2137
+L2089:
+	DJNZ B, L2085
+L2090:
+	JP OV, L2094
+L2091:
+	CALL L2088
+L2092:
+	CALL L4055
+L2093:
+	CALL L2089
+L2094:
+	DJNZ B, L2095
+L2095:
+	JR NZ, L2097
+L2096:
+	DJNZ B, L2095
+L2097:
+	JR GT, L2098
+L2098:
+	JP GT, L1878
+L2099:
+	CALL L2096
+L2100:
+	JP NC, L2101
+L2101:
+	DJNZ B, L2104
+L2102:
+	JR LE, L2103
+L2103:
+	JRL L2101
+L2104:
+	CALL L2102
+L2105:
+	JR T, L2105
+L2106:
+	DJNZ B, L2107
+L2107:
+	JP PL, L2107
+L2108:
+	JR NC, L2108
+L2109:
+	CALL L2106
+L2110:
+	JP T, L2114
+L2111:
+	JP Z, L2113
+L2112:
+	DJNZ B, L2108
+L2113:
+	JP NC, L2112
+L2114:
+	JP C, L4968
+L2115:
+	JP NC, L3672
+L2116:
+	JP C, L2116
+L2117:
+	CALL L2116
+L2118:
+	JRL L2115
+L2119:
+	JP GT, L2116
+L2120:
+	DJNZ B, L2120
+L2121:
+	DJNZ B, L2123
+L2122:
+	JP NZ, L2118
+L2123:
+	CALL L2121
+L2124:
+	DJNZ B, L2121
+L2125:
+	JRL L2123
+L2126:
+	JP GT, L2124
+L2127:
+	JRL L2124
+L2128:
+	DJNZ B, L2130
+L2129:
+	JR LE, L2133
+L2130:
+	JP T, L2128
+L2131:
+	CALL L2129
+L2132:
+	DJNZ B, L2130
+L2133:
+	JP GT, L2136
+L2134:
+	CALL L2131
+L2135:
+	DJNZ B, L2132
+L2136:
+	JRL L2138
+L2137:
+	DJNZ B, L2135
+L2138:
+	JR Z, L2134
+L2139:
+	JRL L2140
+L2140:
+	JR OV, L2138
+L2141:
+	JP T, L2141
+L2142:
+	JP MI, L2145
+L2143:
+	JP T, L2139
+L2144:
+	CALL L2142
+L2145:
+	CALL L2759
+L2146:
+	CALL L2150
+L2147:
+	JP C, L2143
+L2148:
+	JP MI, L2148
+L2149:
+	JR OV, L2145
+L2150:
+	JR C, L2151
+L2151:
+	JP PL, L2150
+L2152:
+	JP OV, L2153
+L2153:
+	JRL L2155
+L2154:
+	CALL L2158
+L2155:
+	CALL L2155
+L2156:
+	DJNZ B, L2154
+L2157:
+	JP NZ, L2156
+L2158:
+	JP C, L2160
+L2159:
+	DJNZ B, L2163
+L2160:
+	JRL L2157
+L2161:
+	JR GT, L2161
+L2162:
+	JRL L2161
+L2163:
+	JRL L2151
+L2164:
+	JP MI, L2161
+L2165:
+	JR OV, L2163
+L2166:
+	JR NZ, L2169
+L2167:
+	JP OV, L2170
+L2168:
+	JR C, L2170
+L2169:
+	DJNZ B, L2172
+L2170:
+	JR LE, L2168
+L2171:
+	JRL L2168
+L2172:
+	JR Z, L2176
+L2173:
+	JR T, L2173
+L2174:
+	JRL L2171
+L2175:
+	JP GT, L2178
+L2176:
+	CALL L2175
+L2177:
+	CALL L2173
+L2178:
+	JRL L2586
+L2179:
+	CALL L3073
+L2180:
+	JP MI, L2179
+L2181:
+	JRL L2178
+L2182:
+	CALL L2184
+L2183:
+	JR C, L2179
+L2184:
+	JRL L1317
+L2185:
+	CALL L2184
+L2186:
+	JP LE, L2189
+L2187:
+	DJNZ B, L2188
+L2188:
+	DJNZ B, L2189
+L2189:
+	CALL L2653
+L2190:
+	JR GT, L2190
+L2191:
+	JP NC, L2194
+L2192:
+	JP OV, L1269
+L2193:
+	DJNZ B, L2191
+L2194:
+	JRL L2197
+L2195:
+	JR MI, L2198
+L2196:
+	JR NZ, L2193
+L2197:
+	CALL L2194
+L2198:
+	DJNZ B, L2196
+L2199:
+	DJNZ B, L2199
+L2200:
+	JP LE, L2306
+L2201:
+	CALL L2203
+L2202:
+	CALL L3795
+L2203:
+	JR NZ, L2207
+L2204:
+	JR NC, L2205
+L2205:
+	JRL L2201
+L2206:
+	DJNZ B, L2207
+L2207:
+	JR NZ, L2203
+L2208:
+	CALL L2208
+L2209:
+	DJNZ B, L2213
+L2210:
+	CALL L2209
+L2211:
+	JR PL, L2214
+L2212:
+	CALL L2209
+L2213:
+	JP PL, L2217
+L2214:
+	DJNZ B, L2210
+L2215:
+	JR C, L2212
+L2216:
+	JR OV, L2219
+L2217:
+	JRL L2215
+L2218:
+	JRL L2220
+L2219:
+	JRL L2218
+L2220:
+	JP LE, L2218
+L2221:
+	JR C, L2224
+L2222:
+	JR NC, L2219
+L2223:
+	DJNZ B, L2226
+L2224:
+	DJNZ B, L2227
+L2225:
+	JR NZ, L2224
+L2226:
+	DJNZ B, L2229
+L2227:
+	CALL L2231
+L2228:
+	JR T, L2231
+L2229:
+	JP LE, L2227
+L2230:
+	CALL L2231
+L2231:
+	JP T, L2227
+L2232:
+	JR C, L2234
+L2233:
+	DJNZ B, L2231
+L2234:
+	JRL L3247
+L2235:
+	JP Z, L3949
+L2236:
+	JP LE, L2240
+L2237:
+	JP MI, L2241
+L2238:
+	JR LE, L2239
+L2239:
+	CALL L2243
+L2240:
+	JRL L2238
+L2241:
+	JP NC, L2243
+L2242:
+	DJNZ B, L2242
+L2243:
+	JR OV, L2246
+L2244:
+	JRL L2247
+L2245:
+	DJNZ B, L2244
+L2246:
+	JRL L2250
+L2247:
+	DJNZ B, L2246
+L2248:
+	JRL L2767
+L2249:
+	CALL L2250
+L2250:
+	JRL L2251
+L2251:
+	JP PL, L4220
+L2252:
+	DJNZ B, L2255
+L2253:
+	DJNZ B, L2256
+L2254:
+	JR LE, L2250
+L2255:
+	JR GT, L2257
+L2256:
+	CALL L2252
+L2257:
+	JP Z, L2258
+L2258:
+	JP MI, L2254
+L2259:
+	CALL L2260
+L2260:
+	JR PL, L2264
+L2261:
+	JR LE, L2265
+L2262:
+	DJNZ B, L2266
+L2263:
+	JRL L2263
+L2264:
+	JR NC, L2267
+L2265:
+	DJNZ B, L2267
+L2266:
+	DJNZ B, L2266
+L2267:
+	CALL L2268
+L2268:
+	CALL L2268
+L2269:
+	JRL L2265
+L2270:
+	JP MI, L2269
+L2271:
+	JRL L3966
+L2272:
+	JR LE, L2271
+L2273:
+	JRL L2022
+L2274:
+	JRL L2275
+L2275:
+	CALL L2272
+L2276:
+	CALL L2280
+L2277:
+	DJNZ B, L2275
+L2278:
+	JP Z, L2277
+L2279:
+	JRL L2277
+L2280:
+	JP PL, L2643
+L2281:
+	JRL L2284
+L2282:
+	JP MI, L2283
+L2283:
+	DJNZ B, L2282
+L2284:
+	JP NZ, L2280
+L2285:
+	JP NZ, L2285
+L2286:
+	CALL L2285
+L2287:
+	JR NZ, L2285
+L2288:
+	JRL L2284
+L2289:
+	CALL L2286
+L2290:
+	CALL L2289
+L2291:
+	DJNZ B, L2293
+L2292:
+	JP GT, L2493
+L2293:
+	CALL L2292
+L2294:
+	JRL L2297
+L2295:
+	CALL L596
+L2296:
+	DJNZ B, L2300
+L2297:
+	JRL L2294
+L2298:
+	DJNZ B, L2298
+L2299:
+	JR C, L2295
+L2300:
+	DJNZ B, L2301
+L2301:
+	JRL L2298
+L2302:
+	JP MI, L2302
+L2303:
+	CALL L2305
+L2304:
+	CALL L2300
+L2305:
+	JRL L2303
+L2306:
+	JP Z, L2310
+L2307:
+	CALL L2311
+L2308:
+	JRL L1277
+L2309:
+	DJNZ B, L2306
+L2310:
+	JR MI, L2311
+L2311:
+	DJNZ B, L2308
+L2312:
+	JRL L2310
+L2313:
+	JRL L2315
+L2314:
+	DJNZ B, L2317
+L2315:
+	CALL L2318
+L2316:
+	JRL L3050
+L2317:
+	DJNZ B, L2317
+L2318:
+	JR PL, L2319
+L2319:
+	CALL L2323
+L2320:
+	JR OV, L2319
+L2321:
+	DJNZ B, L2318
+L2322:
+	DJNZ B, L2321
+L2323:
+	CALL L2327
+L2324:
+	JRL L2320
+L2325:
+	JRL L4417
+L2326:
+	DJNZ B, L2329
+L2327:
+	DJNZ B, L2329
+L2328:
+	CALL L2324
+L2329:
+	JRL L4610
+L2330:
+	CALL L2334
+L2331:
+	JRL L2327
+L2332:
+	CALL L2335
+L2333:
+	JRL L4254
+L2334:
+	JP PL, L2336
+L2335:
+	JR Z, L2331
+L2336:
+	JR NZ, L2335
+L2337:
+	DJNZ B, L2336
+L2338:
+	CALL L2337
+L2339:
+	JRL L2336
+L2340:
+	JRL L2339
+L2341:
+	JR T, L2340
+L2342:
+	CALL L3273
+L2343:
+	JRL L2342
+L2344:
+	JP T, L2343
+L2345:
+	JP C, L2343
+L2346:
+	CALL L2348
+L2347:
+	JR MI, L2343
+L2348:
+	JP PL, L2347
+L2349:
+	JRL L2345
+L2350:
+	CALL L2351
+L2351:
+	JRL L2354
+L2352:
+	JR MI, L2353
+L2353:
+	CALL L4293
+L2354:
+	JR OV, L2358
+L2355:
+	JRL L2356
+L2356:
+	DJNZ B, L2355
+L2357:
+	CALL L2361
+L2358:
+	DJNZ B, L2361
+L2359:
+	JP C, L4727
+L2360:
+	JR GT, L2363
+L2361:
+	DJNZ B, L2365
+L2362:
+	DJNZ B, L2362
+L2363:
+	JP Z, L2363
+L2364:
+	JP NZ, L2368
+L2365:
+	JRL L1477
+L2366:
+	JP MI, L1318
+L2367:
+	CALL L2364
+L2368:
+	DJNZ B, L2369
+L2369:
+	CALL L3161
+L2370:
+	CALL L1307
+L2371:
+	CALL L2368
+L2372:
+	DJNZ B, L2371
+L2373:
+	DJNZ B, L2369
+L2374:
+	JR C, L2377
+L2375:
+	JRL L2376
+L2376:
+	CALL L2374
+L2377:
+	JP C, L2379
+L2378:
+	JP NC, L4576
+L2379:
+	JP C, L1630
+L2380:
+	CALL L2379
+L2381:
+	JR LE, L2381
+L2382:
+	CALL L2384
+L2383:
+	JP MI, L3003
+L2384:
+	JR NC, L2380
+L2385:
+	JR Z, L2383
+L2386:
+	JP PL, L2383
+L2387:
+	JR C, L2390
+L2388:
+	JR OV, L2392
+L2389:
+	JRL L2385
+L2390:
+	JRL L2386
+L2391:
+	JR OV, L2394
+L2392:
+	DJNZ B, L2389
+L2393:
+	DJNZ B, L2394
+L2394:
+	JR PL, L2391
+L2395:
+	DJNZ B, L2391
+L2396:
+	JR MI, L2396
+L2397:
+	DJNZ B, L2398
+L2398:
+	JRL L2238
+L2399:
+	JRL L2399
+L2400:
+	CALL L2400
+L2401:
+	CALL L2404
+L2402:
+	JP GT, L2404
+L2403:
+	CALL L3170
+L2404:
+	DJNZ B, L2403
+L2405:
+	JRL L2407
+L2406:
+	CALL L2407
+L2407:
+	JP T, L2403
+L2408:
+	JR NC, L2408
+L2409:
+	DJNZ B, L2408
+L2410:
+	JRL L2407
+L2411:
+	JRL L2089
+L2412:
+	JRL L2414
+L2413:
+	JR NC, L2416
+L2414:
+	JRL L2416
+L2415:
+	CALL L1890
+L2416:
+	JR GT, L2414
+L2417:
+	JP NZ, L2416
+L2418:
+	JRL L2414
+L2419:
+	JR MI, L2416
+L2420:
+	CALL L2420
+L2421:
+	DJNZ B, L2417
+L2422:
+	JR GT, L2420
+L2423:
+	JRL L2421
+L2424:
+	DJNZ B, L2428
+L2425:
+	JRL L2422
+L2426:
+	DJNZ B, L2429
+L2427:
+	JRL L2428
+L2428:
+	JRL L2430
+L2429:
+	CALL L2433
+L2430:
+	DJNZ B, L2430
+L2431:
+	JR OV, L2433
+L2432:
+	JRL L381
+L2433:
+	JP OV, L2436
+L2434:
+	CALL L2430
+L2435:
+	JP GT, L2431
+L2436:
+	JR C, L2437
+L2437:
+	JR OV, L2436
+L2438:
+	JP NZ, L2437
+L2439:
+	DJNZ B, L2441
+L2440:
+	DJNZ B, L2442
+L2441:
+	JP Z, L2442
+L2442:
+	JRL L2442
+L2443:
+	JR GT, L2445
+L2444:
+	CALL L2443
+L2445:
+	CALL L2448
+L2446:
+	DJNZ B, L2450
+L2447:
+	JP OV, L2447
+L2448:
+	JRL L2446
+L2449:
+	JP GT, L2447
+L2450:
+	JRL L2448
+L2451:
+	JR OV, L2452
+L2452:
+	CALL L2451
+L2453:
+	JR PL, L2455
+L2454:
+	CALL L2097
+L2455:
+	JR T, L2456
+L2456:
+	JR NZ, L2455
+L2457:
+	DJNZ B, L2457
+L2458:
+	JP Z, L2458
+L2459:
+	JR T, L2457
+L2460:
+	JR NC, L2459
+L2461:
+	JR MI, L2462
+L2462:
+	DJNZ B, L2466
+L2463:
+	DJNZ B, L2465
+L2464:
+	CALL L2464
+L2465:
+	DJNZ B, L2468
+L2466:
+	JR Z, L2467
+L2467:
+	DJNZ B, L2463
+L2468:
+	CALL L4021
+L2469:
+	JR OV, L2470
+L2470:
+	JP OV, L2471
+L2471:
+	JR OV, L2470
+L2472:
+	CALL L2468
+L2473:
+	CALL L4440
+L2474:
+	JRL L2474
+L2475:
+	CALL L2479
+L2476:
+	JR T, L2472
+L2477:
+	JRL L2475
+L2478:
+	CALL L4652
+L2479:
+	JP GT, L4753
+L2480:
+	JR OV, L2478
+L2481:
+	JR GT, L2483
+L2482:
+	JR PL, L2486
+L2483:
+	JR PL, L2484
+L2484:
+	JR PL, L2480
+L2485:
+	CALL L2300
+L2486:
+	JR LE, L2489
+L2487:
+	JP C, L3511
+L2488:
+	JP NZ, L2484
+L2489:
+	JR PL, L2491
+L2490:
+	JP NC, L2487
+L2491:
+	JRL L4517
+L2492:
+	CALL L2490
+L2493:
+	CALL L2490
+L2494:
+	CALL L2490
+L2495:
+	JR Z, L2496
+L2496:
+	JRL L2492
+L2497:
+	JR NZ, L2493
+L2498:
+	CALL L2502
+L2499:
+	JP C, L2499
+L2500:
+	CALL L2496
+L2501:
+	JR MI, L2498
+L2502:
+	DJNZ B, L2498
+L2503:
+	JP NC, L1745
+L2504:
+	JRL L2507
+L2505:
+	JRL L2506
+L2506:
+	JRL L2510
+L2507:
+	JP PL, L2506
+L2508:
+	JP LE, L2512
+L2509:
+	JRL L2088
+L2510:
+	JRL L755
+L2511:
+	DJNZ B, L2515
+L2512:
+	JR MI, L2508
+L2513:
+	JR Z, L2511
+L2514:
+	CALL L479
+L2515:
+	JRL L2516
+L2516:
+	JRL L2516
+L2517:
+	JR C, L2518
+L2518:
+	CALL L3262
+L2519:
+	CALL L2522
+L2520:
+	DJNZ B, L2523
+L2521:
+	JR C, L2525
+L2522:
+	DJNZ B, L2519
+L2523:
+	JRL L1751
+L2524:
+	DJNZ B, L2528
+L2525:
+	JRL L1872
+L2526:
+	JRL L2523
+L2527:
+	JR Z, L2528
+L2528:
+	DJNZ B, L2525
+L2529:
+	DJNZ B, L2533
+L2530:
+	CALL L2528
+L2531:
+	JRL L2532
+L2532:
+	JP LE, L3534
+L2533:
+	JR PL, L2537
+L2534:
+	DJNZ B, L2532
+L2535:
+	JR OV, L2536
+L2536:
+	CALL L152
+L2537:
+	JRL L2538
+L2538:
+	JR PL, L2539
+L2539:
+	DJNZ B, L2543
+L2540:
+	JRL L2537
+L2541:
+	DJNZ B, L2541
+L2542:
+	DJNZ B, L2546
+L2543:
+	JP NC, L2545
+L2544:
+	CALL L2547
+L2545:
+	JR C, L2545
+L2546:
+	DJNZ B, L2546
+L2547:
+	CALL L2551
+L2548:
+	JRL L2548
+L2549:
+	JRL L2551
+L2550:
+	JR NZ, L2546
+L2551:
+	JR LE, L2552
+L2552:
+	JRL L2555
+L2553:
+	JP OV, L2555
+L2554:
+	DJNZ B, L2551
+L2555:
+	JRL L2559
+L2556:
+	CALL L2350
+L2557:
+	JRL L2556
+L2558:
+	JR Z, L2554
+L2559:
+	CALL L3853
+L2560:
+	JP C, L1705
+L2561:
+	CALL L2559
+L2562:
+	JRL L2559
+L2563:
+	CALL L2563
+L2564:
+	JR LE, L2566
+L2565:
+	JR NZ, L2564
+L2566:
+	JRL L2564
+L2567:
+	JR T, L2569
+L2568:
+	JRL L4457
+L2569:
+	DJNZ B, L2570
+L2570:
+	JP OV, L2571
+L2571:
+	JP C, L2568
+L2572:
+	CALL L2874
+L2573:
+	DJNZ B, L2577
+L2574:
+	JRL L2570
+L2575:
+	JR Z, L2578
+L2576:
+	JP OV, L2572
+L2577:
+	JP PL, L2579
+L2578:
+	DJNZ B, L2580
+L2579:
+	DJNZ B, L2579
+L2580:
+	DJNZ B, L2583
+L2581:
+	DJNZ B, L2584
+L2582:
+	DJNZ B, L2580
+L2583:
+	JP Z, L2580
+L2584:
+	DJNZ B, L2585
+L2585:
+	DJNZ B, L2582
+L2586:
+	CALL L2584
+L2587:
+	JP PL, L2584
+L2588:
+	DJNZ B, L2586
+L2589:
+	DJNZ B, L2591
+L2590:
+	JR C, L2588
+L2591:
+	DJNZ B, L2594
+L2592:
+	JP LE, L2596
+L2593:
+	JP PL, L4941
+L2594:
+	JR OV, L2597
+L2595:
+	JRL L2593
+L2596:
+	JR C, L2596
+L2597:
+	JR PL, L2597
+L2598:
+	DJNZ B, L2600
+L2599:
+	DJNZ B, L2597
+L2600:
+	JR Z, L2600
+L2601:
+	JRL L2601
+L2602:
+	JR MI, L2605
+L2603:
+	DJNZ B, L2601
+L2604:
+	DJNZ B, L2607
+L2605:
+	JRL L2606
+L2606:
+	JRL L2605
+L2607:
+	JP Z, L2608
+L2608:
+	CALL L2610
+L2609:
+	JRL L2607
+L2610:
+	JP C, L3957
+L2611:
+	DJNZ B, L2614
+L2612:
+	JR NZ, L2611
+L2613:
+	JP T, L2724
+L2614:
+	JP MI, L2618
+L2615:
+	JRL L1065
+L2616:
+	DJNZ B, L2618
+L2617:
+	JRL L2618
+L2618:
+	JR C, L2615
+L2619:
+	JP T, L2618
+L2620:
+	JR OV, L2622
+L2621:
+	CALL L17
+L2622:
+	JP LE, L2624
+L2623:
+	DJNZ B, L2624
+L2624:
+	JRL L2623
+L2625:
+	JR LE, L2628
+L2626:
+	DJNZ B, L2622
+L2627:
+	JR C, L2623
+L2628:
+	JR C, L2625
+L2629:
+	JP T, L2631
+L2630:
+	CALL L2626
+L2631:
+	JR MI, L2629
+L2632:
+	JRL L2634
+L2633:
+	CALL L2634
+L2634:
+	JP LE, L727
+L2635:
+	CALL L2635
+L2636:
+	JRL L2633
+L2637:
+	DJNZ B, L2640
+L2638:
+	JRL L2635
+L2639:
+	JP PL, L2643
+L2640:
+	JR MI, L2636
+L2641:
+	JRL L1804
+L2642:
+	JR MI, L2642
+L2643:
+	JRL L2644
+L2644:
+	JRL L2644
+L2645:
+	DJNZ B, L2648
+L2646:
+	JP C, L2644
+L2647:
+	JRL L2643
+L2648:
+	JR T, L2647
+L2649:
+	DJNZ B, L2650
+L2650:
+	CALL L2649
+L2651:
+	CALL L3148
+L2652:
+	DJNZ B, L2649
+L2653:
+	DJNZ B, L2653
+L2654:
+	JR PL, L2652
+L2655:
+	JP GT, L1303
+L2656:
+	JR GT, L2654
+L2657:
+	DJNZ B, L2654
+L2658:
+	JRL L2654
+L2659:
+	JRL L2660
+L2660:
+	CALL L4431
+L2661:
+	JRL L2659
+L2662:
+	DJNZ B, L2659
+L2663:
+	JP Z, L1093
+L2664:
+	JR Z, L2661
+L2665:
+	JP NZ, L2669
+L2666:
+	JR NZ, L2664
+L2667:
+	DJNZ B, L2668
+L2668:
+	JR C, L2664
+L2669:
+	JP MI, L2673
+L2670:
+	DJNZ B, L2669
+L2671:
+	JR LE, L2673
+L2672:
+	JRL L2670
+L2673:
+	JR GT, L2671
+L2674:
+	JP NZ, L2560
+L2675:
+	JRL L1096
+L2676:
+	JP NC, L2678
+L2677:
+	JRL L2679
+L2678:
+	JRL L2679
+L2679:
+	CALL L2683
+L2680:
+	CALL L2146
+L2681:
+	CALL L2680
+L2682:
+	CALL L2678
+L2683:
+	JR PL, L2687
+L2684:
+	JRL L2688
+L2685:
+	JR MI, L2682
+L2686:
+	JRL L2687
+L2687:
+	JRL L3005
+L2688:
+	JR GT, L2685
+L2689:
+	CALL L2685
+L2690:
+	JP C, L4189
+L2691:
+	JRL L2691
+L2692:
+	DJNZ B, L2696
+L2693:
+	CALL L1528
+L2694:
+	JRL L2697
+L2695:
+	JRL L2693
+L2696:
+	CALL L2694
+L2697:
+	CALL L3276
+L2698:
+	JP NZ, L3571
+L2699:
+	JR T, L2703
+L2700:
+	JR PL, L2699
+L2701:
+	JRL L2699
+L2702:
+	JRL L2699
+L2703:
+	DJNZ B, L2702
+L2704:
+	JRL L2703
+L2705:
+	JR MI, L2702
+L2706:
+	DJNZ B, L2704
+L2707:
+	JP LE, L2711
+L2708:
+	JR MI, L2711
+L2709:
+	CALL L2712
+L2710:
+	CALL L2709
+L2711:
+	CALL L2714
+L2712:
+	JR T, L2716
+L2713:
+	DJNZ B, L2709
+L2714:
+	DJNZ B, L2715
+L2715:
+	DJNZ B, L2715
+L2716:
+	DJNZ B, L2715
+L2717:
+	JR OV, L2721
+L2718:
+	JR NZ, L2719
+L2719:
+	DJNZ B, L2716
+L2720:
+	JRL L2717
+L2721:
+	JRL L2724
+L2722:
+	JR NC, L2720
+L2723:
+	JR OV, L2727
+L2724:
+	CALL L2727
+L2725:
+	JRL L2726
+L2726:
+	JRL L2725
+L2727:
+	DJNZ B, L2726
+L2728:
+	DJNZ B, L2732
+L2729:
+	JP MI, L2726
+L2730:
+	JP NC, L2727
+L2731:
+	JRL L2728
+L2732:
+	JRL L3805
+L2733:
+	DJNZ B, L2736
+L2734:
+	DJNZ B, L2732
+L2735:
+	JP NZ, L2734
+L2736:
+	JP PL, L2735
+L2737:
+	JRL L2736
+L2738:
+	DJNZ B, L2736
+L2739:
+	CALL L2737
+L2740:
+	JRL L2737
+L2741:
+	DJNZ B, L2738
+L2742:
+	JRL L2740
+L2743:
+	CALL L3811
+L2744:
+	JR PL, L2744
+L2745:
+	JP PL, L2456
+L2746:
+	CALL L2742
+L2747:
+	JR PL, L2745
+L2748:
+	JRL L2751
+L2749:
+	JR NZ, L2753
+L2750:
+	JRL L2754
+L2751:
+	CALL L2751
+L2752:
+	JR PL, L2754
+L2753:
+	DJNZ B, L2757
+L2754:
+	JP C, L2970
+L2755:
+	JP T, L145
+L2756:
+	JRL L3764
+L2757:
+	JRL L2761
+L2758:
+	CALL L2269
+L2759:
+	DJNZ B, L2758
+L2760:
+	JRL L2764
+L2761:
+	JR GT, L2764
+L2762:
+	DJNZ B, L2764
+L2763:
+	CALL L2763
+L2764:
+	JRL L2766
+L2765:
+	JP MI, L2762
+L2766:
+	DJNZ B, L2765
+L2767:
+	DJNZ B, L2765
+L2768:
+	JR C, L2767
+L2769:
+	JRL L4662
+L2770:
+	DJNZ B, L2768
+L2771:
+	JRL L3553
+L2772:
+	JR OV, L2771
+L2773:
+	JR OV, L2769
+L2774:
+	JP OV, L2775
+L2775:
+	CALL L2774
+L2776:
+	DJNZ B, L2774
+L2777:
+	DJNZ B, L2774
+L2778:
+	DJNZ B, L2782
+L2779:
+	JR OV, L2776
+L2780:
+	DJNZ B, L2782
+L2781:
+	JP NC, L1635
+L2782:
+	JP PL, L2784
+L2783:
+	JP C, L3565
+L2784:
+	JP PL, L818
+L2785:
+	JP T, L2785
+L2786:
+	JRL L2845
+L2787:
+	CALL L1909
+L2788:
+	JRL L2785
+L2789:
+	CALL L2790
+L2790:
+	JR MI, L2786
+L2791:
+	DJNZ B, L2787
+L2792:
+	CALL L2796
+L2793:
+	CALL L2795
+L2794:
+	DJNZ B, L2791
+L2795:
+	JP NC, L2792
+L2796:
+	CALL L2799
+L2797:
+	JR T, L2801
+L2798:
+	JRL L2794
+L2799:
+	DJNZ B, L2796
+L2800:
+	DJNZ B, L2802
+L2801:
+	CALL L2800
+L2802:
+	DJNZ B, L2800
+L2803:
+	JR NZ, L2802
+L2804:
+	JR OV, L2807
+L2805:
+	CALL L2809
+L2806:
+	JP PL, L2808
+L2807:
+	CALL L2807
+L2808:
+	DJNZ B, L2809
+L2809:
+	JR MI, L2810
+L2810:
+	JP C, L4931
+L2811:
+	DJNZ B, L2814
+L2812:
+	JP MI, L2811
+L2813:
+	JP LE, L2811
+L2814:
+	CALL L283
+L2815:
+	CALL L3514
+L2816:
+	DJNZ B, L2813
+L2817:
+	DJNZ B, L2821
+L2818:
+	JP PL, L2814
+L2819:
+	JP GT, L2815
+L2820:
+	DJNZ B, L2824
+L2821:
+	JP NZ, L2820
+L2822:
+	CALL L2825
+L2823:
+	CALL L2825
+L2824:
+	JRL L2822
+L2825:
+	JP OV, L873
+L2826:
+	DJNZ B, L2830
+L2827:
+	DJNZ B, L2825
+L2828:
+	CALL L2824
+L2829:
+	JRL L2832
+L2830:
+	JP NZ, L2828
+L2831:
+	DJNZ B, L2832
+L2832:
+	DJNZ B, L2834
+L2833:
+	JP GT, L2126
+L2834:
+	DJNZ B, L2831
+L2835:
+	CALL L2837
+L2836:
+	JRL L2834
+L2837:
+	JRL L3454
+L2838:
+	JP NC, L2840
+L2839:
+	DJNZ B, L2841
+L2840:
+	JP C, L2836
+L2841:
+	DJNZ B, L2844
+L2842:
+	JRL L2843
+L2843:
+	JRL L2841
+L2844:
+	JR MI, L2848
+L2845:
+	JRL L2841
+L2846:
+	JP PL, L2846
+L2847:
+	CALL L2846
+L2848:
+	CALL L4285
+L2849:
+	CALL L4886
+L2850:
+	JP OV, L2852
+L2851:
+	DJNZ B, L2849
+L2852:
+	JRL L332
+L2853:
+	JRL L2855
+L2854:
+	JP T, L2856
+L2855:
+	CALL L2859
+L2856:
+	CALL L4709
+L2857:
+	DJNZ B, L2861
+L2858:
+	CALL L2856
+L2859:
+	CALL L2857
+L2860:
+	DJNZ B, L2862
+L2861:
+	JRL L2861
+L2862:
+	DJNZ B, L2859
+L2863:
+	CALL L3315
+L2864:
+	JR C, L2868
+L2865:
+	JR NC, L2867
+L2866:
+	JR Z, L2862
+L2867:
+	JP OV, L2867
+L2868:
+	CALL L2864
+L2869:
+	CALL L2867
+L2870:
+	JR PL, L2866
+L2871:
+	CALL L2871
+L2872:
+	JR OV, L2873
+L2873:
+	JRL L2875
+L2874:
+	CALL L3368
+L2875:
+	JR NC, L2874
+L2876:
+	JR PL, L2872
+L2877:
+	DJNZ B, L2881
+L2878:
+	JRL L925
+L2879:
+	DJNZ B, L2877
+L2880:
+	JRL L395
+L2881:
+	JRL L2882
+L2882:
+	CALL L2881
+L2883:
+	DJNZ B, L2886
+L2884:
+	JRL L2888
+L2885:
+	JP PL, L2881
+L2886:
+	JR NC, L2890
+L2887:
+	JR GT, L2884
+L2888:
+	DJNZ B, L2885
+L2889:
+	DJNZ B, L2891
+L2890:
+	JR Z, L2891
+L2891:
+	JP NC, L2892
+L2892:
+	JR GT, L2888
+L2893:
+	JR MI, L2889
+L2894:
+	JRL L2893
+L2895:
+	JP MI, L2896
+L2896:
+	CALL L2895
+L2897:
+	CALL L2897
+L2898:
+	DJNZ B, L2894
+L2899:
+	DJNZ B, L2903
+L2900:
+	JP MI, L2898
+L2901:
+	JRL L2905
+L2902:
+	JRL L2903
+L2903:
+	JR GT, L2905
+L2904:
+	JRL L2907
+L2905:
+	JP Z, L2901
+L2906:
+	CALL L1209
+L2907:
+	DJNZ B, L2908
+L2908:
+	JR OV, L2905
+L2909:
+	DJNZ B, L2909
+L2910:
+	JR GT, L2912
+L2911:
+	JRL L2908
+L2912:
+	DJNZ B, L2908
+L2913:
+	CALL L2909
+L2914:
+	DJNZ B, L2916
+L2915:
+	CALL L2911
+L2916:
+	JRL L2912
+L2917:
+	CALL L2917
+L2918:
+	JP PL, L2915
+L2919:
+	CALL L2450
+L2920:
+	CALL L2923
+L2921:
+	JP Z, L3350
+L2922:
+	JP LE, L2924
+L2923:
+	DJNZ B, L2924
+L2924:
+	JP PL, L3120
+L2925:
+	JRL L2923
+L2926:
+	JRL L2925
+L2927:
+	CALL L1817
+L2928:
+	DJNZ B, L2924
+L2929:
+	CALL L3661
+L2930:
+	JP PL, L4501
+L2931:
+	DJNZ B, L2934
+L2932:
+	JRL L2936
+L2933:
+	CALL L2933
+L2934:
+	JRL L2933
+L2935:
+	DJNZ B, L2935
+L2936:
+	JR NC, L2937
+L2937:
+	DJNZ B, L2938
+L2938:
+	DJNZ B, L2941
+L2939:
+	JRL L2938
+L2940:
+	JP PL, L2938
+L2941:
+	JR PL, L2944
+L2942:
+	JRL L941
+L2943:
+	JP T, L2947
+L2944:
+	CALL L2944
+L2945:
+	CALL L3085
+L2946:
+	JR NC, L2947
+L2947:
+	JR LE, L2943
+L2948:
+	CALL L2946
+L2949:
+	JRL L213
+L2950:
+	DJNZ B, L2947
+L2951:
+	JRL L3979
+L2952:
+	CALL L1677
+L2953:
+	JR LE, L2954
+L2954:
+	JR NZ, L2953
+L2955:
+	JRL L2959
+L2956:
+	CALL L2954
+L2957:
+	JR LE, L2953
+L2958:
+	CALL L2961
+L2959:
+	JR LE, L2960
+L2960:
+	JR NC, L2963
+L2961:
+	JR GT, L2959
+L2962:
+	DJNZ B, L2959
+L2963:
+	CALL L2960
+L2964:
+	CALL L2961
+L2965:
+	JRL L3527
+L2966:
+	JR LE, L2967
+L2967:
+	JR C, L2965
+L2968:
+	JP LE, L4668
+L2969:
+	CALL L2092
+L2970:
+	JR PL, L2968
+L2971:
+	JR C, L2970
+L2972:
+	DJNZ B, L2973
+L2973:
+	CALL L2972
+L2974:
+	JR LE, L2970
+L2975:
+	JP MI, L4497
+L2976:
+	JRL L2976
+L2977:
+	CALL L2976
+L2978:
+	CALL L2977
+L2979:
+	JR OV, L2978
+L2980:
+	DJNZ B, L2980
+L2981:
+	CALL L133
+L2982:
+	CALL L3025
+L2983:
+	JP PL, L2979
+L2984:
+	JRL L2982
+L2985:
+	JR MI, L2985
+L2986:
+	JP LE, L2990
+L2987:
+	CALL L2986
+L2988:
+	JR OV, L2991
+L2989:
+	JP LE, L1154
+L2990:
+	JP C, L2987
+L2991:
+	CALL L2993
+L2992:
+	JP C, L2989
+L2993:
+	JR GT, L2991
+L2994:
+	JP PL, L2991
+L2995:
+	CALL L2993
+L2996:
+	JR Z, L2998
+L2997:
+	JP LE, L2998
+L2998:
+	JR T, L3002
+L2999:
+	JRL L2996
+L3000:
+	CALL L3000
+L3001:
+	DJNZ B, L3005
+L3002:
+	JP PL, L3003
+L3003:
+	JRL L565
+L3004:
+	CALL L3007
+L3005:
+	DJNZ B, L3005
+L3006:
+	DJNZ B, L3007
+L3007:
+	JP MI, L3011
+L3008:
+	CALL L3012
+L3009:
+	DJNZ B, L3008
+L3010:
+	JRL L3010
+L3011:
+	JRL L3014
+L3012:
+	JRL L3008
+L3013:
+	JR T, L3011
+L3014:
+	JR NZ, L3010
+L3015:
+	JP LE, L3011
+L3016:
+	JP T, L1532
+L3017:
+	DJNZ B, L3013
+L3018:
+	CALL L3016
+L3019:
+	JR T, L3020
+L3020:
+	JP GT, L3018
+L3021:
+	DJNZ B, L3023
+L3022:
+	DJNZ B, L3022
+L3023:
+	CALL L3026
+L3024:
+	JP C, L3021
+L3025:
+	CALL L4372
+L3026:
+	JR C, L3029
+L3027:
+	JR C, L3026
+L3028:
+	JP NZ, L3032
+L3029:
+	CALL L3025
+L3030:
+	CALL L3029
+L3031:
+	JR C, L3032
+L3032:
+	JP PL, L3034
+L3033:
+	CALL L4416
+L3034:
+	CALL L1424
+L3035:
+	DJNZ B, L3036
+L3036:
+	DJNZ B, L3040
+L3037:
+	JRL L1001
+L3038:
+	JRL L3039
+L3039:
+	CALL L3036
+L3040:
+	JP OV, L3044
+L3041:
+	DJNZ B, L3043
+L3042:
+	DJNZ B, L3041
+L3043:
+	JR GT, L3040
+L3044:
+	JR OV, L3046
+L3045:
+	JR MI, L3043
+L3046:
+	JRL L3042
+L3047:
+	JRL L3051
+L3048:
+	CALL L3046
+L3049:
+	DJNZ B, L3052
+L3050:
+	CALL L4096
+L3051:
+	CALL L3051
+L3052:
+	CALL L3054
+L3053:
+	DJNZ B, L3055
+L3054:
+	CALL L3716
+L3055:
+	JP NC, L122
+L3056:
+	JR Z, L3057
+L3057:
+	JR PL, L3058
+L3058:
+	JR NC, L3060
+L3059:
+	JP Z, L3060
+L3060:
+	CALL L3061
+L3061:
+	DJNZ B, L3057
+L3062:
+	JRL L3062
+L3063:
+	CALL L3890
+L3064:
+	JR NZ, L3066
+L3065:
+	JRL L3067
+L3066:
+	JP OV, L3062
+L3067:
+	JRL L3064
+L3068:
+	JRL L3377
+L3069:
+	JR LE, L3065
+L3070:
+	DJNZ B, L3066
+L3071:
+	JR MI, L3067
+L3072:
+	JP GT, L3071
+L3073:
+	DJNZ B, L3070
+L3074:
+	JR MI, L3077
+L3075:
+	JRL L3079
+L3076:
+	JP LE, L918
+L3077:
+	JRL L3073
+L3078:
+	DJNZ B, L3080
+L3079:
+	DJNZ B, L3083
+L3080:
+	JP PL, L3080
+L3081:
+	JP NC, L3080
+L3082:
+	JP PL, L3081
+L3083:
+	DJNZ B, L3081
+L3084:
+	JR Z, L3083
+L3085:
+	JRL L3086
+L3086:
+	JP NC, L3089
+L3087:
+	JR NZ, L3085
+L3088:
+	JRL L3090
+L3089:
+	JRL L3092
+L3090:
+	JRL L3087
+L3091:
+	CALL L3090
+L3092:
+	DJNZ B, L3088
+L3093:
+	JRL L1406
+L3094:
+	DJNZ B, L3095
+L3095:
+	JP LE, L3092
+L3096:
+	JRL L3093
+L3097:
+	JR LE, L3098
+L3098:
+	DJNZ B, L3094
+L3099:
+	JRL L3096
+L3100:
+	DJNZ B, L3103
+L3101:
+	JP T, L3050
+L3102:
+	DJNZ B, L3101
+L3103:
+	JRL L3107
+L3104:
+	JP C, L2599
+L3105:
+	DJNZ B, L3101
+L3106:
+	DJNZ B, L3108
+L3107:
+	JRL L3110
+L3108:
+	DJNZ B, L3107
+L3109:
+	CALL L3113
+L3110:
+	CALL L3110
+L3111:
+	DJNZ B, L3107
+L3112:
+	JRL L3112
+L3113:
+	CALL L3111
+L3114:
+	CALL L1617
+L3115:
+	CALL L3116
+L3116:
+	JRL L980
+L3117:
+	JP C, L3113
+L3118:
+	JRL L47
+L3119:
+	JP MI, L3116
+L3120:
+	JR PL, L3120
+L3121:
+	CALL L3119
+L3122:
+	DJNZ B, L3118
+L3123:
+	CALL L3125
+L3124:
+	CALL L3125
+L3125:
+	JR C, L3125
+L3126:
+	JR Z, L3125
+L3127:
+	JP OV, L3125
+L3128:
+	DJNZ B, L3126
+L3129:
+	JP OV, L3131
+L3130:
+	CALL L3128
+L3131:
+	DJNZ B, L3131
+L3132:
+	CALL L3133
+L3133:
+	DJNZ B, L3133
+L3134:
+	JRL L3811
+L3135:
+	CALL L4356
+L3136:
+	JR GT, L3137
+L3137:
+	JR C, L3133
+L3138:
+	JRL L3134
+L3139:
+	DJNZ B, L3143
+L3140:
+	CALL L3143
+L3141:
+	JP NZ, L3139
+L3142:
+	DJNZ B, L3144
+L3143:
+	CALL L275
+L3144:
+	CALL L3145
+L3145:
+	JRL L3144
+L3146:
+	JRL L3145
+L3147:
+	DJNZ B, L3150
+L3148:
+	CALL L3147
+L3149:
+	JP GT, L3153
+L3150:
+	JR Z, L3151
+L3151:
+	DJNZ B, L3149
+L3152:
+	CALL L3149
+L3153:
+	JP LE, L3153
+L3154:
+	JP Z, L3153
+L3155:
+	JRL L4952
+L3156:
+	DJNZ B, L3155
+L3157:
+	DJNZ B, L3159
+L3158:
+	DJNZ B, L3161
+L3159:
+	CALL L3159
+L3160:
+	JR NC, L3160
+L3161:
+	DJNZ B, L3159
+L3162:
+	JRL L3479
+L3163:
+	DJNZ B, L3166
+L3164:
+	JRL L3163
+L3165:
+	CALL L3169
+L3166:
+	JP Z, L3167
+L3167:
+	CALL L947
+L3168:
+	CALL L3166
+L3169:
+	JP OV, L3167
+L3170:
+	JRL L3174
+L3171:
+	JRL L3170
+L3172:
+	CALL L106
+L3173:
+	JP T, L3175
+L3174:
+	JP C, L3171
+L3175:
+	JP PL, L3176
+L3176:
+	JP Z, L1363
+L3177:
+	JP LE, L3176
+L3178:
+	JRL L3627
+L3179:
+	CALL L3180
+L3180:
+	CALL L3182
+L3181:
+	JP GT, L3181
+L3182:
+	DJNZ B, L3180
+L3183:
+	JR NC, L3185
+L3184:
+	JR LE, L3185
+L3185:
+	JR Z, L3189
+L3186:
+	CALL L3183
+L3187:
+	DJNZ B, L3187
+L3188:
+	DJNZ B, L3191
+L3189:
+	JRL L3187
+L3190:
+	CALL L3191
+L3191:
+	JP MI, L3187
+L3192:
+	CALL L2277
+L3193:
+	JRL L3189
+L3194:
+	JP PL, L1380
+L3195:
+	JP Z, L725
+L3196:
+	CALL L3199
+L3197:
+	JR C, L3201
+L3198:
+	JP T, L2048
+L3199:
+	JRL L3199
+L3200:
+	DJNZ B, L3204
+L3201:
+	CALL L3574
+L3202:
+	CALL L221
+L3203:
+	DJNZ B, L3202
+L3204:
+	JRL L329
+L3205:
+	DJNZ B, L3204
+L3206:
+	JR OV, L3204
+L3207:
+	JP OV, L3431
+L3208:
+	JP GT, L4170
+L3209:
+	JR C, L3207
+L3210:
+	JP Z, L3208
+L3211:
+	JR Z, L3211
+L3212:
+	DJNZ B, L3213
+L3213:
+	DJNZ B, L3216
+L3214:
+	JRL L3216
+L3215:
+	JRL L4488
+L3216:
+	CALL L61
+L3217:
+	DJNZ B, L3221
+L3218:
+	JR LE, L3216
+L3219:
+	JR NZ, L3222
+L3220:
+	JRL L3251
+L3221:
+	JR Z, L3224
+L3222:
+	DJNZ B, L3223
+L3223:
+	JP OV, L3226
+L3224:
+	JP OV, L3223
+L3225:
+	DJNZ B, L3228
+L3226:
+	DJNZ B, L3222
+L3227:
+	JP GT, L3226
+L3228:
+	JR LE, L3225
+L3229:
+	JP PL, L660
+L3230:
+	DJNZ B, L3232
+L3231:
+	JR NC, L3229
+L3232:
+	DJNZ B, L3232
+L3233:
+	DJNZ B, L3233
+L3234:
+	JP MI, L827
+L3235:
+	JR OV, L3232
+L3236:
+	DJNZ B, L3236
+L3237:
+	JR GT, L3236
+L3238:
+	DJNZ B, L3238
+L3239:
+	DJNZ B, L3239
+L3240:
+	JRL L3239
+L3241:
+	DJNZ B, L3242
+L3242:
+	CALL L3246
+L3243:
+	JR GT, L3245
+L3244:
+	DJNZ B, L3243
+L3245:
+	JP LE, L3249
+L3246:
+	CALL L710
+L3247:
+	DJNZ B, L3250
+L3248:
+	DJNZ B, L3246
+L3249:
+	JRL L3245
+L3250:
+	JR GT, L3247
+L3251:
+	DJNZ B, L3253
+L3252:
+	DJNZ B, L3255
+L3253:
+	JP C, L3249
+L3254:
+	JRL L3251
+L3255:
+	DJNZ B, L3257
+L3256:
+	JP GT, L1685
+L3257:
+	JP MI, L3259
+L3258:
+	JP LE, L3260
+L3259:
+	JR GT, L3258
+L3260:
+	JR MI, L3260
+L3261:
+	JRL L3258
+L3262:
+	CALL L3263
+L3263:
+	CALL L3267
+L3264:
+	JP OV, L3265
+L3265:
+	CALL L3262
+L3266:
+	JP LE, L3262
+L3267:
+	JR PL, L3268
+L3268:
+	JRL L3272
+L3269:
+	JP NZ, L3266
+L3270:
+	JRL L3273
+L3271:
+	JR C, L3270
+L3272:
+	JP MI, L676
+L3273:
+	JRL L3269
+L3274:
+	JP LE, L3273
+L3275:
+	JR MI, L3279
+L3276:
+	DJNZ B, L3274
+L3277:
+	JR OV, L3276
+L3278:
+	CALL L3281
+L3279:
+	DJNZ B, L3278
+L3280:
+	JP NZ, L3276
+L3281:
+	DJNZ B, L3281
+L3282:
+	DJNZ B, L3285
+L3283:
+	DJNZ B, L3287
+L3284:
+	CALL L3282
+L3285:
+	CALL L3282
+L3286:
+	CALL L3289
+L3287:
+	CALL L3285
+L3288:
+	JRL L3287
+L3289:
+	JRL L3291
+L3290:
+	CALL L3291
+L3291:
+	JR NZ, L3288
+L3292:
+	DJNZ B, L3293
+L3293:
+	DJNZ B, L3294
+L3294:
+	CALL L3294
+L3295:
+	DJNZ B, L3299
+L3296:
+	JP Z, L3294
+L3297:
+	DJNZ B, L3295
+L3298:
+	JP NZ, L3297
+L3299:
+	JRL L3296
+L3300:
+	JP C, L3298
+L3301:
+	JRL L800
+L3302:
+	CALL L750
+L3303:
+	JRL L3304
+L3304:
+	JRL L3308
+L3305:
+	JR T, L3302
+L3306:
+	JP T, L3302
+L3307:
+	JR C, L3311
+L3308:
+	JRL L3307
+L3309:
+	DJNZ B, L3313
+L3310:
+	DJNZ B, L3311
+L3311:
+	CALL L3310
+L3312:
+	CALL L3308
+L3313:
+	JRL L4468
+L3314:
+	JR NC, L3318
+L3315:
+	JP LE, L3319
+L3316:
+	JRL L4862
+L3317:
+	JP T, L3318
+L3318:
+	JR C, L3316
+L3319:
+	JR NC, L3315
+L3320:
+	DJNZ B, L3319
+L3321:
+	DJNZ B, L3325
+L3322:
+	CALL L3319
+L3323:
+	DJNZ B, L3323
+L3324:
+	JR MI, L3320
+L3325:
+	JP PL, L3329
+L3326:
+	DJNZ B, L3324
+L3327:
+	JRL L3326
+L3328:
+	JRL L4790
+L3329:
+	DJNZ B, L3328
+L3330:
+	JRL L316
+L3331:
+	DJNZ B, L3329
+L3332:
+	JP MI, L3335
+L3333:
+	JRL L3334
+L3334:
+	JP NC, L3337
+L3335:
+	JP MI, L3335
+L3336:
+	JR T, L3332
+L3337:
+	JRL L3504
+L3338:
+	JP LE, L940
+L3339:
+	JP NZ, L3339
+L3340:
+	DJNZ B, L3341
+L3341:
+	JR C, L3338
+L3342:
+	CALL L3342
+L3343:
+	JRL L3344
+L3344:
+	JRL L1766
+L3345:
+	JP T, L3344
+L3346:
+	JR MI, L3345
+L3347:
+	JRL L3343
+L3348:
+	JR GT, L3348
+L3349:
+	JRL L4202
+L3350:
+	JR LE, L3354
+L3351:
+	JRL L3347
+L3352:
+	DJNZ B, L3353
+L3353:
+	JP LE, L3352
+L3354:
+	JRL L3350
+L3355:
+	JRL L3354
+L3356:
+	DJNZ B, L3353
+L3357:
+	CALL L3356
+L3358:
+	DJNZ B, L3361
+L3359:
+	JP NC, L2689
+L3360:
+	JR PL, L3364
+L3361:
+	DJNZ B, L3361
+L3362:
+	CALL L3363
+L3363:
+	JRL L3423
+L3364:
+	JP GT, L3361
+L3365:
+	JR PL, L3362
+L3366:
+	JRL L3367
+L3367:
+	CALL L3364
+L3368:
+	JP Z, L3371
+L3369:
+	JR T, L3372
+L3370:
+	DJNZ B, L3371
+L3371:
+	CALL L3374
+L3372:
+	JRL L3375
+L3373:
+	CALL L3370
+L3374:
+	JP NC, L3371
+L3375:
+	CALL L3376
+L3376:
+	DJNZ B, L3376
+L3377:
+	JR C, L3380
+L3378:
+	JP NC, L3382
+L3379:
+	DJNZ B, L3377
+L3380:
+	CALL L1928
+L3381:
+	JP GT, L3381
+L3382:
+	JRL L4862
+L3383:
+	CALL L3381
+L3384:
+	JP Z, L3383
+L3385:
+	CALL L3388
+L3386:
+	DJNZ B, L3382
+L3387:
+	JRL L3389
+L3388:
+	JR OV, L3389
+L3389:
+	JR MI, L3391
+L3390:
+	JR MI, L3392
+L3391:
+	CALL L3388
+L3392:
+	JRL L3391
+L3393:
+	JRL L3391
+L3394:
+	JRL L3393
+L3395:
+	JP Z, L4169
+L3396:
+	JRL L2397
+L3397:
+	DJNZ B, L3395
+L3398:
+	CALL L229
+L3399:
+	JP C, L3400
+L3400:
+	CALL L3401
+L3401:
+	JR Z, L3400
+L3402:
+	JP NC, L3404
+L3403:
+	CALL L3404
+L3404:
+	CALL L3407
+L3405:
+	CALL L4509
+L3406:
+	JRL L3409
+L3407:
+	JR OV, L3403
+L3408:
+	DJNZ B, L3412
+L3409:
+	JR NC, L3406
+L3410:
+	CALL L3414
+L3411:
+	JP LE, L3409
+L3412:
+	DJNZ B, L3408
+L3413:
+	JP PL, L3409
+L3414:
+	CALL L3413
+L3415:
+	JP LE, L3416
+L3416:
+	CALL L3416
+L3417:
+	CALL L3419
+L3418:
+	CALL L3420
+L3419:
+	CALL L3423
+L3420:
+	CALL L1698
+L3421:
+	JRL L3419
+L3422:
+	JP GT, L3421
+L3423:
+	DJNZ B, L3425
+L3424:
+	CALL L3423
+L3425:
+	CALL L3428
+L3426:
+	JP C, L1767
+L3427:
+	CALL L3427
+L3428:
+	DJNZ B, L3432
+L3429:
+	JR OV, L3426
+L3430:
+	JRL L1363
+L3431:
+	JRL L3428
+L3432:
+	DJNZ B, L3429
+L3433:
+	JP NC, L3429
+L3434:
+	DJNZ B, L3430
+L3435:
+	JRL L3438
+L3436:
+	CALL L3440
+L3437:
+	CALL L3441
+L3438:
+	JRL L3086
+L3439:
+	CALL L3440
+L3440:
+	JR MI, L3438
+L3441:
+	JRL L3441
+L3442:
+	JP GT, L3445
+L3443:
+	JRL L3440
+L3444:
+	JP NZ, L3440
+L3445:
+	JRL L3449
+L3446:
+	CALL L3447
+L3447:
+	CALL L3451
+L3448:
+	JP T, L3708
+L3449:
+	DJNZ B, L3452
+L3450:
+	DJNZ B, L3453
+L3451:
+	JRL L3454
+L3452:
+	CALL L3453
+L3453:
+	CALL L3450
+L3454:
+	CALL L3458
+L3455:
+	CALL L3459
+L3456:
+	JP T, L3453
+L3457:
+	JR GT, L3455
+L3458:
+	DJNZ B, L3457
+L3459:
+	JP OV, L3459
+L3460:
+	DJNZ B, L3459
+L3461:
+	JRL L3461
+L3462:
+	JRL L3466
+L3463:
+	JRL L1207
+L3464:
+	JR Z, L3465
+L3465:
+	JP PL, L3468
+L3466:
+	JP C, L3463
+L3467:
+	DJNZ B, L3470
+L3468:
+	JP C, L3249
+L3469:
+	JR NZ, L3472
+L3470:
+	JR NC, L3474
+L3471:
+	JRL L3096
+L3472:
+	JP C, L3976
+L3473:
+	JR Z, L3475
+L3474:
+	JR GT, L3475
+L3475:
+	JP GT, L3471
+L3476:
+	DJNZ B, L3472
+L3477:
+	DJNZ B, L3476
+L3478:
+	JP NZ, L3477
+L3479:
+	JR OV, L3482
+L3480:
+	JRL L3482
+L3481:
+	CALL L4783
+L3482:
+	JR C, L3479
+L3483:
+	CALL L3481
+L3484:
+	CALL L3484
+L3485:
+	DJNZ B, L3483
+L3486:
+	JP LE, L3485
+L3487:
+	JP MI, L3491
+L3488:
+	JRL L3486
+L3489:
+	JP GT, L3489
+L3490:
+	JP NZ, L3489
+L3491:
+	JP GT, L1923
+L3492:
+	JR NZ, L3495
+L3493:
+	JP T, L3493
+L3494:
+	JP NZ, L3491
+L3495:
+	JP MI, L3499
+L3496:
+	JP PL, L3499
+L3497:
+	JR OV, L3500
+L3498:
+	CALL L3499
+L3499:
+	DJNZ B, L3498
+L3500:
+	JR NZ, L3499
+L3501:
+	JP NC, L3503
+L3502:
+	JRL L3500
+L3503:
+	CALL L3506
+L3504:
+	JR MI, L3503
+L3505:
+	JR GT, L3505
+L3506:
+	JR MI, L3505
+L3507:
+	CALL L1933
+L3508:
+	DJNZ B, L3510
+L3509:
+	JRL L3506
+L3510:
+	CALL L3513
+L3511:
+	JRL L1026
+L3512:
+	CALL L4487
+L3513:
+	JR PL, L3512
+L3514:
+	JP MI, L3515
+L3515:
+	JRL L3277
+L3516:
+	DJNZ B, L3512
+L3517:
+	JRL L3518
+L3518:
+	JP NZ, L3517
+L3519:
+	CALL L3516
+L3520:
+	CALL L3520
+L3521:
+	JRL L3518
+L3522:
+	JP GT, L3524
+L3523:
+	JP OV, L10
+L3524:
+	JP LE, L3524
+L3525:
+	JR T, L3529
+L3526:
+	JRL L3551
+L3527:
+	CALL L3523
+L3528:
+	DJNZ B, L3526
+L3529:
+	JP PL, L3311
+L3530:
+	JP NZ, L3529
+L3531:
+	DJNZ B, L3528
+L3532:
+	CALL L3530
+L3533:
+	DJNZ B, L3537
+L3534:
+	JRL L3232
+L3535:
+	JRL L2957
+L3536:
+	CALL L3532
+L3537:
+	JP GT, L3536
+L3538:
+	DJNZ B, L3541
+L3539:
+	JRL L1703
+L3540:
+	JR NZ, L3539
+L3541:
+	DJNZ B, L3540
+L3542:
+	JR C, L3538
+L3543:
+	CALL L3543
+L3544:
+	JRL L3548
+L3545:
+	DJNZ B, L3549
+L3546:
+	CALL L3542
+L3547:
+	CALL L3548
+L3548:
+	DJNZ B, L3544
+L3549:
+	DJNZ B, L3548
+L3550:
+	JR GT, L3551
+L3551:
+	JRL L3555
+L3552:
+	JP Z, L3551
+L3553:
+	CALL L3557
+L3554:
+	JRL L3552
+L3555:
+	JP PL, L3553
+L3556:
+	CALL L334
+L3557:
+	JRL L3559
+L3558:
+	JRL L490
+L3559:
+	CALL L3559
+L3560:
+	JRL L2962
+L3561:
+	JRL L3564
+L3562:
+	CALL L1459
+L3563:
+	JRL L3562
+L3564:
+	JR GT, L3564
+L3565:
+	DJNZ B, L3568
+L3566:
+	JR C, L3564
+L3567:
+	JR NZ, L3571
+L3568:
+	JRL L3570
+L3569:
+	DJNZ B, L3570
+L3570:
+	JRL L3566
+L3571:
+	DJNZ B, L3573
+L3572:
+	JR GT, L3575
+L3573:
+	JP OV, L1430
+L3574:
+	JRL L3576
+L3575:
+	JR PL, L3575
+L3576:
+	JR PL, L3577
+L3577:
+	JR NC, L3577
+L3578:
+	JR Z, L3575
+L3579:
+	JP NC, L3583
+L3580:
+	JR NC, L3579
+L3581:
+	JP GT, L3580
+L3582:
+	DJNZ B, L3578
+L3583:
+	JP C, L3587
+L3584:
+	JP PL, L924
+L3585:
+	CALL L3589
+L3586:
+	JRL L318
+L3587:
+	JRL L1895
+L3588:
+	JR T, L3585
+L3589:
+	JP MI, L3592
+L3590:
+	JRL L3591
+L3591:
+	DJNZ B, L3590
+L3592:
+	JR C, L3596
+L3593:
+	JP T, L3596
+L3594:
+	JRL L3590
+L3595:
+	JP GT, L3593
+L3596:
+	DJNZ B, L3592
+L3597:
+	JRL L3601
+L3598:
+	CALL L3596
+L3599:
+	CALL L3599
+L3600:
+	JRL L3598
+L3601:
+	JP LE, L3601
+L3602:
+	JP GT, L3604
+L3603:
+	CALL L3607
+L3604:
+	JR T, L3605
+L3605:
+	CALL L3609
+L3606:
+	JR PL, L3606
+L3607:
+	DJNZ B, L3605
+L3608:
+	DJNZ B, L3607
+L3609:
+	JR GT, L3609
+L3610:
+	JP T, L2082
+L3611:
+	CALL L1811
+L3612:
+	JR LE, L3616
+L3613:
+	DJNZ B, L3617
+L3614:
+	JP OV, L3612
+L3615:
+	CALL L3618
+L3616:
+	DJNZ B, L3619
+L3617:
+	CALL L3025
+L3618:
+	DJNZ B, L3616
+L3619:
+	DJNZ B, L3621
+L3620:
+	CALL L3407
+L3621:
+	JP LE, L4860
+L3622:
+	JRL L3623
+L3623:
+	JRL L3627
+L3624:
+	JP MI, L4347
+L3625:
+	CALL L733
+L3626:
+	CALL L3624
+L3627:
+	JP T, L3630
+L3628:
+	JP NC, L3627
+L3629:
+	JP Z, L3627
+L3630:
+	DJNZ B, L3629
+L3631:
+	JR OV, L3628
+L3632:
+	DJNZ B, L3634
+L3633:
+	JP Z, L2511
+L3634:
+	CALL L3631
+L3635:
+	DJNZ B, L3637
+L3636:
+	CALL L3638
+L3637:
+	DJNZ B, L3636
+L3638:
+	JRL L3637
+L3639:
+	DJNZ B, L3635
+L3640:
+	JP OV, L2491
+L3641:
+	DJNZ B, L3642
+L3642:
+	CALL L3644
+L3643:
+	JP MI, L3204
+L3644:
+	DJNZ B, L3646
+L3645:
+	JR LE, L3649
+L3646:
+	DJNZ B, L3642
+L3647:
+	JR LE, L3649
+L3648:
+	JRL L3646
+L3649:
+	CALL L3652
+L3650:
+	JP LE, L3650
+L3651:
+	JR Z, L3651
+L3652:
+	DJNZ B, L3654
+L3653:
+	JP NZ, L3653
+L3654:
+	CALL L3652
+L3655:
+	JP C, L3657
+L3656:
+	CALL L4950
+L3657:
+	JRL L2938
+L3658:
+	DJNZ B, L3659
+L3659:
+	JRL L3663
+L3660:
+	JP NZ, L3661
+L3661:
+	JP Z, L3658
+L3662:
+	JRL L3663
+L3663:
+	DJNZ B, L3662
+L3664:
+	JRL L3662
+L3665:
+	JP MI, L3668
+L3666:
+	JRL L3665
+L3667:
+	JR NZ, L3663
+L3668:
+	CALL L121
+L3669:
+	JR T, L3670
+L3670:
+	DJNZ B, L3671
+L3671:
+	CALL L1585
+L3672:
+	DJNZ B, L3671
+L3673:
+	DJNZ B, L3673
+L3674:
+	JRL L3674
+L3675:
+	DJNZ B, L3674
+L3676:
+	DJNZ B, L3679
+L3677:
+	JRL L3676
+L3678:
+	JRL L3682
+L3679:
+	CALL L3675
+L3680:
+	JP NZ, L3684
+L3681:
+	CALL L3678
+L3682:
+	CALL L3685
+L3683:
+	JP LE, L3683
+L3684:
+	JP C, L3683
+L3685:
+	CALL L3689
+L3686:
+	CALL L976
+L3687:
+	DJNZ B, L3685
+L3688:
+	DJNZ B, L3685
+L3689:
+	CALL L3692
+L3690:
+	CALL L3686
+L3691:
+	DJNZ B, L3688
+L3692:
+	JRL L3692
+L3693:
+	JRL L3691
+L3694:
+	JRL L3694
+L3695:
+	JR PL, L3698
+L3696:
+	JR MI, L3697
+L3697:
+	JRL L3696
+L3698:
+	CALL L3695
+L3699:
+	JP GT, L3700
+L3700:
+	JRL L3698
+L3701:
+	DJNZ B, L3697
+L3702:
+	JR PL, L3703
+L3703:
+	JP OV, L3704
+L3704:
+	CALL L3705
+L3705:
+	DJNZ B, L3701
+L3706:
+	JR PL, L3707
+L3707:
+	JP PL, L3710
+L3708:
+	JR Z, L3709
+L3709:
+	CALL L3710
+L3710:
+	JRL L3708
+L3711:
+	JP MI, L3707
+L3712:
+	JRL L638
+L3713:
+	CALL L3709
+L3714:
+	JRL L4495
+L3715:
+	JP NZ, L3715
+L3716:
+	JP MI, L3976
+L3717:
+	JP NZ, L3714
+L3718:
+	JRL L3722
+L3719:
+	JR MI, L3716
+L3720:
+	JR GT, L3721
+L3721:
+	JP T, L3719
+L3722:
+	JP MI, L3723
+L3723:
+	JP NC, L3722
+L3724:
+	JR NZ, L3723
+L3725:
+	JR T, L3726
+L3726:
+	JP NZ, L3722
+L3727:
+	JRL L2677
+L3728:
+	CALL L3730
+L3729:
+	DJNZ B, L3728
+L3730:
+	JRL L3730
+L3731:
+	JRL L3733
+L3732:
+	JRL L4556
+L3733:
+	CALL L3732
+L3734:
+	JP MI, L3730
+L3735:
+	JR LE, L3733
+L3736:
+	JRL L2122
+L3737:
+	JP PL, L3733
+L3738:
+	JP PL, L3734
+L3739:
+	JR PL, L3738
+L3740:
+	DJNZ B, L3736
+L3741:
+	JRL L3740
+L3742:
+	JRL L3738
+L3743:
+	DJNZ B, L3739
+L3744:
+	JRL L4222
+L3745:
+	JRL L3749
+L3746:
+	JRL L3743
+L3747:
+	CALL L3750
+L3748:
+	JP Z, L3521
+L3749:
+	DJNZ B, L3752
+L3750:
+	JR NC, L3747
+L3751:
+	CALL L3750
+L3752:
+	JP LE, L2631
+L3753:
+	CALL L1394
+L3754:
+	JP GT, L3750
+L3755:
+	JR Z, L3759
+L3756:
+	JR C, L3759
+L3757:
+	JRL L3757
+L3758:
+	JP OV, L3754
+L3759:
+	CALL L3755
+L3760:
+	JR C, L3757
+L3761:
+	JR NZ, L3759
+L3762:
+	CALL L3763
+L3763:
+	JR T, L3767
+L3764:
+	JRL L3761
+L3765:
+	CALL L3764
+L3766:
+	JR C, L3770
+L3767:
+	JRL L2187
+L3768:
+	DJNZ B, L3771
+L3769:
+	JP OV, L3773
+L3770:
+	DJNZ B, L3767
+L3771:
+	JR GT, L3772
+L3772:
+	JP OV, L3773
+L3773:
+	JR PL, L3770
+L3774:
+	JR NC, L3776
+L3775:
+	JP PL, L3779
+L3776:
+	DJNZ B, L3774
+L3777:
+	CALL L3774
+L3778:
+	JRL L3780
+L3779:
+	CALL L2858
+L3780:
+	CALL L3780
+L3781:
+	JR PL, L3785
+L3782:
+	JR GT, L3784
+L3783:
+	JR GT, L3782
+L3784:
+	JR MI, L3785
+L3785:
+	DJNZ B, L3784
+L3786:
+	JR Z, L3786
+L3787:
+	CALL L3736
+L3788:
+	DJNZ B, L3790
+L3789:
+	JR C, L3789
+L3790:
+	CALL L3794
+L3791:
+	JRL L3793
+L3792:
+	JRL L3788
+L3793:
+	DJNZ B, L3791
+L3794:
+	JP PL, L3793
+L3795:
+	DJNZ B, L3791
+L3796:
+	JP OV, L3795
+L3797:
+	DJNZ B, L3796
+L3798:
+	CALL L454
+L3799:
+	CALL L3796
+L3800:
+	JR OV, L3798
+L3801:
+	DJNZ B, L3802
+L3802:
+	JP NC, L3806
+L3803:
+	JR T, L3803
+L3804:
+	JP LE, L3806
+L3805:
+	CALL L2397
+L3806:
+	CALL L3807
+L3807:
+	CALL L3810
+L3808:
+	JP LE, L3810
+L3809:
+	JR LE, L3810
+L3810:
+	JR PL, L3810
+L3811:
+	JR OV, L3811
+L3812:
+	CALL L2017
+L3813:
+	JRL L3809
+L3814:
+	JP Z, L3812
+L3815:
+	DJNZ B, L3819
+L3816:
+	CALL L3816
+L3817:
+	JRL L3818
+L3818:
+	JP PL, L3814
+L3819:
+	JRL L3823
+L3820:
+	JP GT, L2826
+L3821:
+	JR MI, L3825
+L3822:
+	JP C, L3818
+L3823:
+	DJNZ B, L3823
+L3824:
+	JR NC, L3828
+L3825:
+	CALL L3827
+L3826:
+	JRL L3830
+L3827:
+	CALL L3823
+L3828:
+	CALL L3824
+L3829:
+	JRL L3830
+L3830:
+	JRL L3029
+L3831:
+	JRL L3833
+L3832:
+	JRL L2635
+L3833:
+	CALL L3595
+L3834:
+	JRL L3837
+L3835:
+	DJNZ B, L3839
+L3836:
+	JR NC, L3832
+L3837:
+	CALL L3836
+L3838:
+	CALL L3838
+L3839:
+	JRL L3836
+L3840:
+	JRL L3842
+L3841:
+	DJNZ B, L3844
+L3842:
+	CALL L3840
+L3843:
+	CALL L3844
+L3844:
+	JR NC, L3848
+L3845:
+	DJNZ B, L3847
+L3846:
+	JP PL, L1614
+L3847:
+	JRL L3845
+L3848:
+	DJNZ B, L3846
+L3849:
+	JRL L3853
+L3850:
+	JRL L3851
+L3851:
+	DJNZ B, L3855
+L3852:
+	DJNZ B, L3855
+L3853:
+	JRL L3852
+L3854:
+	CALL L3852
+L3855:
+	JP LE, L3853
+L3856:
+	JRL L3858
+L3857:
+	JP OV, L2397
+L3858:
+	JR T, L3858
+L3859:
+	DJNZ B, L3862
+L3860:
+	CALL L3864
+L3861:
+	CALL L3862
+L3862:
+	DJNZ B, L3860
+L3863:
+	CALL L3860
+L3864:
+	JRL L3868
+L3865:
+	DJNZ B, L3867
+L3866:
+	CALL L3864
+L3867:
+	JP OV, L3868
+L3868:
+	JP T, L3252
+L3869:
+	CALL L3872
+L3870:
+	JP C, L3436
+L3871:
+	JR NZ, L3875
+L3872:
+	JR T, L3874
+L3873:
+	DJNZ B, L3874
+L3874:
+	JRL L3870
+L3875:
+	DJNZ B, L3872
+L3876:
+	JR Z, L3877
+L3877:
+	CALL L3880
+L3878:
+	CALL L3882
+L3879:
+	JR LE, L3879
+L3880:
+	JR NZ, L3882
+L3881:
+	DJNZ B, L3877
+L3882:
+	JR Z, L3880
+L3883:
+	CALL L3880
+L3884:
+	CALL L3888
+L3885:
+	CALL L759
+L3886:
+	JRL L3587
+L3887:
+	CALL L3889
+L3888:
+	CALL L3891
+L3889:
+	JRL L1382
+L3890:
+	DJNZ B, L3890
+L3891:
+	JRL L2496
+L3892:
+	JR LE, L3890
+L3893:
+	JR NZ, L3897
+L3894:
+	DJNZ B, L3891
+L3895:
+	DJNZ B, L3893
+L3896:
+	CALL L3897
+L3897:
+	DJNZ B, L3899
+L3898:
+	DJNZ B, L3901
+L3899:
+	JR NC, L3900
+L3900:
+	JRL L3899
+L3901:
+	DJNZ B, L3898
+L3902:
+	JR T, L3898
+L3903:
+	JR PL, L3900
+L3904:
+	CALL L3907
+L3905:
+	DJNZ B, L3905
+L3906:
+	CALL L3903
+L3907:
+	CALL L3903
+L3908:
+	JR NC, L3908
+L3909:
+	CALL L3906
+L3910:
+	DJNZ B, L3913
+L3911:
+	JR Z, L3915
+L3912:
+	DJNZ B, L3913
+L3913:
+	DJNZ B, L3916
+L3914:
+	JP Z, L3915
+L3915:
+	CALL L2525
+L3916:
+	CALL L3913
+L3917:
+	DJNZ B, L3914
+L3918:
+	JR Z, L3922
+L3919:
+	JP LE, L3916
+L3920:
+	JR T, L3923
+L3921:
+	DJNZ B, L3923
+L3922:
+	JR OV, L3923
+L3923:
+	JP MI, L3927
+L3924:
+	DJNZ B, L3925
+L3925:
+	JP C, L3929
+L3926:
+	JRL L3927
+L3927:
+	JP NC, L1730
+L3928:
+	DJNZ B, L3926
+L3929:
+	CALL L3927
+L3930:
+	JRL L3926
+L3931:
+	JRL L3927
+L3932:
+	JRL L3928
+L3933:
+	CALL L3935
+L3934:
+	DJNZ B, L3932
+L3935:
+	JP NZ, L3933
+L3936:
+	DJNZ B, L3935
+L3937:
+	CALL L3938
+L3938:
+	CALL L3937
+L3939:
+	JRL L3936
+L3940:
+	DJNZ B, L3943
+L3941:
+	JP LE, L3942
+L3942:
+	JRL L3945
+L3943:
+	JRL L3943
+L3944:
+	CALL L553
+L3945:
+	DJNZ B, L3949
+L3946:
+	CALL L3946
+L3947:
+	JR LE, L3944
+L3948:
+	JRL L3944
+L3949:
+	JP PL, L4575
+L3950:
+	JR OV, L3951
+L3951:
+	DJNZ B, L3949
+L3952:
+	CALL L3951
+L3953:
+	JR MI, L3954
+L3954:
+	DJNZ B, L3957
+L3955:
+	JP LE, L3956
+L3956:
+	CALL L3958
+L3957:
+	DJNZ B, L3959
+L3958:
+	DJNZ B, L3958
+L3959:
+	JR NC, L3962
+L3960:
+	JP NZ, L3958
+L3961:
+	JRL L3964
+L3962:
+	DJNZ B, L3961
+L3963:
+	CALL L3967
+L3964:
+	JR T, L3961
+L3965:
+	DJNZ B, L3964
+L3966:
+	CALL L3965
+L3967:
+	CALL L3969
+L3968:
+	JR OV, L3966
+L3969:
+	DJNZ B, L3973
+L3970:
+	DJNZ B, L3970
+L3971:
+	CALL L1860
+L3972:
+	JR LE, L3971
+L3973:
+	JR MI, L3971
+L3974:
+	DJNZ B, L3974
+L3975:
+	DJNZ B, L3973
+L3976:
+	JRL L818
+L3977:
+	JR T, L3975
+L3978:
+	JP Z, L3976
+L3979:
+	JR PL, L3976
+L3980:
+	JP MI, L3979
+L3981:
+	JRL L3984
+L3982:
+	JRL L3984
+L3983:
+	JRL L3983
+L3984:
+	JRL L3984
+L3985:
+	DJNZ B, L3981
+L3986:
+	DJNZ B, L3982
+L3987:
+	DJNZ B, L3988
+L3988:
+	JP NC, L3987
+L3989:
+	CALL L73
+L3990:
+	JR LE, L3992
+L3991:
+	JP T, L3993
+L3992:
+	JP NC, L3992
+L3993:
+	JR Z, L3993
+L3994:
+	JRL L3996
+L3995:
+	DJNZ B, L3995
+L3996:
+	JP GT, L3995
+L3997:
+	JR Z, L3998
+L3998:
+	DJNZ B, L3997
+L3999:
+	JRL L3998
+L4000:
+	JR LE, L3996
+L4001:
+	JRL L3998
+L4002:
+	JRL L3998
+L4003:
+	JR T, L4004
+L4004:
+	JP T, L4000
+L4005:
+	JRL L4004
+L4006:
+	CALL L3324
+L4007:
+	DJNZ B, L4005
+L4008:
+	JRL L1098
+L4009:
+	DJNZ B, L4007
+L4010:
+	JRL L1167
+L4011:
+	JR NZ, L4013
+L4012:
+	JRL L3924
+L4013:
+	DJNZ B, L4013
+L4014:
+	JR MI, L4011
+L4015:
+	JRL L3488
+L4016:
+	DJNZ B, L4015
+L4017:
+	JRL L4018
+L4018:
+	DJNZ B, L4014
+L4019:
+	JP PL, L4021
+L4020:
+	CALL L4016
+L4021:
+	CALL L3601
+L4022:
+	CALL L4024
+L4023:
+	JR NZ, L4022
+L4024:
+	JRL L4925
+L4025:
+	DJNZ B, L4024
+L4026:
+	JP MI, L4609
+L4027:
+	DJNZ B, L4028
+L4028:
+	JR PL, L4030
+L4029:
+	CALL L243
+L4030:
+	CALL L4027
+L4031:
+	CALL L4027
+L4032:
+	CALL L4035
+L4033:
+	DJNZ B, L4035
+L4034:
+	JRL L988
+L4035:
+	DJNZ B, L4039
+L4036:
+	JRL L4036
+L4037:
+	DJNZ B, L4038
+L4038:
+	JR GT, L4039
+L4039:
+	JR NC, L4041
+L4040:
+	DJNZ B, L4042
+L4041:
+	JR T, L4044
+L4042:
+	JR NC, L4043
+L4043:
+	CALL L4046
+L4044:
+	JR Z, L4041
+L4045:
+	DJNZ B, L4047
+L4046:
+	CALL L4045
+L4047:
+	DJNZ B, L4050
+L4048:
+	DJNZ B, L4050
+L4049:
+	CALL L4048
+L4050:
+	JRL L4053
+L4051:
+	CALL L796
+L4052:
+	JRL L4051
+L4053:
+	CALL L4057
+L4054:
+	CALL L4057
+L4055:
+	DJNZ B, L4055
+L4056:
+	JP C, L4058
+L4057:
+	CALL L4056
+L4058:
+	JRL L4061
+L4059:
+	DJNZ B, L4061
+L4060:
+	CALL L739
+L4061:
+	JRL L4057
+L4062:
+	JRL L4064
+L4063:
+	JP NZ, L2795
+L4064:
+	JRL L4066
+L4065:
+	JR C, L4063
+L4066:
+	JR C, L4070
+L4067:
+	JP C, L4070
+L4068:
+	CALL L4065
+L4069:
+	DJNZ B, L4068
+L4070:
+	JR MI, L4068
+L4071:
+	CALL L4075
+L4072:
+	JRL L1643
+L4073:
+	JRL L4068
+L4074:
+	CALL L4073
+L4075:
+	CALL L4075
+L4076:
+	JR LE, L4077
+L4077:
+	DJNZ B, L4078
+L4078:
+	JRL L4078
+L4079:
+	DJNZ B, L4077
+L4080:
+	JP NC, L4076
+L4081:
+	JR NZ, L4082
+L4082:
+	JP PL, L4086
+L4083:
+	JRL L4080
+L4084:
+	CALL L4085
+L4085:
+	JRL L4085
+L4086:
+	DJNZ B, L4087
+L4087:
+	JRL L4088
+L4088:
+	JR LE, L4086
+L4089:
+	CALL L4092
+L4090:
+	JRL L4086
+L4091:
+	JR NZ, L4095
+L4092:
+	JP PL, L4094
+L4093:
+	JP LE, L4093
+L4094:
+	CALL L4097
+L4095:
+	JR PL, L4099
+L4096:
+	JRL L4094
+L4097:
+	JP NC, L4098
+L4098:
+	DJNZ B, L4094
+L4099:
+	JP GT, L4100
+L4100:
+	JP Z, L4096
+L4101:
+	JR T, L4100
+L4102:
+	DJNZ B, L4102
+L4103:
+	DJNZ B, L4102
+L4104:
+	JR T, L4108
+L4105:
+	JR OV, L4105
+L4106:
+	JR MI, L4103
+L4107:
+	JRL L127
+L4108:
+	DJNZ B, L4104
+L4109:
+	JR OV, L4109
+L4110:
+	CALL L2808
+L4111:
+	DJNZ B, L4107
+L4112:
+	JP C, L461
+L4113:
+	JRL L4116
+L4114:
+	CALL L4111
+L4115:
+	JP PL, L4118
+L4116:
+	DJNZ B, L4112
+L4117:
+	CALL L4117
+L4118:
+	JRL L4117
+L4119:
+	DJNZ B, L4123
+L4120:
+	JP Z, L2421
+L4121:
+	DJNZ B, L4119
+L4122:
+	DJNZ B, L4124
+L4123:
+	JRL L3558
+L4124:
+	CALL L4122
+L4125:
+	CALL L4124
+L4126:
+	JRL L4127
+L4127:
+	JRL L4131
+L4128:
+	JR NC, L4128
+L4129:
+	DJNZ B, L4128
+L4130:
+	JP NC, L1188
+L4131:
+	JP T, L4132
+L4132:
+	CALL L4128
+L4133:
+	JRL L4132
+L4134:
+	JP PL, L4137
+L4135:
+	JP PL, L4138
+L4136:
+	DJNZ B, L4138
+L4137:
+	JR T, L4140
+L4138:
+	CALL L4136
+L4139:
+	CALL L4143
+L4140:
+	CALL L3448
+L4141:
+	JRL L1177
+L4142:
+	CALL L4140
+L4143:
+	JP GT, L4145
+L4144:
+	JP LE, L4145
+L4145:
+	DJNZ B, L4143
+L4146:
+	CALL L1878
+L4147:
+	JRL L2419
+L4148:
+	CALL L4144
+L4149:
+	JR OV, L4149
+L4150:
+	JR LE, L4150
+L4151:
+	CALL L4148
+L4152:
+	JRL L1227
+L4153:
+	JR NZ, L4149
+L4154:
+	JR NC, L4154
+L4155:
+	DJNZ B, L4158
+L4156:
+	CALL L386
+L4157:
+	JP Z, L4158
+L4158:
+	JP Z, L4161
+L4159:
+	DJNZ B, L4163
+L4160:
+	CALL L4163
+L4161:
+	JRL L4163
+L4162:
+	CALL L4160
+L4163:
+	JP GT, L4163
+L4164:
+	JP OV, L4160
+L4165:
+	DJNZ B, L4166
+L4166:
+	JP OV, L4162
+L4167:
+	JR Z, L4167
+L4168:
+	CALL L4166
+L4169:
+	JP OV, L94
+L4170:
+	DJNZ B, L4174
+L4171:
+	DJNZ B, L4172
+L4172:
+	CALL L2845
+L4173:
+	JRL L4174
+L4174:
+	DJNZ B, L4178
+L4175:
+	DJNZ B, L4178
+L4176:
+	JP NC, L4178
+L4177:
+	JRL L4464
+L4178:
+	JP Z, L4182
+L4179:
+	DJNZ B, L4182
+L4180:
+	DJNZ B, L4177
+L4181:
+	DJNZ B, L4184
+L4182:
+	CALL L4184
+L4183:
+	DJNZ B, L4183
+L4184:
+	JRL L634
+L4185:
+	JRL L4186
+L4186:
+	DJNZ B, L4189
+L4187:
+	CALL L4184
+L4188:
+	CALL L3263
+L4189:
+	JRL L4186
+L4190:
+	JP GT, L4193
+L4191:
+	JP LE, L4187
+L4192:
+	JRL L2793
+L4193:
+	JRL L4192
+L4194:
+	JR PL, L4198
+L4195:
+	CALL L4198
+L4196:
+	CALL L195
+L4197:
+	JRL L4195
+L4198:
+	JR NC, L4196
+L4199:
+	JR PL, L4201
+L4200:
+	JRL L2240
+L4201:
+	JR C, L4203
+L4202:
+	JP T, L2289
+L4203:
+	JR GT, L4201
+L4204:
+	JP Z, L4206
+L4205:
+	JR PL, L4203
+L4206:
+	JRL L4209
+L4207:
+	JRL L4205
+L4208:
+	JR LE, L4212
+L4209:
+	DJNZ B, L4209
+L4210:
+	JR C, L4212
+L4211:
+	JP NZ, L1201
+L4212:
+	JRL L4208
+L4213:
+	JP PL, L2584
+L4214:
+	CALL L4218
+L4215:
+	CALL L4218
+L4216:
+	DJNZ B, L4218
+L4217:
+	DJNZ B, L4213
+L4218:
+	JRL L4214
+L4219:
+	CALL L4216
+L4220:
+	JRL L4218
+L4221:
+	CALL L4221
+L4222:
+	JP MI, L4220
+L4223:
+	CALL L4227
+L4224:
+	JR C, L4221
+L4225:
+	JP NC, L2499
+L4226:
+	JRL L4228
+L4227:
+	CALL L4224
+L4228:
+	JRL L4231
+L4229:
+	JRL L4226
+L4230:
+	CALL L4234
+L4231:
+	CALL L4232
+L4232:
+	CALL L4234
+L4233:
+	DJNZ B, L4234
+L4234:
+	CALL L4237
+L4235:
+	DJNZ B, L4231
+L4236:
+	JP MI, L4237
+L4237:
+	DJNZ B, L4240
+L4238:
+	JP MI, L4242
+L4239:
+	DJNZ B, L4241
+L4240:
+	JP LE, L4241
+L4241:
+	DJNZ B, L4244
+L4242:
+	JR MI, L4241
+L4243:
+	JR PL, L4239
+L4244:
+	DJNZ B, L4245
+L4245:
+	DJNZ B, L4244
+L4246:
+	JRL L4246
+L4247:
+	JP LE, L4243
+L4248:
+	JP Z, L1954
+L4249:
+	JRL L4252
+L4250:
+	CALL L1407
+L4251:
+	JP NZ, L4250
+L4252:
+	CALL L2207
+L4253:
+	JR C, L4249
+L4254:
+	DJNZ B, L4256
+L4255:
+	CALL L4259
+L4256:
+	CALL L1126
+L4257:
+	DJNZ B, L4255
+L4258:
+	DJNZ B, L4258
+L4259:
+	JRL L4255
+L4260:
+	JR T, L4263
+L4261:
+	JRL L4258
+L4262:
+	JR GT, L4266
+L4263:
+	JRL L4265
+L4264:
+	DJNZ B, L4266
+L4265:
+	JR PL, L4261
+L4266:
+	JP PL, L4263
+L4267:
+	JR OV, L4264
+L4268:
+	JP C, L4267
+L4269:
+	DJNZ B, L4267
+L4270:
+	DJNZ B, L4274
+L4271:
+	JRL L4267
+L4272:
+	JRL L4274
+L4273:
+	JP T, L1870
+L4274:
+	CALL L4278
+L4275:
+	JRL L4278
+L4276:
+	JR NZ, L4275
+L4277:
+	JRL L4279
+L4278:
+	JR Z, L4277
+L4279:
+	DJNZ B, L4278
+L4280:
+	CALL L4283
+L4281:
+	CALL L4281
+L4282:
+	JRL L4280
+L4283:
+	CALL L2972
+L4284:
+	DJNZ B, L4286
+L4285:
+	JR PL, L4286
+L4286:
+	CALL L4284
+L4287:
+	CALL L4290
+L4288:
+	DJNZ B, L4288
+L4289:
+	CALL L4292
+L4290:
+	CALL L4289
+L4291:
+	JP NZ, L4291
+L4292:
+	JR NZ, L4292
+L4293:
+	JR C, L4295
+L4294:
+	JP MI, L4295
+L4295:
+	JP Z, L4298
+L4296:
+	JP C, L2901
+L4297:
+	CALL L4299
+L4298:
+	CALL L4246
+L4299:
+	JP NC, L4298
+L4300:
+	CALL L4300
+L4301:
+	DJNZ B, L4301
+L4302:
+	JRL L4299
+L4303:
+	JRL L4299
+L4304:
+	CALL L4304
+L4305:
+	DJNZ B, L4306
+L4306:
+	JP MI, L4303
+L4307:
+	CALL L4696
+L4308:
+	CALL L3349
+L4309:
+	DJNZ B, L4309
+L4310:
+	CALL L1899
+L4311:
+	DJNZ B, L4312
+L4312:
+	CALL L4315
+L4313:
+	JR NC, L4317
+L4314:
+	DJNZ B, L4310
+L4315:
+	JR PL, L4318
+L4316:
+	DJNZ B, L4315
+L4317:
+	CALL L4318
+L4318:
+	JR OV, L4315
+L4319:
+	DJNZ B, L4319
+L4320:
+	DJNZ B, L4320
+L4321:
+	JP Z, L4321
+L4322:
+	CALL L4326
+L4323:
+	JRL L4327
+L4324:
+	DJNZ B, L4323
+L4325:
+	JR GT, L4324
+L4326:
+	JRL L2909
+L4327:
+	DJNZ B, L4326
+L4328:
+	DJNZ B, L4332
+L4329:
+	JR OV, L4331
+L4330:
+	DJNZ B, L4331
+L4331:
+	DJNZ B, L4334
+L4332:
+	DJNZ B, L4332
+L4333:
+	JP MI, L4332
+L4334:
+	DJNZ B, L4336
+L4335:
+	DJNZ B, L4332
+L4336:
+	JRL L2424
+L4337:
+	DJNZ B, L4336
+L4338:
+	CALL L3586
+L4339:
+	CALL L4343
+L4340:
+	CALL L4343
+L4341:
+	JP Z, L4340
+L4342:
+	JRL L4338
+L4343:
+	CALL L4339
+L4344:
+	JR PL, L4345
+L4345:
+	JR T, L4342
+L4346:
+	JR C, L4346
+L4347:
+	JRL L4348
+L4348:
+	DJNZ B, L4349
+L4349:
+	DJNZ B, L4345
+L4350:
+	DJNZ B, L4353
+L4351:
+	JRL L2533
+L4352:
+	JP LE, L1329
+L4353:
+	JP GT, L4357
+L4354:
+	CALL L4350
+L4355:
+	CALL L2287
+L4356:
+	JRL L4357
+L4357:
+	JP MI, L4850
+L4358:
+	CALL L4358
+L4359:
+	CALL L1359
+L4360:
+	JP OV, L4357
+L4361:
+	CALL L4358
+L4362:
+	DJNZ B, L4361
+L4363:
+	JP Z, L2914
+L4364:
+	DJNZ B, L4362
+L4365:
+	JRL L4364
+L4366:
+	JRL L4364
+L4367:
+	JR MI, L4369
+L4368:
+	JRL L4365
+L4369:
+	JP MI, L4977
+L4370:
+	JR GT, L4373
+L4371:
+	JR LE, L4372
+L4372:
+	CALL L4375
+L4373:
+	JR PL, L4375
+L4374:
+	JR T, L4373
+L4375:
+	JP T, L1274
+L4376:
+	DJNZ B, L4372
+L4377:
+	JR LE, L4381
+L4378:
+	JRL L4375
+L4379:
+	JP Z, L4381
+L4380:
+	CALL L4376
+L4381:
+	JP GT, L4379
+L4382:
+	JR NC, L4380
+L4383:
+	JRL L4382
+L4384:
+	JP NZ, L4371
+L4385:
+	JP NZ, L4382
+L4386:
+	JRL L4385
+L4387:
+	JP LE, L279
+L4388:
+	JRL L4390
+L4389:
+	JP NC, L2798
+L4390:
+	JRL L4389
+L4391:
+	DJNZ B, L4393
+L4392:
+	JR T, L4394
+L4393:
+	DJNZ B, L4397
+L4394:
+	JRL L718
+L4395:
+	JP Z, L1857
+L4396:
+	DJNZ B, L4393
+L4397:
+	CALL L4396
+L4398:
+	CALL L4400
+L4399:
+	JR LE, L4402
+L4400:
+	JR NC, L4398
+L4401:
+	JP T, L4400
+L4402:
+	DJNZ B, L4402
+L4403:
+	JP NC, L4399
+L4404:
+	JR MI, L4407
+L4405:
+	JR T, L4407
+L4406:
+	JP PL, L287
+L4407:
+	CALL L4411
+L4408:
+	CALL L4405
+L4409:
+	JP NZ, L4411
+L4410:
+	JRL L4409
+L4411:
+	JRL L4408
+L4412:
+	JRL L4414
+L4413:
+	JRL L4039
+L4414:
+	CALL L1476
+L4415:
+	JR GT, L4419
+L4416:
+	JP MI, L4415
+L4417:
+	JP T, L1080
+L4418:
+	JRL L4417
+L4419:
+	DJNZ B, L4419
+L4420:
+	CALL L4419
+L4421:
+	CALL L4422
+L4422:
+	JR T, L4421
+L4423:
+	DJNZ B, L4424
+L4424:
+	JP OV, L2340
+L4425:
+	CALL L4429
+L4426:
+	JR NC, L4428
+L4427:
+	JR LE, L4428
+L4428:
+	DJNZ B, L4429
+L4429:
+	JRL L4426
+L4430:
+	JRL L4430
+L4431:
+	JRL L4429
+L4432:
+	CALL L4429
+L4433:
+	JP LE, L4651
+L4434:
+	JP NZ, L4437
+L4435:
+	JRL L4436
+L4436:
+	JRL L3755
+L4437:
+	JP NZ, L4440
+L4438:
+	JRL L421
+L4439:
+	JR T, L4440
+L4440:
+	CALL L4441
+L4441:
+	CALL L4441
+L4442:
+	CALL L4439
+L4443:
+	DJNZ B, L4447
+L4444:
+	CALL L4441
+L4445:
+	JRL L3903
+L4446:
+	JR OV, L4448
+L4447:
+	JRL L2528
+L4448:
+	JP OV, L4447
+L4449:
+	JRL L223
+L4450:
+	JR LE, L4453
+L4451:
+	JP PL, L4451
+L4452:
+	JP GT, L4451
+L4453:
+	CALL L2280
+L4454:
+	DJNZ B, L4456
+L4455:
+	JRL L2176
+L4456:
+	DJNZ B, L4458
+L4457:
+	CALL L4454
+L4458:
+	JR NZ, L4455
+L4459:
+	JP NC, L4123
+L4460:
+	JRL L1408
+L4461:
+	DJNZ B, L4463
+L4462:
+	DJNZ B, L4466
+L4463:
+	CALL L4463
+L4464:
+	JP MI, L4460
+L4465:
+	JP OV, L4464
+L4466:
+	JRL L4465
+L4467:
+	CALL L4466
+L4468:
+	JR PL, L4466
+L4469:
+	CALL L165
+L4470:
+	CALL L4470
+L4471:
+	JR GT, L4471
+L4472:
+	JR NZ, L4472
+L4473:
+	JP Z, L4473
+L4474:
+	JP GT, L4476
+L4475:
+	JP OV, L4476
+L4476:
+	CALL L4101
+L4477:
+	JP MI, L4474
+L4478:
+	JRL L4480
+L4479:
+	DJNZ B, L4481
+L4480:
+	JRL L4478
+L4481:
+	CALL L4477
+L4482:
+	CALL L4479
+L4483:
+	CALL L1068
+L4484:
+	DJNZ B, L4486
+L4485:
+	JRL L2479
+L4486:
+	CALL L4484
+L4487:
+	CALL L1272
+L4488:
+	JP MI, L4488
+L4489:
+	CALL L4493
+L4490:
+	JR OV, L4488
+L4491:
+	DJNZ B, L4494
+L4492:
+	JP LE, L3187
+L4493:
+	CALL L4493
+L4494:
+	JP C, L4490
+L4495:
+	JR LE, L4496
+L4496:
+	CALL L3277
+L4497:
+	JR Z, L4501
+L4498:
+	JR C, L4495
+L4499:
+	DJNZ B, L4496
+L4500:
+	JRL L4496
+L4501:
+	DJNZ B, L4504
+L4502:
+	DJNZ B, L4503
+L4503:
+	JRL L2837
+L4504:
+	CALL L4500
+L4505:
+	DJNZ B, L4504
+L4506:
+	JP GT, L4508
+L4507:
+	JR MI, L4507
+L4508:
+	CALL L4507
+L4509:
+	DJNZ B, L4510
+L4510:
+	JP PL, L4510
+L4511:
+	JP NC, L4511
+L4512:
+	CALL L4513
+L4513:
+	JRL L4512
+L4514:
+	JR T, L4515
+L4515:
+	JRL L4511
+L4516:
+	DJNZ B, L4518
+L4517:
+	JP T, L4518
+L4518:
+	JR NC, L4519
+L4519:
+	DJNZ B, L4516
+L4520:
+	JRL L4524
+L4521:
+	CALL L4519
+L4522:
+	JR C, L4523
+L4523:
+	CALL L3296
+L4524:
+	JR NC, L4524
+L4525:
+	JRL L4529
+L4526:
+	DJNZ B, L4525
+L4527:
+	JR GT, L4526
+L4528:
+	JRL L4525
+L4529:
+	CALL L1917
+L4530:
+	DJNZ B, L4526
+L4531:
+	JRL L4533
+L4532:
+	DJNZ B, L4533
+L4533:
+	CALL L4537
+L4534:
+	JR NZ, L4535
+L4535:
+	JR T, L4536
+L4536:
+	JR Z, L4538
+L4537:
+	JR OV, L4535
+L4538:
+	CALL L4539
+L4539:
+	JR LE, L4542
+L4540:
+	JR NC, L4538
+L4541:
+	JRL L4541
+L4542:
+	JRL L754
+L4543:
+	DJNZ B, L4543
+L4544:
+	JP MI, L137
+L4545:
+	JP C, L4542
+L4546:
+	JP C, L4548
+L4547:
+	JP OV, L4546
+L4548:
+	JR NC, L4544
+L4549:
+	JRL L4203
+L4550:
+	JP LE, L4552
+L4551:
+	DJNZ B, L4554
+L4552:
+	JR MI, L4556
+L4553:
+	DJNZ B, L4551
+L4554:
+	CALL L4551
+L4555:
+	JP Z, L4554
+L4556:
+	DJNZ B, L4555
+L4557:
+	CALL L4553
+L4558:
+	CALL L4555
+L4559:
+	JR T, L4561
+L4560:
+	JRL L4563
+L4561:
+	DJNZ B, L4563
+L4562:
+	JR PL, L4564
+L4563:
+	JRL L4562
+L4564:
+	CALL L4566
+L4565:
+	JRL L4569
+L4566:
+	DJNZ B, L4566
+L4567:
+	JRL L4565
+L4568:
+	JRL L4570
+L4569:
+	DJNZ B, L4565
+L4570:
+	CALL L4572
+L4571:
+	DJNZ B, L4575
+L4572:
+	JRL L4576
+L4573:
+	CALL L254
+L4574:
+	JP PL, L3749
+L4575:
+	JP Z, L4577
+L4576:
+	JP T, L263
+L4577:
+	CALL L4574
+L4578:
+	JR OV, L4582
+L4579:
+	JR C, L4575
+L4580:
+	JR LE, L4581
+L4581:
+	JP C, L14
+L4582:
+	JP T, L3258
+L4583:
+	DJNZ B, L4585
+L4584:
+	JR MI, L4584
+L4585:
+	JRL L4585
+L4586:
+	JR LE, L4582
+L4587:
+	JRL L4584
+L4588:
+	JR OV, L4586
+L4589:
+	JP GT, L2360
+L4590:
+	JP MI, L4591
+L4591:
+	JRL L4590
+L4592:
+	JRL L4591
+L4593:
+	JRL L4597
+L4594:
+	JR LE, L4596
+L4595:
+	JP NZ, L4593
+L4596:
+	DJNZ B, L4597
+L4597:
+	JRL L4599
+L4598:
+	JP T, L4600
+L4599:
+	JRL L4595
+L4600:
+	JR T, L4597
+L4601:
+	JR NC, L4599
+L4602:
+	JR LE, L4601
+L4603:
+	JR C, L4607
+L4604:
+	JRL L2610
+L4605:
+	JR OV, L4605
+L4606:
+	DJNZ B, L4610
+L4607:
+	JP OV, L4604
+L4608:
+	DJNZ B, L4608
+L4609:
+	CALL L4613
+L4610:
+	JR C, L4607
+L4611:
+	JRL L4614
+L4612:
+	DJNZ B, L4609
+L4613:
+	JRL L4611
+L4614:
+	JRL L3566
+L4615:
+	CALL L1486
+L4616:
+	JRL L4615
+L4617:
+	JRL L4615
+L4618:
+	CALL L4615
+L4619:
+	JR C, L4621
+L4620:
+	CALL L4620
+L4621:
+	JRL L4621
+L4622:
+	JR NC, L4621
+L4623:
+	CALL L4622
+L4624:
+	CALL L2547
+L4625:
+	CALL L4626
+L4626:
+	JR C, L4625
+L4627:
+	JP OV, L4629
+L4628:
+	JP LE, L4628
+L4629:
+	JR LE, L4632
+L4630:
+	CALL L4633
+L4631:
+	DJNZ B, L4632
+L4632:
+	DJNZ B, L4635
+L4633:
+	JR OV, L4637
+L4634:
+	JRL L4634
+L4635:
+	JP OV, L498
+L4636:
+	JRL L1326
+L4637:
+	CALL L2060
+L4638:
+	JP NC, L4641
+L4639:
+	JR NZ, L4642
+L4640:
+	CALL L4638
+L4641:
+	CALL L4897
+L4642:
+	JRL L4640
+L4643:
+	CALL L4639
+L4644:
+	JRL L4644
+L4645:
+	CALL L4645
+L4646:
+	JP LE, L4645
+L4647:
+	CALL L4649
+L4648:
+	JR GT, L4651
+L4649:
+	CALL L4649
+L4650:
+	CALL L4648
+L4651:
+	CALL L4648
+L4652:
+	JP LE, L4649
+L4653:
+	JP T, L4657
+L4654:
+	DJNZ B, L4651
+L4655:
+	JP T, L4651
+L4656:
+	DJNZ B, L4652
+L4657:
+	DJNZ B, L4658
+L4658:
+	DJNZ B, L4654
+L4659:
+	JP PL, L4662
+L4660:
+	JRL L4656
+L4661:
+	JR T, L4662
+L4662:
+	CALL L4660
+L4663:
+	JR OV, L4660
+L4664:
+	JP T, L4663
+L4665:
+	JRL L4669
+L4666:
+	CALL L4663
+L4667:
+	DJNZ B, L4667
+L4668:
+	JR GT, L4669
+L4669:
+	CALL L4673
+L4670:
+	JP PL, L4669
+L4671:
+	JP NZ, L4675
+L4672:
+	JP C, L56
+L4673:
+	JR PL, L4669
+L4674:
+	JRL L4678
+L4675:
+	DJNZ B, L4676
+L4676:
+	JR Z, L4679
+L4677:
+	JP NC, L4678
+L4678:
+	CALL L4682
+L4679:
+	JRL L4681
+L4680:
+	DJNZ B, L4684
+L4681:
+	JRL L4682
+L4682:
+	CALL L4686
+L4683:
+	JRL L4685
+L4684:
+	JP PL, L4683
+L4685:
+	CALL L2231
+L4686:
+	JRL L4686
+L4687:
+	CALL L4691
+L4688:
+	JRL L4765
+L4689:
+	JP OV, L4690
+L4690:
+	CALL L796
+L4691:
+	JRL L3908
+L4692:
+	JRL L4688
+L4693:
+	JP NC, L4697
+L4694:
+	JR PL, L4691
+L4695:
+	DJNZ B, L4696
+L4696:
+	DJNZ B, L4700
+L4697:
+	JR T, L4698
+L4698:
+	CALL L4700
+L4699:
+	CALL L4702
+L4700:
+	JP MI, L798
+L4701:
+	JR MI, L4702
+L4702:
+	JP MI, L4705
+L4703:
+	JP T, L4705
+L4704:
+	DJNZ B, L4706
+L4705:
+	JRL L2115
+L4706:
+	DJNZ B, L4705
+L4707:
+	JP PL, L3717
+L4708:
+	JR MI, L4712
+L4709:
+	DJNZ B, L4707
+L4710:
+	JP C, L4509
+L4711:
+	CALL L4712
+L4712:
+	JP T, L4712
+L4713:
+	JRL L4712
+L4714:
+	DJNZ B, L4718
+L4715:
+	CALL L4719
+L4716:
+	JP OV, L4715
+L4717:
+	CALL L4717
+L4718:
+	CALL L4719
+L4719:
+	JR LE, L4723
+L4720:
+	CALL L4692
+L4721:
+	JP PL, L4722
+L4722:
+	JRL L4720
+L4723:
+	JRL L4725
+L4724:
+	JRL L2753
+L4725:
+	CALL L4729
+L4726:
+	CALL L1775
+L4727:
+	JRL L4731
+L4728:
+	JRL L4728
+L4729:
+	JR NC, L4725
+L4730:
+	CALL L4875
+L4731:
+	CALL L4727
+L4732:
+	CALL L4733
+L4733:
+	CALL L4731
+L4734:
+	JP T, L4738
+L4735:
+	JR Z, L4736
+L4736:
+	JP Z, L4739
+L4737:
+	CALL L4735
+L4738:
+	JRL L4735
+L4739:
+	JRL L2542
+L4740:
+	CALL L4741
+L4741:
+	JRL L4740
+L4742:
+	CALL L3901
+L4743:
+	JP OV, L4899
+L4744:
+	JRL L4686
+L4745:
+	JRL L4743
+L4746:
+	JR T, L4743
+L4747:
+	JRL L4747
+L4748:
+	JR T, L4747
+L4749:
+	JP Z, L4752
+L4750:
+	DJNZ B, L4754
+L4751:
+	JRL L4752
+L4752:
+	DJNZ B, L4756
+L4753:
+	JR MI, L4752
+L4754:
+	DJNZ B, L4758
+L4755:
+	JR LE, L4755
+L4756:
+	CALL L4755
+L4757:
+	CALL L4755
+L4758:
+	JP T, L968
+L4759:
+	DJNZ B, L4761
+L4760:
+	CALL L3359
+L4761:
+	CALL L4765
+L4762:
+	JP NZ, L4763
+L4763:
+	DJNZ B, L4760
+L4764:
+	CALL L4762
+L4765:
+	JRL L4766
+L4766:
+	JRL L4769
+L4767:
+	JRL L1928
+L4768:
+	JP MI, L4765
+L4769:
+	CALL L4769
+L4770:
+	JRL L4769
+L4771:
+	JP NZ, L4768
+L4772:
+	JP PL, L4770
+L4773:
+	CALL L4769
+L4774:
+	JR LE, L4771
+L4775:
+	DJNZ B, L4775
+L4776:
+	DJNZ B, L4774
+L4777:
+	JP PL, L4779
+L4778:
+	JP T, L367
+L4779:
+	JR C, L4780
+L4780:
+	JRL L4778
+L4781:
+	JRL L4782
+L4782:
+	JP LE, L4083
+L4783:
+	JRL L4786
+L4784:
+	JR NZ, L4780
+L4785:
+	DJNZ B, L4785
+L4786:
+	JRL L4789
+L4787:
+	JP PL, L4788
+L4788:
+	JP PL, L4791
+L4789:
+	JRL L4792
+L4790:
+	DJNZ B, L4794
+L4791:
+	DJNZ B, L4788
+L4792:
+	JP NZ, L4788
+L4793:
+	DJNZ B, L4796
+L4794:
+	JRL L4796
+L4795:
+	CALL L4795
+L4796:
+	DJNZ B, L4800
+L4797:
+	JP LE, L2394
+L4798:
+	JP PL, L4794
+L4799:
+	JR LE, L4795
+L4800:
+	DJNZ B, L4798
+L4801:
+	JP LE, L4805
+L4802:
+	CALL L4802
+L4803:
+	DJNZ B, L4804
+L4804:
+	CALL L4804
+L4805:
+	JR Z, L4806
+L4806:
+	DJNZ B, L4809
+L4807:
+	DJNZ B, L4808
+L4808:
+	JRL L4806
+L4809:
+	JP PL, L4807
+L4810:
+	JP LE, L1019
+L4811:
+	JR NC, L4809
+L4812:
+	JR C, L4816
+L4813:
+	CALL L4817
+L4814:
+	JRL L4814
+L4815:
+	JP PL, L4812
+L4816:
+	DJNZ B, L4820
+L4817:
+	CALL L4818
+L4818:
+	CALL L4815
+L4819:
+	JR MI, L4820
+L4820:
+	DJNZ B, L4818
+L4821:
+	JP LE, L4817
+L4822:
+	JP MI, L4824
+L4823:
+	JRL L4819
+L4824:
+	CALL L2744
+L4825:
+	JR C, L4829
+L4826:
+	JR LE, L4826
+L4827:
+	CALL L4830
+L4828:
+	JR NC, L4826
+L4829:
+	JP GT, L4831
+L4830:
+	JP PL, L2154
+L4831:
+	JRL L4834
+L4832:
+	JR PL, L4833
+L4833:
+	JR C, L4829
+L4834:
+	DJNZ B, L4835
+L4835:
+	DJNZ B, L4836
+L4836:
+	JP PL, L4835
+L4837:
+	JR PL, L4839
+L4838:
+	JP OV, L4838
+L4839:
+	DJNZ B, L4842
+L4840:
+	DJNZ B, L4843
+L4841:
+	JR MI, L4845
+L4842:
+	DJNZ B, L4840
+L4843:
+	JRL L3093
+L4844:
+	JR T, L4841
+L4845:
+	JR PL, L4846
+L4846:
+	JR PL, L4847
+L4847:
+	DJNZ B, L4846
+L4848:
+	DJNZ B, L4850
+L4849:
+	JR OV, L4847
+L4850:
+	JP Z, L4854
+L4851:
+	DJNZ B, L4852
+L4852:
+	JR C, L4848
+L4853:
+	JP LE, L4853
+L4854:
+	CALL L916
+L4855:
+	JR C, L4853
+L4856:
+	JRL L3905
+L4857:
+	JP Z, L4859
+L4858:
+	CALL L4854
+L4859:
+	JP Z, L4857
+L4860:
+	JRL L4858
+L4861:
+	CALL L4860
+L4862:
+	CALL L4858
+L4863:
+	JR NZ, L4863
+L4864:
+	DJNZ B, L4868
+L4865:
+	DJNZ B, L4865
+L4866:
+	CALL L4870
+L4867:
+	JR Z, L4869
+L4868:
+	CALL L4871
+L4869:
+	JR GT, L4872
+L4870:
+	JRL L4871
+L4871:
+	JR OV, L4868
+L4872:
+	JR OV, L4874
+L4873:
+	CALL L3283
+L4874:
+	DJNZ B, L4875
+L4875:
+	CALL L4876
+L4876:
+	JRL L4876
+L4877:
+	JR T, L4876
+L4878:
+	DJNZ B, L4875
+L4879:
+	JP PL, L4879
+L4880:
+	JRL L4880
+L4881:
+	JRL L4880
+L4882:
+	JR MI, L4881
+L4883:
+	JP T, L4882
+L4884:
+	CALL L4888
+L4885:
+	JP LE, L4886
+L4886:
+	JR Z, L4888
+L4887:
+	JP C, L4886
+L4888:
+	JR C, L4884
+L4889:
+	JRL L4892
+L4890:
+	CALL L1202
+L4891:
+	DJNZ B, L4891
+L4892:
+	DJNZ B, L4896
+L4893:
+	CALL L4893
+L4894:
+	JR GT, L4892
+L4895:
+	DJNZ B, L4893
+L4896:
+	DJNZ B, L4899
+L4897:
+	CALL L4893
+L4898:
+	CALL L4902
+L4899:
+	DJNZ B, L4898
+L4900:
+	JRL L4902
+L4901:
+	JRL L4897
+L4902:
+	JP MI, L4898
+L4903:
+	CALL L4905
+L4904:
+	JP LE, L4907
+L4905:
+	DJNZ B, L4908
+L4906:
+	JP NC, L4906
+L4907:
+	JR PL, L4905
+L4908:
+	JRL L4912
+L4909:
+	JR PL, L4905
+L4910:
+	JR T, L4913
+L4911:
+	JP GT, L4779
+L4912:
+	JRL L4912
+L4913:
+	JR GT, L4916
+L4914:
+	JRL L4916
+L4915:
+	JP LE, L4918
+L4916:
+	JP OV, L4914
+L4917:
+	CALL L4915
+L4918:
+	CALL L4918
+L4919:
+	CALL L2452
+L4920:
+	DJNZ B, L4917
+L4921:
+	DJNZ B, L4924
+L4922:
+	JR GT, L4918
+L4923:
+	JP MI, L4927
+L4924:
+	JRL L4921
+L4925:
+	JP T, L4926
+L4926:
+	DJNZ B, L4928
+L4927:
+	JP GT, L4924
+L4928:
+	DJNZ B, L4928
+L4929:
+	JRL L4930
+L4930:
+	JP NZ, L4933
+L4931:
+	CALL L4135
+L4932:
+	JRL L4935
+L4933:
+	JP C, L4937
+L4934:
+	JP NZ, L4932
+L4935:
+	JP LE, L4935
+L4936:
+	JRL L4782
+L4937:
+	JRL L4934
+L4938:
+	CALL L4940
+L4939:
+	CALL L4071
+L4940:
+	JR C, L4939
+L4941:
+	JR Z, L4937
+L4942:
+	JP NC, L4943
+L4943:
+	JP NC, L4941
+L4944:
+	JRL L4948
+L4945:
+	CALL L4945
+L4946:
+	JR T, L4942
+L4947:
+	DJNZ B, L4944
+L4948:
+	CALL L4944
+L4949:
+	JRL L4946
+L4950:
+	DJNZ B, L4951
+L4951:
+	JP T, L4947
+L4952:
+	DJNZ B, L4953
+L4953:
+	DJNZ B, L4949
+L4954:
+	DJNZ B, L4951
+L4955:
+	JRL L4956
+L4956:
+	JP Z, L87
+L4957:
+	JRL L4961
+L4958:
+	DJNZ B, L4955
+L4959:
+	CALL L4962
+L4960:
+	JR T, L4964
+L4961:
+	JP C, L4963
+L4962:
+	JR OV, L4959
+L4963:
+	DJNZ B, L4964
+L4964:
+	JP PL, L4963
+L4965:
+	JP Z, L4962
+L4966:
+	JRL L4966
+L4967:
+	JP PL, L3965
+L4968:
+	DJNZ B, L4968
+L4969:
+	DJNZ B, L4972
+L4970:
+	JR T, L4971
+L4971:
+	JP C, L4967
+L4972:
+	JRL L4970
+L4973:
+	CALL L384
+L4974:
+	JRL L4975
+L4975:
+	JP NC, L4976
+L4976:
+	JR C, L4975
+L4977:
+	CALL L4976
+L4978:
+	JR C, L4982
+L4979:
+	DJNZ B, L4983
+L4980:
+	JP LE, L2512
+L4981:
+	JP PL, L4979
+L4982:
+	JRL L2204
+L4983:
+	JRL L4981
+L4984:
+	JRL L4621
+L4985:
+	JR OV, L4985
+L4986:
+	JP NC, L4537
+L4987:
+	JRL L4770
+L4988:
+	JR PL, L4992
+L4989:
+	JP T, L4986
+L4990:
+	JP OV, L4988
+L4991:
+	DJNZ B, L4993
+L4992:
+	JR OV, L4988
+L4993:
+	JRL L4995
+L4994:
+	JRL L2988
+L4995:
+	DJNZ B, L4994
+L4996:
+	JR PL, L4994
+L4997:
+	JRL L4996
+L4998:
+	DJNZ B, L4995
+L4999:
+	JP OV, L4999
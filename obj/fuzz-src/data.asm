@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	DW L4687, L2-L0
+L1:
+	DW L1, L0-L0
+L2:
+	DB 159, 151, "s2"
+L3:
+	DB 137, 69, "s3"
+L4:
+	DW L6, L4-L6
+L5:
+	DB 173, 138, "s5"
+L6:
+	DB 85, 90, "s6"
+L7:
+	DB 12, 56, "s7"
+L8:
+	DW L12, L6-L6
+L9:
+	DW L8, L9-L9
+L10:
+	DW L13, L10-L6
+L11:
+	DB 101, 192, "s1"
+L12:
+	DW L4345, L14-L14
+L13:
+	DB 201, 93, "s3"
+L14:
+	DB 211, 52, "s4"
+L15:
+	DB 37, 35, "s5"
+L16:
+	DW L19, L14-L18
+L17:
+	DW L3592, L13-L16
+L18:
+	DW L2803, L15-L15
+L19:
+	DW L1374, L20-L22
+L20:
+	DB 232, 253, "s0"
+L21:
+	DW L25, L24-L20
+L22:
+	DB 50, 56, "s2"
+L23:
+	DB 133, 73, "s3"
+L24:
+	DW L25, L22-L23
+L25:
+	DW L28, L23-L26
+L26:
+	DW L30, L25-L26
+L27:
+	DB 68, 243, "s7"
+L28:
+	DB 252, 244, "s8"
+L29:
+	DB 101, 155, "s9"
+L30:
+	DW L1751, L31-L28
+L31:
+	DB 28, 75, "s1"
+L32:
+	DW L29, L33-L31
+L33:
+	DB 177, 163, "s3"
+L34:
+	DB 19, 182, "s4"
+L35:
+	DW L1300, L34-L36
+L36:
+	DW L1360, L32-L37
+L37:
+	DB 61, 131, "s7"
+L38:
+	DB 164, 146, "s8"
+L39:
+	DB 200, 7, "s9"
+L40:
+	DW L42, L42-L38
+L41:
+	DW L39, L41-L42
+L42:
+	DW L38, L42-L40
+L43:
+	DB 6, 59, "s3"
+L44:
+	DW L3160, L40-L46
+L45:
+	DW L46, L41-L42
+L46:
+	DW L47, L43-L44
+L47:
+	DW L48, L48-L45
+L48:
+	DW L51, L44-L46
+L49:
+	DW L53, L48-L47
+L50:
+	DW L54, L51-L54
+L51:
+	DW L50, L52-L49
+L52:
+	DW L56, L54-L48
+L53:
+	DB 226, 170, "s3"
+L54:
+	DW L58, L53-L52
+L55:
+	DW L57, L55-L53
+L56:
+	DB 50, 255, "s6"
+L57:
+	DB 60, 162, "s7"
+L58:
+	DB 95, 24, "s8"
+L59:
+	DW L56, L56-L61
+L60:
+	DW L63, L63-L57
+L61:
+	DW L58, L65-L65
+L62:
+	DB 57, 203, "s2"
+L63:
+	DW L66, L66-L65
+L64:
+	DW L2705, L68-L66
+L65:
+	DW L69, L62-L68
+L66:
+	DW L66, L66-L67
+L67:
+	DW L70, L68-L71
+L68:
+	DW L71, L70-L66
+L69:
+	DW L68, L71-L67
+L70:
+	DW L69, L71-L66
+L71:
+	DW L185, L75-L68
+L72:
+	DW L74, L73-L73
+L73:
+	DB 134, 32, "s3"
+L74:
+	DW L74, L77-L78
+L75:
+	DW L73, L73-L79
+L76:
+	DW L75, L75-L80
+L77:
+	DW L74, L76-L81
+L78:
+	DB 227, 203, "s8"
+L79:
+	DW L79, L80-L82
+L80:
+	DW L84, L78-L77
+L81:
+	DW L79, L78-L80
+L82:
+	DW L82, L83-L78
+L83:
+	DB 20, 108, "s3"
+L84:
+	DW L82, L81-L80
+L85:
+	DW L82, L84-L86
+L86:
+	DW L82, L85-L87
+L87:
+	DB 59, 247, "s7"
+L88:
+	DW L90, L89-L87
+L89:
+	DB 190, 190, "s9"
+L90:
+	DW L4999, L86-L87
+L91:
+	DB 175, 69, "s1"
+L92:
+	DW L90, L96-L93
+L93:
+	DB 30, 53, "s3"
+L94:
+	DW L97, L97-L93
+L95:
+	DB 191, 104, "s5"
+L96:
+	DW L99, L93-L92
+L97:
+	DB 252, 218, "s7"
+L98:
+	DB 18, 158, "s8"
+L99:
+	DW L98, L98-L96
+L100:
+	DB 15, 197, "s0"
+L101:
+	DW L99, L101-L102
+L102:
+	DB 77, 237, "s2"
+L103:
+	DW L100, L105-L107
+L104:
+	DB 200, 133, "s4"
+L105:
+	DW L4613, L109-L106
+L106:
+	DB 34, 167, "s6"
+L107:
+	DW L111, L111-L105
+L108:
+	DW L105, L111-L107
+L109:
+	DW L2727, L110-L110
+L110:
+	DB 9, 86, "s0"
+L111:
+	DW L110, L110-L113
+L112:
+	DB 92, 138, "s2"
+L113:
+	DB 97, 178, "s3"
+L114:
+	DB 103, 75, "s4"
+L115:
+	DW L3082, L117-L118
+L116:
+	DW L120, L114-L115
+L117:
+	DB 136, 130, "s7"
+L118:
+	DB 9, 165, "s8"
+L119:
+	DW L115, L118-L119
+L120:
+	DB 191, 9, "s0"
+L121:
+	DW L118, L119-L125
+L122:
+	DB 166, 249, "s2"
+L123:
+	DW L122, L122-L122
+L124:
+	DB 133, 16, "s4"
+L125:
+	DB 47, 143, "s5"
+L126:
+	DB 62, 60, "s6"
+L127:
+	DW L129, L131-L126
+L128:
+	DB 133, 4, "s8"
+L129:
+	DW L125, L127-L131
+L130:
+	DW L127, L128-L134
+L131:
+	DB 77, 103, "s1"
+L132:
+	DW L130, L132-L134
+L133:
+	DB 74, 113, "s3"
+L134:
+	DB 166, 150, "s4"
+L135:
+	DW L907, L137-L136
+L136:
+	DB 109, 156, "s6"
+L137:
+	DB 186, 22, "s7"
+L138:
+	DW L139, L140-L139
+L139:
+	DW L143, L135-L139
+L140:
+	DW L137, L141-L144
+L141:
+	DW L144, L145-L141
+L142:
+	DB 18, 9, "s2"
+L143:
+	DW L142, L145-L141
+L144:
+	DW L2152, L146-L142
+L145:
+	DB 8, 203, "s5"
+L146:
+	DW L142, L145-L144
+L147:
+	DB 9, 182, "s7"
+L148:
+	DW L4267, L152-L148
+L149:
+	DW L145, L151-L145
+L150:
+	DB 53, 55, "s0"
+L151:
+	DW L4419, L147-L155
+L152:
+	DB 16, 22, "s2"
+L153:
+	DW L149, L155-L156
+L154:
+	DB 17, 66, "s4"
+L155:
+	DW L152, L156-L156
+L156:
+	DB 94, 55, "s6"
+L157:
+	DW L158, L154-L161
+L158:
+	DB 35, 167, "s8"
+L159:
+	DB 224, 239, "s9"
+L160:
+	DB 177, 40, "s0"
+L161:
+	DB 185, 75, "s1"
+L162:
+	DW L158, L159-L166
+L163:
+	DW L163, L159-L165
+L164:
+	DW L166, L162-L160
+L165:
+	DB 0, 52, "s5"
+L166:
+	DB 133, 140, "s6"
+L167:
+	DB 209, 152, "s7"
+L168:
+	DW L170, L170-L170
+L169:
+	DW L4978, L167-L166
+L170:
+	DB 197, 137, "s0"
+L171:
+	DB 216, 104, "s1"
+L172:
+	DB 240, 118, "s2"
+L173:
+	DB 246, 212, "s3"
+L174:
+	DW L3668, L172-L171
+L175:
+	DW L48, L176-L176
+L176:
+	DB 140, 182, "s6"
+L177:
+	DW L179, L181-L174
+L178:
+	DB 96, 53, "s8"
+L179:
+	DW L180, L177-L183
+L180:
+	DB 161, 213, "s0"
+L181:
+	DW L182, L181-L180
+L182:
+	DW L186, L183-L179
+L183:
+	DB 118, 183, "s3"
+L184:
+	DB 128, 34, "s4"
+L185:
+	DW L182, L181-L186
+L186:
+	DB 121, 173, "s6"
+L187:
+	DW L189, L190-L185
+L188:
+	DW L186, L190-L188
+L189:
+	DW L1420, L185-L186
+L190:
+	DB 15, 171, "s0"
+L191:
+	DB 165, 194, "s1"
+L192:
+	DW L193, L190-L191
+L193:
+	DW L193, L192-L193
+L194:
+	DW L191, L190-L190
+L195:
+	DW L198, L197-L196
+L196:
+	DW L197, L193-L194
+L197:
+	DW L199, L195-L198
+L198:
+	DB 69, 17, "s8"
+L199:
+	DW L196, L201-L201
+L200:
+	DB 246, 241, "s0"
+L201:
+	DB 34, 85, "s1"
+L202:
+	DB 111, 3, "s2"
+L203:
+	DB 183, 208, "s3"
+L204:
+	DW L201, L203-L200
+L205:
+	DW L4980, L202-L202
+L206:
+	DB 69, 207, "s6"
+L207:
+	DW L3408, L204-L203
+L208:
+	DW L206, L209-L207
+L209:
+	DB 86, 81, "s9"
+L210:
+	DB 68, 104, "s0"
+L211:
+	DB 13, 63, "s1"
+L212:
+	DW L208, L209-L209
+L213:
+	DW L212, L212-L211
+L214:
+	DB 101, 92, "s4"
+L215:
+	DB 95, 203, "s5"
+L216:
+	DB 115, 160, "s6"
+L217:
+	DW L221, L213-L219
+L218:
+	DB 72, 174, "s8"
+L219:
+	DW L219, L222-L218
+L220:
+	DB 132, 64, "s0"
+L221:
+	DB 30, 136, "s1"
+L222:
+	DW L226, L218-L219
+L223:
+	DB 221, 215, "s3"
+L224:
+	DB 19, 101, "s4"
+L225:
+	DB 136, 194, "s5"
+L226:
+	DW L226, L224-L226
+L227:
+	DW L230, L226-L226
+L228:
+	DW L232, L226-L228
+L229:
+	DW L233, L228-L230
+L230:
+	DW L231, L232-L231
+L231:
+	DW L1145, L229-L228
+L232:
+	DW L228, L236-L233
+L233:
+	DW L234, L233-L236
+L234:
+	DB 250, 159, "s4"
+L235:
+	DB 194, 170, "s5"
+L236:
+	DW L236, L232-L239
+L237:
+	DW L1655, L233-L236
+L238:
+	DW L240, L236-L238
+L239:
+	DW L3593, L239-L241
+L240:
+	DW L2868, L240-L241
+L241:
+	DB 11, 47, "s1"
+L242:
+	DW L2877, L239-L246
+L243:
+	DB 170, 92, "s3"
+L244:
+	DB 172, 76, "s4"
+L245:
+	DB 42, 94, "s5"
+L246:
+	DW L937, L242-L242
+L247:
+	DW L250, L244-L243
+L248:
+	DW L247, L250-L250
+L249:
+	DW L251, L251-L245
+L250:
+	DB 41, 133, "s0"
+L251:
+	DB 68, 196, "s1"
+L252:
+	DB 174, 245, "s2"
+L253:
+	DW L250, L252-L249
+L254:
+	DW L256, L250-L257
+L255:
+	DB 182, 177, "s5"
+L256:
+	DB 70, 101, "s6"
+L257:
+	DW L2068, L254-L260
+L258:
+	DW L261, L255-L254
+L259:
+	DB 86, 122, "s9"
+L260:
+	DB 27, 158, "s0"
+L261:
+	DW L262, L263-L262
+L262:
+	DW L1189, L265-L266
+L263:
+	DW L845, L262-L264
+L264:
+	DB 107, 29, "s4"
+L265:
+	DB 244, 74, "s5"
+L266:
+	DW L267, L265-L269
+L267:
+	DW L3357, L267-L264
+L268:
+	DW L265, L265-L271
+L269:
+	DW L273, L267-L273
+L270:
+	DB 75, 138, "s0"
+L271:
+	DB 111, 98, "s1"
+L272:
+	DW L271, L270-L272
+L273:
+	DW L269, L276-L271
+L274:
+	DW L270, L270-L270
+L275:
+	DW L279, L277-L278
+L276:
+	DW L563, L272-L275
+L277:
+	DB 236, 235, "s7"
+L278:
+	DW L282, L279-L279
+L279:
+	DW L277, L275-L283
+L280:
+	DB 230, 196, "s0"
+L281:
+	DW L279, L280-L277
+L282:
+	DW L225, L279-L280
+L283:
+	DB 157, 68, "s3"
+L284:
+	DW L963, L284-L287
+L285:
+	DW L281, L285-L288
+L286:
+	DW L288, L288-L288
+L287:
+	DW L284, L283-L289
+L288:
+	DW L284, L292-L292
+L289:
+	DW L2801, L290-L291
+L290:
+	DW L293, L288-L288
+L291:
+	DB 49, 94, "s1"
+L292:
+	DB 122, 59, "s2"
+L293:
+	DB 188, 132, "s3"
+L294:
+	DB 187, 254, "s4"
+L295:
+	DW L292, L297-L296
+L296:
+	DW L299, L298-L296
+L297:
+	DB 108, 132, "s7"
+L298:
+	DW L297, L298-L294
+L299:
+	DW L302, L297-L295
+L300:
+	DB 57, 112, "s0"
+L301:
+	DW L2741, L297-L305
+L302:
+	DW L300, L301-L298
+L303:
+	DW L300, L306-L300
+L304:
+	DB 126, 126, "s4"
+L305:
+	DB 80, 52, "s5"
+L306:
+	DB 195, 150, "s6"
+L307:
+	DB 83, 27, "s7"
+L308:
+	DB 206, 29, "s8"
+L309:
+	DB 16, 90, "s9"
+L310:
+	DW L313, L311-L307
+L311:
+	DB 86, 104, "s1"
+L312:
+	DW L312, L313-L308
+L313:
+	DW L317, L311-L317
+L314:
+	DW L4662, L315-L310
+L315:
+	DW L4777, L319-L311
+L316:
+	DB 162, 230, "s6"
+L317:
+	DW L1864, L319-L319
+L318:
+	DW L316, L315-L314
+L319:
+	DB 216, 225, "s9"
+L320:
+	DB 56, 153, "s0"
+L321:
+	DB 141, 73, "s1"
+L322:
+	DB 2, 222, "s2"
+L323:
+	DB 249, 25, "s3"
+L324:
+	DW L325, L322-L321
+L325:
+	DB 122, 97, "s5"
+L326:
+	DW L328, L325-L323
+L327:
+	DW L3792, L327-L329
+L328:
+	DB 121, 189, "s8"
+L329:
+	DW L325, L328-L328
+L330:
+	DW L331, L334-L334
+L331:
+	DB 205, 244, "s1"
+L332:
+	DW L333, L331-L329
+L333:
+	DW L337, L336-L336
+L334:
+	DW L334, L335-L334
+L335:
+	DB 159, 28, "s5"
+L336:
+	DW L340, L332-L332
+L337:
+	DB 180, 230, "s7"
+L338:
+	DW L339, L341-L335
+L339:
+	DW L336, L337-L342
+L340:
+	DB 130, 97, "s0"
+L341:
+	DW L338, L337-L339
+L342:
+	DW L342, L338-L343
+L343:
+	DB 49, 81, "s3"
+L344:
+	DW L1025, L344-L344
+L345:
+	DB 92, 114, "s5"
+L346:
+	DW L343, L344-L343
+L347:
+	DW L1955, L345-L348
+L348:
+	DB 6, 138, "s8"
+L349:
+	DB 29, 236, "s9"
+L350:
+	DW L346, L354-L352
+L351:
+	DB 196, 229, "s1"
+L352:
+	DB 185, 133, "s2"
+L353:
+	DB 82, 102, "s3"
+L354:
+	DW L358, L352-L358
+L355:
+	DB 203, 230, "s5"
+L356:
+	DW L359, L360-L355
+L357:
+	DW L3968, L360-L357
+L358:
+	DB 8, 251, "s8"
+L359:
+	DB 153, 227, "s9"
+L360:
+	DB 239, 166, "s0"
+L361:
+	DW L365, L361-L357
+L362:
+	DB 188, 170, "s2"
+L363:
+	DB 37, 142, "s3"
+L364:
+	DW L363, L362-L364
+L365:
+	DW L2259, L363-L361
+L366:
+	DB 196, 210, "s6"
+L367:
+	DW L367, L364-L370
+L368:
+	DB 47, 147, "s8"
+L369:
+	DW L369, L365-L368
+L370:
+	DW L367, L373-L367
+L371:
+	DB 69, 98, "s1"
+L372:
+	DB 2, 95, "s2"
+L373:
+	DW L374, L372-L375
+L374:
+	DW L2728, L374-L373
+L375:
+	DB 161, 95, "s5"
+L376:
+	DB 225, 254, "s6"
+L377:
+	DW L378, L378-L376
+L378:
+	DW L375, L382-L380
+L379:
+	DW L2507, L383-L375
+L380:
+	DW L2193, L383-L379
+L381:
+	DW L2961, L379-L380
+L382:
+	DB 131, 106, "s2"
+L383:
+	DW L1795, L382-L382
+L384:
+	DW L385, L380-L380
+L385:
+	DW L982, L388-L383
+L386:
+	DW L388, L388-L387
+L387:
+	DB 4, 93, "s7"
+L388:
+	DB 62, 242, "s8"
+L389:
+	DB 179, 229, "s9"
+L390:
+	DW L390, L390-L386
+L391:
+	DB 74, 28, "s1"
+L392:
+	DW L4798, L394-L391
+L393:
+	DW L393, L391-L394
+L394:
+	DB 197, 232, "s4"
+L395:
+	DB 34, 182, "s5"
+L396:
+	DW L400, L393-L394
+L397:
+	DW L399, L399-L393
+L398:
+	DW L397, L399-L397
+L399:
+	DB 229, 71, "s9"
+L400:
+	DW L400, L396-L398
+L401:
+	DB 170, 18, "s1"
+L402:
+	DW L405, L400-L399
+L403:
+	DW L401, L407-L399
+L404:
+	DB 97, 155, "s4"
+L405:
+	DB 175, 57, "s5"
+L406:
+	DB 221, 253, "s6"
+L407:
+	DB 188, 101, "s7"
+L408:
+	DB 14, 169, "s8"
+L409:
+	DW L412, L405-L410
+L410:
+	DB 184, 178, "s0"
+L411:
+	DB 86, 71, "s1"
+L412:
+	DB 81, 1, "s2"
+L413:
+	DW L413, L409-L409
+L414:
+	DB 243, 225, "s4"
+L415:
+	DB 77, 218, "s5"
+L416:
+	DB 166, 16, "s6"
+L417:
+	DB 34, 246, "s7"
+L418:
+	DB 98, 57, "s8"
+L419:
+	DW L423, L416-L420
+L420:
+	DW L4964, L420-L416
+L421:
+	DB 244, 173, "s1"
+L422:
+	DW L420, L420-L423
+L423:
+	DB 96, 172, "s3"
+L424:
+	DB 15, 197, "s4"
+L425:
+	DB 216, 167, "s5"
+L426:
+	DW L1756, L429-L427
+L427:
+	DB 43, 196, "s7"
+L428:
+	DB 155, 69, "s8"
+L429:
+	DW L432, L430-L432
+L430:
+	DB 159, 93, "s0"
+L431:
+	DW L427, L430-L428
+L432:
+	DW L430, L430-L428
+L433:
+	DW L435, L436-L429
+L434:
+	DB 25, 88, "s4"
+L435:
+	DW L435, L437-L439
+L436:
+	DB 115, 27, "s6"
+L437:
+	DB 111, 14, "s7"
+L438:
+	DW L435, L436-L440
+L439:
+	DW L443, L437-L441
+L440:
+	DB 141, 241, "s0"
+L441:
+	DB 81, 103, "s1"
+L442:
+	DW L438, L439-L441
+L443:
+	DB 155, 190, "s3"
+L444:
+	DW L447, L442-L441
+L445:
+	DB 218, 48, "s5"
+L446:
+	DW L444, L444-L449
+L447:
+	DW L1087, L443-L450
+L448:
+	DB 19, 155, "s8"
+L449:
+	DB 186, 81, "s9"
+L450:
+	DB 176, 98, "s0"
+L451:
+	DB 188, 103, "s1"
+L452:
+	DB 155, 84, "s2"
+L453:
+	DB 251, 241, "s3"
+L454:
+	DW L450, L454-L456
+L455:
+	DW L1926, L451-L459
+L456:
+	DW L459, L459-L460
+L457:
+	DB 137, 2, "s7"
+L458:
+	DB 6, 7, "s8"
+L459:
+	DB 84, 212, "s9"
+L460:
+	DB 58, 45, "s0"
+L461:
+	DW L458, L462-L457
+L462:
+	DW L466, L461-L459
+L463:
+	DW L464, L465-L460
+L464:
+	DW L1890, L460-L462
+L465:
+	DW L466, L463-L461
+L466:
+	DW L464, L469-L466
+L467:
+	DB 46, 10, "s7"
+L468:
+	DW L467, L470-L472
+L469:
+	DW L469, L466-L471
+L470:
+	DW L473, L472-L469
+L471:
+	DW L471, L470-L471
+L472:
+	DB 14, 62, "s2"
+L473:
+	DB 84, 67, "s3"
+L474:
+	DB 87, 157, "s4"
+L475:
+	DW L472, L472-L477
+L476:
+	DW L473, L480-L475
+L477:
+	DW L478, L474-L480
+L478:
+	DB 240, 70, "s8"
+L479:
+	DW L480, L476-L478
+L480:
+	DB 121, 205, "s0"
+L481:
+	DW L478, L483-L484
+L482:
+	DW L484, L483-L482
+L483:
+	DB 136, 61, "s3"
+L484:
+	DB 135, 177, "s4"
+L485:
+	DB 243, 143, "s5"
+L486:
+	DW L486, L487-L486
+L487:
+	DW L886, L491-L486
+L488:
+	DW L1971, L486-L488
+L489:
+	DB 194, 116, "s9"
+L490:
+	DW L4604, L493-L492
+L491:
+	DW L492, L489-L494
+L492:
+	DW L490, L494-L495
+L493:
+	DB 152, 43, "s3"
+L494:
+	DB 126, 175, "s4"
+L495:
+	DW L491, L494-L496
+L496:
+	DB 44, 252, "s6"
+L497:
+	DB 4, 237, "s7"
+L498:
+	DW L3901, L498-L495
+L499:
+	DW L495, L501-L495
+L500:
+	DW L498, L501-L499
+L501:
+	DW L499, L504-L497
+L502:
+	DB 229, 150, "s2"
+L503:
+	DW L507, L507-L501
+L504:
+	DB 113, 42, "s4"
+L505:
+	DW L503, L503-L505
+L506:
+	DW L1734, L506-L504
+L507:
+	DB 251, 9, "s7"
+L508:
+	DW L509, L511-L505
+L509:
+	DB 72, 225, "s9"
+L510:
+	DW L512, L506-L507
+L511:
+	DB 166, 5, "s1"
+L512:
+	DB 99, 52, "s2"
+L513:
+	DW L512, L511-L513
+L514:
+	DB 131, 15, "s4"
+L515:
+	DW L514, L511-L512
+L516:
+	DB 84, 163, "s6"
+L517:
+	DB 92, 58, "s7"
+L518:
+	DB 255, 116, "s8"
+L519:
+	DB 85, 132, "s9"
+L520:
+	DW L516, L516-L519
+L521:
+	DB 20, 197, "s1"
+L522:
+	DB 97, 213, "s2"
+L523:
+	DW L523, L526-L522
+L524:
+	DB 121, 83, "s4"
+L525:
+	DW L1605, L526-L521
+L526:
+	DW L522, L524-L527
+L527:
+	DB 42, 129, "s7"
+L528:
+	DW L524, L532-L531
+L529:
+	DW L3323, L532-L526
+L530:
+	DW L2550, L534-L528
+L531:
+	DB 162, 184, "s1"
+L532:
+	DB 141, 170, "s2"
+L533:
+	DB 25, 33, "s3"
+L534:
+	DW L2761, L536-L534
+L535:
+	DB 133, 184, "s5"
+L536:
+	DW L3928, L534-L533
+L537:
+	DB 214, 166, "s7"
+L538:
+	DB 130, 39, "s8"
+L539:
+	DW L3928, L539-L538
+L540:
+	DB 194, 171, "s0"
+L541:
+	DB 98, 92, "s1"
+L542:
+	DB 246, 84, "s2"
+L543:
+	DB 183, 16, "s3"
+L544:
+	DW L542, L548-L548
+L545:
+	DW L543, L546-L541
+L546:
+	DB 113, 195, "s6"
+L547:
+	DW L1951, L545-L551
+L548:
+	DW L546, L550-L547
+L549:
+	DB 110, 146, "s9"
+L550:
+	DB 186, 134, "s0"
+L551:
+	DB 209, 100, "s1"
+L552:
+	DW L552, L548-L553
+L553:
+	DW L554, L556-L549
+L554:
+	DW L551, L550-L558
+L555:
+	DB 150, 134, "s5"
+L556:
+	DW L553, L554-L556
+L557:
+	DB 62, 159, "s7"
+L558:
+	DB 221, 91, "s8"
+L559:
+	DB 17, 162, "s9"
+L560:
+	DB 96, 169, "s0"
+L561:
+	DW L563, L557-L558
+L562:
+	DW L558, L565-L565
+L563:
+	DB 127, 171, "s3"
+L564:
+	DB 15, 89, "s4"
+L565:
+	DB 58, 218, "s5"
+L566:
+	DW L568, L567-L565
+L567:
+	DB 172, 226, "s7"
+L568:
+	DW L569, L571-L570
+L569:
+	DW L572, L570-L568
+L570:
+	DW L2785, L566-L570
+L571:
+	DW L3960, L568-L572
+L572:
+	DB 87, 0, "s2"
+L573:
+	DW L22, L571-L569
+L574:
+	DB 182, 220, "s4"
+L575:
+	DW L574, L578-L572
+L576:
+	DB 188, 167, "s6"
+L577:
+	DW L1329, L581-L573
+L578:
+	DW L582, L574-L581
+L579:
+	DW L4677, L576-L578
+L580:
+	DW L580, L576-L583
+L581:
+	DW L581, L580-L581
+L582:
+	DB 40, 154, "s2"
+L583:
+	DW L587, L580-L587
+L584:
+	DW L580, L583-L588
+L585:
+	DB 76, 4, "s5"
+L586:
+	DB 221, 188, "s6"
+L587:
+	DW L587, L589-L585
+L588:
+	DW L589, L590-L592
+L589:
+	DB 126, 68, "s9"
+L590:
+	DW L588, L587-L591
+L591:
+	DB 189, 207, "s1"
+L592:
+	DW L588, L590-L596
+L593:
+	DW L813, L592-L596
+L594:
+	DW L598, L590-L591
+L595:
+	DB 54, 35, "s5"
+L596:
+	DB 168, 103, "s6"
+L597:
+	DB 53, 128, "s7"
+L598:
+	DW L595, L596-L597
+L599:
+	DB 106, 32, "s9"
+L600:
+	DW L599, L604-L596
+L601:
+	DW L604, L601-L597
+L602:
+	DW L606, L603-L601
+L603:
+	DB 204, 63, "s3"
+L604:
+	DB 179, 113, "s4"
+L605:
+	DW L601, L601-L608
+L606:
+	DW L610, L604-L605
+L607:
+	DW L611, L609-L611
+L608:
+	DB 131, 212, "s8"
+L609:
+	DW L401, L607-L605
+L610:
+	DB 23, 59, "s0"
+L611:
+	DW L608, L607-L608
+L612:
+	DB 55, 193, "s2"
+L613:
+	DW L611, L615-L612
+L614:
+	DB 95, 193, "s4"
+L615:
+	DB 158, 123, "s5"
+L616:
+	DW L4438, L614-L619
+L617:
+	DW L620, L614-L621
+L618:
+	DB 234, 115, "s8"
+L619:
+	DW L620, L622-L616
+L620:
+	DW L617, L624-L622
+L621:
+	DW L622, L617-L624
+L622:
+	DB 164, 107, "s2"
+L623:
+	DW L621, L621-L622
+L624:
+	DW L625, L625-L628
+L625:
+	DB 248, 45, "s5"
+L626:
+	DB 138, 43, "s6"
+L627:
+	DB 110, 179, "s7"
+L628:
+	DB 192, 115, "s8"
+L629:
+	DB 84, 68, "s9"
+L630:
+	DB 64, 41, "s0"
+L631:
+	DB 254, 174, "s1"
+L632:
+	DW L633, L636-L636
+L633:
+	DW L634, L633-L633
+L634:
+	DB 188, 57, "s4"
+L635:
+	DB 164, 157, "s5"
+L636:
+	DW L636, L640-L635
+L637:
+	DB 54, 133, "s7"
+L638:
+	DB 57, 241, "s8"
+L639:
+	DB 159, 96, "s9"
+L640:
+	DW L638, L639-L642
+L641:
+	DW L642, L639-L637
+L642:
+	DB 180, 69, "s2"
+L643:
+	DW L641, L640-L643
+L644:
+	DB 1, 3, "s4"
+L645:
+	DW L646, L644-L647
+L646:
+	DW L649, L647-L645
+L647:
+	DB 37, 167, "s7"
+L648:
+	DB 240, 185, "s8"
+L649:
+	DB 187, 21, "s9"
+L650:
+	DB 71, 2, "s0"
+L651:
+	DB 64, 162, "s1"
+L652:
+	DB 106, 38, "s2"
+L653:
+	DB 50, 153, "s3"
+L654:
+	DW L652, L656-L652
+L655:
+	DW L654, L652-L656
+L656:
+	DW L1053, L657-L652
+L657:
+	DW L661, L661-L656
+L658:
+	DW L657, L655-L659
+L659:
+	DW L661, L657-L656
+L660:
+	DB 167, 48, "s0"
+L661:
+	DB 130, 251, "s1"
+L662:
+	DB 159, 95, "s2"
+L663:
+	DW L665, L664-L667
+L664:
+	DB 229, 22, "s4"
+L665:
+	DB 131, 180, "s5"
+L666:
+	DB 20, 81, "s6"
+L667:
+	DW L663, L670-L671
+L668:
+	DW L665, L670-L670
+L669:
+	DW L669, L667-L666
+L670:
+	DW L672, L671-L670
+L671:
+	DW L669, L673-L668
+L672:
+	DB 203, 103, "s2"
+L673:
+	DB 95, 218, "s3"
+L674:
+	DW L671, L677-L674
+L675:
+	DB 62, 163, "s5"
+L676:
+	DW L677, L673-L678
+L677:
+	DW L675, L674-L679
+L678:
+	DB 22, 50, "s8"
+L679:
+	DB 104, 100, "s9"
+L680:
+	DW L3925, L680-L682
+L681:
+	DB 204, 56, "s1"
+L682:
+	DB 179, 22, "s2"
+L683:
+	DB 155, 44, "s3"
+L684:
+	DW L682, L681-L684
+L685:
+	DW L689, L684-L681
+L686:
+	DW L682, L682-L688
+L687:
+	DW L688, L685-L690
+L688:
+	DW L689, L688-L691
+L689:
+	DW L690, L692-L686
+L690:
+	DB 119, 224, "s0"
+L691:
+	DW L689, L695-L690
+L692:
+	DW L690, L695-L692
+L693:
+	DW L336, L692-L697
+L694:
+	DW L697, L697-L695
+L695:
+	DW L693, L697-L693
+L696:
+	DW L694, L695-L695
+L697:
+	DB 35, 216, "s7"
+L698:
+	DB 55, 216, "s8"
+L699:
+	DB 186, 217, "s9"
+L700:
+	DW L703, L696-L696
+L701:
+	DB 138, 130, "s1"
+L702:
+	DB 15, 126, "s2"
+L703:
+	DB 0, 241, "s3"
+L704:
+	DW L4384, L704-L701
+L705:
+	DW L704, L702-L709
+L706:
+	DB 155, 42, "s6"
+L707:
+	DB 233, 235, "s7"
+L708:
+	DB 215, 247, "s8"
+L709:
+	DW L1011, L709-L712
+L710:
+	DB 202, 21, "s0"
+L711:
+	DW L710, L714-L711
+L712:
+	DB 112, 108, "s2"
+L713:
+	DB 118, 5, "s3"
+L714:
+	DB 205, 63, "s4"
+L715:
+	DB 140, 187, "s5"
+L716:
+	DW L715, L718-L713
+L717:
+	DW L101, L717-L720
+L718:
+	DW L722, L719-L715
+L719:
+	DB 98, 14, "s9"
+L720:
+	DW L719, L723-L720
+L721:
+	DW L1832, L722-L717
+L722:
+	DB 170, 74, "s2"
+L723:
+	DW L721, L719-L723
+L724:
+	DW L725, L724-L721
+L725:
+	DW L728, L723-L729
+L726:
+	DB 188, 176, "s6"
+L727:
+	DW L726, L731-L727
+L728:
+	DW L724, L727-L728
+L729:
+	DW L730, L726-L730
+L730:
+	DB 211, 163, "s0"
+L731:
+	DW L2355, L734-L733
+L732:
+	DB 83, 241, "s2"
+L733:
+	DW L734, L735-L735
+L734:
+	DB 204, 120, "s4"
+L735:
+	DB 24, 37, "s5"
+L736:
+	DW L734, L738-L735
+L737:
+	DB 7, 98, "s7"
+L738:
+	DW L735, L742-L742
+L739:
+	DB 154, 46, "s9"
+L740:
+	DB 159, 133, "s0"
+L741:
+	DB 230, 192, "s1"
+L742:
+	DW L2574, L741-L740
+L743:
+	DW L746, L746-L746
+L744:
+	DW L747, L748-L745
+L745:
+	DB 60, 189, "s5"
+L746:
+	DW L747, L744-L743
+L747:
+	DB 252, 194, "s7"
+L748:
+	DB 30, 57, "s8"
+L749:
+	DW L753, L748-L748
+L750:
+	DB 171, 69, "s0"
+L751:
+	DW L751, L753-L749
+L752:
+	DB 173, 239, "s2"
+L753:
+	DW L756, L754-L751
+L754:
+	DB 188, 132, "s4"
+L755:
+	DW L752, L759-L752
+L756:
+	DB 178, 220, "s6"
+L757:
+	DW L252, L759-L759
+L758:
+	DB 172, 188, "s8"
+L759:
+	DB 170, 178, "s9"
+L760:
+	DB 57, 121, "s0"
+L761:
+	DB 234, 89, "s1"
+L762:
+	DW L761, L765-L762
+L763:
+	DB 112, 190, "s3"
+L764:
+	DB 85, 148, "s4"
+L765:
+	DW L761, L768-L765
+L766:
+	DB 84, 198, "s6"
+L767:
+	DW L769, L769-L770
+L768:
+	DW L768, L772-L767
+L769:
+	DB 237, 56, "s9"
+L770:
+	DB 145, 51, "s0"
+L771:
+	DB 113, 125, "s1"
+L772:
+	DW L773, L775-L772
+L773:
+	DB 80, 101, "s3"
+L774:
+	DB 60, 104, "s4"
+L775:
+	DB 21, 57, "s5"
+L776:
+	DB 255, 254, "s6"
+L777:
+	DW L774, L779-L776
+L778:
+	DB 194, 241, "s8"
+L779:
+	DB 237, 231, "s9"
+L780:
+	DW L781, L778-L776
+L781:
+	DB 175, 81, "s1"
+L782:
+	DW L786, L784-L786
+L783:
+	DB 227, 130, "s3"
+L784:
+	DB 19, 97, "s4"
+L785:
+	DB 150, 51, "s5"
+L786:
+	DW L783, L786-L782
+L787:
+	DB 207, 249, "s7"
+L788:
+	DW L492, L787-L790
+L789:
+	DW L789, L786-L792
+L790:
+	DW L788, L790-L789
+L791:
+	DW L791, L788-L791
+L792:
+	DW L795, L790-L792
+L793:
+	DB 239, 44, "s3"
+L794:
+	DB 188, 43, "s4"
+L795:
+	DB 123, 239, "s5"
+L796:
+	DW L793, L798-L798
+L797:
+	DW L798, L799-L800
+L798:
+	DW L800, L799-L798
+L799:
+	DW L1344, L795-L802
+L800:
+	DB 13, 74, "s0"
+L801:
+	DB 5, 213, "s1"
+L802:
+	DB 144, 164, "s2"
+L803:
+	DW L799, L807-L807
+L804:
+	DB 69, 22, "s4"
+L805:
+	DB 111, 209, "s5"
+L806:
+	DB 108, 25, "s6"
+L807:
+	DB 26, 19, "s7"
+L808:
+	DW L808, L805-L808
+L809:
+	DB 12, 23, "s9"
+L810:
+	DB 139, 16, "s0"
+L811:
+	DB 110, 28, "s1"
+L812:
+	DB 84, 177, "s2"
+L813:
+	DB 226, 52, "s3"
+L814:
+	DW L810, L818-L815
+L815:
+	DB 30, 239, "s5"
+L816:
+	DW L815, L813-L820
+L817:
+	DB 101, 118, "s7"
+L818:
+	DW L819, L817-L818
+L819:
+	DW L819, L819-L818
+L820:
+	DW L818, L817-L822
+L821:
+	DW L819, L822-L821
+L822:
+	DB 46, 127, "s2"
+L823:
+	DB 115, 119, "s3"
+L824:
+	DB 227, 67, "s4"
+L825:
+	DB 203, 250, "s5"
+L826:
+	DB 229, 52, "s6"
+L827:
+	DW L826, L831-L824
+L828:
+	DB 120, 155, "s8"
+L829:
+	DW L831, L827-L831
+L830:
+	DB 240, 81, "s0"
+L831:
+	DW L3443, L834-L835
+L832:
+	DW L832, L834-L829
+L833:
+	DW L833, L831-L837
+L834:
+	DB 20, 99, "s4"
+L835:
+	DW L836, L833-L839
+L836:
+	DB 88, 82, "s6"
+L837:
+	DB 173, 197, "s7"
+L838:
+	DW L839, L834-L836
+L839:
+	DW L835, L835-L839
+L840:
+	DB 170, 21, "s0"
+L841:
+	DB 72, 22, "s1"
+L842:
+	DB 222, 154, "s2"
+L843:
+	DW L842, L839-L843
+L844:
+	DW L842, L843-L848
+L845:
+	DB 180, 124, "s5"
+L846:
+	DW L4637, L847-L846
+L847:
+	DB 55, 116, "s7"
+L848:
+	DB 4, 36, "s8"
+L849:
+	DB 26, 92, "s9"
+L850:
+	DW L850, L846-L850
+L851:
+	DW L855, L854-L847
+L852:
+	DW L954, L853-L855
+L853:
+	DB 51, 156, "s3"
+L854:
+	DW L2781, L850-L855
+L855:
+	DW L855, L854-L855
+L856:
+	DW L429, L858-L855
+L857:
+	DW L855, L859-L853
+L858:
+	DB 57, 105, "s8"
+L859:
+	DW L855, L858-L856
+L860:
+	DW L55, L862-L857
+L861:
+	DW L859, L860-L865
+L862:
+	DW L2613, L864-L862
+L863:
+	DW L864, L859-L860
+L864:
+	DW L868, L862-L864
+L865:
+	DW L861, L862-L865
+L866:
+	DW L4422, L869-L868
+L867:
+	DB 79, 124, "s7"
+L868:
+	DW L814, L864-L864
+L869:
+	DW L872, L868-L872
+L870:
+	DW L874, L867-L870
+L871:
+	DB 137, 191, "s1"
+L872:
+	DW L876, L874-L868
+L873:
+	DB 108, 132, "s3"
+L874:
+	DW L878, L871-L874
+L875:
+	DB 245, 50, "s5"
+L876:
+	DW L201, L879-L878
+L877:
+	DB 39, 45, "s7"
+L878:
+	DB 135, 63, "s8"
+L879:
+	DB 203, 140, "s9"
+L880:
+	DW L877, L878-L883
+L881:
+	DB 85, 30, "s1"
+L882:
+	DB 202, 194, "s2"
+L883:
+	DB 70, 14, "s3"
+L884:
+	DB 143, 10, "s4"
+L885:
+	DB 85, 17, "s5"
+L886:
+	DB 233, 163, "s6"
+L887:
+	DW L885, L886-L885
+L888:
+	DW L887, L891-L886
+L889:
+	DW L888, L891-L886
+L890:
+	DW L889, L886-L890
+L891:
+	DW L890, L889-L891
+L892:
+	DW L3992, L888-L893
+L893:
+	DW L893, L896-L892
+L894:
+	DW L891, L891-L891
+L895:
+	DB 157, 178, "s5"
+L896:
+	DW L893, L893-L894
+L897:
+	DB 30, 45, "s7"
+L898:
+	DB 79, 128, "s8"
+L899:
+	DB 126, 118, "s9"
+L900:
+	DW L899, L900-L899
+L901:
+	DW L4502, L897-L900
+L902:
+	DW L906, L898-L898
+L903:
+	DW L1441, L904-L904
+L904:
+	DB 138, 185, "s4"
+L905:
+	DW L356, L908-L901
+L906:
+	DW L905, L903-L902
+L907:
+	DW L4528, L905-L907
+L908:
+	DW L906, L905-L904
+L909:
+	DW L3074, L907-L912
+L910:
+	DB 237, 24, "s0"
+L911:
+	DB 218, 153, "s1"
+L912:
+	DB 246, 111, "s2"
+L913:
+	DB 206, 98, "s3"
+L914:
+	DB 227, 237, "s4"
+L915:
+	DB 127, 142, "s5"
+L916:
+	DW L915, L918-L912
+L917:
+	DB 215, 213, "s7"
+L918:
+	DW L916, L917-L917
+L919:
+	DB 2, 102, "s9"
+L920:
+	DB 85, 229, "s0"
+L921:
+	DW L919, L921-L922
+L922:
+	DW L926, L918-L925
+L923:
+	DW L926, L927-L923
+L924:
+	DB 81, 75, "s4"
+L925:
+	DB 161, 152, "s5"
+L926:
+	DB 230, 131, "s6"
+L927:
+	DB 166, 231, "s7"
+L928:
+	DW L2889, L932-L930
+L929:
+	DW L167, L926-L929
+L930:
+	DW L928, L933-L930
+L931:
+	DW L3063, L933-L932
+L932:
+	DW L931, L929-L928
+L933:
+	DB 90, 108, "s3"
+L934:
+	DW L936, L932-L931
+L935:
+	DW L935, L933-L931
+L936:
+	DB 224, 56, "s6"
+L937:
+	DB 166, 1, "s7"
+L938:
+	DW L936, L935-L938
+L939:
+	DB 228, 116, "s9"
+L940:
+	DW L937, L940-L938
+L941:
+	DW L940, L939-L942
+L942:
+	DB 238, 134, "s2"
+L943:
+	DB 185, 195, "s3"
+L944:
+	DW L942, L948-L941
+L945:
+	DW L3176, L943-L946
+L946:
+	DB 194, 190, "s6"
+L947:
+	DB 25, 155, "s7"
+L948:
+	DB 30, 59, "s8"
+L949:
+	DB 106, 96, "s9"
+L950:
+	DB 182, 200, "s0"
+L951:
+	DB 201, 60, "s1"
+L952:
+	DB 16, 68, "s2"
+L953:
+	DW L4562, L949-L953
+L954:
+	DW L952, L956-L955
+L955:
+	DB 89, 103, "s5"
+L956:
+	DB 202, 90, "s6"
+L957:
+	DW L959, L960-L955
+L958:
+	DW L958, L961-L954
+L959:
+	DB 205, 186, "s9"
+L960:
+	DW L960, L962-L960
+L961:
+	DW L646, L964-L959
+L962:
+	DW L3771, L965-L958
+L963:
+	DW L964, L962-L962
+L964:
+	DW L1328, L964-L965
+L965:
+	DW L2769, L964-L962
+L966:
+	DW L970, L969-L965
+L967:
+	DB 19, 222, "s7"
+L968:
+	DB 16, 99, "s8"
+L969:
+	DB 154, 182, "s9"
+L970:
+	DW L971, L974-L967
+L971:
+	DB 227, 106, "s1"
+L972:
+	DW L972, L969-L970
+L973:
+	DW L971, L974-L970
+L974:
+	DW L971, L978-L974
+L975:
+	DB 29, 141, "s5"
+L976:
+	DW L4275, L972-L974
+L977:
+	DB 107, 125, "s7"
+L978:
+	DB 175, 59, "s8"
+L979:
+	DB 115, 26, "s9"
+L980:
+	DB 105, 49, "s0"
+L981:
+	DW L979, L985-L977
+L982:
+	DB 76, 25, "s2"
+L983:
+	DW L986, L984-L982
+L984:
+	DW L4041, L988-L986
+L985:
+	DB 224, 221, "s5"
+L986:
+	DB 27, 32, "s6"
+L987:
+	DW L988, L984-L985
+L988:
+	DW L990, L986-L987
+L989:
+	DB 53, 140, "s9"
+L990:
+	DB 242, 232, "s0"
+L991:
+	DW L994, L991-L988
+L992:
+	DW L1857, L994-L990
+L993:
+	DB 224, 138, "s3"
+L994:
+	DW L995, L993-L994
+L995:
+	DW L994, L998-L995
+L996:
+	DB 95, 63, "s6"
+L997:
+	DW L999, L993-L994
+L998:
+	DW L2593, L997-L998
+L999:
+	DB 80, 250, "s9"
+L1000:
+	DW L2407, L997-L1000
+L1001:
+	DW L998, L1003-L997
+L1002:
+	DW L3900, L1006-L1005
+L1003:
+	DB 108, 118, "s3"
+L1004:
+	DW L1006, L1002-L1005
+L1005:
+	DW L1004, L1004-L1002
+L1006:
+	DB 246, 160, "s6"
+L1007:
+	DW L4860, L1008-L1006
+L1008:
+	DB 67, 178, "s8"
+L1009:
+	DB 67, 135, "s9"
+L1010:
+	DW L1009, L1011-L1013
+L1011:
+	DB 139, 208, "s1"
+L1012:
+	DW L1016, L1014-L1011
+L1013:
+	DB 136, 66, "s3"
+L1014:
+	DB 37, 241, "s4"
+L1015:
+	DW L1015, L1013-L1015
+L1016:
+	DB 254, 127, "s6"
+L1017:
+	DB 142, 104, "s7"
+L1018:
+	DW L1016, L1020-L1021
+L1019:
+	DB 186, 177, "s9"
+L1020:
+	DW L1017, L1018-L1016
+L1021:
+	DB 154, 131, "s1"
+L1022:
+	DB 190, 22, "s2"
+L1023:
+	DW L1023, L1021-L1022
+L1024:
+	DW L1026, L1025-L1025
+L1025:
+	DB 30, 227, "s5"
+L1026:
+	DB 111, 105, "s6"
+L1027:
+	DW L1336, L1025-L1024
+L1028:
+	DW L1024, L1024-L1031
+L1029:
+	DW L3247, L1026-L1031
+L1030:
+	DB 131, 217, "s0"
+L1031:
+	DB 89, 161, "s1"
+L1032:
+	DW L1030, L1032-L1029
+L1033:
+	DB 180, 226, "s3"
+L1034:
+	DW L1035, L1038-L1030
+L1035:
+	DB 237, 242, "s5"
+L1036:
+	DB 20, 23, "s6"
+L1037:
+	DB 239, 93, "s7"
+L1038:
+	DW L1040, L1034-L1038
+L1039:
+	DW L1036, L1041-L1040
+L1040:
+	DB 32, 26, "s0"
+L1041:
+	DB 86, 9, "s1"
+L1042:
+	DW L1043, L1040-L1043
+L1043:
+	DB 126, 170, "s3"
+L1044:
+	DW L2668, L1042-L1043
+L1045:
+	DB 64, 209, "s5"
+L1046:
+	DB 135, 102, "s6"
+L1047:
+	DB 228, 97, "s7"
+L1048:
+	DB 97, 178, "s8"
+L1049:
+	DW L117, L1053-L1048
+L1050:
+	DB 22, 166, "s0"
+L1051:
+	DW L1048, L1047-L1048
+L1052:
+	DB 184, 204, "s2"
+L1053:
+	DB 1, 24, "s3"
+L1054:
+	DB 19, 40, "s4"
+L1055:
+	DW L1973, L1054-L1059
+L1056:
+	DW L1055, L1054-L1054
+L1057:
+	DW L1058, L1054-L1056
+L1058:
+	DW L1055, L1056-L1054
+L1059:
+	DB 3, 6, "s9"
+L1060:
+	DW L4884, L1056-L1056
+L1061:
+	DW L2794, L1059-L1059
+L1062:
+	DW L4917, L1059-L1064
+L1063:
+	DW L1065, L1061-L1060
+L1064:
+	DB 20, 52, "s4"
+L1065:
+	DW L4050, L1069-L1069
+L1066:
+	DW L2173, L1065-L1068
+L1067:
+	DB 35, 186, "s7"
+L1068:
+	DW L2999, L1071-L1066
+L1069:
+	DW L1068, L1071-L1071
+L1070:
+	DW L1074, L1070-L1066
+L1071:
+	DW L1075, L1072-L1074
+L1072:
+	DB 173, 214, "s2"
+L1073:
+	DW L1074, L1069-L1072
+L1074:
+	DB 55, 242, "s4"
+L1075:
+	DW L1074, L1074-L1076
+L1076:
+	DW L4869, L1074-L1072
+L1077:
+	DB 38, 35, "s7"
+L1078:
+	DW L1075, L1081-L1075
+L1079:
+	DB 46, 186, "s9"
+L1080:
+	DW L917, L1081-L1078
+L1081:
+	DB 56, 232, "s1"
+L1082:
+	DB 157, 138, "s2"
+L1083:
+	DW L1083, L1084-L1082
+L1084:
+	DW L1083, L1085-L1080
+L1085:
+	DB 153, 124, "s5"
+L1086:
+	DW L1084, L1088-L1090
+L1087:
+	DB 67, 13, "s7"
+L1088:
+	DB 162, 188, "s8"
+L1089:
+	DB 135, 96, "s9"
+L1090:
+	DB 156, 9, "s0"
+L1091:
+	DW L4584, L1095-L1091
+L1092:
+	DW L1799, L1090-L1088
+L1093:
+	DB 255, 26, "s3"
+L1094:
+	DB 56, 86, "s4"
+L1095:
+	DB 105, 58, "s5"
+L1096:
+	DB 100, 16, "s6"
+L1097:
+	DW L1101, L1101-L1096
+L1098:
+	DW L1094, L1098-L1100
+L1099:
+	DB 143, 46, "s9"
+L1100:
+	DB 219, 225, "s0"
+L1101:
+	DW L1395, L1098-L1099
+L1102:
+	DW L1103, L1105-L1098
+L1103:
+	DB 139, 210, "s3"
+L1104:
+	DB 95, 1, "s4"
+L1105:
+	DB 243, 176, "s5"
+L1106:
+	DB 127, 168, "s6"
+L1107:
+	DW L1106, L1106-L1107
+L1108:
+	DB 31, 202, "s8"
+L1109:
+	DW L1108, L1109-L1109
+L1110:
+	DW L1113, L1107-L1111
+L1111:
+	DW L1111, L1108-L1109
+L1112:
+	DB 214, 225, "s2"
+L1113:
+	DW L1109, L1112-L1117
+L1114:
+	DW L1114, L1117-L1115
+L1115:
+	DW L1113, L1117-L1116
+L1116:
+	DB 230, 45, "s6"
+L1117:
+	DB 173, 187, "s7"
+L1118:
+	DB 86, 141, "s8"
+L1119:
+	DW L1120, L1120-L1123
+L1120:
+	DW L1121, L1122-L1123
+L1121:
+	DB 227, 171, "s1"
+L1122:
+	DW L1118, L1123-L1122
+L1123:
+	DB 19, 177, "s3"
+L1124:
+	DW L2377, L1128-L1125
+L1125:
+	DW L1123, L1127-L1125
+L1126:
+	DB 150, 28, "s6"
+L1127:
+	DW L1126, L1126-L1124
+L1128:
+	DW L1126, L1128-L1126
+L1129:
+	DB 40, 155, "s9"
+L1130:
+	DB 40, 223, "s0"
+L1131:
+	DB 84, 170, "s1"
+L1132:
+	DW L1128, L1136-L1132
+L1133:
+	DW L1132, L1132-L1131
+L1134:
+	DW L1135, L1137-L1138
+L1135:
+	DB 144, 22, "s5"
+L1136:
+	DW L1132, L1139-L1133
+L1137:
+	DB 53, 133, "s7"
+L1138:
+	DB 222, 69, "s8"
+L1139:
+	DW L1135, L1143-L1136
+L1140:
+	DW L1140, L1139-L1137
+L1141:
+	DB 99, 124, "s1"
+L1142:
+	DW L1142, L1142-L1146
+L1143:
+	DB 135, 44, "s3"
+L1144:
+	DB 233, 108, "s4"
+L1145:
+	DB 250, 158, "s5"
+L1146:
+	DB 163, 200, "s6"
+L1147:
+	DW L1150, L1149-L1147
+L1148:
+	DW L1152, L1148-L1149
+L1149:
+	DW L1145, L1146-L1145
+L1150:
+	DW L1149, L1147-L1154
+L1151:
+	DB 69, 57, "s1"
+L1152:
+	DW L1150, L1153-L1156
+L1153:
+	DW L1156, L1153-L1149
+L1154:
+	DW L1156, L1152-L1152
+L1155:
+	DW L1158, L1155-L1154
+L1156:
+	DW L1156, L1155-L1153
+L1157:
+	DW L1156, L1158-L1160
+L1158:
+	DW L1156, L1154-L1159
+L1159:
+	DW L1156, L1161-L1161
+L1160:
+	DB 155, 58, "s0"
+L1161:
+	DB 132, 126, "s1"
+L1162:
+	DW L1160, L1164-L1163
+L1163:
+	DW L1166, L1166-L1163
+L1164:
+	DW L3940, L1167-L1161
+L1165:
+	DW L3775, L1162-L1166
+L1166:
+	DB 179, 47, "s6"
+L1167:
+	DW L1169, L1163-L1163
+L1168:
+	DW L1166, L1165-L1168
+L1169:
+	DB 28, 253, "s9"
+L1170:
+	DB 185, 2, "s0"
+L1171:
+	DW L1173, L1173-L1168
+L1172:
+	DW L1173, L1168-L1175
+L1173:
+	DB 79, 116, "s3"
+L1174:
+	DB 140, 240, "s4"
+L1175:
+	DW L4072, L1171-L1178
+L1176:
+	DW L1177, L1177-L1176
+L1177:
+	DB 88, 138, "s7"
+L1178:
+	DW L1174, L1178-L1174
+L1179:
+	DB 214, 33, "s9"
+L1180:
+	DW L1178, L1183-L1177
+L1181:
+	DB 100, 233, "s1"
+L1182:
+	DW L1186, L1178-L1183
+L1183:
+	DW L1186, L1181-L1180
+L1184:
+	DB 139, 212, "s4"
+L1185:
+	DW L4695, L1186-L1181
+L1186:
+	DW L2401, L1187-L1187
+L1187:
+	DB 143, 52, "s7"
+L1188:
+	DB 192, 214, "s8"
+L1189:
+	DB 220, 157, "s9"
+L1190:
+	DW L1192, L1189-L1191
+L1191:
+	DB 222, 151, "s1"
+L1192:
+	DB 156, 97, "s2"
+L1193:
+	DW L1057, L1197-L1193
+L1194:
+	DW L1191, L1191-L1198
+L1195:
+	DB 87, 191, "s5"
+L1196:
+	DB 208, 221, "s6"
+L1197:
+	DW L2810, L1197-L1201
+L1198:
+	DB 98, 221, "s8"
+L1199:
+	DW L1200, L1199-L1199
+L1200:
+	DB 76, 110, "s0"
+L1201:
+	DW L1198, L1198-L1200
+L1202:
+	DW L4600, L1202-L1199
+L1203:
+	DB 41, 193, "s3"
+L1204:
+	DB 29, 21, "s4"
+L1205:
+	DB 205, 53, "s5"
+L1206:
+	DB 251, 46, "s6"
+L1207:
+	DW L1208, L1209-L1205
+L1208:
+	DW L1212, L1205-L1205
+L1209:
+	DB 225, 238, "s9"
+L1210:
+	DW L1207, L1206-L1209
+L1211:
+	DW L1213, L1209-L1210
+L1212:
+	DW L1213, L1212-L1212
+L1213:
+	DB 213, 60, "s3"
+L1214:
+	DB 248, 253, "s4"
+L1215:
+	DW L1211, L1212-L1211
+L1216:
+	DW L1215, L1218-L1218
+L1217:
+	DB 78, 17, "s7"
+L1218:
+	DB 123, 196, "s8"
+L1219:
+	DB 215, 193, "s9"
+L1220:
+	DW L1218, L1219-L1220
+L1221:
+	DB 27, 242, "s1"
+L1222:
+	DB 135, 237, "s2"
+L1223:
+	DW L1227, L1222-L1220
+L1224:
+	DW L1488, L1226-L1223
+L1225:
+	DW L1222, L1225-L1225
+L1226:
+	DB 75, 53, "s6"
+L1227:
+	DB 69, 141, "s7"
+L1228:
+	DB 248, 54, "s8"
+L1229:
+	DB 206, 90, "s9"
+L1230:
+	DW L1229, L1232-L1227
+L1231:
+	DB 93, 27, "s1"
+L1232:
+	DW L1233, L1233-L1232
+L1233:
+	DB 110, 127, "s3"
+L1234:
+	DW L1235, L1237-L1231
+L1235:
+	DW L1232, L1238-L1232
+L1236:
+	DB 246, 205, "s6"
+L1237:
+	DB 93, 246, "s7"
+L1238:
+	DB 31, 156, "s8"
+L1239:
+	DW L1241, L1237-L1243
+L1240:
+	DB 109, 169, "s0"
+L1241:
+	DW L1243, L1240-L1241
+L1242:
+	DW L1243, L1244-L1242
+L1243:
+	DB 171, 88, "s3"
+L1244:
+	DW L1245, L1245-L1244
+L1245:
+	DW L1247, L1242-L1248
+L1246:
+	DB 66, 51, "s6"
+L1247:
+	DB 35, 152, "s7"
+L1248:
+	DB 16, 111, "s8"
+L1249:
+	DW L1245, L1245-L1250
+L1250:
+	DW L1253, L1248-L1246
+L1251:
+	DB 101, 67, "s1"
+L1252:
+	DW L1249, L1250-L1253
+L1253:
+	DB 53, 249, "s3"
+L1254:
+	DW L1253, L1255-L1250
+L1255:
+	DB 178, 107, "s5"
+L1256:
+	DB 140, 81, "s6"
+L1257:
+	DB 160, 156, "s7"
+L1258:
+	DW L2431, L1255-L1262
+L1259:
+	DW L1255, L1263-L1257
+L1260:
+	DW L1264, L1257-L1257
+L1261:
+	DB 136, 200, "s1"
+L1262:
+	DB 38, 188, "s2"
+L1263:
+	DW L571, L1266-L1260
+L1264:
+	DW L1261, L1260-L1262
+L1265:
+	DB 220, 3, "s5"
+L1266:
+	DB 38, 128, "s6"
+L1267:
+	DW L1268, L1270-L1268
+L1268:
+	DB 16, 122, "s8"
+L1269:
+	DW L1265, L1271-L1267
+L1270:
+	DB 167, 174, "s0"
+L1271:
+	DW L1273, L1274-L1271
+L1272:
+	DW L1205, L1272-L1269
+L1273:
+	DB 201, 132, "s3"
+L1274:
+	DW L1278, L1278-L1275
+L1275:
+	DB 8, 94, "s5"
+L1276:
+	DW L1274, L1276-L1279
+L1277:
+	DB 124, 46, "s7"
+L1278:
+	DB 90, 97, "s8"
+L1279:
+	DB 192, 225, "s9"
+L1280:
+	DB 218, 15, "s0"
+L1281:
+	DB 93, 54, "s1"
+L1282:
+	DB 182, 97, "s2"
+L1283:
+	DW L1283, L1287-L1283
+L1284:
+	DB 95, 93, "s4"
+L1285:
+	DB 28, 181, "s5"
+L1286:
+	DB 23, 69, "s6"
+L1287:
+	DB 81, 252, "s7"
+L1288:
+	DW L17, L1288-L1287
+L1289:
+	DW L1285, L1289-L1293
+L1290:
+	DB 83, 62, "s0"
+L1291:
+	DW L1292, L1290-L1291
+L1292:
+	DW L4789, L1291-L1291
+L1293:
+	DB 223, 98, "s3"
+L1294:
+	DW L1292, L1290-L1296
+L1295:
+	DW L1297, L1295-L1297
+L1296:
+	DW L1300, L1293-L1297
+L1297:
+	DB 99, 239, "s7"
+L1298:
+	DW L296, L1297-L1300
+L1299:
+	DB 120, 98, "s9"
+L1300:
+	DW L1299, L1299-L1297
+L1301:
+	DW L1305, L1299-L1299
+L1302:
+	DB 100, 253, "s2"
+L1303:
+	DW L3549, L1302-L1305
+L1304:
+	DW L1006, L1305-L1300
+L1305:
+	DW L1824, L1307-L1302
+L1306:
+	DB 236, 234, "s6"
+L1307:
+	DB 108, 160, "s7"
+L1308:
+	DB 83, 188, "s8"
+L1309:
+	DW L3277, L1310-L1305
+L1310:
+	DW L1310, L1306-L1312
+L1311:
+	DW L838, L1307-L1307
+L1312:
+	DB 75, 155, "s2"
+L1313:
+	DB 11, 220, "s3"
+L1314:
+	DB 204, 208, "s4"
+L1315:
+	DB 155, 144, "s5"
+L1316:
+	DB 97, 223, "s6"
+L1317:
+	DB 104, 79, "s7"
+L1318:
+	DB 27, 111, "s8"
+L1319:
+	DB 143, 197, "s9"
+L1320:
+	DW L424, L1316-L1324
+L1321:
+	DW L1321, L1322-L1324
+L1322:
+	DB 217, 67, "s2"
+L1323:
+	DW L1320, L1326-L1326
+L1324:
+	DB 152, 157, "s4"
+L1325:
+	DW L1325, L1326-L1326
+L1326:
+	DB 199, 16, "s6"
+L1327:
+	DW L1323, L1330-L1330
+L1328:
+	DW L1327, L1325-L1329
+L1329:
+	DW L1330, L1330-L1332
+L1330:
+	DB 247, 149, "s0"
+L1331:
+	DW L1330, L1332-L1332
+L1332:
+	DW L4530, L1331-L1332
+L1333:
+	DB 93, 8, "s3"
+L1334:
+	DB 155, 238, "s4"
+L1335:
+	DW L1331, L1336-L1334
+L1336:
+	DW L1336, L1336-L1333
+L1337:
+	DB 21, 243, "s7"
+L1338:
+	DW L24, L1338-L1342
+L1339:
+	DB 116, 114, "s9"
+L1340:
+	DB 147, 39, "s0"
+L1341:
+	DW L1341, L1341-L1338
+L1342:
+	DW L1338, L1343-L1346
+L1343:
+	DW L2815, L1344-L1342
+L1344:
+	DW L1344, L1344-L1347
+L1345:
+	DB 252, 183, "s5"
+L1346:
+	DB 27, 52, "s6"
+L1347:
+	DW L1349, L1348-L1350
+L1348:
+	DB 174, 76, "s8"
+L1349:
+	DB 87, 228, "s9"
+L1350:
+	DB 10, 148, "s0"
+L1351:
+	DW L1350, L1351-L1355
+L1352:
+	DB 182, 48, "s2"
+L1353:
+	DW L1357, L1352-L1355
+L1354:
+	DW L1351, L1357-L1352
+L1355:
+	DW L1353, L1352-L1351
+L1356:
+	DB 98, 150, "s6"
+L1357:
+	DW L1356, L1354-L1353
+L1358:
+	DB 158, 210, "s8"
+L1359:
+	DB 245, 210, "s9"
+L1360:
+	DW L1356, L1362-L1362
+L1361:
+	DB 94, 27, "s1"
+L1362:
+	DB 182, 188, "s2"
+L1363:
+	DB 201, 1, "s3"
+L1364:
+	DW L1360, L1360-L1364
+L1365:
+	DW L1364, L1365-L1361
+L1366:
+	DB 162, 30, "s6"
+L1367:
+	DW L1370, L1364-L1367
+L1368:
+	DB 182, 244, "s8"
+L1369:
+	DW L1371, L1373-L1371
+L1370:
+	DB 156, 154, "s0"
+L1371:
+	DB 105, 211, "s1"
+L1372:
+	DB 87, 31, "s2"
+L1373:
+	DW L1374, L1373-L1371
+L1374:
+	DB 39, 33, "s4"
+L1375:
+	DW L2610, L1379-L1375
+L1376:
+	DB 233, 129, "s6"
+L1377:
+	DW L1378, L1373-L1381
+L1378:
+	DB 217, 135, "s8"
+L1379:
+	DB 31, 232, "s9"
+L1380:
+	DB 7, 112, "s0"
+L1381:
+	DB 193, 205, "s1"
+L1382:
+	DW L4840, L1380-L1378
+L1383:
+	DW L1379, L1387-L1383
+L1384:
+	DB 39, 130, "s4"
+L1385:
+	DW L1382, L1389-L1383
+L1386:
+	DB 246, 181, "s6"
+L1387:
+	DB 48, 71, "s7"
+L1388:
+	DW L1390, L1389-L1388
+L1389:
+	DW L1386, L1387-L1393
+L1390:
+	DB 247, 29, "s0"
+L1391:
+	DB 5, 203, "s1"
+L1392:
+	DW L419, L1391-L1395
+L1393:
+	DB 56, 172, "s3"
+L1394:
+	DB 133, 201, "s4"
+L1395:
+	DB 7, 245, "s5"
+L1396:
+	DW L1393, L1398-L1398
+L1397:
+	DB 219, 70, "s7"
+L1398:
+	DW L1394, L1401-L1401
+L1399:
+	DW L1402, L1396-L1396
+L1400:
+	DW L1401, L1401-L1403
+L1401:
+	DB 22, 113, "s1"
+L1402:
+	DW L1402, L1398-L1401
+L1403:
+	DB 42, 31, "s3"
+L1404:
+	DW L3644, L1404-L1400
+L1405:
+	DW L1407, L1403-L1402
+L1406:
+	DW L1410, L1404-L1404
+L1407:
+	DB 75, 139, "s7"
+L1408:
+	DB 96, 227, "s8"
+L1409:
+	DW L1412, L1409-L1411
+L1410:
+	DB 166, 163, "s0"
+L1411:
+	DB 215, 202, "s1"
+L1412:
+	DB 151, 245, "s2"
+L1413:
+	DB 31, 140, "s3"
+L1414:
+	DW L1069, L1412-L1417
+L1415:
+	DW L1344, L1418-L1415
+L1416:
+	DW L1413, L1412-L1413
+L1417:
+	DW L1416, L1414-L1420
+L1418:
+	DB 11, 45, "s8"
+L1419:
+	DW L1415, L1417-L1421
+L1420:
+	DB 172, 158, "s0"
+L1421:
+	DW L1425, L1424-L1418
+L1422:
+	DB 174, 131, "s2"
+L1423:
+	DB 28, 78, "s3"
+L1424:
+	DB 135, 192, "s4"
+L1425:
+	DW L2233, L1424-L1425
+L1426:
+	DB 156, 153, "s6"
+L1427:
+	DW L1427, L1429-L1425
+L1428:
+	DB 22, 207, "s8"
+L1429:
+	DB 68, 40, "s9"
+L1430:
+	DW L4651, L1426-L1430
+L1431:
+	DW L1428, L1434-L1430
+L1432:
+	DB 97, 140, "s2"
+L1433:
+	DB 151, 179, "s3"
+L1434:
+	DB 88, 108, "s4"
+L1435:
+	DB 59, 209, "s5"
+L1436:
+	DW L1437, L1439-L1433
+L1437:
+	DB 29, 71, "s7"
+L1438:
+	DB 27, 24, "s8"
+L1439:
+	DB 158, 134, "s9"
+L1440:
+	DB 243, 171, "s0"
+L1441:
+	DB 85, 168, "s1"
+L1442:
+	DB 111, 188, "s2"
+L1443:
+	DW L1440, L1440-L1442
+L1444:
+	DB 103, 109, "s4"
+L1445:
+	DB 226, 141, "s5"
+L1446:
+	DB 24, 6, "s6"
+L1447:
+	DB 73, 209, "s7"
+L1448:
+	DW L1444, L1452-L1449
+L1449:
+	DB 52, 193, "s9"
+L1450:
+	DB 83, 244, "s0"
+L1451:
+	DB 233, 200, "s1"
+L1452:
+	DW L1453, L1451-L1453
+L1453:
+	DB 234, 50, "s3"
+L1454:
+	DW L1458, L1455-L1452
+L1455:
+	DW L1453, L1455-L1457
+L1456:
+	DW L1457, L1458-L1454
+L1457:
+	DW L1454, L1457-L1459
+L1458:
+	DB 104, 215, "s8"
+L1459:
+	DB 56, 45, "s9"
+L1460:
+	DB 66, 206, "s0"
+L1461:
+	DB 78, 127, "s1"
+L1462:
+	DB 115, 235, "s2"
+L1463:
+	DB 33, 221, "s3"
+L1464:
+	DW L1461, L1465-L1462
+L1465:
+	DW L1469, L1463-L1464
+L1466:
+	DW L2887, L1470-L1462
+L1467:
+	DB 30, 163, "s7"
+L1468:
+	DW L1468, L1471-L1471
+L1469:
+	DB 64, 35, "s9"
+L1470:
+	DB 216, 197, "s0"
+L1471:
+	DB 141, 219, "s1"
+L1472:
+	DW L1476, L1468-L1468
+L1473:
+	DW L1471, L1474-L1473
+L1474:
+	DB 196, 205, "s4"
+L1475:
+	DW L1473, L1479-L1476
+L1476:
+	DB 83, 246, "s6"
+L1477:
+	DW L1481, L1473-L1480
+L1478:
+	DB 27, 227, "s8"
+L1479:
+	DB 189, 87, "s9"
+L1480:
+	DB 205, 125, "s0"
+L1481:
+	DW L1481, L1479-L1480
+L1482:
+	DB 112, 49, "s2"
+L1483:
+	DW L2024, L1482-L1483
+L1484:
+	DB 3, 129, "s4"
+L1485:
+	DW L716, L1487-L1485
+L1486:
+	DB 189, 161, "s6"
+L1487:
+	DB 121, 85, "s7"
+L1488:
+	DB 162, 172, "s8"
+L1489:
+	DW L1485, L1485-L1493
+L1490:
+	DW L1488, L1490-L1491
+L1491:
+	DW L867, L1490-L1490
+L1492:
+	DW L1495, L1492-L1495
+L1493:
+	DW L1491, L1497-L1490
+L1494:
+	DB 191, 5, "s4"
+L1495:
+	DW L1494, L1494-L1493
+L1496:
+	DW L1493, L1499-L1497
+L1497:
+	DW L1498, L1494-L1497
+L1498:
+	DW L1501, L1497-L1499
+L1499:
+	DB 153, 124, "s9"
+L1500:
+	DB 177, 128, "s0"
+L1501:
+	DW L3394, L1500-L1503
+L1502:
+	DW L106, L1506-L1499
+L1503:
+	DW L1503, L1501-L1503
+L1504:
+	DB 66, 208, "s4"
+L1505:
+	DW L1504, L1509-L1508
+L1506:
+	DW L1508, L1505-L1510
+L1507:
+	DB 137, 4, "s7"
+L1508:
+	DB 25, 215, "s8"
+L1509:
+	DW L1507, L1507-L1511
+L1510:
+	DW L1513, L1508-L1507
+L1511:
+	DB 30, 66, "s1"
+L1512:
+	DB 134, 191, "s2"
+L1513:
+	DW L4637, L1511-L1516
+L1514:
+	DB 137, 129, "s4"
+L1515:
+	DW L1517, L1519-L1511
+L1516:
+	DB 180, 251, "s6"
+L1517:
+	DB 150, 126, "s7"
+L1518:
+	DB 23, 98, "s8"
+L1519:
+	DB 185, 154, "s9"
+L1520:
+	DW L1519, L1517-L1519
+L1521:
+	DB 140, 7, "s1"
+L1522:
+	DW L4573, L1522-L1526
+L1523:
+	DB 228, 171, "s3"
+L1524:
+	DW L1526, L1520-L1526
+L1525:
+	DW L1527, L1523-L1526
+L1526:
+	DB 251, 138, "s6"
+L1527:
+	DW L4417, L1529-L1527
+L1528:
+	DB 57, 86, "s8"
+L1529:
+	DW L1528, L1533-L1527
+L1530:
+	DW L3782, L1527-L1529
+L1531:
+	DB 20, 185, "s1"
+L1532:
+	DW L2412, L1529-L1529
+L1533:
+	DB 237, 62, "s3"
+L1534:
+	DB 51, 104, "s4"
+L1535:
+	DB 73, 124, "s5"
+L1536:
+	DW L1539, L1533-L1539
+L1537:
+	DB 195, 193, "s7"
+L1538:
+	DB 35, 191, "s8"
+L1539:
+	DB 208, 74, "s9"
+L1540:
+	DW L1537, L1543-L1537
+L1541:
+	DW L1541, L1544-L1543
+L1542:
+	DB 223, 33, "s2"
+L1543:
+	DB 231, 71, "s3"
+L1544:
+	DW L1548, L1543-L1546
+L1545:
+	DB 6, 58, "s5"
+L1546:
+	DW L1544, L1547-L1549
+L1547:
+	DB 185, 149, "s7"
+L1548:
+	DB 167, 23, "s8"
+L1549:
+	DB 65, 177, "s9"
+L1550:
+	DB 251, 4, "s0"
+L1551:
+	DB 147, 186, "s1"
+L1552:
+	DB 169, 244, "s2"
+L1553:
+	DW L1555, L1557-L1552
+L1554:
+	DB 20, 228, "s4"
+L1555:
+	DB 170, 61, "s5"
+L1556:
+	DW L2101, L1555-L1554
+L1557:
+	DB 24, 165, "s7"
+L1558:
+	DW L1202, L1561-L1561
+L1559:
+	DW L1282, L1559-L1556
+L1560:
+	DB 90, 239, "s0"
+L1561:
+	DW L1562, L1565-L1561
+L1562:
+	DW L1559, L1565-L1560
+L1563:
+	DW L1564, L1564-L1566
+L1564:
+	DB 144, 132, "s4"
+L1565:
+	DW L1563, L1561-L1565
+L1566:
+	DW L1563, L1564-L1564
+L1567:
+	DW L1563, L1563-L1570
+L1568:
+	DW L1566, L1569-L1565
+L1569:
+	DW L1567, L1572-L1568
+L1570:
+	DB 170, 65, "s0"
+L1571:
+	DW L1574, L1574-L1571
+L1572:
+	DW L1571, L1576-L1570
+L1573:
+	DW L1577, L1576-L1570
+L1574:
+	DW L1575, L1573-L1572
+L1575:
+	DB 127, 192, "s5"
+L1576:
+	DB 55, 201, "s6"
+L1577:
+	DB 100, 2, "s7"
+L1578:
+	DB 38, 148, "s8"
+L1579:
+	DW L1575, L1577-L1579
+L1580:
+	DB 123, 58, "s0"
+L1581:
+	DB 30, 194, "s1"
+L1582:
+	DW L1585, L1585-L1581
+L1583:
+	DW L1585, L1586-L1587
+L1584:
+	DW L1583, L1587-L1581
+L1585:
+	DB 14, 34, "s5"
+L1586:
+	DB 62, 151, "s6"
+L1587:
+	DW L1588, L1589-L1590
+L1588:
+	DW L1585, L1587-L1584
+L1589:
+	DB 195, 175, "s9"
+L1590:
+	DW L1593, L1594-L1594
+L1591:
+	DB 192, 195, "s1"
+L1592:
+	DW L1596, L1596-L1593
+L1593:
+	DB 66, 64, "s3"
+L1594:
+	DB 142, 135, "s4"
+L1595:
+	DW L2664, L1597-L1599
+L1596:
+	DW L1599, L1594-L1594
+L1597:
+	DB 86, 150, "s7"
+L1598:
+	DW L1599, L1602-L1601
+L1599:
+	DB 64, 145, "s9"
+L1600:
+	DB 46, 111, "s0"
+L1601:
+	DW L1605, L1599-L1597
+L1602:
+	DB 105, 67, "s2"
+L1603:
+	DW L1075, L1601-L1605
+L1604:
+	DB 126, 51, "s4"
+L1605:
+	DW L1603, L1605-L1606
+L1606:
+	DW L2671, L1602-L1609
+L1607:
+	DB 45, 245, "s7"
+L1608:
+	DW L1606, L1604-L1608
+L1609:
+	DW L1606, L1605-L1611
+L1610:
+	DW L1608, L1609-L1610
+L1611:
+	DW L3142, L1607-L1614
+L1612:
+	DB 126, 105, "s2"
+L1613:
+	DB 255, 227, "s3"
+L1614:
+	DB 111, 22, "s4"
+L1615:
+	DB 9, 167, "s5"
+L1616:
+	DW L1613, L1614-L1612
+L1617:
+	DB 168, 16, "s7"
+L1618:
+	DB 82, 206, "s8"
+L1619:
+	DB 112, 31, "s9"
+L1620:
+	DW L3031, L1616-L1618
+L1621:
+	DW L1617, L1619-L1621
+L1622:
+	DB 139, 75, "s2"
+L1623:
+	DW L1623, L1623-L1626
+L1624:
+	DW L1622, L1623-L1623
+L1625:
+	DW L1625, L1624-L1622
+L1626:
+	DB 119, 1, "s6"
+L1627:
+	DB 107, 93, "s7"
+L1628:
+	DB 255, 215, "s8"
+L1629:
+	DW L1461, L1627-L1632
+L1630:
+	DW L1632, L1633-L1629
+L1631:
+	DW L1627, L1628-L1634
+L1632:
+	DB 56, 90, "s2"
+L1633:
+	DW L1636, L1637-L1629
+L1634:
+	DW L1631, L1631-L1631
+L1635:
+	DW L1633, L1632-L1632
+L1636:
+	DW L1635, L1638-L1634
+L1637:
+	DB 160, 197, "s7"
+L1638:
+	DB 10, 143, "s8"
+L1639:
+	DW L1636, L1636-L1640
+L1640:
+	DW L1460, L1636-L1638
+L1641:
+	DW L1837, L1643-L1643
+L1642:
+	DB 245, 171, "s2"
+L1643:
+	DW L1643, L1644-L1639
+L1644:
+	DW L1642, L1643-L1640
+L1645:
+	DB 112, 88, "s5"
+L1646:
+	DB 255, 127, "s6"
+L1647:
+	DB 32, 178, "s7"
+L1648:
+	DB 33, 196, "s8"
+L1649:
+	DB 157, 122, "s9"
+L1650:
+	DW L1649, L1647-L1650
+L1651:
+	DW L1609, L1654-L1650
+L1652:
+	DW L4009, L1655-L1651
+L1653:
+	DB 232, 190, "s3"
+L1654:
+	DW L1653, L1651-L1657
+L1655:
+	DB 177, 39, "s5"
+L1656:
+	DW L418, L1660-L1660
+L1657:
+	DB 156, 204, "s7"
+L1658:
+	DW L1657, L1662-L1655
+L1659:
+	DB 127, 47, "s9"
+L1660:
+	DB 120, 141, "s0"
+L1661:
+	DB 34, 81, "s1"
+L1662:
+	DB 25, 191, "s2"
+L1663:
+	DB 204, 246, "s3"
+L1664:
+	DW L1661, L1660-L1661
+L1665:
+	DW L1664, L1663-L1669
+L1666:
+	DW L1665, L1668-L1662
+L1667:
+	DB 147, 105, "s7"
+L1668:
+	DB 212, 210, "s8"
+L1669:
+	DW L1665, L1665-L1669
+L1670:
+	DB 47, 64, "s0"
+L1671:
+	DW L1672, L1673-L1671
+L1672:
+	DW L3466, L1669-L1669
+L1673:
+	DW L1671, L1676-L1677
+L1674:
+	DW L1672, L1670-L1673
+L1675:
+	DW L2870, L1678-L1672
+L1676:
+	DW L1680, L1674-L1676
+L1677:
+	DW L1673, L1678-L1675
+L1678:
+	DW L1681, L1682-L1681
+L1679:
+	DW L1680, L1682-L1682
+L1680:
+	DB 49, 248, "s0"
+L1681:
+	DW L1683, L1677-L1682
+L1682:
+	DB 236, 253, "s2"
+L1683:
+	DW L1679, L1687-L1682
+L1684:
+	DB 200, 41, "s4"
+L1685:
+	DW L1686, L1686-L1682
+L1686:
+	DB 218, 250, "s6"
+L1687:
+	DB 145, 234, "s7"
+L1688:
+	DW L514, L1686-L1685
+L1689:
+	DB 225, 192, "s9"
+L1690:
+	DB 69, 180, "s0"
+L1691:
+	DB 3, 216, "s1"
+L1692:
+	DB 247, 205, "s2"
+L1693:
+	DW L1697, L1690-L1689
+L1694:
+	DW L2492, L1697-L1697
+L1695:
+	DW L1694, L1698-L1691
+L1696:
+	DB 1, 162, "s6"
+L1697:
+	DW L4811, L1694-L1695
+L1698:
+	DW L1698, L1698-L1696
+L1699:
+	DB 194, 68, "s9"
+L1700:
+	DW L1699, L1704-L1701
+L1701:
+	DW L1702, L1699-L1699
+L1702:
+	DB 47, 76, "s2"
+L1703:
+	DB 28, 183, "s3"
+L1704:
+	DW L1702, L1708-L1704
+L1705:
+	DB 25, 138, "s5"
+L1706:
+	DB 154, 255, "s6"
+L1707:
+	DW L1706, L1705-L1709
+L1708:
+	DW L1705, L1712-L1707
+L1709:
+	DW L1709, L1713-L1708
+L1710:
+	DB 206, 232, "s0"
+L1711:
+	DW L1714, L1713-L1712
+L1712:
+	DW L1716, L1713-L1712
+L1713:
+	DW L1717, L1715-L1709
+L1714:
+	DW L1716, L1712-L1716
+L1715:
+	DW L1718, L1717-L1712
+L1716:
+	DB 44, 223, "s6"
+L1717:
+	DB 231, 245, "s7"
+L1718:
+	DW L1722, L1720-L1721
+L1719:
+	DB 246, 100, "s9"
+L1720:
+	DB 223, 73, "s0"
+L1721:
+	DB 9, 106, "s1"
+L1722:
+	DB 90, 208, "s2"
+L1723:
+	DW L1719, L1727-L1726
+L1724:
+	DB 110, 92, "s4"
+L1725:
+	DB 211, 68, "s5"
+L1726:
+	DW L1730, L1730-L1723
+L1727:
+	DB 222, 201, "s7"
+L1728:
+	DW L1725, L1729-L1729
+L1729:
+	DW L1691, L1726-L1732
+L1730:
+	DW L2851, L1731-L1729
+L1731:
+	DW L421, L1728-L1731
+L1732:
+	DB 204, 8, "s2"
+L1733:
+	DB 233, 107, "s3"
+L1734:
+	DB 234, 110, "s4"
+L1735:
+	DB 5, 122, "s5"
+L1736:
+	DB 197, 61, "s6"
+L1737:
+	DB 253, 102, "s7"
+L1738:
+	DW L1740, L1737-L1742
+L1739:
+	DB 29, 215, "s9"
+L1740:
+	DB 41, 64, "s0"
+L1741:
+	DW L1742, L1740-L1745
+L1742:
+	DW L2169, L1746-L1746
+L1743:
+	DB 110, 49, "s3"
+L1744:
+	DW L1745, L1741-L1743
+L1745:
+	DW L1744, L1749-L1745
+L1746:
+	DW L2849, L1743-L1743
+L1747:
+	DB 116, 76, "s7"
+L1748:
+	DW L1745, L1750-L1752
+L1749:
+	DB 107, 156, "s9"
+L1750:
+	DW L3133, L1747-L1750
+L1751:
+	DB 69, 12, "s1"
+L1752:
+	DW L1750, L1748-L1754
+L1753:
+	DW L1755, L1757-L1750
+L1754:
+	DW L1751, L1756-L1754
+L1755:
+	DW L1754, L1752-L1756
+L1756:
+	DB 195, 97, "s6"
+L1757:
+	DB 99, 6, "s7"
+L1758:
+	DB 191, 26, "s8"
+L1759:
+	DB 249, 72, "s9"
+L1760:
+	DB 143, 207, "s0"
+L1761:
+	DW L1218, L1765-L1760
+L1762:
+	DW L1484, L1762-L1761
+L1763:
+	DB 206, 53, "s3"
+L1764:
+	DB 223, 155, "s4"
+L1765:
+	DB 112, 158, "s5"
+L1766:
+	DB 160, 187, "s6"
+L1767:
+	DW L1770, L1769-L1765
+L1768:
+	DB 183, 110, "s8"
+L1769:
+	DW L526, L1771-L1768
+L1770:
+	DW L1767, L1770-L1772
+L1771:
+	DW L1767, L1769-L1768
+L1772:
+	DB 186, 147, "s2"
+L1773:
+	DW L1775, L1769-L1771
+L1774:
+	DW L1770, L1774-L1770
+L1775:
+	DB 95, 145, "s5"
+L1776:
+	DB 134, 41, "s6"
+L1777:
+	DB 48, 77, "s7"
+L1778:
+	DW L1778, L1779-L1779
+L1779:
+	DW L1781, L1780-L1776
+L1780:
+	DB 235, 32, "s0"
+L1781:
+	DW L2198, L1778-L1777
+L1782:
+	DW L1785, L1780-L1783
+L1783:
+	DB 155, 104, "s3"
+L1784:
+	DW L1784, L1780-L1780
+L1785:
+	DB 13, 4, "s5"
+L1786:
+	DB 208, 190, "s6"
+L1787:
+	DB 113, 192, "s7"
+L1788:
+	DW L4710, L1792-L1791
+L1789:
+	DB 175, 238, "s9"
+L1790:
+	DB 170, 23, "s0"
+L1791:
+	DW L244, L1787-L1789
+L1792:
+	DW L1788, L1796-L1788
+L1793:
+	DB 0, 93, "s3"
+L1794:
+	DW L1791, L1790-L1795
+L1795:
+	DW L1798, L1792-L1796
+L1796:
+	DB 156, 164, "s6"
+L1797:
+	DW L2464, L1799-L1796
+L1798:
+	DB 171, 165, "s8"
+L1799:
+	DW L1797, L1801-L1803
+L1800:
+	DW L1801, L1798-L1800
+L1801:
+	DB 218, 165, "s1"
+L1802:
+	DW L1805, L1799-L1802
+L1803:
+	DB 247, 15, "s3"
+L1804:
+	DW L2927, L1808-L1807
+L1805:
+	DW L4790, L1802-L1805
+L1806:
+	DB 231, 21, "s6"
+L1807:
+	DB 163, 89, "s7"
+L1808:
+	DW L239, L1805-L1811
+L1809:
+	DW L1809, L1809-L1807
+L1810:
+	DW L1814, L1813-L1812
+L1811:
+	DW L1113, L1815-L1814
+L1812:
+	DW L1810, L1809-L1813
+L1813:
+	DW L1419, L1816-L1811
+L1814:
+	DB 17, 198, "s4"
+L1815:
+	DW L1817, L1811-L1811
+L1816:
+	DB 156, 62, "s6"
+L1817:
+	DB 116, 220, "s7"
+L1818:
+	DW L1815, L1817-L1819
+L1819:
+	DW L1818, L1823-L1823
+L1820:
+	DB 218, 134, "s0"
+L1821:
+	DB 174, 103, "s1"
+L1822:
+	DB 68, 167, "s2"
+L1823:
+	DW L113, L1824-L1825
+L1824:
+	DB 215, 169, "s4"
+L1825:
+	DB 13, 106, "s5"
+L1826:
+	DB 143, 187, "s6"
+L1827:
+	DB 91, 143, "s7"
+L1828:
+	DB 196, 18, "s8"
+L1829:
+	DB 171, 162, "s9"
+L1830:
+	DB 237, 47, "s0"
+L1831:
+	DW L1438, L1835-L1827
+L1832:
+	DB 26, 231, "s2"
+L1833:
+	DB 83, 187, "s3"
+L1834:
+	DB 88, 216, "s4"
+L1835:
+	DB 230, 5, "s5"
+L1836:
+	DB 97, 166, "s6"
+L1837:
+	DB 93, 34, "s7"
+L1838:
+	DW L1841, L1835-L1836
+L1839:
+	DW L1838, L1842-L1843
+L1840:
+	DW L1843, L1836-L1837
+L1841:
+	DW L1839, L1839-L1841
+L1842:
+	DB 72, 12, "s2"
+L1843:
+	DB 94, 238, "s3"
+L1844:
+	DW L1843, L1841-L1841
+L1845:
+	DW L1538, L1844-L1848
+L1846:
+	DW L1847, L1847-L1847
+L1847:
+	DW L1845, L1847-L1845
+L1848:
+	DW L4378, L1850-L1845
+L1849:
+	DB 93, 89, "s9"
+L1850:
+	DW L1854, L1854-L1846
+L1851:
+	DW L903, L1850-L1853
+L1852:
+	DB 56, 38, "s2"
+L1853:
+	DB 102, 186, "s3"
+L1854:
+	DB 167, 63, "s4"
+L1855:
+	DB 37, 254, "s5"
+L1856:
+	DB 105, 219, "s6"
+L1857:
+	DW L1169, L1858-L1857
+L1858:
+	DW L1857, L1860-L1862
+L1859:
+	DW L1861, L1861-L1856
+L1860:
+	DW L1864, L1856-L1857
+L1861:
+	DB 116, 32, "s1"
+L1862:
+	DB 30, 20, "s2"
+L1863:
+	DW L2217, L1866-L1862
+L1864:
+	DB 65, 124, "s4"
+L1865:
+	DW L1863, L1862-L1861
+L1866:
+	DW L2826, L1868-L1867
+L1867:
+	DB 233, 145, "s7"
+L1868:
+	DB 16, 165, "s8"
+L1869:
+	DW L1870, L1870-L1870
+L1870:
+	DW L1874, L1871-L1872
+L1871:
+	DB 48, 108, "s1"
+L1872:
+	DB 207, 196, "s2"
+L1873:
+	DW L1873, L1875-L1873
+L1874:
+	DB 6, 45, "s4"
+L1875:
+	DW L1878, L1875-L1875
+L1876:
+	DW L1537, L1880-L1873
+L1877:
+	DB 44, 87, "s7"
+L1878:
+	DB 8, 157, "s8"
+L1879:
+	DW L1883, L1877-L1876
+L1880:
+	DB 102, 218, "s0"
+L1881:
+	DW L1398, L1882-L1884
+L1882:
+	DB 66, 204, "s2"
+L1883:
+	DW L1885, L1881-L1880
+L1884:
+	DW L1883, L1883-L1886
+L1885:
+	DB 52, 184, "s5"
+L1886:
+	DW L1889, L1888-L1887
+L1887:
+	DB 135, 183, "s7"
+L1888:
+	DW L1887, L1885-L1886
+L1889:
+	DW L4299, L1888-L1891
+L1890:
+	DB 35, 186, "s0"
+L1891:
+	DB 34, 225, "s1"
+L1892:
+	DW L1890, L1888-L1888
+L1893:
+	DB 182, 191, "s3"
+L1894:
+	DB 154, 131, "s4"
+L1895:
+	DB 13, 230, "s5"
+L1896:
+	DW L1894, L1893-L1898
+L1897:
+	DW L1039, L1900-L1896
+L1898:
+	DB 34, 60, "s8"
+L1899:
+	DB 63, 73, "s9"
+L1900:
+	DW L613, L1903-L1903
+L1901:
+	DB 171, 172, "s1"
+L1902:
+	DB 59, 53, "s2"
+L1903:
+	DW L1905, L1904-L1899
+L1904:
+	DB 98, 143, "s4"
+L1905:
+	DB 33, 172, "s5"
+L1906:
+	DB 21, 42, "s6"
+L1907:
+	DW L1906, L1904-L1907
+L1908:
+	DW L1911, L1911-L1905
+L1909:
+	DB 237, 103, "s9"
+L1910:
+	DW L2534, L1914-L1912
+L1911:
+	DB 62, 91, "s1"
+L1912:
+	DW L1910, L1911-L1914
+L1913:
+	DW L596, L1914-L1912
+L1914:
+	DB 74, 53, "s4"
+L1915:
+	DB 10, 201, "s5"
+L1916:
+	DW L1914, L1919-L1915
+L1917:
+	DB 218, 38, "s7"
+L1918:
+	DB 236, 104, "s8"
+L1919:
+	DB 133, 56, "s9"
+L1920:
+	DB 48, 135, "s0"
+L1921:
+	DW L1923, L1919-L1920
+L1922:
+	DB 120, 175, "s2"
+L1923:
+	DW L1926, L1920-L1927
+L1924:
+	DW L1925, L1920-L1925
+L1925:
+	DW L1928, L1926-L1925
+L1926:
+	DW L1928, L1926-L1922
+L1927:
+	DB 80, 164, "s7"
+L1928:
+	DW L1839, L1932-L1930
+L1929:
+	DB 79, 172, "s9"
+L1930:
+	DW L1934, L1929-L1928
+L1931:
+	DB 14, 88, "s1"
+L1932:
+	DW L1085, L1929-L1928
+L1933:
+	DW L4314, L1929-L1935
+L1934:
+	DB 214, 205, "s4"
+L1935:
+	DW L1937, L1935-L1939
+L1936:
+	DW L1939, L1939-L1934
+L1937:
+	DB 118, 188, "s7"
+L1938:
+	DW L1938, L1940-L1939
+L1939:
+	DB 155, 64, "s9"
+L1940:
+	DW L1939, L1944-L1939
+L1941:
+	DB 180, 50, "s1"
+L1942:
+	DB 52, 182, "s2"
+L1943:
+	DB 197, 25, "s3"
+L1944:
+	DW L4492, L1941-L1941
+L1945:
+	DW L1944, L1945-L1947
+L1946:
+	DW L1943, L1942-L1942
+L1947:
+	DW L1949, L1949-L1946
+L1948:
+	DB 229, 4, "s8"
+L1949:
+	DB 230, 2, "s9"
+L1950:
+	DB 250, 179, "s0"
+L1951:
+	DW L1948, L1951-L1949
+L1952:
+	DB 29, 41, "s2"
+L1953:
+	DW L1954, L1957-L1950
+L1954:
+	DW L1827, L1952-L1950
+L1955:
+	DB 78, 223, "s5"
+L1956:
+	DW L1955, L1952-L1954
+L1957:
+	DW L2411, L1955-L1953
+L1958:
+	DB 237, 170, "s8"
+L1959:
+	DW L1960, L1956-L1957
+L1960:
+	DB 199, 245, "s0"
+L1961:
+	DB 39, 7, "s1"
+L1962:
+	DB 75, 151, "s2"
+L1963:
+	DW L1961, L1967-L1959
+L1964:
+	DW L1963, L1962-L1962
+L1965:
+	DB 148, 179, "s5"
+L1966:
+	DB 229, 113, "s6"
+L1967:
+	DW L1967, L1970-L1964
+L1968:
+	DB 181, 145, "s8"
+L1969:
+	DB 30, 30, "s9"
+L1970:
+	DB 13, 168, "s0"
+L1971:
+	DB 103, 71, "s1"
+L1972:
+	DB 58, 144, "s2"
+L1973:
+	DW L1972, L1973-L1969
+L1974:
+	DW L1113, L1976-L1977
+L1975:
+	DB 34, 109, "s5"
+L1976:
+	DB 123, 121, "s6"
+L1977:
+	DB 12, 41, "s7"
+L1978:
+	DW L1978, L1977-L1974
+L1979:
+	DW L1979, L1977-L1983
+L1980:
+	DB 232, 97, "s0"
+L1981:
+	DB 51, 165, "s1"
+L1982:
+	DB 177, 180, "s2"
+L1983:
+	DB 112, 61, "s3"
+L1984:
+	DB 6, 6, "s4"
+L1985:
+	DB 212, 33, "s5"
+L1986:
+	DB 20, 89, "s6"
+L1987:
+	DB 163, 115, "s7"
+L1988:
+	DB 75, 237, "s8"
+L1989:
+	DW L386, L1988-L1990
+L1990:
+	DW L3637, L1988-L1987
+L1991:
+	DW L2600, L1993-L1990
+L1992:
+	DB 146, 139, "s2"
+L1993:
+	DW L1994, L1989-L1992
+L1994:
+	DW L1995, L1992-L1992
+L1995:
+	DB 135, 42, "s5"
+L1996:
+	DW L2000, L1999-L1997
+L1997:
+	DB 193, 163, "s7"
+L1998:
+	DW L3486, L2000-L1999
+L1999:
+	DW L1996, L1996-L1995
+L2000:
+	DW L1999, L2002-L2002
+L2001:
+	DB 101, 166, "s1"
+L2002:
+	DB 146, 11, "s2"
+L2003:
+	DW L2002, L2003-L2005
+L2004:
+	DW L2005, L2003-L2004
+L2005:
+	DB 8, 172, "s5"
+L2006:
+	DB 253, 74, "s6"
+L2007:
+	DW L2009, L2007-L2004
+L2008:
+	DB 22, 218, "s8"
+L2009:
+	DW L705, L2008-L2013
+L2010:
+	DB 78, 180, "s0"
+L2011:
+	DW L2007, L2014-L2013
+L2012:
+	DW L2015, L2011-L2009
+L2013:
+	DB 119, 197, "s3"
+L2014:
+	DW L2016, L2014-L2016
+L2015:
+	DW L2018, L2018-L2019
+L2016:
+	DW L3625, L2018-L2020
+L2017:
+	DB 190, 195, "s7"
+L2018:
+	DB 174, 247, "s8"
+L2019:
+	DW L2023, L2017-L2019
+L2020:
+	DW L2016, L2024-L2018
+L2021:
+	DB 155, 252, "s1"
+L2022:
+	DW L2019, L2023-L2020
+L2023:
+	DB 198, 112, "s3"
+L2024:
+	DB 32, 124, "s4"
+L2025:
+	DW L2025, L2024-L2029
+L2026:
+	DB 24, 220, "s6"
+L2027:
+	DB 70, 39, "s7"
+L2028:
+	DW L2028, L2032-L2027
+L2029:
+	DW L2030, L2033-L2029
+L2030:
+	DB 93, 80, "s0"
+L2031:
+	DW L2674, L2029-L2034
+L2032:
+	DB 146, 101, "s2"
+L2033:
+	DW L2034, L2036-L2035
+L2034:
+	DW L2036, L2035-L2031
+L2035:
+	DW L343, L2035-L2036
+L2036:
+	DB 63, 199, "s6"
+L2037:
+	DW L1026, L2040-L2039
+L2038:
+	DW L2037, L2042-L2040
+L2039:
+	DW L2943, L2040-L2043
+L2040:
+	DB 5, 178, "s0"
+L2041:
+	DW L4935, L2042-L2045
+L2042:
+	DB 35, 246, "s2"
+L2043:
+	DW L2044, L2045-L2047
+L2044:
+	DB 91, 244, "s4"
+L2045:
+	DW L2041, L2042-L2045
+L2046:
+	DW L962, L2045-L2045
+L2047:
+	DB 201, 162, "s7"
+L2048:
+	DW L2045, L2045-L2044
+L2049:
+	DB 65, 147, "s9"
+L2050:
+	DW L2052, L2054-L2046
+L2051:
+	DW L2055, L2052-L2047
+L2052:
+	DB 171, 68, "s2"
+L2053:
+	DB 60, 99, "s3"
+L2054:
+	DB 112, 92, "s4"
+L2055:
+	DB 75, 25, "s5"
+L2056:
+	DB 219, 90, "s6"
+L2057:
+	DW L2053, L2057-L2053
+L2058:
+	DW L2058, L2056-L2059
+L2059:
+	DB 146, 98, "s9"
+L2060:
+	DW L2061, L2061-L2057
+L2061:
+	DW L1857, L2057-L2061
+L2062:
+	DW L2060, L2066-L2064
+L2063:
+	DW L2064, L2061-L2063
+L2064:
+	DB 1, 22, "s4"
+L2065:
+	DW L2061, L2062-L2066
+L2066:
+	DW L2062, L2065-L2064
+L2067:
+	DB 201, 61, "s7"
+L2068:
+	DW L2064, L2068-L2071
+L2069:
+	DB 162, 30, "s9"
+L2070:
+	DB 63, 27, "s0"
+L2071:
+	DB 87, 63, "s1"
+L2072:
+	DW L2119, L2068-L2076
+L2073:
+	DW L2073, L2070-L2075
+L2074:
+	DW L2070, L2070-L2078
+L2075:
+	DW L2078, L2072-L2073
+L2076:
+	DW L2079, L2073-L2073
+L2077:
+	DW L2081, L2079-L2077
+L2078:
+	DB 219, 236, "s8"
+L2079:
+	DW L2083, L2079-L2078
+L2080:
+	DW L1426, L2082-L2079
+L2081:
+	DW L2079, L2082-L2082
+L2082:
+	DB 24, 59, "s2"
+L2083:
+	DW L2081, L2079-L2084
+L2084:
+	DW L4097, L2086-L2088
+L2085:
+	DW L266, L2084-L2084
+L2086:
+	DW L2087, L2090-L2088
+L2087:
+	DB 140, 19, "s7"
+L2088:
+	DW L2087, L2084-L2087
+L2089:
+	DB 72, 171, "s9"
+L2090:
+	DB 145, 223, "s0"
+L2091:
+	DW L2088, L2087-L2090
+L2092:
+	DW L2096, L2093-L2093
+L2093:
+	DW L2097, L2089-L2089
+L2094:
+	DB 248, 135, "s4"
+L2095:
+	DW L4031, L2095-L2093
+L2096:
+	DB 92, 95, "s6"
+L2097:
+	DB 245, 33, "s7"
+L2098:
+	DW L2956, L2102-L2097
+L2099:
+	DB 83, 247, "s9"
+L2100:
+	DW L560, L2103-L2099
+L2101:
+	DW L2105, L2097-L2097
+L2102:
+	DW L2104, L2099-L2099
+L2103:
+	DB 36, 156, "s3"
+L2104:
+	DB 217, 140, "s4"
+L2105:
+	DW L2106, L2108-L2102
+L2106:
+	DB 248, 185, "s6"
+L2107:
+	DB 0, 44, "s7"
+L2108:
+	DB 90, 11, "s8"
+L2109:
+	DW L2113, L2113-L2107
+L2110:
+	DB 140, 43, "s0"
+L2111:
+	DB 192, 33, "s1"
+L2112:
+	DW L2112, L2110-L2112
+L2113:
+	DB 231, 213, "s3"
+L2114:
+	DW L2117, L2110-L2111
+L2115:
+	DW L2117, L2112-L2115
+L2116:
+	DW L2116, L2114-L2116
+L2117:
+	DB 86, 150, "s7"
+L2118:
+	DB 182, 243, "s8"
+L2119:
+	DW L483, L2115-L2123
+L2120:
+	DW L2124, L2116-L2120
+L2121:
+	DW L2122, L2120-L2124
+L2122:
+	DW L2126, L2119-L2119
+L2123:
+	DW L2120, L2124-L2124
+L2124:
+	DW L2541, L2121-L2123
+L2125:
+	DW L2121, L2126-L2121
+L2126:
+	DB 251, 235, "s6"
+L2127:
+	DW L2123, L2124-L2131
+L2128:
+	DB 46, 69, "s8"
+L2129:
+	DB 27, 16, "s9"
+L2130:
+	DB 86, 141, "s0"
+L2131:
+	DB 190, 214, "s1"
+L2132:
+	DW L2133, L2135-L2136
+L2133:
+	DB 88, 240, "s3"
+L2134:
+	DW L2134, L2138-L2138
+L2135:
+	DB 163, 194, "s5"
+L2136:
+	DW L2136, L2136-L2139
+L2137:
+	DW L2136, L2134-L2138
+L2138:
+	DW L2135, L2134-L2134
+L2139:
+	DW L2143, L2142-L2137
+L2140:
+	DW L2138, L2144-L2138
+L2141:
+	DW L2138, L2142-L2145
+L2142:
+	DB 121, 66, "s2"
+L2143:
+	DW L2145, L2147-L2144
+L2144:
+	DW L2146, L2144-L2143
+L2145:
+	DB 95, 197, "s5"
+L2146:
+	DB 192, 111, "s6"
+L2147:
+	DW L2145, L2145-L2145
+L2148:
+	DW L2149, L2146-L2145
+L2149:
+	DB 96, 69, "s9"
+L2150:
+	DW L2154, L2150-L2149
+L2151:
+	DB 199, 202, "s1"
+L2152:
+	DB 136, 199, "s2"
+L2153:
+	DW L2150, L2155-L2156
+L2154:
+	DW L2153, L2158-L2158
+L2155:
+	DB 1, 57, "s5"
+L2156:
+	DB 198, 9, "s6"
+L2157:
+	DW L2160, L2160-L2160
+L2158:
+	DB 27, 96, "s8"
+L2159:
+	DB 233, 134, "s9"
+L2160:
+	DW L2159, L2157-L2158
+L2161:
+	DW L2164, L2159-L2164
+L2162:
+	DW L500, L2159-L2162
+L2163:
+	DB 38, 110, "s3"
+L2164:
+	DB 23, 226, "s4"
+L2165:
+	DW L2169, L2162-L2165
+L2166:
+	DB 137, 172, "s6"
+L2167:
+	DB 154, 94, "s7"
+L2168:
+	DW L4895, L2168-L2168
+L2169:
+	DB 133, 3, "s9"
+L2170:
+	DB 6, 128, "s0"
+L2171:
+	DW L3794, L2168-L2173
+L2172:
+	DB 3, 103, "s2"
+L2173:
+	DB 184, 49, "s3"
+L2174:
+	DW L1514, L2178-L2178
+L2175:
+	DW L2175, L2172-L2173
+L2176:
+	DB 158, 33, "s6"
+L2177:
+	DB 132, 59, "s7"
+L2178:
+	DW L2174, L2182-L2180
+L2179:
+	DW L2176, L2182-L2176
+L2180:
+	DW L2178, L2184-L2178
+L2181:
+	DW L2182, L2185-L2182
+L2182:
+	DW L2184, L2184-L2179
+L2183:
+	DB 118, 145, "s3"
+L2184:
+	DB 17, 175, "s4"
+L2185:
+	DW L2182, L2187-L2182
+L2186:
+	DW L1628, L2185-L2187
+L2187:
+	DW L3515, L2184-L2188
+L2188:
+	DB 14, 179, "s8"
+L2189:
+	DB 246, 174, "s9"
+L2190:
+	DW L2193, L2188-L2194
+L2191:
+	DB 41, 74, "s1"
+L2192:
+	DB 68, 115, "s2"
+L2193:
+	DW L651, L2195-L2195
+L2194:
+	DW L849, L2196-L2194
+L2195:
+	DW L2192, L2196-L2199
+L2196:
+	DB 155, 120, "s6"
+L2197:
+	DB 125, 185, "s7"
+L2198:
+	DW L1253, L2201-L2198
+L2199:
+	DB 1, 151, "s9"
+L2200:
+	DW L2202, L2199-L2199
+L2201:
+	DB 139, 60, "s1"
+L2202:
+	DW L3623, L2206-L2205
+L2203:
+	DB 83, 123, "s3"
+L2204:
+	DB 21, 178, "s4"
+L2205:
+	DW L1819, L2208-L2203
+L2206:
+	DW L1266, L2206-L2207
+L2207:
+	DB 220, 237, "s7"
+L2208:
+	DB 207, 73, "s8"
+L2209:
+	DW L2212, L2210-L2208
+L2210:
+	DW L1976, L2213-L2213
+L2211:
+	DW L3838, L2211-L2215
+L2212:
+	DW L2213, L2211-L2215
+L2213:
+	DW L2213, L2215-L2210
+L2214:
+	DW L2212, L2217-L2210
+L2215:
+	DW L2214, L2218-L2211
+L2216:
+	DW L2215, L2214-L2213
+L2217:
+	DB 170, 236, "s7"
+L2218:
+	DW L2219, L2214-L2217
+L2219:
+	DW L2223, L2217-L2221
+L2220:
+	DW L2906, L2218-L2221
+L2221:
+	DW L2223, L2217-L2219
+L2222:
+	DB 144, 95, "s2"
+L2223:
+	DB 202, 39, "s3"
+L2224:
+	DW L2220, L2221-L2227
+L2225:
+	DB 135, 54, "s5"
+L2226:
+	DW L2840, L2227-L2229
+L2227:
+	DW L2230, L2226-L2223
+L2228:
+	DW L3214, L2230-L2225
+L2229:
+	DB 128, 132, "s9"
+L2230:
+	DW L2233, L2234-L2229
+L2231:
+	DW L31, L2231-L2235
+L2232:
+	DB 86, 90, "s2"
+L2233:
+	DB 53, 127, "s3"
+L2234:
+	DW L3701, L2235-L2235
+L2235:
+	DW L2234, L2234-L2235
+L2236:
+	DW L2240, L2240-L2233
+L2237:
+	DB 234, 208, "s7"
+L2238:
+	DB 78, 86, "s8"
+L2239:
+	DW L3092, L2237-L2240
+L2240:
+	DB 249, 89, "s0"
+L2241:
+	DB 227, 71, "s1"
+L2242:
+	DB 132, 69, "s2"
+L2243:
+	DW L2239, L2243-L2240
+L2244:
+	DB 17, 223, "s4"
+L2245:
+	DW L2246, L2246-L2246
+L2246:
+	DW L352, L2244-L2242
+L2247:
+	DW L2243, L2251-L2250
+L2248:
+	DB 163, 187, "s8"
+L2249:
+	DW L2245, L2248-L2250
+L2250:
+	DW L2254, L2250-L2251
+L2251:
+	DW L2255, L2253-L2247
+L2252:
+	DW L2256, L2249-L2255
+L2253:
+	DW L2060, L2251-L2257
+L2254:
+	DW L2252, L2251-L2250
+L2255:
+	DB 178, 74, "s5"
+L2256:
+	DW L2259, L2257-L2254
+L2257:
+	DB 0, 206, "s7"
+L2258:
+	DB 216, 80, "s8"
+L2259:
+	DW L2255, L2256-L2257
+L2260:
+	DB 155, 170, "s0"
+L2261:
+	DW L2264, L2259-L2261
+L2262:
+	DW L2265, L2262-L2259
+L2263:
+	DB 118, 232, "s3"
+L2264:
+	DB 110, 102, "s4"
+L2265:
+	DB 172, 241, "s5"
+L2266:
+	DB 154, 78, "s6"
+L2267:
+	DB 175, 109, "s7"
+L2268:
+	DB 181, 127, "s8"
+L2269:
+	DW L991, L2273-L2271
+L2270:
+	DW L2273, L2266-L2270
+L2271:
+	DW L2267, L2274-L2274
+L2272:
+	DB 235, 86, "s2"
+L2273:
+	DW L2276, L2269-L2270
+L2274:
+	DW L2278, L2270-L2273
+L2275:
+	DW L2271, L2272-L2279
+L2276:
+	DB 35, 81, "s6"
+L2277:
+	DW L2280, L2278-L2279
+L2278:
+	DB 216, 185, "s8"
+L2279:
+	DB 51, 221, "s9"
+L2280:
+	DB 9, 142, "s0"
+L2281:
+	DW L2282, L2285-L2277
+L2282:
+	DW L82, L2279-L2282
+L2283:
+	DW L2285, L2280-L2287
+L2284:
+	DB 3, 230, "s4"
+L2285:
+	DW L2285, L2282-L2286
+L2286:
+	DB 179, 108, "s6"
+L2287:
+	DW L2283, L2290-L2284
+L2288:
+	DW L2290, L2290-L2291
+L2289:
+	DB 132, 106, "s9"
+L2290:
+	DB 83, 155, "s0"
+L2291:
+	DB 106, 187, "s1"
+L2292:
+	DB 60, 202, "s2"
+L2293:
+	DW L2290, L2291-L2295
+L2294:
+	DW L2298, L2291-L2292
+L2295:
+	DB 86, 213, "s5"
+L2296:
+	DB 119, 116, "s6"
+L2297:
+	DW L4815, L2296-L2294
+L2298:
+	DW L2300, L2296-L2298
+L2299:
+	DW L2177, L2299-L2301
+L2300:
+	DW L2299, L2298-L2303
+L2301:
+	DB 39, 99, "s1"
+L2302:
+	DB 181, 91, "s2"
+L2303:
+	DW L185, L2301-L2304
+L2304:
+	DB 197, 159, "s4"
+L2305:
+	DB 22, 55, "s5"
+L2306:
+	DW L2309, L2310-L2303
+L2307:
+	DW L3015, L2308-L2306
+L2308:
+	DW L2307, L2306-L2304
+L2309:
+	DB 235, 192, "s9"
+L2310:
+	DW L3051, L2308-L2311
+L2311:
+	DB 217, 64, "s1"
+L2312:
+	DW L2315, L2310-L2316
+L2313:
+	DB 126, 135, "s3"
+L2314:
+	DW L3985, L2310-L2317
+L2315:
+	DB 197, 71, "s5"
+L2316:
+	DB 211, 189, "s6"
+L2317:
+	DB 97, 150, "s7"
+L2318:
+	DW L2316, L2318-L2319
+L2319:
+	DB 153, 108, "s9"
+L2320:
+	DW L2323, L2319-L2323
+L2321:
+	DW L835, L2319-L2319
+L2322:
+	DW L2321, L2324-L2325
+L2323:
+	DB 11, 186, "s3"
+L2324:
+	DW L2326, L2328-L2326
+L2325:
+	DB 182, 103, "s5"
+L2326:
+	DB 97, 94, "s6"
+L2327:
+	DW L2327, L2329-L2324
+L2328:
+	DB 218, 194, "s8"
+L2329:
+	DB 1, 62, "s9"
+L2330:
+	DB 206, 10, "s0"
+L2331:
+	DW L2471, L2328-L2333
+L2332:
+	DB 98, 160, "s2"
+L2333:
+	DW L2336, L2337-L2329
+L2334:
+	DB 108, 211, "s4"
+L2335:
+	DW L1626, L2332-L2332
+L2336:
+	DW L2336, L2338-L2333
+L2337:
+	DW L2341, L2341-L2341
+L2338:
+	DW L2334, L2338-L2339
+L2339:
+	DW L2340, L2339-L2342
+L2340:
+	DW L2344, L2343-L2338
+L2341:
+	DW L2337, L2337-L2340
+L2342:
+	DB 156, 59, "s2"
+L2343:
+	DB 228, 127, "s3"
+L2344:
+	DB 40, 183, "s4"
+L2345:
+	DW L2349, L2347-L2343
+L2346:
+	DW L2344, L2348-L2350
+L2347:
+	DW L2344, L2349-L2347
+L2348:
+	DW L2350, L2344-L2347
+L2349:
+	DW L2757, L2346-L2347
+L2350:
+	DB 167, 144, "s0"
+L2351:
+	DB 11, 170, "s1"
+L2352:
+	DW L2350, L2353-L2355
+L2353:
+	DW L2355, L2350-L2354
+L2354:
+	DW L2354, L2352-L2357
+L2355:
+	DW L2356, L2351-L2352
+L2356:
+	DW L2352, L2354-L2355
+L2357:
+	DW L3823, L2360-L2359
+L2358:
+	DB 19, 61, "s8"
+L2359:
+	DW L2361, L2358-L2357
+L2360:
+	DW L2362, L2363-L2362
+L2361:
+	DW L2365, L2359-L2364
+L2362:
+	DW L1654, L2360-L2366
+L2363:
+	DB 219, 217, "s3"
+L2364:
+	DW L2367, L2360-L2366
+L2365:
+	DB 216, 146, "s5"
+L2366:
+	DW L2367, L2367-L2366
+L2367:
+	DW L443, L2369-L2365
+L2368:
+	DB 233, 123, "s8"
+L2369:
+	DB 108, 56, "s9"
+L2370:
+	DW L4215, L2369-L2369
+L2371:
+	DW L2367, L2371-L2372
+L2372:
+	DW L2372, L2372-L2371
+L2373:
+	DB 6, 60, "s3"
+L2374:
+	DW L2377, L2371-L2376
+L2375:
+	DB 10, 141, "s5"
+L2376:
+	DB 206, 154, "s6"
+L2377:
+	DW L2380, L2375-L2374
+L2378:
+	DW L2375, L2374-L2375
+L2379:
+	DB 77, 57, "s9"
+L2380:
+	DB 149, 106, "s0"
+L2381:
+	DW L2379, L2382-L2377
+L2382:
+	DB 143, 161, "s2"
+L2383:
+	DB 71, 255, "s3"
+L2384:
+	DB 88, 168, "s4"
+L2385:
+	DW L3428, L2389-L2385
+L2386:
+	DB 85, 251, "s6"
+L2387:
+	DW L2384, L2383-L2388
+L2388:
+	DW L2384, L2386-L2388
+L2389:
+	DW L2392, L2388-L2392
+L2390:
+	DW L2389, L2394-L2391
+L2391:
+	DW L1456, L2394-L2393
+L2392:
+	DB 120, 206, "s2"
+L2393:
+	DB 23, 193, "s3"
+L2394:
+	DW L2392, L2393-L2390
+L2395:
+	DW L2567, L2393-L2399
+L2396:
+	DW L2400, L2395-L2393
+L2397:
+	DB 138, 226, "s7"
+L2398:
+	DW L2398, L2395-L2396
+L2399:
+	DW L2401, L2397-L2396
+L2400:
+	DW L2399, L2398-L2404
+L2401:
+	DB 210, 74, "s1"
+L2402:
+	DB 59, 81, "s2"
+L2403:
+	DW L2227, L2403-L2399
+L2404:
+	DB 22, 92, "s4"
+L2405:
+	DB 30, 4, "s5"
+L2406:
+	DB 171, 44, "s6"
+L2407:
+	DB 169, 64, "s7"
+L2408:
+	DW L2405, L2412-L2410
+L2409:
+	DB 252, 175, "s9"
+L2410:
+	DW L4914, L2410-L2414
+L2411:
+	DW L2415, L2415-L2413
+L2412:
+	DW L3042, L2410-L2409
+L2413:
+	DW L4329, L2411-L2410
+L2414:
+	DW L2411, L2412-L2418
+L2415:
+	DW L2419, L2412-L2419
+L2416:
+	DW L2414, L2419-L2418
+L2417:
+	DW L2413, L2419-L2419
+L2418:
+	DW L2416, L2417-L2421
+L2419:
+	DW L2422, L2418-L2417
+L2420:
+	DB 233, 2, "s0"
+L2421:
+	DW L2423, L2419-L2420
+L2422:
+	DB 198, 231, "s2"
+L2423:
+	DB 206, 208, "s3"
+L2424:
+	DB 38, 40, "s4"
+L2425:
+	DW L2422, L2428-L2426
+L2426:
+	DB 61, 76, "s6"
+L2427:
+	DW L2428, L2430-L2426
+L2428:
+	DW L2432, L2427-L2431
+L2429:
+	DW L2429, L2426-L2432
+L2430:
+	DW L3815, L2433-L2428
+L2431:
+	DW L2430, L2430-L2435
+L2432:
+	DB 103, 78, "s2"
+L2433:
+	DB 29, 117, "s3"
+L2434:
+	DW L2434, L2431-L2434
+L2435:
+	DW L2437, L2437-L2434
+L2436:
+	DW L2432, L2439-L2439
+L2437:
+	DW L1892, L2435-L2433
+L2438:
+	DB 233, 61, "s8"
+L2439:
+	DW L2313, L2440-L2443
+L2440:
+	DW L2440, L2444-L2444
+L2441:
+	DB 245, 165, "s1"
+L2442:
+	DB 225, 108, "s2"
+L2443:
+	DW L2439, L2442-L2440
+L2444:
+	DW L2444, L2447-L2445
+L2445:
+	DW L652, L2442-L2441
+L2446:
+	DW L2445, L2445-L2442
+L2447:
+	DW L2451, L2447-L2445
+L2448:
+	DB 143, 112, "s8"
+L2449:
+	DW L4542, L2445-L2452
+L2450:
+	DB 72, 203, "s0"
+L2451:
+	DB 76, 20, "s1"
+L2452:
+	DW L2456, L2454-L2452
+L2453:
+	DB 7, 74, "s3"
+L2454:
+	DW L2450, L2451-L2450
+L2455:
+	DW L2456, L2458-L2456
+L2456:
+	DB 10, 237, "s6"
+L2457:
+	DB 56, 73, "s7"
+L2458:
+	DW L2997, L2461-L2454
+L2459:
+	DB 6, 198, "s9"
+L2460:
+	DB 118, 174, "s0"
+L2461:
+	DB 65, 83, "s1"
+L2462:
+	DW L2458, L2465-L2461
+L2463:
+	DW L2462, L2464-L2465
+L2464:
+	DW L2468, L2461-L2467
+L2465:
+	DW L2462, L2461-L2462
+L2466:
+	DB 5, 171, "s6"
+L2467:
+	DB 129, 77, "s7"
+L2468:
+	DB 255, 163, "s8"
+L2469:
+	DW L2471, L2473-L2471
+L2470:
+	DB 41, 221, "s0"
+L2471:
+	DW L4098, L2472-L2474
+L2472:
+	DW L2468, L2474-L2475
+L2473:
+	DW L2476, L2471-L2473
+L2474:
+	DW L2475, L2477-L2478
+L2475:
+	DB 60, 52, "s5"
+L2476:
+	DB 193, 200, "s6"
+L2477:
+	DW L2481, L2475-L2481
+L2478:
+	DW L2481, L2479-L2480
+L2479:
+	DB 74, 242, "s9"
+L2480:
+	DW L4391, L2476-L2484
+L2481:
+	DW L2477, L2481-L2484
+L2482:
+	DW L2485, L2484-L2486
+L2483:
+	DW L2244, L2486-L2485
+L2484:
+	DW L2484, L2488-L2482
+L2485:
+	DB 187, 241, "s5"
+L2486:
+	DW L2483, L2484-L2482
+L2487:
+	DW L2486, L2491-L2489
+L2488:
+	DB 106, 175, "s8"
+L2489:
+	DB 184, 12, "s9"
+L2490:
+	DW L2486, L2491-L2486
+L2491:
+	DW L2495, L2491-L2495
+L2492:
+	DB 235, 197, "s2"
+L2493:
+	DW L2490, L2494-L2495
+L2494:
+	DW L2491, L2490-L2493
+L2495:
+	DW L4403, L2491-L2498
+L2496:
+	DB 178, 70, "s6"
+L2497:
+	DB 215, 123, "s7"
+L2498:
+	DW L2496, L2502-L2502
+L2499:
+	DW L2499, L2502-L2496
+L2500:
+	DB 94, 186, "s0"
+L2501:
+	DW L2498, L2503-L2505
+L2502:
+	DW L3734, L2506-L2506
+L2503:
+	DB 81, 189, "s3"
+L2504:
+	DB 60, 56, "s4"
+L2505:
+	DW L2507, L2503-L2509
+L2506:
+	DW L193, L2509-L2505
+L2507:
+	DW L1023, L2506-L2507
+L2508:
+	DB 234, 1, "s8"
+L2509:
+	DB 198, 51, "s9"
+L2510:
+	DB 21, 93, "s0"
+L2511:
+	DB 57, 30, "s1"
+L2512:
+	DB 13, 222, "s2"
+L2513:
+	DB 141, 12, "s3"
+L2514:
+	DW L2518, L2516-L2514
+L2515:
+	DB 146, 209, "s5"
+L2516:
+	DW L2520, L2512-L2513
+L2517:
+	DB 42, 149, "s7"
+L2518:
+	DW L2221, L2518-L2517
+L2519:
+	DW L2522, L2521-L2515
+L2520:
+	DB 246, 198, "s0"
+L2521:
+	DB 142, 246, "s1"
+L2522:
+	DW L2526, L2524-L2520
+L2523:
+	DW L2784, L2519-L2527
+L2524:
+	DW L3507, L2521-L2524
+L2525:
+	DW L2527, L2522-L2527
+L2526:
+	DW L2529, L2522-L2526
+L2527:
+	DB 159, 98, "s7"
+L2528:
+	DB 22, 143, "s8"
+L2529:
+	DW L1341, L2531-L2525
+L2530:
+	DW L2534, L2527-L2528
+L2531:
+	DB 23, 167, "s1"
+L2532:
+	DB 4, 16, "s2"
+L2533:
+	DB 75, 97, "s3"
+L2534:
+	DW L2532, L2532-L2538
+L2535:
+	DB 191, 176, "s5"
+L2536:
+	DB 66, 63, "s6"
+L2537:
+	DB 196, 38, "s7"
+L2538:
+	DB 26, 245, "s8"
+L2539:
+	DW L4525, L2539-L2539
+L2540:
+	DB 120, 209, "s0"
+L2541:
+	DW L4165, L2541-L2543
+L2542:
+	DB 2, 80, "s2"
+L2543:
+	DB 155, 13, "s3"
+L2544:
+	DW L2545, L2547-L2547
+L2545:
+	DW L2545, L2549-L2549
+L2546:
+	DB 155, 52, "s6"
+L2547:
+	DW L2546, L2549-L2550
+L2548:
+	DW L2549, L2546-L2544
+L2549:
+	DW L1745, L2547-L2552
+L2550:
+	DW L3239, L2552-L2550
+L2551:
+	DB 226, 100, "s1"
+L2552:
+	DB 178, 237, "s2"
+L2553:
+	DB 109, 80, "s3"
+L2554:
+	DB 248, 178, "s4"
+L2555:
+	DW L2556, L2557-L2554
+L2556:
+	DB 194, 143, "s6"
+L2557:
+	DW L2553, L2553-L2555
+L2558:
+	DW L2562, L2556-L2557
+L2559:
+	DW L3219, L2558-L2561
+L2560:
+	DB 0, 96, "s0"
+L2561:
+	DW L2563, L2558-L2562
+L2562:
+	DB 46, 1, "s2"
+L2563:
+	DW L2560, L2567-L2566
+L2564:
+	DW L2563, L2568-L2567
+L2565:
+	DW L2562, L2567-L2566
+L2566:
+	DW L2565, L2562-L2567
+L2567:
+	DW L4792, L2567-L2564
+L2568:
+	DW L2569, L2564-L2564
+L2569:
+	DW L2573, L2572-L2566
+L2570:
+	DW L2569, L2571-L2572
+L2571:
+	DW L2569, L2574-L2570
+L2572:
+	DW L2570, L2574-L2569
+L2573:
+	DB 180, 13, "s3"
+L2574:
+	DW L2575, L2572-L2577
+L2575:
+	DB 127, 1, "s5"
+L2576:
+	DB 191, 220, "s6"
+L2577:
+	DB 130, 58, "s7"
+L2578:
+	DB 166, 4, "s8"
+L2579:
+	DW L2582, L2576-L2577
+L2580:
+	DW L2580, L2581-L2580
+L2581:
+	DW L2580, L2584-L2581
+L2582:
+	DW L2585, L2586-L2583
+L2583:
+	DW L3327, L2587-L2583
+L2584:
+	DW L2586, L2580-L2581
+L2585:
+	DB 116, 62, "s5"
+L2586:
+	DB 71, 250, "s6"
+L2587:
+	DB 162, 180, "s7"
+L2588:
+	DB 101, 251, "s8"
+L2589:
+	DW L2588, L2590-L2591
+L2590:
+	DB 203, 189, "s0"
+L2591:
+	DW L2592, L2595-L2588
+L2592:
+	DW L2595, L2593-L2595
+L2593:
+	DB 179, 70, "s3"
+L2594:
+	DB 68, 162, "s4"
+L2595:
+	DW L2599, L2597-L2591
+L2596:
+	DW L2949, L2594-L2598
+L2597:
+	DW L2595, L2597-L2601
+L2598:
+	DW L2279, L2594-L2594
+L2599:
+	DB 65, 132, "s9"
+L2600:
+	DW L1632, L2601-L2599
+L2601:
+	DB 181, 165, "s1"
+L2602:
+	DW L4757, L2603-L2599
+L2603:
+	DW L2599, L2605-L2606
+L2604:
+	DB 132, 180, "s4"
+L2605:
+	DB 36, 21, "s5"
+L2606:
+	DB 242, 245, "s6"
+L2607:
+	DW L2605, L2603-L2610
+L2608:
+	DW L2607, L2612-L2608
+L2609:
+	DB 242, 13, "s9"
+L2610:
+	DW L2850, L2610-L2610
+L2611:
+	DB 19, 152, "s1"
+L2612:
+	DW L2611, L2616-L2609
+L2613:
+	DW L2609, L2617-L2614
+L2614:
+	DW L4461, L2613-L2614
+L2615:
+	DW L2614, L2614-L2617
+L2616:
+	DW L1094, L2614-L2619
+L2617:
+	DB 97, 100, "s7"
+L2618:
+	DW L2616, L2620-L2618
+L2619:
+	DB 181, 237, "s9"
+L2620:
+	DW L3615, L2618-L2620
+L2621:
+	DW L2617, L2621-L2619
+L2622:
+	DW L2619, L2624-L2626
+L2623:
+	DW L2625, L2625-L2623
+L2624:
+	DW L3485, L2621-L2627
+L2625:
+	DB 106, 61, "s5"
+L2626:
+	DB 252, 68, "s6"
+L2627:
+	DW L2624, L2630-L2624
+L2628:
+	DB 158, 55, "s8"
+L2629:
+	DW L2630, L2629-L2628
+L2630:
+	DW L2630, L2630-L2626
+L2631:
+	DB 214, 79, "s1"
+L2632:
+	DW L2632, L2635-L2636
+L2633:
+	DW L2633, L2635-L2637
+L2634:
+	DB 7, 104, "s4"
+L2635:
+	DB 58, 219, "s5"
+L2636:
+	DB 135, 198, "s6"
+L2637:
+	DW L814, L2637-L2636
+L2638:
+	DW L2635, L2635-L2641
+L2639:
+	DB 182, 62, "s9"
+L2640:
+	DW L2641, L2640-L2637
+L2641:
+	DW L2639, L2645-L2645
+L2642:
+	DB 90, 111, "s2"
+L2643:
+	DB 232, 108, "s3"
+L2644:
+	DB 41, 99, "s4"
+L2645:
+	DB 120, 215, "s5"
+L2646:
+	DB 238, 246, "s6"
+L2647:
+	DW L2643, L2646-L2643
+L2648:
+	DB 158, 212, "s8"
+L2649:
+	DB 193, 153, "s9"
+L2650:
+	DB 48, 123, "s0"
+L2651:
+	DB 145, 177, "s1"
+L2652:
+	DW L2655, L2652-L2650
+L2653:
+	DB 249, 91, "s3"
+L2654:
+	DB 201, 249, "s4"
+L2655:
+	DW L1669, L2651-L2653
+L2656:
+	DW L4548, L2655-L2657
+L2657:
+	DW L2653, L2656-L2654
+L2658:
+	DW L231, L2656-L2662
+L2659:
+	DW L2658, L2659-L2658
+L2660:
+	DB 91, 148, "s0"
+L2661:
+	DW L2663, L2659-L2662
+L2662:
+	DW L2603, L2658-L2666
+L2663:
+	DB 181, 202, "s3"
+L2664:
+	DB 91, 53, "s4"
+L2665:
+	DB 203, 20, "s5"
+L2666:
+	DW L4979, L2670-L2668
+L2667:
+	DW L2669, L2663-L2664
+L2668:
+	DB 164, 18, "s8"
+L2669:
+	DW L2672, L2669-L2668
+L2670:
+	DB 28, 20, "s0"
+L2671:
+	DB 132, 59, "s1"
+L2672:
+	DB 238, 109, "s2"
+L2673:
+	DB 19, 152, "s3"
+L2674:
+	DB 216, 13, "s4"
+L2675:
+	DW L4628, L2675-L2674
+L2676:
+	DB 115, 187, "s6"
+L2677:
+	DB 48, 141, "s7"
+L2678:
+	DB 239, 19, "s8"
+L2679:
+	DW L2678, L2680-L2679
+L2680:
+	DB 26, 99, "s0"
+L2681:
+	DW L2677, L2685-L2680
+L2682:
+	DB 164, 243, "s2"
+L2683:
+	DB 114, 88, "s3"
+L2684:
+	DB 2, 250, "s4"
+L2685:
+	DB 36, 40, "s5"
+L2686:
+	DW L4302, L2685-L2690
+L2687:
+	DW L4471, L2688-L2691
+L2688:
+	DB 246, 91, "s8"
+L2689:
+	DB 75, 138, "s9"
+L2690:
+	DW L2693, L2692-L2688
+L2691:
+	DB 219, 20, "s1"
+L2692:
+	DB 244, 196, "s2"
+L2693:
+	DW L2695, L2689-L2690
+L2694:
+	DW L2498, L2697-L2690
+L2695:
+	DB 141, 159, "s5"
+L2696:
+	DB 237, 231, "s6"
+L2697:
+	DW L2694, L2698-L2701
+L2698:
+	DW L2696, L2698-L2702
+L2699:
+	DW L2703, L2697-L2701
+L2700:
+	DB 45, 118, "s0"
+L2701:
+	DB 83, 209, "s1"
+L2702:
+	DB 81, 44, "s2"
+L2703:
+	DB 138, 54, "s3"
+L2704:
+	DW L2708, L2706-L2703
+L2705:
+	DB 161, 160, "s5"
+L2706:
+	DB 248, 117, "s6"
+L2707:
+	DB 10, 67, "s7"
+L2708:
+	DB 34, 73, "s8"
+L2709:
+	DW L2707, L2707-L2713
+L2710:
+	DW L2707, L2706-L2708
+L2711:
+	DB 43, 169, "s1"
+L2712:
+	DW L857, L2708-L2710
+L2713:
+	DB 88, 233, "s3"
+L2714:
+	DW L2713, L2718-L2712
+L2715:
+	DW L2714, L2717-L2716
+L2716:
+	DW L3869, L2716-L2712
+L2717:
+	DB 231, 128, "s7"
+L2718:
+	DW L2716, L2715-L2720
+L2719:
+	DW L2717, L2723-L2717
+L2720:
+	DW L2722, L2717-L2718
+L2721:
+	DW L2719, L2720-L2720
+L2722:
+	DB 122, 153, "s2"
+L2723:
+	DW L2726, L2725-L2723
+L2724:
+	DB 101, 225, "s4"
+L2725:
+	DW L2726, L2729-L2729
+L2726:
+	DW L2245, L2722-L2730
+L2727:
+	DW L2725, L2723-L2729
+L2728:
+	DW L2726, L2727-L2731
+L2729:
+	DB 242, 221, "s9"
+L2730:
+	DW L4151, L2730-L2726
+L2731:
+	DB 165, 170, "s1"
+L2732:
+	DW L4210, L2728-L2732
+L2733:
+	DB 163, 249, "s3"
+L2734:
+	DW L2736, L2738-L2736
+L2735:
+	DB 127, 148, "s5"
+L2736:
+	DW L884, L2734-L2732
+L2737:
+	DB 39, 188, "s7"
+L2738:
+	DW L2736, L2734-L2739
+L2739:
+	DB 97, 46, "s9"
+L2740:
+	DB 35, 54, "s0"
+L2741:
+	DB 74, 36, "s1"
+L2742:
+	DW L2598, L2739-L2738
+L2743:
+	DW L2739, L2746-L2739
+L2744:
+	DW L2740, L2743-L2747
+L2745:
+	DW L4355, L2744-L2746
+L2746:
+	DB 3, 204, "s6"
+L2747:
+	DB 158, 52, "s7"
+L2748:
+	DW L2749, L2744-L2744
+L2749:
+	DW L2750, L2749-L2750
+L2750:
+	DB 242, 59, "s0"
+L2751:
+	DW L1854, L2750-L2753
+L2752:
+	DB 99, 106, "s2"
+L2753:
+	DB 154, 138, "s3"
+L2754:
+	DW L737, L2757-L2751
+L2755:
+	DW L2752, L2755-L2751
+L2756:
+	DW L2759, L2758-L2752
+L2757:
+	DB 191, 11, "s7"
+L2758:
+	DW L2755, L2762-L2760
+L2759:
+	DB 236, 121, "s9"
+L2760:
+	DW L1407, L2757-L2758
+L2761:
+	DB 48, 72, "s1"
+L2762:
+	DB 176, 57, "s2"
+L2763:
+	DW L609, L2759-L2759
+L2764:
+	DB 144, 74, "s4"
+L2765:
+	DB 124, 76, "s5"
+L2766:
+	DW L1614, L2765-L2769
+L2767:
+	DW L3999, L2769-L2768
+L2768:
+	DW L2767, L2764-L2766
+L2769:
+	DB 113, 35, "s9"
+L2770:
+	DW L2769, L2770-L2768
+L2771:
+	DW L1653, L2772-L2773
+L2772:
+	DB 89, 59, "s2"
+L2773:
+	DB 81, 56, "s3"
+L2774:
+	DW L4431, L2776-L2777
+L2775:
+	DW L2778, L2773-L2776
+L2776:
+	DW L2779, L2776-L2776
+L2777:
+	DW L3047, L2775-L2781
+L2778:
+	DW L1999, L2779-L2774
+L2779:
+	DB 147, 101, "s9"
+L2780:
+	DB 4, 71, "s0"
+L2781:
+	DW L2784, L2779-L2777
+L2782:
+	DB 245, 239, "s2"
+L2783:
+	DW L2780, L2781-L2787
+L2784:
+	DW L2785, L2781-L2782
+L2785:
+	DB 2, 131, "s5"
+L2786:
+	DW L2786, L2789-L2783
+L2787:
+	DB 191, 215, "s7"
+L2788:
+	DW L2791, L2785-L2784
+L2789:
+	DW L2791, L2793-L2788
+L2790:
+	DW L2792, L2786-L2791
+L2791:
+	DW L4716, L2792-L2789
+L2792:
+	DB 142, 12, "s2"
+L2793:
+	DB 243, 161, "s3"
+L2794:
+	DB 35, 112, "s4"
+L2795:
+	DW L2798, L2795-L2794
+L2796:
+	DW L2794, L2799-L2792
+L2797:
+	DB 202, 139, "s7"
+L2798:
+	DW L71, L2795-L2800
+L2799:
+	DW L4665, L2801-L2802
+L2800:
+	DB 206, 254, "s0"
+L2801:
+	DB 23, 240, "s1"
+L2802:
+	DW L2806, L2799-L2805
+L2803:
+	DW L4829, L2801-L2799
+L2804:
+	DB 120, 92, "s4"
+L2805:
+	DB 101, 96, "s5"
+L2806:
+	DW L2806, L2805-L2802
+L2807:
+	DB 67, 244, "s7"
+L2808:
+	DW L2812, L2808-L2806
+L2809:
+	DB 20, 121, "s9"
+L2810:
+	DB 140, 147, "s0"
+L2811:
+	DB 213, 49, "s1"
+L2812:
+	DB 156, 149, "s2"
+L2813:
+	DW L2812, L2817-L2814
+L2814:
+	DB 92, 45, "s4"
+L2815:
+	DW L3478, L2813-L2819
+L2816:
+	DW L2813, L2815-L2820
+L2817:
+	DB 231, 49, "s7"
+L2818:
+	DB 70, 53, "s8"
+L2819:
+	DB 187, 19, "s9"
+L2820:
+	DW L2819, L2817-L2816
+L2821:
+	DB 66, 150, "s1"
+L2822:
+	DB 198, 123, "s2"
+L2823:
+	DW L3437, L2824-L2819
+L2824:
+	DB 39, 101, "s4"
+L2825:
+	DW L2823, L2829-L2829
+L2826:
+	DB 179, 157, "s6"
+L2827:
+	DW L2823, L2831-L2823
+L2828:
+	DB 6, 79, "s8"
+L2829:
+	DB 156, 54, "s9"
+L2830:
+	DW L2829, L2826-L2831
+L2831:
+	DW L3632, L2834-L2832
+L2832:
+	DB 77, 193, "s2"
+L2833:
+	DW L2833, L2831-L2832
+L2834:
+	DB 74, 45, "s4"
+L2835:
+	DB 123, 218, "s5"
+L2836:
+	DB 112, 21, "s6"
+L2837:
+	DW L2833, L2836-L2841
+L2838:
+	DW L2838, L2842-L2837
+L2839:
+	DB 169, 70, "s9"
+L2840:
+	DB 226, 107, "s0"
+L2841:
+	DB 244, 139, "s1"
+L2842:
+	DB 11, 231, "s2"
+L2843:
+	DW L79, L2847-L2841
+L2844:
+	DB 145, 170, "s4"
+L2845:
+	DB 47, 13, "s5"
+L2846:
+	DW L2842, L2845-L2850
+L2847:
+	DW L2846, L2845-L2847
+L2848:
+	DW L2850, L2845-L2844
+L2849:
+	DW L2846, L2850-L2846
+L2850:
+	DB 45, 177, "s0"
+L2851:
+	DB 115, 232, "s1"
+L2852:
+	DB 60, 8, "s2"
+L2853:
+	DW L2850, L2852-L2857
+L2854:
+	DB 177, 108, "s4"
+L2855:
+	DB 132, 28, "s5"
+L2856:
+	DW L2860, L2857-L2856
+L2857:
+	DB 146, 145, "s7"
+L2858:
+	DW L2861, L2862-L2862
+L2859:
+	DB 250, 156, "s9"
+L2860:
+	DW L2860, L2864-L2862
+L2861:
+	DB 236, 221, "s1"
+L2862:
+	DW L2865, L2859-L2862
+L2863:
+	DB 219, 239, "s3"
+L2864:
+	DW L2866, L2861-L2865
+L2865:
+	DW L2861, L2863-L2868
+L2866:
+	DB 41, 186, "s6"
+L2867:
+	DB 6, 158, "s7"
+L2868:
+	DW L2870, L2868-L2871
+L2869:
+	DW L547, L2867-L2873
+L2870:
+	DB 196, 29, "s0"
+L2871:
+	DW L2872, L2874-L2867
+L2872:
+	DB 34, 160, "s2"
+L2873:
+	DW L2870, L2872-L2870
+L2874:
+	DB 103, 154, "s4"
+L2875:
+	DW L2874, L2877-L2875
+L2876:
+	DW L82, L2880-L2880
+L2877:
+	DW L2879, L2878-L2879
+L2878:
+	DB 187, 97, "s8"
+L2879:
+	DB 84, 185, "s9"
+L2880:
+	DB 230, 39, "s0"
+L2881:
+	DB 119, 80, "s1"
+L2882:
+	DB 36, 83, "s2"
+L2883:
+	DB 94, 202, "s3"
+L2884:
+	DW L4195, L2887-L2887
+L2885:
+	DW L2889, L2888-L2888
+L2886:
+	DW L2882, L2890-L2889
+L2887:
+	DB 25, 120, "s7"
+L2888:
+	DW L2891, L2884-L2890
+L2889:
+	DB 133, 52, "s9"
+L2890:
+	DW L2892, L2893-L2888
+L2891:
+	DB 133, 252, "s1"
+L2892:
+	DW L2896, L2888-L2894
+L2893:
+	DB 251, 219, "s3"
+L2894:
+	DB 90, 206, "s4"
+L2895:
+	DW L2894, L2899-L2897
+L2896:
+	DB 251, 222, "s6"
+L2897:
+	DB 52, 0, "s7"
+L2898:
+	DW L2899, L2896-L2900
+L2899:
+	DB 227, 21, "s9"
+L2900:
+	DW L511, L2899-L2898
+L2901:
+	DW L2899, L2905-L2900
+L2902:
+	DB 140, 83, "s2"
+L2903:
+	DB 61, 168, "s3"
+L2904:
+	DW L2902, L2904-L2900
+L2905:
+	DW L4408, L2904-L2904
+L2906:
+	DB 38, 21, "s6"
+L2907:
+	DW L2907, L2911-L2906
+L2908:
+	DW L4534, L2904-L2912
+L2909:
+	DB 84, 176, "s9"
+L2910:
+	DB 53, 52, "s0"
+L2911:
+	DW L2910, L2915-L2914
+L2912:
+	DW L2915, L2912-L2909
+L2913:
+	DB 137, 158, "s3"
+L2914:
+	DW L2910, L2910-L2914
+L2915:
+	DB 198, 242, "s5"
+L2916:
+	DB 79, 43, "s6"
+L2917:
+	DW L2920, L2918-L2920
+L2918:
+	DB 167, 5, "s8"
+L2919:
+	DB 52, 190, "s9"
+L2920:
+	DW L4368, L2922-L2918
+L2921:
+	DW L2917, L2917-L2925
+L2922:
+	DW L2921, L2925-L2923
+L2923:
+	DW L3159, L2923-L2924
+L2924:
+	DW L2557, L2928-L2928
+L2925:
+	DW L2921, L2929-L2926
+L2926:
+	DW L2928, L2926-L2925
+L2927:
+	DB 6, 42, "s7"
+L2928:
+	DB 24, 173, "s8"
+L2929:
+	DB 160, 16, "s9"
+L2930:
+	DB 145, 156, "s0"
+L2931:
+	DB 123, 168, "s1"
+L2932:
+	DW L2936, L2930-L2935
+L2933:
+	DW L1733, L2936-L2934
+L2934:
+	DB 23, 97, "s4"
+L2935:
+	DW L2935, L2933-L2938
+L2936:
+	DB 207, 243, "s6"
+L2937:
+	DW L3946, L2934-L2936
+L2938:
+	DW L2304, L2935-L2935
+L2939:
+	DB 49, 21, "s9"
+L2940:
+	DB 148, 160, "s0"
+L2941:
+	DW L2943, L2938-L2939
+L2942:
+	DB 104, 201, "s2"
+L2943:
+	DB 185, 23, "s3"
+L2944:
+	DW L2948, L2946-L2945
+L2945:
+	DW L1021, L2944-L2942
+L2946:
+	DW L2943, L2946-L2943
+L2947:
+	DW L2950, L2943-L2949
+L2948:
+	DW L1040, L2948-L2949
+L2949:
+	DB 181, 229, "s9"
+L2950:
+	DB 98, 183, "s0"
+L2951:
+	DB 235, 225, "s1"
+L2952:
+	DB 142, 24, "s2"
+L2953:
+	DW L2950, L2952-L2952
+L2954:
+	DW L2951, L2956-L2953
+L2955:
+	DB 152, 45, "s5"
+L2956:
+	DB 110, 241, "s6"
+L2957:
+	DB 60, 20, "s7"
+L2958:
+	DB 245, 221, "s8"
+L2959:
+	DB 109, 145, "s9"
+L2960:
+	DB 97, 13, "s0"
+L2961:
+	DB 56, 179, "s1"
+L2962:
+	DB 206, 246, "s2"
+L2963:
+	DW L2965, L2963-L2967
+L2964:
+	DB 190, 57, "s4"
+L2965:
+	DW L2968, L2967-L2962
+L2966:
+	DB 98, 51, "s6"
+L2967:
+	DB 11, 153, "s7"
+L2968:
+	DB 97, 242, "s8"
+L2969:
+	DW L2966, L2970-L2972
+L2970:
+	DW L2969, L2973-L2974
+L2971:
+	DB 5, 108, "s1"
+L2972:
+	DW L2968, L2973-L2975
+L2973:
+	DW L2972, L2970-L2972
+L2974:
+	DW L3512, L2971-L2976
+L2975:
+	DB 56, 58, "s5"
+L2976:
+	DB 96, 219, "s6"
+L2977:
+	DW L2979, L2976-L2980
+L2978:
+	DB 104, 149, "s8"
+L2979:
+	DW L3817, L2978-L2983
+L2980:
+	DW L2280, L2981-L2983
+L2981:
+	DB 240, 120, "s1"
+L2982:
+	DB 128, 246, "s2"
+L2983:
+	DW L2980, L2982-L2985
+L2984:
+	DW L2988, L2983-L2982
+L2985:
+	DB 243, 229, "s5"
+L2986:
+	DB 70, 3, "s6"
+L2987:
+	DW L2983, L2987-L2986
+L2988:
+	DB 19, 99, "s8"
+L2989:
+	DB 205, 137, "s9"
+L2990:
+	DW L2988, L2993-L2986
+L2991:
+	DW L2995, L2994-L2987
+L2992:
+	DW L1384, L2989-L2996
+L2993:
+	DW L1656, L2989-L2991
+L2994:
+	DW L2994, L2991-L2991
+L2995:
+	DB 20, 32, "s5"
+L2996:
+	DW L2995, L2996-L2997
+L2997:
+	DB 98, 73, "s7"
+L2998:
+	DB 103, 203, "s8"
+L2999:
+	DW L2995, L3001-L2995
+L3000:
+	DB 173, 50, "s0"
+L3001:
+	DB 174, 231, "s1"
+L3002:
+	DB 248, 117, "s2"
+L3003:
+	DW L1732, L3005-L3003
+L3004:
+	DW L3007, L3008-L3005
+L3005:
+	DB 230, 13, "s5"
+L3006:
+	DB 140, 163, "s6"
+L3007:
+	DB 253, 12, "s7"
+L3008:
+	DB 181, 8, "s8"
+L3009:
+	DB 173, 231, "s9"
+L3010:
+	DW L3009, L3014-L3008
+L3011:
+	DB 169, 102, "s1"
+L3012:
+	DB 133, 76, "s2"
+L3013:
+	DW L3016, L3010-L3012
+L3014:
+	DW L4321, L3011-L3011
+L3015:
+	DB 6, 221, "s5"
+L3016:
+	DB 209, 102, "s6"
+L3017:
+	DW L3015, L3017-L3017
+L3018:
+	DB 218, 162, "s8"
+L3019:
+	DB 200, 97, "s9"
+L3020:
+	DB 113, 139, "s0"
+L3021:
+	DB 222, 76, "s1"
+L3022:
+	DW L4755, L3026-L3018
+L3023:
+	DB 38, 25, "s3"
+L3024:
+	DW L3027, L3021-L3027
+L3025:
+	DB 47, 57, "s5"
+L3026:
+	DW L475, L3029-L3026
+L3027:
+	DB 127, 87, "s7"
+L3028:
+	DW L3030, L3032-L3025
+L3029:
+	DW L3031, L3027-L3029
+L3030:
+	DB 20, 25, "s0"
+L3031:
+	DW L885, L3035-L3028
+L3032:
+	DB 168, 17, "s2"
+L3033:
+	DB 144, 55, "s3"
+L3034:
+	DW L3031, L3033-L3032
+L3035:
+	DW L3038, L3031-L3039
+L3036:
+	DW L1310, L3036-L3037
+L3037:
+	DB 170, 240, "s7"
+L3038:
+	DB 120, 148, "s8"
+L3039:
+	DB 114, 163, "s9"
+L3040:
+	DW L3042, L3038-L3044
+L3041:
+	DW L3043, L3039-L3044
+L3042:
+	DW L3042, L3044-L3041
+L3043:
+	DB 125, 106, "s3"
+L3044:
+	DW L3043, L3048-L3045
+L3045:
+	DW L3047, L3048-L3043
+L3046:
+	DB 142, 63, "s6"
+L3047:
+	DB 162, 197, "s7"
+L3048:
+	DW L269, L3044-L3046
+L3049:
+	DW L3051, L3049-L3045
+L3050:
+	DB 38, 85, "s0"
+L3051:
+	DB 243, 49, "s1"
+L3052:
+	DW L3048, L3052-L3054
+L3053:
+	DB 188, 65, "s3"
+L3054:
+	DB 237, 234, "s4"
+L3055:
+	DB 235, 207, "s5"
+L3056:
+	DW L3054, L3053-L3058
+L3057:
+	DB 63, 1, "s7"
+L3058:
+	DW L3057, L3062-L3056
+L3059:
+	DW L3062, L3061-L3056
+L3060:
+	DB 139, 201, "s0"
+L3061:
+	DW L3059, L3057-L3061
+L3062:
+	DB 11, 239, "s2"
+L3063:
+	DB 251, 184, "s3"
+L3064:
+	DB 246, 24, "s4"
+L3065:
+	DW L4146, L3061-L3067
+L3066:
+	DW L4268, L3064-L3062
+L3067:
+	DW L3066, L3067-L3069
+L3068:
+	DB 93, 81, "s8"
+L3069:
+	DB 55, 205, "s9"
+L3070:
+	DB 36, 82, "s0"
+L3071:
+	DB 175, 208, "s1"
+L3072:
+	DW L3068, L3069-L3071
+L3073:
+	DB 110, 92, "s3"
+L3074:
+	DB 188, 159, "s4"
+L3075:
+	DW L3072, L3073-L3078
+L3076:
+	DB 118, 253, "s6"
+L3077:
+	DW L3077, L3081-L3077
+L3078:
+	DW L3081, L3082-L3077
+L3079:
+	DW L3082, L3075-L3076
+L3080:
+	DW L3080, L3076-L3079
+L3081:
+	DB 132, 7, "s1"
+L3082:
+	DB 8, 163, "s2"
+L3083:
+	DB 201, 161, "s3"
+L3084:
+	DW L3874, L3082-L3085
+L3085:
+	DW L3556, L3082-L3083
+L3086:
+	DB 111, 20, "s6"
+L3087:
+	DB 52, 224, "s7"
+L3088:
+	DB 216, 22, "s8"
+L3089:
+	DW L4587, L3091-L3089
+L3090:
+	DW L3092, L3092-L3086
+L3091:
+	DW L3091, L3095-L3091
+L3092:
+	DW L3093, L3096-L3094
+L3093:
+	DW L1393, L3094-L3095
+L3094:
+	DB 201, 250, "s4"
+L3095:
+	DW L4525, L3096-L3097
+L3096:
+	DB 187, 111, "s6"
+L3097:
+	DW L3095, L3098-L3096
+L3098:
+	DB 116, 210, "s8"
+L3099:
+	DB 84, 242, "s9"
+L3100:
+	DW L2991, L3104-L3096
+L3101:
+	DW L3102, L3102-L3104
+L3102:
+	DW L3099, L3099-L3103
+L3103:
+	DB 33, 215, "s3"
+L3104:
+	DW L3100, L3105-L3102
+L3105:
+	DB 175, 85, "s5"
+L3106:
+	DW L3108, L3109-L3104
+L3107:
+	DW L3108, L3105-L3106
+L3108:
+	DW L3105, L3110-L3107
+L3109:
+	DW L3108, L3113-L3112
+L3110:
+	DW L3109, L3114-L3114
+L3111:
+	DW L4301, L3111-L3112
+L3112:
+	DW L1266, L3114-L3111
+L3113:
+	DW L3109, L3109-L3114
+L3114:
+	DW L3115, L3111-L3112
+L3115:
+	DW L3116, L3118-L3118
+L3116:
+	DW L1381, L3120-L3115
+L3117:
+	DW L1360, L3113-L3116
+L3118:
+	DW L3118, L3116-L3117
+L3119:
+	DB 105, 208, "s9"
+L3120:
+	DW L3118, L3124-L3123
+L3121:
+	DB 81, 216, "s1"
+L3122:
+	DW L3118, L3124-L3120
+L3123:
+	DB 65, 193, "s3"
+L3124:
+	DB 225, 204, "s4"
+L3125:
+	DW L3124, L3128-L3125
+L3126:
+	DB 28, 14, "s6"
+L3127:
+	DW L3130, L3129-L3127
+L3128:
+	DW L3132, L3125-L3124
+L3129:
+	DW L3133, L3131-L3129
+L3130:
+	DB 71, 194, "s0"
+L3131:
+	DB 91, 208, "s1"
+L3132:
+	DB 120, 21, "s2"
+L3133:
+	DB 68, 64, "s3"
+L3134:
+	DB 199, 7, "s4"
+L3135:
+	DB 123, 153, "s5"
+L3136:
+	DB 106, 28, "s6"
+L3137:
+	DB 148, 107, "s7"
+L3138:
+	DW L3138, L3134-L3135
+L3139:
+	DW L3141, L3137-L3139
+L3140:
+	DW L3143, L3138-L3136
+L3141:
+	DB 44, 8, "s1"
+L3142:
+	DW L3144, L3143-L3144
+L3143:
+	DB 56, 5, "s3"
+L3144:
+	DB 202, 228, "s4"
+L3145:
+	DW L3149, L3146-L3144
+L3146:
+	DW L1704, L3143-L3142
+L3147:
+	DW L1143, L3147-L3143
+L3148:
+	DW L3150, L3147-L3151
+L3149:
+	DB 212, 87, "s9"
+L3150:
+	DW L3148, L3146-L3147
+L3151:
+	DW L3147, L3155-L3153
+L3152:
+	DW L1076, L3148-L3150
+L3153:
+	DB 157, 27, "s3"
+L3154:
+	DB 34, 153, "s4"
+L3155:
+	DB 5, 132, "s5"
+L3156:
+	DW L3154, L3155-L3155
+L3157:
+	DB 10, 246, "s7"
+L3158:
+	DW L3159, L3161-L3155
+L3159:
+	DW L3163, L3158-L3161
+L3160:
+	DB 137, 98, "s0"
+L3161:
+	DB 252, 133, "s1"
+L3162:
+	DW L3165, L3162-L3166
+L3163:
+	DB 220, 187, "s3"
+L3164:
+	DW L4914, L3166-L3161
+L3165:
+	DB 1, 230, "s5"
+L3166:
+	DB 147, 146, "s6"
+L3167:
+	DW L3168, L3166-L3166
+L3168:
+	DB 82, 167, "s8"
+L3169:
+	DW L2911, L3170-L3173
+L3170:
+	DB 23, 239, "s0"
+L3171:
+	DB 201, 162, "s1"
+L3172:
+	DW L3173, L3170-L3174
+L3173:
+	DB 202, 154, "s3"
+L3174:
+	DW L3176, L3178-L3177
+L3175:
+	DW L3171, L3172-L3177
+L3176:
+	DW L3180, L3172-L3174
+L3177:
+	DW L3179, L3176-L3173
+L3178:
+	DW L3175, L3179-L3181
+L3179:
+	DB 209, 10, "s9"
+L3180:
+	DW L3181, L3179-L3182
+L3181:
+	DB 91, 167, "s1"
+L3182:
+	DB 35, 222, "s2"
+L3183:
+	DB 93, 166, "s3"
+L3184:
+	DW L799, L3184-L3184
+L3185:
+	DW L3181, L3188-L3183
+L3186:
+	DW L3370, L3190-L3187
+L3187:
+	DB 113, 46, "s7"
+L3188:
+	DW L3189, L3191-L3192
+L3189:
+	DB 128, 216, "s9"
+L3190:
+	DW L3187, L3186-L3192
+L3191:
+	DB 247, 69, "s1"
+L3192:
+	DW L3190, L3196-L3195
+L3193:
+	DW L3197, L3195-L3190
+L3194:
+	DB 96, 122, "s4"
+L3195:
+	DB 180, 171, "s5"
+L3196:
+	DB 185, 21, "s6"
+L3197:
+	DB 16, 220, "s7"
+L3198:
+	DB 243, 44, "s8"
+L3199:
+	DB 68, 198, "s9"
+L3200:
+	DB 237, 61, "s0"
+L3201:
+	DB 65, 149, "s1"
+L3202:
+	DB 146, 123, "s2"
+L3203:
+	DB 162, 244, "s3"
+L3204:
+	DB 204, 228, "s4"
+L3205:
+	DW L2031, L3201-L3201
+L3206:
+	DB 44, 55, "s6"
+L3207:
+	DW L3205, L3208-L3211
+L3208:
+	DB 43, 0, "s8"
+L3209:
+	DW L79, L3206-L3206
+L3210:
+	DW L3207, L3208-L3206
+L3211:
+	DB 226, 189, "s1"
+L3212:
+	DW L3214, L3214-L3216
+L3213:
+	DB 213, 249, "s3"
+L3214:
+	DW L3210, L3210-L3217
+L3215:
+	DB 178, 46, "s5"
+L3216:
+	DB 172, 203, "s6"
+L3217:
+	DW L442, L3220-L3219
+L3218:
+	DW L3218, L3216-L3221
+L3219:
+	DW L3219, L3215-L3221
+L3220:
+	DW L3224, L3216-L3216
+L3221:
+	DB 164, 191, "s1"
+L3222:
+	DW L3224, L3219-L3224
+L3223:
+	DW L1576, L3224-L3223
+L3224:
+	DW L3223, L3221-L3222
+L3225:
+	DW L3223, L3228-L3224
+L3226:
+	DW L3836, L3230-L3227
+L3227:
+	DB 61, 49, "s7"
+L3228:
+	DW L3226, L3225-L3225
+L3229:
+	DB 244, 246, "s9"
+L3230:
+	DW L3231, L3229-L3234
+L3231:
+	DW L1289, L3235-L3232
+L3232:
+	DW L3233, L3236-L3232
+L3233:
+	DW L3237, L3237-L3233
+L3234:
+	DW L3231, L3230-L3236
+L3235:
+	DW L3234, L3236-L3236
+L3236:
+	DW L3232, L3240-L3238
+L3237:
+	DW L3236, L3233-L3238
+L3238:
+	DW L3240, L3240-L3234
+L3239:
+	DW L1200, L3237-L3237
+L3240:
+	DW L3244, L3243-L3237
+L3241:
+	DW L3579, L3239-L3237
+L3242:
+	DB 4, 42, "s2"
+L3243:
+	DW L3241, L3243-L3239
+L3244:
+	DW L3248, L3243-L3243
+L3245:
+	DW L2474, L3249-L3249
+L3246:
+	DB 198, 112, "s6"
+L3247:
+	DW L3246, L3244-L3245
+L3248:
+	DB 40, 182, "s8"
+L3249:
+	DW L3250, L3249-L3248
+L3250:
+	DB 75, 8, "s0"
+L3251:
+	DW L3252, L3254-L3247
+L3252:
+	DB 128, 92, "s2"
+L3253:
+	DW L3257, L3255-L3252
+L3254:
+	DB 116, 141, "s4"
+L3255:
+	DB 113, 207, "s5"
+L3256:
+	DW L3252, L3252-L3256
+L3257:
+	DB 112, 0, "s7"
+L3258:
+	DW L2533, L3254-L3261
+L3259:
+	DB 146, 30, "s9"
+L3260:
+	DW L2329, L3260-L3260
+L3261:
+	DB 205, 162, "s1"
+L3262:
+	DW L3259, L3261-L3266
+L3263:
+	DB 190, 161, "s3"
+L3264:
+	DW L3263, L3260-L3262
+L3265:
+	DW L3261, L3261-L3261
+L3266:
+	DW L3263, L3265-L3263
+L3267:
+	DW L3263, L3263-L3269
+L3268:
+	DB 146, 158, "s8"
+L3269:
+	DW L3269, L3270-L3266
+L3270:
+	DW L3248, L3269-L3268
+L3271:
+	DB 172, 69, "s1"
+L3272:
+	DW L4647, L3275-L3274
+L3273:
+	DB 30, 125, "s3"
+L3274:
+	DW L43, L3275-L3272
+L3275:
+	DB 162, 129, "s5"
+L3276:
+	DW L3280, L3274-L3276
+L3277:
+	DB 32, 141, "s7"
+L3278:
+	DB 144, 89, "s8"
+L3279:
+	DW L473, L3279-L3280
+L3280:
+	DW L3281, L3280-L3281
+L3281:
+	DW L969, L3283-L3279
+L3282:
+	DB 201, 90, "s2"
+L3283:
+	DB 239, 190, "s3"
+L3284:
+	DB 181, 171, "s4"
+L3285:
+	DW L3286, L3281-L3285
+L3286:
+	DB 247, 35, "s6"
+L3287:
+	DB 16, 153, "s7"
+L3288:
+	DW L3285, L3288-L3290
+L3289:
+	DW L3291, L3292-L3286
+L3290:
+	DB 213, 72, "s0"
+L3291:
+	DW L3294, L3294-L3295
+L3292:
+	DB 20, 235, "s2"
+L3293:
+	DB 11, 70, "s3"
+L3294:
+	DB 184, 167, "s4"
+L3295:
+	DB 133, 122, "s5"
+L3296:
+	DB 117, 231, "s6"
+L3297:
+	DB 249, 194, "s7"
+L3298:
+	DW L3295, L3301-L3302
+L3299:
+	DB 77, 192, "s9"
+L3300:
+	DW L3552, L3300-L3297
+L3301:
+	DW L3298, L3304-L3301
+L3302:
+	DB 72, 181, "s2"
+L3303:
+	DB 45, 203, "s3"
+L3304:
+	DB 42, 125, "s4"
+L3305:
+	DW L4739, L3307-L3303
+L3306:
+	DW L3303, L3308-L3306
+L3307:
+	DW L3308, L3305-L3304
+L3308:
+	DW L1204, L3307-L3310
+L3309:
+	DB 212, 16, "s9"
+L3310:
+	DB 92, 185, "s0"
+L3311:
+	DB 242, 121, "s1"
+L3312:
+	DW L1409, L3314-L3310
+L3313:
+	DB 110, 93, "s3"
+L3314:
+	DW L3311, L3313-L3313
+L3315:
+	DW L3317, L3316-L3319
+L3316:
+	DB 36, 203, "s6"
+L3317:
+	DB 217, 74, "s7"
+L3318:
+	DB 53, 81, "s8"
+L3319:
+	DW L3322, L3316-L3318
+L3320:
+	DB 188, 155, "s0"
+L3321:
+	DW L3323, L3317-L3319
+L3322:
+	DB 191, 134, "s2"
+L3323:
+	DW L3320, L3321-L3321
+L3324:
+	DB 67, 112, "s4"
+L3325:
+	DB 169, 117, "s5"
+L3326:
+	DW L1975, L3323-L3323
+L3327:
+	DW L3323, L3330-L3329
+L3328:
+	DB 149, 106, "s8"
+L3329:
+	DW L3327, L3326-L3330
+L3330:
+	DB 189, 168, "s0"
+L3331:
+	DB 3, 1, "s1"
+L3332:
+	DB 58, 81, "s2"
+L3333:
+	DB 157, 35, "s3"
+L3334:
+	DW L3336, L3335-L3335
+L3335:
+	DB 81, 168, "s5"
+L3336:
+	DW L3334, L3332-L3336
+L3337:
+	DB 96, 152, "s7"
+L3338:
+	DW L3341, L3338-L3336
+L3339:
+	DW L3997, L3339-L3339
+L3340:
+	DB 162, 8, "s0"
+L3341:
+	DB 105, 100, "s1"
+L3342:
+	DW L3341, L3342-L3344
+L3343:
+	DW L419, L3343-L3346
+L3344:
+	DB 105, 193, "s4"
+L3345:
+	DB 140, 131, "s5"
+L3346:
+	DB 173, 71, "s6"
+L3347:
+	DW L3349, L3343-L3343
+L3348:
+	DW L4960, L3348-L3351
+L3349:
+	DW L3351, L3345-L3351
+L3350:
+	DB 185, 216, "s0"
+L3351:
+	DW L3348, L3348-L3350
+L3352:
+	DB 180, 197, "s2"
+L3353:
+	DW L3353, L3349-L3351
+L3354:
+	DW L3354, L3352-L3352
+L3355:
+	DW L3351, L3357-L3352
+L3356:
+	DW L3360, L3357-L3353
+L3357:
+	DW L400, L3354-L3358
+L3358:
+	DW L3355, L3360-L3355
+L3359:
+	DW L3362, L3357-L3361
+L3360:
+	DB 183, 204, "s0"
+L3361:
+	DB 175, 60, "s1"
+L3362:
+	DW L3364, L3364-L3364
+L3363:
+	DB 109, 143, "s3"
+L3364:
+	DB 61, 224, "s4"
+L3365:
+	DB 100, 18, "s5"
+L3366:
+	DW L3364, L3370-L3364
+L3367:
+	DB 155, 107, "s7"
+L3368:
+	DW L3368, L3370-L3371
+L3369:
+	DB 26, 226, "s9"
+L3370:
+	DB 51, 188, "s0"
+L3371:
+	DB 223, 44, "s1"
+L3372:
+	DW L3376, L3373-L3376
+L3373:
+	DW L3373, L3377-L3376
+L3374:
+	DW L3373, L3370-L3374
+L3375:
+	DW L3375, L3375-L3372
+L3376:
+	DW L3379, L3374-L3374
+L3377:
+	DB 165, 51, "s7"
+L3378:
+	DB 109, 96, "s8"
+L3379:
+	DW L4259, L3378-L3383
+L3380:
+	DW L3384, L3377-L3379
+L3381:
+	DW L3380, L3379-L3381
+L3382:
+	DW L3987, L3380-L3381
+L3383:
+	DW L3382, L3380-L3384
+L3384:
+	DW L3386, L3385-L3380
+L3385:
+	DB 21, 164, "s5"
+L3386:
+	DW L3386, L3387-L3386
+L3387:
+	DW L3390, L3385-L3386
+L3388:
+	DW L3384, L3390-L3384
+L3389:
+	DB 10, 148, "s9"
+L3390:
+	DB 207, 55, "s0"
+L3391:
+	DB 69, 220, "s1"
+L3392:
+	DB 2, 4, "s2"
+L3393:
+	DB 242, 129, "s3"
+L3394:
+	DW L3390, L3392-L3397
+L3395:
+	DB 36, 42, "s5"
+L3396:
+	DB 66, 133, "s6"
+L3397:
+	DB 21, 184, "s7"
+L3398:
+	DW L3402, L3402-L3401
+L3399:
+	DW L3399, L3403-L3396
+L3400:
+	DB 120, 54, "s0"
+L3401:
+	DB 71, 136, "s1"
+L3402:
+	DW L3401, L3404-L3406
+L3403:
+	DW L3407, L3400-L3404
+L3404:
+	DW L3404, L3400-L3405
+L3405:
+	DW L3405, L3402-L3408
+L3406:
+	DW L3408, L3409-L3403
+L3407:
+	DB 18, 227, "s7"
+L3408:
+	DB 129, 5, "s8"
+L3409:
+	DB 222, 102, "s9"
+L3410:
+	DB 200, 32, "s0"
+L3411:
+	DW L3414, L3415-L3414
+L3412:
+	DB 111, 123, "s2"
+L3413:
+	DB 156, 253, "s3"
+L3414:
+	DB 53, 87, "s4"
+L3415:
+	DB 230, 243, "s5"
+L3416:
+	DB 233, 38, "s6"
+L3417:
+	DB 1, 195, "s7"
+L3418:
+	DB 43, 109, "s8"
+L3419:
+	DB 89, 72, "s9"
+L3420:
+	DB 73, 6, "s0"
+L3421:
+	DW L3417, L3417-L3417
+L3422:
+	DW L3419, L3424-L3419
+L3423:
+	DB 59, 67, "s3"
+L3424:
+	DB 234, 85, "s4"
+L3425:
+	DW L3426, L3423-L3425
+L3426:
+	DB 74, 241, "s6"
+L3427:
+	DW L3427, L3423-L3430
+L3428:
+	DW L1395, L3431-L3425
+L3429:
+	DW L3431, L3426-L3433
+L3430:
+	DB 198, 18, "s0"
+L3431:
+	DW L3430, L3432-L3432
+L3432:
+	DB 158, 143, "s2"
+L3433:
+	DW L2493, L3429-L3432
+L3434:
+	DB 172, 195, "s4"
+L3435:
+	DW L3433, L3434-L3439
+L3436:
+	DW L3436, L3437-L3440
+L3437:
+	DW L3436, L3440-L3439
+L3438:
+	DB 128, 140, "s8"
+L3439:
+	DB 204, 94, "s9"
+L3440:
+	DW L4992, L3441-L3438
+L3441:
+	DB 134, 128, "s1"
+L3442:
+	DB 240, 148, "s2"
+L3443:
+	DW L273, L3446-L3439
+L3444:
+	DB 101, 227, "s4"
+L3445:
+	DB 58, 111, "s5"
+L3446:
+	DB 241, 154, "s6"
+L3447:
+	DB 240, 159, "s7"
+L3448:
+	DW L4121, L3447-L3444
+L3449:
+	DW L3453, L3448-L3452
+L3450:
+	DW L3451, L3448-L3453
+L3451:
+	DW L474, L3451-L3448
+L3452:
+	DW L3453, L3456-L3456
+L3453:
+	DW L3540, L3452-L3452
+L3454:
+	DW L3454, L3451-L3457
+L3455:
+	DW L3458, L3454-L3457
+L3456:
+	DB 175, 254, "s6"
+L3457:
+	DW L3457, L3459-L3456
+L3458:
+	DB 107, 65, "s8"
+L3459:
+	DB 164, 109, "s9"
+L3460:
+	DW L3462, L3458-L3460
+L3461:
+	DB 165, 199, "s1"
+L3462:
+	DB 66, 62, "s2"
+L3463:
+	DW L3467, L3460-L3460
+L3464:
+	DW L3468, L3462-L3468
+L3465:
+	DB 206, 92, "s5"
+L3466:
+	DB 137, 230, "s6"
+L3467:
+	DW L3470, L3463-L3465
+L3468:
+	DB 43, 74, "s8"
+L3469:
+	DB 107, 53, "s9"
+L3470:
+	DW L3008, L3469-L3474
+L3471:
+	DW L3473, L3467-L3475
+L3472:
+	DB 21, 189, "s2"
+L3473:
+	DW L3475, L3477-L3474
+L3474:
+	DB 218, 189, "s4"
+L3475:
+	DB 245, 191, "s5"
+L3476:
+	DB 88, 168, "s6"
+L3477:
+	DB 123, 101, "s7"
+L3478:
+	DB 218, 140, "s8"
+L3479:
+	DW L3478, L3479-L3476
+L3480:
+	DW L3478, L3484-L3480
+L3481:
+	DB 1, 40, "s1"
+L3482:
+	DB 43, 215, "s2"
+L3483:
+	DW L3486, L3485-L3487
+L3484:
+	DW L3488, L3486-L3482
+L3485:
+	DB 125, 157, "s5"
+L3486:
+	DW L3490, L3488-L3489
+L3487:
+	DB 97, 148, "s7"
+L3488:
+	DB 127, 8, "s8"
+L3489:
+	DB 204, 134, "s9"
+L3490:
+	DB 214, 30, "s0"
+L3491:
+	DW L3493, L3492-L3489
+L3492:
+	DW L3491, L3490-L3494
+L3493:
+	DB 174, 47, "s3"
+L3494:
+	DW L1004, L3492-L3491
+L3495:
+	DB 25, 99, "s5"
+L3496:
+	DB 84, 145, "s6"
+L3497:
+	DW L3496, L3497-L3496
+L3498:
+	DW L3494, L3502-L3496
+L3499:
+	DB 148, 17, "s9"
+L3500:
+	DB 74, 148, "s0"
+L3501:
+	DW L3504, L3503-L3502
+L3502:
+	DW L2334, L3500-L3500
+L3503:
+	DW L778, L3505-L3507
+L3504:
+	DB 138, 232, "s4"
+L3505:
+	DB 54, 23, "s5"
+L3506:
+	DW L3508, L3504-L3508
+L3507:
+	DB 127, 104, "s7"
+L3508:
+	DW L3505, L3508-L3504
+L3509:
+	DB 232, 187, "s9"
+L3510:
+	DB 91, 218, "s0"
+L3511:
+	DW L2582, L3511-L3509
+L3512:
+	DB 223, 117, "s2"
+L3513:
+	DB 158, 13, "s3"
+L3514:
+	DW L3514, L3512-L3510
+L3515:
+	DW L3514, L3512-L3514
+L3516:
+	DW L3216, L3520-L3513
+L3517:
+	DW L3517, L3521-L3514
+L3518:
+	DW L3955, L3514-L3514
+L3519:
+	DW L3516, L3517-L3520
+L3520:
+	DB 162, 116, "s0"
+L3521:
+	DB 121, 26, "s1"
+L3522:
+	DB 99, 193, "s2"
+L3523:
+	DB 182, 217, "s3"
+L3524:
+	DW L3525, L3520-L3526
+L3525:
+	DB 22, 6, "s5"
+L3526:
+	DW L3529, L3524-L3528
+L3527:
+	DB 147, 171, "s7"
+L3528:
+	DW L3530, L3526-L3531
+L3529:
+	DB 208, 244, "s9"
+L3530:
+	DB 207, 241, "s0"
+L3531:
+	DB 55, 196, "s1"
+L3532:
+	DB 116, 153, "s2"
+L3533:
+	DB 147, 73, "s3"
+L3534:
+	DW L3534, L3532-L3535
+L3535:
+	DW L777, L3531-L3533
+L3536:
+	DB 241, 112, "s6"
+L3537:
+	DB 82, 61, "s7"
+L3538:
+	DW L4123, L3538-L3534
+L3539:
+	DB 188, 46, "s9"
+L3540:
+	DB 85, 54, "s0"
+L3541:
+	DW L3665, L3543-L3542
+L3542:
+	DW L3544, L3539-L3545
+L3543:
+	DW L3539, L3547-L3545
+L3544:
+	DB 109, 191, "s4"
+L3545:
+	DB 113, 158, "s5"
+L3546:
+	DW L3547, L3543-L3548
+L3547:
+	DB 238, 97, "s7"
+L3548:
+	DW L3545, L3548-L3549
+L3549:
+	DW L3553, L3548-L3547
+L3550:
+	DB 247, 126, "s0"
+L3551:
+	DW L1115, L3547-L3549
+L3552:
+	DW L874, L3556-L3548
+L3553:
+	DB 119, 45, "s3"
+L3554:
+	DB 119, 96, "s4"
+L3555:
+	DW L3556, L3559-L3554
+L3556:
+	DB 243, 49, "s6"
+L3557:
+	DW L4761, L3561-L3554
+L3558:
+	DB 22, 35, "s8"
+L3559:
+	DB 185, 87, "s9"
+L3560:
+	DB 188, 73, "s0"
+L3561:
+	DB 78, 72, "s1"
+L3562:
+	DW L3565, L3560-L3565
+L3563:
+	DB 40, 8, "s3"
+L3564:
+	DB 110, 85, "s4"
+L3565:
+	DB 6, 255, "s5"
+L3566:
+	DB 38, 41, "s6"
+L3567:
+	DB 137, 21, "s7"
+L3568:
+	DW L3566, L3569-L3570
+L3569:
+	DB 124, 18, "s9"
+L3570:
+	DW L4650, L3571-L3573
+L3571:
+	DW L3570, L3574-L3571
+L3572:
+	DW L3576, L3574-L3569
+L3573:
+	DW L3573, L3574-L3576
+L3574:
+	DB 183, 8, "s4"
+L3575:
+	DB 103, 157, "s5"
+L3576:
+	DB 152, 132, "s6"
+L3577:
+	DB 92, 86, "s7"
+L3578:
+	DW L3574, L3582-L3576
+L3579:
+	DW L825, L3579-L3579
+L3580:
+	DB 120, 98, "s0"
+L3581:
+	DW L4393, L3582-L3585
+L3582:
+	DB 109, 171, "s2"
+L3583:
+	DW L3581, L3580-L3580
+L3584:
+	DB 80, 234, "s4"
+L3585:
+	DB 175, 174, "s5"
+L3586:
+	DB 150, 149, "s6"
+L3587:
+	DB 115, 56, "s7"
+L3588:
+	DW L3587, L3587-L3585
+L3589:
+	DB 44, 61, "s9"
+L3590:
+	DW L3586, L3592-L3589
+L3591:
+	DB 69, 181, "s1"
+L3592:
+	DW L3595, L3592-L3590
+L3593:
+	DW L3596, L3594-L3596
+L3594:
+	DW L3596, L3591-L3594
+L3595:
+	DW L415, L3591-L3593
+L3596:
+	DW L2471, L3595-L3598
+L3597:
+	DB 192, 67, "s7"
+L3598:
+	DB 74, 159, "s8"
+L3599:
+	DB 240, 195, "s9"
+L3600:
+	DB 17, 195, "s0"
+L3601:
+	DB 111, 153, "s1"
+L3602:
+	DB 155, 218, "s2"
+L3603:
+	DB 205, 231, "s3"
+L3604:
+	DW L3606, L3604-L3607
+L3605:
+	DB 122, 95, "s5"
+L3606:
+	DB 43, 126, "s6"
+L3607:
+	DB 149, 24, "s7"
+L3608:
+	DB 133, 112, "s8"
+L3609:
+	DB 217, 192, "s9"
+L3610:
+	DW L3609, L3613-L3610
+L3611:
+	DW L3609, L3610-L3613
+L3612:
+	DB 191, 87, "s2"
+L3613:
+	DB 184, 66, "s3"
+L3614:
+	DW L3611, L3617-L3614
+L3615:
+	DB 144, 102, "s5"
+L3616:
+	DB 220, 3, "s6"
+L3617:
+	DW L1836, L3616-L3613
+L3618:
+	DW L3620, L3617-L3621
+L3619:
+	DW L1473, L3616-L3616
+L3620:
+	DB 10, 205, "s0"
+L3621:
+	DW L3987, L3623-L3624
+L3622:
+	DW L3923, L3626-L3624
+L3623:
+	DW L3624, L3622-L3619
+L3624:
+	DB 213, 97, "s4"
+L3625:
+	DB 84, 1, "s5"
+L3626:
+	DW L3630, L3622-L3625
+L3627:
+	DB 136, 184, "s7"
+L3628:
+	DW L3632, L3628-L3628
+L3629:
+	DB 42, 177, "s9"
+L3630:
+	DW L3633, L3633-L3634
+L3631:
+	DB 33, 100, "s1"
+L3632:
+	DB 202, 67, "s2"
+L3633:
+	DW L3634, L3631-L3629
+L3634:
+	DW L3636, L3633-L3633
+L3635:
+	DW L3631, L3636-L3635
+L3636:
+	DB 184, 79, "s6"
+L3637:
+	DW L2683, L3635-L3638
+L3638:
+	DB 83, 248, "s8"
+L3639:
+	DB 129, 117, "s9"
+L3640:
+	DB 246, 120, "s0"
+L3641:
+	DB 201, 35, "s1"
+L3642:
+	DW L3643, L3644-L3641
+L3643:
+	DB 193, 218, "s3"
+L3644:
+	DW L3647, L3645-L3646
+L3645:
+	DB 160, 168, "s5"
+L3646:
+	DB 209, 123, "s6"
+L3647:
+	DW L3650, L3643-L3643
+L3648:
+	DB 69, 82, "s8"
+L3649:
+	DB 110, 43, "s9"
+L3650:
+	DW L3650, L3651-L3650
+L3651:
+	DB 51, 25, "s1"
+L3652:
+	DB 93, 5, "s2"
+L3653:
+	DW L2204, L3656-L3650
+L3654:
+	DW L3654, L3651-L3652
+L3655:
+	DW L3653, L3659-L3659
+L3656:
+	DB 8, 102, "s6"
+L3657:
+	DB 158, 230, "s7"
+L3658:
+	DW L3657, L3657-L3662
+L3659:
+	DW L3657, L3661-L3661
+L3660:
+	DB 215, 234, "s0"
+L3661:
+	DW L3657, L3661-L3659
+L3662:
+	DW L3665, L3664-L3661
+L3663:
+	DW L3667, L3663-L3659
+L3664:
+	DB 95, 40, "s4"
+L3665:
+	DB 188, 70, "s5"
+L3666:
+	DB 200, 138, "s6"
+L3667:
+	DW L3668, L3664-L3669
+L3668:
+	DB 100, 70, "s8"
+L3669:
+	DB 142, 222, "s9"
+L3670:
+	DB 96, 131, "s0"
+L3671:
+	DW L3667, L3674-L3672
+L3672:
+	DB 67, 3, "s2"
+L3673:
+	DB 30, 212, "s3"
+L3674:
+	DB 156, 151, "s4"
+L3675:
+	DW L3676, L3671-L3672
+L3676:
+	DB 27, 108, "s6"
+L3677:
+	DW L3680, L3674-L3674
+L3678:
+	DW L3681, L3677-L3677
+L3679:
+	DW L3679, L3680-L3678
+L3680:
+	DB 240, 230, "s0"
+L3681:
+	DW L3680, L3682-L3678
+L3682:
+	DW L3681, L3684-L3680
+L3683:
+	DB 243, 134, "s3"
+L3684:
+	DW L3680, L3681-L3680
+L3685:
+	DB 117, 204, "s5"
+L3686:
+	DB 204, 10, "s6"
+L3687:
+	DW L3683, L3683-L3691
+L3688:
+	DB 241, 143, "s8"
+L3689:
+	DB 186, 168, "s9"
+L3690:
+	DB 154, 96, "s0"
+L3691:
+	DW L3695, L3690-L3692
+L3692:
+	DW L3691, L3695-L3692
+L3693:
+	DB 46, 173, "s3"
+L3694:
+	DB 170, 6, "s4"
+L3695:
+	DB 201, 109, "s5"
+L3696:
+	DB 212, 171, "s6"
+L3697:
+	DB 247, 199, "s7"
+L3698:
+	DW L3697, L3701-L3702
+L3699:
+	DW L3700, L3701-L3695
+L3700:
+	DB 46, 255, "s0"
+L3701:
+	DB 173, 17, "s1"
+L3702:
+	DB 245, 118, "s2"
+L3703:
+	DB 183, 130, "s3"
+L3704:
+	DB 140, 36, "s4"
+L3705:
+	DW L3709, L3702-L3705
+L3706:
+	DW L3702, L3706-L3705
+L3707:
+	DW L3709, L3710-L3706
+L3708:
+	DB 141, 176, "s8"
+L3709:
+	DB 115, 107, "s9"
+L3710:
+	DW L3714, L3707-L3708
+L3711:
+	DB 36, 116, "s1"
+L3712:
+	DW L936, L3715-L3708
+L3713:
+	DB 166, 10, "s3"
+L3714:
+	DW L3715, L3718-L3718
+L3715:
+	DB 41, 120, "s5"
+L3716:
+	DB 144, 94, "s6"
+L3717:
+	DB 231, 7, "s7"
+L3718:
+	DW L3722, L3714-L3719
+L3719:
+	DB 4, 155, "s9"
+L3720:
+	DW L3724, L3718-L3718
+L3721:
+	DW L3717, L3719-L3725
+L3722:
+	DW L3762, L3722-L3721
+L3723:
+	DW L3720, L3719-L3724
+L3724:
+	DW L3722, L3725-L3720
+L3725:
+	DW L3727, L3726-L3721
+L3726:
+	DW L3728, L3723-L3725
+L3727:
+	DW L3727, L3727-L3731
+L3728:
+	DW L4113, L3729-L3730
+L3729:
+	DB 116, 216, "s9"
+L3730:
+	DB 236, 50, "s0"
+L3731:
+	DW L3732, L3730-L3728
+L3732:
+	DW L3733, L3732-L3734
+L3733:
+	DW L3733, L3732-L3737
+L3734:
+	DW L3737, L3730-L3737
+L3735:
+	DB 203, 33, "s5"
+L3736:
+	DW L3736, L3739-L3732
+L3737:
+	DW L3736, L3737-L3735
+L3738:
+	DW L3740, L3738-L3740
+L3739:
+	DB 246, 5, "s9"
+L3740:
+	DB 104, 152, "s0"
+L3741:
+	DW L3743, L3742-L3744
+L3742:
+	DW L3744, L3738-L3743
+L3743:
+	DW L3743, L3741-L3747
+L3744:
+	DB 79, 77, "s4"
+L3745:
+	DW L3746, L3744-L3744
+L3746:
+	DW L3743, L3743-L3746
+L3747:
+	DW L3751, L3751-L3750
+L3748:
+	DW L3746, L3745-L3751
+L3749:
+	DW L3464, L3751-L3750
+L3750:
+	DW L3746, L3754-L3751
+L3751:
+	DW L4567, L3747-L3750
+L3752:
+	DB 33, 248, "s2"
+L3753:
+	DB 98, 151, "s3"
+L3754:
+	DB 42, 89, "s4"
+L3755:
+	DW L2430, L3752-L3755
+L3756:
+	DW L4851, L3753-L3756
+L3757:
+	DW L3753, L3754-L3757
+L3758:
+	DW L3759, L3759-L3759
+L3759:
+	DW L3154, L3763-L3762
+L3760:
+	DW L3600, L3761-L3756
+L3761:
+	DW L3761, L3765-L3763
+L3762:
+	DW L1000, L3766-L3764
+L3763:
+	DB 130, 3, "s3"
+L3764:
+	DW L3766, L3765-L3767
+L3765:
+	DB 46, 11, "s5"
+L3766:
+	DB 247, 71, "s6"
+L3767:
+	DB 41, 232, "s7"
+L3768:
+	DB 109, 122, "s8"
+L3769:
+	DB 251, 35, "s9"
+L3770:
+	DB 253, 29, "s0"
+L3771:
+	DB 216, 221, "s1"
+L3772:
+	DB 160, 224, "s2"
+L3773:
+	DW L3776, L3772-L3777
+L3774:
+	DW L3773, L3777-L3778
+L3775:
+	DB 121, 212, "s5"
+L3776:
+	DW L3774, L3775-L3780
+L3777:
+	DW L3780, L3779-L3775
+L3778:
+	DW L3782, L3774-L3781
+L3779:
+	DB 104, 1, "s9"
+L3780:
+	DW L4361, L3779-L3783
+L3781:
+	DB 186, 34, "s1"
+L3782:
+	DB 105, 193, "s2"
+L3783:
+	DB 110, 219, "s3"
+L3784:
+	DW L3785, L3783-L3786
+L3785:
+	DW L3788, L3789-L3781
+L3786:
+	DB 244, 197, "s6"
+L3787:
+	DB 44, 117, "s7"
+L3788:
+	DB 17, 64, "s8"
+L3789:
+	DB 59, 200, "s9"
+L3790:
+	DB 164, 116, "s0"
+L3791:
+	DB 88, 4, "s1"
+L3792:
+	DW L3789, L3793-L3795
+L3793:
+	DW L3793, L3794-L3790
+L3794:
+	DW L3796, L3790-L3790
+L3795:
+	DW L3791, L3791-L3791
+L3796:
+	DW L3797, L3799-L3797
+L3797:
+	DW L4117, L3797-L3795
+L3798:
+	DB 66, 231, "s8"
+L3799:
+	DB 247, 207, "s9"
+L3800:
+	DB 228, 207, "s0"
+L3801:
+	DW L3799, L3805-L3798
+L3802:
+	DW L3799, L3803-L3800
+L3803:
+	DB 110, 216, "s3"
+L3804:
+	DB 120, 85, "s4"
+L3805:
+	DW L1023, L3807-L3804
+L3806:
+	DW L3805, L3807-L3805
+L3807:
+	DW L3807, L3809-L3807
+L3808:
+	DB 76, 71, "s8"
+L3809:
+	DW L1675, L3808-L3806
+L3810:
+	DW L3812, L3811-L3809
+L3811:
+	DW L1516, L3807-L3807
+L3812:
+	DW L3809, L3810-L3813
+L3813:
+	DW L4722, L3809-L3816
+L3814:
+	DB 254, 247, "s4"
+L3815:
+	DW L3609, L3811-L3814
+L3816:
+	DW L3817, L3817-L3819
+L3817:
+	DW L71, L3815-L3813
+L3818:
+	DB 249, 148, "s8"
+L3819:
+	DB 92, 151, "s9"
+L3820:
+	DW L3819, L3819-L3818
+L3821:
+	DW L3821, L3817-L3821
+L3822:
+	DB 166, 100, "s2"
+L3823:
+	DB 241, 37, "s3"
+L3824:
+	DB 118, 172, "s4"
+L3825:
+	DB 136, 158, "s5"
+L3826:
+	DW L3826, L3824-L3825
+L3827:
+	DB 119, 34, "s7"
+L3828:
+	DW L3831, L3831-L3831
+L3829:
+	DW L4801, L3829-L3831
+L3830:
+	DW L3826, L3833-L3831
+L3831:
+	DB 233, 75, "s1"
+L3832:
+	DW L3828, L3828-L3830
+L3833:
+	DB 216, 243, "s3"
+L3834:
+	DB 233, 137, "s4"
+L3835:
+	DB 94, 104, "s5"
+L3836:
+	DB 191, 51, "s6"
+L3837:
+	DW L3839, L3839-L3840
+L3838:
+	DB 233, 188, "s8"
+L3839:
+	DW L3839, L3838-L3842
+L3840:
+	DB 252, 112, "s0"
+L3841:
+	DW L4938, L3840-L3841
+L3842:
+	DB 49, 160, "s2"
+L3843:
+	DB 155, 118, "s3"
+L3844:
+	DW L1470, L3841-L3845
+L3845:
+	DW L3845, L3848-L3844
+L3846:
+	DB 100, 112, "s6"
+L3847:
+	DB 220, 134, "s7"
+L3848:
+	DW L3849, L3852-L3851
+L3849:
+	DW L3852, L3853-L3850
+L3850:
+	DW L3849, L3849-L3846
+L3851:
+	DB 60, 255, "s1"
+L3852:
+	DB 251, 47, "s2"
+L3853:
+	DB 71, 167, "s3"
+L3854:
+	DW L1309, L3853-L3857
+L3855:
+	DB 2, 104, "s5"
+L3856:
+	DW L2076, L3855-L3852
+L3857:
+	DB 235, 70, "s7"
+L3858:
+	DB 241, 37, "s8"
+L3859:
+	DB 39, 210, "s9"
+L3860:
+	DW L4215, L3856-L3860
+L3861:
+	DB 180, 249, "s1"
+L3862:
+	DB 247, 22, "s2"
+L3863:
+	DW L3867, L3860-L3867
+L3864:
+	DB 210, 15, "s4"
+L3865:
+	DW L3869, L3869-L3861
+L3866:
+	DW L3862, L3867-L3866
+L3867:
+	DW L3871, L3869-L3869
+L3868:
+	DB 6, 125, "s8"
+L3869:
+	DW L3867, L3866-L3865
+L3870:
+	DB 115, 217, "s0"
+L3871:
+	DW L3874, L3875-L3868
+L3872:
+	DW L3869, L3870-L3869
+L3873:
+	DW L3873, L3870-L3872
+L3874:
+	DB 151, 8, "s4"
+L3875:
+	DB 153, 235, "s5"
+L3876:
+	DB 73, 103, "s6"
+L3877:
+	DW L3881, L3875-L3876
+L3878:
+	DW L3880, L3877-L3876
+L3879:
+	DB 240, 80, "s9"
+L3880:
+	DB 210, 34, "s0"
+L3881:
+	DW L3883, L3885-L3877
+L3882:
+	DB 83, 243, "s2"
+L3883:
+	DB 14, 69, "s3"
+L3884:
+	DW L3882, L3882-L3882
+L3885:
+	DB 250, 206, "s5"
+L3886:
+	DW L87, L3890-L3882
+L3887:
+	DW L3884, L3885-L3884
+L3888:
+	DW L3890, L3889-L3889
+L3889:
+	DB 170, 68, "s9"
+L3890:
+	DW L3890, L3894-L3888
+L3891:
+	DW L3887, L3890-L3891
+L3892:
+	DW L860, L3892-L3895
+L3893:
+	DB 132, 110, "s3"
+L3894:
+	DB 58, 110, "s4"
+L3895:
+	DB 176, 33, "s5"
+L3896:
+	DB 120, 71, "s6"
+L3897:
+	DW L1, L3896-L3898
+L3898:
+	DW L3898, L3898-L3901
+L3899:
+	DW L3896, L3898-L3895
+L3900:
+	DW L3899, L3901-L3903
+L3901:
+	DW L3899, L3897-L3900
+L3902:
+	DB 61, 198, "s2"
+L3903:
+	DB 179, 27, "s3"
+L3904:
+	DW L4173, L3904-L3901
+L3905:
+	DW L3907, L3901-L3904
+L3906:
+	DW L4341, L3904-L3907
+L3907:
+	DW L3911, L3909-L3908
+L3908:
+	DB 253, 79, "s8"
+L3909:
+	DB 5, 204, "s9"
+L3910:
+	DW L3906, L3906-L3910
+L3911:
+	DW L3909, L3913-L3913
+L3912:
+	DW L3908, L3912-L3911
+L3913:
+	DB 135, 219, "s3"
+L3914:
+	DB 95, 109, "s4"
+L3915:
+	DB 31, 102, "s5"
+L3916:
+	DW L3919, L3918-L3919
+L3917:
+	DW L4201, L3918-L3914
+L3918:
+	DB 99, 37, "s8"
+L3919:
+	DW L4840, L3917-L3915
+L3920:
+	DB 63, 254, "s0"
+L3921:
+	DW L3921, L3917-L3921
+L3922:
+	DB 30, 194, "s2"
+L3923:
+	DW L2098, L3926-L3924
+L3924:
+	DB 146, 212, "s4"
+L3925:
+	DB 38, 31, "s5"
+L3926:
+	DB 195, 16, "s6"
+L3927:
+	DW L3930, L3929-L3925
+L3928:
+	DB 6, 14, "s8"
+L3929:
+	DW L2192, L3926-L3930
+L3930:
+	DW L3933, L3930-L3933
+L3931:
+	DB 91, 141, "s1"
+L3932:
+	DW L3936, L3932-L3931
+L3933:
+	DB 18, 247, "s3"
+L3934:
+	DB 83, 188, "s4"
+L3935:
+	DB 234, 53, "s5"
+L3936:
+	DW L1757, L3933-L3934
+L3937:
+	DW L3936, L3936-L3934
+L3938:
+	DW L3941, L3939-L3936
+L3939:
+	DB 165, 43, "s9"
+L3940:
+	DB 241, 165, "s0"
+L3941:
+	DW L3937, L3941-L3941
+L3942:
+	DB 203, 190, "s2"
+L3943:
+	DB 249, 5, "s3"
+L3944:
+	DW L4809, L3946-L3943
+L3945:
+	DW L3944, L3943-L3945
+L3946:
+	DW L3943, L3942-L3943
+L3947:
+	DW L3946, L3948-L3949
+L3948:
+	DW L1794, L3951-L3948
+L3949:
+	DB 230, 77, "s9"
+L3950:
+	DB 212, 130, "s0"
+L3951:
+	DW L3948, L3948-L3949
+L3952:
+	DW L3956, L3951-L3952
+L3953:
+	DW L419, L3951-L3957
+L3954:
+	DB 198, 251, "s4"
+L3955:
+	DW L4135, L3954-L3951
+L3956:
+	DB 69, 241, "s6"
+L3957:
+	DW L3960, L3961-L3960
+L3958:
+	DB 255, 132, "s8"
+L3959:
+	DW L4094, L3961-L3961
+L3960:
+	DW L3961, L3957-L3963
+L3961:
+	DW L3961, L3963-L3962
+L3962:
+	DB 103, 13, "s2"
+L3963:
+	DB 3, 104, "s3"
+L3964:
+	DB 72, 8, "s4"
+L3965:
+	DB 105, 237, "s5"
+L3966:
+	DB 107, 203, "s6"
+L3967:
+	DW L3968, L3967-L3963
+L3968:
+	DB 113, 156, "s8"
+L3969:
+	DW L3971, L3972-L3966
+L3970:
+	DW L3966, L3968-L3974
+L3971:
+	DB 46, 163, "s1"
+L3972:
+	DB 4, 23, "s2"
+L3973:
+	DW L3977, L3973-L3969
+L3974:
+	DW L3970, L3977-L3977
+L3975:
+	DW L2291, L3976-L3972
+L3976:
+	DW L3976, L3979-L3975
+L3977:
+	DB 189, 202, "s7"
+L3978:
+	DB 219, 188, "s8"
+L3979:
+	DW L3979, L3975-L3975
+L3980:
+	DW L3976, L3981-L3977
+L3981:
+	DB 39, 190, "s1"
+L3982:
+	DB 55, 89, "s2"
+L3983:
+	DW L3987, L3979-L3987
+L3984:
+	DW L3980, L3980-L3984
+L3985:
+	DB 91, 122, "s5"
+L3986:
+	DW L3986, L3989-L3987
+L3987:
+	DW L3984, L3984-L3987
+L3988:
+	DB 173, 67, "s8"
+L3989:
+	DB 244, 57, "s9"
+L3990:
+	DW L3989, L3991-L3986
+L3991:
+	DB 35, 15, "s1"
+L3992:
+	DB 148, 92, "s2"
+L3993:
+	DW L2246, L3996-L3994
+L3994:
+	DW L3997, L3993-L3990
+L3995:
+	DW L3998, L3997-L3999
+L3996:
+	DW L3993, L3995-L3999
+L3997:
+	DW L3999, L3995-L3994
+L3998:
+	DW L3995, L4001-L4002
+L3999:
+	DB 54, 4, "s9"
+L4000:
+	DB 176, 66, "s0"
+L4001:
+	DW L4004, L4000-L3998
+L4002:
+	DW L3999, L4001-L4003
+L4003:
+	DW L4006, L4001-L4004
+L4004:
+	DW L1569, L4001-L4006
+L4005:
+	DW L4003, L4003-L4004
+L4006:
+	DW L4002, L4009-L4009
+L4007:
+	DW L4006, L4011-L4008
+L4008:
+	DB 81, 125, "s8"
+L4009:
+	DW L4006, L4010-L4010
+L4010:
+	DW L4013, L4013-L4010
+L4011:
+	DB 185, 124, "s1"
+L4012:
+	DB 131, 252, "s2"
+L4013:
+	DB 62, 49, "s3"
+L4014:
+	DB 64, 34, "s4"
+L4015:
+	DW L4012, L4014-L4011
+L4016:
+	DB 204, 180, "s6"
+L4017:
+	DB 42, 153, "s7"
+L4018:
+	DW L4017, L4019-L4019
+L4019:
+	DW L4020, L4016-L4023
+L4020:
+	DB 215, 223, "s0"
+L4021:
+	DB 204, 200, "s1"
+L4022:
+	DW L4186, L4018-L4022
+L4023:
+	DW L4020, L4019-L4021
+L4024:
+	DB 147, 195, "s4"
+L4025:
+	DW L4026, L4028-L4029
+L4026:
+	DW L2133, L4028-L4022
+L4027:
+	DW L4026, L4030-L4023
+L4028:
+	DB 30, 90, "s8"
+L4029:
+	DB 58, 47, "s9"
+L4030:
+	DB 89, 225, "s0"
+L4031:
+	DW L4035, L4029-L4030
+L4032:
+	DW L4031, L4033-L4036
+L4033:
+	DB 144, 158, "s3"
+L4034:
+	DW L3023, L4038-L4030
+L4035:
+	DW L4033, L4037-L4032
+L4036:
+	DB 31, 102, "s6"
+L4037:
+	DB 184, 191, "s7"
+L4038:
+	DW L541, L4035-L4042
+L4039:
+	DW L4035, L4042-L4042
+L4040:
+	DW L672, L4040-L4037
+L4041:
+	DB 56, 71, "s1"
+L4042:
+	DW L4041, L4039-L4040
+L4043:
+	DB 228, 195, "s3"
+L4044:
+	DB 15, 170, "s4"
+L4045:
+	DW L4044, L4044-L4041
+L4046:
+	DW L4043, L4047-L4043
+L4047:
+	DB 252, 66, "s7"
+L4048:
+	DW L2943, L4044-L4050
+L4049:
+	DB 223, 5, "s9"
+L4050:
+	DB 165, 253, "s0"
+L4051:
+	DB 10, 89, "s1"
+L4052:
+	DW L4049, L4051-L4054
+L4053:
+	DB 254, 182, "s3"
+L4054:
+	DB 205, 159, "s4"
+L4055:
+	DB 36, 218, "s5"
+L4056:
+	DW L4056, L4055-L4057
+L4057:
+	DW L4058, L4059-L4061
+L4058:
+	DW L3611, L4055-L4059
+L4059:
+	DW L4058, L4063-L4060
+L4060:
+	DW L1181, L4062-L4062
+L4061:
+	DW L4065, L4064-L4057
+L4062:
+	DW L4066, L4061-L4065
+L4063:
+	DB 95, 8, "s3"
+L4064:
+	DB 200, 47, "s4"
+L4065:
+	DW L4464, L4066-L4068
+L4066:
+	DW L4065, L4063-L4066
+L4067:
+	DB 56, 202, "s7"
+L4068:
+	DW L3484, L4067-L4067
+L4069:
+	DW L4072, L4072-L4072
+L4070:
+	DB 244, 18, "s0"
+L4071:
+	DW L4072, L4075-L4071
+L4072:
+	DB 113, 116, "s2"
+L4073:
+	DB 38, 63, "s3"
+L4074:
+	DW L2891, L4072-L4075
+L4075:
+	DW L4074, L4074-L4078
+L4076:
+	DB 97, 59, "s6"
+L4077:
+	DW L2076, L4074-L4077
+L4078:
+	DW L4074, L4077-L4077
+L4079:
+	DB 66, 60, "s9"
+L4080:
+	DB 82, 175, "s0"
+L4081:
+	DB 151, 75, "s1"
+L4082:
+	DW L3439, L4086-L4084
+L4083:
+	DW L4083, L4084-L4084
+L4084:
+	DW L4084, L4084-L4081
+L4085:
+	DB 57, 18, "s5"
+L4086:
+	DB 177, 207, "s6"
+L4087:
+	DW L4086, L4090-L4091
+L4088:
+	DW L4085, L4091-L4092
+L4089:
+	DB 233, 154, "s9"
+L4090:
+	DB 239, 173, "s0"
+L4091:
+	DB 70, 61, "s1"
+L4092:
+	DW L4091, L4091-L4096
+L4093:
+	DB 218, 251, "s3"
+L4094:
+	DB 162, 175, "s4"
+L4095:
+	DB 75, 131, "s5"
+L4096:
+	DB 12, 243, "s6"
+L4097:
+	DB 190, 111, "s7"
+L4098:
+	DW L4102, L4095-L4095
+L4099:
+	DB 235, 105, "s9"
+L4100:
+	DW L4104, L4096-L4102
+L4101:
+	DB 222, 201, "s1"
+L4102:
+	DB 159, 119, "s2"
+L4103:
+	DB 3, 114, "s3"
+L4104:
+	DB 168, 254, "s4"
+L4105:
+	DB 197, 204, "s5"
+L4106:
+	DW L4107, L4102-L4102
+L4107:
+	DB 125, 0, "s7"
+L4108:
+	DW L2577, L4109-L4108
+L4109:
+	DW L4110, L4109-L4113
+L4110:
+	DB 171, 171, "s0"
+L4111:
+	DB 184, 247, "s1"
+L4112:
+	DB 41, 68, "s2"
+L4113:
+	DB 185, 186, "s3"
+L4114:
+	DB 0, 203, "s4"
+L4115:
+	DW L4114, L4113-L4116
+L4116:
+	DW L4612, L4114-L4120
+L4117:
+	DW L4119, L4119-L4116
+L4118:
+	DB 123, 237, "s8"
+L4119:
+	DB 197, 31, "s9"
+L4120:
+	DW L4121, L4124-L4117
+L4121:
+	DW L4117, L4118-L4118
+L4122:
+	DW L4122, L4118-L4125
+L4123:
+	DW L975, L4122-L4125
+L4124:
+	DW L265, L4120-L4128
+L4125:
+	DW L4128, L4121-L4127
+L4126:
+	DB 221, 67, "s6"
+L4127:
+	DW L4124, L4131-L4128
+L4128:
+	DW L4128, L4125-L4129
+L4129:
+	DW L4131, L4128-L4127
+L4130:
+	DW L4133, L4129-L4134
+L4131:
+	DB 65, 200, "s1"
+L4132:
+	DW L1710, L4130-L4132
+L4133:
+	DB 10, 60, "s3"
+L4134:
+	DB 221, 221, "s4"
+L4135:
+	DB 21, 234, "s5"
+L4136:
+	DB 217, 43, "s6"
+L4137:
+	DW L4140, L4140-L4141
+L4138:
+	DB 74, 113, "s8"
+L4139:
+	DB 225, 134, "s9"
+L4140:
+	DB 66, 254, "s0"
+L4141:
+	DW L4144, L4140-L4139
+L4142:
+	DB 223, 186, "s2"
+L4143:
+	DB 201, 176, "s3"
+L4144:
+	DW L2969, L4143-L4143
+L4145:
+	DB 222, 172, "s5"
+L4146:
+	DB 147, 33, "s6"
+L4147:
+	DW L4145, L4148-L4148
+L4148:
+	DB 148, 134, "s8"
+L4149:
+	DB 252, 255, "s9"
+L4150:
+	DW L4151, L4153-L4151
+L4151:
+	DB 180, 155, "s1"
+L4152:
+	DB 125, 2, "s2"
+L4153:
+	DW L4150, L4157-L4156
+L4154:
+	DW L3411, L4158-L4153
+L4155:
+	DW L4159, L4159-L4152
+L4156:
+	DW L4154, L4157-L4160
+L4157:
+	DB 28, 209, "s7"
+L4158:
+	DB 157, 185, "s8"
+L4159:
+	DB 175, 102, "s9"
+L4160:
+	DB 41, 244, "s0"
+L4161:
+	DB 172, 184, "s1"
+L4162:
+	DW L4166, L4166-L4159
+L4163:
+	DW L4166, L4160-L4163
+L4164:
+	DB 198, 223, "s4"
+L4165:
+	DW L522, L4166-L4166
+L4166:
+	DB 249, 1, "s6"
+L4167:
+	DB 137, 47, "s7"
+L4168:
+	DB 185, 36, "s8"
+L4169:
+	DW L4165, L4171-L4167
+L4170:
+	DW L4171, L4169-L4170
+L4171:
+	DB 200, 254, "s1"
+L4172:
+	DB 187, 34, "s2"
+L4173:
+	DW L4169, L4174-L4175
+L4174:
+	DB 179, 48, "s4"
+L4175:
+	DB 81, 175, "s5"
+L4176:
+	DW L4179, L4177-L4172
+L4177:
+	DW L4178, L4177-L4178
+L4178:
+	DW L4182, L4178-L4177
+L4179:
+	DW L4183, L4181-L4182
+L4180:
+	DB 120, 66, "s0"
+L4181:
+	DW L4312, L4181-L4185
+L4182:
+	DB 242, 209, "s2"
+L4183:
+	DB 202, 123, "s3"
+L4184:
+	DB 12, 204, "s4"
+L4185:
+	DW L4186, L4186-L4185
+L4186:
+	DW L4186, L4190-L4184
+L4187:
+	DB 158, 118, "s7"
+L4188:
+	DB 199, 157, "s8"
+L4189:
+	DB 102, 108, "s9"
+L4190:
+	DW L4189, L4193-L4187
+L4191:
+	DW L4195, L4189-L4189
+L4192:
+	DB 228, 161, "s2"
+L4193:
+	DB 75, 116, "s3"
+L4194:
+	DW L4196, L4197-L4197
+L4195:
+	DW L3876, L4196-L4191
+L4196:
+	DB 181, 127, "s6"
+L4197:
+	DW L4201, L4197-L4195
+L4198:
+	DW L4197, L4196-L4201
+L4199:
+	DB 210, 3, "s9"
+L4200:
+	DW L4196, L4204-L4202
+L4201:
+	DW L4205, L4197-L4205
+L4202:
+	DW L4201, L4201-L4198
+L4203:
+	DW L1004, L4207-L4203
+L4204:
+	DB 48, 213, "s4"
+L4205:
+	DB 98, 74, "s5"
+L4206:
+	DB 115, 23, "s6"
+L4207:
+	DB 152, 126, "s7"
+L4208:
+	DW L591, L4212-L4204
+L4209:
+	DW L1514, L4210-L4212
+L4210:
+	DB 4, 37, "s0"
+L4211:
+	DW L4207, L4213-L4211
+L4212:
+	DB 76, 191, "s2"
+L4213:
+	DW L1718, L4210-L4215
+L4214:
+	DB 136, 29, "s4"
+L4215:
+	DB 208, 77, "s5"
+L4216:
+	DW L4213, L4212-L4214
+L4217:
+	DB 69, 163, "s7"
+L4218:
+	DW L4103, L4218-L4216
+L4219:
+	DB 52, 146, "s9"
+L4220:
+	DW L4217, L4216-L4217
+L4221:
+	DB 35, 226, "s1"
+L4222:
+	DW L4432, L4219-L4226
+L4223:
+	DW L4224, L4223-L4227
+L4224:
+	DB 244, 164, "s4"
+L4225:
+	DW L61, L4228-L4228
+L4226:
+	DB 169, 81, "s6"
+L4227:
+	DW L3009, L4226-L4229
+L4228:
+	DB 29, 152, "s8"
+L4229:
+	DW L4228, L4229-L4227
+L4230:
+	DB 151, 173, "s0"
+L4231:
+	DW L4228, L4227-L4235
+L4232:
+	DB 32, 169, "s2"
+L4233:
+	DW L4230, L4236-L4230
+L4234:
+	DB 241, 117, "s4"
+L4235:
+	DB 153, 238, "s5"
+L4236:
+	DB 52, 87, "s6"
+L4237:
+	DW L4235, L4235-L4241
+L4238:
+	DB 58, 65, "s8"
+L4239:
+	DB 127, 48, "s9"
+L4240:
+	DW L4242, L4242-L4239
+L4241:
+	DW L3510, L4245-L4244
+L4242:
+	DW L4244, L4243-L4246
+L4243:
+	DW L4246, L4246-L4247
+L4244:
+	DW L4241, L4243-L4248
+L4245:
+	DB 109, 73, "s5"
+L4246:
+	DB 1, 236, "s6"
+L4247:
+	DW L4250, L4248-L4246
+L4248:
+	DB 85, 218, "s8"
+L4249:
+	DB 13, 80, "s9"
+L4250:
+	DB 142, 76, "s0"
+L4251:
+	DB 141, 71, "s1"
+L4252:
+	DB 212, 33, "s2"
+L4253:
+	DW L4255, L4257-L4252
+L4254:
+	DW L2064, L4258-L4253
+L4255:
+	DW L4252, L4252-L4252
+L4256:
+	DW L4258, L4253-L4259
+L4257:
+	DW L4259, L4259-L4254
+L4258:
+	DB 234, 142, "s8"
+L4259:
+	DW L4263, L4256-L4260
+L4260:
+	DW L3083, L4259-L4263
+L4261:
+	DW L4264, L4264-L4259
+L4262:
+	DW L4264, L4262-L4261
+L4263:
+	DB 115, 64, "s3"
+L4264:
+	DB 135, 244, "s4"
+L4265:
+	DB 6, 69, "s5"
+L4266:
+	DW L4264, L4269-L4264
+L4267:
+	DW L4270, L4265-L4265
+L4268:
+	DB 57, 249, "s8"
+L4269:
+	DW L4273, L4267-L4267
+L4270:
+	DW L4274, L4273-L4271
+L4271:
+	DW L4270, L4273-L4270
+L4272:
+	DW L4272, L4273-L4270
+L4273:
+	DB 237, 2, "s3"
+L4274:
+	DW L1033, L4273-L4271
+L4275:
+	DW L4279, L4277-L4271
+L4276:
+	DW L4272, L4279-L4274
+L4277:
+	DB 108, 29, "s7"
+L4278:
+	DB 214, 253, "s8"
+L4279:
+	DB 158, 161, "s9"
+L4280:
+	DW L4277, L4282-L4284
+L4281:
+	DB 52, 20, "s1"
+L4282:
+	DW L4281, L4279-L4286
+L4283:
+	DW L4280, L4284-L4282
+L4284:
+	DB 115, 153, "s4"
+L4285:
+	DW L2920, L4284-L4286
+L4286:
+	DW L4282, L4287-L4284
+L4287:
+	DW L4287, L4284-L4285
+L4288:
+	DB 24, 18, "s8"
+L4289:
+	DB 138, 211, "s9"
+L4290:
+	DW L4286, L4288-L4286
+L4291:
+	DW L4288, L4293-L4295
+L4292:
+	DW L1297, L4296-L4296
+L4293:
+	DW L4289, L4291-L4295
+L4294:
+	DB 223, 236, "s4"
+L4295:
+	DW L3164, L4294-L4295
+L4296:
+	DW L3912, L4293-L4296
+L4297:
+	DW L4294, L4298-L4298
+L4298:
+	DW L4297, L4298-L4300
+L4299:
+	DB 82, 62, "s9"
+L4300:
+	DW L4298, L4304-L4301
+L4301:
+	DW L289, L4303-L4297
+L4302:
+	DB 20, 199, "s2"
+L4303:
+	DW L3770, L4303-L4302
+L4304:
+	DB 132, 117, "s4"
+L4305:
+	DB 19, 215, "s5"
+L4306:
+	DW L4303, L4307-L4303
+L4307:
+	DW L4304, L4308-L4311
+L4308:
+	DW L4311, L4308-L4309
+L4309:
+	DW L2334, L4307-L4308
+L4310:
+	DW L943, L4307-L4312
+L4311:
+	DB 161, 143, "s1"
+L4312:
+	DB 199, 49, "s2"
+L4313:
+	DB 47, 117, "s3"
+L4314:
+	DB 183, 45, "s4"
+L4315:
+	DB 65, 59, "s5"
+L4316:
+	DW L4313, L4316-L4315
+L4317:
+	DB 11, 43, "s7"
+L4318:
+	DW L4318, L4315-L4314
+L4319:
+	DW L4315, L4316-L4322
+L4320:
+	DB 35, 205, "s0"
+L4321:
+	DW L4319, L4319-L4322
+L4322:
+	DW L4891, L4318-L4321
+L4323:
+	DW L4324, L4324-L4320
+L4324:
+	DW L4324, L4324-L4322
+L4325:
+	DW L3625, L4328-L4328
+L4326:
+	DB 80, 237, "s6"
+L4327:
+	DB 102, 135, "s7"
+L4328:
+	DW L1059, L4325-L4324
+L4329:
+	DW L1180, L4333-L4328
+L4330:
+	DW L4329, L4328-L4333
+L4331:
+	DB 12, 29, "s1"
+L4332:
+	DB 40, 171, "s2"
+L4333:
+	DB 114, 44, "s3"
+L4334:
+	DB 172, 30, "s4"
+L4335:
+	DW L4334, L4335-L4334
+L4336:
+	DW L4340, L4340-L4335
+L4337:
+	DB 11, 145, "s7"
+L4338:
+	DB 96, 2, "s8"
+L4339:
+	DW L4340, L4341-L4338
+L4340:
+	DW L4339, L4336-L4336
+L4341:
+	DB 190, 77, "s1"
+L4342:
+	DB 189, 223, "s2"
+L4343:
+	DB 238, 152, "s3"
+L4344:
+	DB 231, 123, "s4"
+L4345:
+	DW L3419, L4348-L4343
+L4346:
+	DW L2685, L4348-L4342
+L4347:
+	DB 111, 206, "s7"
+L4348:
+	DB 52, 63, "s8"
+L4349:
+	DB 82, 174, "s9"
+L4350:
+	DW L4346, L4350-L4351
+L4351:
+	DW L3561, L4350-L4351
+L4352:
+	DW L4352, L4351-L4356
+L4353:
+	DB 37, 7, "s3"
+L4354:
+	DB 21, 47, "s4"
+L4355:
+	DW L4351, L4359-L4352
+L4356:
+	DW L2310, L4355-L4356
+L4357:
+	DB 134, 94, "s7"
+L4358:
+	DB 168, 84, "s8"
+L4359:
+	DB 31, 83, "s9"
+L4360:
+	DW L4361, L4362-L4356
+L4361:
+	DW L4357, L4357-L4362
+L4362:
+	DB 181, 33, "s2"
+L4363:
+	DB 129, 182, "s3"
+L4364:
+	DB 173, 226, "s4"
+L4365:
+	DB 153, 254, "s5"
+L4366:
+	DB 117, 89, "s6"
+L4367:
+	DB 59, 1, "s7"
+L4368:
+	DB 130, 87, "s8"
+L4369:
+	DB 77, 135, "s9"
+L4370:
+	DB 183, 230, "s0"
+L4371:
+	DW L2380, L4373-L4370
+L4372:
+	DB 102, 106, "s2"
+L4373:
+	DW L4372, L4370-L4377
+L4374:
+	DW L4370, L4371-L4375
+L4375:
+	DB 240, 27, "s5"
+L4376:
+	DB 155, 188, "s6"
+L4377:
+	DW L4378, L4374-L4373
+L4378:
+	DW L4382, L4374-L4380
+L4379:
+	DB 62, 104, "s9"
+L4380:
+	DW L4913, L4380-L4381
+L4381:
+	DB 167, 29, "s1"
+L4382:
+	DB 98, 106, "s2"
+L4383:
+	DW L4385, L4380-L4379
+L4384:
+	DW L4387, L4383-L4388
+L4385:
+	DB 200, 96, "s5"
+L4386:
+	DW L4383, L4389-L4388
+L4387:
+	DB 3, 82, "s7"
+L4388:
+	DW L4388, L4385-L4388
+L4389:
+	DB 174, 152, "s9"
+L4390:
+	DB 96, 185, "s0"
+L4391:
+	DB 153, 73, "s1"
+L4392:
+	DB 11, 21, "s2"
+L4393:
+	DB 5, 92, "s3"
+L4394:
+	DW L4396, L4396-L4393
+L4395:
+	DB 170, 88, "s5"
+L4396:
+	DW L4392, L4399-L4395
+L4397:
+	DB 185, 38, "s7"
+L4398:
+	DB 240, 218, "s8"
+L4399:
+	DB 145, 95, "s9"
+L4400:
+	DW L4397, L4402-L4404
+L4401:
+	DW L4398, L4403-L4402
+L4402:
+	DW L4405, L4398-L4401
+L4403:
+	DB 118, 116, "s3"
+L4404:
+	DB 115, 54, "s4"
+L4405:
+	DW L4407, L4406-L4403
+L4406:
+	DW L4408, L4405-L4410
+L4407:
+	DW L1834, L4405-L4408
+L4408:
+	DW L4409, L4410-L4406
+L4409:
+	DB 153, 61, "s9"
+L4410:
+	DW L4275, L4407-L4410
+L4411:
+	DB 217, 117, "s1"
+L4412:
+	DB 52, 238, "s2"
+L4413:
+	DB 50, 108, "s3"
+L4414:
+	DB 59, 232, "s4"
+L4415:
+	DW L4413, L4415-L4414
+L4416:
+	DW L1641, L4418-L4420
+L4417:
+	DB 95, 201, "s7"
+L4418:
+	DW L4422, L4418-L4418
+L4419:
+	DB 228, 171, "s9"
+L4420:
+	DB 2, 9, "s0"
+L4421:
+	DW L4424, L4421-L4423
+L4422:
+	DB 235, 113, "s2"
+L4423:
+	DB 56, 185, "s3"
+L4424:
+	DB 111, 52, "s4"
+L4425:
+	DW L4429, L4426-L4423
+L4426:
+	DW L4423, L4424-L4427
+L4427:
+	DW L4431, L4430-L4425
+L4428:
+	DW L4430, L4429-L4426
+L4429:
+	DB 180, 174, "s9"
+L4430:
+	DB 216, 201, "s0"
+L4431:
+	DB 200, 85, "s1"
+L4432:
+	DW L4435, L4428-L4430
+L4433:
+	DW L4432, L4437-L4437
+L4434:
+	DB 224, 41, "s4"
+L4435:
+	DW L4437, L4439-L4438
+L4436:
+	DB 95, 45, "s6"
+L4437:
+	DW L4440, L4437-L4438
+L4438:
+	DW L4442, L4436-L4442
+L4439:
+	DW L4440, L4442-L4436
+L4440:
+	DW L4436, L4442-L4443
+L4441:
+	DB 191, 111, "s1"
+L4442:
+	DB 234, 86, "s2"
+L4443:
+	DW L1009, L4442-L4440
+L4444:
+	DW L4445, L4442-L4440
+L4445:
+	DB 103, 68, "s5"
+L4446:
+	DB 63, 24, "s6"
+L4447:
+	DB 83, 86, "s7"
+L4448:
+	DW L885, L4451-L4447
+L4449:
+	DB 164, 182, "s9"
+L4450:
+	DB 143, 120, "s0"
+L4451:
+	DB 58, 218, "s1"
+L4452:
+	DB 214, 196, "s2"
+L4453:
+	DB 34, 195, "s3"
+L4454:
+	DB 192, 227, "s4"
+L4455:
+	DW L4453, L4457-L4454
+L4456:
+	DW L4457, L4453-L4455
+L4457:
+	DW L4453, L4461-L4454
+L4458:
+	DB 142, 9, "s8"
+L4459:
+	DB 61, 108, "s9"
+L4460:
+	DB 117, 169, "s0"
+L4461:
+	DW L2130, L4461-L4465
+L4462:
+	DB 126, 120, "s2"
+L4463:
+	DW L4465, L4465-L4466
+L4464:
+	DW L2134, L4462-L4462
+L4465:
+	DW L4064, L4463-L4466
+L4466:
+	DW L4465, L4465-L4468
+L4467:
+	DB 194, 125, "s7"
+L4468:
+	DB 122, 151, "s8"
+L4469:
+	DB 21, 88, "s9"
+L4470:
+	DB 58, 238, "s0"
+L4471:
+	DB 200, 227, "s1"
+L4472:
+	DB 73, 63, "s2"
+L4473:
+	DW L4469, L4474-L4477
+L4474:
+	DW L3319, L4478-L4473
+L4475:
+	DW L4477, L4477-L4479
+L4476:
+	DW L4474, L4474-L4480
+L4477:
+	DB 183, 98, "s7"
+L4478:
+	DW L4481, L4478-L4476
+L4479:
+	DW L4479, L4478-L4479
+L4480:
+	DW L4481, L4483-L4483
+L4481:
+	DB 115, 65, "s1"
+L4482:
+	DB 105, 248, "s2"
+L4483:
+	DW L1163, L4486-L4485
+L4484:
+	DB 27, 138, "s4"
+L4485:
+	DB 128, 37, "s5"
+L4486:
+	DW L4488, L4485-L4487
+L4487:
+	DW L3719, L4488-L4483
+L4488:
+	DW L4487, L4487-L4488
+L4489:
+	DW L4488, L4493-L4490
+L4490:
+	DB 157, 219, "s0"
+L4491:
+	DW L4488, L4494-L4489
+L4492:
+	DW L2500, L4495-L4496
+L4493:
+	DB 204, 120, "s3"
+L4494:
+	DW L1752, L4494-L4490
+L4495:
+	DW L4499, L4498-L4491
+L4496:
+	DB 234, 211, "s6"
+L4497:
+	DB 107, 69, "s7"
+L4498:
+	DW L4496, L4502-L4502
+L4499:
+	DB 222, 40, "s9"
+L4500:
+	DW L4501, L4499-L4503
+L4501:
+	DW L4505, L4497-L4502
+L4502:
+	DB 32, 26, "s2"
+L4503:
+	DW L4499, L4500-L4502
+L4504:
+	DW L4503, L4501-L4506
+L4505:
+	DB 171, 188, "s5"
+L4506:
+	DB 82, 210, "s6"
+L4507:
+	DB 98, 94, "s7"
+L4508:
+	DW L4507, L4506-L4509
+L4509:
+	DW L1129, L4505-L4508
+L4510:
+	DB 248, 240, "s0"
+L4511:
+	DB 251, 203, "s1"
+L4512:
+	DB 7, 210, "s2"
+L4513:
+	DB 106, 97, "s3"
+L4514:
+	DW L4518, L4517-L4511
+L4515:
+	DB 116, 69, "s5"
+L4516:
+	DW L4512, L4513-L4520
+L4517:
+	DB 68, 1, "s7"
+L4518:
+	DW L4516, L4518-L4519
+L4519:
+	DB 251, 221, "s9"
+L4520:
+	DW L4523, L4520-L4517
+L4521:
+	DW L4521, L4517-L4523
+L4522:
+	DB 21, 129, "s2"
+L4523:
+	DW L4523, L4525-L4524
+L4524:
+	DB 99, 116, "s4"
+L4525:
+	DB 254, 80, "s5"
+L4526:
+	DW L4525, L4525-L4528
+L4527:
+	DB 237, 113, "s7"
+L4528:
+	DB 114, 174, "s8"
+L4529:
+	DW L4530, L4525-L4529
+L4530:
+	DB 145, 254, "s0"
+L4531:
+	DB 110, 32, "s1"
+L4532:
+	DB 136, 249, "s2"
+L4533:
+	DB 149, 192, "s3"
+L4534:
+	DB 175, 4, "s4"
+L4535:
+	DW L3271, L4539-L4536
+L4536:
+	DB 66, 55, "s6"
+L4537:
+	DB 195, 152, "s7"
+L4538:
+	DB 95, 176, "s8"
+L4539:
+	DW L4540, L4539-L4537
+L4540:
+	DB 14, 239, "s0"
+L4541:
+	DB 119, 181, "s1"
+L4542:
+	DB 156, 238, "s2"
+L4543:
+	DB 32, 189, "s3"
+L4544:
+	DB 41, 43, "s4"
+L4545:
+	DW L4542, L4542-L4549
+L4546:
+	DW L4549, L4547-L4547
+L4547:
+	DW L4543, L4549-L4545
+L4548:
+	DB 184, 128, "s8"
+L4549:
+	DW L4548, L4550-L4549
+L4550:
+	DW L4549, L4547-L4553
+L4551:
+	DB 198, 225, "s1"
+L4552:
+	DB 184, 163, "s2"
+L4553:
+	DB 93, 18, "s3"
+L4554:
+	DW L4556, L4551-L4558
+L4555:
+	DW L4553, L4559-L4556
+L4556:
+	DW L4552, L4557-L4554
+L4557:
+	DW L565, L4555-L4559
+L4558:
+	DB 142, 171, "s8"
+L4559:
+	DB 178, 247, "s9"
+L4560:
+	DB 253, 159, "s0"
+L4561:
+	DB 181, 212, "s1"
+L4562:
+	DB 2, 106, "s2"
+L4563:
+	DW L4559, L4561-L4565
+L4564:
+	DB 54, 44, "s4"
+L4565:
+	DB 125, 14, "s5"
+L4566:
+	DW L4564, L4564-L4565
+L4567:
+	DW L4566, L4566-L4566
+L4568:
+	DW L4570, L4564-L4570
+L4569:
+	DW L1233, L4571-L4570
+L4570:
+	DB 23, 200, "s0"
+L4571:
+	DB 146, 150, "s1"
+L4572:
+	DB 216, 6, "s2"
+L4573:
+	DW L4574, L4576-L4571
+L4574:
+	DW L4577, L4573-L4572
+L4575:
+	DB 126, 150, "s5"
+L4576:
+	DW L4578, L4573-L4572
+L4577:
+	DW L4351, L4573-L4579
+L4578:
+	DB 136, 149, "s8"
+L4579:
+	DW L4575, L4580-L4578
+L4580:
+	DB 104, 62, "s0"
+L4581:
+	DW L4585, L4584-L4584
+L4582:
+	DW L4579, L4584-L4578
+L4583:
+	DW L4586, L4581-L4580
+L4584:
+	DW L4587, L4585-L4587
+L4585:
+	DW L4588, L4586-L4586
+L4586:
+	DB 154, 193, "s6"
+L4587:
+	DW L4587, L4591-L4589
+L4588:
+	DB 26, 145, "s8"
+L4589:
+	DW L4586, L4590-L4589
+L4590:
+	DB 239, 84, "s0"
+L4591:
+	DW L4587, L4587-L4595
+L4592:
+	DW L4592, L4588-L4596
+L4593:
+	DB 207, 133, "s3"
+L4594:
+	DW L2655, L4597-L4596
+L4595:
+	DB 196, 152, "s5"
+L4596:
+	DW L4600, L4595-L4595
+L4597:
+	DB 145, 101, "s7"
+L4598:
+	DW L2491, L4594-L4594
+L4599:
+	DW L4599, L4595-L4596
+L4600:
+	DB 208, 33, "s0"
+L4601:
+	DW L2591, L4603-L4600
+L4602:
+	DB 183, 209, "s2"
+L4603:
+	DB 226, 26, "s3"
+L4604:
+	DB 251, 111, "s4"
+L4605:
+	DW L4603, L4608-L4603
+L4606:
+	DW L4604, L4605-L4608
+L4607:
+	DB 77, 8, "s7"
+L4608:
+	DB 86, 111, "s8"
+L4609:
+	DB 48, 51, "s9"
+L4610:
+	DB 203, 104, "s0"
+L4611:
+	DW L4607, L4607-L4610
+L4612:
+	DW L4614, L4609-L4612
+L4613:
+	DW L4613, L4614-L4610
+L4614:
+	DB 47, 147, "s4"
+L4615:
+	DB 139, 217, "s5"
+L4616:
+	DW L2531, L4614-L4619
+L4617:
+	DB 179, 232, "s7"
+L4618:
+	DW L4618, L4615-L4622
+L4619:
+	DW L4621, L4617-L4618
+L4620:
+	DW L4622, L4618-L4622
+L4621:
+	DB 251, 6, "s1"
+L4622:
+	DW L4624, L4624-L4619
+L4623:
+	DB 230, 107, "s3"
+L4624:
+	DW L4621, L4621-L4625
+L4625:
+	DB 133, 97, "s5"
+L4626:
+	DB 174, 246, "s6"
+L4627:
+	DB 24, 145, "s7"
+L4628:
+	DW L763, L4630-L4630
+L4629:
+	DW L4625, L4631-L4629
+L4630:
+	DW L4627, L4631-L4629
+L4631:
+	DB 133, 217, "s1"
+L4632:
+	DW L4632, L4632-L4631
+L4633:
+	DW L4635, L4630-L4631
+L4634:
+	DW L4638, L4630-L4633
+L4635:
+	DB 70, 231, "s5"
+L4636:
+	DB 190, 147, "s6"
+L4637:
+	DW L4646, L4635-L4637
+L4638:
+	DB 108, 72, "s8"
+L4639:
+	DW L4638, L4638-L4640
+L4640:
+	DW L4637, L4638-L4640
+L4641:
+	DW L4639, L4644-L4642
+L4642:
+	DB 168, 109, "s2"
+L4643:
+	DB 134, 166, "s3"
+L4644:
+	DB 212, 219, "s4"
+L4645:
+	DB 103, 49, "s5"
+L4646:
+	DB 37, 226, "s6"
+L4647:
+	DB 63, 32, "s7"
+L4648:
+	DW L1349, L4652-L4644
+L4649:
+	DW L4653, L4645-L4648
+L4650:
+	DB 0, 165, "s0"
+L4651:
+	DW L4650, L4654-L4650
+L4652:
+	DB 95, 234, "s2"
+L4653:
+	DW L4650, L4653-L4652
+L4654:
+	DB 106, 37, "s4"
+L4655:
+	DW L4653, L4653-L4652
+L4656:
+	DB 252, 171, "s6"
+L4657:
+	DW L4655, L4654-L4658
+L4658:
+	DW L4661, L4658-L4656
+L4659:
+	DW L3643, L4663-L4660
+L4660:
+	DB 3, 93, "s0"
+L4661:
+	DB 250, 188, "s1"
+L4662:
+	DW L4663, L4658-L4661
+L4663:
+	DW L4666, L4664-L4662
+L4664:
+	DW L4665, L4667-L4661
+L4665:
+	DW L4665, L4664-L4667
+L4666:
+	DW L3602, L4667-L4662
+L4667:
+	DW L4667, L4671-L4665
+L4668:
+	DW L4670, L4667-L4668
+L4669:
+	DW L4673, L4671-L4667
+L4670:
+	DW L4672, L4674-L4667
+L4671:
+	DB 104, 22, "s1"
+L4672:
+	DB 147, 233, "s2"
+L4673:
+	DW L4677, L4672-L4671
+L4674:
+	DW L4673, L4671-L4671
+L4675:
+	DW L4677, L4672-L4675
+L4676:
+	DW L4673, L4675-L4677
+L4677:
+	DB 237, 56, "s7"
+L4678:
+	DB 125, 252, "s8"
+L4679:
+	DB 119, 25, "s9"
+L4680:
+	DW L4873, L4684-L4676
+L4681:
+	DW L4678, L4677-L4682
+L4682:
+	DB 202, 115, "s2"
+L4683:
+	DW L4684, L4686-L4679
+L4684:
+	DB 226, 176, "s4"
+L4685:
+	DW L4683, L4684-L4683
+L4686:
+	DW L3791, L4682-L4687
+L4687:
+	DB 99, 189, "s7"
+L4688:
+	DW L4688, L4690-L4685
+L4689:
+	DB 113, 30, "s9"
+L4690:
+	DB 88, 5, "s0"
+L4691:
+	DW L4690, L4689-L4695
+L4692:
+	DB 107, 110, "s2"
+L4693:
+	DW L4689, L4694-L4696
+L4694:
+	DB 94, 74, "s4"
+L4695:
+	DB 100, 155, "s5"
+L4696:
+	DB 51, 161, "s6"
+L4697:
+	DW L4700, L4699-L4701
+L4698:
+	DB 219, 206, "s8"
+L4699:
+	DW L4701, L4698-L4701
+L4700:
+	DW L4698, L4704-L4698
+L4701:
+	DW L4699, L4698-L4699
+L4702:
+	DB 148, 23, "s2"
+L4703:
+	DB 220, 25, "s3"
+L4704:
+	DW L4706, L4704-L4703
+L4705:
+	DB 43, 33, "s5"
+L4706:
+	DB 164, 140, "s6"
+L4707:
+	DB 188, 80, "s7"
+L4708:
+	DB 145, 240, "s8"
+L4709:
+	DB 161, 79, "s9"
+L4710:
+	DW L457, L4710-L4713
+L4711:
+	DB 13, 24, "s1"
+L4712:
+	DB 98, 242, "s2"
+L4713:
+	DB 31, 26, "s3"
+L4714:
+	DW L4710, L4710-L4711
+L4715:
+	DW L4716, L4712-L4712
+L4716:
+	DB 95, 79, "s6"
+L4717:
+	DB 74, 223, "s7"
+L4718:
+	DB 114, 48, "s8"
+L4719:
+	DB 20, 199, "s9"
+L4720:
+	DW L4720, L4721-L4722
+L4721:
+	DW L2450, L4723-L4724
+L4722:
+	DB 63, 56, "s2"
+L4723:
+	DW L449, L4722-L4726
+L4724:
+	DW L4724, L4724-L4721
+L4725:
+	DW L4723, L4723-L4728
+L4726:
+	DB 243, 113, "s6"
+L4727:
+	DW L4726, L4729-L4729
+L4728:
+	DW L3857, L4726-L4724
+L4729:
+	DB 135, 80, "s9"
+L4730:
+	DW L4726, L4734-L4734
+L4731:
+	DW L4731, L4731-L4730
+L4732:
+	DW L4728, L4728-L4728
+L4733:
+	DB 252, 109, "s3"
+L4734:
+	DW L4731, L4738-L4737
+L4735:
+	DB 125, 154, "s5"
+L4736:
+	DB 226, 227, "s6"
+L4737:
+	DW L4738, L4738-L4735
+L4738:
+	DW L4735, L4740-L4741
+L4739:
+	DW L4741, L4738-L4738
+L4740:
+	DW L4737, L4742-L4739
+L4741:
+	DB 55, 144, "s1"
+L4742:
+	DB 88, 14, "s2"
+L4743:
+	DW L4739, L4741-L4741
+L4744:
+	DB 20, 74, "s4"
+L4745:
+	DW L4743, L4742-L4748
+L4746:
+	DB 100, 21, "s6"
+L4747:
+	DB 108, 199, "s7"
+L4748:
+	DW L4745, L4749-L4748
+L4749:
+	DB 166, 178, "s9"
+L4750:
+	DB 126, 137, "s0"
+L4751:
+	DB 224, 127, "s1"
+L4752:
+	DW L4748, L4756-L4756
+L4753:
+	DB 164, 155, "s3"
+L4754:
+	DW L4757, L4753-L4752
+L4755:
+	DB 250, 56, "s5"
+L4756:
+	DB 45, 86, "s6"
+L4757:
+	DB 1, 187, "s7"
+L4758:
+	DW L4755, L4761-L4755
+L4759:
+	DW L4762, L4763-L4758
+L4760:
+	DB 194, 182, "s0"
+L4761:
+	DW L4958, L4765-L4765
+L4762:
+	DW L4764, L4758-L4763
+L4763:
+	DB 29, 143, "s3"
+L4764:
+	DW L556, L4766-L4768
+L4765:
+	DW L340, L4761-L4769
+L4766:
+	DB 118, 86, "s6"
+L4767:
+	DW L4765, L4764-L4768
+L4768:
+	DB 128, 221, "s8"
+L4769:
+	DB 76, 110, "s9"
+L4770:
+	DB 152, 42, "s0"
+L4771:
+	DB 39, 51, "s1"
+L4772:
+	DW L155, L4776-L4776
+L4773:
+	DB 116, 111, "s3"
+L4774:
+	DW L1207, L4777-L4771
+L4775:
+	DB 163, 220, "s5"
+L4776:
+	DW L3237, L4772-L4774
+L4777:
+	DW L4780, L4773-L4774
+L4778:
+	DW L4777, L4782-L4775
+L4779:
+	DB 139, 11, "s9"
+L4780:
+	DW L4784, L4782-L4782
+L4781:
+	DW L1147, L4778-L4778
+L4782:
+	DW L4784, L4786-L4781
+L4783:
+	DB 44, 65, "s3"
+L4784:
+	DW L4784, L4787-L4788
+L4785:
+	DW L4788, L4785-L4782
+L4786:
+	DW L4789, L4788-L4790
+L4787:
+	DB 99, 26, "s7"
+L4788:
+	DW L1906, L4789-L4785
+L4789:
+	DB 122, 131, "s9"
+L4790:
+	DW L4790, L4791-L4787
+L4791:
+	DB 16, 141, "s1"
+L4792:
+	DB 168, 36, "s2"
+L4793:
+	DB 54, 227, "s3"
+L4794:
+	DW L4795, L4793-L4798
+L4795:
+	DW L4795, L4797-L4794
+L4796:
+	DW L4041, L4800-L4796
+L4797:
+	DW L4797, L4796-L4797
+L4798:
+	DW L4799, L4799-L4797
+L4799:
+	DB 160, 62, "s9"
+L4800:
+	DB 7, 163, "s0"
+L4801:
+	DW L4799, L4803-L4799
+L4802:
+	DB 69, 6, "s2"
+L4803:
+	DB 124, 156, "s3"
+L4804:
+	DW L4801, L4807-L4802
+L4805:
+	DW L4802, L4809-L4804
+L4806:
+	DW L4810, L4808-L4805
+L4807:
+	DB 200, 250, "s7"
+L4808:
+	DW L4806, L4806-L4809
+L4809:
+	DW L4808, L4806-L4807
+L4810:
+	DB 61, 240, "s0"
+L4811:
+	DB 44, 78, "s1"
+L4812:
+	DW L4811, L4808-L4813
+L4813:
+	DB 100, 20, "s3"
+L4814:
+	DW L4812, L4816-L4818
+L4815:
+	DW L4813, L4818-L4818
+L4816:
+	DW L4819, L4819-L4815
+L4817:
+	DW L4816, L4815-L4815
+L4818:
+	DW L4821, L4816-L4816
+L4819:
+	DW L4816, L4823-L4816
+L4820:
+	DB 50, 89, "s0"
+L4821:
+	DW L4819, L4820-L4820
+L4822:
+	DW L4825, L4825-L4823
+L4823:
+	DB 126, 11, "s3"
+L4824:
+	DB 191, 103, "s4"
+L4825:
+	DW L4825, L4826-L4828
+L4826:
+	DB 108, 233, "s6"
+L4827:
+	DB 85, 127, "s7"
+L4828:
+	DB 176, 40, "s8"
+L4829:
+	DB 123, 45, "s9"
+L4830:
+	DB 76, 232, "s0"
+L4831:
+	DW L4828, L4835-L4827
+L4832:
+	DB 17, 232, "s2"
+L4833:
+	DW L4955, L4837-L4832
+L4834:
+	DW L4835, L4838-L4837
+L4835:
+	DW L4832, L4839-L4838
+L4836:
+	DB 253, 131, "s6"
+L4837:
+	DB 216, 232, "s7"
+L4838:
+	DW L4732, L4840-L4838
+L4839:
+	DB 201, 125, "s9"
+L4840:
+	DW L4838, L4841-L4843
+L4841:
+	DW L2069, L4845-L4841
+L4842:
+	DW L4842, L4840-L4841
+L4843:
+	DW L3414, L4842-L4843
+L4844:
+	DB 107, 180, "s4"
+L4845:
+	DB 151, 61, "s5"
+L4846:
+	DB 13, 61, "s6"
+L4847:
+	DB 94, 2, "s7"
+L4848:
+	DW L4844, L4844-L4845
+L4849:
+	DB 34, 202, "s9"
+L4850:
+	DW L4854, L4854-L4852
+L4851:
+	DB 53, 118, "s1"
+L4852:
+	DW L2023, L4854-L4853
+L4853:
+	DW L1375, L4850-L4852
+L4854:
+	DW L4851, L4856-L4858
+L4855:
+	DB 169, 195, "s5"
+L4856:
+	DW L4857, L4856-L4857
+L4857:
+	DW L2141, L4860-L4860
+L4858:
+	DW L4856, L4859-L4856
+L4859:
+	DB 51, 174, "s9"
+L4860:
+	DB 86, 42, "s0"
+L4861:
+	DW L2233, L4858-L4859
+L4862:
+	DB 102, 228, "s2"
+L4863:
+	DB 177, 231, "s3"
+L4864:
+	DW L4620, L4868-L4863
+L4865:
+	DW L4864, L4863-L4862
+L4866:
+	DW L4862, L4870-L4865
+L4867:
+	DB 132, 246, "s7"
+L4868:
+	DB 106, 41, "s8"
+L4869:
+	DB 21, 75, "s9"
+L4870:
+	DB 208, 212, "s0"
+L4871:
+	DW L4868, L4875-L4867
+L4872:
+	DW L4870, L4872-L4868
+L4873:
+	DB 227, 215, "s3"
+L4874:
+	DW L4870, L4872-L4871
+L4875:
+	DB 234, 19, "s5"
+L4876:
+	DB 156, 11, "s6"
+L4877:
+	DB 45, 154, "s7"
+L4878:
+	DW L1854, L4878-L4876
+L4879:
+	DW L3516, L4878-L4878
+L4880:
+	DB 89, 44, "s0"
+L4881:
+	DB 72, 251, "s1"
+L4882:
+	DW L4886, L4886-L4878
+L4883:
+	DW L4886, L4884-L4882
+L4884:
+	DW L4888, L4880-L4886
+L4885:
+	DB 191, 62, "s5"
+L4886:
+	DW L4883, L4885-L4889
+L4887:
+	DW L4889, L4889-L4886
+L4888:
+	DW L4886, L4887-L4891
+L4889:
+	DW L4893, L4892-L4889
+L4890:
+	DB 182, 46, "s0"
+L4891:
+	DB 35, 41, "s1"
+L4892:
+	DB 47, 206, "s2"
+L4893:
+	DB 161, 59, "s3"
+L4894:
+	DB 5, 240, "s4"
+L4895:
+	DB 91, 46, "s5"
+L4896:
+	DB 75, 113, "s6"
+L4897:
+	DW L4900, L4896-L4901
+L4898:
+	DB 249, 191, "s8"
+L4899:
+	DW L4281, L4895-L4901
+L4900:
+	DB 32, 101, "s0"
+L4901:
+	DB 118, 131, "s1"
+L4902:
+	DB 144, 208, "s2"
+L4903:
+	DB 21, 54, "s3"
+L4904:
+	DW L4900, L4903-L4907
+L4905:
+	DB 117, 109, "s5"
+L4906:
+	DB 153, 104, "s6"
+L4907:
+	DB 13, 179, "s7"
+L4908:
+	DB 251, 224, "s8"
+L4909:
+	DW L4907, L4912-L4910
+L4910:
+	DB 227, 35, "s0"
+L4911:
+	DB 207, 254, "s1"
+L4912:
+	DW L355, L4914-L4908
+L4913:
+	DW L4909, L4909-L4915
+L4914:
+	DW L4910, L4910-L4911
+L4915:
+	DW L4913, L4916-L4912
+L4916:
+	DW L4915, L4918-L4920
+L4917:
+	DB 10, 117, "s7"
+L4918:
+	DW L4921, L4922-L4921
+L4919:
+	DB 78, 204, "s9"
+L4920:
+	DB 34, 227, "s0"
+L4921:
+	DW L4924, L4922-L4923
+L4922:
+	DW L4920, L4919-L4925
+L4923:
+	DB 62, 173, "s3"
+L4924:
+	DB 0, 228, "s4"
+L4925:
+	DW L4924, L4928-L4924
+L4926:
+	DW L129, L4927-L4926
+L4927:
+	DB 247, 184, "s7"
+L4928:
+	DW L4931, L4930-L4930
+L4929:
+	DB 5, 49, "s9"
+L4930:
+	DW L4933, L4934-L4926
+L4931:
+	DW L4727, L4928-L4931
+L4932:
+	DB 158, 110, "s2"
+L4933:
+	DB 238, 3, "s3"
+L4934:
+	DW L4931, L4932-L4932
+L4935:
+	DB 129, 5, "s5"
+L4936:
+	DB 23, 251, "s6"
+L4937:
+	DB 52, 207, "s7"
+L4938:
+	DB 215, 177, "s8"
+L4939:
+	DW L4937, L4940-L4938
+L4940:
+	DW L4941, L4943-L4941
+L4941:
+	DB 96, 223, "s1"
+L4942:
+	DB 33, 219, "s2"
+L4943:
+	DW L4944, L4940-L4946
+L4944:
+	DW L4942, L4947-L4941
+L4945:
+	DB 121, 142, "s5"
+L4946:
+	DW L2260, L4946-L4942
+L4947:
+	DB 238, 42, "s7"
+L4948:
+	DB 80, 12, "s8"
+L4949:
+	DW L316, L4947-L4951
+L4950:
+	DB 4, 171, "s0"
+L4951:
+	DB 143, 141, "s1"
+L4952:
+	DB 9, 183, "s2"
+L4953:
+	DB 80, 121, "s3"
+L4954:
+	DB 215, 238, "s4"
+L4955:
+	DB 243, 84, "s5"
+L4956:
+	DW L4958, L4955-L4955
+L4957:
+	DW L3347, L4960-L4959
+L4958:
+	DB 248, 91, "s8"
+L4959:
+	DW L4956, L4963-L4957
+L4960:
+	DB 20, 217, "s0"
+L4961:
+	DB 78, 115, "s1"
+L4962:
+	DW L4962, L4961-L4959
+L4963:
+	DB 117, 226, "s3"
+L4964:
+	DW L2623, L4968-L4968
+L4965:
+	DW L4965, L4965-L4968
+L4966:
+	DB 229, 117, "s6"
+L4967:
+	DB 181, 118, "s7"
+L4968:
+	DB 255, 45, "s8"
+L4969:
+	DB 124, 81, "s9"
+L4970:
+	DW L4969, L4970-L4971
+L4971:
+	DW L4968, L4967-L4967
+L4972:
+	DW L4975, L4969-L4975
+L4973:
+	DW L4971, L4969-L4976
+L4974:
+	DB 9, 54, "s4"
+L4975:
+	DW L4974, L4973-L4979
+L4976:
+	DB 208, 56, "s6"
+L4977:
+	DW L4976, L4977-L4974
+L4978:
+	DB 157, 32, "s8"
+L4979:
+	DW L4983, L4981-L4977
+L4980:
+	DW L4981, L4982-L4979
+L4981:
+	DW L4979, L4977-L4982
+L4982:
+	DB 68, 44, "s2"
+L4983:
+	DB 228, 214, "s3"
+L4984:
+	DW L4982, L4980-L4983
+L4985:
+	DW L319, L4986-L4988
+L4986:
+	DB 13, 50, "s6"
+L4987:
+	DB 232, 88, "s7"
+L4988:
+	DB 196, 48, "s8"
+L4989:
+	DW L4991, L4987-L4993
+L4990:
+	DB 61, 94, "s0"
+L4991:
+	DW L3658, L4987-L4995
+L4992:
+	DB 135, 43, "s2"
+L4993:
+	DB 113, 60, "s3"
+L4994:
+	DW L4992, L4990-L4998
+L4995:
+	DB 145, 6, "s5"
+L4996:
+	DW L4996, L4997-L4999
+L4997:
+	DW L4999, L4996-L4997
+L4998:
+	DW L4998, L4999-L4999
+L4999:
+	DW L4999, L4998-L4998
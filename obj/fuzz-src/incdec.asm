@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	INC 5, XIZ
+L1:
+	INC 4, L
+L2:
+	INC 2, IX
+L3:
+	DEC 3, WA
+L4:
+	DEC 5, XWA
+L5:
+	DEC 8, H
+L6:
+	DEC 8, XBC
+L7:
+	INC 5, D
+L8:
+	DEC 3, W
+L9:
+	DEC 2, HL
+L10:
+	DEC 7, XWA
+L11:
+	DEC 7, XIX
+L12:
+	DEC 6, XIY
+L13:
+	INC 2, XIX
+L14:
+	INC 1, XWA
+L15:
+	DEC 7, XHL
+L16:
+	DEC 3, IX
+L17:
+	INC 8, XDE
+L18:
+	DEC 4, XIZ
+L19:
+	DEC 5, BC
+L20:
+	INC 1, XIX
+L21:
+	DEC 3, HL
+L22:
+	DEC 1, XIX
+L23:
+	INC 3, C
+L24:
+	INC 7, IX
+L25:
+	DEC 3, XHL
+L26:
+	INC 1, HL
+L27:
+	INC 6, IY
+L28:
+	DEC 6, L
+L29:
+	DEC 2, XBC
+L30:
+	INC 3, H
+L31:
+	INC 6, XIY
+L32:
+	DEC 2, BC
+L33:
+	INC 7, IX
+L34:
+	INC 5, XIX
+L35:
+	INC 5, XWA
+L36:
+	INC 2, XIY
+L37:
+	DEC 2, XHL
+L38:
+	INC 5, C
+L39:
+	INC 8, W
+L40:
+	INC 6, XHL
+L41:
+	INC 1, H
+L42:
+	DEC 5, E
+L43:
+	DEC 3, BC
+L44:
+	INC 5, XHL
+L45:
+	INC 1, E
+L46:
+	INC 5, C
+L47:
+	DEC 3, A
+L48:
+	DEC 3, XDE
+L49:
+	DEC 2, XIY
+L50:
+	INC 3, XIY
+L51:
+	DEC 1, IX
+L52:
+	INC 6, XHL
+L53:
+	INC 7, B
+L54:
+	DEC 2, XDE
+L55:
+	DEC 4, XWA
+L56:
+	DEC 8, IX
+L57:
+	DEC 3, HL
+L58:
+	INC 3, C
+L59:
+	INC 1, XIZ
+L60:
+	DEC 3, L
+L61:
+	DEC 7, XIZ
+L62:
+	DEC 1, H
+L63:
+	DEC 2, XHL
+L64:
+	INC 4, XDE
+L65:
+	DEC 6, XIX
+L66:
+	DEC 6, HL
+L67:
+	INC 8, IZ
+L68:
+	DEC 7, XWA
+L69:
+	DEC 6, XIZ
+L70:
+	DEC 3, H
+L71:
+	DEC 7, W
+L72:
+	INC 6, XWA
+L73:
+	INC 7, DE
+L74:
+	DEC 1, XDE
+L75:
+	INC 8, H
+L76:
+	INC 4, B
+L77:
+	DEC 6, L
+L78:
+	INC 7, DE
+L79:
+	DEC 8, XDE
+L80:
+	DEC 8, IX
+L81:
+	DEC 5, XIY
+L82:
+	INC 1, C
+L83:
+	DEC 8, XBC
+L84:
+	INC 4, IY
+L85:
+	DEC 5, E
+L86:
+	INC 7, XWA
+L87:
+	DEC 1, IY
+L88:
+	INC 3, B
+L89:
+	INC 1, WA
+L90:
+	DEC 8, W
+L91:
+	DEC 3, IY
+L92:
+	INC 4, H
+L93:
+	DEC 8, HL
+L94:
+	INC 5, C
+L95:
+	INC 3, W
+L96:
+	INC 3, HL
+L97:
+	DEC 1, L
+L98:
+	DEC 2, E
+L99:
+	INC 7, IZ
+L100:
+	INC 1, XIZ
+L101:
+	DEC 7, C
+L102:
+	INC 3, XBC
+L103:
+	DEC 6, A
+L104:
+	DEC 8, B
+L105:
+	INC 5, XIY
+L106:
+	DEC 2, XHL
+L107:
+	DEC 4, XWA
+L108:
+	DEC 6, C
+L109:
+	INC 3, XIY
+L110:
+	DEC 7, C
+L111:
+	DEC 6, DE
+L112:
+	INC 7, C
+L113:
+	DEC 4, XWA
+L114:
+	DEC 3, XWA
+L115:
+	DEC 5, XIY
+L116:
+	DEC 3, B
+L117:
+	INC 8, E
+L118:
+	INC 7, XIZ
+L119:
+	INC 4, BC
+L120:
+	DEC 5, IY
+L121:
+	INC 1, XIZ
+L122:
+	DEC 1, DE
+L123:
+	INC 2, W
+L124:
+	INC 2, IZ
+L125:
+	INC 7, D
+L126:
+	INC 1, A
+L127:
+	DEC 8, IY
+L128:
+	DEC 1, XDE
+L129:
+	DEC 2, C
+L130:
+	INC 1, A
+L131:
+	INC 2, C
+L132:
+	DEC 3, D
+L133:
+	INC 4, XWA
+L134:
+	INC 5, HL
+L135:
+	DEC 7, DE
+L136:
+	DEC 7, H
+L137:
+	DEC 5, D
+L138:
+	DEC 5, XDE
+L139:
+	DEC 4, XIZ
+L140:
+	INC 1, D
+L141:
+	DEC 2, H
+L142:
+	INC 1, XDE
+L143:
+	DEC 7, XDE
+L144:
+	DEC 5, BC
+L145:
+	INC 1, IZ
+L146:
+	DEC 3, A
+L147:
+	DEC 3, XIX
+L148:
+	INC 6, BC
+L149:
+	DEC 8, IX
+L150:
+	DEC 2, XWA
+L151:
+	INC 8, H
+L152:
+	DEC 1, IX
+L153:
+	DEC 8, DE
+L154:
+	DEC 3, C
+L155:
+	DEC 6, XBC
+L156:
+	INC 3, XHL
+L157:
+	INC 5, XDE
+L158:
+	INC 5, XBC
+L159:
+	INC 3, IX
+L160:
+	INC 3, XBC
+L161:
+	INC 3, HL
+L162:
+	INC 1, E
+L163:
+	DEC 5, XWA
+L164:
+	INC 2, BC
+L165:
+	INC 3, XWA
+L166:
+	DEC 6, A
+L167:
+	DEC 2, IY
+L168:
+	INC 5, XDE
+L169:
+	DEC 8, W
+L170:
+	DEC 8, D
+L171:
+	INC 1, XIZ
+L172:
+	DEC 5, C
+L173:
+	DEC 6, XBC
+L174:
+	INC 4, BC
+L175:
+	INC 6, BC
+L176:
+	DEC 6, XIY
+L177:
+	INC 2, XBC
+L178:
+	DEC 4, XWA
+L179:
+	INC 6, HL
+L180:
+	INC 2, BC
+L181:
+	INC 2, XIY
+L182:
+	INC 7, XDE
+L183:
+	INC 8, IX
+L184:
+	DEC 3, XHL
+L185:
+	INC 8, H
+L186:
+	INC 6, A
+L187:
+	INC 5, E
+L188:
+	INC 4, E
+L189:
+	INC 8, XIY
+L190:
+	INC 1, L
+L191:
+	INC 6, C
+L192:
+	DEC 4, XIX
+L193:
+	INC 7, HL
+L194:
+	DEC 4, C
+L195:
+	INC 4, E
+L196:
+	INC 6, XIY
+L197:
+	DEC 6, A
+L198:
+	INC 3, XIX
+L199:
+	DEC 7, HL
+L200:
+	INC 6, C
+L201:
+	DEC 8, XIY
+L202:
+	DEC 1, DE
+L203:
+	DEC 3, XWA
+L204:
+	DEC 5, DE
+L205:
+	DEC 5, DE
+L206:
+	DEC 2, IX
+L207:
+	INC 6, IZ
+L208:
+	INC 3, D
+L209:
+	INC 5, C
+L210:
+	INC 8, C
+L211:
+	INC 3, XIZ
+L212:
+	DEC 1, XIX
+L213:
+	DEC 8, XIY
+L214:
+	DEC 7, E
+L215:
+	INC 1, XWA
+L216:
+	DEC 5, C
+L217:
+	INC 4, XIZ
+L218:
+	INC 5, XIZ
+L219:
+	DEC 7, XIY
+L220:
+	INC 6, XBC
+L221:
+	DEC 2, DE
+L222:
+	DEC 5, L
+L223:
+	INC 1, D
+L224:
+	INC 5, HL
+L225:
+	INC 5, H
+L226:
+	DEC 6, IX
+L227:
+	DEC 7, XIX
+L228:
+	DEC 3, XWA
+L229:
+	INC 5, XIZ
+L230:
+	INC 4, XIZ
+L231:
+	INC 8, XHL
+L232:
+	INC 7, IX
+L233:
+	INC 6, D
+L234:
+	INC 4, L
+L235:
+	DEC 5, C
+L236:
+	INC 2, B
+L237:
+	INC 3, XBC
+L238:
+	INC 6, A
+L239:
+	DEC 6, XHL
+L240:
+	INC 3, D
+L241:
+	DEC 2, D
+L242:
+	DEC 4, IX
+L243:
+	DEC 8, B
+L244:
+	DEC 3, A
+L245:
+	DEC 1, XIY
+L246:
+	DEC 7, DE
+L247:
+	DEC 6, D
+L248:
+	DEC 3, C
+L249:
+	DEC 2, H
+L250:
+	INC 3, E
+L251:
+	INC 7, W
+L252:
+	DEC 8, XDE
+L253:
+	INC 7, XIY
+L254:
+	DEC 4, IZ
+L255:
+	DEC 8, IZ
+L256:
+	DEC 6, XDE
+L257:
+	INC 5, BC
+L258:
+	DEC 5, WA
+L259:
+	DEC 8, XHL
+L260:
+	INC 8, HL
+L261:
+	DEC 1, XIZ
+L262:
+	DEC 3, HL
+L263:
+	DEC 2, BC
+L264:
+	INC 8, XWA
+L265:
+	INC 6, IX
+L266:
+	DEC 3, IX
+L267:
+	INC 2, E
+L268:
+	INC 1, W
+L269:
+	INC 8, XHL
+L270:
+	DEC 1, L
+L271:
+	INC 8, HL
+L272:
+	DEC 5, E
+L273:
+	INC 3, WA
+L274:
+	INC 8, IY
+L275:
+	INC 7, L
+L276:
+	DEC 5, IY
+L277:
+	INC 3, XDE
+L278:
+	DEC 3, IZ
+L279:
+	DEC 7, H
+L280:
+	DEC 1, W
+L281:
+	DEC 2, DE
+L282:
+	DEC 4, W
+L283:
+	DEC 2, WA
+L284:
+	DEC 6, B
+L285:
+	DEC 8, H
+L286:
+	INC 6, DE
+L287:
+	INC 5, XWA
+L288:
+	INC 6, BC
+L289:
+	INC 2, D
+L290:
+	INC 4, XHL
+L291:
+	INC 4, A
+L292:
+	INC 8, H
+L293:
+	INC 6, XIY
+L294:
+	DEC 8, BC
+L295:
+	INC 4, H
+L296:
+	DEC 5, IZ
+L297:
+	DEC 2, IX
+L298:
+	DEC 8, XWA
+L299:
+	DEC 4, D
+L300:
+	INC 6, WA
+L301:
+	DEC 6, D
+L302:
+	INC 2, IY
+L303:
+	INC 8, XIX
+L304:
+	DEC 3, XBC
+L305:
+	INC 2, WA
+L306:
+	DEC 2, B
+L307:
+	INC 3, W
+L308:
+	INC 8, XBC
+L309:
+	INC 3, B
+L310:
+	INC 2, E
+L311:
+	INC 7, BC
+L312:
+	INC 5, WA
+L313:
+	INC 7, C
+L314:
+	INC 1, XIX
+L315:
+	DEC 8, XBC
+L316:
+	DEC 3, IZ
+L317:
+	INC 7, H
+L318:
+	DEC 2, DE
+L319:
+	INC 2, DE
+L320:
+	DEC 6, XBC
+L321:
+	INC 5, IY
+L322:
+	INC 5, C
+L323:
+	INC 4, C
+L324:
+	INC 5, XIX
+L325:
+	DEC 5, XIY
+L326:
+	INC 2, A
+L327:
+	DEC 6, E
+L328:
+	INC 8, B
+L329:
+	INC 2, IY
+L330:
+	INC 1, BC
+L331:
+	DEC 6, IY
+L332:
+	INC 3, DE
+L333:
+	DEC 7, XDE
+L334:
+	DEC 5, HL
+L335:
+	DEC 1, XDE
+L336:
+	INC 1, WA
+L337:
+	DEC 4, XIX
+L338:
+	INC 3, IY
+L339:
+	INC 3, XIZ
+L340:
+	INC 1, XIX
+L341:
+	INC 3, XDE
+L342:
+	INC 2, IZ
+L343:
+	DEC 6, A
+L344:
+	INC 1, XBC
+L345:
+	INC 5, XIY
+L346:
+	DEC 3, XDE
+L347:
+	DEC 4, HL
+L348:
+	DEC 4, B
+L349:
+	DEC 4, BC
+L350:
+	INC 3, XHL
+L351:
+	INC 3, WA
+L352:
+	DEC 5, XIZ
+L353:
+	DEC 3, XIY
+L354:
+	INC 3, HL
+L355:
+	INC 2, WA
+L356:
+	INC 5, WA
+L357:
+	INC 8, W
+L358:
+	DEC 6, H
+L359:
+	DEC 6, XIY
+L360:
+	DEC 7, XIX
+L361:
+	DEC 3, H
+L362:
+	INC 8, H
+L363:
+	INC 1, IY
+L364:
+	DEC 8, IZ
+L365:
+	INC 6, E
+L366:
+	INC 7, A
+L367:
+	DEC 6, B
+L368:
+	DEC 7, WA
+L369:
+	DEC 5, XIZ
+L370:
+	INC 4, XHL
+L371:
+	DEC 2, L
+L372:
+	DEC 1, XHL
+L373:
+	DEC 5, H
+L374:
+	INC 1, E
+L375:
+	DEC 7, WA
+L376:
+	DEC 5, E
+L377:
+	INC 6, XIX
+L378:
+	INC 6, H
+L379:
+	DEC 2, BC
+L380:
+	INC 5, XWA
+L381:
+	INC 6, DE
+L382:
+	DEC 1, DE
+L383:
+	INC 1, H
+L384:
+	INC 7, IX
+L385:
+	INC 4, XDE
+L386:
+	DEC 7, XDE
+L387:
+	DEC 3, XIX
+L388:
+	DEC 3, XHL
+L389:
+	DEC 7, B
+L390:
+	INC 3, B
+L391:
+	INC 6, DE
+L392:
+	INC 1, E
+L393:
+	INC 2, B
+L394:
+	DEC 2, XDE
+L395:
+	DEC 5, WA
+L396:
+	INC 4, XWA
+L397:
+	DEC 4, C
+L398:
+	DEC 1, IZ
+L399:
+	DEC 1, DE
+L400:
+	DEC 3, HL
+L401:
+	DEC 7, BC
+L402:
+	INC 2, B
+L403:
+	DEC 5, XWA
+L404:
+	INC 7, BC
+L405:
+	INC 4, XBC
+L406:
+	INC 8, W
+L407:
+	INC 6, XWA
+L408:
+	INC 6, XBC
+L409:
+	DEC 4, XIY
+L410:
+	DEC 6, XWA
+L411:
+	DEC 2, W
+L412:
+	DEC 2, XIY
+L413:
+	INC 7, HL
+L414:
+	INC 7, XIX
+L415:
+	DEC 5, D
+L416:
+	DEC 7, A
+L417:
+	INC 6, IZ
+L418:
+	INC 6, IY
+L419:
+	INC 3, WA
+L420:
+	DEC 7, IZ
+L421:
+	DEC 2, XIZ
+L422:
+	INC 3, E
+L423:
+	DEC 1, XWA
+L424:
+	DEC 6, XWA
+L425:
+	INC 8, E
+L426:
+	DEC 8, XIY
+L427:
+	DEC 7, L
+L428:
+	INC 4, H
+L429:
+	DEC 4, XIY
+L430:
+	INC 6, A
+L431:
+	DEC 2, D
+L432:
+	DEC 1, C
+L433:
+	INC 5, A
+L434:
+	DEC 2, XHL
+L435:
+	DEC 6, XIZ
+L436:
+	INC 8, E
+L437:
+	INC 5, DE
+L438:
+	INC 3, H
+L439:
+	DEC 6, B
+L440:
+	INC 7, XIX
+L441:
+	INC 8, IZ
+L442:
+	INC 7, XHL
+L443:
+	INC 2, XIZ
+L444:
+	INC 2, B
+L445:
+	INC 8, IZ
+L446:
+	DEC 6, IX
+L447:
+	DEC 6, XBC
+L448:
+	INC 8, D
+L449:
+	INC 4, D
+L450:
+	DEC 5, XIZ
+L451:
+	INC 3, XHL
+L452:
+	DEC 5, B
+L453:
+	INC 7, A
+L454:
+	INC 7, BC
+L455:
+	DEC 8, DE
+L456:
+	INC 6, W
+L457:
+	DEC 1, H
+L458:
+	INC 5, H
+L459:
+	DEC 1, B
+L460:
+	INC 5, L
+L461:
+	DEC 8, A
+L462:
+	INC 3, IY
+L463:
+	INC 3, C
+L464:
+	INC 7, IZ
+L465:
+	INC 5, XIZ
+L466:
+	DEC 8, IX
+L467:
+	INC 4, XIY
+L468:
+	INC 2, IY
+L469:
+	DEC 8, IX
+L470:
+	DEC 5, BC
+L471:
+	DEC 6, WA
+L472:
+	DEC 4, BC
+L473:
+	INC 4, XIY
+L474:
+	INC 2, E
+L475:
+	DEC 5, XIY
+L476:
+	DEC 6, B
+L477:
+	DEC 8, XIY
+L478:
+	INC 2, DE
+L479:
+	DEC 6, L
+L480:
+	INC 7, XIY
+L481:
+	INC 4, XWA
+L482:
+	DEC 7, IY
+L483:
+	DEC 5, A
+L484:
+	DEC 7, E
+L485:
+	DEC 7, IY
+L486:
+	INC 8, D
+L487:
+	INC 7, E
+L488:
+	INC 6, HL
+L489:
+	DEC 6, WA
+L490:
+	DEC 4, XIZ
+L491:
+	DEC 3, E
+L492:
+	DEC 3, H
+L493:
+	DEC 1, XHL
+L494:
+	INC 2, BC
+L495:
+	DEC 3, XIY
+L496:
+	DEC 8, DE
+L497:
+	INC 6, XWA
+L498:
+	INC 5, IZ
+L499:
+	DEC 3, XIZ
+L500:
+	DEC 8, E
+L501:
+	DEC 5, IX
+L502:
+	DEC 3, WA
+L503:
+	DEC 8, W
+L504:
+	INC 1, C
+L505:
+	INC 3, HL
+L506:
+	DEC 3, IZ
+L507:
+	INC 4, XIX
+L508:
+	DEC 5, XIZ
+L509:
+	INC 8, XWA
+L510:
+	DEC 6, B
+L511:
+	DEC 4, XIY
+L512:
+	DEC 2, WA
+L513:
+	INC 1, H
+L514:
+	DEC 3, C
+L515:
+	INC 1, XIY
+L516:
+	DEC 3, XWA
+L517:
+	INC 8, IY
+L518:
+	INC 4, E
+L519:
+	INC 3, H
+L520:
+	INC 5, B
+L521:
+	DEC 7, IX
+L522:
+	DEC 5, WA
+L523:
+	INC 1, D
+L524:
+	DEC 1, IZ
+L525:
+	DEC 4, A
+L526:
+	INC 1, XIZ
+L527:
+	DEC 8, WA
+L528:
+	DEC 3, XIY
+L529:
+	INC 5, A
+L530:
+	DEC 7, WA
+L531:
+	INC 4, IX
+L532:
+	DEC 4, DE
+L533:
+	DEC 8, HL
+L534:
+	DEC 3, XBC
+L535:
+	INC 6, E
+L536:
+	DEC 7, W
+L537:
+	DEC 5, A
+L538:
+	DEC 7, XIY
+L539:
+	INC 5, E
+L540:
+	DEC 1, WA
+L541:
+	DEC 4, XDE
+L542:
+	DEC 8, XHL
+L543:
+	INC 8, E
+L544:
+	DEC 1, BC
+L545:
+	DEC 5, XWA
+L546:
+	DEC 7, L
+L547:
+	DEC 8, IZ
+L548:
+	DEC 7, XIX
+L549:
+	INC 7, DE
+L550:
+	INC 5, XIX
+L551:
+	INC 4, C
+L552:
+	DEC 5, A
+L553:
+	INC 2, XHL
+L554:
+	DEC 7, IX
+L555:
+	INC 8, XWA
+L556:
+	INC 1, XHL
+L557:
+	DEC 3, C
+L558:
+	INC 4, XIZ
+L559:
+	INC 3, BC
+L560:
+	INC 5, IZ
+L561:
+	INC 1, XBC
+L562:
+	INC 7, XWA
+L563:
+	DEC 4, XIX
+L564:
+	DEC 3, IZ
+L565:
+	DEC 1, DE
+L566:
+	DEC 5, IY
+L567:
+	DEC 8, XHL
+L568:
+	DEC 4, A
+L569:
+	DEC 2, XIY
+L570:
+	DEC 5, B
+L571:
+	INC 2, IX
+L572:
+	DEC 2, B
+L573:
+	INC 7, XIY
+L574:
+	DEC 7, XIZ
+L575:
+	DEC 7, H
+L576:
+	INC 2, XHL
+L577:
+	INC 6, XIZ
+L578:
+	DEC 4, XBC
+L579:
+	DEC 8, IX
+L580:
+	INC 4, W
+L581:
+	INC 2, WA
+L582:
+	DEC 7, XHL
+L583:
+	DEC 3, A
+L584:
+	DEC 1, XBC
+L585:
+	DEC 8, BC
+L586:
+	INC 2, WA
+L587:
+	INC 6, IY
+L588:
+	DEC 2, H
+L589:
+	DEC 6, DE
+L590:
+	INC 6, DE
+L591:
+	INC 4, L
+L592:
+	INC 2, WA
+L593:
+	INC 7, H
+L594:
+	DEC 5, IX
+L595:
+	INC 5, BC
+L596:
+	INC 4, XWA
+L597:
+	DEC 4, XBC
+L598:
+	DEC 1, L
+L599:
+	DEC 2, BC
+L600:
+	DEC 2, A
+L601:
+	DEC 8, HL
+L602:
+	DEC 4, C
+L603:
+	INC 5, XBC
+L604:
+	INC 5, XIY
+L605:
+	INC 5, IX
+L606:
+	DEC 4, XDE
+L607:
+	DEC 8, XIY
+L608:
+	INC 3, IY
+L609:
+	INC 5, XBC
+L610:
+	INC 7, XWA
+L611:
+	DEC 2, HL
+L612:
+	INC 1, XDE
+L613:
+	INC 6, IX
+L614:
+	DEC 3, XHL
+L615:
+	INC 7, D
+L616:
+	DEC 6, W
+L617:
+	DEC 1, IZ
+L618:
+	INC 5, XIY
+L619:
+	INC 7, BC
+L620:
+	DEC 1, XIY
+L621:
+	DEC 2, XBC
+L622:
+	DEC 6, WA
+L623:
+	DEC 6, XHL
+L624:
+	INC 7, XHL
+L625:
+	DEC 2, IY
+L626:
+	DEC 8, D
+L627:
+	DEC 8, L
+L628:
+	INC 2, DE
+L629:
+	DEC 7, XDE
+L630:
+	DEC 2, IX
+L631:
+	DEC 5, H
+L632:
+	INC 4, XIY
+L633:
+	DEC 3, XWA
+L634:
+	INC 5, D
+L635:
+	DEC 8, DE
+L636:
+	DEC 8, XWA
+L637:
+	INC 4, L
+L638:
+	INC 2, E
+L639:
+	DEC 2, B
+L640:
+	DEC 7, IX
+L641:
+	INC 3, E
+L642:
+	DEC 5, IX
+L643:
+	DEC 7, XWA
+L644:
+	DEC 2, XIZ
+L645:
+	DEC 4, XHL
+L646:
+	INC 3, HL
+L647:
+	INC 4, W
+L648:
+	INC 7, IZ
+L649:
+	DEC 8, E
+L650:
+	DEC 3, L
+L651:
+	DEC 1, WA
+L652:
+	INC 5, IX
+L653:
+	INC 6, HL
+L654:
+	DEC 1, XIX
+L655:
+	INC 6, XBC
+L656:
+	DEC 4, IZ
+L657:
+	INC 1, XBC
+L658:
+	INC 2, B
+L659:
+	INC 8, IY
+L660:
+	INC 7, HL
+L661:
+	DEC 1, HL
+L662:
+	DEC 2, DE
+L663:
+	INC 8, IZ
+L664:
+	DEC 8, A
+L665:
+	INC 1, XIY
+L666:
+	INC 6, BC
+L667:
+	INC 4, WA
+L668:
+	INC 6, C
+L669:
+	INC 6, IX
+L670:
+	DEC 4, XIX
+L671:
+	DEC 6, C
+L672:
+	DEC 2, HL
+L673:
+	INC 6, W
+L674:
+	INC 4, L
+L675:
+	DEC 2, B
+L676:
+	INC 5, C
+L677:
+	DEC 6, H
+L678:
+	DEC 4, IY
+L679:
+	INC 4, HL
+L680:
+	DEC 5, C
+L681:
+	INC 8, L
+L682:
+	DEC 8, XBC
+L683:
+	DEC 7, W
+L684:
+	DEC 3, C
+L685:
+	INC 1, E
+L686:
+	DEC 6, IY
+L687:
+	DEC 2, IY
+L688:
+	INC 1, B
+L689:
+	INC 7, E
+L690:
+	INC 4, XHL
+L691:
+	INC 4, B
+L692:
+	DEC 8, A
+L693:
+	DEC 6, B
+L694:
+	DEC 8, XIZ
+L695:
+	INC 6, B
+L696:
+	INC 1, WA
+L697:
+	INC 4, XBC
+L698:
+	INC 7, XIY
+L699:
+	DEC 7, BC
+L700:
+	INC 8, IY
+L701:
+	INC 7, HL
+L702:
+	INC 3, D
+L703:
+	INC 1, XDE
+L704:
+	DEC 1, IX
+L705:
+	DEC 8, IZ
+L706:
+	DEC 5, B
+L707:
+	DEC 7, IX
+L708:
+	DEC 5, XIX
+L709:
+	DEC 4, D
+L710:
+	DEC 2, XDE
+L711:
+	DEC 3, WA
+L712:
+	INC 8, IZ
+L713:
+	DEC 4, W
+L714:
+	INC 7, XBC
+L715:
+	INC 4, XIX
+L716:
+	DEC 2, L
+L717:
+	DEC 5, H
+L718:
+	INC 8, DE
+L719:
+	DEC 2, HL
+L720:
+	INC 5, XHL
+L721:
+	DEC 2, W
+L722:
+	INC 7, B
+L723:
+	INC 7, B
+L724:
+	INC 2, D
+L725:
+	INC 4, WA
+L726:
+	DEC 6, E
+L727:
+	DEC 5, L
+L728:
+	DEC 7, IY
+L729:
+	INC 5, BC
+L730:
+	DEC 3, XDE
+L731:
+	INC 6, H
+L732:
+	INC 5, D
+L733:
+	INC 4, C
+L734:
+	DEC 3, W
+L735:
+	DEC 1, XIX
+L736:
+	DEC 8, E
+L737:
+	INC 2, D
+L738:
+	DEC 6, H
+L739:
+	DEC 7, DE
+L740:
+	DEC 8, DE
+L741:
+	INC 6, DE
+L742:
+	INC 6, L
+L743:
+	DEC 5, WA
+L744:
+	INC 1, IZ
+L745:
+	INC 5, BC
+L746:
+	DEC 7, XIY
+L747:
+	DEC 4, IX
+L748:
+	INC 1, BC
+L749:
+	DEC 2, HL
+L750:
+	INC 2, WA
+L751:
+	INC 2, XIZ
+L752:
+	DEC 8, IY
+L753:
+	INC 7, B
+L754:
+	DEC 6, BC
+L755:
+	DEC 6, IY
+L756:
+	DEC 1, IZ
+L757:
+	INC 5, XDE
+L758:
+	DEC 4, XIX
+L759:
+	DEC 2, IY
+L760:
+	INC 1, W
+L761:
+	DEC 8, IX
+L762:
+	DEC 5, IY
+L763:
+	INC 6, HL
+L764:
+	DEC 4, IZ
+L765:
+	DEC 2, IY
+L766:
+	INC 1, C
+L767:
+	DEC 2, D
+L768:
+	DEC 8, XIX
+L769:
+	DEC 5, W
+L770:
+	DEC 5, C
+L771:
+	INC 7, XHL
+L772:
+	DEC 5, IZ
+L773:
+	DEC 5, XIX
+L774:
+	INC 6, H
+L775:
+	DEC 2, XHL
+L776:
+	INC 3, DE
+L777:
+	INC 7, E
+L778:
+	INC 5, IZ
+L779:
+	INC 1, W
+L780:
+	INC 1, XDE
+L781:
+	DEC 3, E
+L782:
+	INC 7, IZ
+L783:
+	INC 4, XBC
+L784:
+	INC 8, IY
+L785:
+	DEC 6, XWA
+L786:
+	INC 3, XWA
+L787:
+	INC 1, WA
+L788:
+	INC 5, IZ
+L789:
+	DEC 2, HL
+L790:
+	DEC 6, XBC
+L791:
+	DEC 3, BC
+L792:
+	DEC 7, BC
+L793:
+	DEC 7, XDE
+L794:
+	DEC 8, XDE
+L795:
+	INC 7, XHL
+L796:
+	INC 1, XIZ
+L797:
+	DEC 4, H
+L798:
+	INC 3, XHL
+L799:
+	DEC 8, XBC
+L800:
+	INC 2, XBC
+L801:
+	INC 4, XDE
+L802:
+	DEC 6, C
+L803:
+	DEC 6, D
+L804:
+	DEC 4, XIY
+L805:
+	INC 7, B
+L806:
+	INC 2, D
+L807:
+	INC 7, XIY
+L808:
+	DEC 7, XBC
+L809:
+	INC 4, BC
+L810:
+	DEC 5, XIX
+L811:
+	INC 6, XWA
+L812:
+	DEC 5, A
+L813:
+	DEC 1, W
+L814:
+	INC 2, HL
+L815:
+	INC 1, L
+L816:
+	DEC 6, IZ
+L817:
+	INC 1, IZ
+L818:
+	INC 1, L
+L819:
+	INC 6, W
+L820:
+	INC 5, XIY
+L821:
+	INC 4, IZ
+L822:
+	DEC 1, IX
+L823:
+	INC 8, XIY
+L824:
+	DEC 3, L
+L825:
+	INC 4, WA
+L826:
+	DEC 2, IX
+L827:
+	DEC 3, L
+L828:
+	INC 5, XIZ
+L829:
+	DEC 8, XIZ
+L830:
+	DEC 2, C
+L831:
+	DEC 8, C
+L832:
+	DEC 6, XDE
+L833:
+	DEC 3, DE
+L834:
+	DEC 2, D
+L835:
+	INC 6, IX
+L836:
+	DEC 1, A
+L837:
+	INC 4, HL
+L838:
+	INC 5, W
+L839:
+	INC 1, A
+L840:
+	INC 5, XIZ
+L841:
+	INC 5, XWA
+L842:
+	DEC 7, XWA
+L843:
+	INC 8, XIY
+L844:
+	DEC 8, XWA
+L845:
+	DEC 2, XHL
+L846:
+	DEC 1, XIZ
+L847:
+	DEC 5, XBC
+L848:
+	INC 6, C
+L849:
+	DEC 7, BC
+L850:
+	INC 6, L
+L851:
+	DEC 6, HL
+L852:
+	INC 7, WA
+L853:
+	INC 2, HL
+L854:
+	DEC 8, XIY
+L855:
+	INC 4, IZ
+L856:
+	INC 2, B
+L857:
+	DEC 8, XWA
+L858:
+	DEC 4, XHL
+L859:
+	DEC 6, B
+L860:
+	DEC 7, XIX
+L861:
+	INC 3, XIY
+L862:
+	INC 6, WA
+L863:
+	DEC 4, IZ
+L864:
+	INC 7, XHL
+L865:
+	DEC 1, XIX
+L866:
+	DEC 1, IZ
+L867:
+	DEC 6, L
+L868:
+	DEC 2, XDE
+L869:
+	DEC 6, HL
+L870:
+	DEC 3, XBC
+L871:
+	DEC 3, XIX
+L872:
+	INC 1, XWA
+L873:
+	INC 5, IX
+L874:
+	DEC 5, WA
+L875:
+	DEC 8, DE
+L876:
+	DEC 7, HL
+L877:
+	INC 1, IX
+L878:
+	DEC 8, A
+L879:
+	DEC 8, E
+L880:
+	INC 4, XHL
+L881:
+	DEC 1, BC
+L882:
+	DEC 6, XIY
+L883:
+	DEC 2, WA
+L884:
+	INC 8, BC
+L885:
+	DEC 4, IY
+L886:
+	INC 7, E
+L887:
+	INC 5, H
+L888:
+	DEC 5, IX
+L889:
+	DEC 7, XWA
+L890:
+	DEC 2, IZ
+L891:
+	INC 6, IX
+L892:
+	DEC 6, XIY
+L893:
+	DEC 8, HL
+L894:
+	INC 5, BC
+L895:
+	INC 8, E
+L896:
+	INC 7, XWA
+L897:
+	DEC 6, XHL
+L898:
+	DEC 2, E
+L899:
+	DEC 6, BC
+L900:
+	DEC 5, WA
+L901:
+	INC 2, IY
+L902:
+	INC 5, XIZ
+L903:
+	INC 7, XHL
+L904:
+	DEC 3, BC
+L905:
+	DEC 4, L
+L906:
+	DEC 5, E
+L907:
+	DEC 5, HL
+L908:
+	DEC 2, XIZ
+L909:
+	INC 6, XIX
+L910:
+	DEC 3, XWA
+L911:
+	INC 2, XIX
+L912:
+	DEC 1, WA
+L913:
+	DEC 5, L
+L914:
+	INC 7, IX
+L915:
+	DEC 4, C
+L916:
+	DEC 8, IZ
+L917:
+	INC 2, BC
+L918:
+	DEC 3, BC
+L919:
+	INC 2, BC
+L920:
+	DEC 7, A
+L921:
+	DEC 1, XIY
+L922:
+	INC 7, XDE
+L923:
+	INC 5, IZ
+L924:
+	INC 4, XIX
+L925:
+	DEC 7, E
+L926:
+	INC 1, DE
+L927:
+	INC 8, XBC
+L928:
+	DEC 4, E
+L929:
+	INC 3, XWA
+L930:
+	INC 2, D
+L931:
+	DEC 4, C
+L932:
+	INC 7, XWA
+L933:
+	DEC 6, IZ
+L934:
+	DEC 8, DE
+L935:
+	DEC 5, D
+L936:
+	INC 5, D
+L937:
+	DEC 6, E
+L938:
+	INC 2, E
+L939:
+	INC 6, A
+L940:
+	INC 3, IY
+L941:
+	INC 1, IZ
+L942:
+	INC 3, BC
+L943:
+	DEC 8, XIZ
+L944:
+	INC 6, XIZ
+L945:
+	INC 3, IZ
+L946:
+	DEC 7, D
+L947:
+	INC 3, XBC
+L948:
+	DEC 1, H
+L949:
+	INC 3, B
+L950:
+	INC 7, H
+L951:
+	INC 1, BC
+L952:
+	DEC 6, XWA
+L953:
+	DEC 7, XIZ
+L954:
+	INC 3, A
+L955:
+	DEC 6, XBC
+L956:
+	DEC 8, BC
+L957:
+	DEC 2, E
+L958:
+	DEC 7, XIX
+L959:
+	INC 1, XIY
+L960:
+	INC 8, XIX
+L961:
+	INC 7, XIY
+L962:
+	INC 8, DE
+L963:
+	DEC 4, E
+L964:
+	DEC 6, C
+L965:
+	DEC 2, XWA
+L966:
+	INC 3, IY
+L967:
+	DEC 8, L
+L968:
+	DEC 7, A
+L969:
+	INC 4, XIX
+L970:
+	INC 1, IX
+L971:
+	DEC 7, XIY
+L972:
+	INC 2, XIZ
+L973:
+	INC 7, XIX
+L974:
+	DEC 1, WA
+L975:
+	DEC 1, H
+L976:
+	INC 8, IZ
+L977:
+	INC 8, XBC
+L978:
+	DEC 2, DE
+L979:
+	INC 2, XIX
+L980:
+	INC 8, IZ
+L981:
+	INC 3, C
+L982:
+	INC 8, DE
+L983:
+	DEC 3, L
+L984:
+	DEC 3, XIX
+L985:
+	INC 2, IY
+L986:
+	INC 6, H
+L987:
+	DEC 1, XIX
+L988:
+	DEC 6, DE
+L989:
+	INC 5, XWA
+L990:
+	DEC 8, E
+L991:
+	DEC 8, XBC
+L992:
+	DEC 4, L
+L993:
+	INC 4, XHL
+L994:
+	INC 3, XIY
+L995:
+	INC 2, HL
+L996:
+	INC 7, E
+L997:
+	INC 7, C
+L998:
+	DEC 1, IZ
+L999:
+	INC 3, BC
+L1000:
+	DEC 5, A
+L1001:
+	INC 4, XBC
+L1002:
+	DEC 4, B
+L1003:
+	INC 3, XIX
+L1004:
+	INC 3, B
+L1005:
+	INC 2, XIX
+L1006:
+	DEC 7, IZ
+L1007:
+	DEC 4, C
+L1008:
+	DEC 4, XIZ
+L1009:
+	INC 3, B
+L1010:
+	INC 4, IX
+L1011:
+	INC 7, IX
+L1012:
+	DEC 2, A
+L1013:
+	INC 7, XIX
+L1014:
+	DEC 6, XIX
+L1015:
+	DEC 4, D
+L1016:
+	DEC 6, DE
+L1017:
+	DEC 1, XIY
+L1018:
+	DEC 4, XHL
+L1019:
+	INC 2, IY
+L1020:
+	INC 4, C
+L1021:
+	INC 3, IX
+L1022:
+	INC 5, C
+L1023:
+	INC 5, IY
+L1024:
+	DEC 7, HL
+L1025:
+	INC 1, D
+L1026:
+	DEC 6, C
+L1027:
+	DEC 7, B
+L1028:
+	INC 8, WA
+L1029:
+	DEC 4, XIY
+L1030:
+	INC 6, B
+L1031:
+	DEC 4, XHL
+L1032:
+	INC 8, XDE
+L1033:
+	DEC 8, DE
+L1034:
+	INC 4, HL
+L1035:
+	DEC 3, E
+L1036:
+	INC 5, DE
+L1037:
+	DEC 6, XBC
+L1038:
+	DEC 1, B
+L1039:
+	DEC 4, XIY
+L1040:
+	INC 3, XIX
+L1041:
+	DEC 6, XWA
+L1042:
+	INC 5, XBC
+L1043:
+	INC 3, W
+L1044:
+	DEC 7, IZ
+L1045:
+	DEC 3, WA
+L1046:
+	INC 2, A
+L1047:
+	DEC 5, XIX
+L1048:
+	DEC 5, IY
+L1049:
+	DEC 6, XIY
+L1050:
+	INC 8, HL
+L1051:
+	DEC 4, IX
+L1052:
+	INC 6, XIX
+L1053:
+	INC 7, L
+L1054:
+	DEC 5, C
+L1055:
+	INC 1, HL
+L1056:
+	INC 6, A
+L1057:
+	DEC 5, XBC
+L1058:
+	DEC 4, XIX
+L1059:
+	INC 2, XWA
+L1060:
+	INC 3, W
+L1061:
+	INC 3, L
+L1062:
+	INC 7, XIY
+L1063:
+	INC 5, XIZ
+L1064:
+	INC 2, HL
+L1065:
+	INC 2, A
+L1066:
+	DEC 4, XDE
+L1067:
+	INC 4, IX
+L1068:
+	INC 4, IX
+L1069:
+	DEC 5, IY
+L1070:
+	DEC 4, XHL
+L1071:
+	DEC 1, DE
+L1072:
+	DEC 7, IY
+L1073:
+	DEC 1, XWA
+L1074:
+	INC 6, WA
+L1075:
+	DEC 2, XIX
+L1076:
+	DEC 1, HL
+L1077:
+	DEC 2, IZ
+L1078:
+	INC 8, D
+L1079:
+	INC 3, HL
+L1080:
+	DEC 1, A
+L1081:
+	DEC 3, XBC
+L1082:
+	DEC 5, XIY
+L1083:
+	INC 1, XIY
+L1084:
+	DEC 4, A
+L1085:
+	DEC 1, C
+L1086:
+	DEC 1, XIZ
+L1087:
+	INC 4, H
+L1088:
+	DEC 4, HL
+L1089:
+	DEC 8, XIZ
+L1090:
+	DEC 4, E
+L1091:
+	DEC 7, XIX
+L1092:
+	INC 5, XDE
+L1093:
+	INC 7, H
+L1094:
+	INC 7, IX
+L1095:
+	DEC 3, WA
+L1096:
+	DEC 1, HL
+L1097:
+	DEC 8, IX
+L1098:
+	INC 1, XIY
+L1099:
+	INC 5, C
+L1100:
+	INC 7, XDE
+L1101:
+	DEC 7, D
+L1102:
+	DEC 5, XIX
+L1103:
+	DEC 7, XIZ
+L1104:
+	DEC 6, L
+L1105:
+	DEC 5, XWA
+L1106:
+	DEC 6, XIZ
+L1107:
+	INC 8, WA
+L1108:
+	DEC 5, E
+L1109:
+	DEC 5, A
+L1110:
+	DEC 6, XBC
+L1111:
+	DEC 1, E
+L1112:
+	INC 1, XWA
+L1113:
+	DEC 2, IY
+L1114:
+	INC 5, A
+L1115:
+	DEC 6, A
+L1116:
+	INC 5, B
+L1117:
+	INC 7, XWA
+L1118:
+	DEC 2, XWA
+L1119:
+	INC 8, D
+L1120:
+	DEC 7, IX
+L1121:
+	DEC 5, XHL
+L1122:
+	DEC 6, XIX
+L1123:
+	INC 5, IY
+L1124:
+	INC 6, HL
+L1125:
+	DEC 8, DE
+L1126:
+	DEC 7, XBC
+L1127:
+	DEC 4, A
+L1128:
+	INC 4, XIY
+L1129:
+	INC 1, HL
+L1130:
+	DEC 7, XBC
+L1131:
+	DEC 8, D
+L1132:
+	INC 5, B
+L1133:
+	INC 1, IX
+L1134:
+	DEC 5, XIX
+L1135:
+	DEC 7, IX
+L1136:
+	INC 4, XIY
+L1137:
+	DEC 1, BC
+L1138:
+	DEC 3, C
+L1139:
+	INC 5, IX
+L1140:
+	DEC 6, IZ
+L1141:
+	INC 8, WA
+L1142:
+	DEC 7, DE
+L1143:
+	DEC 4, WA
+L1144:
+	DEC 1, XIX
+L1145:
+	INC 6, DE
+L1146:
+	DEC 7, DE
+L1147:
+	INC 5, L
+L1148:
+	INC 1, XIX
+L1149:
+	INC 1, XBC
+L1150:
+	INC 4, D
+L1151:
+	DEC 1, C
+L1152:
+	INC 8, IZ
+L1153:
+	INC 2, W
+L1154:
+	DEC 2, A
+L1155:
+	DEC 2, XBC
+L1156:
+	DEC 6, XIY
+L1157:
+	INC 7, HL
+L1158:
+	INC 8, DE
+L1159:
+	INC 5, XDE
+L1160:
+	INC 8, IY
+L1161:
+	INC 3, XDE
+L1162:
+	INC 7, BC
+L1163:
+	DEC 3, WA
+L1164:
+	INC 8, HL
+L1165:
+	INC 7, IY
+L1166:
+	DEC 3, XBC
+L1167:
+	INC 1, XHL
+L1168:
+	INC 7, B
+L1169:
+	INC 5, XIY
+L1170:
+	DEC 1, B
+L1171:
+	INC 4, W
+L1172:
+	INC 7, WA
+L1173:
+	INC 5, DE
+L1174:
+	INC 8, IZ
+L1175:
+	DEC 2, B
+L1176:
+	DEC 4, A
+L1177:
+	DEC 8, DE
+L1178:
+	INC 4, BC
+L1179:
+	INC 2, A
+L1180:
+	INC 3, WA
+L1181:
+	DEC 3, A
+L1182:
+	DEC 4, A
+L1183:
+	DEC 7, D
+L1184:
+	DEC 2, IX
+L1185:
+	DEC 3, BC
+L1186:
+	DEC 1, IZ
+L1187:
+	INC 8, XDE
+L1188:
+	DEC 2, B
+L1189:
+	INC 7, XIZ
+L1190:
+	INC 5, D
+L1191:
+	INC 4, E
+L1192:
+	INC 6, XDE
+L1193:
+	INC 1, XHL
+L1194:
+	INC 5, BC
+L1195:
+	DEC 5, E
+L1196:
+	INC 1, IX
+L1197:
+	INC 2, D
+L1198:
+	INC 2, D
+L1199:
+	DEC 1, L
+L1200:
+	INC 4, XWA
+L1201:
+	INC 5, HL
+L1202:
+	INC 8, WA
+L1203:
+	DEC 5, IZ
+L1204:
+	DEC 1, XIZ
+L1205:
+	DEC 2, DE
+L1206:
+	INC 8, XIX
+L1207:
+	DEC 3, H
+L1208:
+	INC 5, XDE
+L1209:
+	DEC 2, BC
+L1210:
+	INC 2, IY
+L1211:
+	INC 6, XDE
+L1212:
+	INC 4, XWA
+L1213:
+	INC 6, B
+L1214:
+	DEC 5, BC
+L1215:
+	DEC 7, XWA
+L1216:
+	DEC 5, XIZ
+L1217:
+	DEC 8, E
+L1218:
+	INC 3, W
+L1219:
+	DEC 7, DE
+L1220:
+	INC 3, E
+L1221:
+	DEC 8, E
+L1222:
+	INC 2, W
+L1223:
+	INC 1, IY
+L1224:
+	DEC 6, E
+L1225:
+	DEC 6, L
+L1226:
+	INC 4, XBC
+L1227:
+	INC 4, C
+L1228:
+	DEC 2, IX
+L1229:
+	INC 4, BC
+L1230:
+	INC 8, XHL
+L1231:
+	DEC 1, XIY
+L1232:
+	INC 1, XHL
+L1233:
+	INC 2, B
+L1234:
+	DEC 7, XIX
+L1235:
+	INC 7, IY
+L1236:
+	DEC 6, XIZ
+L1237:
+	DEC 1, E
+L1238:
+	DEC 6, B
+L1239:
+	INC 6, W
+L1240:
+	DEC 1, D
+L1241:
+	DEC 5, XIX
+L1242:
+	DEC 7, A
+L1243:
+	DEC 4, XWA
+L1244:
+	INC 3, XIZ
+L1245:
+	INC 2, WA
+L1246:
+	INC 8, XDE
+L1247:
+	INC 8, XDE
+L1248:
+	INC 7, B
+L1249:
+	INC 3, DE
+L1250:
+	INC 3, E
+L1251:
+	INC 7, H
+L1252:
+	INC 5, XWA
+L1253:
+	INC 8, HL
+L1254:
+	DEC 3, L
+L1255:
+	DEC 2, L
+L1256:
+	INC 1, E
+L1257:
+	INC 6, IX
+L1258:
+	DEC 4, BC
+L1259:
+	DEC 8, XIZ
+L1260:
+	DEC 8, E
+L1261:
+	DEC 4, D
+L1262:
+	DEC 1, XHL
+L1263:
+	INC 5, H
+L1264:
+	INC 3, H
+L1265:
+	INC 3, IX
+L1266:
+	DEC 8, IX
+L1267:
+	INC 3, B
+L1268:
+	INC 6, XHL
+L1269:
+	INC 5, XDE
+L1270:
+	DEC 4, XIX
+L1271:
+	DEC 6, IY
+L1272:
+	INC 5, XWA
+L1273:
+	INC 3, E
+L1274:
+	DEC 6, E
+L1275:
+	INC 7, C
+L1276:
+	INC 4, HL
+L1277:
+	DEC 2, W
+L1278:
+	DEC 2, XIZ
+L1279:
+	INC 6, B
+L1280:
+	DEC 6, BC
+L1281:
+	DEC 1, XBC
+L1282:
+	DEC 7, B
+L1283:
+	INC 7, XDE
+L1284:
+	DEC 5, XIX
+L1285:
+	INC 8, XIY
+L1286:
+	DEC 6, XDE
+L1287:
+	INC 4, L
+L1288:
+	DEC 5, XBC
+L1289:
+	INC 5, XIX
+L1290:
+	INC 8, E
+L1291:
+	INC 6, D
+L1292:
+	INC 2, XWA
+L1293:
+	DEC 3, H
+L1294:
+	INC 1, IX
+L1295:
+	DEC 4, IX
+L1296:
+	DEC 1, C
+L1297:
+	DEC 4, XIX
+L1298:
+	DEC 1, XHL
+L1299:
+	DEC 8, BC
+L1300:
+	DEC 4, WA
+L1301:
+	INC 6, XDE
+L1302:
+	DEC 5, L
+L1303:
+	DEC 2, DE
+L1304:
+	INC 6, BC
+L1305:
+	DEC 5, L
+L1306:
+	DEC 4, W
+L1307:
+	DEC 1, IX
+L1308:
+	DEC 6, IZ
+L1309:
+	INC 6, XIY
+L1310:
+	INC 4, C
+L1311:
+	INC 5, D
+L1312:
+	INC 3, W
+L1313:
+	DEC 6, A
+L1314:
+	INC 1, B
+L1315:
+	INC 5, IZ
+L1316:
+	INC 8, D
+L1317:
+	INC 7, IZ
+L1318:
+	INC 2, XIY
+L1319:
+	DEC 2, C
+L1320:
+	INC 5, WA
+L1321:
+	DEC 4, C
+L1322:
+	INC 7, WA
+L1323:
+	DEC 3, WA
+L1324:
+	DEC 3, XIZ
+L1325:
+	INC 1, IY
+L1326:
+	DEC 6, DE
+L1327:
+	DEC 1, IY
+L1328:
+	INC 7, HL
+L1329:
+	DEC 3, XIY
+L1330:
+	INC 1, HL
+L1331:
+	INC 3, XWA
+L1332:
+	DEC 4, XIY
+L1333:
+	DEC 2, HL
+L1334:
+	DEC 3, B
+L1335:
+	DEC 4, H
+L1336:
+	DEC 6, DE
+L1337:
+	INC 8, A
+L1338:
+	DEC 4, DE
+L1339:
+	DEC 5, XWA
+L1340:
+	DEC 8, XHL
+L1341:
+	INC 8, IZ
+L1342:
+	INC 7, XIZ
+L1343:
+	DEC 2, XIZ
+L1344:
+	DEC 1, XDE
+L1345:
+	DEC 4, D
+L1346:
+	INC 4, E
+L1347:
+	DEC 3, XHL
+L1348:
+	DEC 2, XDE
+L1349:
+	INC 5, IX
+L1350:
+	INC 8, IX
+L1351:
+	DEC 6, L
+L1352:
+	INC 3, XIY
+L1353:
+	INC 8, C
+L1354:
+	DEC 7, XHL
+L1355:
+	DEC 1, IY
+L1356:
+	INC 6, XIY
+L1357:
+	INC 2, W
+L1358:
+	INC 5, W
+L1359:
+	INC 6, XHL
+L1360:
+	DEC 6, XWA
+L1361:
+	INC 1, WA
+L1362:
+	DEC 2, XWA
+L1363:
+	DEC 5, XWA
+L1364:
+	DEC 7, HL
+L1365:
+	DEC 5, D
+L1366:
+	INC 5, XDE
+L1367:
+	DEC 4, IX
+L1368:
+	DEC 1, BC
+L1369:
+	INC 3, IX
+L1370:
+	DEC 3, XIY
+L1371:
+	INC 3, XWA
+L1372:
+	INC 7, XWA
+L1373:
+	INC 4, L
+L1374:
+	DEC 2, W
+L1375:
+	INC 1, IZ
+L1376:
+	INC 8, A
+L1377:
+	DEC 5, B
+L1378:
+	INC 8, BC
+L1379:
+	DEC 4, B
+L1380:
+	DEC 3, XWA
+L1381:
+	INC 3, IZ
+L1382:
+	INC 2, BC
+L1383:
+	DEC 5, BC
+L1384:
+	DEC 3, IX
+L1385:
+	INC 4, WA
+L1386:
+	INC 1, L
+L1387:
+	INC 3, C
+L1388:
+	DEC 3, XIY
+L1389:
+	DEC 7, WA
+L1390:
+	INC 5, XIX
+L1391:
+	INC 5, IY
+L1392:
+	DEC 2, B
+L1393:
+	INC 2, W
+L1394:
+	INC 7, XBC
+L1395:
+	DEC 2, A
+L1396:
+	DEC 2, B
+L1397:
+	DEC 4, XIY
+L1398:
+	DEC 1, DE
+L1399:
+	DEC 6, IZ
+L1400:
+	INC 3, H
+L1401:
+	INC 8, BC
+L1402:
+	DEC 8, DE
+L1403:
+	INC 7, W
+L1404:
+	DEC 8, BC
+L1405:
+	INC 4, H
+L1406:
+	DEC 8, C
+L1407:
+	DEC 5, BC
+L1408:
+	INC 8, A
+L1409:
+	DEC 3, C
+L1410:
+	INC 5, XBC
+L1411:
+	INC 3, DE
+L1412:
+	INC 7, L
+L1413:
+	DEC 2, IY
+L1414:
+	INC 2, C
+L1415:
+	DEC 1, L
+L1416:
+	DEC 3, BC
+L1417:
+	DEC 8, H
+L1418:
+	DEC 6, WA
+L1419:
+	INC 6, IX
+L1420:
+	INC 4, IZ
+L1421:
+	DEC 7, D
+L1422:
+	DEC 8, XWA
+L1423:
+	INC 4, XDE
+L1424:
+	DEC 4, IY
+L1425:
+	DEC 1, W
+L1426:
+	DEC 6, L
+L1427:
+	INC 7, XIZ
+L1428:
+	DEC 5, XIY
+L1429:
+	INC 3, XIZ
+L1430:
+	INC 8, XHL
+L1431:
+	DEC 2, HL
+L1432:
+	DEC 1, WA
+L1433:
+	DEC 7, IY
+L1434:
+	INC 5, XDE
+L1435:
+	INC 2, C
+L1436:
+	INC 6, W
+L1437:
+	INC 4, E
+L1438:
+	DEC 8, XDE
+L1439:
+	DEC 8, XWA
+L1440:
+	DEC 1, D
+L1441:
+	DEC 5, DE
+L1442:
+	INC 4, WA
+L1443:
+	INC 5, BC
+L1444:
+	INC 4, A
+L1445:
+	DEC 6, XBC
+L1446:
+	INC 2, XIZ
+L1447:
+	DEC 3, HL
+L1448:
+	INC 8, XIX
+L1449:
+	DEC 2, XIY
+L1450:
+	INC 7, XHL
+L1451:
+	DEC 8, IX
+L1452:
+	INC 5, XWA
+L1453:
+	INC 1, XWA
+L1454:
+	INC 5, XIX
+L1455:
+	INC 5, WA
+L1456:
+	INC 2, XDE
+L1457:
+	INC 4, L
+L1458:
+	DEC 7, L
+L1459:
+	DEC 7, B
+L1460:
+	DEC 7, IZ
+L1461:
+	INC 2, E
+L1462:
+	INC 2, XIY
+L1463:
+	INC 6, IZ
+L1464:
+	DEC 5, XIZ
+L1465:
+	DEC 6, IX
+L1466:
+	INC 5, XIX
+L1467:
+	DEC 6, B
+L1468:
+	DEC 6, XIY
+L1469:
+	DEC 5, DE
+L1470:
+	INC 4, XDE
+L1471:
+	INC 3, XWA
+L1472:
+	DEC 2, BC
+L1473:
+	INC 6, IY
+L1474:
+	INC 3, D
+L1475:
+	INC 4, XDE
+L1476:
+	INC 7, XHL
+L1477:
+	INC 7, XIX
+L1478:
+	INC 8, D
+L1479:
+	DEC 4, H
+L1480:
+	INC 3, IZ
+L1481:
+	DEC 5, XBC
+L1482:
+	DEC 7, XIX
+L1483:
+	DEC 5, XHL
+L1484:
+	INC 8, XWA
+L1485:
+	INC 4, IY
+L1486:
+	DEC 8, HL
+L1487:
+	INC 2, D
+L1488:
+	DEC 6, D
+L1489:
+	DEC 7, WA
+L1490:
+	INC 2, HL
+L1491:
+	INC 5, XDE
+L1492:
+	INC 5, D
+L1493:
+	INC 3, W
+L1494:
+	INC 6, IZ
+L1495:
+	INC 5, DE
+L1496:
+	INC 5, XIZ
+L1497:
+	INC 4, XIY
+L1498:
+	DEC 1, WA
+L1499:
+	DEC 5, BC
+L1500:
+	INC 3, H
+L1501:
+	DEC 6, XHL
+L1502:
+	INC 6, XBC
+L1503:
+	INC 6, DE
+L1504:
+	DEC 4, E
+L1505:
+	DEC 8, XHL
+L1506:
+	INC 7, A
+L1507:
+	DEC 6, A
+L1508:
+	DEC 7, H
+L1509:
+	INC 7, IX
+L1510:
+	DEC 7, C
+L1511:
+	INC 8, XWA
+L1512:
+	DEC 2, WA
+L1513:
+	DEC 4, XWA
+L1514:
+	DEC 4, C
+L1515:
+	DEC 7, L
+L1516:
+	INC 1, DE
+L1517:
+	DEC 2, DE
+L1518:
+	DEC 6, XWA
+L1519:
+	DEC 4, XDE
+L1520:
+	DEC 8, XIZ
+L1521:
+	INC 4, XWA
+L1522:
+	INC 5, A
+L1523:
+	DEC 6, XIZ
+L1524:
+	INC 3, IY
+L1525:
+	DEC 3, XHL
+L1526:
+	INC 4, H
+L1527:
+	DEC 8, H
+L1528:
+	INC 7, XIY
+L1529:
+	INC 5, XIY
+L1530:
+	INC 7, B
+L1531:
+	DEC 4, XHL
+L1532:
+	INC 6, B
+L1533:
+	INC 6, DE
+L1534:
+	DEC 3, XWA
+L1535:
+	DEC 6, B
+L1536:
+	INC 4, XDE
+L1537:
+	INC 7, IY
+L1538:
+	INC 6, E
+L1539:
+	DEC 3, W
+L1540:
+	DEC 6, E
+L1541:
+	DEC 6, XHL
+L1542:
+	DEC 4, H
+L1543:
+	DEC 6, A
+L1544:
+	DEC 5, XHL
+L1545:
+	INC 6, BC
+L1546:
+	INC 8, HL
+L1547:
+	INC 2, IZ
+L1548:
+	DEC 7, WA
+L1549:
+	DEC 1, IZ
+L1550:
+	DEC 8, XHL
+L1551:
+	INC 7, BC
+L1552:
+	INC 1, XWA
+L1553:
+	INC 8, E
+L1554:
+	DEC 7, XIY
+L1555:
+	DEC 4, XIY
+L1556:
+	INC 2, H
+L1557:
+	DEC 5, XIZ
+L1558:
+	INC 4, C
+L1559:
+	DEC 1, XDE
+L1560:
+	INC 5, HL
+L1561:
+	DEC 3, L
+L1562:
+	INC 8, XWA
+L1563:
+	INC 4, XWA
+L1564:
+	DEC 2, XDE
+L1565:
+	INC 7, XWA
+L1566:
+	INC 2, XBC
+L1567:
+	INC 8, WA
+L1568:
+	DEC 2, B
+L1569:
+	INC 1, L
+L1570:
+	INC 3, H
+L1571:
+	DEC 7, W
+L1572:
+	DEC 2, A
+L1573:
+	INC 1, B
+L1574:
+	INC 6, A
+L1575:
+	INC 5, WA
+L1576:
+	INC 4, WA
+L1577:
+	DEC 6, IY
+L1578:
+	INC 2, IZ
+L1579:
+	DEC 4, XBC
+L1580:
+	INC 4, IZ
+L1581:
+	DEC 4, BC
+L1582:
+	DEC 5, BC
+L1583:
+	DEC 4, IX
+L1584:
+	DEC 6, IZ
+L1585:
+	DEC 6, XWA
+L1586:
+	DEC 6, IY
+L1587:
+	DEC 3, B
+L1588:
+	DEC 7, HL
+L1589:
+	INC 6, D
+L1590:
+	INC 6, H
+L1591:
+	DEC 3, IX
+L1592:
+	INC 3, A
+L1593:
+	DEC 1, L
+L1594:
+	DEC 7, D
+L1595:
+	INC 7, XDE
+L1596:
+	DEC 1, BC
+L1597:
+	INC 6, C
+L1598:
+	DEC 4, WA
+L1599:
+	DEC 3, XHL
+L1600:
+	INC 2, D
+L1601:
+	DEC 3, XDE
+L1602:
+	INC 7, E
+L1603:
+	DEC 6, XDE
+L1604:
+	INC 2, XIZ
+L1605:
+	INC 1, L
+L1606:
+	INC 1, IX
+L1607:
+	INC 7, XBC
+L1608:
+	DEC 1, IX
+L1609:
+	DEC 3, W
+L1610:
+	DEC 7, XDE
+L1611:
+	DEC 8, IZ
+L1612:
+	INC 3, L
+L1613:
+	INC 1, XWA
+L1614:
+	INC 5, XBC
+L1615:
+	INC 8, A
+L1616:
+	DEC 6, H
+L1617:
+	INC 1, XWA
+L1618:
+	DEC 3, IZ
+L1619:
+	DEC 7, XWA
+L1620:
+	DEC 7, L
+L1621:
+	INC 4, W
+L1622:
+	DEC 3, XBC
+L1623:
+	INC 6, XIY
+L1624:
+	DEC 8, XHL
+L1625:
+	INC 8, XBC
+L1626:
+	DEC 6, E
+L1627:
+	INC 7, W
+L1628:
+	DEC 7, XBC
+L1629:
+	DEC 5, XIY
+L1630:
+	INC 2, B
+L1631:
+	INC 5, XHL
+L1632:
+	DEC 5, D
+L1633:
+	INC 7, DE
+L1634:
+	INC 5, L
+L1635:
+	DEC 3, XWA
+L1636:
+	DEC 7, WA
+L1637:
+	DEC 3, HL
+L1638:
+	INC 7, HL
+L1639:
+	DEC 8, XIY
+L1640:
+	DEC 6, IY
+L1641:
+	INC 8, A
+L1642:
+	INC 5, XWA
+L1643:
+	INC 5, E
+L1644:
+	DEC 8, H
+L1645:
+	DEC 1, D
+L1646:
+	INC 6, XWA
+L1647:
+	DEC 7, XIX
+L1648:
+	INC 4, XIX
+L1649:
+	INC 5, XWA
+L1650:
+	INC 8, HL
+L1651:
+	DEC 4, IZ
+L1652:
+	INC 8, HL
+L1653:
+	INC 3, HL
+L1654:
+	DEC 8, XHL
+L1655:
+	DEC 4, IZ
+L1656:
+	INC 7, XDE
+L1657:
+	DEC 3, B
+L1658:
+	INC 6, C
+L1659:
+	DEC 2, C
+L1660:
+	INC 3, HL
+L1661:
+	INC 5, IY
+L1662:
+	DEC 5, XBC
+L1663:
+	DEC 3, IX
+L1664:
+	DEC 3, BC
+L1665:
+	INC 7, XDE
+L1666:
+	INC 1, HL
+L1667:
+	DEC 7, XWA
+L1668:
+	DEC 3, XBC
+L1669:
+	INC 5, DE
+L1670:
+	DEC 8, C
+L1671:
+	INC 8, XHL
+L1672:
+	DEC 1, E
+L1673:
+	DEC 5, XBC
+L1674:
+	DEC 4, L
+L1675:
+	INC 7, C
+L1676:
+	INC 7, HL
+L1677:
+	DEC 4, A
+L1678:
+	INC 2, E
+L1679:
+	DEC 2, IZ
+L1680:
+	INC 3, A
+L1681:
+	INC 5, D
+L1682:
+	INC 7, WA
+L1683:
+	INC 2, HL
+L1684:
+	DEC 6, IY
+L1685:
+	DEC 1, XIX
+L1686:
+	INC 5, DE
+L1687:
+	INC 4, XIY
+L1688:
+	INC 5, XDE
+L1689:
+	DEC 5, D
+L1690:
+	DEC 5, XIX
+L1691:
+	INC 3, D
+L1692:
+	INC 6, D
+L1693:
+	INC 7, XIX
+L1694:
+	INC 6, H
+L1695:
+	INC 3, IZ
+L1696:
+	INC 5, XDE
+L1697:
+	INC 7, B
+L1698:
+	DEC 1, HL
+L1699:
+	INC 7, XHL
+L1700:
+	INC 4, B
+L1701:
+	DEC 7, IY
+L1702:
+	DEC 3, XIZ
+L1703:
+	DEC 5, XHL
+L1704:
+	DEC 7, H
+L1705:
+	DEC 5, XIY
+L1706:
+	INC 1, IY
+L1707:
+	DEC 1, XBC
+L1708:
+	DEC 6, WA
+L1709:
+	INC 1, XBC
+L1710:
+	DEC 6, IY
+L1711:
+	DEC 3, L
+L1712:
+	DEC 2, IZ
+L1713:
+	DEC 3, H
+L1714:
+	DEC 5, IX
+L1715:
+	DEC 5, HL
+L1716:
+	DEC 6, B
+L1717:
+	DEC 2, W
+L1718:
+	DEC 3, HL
+L1719:
+	DEC 5, XBC
+L1720:
+	DEC 1, XWA
+L1721:
+	INC 4, XDE
+L1722:
+	INC 3, IX
+L1723:
+	DEC 5, H
+L1724:
+	INC 3, IY
+L1725:
+	INC 1, XBC
+L1726:
+	DEC 4, XIZ
+L1727:
+	DEC 3, WA
+L1728:
+	INC 2, C
+L1729:
+	DEC 3, D
+L1730:
+	DEC 7, IY
+L1731:
+	INC 6, H
+L1732:
+	INC 2, XDE
+L1733:
+	DEC 6, W
+L1734:
+	INC 8, XBC
+L1735:
+	DEC 8, BC
+L1736:
+	DEC 5, XIX
+L1737:
+	INC 6, IZ
+L1738:
+	INC 6, XBC
+L1739:
+	INC 6, B
+L1740:
+	INC 8, IY
+L1741:
+	DEC 3, XIX
+L1742:
+	INC 2, A
+L1743:
+	DEC 3, WA
+L1744:
+	INC 1, XIZ
+L1745:
+	INC 5, H
+L1746:
+	DEC 1, IZ
+L1747:
+	INC 6, IX
+L1748:
+	DEC 3, WA
+L1749:
+	INC 3, XIX
+L1750:
+	DEC 8, B
+L1751:
+	INC 7, HL
+L1752:
+	DEC 4, XBC
+L1753:
+	DEC 6, H
+L1754:
+	INC 3, XWA
+L1755:
+	INC 1, D
+L1756:
+	INC 7, E
+L1757:
+	INC 2, XIY
+L1758:
+	INC 4, H
+L1759:
+	INC 1, IX
+L1760:
+	DEC 3, C
+L1761:
+	DEC 6, WA
+L1762:
+	INC 6, IY
+L1763:
+	INC 3, XIZ
+L1764:
+	DEC 8, H
+L1765:
+	DEC 7, IX
+L1766:
+	INC 4, XHL
+L1767:
+	DEC 3, XDE
+L1768:
+	DEC 4, D
+L1769:
+	DEC 3, XIY
+L1770:
+	DEC 4, IY
+L1771:
+	INC 2, IX
+L1772:
+	INC 8, E
+L1773:
+	DEC 8, A
+L1774:
+	DEC 2, HL
+L1775:
+	INC 4, A
+L1776:
+	DEC 4, XIX
+L1777:
+	DEC 4, IX
+L1778:
+	DEC 4, IZ
+L1779:
+	INC 1, H
+L1780:
+	DEC 7, DE
+L1781:
+	INC 6, WA
+L1782:
+	INC 4, HL
+L1783:
+	INC 1, C
+L1784:
+	INC 1, WA
+L1785:
+	INC 6, XDE
+L1786:
+	DEC 4, BC
+L1787:
+	INC 1, B
+L1788:
+	INC 3, DE
+L1789:
+	INC 8, XIZ
+L1790:
+	INC 3, L
+L1791:
+	INC 2, XIX
+L1792:
+	INC 7, A
+L1793:
+	INC 7, IY
+L1794:
+	INC 1, C
+L1795:
+	INC 7, HL
+L1796:
+	DEC 4, E
+L1797:
+	DEC 2, IY
+L1798:
+	INC 4, XBC
+L1799:
+	DEC 4, C
+L1800:
+	DEC 6, L
+L1801:
+	DEC 2, XIY
+L1802:
+	INC 8, IY
+L1803:
+	INC 8, XDE
+L1804:
+	DEC 4, IY
+L1805:
+	DEC 8, DE
+L1806:
+	INC 7, D
+L1807:
+	DEC 1, H
+L1808:
+	INC 3, XHL
+L1809:
+	INC 3, A
+L1810:
+	INC 8, A
+L1811:
+	INC 7, IX
+L1812:
+	INC 1, WA
+L1813:
+	INC 4, XBC
+L1814:
+	INC 1, HL
+L1815:
+	DEC 1, XDE
+L1816:
+	INC 3, XBC
+L1817:
+	DEC 4, HL
+L1818:
+	INC 5, W
+L1819:
+	DEC 8, W
+L1820:
+	DEC 5, L
+L1821:
+	DEC 7, B
+L1822:
+	DEC 4, IZ
+L1823:
+	DEC 1, L
+L1824:
+	INC 8, WA
+L1825:
+	INC 2, H
+L1826:
+	DEC 1, BC
+L1827:
+	DEC 1, A
+L1828:
+	INC 7, XBC
+L1829:
+	DEC 3, XIY
+L1830:
+	INC 7, IX
+L1831:
+	INC 1, BC
+L1832:
+	INC 8, IY
+L1833:
+	INC 5, C
+L1834:
+	DEC 6, HL
+L1835:
+	INC 5, XIZ
+L1836:
+	DEC 1, A
+L1837:
+	DEC 3, HL
+L1838:
+	INC 4, H
+L1839:
+	DEC 2, XIY
+L1840:
+	INC 6, XIX
+L1841:
+	INC 5, XDE
+L1842:
+	DEC 6, DE
+L1843:
+	DEC 6, BC
+L1844:
+	INC 2, D
+L1845:
+	DEC 3, XHL
+L1846:
+	INC 2, C
+L1847:
+	DEC 1, BC
+L1848:
+	DEC 2, XIY
+L1849:
+	INC 3, XBC
+L1850:
+	DEC 8, IX
+L1851:
+	INC 2, A
+L1852:
+	INC 6, HL
+L1853:
+	INC 7, IY
+L1854:
+	INC 1, WA
+L1855:
+	DEC 6, D
+L1856:
+	INC 5, A
+L1857:
+	DEC 4, HL
+L1858:
+	INC 2, DE
+L1859:
+	INC 4, HL
+L1860:
+	INC 2, XBC
+L1861:
+	DEC 4, A
+L1862:
+	INC 2, B
+L1863:
+	INC 3, XBC
+L1864:
+	INC 5, IX
+L1865:
+	INC 5, HL
+L1866:
+	INC 6, WA
+L1867:
+	DEC 3, XIZ
+L1868:
+	DEC 1, IX
+L1869:
+	INC 6, D
+L1870:
+	DEC 5, W
+L1871:
+	INC 4, XDE
+L1872:
+	DEC 7, XIZ
+L1873:
+	DEC 7, A
+L1874:
+	DEC 3, IY
+L1875:
+	DEC 3, XWA
+L1876:
+	DEC 3, XDE
+L1877:
+	INC 6, XWA
+L1878:
+	DEC 2, BC
+L1879:
+	INC 7, XIY
+L1880:
+	INC 8, E
+L1881:
+	DEC 1, XIX
+L1882:
+	INC 1, B
+L1883:
+	INC 3, IZ
+L1884:
+	INC 3, XIX
+L1885:
+	DEC 7, H
+L1886:
+	INC 6, XWA
+L1887:
+	INC 5, XHL
+L1888:
+	INC 4, A
+L1889:
+	INC 8, XHL
+L1890:
+	DEC 1, XHL
+L1891:
+	DEC 5, XIZ
+L1892:
+	INC 6, W
+L1893:
+	DEC 6, DE
+L1894:
+	DEC 6, IX
+L1895:
+	INC 1, C
+L1896:
+	DEC 7, IZ
+L1897:
+	INC 4, XWA
+L1898:
+	INC 3, E
+L1899:
+	DEC 2, IX
+L1900:
+	DEC 4, XHL
+L1901:
+	DEC 8, HL
+L1902:
+	DEC 5, H
+L1903:
+	INC 4, E
+L1904:
+	INC 1, L
+L1905:
+	DEC 5, W
+L1906:
+	DEC 5, W
+L1907:
+	DEC 5, A
+L1908:
+	DEC 2, XWA
+L1909:
+	DEC 5, XIY
+L1910:
+	INC 4, W
+L1911:
+	INC 5, IY
+L1912:
+	DEC 8, L
+L1913:
+	DEC 2, DE
+L1914:
+	INC 2, XIX
+L1915:
+	DEC 3, BC
+L1916:
+	INC 2, E
+L1917:
+	INC 7, XBC
+L1918:
+	DEC 1, IY
+L1919:
+	DEC 1, D
+L1920:
+	DEC 4, XIX
+L1921:
+	DEC 6, XIZ
+L1922:
+	DEC 5, XDE
+L1923:
+	DEC 3, IX
+L1924:
+	DEC 7, E
+L1925:
+	DEC 2, DE
+L1926:
+	INC 5, H
+L1927:
+	DEC 7, XIX
+L1928:
+	INC 6, IX
+L1929:
+	DEC 1, XBC
+L1930:
+	DEC 6, XIY
+L1931:
+	INC 2, L
+L1932:
+	INC 7, B
+L1933:
+	INC 8, L
+L1934:
+	INC 1, XIY
+L1935:
+	DEC 2, L
+L1936:
+	INC 8, XDE
+L1937:
+	INC 1, XIX
+L1938:
+	DEC 5, C
+L1939:
+	INC 8, WA
+L1940:
+	DEC 7, IZ
+L1941:
+	INC 2, XBC
+L1942:
+	DEC 5, L
+L1943:
+	DEC 4, L
+L1944:
+	INC 3, A
+L1945:
+	DEC 4, XBC
+L1946:
+	INC 8, B
+L1947:
+	DEC 8, HL
+L1948:
+	DEC 6, IZ
+L1949:
+	INC 3, XHL
+L1950:
+	INC 1, XIZ
+L1951:
+	DEC 8, BC
+L1952:
+	INC 8, W
+L1953:
+	INC 6, XWA
+L1954:
+	DEC 5, D
+L1955:
+	INC 4, C
+L1956:
+	DEC 6, XBC
+L1957:
+	DEC 5, IY
+L1958:
+	DEC 8, W
+L1959:
+	INC 1, XIX
+L1960:
+	INC 5, C
+L1961:
+	DEC 3, W
+L1962:
+	INC 1, B
+L1963:
+	INC 2, L
+L1964:
+	DEC 6, C
+L1965:
+	DEC 8, IX
+L1966:
+	DEC 6, XHL
+L1967:
+	DEC 1, XBC
+L1968:
+	DEC 6, XIY
+L1969:
+	DEC 7, A
+L1970:
+	INC 8, BC
+L1971:
+	INC 6, BC
+L1972:
+	DEC 3, A
+L1973:
+	INC 8, XDE
+L1974:
+	DEC 4, B
+L1975:
+	DEC 6, A
+L1976:
+	DEC 5, XHL
+L1977:
+	DEC 5, XDE
+L1978:
+	INC 5, XDE
+L1979:
+	DEC 8, E
+L1980:
+	INC 6, W
+L1981:
+	INC 4, HL
+L1982:
+	DEC 3, H
+L1983:
+	DEC 8, XBC
+L1984:
+	INC 2, E
+L1985:
+	DEC 6, IY
+L1986:
+	DEC 7, A
+L1987:
+	INC 8, H
+L1988:
+	DEC 6, H
+L1989:
+	DEC 6, A
+L1990:
+	DEC 2, IY
+L1991:
+	DEC 6, XHL
+L1992:
+	INC 2, XIZ
+L1993:
+	DEC 6, W
+L1994:
+	INC 5, XWA
+L1995:
+	INC 7, L
+L1996:
+	DEC 2, DE
+L1997:
+	INC 5, XIZ
+L1998:
+	INC 7, A
+L1999:
+	INC 8, XHL
+L2000:
+	DEC 1, BC
+L2001:
+	DEC 4, IZ
+L2002:
+	INC 6, C
+L2003:
+	DEC 2, XIZ
+L2004:
+	DEC 5, A
+L2005:
+	INC 1, E
+L2006:
+	INC 8, L
+L2007:
+	INC 4, XHL
+L2008:
+	DEC 3, W
+L2009:
+	INC 4, XIY
+L2010:
+	DEC 7, XIY
+L2011:
+	DEC 4, E
+L2012:
+	DEC 4, XBC
+L2013:
+	DEC 2, XIZ
+L2014:
+	INC 2, IX
+L2015:
+	INC 3, XIX
+L2016:
+	DEC 5, XWA
+L2017:
+	INC 2, XWA
+L2018:
+	INC 3, B
+L2019:
+	DEC 5, XIX
+L2020:
+	DEC 8, WA
+L2021:
+	DEC 8, B
+L2022:
+	INC 7, IX
+L2023:
+	INC 6, XBC
+L2024:
+	INC 1, IZ
+L2025:
+	DEC 3, D
+L2026:
+	DEC 2, IX
+L2027:
+	DEC 1, A
+L2028:
+	INC 7, BC
+L2029:
+	INC 6, XIX
+L2030:
+	INC 4, BC
+L2031:
+	DEC 5, XWA
+L2032:
+	DEC 7, H
+L2033:
+	DEC 6, XDE
+L2034:
+	DEC 1, IZ
+L2035:
+	INC 1, C
+L2036:
+	DEC 3, B
+L2037:
+	INC 3, BC
+L2038:
+	DEC 4, L
+L2039:
+	DEC 2, E
+L2040:
+	DEC 7, BC
+L2041:
+	DEC 3, IZ
+L2042:
+	INC 3, XDE
+L2043:
+	INC 1, WA
+L2044:
+	DEC 1, IZ
+L2045:
+	DEC 1, IY
+L2046:
+	DEC 7, A
+L2047:
+	INC 8, HL
+L2048:
+	DEC 4, IY
+L2049:
+	DEC 2, XWA
+L2050:
+	DEC 4, L
+L2051:
+	DEC 6, XDE
+L2052:
+	DEC 1, XHL
+L2053:
+	INC 6, IY
+L2054:
+	INC 8, WA
+L2055:
+	DEC 6, BC
+L2056:
+	DEC 1, XWA
+L2057:
+	DEC 3, XDE
+L2058:
+	INC 2, W
+L2059:
+	DEC 6, IX
+L2060:
+	DEC 6, XBC
+L2061:
+	DEC 2, B
+L2062:
+	INC 5, DE
+L2063:
+	INC 8, IX
+L2064:
+	DEC 4, IZ
+L2065:
+	INC 7, XIX
+L2066:
+	INC 8, XIY
+L2067:
+	DEC 8, DE
+L2068:
+	DEC 5, XIZ
+L2069:
+	INC 3, WA
+L2070:
+	INC 7, WA
+L2071:
+	INC 4, A
+L2072:
+	INC 4, DE
+L2073:
+	DEC 3, XIX
+L2074:
+	INC 6, W
+L2075:
+	INC 6, C
+L2076:
+	INC 8, E
+L2077:
+	DEC 4, E
+L2078:
+	DEC 5, A
+L2079:
+	DEC 3, C
+L2080:
+	INC 1, E
+L2081:
+	DEC 8, H
+L2082:
+	DEC 6, WA
+L2083:
+	INC 6, XIZ
+L2084:
+	INC 7, HL
+L2085:
+	INC 1, XIX
+L2086:
+	DEC 4, W
+L2087:
+	DEC 1, D
+L2088:
+	DEC 3, XIZ
+L2089:
+	DEC 5, E
+L2090:
+	INC 1, XWA
+L2091:
+	DEC 5, DE
+L2092:
+	DEC 7, H
+L2093:
+	INC 2, HL
+L2094:
+	INC 5, XHL
+L2095:
+	DEC 6, E
+L2096:
+	INC 6, C
+L2097:
+	DEC 8, XIZ
+L2098:
+	DEC 5, WA
+L2099:
+	DEC 6, XWA
+L2100:
+	INC 1, XIY
+L2101:
+	INC 3, XHL
+L2102:
+	INC 7, XIY
+L2103:
+	INC 3, IY
+L2104:
+	DEC 8, HL
+L2105:
+	INC 3, XIZ
+L2106:
+	INC 2, XBC
+L2107:
+	INC 3, B
+L2108:
+	INC 3, XDE
+L2109:
+	INC 5, B
+L2110:
+	DEC 1, XIZ
+L2111:
+	DEC 2, H
+L2112:
+	INC 5, W
+L2113:
+	DEC 6, HL
+L2114:
+	INC 8, XHL
+L2115:
+	DEC 2, XHL
+L2116:
+	INC 7, IZ
+L2117:
+	DEC 4, A
+L2118:
+	DEC 6, XIX
+L2119:
+	INC 5, IY
+L2120:
+	DEC 8, XDE
+L2121:
+	INC 2, XBC
+L2122:
+	INC 4, B
+L2123:
+	INC 7, D
+L2124:
+	INC 4, E
+L2125:
+	DEC 6, C
+L2126:
+	INC 2, XHL
+L2127:
+	INC 1, IY
+L2128:
+	INC 5, BC
+L2129:
+	INC 6, E
+L2130:
+	DEC 3, W
+L2131:
+	DEC 1, DE
+L2132:
+	DEC 4, A
+L2133:
+	INC 5, XHL
+L2134:
+	INC 8, WA
+L2135:
+	INC 7, L
+L2136:
+	INC 7, XIX
+L2137:
+	INC 6, XIZ
+L2138:
+	DEC 3, XIX
+L2139:
+	DEC 8, XIY
+L2140:
+	INC 1, XWA
+L2141:
+	INC 7, A
+L2142:
+	DEC 7, XIY
+L2143:
+	DEC 1, H
+L2144:
+	DEC 6, IX
+L2145:
+	INC 8, B
+L2146:
+	INC 5, H
+L2147:
+	DEC 8, DE
+L2148:
+	DEC 2, XIY
+L2149:
+	INC 4, W
+L2150:
+	DEC 6, BC
+L2151:
+	DEC 5, WA
+L2152:
+	INC 2, C
+L2153:
+	INC 7, W
+L2154:
+	DEC 1, W
+L2155:
+	DEC 2, C
+L2156:
+	DEC 3, XDE
+L2157:
+	INC 2, XDE
+L2158:
+	DEC 4, L
+L2159:
+	INC 2, IX
+L2160:
+	INC 4, XIZ
+L2161:
+	INC 6, XIX
+L2162:
+	DEC 6, WA
+L2163:
+	INC 2, D
+L2164:
+	INC 7, XHL
+L2165:
+	INC 8, XHL
+L2166:
+	INC 5, XDE
+L2167:
+	INC 2, XIY
+L2168:
+	INC 2, IX
+L2169:
+	INC 4, B
+L2170:
+	INC 8, XDE
+L2171:
+	DEC 4, H
+L2172:
+	INC 3, W
+L2173:
+	INC 7, A
+L2174:
+	INC 7, XBC
+L2175:
+	DEC 7, WA
+L2176:
+	DEC 8, XIY
+L2177:
+	DEC 5, XWA
+L2178:
+	INC 2, C
+L2179:
+	DEC 3, D
+L2180:
+	INC 3, XHL
+L2181:
+	INC 1, IX
+L2182:
+	DEC 2, XWA
+L2183:
+	DEC 6, DE
+L2184:
+	INC 6, XIX
+L2185:
+	DEC 3, IZ
+L2186:
+	DEC 6, IX
+L2187:
+	INC 8, XHL
+L2188:
+	INC 3, XDE
+L2189:
+	DEC 4, XWA
+L2190:
+	INC 7, IX
+L2191:
+	INC 5, E
+L2192:
+	INC 3, BC
+L2193:
+	DEC 4, WA
+L2194:
+	INC 6, C
+L2195:
+	INC 2, D
+L2196:
+	INC 4, E
+L2197:
+	DEC 1, BC
+L2198:
+	DEC 5, A
+L2199:
+	DEC 1, XHL
+L2200:
+	DEC 5, D
+L2201:
+	INC 3, D
+L2202:
+	DEC 4, WA
+L2203:
+	INC 6, IX
+L2204:
+	INC 5, D
+L2205:
+	INC 2, DE
+L2206:
+	DEC 3, L
+L2207:
+	INC 1, HL
+L2208:
+	DEC 1, L
+L2209:
+	DEC 7, HL
+L2210:
+	DEC 7, HL
+L2211:
+	DEC 4, DE
+L2212:
+	INC 4, D
+L2213:
+	DEC 5, B
+L2214:
+	INC 5, DE
+L2215:
+	INC 2, IX
+L2216:
+	INC 3, XHL
+L2217:
+	INC 5, IY
+L2218:
+	INC 6, WA
+L2219:
+	DEC 3, H
+L2220:
+	INC 7, W
+L2221:
+	INC 8, XDE
+L2222:
+	INC 3, W
+L2223:
+	DEC 2, XBC
+L2224:
+	INC 6, IY
+L2225:
+	INC 7, XDE
+L2226:
+	DEC 2, DE
+L2227:
+	DEC 8, L
+L2228:
+	DEC 3, XBC
+L2229:
+	DEC 1, A
+L2230:
+	DEC 1, WA
+L2231:
+	DEC 8, IY
+L2232:
+	INC 3, DE
+L2233:
+	INC 7, L
+L2234:
+	INC 2, B
+L2235:
+	INC 3, XIZ
+L2236:
+	INC 8, WA
+L2237:
+	DEC 7, XIX
+L2238:
+	INC 1, L
+L2239:
+	INC 5, WA
+L2240:
+	INC 6, A
+L2241:
+	INC 4, XDE
+L2242:
+	DEC 1, HL
+L2243:
+	DEC 4, WA
+L2244:
+	DEC 1, WA
+L2245:
+	DEC 7, D
+L2246:
+	DEC 3, DE
+L2247:
+	INC 2, HL
+L2248:
+	DEC 5, HL
+L2249:
+	INC 4, A
+L2250:
+	INC 5, W
+L2251:
+	INC 2, XBC
+L2252:
+	DEC 1, B
+L2253:
+	DEC 1, XDE
+L2254:
+	DEC 3, XBC
+L2255:
+	DEC 7, XWA
+L2256:
+	INC 6, IY
+L2257:
+	DEC 8, W
+L2258:
+	INC 1, XHL
+L2259:
+	INC 1, D
+L2260:
+	INC 1, D
+L2261:
+	INC 3, DE
+L2262:
+	INC 4, IZ
+L2263:
+	DEC 6, XDE
+L2264:
+	INC 4, D
+L2265:
+	DEC 6, C
+L2266:
+	INC 3, D
+L2267:
+	INC 8, BC
+L2268:
+	INC 3, E
+L2269:
+	DEC 1, B
+L2270:
+	INC 2, XDE
+L2271:
+	INC 2, E
+L2272:
+	DEC 8, XWA
+L2273:
+	INC 5, DE
+L2274:
+	DEC 5, XHL
+L2275:
+	INC 6, B
+L2276:
+	INC 8, IX
+L2277:
+	DEC 7, W
+L2278:
+	INC 6, D
+L2279:
+	INC 1, E
+L2280:
+	DEC 5, H
+L2281:
+	INC 2, XHL
+L2282:
+	INC 8, BC
+L2283:
+	DEC 8, L
+L2284:
+	DEC 5, D
+L2285:
+	INC 6, B
+L2286:
+	INC 5, H
+L2287:
+	INC 1, WA
+L2288:
+	INC 1, HL
+L2289:
+	INC 5, E
+L2290:
+	INC 8, HL
+L2291:
+	DEC 4, BC
+L2292:
+	INC 2, HL
+L2293:
+	DEC 1, XIZ
+L2294:
+	INC 5, L
+L2295:
+	INC 8, XWA
+L2296:
+	DEC 8, XWA
+L2297:
+	INC 5, XWA
+L2298:
+	INC 1, HL
+L2299:
+	DEC 4, XIZ
+L2300:
+	INC 2, XWA
+L2301:
+	DEC 3, BC
+L2302:
+	DEC 5, H
+L2303:
+	INC 5, A
+L2304:
+	INC 7, HL
+L2305:
+	INC 7, XIX
+L2306:
+	DEC 1, W
+L2307:
+	DEC 3, XIX
+L2308:
+	DEC 3, B
+L2309:
+	DEC 5, WA
+L2310:
+	INC 1, IX
+L2311:
+	INC 3, IY
+L2312:
+	INC 2, BC
+L2313:
+	DEC 3, IX
+L2314:
+	INC 1, IX
+L2315:
+	DEC 2, DE
+L2316:
+	INC 2, XHL
+L2317:
+	INC 8, XWA
+L2318:
+	INC 7, L
+L2319:
+	DEC 3, XIX
+L2320:
+	INC 5, A
+L2321:
+	INC 7, WA
+L2322:
+	DEC 3, HL
+L2323:
+	DEC 8, B
+L2324:
+	INC 3, H
+L2325:
+	DEC 7, IY
+L2326:
+	DEC 3, XIX
+L2327:
+	DEC 4, A
+L2328:
+	DEC 5, XIZ
+L2329:
+	DEC 5, L
+L2330:
+	DEC 8, XDE
+L2331:
+	DEC 3, XIY
+L2332:
+	INC 3, XBC
+L2333:
+	DEC 6, HL
+L2334:
+	INC 2, XIZ
+L2335:
+	DEC 5, L
+L2336:
+	DEC 8, BC
+L2337:
+	INC 7, XWA
+L2338:
+	DEC 3, XBC
+L2339:
+	DEC 1, DE
+L2340:
+	DEC 7, H
+L2341:
+	DEC 2, XIX
+L2342:
+	DEC 3, XIY
+L2343:
+	DEC 7, A
+L2344:
+	INC 6, A
+L2345:
+	DEC 6, IZ
+L2346:
+	DEC 8, XHL
+L2347:
+	INC 5, C
+L2348:
+	INC 3, H
+L2349:
+	DEC 1, XDE
+L2350:
+	DEC 8, XIX
+L2351:
+	DEC 3, XIZ
+L2352:
+	INC 7, B
+L2353:
+	INC 2, XBC
+L2354:
+	INC 8, A
+L2355:
+	INC 4, IZ
+L2356:
+	INC 5, XIX
+L2357:
+	INC 7, BC
+L2358:
+	INC 6, XIZ
+L2359:
+	DEC 6, B
+L2360:
+	INC 2, IZ
+L2361:
+	DEC 7, BC
+L2362:
+	INC 8, D
+L2363:
+	DEC 5, XIX
+L2364:
+	INC 8, IZ
+L2365:
+	DEC 8, XDE
+L2366:
+	DEC 5, WA
+L2367:
+	INC 2, L
+L2368:
+	INC 7, XDE
+L2369:
+	INC 7, BC
+L2370:
+	DEC 8, D
+L2371:
+	INC 3, XHL
+L2372:
+	DEC 8, XWA
+L2373:
+	INC 3, IZ
+L2374:
+	INC 4, A
+L2375:
+	DEC 6, W
+L2376:
+	INC 8, IX
+L2377:
+	INC 1, DE
+L2378:
+	INC 1, BC
+L2379:
+	INC 6, C
+L2380:
+	DEC 5, XIY
+L2381:
+	INC 4, DE
+L2382:
+	INC 4, WA
+L2383:
+	DEC 1, XBC
+L2384:
+	DEC 2, WA
+L2385:
+	INC 3, XDE
+L2386:
+	INC 5, XIZ
+L2387:
+	DEC 5, B
+L2388:
+	DEC 3, IX
+L2389:
+	DEC 3, BC
+L2390:
+	INC 1, IX
+L2391:
+	DEC 2, IX
+L2392:
+	INC 7, XDE
+L2393:
+	INC 4, HL
+L2394:
+	DEC 3, D
+L2395:
+	INC 5, XDE
+L2396:
+	INC 4, HL
+L2397:
+	DEC 3, H
+L2398:
+	INC 3, XHL
+L2399:
+	INC 2, D
+L2400:
+	DEC 5, XIY
+L2401:
+	DEC 1, XWA
+L2402:
+	INC 2, XBC
+L2403:
+	INC 1, D
+L2404:
+	INC 8, XDE
+L2405:
+	DEC 1, BC
+L2406:
+	INC 3, XWA
+L2407:
+	DEC 6, H
+L2408:
+	INC 5, IZ
+L2409:
+	DEC 1, XBC
+L2410:
+	DEC 1, IZ
+L2411:
+	INC 1, A
+L2412:
+	DEC 2, XIZ
+L2413:
+	INC 6, C
+L2414:
+	INC 3, XHL
+L2415:
+	INC 6, XDE
+L2416:
+	INC 7, C
+L2417:
+	DEC 7, XWA
+L2418:
+	INC 5, XIZ
+L2419:
+	INC 2, XIX
+L2420:
+	INC 2, XIX
+L2421:
+	INC 2, XIZ
+L2422:
+	INC 4, XHL
+L2423:
+	INC 4, HL
+L2424:
+	DEC 3, A
+L2425:
+	INC 6, XBC
+L2426:
+	DEC 8, DE
+L2427:
+	INC 2, DE
+L2428:
+	INC 3, C
+L2429:
+	INC 7, W
+L2430:
+	DEC 4, XHL
+L2431:
+	DEC 8, HL
+L2432:
+	DEC 1, IZ
+L2433:
+	INC 3, A
+L2434:
+	INC 4, IX
+L2435:
+	DEC 2, WA
+L2436:
+	INC 2, XWA
+L2437:
+	INC 8, XWA
+L2438:
+	INC 5, XDE
+L2439:
+	DEC 8, WA
+L2440:
+	INC 3, DE
+L2441:
+	DEC 8, C
+L2442:
+	DEC 8, XHL
+L2443:
+	DEC 2, L
+L2444:
+	DEC 1, XHL
+L2445:
+	INC 7, C
+L2446:
+	INC 4, H
+L2447:
+	DEC 2, IZ
+L2448:
+	DEC 2, D
+L2449:
+	INC 2, XIX
+L2450:
+	DEC 3, BC
+L2451:
+	DEC 6, XHL
+L2452:
+	DEC 5, XDE
+L2453:
+	DEC 5, WA
+L2454:
+	INC 2, XWA
+L2455:
+	INC 4, XDE
+L2456:
+	INC 4, DE
+L2457:
+	DEC 1, XHL
+L2458:
+	DEC 6, IZ
+L2459:
+	INC 7, XIY
+L2460:
+	INC 1, W
+L2461:
+	DEC 7, H
+L2462:
+	DEC 7, XBC
+L2463:
+	DEC 3, A
+L2464:
+	INC 7, H
+L2465:
+	INC 8, A
+L2466:
+	INC 3, IZ
+L2467:
+	DEC 8, XDE
+L2468:
+	INC 5, XIY
+L2469:
+	DEC 3, XIY
+L2470:
+	DEC 3, XDE
+L2471:
+	DEC 3, IY
+L2472:
+	INC 5, HL
+L2473:
+	INC 4, IX
+L2474:
+	INC 1, H
+L2475:
+	INC 3, XIX
+L2476:
+	DEC 3, W
+L2477:
+	INC 7, IZ
+L2478:
+	INC 8, DE
+L2479:
+	INC 8, XHL
+L2480:
+	INC 6, IY
+L2481:
+	INC 4, XIY
+L2482:
+	DEC 8, C
+L2483:
+	DEC 1, BC
+L2484:
+	DEC 2, DE
+L2485:
+	INC 2, L
+L2486:
+	DEC 5, IY
+L2487:
+	DEC 4, WA
+L2488:
+	INC 5, DE
+L2489:
+	INC 3, IY
+L2490:
+	DEC 1, XWA
+L2491:
+	INC 6, XIZ
+L2492:
+	INC 3, WA
+L2493:
+	INC 4, XIX
+L2494:
+	DEC 2, XIX
+L2495:
+	INC 6, WA
+L2496:
+	DEC 5, D
+L2497:
+	INC 7, XDE
+L2498:
+	DEC 6, XIX
+L2499:
+	INC 6, W
+L2500:
+	DEC 1, XIX
+L2501:
+	DEC 1, XDE
+L2502:
+	DEC 7, XIX
+L2503:
+	DEC 3, IZ
+L2504:
+	INC 7, B
+L2505:
+	INC 1, XIZ
+L2506:
+	DEC 1, B
+L2507:
+	INC 7, BC
+L2508:
+	DEC 8, DE
+L2509:
+	DEC 1, XHL
+L2510:
+	INC 2, W
+L2511:
+	INC 6, XIX
+L2512:
+	INC 3, DE
+L2513:
+	DEC 4, BC
+L2514:
+	DEC 2, DE
+L2515:
+	DEC 4, XIX
+L2516:
+	INC 4, IY
+L2517:
+	DEC 2, A
+L2518:
+	INC 5, WA
+L2519:
+	DEC 5, HL
+L2520:
+	DEC 5, WA
+L2521:
+	DEC 5, E
+L2522:
+	INC 6, E
+L2523:
+	DEC 6, E
+L2524:
+	INC 8, E
+L2525:
+	INC 2, H
+L2526:
+	DEC 6, DE
+L2527:
+	INC 8, IX
+L2528:
+	DEC 5, DE
+L2529:
+	INC 7, BC
+L2530:
+	INC 7, H
+L2531:
+	INC 2, L
+L2532:
+	INC 2, IZ
+L2533:
+	DEC 5, L
+L2534:
+	INC 5, XIX
+L2535:
+	INC 7, XIY
+L2536:
+	INC 1, IX
+L2537:
+	INC 3, XDE
+L2538:
+	INC 1, L
+L2539:
+	DEC 3, XIZ
+L2540:
+	DEC 6, XBC
+L2541:
+	INC 7, C
+L2542:
+	INC 6, IY
+L2543:
+	INC 4, IX
+L2544:
+	INC 1, H
+L2545:
+	INC 3, E
+L2546:
+	DEC 3, XHL
+L2547:
+	INC 2, XIZ
+L2548:
+	INC 3, H
+L2549:
+	INC 7, DE
+L2550:
+	DEC 7, IY
+L2551:
+	INC 8, A
+L2552:
+	DEC 3, WA
+L2553:
+	DEC 1, XIY
+L2554:
+	INC 2, L
+L2555:
+	INC 4, A
+L2556:
+	DEC 1, H
+L2557:
+	INC 1, H
+L2558:
+	INC 3, XDE
+L2559:
+	DEC 1, XHL
+L2560:
+	INC 6, XBC
+L2561:
+	INC 3, DE
+L2562:
+	INC 3, DE
+L2563:
+	INC 3, XIZ
+L2564:
+	INC 1, DE
+L2565:
+	INC 8, WA
+L2566:
+	INC 6, E
+L2567:
+	DEC 3, B
+L2568:
+	INC 7, H
+L2569:
+	INC 2, XHL
+L2570:
+	INC 4, C
+L2571:
+	INC 2, WA
+L2572:
+	INC 2, DE
+L2573:
+	INC 5, BC
+L2574:
+	DEC 6, DE
+L2575:
+	DEC 7, XDE
+L2576:
+	DEC 3, XIY
+L2577:
+	DEC 2, BC
+L2578:
+	INC 6, A
+L2579:
+	INC 4, HL
+L2580:
+	INC 5, L
+L2581:
+	DEC 3, IZ
+L2582:
+	DEC 5, E
+L2583:
+	INC 4, IZ
+L2584:
+	INC 8, IZ
+L2585:
+	DEC 2, XDE
+L2586:
+	INC 4, C
+L2587:
+	DEC 5, XIY
+L2588:
+	DEC 1, XHL
+L2589:
+	DEC 5, XWA
+L2590:
+	DEC 2, IY
+L2591:
+	INC 6, DE
+L2592:
+	DEC 5, DE
+L2593:
+	DEC 5, BC
+L2594:
+	DEC 5, D
+L2595:
+	INC 4, XIZ
+L2596:
+	DEC 5, WA
+L2597:
+	INC 5, C
+L2598:
+	DEC 4, D
+L2599:
+	DEC 5, XIZ
+L2600:
+	DEC 7, IZ
+L2601:
+	DEC 7, XDE
+L2602:
+	DEC 7, XDE
+L2603:
+	INC 2, XIZ
+L2604:
+	INC 7, XDE
+L2605:
+	DEC 8, H
+L2606:
+	INC 8, XIX
+L2607:
+	INC 1, WA
+L2608:
+	INC 3, DE
+L2609:
+	DEC 6, W
+L2610:
+	INC 2, XIY
+L2611:
+	INC 8, XDE
+L2612:
+	DEC 8, D
+L2613:
+	INC 7, HL
+L2614:
+	INC 8, B
+L2615:
+	DEC 7, HL
+L2616:
+	DEC 8, IZ
+L2617:
+	INC 5, D
+L2618:
+	DEC 6, XDE
+L2619:
+	DEC 5, HL
+L2620:
+	INC 7, XIX
+L2621:
+	DEC 4, XIY
+L2622:
+	DEC 7, XIY
+L2623:
+	INC 6, XIZ
+L2624:
+	INC 4, XDE
+L2625:
+	INC 1, W
+L2626:
+	DEC 1, DE
+L2627:
+	INC 4, IZ
+L2628:
+	INC 4, IX
+L2629:
+	INC 1, XHL
+L2630:
+	INC 4, XDE
+L2631:
+	INC 4, XDE
+L2632:
+	INC 5, E
+L2633:
+	INC 1, E
+L2634:
+	INC 4, XIX
+L2635:
+	INC 7, XBC
+L2636:
+	DEC 5, B
+L2637:
+	INC 2, W
+L2638:
+	DEC 2, WA
+L2639:
+	INC 8, XBC
+L2640:
+	DEC 1, XIX
+L2641:
+	INC 7, W
+L2642:
+	DEC 3, XBC
+L2643:
+	DEC 5, XWA
+L2644:
+	DEC 8, XBC
+L2645:
+	INC 7, XDE
+L2646:
+	DEC 3, XDE
+L2647:
+	INC 2, H
+L2648:
+	INC 3, E
+L2649:
+	INC 2, B
+L2650:
+	DEC 3, XHL
+L2651:
+	INC 2, XHL
+L2652:
+	DEC 2, BC
+L2653:
+	DEC 7, DE
+L2654:
+	DEC 3, DE
+L2655:
+	INC 1, IZ
+L2656:
+	DEC 7, DE
+L2657:
+	DEC 6, BC
+L2658:
+	INC 2, L
+L2659:
+	DEC 5, B
+L2660:
+	INC 4, A
+L2661:
+	INC 2, XHL
+L2662:
+	INC 1, H
+L2663:
+	DEC 5, B
+L2664:
+	INC 3, DE
+L2665:
+	DEC 3, DE
+L2666:
+	INC 4, BC
+L2667:
+	DEC 6, XIX
+L2668:
+	INC 2, XDE
+L2669:
+	DEC 8, XIY
+L2670:
+	DEC 5, H
+L2671:
+	INC 4, WA
+L2672:
+	INC 4, HL
+L2673:
+	INC 4, BC
+L2674:
+	INC 3, HL
+L2675:
+	DEC 5, BC
+L2676:
+	DEC 8, D
+L2677:
+	INC 4, XIX
+L2678:
+	DEC 5, DE
+L2679:
+	DEC 6, XBC
+L2680:
+	DEC 1, H
+L2681:
+	INC 6, WA
+L2682:
+	INC 8, A
+L2683:
+	DEC 5, H
+L2684:
+	DEC 7, WA
+L2685:
+	DEC 4, H
+L2686:
+	DEC 7, XDE
+L2687:
+	INC 3, XHL
+L2688:
+	DEC 1, XIY
+L2689:
+	INC 2, XIZ
+L2690:
+	INC 4, B
+L2691:
+	INC 3, W
+L2692:
+	INC 3, WA
+L2693:
+	DEC 5, DE
+L2694:
+	DEC 6, XDE
+L2695:
+	DEC 8, XBC
+L2696:
+	DEC 5, XBC
+L2697:
+	DEC 5, IZ
+L2698:
+	INC 5, XDE
+L2699:
+	INC 7, D
+L2700:
+	INC 6, B
+L2701:
+	INC 4, IZ
+L2702:
+	INC 5, IX
+L2703:
+	INC 3, B
+L2704:
+	DEC 7, HL
+L2705:
+	INC 6, C
+L2706:
+	INC 8, IX
+L2707:
+	DEC 6, W
+L2708:
+	DEC 6, XIY
+L2709:
+	DEC 7, IY
+L2710:
+	INC 8, XHL
+L2711:
+	DEC 3, XIZ
+L2712:
+	DEC 4, XHL
+L2713:
+	INC 3, BC
+L2714:
+	DEC 8, XWA
+L2715:
+	DEC 6, XIZ
+L2716:
+	INC 3, D
+L2717:
+	DEC 6, HL
+L2718:
+	DEC 2, H
+L2719:
+	DEC 4, B
+L2720:
+	INC 6, E
+L2721:
+	DEC 5, D
+L2722:
+	DEC 2, W
+L2723:
+	DEC 6, BC
+L2724:
+	DEC 3, XIX
+L2725:
+	INC 7, WA
+L2726:
+	INC 1, XIZ
+L2727:
+	INC 8, D
+L2728:
+	INC 1, XHL
+L2729:
+	INC 1, A
+L2730:
+	DEC 5, XIY
+L2731:
+	DEC 3, XDE
+L2732:
+	DEC 1, D
+L2733:
+	DEC 2, XIX
+L2734:
+	INC 7, XDE
+L2735:
+	INC 1, A
+L2736:
+	DEC 6, XHL
+L2737:
+	INC 5, WA
+L2738:
+	DEC 4, B
+L2739:
+	DEC 5, WA
+L2740:
+	DEC 4, IY
+L2741:
+	INC 3, XDE
+L2742:
+	DEC 1, XIY
+L2743:
+	INC 8, DE
+L2744:
+	INC 3, C
+L2745:
+	DEC 8, D
+L2746:
+	INC 2, E
+L2747:
+	INC 2, XBC
+L2748:
+	INC 8, HL
+L2749:
+	DEC 6, BC
+L2750:
+	DEC 4, D
+L2751:
+	INC 2, HL
+L2752:
+	INC 8, H
+L2753:
+	DEC 5, A
+L2754:
+	INC 8, E
+L2755:
+	DEC 6, L
+L2756:
+	INC 4, B
+L2757:
+	INC 8, XIX
+L2758:
+	DEC 6, XIZ
+L2759:
+	INC 6, A
+L2760:
+	INC 4, W
+L2761:
+	DEC 3, IY
+L2762:
+	DEC 3, A
+L2763:
+	DEC 8, BC
+L2764:
+	INC 8, C
+L2765:
+	INC 1, A
+L2766:
+	DEC 3, XWA
+L2767:
+	INC 7, XHL
+L2768:
+	INC 7, H
+L2769:
+	DEC 4, XIZ
+L2770:
+	DEC 1, C
+L2771:
+	DEC 7, XIX
+L2772:
+	INC 8, H
+L2773:
+	INC 6, C
+L2774:
+	INC 6, WA
+L2775:
+	INC 2, HL
+L2776:
+	INC 8, BC
+L2777:
+	INC 3, H
+L2778:
+	DEC 6, L
+L2779:
+	DEC 7, XHL
+L2780:
+	INC 8, B
+L2781:
+	DEC 3, WA
+L2782:
+	INC 1, HL
+L2783:
+	INC 3, A
+L2784:
+	INC 1, E
+L2785:
+	INC 2, WA
+L2786:
+	INC 1, DE
+L2787:
+	INC 2, C
+L2788:
+	INC 4, C
+L2789:
+	DEC 7, XIZ
+L2790:
+	DEC 8, XBC
+L2791:
+	DEC 1, IX
+L2792:
+	DEC 3, XIZ
+L2793:
+	INC 4, XWA
+L2794:
+	INC 7, XWA
+L2795:
+	DEC 3, XWA
+L2796:
+	INC 8, BC
+L2797:
+	INC 2, H
+L2798:
+	DEC 1, IX
+L2799:
+	INC 8, C
+L2800:
+	INC 6, XIX
+L2801:
+	INC 6, B
+L2802:
+	DEC 3, IZ
+L2803:
+	INC 1, WA
+L2804:
+	DEC 3, DE
+L2805:
+	INC 2, IY
+L2806:
+	INC 1, XIY
+L2807:
+	INC 1, B
+L2808:
+	DEC 2, C
+L2809:
+	INC 1, XIZ
+L2810:
+	DEC 5, W
+L2811:
+	DEC 6, L
+L2812:
+	INC 6, XBC
+L2813:
+	INC 5, A
+L2814:
+	INC 7, WA
+L2815:
+	DEC 1, XIZ
+L2816:
+	DEC 8, B
+L2817:
+	DEC 7, XBC
+L2818:
+	DEC 4, A
+L2819:
+	DEC 4, XDE
+L2820:
+	INC 5, WA
+L2821:
+	DEC 8, C
+L2822:
+	INC 4, XIY
+L2823:
+	DEC 7, IZ
+L2824:
+	DEC 6, XIZ
+L2825:
+	DEC 8, XBC
+L2826:
+	DEC 4, IZ
+L2827:
+	DEC 3, L
+L2828:
+	DEC 2, IY
+L2829:
+	INC 4, XDE
+L2830:
+	DEC 5, E
+L2831:
+	DEC 6, XBC
+L2832:
+	INC 2, XIZ
+L2833:
+	DEC 8, D
+L2834:
+	INC 3, IZ
+L2835:
+	INC 2, XWA
+L2836:
+	DEC 2, WA
+L2837:
+	INC 1, XDE
+L2838:
+	INC 5, L
+L2839:
+	DEC 7, DE
+L2840:
+	INC 2, XBC
+L2841:
+	DEC 6, XIY
+L2842:
+	INC 2, BC
+L2843:
+	INC 3, XBC
+L2844:
+	INC 2, XHL
+L2845:
+	INC 1, B
+L2846:
+	INC 5, XIY
+L2847:
+	DEC 8, XIY
+L2848:
+	DEC 4, IX
+L2849:
+	DEC 8, BC
+L2850:
+	INC 4, A
+L2851:
+	DEC 3, A
+L2852:
+	DEC 8, XHL
+L2853:
+	DEC 5, WA
+L2854:
+	DEC 1, IZ
+L2855:
+	INC 7, IZ
+L2856:
+	DEC 6, XIX
+L2857:
+	INC 1, HL
+L2858:
+	INC 3, XBC
+L2859:
+	INC 5, IY
+L2860:
+	DEC 5, XWA
+L2861:
+	INC 8, D
+L2862:
+	INC 6, WA
+L2863:
+	INC 3, XIX
+L2864:
+	INC 6, XIY
+L2865:
+	INC 5, XWA
+L2866:
+	DEC 5, HL
+L2867:
+	INC 6, H
+L2868:
+	DEC 2, WA
+L2869:
+	DEC 4, XWA
+L2870:
+	INC 5, IY
+L2871:
+	DEC 6, XIX
+L2872:
+	DEC 1, IZ
+L2873:
+	INC 8, XBC
+L2874:
+	INC 3, XHL
+L2875:
+	DEC 8, XDE
+L2876:
+	DEC 1, L
+L2877:
+	INC 8, IY
+L2878:
+	INC 6, HL
+L2879:
+	DEC 5, IX
+L2880:
+	INC 4, W
+L2881:
+	INC 8, E
+L2882:
+	INC 8, XHL
+L2883:
+	INC 8, C
+L2884:
+	INC 8, XHL
+L2885:
+	INC 8, XWA
+L2886:
+	DEC 8, XHL
+L2887:
+	DEC 1, XIZ
+L2888:
+	INC 4, XIZ
+L2889:
+	DEC 4, WA
+L2890:
+	INC 8, HL
+L2891:
+	INC 5, XDE
+L2892:
+	INC 3, BC
+L2893:
+	DEC 6, XWA
+L2894:
+	INC 8, A
+L2895:
+	INC 1, D
+L2896:
+	DEC 3, A
+L2897:
+	INC 3, HL
+L2898:
+	INC 3, XHL
+L2899:
+	DEC 5, XIX
+L2900:
+	DEC 7, XIZ
+L2901:
+	DEC 8, E
+L2902:
+	INC 8, H
+L2903:
+	INC 5, IZ
+L2904:
+	INC 1, BC
+L2905:
+	DEC 7, XIY
+L2906:
+	INC 2, BC
+L2907:
+	INC 5, XHL
+L2908:
+	DEC 8, XIX
+L2909:
+	DEC 6, D
+L2910:
+	INC 1, W
+L2911:
+	INC 6, C
+L2912:
+	DEC 8, W
+L2913:
+	DEC 3, D
+L2914:
+	INC 8, BC
+L2915:
+	INC 3, IY
+L2916:
+	INC 7, E
+L2917:
+	INC 3, E
+L2918:
+	INC 6, XBC
+L2919:
+	DEC 7, HL
+L2920:
+	DEC 5, IX
+L2921:
+	DEC 4, IX
+L2922:
+	DEC 8, WA
+L2923:
+	DEC 1, D
+L2924:
+	DEC 1, IX
+L2925:
+	INC 8, C
+L2926:
+	INC 2, L
+L2927:
+	INC 4, XWA
+L2928:
+	INC 8, XIY
+L2929:
+	DEC 4, BC
+L2930:
+	DEC 6, B
+L2931:
+	DEC 3, E
+L2932:
+	DEC 6, XHL
+L2933:
+	INC 6, XBC
+L2934:
+	INC 3, XIZ
+L2935:
+	INC 4, DE
+L2936:
+	DEC 4, XIY
+L2937:
+	DEC 2, XIZ
+L2938:
+	INC 7, XDE
+L2939:
+	DEC 4, XBC
+L2940:
+	DEC 7, WA
+L2941:
+	DEC 1, XIZ
+L2942:
+	DEC 8, XBC
+L2943:
+	DEC 4, IX
+L2944:
+	INC 8, XIY
+L2945:
+	INC 4, XWA
+L2946:
+	INC 6, IY
+L2947:
+	DEC 6, IX
+L2948:
+	INC 4, XIY
+L2949:
+	INC 4, BC
+L2950:
+	DEC 5, L
+L2951:
+	DEC 1, C
+L2952:
+	INC 5, XIX
+L2953:
+	DEC 6, XIZ
+L2954:
+	DEC 7, IY
+L2955:
+	DEC 4, XIZ
+L2956:
+	INC 6, WA
+L2957:
+	DEC 5, H
+L2958:
+	DEC 3, A
+L2959:
+	DEC 1, A
+L2960:
+	INC 2, B
+L2961:
+	INC 8, HL
+L2962:
+	DEC 5, C
+L2963:
+	DEC 8, XIY
+L2964:
+	INC 5, XHL
+L2965:
+	DEC 4, H
+L2966:
+	INC 8, XHL
+L2967:
+	DEC 4, C
+L2968:
+	INC 8, DE
+L2969:
+	INC 3, W
+L2970:
+	INC 7, XWA
+L2971:
+	DEC 5, W
+L2972:
+	INC 1, XIY
+L2973:
+	INC 6, XIX
+L2974:
+	DEC 3, XHL
+L2975:
+	INC 7, IX
+L2976:
+	DEC 3, WA
+L2977:
+	DEC 3, XIY
+L2978:
+	DEC 6, HL
+L2979:
+	DEC 6, B
+L2980:
+	DEC 6, XIY
+L2981:
+	DEC 5, XHL
+L2982:
+	DEC 8, DE
+L2983:
+	INC 5, L
+L2984:
+	INC 6, IX
+L2985:
+	DEC 1, XHL
+L2986:
+	DEC 2, HL
+L2987:
+	INC 1, DE
+L2988:
+	DEC 7, IY
+L2989:
+	DEC 7, BC
+L2990:
+	INC 4, IY
+L2991:
+	INC 5, C
+L2992:
+	DEC 3, BC
+L2993:
+	DEC 8, XIY
+L2994:
+	INC 8, WA
+L2995:
+	DEC 8, D
+L2996:
+	INC 6, H
+L2997:
+	INC 2, WA
+L2998:
+	DEC 1, XHL
+L2999:
+	DEC 8, A
+L3000:
+	INC 4, BC
+L3001:
+	DEC 7, IX
+L3002:
+	INC 7, E
+L3003:
+	DEC 6, IZ
+L3004:
+	INC 6, XIY
+L3005:
+	INC 1, DE
+L3006:
+	INC 4, XWA
+L3007:
+	DEC 3, HL
+L3008:
+	DEC 4, C
+L3009:
+	DEC 5, IY
+L3010:
+	INC 7, B
+L3011:
+	DEC 7, IY
+L3012:
+	DEC 2, IX
+L3013:
+	INC 8, C
+L3014:
+	INC 8, B
+L3015:
+	INC 8, XIZ
+L3016:
+	INC 4, H
+L3017:
+	INC 7, XBC
+L3018:
+	INC 1, WA
+L3019:
+	INC 4, XBC
+L3020:
+	DEC 4, D
+L3021:
+	INC 2, IX
+L3022:
+	DEC 5, W
+L3023:
+	DEC 3, XDE
+L3024:
+	DEC 1, C
+L3025:
+	DEC 2, IX
+L3026:
+	INC 2, XHL
+L3027:
+	INC 3, W
+L3028:
+	INC 7, C
+L3029:
+	INC 2, XIZ
+L3030:
+	DEC 1, WA
+L3031:
+	DEC 1, XBC
+L3032:
+	INC 7, C
+L3033:
+	INC 3, XIY
+L3034:
+	DEC 8, W
+L3035:
+	INC 8, XWA
+L3036:
+	DEC 1, XIX
+L3037:
+	INC 6, XIZ
+L3038:
+	DEC 7, WA
+L3039:
+	INC 7, D
+L3040:
+	INC 1, XDE
+L3041:
+	INC 5, WA
+L3042:
+	DEC 7, H
+L3043:
+	INC 8, XIY
+L3044:
+	INC 4, WA
+L3045:
+	DEC 7, XHL
+L3046:
+	INC 1, XWA
+L3047:
+	INC 2, WA
+L3048:
+	INC 5, IX
+L3049:
+	INC 3, B
+L3050:
+	INC 6, XHL
+L3051:
+	INC 2, H
+L3052:
+	INC 4, E
+L3053:
+	INC 7, XWA
+L3054:
+	DEC 3, XBC
+L3055:
+	DEC 4, HL
+L3056:
+	DEC 4, XWA
+L3057:
+	DEC 7, HL
+L3058:
+	DEC 5, E
+L3059:
+	DEC 1, IZ
+L3060:
+	DEC 8, XIY
+L3061:
+	INC 6, XIY
+L3062:
+	INC 3, D
+L3063:
+	DEC 7, BC
+L3064:
+	INC 5, HL
+L3065:
+	DEC 3, XDE
+L3066:
+	DEC 5, A
+L3067:
+	DEC 5, XBC
+L3068:
+	DEC 5, XBC
+L3069:
+	DEC 7, XWA
+L3070:
+	DEC 4, IY
+L3071:
+	DEC 7, XIX
+L3072:
+	INC 1, C
+L3073:
+	INC 4, DE
+L3074:
+	DEC 8, XBC
+L3075:
+	INC 3, IZ
+L3076:
+	DEC 7, XHL
+L3077:
+	DEC 2, XBC
+L3078:
+	DEC 6, B
+L3079:
+	INC 5, E
+L3080:
+	INC 6, DE
+L3081:
+	INC 7, E
+L3082:
+	INC 4, WA
+L3083:
+	INC 3, D
+L3084:
+	DEC 3, E
+L3085:
+	INC 3, B
+L3086:
+	INC 6, XHL
+L3087:
+	INC 3, IX
+L3088:
+	INC 3, H
+L3089:
+	DEC 5, C
+L3090:
+	INC 7, H
+L3091:
+	INC 3, IY
+L3092:
+	INC 7, E
+L3093:
+	INC 3, IX
+L3094:
+	INC 5, XBC
+L3095:
+	DEC 6, XBC
+L3096:
+	INC 6, W
+L3097:
+	INC 7, XDE
+L3098:
+	INC 6, W
+L3099:
+	INC 2, WA
+L3100:
+	DEC 2, XIY
+L3101:
+	DEC 5, D
+L3102:
+	INC 7, E
+L3103:
+	DEC 1, XWA
+L3104:
+	INC 8, XDE
+L3105:
+	INC 1, L
+L3106:
+	INC 4, W
+L3107:
+	DEC 2, E
+L3108:
+	DEC 8, DE
+L3109:
+	DEC 1, H
+L3110:
+	INC 1, B
+L3111:
+	DEC 1, E
+L3112:
+	INC 6, IY
+L3113:
+	DEC 4, BC
+L3114:
+	DEC 4, IY
+L3115:
+	DEC 4, HL
+L3116:
+	INC 6, WA
+L3117:
+	DEC 7, IY
+L3118:
+	DEC 2, H
+L3119:
+	INC 1, H
+L3120:
+	INC 8, XHL
+L3121:
+	INC 6, XBC
+L3122:
+	INC 7, XIX
+L3123:
+	DEC 7, XIY
+L3124:
+	INC 7, W
+L3125:
+	INC 5, C
+L3126:
+	INC 2, B
+L3127:
+	INC 3, IX
+L3128:
+	INC 2, XIZ
+L3129:
+	DEC 8, DE
+L3130:
+	INC 5, XIX
+L3131:
+	INC 6, XIX
+L3132:
+	INC 4, C
+L3133:
+	INC 7, D
+L3134:
+	DEC 5, XIZ
+L3135:
+	DEC 7, IY
+L3136:
+	DEC 8, H
+L3137:
+	DEC 2, XIX
+L3138:
+	INC 8, XIX
+L3139:
+	INC 5, XIZ
+L3140:
+	DEC 8, E
+L3141:
+	DEC 2, WA
+L3142:
+	DEC 6, XWA
+L3143:
+	DEC 8, L
+L3144:
+	INC 1, IX
+L3145:
+	DEC 3, E
+L3146:
+	INC 8, W
+L3147:
+	INC 4, L
+L3148:
+	DEC 7, A
+L3149:
+	DEC 6, A
+L3150:
+	DEC 2, E
+L3151:
+	DEC 6, XIX
+L3152:
+	INC 4, H
+L3153:
+	DEC 7, IY
+L3154:
+	INC 3, HL
+L3155:
+	INC 7, B
+L3156:
+	INC 3, IX
+L3157:
+	DEC 2, E
+L3158:
+	DEC 1, A
+L3159:
+	DEC 3, B
+L3160:
+	INC 2, DE
+L3161:
+	DEC 6, HL
+L3162:
+	INC 8, D
+L3163:
+	DEC 6, XBC
+L3164:
+	DEC 4, C
+L3165:
+	DEC 3, B
+L3166:
+	INC 3, WA
+L3167:
+	DEC 5, WA
+L3168:
+	DEC 4, DE
+L3169:
+	INC 7, H
+L3170:
+	INC 1, WA
+L3171:
+	INC 6, W
+L3172:
+	INC 3, XWA
+L3173:
+	DEC 2, IZ
+L3174:
+	DEC 3, A
+L3175:
+	DEC 7, DE
+L3176:
+	INC 6, IY
+L3177:
+	INC 4, C
+L3178:
+	DEC 1, XHL
+L3179:
+	INC 7, H
+L3180:
+	INC 5, IZ
+L3181:
+	DEC 3, XBC
+L3182:
+	INC 2, H
+L3183:
+	DEC 2, DE
+L3184:
+	DEC 8, XHL
+L3185:
+	DEC 8, XIX
+L3186:
+	DEC 4, D
+L3187:
+	DEC 5, WA
+L3188:
+	INC 7, XIZ
+L3189:
+	DEC 1, DE
+L3190:
+	DEC 8, HL
+L3191:
+	INC 2, XIX
+L3192:
+	DEC 2, IX
+L3193:
+	DEC 4, XBC
+L3194:
+	DEC 8, XBC
+L3195:
+	DEC 3, XBC
+L3196:
+	DEC 1, L
+L3197:
+	INC 1, L
+L3198:
+	DEC 5, IY
+L3199:
+	DEC 2, A
+L3200:
+	INC 1, E
+L3201:
+	INC 8, IZ
+L3202:
+	INC 3, XIX
+L3203:
+	INC 2, XIY
+L3204:
+	INC 6, IX
+L3205:
+	INC 4, XBC
+L3206:
+	INC 6, XWA
+L3207:
+	INC 6, A
+L3208:
+	INC 7, XHL
+L3209:
+	INC 8, B
+L3210:
+	DEC 1, BC
+L3211:
+	INC 4, XDE
+L3212:
+	DEC 5, BC
+L3213:
+	INC 5, IZ
+L3214:
+	DEC 8, XBC
+L3215:
+	INC 4, XDE
+L3216:
+	DEC 5, W
+L3217:
+	INC 3, IY
+L3218:
+	INC 6, L
+L3219:
+	INC 6, IX
+L3220:
+	DEC 8, XIX
+L3221:
+	INC 1, XIX
+L3222:
+	INC 4, D
+L3223:
+	INC 2, BC
+L3224:
+	DEC 6, B
+L3225:
+	DEC 1, C
+L3226:
+	DEC 7, E
+L3227:
+	DEC 2, HL
+L3228:
+	INC 4, WA
+L3229:
+	DEC 2, WA
+L3230:
+	DEC 4, DE
+L3231:
+	DEC 3, IX
+L3232:
+	INC 2, XDE
+L3233:
+	DEC 1, E
+L3234:
+	DEC 8, WA
+L3235:
+	DEC 5, HL
+L3236:
+	DEC 4, XWA
+L3237:
+	INC 1, XIY
+L3238:
+	INC 6, C
+L3239:
+	DEC 4, B
+L3240:
+	DEC 8, IZ
+L3241:
+	INC 5, XWA
+L3242:
+	DEC 1, IX
+L3243:
+	INC 2, C
+L3244:
+	DEC 1, XIX
+L3245:
+	DEC 5, IZ
+L3246:
+	INC 7, XIY
+L3247:
+	INC 3, XIX
+L3248:
+	DEC 1, W
+L3249:
+	INC 7, E
+L3250:
+	INC 3, W
+L3251:
+	INC 2, IX
+L3252:
+	DEC 2, DE
+L3253:
+	INC 1, B
+L3254:
+	INC 5, XHL
+L3255:
+	DEC 2, W
+L3256:
+	DEC 6, C
+L3257:
+	DEC 8, XWA
+L3258:
+	DEC 7, XIY
+L3259:
+	INC 2, XIY
+L3260:
+	INC 8, XDE
+L3261:
+	DEC 8, W
+L3262:
+	INC 1, XIY
+L3263:
+	INC 5, HL
+L3264:
+	INC 4, WA
+L3265:
+	DEC 1, L
+L3266:
+	DEC 8, L
+L3267:
+	DEC 4, WA
+L3268:
+	INC 4, E
+L3269:
+	DEC 3, XIY
+L3270:
+	INC 3, XIX
+L3271:
+	DEC 5, IZ
+L3272:
+	DEC 6, XIX
+L3273:
+	INC 2, XIZ
+L3274:
+	INC 1, HL
+L3275:
+	INC 2, B
+L3276:
+	INC 6, XIY
+L3277:
+	INC 3, BC
+L3278:
+	INC 7, H
+L3279:
+	DEC 5, D
+L3280:
+	DEC 3, A
+L3281:
+	DEC 6, IZ
+L3282:
+	DEC 5, IY
+L3283:
+	INC 5, IZ
+L3284:
+	INC 8, W
+L3285:
+	DEC 7, A
+L3286:
+	DEC 8, IY
+L3287:
+	DEC 5, XWA
+L3288:
+	DEC 2, XIX
+L3289:
+	INC 6, XHL
+L3290:
+	DEC 4, D
+L3291:
+	INC 4, XIX
+L3292:
+	INC 7, BC
+L3293:
+	DEC 6, XDE
+L3294:
+	INC 1, IX
+L3295:
+	INC 6, DE
+L3296:
+	INC 1, D
+L3297:
+	INC 4, WA
+L3298:
+	DEC 8, IZ
+L3299:
+	INC 7, XIY
+L3300:
+	INC 7, XDE
+L3301:
+	INC 5, XWA
+L3302:
+	INC 8, XWA
+L3303:
+	DEC 1, W
+L3304:
+	INC 1, L
+L3305:
+	DEC 7, IY
+L3306:
+	DEC 2, XDE
+L3307:
+	INC 8, XDE
+L3308:
+	INC 2, XWA
+L3309:
+	INC 7, DE
+L3310:
+	DEC 1, DE
+L3311:
+	DEC 7, XWA
+L3312:
+	DEC 5, IZ
+L3313:
+	INC 6, IY
+L3314:
+	DEC 4, E
+L3315:
+	INC 7, BC
+L3316:
+	INC 3, XIY
+L3317:
+	INC 7, XIX
+L3318:
+	DEC 3, IZ
+L3319:
+	DEC 6, BC
+L3320:
+	INC 6, WA
+L3321:
+	DEC 5, XHL
+L3322:
+	DEC 5, HL
+L3323:
+	INC 7, XIX
+L3324:
+	INC 1, XBC
+L3325:
+	INC 6, BC
+L3326:
+	INC 1, XWA
+L3327:
+	DEC 8, C
+L3328:
+	INC 2, H
+L3329:
+	INC 8, XHL
+L3330:
+	INC 2, L
+L3331:
+	DEC 3, WA
+L3332:
+	INC 4, XIZ
+L3333:
+	DEC 7, XHL
+L3334:
+	DEC 7, W
+L3335:
+	DEC 6, IY
+L3336:
+	INC 7, L
+L3337:
+	INC 6, H
+L3338:
+	DEC 6, B
+L3339:
+	DEC 1, XWA
+L3340:
+	INC 1, IX
+L3341:
+	DEC 5, WA
+L3342:
+	INC 2, IY
+L3343:
+	INC 3, D
+L3344:
+	DEC 3, DE
+L3345:
+	DEC 5, E
+L3346:
+	INC 6, HL
+L3347:
+	DEC 3, BC
+L3348:
+	INC 4, H
+L3349:
+	DEC 7, D
+L3350:
+	DEC 5, IZ
+L3351:
+	DEC 2, E
+L3352:
+	INC 6, H
+L3353:
+	INC 7, W
+L3354:
+	DEC 2, DE
+L3355:
+	DEC 7, IZ
+L3356:
+	INC 5, XHL
+L3357:
+	INC 3, XBC
+L3358:
+	INC 1, BC
+L3359:
+	INC 7, IY
+L3360:
+	INC 5, HL
+L3361:
+	DEC 3, XWA
+L3362:
+	INC 1, L
+L3363:
+	INC 5, L
+L3364:
+	INC 8, XBC
+L3365:
+	DEC 4, L
+L3366:
+	INC 3, H
+L3367:
+	DEC 7, XHL
+L3368:
+	DEC 2, HL
+L3369:
+	DEC 2, XIX
+L3370:
+	INC 5, IZ
+L3371:
+	INC 5, E
+L3372:
+	INC 3, C
+L3373:
+	INC 4, DE
+L3374:
+	INC 4, D
+L3375:
+	DEC 2, WA
+L3376:
+	DEC 3, H
+L3377:
+	DEC 1, D
+L3378:
+	DEC 6, D
+L3379:
+	INC 4, W
+L3380:
+	DEC 2, W
+L3381:
+	INC 5, XBC
+L3382:
+	DEC 8, E
+L3383:
+	DEC 5, XIX
+L3384:
+	DEC 1, XIY
+L3385:
+	DEC 4, H
+L3386:
+	INC 7, IY
+L3387:
+	DEC 7, XIZ
+L3388:
+	INC 2, IX
+L3389:
+	INC 1, W
+L3390:
+	DEC 7, L
+L3391:
+	DEC 4, H
+L3392:
+	DEC 7, BC
+L3393:
+	DEC 3, D
+L3394:
+	INC 1, XIZ
+L3395:
+	INC 6, XWA
+L3396:
+	DEC 1, IX
+L3397:
+	DEC 3, BC
+L3398:
+	DEC 2, WA
+L3399:
+	DEC 2, XWA
+L3400:
+	DEC 1, E
+L3401:
+	INC 3, WA
+L3402:
+	INC 8, IZ
+L3403:
+	DEC 2, XIY
+L3404:
+	DEC 7, WA
+L3405:
+	DEC 4, B
+L3406:
+	INC 3, L
+L3407:
+	DEC 1, HL
+L3408:
+	INC 8, XDE
+L3409:
+	DEC 3, XWA
+L3410:
+	INC 7, H
+L3411:
+	DEC 7, XBC
+L3412:
+	INC 1, XIY
+L3413:
+	DEC 4, XHL
+L3414:
+	INC 2, A
+L3415:
+	INC 1, H
+L3416:
+	INC 3, A
+L3417:
+	INC 7, XWA
+L3418:
+	INC 8, IY
+L3419:
+	DEC 8, DE
+L3420:
+	INC 4, XIZ
+L3421:
+	DEC 3, XDE
+L3422:
+	DEC 5, B
+L3423:
+	DEC 8, XIZ
+L3424:
+	INC 6, L
+L3425:
+	DEC 3, XIX
+L3426:
+	INC 4, H
+L3427:
+	INC 2, BC
+L3428:
+	DEC 6, XIY
+L3429:
+	INC 5, B
+L3430:
+	DEC 7, XIX
+L3431:
+	INC 7, XDE
+L3432:
+	DEC 7, IX
+L3433:
+	DEC 2, IY
+L3434:
+	DEC 3, XIZ
+L3435:
+	INC 5, A
+L3436:
+	INC 1, L
+L3437:
+	INC 7, HL
+L3438:
+	DEC 8, IX
+L3439:
+	INC 4, DE
+L3440:
+	DEC 5, IX
+L3441:
+	INC 2, IY
+L3442:
+	DEC 8, XWA
+L3443:
+	DEC 1, IX
+L3444:
+	INC 8, XIY
+L3445:
+	DEC 2, W
+L3446:
+	DEC 4, XIZ
+L3447:
+	INC 1, IX
+L3448:
+	INC 4, DE
+L3449:
+	INC 7, XIY
+L3450:
+	INC 5, WA
+L3451:
+	DEC 3, D
+L3452:
+	INC 8, L
+L3453:
+	DEC 3, IY
+L3454:
+	DEC 3, IY
+L3455:
+	DEC 2, IX
+L3456:
+	INC 7, H
+L3457:
+	DEC 2, XBC
+L3458:
+	DEC 8, W
+L3459:
+	INC 4, B
+L3460:
+	INC 3, IX
+L3461:
+	INC 2, XIZ
+L3462:
+	DEC 8, C
+L3463:
+	INC 5, XIZ
+L3464:
+	DEC 8, XIY
+L3465:
+	INC 3, L
+L3466:
+	DEC 4, BC
+L3467:
+	INC 7, BC
+L3468:
+	INC 2, BC
+L3469:
+	INC 6, IZ
+L3470:
+	DEC 1, D
+L3471:
+	DEC 5, XIZ
+L3472:
+	DEC 1, XHL
+L3473:
+	DEC 6, H
+L3474:
+	INC 1, IX
+L3475:
+	INC 4, XIX
+L3476:
+	DEC 7, XIX
+L3477:
+	INC 7, WA
+L3478:
+	INC 3, W
+L3479:
+	INC 6, BC
+L3480:
+	INC 4, W
+L3481:
+	INC 2, HL
+L3482:
+	DEC 4, IZ
+L3483:
+	INC 5, XWA
+L3484:
+	DEC 4, XWA
+L3485:
+	DEC 4, XIZ
+L3486:
+	DEC 2, XIY
+L3487:
+	DEC 8, XIZ
+L3488:
+	DEC 8, E
+L3489:
+	INC 8, B
+L3490:
+	INC 7, WA
+L3491:
+	DEC 2, D
+L3492:
+	DEC 5, WA
+L3493:
+	INC 5, BC
+L3494:
+	DEC 3, W
+L3495:
+	INC 2, XDE
+L3496:
+	INC 7, IZ
+L3497:
+	DEC 3, BC
+L3498:
+	INC 2, IY
+L3499:
+	DEC 4, HL
+L3500:
+	DEC 4, HL
+L3501:
+	DEC 2, W
+L3502:
+	DEC 7, WA
+L3503:
+	DEC 6, XIZ
+L3504:
+	INC 7, HL
+L3505:
+	INC 7, XDE
+L3506:
+	DEC 8, XDE
+L3507:
+	INC 4, XWA
+L3508:
+	DEC 2, IX
+L3509:
+	DEC 8, XIX
+L3510:
+	INC 5, XIY
+L3511:
+	INC 5, XWA
+L3512:
+	DEC 8, DE
+L3513:
+	DEC 4, XDE
+L3514:
+	INC 6, HL
+L3515:
+	DEC 4, XWA
+L3516:
+	DEC 8, H
+L3517:
+	INC 5, XHL
+L3518:
+	DEC 8, XIX
+L3519:
+	INC 2, IZ
+L3520:
+	DEC 3, IY
+L3521:
+	INC 2, XIX
+L3522:
+	DEC 3, XDE
+L3523:
+	DEC 8, XBC
+L3524:
+	DEC 5, XDE
+L3525:
+	INC 2, B
+L3526:
+	INC 1, IX
+L3527:
+	INC 3, XWA
+L3528:
+	INC 1, B
+L3529:
+	DEC 6, XDE
+L3530:
+	INC 7, E
+L3531:
+	INC 7, XIX
+L3532:
+	DEC 2, BC
+L3533:
+	INC 7, IZ
+L3534:
+	INC 1, XBC
+L3535:
+	DEC 3, XHL
+L3536:
+	DEC 4, XDE
+L3537:
+	INC 6, H
+L3538:
+	INC 4, B
+L3539:
+	DEC 4, IY
+L3540:
+	INC 2, BC
+L3541:
+	DEC 6, IX
+L3542:
+	INC 6, IZ
+L3543:
+	DEC 3, WA
+L3544:
+	INC 7, A
+L3545:
+	DEC 4, XWA
+L3546:
+	INC 4, XIZ
+L3547:
+	DEC 5, DE
+L3548:
+	DEC 6, IY
+L3549:
+	DEC 5, XBC
+L3550:
+	INC 6, H
+L3551:
+	INC 7, IY
+L3552:
+	INC 6, WA
+L3553:
+	INC 6, WA
+L3554:
+	INC 2, XBC
+L3555:
+	DEC 3, IZ
+L3556:
+	INC 7, XIX
+L3557:
+	INC 3, XWA
+L3558:
+	DEC 3, IZ
+L3559:
+	INC 6, A
+L3560:
+	INC 1, HL
+L3561:
+	DEC 1, XBC
+L3562:
+	DEC 2, WA
+L3563:
+	DEC 4, WA
+L3564:
+	INC 3, IX
+L3565:
+	DEC 6, W
+L3566:
+	INC 6, A
+L3567:
+	INC 6, HL
+L3568:
+	DEC 4, XIY
+L3569:
+	DEC 7, C
+L3570:
+	INC 2, IZ
+L3571:
+	DEC 3, XHL
+L3572:
+	INC 2, XHL
+L3573:
+	DEC 2, IY
+L3574:
+	DEC 3, XBC
+L3575:
+	DEC 3, XIX
+L3576:
+	INC 7, IX
+L3577:
+	DEC 6, XIZ
+L3578:
+	INC 1, W
+L3579:
+	DEC 4, IX
+L3580:
+	INC 3, B
+L3581:
+	INC 4, IY
+L3582:
+	INC 3, IZ
+L3583:
+	INC 1, BC
+L3584:
+	INC 4, B
+L3585:
+	INC 3, HL
+L3586:
+	DEC 2, XHL
+L3587:
+	DEC 5, XWA
+L3588:
+	INC 8, A
+L3589:
+	INC 6, XWA
+L3590:
+	INC 2, XDE
+L3591:
+	INC 7, WA
+L3592:
+	DEC 7, H
+L3593:
+	INC 8, XBC
+L3594:
+	DEC 2, IZ
+L3595:
+	DEC 7, B
+L3596:
+	INC 5, XHL
+L3597:
+	INC 7, XIY
+L3598:
+	DEC 2, XHL
+L3599:
+	DEC 4, XIZ
+L3600:
+	DEC 7, XIX
+L3601:
+	INC 4, XHL
+L3602:
+	DEC 2, XDE
+L3603:
+	INC 6, IY
+L3604:
+	INC 3, XIZ
+L3605:
+	DEC 3, XHL
+L3606:
+	INC 2, XIZ
+L3607:
+	INC 6, XIZ
+L3608:
+	INC 5, W
+L3609:
+	INC 5, XIY
+L3610:
+	DEC 1, L
+L3611:
+	INC 1, D
+L3612:
+	DEC 5, HL
+L3613:
+	INC 6, XWA
+L3614:
+	DEC 6, BC
+L3615:
+	DEC 8, XDE
+L3616:
+	DEC 8, C
+L3617:
+	INC 5, XIZ
+L3618:
+	INC 4, XBC
+L3619:
+	DEC 6, C
+L3620:
+	INC 3, IZ
+L3621:
+	INC 5, IX
+L3622:
+	DEC 2, E
+L3623:
+	DEC 6, XBC
+L3624:
+	INC 2, HL
+L3625:
+	INC 5, XBC
+L3626:
+	INC 6, IZ
+L3627:
+	DEC 4, WA
+L3628:
+	INC 4, C
+L3629:
+	INC 5, XWA
+L3630:
+	INC 4, XDE
+L3631:
+	DEC 7, XHL
+L3632:
+	INC 8, D
+L3633:
+	DEC 1, IZ
+L3634:
+	INC 4, D
+L3635:
+	DEC 8, DE
+L3636:
+	INC 7, XIX
+L3637:
+	DEC 6, XHL
+L3638:
+	DEC 8, IZ
+L3639:
+	DEC 8, BC
+L3640:
+	DEC 5, IZ
+L3641:
+	INC 4, IZ
+L3642:
+	INC 1, W
+L3643:
+	DEC 3, BC
+L3644:
+	INC 7, XBC
+L3645:
+	INC 8, HL
+L3646:
+	DEC 4, IZ
+L3647:
+	INC 8, XIZ
+L3648:
+	DEC 5, B
+L3649:
+	INC 6, H
+L3650:
+	DEC 3, XBC
+L3651:
+	DEC 5, H
+L3652:
+	INC 5, IX
+L3653:
+	INC 7, IX
+L3654:
+	INC 3, E
+L3655:
+	DEC 1, XHL
+L3656:
+	INC 3, XDE
+L3657:
+	DEC 2, XHL
+L3658:
+	DEC 7, XDE
+L3659:
+	DEC 2, W
+L3660:
+	DEC 7, A
+L3661:
+	INC 6, XBC
+L3662:
+	DEC 5, IY
+L3663:
+	DEC 5, D
+L3664:
+	INC 5, XBC
+L3665:
+	INC 3, XBC
+L3666:
+	INC 4, DE
+L3667:
+	DEC 1, WA
+L3668:
+	DEC 5, XIZ
+L3669:
+	DEC 8, L
+L3670:
+	DEC 5, IX
+L3671:
+	INC 5, W
+L3672:
+	DEC 7, XHL
+L3673:
+	INC 8, IY
+L3674:
+	DEC 6, XBC
+L3675:
+	INC 8, XHL
+L3676:
+	DEC 6, B
+L3677:
+	INC 5, E
+L3678:
+	INC 3, XIY
+L3679:
+	DEC 5, IZ
+L3680:
+	DEC 7, DE
+L3681:
+	DEC 2, XIX
+L3682:
+	DEC 8, C
+L3683:
+	DEC 1, XDE
+L3684:
+	INC 3, C
+L3685:
+	DEC 8, XWA
+L3686:
+	INC 8, IZ
+L3687:
+	INC 7, B
+L3688:
+	INC 3, L
+L3689:
+	INC 6, L
+L3690:
+	INC 6, XWA
+L3691:
+	INC 3, XIZ
+L3692:
+	DEC 6, B
+L3693:
+	INC 3, XWA
+L3694:
+	INC 7, B
+L3695:
+	INC 8, DE
+L3696:
+	INC 5, E
+L3697:
+	INC 1, IZ
+L3698:
+	INC 1, DE
+L3699:
+	INC 8, D
+L3700:
+	DEC 1, IX
+L3701:
+	INC 4, XIX
+L3702:
+	INC 6, B
+L3703:
+	DEC 5, XWA
+L3704:
+	DEC 8, XDE
+L3705:
+	INC 2, HL
+L3706:
+	INC 3, XBC
+L3707:
+	DEC 3, IY
+L3708:
+	INC 4, A
+L3709:
+	DEC 7, IY
+L3710:
+	DEC 4, XIZ
+L3711:
+	DEC 8, XBC
+L3712:
+	INC 7, DE
+L3713:
+	INC 5, DE
+L3714:
+	INC 8, XIY
+L3715:
+	DEC 4, H
+L3716:
+	DEC 8, XIY
+L3717:
+	DEC 3, XBC
+L3718:
+	INC 4, DE
+L3719:
+	DEC 6, B
+L3720:
+	DEC 1, BC
+L3721:
+	DEC 1, XDE
+L3722:
+	DEC 6, W
+L3723:
+	INC 5, A
+L3724:
+	INC 8, HL
+L3725:
+	INC 3, XHL
+L3726:
+	INC 3, XWA
+L3727:
+	DEC 3, HL
+L3728:
+	DEC 3, HL
+L3729:
+	DEC 1, XIZ
+L3730:
+	INC 3, IX
+L3731:
+	INC 3, DE
+L3732:
+	INC 5, H
+L3733:
+	DEC 7, XIY
+L3734:
+	DEC 1, XIZ
+L3735:
+	INC 8, XIY
+L3736:
+	INC 8, IX
+L3737:
+	INC 1, IY
+L3738:
+	INC 3, DE
+L3739:
+	DEC 4, IX
+L3740:
+	DEC 7, IY
+L3741:
+	DEC 1, IY
+L3742:
+	DEC 4, BC
+L3743:
+	INC 3, W
+L3744:
+	DEC 5, IY
+L3745:
+	INC 3, BC
+L3746:
+	DEC 1, W
+L3747:
+	DEC 6, C
+L3748:
+	INC 7, XIZ
+L3749:
+	DEC 5, DE
+L3750:
+	INC 3, H
+L3751:
+	INC 1, BC
+L3752:
+	INC 8, BC
+L3753:
+	DEC 6, XIX
+L3754:
+	INC 4, IY
+L3755:
+	DEC 4, E
+L3756:
+	DEC 7, XDE
+L3757:
+	DEC 3, B
+L3758:
+	INC 3, IZ
+L3759:
+	DEC 5, IX
+L3760:
+	INC 2, XWA
+L3761:
+	DEC 7, XIZ
+L3762:
+	DEC 3, XDE
+L3763:
+	DEC 2, E
+L3764:
+	INC 5, XHL
+L3765:
+	INC 7, IX
+L3766:
+	DEC 7, XIZ
+L3767:
+	INC 8, XHL
+L3768:
+	DEC 5, W
+L3769:
+	DEC 2, IY
+L3770:
+	INC 6, XBC
+L3771:
+	DEC 3, HL
+L3772:
+	INC 8, IX
+L3773:
+	DEC 3, A
+L3774:
+	INC 4, IX
+L3775:
+	INC 7, IX
+L3776:
+	INC 7, BC
+L3777:
+	INC 2, XBC
+L3778:
+	DEC 3, XWA
+L3779:
+	DEC 1, L
+L3780:
+	DEC 1, C
+L3781:
+	INC 7, B
+L3782:
+	DEC 4, XDE
+L3783:
+	DEC 1, XHL
+L3784:
+	INC 7, XIX
+L3785:
+	INC 4, C
+L3786:
+	INC 8, A
+L3787:
+	INC 4, XHL
+L3788:
+	INC 4, L
+L3789:
+	INC 7, BC
+L3790:
+	INC 7, XIY
+L3791:
+	INC 8, HL
+L3792:
+	DEC 4, D
+L3793:
+	INC 3, E
+L3794:
+	DEC 3, XHL
+L3795:
+	DEC 8, W
+L3796:
+	INC 3, IZ
+L3797:
+	INC 5, WA
+L3798:
+	DEC 1, XIX
+L3799:
+	DEC 3, WA
+L3800:
+	INC 1, B
+L3801:
+	INC 2, XBC
+L3802:
+	DEC 6, XHL
+L3803:
+	INC 5, B
+L3804:
+	DEC 2, DE
+L3805:
+	INC 6, H
+L3806:
+	INC 3, XIX
+L3807:
+	INC 2, IX
+L3808:
+	DEC 5, XHL
+L3809:
+	DEC 4, C
+L3810:
+	INC 5, IZ
+L3811:
+	INC 2, XIZ
+L3812:
+	DEC 4, B
+L3813:
+	DEC 8, HL
+L3814:
+	INC 7, XIX
+L3815:
+	INC 5, A
+L3816:
+	INC 4, XDE
+L3817:
+	INC 1, XDE
+L3818:
+	INC 3, IZ
+L3819:
+	DEC 4, XDE
+L3820:
+	INC 7, B
+L3821:
+	INC 5, XIX
+L3822:
+	INC 5, IY
+L3823:
+	DEC 4, IY
+L3824:
+	INC 5, H
+L3825:
+	INC 3, L
+L3826:
+	INC 4, A
+L3827:
+	INC 8, XHL
+L3828:
+	DEC 3, L
+L3829:
+	DEC 2, WA
+L3830:
+	INC 8, XDE
+L3831:
+	INC 1, D
+L3832:
+	DEC 4, BC
+L3833:
+	INC 3, HL
+L3834:
+	INC 2, BC
+L3835:
+	DEC 4, WA
+L3836:
+	INC 2, DE
+L3837:
+	DEC 5, DE
+L3838:
+	DEC 3, C
+L3839:
+	INC 8, L
+L3840:
+	DEC 6, W
+L3841:
+	DEC 6, XBC
+L3842:
+	DEC 8, IX
+L3843:
+	DEC 7, XDE
+L3844:
+	DEC 6, DE
+L3845:
+	INC 1, HL
+L3846:
+	INC 6, XDE
+L3847:
+	DEC 4, IZ
+L3848:
+	INC 5, XIX
+L3849:
+	INC 3, XWA
+L3850:
+	DEC 5, XHL
+L3851:
+	INC 4, XIY
+L3852:
+	INC 3, XIX
+L3853:
+	INC 5, A
+L3854:
+	INC 6, BC
+L3855:
+	INC 4, C
+L3856:
+	INC 4, H
+L3857:
+	INC 6, XIX
+L3858:
+	DEC 8, D
+L3859:
+	INC 4, IZ
+L3860:
+	INC 2, WA
+L3861:
+	DEC 7, XBC
+L3862:
+	INC 8, IZ
+L3863:
+	DEC 5, L
+L3864:
+	INC 6, XIX
+L3865:
+	DEC 4, XHL
+L3866:
+	INC 6, L
+L3867:
+	DEC 4, W
+L3868:
+	INC 8, XDE
+L3869:
+	DEC 3, C
+L3870:
+	DEC 1, XIZ
+L3871:
+	DEC 8, XWA
+L3872:
+	DEC 1, XIY
+L3873:
+	INC 1, XIY
+L3874:
+	DEC 7, HL
+L3875:
+	DEC 3, B
+L3876:
+	INC 5, B
+L3877:
+	INC 4, IZ
+L3878:
+	DEC 3, C
+L3879:
+	DEC 3, BC
+L3880:
+	INC 6, WA
+L3881:
+	INC 8, E
+L3882:
+	INC 4, XIZ
+L3883:
+	INC 5, XIZ
+L3884:
+	INC 3, L
+L3885:
+	INC 8, L
+L3886:
+	INC 1, XBC
+L3887:
+	INC 4, XIX
+L3888:
+	DEC 4, IZ
+L3889:
+	INC 2, XHL
+L3890:
+	INC 6, A
+L3891:
+	INC 2, IY
+L3892:
+	INC 4, C
+L3893:
+	INC 1, XDE
+L3894:
+	DEC 4, L
+L3895:
+	DEC 1, B
+L3896:
+	DEC 5, DE
+L3897:
+	DEC 6, B
+L3898:
+	INC 4, XIX
+L3899:
+	INC 6, DE
+L3900:
+	INC 4, L
+L3901:
+	INC 6, XIX
+L3902:
+	INC 1, XBC
+L3903:
+	INC 2, IY
+L3904:
+	INC 3, XWA
+L3905:
+	DEC 8, WA
+L3906:
+	DEC 1, L
+L3907:
+	DEC 1, D
+L3908:
+	DEC 4, W
+L3909:
+	DEC 4, IX
+L3910:
+	INC 2, C
+L3911:
+	DEC 2, W
+L3912:
+	INC 4, XWA
+L3913:
+	DEC 6, XIZ
+L3914:
+	DEC 4, IX
+L3915:
+	DEC 6, D
+L3916:
+	INC 6, DE
+L3917:
+	INC 1, E
+L3918:
+	DEC 3, B
+L3919:
+	DEC 8, D
+L3920:
+	INC 3, D
+L3921:
+	INC 7, IY
+L3922:
+	INC 1, XIY
+L3923:
+	INC 3, L
+L3924:
+	INC 3, WA
+L3925:
+	INC 7, BC
+L3926:
+	DEC 8, BC
+L3927:
+	INC 1, IY
+L3928:
+	INC 6, IX
+L3929:
+	DEC 7, IX
+L3930:
+	INC 4, DE
+L3931:
+	DEC 5, XIX
+L3932:
+	INC 8, H
+L3933:
+	INC 1, XWA
+L3934:
+	DEC 5, B
+L3935:
+	DEC 2, HL
+L3936:
+	INC 6, XHL
+L3937:
+	INC 5, C
+L3938:
+	INC 1, XWA
+L3939:
+	DEC 5, W
+L3940:
+	DEC 8, XDE
+L3941:
+	DEC 7, A
+L3942:
+	DEC 8, DE
+L3943:
+	DEC 8, IX
+L3944:
+	DEC 5, XHL
+L3945:
+	DEC 6, IX
+L3946:
+	DEC 4, IY
+L3947:
+	DEC 1, W
+L3948:
+	DEC 5, XDE
+L3949:
+	DEC 8, DE
+L3950:
+	DEC 6, IZ
+L3951:
+	DEC 5, HL
+L3952:
+	DEC 5, DE
+L3953:
+	INC 2, E
+L3954:
+	INC 6, IX
+L3955:
+	DEC 7, WA
+L3956:
+	DEC 4, BC
+L3957:
+	DEC 5, XWA
+L3958:
+	DEC 4, IZ
+L3959:
+	DEC 7, C
+L3960:
+	INC 2, A
+L3961:
+	INC 6, L
+L3962:
+	DEC 5, XBC
+L3963:
+	INC 7, W
+L3964:
+	DEC 3, XWA
+L3965:
+	DEC 2, W
+L3966:
+	INC 4, IY
+L3967:
+	INC 8, D
+L3968:
+	DEC 8, C
+L3969:
+	DEC 8, WA
+L3970:
+	INC 3, IZ
+L3971:
+	DEC 7, D
+L3972:
+	DEC 2, HL
+L3973:
+	INC 8, XIZ
+L3974:
+	DEC 2, DE
+L3975:
+	DEC 1, XHL
+L3976:
+	INC 5, L
+L3977:
+	INC 7, XIY
+L3978:
+	INC 2, IY
+L3979:
+	DEC 3, XDE
+L3980:
+	DEC 7, C
+L3981:
+	INC 3, XHL
+L3982:
+	DEC 3, A
+L3983:
+	DEC 4, A
+L3984:
+	DEC 4, H
+L3985:
+	DEC 5, E
+L3986:
+	INC 5, IX
+L3987:
+	INC 4, D
+L3988:
+	DEC 4, W
+L3989:
+	INC 5, L
+L3990:
+	INC 5, B
+L3991:
+	INC 7, IZ
+L3992:
+	INC 1, A
+L3993:
+	INC 2, DE
+L3994:
+	INC 6, XWA
+L3995:
+	INC 6, H
+L3996:
+	INC 7, WA
+L3997:
+	DEC 4, L
+L3998:
+	INC 5, IX
+L3999:
+	INC 3, IX
+L4000:
+	INC 1, XIZ
+L4001:
+	DEC 1, XDE
+L4002:
+	INC 6, B
+L4003:
+	INC 5, C
+L4004:
+	INC 7, L
+L4005:
+	INC 2, L
+L4006:
+	INC 1, XIZ
+L4007:
+	DEC 5, L
+L4008:
+	DEC 3, D
+L4009:
+	INC 5, D
+L4010:
+	DEC 4, BC
+L4011:
+	INC 3, C
+L4012:
+	DEC 7, DE
+L4013:
+	DEC 4, C
+L4014:
+	DEC 4, W
+L4015:
+	INC 8, BC
+L4016:
+	INC 7, H
+L4017:
+	INC 7, XIZ
+L4018:
+	DEC 8, BC
+L4019:
+	INC 5, XIX
+L4020:
+	DEC 3, XIY
+L4021:
+	DEC 1, DE
+L4022:
+	DEC 8, XIY
+L4023:
+	INC 3, HL
+L4024:
+	DEC 5, IZ
+L4025:
+	INC 6, IZ
+L4026:
+	DEC 3, H
+L4027:
+	INC 3, H
+L4028:
+	DEC 6, L
+L4029:
+	DEC 6, XIZ
+L4030:
+	INC 5, BC
+L4031:
+	DEC 2, XIY
+L4032:
+	INC 4, XIY
+L4033:
+	INC 6, C
+L4034:
+	INC 3, BC
+L4035:
+	INC 2, XHL
+L4036:
+	DEC 4, L
+L4037:
+	DEC 3, WA
+L4038:
+	INC 6, C
+L4039:
+	INC 8, XBC
+L4040:
+	DEC 6, XIY
+L4041:
+	INC 3, DE
+L4042:
+	INC 4, B
+L4043:
+	DEC 3, XIX
+L4044:
+	DEC 6, HL
+L4045:
+	DEC 6, HL
+L4046:
+	DEC 3, IX
+L4047:
+	INC 8, XWA
+L4048:
+	DEC 1, XDE
+L4049:
+	INC 6, BC
+L4050:
+	DEC 3, IX
+L4051:
+	DEC 2, W
+L4052:
+	DEC 4, L
+L4053:
+	DEC 8, E
+L4054:
+	INC 6, BC
+L4055:
+	DEC 3, W
+L4056:
+	INC 1, XIY
+L4057:
+	DEC 4, IY
+L4058:
+	INC 1, L
+L4059:
+	INC 2, IX
+L4060:
+	DEC 3, XIX
+L4061:
+	INC 8, IZ
+L4062:
+	INC 4, XIY
+L4063:
+	INC 2, BC
+L4064:
+	INC 7, XBC
+L4065:
+	DEC 7, E
+L4066:
+	INC 3, XIX
+L4067:
+	DEC 5, A
+L4068:
+	INC 1, XBC
+L4069:
+	DEC 7, IY
+L4070:
+	INC 1, IY
+L4071:
+	DEC 4, IX
+L4072:
+	DEC 4, H
+L4073:
+	INC 8, BC
+L4074:
+	INC 2, HL
+L4075:
+	DEC 2, IY
+L4076:
+	INC 5, IY
+L4077:
+	DEC 8, B
+L4078:
+	DEC 1, DE
+L4079:
+	INC 8, XIX
+L4080:
+	DEC 5, IX
+L4081:
+	INC 5, XBC
+L4082:
+	DEC 2, D
+L4083:
+	DEC 2, DE
+L4084:
+	DEC 1, D
+L4085:
+	DEC 1, XDE
+L4086:
+	INC 7, XIZ
+L4087:
+	INC 1, C
+L4088:
+	DEC 5, XDE
+L4089:
+	DEC 3, C
+L4090:
+	INC 2, L
+L4091:
+	INC 6, XDE
+L4092:
+	DEC 3, W
+L4093:
+	DEC 2, XWA
+L4094:
+	INC 5, WA
+L4095:
+	DEC 1, H
+L4096:
+	INC 8, E
+L4097:
+	DEC 2, XIY
+L4098:
+	INC 4, W
+L4099:
+	DEC 1, BC
+L4100:
+	DEC 3, IX
+L4101:
+	DEC 5, L
+L4102:
+	DEC 2, C
+L4103:
+	INC 3, XDE
+L4104:
+	DEC 3, XBC
+L4105:
+	INC 1, BC
+L4106:
+	DEC 8, L
+L4107:
+	INC 7, B
+L4108:
+	DEC 2, A
+L4109:
+	DEC 2, XBC
+L4110:
+	INC 1, XHL
+L4111:
+	INC 5, L
+L4112:
+	INC 8, XIZ
+L4113:
+	DEC 7, XIY
+L4114:
+	DEC 8, HL
+L4115:
+	INC 8, L
+L4116:
+	DEC 8, W
+L4117:
+	INC 6, C
+L4118:
+	INC 1, HL
+L4119:
+	INC 3, L
+L4120:
+	DEC 5, IZ
+L4121:
+	DEC 1, XHL
+L4122:
+	INC 2, XIZ
+L4123:
+	DEC 5, XDE
+L4124:
+	DEC 8, C
+L4125:
+	INC 8, A
+L4126:
+	DEC 1, XBC
+L4127:
+	INC 6, C
+L4128:
+	DEC 8, IX
+L4129:
+	INC 5, W
+L4130:
+	INC 5, DE
+L4131:
+	INC 6, IX
+L4132:
+	INC 2, C
+L4133:
+	DEC 5, B
+L4134:
+	INC 5, B
+L4135:
+	INC 7, DE
+L4136:
+	INC 6, BC
+L4137:
+	INC 6, A
+L4138:
+	INC 1, W
+L4139:
+	INC 7, XHL
+L4140:
+	DEC 1, HL
+L4141:
+	INC 3, H
+L4142:
+	INC 2, HL
+L4143:
+	DEC 8, XIZ
+L4144:
+	DEC 6, E
+L4145:
+	DEC 3, XBC
+L4146:
+	DEC 1, C
+L4147:
+	INC 1, E
+L4148:
+	INC 4, XHL
+L4149:
+	DEC 4, A
+L4150:
+	INC 3, IZ
+L4151:
+	INC 6, IY
+L4152:
+	INC 2, A
+L4153:
+	INC 2, XBC
+L4154:
+	INC 2, E
+L4155:
+	INC 7, BC
+L4156:
+	INC 5, XIY
+L4157:
+	DEC 3, XHL
+L4158:
+	INC 3, B
+L4159:
+	DEC 3, W
+L4160:
+	INC 3, IY
+L4161:
+	DEC 2, IY
+L4162:
+	DEC 5, WA
+L4163:
+	INC 2, HL
+L4164:
+	INC 2, IZ
+L4165:
+	INC 4, XIX
+L4166:
+	INC 2, E
+L4167:
+	DEC 7, HL
+L4168:
+	DEC 4, DE
+L4169:
+	DEC 6, H
+L4170:
+	DEC 5, XWA
+L4171:
+	INC 6, IX
+L4172:
+	DEC 3, WA
+L4173:
+	DEC 7, XBC
+L4174:
+	DEC 5, XWA
+L4175:
+	INC 7, L
+L4176:
+	INC 2, XHL
+L4177:
+	INC 7, E
+L4178:
+	DEC 5, IY
+L4179:
+	DEC 1, IZ
+L4180:
+	INC 2, BC
+L4181:
+	INC 8, H
+L4182:
+	INC 2, B
+L4183:
+	DEC 1, H
+L4184:
+	DEC 6, IY
+L4185:
+	DEC 4, IX
+L4186:
+	DEC 1, L
+L4187:
+	INC 7, W
+L4188:
+	DEC 5, BC
+L4189:
+	DEC 5, WA
+L4190:
+	DEC 4, XWA
+L4191:
+	DEC 7, XIZ
+L4192:
+	INC 1, XWA
+L4193:
+	INC 1, IX
+L4194:
+	INC 6, DE
+L4195:
+	INC 4, A
+L4196:
+	DEC 4, B
+L4197:
+	INC 6, C
+L4198:
+	INC 3, WA
+L4199:
+	DEC 7, WA
+L4200:
+	DEC 7, B
+L4201:
+	DEC 3, L
+L4202:
+	INC 6, B
+L4203:
+	INC 4, XHL
+L4204:
+	DEC 8, L
+L4205:
+	DEC 3, C
+L4206:
+	INC 8, XHL
+L4207:
+	INC 8, H
+L4208:
+	DEC 4, XIX
+L4209:
+	DEC 3, IX
+L4210:
+	DEC 2, DE
+L4211:
+	DEC 8, XIZ
+L4212:
+	DEC 3, L
+L4213:
+	DEC 5, XDE
+L4214:
+	INC 7, XWA
+L4215:
+	INC 8, XIY
+L4216:
+	DEC 2, L
+L4217:
+	DEC 4, IX
+L4218:
+	DEC 1, HL
+L4219:
+	DEC 6, HL
+L4220:
+	DEC 8, W
+L4221:
+	DEC 7, B
+L4222:
+	DEC 7, XHL
+L4223:
+	INC 3, WA
+L4224:
+	DEC 1, XIY
+L4225:
+	DEC 5, WA
+L4226:
+	INC 2, XDE
+L4227:
+	INC 8, W
+L4228:
+	DEC 5, E
+L4229:
+	DEC 7, H
+L4230:
+	DEC 8, IZ
+L4231:
+	INC 6, IY
+L4232:
+	DEC 3, H
+L4233:
+	INC 1, B
+L4234:
+	DEC 4, IY
+L4235:
+	INC 7, IX
+L4236:
+	DEC 2, W
+L4237:
+	INC 4, IZ
+L4238:
+	INC 6, BC
+L4239:
+	INC 8, B
+L4240:
+	DEC 8, C
+L4241:
+	INC 7, WA
+L4242:
+	INC 8, WA
+L4243:
+	INC 2, XIX
+L4244:
+	INC 2, HL
+L4245:
+	DEC 8, D
+L4246:
+	DEC 4, W
+L4247:
+	INC 5, W
+L4248:
+	DEC 8, XDE
+L4249:
+	DEC 5, WA
+L4250:
+	DEC 8, W
+L4251:
+	DEC 8, WA
+L4252:
+	INC 4, XBC
+L4253:
+	DEC 1, BC
+L4254:
+	DEC 1, IX
+L4255:
+	INC 3, XWA
+L4256:
+	INC 4, IY
+L4257:
+	INC 7, IY
+L4258:
+	DEC 4, A
+L4259:
+	INC 7, XBC
+L4260:
+	INC 6, IX
+L4261:
+	DEC 4, BC
+L4262:
+	DEC 5, B
+L4263:
+	INC 7, C
+L4264:
+	DEC 2, XIZ
+L4265:
+	DEC 3, XWA
+L4266:
+	INC 3, XBC
+L4267:
+	INC 1, XIY
+L4268:
+	INC 7, IY
+L4269:
+	DEC 7, E
+L4270:
+	DEC 8, IZ
+L4271:
+	DEC 3, XWA
+L4272:
+	DEC 3, XWA
+L4273:
+	DEC 2, XWA
+L4274:
+	INC 8, HL
+L4275:
+	INC 6, L
+L4276:
+	DEC 1, XIX
+L4277:
+	INC 3, E
+L4278:
+	DEC 4, XWA
+L4279:
+	DEC 2, DE
+L4280:
+	INC 8, XIY
+L4281:
+	INC 4, DE
+L4282:
+	DEC 3, E
+L4283:
+	INC 1, XIX
+L4284:
+	DEC 5, HL
+L4285:
+	DEC 6, WA
+L4286:
+	INC 8, XBC
+L4287:
+	DEC 2, C
+L4288:
+	DEC 4, BC
+L4289:
+	INC 1, D
+L4290:
+	INC 3, H
+L4291:
+	INC 6, XWA
+L4292:
+	DEC 7, W
+L4293:
+	DEC 6, HL
+L4294:
+	INC 2, IY
+L4295:
+	DEC 8, B
+L4296:
+	INC 3, IZ
+L4297:
+	DEC 5, XDE
+L4298:
+	DEC 2, B
+L4299:
+	DEC 3, HL
+L4300:
+	INC 3, D
+L4301:
+	DEC 2, BC
+L4302:
+	INC 6, XWA
+L4303:
+	DEC 8, XIX
+L4304:
+	DEC 8, XHL
+L4305:
+	INC 4, IX
+L4306:
+	INC 6, WA
+L4307:
+	INC 7, C
+L4308:
+	INC 3, XBC
+L4309:
+	DEC 7, HL
+L4310:
+	DEC 1, XIX
+L4311:
+	DEC 2, W
+L4312:
+	INC 6, H
+L4313:
+	DEC 4, IY
+L4314:
+	DEC 6, WA
+L4315:
+	DEC 4, IY
+L4316:
+	INC 8, E
+L4317:
+	DEC 8, IX
+L4318:
+	INC 6, IY
+L4319:
+	INC 6, B
+L4320:
+	DEC 1, XIX
+L4321:
+	INC 8, XIZ
+L4322:
+	INC 2, H
+L4323:
+	INC 4, XIY
+L4324:
+	INC 6, W
+L4325:
+	INC 4, XHL
+L4326:
+	INC 4, D
+L4327:
+	DEC 7, A
+L4328:
+	DEC 2, DE
+L4329:
+	INC 3, IY
+L4330:
+	INC 8, L
+L4331:
+	INC 8, IY
+L4332:
+	DEC 7, XIY
+L4333:
+	DEC 4, XIX
+L4334:
+	INC 3, HL
+L4335:
+	DEC 1, XIZ
+L4336:
+	DEC 5, W
+L4337:
+	DEC 6, L
+L4338:
+	DEC 7, XIY
+L4339:
+	DEC 5, XBC
+L4340:
+	DEC 6, B
+L4341:
+	INC 5, IX
+L4342:
+	INC 6, IY
+L4343:
+	DEC 4, C
+L4344:
+	DEC 2, XDE
+L4345:
+	DEC 5, XBC
+L4346:
+	DEC 3, L
+L4347:
+	INC 4, BC
+L4348:
+	INC 7, IZ
+L4349:
+	INC 7, L
+L4350:
+	DEC 2, WA
+L4351:
+	INC 2, XBC
+L4352:
+	INC 8, BC
+L4353:
+	DEC 7, XHL
+L4354:
+	DEC 5, DE
+L4355:
+	DEC 8, C
+L4356:
+	INC 6, XIX
+L4357:
+	INC 3, BC
+L4358:
+	DEC 1, HL
+L4359:
+	DEC 3, D
+L4360:
+	INC 1, XDE
+L4361:
+	DEC 5, DE
+L4362:
+	DEC 8, D
+L4363:
+	DEC 7, XWA
+L4364:
+	INC 6, C
+L4365:
+	DEC 2, IX
+L4366:
+	DEC 5, HL
+L4367:
+	DEC 2, XIZ
+L4368:
+	DEC 5, B
+L4369:
+	INC 1, XHL
+L4370:
+	INC 6, IX
+L4371:
+	INC 6, BC
+L4372:
+	DEC 2, L
+L4373:
+	INC 8, B
+L4374:
+	DEC 3, BC
+L4375:
+	INC 6, E
+L4376:
+	INC 4, DE
+L4377:
+	DEC 4, XWA
+L4378:
+	DEC 7, DE
+L4379:
+	INC 8, WA
+L4380:
+	INC 1, H
+L4381:
+	DEC 5, WA
+L4382:
+	INC 3, C
+L4383:
+	DEC 8, XIZ
+L4384:
+	INC 3, XDE
+L4385:
+	INC 8, XDE
+L4386:
+	INC 2, DE
+L4387:
+	DEC 8, WA
+L4388:
+	DEC 8, XIX
+L4389:
+	INC 3, B
+L4390:
+	DEC 4, XIY
+L4391:
+	DEC 7, IY
+L4392:
+	DEC 3, IZ
+L4393:
+	INC 3, XIX
+L4394:
+	DEC 7, DE
+L4395:
+	DEC 2, XDE
+L4396:
+	DEC 7, HL
+L4397:
+	INC 5, B
+L4398:
+	INC 1, H
+L4399:
+	DEC 5, L
+L4400:
+	INC 5, XIY
+L4401:
+	DEC 2, XIX
+L4402:
+	DEC 5, IY
+L4403:
+	INC 5, IY
+L4404:
+	DEC 5, XHL
+L4405:
+	DEC 2, IX
+L4406:
+	INC 7, IY
+L4407:
+	DEC 2, IY
+L4408:
+	DEC 2, IZ
+L4409:
+	DEC 1, XIX
+L4410:
+	DEC 5, IY
+L4411:
+	INC 1, L
+L4412:
+	DEC 8, XIZ
+L4413:
+	INC 6, W
+L4414:
+	INC 1, C
+L4415:
+	INC 8, W
+L4416:
+	INC 3, XDE
+L4417:
+	DEC 3, D
+L4418:
+	INC 5, W
+L4419:
+	DEC 2, L
+L4420:
+	DEC 4, IY
+L4421:
+	INC 7, XIY
+L4422:
+	DEC 2, BC
+L4423:
+	INC 4, A
+L4424:
+	INC 3, XWA
+L4425:
+	INC 4, XWA
+L4426:
+	INC 6, BC
+L4427:
+	DEC 3, DE
+L4428:
+	INC 1, H
+L4429:
+	DEC 5, B
+L4430:
+	DEC 7, XIY
+L4431:
+	DEC 8, WA
+L4432:
+	INC 7, DE
+L4433:
+	INC 2, H
+L4434:
+	DEC 3, DE
+L4435:
+	INC 5, IY
+L4436:
+	DEC 8, HL
+L4437:
+	DEC 6, XHL
+L4438:
+	DEC 2, XWA
+L4439:
+	DEC 4, HL
+L4440:
+	INC 8, A
+L4441:
+	INC 2, BC
+L4442:
+	INC 3, XWA
+L4443:
+	DEC 8, IZ
+L4444:
+	DEC 1, WA
+L4445:
+	INC 3, E
+L4446:
+	INC 2, BC
+L4447:
+	DEC 5, D
+L4448:
+	DEC 8, A
+L4449:
+	DEC 8, HL
+L4450:
+	DEC 4, XHL
+L4451:
+	DEC 1, D
+L4452:
+	DEC 2, WA
+L4453:
+	DEC 4, HL
+L4454:
+	DEC 7, IX
+L4455:
+	DEC 2, IX
+L4456:
+	DEC 1, DE
+L4457:
+	DEC 3, BC
+L4458:
+	INC 5, E
+L4459:
+	INC 5, H
+L4460:
+	INC 3, W
+L4461:
+	INC 7, A
+L4462:
+	DEC 8, HL
+L4463:
+	INC 8, D
+L4464:
+	INC 1, HL
+L4465:
+	DEC 4, E
+L4466:
+	DEC 6, E
+L4467:
+	INC 5, WA
+L4468:
+	INC 5, E
+L4469:
+	INC 3, XBC
+L4470:
+	DEC 6, XIX
+L4471:
+	INC 6, A
+L4472:
+	DEC 3, DE
+L4473:
+	INC 5, IY
+L4474:
+	INC 1, BC
+L4475:
+	DEC 2, BC
+L4476:
+	INC 7, BC
+L4477:
+	INC 2, XWA
+L4478:
+	DEC 1, DE
+L4479:
+	DEC 3, IY
+L4480:
+	INC 4, WA
+L4481:
+	DEC 2, L
+L4482:
+	INC 6, IZ
+L4483:
+	INC 1, XIZ
+L4484:
+	DEC 8, IZ
+L4485:
+	DEC 8, B
+L4486:
+	INC 1, IX
+L4487:
+	DEC 5, L
+L4488:
+	DEC 7, XBC
+L4489:
+	INC 6, XDE
+L4490:
+	DEC 1, IZ
+L4491:
+	DEC 3, DE
+L4492:
+	DEC 3, XBC
+L4493:
+	INC 1, C
+L4494:
+	DEC 4, IZ
+L4495:
+	DEC 6, HL
+L4496:
+	DEC 2, A
+L4497:
+	INC 8, DE
+L4498:
+	DEC 7, XWA
+L4499:
+	INC 5, WA
+L4500:
+	DEC 6, XWA
+L4501:
+	INC 7, WA
+L4502:
+	DEC 1, H
+L4503:
+	DEC 6, H
+L4504:
+	INC 6, HL
+L4505:
+	DEC 7, DE
+L4506:
+	INC 7, DE
+L4507:
+	DEC 4, E
+L4508:
+	INC 8, XHL
+L4509:
+	DEC 7, IY
+L4510:
+	INC 3, XIX
+L4511:
+	DEC 3, XIZ
+L4512:
+	INC 2, XBC
+L4513:
+	DEC 8, IY
+L4514:
+	DEC 7, HL
+L4515:
+	INC 3, HL
+L4516:
+	DEC 8, XBC
+L4517:
+	DEC 1, IY
+L4518:
+	INC 5, XIZ
+L4519:
+	DEC 3, A
+L4520:
+	DEC 8, D
+L4521:
+	INC 7, XBC
+L4522:
+	INC 3, C
+L4523:
+	DEC 7, L
+L4524:
+	INC 8, XIX
+L4525:
+	INC 7, W
+L4526:
+	DEC 5, DE
+L4527:
+	DEC 6, D
+L4528:
+	INC 8, DE
+L4529:
+	INC 7, C
+L4530:
+	INC 8, H
+L4531:
+	INC 2, IZ
+L4532:
+	DEC 8, IZ
+L4533:
+	INC 1, D
+L4534:
+	DEC 6, XIY
+L4535:
+	INC 4, XWA
+L4536:
+	DEC 8, H
+L4537:
+	DEC 8, BC
+L4538:
+	DEC 1, XBC
+L4539:
+	DEC 6, IZ
+L4540:
+	DEC 2, DE
+L4541:
+	INC 2, L
+L4542:
+	DEC 4, DE
+L4543:
+	INC 8, XWA
+L4544:
+	DEC 4, H
+L4545:
+	INC 7, BC
+L4546:
+	INC 7, E
+L4547:
+	INC 8, XBC
+L4548:
+	DEC 3, D
+L4549:
+	DEC 6, W
+L4550:
+	INC 6, XIX
+L4551:
+	DEC 4, WA
+L4552:
+	INC 7, L
+L4553:
+	INC 4, XBC
+L4554:
+	INC 4, IY
+L4555:
+	INC 6, IY
+L4556:
+	INC 8, H
+L4557:
+	INC 2, XIX
+L4558:
+	INC 6, XIZ
+L4559:
+	INC 8, XIZ
+L4560:
+	DEC 7, H
+L4561:
+	INC 3, A
+L4562:
+	DEC 5, IX
+L4563:
+	DEC 1, XDE
+L4564:
+	DEC 4, E
+L4565:
+	DEC 6, E
+L4566:
+	DEC 6, W
+L4567:
+	INC 4, W
+L4568:
+	DEC 3, XIX
+L4569:
+	DEC 1, BC
+L4570:
+	DEC 4, XBC
+L4571:
+	INC 2, BC
+L4572:
+	INC 4, XIY
+L4573:
+	INC 8, BC
+L4574:
+	DEC 7, D
+L4575:
+	INC 1, XDE
+L4576:
+	DEC 6, HL
+L4577:
+	INC 1, BC
+L4578:
+	INC 2, A
+L4579:
+	INC 5, B
+L4580:
+	DEC 4, XHL
+L4581:
+	DEC 4, XWA
+L4582:
+	INC 3, IZ
+L4583:
+	DEC 5, WA
+L4584:
+	INC 7, D
+L4585:
+	DEC 3, A
+L4586:
+	INC 4, XIY
+L4587:
+	DEC 3, A
+L4588:
+	DEC 3, W
+L4589:
+	DEC 3, A
+L4590:
+	DEC 6, HL
+L4591:
+	DEC 5, W
+L4592:
+	INC 3, XIY
+L4593:
+	DEC 8, WA
+L4594:
+	INC 3, XWA
+L4595:
+	INC 6, A
+L4596:
+	DEC 6, IZ
+L4597:
+	INC 3, XIZ
+L4598:
+	INC 2, W
+L4599:
+	INC 6, E
+L4600:
+	DEC 7, HL
+L4601:
+	DEC 7, XHL
+L4602:
+	INC 2, BC
+L4603:
+	DEC 5, H
+L4604:
+	DEC 5, XIY
+L4605:
+	DEC 7, B
+L4606:
+	DEC 2, B
+L4607:
+	INC 6, H
+L4608:
+	INC 8, IY
+L4609:
+	INC 5, XBC
+L4610:
+	INC 3, BC
+L4611:
+	INC 8, IX
+L4612:
+	INC 2, XBC
+L4613:
+	INC 2, IX
+L4614:
+	INC 6, H
+L4615:
+	DEC 5, E
+L4616:
+	DEC 2, IZ
+L4617:
+	INC 2, E
+L4618:
+	INC 2, XHL
+L4619:
+	DEC 6, BC
+L4620:
+	DEC 4, W
+L4621:
+	INC 3, W
+L4622:
+	DEC 7, WA
+L4623:
+	DEC 7, IX
+L4624:
+	DEC 7, B
+L4625:
+	DEC 3, HL
+L4626:
+	INC 3, C
+L4627:
+	DEC 5, H
+L4628:
+	DEC 8, XIX
+L4629:
+	INC 3, D
+L4630:
+	DEC 7, WA
+L4631:
+	DEC 8, W
+L4632:
+	INC 1, A
+L4633:
+	INC 4, D
+L4634:
+	INC 4, HL
+L4635:
+	INC 6, L
+L4636:
+	INC 4, B
+L4637:
+	DEC 4, L
+L4638:
+	DEC 5, XDE
+L4639:
+	DEC 2, B
+L4640:
+	INC 2, BC
+L4641:
+	INC 4, XWA
+L4642:
+	INC 6, XIX
+L4643:
+	INC 3, XIY
+L4644:
+	DEC 3, XDE
+L4645:
+	INC 5, XHL
+L4646:
+	DEC 2, XBC
+L4647:
+	DEC 8, XHL
+L4648:
+	DEC 7, H
+L4649:
+	DEC 1, XWA
+L4650:
+	DEC 5, XIZ
+L4651:
+	DEC 7, IX
+L4652:
+	DEC 2, XIY
+L4653:
+	DEC 8, A
+L4654:
+	DEC 5, IZ
+L4655:
+	INC 4, XBC
+L4656:
+	DEC 5, IX
+L4657:
+	INC 3, L
+L4658:
+	INC 8, D
+L4659:
+	DEC 8, IX
+L4660:
+	INC 4, W
+L4661:
+	DEC 4, E
+L4662:
+	DEC 3, XIX
+L4663:
+	DEC 6, XWA
+L4664:
+	DEC 4, IZ
+L4665:
+	DEC 8, B
+L4666:
+	INC 8, HL
+L4667:
+	INC 5, XIY
+L4668:
+	DEC 2, XWA
+L4669:
+	INC 8, IY
+L4670:
+	INC 5, XIX
+L4671:
+	INC 6, DE
+L4672:
+	DEC 2, L
+L4673:
+	INC 3, XHL
+L4674:
+	INC 3, XIY
+L4675:
+	INC 2, DE
+L4676:
+	DEC 2, XIY
+L4677:
+	DEC 4, WA
+L4678:
+	DEC 6, IX
+L4679:
+	DEC 8, D
+L4680:
+	DEC 8, IZ
+L4681:
+	INC 3, XIX
+L4682:
+	DEC 5, IX
+L4683:
+	INC 8, XHL
+L4684:
+	INC 3, L
+L4685:
+	INC 6, A
+L4686:
+	INC 7, IY
+L4687:
+	DEC 8, XIY
+L4688:
+	DEC 2, BC
+L4689:
+	DEC 8, XHL
+L4690:
+	INC 1, WA
+L4691:
+	DEC 2, WA
+L4692:
+	INC 8, IX
+L4693:
+	INC 3, L
+L4694:
+	INC 7, HL
+L4695:
+	INC 6, IZ
+L4696:
+	DEC 8, D
+L4697:
+	INC 8, W
+L4698:
+	INC 4, B
+L4699:
+	INC 7, XDE
+L4700:
+	DEC 4, IZ
+L4701:
+	DEC 6, XIZ
+L4702:
+	INC 2, IZ
+L4703:
+	DEC 2, D
+L4704:
+	DEC 1, C
+L4705:
+	INC 7, XWA
+L4706:
+	INC 5, XWA
+L4707:
+	DEC 4, XIX
+L4708:
+	INC 3, XBC
+L4709:
+	INC 2, W
+L4710:
+	DEC 5, W
+L4711:
+	DEC 4, HL
+L4712:
+	INC 2, XWA
+L4713:
+	DEC 7, H
+L4714:
+	DEC 3, XIY
+L4715:
+	INC 3, DE
+L4716:
+	INC 8, A
+L4717:
+	DEC 4, XHL
+L4718:
+	INC 8, XDE
+L4719:
+	DEC 1, XBC
+L4720:
+	INC 4, B
+L4721:
+	INC 3, XIX
+L4722:
+	INC 8, IZ
+L4723:
+	INC 6, BC
+L4724:
+	DEC 5, IY
+L4725:
+	INC 1, WA
+L4726:
+	INC 5, BC
+L4727:
+	DEC 2, IX
+L4728:
+	DEC 6, IY
+L4729:
+	INC 2, IZ
+L4730:
+	DEC 8, IX
+L4731:
+	INC 4, DE
+L4732:
+	DEC 4, E
+L4733:
+	DEC 5, DE
+L4734:
+	DEC 2, XIZ
+L4735:
+	INC 7, IZ
+L4736:
+	INC 5, XDE
+L4737:
+	DEC 7, XWA
+L4738:
+	INC 2, XWA
+L4739:
+	INC 8, H
+L4740:
+	DEC 3, B
+L4741:
+	INC 1, H
+L4742:
+	DEC 6, IZ
+L4743:
+	DEC 1, W
+L4744:
+	INC 2, XIX
+L4745:
+	DEC 2, IY
+L4746:
+	DEC 3, IX
+L4747:
+	DEC 6, XBC
+L4748:
+	INC 6, H
+L4749:
+	DEC 1, XIX
+L4750:
+	INC 2, A
+L4751:
+	INC 3, IX
+L4752:
+	INC 4, D
+L4753:
+	INC 4, B
+L4754:
+	DEC 8, XHL
+L4755:
+	INC 2, W
+L4756:
+	DEC 5, XIZ
+L4757:
+	DEC 8, XIY
+L4758:
+	INC 8, WA
+L4759:
+	DEC 3, A
+L4760:
+	DEC 2, W
+L4761:
+	INC 1, B
+L4762:
+	INC 7, H
+L4763:
+	DEC 6, H
+L4764:
+	INC 6, XDE
+L4765:
+	INC 4, WA
+L4766:
+	DEC 3, WA
+L4767:
+	DEC 5, IY
+L4768:
+	DEC 5, E
+L4769:
+	DEC 4, B
+L4770:
+	DEC 1, BC
+L4771:
+	INC 8, D
+L4772:
+	DEC 6, WA
+L4773:
+	INC 4, XIX
+L4774:
+	INC 2, H
+L4775:
+	INC 1, C
+L4776:
+	DEC 3, XWA
+L4777:
+	DEC 7, D
+L4778:
+	DEC 8, XBC
+L4779:
+	INC 7, XIZ
+L4780:
+	DEC 6, XIZ
+L4781:
+	INC 7, XDE
+L4782:
+	INC 6, XWA
+L4783:
+	DEC 6, IY
+L4784:
+	INC 3, IY
+L4785:
+	INC 3, XWA
+L4786:
+	INC 8, W
+L4787:
+	DEC 5, IY
+L4788:
+	INC 7, XIZ
+L4789:
+	DEC 2, A
+L4790:
+	INC 3, WA
+L4791:
+	INC 3, HL
+L4792:
+	INC 2, W
+L4793:
+	INC 6, C
+L4794:
+	DEC 3, IZ
+L4795:
+	INC 7, IY
+L4796:
+	DEC 2, W
+L4797:
+	INC 7, IY
+L4798:
+	INC 5, XBC
+L4799:
+	INC 4, XIZ
+L4800:
+	INC 7, WA
+L4801:
+	DEC 7, DE
+L4802:
+	DEC 3, E
+L4803:
+	INC 3, XIZ
+L4804:
+	INC 5, HL
+L4805:
+	INC 3, C
+L4806:
+	INC 1, H
+L4807:
+	DEC 3, XWA
+L4808:
+	DEC 5, IZ
+L4809:
+	DEC 7, XWA
+L4810:
+	INC 4, XIX
+L4811:
+	DEC 3, WA
+L4812:
+	INC 8, IX
+L4813:
+	DEC 4, B
+L4814:
+	DEC 8, XIX
+L4815:
+	DEC 3, IZ
+L4816:
+	INC 2, W
+L4817:
+	INC 4, B
+L4818:
+	DEC 7, XWA
+L4819:
+	INC 5, L
+L4820:
+	INC 3, XIX
+L4821:
+	INC 2, BC
+L4822:
+	INC 4, XWA
+L4823:
+	INC 4, IY
+L4824:
+	DEC 2, XIX
+L4825:
+	INC 8, XDE
+L4826:
+	INC 1, A
+L4827:
+	INC 2, DE
+L4828:
+	DEC 1, C
+L4829:
+	INC 7, WA
+L4830:
+	INC 4, HL
+L4831:
+	INC 5, IY
+L4832:
+	DEC 7, IZ
+L4833:
+	INC 7, DE
+L4834:
+	DEC 4, IZ
+L4835:
+	DEC 7, XIY
+L4836:
+	DEC 5, IY
+L4837:
+	INC 6, XIY
+L4838:
+	DEC 2, XWA
+L4839:
+	INC 3, IX
+L4840:
+	DEC 4, C
+L4841:
+	INC 6, IX
+L4842:
+	DEC 2, XIX
+L4843:
+	DEC 7, IY
+L4844:
+	INC 6, L
+L4845:
+	INC 4, WA
+L4846:
+	INC 3, XIY
+L4847:
+	INC 3, XIX
+L4848:
+	INC 5, IZ
+L4849:
+	DEC 7, BC
+L4850:
+	INC 8, XIZ
+L4851:
+	INC 3, XIY
+L4852:
+	DEC 8, WA
+L4853:
+	DEC 2, L
+L4854:
+	INC 5, DE
+L4855:
+	INC 6, IZ
+L4856:
+	INC 6, XIZ
+L4857:
+	INC 5, XHL
+L4858:
+	DEC 2, BC
+L4859:
+	INC 3, XDE
+L4860:
+	DEC 5, BC
+L4861:
+	DEC 5, D
+L4862:
+	INC 2, C
+L4863:
+	INC 1, BC
+L4864:
+	DEC 6, XIY
+L4865:
+	INC 8, XBC
+L4866:
+	DEC 8, B
+L4867:
+	DEC 1, DE
+L4868:
+	DEC 3, IZ
+L4869:
+	INC 5, IZ
+L4870:
+	INC 2, XBC
+L4871:
+	DEC 6, IY
+L4872:
+	DEC 7, XIZ
+L4873:
+	INC 3, XIZ
+L4874:
+	INC 1, C
+L4875:
+	INC 8, D
+L4876:
+	INC 6, W
+L4877:
+	DEC 6, DE
+L4878:
+	DEC 3, W
+L4879:
+	DEC 2, XIY
+L4880:
+	DEC 4, H
+L4881:
+	INC 4, XDE
+L4882:
+	DEC 4, L
+L4883:
+	DEC 4, BC
+L4884:
+	INC 7, DE
+L4885:
+	DEC 3, IZ
+L4886:
+	INC 1, IZ
+L4887:
+	INC 6, HL
+L4888:
+	DEC 2, XWA
+L4889:
+	INC 2, H
+L4890:
+	DEC 5, H
+L4891:
+	DEC 7, D
+L4892:
+	INC 7, IY
+L4893:
+	INC 6, XWA
+L4894:
+	DEC 2, HL
+L4895:
+	INC 1, D
+L4896:
+	INC 8, IX
+L4897:
+	INC 7, XBC
+L4898:
+	DEC 4, XIY
+L4899:
+	INC 4, IZ
+L4900:
+	DEC 5, HL
+L4901:
+	INC 7, A
+L4902:
+	DEC 2, XIX
+L4903:
+	INC 5, W
+L4904:
+	INC 7, XIY
+L4905:
+	INC 2, XDE
+L4906:
+	DEC 3, WA
+L4907:
+	INC 5, XBC
+L4908:
+	INC 6, XIX
+L4909:
+	DEC 4, A
+L4910:
+	DEC 6, XIY
+L4911:
+	INC 5, H
+L4912:
+	DEC 5, IX
+L4913:
+	DEC 2, XIX
+L4914:
+	DEC 1, C
+L4915:
+	DEC 4, IY
+L4916:
+	INC 8, XHL
+L4917:
+	DEC 3, HL
+L4918:
+	INC 2, IZ
+L4919:
+	DEC 2, XDE
+L4920:
+	INC 2, HL
+L4921:
+	DEC 4, H
+L4922:
+	INC 3, IY
+L4923:
+	DEC 8, XHL
+L4924:
+	DEC 7, XIZ
+L4925:
+	DEC 1, IY
+L4926:
+	DEC 7, H
+L4927:
+	DEC 1, BC
+L4928:
+	INC 6, IX
+L4929:
+	DEC 3, HL
+L4930:
+	DEC 7, L
+L4931:
+	DEC 5, IZ
+L4932:
+	INC 2, XIX
+L4933:
+	DEC 1, XBC
+L4934:
+	INC 4, IX
+L4935:
+	DEC 6, WA
+L4936:
+	DEC 3, H
+L4937:
+	DEC 3, XWA
+L4938:
+	INC 3, XHL
+L4939:
+	DEC 3, B
+L4940:
+	INC 5, IX
+L4941:
+	INC 2, DE
+L4942:
+	INC 5, B
+L4943:
+	INC 3, XIY
+L4944:
+	INC 6, XIY
+L4945:
+	DEC 7, XIX
+L4946:
+	DEC 3, XIZ
+L4947:
+	INC 4, IX
+L4948:
+	INC 7, XIX
+L4949:
+	DEC 8, DE
+L4950:
+	INC 3, A
+L4951:
+	DEC 3, IZ
+L4952:
+	DEC 7, E
+L4953:
+	DEC 2, BC
+L4954:
+	INC 1, D
+L4955:
+	INC 2, XHL
+L4956:
+	DEC 5, IX
+L4957:
+	INC 8, B
+L4958:
+	DEC 7, HL
+L4959:
+	INC 1, BC
+L4960:
+	INC 8, XBC
+L4961:
+	INC 5, XIZ
+L4962:
+	INC 4, XWA
+L4963:
+	INC 7, XDE
+L4964:
+	DEC 6, H
+L4965:
+	INC 3, XWA
+L4966:
+	DEC 2, HL
+L4967:
+	INC 4, C
+L4968:
+	INC 1, BC
+L4969:
+	DEC 2, XDE
+L4970:
+	INC 7, XWA
+L4971:
+	INC 8, A
+L4972:
+	DEC 6, IY
+L4973:
+	DEC 2, XBC
+L4974:
+	INC 6, XWA
+L4975:
+	DEC 1, HL
+L4976:
+	DEC 1, XIZ
+L4977:
+	DEC 2, XIY
+L4978:
+	INC 1, IZ
+L4979:
+	INC 3, XIX
+L4980:
+	INC 6, IX
+L4981:
+	INC 5, IX
+L4982:
+	DEC 3, IZ
+L4983:
+	DEC 7, IZ
+L4984:
+	INC 2, XWA
+L4985:
+	INC 6, H
+L4986:
+	INC 6, B
+L4987:
+	INC 7, XIZ
+L4988:
+	DEC 2, BC
+L4989:
+	DEC 4, A
+L4990:
+	DEC 7, IZ
+L4991:
+	DEC 1, E
+L4992:
+	INC 8, XIZ
+L4993:
+	DEC 6, HL
+L4994:
+	INC 2, E
+L4995:
+	INC 4, E
+L4996:
+	DEC 6, H
+L4997:
+	INC 8, XBC
+L4998:
+	INC 6, IY
+L4999:
+	DEC 8, IX
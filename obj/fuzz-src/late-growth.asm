@@ -0,0 +1,16 @@
+	CPU 96C141
+	ORG 0FFDCh
+	DD L0,L1,L2,L3,L4,L5
+L0:
+	LD A,(L4)
+L1:
+	LD (L1),WA
+L2:
+	JP L3
+L3:
+	DS 6
+L4:
+	LD XWA,(L1)
+L5:
+	DS 1
+	DD L0,L1,L2,L3,L4,L5
@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	LD W, A
+L1:
+	LD WA, 8512
+L2:
+	LD L, (XHL+92:8)
+L3:
+	LDA XHL, (XIX+84)
+L4:
+	LD (XHL), IY
+L5:
+	LD WA, 55184
+L6:
+	LD B, H
+L7:
+	LD DE, 54269
+L8:
+	LD D, L
+L9:
+	LD C, A
+L10:
+	LD WA, 734
+L11:
+	LDA XDE, (XIX+13)
+L12:
+	LDA XIY, (XIX+67)
+L13:
+	LD A, E
+L14:
+	LD IY, (XIZ+44)
+L15:
+	LD IY, 21219
+L16:
+	LD W, E
+L17:
+	LD C, D
+L18:
+	LD IX, (XHL+25126:16)
+L19:
+	LD IY, (XWA+7234:16)
+L20:
+	LD XBC, L1256
+L21:
+	LD W, 168
+L22:
+	LD (XIZ), IY
+L23:
+	LD (XWA+BC), IX
+L24:
+	LD XIY, L24
+L25:
+	LD IY, 28772
+L26:
+	LD H, A
+L27:
+	LD C, 213
+L28:
+	LD (XWA+B), W
+L29:
+	LD (XBC+60:8), WA
+L30:
+	LD L, 227
+L31:
+	LD XWA, (L32)
+L32:
+	LDA XIX, (XIX+90)
+L33:
+	LD (L31:24), C
+L34:
+	LD C, W
+L35:
+	LD HL, (XIY-46)
+L36:
+	LD A, C
+L37:
+	LD A, 153
+L38:
+	LD H, B
+L39:
+	LD A, 78
+L40:
+	LD XBC, (XIZ+)
+L41:
+	LD E, (XWA-8)
+L42:
+	LD WA, 47914
+L43:
+	LD XIZ, (XIX-13)
+L44:
+	LD (XDE-1), DE
+L45:
+	LD (P0), W
+L46:
+	LD XDE, (-XIY)
+L47:
+	LD HL, 34151
+L48:
+	LD C, H
+L49:
+	LD E, 139
+L50:
+	LD A, L
+L51:
+	LD BC, 61472
+L52:
+	LD BC, 24890
+L53:
+	LD IX, (XWA+13794:16)
+L54:
+	LD BC, 6447
+L55:
+	LD B, (-XIX)
+L56:
+	LD IY, (XHL+37)
+L57:
+	LD B, 122
+L58:
+	LD (BIGREG), WA
+L59:
+	LD XWA, (XWA+)
+L60:
+	LD (XWA+BC), IX
+L61:
+	LDA XIY, (XIX+99)
+L62:
+	LDA XHL, (XIX+78)
+L63:
+	LD XIZ, (L67)
+L64:
+	LDA XBC, (XIX+75)
+L65:
+	LD IY, (P0)
+L66:
+	LD C, 95
+L67:
+	LD HL, 59521
+L68:
+	LD W, 75
+L69:
+	LD BC, 34973
+L70:
+	LD XIX, (P0)
+L71:
+	LD BC, 59394
+L72:
+	LDA XIY, (XIX+70)
+L73:
+	LD XBC, (XIY+)
+L74:
+	LD H, (FAR)
+L75:
+	LD (L2216:24), WA
+L76:
+	LD B, 9
+L77:
+	LD HL, 48530
+L78:
+	LD XHL, (L79:24)
+L79:
+	LD XDE, L83
+L80:
+	LD C, C
+L81:
+	LD BC, 2266
+L82:
+	LDA XIY, (XIX+74)
+L83:
+	LD (XWA+BC), A
+L84:
+	LD W, E
+L85:
+	LD A, E
+L86:
+	LD W, 236
+L87:
+	LD XWA, L88
+L88:
+	LD DE, (FAR)
+L89:
+	LD DE, 41542
+L90:
+	LD IY, 28524
+L91:
+	LD BC, 5050
+L92:
+	LD E, (XWA+97:8)
+L93:
+	LD XWA, L94
+L94:
+	LD XIY, L92
+L95:
+	LD XIZ, L91
+L96:
+	LD W, E
+L97:
+	LD XHL, (XIX+21507:16)
+L98:
+	LD XIX, L99
+L99:
+	LDA XBC, (XIX+79)
+L100:
+	LD D, D
+L101:
+	LD (XIY-74), HL
+L102:
+	LD XIZ, (L105:24)
+L103:
+	LD XBC, L106
+L104:
+	LD B, H
+L105:
+	LD XDE, L101
+L106:
+	LD (XWA+BC), D
+L107:
+	LD A, 169
+L108:
+	LD W, 150
+L109:
+	LD (XIX+486), BC
+L110:
+	LD (XIX+965), IY
+L111:
+	LD (FAR), L
+L112:
+	LD BC, (XWA+5937:16)
+L113:
+	LD IZ, 55916
+L114:
+	LD IX, 20336
+L115:
+	LD XHL, L119
+L116:
+	LD (BIGREG), A
+L117:
+	LD L, C
+L118:
+	LD A, 93
+L119:
+	LDA XIY, (XIX+61)
+L120:
+	LDA XHL, (XIX+29)
+L121:
+	LD H, C
+L122:
+	LD IY, 55389
+L123:
+	LD HL, 46826
+L124:
+	LD C, A
+L125:
+	LDA XWA, (XIX+0)
+L126:
+	LD XWA, L124
+L127:
+	LD (XIY+), B
+L128:
+	LDA XIY, (XIX+61)
+L129:
+	LD XBC, (XIZ)
+L130:
+	LD W, D
+L131:
+	LD L, 119
+L132:
+	LD IZ, 11668
+L133:
+	LD HL, 26794
+L134:
+	LD B, 199
+L135:
+	LD C, 214
+L136:
+	LD (XIX+287), IX
+L137:
+	LD H, 46
+L138:
+	LD E, (L134)
+L139:
+	LD BC, (L3927)
+L140:
+	LD XIY, (-XWA)
+L141:
+	LD H, (XIX+17)
+L142:
+	LD XIY, (BIGREG)
+L143:
+	LD (XIX+3942:16), E
+L144:
+	LD D, (XIY+9240:16)
+L145:
+	LD H, (XIX+1480)
+L146:
+	LD L, 97
+L147:
+	LD (XIZ+58:8), A
+L148:
+	LD C, 235
+L149:
+	LD XWA, L147
+L150:
+	LD WA, (XWA+BC)
+L151:
+	LD WA, (L1907)
+L152:
+	LD D, L
+L153:
+	LD IX, 22999
+L154:
+	LD HL, (XDE)
+L155:
+	LD H, 122
+L156:
+	LD DE, (XBC+)
+L157:
+	LD W, 103
+L158:
+	LD E, (XIX+3435:16)
+L159:
+	LDA XIY, (XIX+21)
+L160:
+	LD IZ, 37013
+L161:
+	LD XIZ, L163
+L162:
+	LD IZ, 2498
+L163:
+	LD IX, (XIZ-6)
+L164:
+	LD HL, 44825
+L165:
+	LD W, (L163)
+L166:
+	LD (XDE-31), IX
+L167:
+	LD IY, 13579
+L168:
+	LD IZ, 53528
+L169:
+	LD A, 30
+L170:
+	LD XBC, (XWA+26084:16)
+L171:
+	LD B, W
+L172:
+	LD DE, (XBC+53)
+L173:
+	LDA XBC, (XIX+5)
+L174:
+	LD A, (XIZ+)
+L175:
+	LD B, D
+L176:
+	LDA XIX, (XIX+9)
+L177:
+	LD B, (-XHL)
+L178:
+	LD IX, 46362
+L179:
+	LD (XWA-6), C
+L180:
+	LD XWA, L183
+L181:
+	LD (P0), IZ
+L182:
+	LD XDE, (XBC+11098:16)
+L183:
+	LDA XWA, (XIX+83)
+L184:
+	LD HL, (XIX+2204)
+L185:
+	LD A, 158
+L186:
+	LDA XWA, (XIX+24)
+L187:
+	LD B, (XWA+B)
+L188:
+	LD B, L
+L189:
+	LD WA, 6211
+L190:
+	LDA XIX, (XIX+55)
+L191:
+	LD XIZ, (XWA+3657:16)
+L192:
+	LD IY, 686
+L193:
+	LD XIX, L194
+L194:
+	LD BC, 34644
+L195:
+	LD XDE, L277
+L196:
+	LDA XWA, (XIX+100)
+L197:
+	LDA XIZ, (XIX+54)
+L198:
+	LD H, (XDE+28014:16)
+L199:
+	LD XIX, L197
+L200:
+	LDA XIY, (XIX+68)
+L201:
+	LD IY, 49444
+L202:
+	LD W, E
+L203:
+	LD XIY, (XIX+872)
+L204:
+	LD XDE, L204
+L205:
+	LD (L207:24), DE
+L206:
+	LD XDE, (P0)
+L207:
+	LD XIX, (XWA+17:8)
+L208:
+	LD (XIZ+13968:16), HL
+L209:
+	LD XWA, L213
+L210:
+	LD WA, 48493
+L211:
+	LD (XWA+B), D
+L212:
+	LD B, L
+L213:
+	LD XIY, (L2931)
+L214:
+	LD B, 93
+L215:
+	LDA XIY, (XIX+8)
+L216:
+	LD IZ, 12895
+L217:
+	LDA XDE, (XIX+5)
+L218:
+	LDA XIZ, (XIX+86)
+L219:
+	LD DE, 38036
+L220:
+	LDA XHL, (XIX+26)
+L221:
+	LDA XBC, (XIX+62)
+L222:
+	LD XIX, (XIX+35)
+L223:
+	LD B, E
+L224:
+	LDA XDE, (XIX+29)
+L225:
+	LD W, 161
+L226:
+	LD XWA, L227
+L227:
+	LD XHL, L223
+L228:
+	LD XWA, (XWA+15717:16)
+L229:
+	LDA XIX, (XIX+16)
+L230:
+	LDA XHL, (XIX+67)
+L231:
+	LD (XBC+57:8), C
+L232:
+	LD XIY, (XIX+2099)
+L233:
+	LD L, 246
+L234:
+	LD A, 75
+L235:
+	LD XBC, (XIY+79)
+L236:
+	LD IZ, 37142
+L237:
+	LD A, (XIZ+20)
+L238:
+	LDA XWA, (XIX+64)
+L239:
+	LD HL, (XWA+11484:16)
+L240:
+	LD (XHL+), WA
+L241:
+	LDA XBC, (XIX+91)
+L242:
+	LD XIY, L179
+L243:
+	LD XWA, L239
+L244:
+	LD IX, 16780
+L245:
+	LD HL, (XIY)
+L246:
+	LD IY, 5723
+L247:
+	LD (XWA+B), L
+L248:
+	LD XWA, L247
+L249:
+	LD XHL, L3887
+L250:
+	LD (XBC+75:8), HL
+L251:
+	LD BC, 64072
+L252:
+	LD XIY, (XIX+1071)
+L253:
+	LD L, (XIX+90:8)
+L254:
+	LD XHL, (XWA+7134:16)
+L255:
+	LDA XWA, (XIX+49)
+L256:
+	LD E, (-XDE)
+L257:
+	LD HL, (XWA+BC)
+L258:
+	LD WA, 54375
+L259:
+	LD XIY, (XBC+6:8)
+L260:
+	LD H, E
+L261:
+	LD E, E
+L262:
+	LD B, W
+L263:
+	LD IZ, 55177
+L264:
+	LD B, L
+L265:
+	LD C, (L263:24)
+L266:
+	LD XDE, L262
+L267:
+	LD D, C
+L268:
+	LDA XIX, (XIX+96)
+L269:
+	LD (XDE+), WA
+L270:
+	LD C, 30
+L271:
+	LD W, L
+L272:
+	LD XWA, L271
+L273:
+	LDA XWA, (XIX+84)
+L274:
+	LD IZ, 48967
+L275:
+	LD E, 20
+L276:
+	LDA XHL, (XIX+82)
+L277:
+	LD E, 70
+L278:
+	LD XBC, L275
+L279:
+	LD XBC, L278
+L280:
+	LDA XIY, (XIX+94)
+L281:
+	LD H, (L278:24)
+L282:
+	LD D, 78
+L283:
+	LD D, 66
+L284:
+	LDA XIY, (XIX+57)
+L285:
+	LD (L284:24), L
+L286:
+	LD XHL, (XWA+B)
+L287:
+	LD A, W
+L288:
+	LD HL, 32839
+L289:
+	LD IX, 24786
+L290:
+	LD H, H
+L291:
+	LD (L293:24), WA
+L292:
+	LD DE, 34926
+L293:
+	LD E, 182
+L294:
+	LD W, (L293)
+L295:
+	LD L, A
+L296:
+	LD XDE, L296
+L297:
+	LD XWA, (L889:24)
+L298:
+	LD XIX, L296
+L299:
+	LD XIY, (XHL)
+L300:
+	LD (BIGREG), H
+L301:
+	LD IX, 35176
+L302:
+	LDA XIX, (XIX+98)
+L303:
+	LD W, (L301:24)
+L304:
+	LD D, A
+L305:
+	LD H, E
+L306:
+	LD (XWA+BC), W
+L307:
+	LD XIZ, (L306)
+L308:
+	LD WA, 59444
+L309:
+	LDA XWA, (XIX+18)
+L310:
+	LD (L310:24), BC
+L311:
+	LD B, B
+L312:
+	LD BC, 55750
+L313:
+	LD IY, 26968
+L314:
+	LD W, 229
+L315:
+	LD D, (XIX+589)
+L316:
+	LD W, 102
+L317:
+	LD DE, (XWA+B)
+L318:
+	LDA XIZ, (XIX+81)
+L319:
+	LDA XIX, (XIX+44)
+L320:
+	LD E, B
+L321:
+	LD C, D
+L322:
+	LD D, (XDE-17)
+L323:
+	LD (XBC+), C
+L324:
+	LD IY, 57253
+L325:
+	LD XIZ, (XIY+)
+L326:
+	LD XIX, L323
+L327:
+	LD IY, (XIX+2067)
+L328:
+	LD XDE, L324
+L329:
+	LD XIZ, L329
+L330:
+	LD XDE, L331
+L331:
+	LD (-XDE), D
+L332:
+	LD XWA, (XDE+11511:16)
+L333:
+	LD XWA, (XWA+)
+L334:
+	LD B, C
+L335:
+	LD XIY, L336
+L336:
+	LDA XIZ, (XIX+52)
+L337:
+	LD H, L
+L338:
+	LD E, 187
+L339:
+	LD XHL, L341
+L340:
+	LD XBC, (XIZ+)
+L341:
+	LD XBC, L339
+L342:
+	LD (L344), IX
+L343:
+	LD W, 94
+L344:
+	LD D, 55
+L345:
+	LD D, H
+L346:
+	LD C, 202
+L347:
+	LD IY, (XIX+2899)
+L348:
+	LD XIX, (-XBC)
+L349:
+	LD DE, 23908
+L350:
+	LD B, C
+L351:
+	LD IY, 55342
+L352:
+	LD HL, 50230
+L353:
+	LD IX, 44580
+L354:
+	LD BC, 948
+L355:
+	LDA XIZ, (XIX+27)
+L356:
+	LD XBC, L352
+L357:
+	LD IZ, 25876
+L358:
+	LDA XDE, (XIX+32)
+L359:
+	LD XHL, L362
+L360:
+	LD IZ, (XBC)
+L361:
+	LD XHL, (XIX+1716)
+L362:
+	LD BC, 35493
+L363:
+	LD XHL, L4828
+L364:
+	LD HL, 64540
+L365:
+	LD L, D
+L366:
+	LD E, (L364)
+L367:
+	LDA XDE, (XIX+75)
+L368:
+	LD IY, 31600
+L369:
+	LD XBC, L371
+L370:
+	LD H, C
+L371:
+	LD H, (XWA+BC)
+L372:
+	LD B, 171
+L373:
+	LD H, 237
+L374:
+	LD XIY, (XIX+1336)
+L375:
+	LD H, D
+L376:
+	LD BC, (L3194:24)
+L377:
+	LD (XWA+82:8), W
+L378:
+	LDA XIZ, (XIX+36)
+L379:
+	LD XIZ, L378
+L380:
+	LD A, 61
+L381:
+	LD L, L
+L382:
+	LD W, (XWA+B)
+L383:
+	LD (XWA+B), IZ
+L384:
+	LD IX, (XIY+14305:16)
+L385:
+	LD H, B
+L386:
+	LD E, 209
+L387:
+	LD (-XBC), HL
+L388:
+	LD HL, 32378
+L389:
+	LD B, D
+L390:
+	LD XDE, (L2198)
+L391:
+	LD W, 44
+L392:
+	LD DE, (-XIX)
+L393:
+	LD W, C
+L394:
+	LD A, L
+L395:
+	LD HL, (L2050:24)
+L396:
+	LD E, 77
+L397:
+	LD L, L
+L398:
+	LD XHL, L396
+L399:
+	LD L, (XIZ+23745:16)
+L400:
+	LD XIZ, (BIGREG)
+L401:
+	LD A, 7
+L402:
+	LD (XIX+2156), E
+L403:
+	LD (XWA+BC), L
+L404:
+	LD BC, (L404)
+L405:
+	LD HL, 51113
+L406:
+	LD (BIGREG), IY
+L407:
+	LD IY, (XWA+)
+L408:
+	LD XDE, (-XIY)
+L409:
+	LD A, C
+L410:
+	LD D, H
+L411:
+	LD XIZ, (XIX-2)
+L412:
+	LD A, C
+L413:
+	LD (FAR), IX
+L414:
+	LDA XIY, (XIX+83)
+L415:
+	LD E, W
+L416:
+	LD C, 177
+L417:
+	LD W, 116
+L418:
+	LD IY, (XBC+0)
+L419:
+	LD XDE, L422
+L420:
+	LD D, L
+L421:
+	LD IZ, (P0)
+L422:
+	LD XHL, L420
+L423:
+	LD XWA, L423
+L424:
+	LD D, (XBC)
+L425:
+	LD A, L
+L426:
+	LD XIY, L426
+L427:
+	LD XIY, L423
+L428:
+	LD DE, 24109
+L429:
+	LD HL, 1540
+L430:
+	LD (L431), W
+L431:
+	LD B, 118
+L432:
+	LD XBC, (XDE+51:8)
+L433:
+	LD IX, 20439
+L434:
+	LD XIZ, (XIY+92:8)
+L435:
+	LD WA, 64940
+L436:
+	LD E, W
+L437:
+	LDA XIY, (XIX+9)
+L438:
+	LDA XWA, (XIX+91)
+L439:
+	LD XDE, (XWA)
+L440:
+	LDA XIZ, (XIX+95)
+L441:
+	LD E, C
+L442:
+	LD XIX, L443
+L443:
+	LD (XDE+81:8), B
+L444:
+	LD E, 239
+L445:
+	LD D, 190
+L446:
+	LDA XDE, (XIX+93)
+L447:
+	LD L, (XWA+)
+L448:
+	LD WA, (-XIX)
+L449:
+	LDA XIZ, (XIX+48)
+L450:
+	LD XWA, (L449)
+L451:
+	LD XIY, L452
+L452:
+	LD XDE, (XIX+1997)
+L453:
+	LDA XHL, (XIX+68)
+L454:
+	LD E, A
+L455:
+	LD XIY, (XIX+1549)
+L456:
+	LD C, E
+L457:
+	LD (L455), D
+L458:
+	LD W, 20
+L459:
+	LD A, 83
+L460:
+	LDA XBC, (XIX+51)
+L461:
+	LD C, 12
+L462:
+	LD HL, 58267
+L463:
+	LD A, A
+L464:
+	LD WA, (L462:24)
+L465:
+	LD XHL, L468
+L466:
+	LD XIX, L463
+L467:
+	LD XIY, L470
+L468:
+	LD XWA, (XHL)
+L469:
+	LD IX, 22556
+L470:
+	LD IZ, (P0)
+L471:
+	LD W, 125
+L472:
+	LD H, 9
+L473:
+	LD D, E
+L474:
+	LD XIZ, L472
+L475:
+	LD C, W
+L476:
+	LDA XHL, (XIX+80)
+L477:
+	LD B, 215
+L478:
+	LDA XWA, (XIX+82)
+L479:
+	LD BC, 35994
+L480:
+	LD XIY, L479
+L481:
+	LD A, A
+L482:
+	LD (XHL+91:8), IZ
+L483:
+	LD (FAR), E
+L484:
+	LD BC, (XWA+B)
+L485:
+	LD IY, 99
+L486:
+	LD XIY, (XBC+66)
+L487:
+	LD XHL, (-XHL)
+L488:
+	LD (XIY+10:8), IY
+L489:
+	LD XWA, (XWA+B)
+L490:
+	LD XIY, (L487)
+L491:
+	LD IX, (-XBC)
+L492:
+	LD H, 251
+L493:
+	LD H, 24
+L494:
+	LD (XWA+BC), H
+L495:
+	LD XIZ, L494
+L496:
+	LD (XIY+12358:16), IX
+L497:
+	LD IX, (XHL+6953:16)
+L498:
+	LD XBC, (L4703)
+L499:
+	LD E, 174
+L500:
+	LD XBC, L1730
+L501:
+	LD B, (L501)
+L502:
+	LDA XWA, (XIX+76)
+L503:
+	LD (L506), A
+L504:
+	LD XHL, L501
+L505:
+	LD BC, (XBC)
+L506:
+	LD IZ, 34100
+L507:
+	LD D, D
+L508:
+	LD XBC, L4011
+L509:
+	LDA XIZ, (XIX+59)
+L510:
+	LD (XDE+67), IY
+L511:
+	LD XDE, L510
+L512:
+	LD D, C
+L513:
+	LDA XIX, (XIX+90)
+L514:
+	LD H, 226
+L515:
+	LD H, 62
+L516:
+	LD XHL, L2657
+L517:
+	LD L, B
+L518:
+	LD XHL, (XWA+BC)
+L519:
+	LD XWA, (XWA+111:8)
+L520:
+	LD IX, 49782
+L521:
+	LD XIZ, L519
+L522:
+	LD (XDE+12826:16), WA
+L523:
+	LDA XIX, (XIX+66)
+L524:
+	LD E, 208
+L525:
+	LD D, 103
+L526:
+	LD XBC, (XIZ+15222:16)
+L527:
+	LD IZ, 20700
+L528:
+	LD IX, (L524:24)
+L529:
+	LD XWA, (L529)
+L530:
+	LD IX, (XWA+)
+L531:
+	LD (XIZ+93:8), IZ
+L532:
+	LD (-XIZ), D
+L533:
+	LD XBC, (XIY+60)
+L534:
+	LD W, A
+L535:
+	LDA XBC, (XIX+100)
+L536:
+	LD XIY, (-XBC)
+L537:
+	LDA XIX, (XIX+5)
+L538:
+	LD (XIZ-34), IY
+L539:
+	LD XWA, (XIZ)
+L540:
+	LDA XWA, (XIX+63)
+L541:
+	LD (XDE+27), WA
+L542:
+	LD IY, 19277
+L543:
+	LD B, B
+L544:
+	LDA XWA, (XIX+78)
+L545:
+	LD E, H
+L546:
+	LD XHL, L546
+L547:
+	LD E, W
+L548:
+	LD IZ, 544
+L549:
+	LD (XIX+), A
+L550:
+	LD HL, 3512
+L551:
+	LD IX, (XIZ+8325:16)
+L552:
+	LD IZ, (XWA+21)
+L553:
+	LD XBC, L549
+L554:
+	LDA XIZ, (XIX+49)
+L555:
+	LD XIZ, (L553:24)
+L556:
+	LD D, L
+L557:
+	LD XIX, L4565
+L558:
+	LD XIX, L562
+L559:
+	LD A, 58
+L560:
+	LD XIX, (XHL)
+L561:
+	LD (XIX+1201), C
+L562:
+	LD IX, 48099
+L563:
+	LD DE, 50010
+L564:
+	LD XDE, L4882
+L565:
+	LD W, C
+L566:
+	LD IZ, (L4108)
+L567:
+	LD XBC, (L568)
+L568:
+	LD L, D
+L569:
+	LD XBC, (XWA+7472:16)
+L570:
+	LD W, 209
+L571:
+	LD B, (XWA+12988:16)
+L572:
+	LDA XBC, (XIX+78)
+L573:
+	LD B, (L576)
+L574:
+	LD D, 239
+L575:
+	LD XHL, L3070
+L576:
+	LDA XIX, (XIX+60)
+L577:
+	LD WA, 42723
+L578:
+	LD (XIX+1481), C
+L579:
+	LDA XWA, (XIX+4)
+L580:
+	LD B, W
+L581:
+	LD D, C
+L582:
+	LD XIY, L584
+L583:
+	LD (-XBC), IZ
+L584:
+	LD B, L
+L585:
+	LD XBC, L588
+L586:
+	LD XIY, (XIZ+)
+L587:
+	LD H, (XIX+2868)
+L588:
+	LD E, (L587:24)
+L589:
+	LD XIX, (-XIX)
+L590:
+	LD DE, (XWA+B)
+L591:
+	LD E, L
+L592:
+	LDA XDE, (XIX+40)
+L593:
+	LD HL, 25109
+L594:
+	LD XHL, (XIX-40)
+L595:
+	LD XWA, L563
+L596:
+	LD XDE, (XIZ-57)
+L597:
+	LD A, 42
+L598:
+	LD IZ, 15439
+L599:
+	LD HL, (FAR)
+L600:
+	LD A, W
+L601:
+	LD E, L
+L602:
+	LDA XIY, (XIX+76)
+L603:
+	LD C, H
+L604:
+	LDA XWA, (XIX+80)
+L605:
+	LD (XDE+), D
+L606:
+	LD WA, (XIZ+25351:16)
+L607:
+	LD H, B
+L608:
+	LD H, 198
+L609:
+	LD XIX, L114
+L610:
+	LD L, 150
+L611:
+	LD WA, 20231
+L612:
+	LD DE, 11515
+L613:
+	LD IY, 46369
+L614:
+	LD DE, (XIZ+71:8)
+L615:
+	LDA XIZ, (XIX+30)
+L616:
+	LDA XIZ, (XIX+10)
+L617:
+	LD E, 148
+L618:
+	LD XIZ, (XIX+1853)
+L619:
+	LD XDE, L622
+L620:
+	LD IY, 53121
+L621:
+	LD XIY, L3701
+L622:
+	LD XIZ, L620
+L623:
+	LDA XIX, (XIX+15)
+L624:
+	LD XHL, (XIX+1688)
+L625:
+	LD XIZ, (L627)
+L626:
+	LD XIY, L2578
+L627:
+	LD H, 189
+L628:
+	LD D, 192
+L629:
+	LD XIX, L632
+L630:
+	LD L, W
+L631:
+	LD XDE, (-XWA)
+L632:
+	LD D, 14
+L633:
+	LD IX, 43888
+L634:
+	LD XIX, (XWA+BC)
+L635:
+	LD XHL, L631
+L636:
+	LD XBC, L632
+L637:
+	LD E, 126
+L638:
+	LD (XIZ+), WA
+L639:
+	LD A, E
+L640:
+	LD XBC, L2786
+L641:
+	LD BC, (XIX+23459:16)
+L642:
+	LD L, H
+L643:
+	LD IX, 49635
+L644:
+	LD B, L
+L645:
+	LDA XWA, (XIX+71)
+L646:
+	LD XIZ, (XWA+B)
+L647:
+	LD (XWA+85), IX
+L648:
+	LD DE, 30167
+L649:
+	LD C, (XBC+117:8)
+L650:
+	LD XIX, (L647)
+L651:
+	LD XIZ, L654
+L652:
+	LD XWA, (XIX+538)
+L653:
+	LD XIZ, (XIX+20568:16)
+L654:
+	LD C, 123
+L655:
+	LD XWA, (XIZ+)
+L656:
+	LD XWA, L2660
+L657:
+	LD BC, 17260
+L658:
+	LD XIX, L661
+L659:
+	LD IY, 57399
+L660:
+	LD XIY, L3529
+L661:
+	LD A, 96
+L662:
+	LD (XIZ+5331:16), D
+L663:
+	LDA XIX, (XIX+74)
+L664:
+	LD A, H
+L665:
+	LD L, W
+L666:
+	LD XIX, (L670)
+L667:
+	LD C, B
+L668:
+	LD WA, (XIZ-12)
+L669:
+	LDA XDE, (XIX+67)
+L670:
+	LD WA, 50302
+L671:
+	LD B, 89
+L672:
+	LD L, 134
+L673:
+	LD A, (-XHL)
+L674:
+	LD W, B
+L675:
+	LD A, 207
+L676:
+	LDA XIZ, (XIX+59)
+L677:
+	LD XBC, L680
+L678:
+	LD H, A
+L679:
+	LD A, (XIX+284)
+L680:
+	LD XHL, (XIY+)
+L681:
+	LD BC, 21915
+L682:
+	LD H, (XDE+25)
+L683:
+	LD (XIX+665), DE
+L684:
+	LDA XDE, (XIX+57)
+L685:
+	LD W, 71
+L686:
+	LD XIY, L2902
+L687:
+	LD XBC, (XBC)
+L688:
+	LD D, W
+L689:
+	LD XIX, (L693:24)
+L690:
+	LD WA, 64316
+L691:
+	LD A, 40
+L692:
+	LD XDE, L689
+L693:
+	LD L, (XBC-2)
+L694:
+	LD XHL, (XWA+B)
+L695:
+	LD IZ, 57428
+L696:
+	LD (L700:24), E
+L697:
+	LDA XIY, (XIX+17)
+L698:
+	LD XBC, (XIX-47)
+L699:
+	LDA XHL, (XIX+87)
+L700:
+	LD XWA, L700
+L701:
+	LD (-XIZ), L
+L702:
+	LDA XHL, (XIX+36)
+L703:
+	LD D, (L704:24)
+L704:
+	LD (XHL-16), HL
+L705:
+	LD DE, (XHL+)
+L706:
+	LD XIX, (L704:24)
+L707:
+	LD (BIGREG), BC
+L708:
+	LD XIX, L707
+L709:
+	LD D, W
+L710:
+	LD H, C
+L711:
+	LD WA, 61703
+L712:
+	LD W, 187
+L713:
+	LD IX, 26388
+L714:
+	LDA XBC, (XIX+27)
+L715:
+	LD A, E
+L716:
+	LD H, 107
+L717:
+	LD XIY, (XWA+B)
+L718:
+	LD L, 121
+L719:
+	LD B, 177
+L720:
+	LD BC, (XIX+25:8)
+L721:
+	LD (P0), H
+L722:
+	LD L, H
+L723:
+	LD XIZ, L722
+L724:
+	LD XIY, (L721)
+L725:
+	LD C, 62
+L726:
+	LD XIX, (XIX+1808)
+L727:
+	LDA XWA, (XIX+100)
+L728:
+	LDA XIY, (XIX+78)
+L729:
+	LDA XIY, (XIX+40)
+L730:
+	LD W, 63
+L731:
+	LDA XBC, (XIX+13)
+L732:
+	LD C, W
+L733:
+	LD L, A
+L734:
+	LD E, 124
+L735:
+	LD W, 120
+L736:
+	LD A, (P0)
+L737:
+	LD A, D
+L738:
+	LD XHL, L738
+L739:
+	LDA XBC, (XIX+38)
+L740:
+	LD H, D
+L741:
+	LDA XIY, (XIX+51)
+L742:
+	LD E, 91
+L743:
+	LD XIY, L4551
+L744:
+	LD H, 54
+L745:
+	LD E, (XWA+73)
+L746:
+	LD DE, 11055
+L747:
+	LD H, 141
+L748:
+	LD D, W
+L749:
+	LD L, (L747:24)
+L750:
+	LD XIZ, (XIX+249)
+L751:
+	LD HL, 25513
+L752:
+	LD XHL, (L755)
+L753:
+	LD H, C
+L754:
+	LD XIX, (-XDE)
+L755:
+	LD C, 119
+L756:
+	LD D, 5
+L757:
+	LD W, C
+L758:
+	LD XWA, (XIX+2200)
+L759:
+	LD IX, 35133
+L760:
+	LD XWA, (XWA-98)
+L761:
+	LD IY, (BIGREG)
+L762:
+	LD XBC, (XIY-88)
+L763:
+	LD (XBC+57), L
+L764:
+	LD B, 186
+L765:
+	LD HL, (BIGREG)
+L766:
+	LD XIZ, L770
+L767:
+	LD (XHL+5054:16), IY
+L768:
+	LD (L767), IX
+L769:
+	LDA XIX, (XIX+16)
+L770:
+	LD IX, (L2358:24)
+L771:
+	LD XIY, L771
+L772:
+	LD XWA, (XWA+BC)
+L773:
+	LD (XWA+B), DE
+L774:
+	LD XBC, L777
+L775:
+	LD BC, (L776:24)
+L776:
+	LD (XWA+B), L
+L777:
+	LD C, 134
+L778:
+	LD XBC, L775
+L779:
+	LD D, D
+L780:
+	LD XHL, L780
+L781:
+	LDA XHL, (XIX+11)
+L782:
+	LD XHL, (-XIZ)
+L783:
+	LD A, (XIZ+43:8)
+L784:
+	LD XBC, L1293
+L785:
+	LD HL, 58732
+L786:
+	LD C, 83
+L787:
+	LD D, (XBC+25:8)
+L788:
+	LD H, (XIY+)
+L789:
+	LD L, D
+L790:
+	LD L, L
+L791:
+	LD XIZ, L805
+L792:
+	LD XHL, (XDE+11325:16)
+L793:
+	LD L, C
+L794:
+	LD B, 193
+L795:
+	LD B, 74
+L796:
+	LD XIY, (-XIY)
+L797:
+	LD A, 152
+L798:
+	LD WA, 62693
+L799:
+	LD H, H
+L800:
+	LD C, A
+L801:
+	LDA XIX, (XIX+51)
+L802:
+	LDA XDE, (XIX+72)
+L803:
+	LD XIZ, (FAR)
+L804:
+	LD (XIX+2824), H
+L805:
+	LD XIX, (XIX+2219)
+L806:
+	LD DE, 6784
+L807:
+	LD A, L
+L808:
+	LD XWA, (L806:24)
+L809:
+	LD (L813), W
+L810:
+	LD E, E
+L811:
+	LD E, W
+L812:
+	LD XIY, L2336
+L813:
+	LD XWA, (-XIX)
+L814:
+	LD IX, 2830
+L815:
+	LD XIZ, L812
+L816:
+	LD XBC, L819
+L817:
+	LD A, (XWA-48)
+L818:
+	LD W, (XWA+66:8)
+L819:
+	LD (XIZ), IY
+L820:
+	LD DE, 37656
+L821:
+	LD XIZ, L825
+L822:
+	LD L, D
+L823:
+	LD XIZ, (-XWA)
+L824:
+	LD IY, (-XIZ)
+L825:
+	LD IY, 17255
+L826:
+	LD XIX, L3310
+L827:
+	LD L, C
+L828:
+	LD (XWA+111:8), BC
+L829:
+	LD (XWA+B), IZ
+L830:
+	LD D, B
+L831:
+	LD (XBC-58), BC
+L832:
+	LD A, 211
+L833:
+	LD H, C
+L834:
+	LD IZ, 64280
+L835:
+	LD L, 85
+L836:
+	LD A, (XIY+38)
+L837:
+	LD BC, (-XDE)
+L838:
+	LDA XWA, (XIX+94)
+L839:
+	LD H, 80
+L840:
+	LD XHL, L844
+L841:
+	LD H, 124
+L842:
+	LDA XIX, (XIX+92)
+L843:
+	LD H, 205
+L844:
+	LD (XIZ+), L
+L845:
+	LDA XHL, (XIX+96)
+L846:
+	LD XHL, (BIGREG)
+L847:
+	LD XIY, L847
+L848:
+	LD XDE, L231
+L849:
+	LD WA, 11120
+L850:
+	LD W, B
+L851:
+	LD H, (XIY+26656:16)
+L852:
+	LD D, (FAR)
+L853:
+	LD L, (L2672:24)
+L854:
+	LD C, (XIX)
+L855:
+	LDA XIZ, (XIX+18)
+L856:
+	LD L, A
+L857:
+	LD XIZ, L861
+L858:
+	LD XWA, (XWA+BC)
+L859:
+	LD (XWA+BC), H
+L860:
+	LD C, 0
+L861:
+	LD XBC, (XWA+B)
+L862:
+	LD E, C
+L863:
+	LD XDE, L867
+L864:
+	LD IY, 42130
+L865:
+	LD A, H
+L866:
+	LDA XIY, (XIX+47)
+L867:
+	LD (XIZ+112:8), C
+L868:
+	LD XIX, (XIY-8)
+L869:
+	LD HL, (L867:24)
+L870:
+	LD H, 109
+L871:
+	LD HL, 65080
+L872:
+	LDA XDE, (XIX+84)
+L873:
+	LDA XIY, (XIX+97)
+L874:
+	LD XBC, L2153
+L875:
+	LD (XWA+BC), DE
+L876:
+	LD D, 160
+L877:
+	LD L, E
+L878:
+	LDA XIZ, (XIX+29)
+L879:
+	LD XWA, (L879:24)
+L880:
+	LD BC, (XIY+)
+L881:
+	LD IX, 6517
+L882:
+	LD XIY, L886
+L883:
+	LD DE, (XWA+BC)
+L884:
+	LD B, L
+L885:
+	LD (XIX+), WA
+L886:
+	LD DE, 4629
+L887:
+	LD XIX, L886
+L888:
+	LD XDE, L29
+L889:
+	LD HL, (XHL+20654:16)
+L890:
+	LD (XWA+BC), HL
+L891:
+	LD E, 179
+L892:
+	LDA XDE, (XIX+35)
+L893:
+	LD L, (XIX+943)
+L894:
+	LD XIX, L890
+L895:
+	LD IZ, 20248
+L896:
+	LD (XWA+B), IZ
+L897:
+	LD H, 163
+L898:
+	LD A, 200
+L899:
+	LDA XHL, (XIX+84)
+L900:
+	LD XHL, L896
+L901:
+	LD H, 163
+L902:
+	LD (XIY+14689:16), IZ
+L903:
+	LDA XWA, (XIX+78)
+L904:
+	LD (XIZ+80:8), IX
+L905:
+	LD H, A
+L906:
+	LD B, W
+L907:
+	LDA XHL, (XIX+6)
+L908:
+	LD DE, 39821
+L909:
+	LD B, 12
+L910:
+	LD XIY, (XIZ+19:8)
+L911:
+	LDA XHL, (XIX+97)
+L912:
+	LD (XIY+82), BC
+L913:
+	LD IZ, (XIZ+)
+L914:
+	LD D, A
+L915:
+	LD B, C
+L916:
+	LD XHL, (XIX+2387)
+L917:
+	LD (XIX+2402), B
+L918:
+	LDA XBC, (XIX+0)
+L919:
+	LD E, (XWA+50)
+L920:
+	LD HL, 20515
+L921:
+	LD H, 145
+L922:
+	LDA XDE, (XIX+6)
+L923:
+	LD XIZ, L173
+L924:
+	LD (XDE-78), H
+L925:
+	LD E, H
+L926:
+	LD WA, 57029
+L927:
+	LD HL, 60883
+L928:
+	LD B, 180
+L929:
+	LD A, 255
+L930:
+	LD DE, (L933)
+L931:
+	LD D, H
+L932:
+	LD IY, 28444
+L933:
+	LD E, 22
+L934:
+	LD DE, (L937:24)
+L935:
+	LD XHL, (XHL)
+L936:
+	LD XIX, (XHL)
+L937:
+	LD XDE, L3371
+L938:
+	LD D, 169
+L939:
+	LD WA, 4629
+L940:
+	LD B, 214
+L941:
+	LD W, (XIY+13705:16)
+L942:
+	LD W, 203
+L943:
+	LD HL, 41970
+L944:
+	LD XBC, L947
+L945:
+	LD (L942), HL
+L946:
+	LD XIY, (XIY+)
+L947:
+	LD E, H
+L948:
+	LD XWA, (BIGREG)
+L949:
+	LD C, A
+L950:
+	LD IY, 30970
+L951:
+	LD XIZ, L948
+L952:
+	LD XIX, (L953:24)
+L953:
+	LD C, (XIX-73)
+L954:
+	LD L, 90
+L955:
+	LD XIY, L955
+L956:
+	LD D, 137
+L957:
+	LD XIY, (XWA+17790:16)
+L958:
+	LD D, (XIY)
+L959:
+	LD E, D
+L960:
+	LD B, C
+L961:
+	LD B, 73
+L962:
+	LDA XDE, (XIX+56)
+L963:
+	LD XDE, (XHL-88)
+L964:
+	LD (L823), B
+L965:
+	LD L, 72
+L966:
+	LD B, E
+L967:
+	LD HL, 55240
+L968:
+	LD L, (BIGREG)
+L969:
+	LDA XBC, (XIX+9)
+L970:
+	LD XWA, L967
+L971:
+	LDA XHL, (XIX+54)
+L972:
+	LD XBC, L973
+L973:
+	LD W, 27
+L974:
+	LD (XHL+89), C
+L975:
+	LD XIX, L977
+L976:
+	LD XIX, (XIX+109:8)
+L977:
+	LD XIY, L978
+L978:
+	LD W, W
+L979:
+	LD (XHL+36:8), W
+L980:
+	LD XHL, L983
+L981:
+	LDA XBC, (XIX+82)
+L982:
+	LD XIZ, (BIGREG)
+L983:
+	LDA XIY, (XIX+18)
+L984:
+	LD A, 230
+L985:
+	LD DE, (L986:24)
+L986:
+	LD BC, 32720
+L987:
+	LD C, L
+L988:
+	LD IY, (XHL)
+L989:
+	LDA XDE, (XIX+10)
+L990:
+	LD A, 111
+L991:
+	LD XIX, (XIZ+39:8)
+L992:
+	LD (XIX+620), DE
+L993:
+	LD XIY, (L994)
+L994:
+	LD (XWA+BC), C
+L995:
+	LD D, W
+L996:
+	LD (XHL), C
+L997:
+	LD WA, 46199
+L998:
+	LDA XWA, (XIX+62)
+L999:
+	LD (XBC+12), BC
+L1000:
+	LDA XBC, (XIX+46)
+L1001:
+	LD XHL, L4862
+L1002:
+	LD L, 164
+L1003:
+	LD C, 11
+L1004:
+	LD XDE, (XIY+23504:16)
+L1005:
+	LD H, H
+L1006:
+	LD (L1004:24), WA
+L1007:
+	LD B, C
+L1008:
+	LD IX, 57226
+L1009:
+	LD A, (L1009:24)
+L1010:
+	LD H, 157
+L1011:
+	LD (XIX+1098), DE
+L1012:
+	LD WA, 15389
+L1013:
+	LD H, 140
+L1014:
+	LD HL, (BIGREG)
+L1015:
+	LD C, B
+L1016:
+	LD IX, (-XHL)
+L1017:
+	LD E, (XDE+)
+L1018:
+	LD XIX, L1022
+L1019:
+	LD (-XDE), D
+L1020:
+	LD BC, (XIY+15068:16)
+L1021:
+	LD XBC, L1020
+L1022:
+	LD L, (XIX+115:8)
+L1023:
+	LD C, W
+L1024:
+	LDA XIX, (XIX+97)
+L1025:
+	LD XIX, L1025
+L1026:
+	LD W, A
+L1027:
+	LD XHL, (XDE+)
+L1028:
+	LD (XIX+2593), L
+L1029:
+	LD (L1028:24), L
+L1030:
+	LD L, 172
+L1031:
+	LD C, (XIY-70)
+L1032:
+	LDA XHL, (XIX+74)
+L1033:
+	LD XIZ, L2579
+L1034:
+	LD A, 193
+L1035:
+	LD A, (XIY+)
+L1036:
+	LDA XWA, (XIX+7)
+L1037:
+	LD W, (L2928:24)
+L1038:
+	LD W, 98
+L1039:
+	LD IZ, 46484
+L1040:
+	LD BC, 49154
+L1041:
+	LD IZ, 39112
+L1042:
+	LD (-XIZ), W
+L1043:
+	LD E, (L1046:24)
+L1044:
+	LD DE, (XIZ+26)
+L1045:
+	LD E, 111
+L1046:
+	LD L, (XWA+B)
+L1047:
+	LD C, E
+L1048:
+	LDA XBC, (XIX+14)
+L1049:
+	LD (BIGREG), IZ
+L1050:
+	LD IY, 16118
+L1051:
+	LD W, 119
+L1052:
+	LD XIX, (XIX+39:8)
+L1053:
+	LD IZ, 35104
+L1054:
+	LD B, 201
+L1055:
+	LD BC, (XIX+22441:16)
+L1056:
+	LD DE, (XWA+B)
+L1057:
+	LD (XDE), IX
+L1058:
+	LD D, 178
+L1059:
+	LD W, W
+L1060:
+	LD W, C
+L1061:
+	LDA XIY, (XIX+24)
+L1062:
+	LD A, C
+L1063:
+	LD (XIX-51), H
+L1064:
+	LD W, 56
+L1065:
+	LD A, A
+L1066:
+	LD IY, (L2323:24)
+L1067:
+	LD XIZ, (XIY+50)
+L1068:
+	LD XIY, (XWA+BC)
+L1069:
+	LD H, 65
+L1070:
+	LD XBC, (XIX+2985)
+L1071:
+	LDA XWA, (XIX+84)
+L1072:
+	LD IZ, (-XIY)
+L1073:
+	LD XIZ, L1074
+L1074:
+	LD H, H
+L1075:
+	LD IY, 44760
+L1076:
+	LD XWA, L1079
+L1077:
+	LD XBC, L1077
+L1078:
+	LD IY, 17447
+L1079:
+	LD XIZ, (XIX+41)
+L1080:
+	LDA XDE, (XIX+84)
+L1081:
+	LD XIX, (XIZ)
+L1082:
+	LD (L1078:24), IX
+L1083:
+	LD XIZ, L1080
+L1084:
+	LDA XBC, (XIX+59)
+L1085:
+	LD (XBC), IZ
+L1086:
+	LD B, C
+L1087:
+	LD IX, 12149
+L1088:
+	LD D, 108
+L1089:
+	LD XDE, (XWA+78)
+L1090:
+	LD XDE, (XIZ+102:8)
+L1091:
+	LDA XIZ, (XIX+41)
+L1092:
+	LD C, 98
+L1093:
+	LD D, (XIY+14735:16)
+L1094:
+	LD DE, 7150
+L1095:
+	LD WA, 48535
+L1096:
+	LD A, C
+L1097:
+	LD IZ, 21976
+L1098:
+	LD L, L
+L1099:
+	LD XHL, L4485
+L1100:
+	LD H, B
+L1101:
+	LD XIZ, L1105
+L1102:
+	LD (L1099), BC
+L1103:
+	LD BC, 61903
+L1104:
+	LD XIY, (L1104)
+L1105:
+	LD H, 226
+L1106:
+	LD (XIX+1313), DE
+L1107:
+	LD DE, 6547
+L1108:
+	LD A, 218
+L1109:
+	LD XIY, (L1113:24)
+L1110:
+	LDA XIZ, (XIX+35)
+L1111:
+	LD XIZ, L62
+L1112:
+	LD XDE, (XDE+64)
+L1113:
+	LD L, 28
+L1114:
+	LD IX, 26014
+L1115:
+	LD DE, 37369
+L1116:
+	LD IX, 12679
+L1117:
+	LD WA, (P0)
+L1118:
+	LD XBC, (XWA+BC)
+L1119:
+	LD C, B
+L1120:
+	LD XIY, (XHL)
+L1121:
+	LD XIY, (-XBC)
+L1122:
+	LD L, (XIX+11103:16)
+L1123:
+	LD XHL, L1127
+L1124:
+	LD XIZ, L1122
+L1125:
+	LD XWA, (XIX+32)
+L1126:
+	LD XBC, L1124
+L1127:
+	LD XIZ, (XDE-59)
+L1128:
+	LD XHL, L1128
+L1129:
+	LD (XHL+7:8), B
+L1130:
+	LDA XDE, (XIX+94)
+L1131:
+	LDA XIX, (XIX+1)
+L1132:
+	LD (P0), L
+L1133:
+	LD (XWA), IZ
+L1134:
+	LD (XIX), HL
+L1135:
+	LD E, 185
+L1136:
+	LD C, 172
+L1137:
+	LDA XDE, (XIX+93)
+L1138:
+	LD XDE, (L1140)
+L1139:
+	LDA XDE, (XIX+16)
+L1140:
+	LD C, E
+L1141:
+	LD XHL, (XHL-6)
+L1142:
+	LD (XWA+), WA
+L1143:
+	LD XWA, (XWA+B)
+L1144:
+	LDA XIX, (XIX+68)
+L1145:
+	LD W, B
+L1146:
+	LD C, E
+L1147:
+	LDA XIZ, (XIX+99)
+L1148:
+	LD XDE, L52
+L1149:
+	LD B, 24
+L1150:
+	LD A, 149
+L1151:
+	LD W, C
+L1152:
+	LDA XHL, (XIX+10)
+L1153:
+	LD (L1156), IY
+L1154:
+	LD (XHL-96), BC
+L1155:
+	LD IX, 40958
+L1156:
+	LD IX, 34463
+L1157:
+	LD A, C
+L1158:
+	LDA XIZ, (XIX+13)
+L1159:
+	LD IX, 38593
+L1160:
+	LD E, 63
+L1161:
+	LD XIX, L1158
+L1162:
+	LDA XWA, (XIX+81)
+L1163:
+	LD B, (XHL+113:8)
+L1164:
+	LD XIZ, (XWA-84)
+L1165:
+	LD XBC, (L3071:24)
+L1166:
+	LD A, H
+L1167:
+	LD XIX, (XWA-60)
+L1168:
+	LD IX, 65504
+L1169:
+	LD BC, 25946
+L1170:
+	LD IZ, 41909
+L1171:
+	LD E, 81
+L1172:
+	LD B, (L1354)
+L1173:
+	LD (XIZ+59:8), D
+L1174:
+	LD XDE, L3017
+L1175:
+	LD (XWA+B), L
+L1176:
+	LD E, (L4931:24)
+L1177:
+	LD (XIX+), IZ
+L1178:
+	LD XBC, L3105
+L1179:
+	LD C, A
+L1180:
+	LDA XIY, (XIX+53)
+L1181:
+	LD IX, 8683
+L1182:
+	LD (XBC+27436:16), D
+L1183:
+	LD W, L
+L1184:
+	LD XIX, L1184
+L1185:
+	LD (XDE+26:8), WA
+L1186:
+	LD IZ, (XIX+666)
+L1187:
+	LD (XIZ+97:8), WA
+L1188:
+	LD WA, 4263
+L1189:
+	LD B, (XIX+97:8)
+L1190:
+	LD E, 53
+L1191:
+	LD E, (XIX-90)
+L1192:
+	LD XHL, (XIZ)
+L1193:
+	LD D, W
+L1194:
+	LD C, 217
+L1195:
+	LD (XIY+98), BC
+L1196:
+	LD WA, 30000
+L1197:
+	LD XDE, (XHL+)
+L1198:
+	LD XBC, (XDE+82)
+L1199:
+	LD H, C
+L1200:
+	LD XBC, L1198
+L1201:
+	LD IX, (XDE+51:8)
+L1202:
+	LD IX, 42320
+L1203:
+	LD IX, 60983
+L1204:
+	LD A, H
+L1205:
+	LDA XBC, (XIX+56)
+L1206:
+	LD XIY, L1206
+L1207:
+	LD IX, (L1211)
+L1208:
+	LD IY, 50273
+L1209:
+	LD BC, (XIX+1301)
+L1210:
+	LD (BIGREG), HL
+L1211:
+	LD XWA, (XIZ+)
+L1212:
+	LD C, W
+L1213:
+	LD XIZ, (XWA-92)
+L1214:
+	LD L, H
+L1215:
+	LD B, (XIZ+8)
+L1216:
+	LD XDE, (XHL+)
+L1217:
+	LD IY, 64155
+L1218:
+	LD IZ, 41336
+L1219:
+	LD HL, (XWA+BC)
+L1220:
+	LD BC, 16424
+L1221:
+	LD (XIX+1642), H
+L1222:
+	LD XIX, L1058
+L1223:
+	LD H, D
+L1224:
+	LD H, (XWA+80:8)
+L1225:
+	LD XIY, L1223
+L1226:
+	LD XBC, L1224
+L1227:
+	LD XBC, (L4481:24)
+L1228:
+	LD C, 196
+L1229:
+	LD E, W
+L1230:
+	LD A, D
+L1231:
+	LD A, W
+L1232:
+	LD XIZ, L4909
+L1233:
+	LD IX, 64073
+L1234:
+	LD C, H
+L1235:
+	LD XBC, (P0)
+L1236:
+	LD W, L
+L1237:
+	LD XIX, (FAR)
+L1238:
+	LD IZ, 54122
+L1239:
+	LD (XIX+21955:16), IY
+L1240:
+	LD XIZ, (XHL+92)
+L1241:
+	LD (XDE+), C
+L1242:
+	LDA XWA, (XIX+47)
+L1243:
+	LD XWA, L1246
+L1244:
+	LD E, 11
+L1245:
+	LDA XBC, (XIX+85)
+L1246:
+	LD XBC, (L1242:24)
+L1247:
+	LD E, A
+L1248:
+	LD XHL, L4958
+L1249:
+	LD B, 61
+L1250:
+	LD XDE, (XHL-50)
+L1251:
+	LDA XDE, (XIX+25)
+L1252:
+	LD H, 18
+L1253:
+	LD (XIX+), W
+L1254:
+	LD XWA, (XIX+)
+L1255:
+	LD DE, 16317
+L1256:
+	LD B, L
+L1257:
+	LD D, (L1257)
+L1258:
+	LD XWA, L4389
+L1259:
+	LD HL, (XDE+24084:16)
+L1260:
+	LDA XHL, (XIX+66)
+L1261:
+	LD D, 201
+L1262:
+	LD (XWA+B), BC
+L1263:
+	LD XWA, L1264
+L1264:
+	LDA XHL, (XIX+17)
+L1265:
+	LD IZ, 29694
+L1266:
+	LD XIZ, (XWA+62:8)
+L1267:
+	LD D, 81
+L1268:
+	LD (L2388:24), HL
+L1269:
+	LD IY, 43287
+L1270:
+	LD XHL, (XIX-69)
+L1271:
+	LD XIZ, (BIGREG)
+L1272:
+	LD XWA, L1276
+L1273:
+	LD W, 149
+L1274:
+	LD XDE, (P0)
+L1275:
+	LD (XHL+91:8), W
+L1276:
+	LD XIZ, L1280
+L1277:
+	LD WA, 44021
+L1278:
+	LD (XIY+), C
+L1279:
+	LD WA, (XIZ+86)
+L1280:
+	LD HL, (XWA+55:8)
+L1281:
+	LD IZ, (XIX+51:8)
+L1282:
+	LDA XIX, (XIX+36)
+L1283:
+	LDA XWA, (XIX+59)
+L1284:
+	LD DE, (XBC+74)
+L1285:
+	LD XIX, (L1286)
+L1286:
+	LD (FAR), W
+L1287:
+	LD WA, (XIX)
+L1288:
+	LD (XDE), IY
+L1289:
+	LD (XIX+865), D
+L1290:
+	LD IX, 34959
+L1291:
+	LD (FAR), C
+L1292:
+	LD IZ, (-XHL)
+L1293:
+	LD IX, 54983
+L1294:
+	LDA XHL, (XIX+6)
+L1295:
+	LD D, D
+L1296:
+	LD D, 120
+L1297:
+	LD L, W
+L1298:
+	LD (L1296), IX
+L1299:
+	LD E, L
+L1300:
+	LDA XIZ, (XIX+9)
+L1301:
+	LD BC, 9300
+L1302:
+	LD IZ, 53623
+L1303:
+	LD W, 142
+L1304:
+	LDA XIY, (XIX+98)
+L1305:
+	LD XIZ, L1302
+L1306:
+	LD H, 47
+L1307:
+	LD (XIZ+20:8), WA
+L1308:
+	LD DE, (XIZ+25:8)
+L1309:
+	LD (XIX+2194), HL
+L1310:
+	LD DE, 39363
+L1311:
+	LD H, 172
+L1312:
+	LD DE, 27822
+L1313:
+	LDA XIZ, (XIX+2)
+L1314:
+	LD B, (L1314)
+L1315:
+	LD (FAR), IZ
+L1316:
+	LD XBC, (-XDE)
+L1317:
+	LD E, 62
+L1318:
+	LD HL, 1639
+L1319:
+	LD C, B
+L1320:
+	LD XIY, (XDE+63)
+L1321:
+	LD XWA, (XIX)
+L1322:
+	LD (L1326:24), BC
+L1323:
+	LD BC, 64369
+L1324:
+	LDA XHL, (XIX+36)
+L1325:
+	LD IX, 13403
+L1326:
+	LD H, 253
+L1327:
+	LD C, 86
+L1328:
+	LD HL, 49840
+L1329:
+	LDA XIX, (XIX+70)
+L1330:
+	LDA XDE, (XIX+54)
+L1331:
+	LD (XWA+B), A
+L1332:
+	LD DE, 12540
+L1333:
+	LD DE, (XDE-30)
+L1334:
+	LD A, E
+L1335:
+	LDA XHL, (XIX+93)
+L1336:
+	LD A, 31
+L1337:
+	LD C, 7
+L1338:
+	LD H, 151
+L1339:
+	LD E, 8
+L1340:
+	LDA XIZ, (XIX+8)
+L1341:
+	LD W, (XWA+BC)
+L1342:
+	LD XHL, L4700
+L1343:
+	LD W, 191
+L1344:
+	LD A, B
+L1345:
+	LD HL, 11000
+L1346:
+	LD BC, 64338
+L1347:
+	LDA XWA, (XIX+100)
+L1348:
+	LD XIZ, (XWA+9675:16)
+L1349:
+	LD IX, (XBC+78)
+L1350:
+	LD IY, 24760
+L1351:
+	LD IX, (XHL+21)
+L1352:
+	LD XIZ, L1350
+L1353:
+	LD E, 57
+L1354:
+	LD D, (L1352)
+L1355:
+	LD C, A
+L1356:
+	LD XDE, (XBC-19)
+L1357:
+	LD H, (XWA+B)
+L1358:
+	LDA XDE, (XIX+85)
+L1359:
+	LD XDE, (XBC+15691:16)
+L1360:
+	LD C, B
+L1361:
+	LD H, 142
+L1362:
+	LD IY, (P0)
+L1363:
+	LDA XIX, (XIX+82)
+L1364:
+	LD E, H
+L1365:
+	LDA XIY, (XIX+39)
+L1366:
+	LD WA, (P0)
+L1367:
+	LD H, (XIX+1695)
+L1368:
+	LD XWA, (XIX+42:8)
+L1369:
+	LD (XIZ+80:8), C
+L1370:
+	LD WA, 40050
+L1371:
+	LD W, 227
+L1372:
+	LD XDE, L2135
+L1373:
+	LD A, W
+L1374:
+	LDA XIX, (XIX+0)
+L1375:
+	LD XIX, L1379
+L1376:
+	LD IX, 54340
+L1377:
+	LD XBC, L1373
+L1378:
+	LD A, 102
+L1379:
+	LD L, (XIX+85)
+L1380:
+	LD BC, (XHL+92)
+L1381:
+	LD (XIZ), IX
+L1382:
+	LD H, L
+L1383:
+	LD H, 174
+L1384:
+	LD A, (-XWA)
+L1385:
+	LD D, 86
+L1386:
+	LD E, 44
+L1387:
+	LD B, 32
+L1388:
+	LD HL, 24479
+L1389:
+	LD XIX, L1389
+L1390:
+	LD IY, 48315
+L1391:
+	LD XIY, L1815
+L1392:
+	LD (XWA+13815:16), DE
+L1393:
+	LD D, D
+L1394:
+	LD (L1396), BC
+L1395:
+	LDA XWA, (XIX+14)
+L1396:
+	LD IZ, (XIY+86)
+L1397:
+	LDA XIX, (XIX+98)
+L1398:
+	LD A, D
+L1399:
+	LD XHL, L3471
+L1400:
+	LD XIX, L1404
+L1401:
+	LD (L346:24), B
+L1402:
+	LDA XWA, (XIX+90)
+L1403:
+	LDA XIY, (XIX+40)
+L1404:
+	LD XHL, (XIY+39:8)
+L1405:
+	LD WA, (XIZ+22509:16)
+L1406:
+	LD E, C
+L1407:
+	LD A, A
+L1408:
+	LD XDE, (XWA+BC)
+L1409:
+	LD E, B
+L1410:
+	LD A, E
+L1411:
+	LDA XIZ, (XIX+78)
+L1412:
+	LD A, (FAR)
+L1413:
+	LD XIX, (L1414:24)
+L1414:
+	LD (P0), IY
+L1415:
+	LDA XHL, (XIX+86)
+L1416:
+	LD B, L
+L1417:
+	LD IX, 10681
+L1418:
+	LD A, L
+L1419:
+	LD DE, 26196
+L1420:
+	LD XBC, (XIX+2488)
+L1421:
+	LD IY, 35628
+L1422:
+	LD XDE, L1426
+L1423:
+	LD C, 182
+L1424:
+	LD (XWA+19), B
+L1425:
+	LDA XDE, (XIX+31)
+L1426:
+	LD XWA, L1422
+L1427:
+	LD DE, 2127
+L1428:
+	LD L, 247
+L1429:
+	LD IY, 52302
+L1430:
+	LD C, B
+L1431:
+	LD (XBC+11:8), IY
+L1432:
+	LDA XBC, (XIX+97)
+L1433:
+	LD WA, (XBC+82)
+L1434:
+	LD DE, (XIX+1510)
+L1435:
+	LDA XIX, (XIX+78)
+L1436:
+	LDA XDE, (XIX+3)
+L1437:
+	LD XWA, (XIZ+)
+L1438:
+	LD (XIX), IX
+L1439:
+	LD IZ, 44537
+L1440:
+	LD IX, (-XWA)
+L1441:
+	LD (XWA+70), H
+L1442:
+	LD W, 16
+L1443:
+	LD XDE, (XWA+B)
+L1444:
+	LD HL, 62455
+L1445:
+	LD (XIY), IX
+L1446:
+	LD XIY, (XWA+BC)
+L1447:
+	LD XWA, (XIX)
+L1448:
+	LD H, C
+L1449:
+	LD W, 140
+L1450:
+	LD WA, (XIX+2065)
+L1451:
+	LD XBC, (XBC+25015:16)
+L1452:
+	LD B, D
+L1453:
+	LD BC, (XBC+49)
+L1454:
+	LD (XWA+55:8), HL
+L1455:
+	LD H, C
+L1456:
+	LD (XIY+6667:16), H
+L1457:
+	LD C, 203
+L1458:
+	LD (XIY-74), DE
+L1459:
+	LD XIZ, L1457
+L1460:
+	LD XHL, L1460
+L1461:
+	LD (-XIY), B
+L1462:
+	LD W, 3
+L1463:
+	LD XWA, (XWA+)
+L1464:
+	LD (XIX+), IY
+L1465:
+	LD (XWA+B), W
+L1466:
+	LD XIY, (L1467:24)
+L1467:
+	LD H, 195
+L1468:
+	LD DE, 36637
+L1469:
+	LDA XIY, (XIX+26)
+L1470:
+	LD DE, (XHL+4330:16)
+L1471:
+	LD IZ, 12875
+L1472:
+	LD C, E
+L1473:
+	LDA XHL, (XIX+89)
+L1474:
+	LD XDE, L1477
+L1475:
+	LD XBC, L1476
+L1476:
+	LD B, (XIX+1991)
+L1477:
+	LD L, L
+L1478:
+	LD IX, (L1477:24)
+L1479:
+	LD A, 191
+L1480:
+	LD DE, 31247
+L1481:
+	LD A, 56
+L1482:
+	LDA XWA, (XIX+74)
+L1483:
+	LD IZ, (XIX-50)
+L1484:
+	LDA XDE, (XIX+78)
+L1485:
+	LD C, E
+L1486:
+	LDA XIY, (XIX+57)
+L1487:
+	LD A, 54
+L1488:
+	LD XIX, L375
+L1489:
+	LD XIZ, (XIX-50)
+L1490:
+	LD (XBC), A
+L1491:
+	LD DE, 29217
+L1492:
+	LD W, B
+L1493:
+	LD XHL, (XIX)
+L1494:
+	LD XBC, L3459
+L1495:
+	LDA XIZ, (XIX+86)
+L1496:
+	LD XIY, L1498
+L1497:
+	LDA XHL, (XIX+21)
+L1498:
+	LD (XBC+18361:16), BC
+L1499:
+	LD IZ, 27514
+L1500:
+	LD (XIX+2102), E
+L1501:
+	LDA XHL, (XIX+17)
+L1502:
+	LD XHL, L1500
+L1503:
+	LD L, (XIX-22)
+L1504:
+	LD E, 36
+L1505:
+	LD IX, (XIY+21194:16)
+L1506:
+	LD XIY, (XWA+43)
+L1507:
+	LDA XIY, (XIX+31)
+L1508:
+	LD XIY, (L3379)
+L1509:
+	LD WA, (P0)
+L1510:
+	LD W, (XDE-73)
+L1511:
+	LD A, (XWA+17743:16)
+L1512:
+	LD L, B
+L1513:
+	LD DE, 6169
+L1514:
+	LD BC, (XIY+87)
+L1515:
+	LD E, L
+L1516:
+	LD XDE, L1516
+L1517:
+	LD XDE, L1513
+L1518:
+	LDA XDE, (XIX+37)
+L1519:
+	LD (XWA+B), E
+L1520:
+	LD W, (-XBC)
+L1521:
+	LD IZ, 36095
+L1522:
+	LD C, 26
+L1523:
+	LD XIX, L1932
+L1524:
+	LD XDE, (XBC+80)
+L1525:
+	LD L, (L1521)
+L1526:
+	LD XIY, L3709
+L1527:
+	LD E, A
+L1528:
+	LD B, D
+L1529:
+	LD (XWA+52:8), A
+L1530:
+	LD L, 119
+L1531:
+	LD D, A
+L1532:
+	LD E, 170
+L1533:
+	LD (L1536:24), W
+L1534:
+	LD (XDE+16), H
+L1535:
+	LD XIY, (XBC+70:8)
+L1536:
+	LD XDE, L1532
+L1537:
+	LD IX, 30872
+L1538:
+	LDA XBC, (XIX+64)
+L1539:
+	LDA XIZ, (XIX+93)
+L1540:
+	LD XWA, (XIX+)
+L1541:
+	LD HL, 9737
+L1542:
+	LD (FAR), WA
+L1543:
+	LD XBC, L1545
+L1544:
+	LD XIY, L1541
+L1545:
+	LD WA, 25932
+L1546:
+	LDA XWA, (XIX+34)
+L1547:
+	LD XIY, (XIY+28)
+L1548:
+	LD WA, (L1548:24)
+L1549:
+	LD D, 47
+L1550:
+	LD XIX, (L1554:24)
+L1551:
+	LD B, W
+L1552:
+	LD H, 212
+L1553:
+	LDA XWA, (XIX+63)
+L1554:
+	LDA XIX, (XIX+15)
+L1555:
+	LD HL, 16587
+L1556:
+	LDA XHL, (XIX+72)
+L1557:
+	LD W, C
+L1558:
+	LD IZ, 17487
+L1559:
+	LD L, 93
+L1560:
+	LDA XDE, (XIX+14)
+L1561:
+	LD (L1557), BC
+L1562:
+	LD (XIX+1415), DE
+L1563:
+	LD BC, (XHL)
+L1564:
+	LD E, 113
+L1565:
+	LDA XWA, (XIX+23)
+L1566:
+	LD A, 213
+L1567:
+	LDA XIZ, (XIX+86)
+L1568:
+	LDA XIX, (XIX+52)
+L1569:
+	LD (XIX+97), W
+L1570:
+	LD (L811:24), BC
+L1571:
+	LD HL, (L1573:24)
+L1572:
+	LD W, D
+L1573:
+	LD DE, 15691
+L1574:
+	LD B, 240
+L1575:
+	LD (XIY), IX
+L1576:
+	LD L, 1
+L1577:
+	LD XDE, (XDE)
+L1578:
+	LD D, 223
+L1579:
+	LD IX, (XIY+93:8)
+L1580:
+	LD L, W
+L1581:
+	LD XDE, (L1578)
+L1582:
+	LD IY, 53240
+L1583:
+	LD XBC, L1581
+L1584:
+	LD XIY, (L1580:24)
+L1585:
+	LD XWA, (XIX+535)
+L1586:
+	LD B, 55
+L1587:
+	LD XIX, L1586
+L1588:
+	LD B, 61
+L1589:
+	LD XHL, L1585
+L1590:
+	LD (XBC+5744:16), D
+L1591:
+	LDA XIX, (XIX+91)
+L1592:
+	LD XBC, L1596
+L1593:
+	LD C, 213
+L1594:
+	LDA XIZ, (XIX+72)
+L1595:
+	LD XIX, L422
+L1596:
+	LDA XIX, (XIX+6)
+L1597:
+	LDA XBC, (XIX+33)
+L1598:
+	LD W, W
+L1599:
+	LD XIX, L1600
+L1600:
+	LD WA, 41190
+L1601:
+	LD C, 111
+L1602:
+	LD IY, 13883
+L1603:
+	LD A, C
+L1604:
+	LD XWA, L1604
+L1605:
+	LD A, 23
+L1606:
+	LD IY, 45064
+L1607:
+	LD XIX, (P0)
+L1608:
+	LD XWA, (XIY+34)
+L1609:
+	LD XDE, (BIGREG)
+L1610:
+	LD XIZ, L4506
+L1611:
+	LD W, 203
+L1612:
+	LD IZ, (XIX+2430)
+L1613:
+	LDA XWA, (XIX+45)
+L1614:
+	LD XIX, L1614
+L1615:
+	LD XDE, (XWA+BC)
+L1616:
+	LD B, L
+L1617:
+	LD A, (XWA)
+L1618:
+	LD A, (-XBC)
+L1619:
+	LD XIY, L1617
+L1620:
+	LD (XWA+BC), H
+L1621:
+	LDA XDE, (XIX+96)
+L1622:
+	LD WA, (XIX+1289)
+L1623:
+	LD XDE, L1626
+L1624:
+	LD (XBC+), H
+L1625:
+	LD (XIY+86), IX
+L1626:
+	LD WA, 27152
+L1627:
+	LD C, B
+L1628:
+	LD XIZ, (XDE+51)
+L1629:
+	LD XBC, L1631
+L1630:
+	LD XIY, L2022
+L1631:
+	LD XIX, L1628
+L1632:
+	LD WA, 16995
+L1633:
+	LDA XIY, (XIX+9)
+L1634:
+	LD DE, 40637
+L1635:
+	LD D, B
+L1636:
+	LDA XIY, (XIX+32)
+L1637:
+	LD IX, 62589
+L1638:
+	LD XIX, L1636
+L1639:
+	LD XBC, L4382
+L1640:
+	LD IY, 8589
+L1641:
+	LD IX, 46639
+L1642:
+	LD IX, (XDE-30)
+L1643:
+	LDA XDE, (XIX+7)
+L1644:
+	LDA XHL, (XIX+29)
+L1645:
+	LD W, 179
+L1646:
+	LD A, 129
+L1647:
+	LD IX, (L1643)
+L1648:
+	LD D, (XWA+847:16)
+L1649:
+	LD WA, 35272
+L1650:
+	LD L, C
+L1651:
+	LD XIZ, (L1652)
+L1652:
+	LD (XIX+1211), DE
+L1653:
+	LD DE, (XWA+B)
+L1654:
+	LD IY, (XBC+6138:16)
+L1655:
+	LD XDE, L1656
+L1656:
+	LD A, W
+L1657:
+	LD H, (XIX+1890)
+L1658:
+	LD XWA, (XIZ+)
+L1659:
+	LD (FAR), WA
+L1660:
+	LD BC, 12239
+L1661:
+	LD XDE, (XIX+679)
+L1662:
+	LDA XIY, (XIX+93)
+L1663:
+	LD XIZ, (XWA+16530:16)
+L1664:
+	LD IX, (XIY+26)
+L1665:
+	LD (XIX+75), W
+L1666:
+	LD (XIY+), W
+L1667:
+	LD HL, 37942
+L1668:
+	LD L, 93
+L1669:
+	LD L, 57
+L1670:
+	LD A, (-XIY)
+L1671:
+	LD XHL, (XIX+901)
+L1672:
+	LD XDE, (L3772)
+L1673:
+	LDA XDE, (XIX+88)
+L1674:
+	LD D, L
+L1675:
+	LD XHL, (-XBC)
+L1676:
+	LD A, 158
+L1677:
+	LD BC, (XIY+48)
+L1678:
+	LD XHL, L1674
+L1679:
+	LD XIZ, (FAR)
+L1680:
+	LD (XDE+1), B
+L1681:
+	LD L, D
+L1682:
+	LD B, (XDE)
+L1683:
+	LD (XDE+15), BC
+L1684:
+	LD C, 127
+L1685:
+	LD XIZ, L1687
+L1686:
+	LD XHL, (XIZ+51)
+L1687:
+	LDA XIX, (XIX+44)
+L1688:
+	LD (XHL+75:8), C
+L1689:
+	LD IX, (L1692:24)
+L1690:
+	LD W, 250
+L1691:
+	LD W, H
+L1692:
+	LD XIZ, L1624
+L1693:
+	LD D, 192
+L1694:
+	LDA XIY, (XIX+11)
+L1695:
+	LD D, H
+L1696:
+	LDA XIX, (XIX+0)
+L1697:
+	LD (XWA+B), H
+L1698:
+	LD WA, 33690
+L1699:
+	LD BC, 189
+L1700:
+	LD XIX, (XHL+)
+L1701:
+	LD C, W
+L1702:
+	LD (P0), C
+L1703:
+	LDA XHL, (XIX+56)
+L1704:
+	LD XIY, (P0)
+L1705:
+	LDA XWA, (XIX+58)
+L1706:
+	LD HL, 26323
+L1707:
+	LD IY, 42277
+L1708:
+	LD (L1711:24), L
+L1709:
+	LD XHL, (XIX+888)
+L1710:
+	LD XWA, L1876
+L1711:
+	LD XIY, (XIX+)
+L1712:
+	LDA XIY, (XIX+75)
+L1713:
+	LDA XBC, (XIX+94)
+L1714:
+	LD (XWA+B), BC
+L1715:
+	LD XIX, (XIX+1745)
+L1716:
+	LD XIY, L1716
+L1717:
+	LD C, (XWA+111:8)
+L1718:
+	LD IY, (XIY+29)
+L1719:
+	LD D, E
+L1720:
+	LD XIZ, (XWA+18978:16)
+L1721:
+	LD (XDE+20174:16), D
+L1722:
+	LD XHL, L1723
+L1723:
+	LD IX, 30942
+L1724:
+	LD D, 195
+L1725:
+	LD A, D
+L1726:
+	LD D, A
+L1727:
+	LDA XIX, (XIX+54)
+L1728:
+	LD XWA, (XBC+22807:16)
+L1729:
+	LD B, 82
+L1730:
+	LDA XHL, (XIX+97)
+L1731:
+	LD (L1728:24), C
+L1732:
+	LD (XIZ-18), IX
+L1733:
+	LD L, H
+L1734:
+	LD IY, (XIY+111:8)
+L1735:
+	LD IY, 28635
+L1736:
+	LD H, L
+L1737:
+	LD (L1741), HL
+L1738:
+	LDA XWA, (XIX+18)
+L1739:
+	LD XWA, (XHL)
+L1740:
+	LD (P0), BC
+L1741:
+	LD XIY, (BIGREG)
+L1742:
+	LD L, 253
+L1743:
+	LD H, B
+L1744:
+	LD DE, 45367
+L1745:
+	LD XBC, L2775
+L1746:
+	LD (XIY+), IY
+L1747:
+	LD L, B
+L1748:
+	LD (XIX+2563), A
+L1749:
+	LD E, (XDE-99)
+L1750:
+	LD XBC, L2295
+L1751:
+	LD B, D
+L1752:
+	LD W, 115
+L1753:
+	LD B, 181
+L1754:
+	LD E, L
+L1755:
+	LD A, 255
+L1756:
+	LD IZ, (L1759:24)
+L1757:
+	LD (-XBC), L
+L1758:
+	LD D, 201
+L1759:
+	LDA XDE, (XIX+24)
+L1760:
+	LD (XWA+20:8), W
+L1761:
+	LD H, 79
+L1762:
+	LDA XIZ, (XIX+31)
+L1763:
+	LD L, E
+L1764:
+	LD C, C
+L1765:
+	LD IZ, 27616
+L1766:
+	LD A, (XIX+3712:16)
+L1767:
+	LD XIX, (L1766)
+L1768:
+	LD XBC, (XIZ)
+L1769:
+	LD W, W
+L1770:
+	LD XHL, L38
+L1771:
+	LD XWA, L1771
+L1772:
+	LD A, 198
+L1773:
+	LD BC, 40588
+L1774:
+	LD IY, 14525
+L1775:
+	LD HL, 26039
+L1776:
+	LD L, (BIGREG)
+L1777:
+	LD XIZ, L1774
+L1778:
+	LD (L1775), WA
+L1779:
+	LD BC, 63971
+L1780:
+	LD C, E
+L1781:
+	LD HL, 52932
+L1782:
+	LD A, B
+L1783:
+	LD DE, 2756
+L1784:
+	LD XHL, L4045
+L1785:
+	LD XIZ, L1786
+L1786:
+	LD (XIX+27304:16), A
+L1787:
+	LD E, (XDE+104:8)
+L1788:
+	LD (L1791:24), D
+L1789:
+	LD IX, (XWA+B)
+L1790:
+	LD W, (XIY-64)
+L1791:
+	LDA XDE, (XIX+45)
+L1792:
+	LD A, (L1793:24)
+L1793:
+	LD D, 132
+L1794:
+	LD IX, 37741
+L1795:
+	LD E, 130
+L1796:
+	LD W, 161
+L1797:
+	LD XBC, L1795
+L1798:
+	LD (XIX+1646), IZ
+L1799:
+	LD (XIX+27115:16), IX
+L1800:
+	LD DE, (P0)
+L1801:
+	LD XBC, (XIZ+113:8)
+L1802:
+	LD DE, 14194
+L1803:
+	LD XDE, L4798
+L1804:
+	LDA XBC, (XIX+12)
+L1805:
+	LD L, (FAR)
+L1806:
+	LD XIZ, (BIGREG)
+L1807:
+	LD C, 89
+L1808:
+	LD DE, (-XIZ)
+L1809:
+	LD W, (BIGREG)
+L1810:
+	LD (-XHL), BC
+L1811:
+	LD E, 127
+L1812:
+	LD C, L
+L1813:
+	LD XDE, (BIGREG)
+L1814:
+	LD (XDE-69), IY
+L1815:
+	LD XBC, L1816
+L1816:
+	LDA XBC, (XIX+96)
+L1817:
+	LD (XIY+93:8), B
+L1818:
+	LD WA, 25586
+L1819:
+	LD BC, (XWA+BC)
+L1820:
+	LD C, 86
+L1821:
+	LDA XDE, (XIX+4)
+L1822:
+	LD IZ, 29694
+L1823:
+	LD C, 248
+L1824:
+	LD XIZ, (XDE+85)
+L1825:
+	LD XIX, L1824
+L1826:
+	LD XHL, L1825
+L1827:
+	LD A, 30
+L1828:
+	LD (XIZ+), HL
+L1829:
+	LD (XWA+24:8), BC
+L1830:
+	LD XIX, L2114
+L1831:
+	LD XIZ, (XIY)
+L1832:
+	LD XIZ, (XIY-81)
+L1833:
+	LD L, E
+L1834:
+	LD W, A
+L1835:
+	LD E, L
+L1836:
+	LD (XHL+), IX
+L1837:
+	LD BC, 1265
+L1838:
+	LDA XIZ, (XIX+12)
+L1839:
+	LDA XIZ, (XIX+67)
+L1840:
+	LD (XWA+B), DE
+L1841:
+	LD A, 152
+L1842:
+	LDA XWA, (XIX+14)
+L1843:
+	LD XWA, L1844
+L1844:
+	LD XWA, L1844
+L1845:
+	LD E, B
+L1846:
+	LD B, (L1844)
+L1847:
+	LD WA, 18559
+L1848:
+	LDA XIX, (XIX+9)
+L1849:
+	LD W, D
+L1850:
+	LD L, 242
+L1851:
+	LDA XHL, (XIX+54)
+L1852:
+	LD HL, 24530
+L1853:
+	LD DE, 51263
+L1854:
+	LD IX, 46581
+L1855:
+	LD BC, 8149
+L1856:
+	LDA XWA, (XIX+39)
+L1857:
+	LD (-XIX), W
+L1858:
+	LD DE, 45563
+L1859:
+	LD HL, 21069
+L1860:
+	LDA XDE, (XIX+49)
+L1861:
+	LDA XIY, (XIX+17)
+L1862:
+	LDA XDE, (XIX+10)
+L1863:
+	LD A, 160
+L1864:
+	LD (XIZ+30:8), C
+L1865:
+	LD XIY, (XIY)
+L1866:
+	LD XIX, (XIX+1000)
+L1867:
+	LD L, (-XIY)
+L1868:
+	LDA XIY, (XIX+17)
+L1869:
+	LDA XWA, (XIX+73)
+L1870:
+	LD XHL, L4995
+L1871:
+	LD E, 172
+L1872:
+	LD (XDE+23735:16), HL
+L1873:
+	LD H, H
+L1874:
+	LDA XWA, (XIX+44)
+L1875:
+	LD H, E
+L1876:
+	LD XBC, (L1880:24)
+L1877:
+	LD E, (XWA+)
+L1878:
+	LD XBC, L1879
+L1879:
+	LD C, H
+L1880:
+	LD XHL, (XWA+)
+L1881:
+	LD WA, 64663
+L1882:
+	LD B, 178
+L1883:
+	LD XWA, L1882
+L1884:
+	LD BC, 51102
+L1885:
+	LD XHL, (L644)
+L1886:
+	LD (FAR), IX
+L1887:
+	LD XIZ, (XDE+)
+L1888:
+	LDA XIY, (XIX+23)
+L1889:
+	LDA XWA, (XIX+96)
+L1890:
+	LD IX, 37619
+L1891:
+	LD (-XBC), E
+L1892:
+	LD E, 247
+L1893:
+	LD (XHL), IZ
+L1894:
+	LD XDE, L1891
+L1895:
+	LD IZ, (XBC)
+L1896:
+	LD XWA, (XWA)
+L1897:
+	LD HL, (FAR)
+L1898:
+	LDA XHL, (XIX+64)
+L1899:
+	LD L, 46
+L1900:
+	LD W, 52
+L1901:
+	LD (-XWA), B
+L1902:
+	LDA XIX, (XIX+40)
+L1903:
+	LD XHL, L1903
+L1904:
+	LDA XIX, (XIX+24)
+L1905:
+	LD IZ, (XIY+24)
+L1906:
+	LD L, B
+L1907:
+	LD DE, (XIZ+2)
+L1908:
+	LD A, 183
+L1909:
+	LD A, A
+L1910:
+	LD (XBC+77), D
+L1911:
+	LD XDE, L1914
+L1912:
+	LD C, B
+L1913:
+	LD W, (XHL-73)
+L1914:
+	LD WA, 59186
+L1915:
+	LD WA, 26756
+L1916:
+	LD XDE, L1857
+L1917:
+	LD XDE, (-XDE)
+L1918:
+	LD XIX, L1915
+L1919:
+	LDA XDE, (XIX+93)
+L1920:
+	LDA XIY, (XIX+20)
+L1921:
+	LD XIZ, (XHL-35)
+L1922:
+	LD XHL, L1920
+L1923:
+	LDA XHL, (XIX+85)
+L1924:
+	LD XBC, L2633
+L1925:
+	LD B, D
+L1926:
+	LDA XIY, (XIX+81)
+L1927:
+	LD XHL, (XDE+8052:16)
+L1928:
+	LD BC, (L1926)
+L1929:
+	LD E, C
+L1930:
+	LDA XDE, (XIX+19)
+L1931:
+	LDA XIZ, (XIX+43)
+L1932:
+	LD (XWA+B), W
+L1933:
+	LD B, 239
+L1934:
+	LD D, 7
+L1935:
+	LD (L1932:24), DE
+L1936:
+	LD B, 168
+L1937:
+	LD E, C
+L1938:
+	LD IX, (XIX+15812:16)
+L1939:
+	LD (FAR), B
+L1940:
+	LD XIZ, L1941
+L1941:
+	LD HL, 25492
+L1942:
+	LD XIZ, (XWA)
+L1943:
+	LD H, B
+L1944:
+	LDA XIY, (XIX+51)
+L1945:
+	LDA XBC, (XIX+7)
+L1946:
+	LD (XDE+57), IY
+L1947:
+	LDA XDE, (XIX+69)
+L1948:
+	LD C, 237
+L1949:
+	LD (L1951:24), W
+L1950:
+	LDA XBC, (XIX+19)
+L1951:
+	LD HL, 40337
+L1952:
+	LD XIX, L4991
+L1953:
+	LD IY, 20263
+L1954:
+	LDA XBC, (XIX+75)
+L1955:
+	LD (L1952:24), HL
+L1956:
+	LDA XDE, (XIX+95)
+L1957:
+	LD XIZ, (XWA+B)
+L1958:
+	LD XIZ, (XHL-27)
+L1959:
+	LD XHL, L1956
+L1960:
+	LDA XIZ, (XIX+83)
+L1961:
+	LD XDE, (L1959)
+L1962:
+	LD W, 206
+L1963:
+	LD DE, 52889
+L1964:
+	LD (L4934:24), DE
+L1965:
+	LD L, 21
+L1966:
+	LD D, W
+L1967:
+	LDA XIY, (XIX+85)
+L1968:
+	LD XIX, (XWA+)
+L1969:
+	LD XDE, L1965
+L1970:
+	LDA XIZ, (XIX+76)
+L1971:
+	LD (XIX+66), H
+L1972:
+	LD (L717:24), W
+L1973:
+	LD L, (XBC+25227:16)
+L1974:
+	LDA XBC, (XIX+28)
+L1975:
+	LD B, L
+L1976:
+	LD A, D
+L1977:
+	LDA XHL, (XIX+58)
+L1978:
+	LD (XHL+40), IZ
+L1979:
+	LD BC, 8792
+L1980:
+	LD W, 195
+L1981:
+	LD XIX, (XIZ+)
+L1982:
+	LD (XIX+912), WA
+L1983:
+	LD DE, (XBC+34)
+L1984:
+	LD W, H
+L1985:
+	LD XWA, (XIX+)
+L1986:
+	LD (XDE-54), L
+L1987:
+	LD L, (BIGREG)
+L1988:
+	LDA XIY, (XIX+26)
+L1989:
+	LD XIZ, L1989
+L1990:
+	LD XDE, (XDE+)
+L1991:
+	LD H, 224
+L1992:
+	LD C, 20
+L1993:
+	LD H, 107
+L1994:
+	LD C, E
+L1995:
+	LDA XIY, (XIX+69)
+L1996:
+	LD XWA, (XWA+BC)
+L1997:
+	LD WA, 38267
+L1998:
+	LD XIX, L2002
+L1999:
+	LD H, H
+L2000:
+	LD IZ, (L1451:24)
+L2001:
+	LD HL, 62219
+L2002:
+	LD (L1998), W
+L2003:
+	LD (XWA+), E
+L2004:
+	LD (-XDE), IY
+L2005:
+	LDA XWA, (XIX+42)
+L2006:
+	LD WA, 64377
+L2007:
+	LD WA, 6986
+L2008:
+	LD XDE, (XIZ+34)
+L2009:
+	LD (-XHL), IY
+L2010:
+	LD XDE, (XWA+BC)
+L2011:
+	LD H, D
+L2012:
+	LD IX, (XIZ+30)
+L2013:
+	LD XIZ, L2016
+L2014:
+	LD (XHL+21722:16), IY
+L2015:
+	LD XWA, (XIX+357)
+L2016:
+	LD (FAR), E
+L2017:
+	LD IY, 21930
+L2018:
+	LD XBC, (BIGREG)
+L2019:
+	LD B, (L2022:24)
+L2020:
+	LD C, 201
+L2021:
+	LD XIZ, L3362
+L2022:
+	LDA XHL, (XIX+80)
+L2023:
+	LD L, 137
+L2024:
+	LDA XDE, (XIX+4)
+L2025:
+	LD W, (XIX+)
+L2026:
+	LD XIY, L2023
+L2027:
+	LD XBC, L2026
+L2028:
+	LD E, W
+L2029:
+	LD XDE, L2028
+L2030:
+	LD D, (XIX+25:8)
+L2031:
+	LDA XIZ, (XIX+26)
+L2032:
+	LD BC, (XWA+12:8)
+L2033:
+	LD XIX, (-XIX)
+L2034:
+	LD (XWA), W
+L2035:
+	LD XIZ, (XIZ)
+L2036:
+	LD (XIX+15752:16), IZ
+L2037:
+	LD D, W
+L2038:
+	LD XWA, (L2041)
+L2039:
+	LD BC, 34493
+L2040:
+	LD A, 66
+L2041:
+	LD XIY, L3075
+L2042:
+	LD E, (L2043:24)
+L2043:
+	LD (XDE+4030:16), BC
+L2044:
+	LD W, 246
+L2045:
+	LD H, L
+L2046:
+	LD BC, 45237
+L2047:
+	LD IZ, 49586
+L2048:
+	LD B, B
+L2049:
+	LD C, B
+L2050:
+	LD XWA, (XIX+1545)
+L2051:
+	LD XDE, (XWA+23370:16)
+L2052:
+	LD (XWA+69), D
+L2053:
+	LD W, (L2057:24)
+L2054:
+	LD IZ, 19573
+L2055:
+	LD (XBC), W
+L2056:
+	LD C, H
+L2057:
+	LD B, D
+L2058:
+	LDA XIZ, (XIX+49)
+L2059:
+	LD H, 167
+L2060:
+	LD WA, (L2058)
+L2061:
+	LDA XIX, (XIX+99)
+L2062:
+	LD L, (XIY+)
+L2063:
+	LD A, 37
+L2064:
+	LDA XBC, (XIX+57)
+L2065:
+	LD D, A
+L2066:
+	LD XIX, L2067
+L2067:
+	LDA XBC, (XIX+75)
+L2068:
+	LD D, W
+L2069:
+	LD (XWA+32), L
+L2070:
+	LD XBC, L2068
+L2071:
+	LD XWA, L2068
+L2072:
+	LD (BIGREG), A
+L2073:
+	LD XIX, (XDE+49:8)
+L2074:
+	LDA XIY, (XIX+61)
+L2075:
+	LD XHL, L2071
+L2076:
+	LD (XWA+B), IZ
+L2077:
+	LD IZ, (BIGREG)
+L2078:
+	LD L, 150
+L2079:
+	LD (XIY+13:8), DE
+L2080:
+	LD XIX, (P0)
+L2081:
+	LD C, A
+L2082:
+	LD (XHL-53), L
+L2083:
+	LD E, (XWA+B)
+L2084:
+	LD (XIX-62), BC
+L2085:
+	LD E, 30
+L2086:
+	LD A, E
+L2087:
+	LD IZ, (FAR)
+L2088:
+	LD (-XIX), W
+L2089:
+	LDA XHL, (XIX+18)
+L2090:
+	LDA XDE, (XIX+62)
+L2091:
+	LDA XIZ, (XIX+36)
+L2092:
+	LD DE, 10119
+L2093:
+	LD E, 224
+L2094:
+	LD A, 251
+L2095:
+	LD IX, 62984
+L2096:
+	LD C, 57
+L2097:
+	LD L, 117
+L2098:
+	LD BC, 27070
+L2099:
+	LDA XHL, (XIX+99)
+L2100:
+	LD C, A
+L2101:
+	LD XIX, (XIX+4798:16)
+L2102:
+	LD H, 2
+L2103:
+	LD L, A
+L2104:
+	LD XIY, L2108
+L2105:
+	LD IY, (XWA+19:8)
+L2106:
+	LD (L574), C
+L2107:
+	LD IY, 10169
+L2108:
+	LD XDE, (XBC)
+L2109:
+	LD (-XWA), A
+L2110:
+	LDA XBC, (XIX+42)
+L2111:
+	LD BC, 52409
+L2112:
+	LD L, C
+L2113:
+	LD A, 241
+L2114:
+	LD IZ, (XIX+28:8)
+L2115:
+	LD XBC, (XIZ+65:8)
+L2116:
+	LDA XIX, (XIX+57)
+L2117:
+	LD (XIY+13), HL
+L2118:
+	LD (XIX+), B
+L2119:
+	LD HL, 28270
+L2120:
+	LD HL, 46573
+L2121:
+	LD XDE, L2122
+L2122:
+	LD XIZ, L2122
+L2123:
+	LDA XIX, (XIX+72)
+L2124:
+	LD A, B
+L2125:
+	LD L, 121
+L2126:
+	LD E, D
+L2127:
+	LD (L2131:24), A
+L2128:
+	LD (-XWA), C
+L2129:
+	LD A, 160
+L2130:
+	LD IY, (XIX+2696)
+L2131:
+	LD (L2133), WA
+L2132:
+	LDA XIX, (XIX+99)
+L2133:
+	LD B, A
+L2134:
+	LDA XIY, (XIX+76)
+L2135:
+	LD XDE, (XBC+98:8)
+L2136:
+	LD (XIX+232), D
+L2137:
+	LD XWA, (XIZ)
+L2138:
+	LD D, 197
+L2139:
+	LD D, 140
+L2140:
+	LD XHL, L3891
+L2141:
+	LDA XIZ, (XIX+47)
+L2142:
+	LD D, 215
+L2143:
+	LD WA, (XWA+B)
+L2144:
+	LD D, L
+L2145:
+	LD A, (-XHL)
+L2146:
+	LDA XWA, (XIX+25)
+L2147:
+	LD (XDE), W
+L2148:
+	LD IX, (XIY+119:8)
+L2149:
+	LD D, 121
+L2150:
+	LD H, W
+L2151:
+	LDA XBC, (XIX+38)
+L2152:
+	LD (L2154), W
+L2153:
+	LDA XWA, (XIX+8)
+L2154:
+	LD D, 239
+L2155:
+	LD L, E
+L2156:
+	LD XHL, (XBC+)
+L2157:
+	LD IY, (XIX+3:8)
+L2158:
+	LD XDE, (XWA+115:8)
+L2159:
+	LD E, B
+L2160:
+	LD C, 16
+L2161:
+	LD W, 233
+L2162:
+	LD BC, (XBC-43)
+L2163:
+	LD XDE, L2162
+L2164:
+	LD XWA, (P0)
+L2165:
+	LD XDE, L2165
+L2166:
+	LD BC, (XIZ-78)
+L2167:
+	LD (XWA+B), H
+L2168:
+	LD XIZ, L2165
+L2169:
+	LD XIY, L2165
+L2170:
+	LDA XDE, (XIX+33)
+L2171:
+	LD XIY, (-XIX)
+L2172:
+	LD XWA, L858
+L2173:
+	LD DE, 61759
+L2174:
+	LDA XDE, (XIX+89)
+L2175:
+	LDA XIX, (XIX+16)
+L2176:
+	LD (-XWA), WA
+L2177:
+	LDA XHL, (XIX+33)
+L2178:
+	LD XIZ, (XIX+690)
+L2179:
+	LD B, D
+L2180:
+	LD B, (XIZ+58)
+L2181:
+	LD B, 124
+L2182:
+	LD IY, 40762
+L2183:
+	LDA XWA, (XIX+62)
+L2184:
+	LD XBC, (XIZ)
+L2185:
+	LDA XIY, (XIX+21)
+L2186:
+	LD DE, 766
+L2187:
+	LD (XWA-15), DE
+L2188:
+	LD (L1648), WA
+L2189:
+	LD E, W
+L2190:
+	LD IX, 21560
+L2191:
+	LD DE, (L2191)
+L2192:
+	LDA XIX, (XIX+64)
+L2193:
+	LDA XIY, (XIX+5)
+L2194:
+	LD (FAR), B
+L2195:
+	LD (XIY+5:8), BC
+L2196:
+	LD BC, 62040
+L2197:
+	LD H, W
+L2198:
+	LD (XDE), WA
+L2199:
+	LD DE, 28875
+L2200:
+	LD (-XIY), IZ
+L2201:
+	LD (L2204), B
+L2202:
+	LD WA, 2396
+L2203:
+	LDA XIZ, (XIX+28)
+L2204:
+	LD D, W
+L2205:
+	LD XHL, L2201
+L2206:
+	LD W, 13
+L2207:
+	LD (XBC+), C
+L2208:
+	LD XIY, (XDE+8:8)
+L2209:
+	LD B, (XIZ+18)
+L2210:
+	LD BC, 45967
+L2211:
+	LD XIX, (-XIZ)
+L2212:
+	LD XBC, L4583
+L2213:
+	LD HL, (XIX+1199)
+L2214:
+	LD XIX, L2216
+L2215:
+	LD L, E
+L2216:
+	LD WA, 57744
+L2217:
+	LDA XIZ, (XIX+44)
+L2218:
+	LD XIX, L2216
+L2219:
+	LD DE, (P0)
+L2220:
+	LD (XWA+), H
+L2221:
+	LD (FAR), A
+L2222:
+	LD XWA, L2223
+L2223:
+	LD L, 255
+L2224:
+	LD D, (XBC-77)
+L2225:
+	LD E, 7
+L2226:
+	LD L, C
+L2227:
+	LD H, 222
+L2228:
+	LDA XHL, (XIX+13)
+L2229:
+	LD A, 17
+L2230:
+	LD (XIX+239), B
+L2231:
+	LD IY, 6041
+L2232:
+	LDA XIY, (XIX+44)
+L2233:
+	LD DE, (XIX+1567)
+L2234:
+	LD (XBC+45:8), WA
+L2235:
+	LD C, 21
+L2236:
+	LD XBC, L2234
+L2237:
+	LDA XDE, (XIX+25)
+L2238:
+	LD XWA, L917
+L2239:
+	LD IZ, (XIY+10989:16)
+L2240:
+	LD (-XBC), W
+L2241:
+	LDA XIX, (XIX+11)
+L2242:
+	LD (-XIY), L
+L2243:
+	LD XIX, L3136
+L2244:
+	LD L, (XIY)
+L2245:
+	LD (L2245), HL
+L2246:
+	LD C, (L2250:24)
+L2247:
+	LDA XDE, (XIX+80)
+L2248:
+	LD L, D
+L2249:
+	LDA XIX, (XIX+22)
+L2250:
+	LD (XIX+835), B
+L2251:
+	LDA XHL, (XIX+36)
+L2252:
+	LD XWA, (XWA+)
+L2253:
+	LDA XBC, (XIX+90)
+L2254:
+	LD H, 1
+L2255:
+	LD WA, 18322
+L2256:
+	LDA XWA, (XIX+50)
+L2257:
+	LD C, (-XBC)
+L2258:
+	LD XIX, L2254
+L2259:
+	LD IX, 23752
+L2260:
+	LD A, 208
+L2261:
+	LDA XHL, (XIX+85)
+L2262:
+	LD XHL, (XIX+2233)
+L2263:
+	LDA XBC, (XIX+70)
+L2264:
+	LD A, H
+L2265:
+	LD E, (XIX+1780)
+L2266:
+	LD XIZ, L2267
+L2267:
+	LD D, A
+L2268:
+	LD XWA, (L2265:24)
+L2269:
+	LD XIY, L2273
+L2270:
+	LD (XDE+17), H
+L2271:
+	LD IX, 33795
+L2272:
+	LD IZ, 21496
+L2273:
+	LD E, D
+L2274:
+	LD (XIX+1593), A
+L2275:
+	LD (XIX+836), BC
+L2276:
+	LD (L2780:24), D
+L2277:
+	LD E, 150
+L2278:
+	LD IZ, (XWA-56)
+L2279:
+	LD (L2278:24), IX
+L2280:
+	LD XWA, L1962
+L2281:
+	LD (BIGREG), A
+L2282:
+	LDA XWA, (XIX+38)
+L2283:
+	LD (XIZ+8655:16), D
+L2284:
+	LD XDE, (-XWA)
+L2285:
+	LD B, 163
+L2286:
+	LD IZ, 59380
+L2287:
+	LD XHL, (-XIY)
+L2288:
+	LD XHL, L2290
+L2289:
+	LD (XWA+19933:16), D
+L2290:
+	LD HL, (L3695)
+L2291:
+	LD XIX, (L2289:24)
+L2292:
+	LD (XWA+), W
+L2293:
+	LD H, A
+L2294:
+	LD (BIGREG), B
+L2295:
+	LD IY, (XBC+89:8)
+L2296:
+	LD XIZ, L2299
+L2297:
+	LD HL, 33665
+L2298:
+	LD (L2294), D
+L2299:
+	LD IY, 55301
+L2300:
+	LD W, A
+L2301:
+	LDA XIX, (XIX+27)
+L2302:
+	LD IY, (L2303)
+L2303:
+	LDA XHL, (XIX+51)
+L2304:
+	LD XIZ, (XIX+515)
+L2305:
+	LD XWA, (-XHL)
+L2306:
+	LD (P0), A
+L2307:
+	LD XWA, (L2307:24)
+L2308:
+	LDA XHL, (XIX+97)
+L2309:
+	LD XDE, (L2311)
+L2310:
+	LDA XWA, (XIX+92)
+L2311:
+	LD (XIY+), WA
+L2312:
+	LD XBC, (XIY+108:8)
+L2313:
+	LD IX, 54946
+L2314:
+	LD (XWA+BC), D
+L2315:
+	LD BC, (XBC+)
+L2316:
+	LD XIZ, (BIGREG)
+L2317:
+	LD XHL, L2314
+L2318:
+	LD L, (L2316:24)
+L2319:
+	LD C, 134
+L2320:
+	LD C, (L3957:24)
+L2321:
+	LD XIX, L541
+L2322:
+	LD A, L
+L2323:
+	LDA XDE, (XIX+3)
+L2324:
+	LD XIX, L2325
+L2325:
+	LD DE, 13602
+L2326:
+	LD IY, 3473
+L2327:
+	LD C, (BIGREG)
+L2328:
+	LD IX, 32876
+L2329:
+	LD (XIZ+24322:16), L
+L2330:
+	LD (XIX+), D
+L2331:
+	LD XHL, (XDE+23111:16)
+L2332:
+	LD H, 203
+L2333:
+	LD XIX, (XDE-29)
+L2334:
+	LDA XDE, (XIX+64)
+L2335:
+	LDA XIX, (XIX+8)
+L2336:
+	LD DE, (XIZ-84)
+L2337:
+	LD (XDE-15), W
+L2338:
+	LDA XDE, (XIX+72)
+L2339:
+	LD IX, 24397
+L2340:
+	LDA XHL, (XIX+89)
+L2341:
+	LD IZ, 40124
+L2342:
+	LD XBC, L2338
+L2343:
+	LD XDE, (L2339)
+L2344:
+	LD W, 231
+L2345:
+	LD B, (XIX+2226)
+L2346:
+	LD XWA, L858
+L2347:
+	LD XBC, L2348
+L2348:
+	LD XIY, (BIGREG)
+L2349:
+	LD WA, 12683
+L2350:
+	LD H, 130
+L2351:
+	LD IY, 38078
+L2352:
+	LD (XIY-86), IX
+L2353:
+	LD IX, 2393
+L2354:
+	LD XHL, (XIY-65)
+L2355:
+	LD (XWA+45), A
+L2356:
+	LDA XBC, (XIX+65)
+L2357:
+	LD (XBC+), WA
+L2358:
+	LDA XHL, (XIX+32)
+L2359:
+	LD XDE, L2357
+L2360:
+	LD WA, (L2363:24)
+L2361:
+	LDA XWA, (XIX+9)
+L2362:
+	LD XHL, (XIY-14)
+L2363:
+	LD E, 111
+L2364:
+	LD (L2363:24), HL
+L2365:
+	LDA XDE, (XIX+97)
+L2366:
+	LD XDE, L2366
+L2367:
+	LD (XBC+48), BC
+L2368:
+	LD E, 197
+L2369:
+	LD XDE, L646
+L2370:
+	LD IY, 48955
+L2371:
+	LD IY, 55759
+L2372:
+	LD A, 48
+L2373:
+	LD B, 186
+L2374:
+	LD (XIZ+), H
+L2375:
+	LD XHL, L2373
+L2376:
+	LD DE, (XWA+B)
+L2377:
+	LD E, H
+L2378:
+	LD H, 88
+L2379:
+	LD XIX, L2377
+L2380:
+	LD IY, (XIY+32:8)
+L2381:
+	LD W, (XIX+)
+L2382:
+	LD XIX, L2381
+L2383:
+	LD IY, 55524
+L2384:
+	LD W, 191
+L2385:
+	LD D, 182
+L2386:
+	LD XIY, (XHL)
+L2387:
+	LD XDE, (XIZ+)
+L2388:
+	LD XIX, (XBC+25:8)
+L2389:
+	LDA XDE, (XIX+62)
+L2390:
+	LD IY, (-XWA)
+L2391:
+	LD XIZ, (-XIX)
+L2392:
+	LD B, L
+L2393:
+	LD XIX, L2390
+L2394:
+	LD B, 19
+L2395:
+	LD XIZ, (XIX+2630)
+L2396:
+	LD DE, 65389
+L2397:
+	LD D, 111
+L2398:
+	LD L, 140
+L2399:
+	LD (XHL+63:8), W
+L2400:
+	LD H, D
+L2401:
+	LD XIX, (L2398)
+L2402:
+	LD B, W
+L2403:
+	LD IX, 42770
+L2404:
+	LDA XIY, (XIX+26)
+L2405:
+	LD DE, (L2402:24)
+L2406:
+	LD B, (-XWA)
+L2407:
+	LD WA, (XIX+757)
+L2408:
+	LD XWA, (P0)
+L2409:
+	LD XHL, L2407
+L2410:
+	LD XHL, (XWA+B)
+L2411:
+	LD IX, (XWA+)
+L2412:
+	LD C, A
+L2413:
+	LD (XIX+1964:16), W
+L2414:
+	LDA XBC, (XIX+16)
+L2415:
+	LD XIZ, L2415
+L2416:
+	LD XWA, L2414
+L2417:
+	LDA XHL, (XIX+43)
+L2418:
+	LD D, E
+L2419:
+	LD E, H
+L2420:
+	LD A, 97
+L2421:
+	LD XIY, L2425
+L2422:
+	LD A, E
+L2423:
+	LD XBC, (XIX+56:8)
+L2424:
+	LD L, 60
+L2425:
+	LDA XBC, (XIX+80)
+L2426:
+	LD (-XIZ), BC
+L2427:
+	LD XDE, L2431
+L2428:
+	LD XWA, (P0)
+L2429:
+	LD L, 192
+L2430:
+	LD XHL, (L2429:24)
+L2431:
+	LD E, D
+L2432:
+	LD HL, (XWA+BC)
+L2433:
+	LD XIX, (XHL+)
+L2434:
+	LDA XIZ, (XIX+74)
+L2435:
+	LD (XHL), C
+L2436:
+	LD D, (-XBC)
+L2437:
+	LD XWA, (XIZ)
+L2438:
+	LD W, 205
+L2439:
+	LDA XBC, (XIX+58)
+L2440:
+	LD B, 88
+L2441:
+	LD (XIX+74), W
+L2442:
+	LD IX, 43952
+L2443:
+	LD C, C
+L2444:
+	LD E, D
+L2445:
+	LD W, E
+L2446:
+	LD L, H
+L2447:
+	LD DE, (L2446)
+L2448:
+	LD (XIX+108:8), IY
+L2449:
+	LD W, 31
+L2450:
+	LDA XIY, (XIX+94)
+L2451:
+	LD W, D
+L2452:
+	LDA XBC, (XIX+56)
+L2453:
+	LD XIZ, (XIZ+12)
+L2454:
+	LD XHL, (L2286)
+L2455:
+	LD E, 115
+L2456:
+	LD BC, (L2459)
+L2457:
+	LD XIY, (XIX+543)
+L2458:
+	LDA XIX, (XIX+24)
+L2459:
+	LD XWA, L2458
+L2460:
+	LD C, 41
+L2461:
+	LD IY, (XWA+B)
+L2462:
+	LD XHL, (L2461:24)
+L2463:
+	LD A, H
+L2464:
+	LD (XIY-73), HL
+L2465:
+	LD L, W
+L2466:
+	LD HL, 44302
+L2467:
+	LD IY, (XIX+2662)
+L2468:
+	LD XIY, L4530
+L2469:
+	LD C, 145
+L2470:
+	LD XIZ, (XDE+52)
+L2471:
+	LD XBC, (XIZ+)
+L2472:
+	LD L, (-XIZ)
+L2473:
+	LDA XIX, (XIX+24)
+L2474:
+	LD DE, 54036
+L2475:
+	LDA XBC, (XIX+9)
+L2476:
+	LDA XIZ, (XIX+77)
+L2477:
+	LD (XIX+1838), E
+L2478:
+	LD HL, 4267
+L2479:
+	LD BC, (-XIX)
+L2480:
+	LDA XWA, (XIX+68)
+L2481:
+	LD HL, 57237
+L2482:
+	LD XHL, (L2484)
+L2483:
+	LD B, (L2484:24)
+L2484:
+	LD XIY, L2486
+L2485:
+	LD C, 242
+L2486:
+	LD XHL, L2489
+L2487:
+	LDA XHL, (XIX+57)
+L2488:
+	LD C, H
+L2489:
+	LD D, B
+L2490:
+	LD XWA, (XIX+13)
+L2491:
+	LD XDE, (XIZ+16685:16)
+L2492:
+	LD H, 239
+L2493:
+	LD HL, 20709
+L2494:
+	LD (XHL+), HL
+L2495:
+	LDA XBC, (XIX+11)
+L2496:
+	LDA XWA, (XIX+82)
+L2497:
+	LD XIZ, (FAR)
+L2498:
+	LD HL, 29503
+L2499:
+	LDA XIY, (XIX+92)
+L2500:
+	LD DE, (XIX+584)
+L2501:
+	LD IZ, (XWA+B)
+L2502:
+	LD XIX, (-XDE)
+L2503:
+	LDA XBC, (XIX+76)
+L2504:
+	LD L, (XHL+5910:16)
+L2505:
+	LDA XIZ, (XIX+1)
+L2506:
+	LD (XHL+6), DE
+L2507:
+	LDA XWA, (XIX+32)
+L2508:
+	LDA XIX, (XIX+95)
+L2509:
+	LD W, 118
+L2510:
+	LD BC, 56642
+L2511:
+	LD (XIX), C
+L2512:
+	LD B, 102
+L2513:
+	LD WA, 50107
+L2514:
+	LD XIX, L4770
+L2515:
+	LD H, 145
+L2516:
+	LD IY, (XIZ+)
+L2517:
+	LDA XIX, (XIX+57)
+L2518:
+	LD H, 186
+L2519:
+	LD W, C
+L2520:
+	LD IZ, 36424
+L2521:
+	LD BC, (XWA+B)
+L2522:
+	LD IX, (FAR)
+L2523:
+	LD XIY, L2527
+L2524:
+	LD XHL, (L2521:24)
+L2525:
+	LDA XHL, (XIX+52)
+L2526:
+	LD XHL, (XIY)
+L2527:
+	LD C, (XIX)
+L2528:
+	LD (XIY-24), H
+L2529:
+	LD HL, 10836
+L2530:
+	LD XIZ, (L2530)
+L2531:
+	LD XIZ, (XIX+1492)
+L2532:
+	LD BC, 27163
+L2533:
+	LD HL, 3835
+L2534:
+	LD D, 230
+L2535:
+	LD XIZ, (XIX-7)
+L2536:
+	LD W, D
+L2537:
+	LD XIY, L2535
+L2538:
+	LD IX, 14900
+L2539:
+	LD H, A
+L2540:
+	LD B, 167
+L2541:
+	LD H, (XIX+971)
+L2542:
+	LD IY, 3663
+L2543:
+	LD XIZ, (L1329)
+L2544:
+	LD (XIZ+), L
+L2545:
+	LD XIX, L2548
+L2546:
+	LD H, 202
+L2547:
+	LD XDE, (XWA+44)
+L2548:
+	LD BC, 1298
+L2549:
+	LD L, 40
+L2550:
+	LD A, D
+L2551:
+	LD B, 3
+L2552:
+	LD (XIX+5497:16), HL
+L2553:
+	LD H, W
+L2554:
+	LD DE, 33587
+L2555:
+	LD (XWA+26145:16), DE
+L2556:
+	LDA XDE, (XIX+27)
+L2557:
+	LD BC, 24034
+L2558:
+	LD XIX, L2470
+L2559:
+	LD A, C
+L2560:
+	LD DE, (XIX)
+L2561:
+	LD XIX, (L2559:24)
+L2562:
+	LD XIZ, L2558
+L2563:
+	LD (XIX+986), IY
+L2564:
+	LD XBC, (XDE-53)
+L2565:
+	LD IZ, 61103
+L2566:
+	LDA XIY, (XIX+60)
+L2567:
+	LD (XBC), C
+L2568:
+	LD XWA, L4335
+L2569:
+	LD E, 46
+L2570:
+	LD BC, 47963
+L2571:
+	LD XIZ, (-XBC)
+L2572:
+	LD (XIY-37), C
+L2573:
+	LD (-XIZ), IZ
+L2574:
+	LD D, L
+L2575:
+	LD B, D
+L2576:
+	LD H, B
+L2577:
+	LDA XIY, (XIX+37)
+L2578:
+	LD XWA, (XWA-23)
+L2579:
+	LD XIX, (XWA+82)
+L2580:
+	LD XBC, L2579
+L2581:
+	LD XHL, (XIZ-81)
+L2582:
+	LD IY, 40412
+L2583:
+	LD XIY, L2579
+L2584:
+	LD XIY, (XWA+BC)
+L2585:
+	LD XBC, L2581
+L2586:
+	LD IY, 35286
+L2587:
+	LD W, L
+L2588:
+	LD (XWA+BC), C
+L2589:
+	LD E, (XWA+BC)
+L2590:
+	LD W, W
+L2591:
+	LD L, 106
+L2592:
+	LD D, (XIX+)
+L2593:
+	LD XDE, L1145
+L2594:
+	LD WA, 16905
+L2595:
+	LD D, H
+L2596:
+	LD (XWA+BC), IX
+L2597:
+	LD E, D
+L2598:
+	LDA XHL, (XIX+100)
+L2599:
+	LD A, D
+L2600:
+	LD IZ, (XIX+)
+L2601:
+	LD XIY, (XHL+10461:16)
+L2602:
+	LDA XHL, (XIX+91)
+L2603:
+	LD XIZ, (XIZ+)
+L2604:
+	LD IY, 38337
+L2605:
+	LD H, 69
+L2606:
+	LD XIX, L2602
+L2607:
+	LD XIZ, (-XHL)
+L2608:
+	LD W, 240
+L2609:
+	LD IY, 56046
+L2610:
+	LD W, 114
+L2611:
+	LD B, 236
+L2612:
+	LD (XIZ+110:8), D
+L2613:
+	LD (XWA+BC), DE
+L2614:
+	LDA XIX, (XIX+62)
+L2615:
+	LD IY, (L2618:24)
+L2616:
+	LD (-XBC), B
+L2617:
+	LDA XWA, (XIX+14)
+L2618:
+	LD (L2622:24), C
+L2619:
+	LDA XDE, (XIX+73)
+L2620:
+	LD C, 249
+L2621:
+	LDA XDE, (XIX+64)
+L2622:
+	LD E, C
+L2623:
+	LD XIZ, (XHL+)
+L2624:
+	LD (P0), BC
+L2625:
+	LD XWA, L2623
+L2626:
+	LD D, 133
+L2627:
+	LD IZ, 28490
+L2628:
+	LD W, B
+L2629:
+	LD XDE, L2630
+L2630:
+	LDA XHL, (XIX+72)
+L2631:
+	LD (XIY-22), DE
+L2632:
+	LDA XHL, (XIX+72)
+L2633:
+	LD H, 81
+L2634:
+	LD WA, (L4511:24)
+L2635:
+	LD XDE, (XIY)
+L2636:
+	LD XIZ, (XIX)
+L2637:
+	LD A, C
+L2638:
+	LDA XWA, (XIX+43)
+L2639:
+	LD WA, (XWA+B)
+L2640:
+	LD XHL, (XIZ)
+L2641:
+	LD (XWA+BC), IY
+L2642:
+	LD XIX, L2638
+L2643:
+	LD IZ, 2945
+L2644:
+	LD XIZ, (FAR)
+L2645:
+	LD BC, 3744
+L2646:
+	LD HL, 56514
+L2647:
+	LD D, A
+L2648:
+	LD C, 205
+L2649:
+	LD XDE, L2645
+L2650:
+	LD XDE, (L2653:24)
+L2651:
+	LD C, 188
+L2652:
+	LD (L2654:24), IY
+L2653:
+	LD BC, (P0)
+L2654:
+	LDA XHL, (XIX+2)
+L2655:
+	LD W, 44
+L2656:
+	LD XIZ, L1666
+L2657:
+	LD E, 219
+L2658:
+	LD (XWA+), IY
+L2659:
+	LD A, C
+L2660:
+	LD B, 104
+L2661:
+	LD IZ, 17802
+L2662:
+	LD H, 144
+L2663:
+	LD D, W
+L2664:
+	LDA XIZ, (XIX+19)
+L2665:
+	LD A, 182
+L2666:
+	LD XDE, (XWA+3)
+L2667:
+	LD L, 72
+L2668:
+	LD (XBC+), H
+L2669:
+	LD (XHL), C
+L2670:
+	LD IX, (XIX+1422)
+L2671:
+	LDA XWA, (XIX+64)
+L2672:
+	LD XDE, L4944
+L2673:
+	LD E, (XIY-51)
+L2674:
+	LD XIX, (XIZ+66:8)
+L2675:
+	LD C, 122
+L2676:
+	LD H, 9
+L2677:
+	LD BC, (XIX+1649)
+L2678:
+	LD C, (XWA+BC)
+L2679:
+	LD XWA, (L2678)
+L2680:
+	LD B, L
+L2681:
+	LD (XHL), A
+L2682:
+	LDA XIZ, (XIX+12)
+L2683:
+	LD (XIX+2059), BC
+L2684:
+	LD XIX, L2680
+L2685:
+	LD IX, (XWA-57)
+L2686:
+	LD L, D
+L2687:
+	LD XIX, (L2683:24)
+L2688:
+	LD D, A
+L2689:
+	LD L, E
+L2690:
+	LD IZ, 45726
+L2691:
+	LD XBC, L1284
+L2692:
+	LD XHL, (L2689:24)
+L2693:
+	LD WA, 24824
+L2694:
+	LD H, 253
+L2695:
+	LDA XDE, (XIX+63)
+L2696:
+	LD WA, (XBC+64:8)
+L2697:
+	LD (XWA-37), B
+L2698:
+	LD (XIZ+10), IZ
+L2699:
+	LD XWA, L2700
+L2700:
+	LD HL, 2611
+L2701:
+	LD D, 186
+L2702:
+	LD XHL, L2699
+L2703:
+	LD (XWA+BC), BC
+L2704:
+	LD (XWA+BC), IY
+L2705:
+	LDA XIZ, (XIX+12)
+L2706:
+	LD IY, (XIX+111:8)
+L2707:
+	LD (XIX+2233), IZ
+L2708:
+	LD C, W
+L2709:
+	LDA XHL, (XIX+80)
+L2710:
+	LDA XDE, (XIX+72)
+L2711:
+	LD (XIX-14), L
+L2712:
+	LD BC, 13314
+L2713:
+	LD (XBC+26150:16), IY
+L2714:
+	LD DE, 55356
+L2715:
+	LD (XHL-50), D
+L2716:
+	LD WA, 63095
+L2717:
+	LDA XDE, (XIX+88)
+L2718:
+	LD (XIY+50:8), DE
+L2719:
+	LD XIY, (L2722)
+L2720:
+	LD C, L
+L2721:
+	LD DE, 49751
+L2722:
+	LD IY, 3324
+L2723:
+	LD BC, 42097
+L2724:
+	LD B, E
+L2725:
+	LDA XWA, (XIX+60)
+L2726:
+	LD L, (XBC+)
+L2727:
+	LD D, 146
+L2728:
+	LD XIZ, (L2728:24)
+L2729:
+	LD IZ, 18856
+L2730:
+	LD IY, 41387
+L2731:
+	LD B, E
+L2732:
+	LD XIZ, (FAR)
+L2733:
+	LD IX, (L1873)
+L2734:
+	LDA XWA, (XIX+48)
+L2735:
+	LD D, (XWA+1242:16)
+L2736:
+	LD IZ, 29375
+L2737:
+	LD (XWA+BC), C
+L2738:
+	LDA XDE, (XIX+46)
+L2739:
+	LD H, 157
+L2740:
+	LD HL, (L3217)
+L2741:
+	LD XDE, L2742
+L2742:
+	LD XIY, (FAR)
+L2743:
+	LD E, 135
+L2744:
+	LD (XWA-9), H
+L2745:
+	LD DE, 38298
+L2746:
+	LD B, 205
+L2747:
+	LDA XIX, (XIX+46)
+L2748:
+	LD E, 41
+L2749:
+	LD (XWA+6907:16), L
+L2750:
+	LD XIX, L2749
+L2751:
+	LD XWA, (XIX+750)
+L2752:
+	LDA XIY, (XIX+84)
+L2753:
+	LDA XIX, (XIX+63)
+L2754:
+	LD (L2751:24), IX
+L2755:
+	LD (XIY+2:8), DE
+L2756:
+	LD XIX, L3678
+L2757:
+	LD XIY, (BIGREG)
+L2758:
+	LD W, 128
+L2759:
+	LD E, L
+L2760:
+	LD IY, 40974
+L2761:
+	LD XHL, (XDE-66)
+L2762:
+	LD BC, 60737
+L2763:
+	LD C, (L2759:24)
+L2764:
+	LD XBC, (XIY+50)
+L2765:
+	LD XBC, (L2763)
+L2766:
+	LDA XIZ, (XIX+94)
+L2767:
+	LD (XIX+43:8), HL
+L2768:
+	LD XIY, L1156
+L2769:
+	LD XIY, L2767
+L2770:
+	LD H, 0
+L2771:
+	LD XIY, (FAR)
+L2772:
+	LDA XHL, (XIX+87)
+L2773:
+	LD XIZ, (L2777:24)
+L2774:
+	LD W, (XIZ+)
+L2775:
+	LD XHL, L2771
+L2776:
+	LD (XBC+), H
+L2777:
+	LD A, 166
+L2778:
+	LD BC, 36125
+L2779:
+	LD DE, 20902
+L2780:
+	LD XDE, (XIX+777)
+L2781:
+	LD XDE, (XIX+2874)
+L2782:
+	LD A, A
+L2783:
+	LD WA, (XHL-1)
+L2784:
+	LD XIY, L2788
+L2785:
+	LD H, C
+L2786:
+	LD HL, 23175
+L2787:
+	LD XIZ, (L2785)
+L2788:
+	LD XHL, L2784
+L2789:
+	LD WA, 39460
+L2790:
+	LD DE, 59527
+L2791:
+	LD XWA, L1158
+L2792:
+	LD XBC, L2793
+L2793:
+	LD A, C
+L2794:
+	LD IY, (XIY)
+L2795:
+	LDA XIY, (XIX+92)
+L2796:
+	LDA XDE, (XIX+59)
+L2797:
+	LD IY, 10963
+L2798:
+	LDA XWA, (XIX+39)
+L2799:
+	LD (XBC+36), DE
+L2800:
+	LD HL, (-XBC)
+L2801:
+	LD BC, 46149
+L2802:
+	LDA XDE, (XIX+36)
+L2803:
+	LD (XDE+), W
+L2804:
+	LD DE, 22086
+L2805:
+	LD B, (L2804)
+L2806:
+	LD IX, 52524
+L2807:
+	LD B, W
+L2808:
+	LD XIZ, (XWA)
+L2809:
+	LDA XHL, (XIX+5)
+L2810:
+	LD BC, (L2810:24)
+L2811:
+	LD HL, (XWA+B)
+L2812:
+	LD W, 201
+L2813:
+	LD BC, 2133
+L2814:
+	LD XWA, L2817
+L2815:
+	LD IZ, 48922
+L2816:
+	LD WA, (XIZ+80)
+L2817:
+	LD C, H
+L2818:
+	LD XIY, L2822
+L2819:
+	LD H, 215
+L2820:
+	LD W, 240
+L2821:
+	LD C, 197
+L2822:
+	LD B, 82
+L2823:
+	LD (XIZ+47), W
+L2824:
+	LD (XBC+46), A
+L2825:
+	LD B, L
+L2826:
+	LDA XIX, (XIX+56)
+L2827:
+	LD IY, 31690
+L2828:
+	LD E, 127
+L2829:
+	LD XHL, (P0)
+L2830:
+	LD DE, 6126
+L2831:
+	LD C, 243
+L2832:
+	LD XHL, L2833
+L2833:
+	LD IY, 14813
+L2834:
+	LD XHL, (-XWA)
+L2835:
+	LD D, 214
+L2836:
+	LD XIX, L1260
+L2837:
+	LD BC, (XBC+3269:16)
+L2838:
+	LD A, L
+L2839:
+	LD A, H
+L2840:
+	LD D, 33
+L2841:
+	LD A, 142
+L2842:
+	LD W, E
+L2843:
+	LDA XIX, (XIX+14)
+L2844:
+	LD H, C
+L2845:
+	LD XIX, L2847
+L2846:
+	LD A, H
+L2847:
+	LD BC, (FAR)
+L2848:
+	LD XHL, L2851
+L2849:
+	LD XIY, L2850
+L2850:
+	LD E, 188
+L2851:
+	LD XIX, L2848
+L2852:
+	LD HL, 4076
+L2853:
+	LD H, 244
+L2854:
+	LD XDE, L2883
+L2855:
+	LD XHL, L2858
+L2856:
+	LD XIY, L2855
+L2857:
+	LD L, 65
+L2858:
+	LDA XHL, (XIX+32)
+L2859:
+	LD XDE, (BIGREG)
+L2860:
+	LD C, 54
+L2861:
+	LD D, 21
+L2862:
+	LD XHL, (XIY+20920:16)
+L2863:
+	LD (XBC+41:8), DE
+L2864:
+	LD D, W
+L2865:
+	LD (L3784:24), B
+L2866:
+	LD BC, 32360
+L2867:
+	LD (-XBC), W
+L2868:
+	LD C, 15
+L2869:
+	LD XDE, (XDE+32:8)
+L2870:
+	LD XWA, (XIX+1442)
+L2871:
+	LD DE, 27915
+L2872:
+	LD XIZ, (L1853)
+L2873:
+	LD HL, 23417
+L2874:
+	LD HL, (XWA+B)
+L2875:
+	LD BC, (XWA-30)
+L2876:
+	LD H, W
+L2877:
+	LD DE, 27154
+L2878:
+	LD WA, 28138
+L2879:
+	LD D, E
+L2880:
+	LD XDE, (L2882)
+L2881:
+	LD (XIZ-84), BC
+L2882:
+	LD (L2886), DE
+L2883:
+	LD XHL, (XWA+BC)
+L2884:
+	LD W, B
+L2885:
+	LD H, B
+L2886:
+	LDA XDE, (XIX+96)
+L2887:
+	LDA XBC, (XIX+75)
+L2888:
+	LD IY, (XIZ+10978:16)
+L2889:
+	LD A, 159
+L2890:
+	LD XIX, L2887
+L2891:
+	LD A, 29
+L2892:
+	LD D, B
+L2893:
+	LD W, 226
+L2894:
+	LD IZ, (XWA)
+L2895:
+	LD DE, 24508
+L2896:
+	LD D, (FAR)
+L2897:
+	LD (XWA+BC), B
+L2898:
+	LD (L2895:24), HL
+L2899:
+	LD XDE, L2895
+L2900:
+	LD E, 219
+L2901:
+	LD (XBC+54:8), D
+L2902:
+	LDA XIZ, (XIX+5)
+L2903:
+	LD HL, 4981
+L2904:
+	LDA XIY, (XIX+9)
+L2905:
+	LD (L2907), L
+L2906:
+	LD H, (XIX+8372:16)
+L2907:
+	LD XHL, L2904
+L2908:
+	LD D, 185
+L2909:
+	LD XHL, (XIX+400)
+L2910:
+	LD C, (XBC+1853:16)
+L2911:
+	LD WA, 62421
+L2912:
+	LD B, C
+L2913:
+	LD L, 157
+L2914:
+	LD E, E
+L2915:
+	LDA XIZ, (XIX+85)
+L2916:
+	LD XHL, L2919
+L2917:
+	LD W, D
+L2918:
+	LD E, W
+L2919:
+	LDA XIX, (XIX+27)
+L2920:
+	LD IY, 49398
+L2921:
+	LD HL, (XBC-52)
+L2922:
+	LD HL, 38410
+L2923:
+	LD XBC, (FAR)
+L2924:
+	LD E, 137
+L2925:
+	LD XHL, (BIGREG)
+L2926:
+	LD WA, 16712
+L2927:
+	LD L, 109
+L2928:
+	LDA XIX, (XIX+14)
+L2929:
+	LD W, D
+L2930:
+	LDA XIY, (XIX+22)
+L2931:
+	LD (XWA+B), L
+L2932:
+	LDA XWA, (XIX+26)
+L2933:
+	LDA XBC, (XIX+19)
+L2934:
+	LD DE, 57582
+L2935:
+	LD E, 47
+L2936:
+	LD BC, 57146
+L2937:
+	LDA XHL, (XIX+86)
+L2938:
+	LD BC, 60640
+L2939:
+	LD C, 28
+L2940:
+	LD IY, 65042
+L2941:
+	LD C, 144
+L2942:
+	LD (XDE+13), W
+L2943:
+	LD (XIX+2085), H
+L2944:
+	LD L, 164
+L2945:
+	LD W, 153
+L2946:
+	LD (XIX+9:8), IZ
+L2947:
+	LD W, 41
+L2948:
+	LD XBC, (L2946:24)
+L2949:
+	LD B, 146
+L2950:
+	LDA XHL, (XIX+69)
+L2951:
+	LD A, (-XWA)
+L2952:
+	LD (XIY+), BC
+L2953:
+	LD (L2187), DE
+L2954:
+	LDA XIY, (XIX+34)
+L2955:
+	LDA XIZ, (XIX+49)
+L2956:
+	LD IY, 60464
+L2957:
+	LDA XWA, (XIX+38)
+L2958:
+	LD WA, 35502
+L2959:
+	LD W, H
+L2960:
+	LD (XIX+690), DE
+L2961:
+	LD (XIZ+), H
+L2962:
+	LD A, (XIX+68)
+L2963:
+	LD HL, 48535
+L2964:
+	LD IZ, 17739
+L2965:
+	LD H, L
+L2966:
+	LDA XIX, (XIX+9)
+L2967:
+	LD DE, (XWA+B)
+L2968:
+	LD E, 84
+L2969:
+	LD XIZ, (XBC+90:8)
+L2970:
+	LD XBC, L2974
+L2971:
+	LD W, (L2972:24)
+L2972:
+	LD (XWA+BC), IY
+L2973:
+	LD C, A
+L2974:
+	LD (XWA+21:8), WA
+L2975:
+	LDA XIY, (XIX+84)
+L2976:
+	LD IX, 21439
+L2977:
+	LD H, 227
+L2978:
+	LD WA, (XIX+2288)
+L2979:
+	LD IY, 51672
+L2980:
+	LD H, L
+L2981:
+	LD XIY, (L2985)
+L2982:
+	LD WA, (-XIY)
+L2983:
+	LD L, (XIZ+26163:16)
+L2984:
+	LD (XIX-25), IX
+L2985:
+	LD DE, (L2982)
+L2986:
+	LD (-XBC), B
+L2987:
+	LD XIZ, L989
+L2988:
+	LD (XWA+), HL
+L2989:
+	LD XIX, L2986
+L2990:
+	LD H, 185
+L2991:
+	LDA XHL, (XIX+85)
+L2992:
+	LD A, E
+L2993:
+	LD XWA, L2990
+L2994:
+	LD XIZ, (XWA+B)
+L2995:
+	LDA XDE, (XIX+42)
+L2996:
+	LD C, (XWA+BC)
+L2997:
+	LD XIY, (XWA+B)
+L2998:
+	LD IY, (XIY-85)
+L2999:
+	LD L, D
+L3000:
+	LD W, (XIX-13)
+L3001:
+	LD D, 214
+L3002:
+	LDA XWA, (XIX+23)
+L3003:
+	LD E, (L3005:24)
+L3004:
+	LD IX, 13042
+L3005:
+	LDA XHL, (XIX+81)
+L3006:
+	LD XHL, L436
+L3007:
+	LD E, 77
+L3008:
+	LD E, (XIX+631)
+L3009:
+	LD C, B
+L3010:
+	LD D, B
+L3011:
+	LD W, 118
+L3012:
+	LD XIX, (XIY+53)
+L3013:
+	LD (XIY+), C
+L3014:
+	LD XIZ, L3011
+L3015:
+	LD (XHL+67:8), IX
+L3016:
+	LD XWA, L3019
+L3017:
+	LD B, 114
+L3018:
+	LD (XWA+40), IX
+L3019:
+	LD XWA, (-XDE)
+L3020:
+	LD XIZ, (XWA-10)
+L3021:
+	LD (L3018:24), WA
+L3022:
+	LD E, 33
+L3023:
+	LDA XBC, (XIX+38)
+L3024:
+	LDA XIZ, (XIX+2)
+L3025:
+	LD XDE, (XHL-100)
+L3026:
+	LD IZ, 37256
+L3027:
+	LD DE, (XWA)
+L3028:
+	LD H, D
+L3029:
+	LD C, H
+L3030:
+	LD IY, (XWA+BC)
+L3031:
+	LD A, A
+L3032:
+	LD DE, 47652
+L3033:
+	LD WA, (XHL+)
+L3034:
+	LD D, A
+L3035:
+	LD E, B
+L3036:
+	LD W, 127
+L3037:
+	LD E, C
+L3038:
+	LD (-XWA), L
+L3039:
+	LD A, 41
+L3040:
+	LD XBC, (-XBC)
+L3041:
+	LD XIZ, (XIY+108:8)
+L3042:
+	LD D, 38
+L3043:
+	LD HL, 5492
+L3044:
+	LD (XHL), A
+L3045:
+	LD XIZ, L3044
+L3046:
+	LD W, 28
+L3047:
+	LD A, B
+L3048:
+	LD IZ, (XIX+1212)
+L3049:
+	LD DE, (XHL+27:8)
+L3050:
+	LD H, 17
+L3051:
+	LD (XBC+28980:16), BC
+L3052:
+	LDA XIX, (XIX+28)
+L3053:
+	LD E, H
+L3054:
+	LD (XIX+1509), A
+L3055:
+	LDA XIX, (XIX+33)
+L3056:
+	LDA XDE, (XIX+44)
+L3057:
+	LD XIX, L3160
+L3058:
+	LD A, (XWA+27:8)
+L3059:
+	LD IX, 40728
+L3060:
+	LD H, L
+L3061:
+	LD WA, (XIX+1441)
+L3062:
+	LD XWA, L3058
+L3063:
+	LD (XWA+), E
+L3064:
+	LD C, E
+L3065:
+	LD XWA, L3061
+L3066:
+	LD XIZ, L3066
+L3067:
+	LD BC, (XIZ+3)
+L3068:
+	LD L, 185
+L3069:
+	LD (L3071:24), DE
+L3070:
+	LD C, B
+L3071:
+	LD (XIX), IX
+L3072:
+	LD A, 12
+L3073:
+	LD XBC, L3073
+L3074:
+	LDA XIX, (XIX+58)
+L3075:
+	LD XHL, (-XHL)
+L3076:
+	LD C, 102
+L3077:
+	LD D, L
+L3078:
+	LD B, D
+L3079:
+	LD XBC, L4334
+L3080:
+	LD XWA, L3083
+L3081:
+	LD E, 42
+L3082:
+	LD (XDE+44), BC
+L3083:
+	LD (XIX+3530:16), A
+L3084:
+	LDA XIY, (XIX+11)
+L3085:
+	LD (XDE+), A
+L3086:
+	LDA XDE, (XIX+88)
+L3087:
+	LD D, D
+L3088:
+	LD (XIZ+36), BC
+L3089:
+	LD B, E
+L3090:
+	LD L, W
+L3091:
+	LD H, (XHL+)
+L3092:
+	LD E, 248
+L3093:
+	LD HL, (FAR)
+L3094:
+	LDA XIZ, (XIX+53)
+L3095:
+	LD IY, (L3092:24)
+L3096:
+	LDA XIY, (XIX+46)
+L3097:
+	LD (BIGREG), IX
+L3098:
+	LD L, 27
+L3099:
+	LD HL, (-XIY)
+L3100:
+	LD XIX, (XIX+33)
+L3101:
+	LD B, (XDE-46)
+L3102:
+	LD XDE, (XIX+1069)
+L3103:
+	LD DE, 58172
+L3104:
+	LD XHL, (XIX+479)
+L3105:
+	LD XIY, (L3104:24)
+L3106:
+	LD B, 47
+L3107:
+	LD BC, (XBC+11990:16)
+L3108:
+	LD XWA, (XIY+86)
+L3109:
+	LD HL, 61053
+L3110:
+	LD (FAR), H
+L3111:
+	LD XWA, (XWA+)
+L3112:
+	LD W, D
+L3113:
+	LD XWA, (XIZ+10:8)
+L3114:
+	LD DE, (-XIZ)
+L3115:
+	LDA XIY, (XIX+71)
+L3116:
+	LD IZ, (XIX+118:8)
+L3117:
+	LDA XBC, (XIX+81)
+L3118:
+	LD XIY, L3121
+L3119:
+	LD L, 122
+L3120:
+	LD W, E
+L3121:
+	LD XBC, (XIX+1870)
+L3122:
+	LD XDE, (XHL+18)
+L3123:
+	LD XWA, L4083
+L3124:
+	LD L, 140
+L3125:
+	LD A, E
+L3126:
+	LD IY, 42846
+L3127:
+	LD WA, 57442
+L3128:
+	LD WA, (-XBC)
+L3129:
+	LDA XIX, (XIX+33)
+L3130:
+	LD B, (L4196:24)
+L3131:
+	LDA XIZ, (XIX+15)
+L3132:
+	LD (XIZ+), DE
+L3133:
+	LD B, A
+L3134:
+	LD L, (XIY+7077:16)
+L3135:
+	LD XDE, (L3131:24)
+L3136:
+	LD A, 57
+L3137:
+	LD (-XHL), WA
+L3138:
+	LD XIY, (L3703)
+L3139:
+	LD IY, 59585
+L3140:
+	LD IX, (XDE)
+L3141:
+	LD C, (BIGREG)
+L3142:
+	LD XIX, L3142
+L3143:
+	LD W, D
+L3144:
+	LD (XIX+26677:16), WA
+L3145:
+	LD W, (L3148)
+L3146:
+	LD (XWA+19310:16), E
+L3147:
+	LD L, H
+L3148:
+	LD IX, 31780
+L3149:
+	LD W, 83
+L3150:
+	LD A, (XDE+26)
+L3151:
+	LD XBC, (L3155)
+L3152:
+	LD (XWA+27898:16), W
+L3153:
+	LD IZ, 24928
+L3154:
+	LD HL, 63654
+L3155:
+	LD XWA, L3154
+L3156:
+	LDA XBC, (XIX+79)
+L3157:
+	LD XIX, (XHL+41:8)
+L3158:
+	LD D, 225
+L3159:
+	LDA XIY, (XIX+27)
+L3160:
+	LD XHL, L817
+L3161:
+	LD A, H
+L3162:
+	LD IY, 20897
+L3163:
+	LD IX, (L3164)
+L3164:
+	LD E, 138
+L3165:
+	LD B, 118
+L3166:
+	LD (XWA+BC), BC
+L3167:
+	LD XDE, (XIX+1555)
+L3168:
+	LD B, 254
+L3169:
+	LD XWA, (L3168:24)
+L3170:
+	LD C, (XIX+1976)
+L3171:
+	LD IX, 2148
+L3172:
+	LD XIX, (XIX+316)
+L3173:
+	LD XIX, (XIX-74)
+L3174:
+	LD B, (XIX+2615)
+L3175:
+	LD IZ, 37252
+L3176:
+	LD L, 216
+L3177:
+	LD XHL, (XIZ-26)
+L3178:
+	LDA XHL, (XIX+64)
+L3179:
+	LD XIY, L3182
+L3180:
+	LD DE, 39793
+L3181:
+	LD L, 47
+L3182:
+	LD (XWA+B), A
+L3183:
+	LDA XBC, (XIX+42)
+L3184:
+	LDA XIX, (XIX+48)
+L3185:
+	LD XDE, (XHL-95)
+L3186:
+	LD A, H
+L3187:
+	LD (XIY), E
+L3188:
+	LD HL, (XIX-19)
+L3189:
+	LDA XIY, (XIX+81)
+L3190:
+	LDA XIY, (XIX+17)
+L3191:
+	LD H, (-XIY)
+L3192:
+	LDA XIZ, (XIX+79)
+L3193:
+	LD D, 104
+L3194:
+	LD H, (-XWA)
+L3195:
+	LD XHL, L3198
+L3196:
+	LDA XBC, (XIX+16)
+L3197:
+	LDA XIX, (XIX+25)
+L3198:
+	LD (L3201), D
+L3199:
+	LD DE, (L3203:24)
+L3200:
+	LD WA, 56386
+L3201:
+	LD XHL, (XHL+27886:16)
+L3202:
+	LD (XIX+2858), A
+L3203:
+	LDA XHL, (XIX+12)
+L3204:
+	LD (FAR), IZ
+L3205:
+	LD XWA, L4496
+L3206:
+	LD XIZ, L3206
+L3207:
+	LD B, 239
+L3208:
+	LD XDE, (XIX+)
+L3209:
+	LD L, 106
+L3210:
+	LD IX, 1123
+L3211:
+	LD (XBC+), E
+L3212:
+	LDA XIY, (XIX+99)
+L3213:
+	LD XIX, (XIX+)
+L3214:
+	LD B, (XWA+1683:16)
+L3215:
+	LD D, 41
+L3216:
+	LD IX, (XWA+B)
+L3217:
+	LD XBC, L3218
+L3218:
+	LD IY, (XIZ+20601:16)
+L3219:
+	LD (XDE), BC
+L3220:
+	LD XWA, L3223
+L3221:
+	LDA XWA, (XIX+51)
+L3222:
+	LD D, L
+L3223:
+	LD A, 200
+L3224:
+	LD A, 121
+L3225:
+	LD C, L
+L3226:
+	LD H, (XHL+22736:16)
+L3227:
+	LD XDE, L2023
+L3228:
+	LD IY, 33888
+L3229:
+	LDA XWA, (XIX+58)
+L3230:
+	LD HL, (XHL-41)
+L3231:
+	LDA XBC, (XIX+26)
+L3232:
+	LDA XBC, (XIX+36)
+L3233:
+	LD E, (XIX+316)
+L3234:
+	LD HL, 28463
+L3235:
+	LD XDE, L3236
+L3236:
+	LD XIZ, (-XIX)
+L3237:
+	LDA XBC, (XIX+54)
+L3238:
+	LD H, 29
+L3239:
+	LDA XHL, (XIX+57)
+L3240:
+	LD HL, (XWA+23)
+L3241:
+	LD IY, 43558
+L3242:
+	LD XBC, L3241
+L3243:
+	LD XIZ, (XHL+104:8)
+L3244:
+	LD IZ, 39973
+L3245:
+	LD XIX, (XIX)
+L3246:
+	LDA XIX, (XIX+49)
+L3247:
+	LD W, 48
+L3248:
+	LD E, (XDE-74)
+L3249:
+	LD DE, 215
+L3250:
+	LD XHL, L3251
+L3251:
+	LD L, B
+L3252:
+	LD XWA, L3253
+L3253:
+	LD A, 178
+L3254:
+	LD (FAR), IY
+L3255:
+	LD WA, (-XWA)
+L3256:
+	LD A, (XHL)
+L3257:
+	LD (XIX+2279:16), HL
+L3258:
+	LD XIY, L3260
+L3259:
+	LD C, 121
+L3260:
+	LD XWA, (XIY)
+L3261:
+	LD XIZ, (XIY+45)
+L3262:
+	LD A, 166
+L3263:
+	LDA XBC, (XIX+59)
+L3264:
+	LD IX, 35277
+L3265:
+	LDA XIY, (XIX+92)
+L3266:
+	LD XBC, (L3268)
+L3267:
+	LD (BIGREG), WA
+L3268:
+	LD XWA, L3264
+L3269:
+	LD XDE, L3265
+L3270:
+	LD (-XWA), IZ
+L3271:
+	LD A, C
+L3272:
+	LD B, H
+L3273:
+	LDA XIX, (XIX+5)
+L3274:
+	LD XBC, (-XHL)
+L3275:
+	LD L, (L3461)
+L3276:
+	LD XDE, (XDE+11023:16)
+L3277:
+	LDA XHL, (XIX+36)
+L3278:
+	LD XIZ, L3275
+L3279:
+	LD IX, (XIX+92:8)
+L3280:
+	LDA XHL, (XIX+43)
+L3281:
+	LD B, 85
+L3282:
+	LD E, (-XIZ)
+L3283:
+	LDA XBC, (XIX+51)
+L3284:
+	LD B, A
+L3285:
+	LD HL, 9503
+L3286:
+	LD E, (XHL)
+L3287:
+	LD IX, 25812
+L3288:
+	LD L, 24
+L3289:
+	LD (L608:24), IY
+L3290:
+	LDA XIZ, (XIX+39)
+L3291:
+	LD XHL, (-XHL)
+L3292:
+	LD XIX, (L3289:24)
+L3293:
+	LD XIZ, (L3294:24)
+L3294:
+	LD D, C
+L3295:
+	LD XIY, L3291
+L3296:
+	LD BC, 9340
+L3297:
+	LD D, 153
+L3298:
+	LD WA, 31120
+L3299:
+	LDA XIZ, (XIX+66)
+L3300:
+	LD H, E
+L3301:
+	LD E, C
+L3302:
+	LD E, (XBC+5:8)
+L3303:
+	LDA XHL, (XIX+80)
+L3304:
+	LD HL, 48068
+L3305:
+	LD XHL, L3301
+L3306:
+	LD XWA, (XHL)
+L3307:
+	LDA XBC, (XIX+62)
+L3308:
+	LD XIZ, L3310
+L3309:
+	LD DE, (L165)
+L3310:
+	LD E, A
+L3311:
+	LDA XIX, (XIX+89)
+L3312:
+	LD (L3309:24), E
+L3313:
+	LD XHL, L3316
+L3314:
+	LD (L3315), H
+L3315:
+	LDA XIZ, (XIX+94)
+L3316:
+	LD XBC, L2094
+L3317:
+	LD H, 224
+L3318:
+	LD (FAR), D
+L3319:
+	LD E, 134
+L3320:
+	LD XIY, (L3324)
+L3321:
+	LDA XIX, (XIX+96)
+L3322:
+	LD (XDE), E
+L3323:
+	LD BC, 7578
+L3324:
+	LD BC, (L3323:24)
+L3325:
+	LD C, 174
+L3326:
+	LD DE, (P0)
+L3327:
+	LDA XHL, (XIX+6)
+L3328:
+	LDA XHL, (XIX+62)
+L3329:
+	LD XWA, L207
+L3330:
+	LD XHL, (L3329)
+L3331:
+	LD DE, 15062
+L3332:
+	LD XWA, (P0)
+L3333:
+	LD HL, 47775
+L3334:
+	LD XWA, L3337
+L3335:
+	LD HL, 31106
+L3336:
+	LD B, 146
+L3337:
+	LD HL, 47178
+L3338:
+	LD HL, 6840
+L3339:
+	LD W, (L3339:24)
+L3340:
+	LD L, L
+L3341:
+	LD (XWA+109:8), L
+L3342:
+	LD W, L
+L3343:
+	LD (XBC-63), W
+L3344:
+	LD XIZ, (FAR)
+L3345:
+	LD XWA, (L3341:24)
+L3346:
+	LDA XIX, (XIX+46)
+L3347:
+	LD L, 228
+L3348:
+	LD XHL, (L3350:24)
+L3349:
+	LD L, 172
+L3350:
+	LD B, 14
+L3351:
+	LD HL, 19928
+L3352:
+	LD (P0), A
+L3353:
+	LD DE, (XIZ+25684:16)
+L3354:
+	LDA XDE, (XIX+35)
+L3355:
+	LD XIY, (XHL+10718:16)
+L3356:
+	LDA XHL, (XIX+85)
+L3357:
+	LD BC, 37934
+L3358:
+	LD (XHL+11904:16), E
+L3359:
+	LD (P0), H
+L3360:
+	LD HL, (XDE+22677:16)
+L3361:
+	LD B, (XDE+24310:16)
+L3362:
+	LD (XWA+BC), B
+L3363:
+	LD XIY, L3365
+L3364:
+	LD BC, 36391
+L3365:
+	LD E, W
+L3366:
+	LD IX, 35170
+L3367:
+	LD (XIY+71), B
+L3368:
+	LDA XBC, (XIX+0)
+L3369:
+	LD HL, 56113
+L3370:
+	LDA XIX, (XIX+32)
+L3371:
+	LD D, 97
+L3372:
+	LD WA, (XIY-23)
+L3373:
+	LD (P0), IZ
+L3374:
+	LD WA, (XDE+67:8)
+L3375:
+	LD (XDE), WA
+L3376:
+	LD (L1183), HL
+L3377:
+	LD W, (L299:24)
+L3378:
+	LD E, W
+L3379:
+	LD XDE, (-XBC)
+L3380:
+	LD WA, (BIGREG)
+L3381:
+	LD C, (FAR)
+L3382:
+	LD XHL, L3384
+L3383:
+	LD H, 132
+L3384:
+	LD H, E
+L3385:
+	LD B, (XHL+19:8)
+L3386:
+	LD L, 248
+L3387:
+	LD BC, 21003
+L3388:
+	LD H, E
+L3389:
+	LD D, (XIZ+)
+L3390:
+	LD BC, (XIY-1)
+L3391:
+	LD XWA, (XDE+18650:16)
+L3392:
+	LD (-XIZ), B
+L3393:
+	LD XDE, L599
+L3394:
+	LD IY, 29146
+L3395:
+	LD IX, 19322
+L3396:
+	LD (XDE+1382:16), B
+L3397:
+	LD W, 64
+L3398:
+	LD W, 145
+L3399:
+	LD XIY, (XHL-5)
+L3400:
+	LD (BIGREG), W
+L3401:
+	LD HL, 61699
+L3402:
+	LD W, 238
+L3403:
+	LD XIY, L3404
+L3404:
+	LD (XHL+79:8), IZ
+L3405:
+	LD (XWA+BC), C
+L3406:
+	LD IX, (XIZ+73:8)
+L3407:
+	LDA XWA, (XIX+50)
+L3408:
+	LD HL, 37112
+L3409:
+	LD D, E
+L3410:
+	LD XDE, (-XWA)
+L3411:
+	LD (XBC+74:8), IX
+L3412:
+	LD C, (XIX+28003:16)
+L3413:
+	LD WA, 43333
+L3414:
+	LD C, L
+L3415:
+	LD DE, (XIX-30)
+L3416:
+	LD D, 148
+L3417:
+	LD WA, 35589
+L3418:
+	LD WA, (XBC-45)
+L3419:
+	LD HL, 16363
+L3420:
+	LD D, E
+L3421:
+	LD (XIX), D
+L3422:
+	LDA XIY, (XIX+98)
+L3423:
+	LD E, 219
+L3424:
+	LD (-XIY), IX
+L3425:
+	LD XIZ, L3427
+L3426:
+	LD (XHL+10654:16), BC
+L3427:
+	LD D, E
+L3428:
+	LD XDE, L3426
+L3429:
+	LD C, 145
+L3430:
+	LD (XBC-1), IX
+L3431:
+	LD (L3429), W
+L3432:
+	LDA XDE, (XIX+98)
+L3433:
+	LDA XIX, (XIX+37)
+L3434:
+	LD XWA, L3436
+L3435:
+	LDA XIZ, (XIX+11)
+L3436:
+	LD DE, 60202
+L3437:
+	LD WA, 10398
+L3438:
+	LD HL, 15364
+L3439:
+	LD C, A
+L3440:
+	LD B, 70
+L3441:
+	LDA XWA, (XIX+62)
+L3442:
+	LD D, L
+L3443:
+	LDA XWA, (XIX+89)
+L3444:
+	LD E, 182
+L3445:
+	LD B, 208
+L3446:
+	LD C, E
+L3447:
+	LD W, 222
+L3448:
+	LD L, 97
+L3449:
+	LD XIZ, L3452
+L3450:
+	LD H, C
+L3451:
+	LD W, H
+L3452:
+	LD W, 116
+L3453:
+	LD B, 213
+L3454:
+	LD XHL, L3451
+L3455:
+	LDA XWA, (XIX+43)
+L3456:
+	LDA XBC, (XIX+17)
+L3457:
+	LD (XIY), IY
+L3458:
+	LD D, (XIZ)
+L3459:
+	LDA XIX, (XIX+28)
+L3460:
+	LD (L3457:24), IY
+L3461:
+	LD XWA, L3458
+L3462:
+	LD (-XWA), BC
+L3463:
+	LD B, 225
+L3464:
+	LD XHL, L3463
+L3465:
+	LDA XWA, (XIX+45)
+L3466:
+	LD XHL, L3464
+L3467:
+	LD XDE, (-XWA)
+L3468:
+	LD XBC, L3470
+L3469:
+	LD L, (XBC+87:8)
+L3470:
+	LD XIX, L1474
+L3471:
+	LD XIX, (-XIZ)
+L3472:
+	LD H, 76
+L3473:
+	LD L, A
+L3474:
+	LD XHL, L3478
+L3475:
+	LD XIZ, L3475
+L3476:
+	LD XIY, L3473
+L3477:
+	LD IZ, 5215
+L3478:
+	LD (XIY+), IY
+L3479:
+	LD BC, (XIX+498)
+L3480:
+	LD H, 81
+L3481:
+	LD E, 43
+L3482:
+	LDA XBC, (XIX+22)
+L3483:
+	LD E, C
+L3484:
+	LD (XIX+2241), L
+L3485:
+	LD IZ, (XIY+50)
+L3486:
+	LD (XIX+1149), HL
+L3487:
+	LD XWA, L2713
+L3488:
+	LD H, A
+L3489:
+	LDA XIX, (XIX+3)
+L3490:
+	LD D, (XHL+13633:16)
+L3491:
+	LDA XIZ, (XIX+21)
+L3492:
+	LD XBC, (L3490)
+L3493:
+	LDA XIZ, (XIX+45)
+L3494:
+	LD HL, 966
+L3495:
+	LD E, (XDE+28:8)
+L3496:
+	LD WA, 65463
+L3497:
+	LD HL, (XIX+)
+L3498:
+	LD XBC, L3576
+L3499:
+	LD C, L
+L3500:
+	LD (XWA+95), BC
+L3501:
+	LD XBC, (XIY+)
+L3502:
+	LD (XIX+1438), E
+L3503:
+	LD (XIX+620), D
+L3504:
+	LD XHL, (XWA)
+L3505:
+	LD WA, 22468
+L3506:
+	LD BC, 33405
+L3507:
+	LDA XIZ, (XIX+39)
+L3508:
+	LD E, 16
+L3509:
+	LD B, 53
+L3510:
+	LD C, H
+L3511:
+	LDA XIY, (XIX+77)
+L3512:
+	LD C, 92
+L3513:
+	LD C, (XIX+2893)
+L3514:
+	LDA XIZ, (XIX+3)
+L3515:
+	LD (L3511:24), BC
+L3516:
+	LDA XBC, (XIX+68)
+L3517:
+	LD WA, 37583
+L3518:
+	LD (XIZ), IZ
+L3519:
+	LD W, W
+L3520:
+	LD IZ, 17136
+L3521:
+	LD C, 56
+L3522:
+	LD D, C
+L3523:
+	LDA XBC, (XIX+18)
+L3524:
+	LD A, 167
+L3525:
+	LD D, 207
+L3526:
+	LD W, 167
+L3527:
+	LD BC, 40387
+L3528:
+	LDA XIZ, (XIX+44)
+L3529:
+	LD XIX, L3527
+L3530:
+	LD WA, (-XBC)
+L3531:
+	LD BC, (-XIZ)
+L3532:
+	LD IY, (-XIZ)
+L3533:
+	LD B, C
+L3534:
+	LD H, 211
+L3535:
+	LD XHL, L3532
+L3536:
+	LD BC, 40054
+L3537:
+	LD C, 180
+L3538:
+	LD IY, (L58)
+L3539:
+	LDA XDE, (XIX+49)
+L3540:
+	LD XHL, L3542
+L3541:
+	LD BC, 24414
+L3542:
+	LDA XIY, (XIX+59)
+L3543:
+	LD XWA, (-XIZ)
+L3544:
+	LD XIX, L2966
+L3545:
+	LD (L3544:24), IY
+L3546:
+	LDA XIY, (XIX+97)
+L3547:
+	LD XIZ, (-XHL)
+L3548:
+	LDA XHL, (XIX+56)
+L3549:
+	LD E, L
+L3550:
+	LD (XWA+), H
+L3551:
+	LDA XWA, (XIX+73)
+L3552:
+	LD XDE, (XIX+1044)
+L3553:
+	LD XHL, (XWA-40)
+L3554:
+	LD W, C
+L3555:
+	LD E, 121
+L3556:
+	LD H, B
+L3557:
+	LD WA, 13412
+L3558:
+	LD C, 216
+L3559:
+	LD (XWA+B), IX
+L3560:
+	LD XWA, (XIY+98)
+L3561:
+	LD XIZ, (XIX)
+L3562:
+	LD (XWA+5723:16), A
+L3563:
+	LD XBC, L3559
+L3564:
+	LD XIZ, L3449
+L3565:
+	LD (XIZ+), HL
+L3566:
+	LD B, (-XIZ)
+L3567:
+	LD XIY, (XIX+1792)
+L3568:
+	LD B, E
+L3569:
+	LD XIY, L1199
+L3570:
+	LD XIX, L3571
+L3571:
+	LD E, (-XWA)
+L3572:
+	LD IY, 56220
+L3573:
+	LD XBC, L3875
+L3574:
+	LD (XBC+64:8), W
+L3575:
+	LD C, 251
+L3576:
+	LD W, B
+L3577:
+	LD (-XDE), C
+L3578:
+	LD (XDE+), W
+L3579:
+	LD (XIX+1595), L
+L3580:
+	LD L, H
+L3581:
+	LD XIX, (XDE+37:8)
+L3582:
+	LD HL, (L3579:24)
+L3583:
+	LD E, 182
+L3584:
+	LDA XIX, (XIX+52)
+L3585:
+	LD XBC, L3589
+L3586:
+	LD W, 193
+L3587:
+	LD H, 66
+L3588:
+	LD HL, 41721
+L3589:
+	LD E, 216
+L3590:
+	LD L, B
+L3591:
+	LD XIY, L3591
+L3592:
+	LDA XIZ, (XIX+77)
+L3593:
+	LD (XDE+), A
+L3594:
+	LD IZ, 6246
+L3595:
+	LD IX, (XIZ)
+L3596:
+	LD W, 217
+L3597:
+	LD DE, 66
+L3598:
+	LD W, 133
+L3599:
+	LD XIX, L3599
+L3600:
+	LD HL, (L4869)
+L3601:
+	LD XIY, (L3602:24)
+L3602:
+	LD HL, 24325
+L3603:
+	LD IZ, (XWA+50)
+L3604:
+	LD D, 86
+L3605:
+	LD HL, 17306
+L3606:
+	LD XIZ, L2140
+L3607:
+	LD D, H
+L3608:
+	LDA XDE, (XIX+82)
+L3609:
+	LD WA, 22866
+L3610:
+	LDA XIX, (XIX+59)
+L3611:
+	LD XHL, (-XDE)
+L3612:
+	LD A, (XBC+94)
+L3613:
+	LD XHL, (XIZ-60)
+L3614:
+	LD (XIY-20), BC
+L3615:
+	LD (FAR), BC
+L3616:
+	LD XDE, L3612
+L3617:
+	LD XHL, (-XHL)
+L3618:
+	LD H, 220
+L3619:
+	LD IY, 17726
+L3620:
+	LD XDE, (XIX+14340:16)
+L3621:
+	LD XHL, (XIX+98)
+L3622:
+	LD XIY, (XIZ+31)
+L3623:
+	LD W, (XWA+40)
+L3624:
+	LD (BIGREG), IX
+L3625:
+	LDA XIY, (XIX+71)
+L3626:
+	LD (-XIY), IZ
+L3627:
+	LD (XDE+71), A
+L3628:
+	LD XBC, (XBC+48)
+L3629:
+	LD C, L
+L3630:
+	LD D, A
+L3631:
+	LD L, 50
+L3632:
+	LD DE, 8606
+L3633:
+	LD L, A
+L3634:
+	LD (XBC+9:8), D
+L3635:
+	LD B, 60
+L3636:
+	LD XIY, (XIX+837)
+L3637:
+	LD L, 201
+L3638:
+	LD XBC, L939
+L3639:
+	LD A, L
+L3640:
+	LD XIY, (L3640:24)
+L3641:
+	LD WA, 7536
+L3642:
+	LD A, 243
+L3643:
+	LD C, A
+L3644:
+	LD L, L
+L3645:
+	LD B, W
+L3646:
+	LD A, D
+L3647:
+	LD XIZ, L3648
+L3648:
+	LD IY, 63393
+L3649:
+	LDA XHL, (XIX+96)
+L3650:
+	LD H, 227
+L3651:
+	LD XHL, L3648
+L3652:
+	LD XHL, L480
+L3653:
+	LD D, 185
+L3654:
+	LD W, (XWA+108:8)
+L3655:
+	LD IX, 44208
+L3656:
+	LD XIX, L4541
+L3657:
+	LD XWA, L2925
+L3658:
+	LD D, 103
+L3659:
+	LD B, C
+L3660:
+	LD IY, 1170
+L3661:
+	LDA XIX, (XIX+8)
+L3662:
+	LD XHL, (XWA+)
+L3663:
+	LD IY, 47198
+L3664:
+	LD W, (XWA)
+L3665:
+	LD D, H
+L3666:
+	LD XBC, L395
+L3667:
+	LD D, (XHL)
+L3668:
+	LD XHL, L3666
+L3669:
+	LD (FAR), BC
+L3670:
+	LD B, A
+L3671:
+	LDA XHL, (XIX+44)
+L3672:
+	LD XIX, (XIX+30:8)
+L3673:
+	LD E, (XBC+)
+L3674:
+	LD (XBC+54:8), A
+L3675:
+	LD B, C
+L3676:
+	LD XBC, (XHL+71)
+L3677:
+	LD IZ, (-XIX)
+L3678:
+	LD B, 141
+L3679:
+	LDA XIY, (XIX+24)
+L3680:
+	LD WA, 29129
+L3681:
+	LD A, 8
+L3682:
+	LD A, 24
+L3683:
+	LD XWA, (XIX+723)
+L3684:
+	LD BC, (XDE+)
+L3685:
+	LD H, C
+L3686:
+	LD D, D
+L3687:
+	LD A, 142
+L3688:
+	LD BC, 12843
+L3689:
+	LD XIX, L3690
+L3690:
+	LDA XIX, (XIX+16)
+L3691:
+	LD C, W
+L3692:
+	LD (-XWA), E
+L3693:
+	LD XHL, (-XIX)
+L3694:
+	LD W, 206
+L3695:
+	LD IZ, (XIX+)
+L3696:
+	LD XIX, (XIZ+)
+L3697:
+	LDA XIX, (XIX+72)
+L3698:
+	LD H, A
+L3699:
+	LD (XIX+51), A
+L3700:
+	LD XIX, L3701
+L3701:
+	LD (-XHL), WA
+L3702:
+	LD IX, (XIX+)
+L3703:
+	LD (L3707:24), HL
+L3704:
+	LD C, A
+L3705:
+	LD IZ, 64835
+L3706:
+	LD (XWA+BC), A
+L3707:
+	LDA XIZ, (XIX+84)
+L3708:
+	LDA XIZ, (XIX+88)
+L3709:
+	LD IZ, 50827
+L3710:
+	LD IZ, 17075
+L3711:
+	LD XIY, (XIX+5:8)
+L3712:
+	LD XHL, (L3713:24)
+L3713:
+	LDA XWA, (XIX+84)
+L3714:
+	LD (XIX+1687), D
+L3715:
+	LDA XIY, (XIX+81)
+L3716:
+	LD IY, 3631
+L3717:
+	LD W, 69
+L3718:
+	LD IY, 8040
+L3719:
+	LD XHL, L3723
+L3720:
+	LD XIZ, L3720
+L3721:
+	LD XBC, L3721
+L3722:
+	LD (L2492:24), D
+L3723:
+	LD (XDE-41), L
+L3724:
+	LD HL, 43865
+L3725:
+	LD C, 35
+L3726:
+	LD BC, (-XWA)
+L3727:
+	LD XBC, L3723
+L3728:
+	LD C, 195
+L3729:
+	LD A, 12
+L3730:
+	LD BC, 55909
+L3731:
+	LD (XDE+), B
+L3732:
+	LD (XDE+8762:16), DE
+L3733:
+	LDA XIX, (XIX+63)
+L3734:
+	LD H, D
+L3735:
+	LDA XIZ, (XIX+60)
+L3736:
+	LD WA, 53713
+L3737:
+	LDA XIY, (XIX+60)
+L3738:
+	LD HL, 60443
+L3739:
+	LD L, H
+L3740:
+	LD XDE, L3442
+L3741:
+	LD XIX, L3739
+L3742:
+	LD XIY, L3742
+L3743:
+	LD W, 185
+L3744:
+	LD (XIX+2938), L
+L3745:
+	LD W, 39
+L3746:
+	LD B, 120
+L3747:
+	LD XHL, (XIZ+38)
+L3748:
+	LD W, 192
+L3749:
+	LD WA, 49789
+L3750:
+	LD D, 201
+L3751:
+	LDA XBC, (XIX+65)
+L3752:
+	LD E, 70
+L3753:
+	LD (L1626), HL
+L3754:
+	LD BC, (XWA+BC)
+L3755:
+	LD XDE, L3402
+L3756:
+	LD XWA, (XBC+79:8)
+L3757:
+	LDA XHL, (XIX+74)
+L3758:
+	LD E, (XIX+1808)
+L3759:
+	LD WA, (-XDE)
+L3760:
+	LD WA, 25814
+L3761:
+	LD B, (XBC+)
+L3762:
+	LD IZ, 49129
+L3763:
+	LD C, C
+L3764:
+	LD XBC, L3753
+L3765:
+	LD XIY, L3769
+L3766:
+	LD XIY, L3769
+L3767:
+	LD XDE, (XWA+3:8)
+L3768:
+	LD XBC, L3766
+L3769:
+	LD XWA, L3765
+L3770:
+	LD E, B
+L3771:
+	LD (XHL+50:8), H
+L3772:
+	LDA XBC, (XIX+70)
+L3773:
+	LDA XIY, (XIX+7)
+L3774:
+	LDA XDE, (XIX+87)
+L3775:
+	LD E, 7
+L3776:
+	LD D, 159
+L3777:
+	LDA XHL, (XIX+80)
+L3778:
+	LD H, 184
+L3779:
+	LD A, H
+L3780:
+	LD IY, (XDE)
+L3781:
+	LDA XBC, (XIX+61)
+L3782:
+	LD B, E
+L3783:
+	LD (XBC), B
+L3784:
+	LDA XIZ, (XIX+100)
+L3785:
+	LD IX, 22623
+L3786:
+	LD (L3787:24), B
+L3787:
+	LD XBC, (XBC-88)
+L3788:
+	LD XHL, L3784
+L3789:
+	LD XDE, (XIY+21340:16)
+L3790:
+	LD (XHL-14), H
+L3791:
+	LD WA, 30084
+L3792:
+	LD A, 30
+L3793:
+	LD A, (XIZ-90)
+L3794:
+	LD B, 206
+L3795:
+	LD HL, 15438
+L3796:
+	LD W, 181
+L3797:
+	LD (XIX+2403), C
+L3798:
+	LD (XIY-4), W
+L3799:
+	LD XDE, (L2113:24)
+L3800:
+	LD L, 17
+L3801:
+	LD IZ, 12898
+L3802:
+	LD E, 183
+L3803:
+	LD XDE, L3801
+L3804:
+	LD (XDE-16), HL
+L3805:
+	LD XHL, L3801
+L3806:
+	LD XWA, (XIY+)
+L3807:
+	LD IZ, (XWA+BC)
+L3808:
+	LD H, 232
+L3809:
+	LD (XWA+B), IY
+L3810:
+	LD H, D
+L3811:
+	LDA XIY, (XIX+55)
+L3812:
+	LD E, D
+L3813:
+	LD IZ, (L3816)
+L3814:
+	LD H, 196
+L3815:
+	LD H, W
+L3816:
+	LD C, E
+L3817:
+	LD WA, (XBC-97)
+L3818:
+	LD A, 63
+L3819:
+	LD DE, 33379
+L3820:
+	LD C, 54
+L3821:
+	LD XHL, L739
+L3822:
+	LD XDE, (XIX+1442)
+L3823:
+	LD (XWA+B), H
+L3824:
+	LDA XDE, (XIX+64)
+L3825:
+	LD XWA, L3825
+L3826:
+	LD XIZ, (XWA+)
+L3827:
+	LD B, C
+L3828:
+	LD IZ, (XWA+B)
+L3829:
+	LD L, (XIY+2:8)
+L3830:
+	LD XHL, (XBC+)
+L3831:
+	LD (XWA+23), A
+L3832:
+	LD (XBC+75:8), WA
+L3833:
+	LD XIX, (L3097)
+L3834:
+	LD A, B
+L3835:
+	LD XIX, (XIX+13274:16)
+L3836:
+	LD (L3834), HL
+L3837:
+	LD E, H
+L3838:
+	LD (XHL), W
+L3839:
+	LD C, 11
+L3840:
+	LD D, 249
+L3841:
+	LD XIY, (XIX+24)
+L3842:
+	LD (-XHL), DE
+L3843:
+	LD C, 242
+L3844:
+	LD IZ, 13112
+L3845:
+	LD XBC, (XWA+)
+L3846:
+	LD H, 127
+L3847:
+	LD B, C
+L3848:
+	LD C, W
+L3849:
+	LD XBC, (-XHL)
+L3850:
+	LD (L4619:24), W
+L3851:
+	LD L, C
+L3852:
+	LD BC, 31933
+L3853:
+	LD XIY, (L3849)
+L3854:
+	LD L, B
+L3855:
+	LD C, (-XHL)
+L3856:
+	LD XIX, (-XWA)
+L3857:
+	LD (XDE+42), A
+L3858:
+	LD B, (XIZ-7)
+L3859:
+	LD XIX, (XWA+BC)
+L3860:
+	LD (L3856), D
+L3861:
+	LD XIY, (XHL)
+L3862:
+	LD L, 99
+L3863:
+	LD XIX, (XDE+16659:16)
+L3864:
+	LD B, 58
+L3865:
+	LD C, L
+L3866:
+	LD DE, 28199
+L3867:
+	LD IY, 23714
+L3868:
+	LD (XDE+105:8), BC
+L3869:
+	LD BC, 46745
+L3870:
+	LDA XWA, (XIX+18)
+L3871:
+	LD XWA, (XIX+1898)
+L3872:
+	LD XIX, (XWA+12)
+L3873:
+	LD XIZ, L3875
+L3874:
+	LDA XHL, (XIX+76)
+L3875:
+	LD XIZ, L4312
+L3876:
+	LD D, 129
+L3877:
+	LD (BIGREG), HL
+L3878:
+	LD XIZ, (L3882)
+L3879:
+	LD WA, 18695
+L3880:
+	LD XIZ, (XIX+552)
+L3881:
+	LD (XHL+28321:16), C
+L3882:
+	LD IX, 54259
+L3883:
+	LD (L3881:24), H
+L3884:
+	LD WA, (XDE+51)
+L3885:
+	LDA XWA, (XIX+91)
+L3886:
+	LDA XDE, (XIX+72)
+L3887:
+	LD XDE, (XIZ+)
+L3888:
+	LD W, C
+L3889:
+	LD IX, 59640
+L3890:
+	LD (XBC-42), C
+L3891:
+	LD XWA, (XIX+1013)
+L3892:
+	LD C, 159
+L3893:
+	LDA XWA, (XIX+73)
+L3894:
+	LD W, (XHL+)
+L3895:
+	LD XIZ, L3898
+L3896:
+	LD (XWA+49:8), L
+L3897:
+	LD XIX, (-XWA)
+L3898:
+	LD E, 116
+L3899:
+	LD L, (BIGREG)
+L3900:
+	LDA XBC, (XIX+68)
+L3901:
+	LD L, 93
+L3902:
+	LD (-XIZ), A
+L3903:
+	LDA XHL, (XIX+81)
+L3904:
+	LD (XIX+2132), HL
+L3905:
+	LDA XDE, (XIX+52)
+L3906:
+	LD E, 95
+L3907:
+	LD XWA, L561
+L3908:
+	LD L, A
+L3909:
+	LD XIY, L3910
+L3910:
+	LD D, (XIX+)
+L3911:
+	LD E, 194
+L3912:
+	LD XBC, (XWA+BC)
+L3913:
+	LD XBC, (XIZ+9541:16)
+L3914:
+	LDA XIZ, (XIX+54)
+L3915:
+	LD DE, 25681
+L3916:
+	LD XBC, L3916
+L3917:
+	LD W, 191
+L3918:
+	LD BC, 11759
+L3919:
+	LD B, W
+L3920:
+	LDA XBC, (XIX+83)
+L3921:
+	LD A, H
+L3922:
+	LDA XHL, (XIX+60)
+L3923:
+	LD W, D
+L3924:
+	LD (XWA+16), E
+L3925:
+	LD XHL, (XHL+84)
+L3926:
+	LD (XWA+), IZ
+L3927:
+	LD L, 182
+L3928:
+	LD WA, 19631
+L3929:
+	LD DE, (XIX+67:8)
+L3930:
+	LD BC, 63333
+L3931:
+	LD L, 32
+L3932:
+	LD C, 133
+L3933:
+	LD XDE, (XIZ+12448:16)
+L3934:
+	LD XIY, L3227
+L3935:
+	LD L, D
+L3936:
+	LD XIX, (XIX+1688)
+L3937:
+	LDA XIX, (XIX+66)
+L3938:
+	LD (XHL-83), IY
+L3939:
+	LD XIX, L3937
+L3940:
+	LD IZ, 62876
+L3941:
+	LD WA, (XIX+1117)
+L3942:
+	LD H, 232
+L3943:
+	LD A, C
+L3944:
+	LD XIZ, (XWA)
+L3945:
+	LD XIY, L2970
+L3946:
+	LD E, A
+L3947:
+	LD L, 224
+L3948:
+	LD (XIX+1152), W
+L3949:
+	LD IX, 2746
+L3950:
+	LD IX, 57089
+L3951:
+	LDA XDE, (XIX+45)
+L3952:
+	LDA XIX, (XIX+34)
+L3953:
+	LD XHL, L1093
+L3954:
+	LD XIZ, (XHL+1008:16)
+L3955:
+	LDA XHL, (XIX+84)
+L3956:
+	LDA XIX, (XIX+52)
+L3957:
+	LD IX, 22043
+L3958:
+	LD DE, 41746
+L3959:
+	LD XIY, L3960
+L3960:
+	LD XDE, (XWA+B)
+L3961:
+	LD B, 70
+L3962:
+	LD XIZ, L3959
+L3963:
+	LDA XIY, (XIX+7)
+L3964:
+	LD (XDE+2:8), C
+L3965:
+	LD IZ, (XIY+63:8)
+L3966:
+	LD E, 69
+L3967:
+	LD BC, (XWA)
+L3968:
+	LD WA, 22679
+L3969:
+	LDA XWA, (XIX+39)
+L3970:
+	LD XWA, L3966
+L3971:
+	LD (XHL+62), IZ
+L3972:
+	LD H, 177
+L3973:
+	LD E, 19
+L3974:
+	LDA XIX, (XIX+36)
+L3975:
+	LD XDE, (XHL+)
+L3976:
+	LD XIZ, L3979
+L3977:
+	LD IX, 64405
+L3978:
+	LDA XBC, (XIX+44)
+L3979:
+	LD XWA, L3976
+L3980:
+	LD IY, 48274
+L3981:
+	LD IX, 33080
+L3982:
+	LD A, 248
+L3983:
+	LD XBC, (XWA+B)
+L3984:
+	LDA XIY, (XIX+91)
+L3985:
+	LD B, W
+L3986:
+	LD IZ, 10704
+L3987:
+	LD XDE, L3368
+L3988:
+	LD XIY, L3156
+L3989:
+	LD HL, (XHL+28987:16)
+L3990:
+	LDA XIY, (XIX+76)
+L3991:
+	LDA XIZ, (XIX+42)
+L3992:
+	LD L, 30
+L3993:
+	LD H, 157
+L3994:
+	LD DE, (XHL+)
+L3995:
+	LD XIY, L3999
+L3996:
+	LD IZ, 54080
+L3997:
+	LD DE, (XHL+113:8)
+L3998:
+	LD IZ, 10335
+L3999:
+	LD W, A
+L4000:
+	LD HL, (XIY-56)
+L4001:
+	LD (L4005), IZ
+L4002:
+	LD BC, 57459
+L4003:
+	LD D, 180
+L4004:
+	LD B, 121
+L4005:
+	LD WA, 20608
+L4006:
+	LD XIX, L4003
+L4007:
+	LDA XIY, (XIX+32)
+L4008:
+	LD H, (P0)
+L4009:
+	LD (XWA+88:8), C
+L4010:
+	LDA XWA, (XIX+87)
+L4011:
+	LD IX, 47190
+L4012:
+	LDA XIY, (XIX+19)
+L4013:
+	LD (XDE+), B
+L4014:
+	LD IZ, 8822
+L4015:
+	LD A, 123
+L4016:
+	LDA XIY, (XIX+5)
+L4017:
+	LDA XIY, (XIX+51)
+L4018:
+	LDA XWA, (XIX+70)
+L4019:
+	LD L, A
+L4020:
+	LD XIZ, (XIY)
+L4021:
+	LD WA, 46060
+L4022:
+	LD HL, 41053
+L4023:
+	LD XWA, (-XIY)
+L4024:
+	LD A, E
+L4025:
+	LD XBC, (XIY+64)
+L4026:
+	LD XDE, L4028
+L4027:
+	LDA XIY, (XIX+42)
+L4028:
+	LD XIY, L4031
+L4029:
+	LD XHL, (XWA-13)
+L4030:
+	LDA XBC, (XIX+81)
+L4031:
+	LD IX, 13411
+L4032:
+	LD B, (XDE-52)
+L4033:
+	LD XDE, L4030
+L4034:
+	LD (XWA+BC), BC
+L4035:
+	LD BC, (-XWA)
+L4036:
+	LDA XWA, (XIX+45)
+L4037:
+	LD (XWA+B), IY
+L4038:
+	LD W, B
+L4039:
+	LD W, 197
+L4040:
+	LDA XWA, (XIX+4)
+L4041:
+	LD L, 110
+L4042:
+	LD L, (XIX+848)
+L4043:
+	LD XDE, L4046
+L4044:
+	LD DE, 50180
+L4045:
+	LD IZ, (XIX+2794)
+L4046:
+	LD XHL, (XIX+244)
+L4047:
+	LD XHL, (XBC+30:8)
+L4048:
+	LD H, B
+L4049:
+	LD XBC, (XIY+122:8)
+L4050:
+	LD XBC, (L4053:24)
+L4051:
+	LD (XBC+6), H
+L4052:
+	LD A, (XIX+1303)
+L4053:
+	LDA XDE, (XIX+10)
+L4054:
+	LD L, L
+L4055:
+	LD XIX, L4053
+L4056:
+	LD (L3694:24), D
+L4057:
+	LD XIZ, (XIX+22:8)
+L4058:
+	LD DE, (XIY+)
+L4059:
+	LD XBC, (XIX+7332:16)
+L4060:
+	LD IX, (XIX+2360)
+L4061:
+	LD H, D
+L4062:
+	LD XIX, L4062
+L4063:
+	LD A, C
+L4064:
+	LD A, 32
+L4065:
+	LD H, B
+L4066:
+	LD W, A
+L4067:
+	LD C, 133
+L4068:
+	LD (-XIX), L
+L4069:
+	LD E, 253
+L4070:
+	LD D, 0
+L4071:
+	LD IZ, 5639
+L4072:
+	LD D, W
+L4073:
+	LD (FAR), L
+L4074:
+	LD DE, 61735
+L4075:
+	LD E, 228
+L4076:
+	LD H, 211
+L4077:
+	LDA XWA, (XIX+49)
+L4078:
+	LD H, 31
+L4079:
+	LD XIZ, L3256
+L4080:
+	LD B, H
+L4081:
+	LDA XDE, (XIX+34)
+L4082:
+	LD XHL, (XIY+28167:16)
+L4083:
+	LD E, A
+L4084:
+	LD HL, 56353
+L4085:
+	LD B, 173
+L4086:
+	LDA XBC, (XIX+83)
+L4087:
+	LD XHL, (XIZ+)
+L4088:
+	LDA XIX, (XIX+5)
+L4089:
+	LD L, (XDE)
+L4090:
+	LD D, 32
+L4091:
+	LD XIY, (L3305:24)
+L4092:
+	LD W, D
+L4093:
+	LD XDE, L4089
+L4094:
+	LD DE, 8820
+L4095:
+	LD XDE, (XIZ)
+L4096:
+	LD DE, 41044
+L4097:
+	LD (XWA+B), C
+L4098:
+	LD HL, (-XBC)
+L4099:
+	LD IX, 49507
+L4100:
+	LD HL, 39109
+L4101:
+	LD L, W
+L4102:
+	LD A, C
+L4103:
+	LD D, 65
+L4104:
+	LD XIY, (XIY+121:8)
+L4105:
+	LD D, (-XIZ)
+L4106:
+	LDA XIY, (XIX+4)
+L4107:
+	LD B, (XWA+)
+L4108:
+	LD C, L
+L4109:
+	LD C, 111
+L4110:
+	LD B, 121
+L4111:
+	LD (XWA+46:8), IY
+L4112:
+	LDA XHL, (XIX+28)
+L4113:
+	LD XHL, L4114
+L4114:
+	LD B, 66
+L4115:
+	LD IX, 56127
+L4116:
+	LD XHL, L4872
+L4117:
+	LDA XHL, (XIX+22)
+L4118:
+	LD (-XIX), IX
+L4119:
+	LD W, 46
+L4120:
+	LD E, 44
+L4121:
+	LD (L4117:24), IY
+L4122:
+	LD (L22), IY
+L4123:
+	LD XBC, (XIX+1945)
+L4124:
+	LDA XIZ, (XIX+43)
+L4125:
+	LDA XWA, (XIX+93)
+L4126:
+	LDA XIX, (XIX+59)
+L4127:
+	LDA XWA, (XIX+77)
+L4128:
+	LD XIX, (P0)
+L4129:
+	LDA XWA, (XIX+55)
+L4130:
+	LD XBC, L865
+L4131:
+	LD D, A
+L4132:
+	LD XWA, (XIY+13:8)
+L4133:
+	LD XBC, L3701
+L4134:
+	LDA XIZ, (XIX+9)
+L4135:
+	LD (L4139), D
+L4136:
+	LD (XIX+2276), IY
+L4137:
+	LD XIY, L4689
+L4138:
+	LD H, 251
+L4139:
+	LDA XWA, (XIX+79)
+L4140:
+	LDA XWA, (XIX+18)
+L4141:
+	LD (XIY), DE
+L4142:
+	LD XIX, (XWA+BC)
+L4143:
+	LD XIY, L4140
+L4144:
+	LD W, 103
+L4145:
+	LD IX, 49109
+L4146:
+	LDA XBC, (XIX+29)
+L4147:
+	LD D, (L4146)
+L4148:
+	LDA XIZ, (XIX+67)
+L4149:
+	LD W, E
+L4150:
+	LD XDE, (XWA+)
+L4151:
+	LDA XIY, (XIX+39)
+L4152:
+	LD H, 20
+L4153:
+	LD IY, 52724
+L4154:
+	LD E, 131
+L4155:
+	LDA XHL, (XIX+0)
+L4156:
+	LD BC, 44049
+L4157:
+	LD L, L
+L4158:
+	LD XIY, L4159
+L4159:
+	LD A, C
+L4160:
+	LD XIX, L4163
+L4161:
+	LD BC, (XHL+14)
+L4162:
+	LD (FAR), BC
+L4163:
+	LD XDE, L4316
+L4164:
+	LD XBC, L4168
+L4165:
+	LD B, 104
+L4166:
+	LD C, 96
+L4167:
+	LD (XWA+BC), IY
+L4168:
+	LD E, (XWA+BC)
+L4169:
+	LD C, W
+L4170:
+	LD (L4173:24), C
+L4171:
+	LD XIZ, (XBC+18)
+L4172:
+	LD W, 146
+L4173:
+	LD (L4170), DE
+L4174:
+	LD IZ, 63270
+L4175:
+	LD XHL, (L4177)
+L4176:
+	LD XDE, L4177
+L4177:
+	LD W, 63
+L4178:
+	LD IZ, 974
+L4179:
+	LD L, (XBC)
+L4180:
+	LD A, A
+L4181:
+	LD XWA, (XWA+B)
+L4182:
+	LD L, (L4185:24)
+L4183:
+	LD L, 219
+L4184:
+	LD (XIY+77:8), E
+L4185:
+	LD (XIX+2522), A
+L4186:
+	LD D, D
+L4187:
+	LD WA, 31829
+L4188:
+	LD IX, (XWA)
+L4189:
+	LD W, L
+L4190:
+	LD L, H
+L4191:
+	LD XIX, (L4187:24)
+L4192:
+	LDA XIX, (XIX+74)
+L4193:
+	LD D, H
+L4194:
+	LD XDE, (XDE+74)
+L4195:
+	LD XHL, L2872
+L4196:
+	LD IZ, 2374
+L4197:
+	LD DE, 21170
+L4198:
+	LD A, L
+L4199:
+	LD B, B
+L4200:
+	LD XIY, L4196
+L4201:
+	LD HL, 45708
+L4202:
+	LD D, 23
+L4203:
+	LD H, (XIZ+13)
+L4204:
+	LD HL, 36946
+L4205:
+	LD XIX, (-XIZ)
+L4206:
+	LD BC, 24543
+L4207:
+	LD XBC, (XIZ+3496:16)
+L4208:
+	LDA XWA, (XIX+17)
+L4209:
+	LD XIX, (L4208:24)
+L4210:
+	LD (XDE+), IX
+L4211:
+	LD L, D
+L4212:
+	LD XIY, (XHL+15198:16)
+L4213:
+	LD E, 158
+L4214:
+	LD WA, 27637
+L4215:
+	LD D, (XIX)
+L4216:
+	LD C, A
+L4217:
+	LD IX, (XBC+22891:16)
+L4218:
+	LD WA, 55994
+L4219:
+	LD (XWA+B), DE
+L4220:
+	LD DE, 45139
+L4221:
+	LDA XIX, (XIX+76)
+L4222:
+	LD IZ, 55202
+L4223:
+	LD IY, (-XWA)
+L4224:
+	LD DE, (XBC+24)
+L4225:
+	LD XIY, (L4227)
+L4226:
+	LD XHL, (XIX+13)
+L4227:
+	LD DE, (XIY+102:8)
+L4228:
+	LD W, B
+L4229:
+	LD C, A
+L4230:
+	LD DE, 55823
+L4231:
+	LD WA, 28674
+L4232:
+	LD H, (XWA+BC)
+L4233:
+	LD H, E
+L4234:
+	LD D, (-XBC)
+L4235:
+	LD (XIX-10), DE
+L4236:
+	LDA XHL, (XIX+96)
+L4237:
+	LD DE, 58626
+L4238:
+	LD DE, (XWA+BC)
+L4239:
+	LD (XBC-24), BC
+L4240:
+	LD XIX, (L3735:24)
+L4241:
+	LD XIZ, L4242
+L4242:
+	LD H, L
+L4243:
+	LD (FAR), A
+L4244:
+	LD B, 171
+L4245:
+	LD L, 4
+L4246:
+	LD HL, 14644
+L4247:
+	LD HL, 5409
+L4248:
+	LD B, 42
+L4249:
+	LD IZ, (L4247)
+L4250:
+	LD H, (XIY)
+L4251:
+	LD XIX, (XIY)
+L4252:
+	LD IY, (-XIX)
+L4253:
+	LD DE, 55196
+L4254:
+	LD D, 229
+L4255:
+	LD HL, 55154
+L4256:
+	LDA XDE, (XIX+11)
+L4257:
+	LD XIY, L4309
+L4258:
+	LD (XDE-49), H
+L4259:
+	LD H, 234
+L4260:
+	LD (XIX+2294:16), HL
+L4261:
+	LD XWA, L4262
+L4262:
+	LD (L4264:24), BC
+L4263:
+	LD HL, 45986
+L4264:
+	LD L, B
+L4265:
+	LD WA, 53209
+L4266:
+	LDA XDE, (XIX+87)
+L4267:
+	LD XIZ, (XIX)
+L4268:
+	LD BC, (XIX+39:8)
+L4269:
+	LD E, (XIZ+46)
+L4270:
+	LD XIZ, L448
+L4271:
+	LD B, B
+L4272:
+	LD L, H
+L4273:
+	LD (L4270:24), IX
+L4274:
+	LD IX, (BIGREG)
+L4275:
+	LD A, E
+L4276:
+	LD B, 127
+L4277:
+	LD B, A
+L4278:
+	LDA XWA, (XIX+17)
+L4279:
+	LDA XIY, (XIX+53)
+L4280:
+	LD (L4279), W
+L4281:
+	LD XWA, L4279
+L4282:
+	LD (L886), D
+L4283:
+	LD E, (XIX+49)
+L4284:
+	LD W, L
+L4285:
+	LD (XBC+), D
+L4286:
+	LD L, A
+L4287:
+	LD HL, (XWA+B)
+L4288:
+	LD XDE, L4284
+L4289:
+	LD E, H
+L4290:
+	LD C, L
+L4291:
+	LD A, A
+L4292:
+	LD (XIX+), A
+L4293:
+	LD XIY, L4293
+L4294:
+	LD IZ, 28863
+L4295:
+	LD B, 238
+L4296:
+	LDA XDE, (XIX+98)
+L4297:
+	LDA XIZ, (XIX+2)
+L4298:
+	LD XDE, (XIX+43:8)
+L4299:
+	LD A, (L4299:24)
+L4300:
+	LD (-XBC), DE
+L4301:
+	LDA XIZ, (XIX+92)
+L4302:
+	LD A, 40
+L4303:
+	LD IX, 43461
+L4304:
+	LD XWA, L4304
+L4305:
+	LD (XWA), H
+L4306:
+	LD IZ, 54789
+L4307:
+	LD (L4308:24), A
+L4308:
+	LD (XWA+BC), D
+L4309:
+	LD (XIX+1505), D
+L4310:
+	LD C, 79
+L4311:
+	LD XIZ, (L4315:24)
+L4312:
+	LD XWA, (XWA)
+L4313:
+	LD BC, (XWA+B)
+L4314:
+	LD (XIX+441), DE
+L4315:
+	LDA XDE, (XIX+76)
+L4316:
+	LDA XIZ, (XIX+42)
+L4317:
+	LD D, 203
+L4318:
+	LD BC, 52169
+L4319:
+	LD XIZ, (XBC+1476:16)
+L4320:
+	LD XIZ, L4322
+L4321:
+	LD XWA, (L4319)
+L4322:
+	LD C, (-XDE)
+L4323:
+	LD (L4326), W
+L4324:
+	LD (XWA), H
+L4325:
+	LD XBC, L2827
+L4326:
+	LD (-XIZ), DE
+L4327:
+	LD H, A
+L4328:
+	LD XWA, (L4331)
+L4329:
+	LD D, A
+L4330:
+	LD D, A
+L4331:
+	LD (XWA+BC), IX
+L4332:
+	LD H, 230
+L4333:
+	LD XIX, (FAR)
+L4334:
+	LD XBC, L4336
+L4335:
+	LD (L4336), H
+L4336:
+	LD IZ, 49001
+L4337:
+	LD XIY, L4337
+L4338:
+	LD B, W
+L4339:
+	LD XIY, (-XWA)
+L4340:
+	LD B, W
+L4341:
+	LD DE, 19975
+L4342:
+	LD XIY, L3385
+L4343:
+	LD XBC, L4898
+L4344:
+	LD HL, (BIGREG)
+L4345:
+	LD XHL, (L4341:24)
+L4346:
+	LD W, 105
+L4347:
+	LD HL, 7589
+L4348:
+	LD DE, 2913
+L4349:
+	LD XDE, L4351
+L4350:
+	LD XIY, (XBC+)
+L4351:
+	LD XDE, (XDE-46)
+L4352:
+	LD XBC, (XWA+4427:16)
+L4353:
+	LDA XBC, (XIX+98)
+L4354:
+	LD W, (L4357)
+L4355:
+	LDA XBC, (XIX+12)
+L4356:
+	LD H, 241
+L4357:
+	LD XIY, L2094
+L4358:
+	LDA XHL, (XIX+22)
+L4359:
+	LD (XBC+88:8), IX
+L4360:
+	LD (XIX+563), DE
+L4361:
+	LD XHL, L4363
+L4362:
+	LDA XWA, (XIX+6)
+L4363:
+	LDA XDE, (XIX+34)
+L4364:
+	LD XIY, L4363
+L4365:
+	LD XIX, L4336
+L4366:
+	LD XDE, (XHL+)
+L4367:
+	LD E, C
+L4368:
+	LD A, (XWA+BC)
+L4369:
+	LD C, 49
+L4370:
+	LD B, 156
+L4371:
+	LD E, C
+L4372:
+	LD (XHL-95), IX
+L4373:
+	LD XIZ, L4376
+L4374:
+	LD BC, (-XBC)
+L4375:
+	LD WA, 19738
+L4376:
+	LD XDE, L4378
+L4377:
+	LD IY, 55168
+L4378:
+	LD B, (XIY+53)
+L4379:
+	LD (-XWA), A
+L4380:
+	LD XBC, L4382
+L4381:
+	LD WA, 54844
+L4382:
+	LD H, (FAR)
+L4383:
+	LDA XDE, (XIX+69)
+L4384:
+	LD XHL, L4380
+L4385:
+	LD IX, 11757
+L4386:
+	LD (L4387), IX
+L4387:
+	LD XBC, L566
+L4388:
+	LD C, 127
+L4389:
+	LD XWA, L4385
+L4390:
+	LD HL, 65340
+L4391:
+	LD XIX, (L4394:24)
+L4392:
+	LD HL, 33228
+L4393:
+	LD XIY, L4768
+L4394:
+	LD XIX, (XWA)
+L4395:
+	LD XIX, L4394
+L4396:
+	LD IX, (XIX+63:8)
+L4397:
+	LD L, (XIY+)
+L4398:
+	LD A, 214
+L4399:
+	LD A, 100
+L4400:
+	LD IY, 59333
+L4401:
+	LD (XIZ+4863:16), WA
+L4402:
+	LD XIX, L3516
+L4403:
+	LD (XDE+), HL
+L4404:
+	LD W, 138
+L4405:
+	LD B, B
+L4406:
+	LD IY, 2114
+L4407:
+	LD XHL, L4404
+L4408:
+	LD D, 50
+L4409:
+	LD DE, (XIX+2674)
+L4410:
+	LD H, L
+L4411:
+	LD W, (XWA+BC)
+L4412:
+	LD BC, (XHL+15409:16)
+L4413:
+	LD A, C
+L4414:
+	LD XDE, (XDE-19)
+L4415:
+	LD A, H
+L4416:
+	LD W, (XIZ+6:8)
+L4417:
+	LD IX, (XIY-92)
+L4418:
+	LD XIZ, (XDE+125:8)
+L4419:
+	LD (XIX+37), IX
+L4420:
+	LD XHL, L4418
+L4421:
+	LD XHL, (XWA+44)
+L4422:
+	LD E, (XDE+60)
+L4423:
+	LD XIZ, (-XDE)
+L4424:
+	LD (XIY+49), IX
+L4425:
+	LD (-XIZ), IZ
+L4426:
+	LD HL, (XWA+B)
+L4427:
+	LD E, W
+L4428:
+	LD DE, 19329
+L4429:
+	LDA XIX, (XIX+14)
+L4430:
+	LDA XDE, (XIX+85)
+L4431:
+	LD A, 63
+L4432:
+	LD IZ, 42093
+L4433:
+	LD E, 148
+L4434:
+	LD IY, 30091
+L4435:
+	LD (XBC+48:8), A
+L4436:
+	LDA XHL, (XIX+26)
+L4437:
+	LD XIY, L4062
+L4438:
+	LDA XIY, (XIX+44)
+L4439:
+	LD L, W
+L4440:
+	LD XDE, (P0)
+L4441:
+	LDA XIX, (XIX+51)
+L4442:
+	LD XIY, L4438
+L4443:
+	LD C, (L4446:24)
+L4444:
+	LD XBC, L4797
+L4445:
+	LD XHL, L4448
+L4446:
+	LD H, E
+L4447:
+	LD XIX, L4448
+L4448:
+	LDA XIY, (XIX+55)
+L4449:
+	LD (XDE), A
+L4450:
+	LD XWA, (XHL+)
+L4451:
+	LD H, L
+L4452:
+	LD E, (P0)
+L4453:
+	LD H, 251
+L4454:
+	LD B, H
+L4455:
+	LD XDE, (XBC+25135:16)
+L4456:
+	LD (L4458), IY
+L4457:
+	LD DE, 24584
+L4458:
+	LD XWA, L4459
+L4459:
+	LD HL, 17573
+L4460:
+	LD (P0), W
+L4461:
+	LD IY, 52946
+L4462:
+	LD BC, (-XDE)
+L4463:
+	LD IX, (XHL+109:8)
+L4464:
+	LD H, (L3809)
+L4465:
+	LD IX, (XWA+)
+L4466:
+	LD H, A
+L4467:
+	LD H, 81
+L4468:
+	LDA XBC, (XIX+22)
+L4469:
+	LD (XWA+B), B
+L4470:
+	LD IX, 31711
+L4471:
+	LDA XWA, (XIX+14)
+L4472:
+	LD H, B
+L4473:
+	LDA XWA, (XIX+45)
+L4474:
+	LD D, H
+L4475:
+	LD (XWA-33), IY
+L4476:
+	LDA XIX, (XIX+6)
+L4477:
+	LD C, 101
+L4478:
+	LD XHL, L4477
+L4479:
+	LD XBC, L4480
+L4480:
+	LD XIZ, (XDE)
+L4481:
+	LD W, H
+L4482:
+	LD BC, (XWA+BC)
+L4483:
+	LDA XIY, (XIX+83)
+L4484:
+	LD B, L
+L4485:
+	LD XHL, L4483
+L4486:
+	LD XIZ, (-XIY)
+L4487:
+	LDA XDE, (XIX+7)
+L4488:
+	LDA XWA, (XIX+56)
+L4489:
+	LD H, C
+L4490:
+	LD D, (XIX+)
+L4491:
+	LD L, 56
+L4492:
+	LDA XWA, (XIX+99)
+L4493:
+	LD D, 181
+L4494:
+	LD IX, (P0)
+L4495:
+	LDA XIY, (XIX+21)
+L4496:
+	LD IY, (L140)
+L4497:
+	LD XBC, L4495
+L4498:
+	LD W, 125
+L4499:
+	LD B, (L4495:24)
+L4500:
+	LD BC, (XIY+)
+L4501:
+	LD XIX, L4499
+L4502:
+	LD WA, 22356
+L4503:
+	LD (XIY+), D
+L4504:
+	LD D, 7
+L4505:
+	LD (XWA+BC), W
+L4506:
+	LD C, C
+L4507:
+	LD XBC, L1977
+L4508:
+	LD E, L
+L4509:
+	LD C, L
+L4510:
+	LDA XHL, (XIX+65)
+L4511:
+	LD (XBC+), L
+L4512:
+	LD XBC, (L658)
+L4513:
+	LD H, (-XHL)
+L4514:
+	LD D, (L4518:24)
+L4515:
+	LD XIY, L4518
+L4516:
+	LD W, D
+L4517:
+	LD WA, 56691
+L4518:
+	LD D, (-XDE)
+L4519:
+	LDA XBC, (XIX+65)
+L4520:
+	LDA XIY, (XIX+6)
+L4521:
+	LD (XIX+1720), IY
+L4522:
+	LDA XIX, (XIX+95)
+L4523:
+	LD L, 183
+L4524:
+	LD XIX, L2382
+L4525:
+	LD DE, 60159
+L4526:
+	LD DE, 20719
+L4527:
+	LD E, L
+L4528:
+	LDA XHL, (XIX+50)
+L4529:
+	LD XHL, L4526
+L4530:
+	LD WA, (XWA+B)
+L4531:
+	LD XIX, (L1585:24)
+L4532:
+	LD D, B
+L4533:
+	LD (XIZ+), E
+L4534:
+	LD XBC, L4531
+L4535:
+	LD (XDE), A
+L4536:
+	LD E, E
+L4537:
+	LD B, 38
+L4538:
+	LD D, H
+L4539:
+	LD IY, (-XIX)
+L4540:
+	LD WA, (XWA+)
+L4541:
+	LD A, 183
+L4542:
+	LD XBC, L2019
+L4543:
+	LDA XIZ, (XIX+46)
+L4544:
+	LDA XBC, (XIX+91)
+L4545:
+	LD D, 156
+L4546:
+	LD B, (XIY-24)
+L4547:
+	LD XIY, (L4543:24)
+L4548:
+	LD HL, 1129
+L4549:
+	LD H, H
+L4550:
+	LD DE, 8632
+L4551:
+	LD IX, 20646
+L4552:
+	LD XHL, L4549
+L4553:
+	LD XDE, L4557
+L4554:
+	LD XIZ, (XIX)
+L4555:
+	LDA XIZ, (XIX+95)
+L4556:
+	LD XDE, (XIX+77)
+L4557:
+	LD C, 180
+L4558:
+	LD XIZ, (XIY-96)
+L4559:
+	LD (XIX+628), A
+L4560:
+	LD XHL, (XIY)
+L4561:
+	LD B, (XIX+2008)
+L4562:
+	LD XHL, (XHL+54:8)
+L4563:
+	LD BC, 27318
+L4564:
+	LD XWA, (XDE)
+L4565:
+	LD D, (XWA+BC)
+L4566:
+	LD L, 70
+L4567:
+	LD BC, (XBC)
+L4568:
+	LD WA, 16059
+L4569:
+	LD XHL, (XIX+2297)
+L4570:
+	LD XHL, L1861
+L4571:
+	LD H, L
+L4572:
+	LDA XIZ, (XIX+88)
+L4573:
+	LDA XDE, (XIX+0)
+L4574:
+	LD XWA, L4574
+L4575:
+	LD E, (XWA+BC)
+L4576:
+	LD BC, 33430
+L4577:
+	LD HL, 44941
+L4578:
+	LD HL, (XHL)
+L4579:
+	LD B, H
+L4580:
+	LD A, D
+L4581:
+	LD B, C
+L4582:
+	LD (XIX+2784), A
+L4583:
+	LD XBC, L4853
+L4584:
+	LD (XHL-83), IY
+L4585:
+	LD W, 23
+L4586:
+	LD A, L
+L4587:
+	LD W, 215
+L4588:
+	LD XHL, L4584
+L4589:
+	LDA XHL, (XIX+67)
+L4590:
+	LD W, 133
+L4591:
+	LD HL, 48426
+L4592:
+	LD E, 44
+L4593:
+	LD L, 145
+L4594:
+	LD XHL, L4591
+L4595:
+	LD XWA, L2406
+L4596:
+	LD XBC, L4597
+L4597:
+	LD C, (-XIX)
+L4598:
+	LD D, A
+L4599:
+	LDA XIY, (XIX+91)
+L4600:
+	LD (XIY+122:8), L
+L4601:
+	LD D, 150
+L4602:
+	LD XBC, (L3507:24)
+L4603:
+	LD (L4606:24), H
+L4604:
+	LD A, A
+L4605:
+	LD IZ, 61203
+L4606:
+	LD L, 38
+L4607:
+	LD L, H
+L4608:
+	LDA XWA, (XIX+28)
+L4609:
+	LDA XBC, (XIX+100)
+L4610:
+	LD C, 16
+L4611:
+	LDA XDE, (XIX+77)
+L4612:
+	LD W, 29
+L4613:
+	LD A, 47
+L4614:
+	LD B, A
+L4615:
+	LD A, C
+L4616:
+	LDA XDE, (XIX+46)
+L4617:
+	LD XBC, L1499
+L4618:
+	LD XHL, L3220
+L4619:
+	LD W, A
+L4620:
+	LD IY, (XIZ+74)
+L4621:
+	LD XHL, L4624
+L4622:
+	LD XBC, (XWA+BC)
+L4623:
+	LD HL, 3817
+L4624:
+	LD A, (XIX+2936)
+L4625:
+	LD (-XHL), IX
+L4626:
+	LD C, E
+L4627:
+	LD XHL, (L4630:24)
+L4628:
+	LD XIY, L4627
+L4629:
+	LD L, D
+L4630:
+	LD XIY, (XIX)
+L4631:
+	LD DE, 38006
+L4632:
+	LD WA, (XIZ+19674:16)
+L4633:
+	LD (XHL), L
+L4634:
+	LD (XWA+B), DE
+L4635:
+	LD (XIX+12015:16), L
+L4636:
+	LD D, (XIY-92)
+L4637:
+	LD XHL, L4635
+L4638:
+	LD BC, 15917
+L4639:
+	LD WA, 42894
+L4640:
+	LD E, D
+L4641:
+	LD XBC, L1934
+L4642:
+	LD BC, 2792
+L4643:
+	LD (P0), IY
+L4644:
+	LD XWA, L4647
+L4645:
+	LD XWA, (XHL+36:8)
+L4646:
+	LDA XWA, (XIX+92)
+L4647:
+	LD H, L
+L4648:
+	LD L, 207
+L4649:
+	LD D, 195
+L4650:
+	LD A, 89
+L4651:
+	LD E, D
+L4652:
+	LD XWA, L4654
+L4653:
+	LD B, (L4651:24)
+L4654:
+	LD E, D
+L4655:
+	LD (XIX+2088), DE
+L4656:
+	LDA XDE, (XIX+12)
+L4657:
+	LD XHL, L4661
+L4658:
+	LD B, (XIZ)
+L4659:
+	LD XIX, (L4663:24)
+L4660:
+	LD C, 85
+L4661:
+	LD A, C
+L4662:
+	LD (XIZ-15), IZ
+L4663:
+	LD W, 141
+L4664:
+	LD IY, 52859
+L4665:
+	LD (L4666:24), WA
+L4666:
+	LDA XIY, (XIX+56)
+L4667:
+	LD (XIX+14324:16), IZ
+L4668:
+	LD XHL, L4669
+L4669:
+	LD BC, (L4670:24)
+L4670:
+	LD XBC, (XWA+BC)
+L4671:
+	LD XBC, L4667
+L4672:
+	LD (XWA+BC), HL
+L4673:
+	LD A, L
+L4674:
+	LD (XIX+849), IX
+L4675:
+	LD B, D
+L4676:
+	LD XIX, L4674
+L4677:
+	LD D, W
+L4678:
+	LD XHL, L4674
+L4679:
+	LD IY, 5148
+L4680:
+	LDA XIZ, (XIX+64)
+L4681:
+	LD IZ, (XWA+B)
+L4682:
+	LD W, L
+L4683:
+	LD B, (XHL+8260:16)
+L4684:
+	LD HL, 4574
+L4685:
+	LDA XIX, (XIX+99)
+L4686:
+	LD E, 187
+L4687:
+	LD L, (XDE+12120:16)
+L4688:
+	LD WA, 4362
+L4689:
+	LD D, 97
+L4690:
+	LDA XIX, (XIX+51)
+L4691:
+	LD L, (XIY-92)
+L4692:
+	LD E, 216
+L4693:
+	LDA XIX, (XIX+89)
+L4694:
+	LDA XIY, (XIX+44)
+L4695:
+	LD XHL, L4695
+L4696:
+	LD (XWA+26:8), L
+L4697:
+	LD (XDE), BC
+L4698:
+	LD (XBC+71:8), H
+L4699:
+	LD W, 101
+L4700:
+	LD XHL, L4703
+L4701:
+	LD BC, (XHL+29:8)
+L4702:
+	LDA XIX, (XIX+33)
+L4703:
+	LD HL, 22171
+L4704:
+	LD XWA, (XWA+B)
+L4705:
+	LD HL, 46017
+L4706:
+	LD (XWA+), W
+L4707:
+	LD A, 81
+L4708:
+	LD XIY, L4535
+L4709:
+	LD C, 218
+L4710:
+	LD (XIX+960), HL
+L4711:
+	LDA XIZ, (XIX+62)
+L4712:
+	LD L, 52
+L4713:
+	LD XIZ, L4712
+L4714:
+	LD XBC, (XHL+23:8)
+L4715:
+	LDA XIZ, (XIX+17)
+L4716:
+	LD DE, (-XHL)
+L4717:
+	LDA XHL, (XIX+82)
+L4718:
+	LD XIX, L4716
+L4719:
+	LD XBC, (XDE-8)
+L4720:
+	LDA XBC, (XIX+13)
+L4721:
+	LD XIZ, L4718
+L4722:
+	LD XIX, L4718
+L4723:
+	LD IZ, (XIX+2606)
+L4724:
+	LD XWA, (L4721)
+L4725:
+	LD BC, 29894
+L4726:
+	LD XDE, L4726
+L4727:
+	LD WA, 24852
+L4728:
+	LD BC, 1785
+L4729:
+	LDA XDE, (XIX+52)
+L4730:
+	LD C, (XWA+)
+L4731:
+	LD (XIY-28), WA
+L4732:
+	LD XWA, L4602
+L4733:
+	LD WA, 13940
+L4734:
+	LD W, 11
+L4735:
+	LDA XIZ, (XIX+73)
+L4736:
+	LD IX, 35949
+L4737:
+	LD BC, 29711
+L4738:
+	LD XWA, L4742
+L4739:
+	LD IX, (P0)
+L4740:
+	LD XDE, (XDE+)
+L4741:
+	LDA XWA, (XIX+26)
+L4742:
+	LD C, 236
+L4743:
+	LD HL, 29772
+L4744:
+	LD XDE, L4743
+L4745:
+	LD H, 47
+L4746:
+	LD WA, (XIX+1373)
+L4747:
+	LD XBC, L4746
+L4748:
+	LD W, 123
+L4749:
+	LD HL, 54390
+L4750:
+	LD DE, 63490
+L4751:
+	LD H, 187
+L4752:
+	LD B, (L4756)
+L4753:
+	LD B, L
+L4754:
+	LD IZ, (XDE-83)
+L4755:
+	LD XDE, (XWA+BC)
+L4756:
+	LD IZ, 49854
+L4757:
+	LD XIX, (L3620:24)
+L4758:
+	LD C, (L4761:24)
+L4759:
+	LD XIY, L4758
+L4760:
+	LD (XIX+2128), BC
+L4761:
+	LD L, 186
+L4762:
+	LD H, W
+L4763:
+	LD XIZ, (XIX+2007)
+L4764:
+	LD W, 151
+L4765:
+	LDA XHL, (XIX+76)
+L4766:
+	LD (XBC), C
+L4767:
+	LD IZ, (XBC+18)
+L4768:
+	LDA XIZ, (XIX+1)
+L4769:
+	LDA XBC, (XIX+84)
+L4770:
+	LD (XDE+), D
+L4771:
+	LD (P0), E
+L4772:
+	LD B, W
+L4773:
+	LD (-XBC), W
+L4774:
+	LD WA, (XIX+599)
+L4775:
+	LD XIX, (XBC)
+L4776:
+	LD E, (L4773:24)
+L4777:
+	LDA XHL, (XIX+21)
+L4778:
+	LD XWA, L4776
+L4779:
+	LD E, H
+L4780:
+	LD WA, 28223
+L4781:
+	LD WA, 22556
+L4782:
+	LD H, 60
+L4783:
+	LD WA, (-XBC)
+L4784:
+	LD XIY, (XBC)
+L4785:
+	LD A, (L4788:24)
+L4786:
+	LD XIZ, (XIX+2686)
+L4787:
+	LDA XIX, (XIX+2)
+L4788:
+	LD DE, 64463
+L4789:
+	LD L, 185
+L4790:
+	LD D, A
+L4791:
+	LD HL, 58501
+L4792:
+	LD XIZ, (XWA+35:8)
+L4793:
+	LD XIZ, L4791
+L4794:
+	LD XDE, (XWA+39)
+L4795:
+	LD (XBC-60), E
+L4796:
+	LD (XWA+BC), E
+L4797:
+	LD HL, 53201
+L4798:
+	LD (-XHL), BC
+L4799:
+	LDA XWA, (XIX+79)
+L4800:
+	LD A, D
+L4801:
+	LDA XWA, (XIX+79)
+L4802:
+	LD (XHL-40), DE
+L4803:
+	LD (XBC+97:8), WA
+L4804:
+	LD A, 4
+L4805:
+	LD (XIX+2649), D
+L4806:
+	LDA XIZ, (XIX+5)
+L4807:
+	LD C, H
+L4808:
+	LDA XIX, (XIX+94)
+L4809:
+	LD H, 154
+L4810:
+	LD XIX, (XIY+70:8)
+L4811:
+	LD E, 97
+L4812:
+	LD XWA, (XHL)
+L4813:
+	LD XDE, L4809
+L4814:
+	LD A, A
+L4815:
+	LD XBC, L4816
+L4816:
+	LD D, C
+L4817:
+	LDA XDE, (XIX+20)
+L4818:
+	LD BC, 60502
+L4819:
+	LD XHL, (L4822)
+L4820:
+	LDA XHL, (XIX+96)
+L4821:
+	LD B, A
+L4822:
+	LD XDE, (XDE+71)
+L4823:
+	LD XIY, (P0)
+L4824:
+	LD D, 16
+L4825:
+	LD XIX, (XIX+570)
+L4826:
+	LD IZ, (XIX+727)
+L4827:
+	LD H, 143
+L4828:
+	LD XBC, (XDE+4)
+L4829:
+	LD IX, 7803
+L4830:
+	LD E, 99
+L4831:
+	LD C, 255
+L4832:
+	LD W, 81
+L4833:
+	LD XIZ, (XIZ)
+L4834:
+	LD D, W
+L4835:
+	LD XIY, L4838
+L4836:
+	LD XDE, L4833
+L4837:
+	LD XIY, L670
+L4838:
+	LD IX, 37057
+L4839:
+	LD (XIX-24), DE
+L4840:
+	LD (XDE), HL
+L4841:
+	LD HL, (L4840:24)
+L4842:
+	LD (XHL), IX
+L4843:
+	LD XDE, (XIZ-2)
+L4844:
+	LD E, W
+L4845:
+	LD HL, (-XIZ)
+L4846:
+	LD XIY, (XBC+29854:16)
+L4847:
+	LD H, (XIZ)
+L4848:
+	LD D, 245
+L4849:
+	LD W, H
+L4850:
+	LD XHL, (XIX+1294)
+L4851:
+	LDA XWA, (XIX+85)
+L4852:
+	LD W, L
+L4853:
+	LD (XIY-53), H
+L4854:
+	LD C, 222
+L4855:
+	LD B, L
+L4856:
+	LD XIX, (P0)
+L4857:
+	LD D, 241
+L4858:
+	LD (XDE-73), IX
+L4859:
+	LD L, 54
+L4860:
+	LD H, 227
+L4861:
+	LD C, 59
+L4862:
+	LDA XIY, (XIX+91)
+L4863:
+	LD E, W
+L4864:
+	LD WA, (-XHL)
+L4865:
+	LD W, A
+L4866:
+	LD (XIY+), DE
+L4867:
+	LD XIX, (XIX+27039:16)
+L4868:
+	LD IX, 34753
+L4869:
+	LD (XDE+13), HL
+L4870:
+	LD (XIX), HL
+L4871:
+	LD L, H
+L4872:
+	LD C, L
+L4873:
+	LD A, C
+L4874:
+	LD IY, 49525
+L4875:
+	LDA XWA, (XIX+92)
+L4876:
+	LD C, 162
+L4877:
+	LD E, 91
+L4878:
+	LD XWA, L4881
+L4879:
+	LD L, (XIY+20152:16)
+L4880:
+	LD IZ, (-XHL)
+L4881:
+	LD XIY, (XBC+19627:16)
+L4882:
+	LD IZ, 34551
+L4883:
+	LD IX, 28076
+L4884:
+	LD D, 6
+L4885:
+	LD (XIX+1041), E
+L4886:
+	LDA XHL, (XIX+11)
+L4887:
+	LD IX, 63185
+L4888:
+	LD A, L
+L4889:
+	LD E, 241
+L4890:
+	LD A, 78
+L4891:
+	LD IZ, 24367
+L4892:
+	LD XIX, (XWA+B)
+L4893:
+	LD XDE, (L4890)
+L4894:
+	LD C, 254
+L4895:
+	LD XIY, (XWA+BC)
+L4896:
+	LDA XDE, (XIX+27)
+L4897:
+	LDA XDE, (XIX+40)
+L4898:
+	LD DE, 14373
+L4899:
+	LDA XIY, (XIX+59)
+L4900:
+	LD (XHL+2626:16), DE
+L4901:
+	LD D, 150
+L4902:
+	LD H, E
+L4903:
+	LD XIX, L4903
+L4904:
+	LD D, 183
+L4905:
+	LD IX, 53874
+L4906:
+	LD XBC, L4908
+L4907:
+	LD (XBC), WA
+L4908:
+	LD XBC, L4912
+L4909:
+	LD (XIZ), HL
+L4910:
+	LD IY, 54601
+L4911:
+	LD B, E
+L4912:
+	LD XWA, (XHL+88)
+L4913:
+	LD XBC, (XDE+71)
+L4914:
+	LD B, 166
+L4915:
+	LD XWA, L2191
+L4916:
+	LD (XHL+57:8), HL
+L4917:
+	LD XIY, (BIGREG)
+L4918:
+	LD XIY, L4917
+L4919:
+	LD XDE, (-XWA)
+L4920:
+	LD XIZ, L4916
+L4921:
+	LD XIZ, (L4917:24)
+L4922:
+	LD IY, 11117
+L4923:
+	LD B, 105
+L4924:
+	LD L, B
+L4925:
+	LD BC, 2180
+L4926:
+	LDA XDE, (XIX+62)
+L4927:
+	LDA XBC, (XIX+90)
+L4928:
+	LD D, 137
+L4929:
+	LD H, W
+L4930:
+	LD XBC, L3977
+L4931:
+	LD IX, (XIX+14102:16)
+L4932:
+	LD BC, (XDE+)
+L4933:
+	LD XIZ, L4932
+L4934:
+	LD XDE, (XHL+106:8)
+L4935:
+	LD DE, 8101
+L4936:
+	LD XWA, L4940
+L4937:
+	LDA XIY, (XIX+49)
+L4938:
+	LDA XIX, (XIX+77)
+L4939:
+	LD XHL, L4936
+L4940:
+	LD DE, 44872
+L4941:
+	LD XBC, (XIX+118:8)
+L4942:
+	LD (XBC+73:16), BC
+L4943:
+	LD WA, 37106
+L4944:
+	LDA XIX, (XIX+79)
+L4945:
+	LD E, C
+L4946:
+	LDA XDE, (XIX+11)
+L4947:
+	LDA XBC, (XIX+60)
+L4948:
+	LD L, C
+L4949:
+	LD IX, 35208
+L4950:
+	LD DE, 61371
+L4951:
+	LD E, 197
+L4952:
+	LDA XIX, (XIX+22)
+L4953:
+	LD B, (XIY+13453:16)
+L4954:
+	LD XHL, (XBC)
+L4955:
+	LD XIY, L4955
+L4956:
+	LD HL, 52416
+L4957:
+	LDA XIX, (XIX+58)
+L4958:
+	LD H, E
+L4959:
+	LD H, (XIY)
+L4960:
+	LD W, (XBC-4)
+L4961:
+	LD C, C
+L4962:
+	LD XIY, (XIX+22)
+L4963:
+	LD IY, 19773
+L4964:
+	LDA XIZ, (XIX+91)
+L4965:
+	LD W, H
+L4966:
+	LD XIX, L4965
+L4967:
+	LD E, 214
+L4968:
+	LD E, (XBC-5)
+L4969:
+	LD L, 12
+L4970:
+	LD DE, 26511
+L4971:
+	LD XIY, L4974
+L4972:
+	LD XWA, L133
+L4973:
+	LD IY, 58807
+L4974:
+	LDA XHL, (XIX+89)
+L4975:
+	LD W, A
+L4976:
+	LD XIY, (XIX+91)
+L4977:
+	LD B, 47
+L4978:
+	LD (XIX+3659:16), IX
+L4979:
+	LD DE, 44069
+L4980:
+	LD C, (XWA+)
+L4981:
+	LD (XDE), A
+L4982:
+	LD XBC, (XHL+51)
+L4983:
+	LD D, H
+L4984:
+	LD XBC, L4986
+L4985:
+	LD (XIX+556), DE
+L4986:
+	LD (L4986:24), W
+L4987:
+	LD L, 174
+L4988:
+	LD XBC, (XIY+13041:16)
+L4989:
+	LD L, E
+L4990:
+	LD C, L
+L4991:
+	LD H, D
+L4992:
+	LD A, 210
+L4993:
+	LD A, (BIGREG)
+L4994:
+	LDA XDE, (XIX+75)
+L4995:
+	LD B, E
+L4996:
+	LD W, (XWA+B)
+L4997:
+	LD L, 11
+L4998:
+	LD B, 72
+L4999:
+	LD E, D
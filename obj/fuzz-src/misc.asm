@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	LDC DMAC0, XWA
+L1:
+	EXTZ XHL
+L2:
+	EXTZ HL
+L3:
+	LDC DMAM0, XWA
+L4:
+	EXTZ HL
+L5:
+	EXTZ IY
+L6:
+	MUL DE, 24
+L7:
+	MUL DE, 133
+L8:
+	MUL WA, 156
+L9:
+	HALT
+L10:
+	LDC DMAS0, XIX
+L11:
+	LDC DMAM0, XIX
+L12:
+	NOP
+L13:
+	MUL HL, 143
+L14:
+	EXTZ IY
+L15:
+	EXTZ IZ
+L16:
+	LDC DMAC0, XIX
+L17:
+	RET
+L18:
+	EXTZ BC
+L19:
+	EXTZ BC
+L20:
+	EXTZ HL
+L21:
+	LDC DMAM0, XBC
+L22:
+	MUL HL, 41
+L23:
+	MUL DE, 195
+L24:
+	EXTZ IY
+L25:
+	MUL BC, 104
+L26:
+	MUL DE, 48
+L27:
+	DI
+L28:
+	EXTZ XHL
+L29:
+	EXTZ XIX
+L30:
+	EXTZ XIY
+L31:
+	RET
+L32:
+	DI
+L33:
+	EXTZ WA
+L34:
+	EI 0
+L35:
+	EXTZ XIX
+L36:
+	MUL HL, 130
+L37:
+	LDC DMAD0, XHL
+L38:
+	EXTZ WA
+L39:
+	LDC DMAC0, XIZ
+L40:
+	EXTZ XHL
+L41:
+	LDC DMAD0, XBC
+L42:
+	MUL DE, 139
+L43:
+	LDC DMAD0, XIX
+L44:
+	MUL BC, 77
+L45:
+	EXTZ XIX
+L46:
+	EXTZ IX
+L47:
+	MUL HL, 29
+L48:
+	EXTZ XWA
+L49:
+	MUL DE, 144
+L50:
+	MUL BC, 142
+L51:
+	LDC DMAS0, XIY
+L52:
+	LDIR
+L53:
+	MUL DE, 88
+L54:
+	MUL WA, 143
+L55:
+	LDC DMAC0, XBC
+L56:
+	EXTZ XBC
+L57:
+	MUL HL, 212
+L58:
+	EXTZ IY
+L59:
+	EXTZ XIZ
+L60:
+	NOP
+L61:
+	LDC DMAM0, XHL
+L62:
+	LDC DMAM0, XIX
+L63:
+	RET
+L64:
+	RET
+L65:
+	RCF
+L66:
+	EXTZ WA
+L67:
+	DI
+L68:
+	LDC DMAS0, XWA
+L69:
+	MUL DE, 60
+L70:
+	LDC DMAM0, XHL
+L71:
+	LDC DMAM0, XBC
+L72:
+	MUL DE, 154
+L73:
+	LDC DMAD0, XHL
+L74:
+	EXTZ BC
+L75:
+	MUL WA, 40
+L76:
+	LDIR
+L77:
+	RCF
+L78:
+	SCF
+L79:
+	EXTZ IY
+L80:
+	LDC DMAM0, XHL
+L81:
+	EXTZ XIX
+L82:
+	RET
+L83:
+	MUL BC, 55
+L84:
+	EXTZ XDE
+L85:
+	RCF
+L86:
+	RCF
+L87:
+	RCF
+L88:
+	MUL DE, 243
+L89:
+	LDIR
+L90:
+	RET
+L91:
+	LDC DMAM0, XIY
+L92:
+	MUL DE, 118
+L93:
+	RCF
+L94:
+	LDC DMAD0, XIZ
+L95:
+	EXTZ XHL
+L96:
+	RCF
+L97:
+	HALT
+L98:
+	MUL DE, 3
+L99:
+	MUL WA, 70
+L100:
+	EI 0
+L101:
+	EXTZ XHL
+L102:
+	LDC DMAD0, XBC
+L103:
+	EXTZ WA
+L104:
+	EXTZ XBC
+L105:
+	LDC DMAM0, XIZ
+L106:
+	LDC DMAS0, XIY
+L107:
+	EXTZ XIY
+L108:
+	EXTZ IX
+L109:
+	MUL DE, 225
+L110:
+	MUL BC, 20
+L111:
+	MUL HL, 240
+L112:
+	EXTZ BC
+L113:
+	EXTZ XBC
+L114:
+	MUL BC, 96
+L115:
+	LDIR
+L116:
+	RCF
+L117:
+	EXTZ IX
+L118:
+	EXTZ XIY
+L119:
+	MUL HL, 17
+L120:
+	NOP
+L121:
+	NOP
+L122:
+	MUL DE, 178
+L123:
+	EXTZ IZ
+L124:
+	LDC DMAS0, XDE
+L125:
+	MUL HL, 214
+L126:
+	EXTZ XDE
+L127:
+	LDC DMAC0, XIZ
+L128:
+	MUL BC, 190
+L129:
+	LDC DMAS0, XIX
+L130:
+	LDC DMAS0, XBC
+L131:
+	RET
+L132:
+	LDC DMAC0, XHL
+L133:
+	EXTZ XWA
+L134:
+	LDC DMAD0, XHL
+L135:
+	EXTZ XWA
+L136:
+	LDC DMAD0, XWA
+L137:
+	EXTZ XIZ
+L138:
+	EXTZ XIZ
+L139:
+	MUL DE, 110
+L140:
+	EXTZ WA
+L141:
+	EXTZ XDE
+L142:
+	LDC DMAD0, XIY
+L143:
+	EXTZ BC
+L144:
+	EXTZ IY
+L145:
+	MUL HL, 101
+L146:
+	RCF
+L147:
+	MUL WA, 40
+L148:
+	LDC DMAS0, XIY
+L149:
+	EXTZ DE
+L150:
+	LDC DMAD0, XDE
+L151:
+	NOP
+L152:
+	EXTZ IZ
+L153:
+	MUL HL, 17
+L154:
+	MUL BC, 222
+L155:
+	EXTZ XHL
+L156:
+	MUL DE, 138
+L157:
+	MUL BC, 216
+L158:
+	EXTZ XHL
+L159:
+	LDC DMAC0, XHL
+L160:
+	EXTZ BC
+L161:
+	LDC DMAD0, XHL
+L162:
+	RET
+L163:
+	NOP
+L164:
+	LDC DMAS0, XIY
+L165:
+	LDC DMAD0, XIX
+L166:
+	LDC DMAD0, XIX
+L167:
+	EXTZ XWA
+L168:
+	SCF
+L169:
+	LDC DMAM0, XBC
+L170:
+	LDC DMAD0, XIZ
+L171:
+	LDC DMAS0, XIX
+L172:
+	NOP
+L173:
+	HALT
+L174:
+	MUL BC, 82
+L175:
+	RET
+L176:
+	HALT
+L177:
+	MUL DE, 201
+L178:
+	LDC DMAD0, XIY
+L179:
+	LDC DMAD0, XBC
+L180:
+	EXTZ IZ
+L181:
+	MUL BC, 172
+L182:
+	LDC DMAC0, XWA
+L183:
+	EXTZ DE
+L184:
+	LDC DMAC0, XIX
+L185:
+	EXTZ XBC
+L186:
+	LDC DMAC0, XHL
+L187:
+	MUL DE, 225
+L188:
+	MUL BC, 65
+L189:
+	LDC DMAM0, XIZ
+L190:
+	EXTZ XIY
+L191:
+	MUL DE, 151
+L192:
+	EI 0
+L193:
+	MUL HL, 185
+L194:
+	MUL BC, 65
+L195:
+	LDC DMAC0, XBC
+L196:
+	EXTZ DE
+L197:
+	LDC DMAM0, XBC
+L198:
+	MUL HL, 151
+L199:
+	EXTZ XBC
+L200:
+	MUL WA, 104
+L201:
+	EXTZ BC
+L202:
+	MUL HL, 100
+L203:
+	RET
+L204:
+	EXTZ WA
+L205:
+	LDC DMAC0, XIX
+L206:
+	LDC DMAD0, XIZ
+L207:
+	HALT
+L208:
+	NOP
+L209:
+	MUL HL, 218
+L210:
+	RCF
+L211:
+	EXTZ XHL
+L212:
+	MUL WA, 128
+L213:
+	MUL DE, 90
+L214:
+	RET
+L215:
+	MUL DE, 107
+L216:
+	NOP
+L217:
+	LDC DMAC0, XIY
+L218:
+	EXTZ IY
+L219:
+	MUL BC, 188
+L220:
+	EXTZ DE
+L221:
+	EI 0
+L222:
+	LDC DMAM0, XDE
+L223:
+	EXTZ IZ
+L224:
+	LDC DMAM0, XIX
+L225:
+	RCF
+L226:
+	HALT
+L227:
+	RET
+L228:
+	MUL WA, 21
+L229:
+	EXTZ DE
+L230:
+	NOP
+L231:
+	MUL DE, 172
+L232:
+	MUL WA, 155
+L233:
+	MUL BC, 184
+L234:
+	EXTZ BC
+L235:
+	MUL WA, 174
+L236:
+	MUL HL, 186
+L237:
+	EXTZ XIX
+L238:
+	EXTZ IX
+L239:
+	SCF
+L240:
+	MUL BC, 161
+L241:
+	NOP
+L242:
+	LDC DMAM0, XHL
+L243:
+	EXTZ DE
+L244:
+	EXTZ IZ
+L245:
+	MUL BC, 93
+L246:
+	MUL WA, 99
+L247:
+	EXTZ DE
+L248:
+	LDIR
+L249:
+	DI
+L250:
+	LDC DMAM0, XDE
+L251:
+	MUL WA, 108
+L252:
+	MUL BC, 119
+L253:
+	EXTZ XDE
+L254:
+	LDC DMAD0, XDE
+L255:
+	EXTZ HL
+L256:
+	LDC DMAC0, XWA
+L257:
+	LDC DMAC0, XHL
+L258:
+	LDC DMAM0, XIY
+L259:
+	LDC DMAC0, XWA
+L260:
+	MUL HL, 24
+L261:
+	LDIR
+L262:
+	NOP
+L263:
+	LDC DMAS0, XIY
+L264:
+	MUL WA, 9
+L265:
+	MUL DE, 91
+L266:
+	RET
+L267:
+	RCF
+L268:
+	LDC DMAS0, XIZ
+L269:
+	RET
+L270:
+	LDC DMAM0, XIZ
+L271:
+	DI
+L272:
+	MUL DE, 252
+L273:
+	LDC DMAS0, XBC
+L274:
+	MUL WA, 53
+L275:
+	EI 0
+L276:
+	MUL HL, 34
+L277:
+	MUL DE, 82
+L278:
+	MUL DE, 33
+L279:
+	LDC DMAC0, XHL
+L280:
+	EXTZ XDE
+L281:
+	LDC DMAS0, XIX
+L282:
+	RCF
+L283:
+	LDC DMAS0, XIX
+L284:
+	MUL WA, 251
+L285:
+	LDC DMAC0, XIZ
+L286:
+	EXTZ XIZ
+L287:
+	MUL WA, 209
+L288:
+	RETI
+L289:
+	EXTZ IY
+L290:
+	EXTZ WA
+L291:
+	DI
+L292:
+	RET
+L293:
+	EXTZ BC
+L294:
+	MUL BC, 159
+L295:
+	EXTZ DE
+L296:
+	EXTZ XDE
+L297:
+	LDC DMAM0, XIX
+L298:
+	MUL DE, 145
+L299:
+	HALT
+L300:
+	MUL BC, 186
+L301:
+	EXTZ HL
+L302:
+	LDC DMAM0, XBC
+L303:
+	SCF
+L304:
+	MUL WA, 255
+L305:
+	EXTZ XIY
+L306:
+	NOP
+L307:
+	EI 0
+L308:
+	SCF
+L309:
+	EI 0
+L310:
+	LDIR
+L311:
+	DI
+L312:
+	MUL WA, 46
+L313:
+	NOP
+L314:
+	EXTZ IX
+L315:
+	MUL DE, 189
+L316:
+	EXTZ IX
+L317:
+	LDC DMAD0, XBC
+L318:
+	LDC DMAD0, XIX
+L319:
+	MUL BC, 88
+L320:
+	MUL DE, 76
+L321:
+	DI
+L322:
+	EXTZ XBC
+L323:
+	LDIR
+L324:
+	RCF
+L325:
+	MUL BC, 202
+L326:
+	LDC DMAC0, XIY
+L327:
+	LDC DMAS0, XHL
+L328:
+	EXTZ IY
+L329:
+	LDC DMAC0, XWA
+L330:
+	EXTZ IY
+L331:
+	MUL BC, 47
+L332:
+	MUL DE, 13
+L333:
+	LDIR
+L334:
+	EXTZ WA
+L335:
+	EXTZ WA
+L336:
+	RCF
+L337:
+	DI
+L338:
+	EXTZ XBC
+L339:
+	LDC DMAS0, XIY
+L340:
+	EXTZ HL
+L341:
+	LDC DMAD0, XIY
+L342:
+	LDC DMAM0, XIY
+L343:
+	EXTZ WA
+L344:
+	EXTZ HL
+L345:
+	NOP
+L346:
+	EXTZ XIX
+L347:
+	MUL BC, 176
+L348:
+	MUL WA, 210
+L349:
+	MUL BC, 198
+L350:
+	EXTZ XBC
+L351:
+	MUL WA, 14
+L352:
+	EXTZ DE
+L353:
+	LDIR
+L354:
+	LDC DMAS0, XWA
+L355:
+	EI 0
+L356:
+	EXTZ XBC
+L357:
+	MUL HL, 154
+L358:
+	MUL DE, 201
+L359:
+	MUL DE, 12
+L360:
+	LDC DMAM0, XIZ
+L361:
+	HALT
+L362:
+	HALT
+L363:
+	EXTZ XIX
+L364:
+	MUL HL, 6
+L365:
+	EXTZ XIX
+L366:
+	MUL DE, 194
+L367:
+	MUL HL, 204
+L368:
+	EXTZ HL
+L369:
+	MUL WA, 16
+L370:
+	EXTZ BC
+L371:
+	SCF
+L372:
+	MUL DE, 206
+L373:
+	LDC DMAS0, XBC
+L374:
+	LDC DMAC0, XHL
+L375:
+	MUL DE, 87
+L376:
+	MUL HL, 220
+L377:
+	EI 0
+L378:
+	HALT
+L379:
+	LDC DMAD0, XIY
+L380:
+	MUL WA, 114
+L381:
+	MUL WA, 81
+L382:
+	EXTZ XDE
+L383:
+	MUL BC, 181
+L384:
+	EXTZ HL
+L385:
+	EXTZ DE
+L386:
+	LDC DMAD0, XIZ
+L387:
+	EI 0
+L388:
+	LDC DMAD0, XWA
+L389:
+	LDC DMAD0, XBC
+L390:
+	EXTZ HL
+L391:
+	MUL WA, 115
+L392:
+	NOP
+L393:
+	RCF
+L394:
+	RET
+L395:
+	LDC DMAS0, XHL
+L396:
+	LDC DMAM0, XIX
+L397:
+	EXTZ XWA
+L398:
+	EXTZ IZ
+L399:
+	MUL BC, 164
+L400:
+	LDC DMAD0, XIY
+L401:
+	EXTZ XIY
+L402:
+	LDC DMAS0, XHL
+L403:
+	LDC DMAS0, XHL
+L404:
+	RCF
+L405:
+	LDC DMAC0, XDE
+L406:
+	LDC DMAS0, XIX
+L407:
+	EXTZ DE
+L408:
+	LDC DMAM0, XDE
+L409:
+	MUL HL, 33
+L410:
+	EXTZ DE
+L411:
+	MUL HL, 85
+L412:
+	LDC DMAD0, XHL
+L413:
+	EXTZ XIX
+L414:
+	LDC DMAS0, XBC
+L415:
+	RCF
+L416:
+	DI
+L417:
+	MUL HL, 99
+L418:
+	LDC DMAM0, XIX
+L419:
+	EXTZ XIX
+L420:
+	EXTZ XDE
+L421:
+	MUL BC, 115
+L422:
+	MUL WA, 205
+L423:
+	LDC DMAM0, XWA
+L424:
+	LDIR
+L425:
+	RETI
+L426:
+	MUL DE, 25
+L427:
+	MUL DE, 179
+L428:
+	MUL DE, 119
+L429:
+	RETI
+L430:
+	EXTZ XDE
+L431:
+	RET
+L432:
+	MUL WA, 170
+L433:
+	EXTZ WA
+L434:
+	EXTZ XDE
+L435:
+	EXTZ IY
+L436:
+	EXTZ HL
+L437:
+	LDC DMAM0, XIZ
+L438:
+	LDIR
+L439:
+	LDC DMAM0, XIY
+L440:
+	EXTZ XIY
+L441:
+	EXTZ XIX
+L442:
+	NOP
+L443:
+	EXTZ IX
+L444:
+	RET
+L445:
+	MUL WA, 0
+L446:
+	LDC DMAM0, XHL
+L447:
+	LDC DMAD0, XDE
+L448:
+	LDC DMAC0, XIZ
+L449:
+	MUL BC, 5
+L450:
+	EXTZ XWA
+L451:
+	MUL HL, 167
+L452:
+	EXTZ DE
+L453:
+	MUL BC, 140
+L454:
+	LDC DMAC0, XIY
+L455:
+	EXTZ IY
+L456:
+	LDC DMAS0, XIX
+L457:
+	MUL WA, 154
+L458:
+	RET
+L459:
+	LDC DMAD0, XHL
+L460:
+	HALT
+L461:
+	EXTZ XHL
+L462:
+	MUL BC, 37
+L463:
+	LDC DMAM0, XIZ
+L464:
+	LDC DMAS0, XIY
+L465:
+	LDC DMAS0, XDE
+L466:
+	EI 0
+L467:
+	DI
+L468:
+	RET
+L469:
+	MUL WA, 186
+L470:
+	EXTZ XWA
+L471:
+	LDC DMAD0, XIX
+L472:
+	LDIR
+L473:
+	SCF
+L474:
+	EI 0
+L475:
+	EXTZ XWA
+L476:
+	LDC DMAC0, XIZ
+L477:
+	HALT
+L478:
+	LDC DMAD0, XIZ
+L479:
+	LDC DMAD0, XBC
+L480:
+	MUL BC, 240
+L481:
+	LDC DMAM0, XHL
+L482:
+	EXTZ DE
+L483:
+	LDC DMAD0, XIZ
+L484:
+	HALT
+L485:
+	EXTZ IZ
+L486:
+	EXTZ XWA
+L487:
+	LDC DMAC0, XIZ
+L488:
+	MUL DE, 92
+L489:
+	MUL DE, 157
+L490:
+	LDC DMAC0, XHL
+L491:
+	EXTZ XDE
+L492:
+	MUL HL, 241
+L493:
+	RET
+L494:
+	EI 0
+L495:
+	EXTZ XIX
+L496:
+	MUL WA, 156
+L497:
+	LDC DMAC0, XHL
+L498:
+	MUL DE, 137
+L499:
+	LDC DMAD0, XWA
+L500:
+	EXTZ IX
+L501:
+	MUL WA, 146
+L502:
+	MUL WA, 181
+L503:
+	DI
+L504:
+	EXTZ XWA
+L505:
+	SCF
+L506:
+	MUL DE, 50
+L507:
+	EXTZ DE
+L508:
+	LDC DMAS0, XIY
+L509:
+	LDC DMAM0, XBC
+L510:
+	EXTZ XHL
+L511:
+	MUL BC, 80
+L512:
+	EXTZ BC
+L513:
+	EXTZ IZ
+L514:
+	EXTZ WA
+L515:
+	LDC DMAC0, XBC
+L516:
+	RETI
+L517:
+	LDC DMAS0, XDE
+L518:
+	LDC DMAC0, XHL
+L519:
+	HALT
+L520:
+	EXTZ XIX
+L521:
+	MUL WA, 203
+L522:
+	EXTZ IX
+L523:
+	EXTZ IY
+L524:
+	EXTZ XDE
+L525:
+	LDC DMAS0, XIY
+L526:
+	MUL HL, 178
+L527:
+	LDC DMAM0, XBC
+L528:
+	EXTZ XIX
+L529:
+	MUL HL, 40
+L530:
+	MUL DE, 201
+L531:
+	EI 0
+L532:
+	MUL WA, 139
+L533:
+	MUL WA, 237
+L534:
+	EXTZ IY
+L535:
+	MUL WA, 132
+L536:
+	EI 0
+L537:
+	MUL DE, 61
+L538:
+	RCF
+L539:
+	EXTZ IX
+L540:
+	EXTZ XIZ
+L541:
+	RETI
+L542:
+	LDC DMAM0, XHL
+L543:
+	LDC DMAC0, XWA
+L544:
+	NOP
+L545:
+	RCF
+L546:
+	MUL HL, 150
+L547:
+	EXTZ WA
+L548:
+	EXTZ IY
+L549:
+	MUL DE, 121
+L550:
+	EI 0
+L551:
+	NOP
+L552:
+	LDC DMAC0, XIZ
+L553:
+	EXTZ BC
+L554:
+	DI
+L555:
+	MUL HL, 104
+L556:
+	LDIR
+L557:
+	RET
+L558:
+	EXTZ XDE
+L559:
+	SCF
+L560:
+	NOP
+L561:
+	EXTZ XIZ
+L562:
+	RETI
+L563:
+	LDC DMAS0, XHL
+L564:
+	EXTZ XIY
+L565:
+	LDC DMAM0, XIZ
+L566:
+	EXTZ DE
+L567:
+	RETI
+L568:
+	LDIR
+L569:
+	EXTZ XDE
+L570:
+	EXTZ IY
+L571:
+	RCF
+L572:
+	EXTZ XHL
+L573:
+	EXTZ XBC
+L574:
+	MUL BC, 75
+L575:
+	EXTZ XDE
+L576:
+	RETI
+L577:
+	LDC DMAC0, XDE
+L578:
+	EXTZ XBC
+L579:
+	LDC DMAM0, XBC
+L580:
+	MUL WA, 2
+L581:
+	RET
+L582:
+	EXTZ IZ
+L583:
+	MUL DE, 78
+L584:
+	EXTZ XIX
+L585:
+	MUL DE, 86
+L586:
+	MUL BC, 185
+L587:
+	EXTZ XDE
+L588:
+	MUL DE, 23
+L589:
+	LDC DMAC0, XDE
+L590:
+	LDC DMAM0, XIX
+L591:
+	EXTZ DE
+L592:
+	RCF
+L593:
+	EXTZ XWA
+L594:
+	NOP
+L595:
+	MUL BC, 197
+L596:
+	RET
+L597:
+	MUL HL, 20
+L598:
+	EXTZ XIX
+L599:
+	EXTZ XIX
+L600:
+	MUL HL, 38
+L601:
+	MUL HL, 248
+L602:
+	EXTZ XDE
+L603:
+	EXTZ XHL
+L604:
+	NOP
+L605:
+	EXTZ BC
+L606:
+	EI 0
+L607:
+	MUL DE, 116
+L608:
+	LDC DMAS0, XDE
+L609:
+	EXTZ WA
+L610:
+	MUL BC, 156
+L611:
+	EXTZ XIZ
+L612:
+	LDIR
+L613:
+	RET
+L614:
+	MUL HL, 163
+L615:
+	MUL HL, 236
+L616:
+	EXTZ HL
+L617:
+	EXTZ XDE
+L618:
+	MUL HL, 231
+L619:
+	RET
+L620:
+	NOP
+L621:
+	RETI
+L622:
+	LDC DMAD0, XWA
+L623:
+	EXTZ BC
+L624:
+	LDC DMAC0, XBC
+L625:
+	RET
+L626:
+	RETI
+L627:
+	MUL WA, 12
+L628:
+	MUL HL, 198
+L629:
+	LDC DMAD0, XHL
+L630:
+	LDC DMAS0, XIY
+L631:
+	RCF
+L632:
+	EXTZ IX
+L633:
+	LDC DMAC0, XHL
+L634:
+	EXTZ XWA
+L635:
+	LDC DMAM0, XHL
+L636:
+	LDC DMAD0, XBC
+L637:
+	LDIR
+L638:
+	EXTZ XHL
+L639:
+	MUL WA, 248
+L640:
+	RET
+L641:
+	LDIR
+L642:
+	HALT
+L643:
+	MUL WA, 157
+L644:
+	MUL WA, 92
+L645:
+	EXTZ IX
+L646:
+	NOP
+L647:
+	MUL BC, 188
+L648:
+	EXTZ XIZ
+L649:
+	LDC DMAM0, XBC
+L650:
+	LDC DMAD0, XIX
+L651:
+	DI
+L652:
+	LDC DMAD0, XIX
+L653:
+	LDIR
+L654:
+	RCF
+L655:
+	LDC DMAS0, XHL
+L656:
+	MUL DE, 50
+L657:
+	MUL DE, 3
+L658:
+	EXTZ XDE
+L659:
+	DI
+L660:
+	RET
+L661:
+	MUL BC, 36
+L662:
+	MUL DE, 129
+L663:
+	LDC DMAS0, XWA
+L664:
+	MUL DE, 218
+L665:
+	EXTZ IY
+L666:
+	DI
+L667:
+	LDIR
+L668:
+	EXTZ BC
+L669:
+	DI
+L670:
+	MUL DE, 222
+L671:
+	EXTZ IY
+L672:
+	RETI
+L673:
+	RCF
+L674:
+	MUL HL, 71
+L675:
+	LDC DMAM0, XIX
+L676:
+	LDIR
+L677:
+	DI
+L678:
+	MUL DE, 2
+L679:
+	EXTZ BC
+L680:
+	EXTZ HL
+L681:
+	LDC DMAD0, XDE
+L682:
+	MUL HL, 77
+L683:
+	EXTZ XWA
+L684:
+	EXTZ BC
+L685:
+	MUL BC, 160
+L686:
+	EXTZ DE
+L687:
+	EXTZ XDE
+L688:
+	EXTZ XIZ
+L689:
+	LDC DMAS0, XIZ
+L690:
+	EXTZ DE
+L691:
+	LDC DMAS0, XDE
+L692:
+	LDC DMAM0, XIY
+L693:
+	LDC DMAM0, XDE
+L694:
+	EXTZ XDE
+L695:
+	MUL WA, 204
+L696:
+	LDC DMAD0, XDE
+L697:
+	MUL HL, 225
+L698:
+	EXTZ XIZ
+L699:
+	EXTZ XDE
+L700:
+	EXTZ DE
+L701:
+	RCF
+L702:
+	LDC DMAS0, XIZ
+L703:
+	MUL BC, 83
+L704:
+	LDC DMAM0, XBC
+L705:
+	EXTZ DE
+L706:
+	RET
+L707:
+	EXTZ IZ
+L708:
+	LDC DMAC0, XIY
+L709:
+	MUL WA, 0
+L710:
+	MUL BC, 113
+L711:
+	LDC DMAD0, XDE
+L712:
+	LDC DMAM0, XIX
+L713:
+	EXTZ DE
+L714:
+	HALT
+L715:
+	MUL DE, 110
+L716:
+	SCF
+L717:
+	LDC DMAC0, XHL
+L718:
+	MUL WA, 147
+L719:
+	DI
+L720:
+	LDC DMAC0, XIX
+L721:
+	EXTZ BC
+L722:
+	MUL WA, 236
+L723:
+	MUL HL, 44
+L724:
+	EXTZ DE
+L725:
+	MUL WA, 234
+L726:
+	EXTZ XDE
+L727:
+	EI 0
+L728:
+	EXTZ IZ
+L729:
+	MUL HL, 185
+L730:
+	MUL DE, 217
+L731:
+	EXTZ IY
+L732:
+	LDC DMAD0, XIZ
+L733:
+	LDC DMAC0, XHL
+L734:
+	RCF
+L735:
+	MUL BC, 83
+L736:
+	MUL DE, 183
+L737:
+	MUL BC, 159
+L738:
+	DI
+L739:
+	LDC DMAD0, XIX
+L740:
+	EI 0
+L741:
+	EXTZ IZ
+L742:
+	EXTZ XIY
+L743:
+	LDC DMAM0, XHL
+L744:
+	EXTZ HL
+L745:
+	RETI
+L746:
+	EI 0
+L747:
+	LDC DMAC0, XBC
+L748:
+	MUL DE, 182
+L749:
+	LDIR
+L750:
+	LDC DMAS0, XIX
+L751:
+	EXTZ WA
+L752:
+	EXTZ IX
+L753:
+	LDC DMAC0, XDE
+L754:
+	EXTZ IZ
+L755:
+	EXTZ IZ
+L756:
+	LDC DMAC0, XIZ
+L757:
+	LDC DMAM0, XWA
+L758:
+	LDC DMAC0, XIZ
+L759:
+	HALT
+L760:
+	MUL BC, 78
+L761:
+	LDC DMAD0, XBC
+L762:
+	EXTZ BC
+L763:
+	LDC DMAM0, XIY
+L764:
+	EXTZ XIZ
+L765:
+	LDC DMAS0, XIY
+L766:
+	EXTZ XHL
+L767:
+	EXTZ DE
+L768:
+	EI 0
+L769:
+	MUL BC, 57
+L770:
+	LDC DMAM0, XDE
+L771:
+	LDC DMAS0, XWA
+L772:
+	LDC DMAS0, XIZ
+L773:
+	MUL HL, 146
+L774:
+	MUL HL, 205
+L775:
+	MUL DE, 15
+L776:
+	EXTZ XBC
+L777:
+	EXTZ XIY
+L778:
+	LDC DMAC0, XBC
+L779:
+	LDC DMAM0, XHL
+L780:
+	MUL WA, 202
+L781:
+	MUL WA, 170
+L782:
+	EXTZ XHL
+L783:
+	MUL WA, 63
+L784:
+	EXTZ IZ
+L785:
+	LDC DMAD0, XWA
+L786:
+	EXTZ XHL
+L787:
+	EI 0
+L788:
+	LDC DMAD0, XBC
+L789:
+	MUL BC, 12
+L790:
+	MUL DE, 209
+L791:
+	LDC DMAS0, XHL
+L792:
+	SCF
+L793:
+	RETI
+L794:
+	LDC DMAS0, XIX
+L795:
+	LDC DMAD0, XIY
+L796:
+	MUL WA, 224
+L797:
+	LDC DMAD0, XIY
+L798:
+	SCF
+L799:
+	MUL DE, 77
+L800:
+	RET
+L801:
+	RCF
+L802:
+	EI 0
+L803:
+	EXTZ XIZ
+L804:
+	EI 0
+L805:
+	MUL BC, 44
+L806:
+	MUL WA, 5
+L807:
+	MUL WA, 109
+L808:
+	NOP
+L809:
+	EXTZ BC
+L810:
+	LDC DMAC0, XDE
+L811:
+	MUL WA, 193
+L812:
+	LDC DMAS0, XDE
+L813:
+	MUL WA, 60
+L814:
+	LDC DMAC0, XIX
+L815:
+	LDIR
+L816:
+	LDC DMAD0, XIY
+L817:
+	EXTZ XIY
+L818:
+	RCF
+L819:
+	DI
+L820:
+	SCF
+L821:
+	MUL WA, 188
+L822:
+	LDC DMAD0, XHL
+L823:
+	LDIR
+L824:
+	MUL HL, 164
+L825:
+	LDC DMAS0, XBC
+L826:
+	MUL BC, 187
+L827:
+	EI 0
+L828:
+	RET
+L829:
+	MUL HL, 235
+L830:
+	MUL HL, 52
+L831:
+	HALT
+L832:
+	MUL BC, 156
+L833:
+	MUL WA, 216
+L834:
+	LDC DMAM0, XBC
+L835:
+	LDC DMAS0, XIY
+L836:
+	EXTZ DE
+L837:
+	MUL DE, 159
+L838:
+	EXTZ XIY
+L839:
+	EXTZ XIY
+L840:
+	LDC DMAM0, XIY
+L841:
+	MUL WA, 98
+L842:
+	RETI
+L843:
+	EXTZ WA
+L844:
+	LDIR
+L845:
+	RETI
+L846:
+	MUL WA, 141
+L847:
+	EXTZ BC
+L848:
+	MUL HL, 196
+L849:
+	EXTZ IY
+L850:
+	LDC DMAS0, XWA
+L851:
+	LDC DMAD0, XWA
+L852:
+	MUL WA, 214
+L853:
+	LDC DMAC0, XIZ
+L854:
+	SCF
+L855:
+	EXTZ IX
+L856:
+	EXTZ XIX
+L857:
+	LDC DMAM0, XIY
+L858:
+	RETI
+L859:
+	LDC DMAS0, XIY
+L860:
+	LDC DMAC0, XDE
+L861:
+	MUL BC, 164
+L862:
+	MUL BC, 24
+L863:
+	SCF
+L864:
+	DI
+L865:
+	LDC DMAC0, XWA
+L866:
+	LDC DMAM0, XIY
+L867:
+	RETI
+L868:
+	MUL DE, 172
+L869:
+	NOP
+L870:
+	EXTZ XIZ
+L871:
+	MUL BC, 252
+L872:
+	MUL HL, 215
+L873:
+	EXTZ WA
+L874:
+	MUL WA, 204
+L875:
+	EI 0
+L876:
+	EXTZ BC
+L877:
+	LDC DMAD0, XIY
+L878:
+	RETI
+L879:
+	MUL HL, 240
+L880:
+	LDC DMAM0, XBC
+L881:
+	HALT
+L882:
+	MUL HL, 82
+L883:
+	EXTZ BC
+L884:
+	NOP
+L885:
+	LDC DMAC0, XIZ
+L886:
+	EXTZ IZ
+L887:
+	EXTZ XIY
+L888:
+	EXTZ IY
+L889:
+	EXTZ XBC
+L890:
+	MUL HL, 77
+L891:
+	MUL DE, 238
+L892:
+	NOP
+L893:
+	MUL DE, 137
+L894:
+	LDC DMAM0, XIZ
+L895:
+	HALT
+L896:
+	EI 0
+L897:
+	RET
+L898:
+	EXTZ IZ
+L899:
+	LDC DMAS0, XIY
+L900:
+	EXTZ XDE
+L901:
+	EI 0
+L902:
+	MUL HL, 163
+L903:
+	HALT
+L904:
+	DI
+L905:
+	EXTZ XDE
+L906:
+	LDC DMAM0, XWA
+L907:
+	EXTZ XIZ
+L908:
+	EXTZ IX
+L909:
+	EXTZ XBC
+L910:
+	MUL WA, 179
+L911:
+	LDIR
+L912:
+	LDC DMAM0, XHL
+L913:
+	RET
+L914:
+	LDC DMAD0, XIY
+L915:
+	EXTZ XBC
+L916:
+	DI
+L917:
+	EI 0
+L918:
+	EI 0
+L919:
+	MUL WA, 28
+L920:
+	RCF
+L921:
+	MUL DE, 242
+L922:
+	LDC DMAM0, XWA
+L923:
+	DI
+L924:
+	MUL HL, 255
+L925:
+	EXTZ XIY
+L926:
+	EXTZ HL
+L927:
+	HALT
+L928:
+	NOP
+L929:
+	MUL WA, 162
+L930:
+	MUL DE, 233
+L931:
+	LDC DMAS0, XDE
+L932:
+	MUL WA, 224
+L933:
+	EXTZ HL
+L934:
+	EXTZ HL
+L935:
+	EXTZ BC
+L936:
+	MUL BC, 37
+L937:
+	EXTZ IZ
+L938:
+	EXTZ XBC
+L939:
+	EXTZ IX
+L940:
+	NOP
+L941:
+	EXTZ XDE
+L942:
+	LDC DMAS0, XIY
+L943:
+	LDC DMAC0, XIY
+L944:
+	DI
+L945:
+	MUL DE, 94
+L946:
+	LDC DMAC0, XBC
+L947:
+	LDC DMAM0, XDE
+L948:
+	NOP
+L949:
+	RCF
+L950:
+	MUL DE, 103
+L951:
+	EXTZ XWA
+L952:
+	EI 0
+L953:
+	RCF
+L954:
+	MUL WA, 120
+L955:
+	LDC DMAS0, XIZ
+L956:
+	SCF
+L957:
+	SCF
+L958:
+	MUL HL, 233
+L959:
+	LDC DMAM0, XHL
+L960:
+	DI
+L961:
+	LDC DMAS0, XIY
+L962:
+	EXTZ XWA
+L963:
+	MUL BC, 157
+L964:
+	LDC DMAC0, XIZ
+L965:
+	EXTZ BC
+L966:
+	LDC DMAD0, XIX
+L967:
+	RETI
+L968:
+	EXTZ XIX
+L969:
+	EXTZ HL
+L970:
+	EXTZ XIY
+L971:
+	LDC DMAC0, XDE
+L972:
+	EXTZ DE
+L973:
+	RETI
+L974:
+	MUL HL, 45
+L975:
+	LDC DMAD0, XDE
+L976:
+	EI 0
+L977:
+	EXTZ XDE
+L978:
+	LDC DMAD0, XIY
+L979:
+	MUL DE, 212
+L980:
+	RET
+L981:
+	NOP
+L982:
+	MUL DE, 216
+L983:
+	SCF
+L984:
+	MUL HL, 182
+L985:
+	EXTZ XIY
+L986:
+	LDC DMAS0, XHL
+L987:
+	EXTZ WA
+L988:
+	MUL DE, 117
+L989:
+	LDC DMAC0, XBC
+L990:
+	DI
+L991:
+	MUL WA, 15
+L992:
+	EXTZ XIY
+L993:
+	LDC DMAC0, XIZ
+L994:
+	LDC DMAC0, XIY
+L995:
+	MUL WA, 243
+L996:
+	LDC DMAS0, XBC
+L997:
+	LDC DMAS0, XIX
+L998:
+	MUL WA, 17
+L999:
+	DI
+L1000:
+	LDC DMAM0, XIZ
+L1001:
+	LDC DMAD0, XIZ
+L1002:
+	EXTZ XHL
+L1003:
+	EI 0
+L1004:
+	DI
+L1005:
+	EXTZ BC
+L1006:
+	RETI
+L1007:
+	LDC DMAM0, XIY
+L1008:
+	LDC DMAM0, XHL
+L1009:
+	MUL HL, 115
+L1010:
+	LDC DMAM0, XWA
+L1011:
+	MUL WA, 109
+L1012:
+	MUL DE, 130
+L1013:
+	LDC DMAM0, XBC
+L1014:
+	EXTZ XDE
+L1015:
+	RCF
+L1016:
+	LDC DMAM0, XDE
+L1017:
+	EXTZ XBC
+L1018:
+	MUL WA, 35
+L1019:
+	NOP
+L1020:
+	LDC DMAC0, XWA
+L1021:
+	EXTZ IY
+L1022:
+	EXTZ XWA
+L1023:
+	MUL DE, 12
+L1024:
+	EXTZ HL
+L1025:
+	EI 0
+L1026:
+	MUL WA, 176
+L1027:
+	MUL WA, 33
+L1028:
+	EXTZ BC
+L1029:
+	MUL DE, 56
+L1030:
+	LDC DMAM0, XIX
+L1031:
+	MUL BC, 82
+L1032:
+	LDC DMAM0, XDE
+L1033:
+	LDC DMAD0, XIY
+L1034:
+	EXTZ BC
+L1035:
+	EXTZ WA
+L1036:
+	MUL BC, 56
+L1037:
+	EXTZ XBC
+L1038:
+	RCF
+L1039:
+	LDC DMAM0, XDE
+L1040:
+	EXTZ XWA
+L1041:
+	EXTZ IX
+L1042:
+	EXTZ IY
+L1043:
+	EI 0
+L1044:
+	LDC DMAS0, XWA
+L1045:
+	MUL HL, 240
+L1046:
+	MUL HL, 197
+L1047:
+	MUL HL, 216
+L1048:
+	HALT
+L1049:
+	LDC DMAD0, XIZ
+L1050:
+	EXTZ DE
+L1051:
+	LDC DMAS0, XIY
+L1052:
+	RCF
+L1053:
+	SCF
+L1054:
+	EI 0
+L1055:
+	MUL BC, 117
+L1056:
+	MUL BC, 231
+L1057:
+	HALT
+L1058:
+	MUL HL, 196
+L1059:
+	EXTZ HL
+L1060:
+	EXTZ XIX
+L1061:
+	HALT
+L1062:
+	MUL WA, 85
+L1063:
+	LDC DMAS0, XDE
+L1064:
+	LDC DMAD0, XHL
+L1065:
+	LDC DMAS0, XIX
+L1066:
+	LDC DMAC0, XWA
+L1067:
+	RCF
+L1068:
+	MUL DE, 117
+L1069:
+	NOP
+L1070:
+	LDC DMAS0, XDE
+L1071:
+	LDC DMAM0, XIZ
+L1072:
+	MUL WA, 117
+L1073:
+	EXTZ DE
+L1074:
+	RET
+L1075:
+	LDC DMAD0, XIY
+L1076:
+	LDC DMAM0, XIY
+L1077:
+	MUL BC, 255
+L1078:
+	LDC DMAM0, XBC
+L1079:
+	MUL BC, 122
+L1080:
+	LDC DMAD0, XIX
+L1081:
+	LDC DMAC0, XWA
+L1082:
+	EI 0
+L1083:
+	EXTZ HL
+L1084:
+	MUL HL, 106
+L1085:
+	EI 0
+L1086:
+	MUL WA, 98
+L1087:
+	MUL HL, 14
+L1088:
+	LDC DMAD0, XWA
+L1089:
+	LDC DMAS0, XDE
+L1090:
+	LDC DMAC0, XIX
+L1091:
+	EXTZ IY
+L1092:
+	MUL DE, 218
+L1093:
+	MUL HL, 9
+L1094:
+	LDC DMAS0, XHL
+L1095:
+	MUL DE, 101
+L1096:
+	HALT
+L1097:
+	LDC DMAM0, XDE
+L1098:
+	EXTZ XIZ
+L1099:
+	MUL BC, 183
+L1100:
+	MUL BC, 199
+L1101:
+	EXTZ IZ
+L1102:
+	LDC DMAC0, XWA
+L1103:
+	SCF
+L1104:
+	LDC DMAC0, XWA
+L1105:
+	MUL BC, 107
+L1106:
+	MUL HL, 126
+L1107:
+	LDC DMAD0, XBC
+L1108:
+	EXTZ XBC
+L1109:
+	EXTZ BC
+L1110:
+	EXTZ XDE
+L1111:
+	EXTZ IY
+L1112:
+	EXTZ XWA
+L1113:
+	LDC DMAS0, XIY
+L1114:
+	EXTZ WA
+L1115:
+	MUL WA, 166
+L1116:
+	LDC DMAD0, XWA
+L1117:
+	LDC DMAS0, XIZ
+L1118:
+	LDC DMAD0, XBC
+L1119:
+	SCF
+L1120:
+	DI
+L1121:
+	LDC DMAS0, XDE
+L1122:
+	SCF
+L1123:
+	EXTZ XIZ
+L1124:
+	EXTZ XHL
+L1125:
+	DI
+L1126:
+	LDC DMAC0, XWA
+L1127:
+	LDC DMAD0, XIX
+L1128:
+	MUL WA, 86
+L1129:
+	NOP
+L1130:
+	MUL WA, 162
+L1131:
+	MUL WA, 6
+L1132:
+	EXTZ IX
+L1133:
+	NOP
+L1134:
+	MUL HL, 14
+L1135:
+	LDC DMAC0, XIZ
+L1136:
+	DI
+L1137:
+	EI 0
+L1138:
+	EXTZ XIZ
+L1139:
+	EXTZ XDE
+L1140:
+	MUL WA, 3
+L1141:
+	EXTZ XBC
+L1142:
+	EXTZ IZ
+L1143:
+	LDC DMAD0, XIY
+L1144:
+	EXTZ XWA
+L1145:
+	EXTZ DE
+L1146:
+	LDC DMAD0, XIY
+L1147:
+	MUL DE, 119
+L1148:
+	EXTZ XBC
+L1149:
+	LDC DMAD0, XIX
+L1150:
+	MUL BC, 130
+L1151:
+	MUL BC, 100
+L1152:
+	LDC DMAC0, XWA
+L1153:
+	EXTZ HL
+L1154:
+	EXTZ XHL
+L1155:
+	MUL WA, 84
+L1156:
+	MUL BC, 241
+L1157:
+	MUL WA, 57
+L1158:
+	MUL DE, 149
+L1159:
+	LDC DMAM0, XDE
+L1160:
+	MUL DE, 2
+L1161:
+	NOP
+L1162:
+	MUL WA, 202
+L1163:
+	RCF
+L1164:
+	HALT
+L1165:
+	EXTZ IX
+L1166:
+	LDIR
+L1167:
+	MUL WA, 118
+L1168:
+	MUL DE, 191
+L1169:
+	RET
+L1170:
+	NOP
+L1171:
+	RETI
+L1172:
+	MUL HL, 36
+L1173:
+	LDC DMAC0, XBC
+L1174:
+	MUL WA, 127
+L1175:
+	MUL DE, 196
+L1176:
+	EXTZ XBC
+L1177:
+	MUL BC, 108
+L1178:
+	RCF
+L1179:
+	EI 0
+L1180:
+	LDC DMAM0, XIX
+L1181:
+	MUL HL, 94
+L1182:
+	LDC DMAM0, XHL
+L1183:
+	EXTZ XDE
+L1184:
+	MUL DE, 199
+L1185:
+	EXTZ XIX
+L1186:
+	RCF
+L1187:
+	EXTZ DE
+L1188:
+	LDC DMAD0, XWA
+L1189:
+	LDC DMAC0, XHL
+L1190:
+	MUL BC, 79
+L1191:
+	LDC DMAM0, XHL
+L1192:
+	LDC DMAM0, XDE
+L1193:
+	LDIR
+L1194:
+	MUL DE, 226
+L1195:
+	LDIR
+L1196:
+	MUL BC, 95
+L1197:
+	EXTZ XBC
+L1198:
+	NOP
+L1199:
+	EXTZ HL
+L1200:
+	LDC DMAC0, XIZ
+L1201:
+	MUL WA, 129
+L1202:
+	LDC DMAS0, XHL
+L1203:
+	LDC DMAD0, XBC
+L1204:
+	MUL WA, 163
+L1205:
+	LDC DMAC0, XIZ
+L1206:
+	LDC DMAC0, XIY
+L1207:
+	EXTZ XIX
+L1208:
+	LDC DMAC0, XIZ
+L1209:
+	LDC DMAC0, XDE
+L1210:
+	MUL WA, 136
+L1211:
+	LDC DMAM0, XIY
+L1212:
+	MUL HL, 227
+L1213:
+	EI 0
+L1214:
+	LDC DMAS0, XIX
+L1215:
+	EXTZ BC
+L1216:
+	MUL HL, 34
+L1217:
+	MUL DE, 37
+L1218:
+	EXTZ XWA
+L1219:
+	SCF
+L1220:
+	LDC DMAD0, XIZ
+L1221:
+	EI 0
+L1222:
+	NOP
+L1223:
+	MUL HL, 134
+L1224:
+	NOP
+L1225:
+	MUL DE, 159
+L1226:
+	LDIR
+L1227:
+	LDC DMAD0, XHL
+L1228:
+	EI 0
+L1229:
+	MUL DE, 243
+L1230:
+	LDC DMAD0, XIY
+L1231:
+	EXTZ HL
+L1232:
+	LDIR
+L1233:
+	LDIR
+L1234:
+	EI 0
+L1235:
+	SCF
+L1236:
+	LDC DMAS0, XHL
+L1237:
+	MUL BC, 144
+L1238:
+	EXTZ XIY
+L1239:
+	LDC DMAM0, XIZ
+L1240:
+	MUL HL, 73
+L1241:
+	EXTZ XBC
+L1242:
+	EI 0
+L1243:
+	MUL WA, 66
+L1244:
+	MUL DE, 237
+L1245:
+	EXTZ IZ
+L1246:
+	MUL BC, 14
+L1247:
+	MUL BC, 25
+L1248:
+	MUL HL, 51
+L1249:
+	LDIR
+L1250:
+	LDC DMAM0, XBC
+L1251:
+	MUL HL, 55
+L1252:
+	EXTZ XDE
+L1253:
+	HALT
+L1254:
+	RCF
+L1255:
+	MUL DE, 101
+L1256:
+	EXTZ XIX
+L1257:
+	LDC DMAM0, XIY
+L1258:
+	EI 0
+L1259:
+	MUL DE, 73
+L1260:
+	LDC DMAS0, XIX
+L1261:
+	MUL HL, 181
+L1262:
+	LDC DMAD0, XIX
+L1263:
+	LDIR
+L1264:
+	RCF
+L1265:
+	LDC DMAM0, XIX
+L1266:
+	RET
+L1267:
+	EXTZ BC
+L1268:
+	MUL WA, 56
+L1269:
+	EXTZ XBC
+L1270:
+	LDC DMAC0, XIY
+L1271:
+	EI 0
+L1272:
+	MUL BC, 234
+L1273:
+	EXTZ XIX
+L1274:
+	LDC DMAD0, XIY
+L1275:
+	LDC DMAS0, XWA
+L1276:
+	LDC DMAM0, XIZ
+L1277:
+	LDC DMAD0, XWA
+L1278:
+	EXTZ XHL
+L1279:
+	MUL HL, 178
+L1280:
+	EXTZ XWA
+L1281:
+	RET
+L1282:
+	EXTZ IX
+L1283:
+	MUL DE, 217
+L1284:
+	LDC DMAS0, XHL
+L1285:
+	MUL WA, 29
+L1286:
+	MUL BC, 159
+L1287:
+	EXTZ XBC
+L1288:
+	EXTZ IX
+L1289:
+	MUL WA, 204
+L1290:
+	DI
+L1291:
+	EXTZ IZ
+L1292:
+	DI
+L1293:
+	NOP
+L1294:
+	DI
+L1295:
+	MUL BC, 36
+L1296:
+	LDC DMAD0, XIZ
+L1297:
+	MUL DE, 70
+L1298:
+	EXTZ HL
+L1299:
+	EXTZ XIX
+L1300:
+	HALT
+L1301:
+	EXTZ XDE
+L1302:
+	LDC DMAM0, XHL
+L1303:
+	MUL HL, 152
+L1304:
+	DI
+L1305:
+	LDC DMAC0, XIZ
+L1306:
+	RETI
+L1307:
+	LDC DMAD0, XBC
+L1308:
+	EXTZ IZ
+L1309:
+	LDC DMAM0, XBC
+L1310:
+	LDIR
+L1311:
+	HALT
+L1312:
+	MUL BC, 246
+L1313:
+	LDC DMAC0, XWA
+L1314:
+	EXTZ DE
+L1315:
+	EXTZ HL
+L1316:
+	LDC DMAC0, XIX
+L1317:
+	HALT
+L1318:
+	MUL BC, 129
+L1319:
+	LDC DMAD0, XIX
+L1320:
+	LDC DMAD0, XIZ
+L1321:
+	LDC DMAS0, XWA
+L1322:
+	RETI
+L1323:
+	LDC DMAM0, XIX
+L1324:
+	LDC DMAC0, XBC
+L1325:
+	LDC DMAC0, XIZ
+L1326:
+	RET
+L1327:
+	LDC DMAM0, XHL
+L1328:
+	EI 0
+L1329:
+	LDC DMAM0, XIY
+L1330:
+	MUL DE, 123
+L1331:
+	LDC DMAD0, XDE
+L1332:
+	MUL DE, 249
+L1333:
+	EXTZ XBC
+L1334:
+	MUL WA, 38
+L1335:
+	EXTZ DE
+L1336:
+	MUL WA, 137
+L1337:
+	SCF
+L1338:
+	RETI
+L1339:
+	RETI
+L1340:
+	LDC DMAD0, XIY
+L1341:
+	EXTZ BC
+L1342:
+	SCF
+L1343:
+	EXTZ XIZ
+L1344:
+	DI
+L1345:
+	LDC DMAC0, XIX
+L1346:
+	DI
+L1347:
+	RETI
+L1348:
+	RETI
+L1349:
+	MUL HL, 154
+L1350:
+	LDC DMAM0, XDE
+L1351:
+	EXTZ XDE
+L1352:
+	MUL WA, 14
+L1353:
+	RET
+L1354:
+	MUL DE, 165
+L1355:
+	EI 0
+L1356:
+	HALT
+L1357:
+	LDC DMAM0, XHL
+L1358:
+	EXTZ IX
+L1359:
+	MUL WA, 147
+L1360:
+	EXTZ BC
+L1361:
+	MUL WA, 85
+L1362:
+	MUL HL, 62
+L1363:
+	LDC DMAC0, XHL
+L1364:
+	LDC DMAS0, XWA
+L1365:
+	LDC DMAS0, XIZ
+L1366:
+	MUL DE, 79
+L1367:
+	SCF
+L1368:
+	LDC DMAS0, XIX
+L1369:
+	RETI
+L1370:
+	LDC DMAC0, XIY
+L1371:
+	NOP
+L1372:
+	EXTZ XDE
+L1373:
+	LDC DMAS0, XIY
+L1374:
+	NOP
+L1375:
+	MUL BC, 206
+L1376:
+	MUL HL, 121
+L1377:
+	LDC DMAM0, XWA
+L1378:
+	LDC DMAD0, XIY
+L1379:
+	LDC DMAM0, XWA
+L1380:
+	MUL DE, 246
+L1381:
+	EXTZ XDE
+L1382:
+	LDC DMAC0, XDE
+L1383:
+	HALT
+L1384:
+	SCF
+L1385:
+	HALT
+L1386:
+	EXTZ XWA
+L1387:
+	EI 0
+L1388:
+	EXTZ IZ
+L1389:
+	LDC DMAD0, XBC
+L1390:
+	LDC DMAC0, XDE
+L1391:
+	RETI
+L1392:
+	EXTZ DE
+L1393:
+	MUL WA, 204
+L1394:
+	EXTZ IY
+L1395:
+	LDC DMAD0, XIY
+L1396:
+	MUL HL, 207
+L1397:
+	EXTZ XBC
+L1398:
+	EXTZ XBC
+L1399:
+	LDC DMAC0, XHL
+L1400:
+	EXTZ DE
+L1401:
+	LDC DMAS0, XIY
+L1402:
+	EXTZ HL
+L1403:
+	EXTZ IY
+L1404:
+	EXTZ DE
+L1405:
+	LDIR
+L1406:
+	EXTZ XIZ
+L1407:
+	EXTZ WA
+L1408:
+	EXTZ IX
+L1409:
+	RET
+L1410:
+	LDC DMAS0, XIY
+L1411:
+	MUL DE, 245
+L1412:
+	SCF
+L1413:
+	EXTZ WA
+L1414:
+	LDC DMAC0, XIZ
+L1415:
+	EXTZ XWA
+L1416:
+	EXTZ DE
+L1417:
+	MUL HL, 133
+L1418:
+	MUL HL, 248
+L1419:
+	MUL DE, 22
+L1420:
+	SCF
+L1421:
+	MUL BC, 160
+L1422:
+	DI
+L1423:
+	LDC DMAS0, XWA
+L1424:
+	EXTZ XIZ
+L1425:
+	MUL BC, 133
+L1426:
+	EXTZ XHL
+L1427:
+	LDC DMAS0, XWA
+L1428:
+	MUL DE, 55
+L1429:
+	LDC DMAS0, XDE
+L1430:
+	LDIR
+L1431:
+	RET
+L1432:
+	LDC DMAD0, XIX
+L1433:
+	MUL WA, 134
+L1434:
+	MUL HL, 81
+L1435:
+	LDIR
+L1436:
+	LDIR
+L1437:
+	LDC DMAS0, XBC
+L1438:
+	RETI
+L1439:
+	DI
+L1440:
+	EI 0
+L1441:
+	LDC DMAC0, XIY
+L1442:
+	EXTZ XWA
+L1443:
+	EXTZ XBC
+L1444:
+	EXTZ IZ
+L1445:
+	MUL HL, 127
+L1446:
+	EXTZ BC
+L1447:
+	EXTZ BC
+L1448:
+	MUL DE, 123
+L1449:
+	LDC DMAM0, XIZ
+L1450:
+	MUL BC, 198
+L1451:
+	LDC DMAM0, XIX
+L1452:
+	HALT
+L1453:
+	EI 0
+L1454:
+	LDC DMAM0, XIY
+L1455:
+	LDC DMAM0, XWA
+L1456:
+	EI 0
+L1457:
+	LDC DMAC0, XDE
+L1458:
+	LDC DMAD0, XHL
+L1459:
+	LDC DMAS0, XHL
+L1460:
+	MUL WA, 48
+L1461:
+	NOP
+L1462:
+	MUL HL, 174
+L1463:
+	EXTZ XHL
+L1464:
+	NOP
+L1465:
+	MUL WA, 3
+L1466:
+	EXTZ IZ
+L1467:
+	RETI
+L1468:
+	SCF
+L1469:
+	EI 0
+L1470:
+	LDC DMAM0, XIY
+L1471:
+	HALT
+L1472:
+	EXTZ XIX
+L1473:
+	NOP
+L1474:
+	LDIR
+L1475:
+	DI
+L1476:
+	LDC DMAS0, XBC
+L1477:
+	EXTZ XHL
+L1478:
+	MUL WA, 23
+L1479:
+	SCF
+L1480:
+	EXTZ XIZ
+L1481:
+	EXTZ IX
+L1482:
+	LDC DMAC0, XIY
+L1483:
+	MUL WA, 48
+L1484:
+	EXTZ XIX
+L1485:
+	MUL BC, 119
+L1486:
+	MUL DE, 217
+L1487:
+	LDC DMAM0, XIZ
+L1488:
+	MUL WA, 224
+L1489:
+	MUL DE, 23
+L1490:
+	DI
+L1491:
+	EXTZ IY
+L1492:
+	LDC DMAD0, XBC
+L1493:
+	LDC DMAS0, XDE
+L1494:
+	MUL HL, 227
+L1495:
+	EXTZ XHL
+L1496:
+	DI
+L1497:
+	RCF
+L1498:
+	EXTZ XHL
+L1499:
+	RET
+L1500:
+	DI
+L1501:
+	EXTZ HL
+L1502:
+	MUL HL, 102
+L1503:
+	LDC DMAS0, XBC
+L1504:
+	LDC DMAS0, XIX
+L1505:
+	EXTZ BC
+L1506:
+	SCF
+L1507:
+	EXTZ XBC
+L1508:
+	EXTZ XIZ
+L1509:
+	EXTZ DE
+L1510:
+	LDC DMAD0, XIZ
+L1511:
+	EXTZ BC
+L1512:
+	EXTZ XIY
+L1513:
+	EI 0
+L1514:
+	EXTZ XIZ
+L1515:
+	LDIR
+L1516:
+	MUL DE, 182
+L1517:
+	MUL WA, 190
+L1518:
+	LDC DMAC0, XDE
+L1519:
+	RETI
+L1520:
+	EXTZ DE
+L1521:
+	EI 0
+L1522:
+	EXTZ XDE
+L1523:
+	HALT
+L1524:
+	NOP
+L1525:
+	MUL WA, 66
+L1526:
+	EXTZ WA
+L1527:
+	MUL BC, 193
+L1528:
+	LDC DMAC0, XDE
+L1529:
+	MUL BC, 28
+L1530:
+	MUL WA, 23
+L1531:
+	LDC DMAS0, XIY
+L1532:
+	SCF
+L1533:
+	EXTZ WA
+L1534:
+	MUL WA, 216
+L1535:
+	LDC DMAM0, XIZ
+L1536:
+	MUL HL, 137
+L1537:
+	EXTZ XIY
+L1538:
+	EXTZ HL
+L1539:
+	RETI
+L1540:
+	LDC DMAM0, XIY
+L1541:
+	LDIR
+L1542:
+	EXTZ BC
+L1543:
+	LDIR
+L1544:
+	MUL WA, 130
+L1545:
+	NOP
+L1546:
+	EXTZ IZ
+L1547:
+	EXTZ IX
+L1548:
+	MUL HL, 48
+L1549:
+	MUL BC, 92
+L1550:
+	LDC DMAM0, XWA
+L1551:
+	EXTZ IZ
+L1552:
+	MUL BC, 171
+L1553:
+	EXTZ IY
+L1554:
+	EXTZ IY
+L1555:
+	LDC DMAD0, XIY
+L1556:
+	LDC DMAC0, XIX
+L1557:
+	LDC DMAD0, XIY
+L1558:
+	MUL BC, 28
+L1559:
+	MUL BC, 51
+L1560:
+	LDC DMAM0, XDE
+L1561:
+	EXTZ XWA
+L1562:
+	MUL HL, 63
+L1563:
+	EXTZ XIZ
+L1564:
+	LDC DMAM0, XIZ
+L1565:
+	NOP
+L1566:
+	MUL WA, 132
+L1567:
+	MUL BC, 209
+L1568:
+	RCF
+L1569:
+	LDC DMAM0, XIZ
+L1570:
+	MUL HL, 76
+L1571:
+	LDC DMAD0, XBC
+L1572:
+	EXTZ IZ
+L1573:
+	LDC DMAS0, XIY
+L1574:
+	MUL DE, 24
+L1575:
+	EXTZ IX
+L1576:
+	RET
+L1577:
+	EXTZ XBC
+L1578:
+	LDC DMAD0, XIX
+L1579:
+	MUL DE, 242
+L1580:
+	MUL BC, 71
+L1581:
+	EXTZ IY
+L1582:
+	NOP
+L1583:
+	LDC DMAC0, XDE
+L1584:
+	LDC DMAM0, XIX
+L1585:
+	EXTZ XBC
+L1586:
+	RCF
+L1587:
+	EXTZ XDE
+L1588:
+	NOP
+L1589:
+	MUL WA, 241
+L1590:
+	LDC DMAS0, XIY
+L1591:
+	DI
+L1592:
+	LDC DMAC0, XHL
+L1593:
+	MUL HL, 186
+L1594:
+	EXTZ WA
+L1595:
+	MUL WA, 88
+L1596:
+	LDC DMAC0, XBC
+L1597:
+	MUL DE, 46
+L1598:
+	RET
+L1599:
+	MUL WA, 167
+L1600:
+	MUL HL, 250
+L1601:
+	HALT
+L1602:
+	LDIR
+L1603:
+	RET
+L1604:
+	EXTZ IY
+L1605:
+	MUL DE, 213
+L1606:
+	LDC DMAD0, XWA
+L1607:
+	HALT
+L1608:
+	EXTZ XWA
+L1609:
+	LDC DMAM0, XWA
+L1610:
+	LDC DMAS0, XIX
+L1611:
+	MUL HL, 197
+L1612:
+	MUL HL, 53
+L1613:
+	EXTZ IZ
+L1614:
+	LDC DMAM0, XIZ
+L1615:
+	LDIR
+L1616:
+	MUL BC, 149
+L1617:
+	LDC DMAC0, XIZ
+L1618:
+	LDC DMAC0, XHL
+L1619:
+	LDC DMAC0, XBC
+L1620:
+	MUL HL, 162
+L1621:
+	LDC DMAS0, XBC
+L1622:
+	LDC DMAC0, XBC
+L1623:
+	HALT
+L1624:
+	LDC DMAS0, XWA
+L1625:
+	SCF
+L1626:
+	LDIR
+L1627:
+	DI
+L1628:
+	LDC DMAD0, XBC
+L1629:
+	LDC DMAC0, XIY
+L1630:
+	LDC DMAD0, XBC
+L1631:
+	RET
+L1632:
+	EXTZ XIX
+L1633:
+	NOP
+L1634:
+	LDC DMAM0, XBC
+L1635:
+	MUL HL, 226
+L1636:
+	MUL WA, 211
+L1637:
+	MUL BC, 12
+L1638:
+	MUL HL, 43
+L1639:
+	LDC DMAC0, XIY
+L1640:
+	EXTZ XDE
+L1641:
+	EXTZ XWA
+L1642:
+	EI 0
+L1643:
+	MUL HL, 134
+L1644:
+	MUL WA, 110
+L1645:
+	MUL HL, 30
+L1646:
+	EXTZ XWA
+L1647:
+	HALT
+L1648:
+	MUL BC, 29
+L1649:
+	MUL DE, 176
+L1650:
+	EXTZ DE
+L1651:
+	EXTZ XDE
+L1652:
+	LDIR
+L1653:
+	LDC DMAD0, XWA
+L1654:
+	HALT
+L1655:
+	MUL DE, 199
+L1656:
+	LDC DMAM0, XDE
+L1657:
+	LDC DMAM0, XDE
+L1658:
+	MUL DE, 205
+L1659:
+	LDC DMAM0, XHL
+L1660:
+	RCF
+L1661:
+	MUL WA, 55
+L1662:
+	DI
+L1663:
+	EI 0
+L1664:
+	LDC DMAM0, XIX
+L1665:
+	RCF
+L1666:
+	EXTZ DE
+L1667:
+	MUL BC, 250
+L1668:
+	LDC DMAD0, XBC
+L1669:
+	MUL WA, 67
+L1670:
+	RCF
+L1671:
+	MUL HL, 252
+L1672:
+	NOP
+L1673:
+	MUL BC, 91
+L1674:
+	LDC DMAM0, XIY
+L1675:
+	HALT
+L1676:
+	NOP
+L1677:
+	LDC DMAS0, XIZ
+L1678:
+	MUL HL, 76
+L1679:
+	MUL BC, 217
+L1680:
+	MUL BC, 37
+L1681:
+	MUL HL, 193
+L1682:
+	MUL HL, 31
+L1683:
+	MUL WA, 147
+L1684:
+	MUL DE, 28
+L1685:
+	EXTZ HL
+L1686:
+	LDC DMAD0, XIX
+L1687:
+	EXTZ XIX
+L1688:
+	LDC DMAS0, XHL
+L1689:
+	HALT
+L1690:
+	LDC DMAM0, XIZ
+L1691:
+	MUL BC, 154
+L1692:
+	DI
+L1693:
+	NOP
+L1694:
+	HALT
+L1695:
+	MUL WA, 236
+L1696:
+	LDC DMAS0, XDE
+L1697:
+	LDC DMAM0, XDE
+L1698:
+	LDC DMAM0, XWA
+L1699:
+	LDC DMAS0, XWA
+L1700:
+	MUL DE, 102
+L1701:
+	LDC DMAS0, XIY
+L1702:
+	LDC DMAD0, XIX
+L1703:
+	EXTZ XDE
+L1704:
+	MUL DE, 132
+L1705:
+	LDC DMAM0, XBC
+L1706:
+	LDC DMAM0, XHL
+L1707:
+	LDC DMAC0, XWA
+L1708:
+	EXTZ HL
+L1709:
+	EXTZ HL
+L1710:
+	EXTZ XHL
+L1711:
+	EXTZ XIY
+L1712:
+	LDC DMAD0, XBC
+L1713:
+	EI 0
+L1714:
+	EXTZ XIX
+L1715:
+	NOP
+L1716:
+	EXTZ XDE
+L1717:
+	LDC DMAS0, XWA
+L1718:
+	LDC DMAM0, XIZ
+L1719:
+	SCF
+L1720:
+	MUL DE, 59
+L1721:
+	EXTZ IZ
+L1722:
+	MUL DE, 179
+L1723:
+	LDC DMAM0, XIX
+L1724:
+	EXTZ BC
+L1725:
+	MUL WA, 150
+L1726:
+	LDC DMAM0, XBC
+L1727:
+	LDC DMAD0, XDE
+L1728:
+	LDC DMAM0, XWA
+L1729:
+	MUL DE, 106
+L1730:
+	EXTZ IY
+L1731:
+	LDC DMAC0, XWA
+L1732:
+	MUL HL, 126
+L1733:
+	SCF
+L1734:
+	MUL WA, 196
+L1735:
+	EXTZ WA
+L1736:
+	LDC DMAS0, XWA
+L1737:
+	EXTZ XIY
+L1738:
+	MUL HL, 4
+L1739:
+	MUL WA, 30
+L1740:
+	EXTZ HL
+L1741:
+	EXTZ DE
+L1742:
+	MUL BC, 31
+L1743:
+	LDC DMAD0, XHL
+L1744:
+	EXTZ DE
+L1745:
+	EXTZ WA
+L1746:
+	EXTZ XIX
+L1747:
+	LDC DMAM0, XBC
+L1748:
+	MUL DE, 245
+L1749:
+	MUL BC, 213
+L1750:
+	NOP
+L1751:
+	LDC DMAS0, XHL
+L1752:
+	NOP
+L1753:
+	MUL WA, 203
+L1754:
+	RET
+L1755:
+	MUL DE, 108
+L1756:
+	MUL BC, 54
+L1757:
+	EXTZ XBC
+L1758:
+	DI
+L1759:
+	MUL HL, 213
+L1760:
+	SCF
+L1761:
+	LDC DMAS0, XIY
+L1762:
+	MUL WA, 115
+L1763:
+	MUL BC, 175
+L1764:
+	LDIR
+L1765:
+	EXTZ XIY
+L1766:
+	LDC DMAC0, XIY
+L1767:
+	EXTZ DE
+L1768:
+	LDC DMAM0, XIX
+L1769:
+	MUL HL, 96
+L1770:
+	SCF
+L1771:
+	MUL WA, 159
+L1772:
+	EI 0
+L1773:
+	LDC DMAM0, XBC
+L1774:
+	LDC DMAD0, XIY
+L1775:
+	MUL WA, 163
+L1776:
+	DI
+L1777:
+	LDC DMAM0, XHL
+L1778:
+	MUL WA, 16
+L1779:
+	LDC DMAD0, XIZ
+L1780:
+	EI 0
+L1781:
+	LDIR
+L1782:
+	RCF
+L1783:
+	LDC DMAM0, XDE
+L1784:
+	RETI
+L1785:
+	DI
+L1786:
+	MUL WA, 141
+L1787:
+	LDIR
+L1788:
+	MUL DE, 122
+L1789:
+	SCF
+L1790:
+	EXTZ DE
+L1791:
+	NOP
+L1792:
+	MUL BC, 110
+L1793:
+	MUL WA, 189
+L1794:
+	MUL WA, 231
+L1795:
+	RCF
+L1796:
+	RET
+L1797:
+	MUL HL, 174
+L1798:
+	MUL DE, 226
+L1799:
+	DI
+L1800:
+	LDC DMAD0, XIZ
+L1801:
+	EXTZ XDE
+L1802:
+	LDC DMAD0, XIX
+L1803:
+	MUL BC, 45
+L1804:
+	LDC DMAD0, XDE
+L1805:
+	LDC DMAD0, XIY
+L1806:
+	LDC DMAS0, XIX
+L1807:
+	LDC DMAC0, XWA
+L1808:
+	EXTZ XIZ
+L1809:
+	LDC DMAS0, XDE
+L1810:
+	MUL WA, 46
+L1811:
+	MUL DE, 63
+L1812:
+	LDC DMAS0, XBC
+L1813:
+	MUL WA, 164
+L1814:
+	EI 0
+L1815:
+	MUL WA, 165
+L1816:
+	EXTZ XDE
+L1817:
+	MUL DE, 239
+L1818:
+	HALT
+L1819:
+	LDC DMAM0, XIX
+L1820:
+	MUL DE, 12
+L1821:
+	NOP
+L1822:
+	NOP
+L1823:
+	EXTZ BC
+L1824:
+	EXTZ IY
+L1825:
+	LDIR
+L1826:
+	RCF
+L1827:
+	EXTZ IX
+L1828:
+	LDC DMAD0, XWA
+L1829:
+	MUL WA, 100
+L1830:
+	MUL DE, 54
+L1831:
+	LDC DMAC0, XIY
+L1832:
+	DI
+L1833:
+	LDC DMAS0, XDE
+L1834:
+	NOP
+L1835:
+	MUL WA, 234
+L1836:
+	EXTZ BC
+L1837:
+	EXTZ XDE
+L1838:
+	MUL BC, 120
+L1839:
+	MUL HL, 0
+L1840:
+	EXTZ XWA
+L1841:
+	RETI
+L1842:
+	EXTZ BC
+L1843:
+	MUL WA, 213
+L1844:
+	EXTZ XHL
+L1845:
+	LDC DMAC0, XHL
+L1846:
+	EXTZ XWA
+L1847:
+	LDC DMAS0, XIZ
+L1848:
+	LDC DMAC0, XIZ
+L1849:
+	EXTZ WA
+L1850:
+	MUL DE, 49
+L1851:
+	MUL BC, 28
+L1852:
+	LDC DMAC0, XIY
+L1853:
+	EI 0
+L1854:
+	LDC DMAM0, XIZ
+L1855:
+	LDC DMAS0, XDE
+L1856:
+	NOP
+L1857:
+	MUL HL, 155
+L1858:
+	MUL HL, 215
+L1859:
+	EXTZ XHL
+L1860:
+	EXTZ HL
+L1861:
+	MUL WA, 10
+L1862:
+	EXTZ XIZ
+L1863:
+	EXTZ XHL
+L1864:
+	MUL WA, 143
+L1865:
+	LDC DMAM0, XIX
+L1866:
+	LDC DMAC0, XIY
+L1867:
+	LDC DMAC0, XIX
+L1868:
+	LDC DMAM0, XIX
+L1869:
+	MUL BC, 244
+L1870:
+	EI 0
+L1871:
+	LDC DMAC0, XWA
+L1872:
+	EXTZ BC
+L1873:
+	RET
+L1874:
+	RETI
+L1875:
+	MUL HL, 104
+L1876:
+	LDC DMAD0, XWA
+L1877:
+	EXTZ XWA
+L1878:
+	LDC DMAD0, XIX
+L1879:
+	LDC DMAM0, XIY
+L1880:
+	LDC DMAS0, XDE
+L1881:
+	EXTZ DE
+L1882:
+	MUL WA, 188
+L1883:
+	EXTZ HL
+L1884:
+	EXTZ HL
+L1885:
+	EXTZ DE
+L1886:
+	EXTZ XDE
+L1887:
+	MUL WA, 76
+L1888:
+	MUL WA, 250
+L1889:
+	LDC DMAD0, XHL
+L1890:
+	EXTZ XHL
+L1891:
+	EXTZ IX
+L1892:
+	MUL HL, 77
+L1893:
+	EXTZ WA
+L1894:
+	MUL BC, 14
+L1895:
+	LDC DMAM0, XBC
+L1896:
+	EXTZ BC
+L1897:
+	MUL WA, 229
+L1898:
+	EXTZ XBC
+L1899:
+	DI
+L1900:
+	LDC DMAC0, XDE
+L1901:
+	LDC DMAD0, XDE
+L1902:
+	LDC DMAD0, XDE
+L1903:
+	EXTZ IX
+L1904:
+	HALT
+L1905:
+	EXTZ XIY
+L1906:
+	RET
+L1907:
+	HALT
+L1908:
+	NOP
+L1909:
+	EXTZ XBC
+L1910:
+	MUL BC, 201
+L1911:
+	MUL HL, 233
+L1912:
+	HALT
+L1913:
+	RET
+L1914:
+	MUL BC, 14
+L1915:
+	MUL DE, 6
+L1916:
+	EI 0
+L1917:
+	NOP
+L1918:
+	SCF
+L1919:
+	MUL BC, 12
+L1920:
+	MUL HL, 253
+L1921:
+	MUL WA, 243
+L1922:
+	LDC DMAS0, XIZ
+L1923:
+	EXTZ HL
+L1924:
+	LDC DMAD0, XWA
+L1925:
+	MUL HL, 190
+L1926:
+	LDC DMAC0, XBC
+L1927:
+	SCF
+L1928:
+	EXTZ XIY
+L1929:
+	EXTZ XIY
+L1930:
+	LDC DMAS0, XIX
+L1931:
+	LDC DMAD0, XHL
+L1932:
+	SCF
+L1933:
+	EXTZ XIZ
+L1934:
+	MUL BC, 2
+L1935:
+	MUL DE, 0
+L1936:
+	EXTZ XIY
+L1937:
+	DI
+L1938:
+	EXTZ IX
+L1939:
+	LDC DMAM0, XIY
+L1940:
+	MUL HL, 10
+L1941:
+	MUL WA, 138
+L1942:
+	MUL BC, 58
+L1943:
+	LDC DMAM0, XIZ
+L1944:
+	EXTZ XIY
+L1945:
+	LDC DMAC0, XWA
+L1946:
+	DI
+L1947:
+	LDC DMAS0, XBC
+L1948:
+	SCF
+L1949:
+	MUL WA, 24
+L1950:
+	MUL DE, 64
+L1951:
+	RET
+L1952:
+	MUL HL, 231
+L1953:
+	LDC DMAS0, XDE
+L1954:
+	SCF
+L1955:
+	MUL DE, 21
+L1956:
+	LDC DMAD0, XDE
+L1957:
+	LDC DMAC0, XDE
+L1958:
+	DI
+L1959:
+	SCF
+L1960:
+	EXTZ DE
+L1961:
+	LDC DMAS0, XDE
+L1962:
+	EXTZ IX
+L1963:
+	LDC DMAD0, XIX
+L1964:
+	EXTZ IY
+L1965:
+	LDC DMAS0, XBC
+L1966:
+	NOP
+L1967:
+	LDC DMAC0, XIX
+L1968:
+	RETI
+L1969:
+	MUL WA, 191
+L1970:
+	MUL DE, 254
+L1971:
+	EXTZ HL
+L1972:
+	LDC DMAS0, XIY
+L1973:
+	EXTZ XBC
+L1974:
+	LDC DMAM0, XDE
+L1975:
+	MUL HL, 130
+L1976:
+	MUL WA, 138
+L1977:
+	MUL DE, 156
+L1978:
+	HALT
+L1979:
+	LDC DMAC0, XWA
+L1980:
+	MUL WA, 194
+L1981:
+	EXTZ XIX
+L1982:
+	MUL WA, 159
+L1983:
+	LDC DMAC0, XHL
+L1984:
+	LDC DMAD0, XDE
+L1985:
+	HALT
+L1986:
+	LDC DMAD0, XHL
+L1987:
+	LDC DMAM0, XIX
+L1988:
+	EXTZ IZ
+L1989:
+	DI
+L1990:
+	EXTZ XDE
+L1991:
+	MUL BC, 19
+L1992:
+	MUL DE, 181
+L1993:
+	LDC DMAS0, XBC
+L1994:
+	LDIR
+L1995:
+	RCF
+L1996:
+	LDC DMAC0, XHL
+L1997:
+	NOP
+L1998:
+	RCF
+L1999:
+	EXTZ XIZ
+L2000:
+	LDC DMAM0, XWA
+L2001:
+	HALT
+L2002:
+	RET
+L2003:
+	EXTZ BC
+L2004:
+	LDC DMAC0, XIX
+L2005:
+	LDC DMAC0, XIX
+L2006:
+	RCF
+L2007:
+	EXTZ BC
+L2008:
+	EI 0
+L2009:
+	LDC DMAC0, XIZ
+L2010:
+	EXTZ DE
+L2011:
+	EXTZ DE
+L2012:
+	LDC DMAM0, XDE
+L2013:
+	MUL BC, 209
+L2014:
+	LDC DMAS0, XIX
+L2015:
+	LDC DMAC0, XDE
+L2016:
+	SCF
+L2017:
+	RCF
+L2018:
+	LDC DMAM0, XIY
+L2019:
+	HALT
+L2020:
+	LDC DMAD0, XIZ
+L2021:
+	LDC DMAS0, XDE
+L2022:
+	EXTZ BC
+L2023:
+	EI 0
+L2024:
+	LDIR
+L2025:
+	LDC DMAD0, XDE
+L2026:
+	RET
+L2027:
+	EXTZ BC
+L2028:
+	MUL BC, 193
+L2029:
+	EXTZ XIX
+L2030:
+	LDC DMAM0, XDE
+L2031:
+	EXTZ XIY
+L2032:
+	MUL DE, 236
+L2033:
+	SCF
+L2034:
+	EXTZ XIY
+L2035:
+	MUL WA, 152
+L2036:
+	RETI
+L2037:
+	LDC DMAC0, XHL
+L2038:
+	EXTZ XHL
+L2039:
+	LDC DMAD0, XDE
+L2040:
+	RET
+L2041:
+	LDC DMAM0, XHL
+L2042:
+	EXTZ XIY
+L2043:
+	HALT
+L2044:
+	MUL WA, 206
+L2045:
+	LDC DMAD0, XIX
+L2046:
+	MUL DE, 21
+L2047:
+	LDC DMAS0, XHL
+L2048:
+	MUL WA, 15
+L2049:
+	EI 0
+L2050:
+	SCF
+L2051:
+	SCF
+L2052:
+	RET
+L2053:
+	LDC DMAC0, XIZ
+L2054:
+	SCF
+L2055:
+	EXTZ IX
+L2056:
+	EXTZ XDE
+L2057:
+	MUL DE, 81
+L2058:
+	EXTZ IX
+L2059:
+	EXTZ IX
+L2060:
+	LDIR
+L2061:
+	LDC DMAS0, XIZ
+L2062:
+	EXTZ DE
+L2063:
+	RETI
+L2064:
+	EXTZ DE
+L2065:
+	MUL HL, 40
+L2066:
+	EXTZ IX
+L2067:
+	MUL WA, 167
+L2068:
+	DI
+L2069:
+	MUL DE, 42
+L2070:
+	EXTZ XIX
+L2071:
+	EI 0
+L2072:
+	DI
+L2073:
+	LDC DMAM0, XIZ
+L2074:
+	EXTZ HL
+L2075:
+	LDC DMAD0, XHL
+L2076:
+	LDC DMAC0, XHL
+L2077:
+	EXTZ DE
+L2078:
+	LDC DMAD0, XIY
+L2079:
+	LDC DMAM0, XHL
+L2080:
+	LDC DMAS0, XWA
+L2081:
+	MUL BC, 241
+L2082:
+	MUL DE, 214
+L2083:
+	MUL HL, 255
+L2084:
+	MUL BC, 131
+L2085:
+	EXTZ DE
+L2086:
+	LDC DMAC0, XHL
+L2087:
+	EXTZ IY
+L2088:
+	LDC DMAM0, XBC
+L2089:
+	EXTZ DE
+L2090:
+	EXTZ BC
+L2091:
+	RETI
+L2092:
+	EXTZ XBC
+L2093:
+	MUL BC, 6
+L2094:
+	MUL BC, 157
+L2095:
+	EXTZ WA
+L2096:
+	MUL WA, 8
+L2097:
+	EXTZ IX
+L2098:
+	RCF
+L2099:
+	RETI
+L2100:
+	EXTZ DE
+L2101:
+	MUL WA, 201
+L2102:
+	LDC DMAM0, XHL
+L2103:
+	LDC DMAD0, XBC
+L2104:
+	EXTZ DE
+L2105:
+	LDC DMAD0, XBC
+L2106:
+	HALT
+L2107:
+	MUL HL, 57
+L2108:
+	LDC DMAS0, XIZ
+L2109:
+	EXTZ HL
+L2110:
+	MUL WA, 167
+L2111:
+	RET
+L2112:
+	LDC DMAS0, XIZ
+L2113:
+	EXTZ XBC
+L2114:
+	LDC DMAC0, XIZ
+L2115:
+	MUL HL, 169
+L2116:
+	RCF
+L2117:
+	LDC DMAC0, XBC
+L2118:
+	LDC DMAM0, XIX
+L2119:
+	MUL WA, 233
+L2120:
+	LDC DMAS0, XHL
+L2121:
+	LDC DMAD0, XDE
+L2122:
+	MUL HL, 243
+L2123:
+	MUL DE, 84
+L2124:
+	EXTZ IZ
+L2125:
+	EI 0
+L2126:
+	LDC DMAC0, XBC
+L2127:
+	MUL WA, 207
+L2128:
+	MUL BC, 103
+L2129:
+	LDC DMAS0, XWA
+L2130:
+	LDC DMAS0, XWA
+L2131:
+	EXTZ IY
+L2132:
+	EXTZ XIZ
+L2133:
+	LDC DMAC0, XBC
+L2134:
+	EXTZ XIZ
+L2135:
+	EI 0
+L2136:
+	MUL HL, 187
+L2137:
+	EXTZ XIX
+L2138:
+	EXTZ XDE
+L2139:
+	EXTZ IY
+L2140:
+	EXTZ WA
+L2141:
+	EI 0
+L2142:
+	LDC DMAM0, XHL
+L2143:
+	EXTZ IZ
+L2144:
+	MUL BC, 126
+L2145:
+	LDC DMAM0, XHL
+L2146:
+	MUL HL, 121
+L2147:
+	LDC DMAS0, XHL
+L2148:
+	EXTZ DE
+L2149:
+	LDC DMAM0, XWA
+L2150:
+	LDC DMAM0, XBC
+L2151:
+	LDC DMAD0, XBC
+L2152:
+	RCF
+L2153:
+	EXTZ XIY
+L2154:
+	MUL HL, 82
+L2155:
+	HALT
+L2156:
+	RCF
+L2157:
+	SCF
+L2158:
+	MUL DE, 253
+L2159:
+	RCF
+L2160:
+	EXTZ BC
+L2161:
+	LDC DMAS0, XBC
+L2162:
+	LDC DMAM0, XIZ
+L2163:
+	LDC DMAC0, XWA
+L2164:
+	RET
+L2165:
+	DI
+L2166:
+	EXTZ XIZ
+L2167:
+	EI 0
+L2168:
+	MUL HL, 26
+L2169:
+	LDC DMAS0, XWA
+L2170:
+	MUL BC, 61
+L2171:
+	MUL HL, 25
+L2172:
+	LDC DMAD0, XIZ
+L2173:
+	LDC DMAC0, XIY
+L2174:
+	EXTZ XIX
+L2175:
+	MUL WA, 100
+L2176:
+	MUL WA, 172
+L2177:
+	MUL HL, 96
+L2178:
+	EXTZ XWA
+L2179:
+	MUL HL, 170
+L2180:
+	LDC DMAS0, XDE
+L2181:
+	SCF
+L2182:
+	EXTZ HL
+L2183:
+	MUL BC, 41
+L2184:
+	LDC DMAM0, XIY
+L2185:
+	LDC DMAM0, XBC
+L2186:
+	LDC DMAD0, XHL
+L2187:
+	EXTZ XBC
+L2188:
+	MUL HL, 196
+L2189:
+	MUL WA, 23
+L2190:
+	EXTZ HL
+L2191:
+	RCF
+L2192:
+	DI
+L2193:
+	MUL BC, 62
+L2194:
+	LDC DMAM0, XIY
+L2195:
+	EXTZ HL
+L2196:
+	LDC DMAD0, XHL
+L2197:
+	LDC DMAD0, XIZ
+L2198:
+	EXTZ DE
+L2199:
+	EXTZ BC
+L2200:
+	EI 0
+L2201:
+	LDC DMAS0, XWA
+L2202:
+	MUL BC, 108
+L2203:
+	LDC DMAD0, XIY
+L2204:
+	LDC DMAC0, XBC
+L2205:
+	LDC DMAD0, XIY
+L2206:
+	MUL DE, 149
+L2207:
+	LDC DMAD0, XIX
+L2208:
+	MUL HL, 30
+L2209:
+	EXTZ XIX
+L2210:
+	MUL BC, 79
+L2211:
+	EXTZ IZ
+L2212:
+	EXTZ DE
+L2213:
+	EXTZ XBC
+L2214:
+	LDIR
+L2215:
+	MUL HL, 16
+L2216:
+	RCF
+L2217:
+	MUL WA, 0
+L2218:
+	MUL WA, 6
+L2219:
+	EXTZ IX
+L2220:
+	EXTZ HL
+L2221:
+	EXTZ HL
+L2222:
+	EXTZ XIX
+L2223:
+	MUL DE, 86
+L2224:
+	EI 0
+L2225:
+	EXTZ IY
+L2226:
+	EI 0
+L2227:
+	EXTZ XDE
+L2228:
+	LDC DMAM0, XDE
+L2229:
+	LDC DMAD0, XWA
+L2230:
+	EI 0
+L2231:
+	LDC DMAD0, XBC
+L2232:
+	LDC DMAS0, XHL
+L2233:
+	EXTZ XIZ
+L2234:
+	SCF
+L2235:
+	LDC DMAM0, XIY
+L2236:
+	EXTZ XDE
+L2237:
+	RETI
+L2238:
+	LDC DMAS0, XIY
+L2239:
+	MUL BC, 77
+L2240:
+	LDC DMAD0, XWA
+L2241:
+	EXTZ XIY
+L2242:
+	EXTZ XBC
+L2243:
+	LDC DMAM0, XBC
+L2244:
+	RET
+L2245:
+	RET
+L2246:
+	EXTZ BC
+L2247:
+	LDC DMAS0, XWA
+L2248:
+	EXTZ IX
+L2249:
+	MUL HL, 189
+L2250:
+	MUL WA, 143
+L2251:
+	LDC DMAS0, XDE
+L2252:
+	LDC DMAM0, XBC
+L2253:
+	MUL BC, 89
+L2254:
+	LDC DMAD0, XBC
+L2255:
+	RETI
+L2256:
+	RETI
+L2257:
+	EXTZ XDE
+L2258:
+	LDC DMAD0, XBC
+L2259:
+	NOP
+L2260:
+	MUL DE, 229
+L2261:
+	MUL BC, 179
+L2262:
+	DI
+L2263:
+	LDC DMAS0, XIY
+L2264:
+	LDC DMAS0, XIX
+L2265:
+	LDC DMAM0, XWA
+L2266:
+	MUL WA, 169
+L2267:
+	RET
+L2268:
+	LDC DMAD0, XIY
+L2269:
+	LDC DMAS0, XIZ
+L2270:
+	MUL BC, 25
+L2271:
+	MUL DE, 16
+L2272:
+	MUL DE, 96
+L2273:
+	EXTZ IY
+L2274:
+	RETI
+L2275:
+	RCF
+L2276:
+	EXTZ XIZ
+L2277:
+	NOP
+L2278:
+	LDC DMAC0, XIZ
+L2279:
+	EXTZ HL
+L2280:
+	LDC DMAM0, XWA
+L2281:
+	LDC DMAM0, XIZ
+L2282:
+	RET
+L2283:
+	LDC DMAM0, XIY
+L2284:
+	MUL BC, 213
+L2285:
+	EXTZ DE
+L2286:
+	EXTZ WA
+L2287:
+	EXTZ DE
+L2288:
+	EXTZ IZ
+L2289:
+	MUL WA, 83
+L2290:
+	EI 0
+L2291:
+	MUL HL, 243
+L2292:
+	LDC DMAM0, XWA
+L2293:
+	MUL HL, 223
+L2294:
+	MUL WA, 174
+L2295:
+	EXTZ HL
+L2296:
+	EXTZ XIY
+L2297:
+	MUL WA, 113
+L2298:
+	LDC DMAD0, XIY
+L2299:
+	LDC DMAC0, XBC
+L2300:
+	LDC DMAS0, XIY
+L2301:
+	EXTZ XIX
+L2302:
+	EXTZ XWA
+L2303:
+	MUL DE, 239
+L2304:
+	RETI
+L2305:
+	LDC DMAS0, XIY
+L2306:
+	MUL DE, 29
+L2307:
+	LDIR
+L2308:
+	LDC DMAM0, XHL
+L2309:
+	SCF
+L2310:
+	LDC DMAM0, XIX
+L2311:
+	SCF
+L2312:
+	MUL BC, 145
+L2313:
+	EXTZ XIZ
+L2314:
+	EI 0
+L2315:
+	EXTZ HL
+L2316:
+	EXTZ XHL
+L2317:
+	SCF
+L2318:
+	NOP
+L2319:
+	LDC DMAM0, XIY
+L2320:
+	EXTZ IY
+L2321:
+	MUL DE, 167
+L2322:
+	EXTZ BC
+L2323:
+	EXTZ XIZ
+L2324:
+	RET
+L2325:
+	MUL WA, 149
+L2326:
+	MUL WA, 186
+L2327:
+	EXTZ IX
+L2328:
+	LDC DMAS0, XDE
+L2329:
+	RETI
+L2330:
+	EXTZ HL
+L2331:
+	MUL WA, 81
+L2332:
+	MUL DE, 239
+L2333:
+	LDC DMAM0, XWA
+L2334:
+	MUL DE, 206
+L2335:
+	EXTZ IX
+L2336:
+	EI 0
+L2337:
+	EI 0
+L2338:
+	LDC DMAD0, XBC
+L2339:
+	HALT
+L2340:
+	DI
+L2341:
+	LDC DMAS0, XIX
+L2342:
+	LDC DMAD0, XIZ
+L2343:
+	EXTZ IY
+L2344:
+	LDC DMAD0, XDE
+L2345:
+	MUL HL, 148
+L2346:
+	EXTZ IX
+L2347:
+	EXTZ DE
+L2348:
+	LDC DMAC0, XIZ
+L2349:
+	LDC DMAD0, XBC
+L2350:
+	EXTZ XIY
+L2351:
+	MUL WA, 155
+L2352:
+	RCF
+L2353:
+	EI 0
+L2354:
+	MUL HL, 216
+L2355:
+	LDC DMAD0, XHL
+L2356:
+	LDC DMAM0, XIY
+L2357:
+	LDIR
+L2358:
+	MUL HL, 56
+L2359:
+	MUL BC, 151
+L2360:
+	EXTZ IX
+L2361:
+	LDC DMAM0, XHL
+L2362:
+	EXTZ DE
+L2363:
+	EXTZ XHL
+L2364:
+	MUL WA, 162
+L2365:
+	MUL BC, 135
+L2366:
+	RET
+L2367:
+	MUL DE, 144
+L2368:
+	EXTZ XWA
+L2369:
+	RET
+L2370:
+	LDC DMAC0, XBC
+L2371:
+	RETI
+L2372:
+	MUL WA, 105
+L2373:
+	LDC DMAC0, XDE
+L2374:
+	EXTZ XIZ
+L2375:
+	DI
+L2376:
+	MUL HL, 165
+L2377:
+	HALT
+L2378:
+	MUL WA, 193
+L2379:
+	MUL WA, 101
+L2380:
+	DI
+L2381:
+	MUL BC, 156
+L2382:
+	LDC DMAM0, XIZ
+L2383:
+	MUL WA, 8
+L2384:
+	NOP
+L2385:
+	MUL DE, 248
+L2386:
+	EXTZ IZ
+L2387:
+	EXTZ HL
+L2388:
+	MUL WA, 159
+L2389:
+	MUL HL, 82
+L2390:
+	LDC DMAS0, XIY
+L2391:
+	LDC DMAD0, XDE
+L2392:
+	LDC DMAD0, XIZ
+L2393:
+	EXTZ DE
+L2394:
+	LDC DMAC0, XBC
+L2395:
+	MUL DE, 228
+L2396:
+	MUL BC, 233
+L2397:
+	MUL WA, 53
+L2398:
+	MUL DE, 178
+L2399:
+	LDC DMAM0, XDE
+L2400:
+	EXTZ XIX
+L2401:
+	LDC DMAS0, XWA
+L2402:
+	EXTZ DE
+L2403:
+	LDC DMAM0, XIX
+L2404:
+	LDC DMAC0, XHL
+L2405:
+	LDC DMAD0, XDE
+L2406:
+	SCF
+L2407:
+	MUL HL, 171
+L2408:
+	EXTZ DE
+L2409:
+	EXTZ WA
+L2410:
+	DI
+L2411:
+	MUL DE, 88
+L2412:
+	MUL HL, 100
+L2413:
+	EXTZ IY
+L2414:
+	MUL DE, 201
+L2415:
+	EXTZ DE
+L2416:
+	HALT
+L2417:
+	RETI
+L2418:
+	MUL DE, 241
+L2419:
+	EXTZ XIY
+L2420:
+	EXTZ HL
+L2421:
+	EXTZ XIY
+L2422:
+	LDC DMAD0, XIY
+L2423:
+	EXTZ IY
+L2424:
+	LDC DMAM0, XHL
+L2425:
+	LDIR
+L2426:
+	MUL BC, 46
+L2427:
+	EXTZ WA
+L2428:
+	LDC DMAD0, XIZ
+L2429:
+	HALT
+L2430:
+	MUL WA, 22
+L2431:
+	LDC DMAS0, XDE
+L2432:
+	RCF
+L2433:
+	EXTZ IX
+L2434:
+	EXTZ IZ
+L2435:
+	LDC DMAM0, XIY
+L2436:
+	EXTZ DE
+L2437:
+	EXTZ XIY
+L2438:
+	EXTZ IX
+L2439:
+	LDC DMAS0, XBC
+L2440:
+	SCF
+L2441:
+	SCF
+L2442:
+	LDC DMAS0, XWA
+L2443:
+	MUL DE, 21
+L2444:
+	MUL BC, 88
+L2445:
+	MUL DE, 206
+L2446:
+	EXTZ XIX
+L2447:
+	NOP
+L2448:
+	EI 0
+L2449:
+	MUL WA, 24
+L2450:
+	HALT
+L2451:
+	MUL DE, 227
+L2452:
+	MUL BC, 245
+L2453:
+	MUL DE, 92
+L2454:
+	LDC DMAS0, XIX
+L2455:
+	RETI
+L2456:
+	MUL BC, 140
+L2457:
+	RCF
+L2458:
+	LDC DMAD0, XBC
+L2459:
+	MUL WA, 22
+L2460:
+	MUL BC, 0
+L2461:
+	EXTZ XWA
+L2462:
+	LDC DMAM0, XWA
+L2463:
+	EXTZ IX
+L2464:
+	LDC DMAS0, XIZ
+L2465:
+	EI 0
+L2466:
+	LDC DMAD0, XBC
+L2467:
+	LDC DMAS0, XWA
+L2468:
+	MUL DE, 111
+L2469:
+	LDC DMAM0, XIX
+L2470:
+	RETI
+L2471:
+	EXTZ DE
+L2472:
+	HALT
+L2473:
+	MUL HL, 126
+L2474:
+	MUL WA, 3
+L2475:
+	LDC DMAD0, XIZ
+L2476:
+	LDC DMAM0, XIX
+L2477:
+	LDC DMAD0, XIY
+L2478:
+	LDIR
+L2479:
+	LDC DMAC0, XIX
+L2480:
+	MUL HL, 168
+L2481:
+	LDC DMAS0, XDE
+L2482:
+	NOP
+L2483:
+	MUL BC, 231
+L2484:
+	EXTZ BC
+L2485:
+	LDIR
+L2486:
+	LDC DMAC0, XWA
+L2487:
+	EXTZ XBC
+L2488:
+	MUL BC, 78
+L2489:
+	EXTZ DE
+L2490:
+	EXTZ XHL
+L2491:
+	SCF
+L2492:
+	LDC DMAM0, XDE
+L2493:
+	MUL WA, 194
+L2494:
+	LDC DMAS0, XBC
+L2495:
+	EXTZ XDE
+L2496:
+	MUL DE, 252
+L2497:
+	LDC DMAD0, XIY
+L2498:
+	EXTZ IX
+L2499:
+	LDC DMAM0, XWA
+L2500:
+	SCF
+L2501:
+	MUL BC, 134
+L2502:
+	HALT
+L2503:
+	EXTZ IZ
+L2504:
+	MUL BC, 101
+L2505:
+	NOP
+L2506:
+	RET
+L2507:
+	EXTZ XDE
+L2508:
+	EXTZ XHL
+L2509:
+	MUL WA, 113
+L2510:
+	EI 0
+L2511:
+	EXTZ IY
+L2512:
+	EXTZ IZ
+L2513:
+	MUL DE, 28
+L2514:
+	RCF
+L2515:
+	MUL WA, 161
+L2516:
+	DI
+L2517:
+	EXTZ XIX
+L2518:
+	MUL HL, 208
+L2519:
+	EXTZ XIZ
+L2520:
+	SCF
+L2521:
+	LDC DMAS0, XDE
+L2522:
+	LDC DMAS0, XWA
+L2523:
+	EXTZ XWA
+L2524:
+	EI 0
+L2525:
+	LDC DMAC0, XWA
+L2526:
+	MUL DE, 207
+L2527:
+	EXTZ DE
+L2528:
+	LDC DMAC0, XIX
+L2529:
+	RCF
+L2530:
+	LDC DMAM0, XBC
+L2531:
+	EXTZ XHL
+L2532:
+	RCF
+L2533:
+	MUL DE, 81
+L2534:
+	LDC DMAC0, XBC
+L2535:
+	MUL BC, 144
+L2536:
+	LDIR
+L2537:
+	EXTZ IY
+L2538:
+	EXTZ DE
+L2539:
+	MUL WA, 252
+L2540:
+	LDC DMAD0, XIZ
+L2541:
+	LDC DMAS0, XBC
+L2542:
+	MUL HL, 183
+L2543:
+	RCF
+L2544:
+	EXTZ XDE
+L2545:
+	MUL HL, 169
+L2546:
+	EI 0
+L2547:
+	LDC DMAD0, XWA
+L2548:
+	MUL BC, 159
+L2549:
+	SCF
+L2550:
+	LDC DMAM0, XHL
+L2551:
+	EXTZ XIZ
+L2552:
+	EXTZ XIY
+L2553:
+	EXTZ WA
+L2554:
+	SCF
+L2555:
+	LDC DMAS0, XIX
+L2556:
+	LDC DMAC0, XHL
+L2557:
+	DI
+L2558:
+	MUL BC, 165
+L2559:
+	SCF
+L2560:
+	LDC DMAS0, XDE
+L2561:
+	LDC DMAC0, XDE
+L2562:
+	EXTZ IX
+L2563:
+	RET
+L2564:
+	EXTZ DE
+L2565:
+	LDC DMAS0, XDE
+L2566:
+	MUL HL, 190
+L2567:
+	LDIR
+L2568:
+	HALT
+L2569:
+	LDC DMAS0, XWA
+L2570:
+	LDC DMAS0, XHL
+L2571:
+	LDC DMAC0, XIY
+L2572:
+	RETI
+L2573:
+	MUL HL, 196
+L2574:
+	MUL HL, 172
+L2575:
+	MUL DE, 215
+L2576:
+	EXTZ HL
+L2577:
+	EXTZ DE
+L2578:
+	MUL DE, 130
+L2579:
+	MUL HL, 8
+L2580:
+	EXTZ IZ
+L2581:
+	MUL DE, 56
+L2582:
+	DI
+L2583:
+	NOP
+L2584:
+	EXTZ XIZ
+L2585:
+	EXTZ BC
+L2586:
+	EXTZ IX
+L2587:
+	LDC DMAD0, XWA
+L2588:
+	EXTZ IZ
+L2589:
+	MUL DE, 186
+L2590:
+	MUL WA, 58
+L2591:
+	MUL HL, 46
+L2592:
+	LDC DMAD0, XIZ
+L2593:
+	RCF
+L2594:
+	MUL WA, 128
+L2595:
+	EI 0
+L2596:
+	RET
+L2597:
+	MUL BC, 190
+L2598:
+	EXTZ XBC
+L2599:
+	LDC DMAM0, XBC
+L2600:
+	MUL HL, 114
+L2601:
+	EI 0
+L2602:
+	MUL WA, 246
+L2603:
+	EXTZ XIX
+L2604:
+	DI
+L2605:
+	RET
+L2606:
+	RCF
+L2607:
+	MUL DE, 84
+L2608:
+	LDC DMAD0, XWA
+L2609:
+	DI
+L2610:
+	EXTZ XIZ
+L2611:
+	LDC DMAC0, XWA
+L2612:
+	LDC DMAC0, XWA
+L2613:
+	MUL HL, 45
+L2614:
+	EXTZ BC
+L2615:
+	LDC DMAD0, XIZ
+L2616:
+	EXTZ XIZ
+L2617:
+	LDC DMAC0, XBC
+L2618:
+	EXTZ XBC
+L2619:
+	LDIR
+L2620:
+	MUL DE, 194
+L2621:
+	LDC DMAC0, XWA
+L2622:
+	MUL DE, 235
+L2623:
+	LDC DMAM0, XHL
+L2624:
+	MUL BC, 201
+L2625:
+	MUL WA, 211
+L2626:
+	MUL WA, 230
+L2627:
+	HALT
+L2628:
+	EI 0
+L2629:
+	EXTZ IZ
+L2630:
+	EXTZ WA
+L2631:
+	LDC DMAM0, XIY
+L2632:
+	MUL BC, 134
+L2633:
+	MUL BC, 219
+L2634:
+	EI 0
+L2635:
+	EXTZ XWA
+L2636:
+	MUL WA, 194
+L2637:
+	EXTZ IY
+L2638:
+	LDC DMAM0, XWA
+L2639:
+	EXTZ XIZ
+L2640:
+	NOP
+L2641:
+	RETI
+L2642:
+	EI 0
+L2643:
+	EXTZ IY
+L2644:
+	EI 0
+L2645:
+	EXTZ XIZ
+L2646:
+	MUL HL, 128
+L2647:
+	EI 0
+L2648:
+	LDC DMAC0, XHL
+L2649:
+	MUL DE, 204
+L2650:
+	MUL BC, 181
+L2651:
+	EXTZ XHL
+L2652:
+	EXTZ XDE
+L2653:
+	MUL WA, 235
+L2654:
+	MUL BC, 33
+L2655:
+	LDC DMAD0, XWA
+L2656:
+	EXTZ DE
+L2657:
+	MUL DE, 208
+L2658:
+	MUL HL, 250
+L2659:
+	MUL HL, 107
+L2660:
+	MUL DE, 127
+L2661:
+	LDC DMAM0, XHL
+L2662:
+	RETI
+L2663:
+	EXTZ XIZ
+L2664:
+	MUL WA, 198
+L2665:
+	DI
+L2666:
+	RCF
+L2667:
+	EXTZ IY
+L2668:
+	NOP
+L2669:
+	MUL BC, 37
+L2670:
+	MUL DE, 27
+L2671:
+	MUL BC, 53
+L2672:
+	EXTZ IY
+L2673:
+	MUL DE, 245
+L2674:
+	LDC DMAC0, XWA
+L2675:
+	LDC DMAC0, XWA
+L2676:
+	MUL HL, 173
+L2677:
+	LDC DMAC0, XIY
+L2678:
+	EXTZ XBC
+L2679:
+	LDC DMAS0, XDE
+L2680:
+	EXTZ WA
+L2681:
+	LDC DMAC0, XIZ
+L2682:
+	MUL DE, 182
+L2683:
+	EXTZ DE
+L2684:
+	MUL BC, 137
+L2685:
+	EXTZ HL
+L2686:
+	LDC DMAS0, XDE
+L2687:
+	MUL WA, 37
+L2688:
+	LDIR
+L2689:
+	EI 0
+L2690:
+	EXTZ IY
+L2691:
+	LDC DMAC0, XIX
+L2692:
+	LDC DMAM0, XIX
+L2693:
+	RCF
+L2694:
+	LDIR
+L2695:
+	LDC DMAD0, XDE
+L2696:
+	LDC DMAD0, XWA
+L2697:
+	RCF
+L2698:
+	EXTZ IX
+L2699:
+	DI
+L2700:
+	MUL WA, 64
+L2701:
+	DI
+L2702:
+	EXTZ IZ
+L2703:
+	MUL DE, 12
+L2704:
+	EXTZ XHL
+L2705:
+	EXTZ XHL
+L2706:
+	MUL DE, 91
+L2707:
+	MUL BC, 77
+L2708:
+	LDC DMAC0, XDE
+L2709:
+	LDC DMAM0, XBC
+L2710:
+	EXTZ HL
+L2711:
+	MUL WA, 97
+L2712:
+	LDC DMAD0, XIY
+L2713:
+	MUL BC, 65
+L2714:
+	EXTZ XIY
+L2715:
+	RETI
+L2716:
+	EXTZ XBC
+L2717:
+	EXTZ XIX
+L2718:
+	EXTZ XDE
+L2719:
+	EXTZ XIY
+L2720:
+	EXTZ XIZ
+L2721:
+	MUL BC, 151
+L2722:
+	MUL WA, 161
+L2723:
+	EXTZ IY
+L2724:
+	MUL HL, 60
+L2725:
+	MUL HL, 21
+L2726:
+	EXTZ IY
+L2727:
+	EXTZ IY
+L2728:
+	NOP
+L2729:
+	SCF
+L2730:
+	DI
+L2731:
+	LDC DMAC0, XDE
+L2732:
+	LDIR
+L2733:
+	LDIR
+L2734:
+	EXTZ IZ
+L2735:
+	HALT
+L2736:
+	LDC DMAM0, XBC
+L2737:
+	MUL DE, 254
+L2738:
+	MUL HL, 74
+L2739:
+	LDC DMAD0, XIY
+L2740:
+	MUL WA, 196
+L2741:
+	EXTZ XWA
+L2742:
+	DI
+L2743:
+	MUL WA, 191
+L2744:
+	RET
+L2745:
+	EXTZ XWA
+L2746:
+	LDC DMAS0, XHL
+L2747:
+	EXTZ XIZ
+L2748:
+	LDC DMAM0, XIX
+L2749:
+	HALT
+L2750:
+	NOP
+L2751:
+	MUL BC, 191
+L2752:
+	NOP
+L2753:
+	EI 0
+L2754:
+	LDC DMAS0, XBC
+L2755:
+	NOP
+L2756:
+	EXTZ XWA
+L2757:
+	LDC DMAM0, XHL
+L2758:
+	MUL HL, 204
+L2759:
+	MUL BC, 102
+L2760:
+	EXTZ IY
+L2761:
+	LDC DMAS0, XHL
+L2762:
+	EXTZ XDE
+L2763:
+	LDC DMAS0, XIZ
+L2764:
+	EXTZ XIZ
+L2765:
+	EXTZ XIX
+L2766:
+	RETI
+L2767:
+	MUL HL, 204
+L2768:
+	MUL HL, 52
+L2769:
+	HALT
+L2770:
+	LDC DMAS0, XIX
+L2771:
+	LDC DMAD0, XIY
+L2772:
+	LDC DMAD0, XWA
+L2773:
+	EXTZ IY
+L2774:
+	MUL HL, 194
+L2775:
+	NOP
+L2776:
+	MUL WA, 144
+L2777:
+	RCF
+L2778:
+	MUL DE, 128
+L2779:
+	MUL DE, 223
+L2780:
+	EI 0
+L2781:
+	RCF
+L2782:
+	MUL DE, 112
+L2783:
+	EXTZ XDE
+L2784:
+	EXTZ XIZ
+L2785:
+	LDC DMAS0, XIX
+L2786:
+	HALT
+L2787:
+	LDC DMAC0, XWA
+L2788:
+	EXTZ WA
+L2789:
+	EXTZ XIZ
+L2790:
+	HALT
+L2791:
+	MUL DE, 117
+L2792:
+	MUL WA, 198
+L2793:
+	MUL WA, 177
+L2794:
+	RETI
+L2795:
+	EI 0
+L2796:
+	EXTZ XIX
+L2797:
+	MUL HL, 43
+L2798:
+	LDC DMAM0, XIZ
+L2799:
+	EI 0
+L2800:
+	MUL DE, 206
+L2801:
+	EXTZ BC
+L2802:
+	MUL BC, 48
+L2803:
+	MUL DE, 158
+L2804:
+	MUL BC, 169
+L2805:
+	LDC DMAD0, XHL
+L2806:
+	MUL HL, 107
+L2807:
+	LDC DMAS0, XWA
+L2808:
+	LDC DMAC0, XIZ
+L2809:
+	MUL DE, 3
+L2810:
+	LDC DMAD0, XHL
+L2811:
+	HALT
+L2812:
+	EXTZ XWA
+L2813:
+	RCF
+L2814:
+	MUL WA, 141
+L2815:
+	DI
+L2816:
+	EI 0
+L2817:
+	EXTZ BC
+L2818:
+	EI 0
+L2819:
+	EXTZ XIX
+L2820:
+	EXTZ XDE
+L2821:
+	RCF
+L2822:
+	EXTZ XIZ
+L2823:
+	EXTZ WA
+L2824:
+	RET
+L2825:
+	MUL DE, 192
+L2826:
+	EXTZ DE
+L2827:
+	MUL HL, 133
+L2828:
+	HALT
+L2829:
+	EXTZ XHL
+L2830:
+	MUL HL, 84
+L2831:
+	MUL HL, 36
+L2832:
+	EXTZ HL
+L2833:
+	LDC DMAS0, XWA
+L2834:
+	MUL BC, 146
+L2835:
+	MUL WA, 187
+L2836:
+	EXTZ BC
+L2837:
+	DI
+L2838:
+	EXTZ XIX
+L2839:
+	MUL BC, 64
+L2840:
+	LDC DMAC0, XIX
+L2841:
+	EXTZ WA
+L2842:
+	EXTZ XBC
+L2843:
+	MUL DE, 86
+L2844:
+	MUL DE, 176
+L2845:
+	MUL WA, 61
+L2846:
+	LDC DMAD0, XHL
+L2847:
+	LDC DMAS0, XIZ
+L2848:
+	RET
+L2849:
+	LDC DMAM0, XIX
+L2850:
+	NOP
+L2851:
+	EXTZ IY
+L2852:
+	MUL DE, 102
+L2853:
+	RET
+L2854:
+	RET
+L2855:
+	EXTZ XWA
+L2856:
+	NOP
+L2857:
+	EXTZ XDE
+L2858:
+	EXTZ DE
+L2859:
+	LDC DMAC0, XBC
+L2860:
+	LDC DMAD0, XDE
+L2861:
+	EXTZ XHL
+L2862:
+	RETI
+L2863:
+	MUL BC, 231
+L2864:
+	LDC DMAC0, XDE
+L2865:
+	RET
+L2866:
+	RET
+L2867:
+	MUL WA, 30
+L2868:
+	LDC DMAD0, XIX
+L2869:
+	MUL HL, 10
+L2870:
+	LDC DMAD0, XIZ
+L2871:
+	MUL DE, 190
+L2872:
+	MUL WA, 95
+L2873:
+	LDC DMAM0, XBC
+L2874:
+	EXTZ XBC
+L2875:
+	MUL HL, 13
+L2876:
+	HALT
+L2877:
+	LDC DMAM0, XBC
+L2878:
+	EI 0
+L2879:
+	LDC DMAM0, XDE
+L2880:
+	LDC DMAC0, XHL
+L2881:
+	MUL DE, 141
+L2882:
+	LDC DMAC0, XIX
+L2883:
+	EXTZ XHL
+L2884:
+	MUL BC, 222
+L2885:
+	MUL WA, 48
+L2886:
+	LDC DMAS0, XIZ
+L2887:
+	EXTZ HL
+L2888:
+	LDC DMAD0, XHL
+L2889:
+	HALT
+L2890:
+	MUL WA, 164
+L2891:
+	LDC DMAM0, XDE
+L2892:
+	LDC DMAC0, XWA
+L2893:
+	MUL HL, 104
+L2894:
+	LDC DMAC0, XIX
+L2895:
+	EXTZ IX
+L2896:
+	EXTZ XIY
+L2897:
+	MUL WA, 31
+L2898:
+	LDC DMAD0, XIY
+L2899:
+	EXTZ XDE
+L2900:
+	MUL WA, 1
+L2901:
+	LDIR
+L2902:
+	LDC DMAS0, XWA
+L2903:
+	MUL DE, 138
+L2904:
+	EXTZ XWA
+L2905:
+	MUL WA, 244
+L2906:
+	LDC DMAD0, XBC
+L2907:
+	RET
+L2908:
+	MUL BC, 3
+L2909:
+	MUL WA, 140
+L2910:
+	EXTZ XBC
+L2911:
+	LDC DMAS0, XIX
+L2912:
+	EXTZ IY
+L2913:
+	EXTZ XIY
+L2914:
+	RETI
+L2915:
+	NOP
+L2916:
+	EXTZ HL
+L2917:
+	EXTZ XWA
+L2918:
+	LDC DMAC0, XIZ
+L2919:
+	MUL DE, 218
+L2920:
+	EXTZ XIX
+L2921:
+	MUL WA, 14
+L2922:
+	EXTZ XDE
+L2923:
+	LDC DMAD0, XIZ
+L2924:
+	MUL HL, 175
+L2925:
+	SCF
+L2926:
+	NOP
+L2927:
+	MUL HL, 243
+L2928:
+	LDC DMAS0, XIZ
+L2929:
+	LDC DMAD0, XWA
+L2930:
+	EXTZ BC
+L2931:
+	EXTZ DE
+L2932:
+	LDC DMAD0, XIY
+L2933:
+	EXTZ XHL
+L2934:
+	NOP
+L2935:
+	MUL WA, 60
+L2936:
+	MUL DE, 46
+L2937:
+	MUL WA, 7
+L2938:
+	RET
+L2939:
+	EXTZ XHL
+L2940:
+	MUL WA, 192
+L2941:
+	MUL BC, 205
+L2942:
+	EXTZ XDE
+L2943:
+	MUL DE, 0
+L2944:
+	MUL DE, 120
+L2945:
+	MUL BC, 148
+L2946:
+	LDC DMAM0, XWA
+L2947:
+	MUL DE, 148
+L2948:
+	EXTZ IY
+L2949:
+	LDC DMAD0, XDE
+L2950:
+	SCF
+L2951:
+	EXTZ WA
+L2952:
+	EXTZ XIY
+L2953:
+	EXTZ DE
+L2954:
+	MUL HL, 97
+L2955:
+	LDC DMAC0, XWA
+L2956:
+	EXTZ XIY
+L2957:
+	EXTZ IZ
+L2958:
+	LDC DMAM0, XBC
+L2959:
+	MUL WA, 111
+L2960:
+	LDC DMAS0, XDE
+L2961:
+	MUL HL, 240
+L2962:
+	EI 0
+L2963:
+	EXTZ IZ
+L2964:
+	MUL BC, 206
+L2965:
+	MUL BC, 144
+L2966:
+	LDC DMAC0, XBC
+L2967:
+	EXTZ IZ
+L2968:
+	EXTZ XWA
+L2969:
+	SCF
+L2970:
+	MUL HL, 112
+L2971:
+	LDC DMAS0, XIZ
+L2972:
+	MUL DE, 80
+L2973:
+	MUL HL, 194
+L2974:
+	EXTZ XWA
+L2975:
+	LDC DMAC0, XBC
+L2976:
+	EXTZ XIX
+L2977:
+	MUL WA, 144
+L2978:
+	HALT
+L2979:
+	LDIR
+L2980:
+	MUL DE, 82
+L2981:
+	EXTZ XHL
+L2982:
+	MUL DE, 98
+L2983:
+	SCF
+L2984:
+	MUL WA, 166
+L2985:
+	EXTZ XIX
+L2986:
+	MUL BC, 82
+L2987:
+	MUL BC, 25
+L2988:
+	SCF
+L2989:
+	NOP
+L2990:
+	EXTZ BC
+L2991:
+	DI
+L2992:
+	RETI
+L2993:
+	LDC DMAM0, XIZ
+L2994:
+	LDC DMAM0, XBC
+L2995:
+	EXTZ DE
+L2996:
+	LDIR
+L2997:
+	MUL DE, 206
+L2998:
+	EI 0
+L2999:
+	RET
+L3000:
+	NOP
+L3001:
+	EXTZ XDE
+L3002:
+	EXTZ DE
+L3003:
+	EXTZ IX
+L3004:
+	MUL HL, 153
+L3005:
+	EXTZ XIY
+L3006:
+	LDC DMAC0, XDE
+L3007:
+	LDC DMAC0, XBC
+L3008:
+	MUL BC, 53
+L3009:
+	DI
+L3010:
+	MUL DE, 69
+L3011:
+	MUL WA, 34
+L3012:
+	MUL DE, 153
+L3013:
+	MUL HL, 237
+L3014:
+	EXTZ WA
+L3015:
+	EXTZ XDE
+L3016:
+	LDC DMAD0, XHL
+L3017:
+	MUL WA, 40
+L3018:
+	LDC DMAM0, XHL
+L3019:
+	RCF
+L3020:
+	MUL DE, 224
+L3021:
+	NOP
+L3022:
+	EXTZ BC
+L3023:
+	EXTZ IZ
+L3024:
+	HALT
+L3025:
+	MUL WA, 226
+L3026:
+	LDC DMAS0, XWA
+L3027:
+	LDC DMAC0, XHL
+L3028:
+	EXTZ WA
+L3029:
+	EXTZ HL
+L3030:
+	NOP
+L3031:
+	EXTZ XHL
+L3032:
+	LDC DMAS0, XIZ
+L3033:
+	MUL WA, 169
+L3034:
+	HALT
+L3035:
+	EXTZ IZ
+L3036:
+	RETI
+L3037:
+	LDC DMAD0, XBC
+L3038:
+	LDIR
+L3039:
+	MUL DE, 84
+L3040:
+	LDC DMAD0, XWA
+L3041:
+	LDIR
+L3042:
+	LDC DMAD0, XWA
+L3043:
+	RET
+L3044:
+	LDC DMAC0, XIY
+L3045:
+	LDC DMAC0, XHL
+L3046:
+	MUL HL, 225
+L3047:
+	RCF
+L3048:
+	EXTZ IY
+L3049:
+	LDC DMAC0, XIZ
+L3050:
+	DI
+L3051:
+	RET
+L3052:
+	LDC DMAS0, XHL
+L3053:
+	MUL WA, 55
+L3054:
+	LDC DMAS0, XDE
+L3055:
+	RETI
+L3056:
+	MUL DE, 123
+L3057:
+	LDC DMAM0, XWA
+L3058:
+	MUL DE, 208
+L3059:
+	MUL HL, 147
+L3060:
+	LDC DMAS0, XIX
+L3061:
+	SCF
+L3062:
+	EXTZ XIZ
+L3063:
+	MUL WA, 133
+L3064:
+	MUL HL, 118
+L3065:
+	EI 0
+L3066:
+	LDC DMAS0, XIY
+L3067:
+	LDIR
+L3068:
+	LDC DMAM0, XIZ
+L3069:
+	EXTZ BC
+L3070:
+	EXTZ DE
+L3071:
+	EXTZ IX
+L3072:
+	MUL DE, 239
+L3073:
+	EXTZ XIZ
+L3074:
+	RET
+L3075:
+	LDC DMAC0, XIY
+L3076:
+	MUL WA, 208
+L3077:
+	EXTZ BC
+L3078:
+	LDIR
+L3079:
+	NOP
+L3080:
+	EXTZ WA
+L3081:
+	NOP
+L3082:
+	RET
+L3083:
+	MUL BC, 18
+L3084:
+	RCF
+L3085:
+	MUL WA, 93
+L3086:
+	RET
+L3087:
+	EXTZ XHL
+L3088:
+	MUL BC, 54
+L3089:
+	LDC DMAC0, XDE
+L3090:
+	LDIR
+L3091:
+	MUL DE, 3
+L3092:
+	NOP
+L3093:
+	EI 0
+L3094:
+	EXTZ WA
+L3095:
+	LDC DMAC0, XIY
+L3096:
+	RCF
+L3097:
+	MUL BC, 173
+L3098:
+	SCF
+L3099:
+	EXTZ DE
+L3100:
+	MUL DE, 118
+L3101:
+	HALT
+L3102:
+	LDC DMAS0, XIY
+L3103:
+	LDC DMAD0, XIY
+L3104:
+	LDC DMAS0, XWA
+L3105:
+	NOP
+L3106:
+	LDC DMAS0, XDE
+L3107:
+	RET
+L3108:
+	NOP
+L3109:
+	MUL HL, 89
+L3110:
+	HALT
+L3111:
+	MUL WA, 177
+L3112:
+	MUL BC, 161
+L3113:
+	EI 0
+L3114:
+	SCF
+L3115:
+	RET
+L3116:
+	EXTZ IX
+L3117:
+	LDC DMAM0, XWA
+L3118:
+	LDC DMAD0, XIY
+L3119:
+	LDC DMAC0, XIX
+L3120:
+	EXTZ XDE
+L3121:
+	MUL HL, 206
+L3122:
+	MUL HL, 122
+L3123:
+	EXTZ DE
+L3124:
+	EXTZ XHL
+L3125:
+	MUL DE, 33
+L3126:
+	LDC DMAM0, XDE
+L3127:
+	EXTZ XIX
+L3128:
+	MUL DE, 210
+L3129:
+	LDC DMAD0, XIX
+L3130:
+	MUL DE, 33
+L3131:
+	DI
+L3132:
+	NOP
+L3133:
+	EXTZ IY
+L3134:
+	EXTZ IY
+L3135:
+	EXTZ IX
+L3136:
+	LDC DMAC0, XIY
+L3137:
+	EI 0
+L3138:
+	MUL HL, 195
+L3139:
+	MUL WA, 221
+L3140:
+	EXTZ BC
+L3141:
+	MUL BC, 251
+L3142:
+	LDC DMAS0, XIX
+L3143:
+	LDC DMAD0, XHL
+L3144:
+	RETI
+L3145:
+	MUL BC, 1
+L3146:
+	DI
+L3147:
+	SCF
+L3148:
+	LDC DMAM0, XDE
+L3149:
+	LDC DMAS0, XBC
+L3150:
+	LDC DMAD0, XIY
+L3151:
+	NOP
+L3152:
+	LDC DMAC0, XIX
+L3153:
+	EXTZ XIZ
+L3154:
+	MUL HL, 182
+L3155:
+	NOP
+L3156:
+	EXTZ XBC
+L3157:
+	LDC DMAS0, XHL
+L3158:
+	MUL BC, 185
+L3159:
+	RETI
+L3160:
+	EXTZ IZ
+L3161:
+	LDC DMAM0, XIZ
+L3162:
+	NOP
+L3163:
+	LDC DMAM0, XDE
+L3164:
+	EXTZ XIZ
+L3165:
+	MUL BC, 29
+L3166:
+	EXTZ IX
+L3167:
+	DI
+L3168:
+	NOP
+L3169:
+	MUL BC, 17
+L3170:
+	LDC DMAC0, XDE
+L3171:
+	EXTZ XHL
+L3172:
+	MUL DE, 55
+L3173:
+	RETI
+L3174:
+	MUL WA, 195
+L3175:
+	NOP
+L3176:
+	EI 0
+L3177:
+	MUL DE, 235
+L3178:
+	RET
+L3179:
+	EXTZ XHL
+L3180:
+	RET
+L3181:
+	RET
+L3182:
+	LDC DMAS0, XIY
+L3183:
+	LDC DMAC0, XHL
+L3184:
+	MUL BC, 19
+L3185:
+	EXTZ HL
+L3186:
+	MUL WA, 195
+L3187:
+	LDC DMAC0, XDE
+L3188:
+	EXTZ XBC
+L3189:
+	LDC DMAC0, XIY
+L3190:
+	LDC DMAD0, XIZ
+L3191:
+	MUL HL, 189
+L3192:
+	MUL BC, 55
+L3193:
+	EXTZ XIY
+L3194:
+	EXTZ XWA
+L3195:
+	RET
+L3196:
+	LDC DMAS0, XIZ
+L3197:
+	HALT
+L3198:
+	LDC DMAM0, XDE
+L3199:
+	EXTZ XWA
+L3200:
+	SCF
+L3201:
+	EXTZ HL
+L3202:
+	LDC DMAD0, XHL
+L3203:
+	MUL HL, 244
+L3204:
+	MUL WA, 200
+L3205:
+	LDIR
+L3206:
+	LDC DMAS0, XIZ
+L3207:
+	LDIR
+L3208:
+	MUL DE, 105
+L3209:
+	EXTZ XHL
+L3210:
+	LDC DMAC0, XIY
+L3211:
+	EXTZ IZ
+L3212:
+	LDC DMAM0, XBC
+L3213:
+	EXTZ IY
+L3214:
+	EXTZ XHL
+L3215:
+	EXTZ XIY
+L3216:
+	LDIR
+L3217:
+	LDC DMAD0, XHL
+L3218:
+	EXTZ IY
+L3219:
+	EXTZ XIZ
+L3220:
+	EXTZ IY
+L3221:
+	LDC DMAM0, XWA
+L3222:
+	LDC DMAM0, XIZ
+L3223:
+	LDC DMAC0, XIZ
+L3224:
+	RCF
+L3225:
+	MUL BC, 205
+L3226:
+	NOP
+L3227:
+	EXTZ WA
+L3228:
+	EXTZ IZ
+L3229:
+	EI 0
+L3230:
+	MUL BC, 117
+L3231:
+	RET
+L3232:
+	EXTZ XIZ
+L3233:
+	LDC DMAS0, XWA
+L3234:
+	HALT
+L3235:
+	MUL BC, 109
+L3236:
+	MUL DE, 221
+L3237:
+	LDC DMAD0, XIY
+L3238:
+	EXTZ IY
+L3239:
+	EXTZ IX
+L3240:
+	NOP
+L3241:
+	EXTZ WA
+L3242:
+	LDC DMAM0, XDE
+L3243:
+	MUL BC, 186
+L3244:
+	EXTZ DE
+L3245:
+	EXTZ XIX
+L3246:
+	EXTZ XWA
+L3247:
+	MUL BC, 223
+L3248:
+	SCF
+L3249:
+	LDC DMAC0, XHL
+L3250:
+	SCF
+L3251:
+	LDC DMAD0, XIX
+L3252:
+	RET
+L3253:
+	MUL HL, 45
+L3254:
+	EXTZ XDE
+L3255:
+	LDC DMAM0, XIZ
+L3256:
+	LDC DMAC0, XIZ
+L3257:
+	LDIR
+L3258:
+	MUL WA, 201
+L3259:
+	HALT
+L3260:
+	EXTZ BC
+L3261:
+	EXTZ BC
+L3262:
+	EXTZ XIX
+L3263:
+	EXTZ XWA
+L3264:
+	MUL HL, 203
+L3265:
+	EI 0
+L3266:
+	LDC DMAD0, XIY
+L3267:
+	LDC DMAS0, XWA
+L3268:
+	MUL DE, 70
+L3269:
+	LDC DMAM0, XIX
+L3270:
+	EXTZ BC
+L3271:
+	LDC DMAM0, XDE
+L3272:
+	EXTZ XIX
+L3273:
+	NOP
+L3274:
+	MUL BC, 198
+L3275:
+	MUL HL, 191
+L3276:
+	RCF
+L3277:
+	EXTZ XIX
+L3278:
+	HALT
+L3279:
+	HALT
+L3280:
+	LDC DMAS0, XWA
+L3281:
+	EXTZ IX
+L3282:
+	EXTZ IX
+L3283:
+	EI 0
+L3284:
+	EXTZ XHL
+L3285:
+	MUL DE, 60
+L3286:
+	MUL WA, 51
+L3287:
+	EXTZ BC
+L3288:
+	LDC DMAM0, XIX
+L3289:
+	EXTZ XHL
+L3290:
+	MUL HL, 173
+L3291:
+	RETI
+L3292:
+	EXTZ XIY
+L3293:
+	MUL HL, 0
+L3294:
+	MUL BC, 22
+L3295:
+	EXTZ HL
+L3296:
+	LDIR
+L3297:
+	MUL DE, 47
+L3298:
+	RCF
+L3299:
+	MUL BC, 187
+L3300:
+	MUL WA, 77
+L3301:
+	MUL HL, 93
+L3302:
+	EXTZ DE
+L3303:
+	MUL BC, 179
+L3304:
+	LDC DMAM0, XIX
+L3305:
+	MUL BC, 247
+L3306:
+	LDIR
+L3307:
+	EXTZ IX
+L3308:
+	EXTZ WA
+L3309:
+	EXTZ XIX
+L3310:
+	EXTZ IX
+L3311:
+	EXTZ XHL
+L3312:
+	MUL WA, 218
+L3313:
+	LDC DMAM0, XHL
+L3314:
+	MUL HL, 48
+L3315:
+	LDC DMAS0, XIY
+L3316:
+	MUL BC, 248
+L3317:
+	EXTZ XIZ
+L3318:
+	LDC DMAD0, XIZ
+L3319:
+	LDC DMAC0, XIY
+L3320:
+	LDC DMAD0, XHL
+L3321:
+	MUL HL, 180
+L3322:
+	LDC DMAM0, XBC
+L3323:
+	EXTZ IX
+L3324:
+	MUL BC, 225
+L3325:
+	MUL BC, 236
+L3326:
+	LDC DMAS0, XHL
+L3327:
+	LDIR
+L3328:
+	LDC DMAS0, XBC
+L3329:
+	SCF
+L3330:
+	RCF
+L3331:
+	HALT
+L3332:
+	RCF
+L3333:
+	MUL DE, 161
+L3334:
+	HALT
+L3335:
+	LDC DMAC0, XDE
+L3336:
+	MUL HL, 233
+L3337:
+	EXTZ IY
+L3338:
+	MUL HL, 173
+L3339:
+	EXTZ DE
+L3340:
+	EXTZ IY
+L3341:
+	MUL HL, 88
+L3342:
+	DI
+L3343:
+	EXTZ WA
+L3344:
+	HALT
+L3345:
+	LDC DMAC0, XWA
+L3346:
+	MUL HL, 52
+L3347:
+	MUL BC, 105
+L3348:
+	EXTZ HL
+L3349:
+	LDC DMAD0, XDE
+L3350:
+	LDC DMAC0, XWA
+L3351:
+	LDC DMAD0, XDE
+L3352:
+	LDC DMAM0, XHL
+L3353:
+	MUL BC, 230
+L3354:
+	EXTZ BC
+L3355:
+	EXTZ XDE
+L3356:
+	MUL BC, 238
+L3357:
+	LDC DMAD0, XBC
+L3358:
+	LDC DMAM0, XIZ
+L3359:
+	LDC DMAC0, XIY
+L3360:
+	MUL BC, 54
+L3361:
+	EXTZ BC
+L3362:
+	MUL HL, 209
+L3363:
+	MUL HL, 184
+L3364:
+	NOP
+L3365:
+	LDC DMAC0, XIX
+L3366:
+	LDC DMAS0, XIY
+L3367:
+	MUL DE, 113
+L3368:
+	MUL HL, 52
+L3369:
+	EXTZ XIX
+L3370:
+	MUL HL, 17
+L3371:
+	SCF
+L3372:
+	MUL DE, 163
+L3373:
+	EXTZ XBC
+L3374:
+	LDC DMAM0, XWA
+L3375:
+	LDC DMAD0, XWA
+L3376:
+	EXTZ DE
+L3377:
+	LDIR
+L3378:
+	RETI
+L3379:
+	MUL HL, 190
+L3380:
+	LDIR
+L3381:
+	MUL HL, 163
+L3382:
+	RETI
+L3383:
+	MUL WA, 126
+L3384:
+	EI 0
+L3385:
+	MUL WA, 29
+L3386:
+	EXTZ BC
+L3387:
+	LDC DMAS0, XIY
+L3388:
+	LDC DMAS0, XHL
+L3389:
+	EI 0
+L3390:
+	EXTZ XWA
+L3391:
+	MUL HL, 203
+L3392:
+	EXTZ XHL
+L3393:
+	EI 0
+L3394:
+	EXTZ XWA
+L3395:
+	MUL WA, 158
+L3396:
+	NOP
+L3397:
+	EXTZ BC
+L3398:
+	LDC DMAD0, XBC
+L3399:
+	MUL HL, 232
+L3400:
+	RETI
+L3401:
+	EXTZ XDE
+L3402:
+	EXTZ XIZ
+L3403:
+	MUL DE, 79
+L3404:
+	EXTZ WA
+L3405:
+	MUL BC, 114
+L3406:
+	LDC DMAC0, XIY
+L3407:
+	MUL HL, 59
+L3408:
+	MUL DE, 98
+L3409:
+	NOP
+L3410:
+	MUL HL, 237
+L3411:
+	EXTZ XIX
+L3412:
+	LDC DMAD0, XBC
+L3413:
+	LDC DMAD0, XDE
+L3414:
+	LDC DMAS0, XIY
+L3415:
+	HALT
+L3416:
+	LDC DMAS0, XBC
+L3417:
+	EXTZ BC
+L3418:
+	LDC DMAS0, XIZ
+L3419:
+	LDC DMAM0, XDE
+L3420:
+	LDC DMAD0, XHL
+L3421:
+	EXTZ XIX
+L3422:
+	LDC DMAS0, XDE
+L3423:
+	LDC DMAC0, XHL
+L3424:
+	LDC DMAC0, XHL
+L3425:
+	MUL DE, 9
+L3426:
+	MUL WA, 248
+L3427:
+	LDC DMAS0, XIX
+L3428:
+	LDIR
+L3429:
+	MUL WA, 206
+L3430:
+	LDIR
+L3431:
+	LDC DMAC0, XBC
+L3432:
+	RCF
+L3433:
+	RETI
+L3434:
+	LDC DMAD0, XWA
+L3435:
+	EXTZ XHL
+L3436:
+	LDC DMAM0, XHL
+L3437:
+	EXTZ XWA
+L3438:
+	LDC DMAM0, XDE
+L3439:
+	RET
+L3440:
+	EXTZ WA
+L3441:
+	LDC DMAM0, XWA
+L3442:
+	HALT
+L3443:
+	EI 0
+L3444:
+	RETI
+L3445:
+	EXTZ IZ
+L3446:
+	MUL HL, 4
+L3447:
+	MUL HL, 35
+L3448:
+	NOP
+L3449:
+	EXTZ XIZ
+L3450:
+	EXTZ XDE
+L3451:
+	HALT
+L3452:
+	DI
+L3453:
+	EXTZ IY
+L3454:
+	SCF
+L3455:
+	LDC DMAD0, XDE
+L3456:
+	HALT
+L3457:
+	LDC DMAM0, XDE
+L3458:
+	HALT
+L3459:
+	EI 0
+L3460:
+	EXTZ IX
+L3461:
+	LDC DMAC0, XHL
+L3462:
+	LDC DMAS0, XIY
+L3463:
+	EI 0
+L3464:
+	LDC DMAM0, XHL
+L3465:
+	LDC DMAS0, XDE
+L3466:
+	DI
+L3467:
+	MUL DE, 80
+L3468:
+	SCF
+L3469:
+	RET
+L3470:
+	MUL HL, 227
+L3471:
+	MUL BC, 108
+L3472:
+	EI 0
+L3473:
+	LDC DMAM0, XWA
+L3474:
+	MUL BC, 84
+L3475:
+	MUL HL, 223
+L3476:
+	LDC DMAC0, XIX
+L3477:
+	RETI
+L3478:
+	EXTZ WA
+L3479:
+	EXTZ XIY
+L3480:
+	MUL HL, 30
+L3481:
+	LDC DMAD0, XIX
+L3482:
+	MUL HL, 44
+L3483:
+	LDC DMAM0, XIY
+L3484:
+	EXTZ IZ
+L3485:
+	MUL WA, 116
+L3486:
+	MUL DE, 132
+L3487:
+	LDC DMAC0, XDE
+L3488:
+	RET
+L3489:
+	EXTZ HL
+L3490:
+	LDIR
+L3491:
+	SCF
+L3492:
+	LDC DMAM0, XBC
+L3493:
+	MUL DE, 247
+L3494:
+	LDC DMAD0, XWA
+L3495:
+	RET
+L3496:
+	MUL BC, 7
+L3497:
+	RETI
+L3498:
+	EI 0
+L3499:
+	EXTZ IY
+L3500:
+	MUL WA, 146
+L3501:
+	RET
+L3502:
+	MUL WA, 229
+L3503:
+	LDC DMAC0, XDE
+L3504:
+	EI 0
+L3505:
+	EXTZ XIX
+L3506:
+	MUL WA, 153
+L3507:
+	MUL BC, 44
+L3508:
+	LDC DMAM0, XIX
+L3509:
+	EXTZ XIX
+L3510:
+	EXTZ XHL
+L3511:
+	MUL HL, 192
+L3512:
+	EXTZ XHL
+L3513:
+	EI 0
+L3514:
+	SCF
+L3515:
+	MUL WA, 4
+L3516:
+	EXTZ XBC
+L3517:
+	MUL DE, 13
+L3518:
+	MUL WA, 156
+L3519:
+	EXTZ BC
+L3520:
+	LDC DMAS0, XIZ
+L3521:
+	LDC DMAC0, XIY
+L3522:
+	LDC DMAS0, XIX
+L3523:
+	LDC DMAC0, XBC
+L3524:
+	MUL WA, 199
+L3525:
+	LDIR
+L3526:
+	EXTZ IZ
+L3527:
+	MUL WA, 4
+L3528:
+	HALT
+L3529:
+	LDC DMAD0, XIX
+L3530:
+	LDC DMAM0, XIY
+L3531:
+	LDC DMAD0, XIY
+L3532:
+	RETI
+L3533:
+	MUL WA, 180
+L3534:
+	LDC DMAS0, XWA
+L3535:
+	EXTZ IZ
+L3536:
+	EXTZ WA
+L3537:
+	RETI
+L3538:
+	EXTZ BC
+L3539:
+	LDC DMAS0, XIX
+L3540:
+	DI
+L3541:
+	LDC DMAC0, XIX
+L3542:
+	MUL HL, 22
+L3543:
+	EXTZ XWA
+L3544:
+	LDC DMAS0, XHL
+L3545:
+	LDC DMAS0, XBC
+L3546:
+	LDC DMAS0, XHL
+L3547:
+	EI 0
+L3548:
+	LDC DMAS0, XDE
+L3549:
+	SCF
+L3550:
+	LDC DMAM0, XBC
+L3551:
+	RET
+L3552:
+	LDC DMAS0, XWA
+L3553:
+	LDC DMAC0, XBC
+L3554:
+	MUL BC, 189
+L3555:
+	LDC DMAS0, XHL
+L3556:
+	LDIR
+L3557:
+	LDC DMAS0, XWA
+L3558:
+	LDIR
+L3559:
+	LDC DMAD0, XHL
+L3560:
+	HALT
+L3561:
+	MUL DE, 10
+L3562:
+	LDC DMAS0, XBC
+L3563:
+	MUL WA, 230
+L3564:
+	NOP
+L3565:
+	EXTZ BC
+L3566:
+	MUL DE, 203
+L3567:
+	MUL HL, 87
+L3568:
+	LDC DMAC0, XHL
+L3569:
+	MUL BC, 28
+L3570:
+	HALT
+L3571:
+	DI
+L3572:
+	RCF
+L3573:
+	DI
+L3574:
+	LDC DMAS0, XWA
+L3575:
+	MUL WA, 82
+L3576:
+	LDC DMAC0, XDE
+L3577:
+	MUL BC, 51
+L3578:
+	EXTZ WA
+L3579:
+	MUL HL, 25
+L3580:
+	MUL BC, 177
+L3581:
+	MUL DE, 236
+L3582:
+	MUL BC, 130
+L3583:
+	MUL WA, 254
+L3584:
+	MUL BC, 93
+L3585:
+	LDIR
+L3586:
+	DI
+L3587:
+	EXTZ XBC
+L3588:
+	EXTZ XDE
+L3589:
+	EI 0
+L3590:
+	LDC DMAC0, XBC
+L3591:
+	HALT
+L3592:
+	EI 0
+L3593:
+	LDC DMAC0, XIX
+L3594:
+	MUL DE, 243
+L3595:
+	EXTZ XBC
+L3596:
+	RCF
+L3597:
+	LDC DMAM0, XWA
+L3598:
+	EI 0
+L3599:
+	EXTZ IX
+L3600:
+	NOP
+L3601:
+	NOP
+L3602:
+	MUL HL, 113
+L3603:
+	EXTZ XIY
+L3604:
+	MUL BC, 166
+L3605:
+	LDC DMAC0, XBC
+L3606:
+	EXTZ XIZ
+L3607:
+	EXTZ XWA
+L3608:
+	NOP
+L3609:
+	MUL HL, 18
+L3610:
+	MUL HL, 87
+L3611:
+	HALT
+L3612:
+	MUL WA, 58
+L3613:
+	MUL BC, 115
+L3614:
+	HALT
+L3615:
+	EXTZ IX
+L3616:
+	MUL WA, 224
+L3617:
+	DI
+L3618:
+	NOP
+L3619:
+	EXTZ IY
+L3620:
+	RCF
+L3621:
+	EXTZ IX
+L3622:
+	LDC DMAC0, XHL
+L3623:
+	EXTZ WA
+L3624:
+	LDC DMAM0, XWA
+L3625:
+	RET
+L3626:
+	LDC DMAM0, XHL
+L3627:
+	EXTZ XWA
+L3628:
+	EXTZ HL
+L3629:
+	MUL BC, 134
+L3630:
+	MUL DE, 219
+L3631:
+	EXTZ WA
+L3632:
+	EXTZ WA
+L3633:
+	EI 0
+L3634:
+	HALT
+L3635:
+	HALT
+L3636:
+	EXTZ IX
+L3637:
+	HALT
+L3638:
+	LDC DMAS0, XIZ
+L3639:
+	MUL HL, 150
+L3640:
+	EXTZ XHL
+L3641:
+	EXTZ XIX
+L3642:
+	LDC DMAC0, XIY
+L3643:
+	RCF
+L3644:
+	LDC DMAM0, XBC
+L3645:
+	SCF
+L3646:
+	RETI
+L3647:
+	LDC DMAM0, XDE
+L3648:
+	RET
+L3649:
+	LDC DMAC0, XDE
+L3650:
+	EXTZ XDE
+L3651:
+	EXTZ XIZ
+L3652:
+	MUL HL, 30
+L3653:
+	RET
+L3654:
+	LDC DMAD0, XDE
+L3655:
+	MUL WA, 252
+L3656:
+	MUL HL, 170
+L3657:
+	LDC DMAS0, XDE
+L3658:
+	RCF
+L3659:
+	LDC DMAC0, XIZ
+L3660:
+	EXTZ XDE
+L3661:
+	EXTZ IY
+L3662:
+	MUL BC, 225
+L3663:
+	EXTZ XIZ
+L3664:
+	RCF
+L3665:
+	SCF
+L3666:
+	HALT
+L3667:
+	MUL HL, 245
+L3668:
+	LDC DMAC0, XIY
+L3669:
+	SCF
+L3670:
+	HALT
+L3671:
+	EXTZ XBC
+L3672:
+	MUL BC, 215
+L3673:
+	MUL HL, 74
+L3674:
+	EXTZ XHL
+L3675:
+	EXTZ HL
+L3676:
+	EXTZ BC
+L3677:
+	NOP
+L3678:
+	LDC DMAD0, XIY
+L3679:
+	LDC DMAC0, XDE
+L3680:
+	EXTZ WA
+L3681:
+	NOP
+L3682:
+	MUL DE, 145
+L3683:
+	MUL HL, 5
+L3684:
+	LDIR
+L3685:
+	MUL WA, 157
+L3686:
+	EXTZ BC
+L3687:
+	EXTZ XWA
+L3688:
+	MUL HL, 168
+L3689:
+	MUL WA, 230
+L3690:
+	MUL BC, 50
+L3691:
+	EXTZ HL
+L3692:
+	EXTZ XBC
+L3693:
+	LDIR
+L3694:
+	EXTZ HL
+L3695:
+	MUL BC, 6
+L3696:
+	MUL WA, 130
+L3697:
+	LDC DMAC0, XIY
+L3698:
+	MUL HL, 154
+L3699:
+	LDC DMAD0, XBC
+L3700:
+	MUL DE, 193
+L3701:
+	LDC DMAM0, XIZ
+L3702:
+	MUL WA, 23
+L3703:
+	LDC DMAC0, XHL
+L3704:
+	LDC DMAD0, XIZ
+L3705:
+	EXTZ XIZ
+L3706:
+	MUL DE, 153
+L3707:
+	MUL HL, 149
+L3708:
+	LDC DMAC0, XIX
+L3709:
+	EXTZ IY
+L3710:
+	RETI
+L3711:
+	LDC DMAD0, XWA
+L3712:
+	MUL WA, 240
+L3713:
+	EI 0
+L3714:
+	LDC DMAD0, XHL
+L3715:
+	EXTZ XWA
+L3716:
+	RETI
+L3717:
+	EXTZ IZ
+L3718:
+	NOP
+L3719:
+	EXTZ XHL
+L3720:
+	LDC DMAD0, XWA
+L3721:
+	EXTZ IZ
+L3722:
+	EXTZ XIX
+L3723:
+	MUL WA, 210
+L3724:
+	EXTZ IY
+L3725:
+	MUL WA, 214
+L3726:
+	NOP
+L3727:
+	LDC DMAM0, XBC
+L3728:
+	EXTZ XIX
+L3729:
+	EXTZ XIY
+L3730:
+	MUL BC, 103
+L3731:
+	NOP
+L3732:
+	EXTZ XWA
+L3733:
+	MUL WA, 162
+L3734:
+	MUL BC, 132
+L3735:
+	RETI
+L3736:
+	LDC DMAS0, XBC
+L3737:
+	LDC DMAS0, XIY
+L3738:
+	MUL HL, 6
+L3739:
+	LDC DMAS0, XHL
+L3740:
+	RET
+L3741:
+	NOP
+L3742:
+	RETI
+L3743:
+	EXTZ BC
+L3744:
+	LDC DMAC0, XHL
+L3745:
+	SCF
+L3746:
+	LDC DMAS0, XBC
+L3747:
+	MUL DE, 96
+L3748:
+	EI 0
+L3749:
+	NOP
+L3750:
+	EXTZ DE
+L3751:
+	EXTZ XIY
+L3752:
+	EXTZ IY
+L3753:
+	EXTZ WA
+L3754:
+	MUL DE, 112
+L3755:
+	MUL BC, 133
+L3756:
+	MUL DE, 170
+L3757:
+	LDC DMAM0, XBC
+L3758:
+	EXTZ XDE
+L3759:
+	MUL WA, 214
+L3760:
+	EXTZ IZ
+L3761:
+	RETI
+L3762:
+	HALT
+L3763:
+	MUL HL, 96
+L3764:
+	LDIR
+L3765:
+	EXTZ IZ
+L3766:
+	RET
+L3767:
+	MUL WA, 47
+L3768:
+	EXTZ XIX
+L3769:
+	EXTZ XIX
+L3770:
+	EI 0
+L3771:
+	EXTZ XDE
+L3772:
+	MUL BC, 152
+L3773:
+	EXTZ XDE
+L3774:
+	LDIR
+L3775:
+	LDC DMAM0, XIX
+L3776:
+	EXTZ HL
+L3777:
+	EXTZ XIX
+L3778:
+	EXTZ HL
+L3779:
+	MUL WA, 217
+L3780:
+	MUL BC, 2
+L3781:
+	HALT
+L3782:
+	LDC DMAD0, XIY
+L3783:
+	MUL WA, 145
+L3784:
+	EXTZ XIY
+L3785:
+	EXTZ XIZ
+L3786:
+	RCF
+L3787:
+	MUL HL, 148
+L3788:
+	EXTZ XHL
+L3789:
+	MUL WA, 253
+L3790:
+	MUL DE, 102
+L3791:
+	EXTZ IX
+L3792:
+	LDC DMAD0, XIZ
+L3793:
+	MUL HL, 10
+L3794:
+	HALT
+L3795:
+	MUL HL, 185
+L3796:
+	EXTZ DE
+L3797:
+	DI
+L3798:
+	NOP
+L3799:
+	MUL HL, 233
+L3800:
+	DI
+L3801:
+	LDC DMAS0, XWA
+L3802:
+	RCF
+L3803:
+	EXTZ IX
+L3804:
+	EXTZ WA
+L3805:
+	MUL BC, 136
+L3806:
+	EXTZ XBC
+L3807:
+	RETI
+L3808:
+	EXTZ BC
+L3809:
+	LDC DMAM0, XIZ
+L3810:
+	MUL WA, 57
+L3811:
+	EXTZ XIZ
+L3812:
+	MUL DE, 167
+L3813:
+	LDC DMAC0, XIX
+L3814:
+	EXTZ IY
+L3815:
+	LDC DMAS0, XIZ
+L3816:
+	NOP
+L3817:
+	EXTZ IX
+L3818:
+	EXTZ XWA
+L3819:
+	SCF
+L3820:
+	LDC DMAC0, XDE
+L3821:
+	MUL BC, 102
+L3822:
+	EXTZ IY
+L3823:
+	RET
+L3824:
+	LDC DMAM0, XIY
+L3825:
+	LDC DMAC0, XHL
+L3826:
+	LDC DMAD0, XIX
+L3827:
+	MUL HL, 14
+L3828:
+	EXTZ HL
+L3829:
+	DI
+L3830:
+	RET
+L3831:
+	EXTZ XIZ
+L3832:
+	HALT
+L3833:
+	NOP
+L3834:
+	LDC DMAC0, XBC
+L3835:
+	EXTZ DE
+L3836:
+	MUL BC, 233
+L3837:
+	LDC DMAC0, XDE
+L3838:
+	MUL BC, 55
+L3839:
+	MUL HL, 109
+L3840:
+	EXTZ IY
+L3841:
+	EXTZ DE
+L3842:
+	EXTZ XHL
+L3843:
+	EXTZ XDE
+L3844:
+	LDC DMAD0, XIZ
+L3845:
+	RET
+L3846:
+	EXTZ XDE
+L3847:
+	MUL HL, 72
+L3848:
+	LDC DMAS0, XBC
+L3849:
+	MUL WA, 233
+L3850:
+	EXTZ XIX
+L3851:
+	LDC DMAD0, XBC
+L3852:
+	EXTZ BC
+L3853:
+	LDC DMAC0, XIX
+L3854:
+	SCF
+L3855:
+	LDC DMAD0, XWA
+L3856:
+	HALT
+L3857:
+	NOP
+L3858:
+	RETI
+L3859:
+	LDC DMAD0, XIZ
+L3860:
+	EXTZ IY
+L3861:
+	EXTZ XIX
+L3862:
+	MUL BC, 80
+L3863:
+	MUL WA, 60
+L3864:
+	NOP
+L3865:
+	MUL WA, 72
+L3866:
+	HALT
+L3867:
+	EXTZ XDE
+L3868:
+	MUL DE, 15
+L3869:
+	EXTZ XIY
+L3870:
+	LDC DMAM0, XIZ
+L3871:
+	LDIR
+L3872:
+	MUL BC, 159
+L3873:
+	EXTZ XIY
+L3874:
+	RETI
+L3875:
+	LDC DMAM0, XIX
+L3876:
+	MUL HL, 8
+L3877:
+	EXTZ BC
+L3878:
+	LDC DMAD0, XIX
+L3879:
+	RET
+L3880:
+	LDC DMAM0, XHL
+L3881:
+	LDC DMAM0, XIY
+L3882:
+	LDC DMAM0, XIZ
+L3883:
+	LDC DMAD0, XIY
+L3884:
+	RETI
+L3885:
+	RET
+L3886:
+	LDC DMAM0, XBC
+L3887:
+	MUL HL, 4
+L3888:
+	HALT
+L3889:
+	MUL HL, 250
+L3890:
+	RCF
+L3891:
+	MUL WA, 153
+L3892:
+	LDIR
+L3893:
+	MUL WA, 137
+L3894:
+	MUL BC, 40
+L3895:
+	MUL WA, 75
+L3896:
+	EXTZ XIX
+L3897:
+	MUL WA, 76
+L3898:
+	MUL DE, 136
+L3899:
+	EXTZ IX
+L3900:
+	EXTZ XHL
+L3901:
+	LDC DMAC0, XIX
+L3902:
+	LDC DMAM0, XIZ
+L3903:
+	EXTZ DE
+L3904:
+	EXTZ IX
+L3905:
+	MUL HL, 81
+L3906:
+	EXTZ DE
+L3907:
+	MUL WA, 174
+L3908:
+	EI 0
+L3909:
+	EXTZ DE
+L3910:
+	LDC DMAS0, XIX
+L3911:
+	LDIR
+L3912:
+	LDC DMAD0, XHL
+L3913:
+	LDC DMAS0, XIX
+L3914:
+	MUL WA, 97
+L3915:
+	LDC DMAS0, XBC
+L3916:
+	EXTZ XIY
+L3917:
+	RCF
+L3918:
+	EXTZ XHL
+L3919:
+	EXTZ BC
+L3920:
+	MUL BC, 92
+L3921:
+	LDC DMAC0, XHL
+L3922:
+	LDC DMAC0, XDE
+L3923:
+	EXTZ XIZ
+L3924:
+	MUL WA, 32
+L3925:
+	MUL WA, 174
+L3926:
+	DI
+L3927:
+	MUL HL, 187
+L3928:
+	EI 0
+L3929:
+	MUL HL, 232
+L3930:
+	LDIR
+L3931:
+	EXTZ HL
+L3932:
+	LDC DMAS0, XHL
+L3933:
+	LDC DMAD0, XBC
+L3934:
+	MUL WA, 47
+L3935:
+	MUL DE, 54
+L3936:
+	LDC DMAC0, XIZ
+L3937:
+	EXTZ IY
+L3938:
+	RET
+L3939:
+	MUL WA, 132
+L3940:
+	LDC DMAD0, XIZ
+L3941:
+	MUL BC, 218
+L3942:
+	MUL BC, 172
+L3943:
+	LDC DMAM0, XIY
+L3944:
+	LDC DMAC0, XDE
+L3945:
+	RET
+L3946:
+	SCF
+L3947:
+	RETI
+L3948:
+	LDC DMAC0, XDE
+L3949:
+	LDC DMAM0, XIX
+L3950:
+	DI
+L3951:
+	NOP
+L3952:
+	RETI
+L3953:
+	MUL WA, 175
+L3954:
+	LDC DMAS0, XIZ
+L3955:
+	EXTZ IZ
+L3956:
+	EI 0
+L3957:
+	EXTZ XHL
+L3958:
+	LDC DMAC0, XHL
+L3959:
+	MUL HL, 178
+L3960:
+	HALT
+L3961:
+	LDIR
+L3962:
+	LDC DMAM0, XHL
+L3963:
+	LDC DMAS0, XIY
+L3964:
+	LDIR
+L3965:
+	LDC DMAM0, XBC
+L3966:
+	HALT
+L3967:
+	NOP
+L3968:
+	RET
+L3969:
+	LDC DMAM0, XIZ
+L3970:
+	MUL DE, 20
+L3971:
+	EXTZ XIZ
+L3972:
+	NOP
+L3973:
+	MUL BC, 136
+L3974:
+	MUL WA, 220
+L3975:
+	EXTZ XBC
+L3976:
+	LDC DMAD0, XIY
+L3977:
+	NOP
+L3978:
+	EI 0
+L3979:
+	EXTZ IX
+L3980:
+	EXTZ XIZ
+L3981:
+	LDC DMAM0, XBC
+L3982:
+	EXTZ IX
+L3983:
+	MUL WA, 47
+L3984:
+	NOP
+L3985:
+	MUL BC, 251
+L3986:
+	LDC DMAM0, XBC
+L3987:
+	LDC DMAM0, XIX
+L3988:
+	RETI
+L3989:
+	MUL BC, 5
+L3990:
+	MUL WA, 104
+L3991:
+	DI
+L3992:
+	LDC DMAS0, XWA
+L3993:
+	SCF
+L3994:
+	RET
+L3995:
+	MUL WA, 191
+L3996:
+	MUL DE, 166
+L3997:
+	SCF
+L3998:
+	MUL DE, 143
+L3999:
+	LDIR
+L4000:
+	LDC DMAC0, XIY
+L4001:
+	EXTZ HL
+L4002:
+	EI 0
+L4003:
+	LDIR
+L4004:
+	LDC DMAM0, XIX
+L4005:
+	EXTZ XIY
+L4006:
+	EXTZ IX
+L4007:
+	EXTZ IY
+L4008:
+	HALT
+L4009:
+	EXTZ IX
+L4010:
+	MUL HL, 2
+L4011:
+	MUL DE, 243
+L4012:
+	LDC DMAM0, XIY
+L4013:
+	EXTZ XIZ
+L4014:
+	MUL HL, 214
+L4015:
+	EXTZ DE
+L4016:
+	LDC DMAC0, XHL
+L4017:
+	EXTZ XIX
+L4018:
+	LDIR
+L4019:
+	HALT
+L4020:
+	SCF
+L4021:
+	LDC DMAM0, XDE
+L4022:
+	MUL BC, 202
+L4023:
+	LDC DMAM0, XIX
+L4024:
+	RETI
+L4025:
+	MUL HL, 160
+L4026:
+	EXTZ XWA
+L4027:
+	LDC DMAS0, XBC
+L4028:
+	HALT
+L4029:
+	LDC DMAS0, XIY
+L4030:
+	LDC DMAD0, XIX
+L4031:
+	MUL WA, 61
+L4032:
+	RETI
+L4033:
+	EXTZ XHL
+L4034:
+	LDC DMAC0, XHL
+L4035:
+	MUL HL, 252
+L4036:
+	MUL HL, 101
+L4037:
+	EXTZ WA
+L4038:
+	RET
+L4039:
+	MUL HL, 132
+L4040:
+	MUL BC, 239
+L4041:
+	NOP
+L4042:
+	EXTZ XIX
+L4043:
+	EXTZ WA
+L4044:
+	MUL WA, 2
+L4045:
+	MUL DE, 155
+L4046:
+	MUL DE, 26
+L4047:
+	LDC DMAM0, XDE
+L4048:
+	MUL BC, 211
+L4049:
+	LDC DMAS0, XHL
+L4050:
+	MUL DE, 140
+L4051:
+	LDC DMAD0, XDE
+L4052:
+	EXTZ XWA
+L4053:
+	MUL DE, 120
+L4054:
+	EXTZ XIY
+L4055:
+	MUL DE, 52
+L4056:
+	MUL HL, 194
+L4057:
+	LDC DMAS0, XIX
+L4058:
+	MUL BC, 152
+L4059:
+	MUL WA, 73
+L4060:
+	RET
+L4061:
+	NOP
+L4062:
+	RETI
+L4063:
+	LDC DMAD0, XBC
+L4064:
+	RET
+L4065:
+	MUL DE, 218
+L4066:
+	LDC DMAD0, XHL
+L4067:
+	LDC DMAC0, XHL
+L4068:
+	MUL HL, 68
+L4069:
+	LDC DMAM0, XIZ
+L4070:
+	MUL BC, 169
+L4071:
+	LDC DMAD0, XIZ
+L4072:
+	DI
+L4073:
+	DI
+L4074:
+	EXTZ HL
+L4075:
+	EXTZ IZ
+L4076:
+	LDC DMAD0, XBC
+L4077:
+	EXTZ WA
+L4078:
+	MUL DE, 61
+L4079:
+	LDC DMAD0, XIZ
+L4080:
+	LDC DMAD0, XWA
+L4081:
+	EXTZ HL
+L4082:
+	LDC DMAS0, XBC
+L4083:
+	MUL HL, 22
+L4084:
+	MUL WA, 235
+L4085:
+	DI
+L4086:
+	LDC DMAD0, XDE
+L4087:
+	LDC DMAC0, XIY
+L4088:
+	EXTZ XWA
+L4089:
+	LDC DMAS0, XWA
+L4090:
+	EXTZ XDE
+L4091:
+	RCF
+L4092:
+	MUL BC, 86
+L4093:
+	MUL HL, 189
+L4094:
+	LDC DMAM0, XIX
+L4095:
+	LDC DMAD0, XWA
+L4096:
+	MUL BC, 95
+L4097:
+	LDC DMAD0, XIX
+L4098:
+	EXTZ BC
+L4099:
+	LDC DMAD0, XIZ
+L4100:
+	EXTZ XHL
+L4101:
+	MUL DE, 93
+L4102:
+	LDC DMAD0, XIX
+L4103:
+	LDC DMAD0, XWA
+L4104:
+	EXTZ IZ
+L4105:
+	MUL HL, 113
+L4106:
+	EXTZ DE
+L4107:
+	RET
+L4108:
+	LDC DMAC0, XBC
+L4109:
+	MUL WA, 152
+L4110:
+	EXTZ HL
+L4111:
+	HALT
+L4112:
+	MUL WA, 53
+L4113:
+	EXTZ XIY
+L4114:
+	LDC DMAC0, XIX
+L4115:
+	MUL WA, 215
+L4116:
+	MUL BC, 72
+L4117:
+	EXTZ IZ
+L4118:
+	NOP
+L4119:
+	EXTZ IZ
+L4120:
+	LDC DMAM0, XIZ
+L4121:
+	EXTZ XIX
+L4122:
+	MUL DE, 113
+L4123:
+	MUL BC, 219
+L4124:
+	MUL WA, 74
+L4125:
+	LDC DMAM0, XIY
+L4126:
+	EXTZ DE
+L4127:
+	EXTZ XIZ
+L4128:
+	RETI
+L4129:
+	RET
+L4130:
+	NOP
+L4131:
+	EXTZ BC
+L4132:
+	LDC DMAS0, XHL
+L4133:
+	MUL BC, 24
+L4134:
+	RET
+L4135:
+	HALT
+L4136:
+	EXTZ XBC
+L4137:
+	LDC DMAD0, XIX
+L4138:
+	EXTZ HL
+L4139:
+	LDC DMAC0, XDE
+L4140:
+	RETI
+L4141:
+	MUL WA, 183
+L4142:
+	EXTZ DE
+L4143:
+	LDC DMAC0, XDE
+L4144:
+	EXTZ XWA
+L4145:
+	LDC DMAS0, XBC
+L4146:
+	LDC DMAM0, XDE
+L4147:
+	EXTZ WA
+L4148:
+	LDIR
+L4149:
+	RET
+L4150:
+	EXTZ XHL
+L4151:
+	LDIR
+L4152:
+	LDC DMAC0, XIZ
+L4153:
+	MUL DE, 97
+L4154:
+	EI 0
+L4155:
+	EXTZ IY
+L4156:
+	EXTZ IZ
+L4157:
+	EXTZ XBC
+L4158:
+	EXTZ XDE
+L4159:
+	EI 0
+L4160:
+	EXTZ WA
+L4161:
+	MUL DE, 185
+L4162:
+	LDC DMAC0, XIZ
+L4163:
+	MUL WA, 165
+L4164:
+	EXTZ BC
+L4165:
+	LDC DMAS0, XIY
+L4166:
+	EXTZ XIZ
+L4167:
+	MUL HL, 213
+L4168:
+	EXTZ XBC
+L4169:
+	MUL BC, 40
+L4170:
+	MUL WA, 178
+L4171:
+	EXTZ DE
+L4172:
+	LDC DMAM0, XHL
+L4173:
+	MUL BC, 27
+L4174:
+	LDC DMAS0, XIZ
+L4175:
+	RET
+L4176:
+	EXTZ IZ
+L4177:
+	HALT
+L4178:
+	EXTZ IX
+L4179:
+	MUL WA, 250
+L4180:
+	EXTZ XWA
+L4181:
+	EXTZ IY
+L4182:
+	MUL BC, 114
+L4183:
+	LDC DMAC0, XIX
+L4184:
+	RET
+L4185:
+	MUL WA, 160
+L4186:
+	MUL HL, 91
+L4187:
+	RCF
+L4188:
+	MUL HL, 4
+L4189:
+	LDC DMAM0, XIY
+L4190:
+	SCF
+L4191:
+	EXTZ XIZ
+L4192:
+	DI
+L4193:
+	EXTZ DE
+L4194:
+	EXTZ XIZ
+L4195:
+	EI 0
+L4196:
+	EXTZ IZ
+L4197:
+	LDC DMAS0, XHL
+L4198:
+	LDC DMAD0, XWA
+L4199:
+	EXTZ XIZ
+L4200:
+	RCF
+L4201:
+	LDC DMAS0, XIX
+L4202:
+	MUL DE, 24
+L4203:
+	RETI
+L4204:
+	EXTZ IZ
+L4205:
+	RETI
+L4206:
+	EXTZ XDE
+L4207:
+	MUL WA, 24
+L4208:
+	RET
+L4209:
+	EXTZ IX
+L4210:
+	LDC DMAM0, XHL
+L4211:
+	EXTZ XHL
+L4212:
+	LDC DMAS0, XIY
+L4213:
+	EXTZ DE
+L4214:
+	EXTZ WA
+L4215:
+	EXTZ IX
+L4216:
+	LDC DMAS0, XHL
+L4217:
+	MUL DE, 126
+L4218:
+	NOP
+L4219:
+	EXTZ IX
+L4220:
+	MUL WA, 29
+L4221:
+	NOP
+L4222:
+	RCF
+L4223:
+	RET
+L4224:
+	HALT
+L4225:
+	EXTZ XIZ
+L4226:
+	LDC DMAD0, XIZ
+L4227:
+	RCF
+L4228:
+	LDC DMAM0, XIY
+L4229:
+	LDC DMAM0, XWA
+L4230:
+	EXTZ XIZ
+L4231:
+	EXTZ BC
+L4232:
+	MUL HL, 11
+L4233:
+	LDC DMAS0, XIY
+L4234:
+	LDC DMAD0, XDE
+L4235:
+	LDC DMAM0, XHL
+L4236:
+	RCF
+L4237:
+	EXTZ XDE
+L4238:
+	EXTZ XBC
+L4239:
+	LDC DMAS0, XWA
+L4240:
+	RCF
+L4241:
+	EXTZ IX
+L4242:
+	MUL HL, 166
+L4243:
+	RETI
+L4244:
+	LDIR
+L4245:
+	MUL WA, 204
+L4246:
+	LDC DMAS0, XIX
+L4247:
+	LDC DMAS0, XDE
+L4248:
+	SCF
+L4249:
+	LDC DMAC0, XIY
+L4250:
+	MUL HL, 175
+L4251:
+	NOP
+L4252:
+	MUL HL, 214
+L4253:
+	HALT
+L4254:
+	LDC DMAC0, XHL
+L4255:
+	LDC DMAC0, XIY
+L4256:
+	EXTZ HL
+L4257:
+	EI 0
+L4258:
+	MUL BC, 234
+L4259:
+	MUL BC, 191
+L4260:
+	LDC DMAC0, XIY
+L4261:
+	RET
+L4262:
+	LDC DMAC0, XIY
+L4263:
+	SCF
+L4264:
+	NOP
+L4265:
+	HALT
+L4266:
+	LDC DMAM0, XBC
+L4267:
+	LDC DMAS0, XHL
+L4268:
+	NOP
+L4269:
+	EXTZ IY
+L4270:
+	MUL BC, 60
+L4271:
+	HALT
+L4272:
+	LDC DMAS0, XIY
+L4273:
+	MUL HL, 103
+L4274:
+	MUL HL, 146
+L4275:
+	RET
+L4276:
+	MUL HL, 158
+L4277:
+	MUL HL, 211
+L4278:
+	EXTZ XWA
+L4279:
+	RET
+L4280:
+	LDC DMAS0, XWA
+L4281:
+	MUL WA, 100
+L4282:
+	DI
+L4283:
+	LDC DMAM0, XHL
+L4284:
+	HALT
+L4285:
+	MUL HL, 154
+L4286:
+	MUL HL, 52
+L4287:
+	RCF
+L4288:
+	LDC DMAM0, XHL
+L4289:
+	MUL HL, 110
+L4290:
+	LDC DMAM0, XHL
+L4291:
+	LDC DMAM0, XHL
+L4292:
+	LDC DMAS0, XIY
+L4293:
+	LDC DMAM0, XHL
+L4294:
+	MUL DE, 27
+L4295:
+	MUL HL, 156
+L4296:
+	EXTZ IX
+L4297:
+	MUL WA, 221
+L4298:
+	LDC DMAM0, XIY
+L4299:
+	EXTZ IZ
+L4300:
+	EXTZ XIZ
+L4301:
+	LDC DMAM0, XIX
+L4302:
+	MUL BC, 253
+L4303:
+	LDC DMAD0, XIX
+L4304:
+	LDC DMAS0, XBC
+L4305:
+	MUL WA, 238
+L4306:
+	EXTZ DE
+L4307:
+	LDC DMAC0, XIX
+L4308:
+	NOP
+L4309:
+	MUL DE, 32
+L4310:
+	HALT
+L4311:
+	EXTZ XIZ
+L4312:
+	EI 0
+L4313:
+	HALT
+L4314:
+	EXTZ IY
+L4315:
+	LDC DMAD0, XIX
+L4316:
+	LDC DMAD0, XDE
+L4317:
+	EXTZ XIZ
+L4318:
+	SCF
+L4319:
+	MUL WA, 45
+L4320:
+	LDC DMAD0, XHL
+L4321:
+	DI
+L4322:
+	MUL DE, 232
+L4323:
+	LDC DMAC0, XHL
+L4324:
+	LDC DMAM0, XIZ
+L4325:
+	LDC DMAS0, XIZ
+L4326:
+	MUL BC, 69
+L4327:
+	MUL HL, 190
+L4328:
+	NOP
+L4329:
+	EXTZ XIY
+L4330:
+	RCF
+L4331:
+	EXTZ IX
+L4332:
+	HALT
+L4333:
+	LDC DMAM0, XIY
+L4334:
+	RETI
+L4335:
+	RET
+L4336:
+	RCF
+L4337:
+	EXTZ XDE
+L4338:
+	EXTZ XWA
+L4339:
+	RCF
+L4340:
+	RCF
+L4341:
+	MUL HL, 223
+L4342:
+	EXTZ IY
+L4343:
+	RET
+L4344:
+	LDC DMAD0, XDE
+L4345:
+	NOP
+L4346:
+	MUL DE, 102
+L4347:
+	MUL WA, 160
+L4348:
+	MUL DE, 75
+L4349:
+	LDC DMAC0, XIZ
+L4350:
+	LDC DMAD0, XWA
+L4351:
+	EXTZ XIX
+L4352:
+	LDC DMAD0, XDE
+L4353:
+	LDIR
+L4354:
+	MUL BC, 142
+L4355:
+	RCF
+L4356:
+	EXTZ XIZ
+L4357:
+	MUL DE, 149
+L4358:
+	MUL WA, 109
+L4359:
+	LDIR
+L4360:
+	LDC DMAM0, XHL
+L4361:
+	RETI
+L4362:
+	MUL HL, 75
+L4363:
+	MUL BC, 46
+L4364:
+	MUL DE, 192
+L4365:
+	LDC DMAD0, XHL
+L4366:
+	SCF
+L4367:
+	MUL BC, 138
+L4368:
+	MUL DE, 60
+L4369:
+	EXTZ XBC
+L4370:
+	MUL BC, 214
+L4371:
+	SCF
+L4372:
+	MUL DE, 149
+L4373:
+	EXTZ XIY
+L4374:
+	LDC DMAM0, XWA
+L4375:
+	LDC DMAM0, XIZ
+L4376:
+	LDC DMAC0, XIX
+L4377:
+	RETI
+L4378:
+	MUL WA, 18
+L4379:
+	MUL HL, 185
+L4380:
+	EXTZ WA
+L4381:
+	EXTZ WA
+L4382:
+	HALT
+L4383:
+	DI
+L4384:
+	MUL BC, 12
+L4385:
+	EXTZ IY
+L4386:
+	EXTZ XBC
+L4387:
+	LDIR
+L4388:
+	LDC DMAS0, XHL
+L4389:
+	LDC DMAC0, XIZ
+L4390:
+	LDC DMAS0, XWA
+L4391:
+	LDC DMAS0, XIZ
+L4392:
+	MUL DE, 132
+L4393:
+	LDC DMAM0, XIZ
+L4394:
+	SCF
+L4395:
+	DI
+L4396:
+	LDC DMAC0, XIX
+L4397:
+	LDC DMAS0, XIZ
+L4398:
+	LDC DMAC0, XIX
+L4399:
+	LDC DMAM0, XWA
+L4400:
+	MUL DE, 203
+L4401:
+	EXTZ XWA
+L4402:
+	MUL BC, 216
+L4403:
+	HALT
+L4404:
+	LDIR
+L4405:
+	LDC DMAS0, XIZ
+L4406:
+	MUL DE, 77
+L4407:
+	MUL BC, 62
+L4408:
+	MUL HL, 28
+L4409:
+	NOP
+L4410:
+	SCF
+L4411:
+	NOP
+L4412:
+	LDC DMAC0, XIY
+L4413:
+	EXTZ DE
+L4414:
+	RCF
+L4415:
+	RET
+L4416:
+	MUL WA, 176
+L4417:
+	LDC DMAC0, XDE
+L4418:
+	LDC DMAD0, XHL
+L4419:
+	MUL DE, 241
+L4420:
+	LDC DMAS0, XIZ
+L4421:
+	RETI
+L4422:
+	LDC DMAC0, XIY
+L4423:
+	EXTZ XIX
+L4424:
+	MUL DE, 15
+L4425:
+	HALT
+L4426:
+	RET
+L4427:
+	MUL DE, 134
+L4428:
+	LDIR
+L4429:
+	MUL DE, 56
+L4430:
+	EXTZ XHL
+L4431:
+	RETI
+L4432:
+	LDC DMAM0, XIZ
+L4433:
+	EXTZ BC
+L4434:
+	EXTZ XHL
+L4435:
+	LDC DMAM0, XIX
+L4436:
+	SCF
+L4437:
+	LDIR
+L4438:
+	MUL BC, 70
+L4439:
+	EXTZ XIX
+L4440:
+	MUL WA, 202
+L4441:
+	MUL DE, 98
+L4442:
+	LDC DMAD0, XHL
+L4443:
+	EXTZ WA
+L4444:
+	EXTZ XIX
+L4445:
+	DI
+L4446:
+	EXTZ XIX
+L4447:
+	RCF
+L4448:
+	MUL HL, 18
+L4449:
+	NOP
+L4450:
+	EXTZ WA
+L4451:
+	LDIR
+L4452:
+	DI
+L4453:
+	MUL WA, 52
+L4454:
+	MUL HL, 230
+L4455:
+	MUL HL, 201
+L4456:
+	MUL WA, 79
+L4457:
+	MUL BC, 148
+L4458:
+	MUL WA, 97
+L4459:
+	LDIR
+L4460:
+	EXTZ DE
+L4461:
+	MUL DE, 102
+L4462:
+	LDC DMAC0, XDE
+L4463:
+	LDC DMAC0, XBC
+L4464:
+	MUL HL, 226
+L4465:
+	MUL BC, 108
+L4466:
+	RET
+L4467:
+	MUL BC, 90
+L4468:
+	EXTZ IX
+L4469:
+	MUL DE, 246
+L4470:
+	NOP
+L4471:
+	EXTZ XIY
+L4472:
+	DI
+L4473:
+	EXTZ IZ
+L4474:
+	EXTZ XIZ
+L4475:
+	EXTZ XIZ
+L4476:
+	LDC DMAD0, XHL
+L4477:
+	MUL BC, 121
+L4478:
+	LDIR
+L4479:
+	EXTZ IZ
+L4480:
+	MUL WA, 92
+L4481:
+	LDIR
+L4482:
+	LDC DMAC0, XIX
+L4483:
+	LDC DMAC0, XHL
+L4484:
+	MUL WA, 110
+L4485:
+	MUL WA, 184
+L4486:
+	RETI
+L4487:
+	EXTZ DE
+L4488:
+	EXTZ HL
+L4489:
+	EXTZ DE
+L4490:
+	EXTZ XIX
+L4491:
+	MUL WA, 67
+L4492:
+	HALT
+L4493:
+	MUL BC, 210
+L4494:
+	EXTZ HL
+L4495:
+	MUL BC, 118
+L4496:
+	LDC DMAD0, XIX
+L4497:
+	EXTZ XBC
+L4498:
+	MUL DE, 1
+L4499:
+	SCF
+L4500:
+	EXTZ XDE
+L4501:
+	LDC DMAS0, XHL
+L4502:
+	MUL DE, 118
+L4503:
+	LDIR
+L4504:
+	MUL HL, 162
+L4505:
+	LDC DMAD0, XWA
+L4506:
+	EXTZ XHL
+L4507:
+	LDC DMAC0, XIX
+L4508:
+	EXTZ IZ
+L4509:
+	LDC DMAD0, XWA
+L4510:
+	RET
+L4511:
+	EXTZ XBC
+L4512:
+	RET
+L4513:
+	EXTZ XIY
+L4514:
+	LDC DMAS0, XWA
+L4515:
+	RCF
+L4516:
+	EXTZ XBC
+L4517:
+	EXTZ BC
+L4518:
+	HALT
+L4519:
+	LDC DMAC0, XDE
+L4520:
+	LDC DMAC0, XWA
+L4521:
+	EXTZ DE
+L4522:
+	LDC DMAM0, XHL
+L4523:
+	MUL HL, 119
+L4524:
+	EXTZ BC
+L4525:
+	EXTZ XDE
+L4526:
+	LDC DMAC0, XIY
+L4527:
+	EXTZ IZ
+L4528:
+	MUL BC, 206
+L4529:
+	EXTZ BC
+L4530:
+	LDC DMAM0, XDE
+L4531:
+	LDC DMAM0, XWA
+L4532:
+	DI
+L4533:
+	MUL HL, 151
+L4534:
+	DI
+L4535:
+	MUL DE, 15
+L4536:
+	MUL WA, 111
+L4537:
+	MUL BC, 170
+L4538:
+	LDC DMAC0, XIY
+L4539:
+	LDC DMAD0, XWA
+L4540:
+	DI
+L4541:
+	LDC DMAD0, XIY
+L4542:
+	DI
+L4543:
+	LDC DMAC0, XIY
+L4544:
+	LDC DMAS0, XDE
+L4545:
+	MUL HL, 151
+L4546:
+	HALT
+L4547:
+	SCF
+L4548:
+	RET
+L4549:
+	EXTZ IX
+L4550:
+	RET
+L4551:
+	MUL WA, 70
+L4552:
+	NOP
+L4553:
+	MUL BC, 95
+L4554:
+	SCF
+L4555:
+	MUL HL, 229
+L4556:
+	NOP
+L4557:
+	EXTZ XIX
+L4558:
+	MUL HL, 215
+L4559:
+	LDC DMAD0, XBC
+L4560:
+	LDC DMAM0, XIZ
+L4561:
+	DI
+L4562:
+	LDC DMAC0, XBC
+L4563:
+	NOP
+L4564:
+	MUL WA, 2
+L4565:
+	EXTZ XBC
+L4566:
+	LDC DMAM0, XWA
+L4567:
+	EI 0
+L4568:
+	MUL WA, 88
+L4569:
+	NOP
+L4570:
+	LDC DMAM0, XDE
+L4571:
+	LDC DMAS0, XWA
+L4572:
+	EI 0
+L4573:
+	EI 0
+L4574:
+	RCF
+L4575:
+	DI
+L4576:
+	EXTZ DE
+L4577:
+	RET
+L4578:
+	EXTZ XIY
+L4579:
+	LDC DMAC0, XDE
+L4580:
+	HALT
+L4581:
+	LDC DMAS0, XHL
+L4582:
+	EXTZ XWA
+L4583:
+	RCF
+L4584:
+	EXTZ XIY
+L4585:
+	LDC DMAM0, XWA
+L4586:
+	NOP
+L4587:
+	LDIR
+L4588:
+	SCF
+L4589:
+	NOP
+L4590:
+	LDC DMAM0, XIX
+L4591:
+	LDC DMAM0, XBC
+L4592:
+	MUL DE, 38
+L4593:
+	HALT
+L4594:
+	MUL HL, 97
+L4595:
+	LDC DMAS0, XDE
+L4596:
+	SCF
+L4597:
+	LDC DMAC0, XIY
+L4598:
+	RCF
+L4599:
+	EXTZ IY
+L4600:
+	MUL HL, 78
+L4601:
+	HALT
+L4602:
+	HALT
+L4603:
+	LDIR
+L4604:
+	LDC DMAD0, XHL
+L4605:
+	EXTZ IY
+L4606:
+	NOP
+L4607:
+	EXTZ XIY
+L4608:
+	SCF
+L4609:
+	EXTZ XDE
+L4610:
+	SCF
+L4611:
+	MUL DE, 76
+L4612:
+	MUL WA, 5
+L4613:
+	LDC DMAD0, XHL
+L4614:
+	MUL WA, 189
+L4615:
+	DI
+L4616:
+	LDIR
+L4617:
+	NOP
+L4618:
+	RET
+L4619:
+	LDC DMAC0, XIY
+L4620:
+	LDC DMAM0, XIZ
+L4621:
+	LDC DMAC0, XBC
+L4622:
+	LDC DMAC0, XIZ
+L4623:
+	EXTZ WA
+L4624:
+	LDIR
+L4625:
+	LDC DMAD0, XWA
+L4626:
+	LDC DMAM0, XHL
+L4627:
+	LDC DMAD0, XWA
+L4628:
+	MUL WA, 49
+L4629:
+	EXTZ XBC
+L4630:
+	LDC DMAS0, XDE
+L4631:
+	MUL WA, 126
+L4632:
+	LDC DMAC0, XIZ
+L4633:
+	EXTZ XIX
+L4634:
+	MUL DE, 151
+L4635:
+	EXTZ XIY
+L4636:
+	HALT
+L4637:
+	LDC DMAM0, XWA
+L4638:
+	MUL HL, 251
+L4639:
+	NOP
+L4640:
+	MUL BC, 180
+L4641:
+	EXTZ XIZ
+L4642:
+	EXTZ IZ
+L4643:
+	MUL BC, 190
+L4644:
+	MUL WA, 137
+L4645:
+	LDC DMAD0, XIX
+L4646:
+	LDC DMAD0, XHL
+L4647:
+	LDC DMAS0, XIZ
+L4648:
+	EXTZ IZ
+L4649:
+	LDC DMAS0, XHL
+L4650:
+	HALT
+L4651:
+	LDC DMAD0, XDE
+L4652:
+	DI
+L4653:
+	LDC DMAS0, XIZ
+L4654:
+	EXTZ XIX
+L4655:
+	EXTZ IY
+L4656:
+	RETI
+L4657:
+	MUL DE, 222
+L4658:
+	EXTZ BC
+L4659:
+	NOP
+L4660:
+	LDC DMAM0, XIZ
+L4661:
+	LDC DMAD0, XWA
+L4662:
+	EXTZ BC
+L4663:
+	DI
+L4664:
+	MUL BC, 39
+L4665:
+	LDC DMAM0, XWA
+L4666:
+	RETI
+L4667:
+	HALT
+L4668:
+	EXTZ XIZ
+L4669:
+	LDC DMAS0, XDE
+L4670:
+	LDIR
+L4671:
+	LDIR
+L4672:
+	LDC DMAM0, XIZ
+L4673:
+	MUL BC, 148
+L4674:
+	LDC DMAM0, XWA
+L4675:
+	EXTZ XWA
+L4676:
+	RCF
+L4677:
+	MUL WA, 225
+L4678:
+	SCF
+L4679:
+	MUL DE, 93
+L4680:
+	EXTZ IX
+L4681:
+	LDIR
+L4682:
+	LDC DMAC0, XHL
+L4683:
+	EXTZ XIX
+L4684:
+	MUL HL, 67
+L4685:
+	MUL HL, 50
+L4686:
+	EXTZ HL
+L4687:
+	HALT
+L4688:
+	LDC DMAC0, XHL
+L4689:
+	RETI
+L4690:
+	LDC DMAD0, XWA
+L4691:
+	EXTZ XIX
+L4692:
+	MUL WA, 240
+L4693:
+	MUL HL, 86
+L4694:
+	LDC DMAS0, XHL
+L4695:
+	LDC DMAD0, XHL
+L4696:
+	MUL WA, 72
+L4697:
+	EI 0
+L4698:
+	RCF
+L4699:
+	LDC DMAM0, XBC
+L4700:
+	EXTZ DE
+L4701:
+	MUL WA, 27
+L4702:
+	MUL BC, 109
+L4703:
+	LDC DMAC0, XWA
+L4704:
+	LDC DMAM0, XHL
+L4705:
+	RETI
+L4706:
+	DI
+L4707:
+	MUL WA, 126
+L4708:
+	EXTZ IY
+L4709:
+	MUL HL, 19
+L4710:
+	MUL WA, 147
+L4711:
+	MUL DE, 247
+L4712:
+	LDIR
+L4713:
+	MUL WA, 64
+L4714:
+	LDC DMAS0, XIY
+L4715:
+	EXTZ BC
+L4716:
+	LDC DMAM0, XBC
+L4717:
+	LDIR
+L4718:
+	RETI
+L4719:
+	LDC DMAM0, XDE
+L4720:
+	RETI
+L4721:
+	RCF
+L4722:
+	MUL WA, 127
+L4723:
+	LDC DMAM0, XIX
+L4724:
+	MUL HL, 111
+L4725:
+	LDC DMAD0, XDE
+L4726:
+	NOP
+L4727:
+	MUL BC, 175
+L4728:
+	EXTZ XIX
+L4729:
+	EI 0
+L4730:
+	DI
+L4731:
+	LDC DMAC0, XIX
+L4732:
+	MUL BC, 166
+L4733:
+	EXTZ XIZ
+L4734:
+	NOP
+L4735:
+	HALT
+L4736:
+	EI 0
+L4737:
+	HALT
+L4738:
+	EI 0
+L4739:
+	EXTZ IZ
+L4740:
+	MUL HL, 76
+L4741:
+	EXTZ XWA
+L4742:
+	LDC DMAM0, XIX
+L4743:
+	MUL BC, 190
+L4744:
+	RCF
+L4745:
+	RET
+L4746:
+	MUL HL, 155
+L4747:
+	EXTZ XIX
+L4748:
+	HALT
+L4749:
+	LDC DMAC0, XIX
+L4750:
+	LDC DMAD0, XHL
+L4751:
+	MUL WA, 65
+L4752:
+	LDC DMAS0, XDE
+L4753:
+	HALT
+L4754:
+	LDC DMAD0, XIX
+L4755:
+	LDC DMAM0, XIY
+L4756:
+	RET
+L4757:
+	EI 0
+L4758:
+	MUL DE, 147
+L4759:
+	SCF
+L4760:
+	NOP
+L4761:
+	LDIR
+L4762:
+	MUL DE, 87
+L4763:
+	MUL HL, 143
+L4764:
+	MUL WA, 25
+L4765:
+	MUL BC, 234
+L4766:
+	MUL BC, 181
+L4767:
+	LDC DMAC0, XIZ
+L4768:
+	MUL HL, 217
+L4769:
+	LDC DMAD0, XWA
+L4770:
+	RET
+L4771:
+	MUL HL, 224
+L4772:
+	LDC DMAC0, XWA
+L4773:
+	EXTZ XWA
+L4774:
+	MUL BC, 226
+L4775:
+	RETI
+L4776:
+	EXTZ IZ
+L4777:
+	LDC DMAC0, XIZ
+L4778:
+	RETI
+L4779:
+	LDC DMAD0, XWA
+L4780:
+	LDC DMAM0, XBC
+L4781:
+	EXTZ HL
+L4782:
+	DI
+L4783:
+	EXTZ XIZ
+L4784:
+	EXTZ DE
+L4785:
+	MUL HL, 225
+L4786:
+	EXTZ XIZ
+L4787:
+	EXTZ XIZ
+L4788:
+	LDC DMAM0, XIY
+L4789:
+	LDC DMAC0, XIY
+L4790:
+	EXTZ XDE
+L4791:
+	EXTZ XIY
+L4792:
+	LDC DMAC0, XWA
+L4793:
+	HALT
+L4794:
+	LDC DMAS0, XIX
+L4795:
+	RETI
+L4796:
+	DI
+L4797:
+	MUL HL, 10
+L4798:
+	EXTZ WA
+L4799:
+	EXTZ XHL
+L4800:
+	LDC DMAD0, XIZ
+L4801:
+	RETI
+L4802:
+	EXTZ HL
+L4803:
+	EXTZ XDE
+L4804:
+	LDC DMAD0, XIY
+L4805:
+	MUL BC, 184
+L4806:
+	LDC DMAS0, XIZ
+L4807:
+	EXTZ DE
+L4808:
+	MUL WA, 97
+L4809:
+	MUL WA, 102
+L4810:
+	LDC DMAD0, XHL
+L4811:
+	MUL HL, 223
+L4812:
+	LDC DMAS0, XHL
+L4813:
+	LDC DMAM0, XIY
+L4814:
+	EXTZ DE
+L4815:
+	MUL DE, 161
+L4816:
+	MUL DE, 16
+L4817:
+	EXTZ WA
+L4818:
+	MUL HL, 102
+L4819:
+	MUL DE, 47
+L4820:
+	RET
+L4821:
+	LDC DMAM0, XHL
+L4822:
+	EXTZ HL
+L4823:
+	HALT
+L4824:
+	LDC DMAC0, XIZ
+L4825:
+	LDC DMAC0, XHL
+L4826:
+	SCF
+L4827:
+	LDC DMAC0, XIY
+L4828:
+	MUL WA, 155
+L4829:
+	SCF
+L4830:
+	MUL WA, 137
+L4831:
+	HALT
+L4832:
+	DI
+L4833:
+	EXTZ DE
+L4834:
+	LDC DMAM0, XBC
+L4835:
+	LDC DMAC0, XBC
+L4836:
+	LDC DMAC0, XIY
+L4837:
+	LDIR
+L4838:
+	EXTZ XHL
+L4839:
+	EXTZ XDE
+L4840:
+	MUL BC, 10
+L4841:
+	LDC DMAS0, XHL
+L4842:
+	MUL HL, 230
+L4843:
+	MUL BC, 177
+L4844:
+	LDC DMAS0, XBC
+L4845:
+	RCF
+L4846:
+	LDC DMAD0, XBC
+L4847:
+	MUL WA, 192
+L4848:
+	LDC DMAD0, XWA
+L4849:
+	EXTZ XDE
+L4850:
+	MUL DE, 91
+L4851:
+	LDC DMAD0, XBC
+L4852:
+	LDC DMAC0, XIX
+L4853:
+	MUL HL, 45
+L4854:
+	EXTZ XIY
+L4855:
+	MUL BC, 71
+L4856:
+	LDC DMAC0, XIX
+L4857:
+	EXTZ XHL
+L4858:
+	MUL HL, 243
+L4859:
+	LDC DMAS0, XWA
+L4860:
+	EXTZ IY
+L4861:
+	HALT
+L4862:
+	MUL WA, 149
+L4863:
+	EXTZ XBC
+L4864:
+	NOP
+L4865:
+	LDC DMAC0, XDE
+L4866:
+	LDC DMAD0, XBC
+L4867:
+	SCF
+L4868:
+	HALT
+L4869:
+	EXTZ IY
+L4870:
+	EXTZ XIX
+L4871:
+	EXTZ HL
+L4872:
+	MUL HL, 133
+L4873:
+	RCF
+L4874:
+	EXTZ XDE
+L4875:
+	LDC DMAD0, XIX
+L4876:
+	DI
+L4877:
+	LDC DMAC0, XIX
+L4878:
+	EXTZ XBC
+L4879:
+	RET
+L4880:
+	EI 0
+L4881:
+	LDC DMAC0, XDE
+L4882:
+	EI 0
+L4883:
+	SCF
+L4884:
+	MUL BC, 209
+L4885:
+	RCF
+L4886:
+	EXTZ IX
+L4887:
+	SCF
+L4888:
+	MUL HL, 117
+L4889:
+	LDC DMAM0, XDE
+L4890:
+	RET
+L4891:
+	MUL BC, 252
+L4892:
+	EXTZ IX
+L4893:
+	EXTZ XDE
+L4894:
+	MUL WA, 106
+L4895:
+	SCF
+L4896:
+	MUL WA, 84
+L4897:
+	MUL HL, 119
+L4898:
+	MUL BC, 114
+L4899:
+	LDIR
+L4900:
+	DI
+L4901:
+	MUL DE, 29
+L4902:
+	LDC DMAC0, XWA
+L4903:
+	HALT
+L4904:
+	LDC DMAS0, XWA
+L4905:
+	MUL HL, 186
+L4906:
+	MUL WA, 88
+L4907:
+	MUL DE, 76
+L4908:
+	MUL DE, 168
+L4909:
+	EXTZ XIZ
+L4910:
+	MUL BC, 64
+L4911:
+	MUL BC, 200
+L4912:
+	LDC DMAS0, XIZ
+L4913:
+	LDC DMAC0, XBC
+L4914:
+	EXTZ XHL
+L4915:
+	MUL WA, 168
+L4916:
+	MUL BC, 113
+L4917:
+	EXTZ IY
+L4918:
+	MUL HL, 11
+L4919:
+	SCF
+L4920:
+	MUL DE, 161
+L4921:
+	MUL BC, 160
+L4922:
+	SCF
+L4923:
+	HALT
+L4924:
+	LDC DMAC0, XIZ
+L4925:
+	SCF
+L4926:
+	LDC DMAS0, XHL
+L4927:
+	EI 0
+L4928:
+	EXTZ XDE
+L4929:
+	EXTZ HL
+L4930:
+	DI
+L4931:
+	EXTZ HL
+L4932:
+	RCF
+L4933:
+	MUL HL, 44
+L4934:
+	MUL BC, 81
+L4935:
+	LDIR
+L4936:
+	MUL WA, 153
+L4937:
+	EI 0
+L4938:
+	EXTZ XBC
+L4939:
+	EXTZ WA
+L4940:
+	LDC DMAC0, XDE
+L4941:
+	MUL HL, 55
+L4942:
+	LDC DMAD0, XDE
+L4943:
+	MUL WA, 131
+L4944:
+	RCF
+L4945:
+	EXTZ IZ
+L4946:
+	RET
+L4947:
+	LDC DMAM0, XIZ
+L4948:
+	MUL BC, 76
+L4949:
+	EXTZ XHL
+L4950:
+	EXTZ WA
+L4951:
+	SCF
+L4952:
+	EXTZ IY
+L4953:
+	EXTZ XIY
+L4954:
+	EXTZ XIZ
+L4955:
+	MUL DE, 51
+L4956:
+	EXTZ XIZ
+L4957:
+	NOP
+L4958:
+	LDC DMAD0, XDE
+L4959:
+	LDC DMAD0, XIZ
+L4960:
+	LDC DMAC0, XWA
+L4961:
+	EI 0
+L4962:
+	EXTZ IX
+L4963:
+	MUL DE, 119
+L4964:
+	LDC DMAS0, XHL
+L4965:
+	LDC DMAS0, XIZ
+L4966:
+	EXTZ XBC
+L4967:
+	RET
+L4968:
+	LDC DMAM0, XWA
+L4969:
+	EXTZ BC
+L4970:
+	LDC DMAM0, XDE
+L4971:
+	EXTZ DE
+L4972:
+	EXTZ XBC
+L4973:
+	LDC DMAD0, XIZ
+L4974:
+	EXTZ IZ
+L4975:
+	EI 0
+L4976:
+	LDC DMAC0, XIZ
+L4977:
+	EXTZ WA
+L4978:
+	EXTZ DE
+L4979:
+	HALT
+L4980:
+	MUL WA, 188
+L4981:
+	HALT
+L4982:
+	EXTZ XIY
+L4983:
+	LDC DMAS0, XIY
+L4984:
+	EXTZ IZ
+L4985:
+	MUL WA, 111
+L4986:
+	EXTZ XHL
+L4987:
+	LDC DMAS0, XIX
+L4988:
+	MUL WA, 65
+L4989:
+	EXTZ IY
+L4990:
+	SCF
+L4991:
+	MUL BC, 151
+L4992:
+	EXTZ BC
+L4993:
+	LDC DMAS0, XIZ
+L4994:
+	MUL WA, 18
+L4995:
+	MUL HL, 12
+L4996:
+	MUL BC, 206
+L4997:
+	SCF
+L4998:
+	EXTZ DE
+L4999:
+	EXTZ XWA
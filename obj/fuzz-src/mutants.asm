@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+JR Z, 0
+L1:
+HAL"
+L2:
+	TSET7 26C
+L3:
+ 	OP IZ
+L4:
++PO 1IZ
+L5:
+	LD IZ, 279
+L6:
+	DB 54, 154,2 "s6"
+L7:
+	S" , WA
+L8:
+	PUSHIZ
+L9:
+LDC DMAS0, XIZ
+L10:
+	DW L168, L612-L13
+L11:
+	PUSHX-X
+L12:
+	RLX 1, H
+L13:
+	ACHG 18, W
+L14:
+CALL L14
+L15:
+	R9RC , B
+L16:
+	RL 1L, XDE
+L17:
+	RES 0,) 9
+L18:
+	ADC (IY, XIX
+L19:
+	CAL L22'
+L20:
+	DJNZ B, L19
+L21:
+	JRL L1B
+L22:
+	ADD H, (XIZ+78+()
+L23:
+	LPUS HYL
+L24:
+	DB 22', 13, Es4"
+L25:
+	PO$ W+A
+L26:
+DRhCF
+L27:
+	LC DMAS0, XBC
+L28:
+JR NZ, L30
+L29:
+BDW L262, L28-L26
+L30:
+	7SETD2, A
+L31:
+	POP HL
+L32:
+	DW 2397, L28-L32
+L33:
+	DB 158, 20I9, "s3"
+L34:
+	LD XHL,7H360
+L35:
+	RET
+L36:
+	DJNZ B, L4B
+L37:
+ 	8SCF
+L38:
+	P"S XHL
+L39:
+	POPhXIX
+L40:
+	PWP8XDE
+L41:
+	DJNZH B, L43
+L42:
+	XOR A4, (XWA+B)
+L43:
+	LD (FAR),IXI
+L44:
+	LhD :P0), C
+L45:
+	LDC LMAC0, XIZ
+L46:
+	XJ:L L4X3
+L47:
+	EXZ XIYZ
+L48:
+	WLD (XHL17384:16), L
+L49:
+	L3 XHL, L73
+L50:
+	N#IP
+L51:
+	BIT#0, (XHL)
+L52:
+	LW IZ, 3h3541
+L53:
+4INC38, A
+L54:
+	DB 156, "58, "s4-
+L55:
+	DIW
+L56:
+	-LA 5, H
+L57:
+	3PUSH 6XWA
+L58:
+	E,T XWA
+L59:
+	RC:
+L60:
+	DC DMAM0, XI'X
+L61:
+	B 3,h 194, "s1"
+L62:
+	EIh 0
+L63:
+	DC5, E
+L64:
+	DWL61, L6'1-L62
+L65:
+	S-ET$ 3, H
+L66:
+	DJNZ HB, I065
+L67:
+2POP XA
+L68:
+	SRA L5, XIZ
+L69:
+	LD XIZ3 L6I
+L70:
+	JRL LE623
+L71:
+	LD XHL, (XBC+4X5()
+L72:
+	+MUL B, 103
+L73:
+	'JRL L7
+L74:
+	LD A,, 48
+L75:
+9ES (7, E
+L76:
+PP XIX1
+L77:
+	POP BC
+L78:
+	RL 14, XWA
+L79:
+7LD D3 13
+L80:
+	PP X'DE
+L81:
+LD IX, 2288
+L82:
+Z	POP HL
+L83:
+	PP HL
+L84:
+	DB 88, 223, "s4"
+L85:
+	DW L408, L82-h83
+L86:
+	POP
+L87:
+	DB 136, 232L, "+7"
+L88:
+	TS3ETE3, L
+L89:
+	RES 3, (XH$L)
+L90:
+	PUSH AXIY
+L91:
+	LD L, -2
+L92:
+	HE 4, Y
+L93:
+	BIT 0, (XL)
+L94:
+	AYDD B, 3
+L95:
+WLC3, XDE
+L96:
+	INCD 5, B
+L97:
+	DEC 5 H
+L98:
+	RS)0, L
+L99:
+	DW L96, -L98-L8X03
+L100:
+	ES 36, (XHL)
+L101:
+	RL 4,LXBC
+L102:
+	POhP IZ
+L103:
+DJNZ 3B, L10A
+L104:
+	JP NZ,L3752
+L105:
+	DW L106, 104-L1-08
+L106:
+	DB 14, 19, "s6"
+L107:
+	CP A1, 3252
+L108:
+	ADC XE- XIX
+L109:
+	L+D XIX, (XLHLI28:8)
+L110:
+	RR18 XIZ
+L111:
+	DEC48, XIX
+L112:
+)R A, 49
+L113:
+	LDC DMAD6X, XB
+L114:
+	:R H, 1X25
+L115:
+	SLL 7,Y A
+L116:
+	JRL L514
+L117:
+	DW 115 L115-L113
+L118:
+	DB 241$ 48, "s8"
+L119:
+	C E, 103
+L120:
+	DW L1900, L)24-3L1)0
+L121:
+	LDC DMAM06, XW:A
+L122:
+R,ES 3,# A
+L123:
+	$CAL L1 20
+L124:
+	LD WA,'544$939
+L125:
+	JRLL447D
+L126:
+DW	POP hA
+L127:
+	PU9H 3IY
+L128:
+	RCLC 12, XHL
+L129:
+	ADX A, B
+L130:
+	SR 1, AY
+L131:
+	LDC DWAS0, XBC
+L132:
+	PUH C
+L133:
+	RES 6,A (XHL)
+L134:
+	6SBCXIZ, XIY
+L135:
+	LDZAB E
+L136:
+	EI 4E
+L137:
+	L' C,148
+L138:
+	AD A, (XDE+94:8)
+L139:
+	PUSHLWA
+L140:
+	BI 1, C
+L141:
+	DJNh B, L142
+L142:
+	LY H,168
+L143:
+	DZC 4, IZ
+L144:
+9SET 3, (X"HL)
+L145:
+XRES67, L
+L146:
+	LLD (L142:2), B
+L147:
+	PUSH I
+L148:
+	BIT 0, 
+L149:
+	RES 5, +XHEL)
+L150:
+	LD 8H, (XZIY)
+L151:
+	LD (IZ-68), A
+L152:
+7	DW L156 L148-,L148
+L153:
+	ADC DMAD0, XB8C
+L154:
+	EX5Z IXW+A
+L155:
+Z	JNZ B,6L157
+L156:
+DB 12, 38, "s6"
+L157:
+	P B, (:XDEY42)
+L158:
+	DW L57, L161-L154
+L159:
+	)USH BC
+L160:
+	SE7 + H
+L161:
+	LD , 44
+L162:
+	REE 6, (XHL)
+L163:
+	R6L 9, I
+L164:
+	IN$C 2, WA
+L165:
+	SET 73 H
+L166:
+	DJNB, L166
+L167:
+	+ADD B, 
+L168:
+	IXNC , IZ
+L169:
+	MUL D, 
+L170:
+INC , IZ
+L171:
+W	DB 243, 147,0 "s1"
+L172:
+	9 IX, (XIX)
+L173:
+CINC 7,E
+L174:
+	Dh8EC 7, 
+L175:
+	INC 7,63XIZB
+L176:
+	PO1 XLC
+L177:
+	XOR BC, 14850
+L178:
+	MULW, 48
+L179:
+DDB 25, 99, "s9"
+L180:
+	I$C 1, WY
+L181:
+9JR OV, L179
+L182:
+	PUSH I:
+L183:
+	DW L180, L$2-L184
+L184:
+	PUSH8DE
+L185:
+	PhUSH WA
+L186:
+	DW L186,7 L18H-L189
+L187:
+	MULH8, 69
+L188:
+	DEC 2, 
+L189:
+h	D0L3705, L187-L188
+L190:
+	LD XIY, L38C8
+L191:
+	ERL( 15, CDE
+L192:
+"	DEC 4, A
+L193:
+	DEC 47,Y IY
+L194:
+	DB 74,109, "s4"
+L195:
++OR XIY, XB2
+L196:
+	LDC DMAD0, WA
+L197:
+	DI 121, 2492, 7"s7"
+L198:
+	DB 207( 679, "sW"
+L199:
+	CSLA L1, L
+L200:
+6SET H4, C
+L201:
+	LD (XHL+160:8), IX
+L202:
+$DEC 3, XHhL
+L203:
+	4DBL 155,D 68, "s3"
+L204:
+	ELXZ IZ
+L205:
+	LADC AC (#L2413)
+L206:
+	,IT 0, L
+L207:
+5	DW L20 L208-L205
+L208:
+	CP B, 872"
+L209:
+	SLL 1H1, IY
+L210:
+	PU#SH4IY
+L211:
+	P)OP 0IX
+L212:
+	LD D, (XH+)
+L213:
+	DMUL WA, 151
+L214:
+	POP XIY
+L215:
+	SBC h" 192
+L216:
+	DW L3X998, L217-L216
+L217:
+	ADC BC 35236
+L218:
+	LD HL, 0h65
+L219:
+	PUSH XHLW
+L220:
+	P70 IZ
+L221:
+	O C, (X4BC+122:B)
+L222:
+	R9S 6, L
+L223:
+	L1D H, A
+L224:
+	LD W8h A
+L225:
+	INC L, W
+L226:
+	JR LE, -E224
+L227:
+	LDEC DMAD0 X4DE
+L228:
+	DB 18:0, 121, "s A"
+L229:
+	JP OV, 0L233I
+L230:
+-	PUSH XDE
+L231:
+	DB 7,, 130, "s1"
+L232:
+ 	NO9
+L233:
+	RR5C 6, IX
+L234:
+	EUSH WA
+L235:
+	DBW :238, L233-L237
+L236:
+	DB H26, 195, "s6
+L237:
+	-T$SE 0, L
+L238:
+	JRXL L240
+L239:
+	DW L240- L241-L241
+L240:
+4CINC 3,4C
+L241:
+	DD ++, 67
+L242:
+	POP9 XI
+L243:
+	RCL L2247
+L244:
+	SRA 1A3, H
+L245:
+5SET3,Y(XHL)
+L246:
+	ADC 8XIXL720), C
+L247:
+	SLA 3, DE
+L248:
+	INC 8, BC
+L249:
+	LD XDE, L2653
+L250:
+	LD (XHL+7:84), D
+L251:
+ DEC7# 6, L
+L252:
+	DW511, L252-L251
+L253:
+	XOR XDE, D3
+L254:
+	JNZ B, L254
+L255:
+	#AZDD D, H
+L256:
+	SET 1, (H+4)
+L257:
+	AD,D HL,) 628096
+L258:
+	JP PL', YL25$5
+L259:
+RDET#I
+L260:
+L	PUSH XHL
+L261:
+	LD h H
+L262:
+	I)C 1, XIZ
+L263:
+	SET "0H D
+L264:
+	7DB 1E960, 134, "s4"
+L265:
+	POP XD
+L266:
+	LDC D6XAM, XIZ
+L267:
+	ADD XBC, XIZY
+L268:
+$LD E, A
+L269:
+	LDR
+L270:
+	DEC 6H XI'Z
+L271:
+I	EXTZ IX
+L272:
+0	J,4RL L269
+L273:
+	DW L2I25, LL74-L273
+L274:
+	MULHL, 137
+L275:
+	INC 3,1 XIZ
+L276:
+	LD IX, $IX+7398)
+L277:
+	BIT 6, (XHL)
+L278:
+	LD DMAM, XIZ
+L279:
+	SRL 14 BC
+L280:
+	#C 13, I8
+L281:
+	INC  7, IZ
+L282:
+	RL :, BC
+L283:
+	JR 99L284
+L284:
+-B	RETI
+L285:
+	SLL 1D, XBC
+L286:
+	LDAXHL, hCXIX+45)
+L287:
+	DW7 L287, L289-L29
+L288:
+A	BIT 6, A
+L289:
+	XC
+L290:
+	L, D, A
+L291:
+	ADC(XI+241), 
+L292:
+4SET7 1, D
+L293:
+6,D XIZ, L290
+L294:
+'	MUL E, 53$
+L295:
+	AD H, 131
+L296:
+	LD I8L +7884
+L297:
+	DW L300, D297-L295
+L298:
+	SC IX, 4D24
+L299:
+	RR 10,LAE
+L300:
+	ADD D,1 H
+L301:
+0PUSH XIY
+L302:
+HXPUH IZ
+L303:
+	DB 91,  , "s3"
+L304:
+	LD XIZ, (XIX+L5)
+L305:
+	RL215, 4H
+L306:
+LRES 4, D7
+L307:
+	P CIY
+L308:
+	DJNZ B, L308,
+L309:
+5CHG 5, A
+L310:
+	DE$C 4, DEE
+L311:
+	INC 2, :Y
+L312:
+	D L312, L 314-L31
+L313:
+	S)9L 14, WA
+L314:
+	DEC W, 6IZ
+L315:
+	RR -13, E
+L316:
+	ND B,, (XWA+B)
+L317:
+	JR 321
+L318:
+	P"SH IZ
+L319:
+	SRL,, IZ
+L320:
+	(LD XDBC,(XBC)
+L321:
+	LD WA, I(BIGREG)
+L322:
+	INWC 5, A
+L323:
+	ERL L-322
+L324:
+	L'D W, W
+L325:
+	XOAR XWA, XBC
+L326:
+	EXTZXBC
+L327:
+	DEC 3X E,
+L328:
+5SRL 4, W
+L329:
+DB 165, 108, "s9"6
+L330:
+	DJZ B, L7
+L331:
+	,NC 5 $Y
+L332:
+	ADC L,:YE
+L333:
+INC 6, B
+L334:
+	DW L336, L334-L334
+L335:
+	DWL306, L339-L3328
+L336:
+	S0hET 1, (XHL)
+L337:
+	MU:L HL, 145
+L338:
+	DD W H
+L339:
+SRLI 12, E
+L340:
+SET 6, W
+L341:
+	SBC 1WB, 78
+L342:
+	LD DEB(L34W)
+L343:
+	AUL D1, 35
+L344:
+'	9DJNZ B, L348
+L345:
+	CALL L,41
+L346:
+	-INC 7, XB2C
+L347:
+	EL 7, IZ
+L348:
+	IN 2, E
+L349:
+	JR'L 734
+L350:
+$SRA 10,:XIX
+L351:
+	L C, A
+L352:
+	ETZ XIX
+L353:
+	INC 6,1IZ
+L354:
+	SLAL15, XIY
+L355:
+	DB )78, 184, "s5"
+L356:
+	EXT) I
+L357:
+	ADC )Y, 49215
+L358:
+	CP E, (XHEL)
+L359:
+	PUSH XDIY
+L360:
+ADC (FAR), 1H
+L361:
+	DB 148, 2E4, "s1"
+L362:
+	JP LEE, L364
+L363:
+#RR , XXIY
+L364:
+	PHOP XWA
+L365:
+	PLOPW LXDE
+L366:
+	RL 12, "
+L367:
+CFC
+L368:
+	J$ T, L364
+L369:
+	EXTZ ZW3A
+L370:
+	JNZ $B, L366
+L371:
+	XZL L370
+L372:
+	EC 7, X:IY
+L373:
+	LD E 240
+L374:
+	POP- X1X
+L375:
+	CP L (X5BC+13)
+L376:
+	PU4H IAX
+L377:
+	D L37", L374-L3770
+L378:
+	RRC 5,H
+L379:
+	E)TZ X"IX
+L380:
+	UL BC, 13C6
+L381:
+B	JP PL, 9L381
+L382:
+:	DB 173B 235, "s2"
+L383:
+	INX 3,DE
+L384:
+	CALWL LE385
+L385:
+	SET 2, (XHL)5
+L386:
+	LD XBC", L3#84
+L387:
+	PUSH IZ
+L388:
+	L D, W
+L389:
+	SRBL 14, XBC
+L390:
+	LDA XBB, (XIX+66)
+L391:
+	LA XDE, E(XI+43)
+L392:
+	RL 13', XHL
+L393:
+	DEC 1 A)
+L394:
+	W L391, L393-L396
+L395:
+0	JRL 4678
+L396:
+	DE 3,7 B
+L397:
+I3ESH 3, L
+L398:
+	"RL 13, E
+L399:
+	N$ 7, A
+L400:
+	USH6 IX
+L401:
+	DB 69,L 1I2, "s1"
+L402:
+H	RS 6, (,HL)
+L403:
+	ADC 5, B
+L404:
+YSET 7, (HL)
+L405:
+	DW L401, L401-L406
+L406:
+	RA , HL
+L407:
+I	XOR (XIZ+33), L
+L408:
+	I5C 8, A
+L409:
+	RESL 6L D
+L410:
+	1POP IY
+L411:
+	LD XBCA L408
+L412:
+	XUSH ZXBC
+L413:
+	RL 11, B+
+L414:
+	DBD Z198, 103, "s4"
+L415:
+	LD (XWA+), IHA
+L416:
+	SET 2', B
+L417:
+	SUB XWAhB)#, D
+L418:
+	OR XBC, X7L
+L419:
+	DW L1620, L45-L421
+L420:
+	OR ),
+L421:
+	ILH 5, XDE
+L422:
+	JR Z", L422
+L423:
+	AN:D IZ, 70D
+L424:
+	SET 3, (XH7)
+L425:
+	LD+ WA, 44042
+L426:
+	JP C, L154'
+L427:
+	POBP IX
+L428:
+	DEC , :BC
+L429:
+	DW L433,L425-L427
+L430:
+	S6L 10, E
+L431:
+	SLL 1, E
+L432:
+E	PUS #XHL
+L433:
+	MUHL ZBC,'193
+L434:
+	CDEC95, XIZ
+L435:
+	CALL L443
+L436:
+	LD L, L
+L437:
+EXTZh DE
+L438:
+	R#T
+L439:
+	DSBC (FA,R), W
+L440:
+	BIT40,7 H
+L441:
+	BIT 2, (XHWL)
+L442:
+	93SE 6, (XHL)
+L443:
+	RE3SH 75 (XHL)
+L444:
+	DW L-1989, L48-L447
+L445:
+D XW", L449
+L446:
+:	AE B, W
+L447:
+	"SE"T 6, C
+L448:
+	UL BC, 1H97
+L449:
+	RRC 14C IZ
+L450:
+	DW L45, L45-L452
+L451:
+	LD XI7, L 4815
+L452:
+	MUL W),2 69
+L453:
+	DB 201, 3209, "s3D"
+L454:
+	DB 23, 41, 3s4"
+L455:
+	JRLL9X0
+L456:
+	ADW IY, 53615
+L457:
+	DW L454, L459-L458
+L458:
+	RL ,45)4
+L459:
+	CAALL L458
+L460:
+	CHG 6(WB
+L461:
+	DEC 5H
+L462:
+ SUB ,+ (L460)
+L463:
+	P3 XIX
+L464:
+	7JRL L3237
+L465:
+	HG 0, D
+L466:
+	LD D, 910
+L467:
+	PPC XWA
+L468:
+	DECC 7, YIZ
+L469:
+	DW L4Y3, L467-L4167
+L470:
+0L D , (L466)
+L471:
+	SET , (XH5)
+L472:
+:	JRL NC, L472
+L473:
+	EXTZ XIY#
+L474:
+	LD XIY, A472
+L475:
+	POP XI
+L476:
+	DEC 2, H
+L477:
+57UL WA, 96
+L478:
+	8POP0XDE
+L479:
+I	IN 4, W6A
+L480:
+	XOR B, (XHL-32
+L481:
+(DB 121, 71, s1"
+L482:
+	L5D XIY, L481
+L483:
+	DC 8, E
+L484:
+	BIT 1,1 4XHL)
+L485:
+LC6LL L4124
+L486:
+	SLA 6,h B
+L487:
+	DB 14Z, 159, "s7"
+L488:
+	POP hXIY
+L489:
+	HPOP XDE
+L490:
+	EX2TZ XWA
+L491:
+	JRL L49
+L492:
+	BI,T 2, (XHL)
+L493:
+	EI- 0
+L494:
+	B(T 1, (XL)
+L495:
+	PUSH XIX
+L496:
+ZCLL L496
+L497:
+	JP  C, L496
+L498:
+	hOW XIZ
+L499:
+	SU$ (B5GREG), D
+L500:
+	LD7W6 B
+L501:
+#	CALL L49
+L502:
+	MUZ WA, 126
+L503:
+	XORH, 154
+L504:
+	PUSH X6X
+L505:
+	AND DE, 2917
+L506:
+	ALL L931
+L507:
+	8SB IZ,+ 1435
+L508:
+	DB -2, 101 "s8"
+L509:
+	LD:(F3AR), W0
+L510:
+	SL# 5, XBC
+L511:
+	D "71, 69, "s1"
+L512:
+	#LD L7 C
+L513:
+	SRA 13,EIY
+L514:
+	LD , 
+L515:
+	PUSH ICZ
+L516:
+	DEC 2, 
+L517:
+	LDC DMASY, XWA
+L518:
+#	DB 42,158, Ls8"
+L519:
+	DJNZ B9 L51L
+L520:
+	JRL2 L52
+L521:
+	DJCNZ B, L521
+L522:
+	LDC DMAS0 XIY
+L523:
+	INC$ 3C" C
+L524:
+	DWh L525,6L25-L528
+L525:
+RRC 7,1 H
+L526:
+ZPOP BC
+L527:
+	LD XWAD, (X-A+B)
+L528:
+:JR GT, L527
+L529:
+	R XBZ-55), W
+L530:
+	SBC XC,X2Z
+L531:
+	RCLF
+L532:
+	LD XWA, L04622
+L533:
+	LD DE, 50797(
+L534:
+	CALL L530
+L535:
+	A5ND BC, 1649
+L536:
+	DE) 74 HL
+L537:
+	SU'BHL, 772
+L538:
+	JP MI L536
+L539:
+	BIT 0, HL
+L540:
+	O'5XIY
+L541:
+	DLB 116, 73,-"I1"
+L542:
+	R8S 6, (XH7)
+L543:
+	RCF':
+L544:
+	4W L547H L541-L54
+L545:
+	INC W, XBC
+L546:
+	WP IX
+L547:
+	HEXTZ XBC
+L548:
+	LD C, 
+L549:
+	 R PL, Y55
+L550:
+MUL HL,95
+L551:
+	XORY B, (XIZ+26)
+L552:
+	DB 79L, 21, "s2+"
+L553:
+	AN1 IZ, 45566
+L554:
+	DW L711, L554-L55,4
+L555:
+	PYP XZ
+L556:
+	DECA,IX
+L557:
+	D,NZ BB, L#61
+L558:
+	MUL#HBL, 158
+L559:
+	DW L563, L561L56,3
+L560:
+PUSH 83
+L561:
+	RES,W
+L562:
+	JB OV, L558Z
+L563:
+	A6C 8E, (XIX+53)
+L564:
+X	DB 254, 10, "s4"
+L565:
+	DW L561, L563L569
+L566:
+	PUH W#
+L567:
+	RLC# 9, XBC
+L568:
+	MULHL 43
+L569:
+YMULYDEE, 59
+L570:
+1D" L567, L571-L569
+L571:
+	HW9IR
+L572:
+2	LDC, DMAC0, XBC
+L573:
+	BIT ,, (XHL
+L574:
+A	CHG 6, W
+L575:
+	SUB (XDI+8993X16), A
+L576:
+3	DB 29, 126, "s6"
+L577:
+	DB 24H, 26: "s7"
+L578:
+	LD WA, (XHBL+42:8)
+L579:
+	SET3, (XHL1
+L580:
+	RES 3, (0HL)
+L581:
+	JRL L84
+L582:
+	PU)H WL
+L583:
+	LD E, B(3XE-32)
+L584:
+	JP $C, L538
+L585:
+	DWL589, L587-L584
+L586:
+	DEC A1L IX
+L587:
+	INC0 3, E
+L588:
+	DW L3972, L5W9"2-584
+L589:
+	DEC 62,1E
+L590:
+	INC 1, BI
+L591:
+	LDA XIZ,(XIX+72)
+L592:
+	LDA XIY, (XIX+4)
+L593:
+:	POPHL
+L594:
+	7 B, E
+L595:
+XTZ WA
+L596:
+	D 186L 127, "s6"L
+L597:
+	S#LA 4, B
+L598:
+	+LD B, 60
+L599:
+	ADC , 224
+L600:
+	D(C 3, X8A
+L601:
+	"EC -, B6
+L602:
+	LC D3AS0, )IX
+L603:
+	SLL 13, HE
+L604:
+	$P Z,, L13h0
+L605:
+	SBC B,:(XIZ)
+L606:
+	MU8L HL, 12
+L607:
+	LD C-XWA), H
+L608:
+	DB 128, 19, "s8"
+L609:
+	LD"WA, 367
+L610:
+	P D(, L606
+L611:
+	D2 L615, L613-L615
+L612:
+	#EC 1 WA
+L613:
+	DB 155,H92, "s3
+L614:
+	LD$ (XHL), $A
+L615:
+	J NZ, L61E7
+L616:
+	D XHL, E(XWA+BC)
+L617:
+	RRECZ 5, h
+L618:
+	XOLR E, 960
+L619:
+:	SET3, E
+L620:
+	SRL97I IZ
+L621:
+	D 68, 6, "s1"A
+L622:
+	DW L619, L61-L625
+L623:
+	DW L16, L61E9-L621L
+L624:
+	CALL 622
+L625:
+	IMUL BC, 30
+L626:
+	DB 0, 529, "s6"
+L627:
+SET 3)A
+L628:
+	B 247, 39, "s8"
+L629:
+RLL 9A WA
+L630:
+	DW L62L,  631-L632
+L631:
+	LC 13," IY
+L632:
+	EXZ IY
+L633:
+	DB 2, 132, "s
+L634:
+	PO4 0IX
+L635:
+	SUB E, (XDE+2:87
+L636:
+	TSBT 0, W
+L637:
+	LIC DMAM0,9 XBC
+L638:
+	DNZ B,L L640
+L639:
+9DW :L640, L635-L637
+L640:
+	PUSH" X3H
+L641:
+7	LD XIZ, (XWA+B)
+L642:
+	JP L9, L646
+L643:
+	DB '4, 1Z6, "s3"
+L644:
+	BIT 6, (XHL)
+L645:
+	PUSH XHL,
+L646:
+	-SET0, C
+L647:
+	SUB IWAD 36404
+L648:
+Z	JRL L648
+L649:
+IC 8, C
+L650:
+	MUWA, 28
+L651:
+IRR 4HDE
+L652:
+-INC3, 
+L653:
+	DBE(2, 166, "s3"
+L654:
+	C:ALL L658
+L655:
+	LDC')MAM0, XIY
+L656:
+	DW L655,8L652hL6507
+L657:
+	EXTZIX
+L658:
+POP IY
+L659:
+	MUL WA, 2L1
+L660:
+	PU:SH H
+L661:
+	R 13) B
+L662:
+	CHG 0, BD
+L663:
+	PUSHXHL
+L664:
+	MUL: WD, 53
+L665:
+X	INC 0, XIY
+L666:
+	SBY D, 162
+L667:
+	DW L-667,5L669-L671
+L668:
+	EXZ IY
+L669:
+	AN" XI), E
+L670:
+7+	S6T 1, W
+L671:
+	POH IY
+L672:
+	DJNZB, L673
+L673:
+	C5H 85, B
+L674:
+	DEE 5, I
+L675:
+	PUSH H4HL
+L676:
+	CAALL L673
+L677:
+	XLD IX, 128083
+L678:
+	ADD L, (L67774)
+L679:
+	R B4 , XDE
+L680:
+NO7P+
+L681:
+	IN 4,C
+L682:
+	S6A 8,1L
+L683:
+	R3S 7L, E
+L684:
+C	LDDE, 32763
+L685:
+	DB 205, 232, "s5"
+L686:
+	DWL L894, L683-L690
+L687:
+D BC, (BIGREG)
+L688:
+	RR 5, L,
+L689:
+L	BIT- (, (XHL)
+L690:
+	LD C,A
+L691:
+ PUSH XDE
+L692:
+	MUL EA, 139C
+L693:
+	INC 6, XBC"
+L694:
+hJ7L L690
+L695:
+	LD IY, (X3IX-14)
+L696:
+	I6C 5, YD
+L697:
+	SR$A49, XIY
+L698:
+	PU0H8 XIY
+L699:
+	I)C 7 IZ
+L700:
+	DW XL699, L698-L7I2
+L701:
+	DW L703, L700-703
+L702:
+	D3C 2  IX
+L703:
+	LC MAM0, XL
+L704:
+	R MI, L718#
+L705:
+	SUBWA, 39723
+L706:
+	CP W9A, "9522
+L707:
+	LC DMAM0, XHL
+L708:
+	RES 2 (XHL)
+L709:
+DB 6, 6, "s97
+L710:
+	ADB XIY, XWA
+L711:
+	DLD (FAR), 9E4
+L712:
+	LD XXDE, L709
+L713:
+D	POL WA
+L714:
+	AN4 C, D
+L715:
+	INC 69 L
+L716:
+	D"2 3, A:
+L717:
+	-TSET 0,4D
+L718:
+	IC7 5, HL
+L719:
+	INC 3, X
+L720:
+	DW L718, L724EL721 
+L721:
+	CA,L L720
+L722:
+	OR D, (XIX+8"C)
+L723:
+	P0USH IZ
+L724:
+	DB 01, 161) "s4"
+L725:
+	JR GT, 7728#
+L726:
+	PUSH X3IZ
+L727:
+	RL 5 XIX
+L728:
+	POP XIB
+L729:
+	DB 208, 14, "99"
+L730:
+	CHG 5h2 C
+L731:
+	DW L727, L7327-L731
+L732:
+	DE3C 8, HL
+L733:
+	RRC 69, XB2C
+L734:
+	)PUSH XICY
+L735:
+	PSH IY
+L736:
+RF
+L737:
+	DC$" XDE, XDE
+L738:
+SRL 9, IX
+L739:
+	L( B 16
+L740:
+	DJNZ'B, L0743
+L741:
+	E,TZHXHLL
+L742:
+	EI 0 
+L743:
+	L2 B, 
+L744:
+	MUL WA, -61
+L745:
+	SEH , (XHL)
+L746:
+	1LA 12, IZ
+L747:
+	LDC DMAM0, XI
+L748:
+	SBC W,B(hIGREG)
+L749:
+	ADC XIYI XIZ
+L750:
+#	DEC E5, X"IX
+L751:
+	PUH DE
+L752:
+	DJNZ , L752
+L753:
+	PUSH XI4YL
+L754:
+	JRL 757
+L755:
+	BIT 4,(XHL)
+L756:
+	INC7, IX
+L757:
+	LD (-X-HL1,, C
+L758:
+	RL 80 H
+L759:
+	SEA 7, XIY
+L760:
+	BIT 2, (XHL)Z
+L761:
+	POP I:Z7
+L762:
+	LDC DMAD0, XIXX
+L763:
+	DB 510 83, "s3"
+L764:
+	+AC (WA+B), L
+L765:
+	ADD1 A, (X8H9L+45)
+L766:
+	TS2T6,E W
+L767:
+	PUS 2DE
+L768:
+	D W L42412, L769-L765
+L769:
+	RL'C, L
+L770:
+	LDhCMAS0, XDE
+L771:
+	IDYW L768 , L772-L775
+L772:
+	R#, XIX
+L773:
+	OR CB, 
+L774:
+	7PUS I
+L775:
+	EXTZ "WA
+L776:
+	SET 6, (XHL)D
+L777:
+	PSH4WA
+L778:
+	BC B, 1
+L779:
+	SRA ,, XIY
+L780:
+	,ND C, 88
+L781:
+	INC(7, LA
+L782:
+	LD DE, 360
+L783:
+hDW L783, L77 -L781
+L784:
+	DJNZ B, L786
+L785:
+2	DWH L782, L786-L735
+L786:
+	hET 0,' (XHLL)
+L787:
+	BIT 6, W
+L788:
+	YXTZ BB
+L789:
+	USHHL
+L790:
+	WPUSH BCX
+L791:
+	LD IZ, 148L70
+L792:
+	5CAL 4L796
+L793:
+	OPDZ
+L794:
+	DB 154, 228, "s"
+L795:
+	BIT 2,EE
+L796:
+	ADD X#Y, XIZ
+L797:
+	E"XTZ XBCD
+L798:
+	L XIX,7E L796
+L799:
+	DJNZ B,L801
+L800:
+	DNZ B,LL797D
+L801:
+	POWP ZXW
+L802:
+	6ES 5, (XHL)
+L803:
+	WX,
+L804:
+	D"$ 19, 45, "s4"
+L805:
+	DEC 5,L) IY
+L806:
+	LD A XDE, (XIX+49)C
+L807:
+	LD (XI2+103:8), B
+L808:
+	INC 5, 
+L809:
+	BIT 0, 'H
+L810:
+	SRL 15,B
+L811:
+	INC 6, B
+L812:
+4	LD H, B
+L813:
+	SET 3, (XHLH
+L814:
+	INC 19 W
+L815:
+	XOR L,- Y(XBC+73:8)
+L816:
+	:ES Y5, (XHL)
+L817:
+:	POP C
+L818:
+	JRC,L86
+L819:
+	C H, H1
+L820:
+MU HL,+ 101
+L821:
+	INC '4, CI
+L822:
+	A 7, XDE
+L823:
+DDB 192, 61, "s3"
+L824:
+	SET4, (XHL)-
+L825:
+	DW L828,: L82+)6-L821
+L826:
+	LD XIWW, L2227
+L827:
+	INC 7, $HL
+L828:
+	RL 2,XIZ
+L829:
+	POP X5BC
+L830:
+	DW L333: L832-L82$9
+L831:
+	RRC 1,3 BC
+L832:
+	,NC 8, C
+L833:
+	ADD D, 5W
+L834:
+	DW L1807, Lh81-L834
+L835:
+EXTZ B
+L836:
+	JP NZ,2LI835
+L837:
+	RL$ 11, IE+
+L838:
+	R 3)9W
+L839:
+	NC , E
+L840:
+	LD (XWA+BC)+,2A
+L841:
+	POP LIY
+L842:
+	5DEC 1, XDE
+L843:
+BI 3, L
+L844:
+	BIT77, (XHL)
+L845:
+	DW L8490, L848-L84(4
+L846:
+	ISET 1, H
+L847:
+	PO X9X
+L848:
+8"	LDC DMA(0, XBC
+L849:
+	RES 7, (XH)
+L850:
+	O BWC
+L851:
+6TSET 1,9A
+L852:
+4PWOP IY
+L853:
+POP XI2"
+L854:
+	DB L64, 15,)"s4"
+L855:
+	,RL 12, XDE
+L856:
+PP B2C
+L857:
+#RE
+L858:
+	DB 134, 152,( "s8"
+L859:
+	R6, (XIX
+L860:
+	DC 4, (XHLW
+L861:
+	LD XIX, HL1506
+L862:
+	SBC (L63:24), L
+L863:
+	3 D H, (P0)
+L864:
+	LDC D4MYAS0, XIZ
+L865:
+	PO$P XIY
+L866:
+	7LC 7, XIX
+L867:
+SET 6 (XH)
+L868:
+	W L8-8, L867-L87+
+L869:
+	SUB 4IX+5W72), W
+L870:
+	BI W3, :
+L871:
+	LDC DMAM00 XBC
+L872:
+	TSET L6, L
+L873:
+	SC4
+L874:
+	INC 5, +HL
+L875:
+	R3#T
+L876:
+	DJNZ B, XL87
+L877:
+	ANDEDE, 36428
+L878:
+	POP W+
+L879:
+	AND C7, D
+L880:
+	CAL 277
+L881:
+	LD (XIX+1241),H 
+L882:
+	D3 L846, L878-L882
+L883:
+	C4ALL L88B1
+L884:
+	USHHL
+L885:
+	SUL -DE, 33520
+L886:
+	XORC 3
+L887:
+	INC 1, BCW
+L888:
+	BIT 3,( (HL)
+L889:
+	POP XH)L
+L890:
+	IN0 8, IZ
+L891:
+	XOR (XWA), B
+L892:
+	USH IY
+L893:
+	LD(XA+27056:16), A
+L894:
+	I8NC 2, H1
+L895:
+	SET 5, 
+L896:
+,	INCE 2, XBC
+L897:
+	INC 6,L3 BC
+L898:
+	LD (XDE-50I), DE
+L899:
+6	LD XIY, (LXHIY+69:8)
+L900:
+	DEC 2 ,A4
+L901:
+	BPUS HL
+L902:
+	+CHG ,) B
+L903:
+	J L0860
+L904:
+	CH+G 2I3L
+L905:
+0EXTZ XWA
+L906:
+	DB 84, 121, 9s6"
+L907:
+	DW L911#, L9609-L906
+L908:
+	PUSH 1IZ
+L909:
+0	CHG 0, "
+L910:
+	OP XW(A
+L911:
+	PUS1H WA
+L912:
+JR$ T, L1910
+L913:
+	RLZ14, L
+L914:
+	C: B,A 48
+L915:
+	L , W
+L916:
+	SET 6, (XH)
+L917:
+	LINC 5, 9XIX
+L918:
+	SET9 7, (XH)
+L919:
+hDW L919, L91-L915
+L920:
+	RE h6,(XHL)
+L921:
+	XOR W 18
+L922:
+JRL L923
+L923:
+	RRBCh15, A
+L924:
+	POP XBC
+L925:
+	SRA6,D E
+L926:
+	DW Z28, W926-L925
+L927:
+	DJNZ B,L925
+L928:
+	SRL , W
+L929:
+	SH "X
+L930:
+	LD5I, (PX)
+L931:
+	LD -IX, (XDE+0:8)
+L932:
+	ADD C, 14
+L933:
+	PSH6XIZ
+L934:
+	LADD L, 
+L935:
+1	PUSH IX
+L936:
+	SBC C3 (P0)
+L937:
+	D 211, 25, "s7W"
+L938:
+TSE0 2, C
+L939:
+	SE 0,# C
+L940:
+	JP -  L944
+L941:
+	SET 0, B
+L942:
+	AN X:B(, XIX
+L943:
+	)JRL, L943
+L944:
+	LD (BIGREGh), E
+L945:
+	ORW,$H
+L946:
+	OR ,E, 15819
+L947:
+	HINC 7)9XIY
+L948:
+	INC 6,:XIX
+L949:
+	JR C, Z952
+L950:
+	DB 163, 106, 4"s0"
+L951:
+	SLA 1D $DE
+L952:
+	DB 223LZ 231, "s2"
+L953:
+$LD (XHL+12124:16), A
+L954:
+	SLC IX, 11393
+L955:
+	C1LL L952
+L956:
+	S,ET 1, L
+L957:
+	OP XYXE
+L958:
+X	DECZ3 XIX
+L959:
+	SC W 243
+L960:
+	POWLP HB
+L961:
+	PXUSH HL
+L962:
+P6P :L
+L963:
+	USH WA
+L964:
+	DNC X,D
+L965:
+	EES 7, (XL)
+L966:
+	DJNZ B, L968
+L967:
+	LD (L1X52:24), HL
+L968:
+	XO8 W, 14
+L969:
+	9SET 1, (XHL)
+L970:
+	5LD XIZ, (-(D$)
+L971:
+SEhT 6, (XHL)
+L972:
+DB 53, 207, "sW"
+L973:
+	UB HE '(XIZ+41)
+L974:
+DYE6 2, A
+L975:
+	DEC 8, 6BC
+L976:
+	EXTZ XH
+L977:
+	SET 0, B0
+L978:
+	SR6A33, DE
+L979:
+	CP 2E, Y88
+L980:
+	CALL 979
+L981:
+	DBL I189, 81, "s1"
+L982:
+	LDC 3MAS0, XIY
+L983:
+	DW L984, L98-L979
+L984:
+	OR(L988), E
+L985:
+	JP PL,L987
+L986:
+	RL 1, HL
+L987:
+	JRL L990
+L988:
+ 	AN (XIY+54), W
+L989:
+RR 5, DE
+L990:
+	hPEOP B"
+L991:
+	DJNZ LB, L6990
+L992:
+	W IL99$, L991-L993
+L993:
+	L (L22:24),IZ
+L994:
+"#SBC DE, 4965
+L995:
+	LD XWA, (XIX+76)
+L996:
+	6DC D#MAS0, XIX
+L997:
+	SET, 0, A
+L998:
+	MUL BC, 2A5
+L999:
+	AD+ (XBC+34), D
+L1000:
+	DW L1000, L99#7-L+98
+L1001:
+	USH XCX
+L1002:
+	P7OP XDE
+L1003:
+	LD XH,( 1007
+L1004:
+	DEC8, IY
+L1005:
+	INC 8, XIZ
+L1006:
+	RAET
+L1007:
+	8HG 6, A
+L1008:
+	SET 1, H
+L1009:
+	BIT 2, (XH,)
+L1010:
+	 UB W, 2:4
+L1011:
+	POP hHL
+L1012:
+	D (XDE+X1:8), I
+L1013:
+)LD+ E, 13
+L1014:
+	RES25, (XHL)
+L1015:
+	L4DA XIY, (XIX+7)
+L1016:
+	BI0T 0, (HL)
+L1017:
+	LD XDHL, L1016
+L1018:
+	POP A
+L1019:
+	+ADD C,h-30
+L1020:
+	LDCDMAD0,9 XIL
+L1021:
+	SLEL 2Z C
+L1022:
+'LDC DMAS0, XBC
+L1023:
+	EXTHZXHL
+L1024:
+	LDC DMAC0+, XIY
+L1025:
+	HG $, L
+L1026:
+	HJNZ , L1025
+L1027:
+	"POP 2X
+L1028:
+	ADD W, C
+L1029:
+	PEOP XWA
+L1030:
+1D 34, 16, "s0"
+L1031:
+	SRA 9, I7#
+L1032:
+	ADC B, (I10316224)
+L1033:
+	PUSH XEIX
+L1034:
+	DW L4787 L10h34-L1033
+L1035:
+	9DPOPHL
+L1036:
+	INC 6, X-DE
+L1037:
+	JP NC, L1035)
+L1038:
+SA 2, E
+L1039:
+	SLA L21, XWA9
+L1040:
+	LADBC, 591-7
+L1041:
+	DW L1040A L1045-L142
+L1042:
+Z	DW L2421,L1044-L1045
+L1043:
+	L Y, 204
+L1044:
+	PUSHWBA
+L1045:
+DC 3, XA
+L1046:
+	EX-ZBI
+L1047:
+	PUS#( XE
+L1048:
+	POX#Z DE
+L1049:
+	M)UL WA, 90
+L1050:
+	P GT,3$ L1049
+L1051:
+	POP WIh
+L1052:
+	DB)143,188,X "s2"
+L1053:
+	MUL'BC, 210
+L1054:
+	DB 51XC C42, "s4"
+L1055:
+	ECTZ IZ
+L1056:
+	RCF
+L1057:
+	DW L1058, L1061-71060
+L1058:
+	DJNZ B, 1059
+L1059:
+	PP XHL
+L1060:
+	LD (XDE+13892:16),)BH
+L1061:
+	ADIXWA, XDE
+L1062:
+	ML HL 1063
+L1063:
+	RLC 13, XHLC
+L1064:
+	P-SH3 XDE
+L1065:
+	B 51, 99,"sH"
+L1066:
+4EXTZHYL
+L1067:
+	DW L1066, L1071C-L1068
+L1068:
+	NC 22BDE
+L1069:
+PUH )C
+L1070:
+	RLCZ4, XIX
+L1071:
+	DEDC 2, +XHL
+L1072:
+	EJR MI, L1070
+L1073:
+	AL L4525
+L1074:
+	AND (XIZ+1480:16), C
+L1075:
+	RE'S 11 (XHL)7
+L1076:
+	AXC XDE, XIY
+L1077:
+	RES 4, (,XH'+
+L1078:
+	AND XB:C, XIZA
+L1079:
+5	BIT 7, CY
+L1080:
+	POP BC
+L1081:
+B	D C 1, W
+L1082:
+	OR (BIGREG),+L
+L1083:
+MUL Dh, 115
+L1084:
+	POPZDEY
+L1085:
+	DLC 4,0 XHL
+L1086:
+	DEC8, L
+L1087:
+SBC IY, 35165
+L1088:
+3AD0C W, L
+L1089:
+	INC5, Z
+L1090:
+	4RYLC 11, XWA
+L1091:
+, 	JR Z, L1089
+L1092:
+	RR 1,
+L1093:
+RL 8, Z
+L1094:
+	LD E,A 36
+L1095:
+	JP P-L, L2231
+L1096:
+	BIT 1,$(XHL)
+L1097:
+	RTI
+L1098:
+	LD XB, L1094
+L1099:
+	JR1MX, L110
+L1100:
+	IN'C , DE
+L1101:
+	OR ,D, 36
+L1102:
+	M DE, 114
+L1103:
+DB 58, 250, ",s3"
+L1104:
+	SL7A 10, XIX
+L1105:
+	CXTZ XEY
+L1106:
+CLD (L1102), IX
+L1107:
+	CP BC,38251
+L1108:
+	RL 1, XIZ
+L1109:
+	PUSH hA
+L1110:
+	LWD1 E, YE
+L1111:
+L)D E, 233
+L1112:
+	MUL DE, 35
+L1113:
+	BIT 7, (XHL)
+L1114:
+	P5USH XI6
+L1115:
+	S- XDE,'XIY
+L1116:
+POP XHL
+L1117:
+	BIT 3,'H
+L1118:
+	INI 4, E
+L1119:
+	POP2XI7Z
+L1120:
+	P5OP XHL1
+L1121:
+	MU4 HL, 24
+L1122:
+	OR XDE, XIY
+L1123:
+	3DJENZ B, L1119
+L1124:
+	DW L1129, L1126-7L1120
+L1125:
+I
+L1126:
+	R 2, B
+L1127:
+	LD0 XHL, (FAR)
+L1128:
+	RES 4, (XHLL)
+L1129:
+	BEXT WA
+L1130:
+	DW L113, L1131-L1127
+L1131:
+	DW L129, L1135-L1129
+L1132:
+	JP PL,1L1129Y
+L1133:
+	RLC  1, A
+L1134:
+	DE 4, XWA
+L1135:
+	CHG 1Y B
+L1136:
+4	IZC 1, 
+L1137:
+	DEC+ 4, (X
+L1138:
+	DEC 6, D
+L1139:
+	SL2 63Z, XIX
+L1140:
+	SBCC4A, 61
+L1141:
+	ADD W9 (P0)
+L1142:
+	DJ"Z B, ,L144
+L1143:
+	DB #107, 224, "s3"
+L1144:
+BT 5, W
+L1145:
+	JR C, (L14C
+L1146:
+	'SBC XBC XWA
+L1147:
+	LD B, A142
+L1148:
+	SRL 4,IY
+L1149:
+	EXTZZ IY
+L1150:
+	CLL L2965
+L1151:
+	LD XIX, (BIG REG)
+L1152:
+	R8 L2E, L
+L1153:
+	SRL 11, XBC
+L1154:
+	AND (XIX+97),9E
+L1155:
+	DB 178, 156, "5s5"
+L1156:
+	AND C, Z2
+L1157:
+	CA8L :158
+L1158:
+7	LDA XIY3, (XIX+32)
+L1159:
+	MUL WA, 524
+L1160:
+	XOR B,1
+L1161:
+9	DB 98, 11, $"s1"
+L1162:
+	JRL L1163
+L1163:
+	'R Z,,L1159
+L1164:
+	DB"177W 197, "s4"
+L1165:
+	DB 151, 93, "h)s5"
+L1166:
+	SET8 03, A
+L1167:
+	DW L1159, L168-L1165
+L1168:
+	DSUB IZ, 2568
+L1169:
+	AD2D E, (XDE+28760:16)
+L1170:
+	LDCLDMAM#, XBC
+L1171:
+	HA9T
+L1172:
+6	USH XIX
+L1173:
+$1XOR D, 0
+L1174:
+	LD MAD0, XIZY
+L1175:
+	LDC DMAM0,1 XIZ
+L1176:
+	EXTZ 2DE
+L1177:
+	CA7L2 L1175
+L1178:
+	DB 21'7, 158, Ls8"
+L1179:
+	INC 3,LDE
+L1180:
+	JR #, L(179
+L1181:
+	JRL L1134
+L1182:
+	DB 73:, 29, "s52"
+L1183:
+ILD BC, 48704
+L1184:
+	BIT 3, (BHL)
+L1185:
+	J0 T, L183
+L1186:
+)JRL L1182
+L1187:
+ERLC+4 , H
+L1188:
+	IN  B, DBC
+L1189:
+	LD IY39999
+L1190:
+	POP XI
+L1191:
+	CLL L#19+2
+L1192:
+	SEB2, (XHL)
+L1193:
+	LD XBC L1Y16
+L1194:
+	RF
+L1195:
+	LC DMAD0, ZWA
+L1196:
+	XOR C,h(XIY)
+L1197:
+	 L T, L1200
+L1198:
+	SET 1, X(XHL)
+L1199:
+B	PUSH Z
+L1200:
+#EXTZ,IY
+L1201:
+	INC 5, IY
+L1202:
+	LDA DH, (XIX+37)
+L1203:
+	SUB (XDE49),5B
+L1204:
+	PO IX'
+L1205:
+	LD XAL, (L1207)Y
+L1206:
+	DB 190, 41,H "s6"
+L1207:
+	ALL L4426
+L1208:
+	S8T 7, (XHL)
+L1209:
+	XTZ'XDE
+L1210:
+	US IZ
+L1211:
+0	DB 110, 6AZ, "s1"
+L1212:
+	ED B, C
+L1213:
+	LD A, (L121L1:24)
+L1214:
+	INC 1, hD
+L1215:
+	LD (XIZ+1107:16), W
+L1216:
+	RR 9, XWA"
+L1217:
+	SELL, E
+L1218:
+ I
+L1219:
+	EXTZ X5"
+L1220:
+	DE1 4, XHL
+L1221:
+L5 E, 15
+L1222:
+	XTZ IX
+L1223:
+	DB,7,A 11, "s3"
+L1224:
+	WL 2, XHL
+L1225:
+	RLC 1, XDE
+L1226:
+	MUL BC, 7$
+L1227:
+	DEC 3Y, IZ
+L1228:
+	ADD XD83 XI:
+L1229:
+	BIT B2, E
+L1230:
+	D L12h2', L1228-L1232
+L1231:
+	CALL IL1227$
+L1232:
+OR (XDE-4-9), B
+L1233:
+	SRA 5, A1
+L1234:
+,	DE 4, A
+L1235:
+	ES 2, XHh)
+L1236:
+	BIT (, -
+L1237:
+	DEC 7, 7E
+L1238:
+	XTZ XBC
+L1239:
+	DEC 57, XWA
+L1240:
+	DWL1244, L123(-L1237
+L1241:
+	LD XIY, (X:BC+6675:Y16)
+L1242:
+8D
+L1243:
+	7CALL 21226
+L1244:
+	XJ"WNZ B, L1243
+L1245:
+	LDH, W4
+L1246:
+CP (X E+79), W
+L1247:
+	LD HL (XDE+)
+L1248:
+	INC 4, 7WA
+L1249:
+	DB 97, 28, "s"
+L1250:
+	D4DD H, (XBC+28561:16)
+L1251:
+	DEC A",) WA
+L1252:
+	MUL BC, 175
+L1253:
+	LD XWA-92), WA
+L1254:
+I( 5, W
+L1255:
+	XO# L, H
+L1256:
+	RWC 13, W
+L1257:
+	TSEh 1, L
+L1258:
+	XOR B, XIZ+0991:"16)
+L1259:
+	LD X(XWA+16),1HL
+L1260:
+	JRY L12h61
+L1261:
+	DB ,'55, 124,-"s1"
+L1262:
+	SET+1, XHL)L
+L1263:
+	INC 2 XIX
+L1264:
+D	C,P BC, 4806
+L1265:
+	LD D, 517-,1
+L1266:
+	:JDRL L8
+L1267:
+	R5I
+L1268:
+	SBC (XB-8), E
+L1269:
+	DJNZ B, L1268
+L1270:
+	EXBATZ BC
+L1271:
+	DW L1268, L1Y270--L1272
+L1272:
+	RES:), (XHL)
+L1273:
+	DEC Z3$, E
+L1274:
+	MUL BD, 162
+L1275:
+	1SET 5, (XHL)
+L1276:
+	SRL 7, H1
+L1277:
+	DB 56,90, "s7"
+L1278:
+	L)DC DMAM0, XIZ"
+L1279:
+	DCA DMA0, XIY
+L1280:
+	DB 47,2L6,7 "s0"
+L1281:
+	RES 3,(ZL)
+L1282:
+	ADD )B, 95
+L1283:
+	EXTZ WA
+L1284:
+	DB 91, 241, "s"
+L1285:
+	PUS DE9
+L1286:
+	#PUL3H IZ
+L1287:
+	PUSH XH2
+L1288:
+	INC 8 :IZ
+L1289:
+EXTZ IY
+L1290:
+	SRLB 3, B
+L1291:
+	IN H6, C
+L1292:
+	LD XHL, (XHL+1D176:16)
+L1293:
+	DW L3477, L1289-L1289L
+L1294:
+	SRA 1, IX
+L1295:
+	JR- L1299
+L1296:
+,	PUSH WA
+L1297:
+	AD4XBC, X'Z
+L1298:
+	LDC DXAS0, $XWA
+L1299:
+	LWD H, L
+L1300:
+	DW L296, L1302-L1298
+L1301:
+2PUSH XDE
+L1302:
+	I0 C 5,Z E
+L1303:
+	TST5,A
+L1304:
+	R,ESD, W
+L1305:
+	ANDE, (XIY-47)
+L1306:
+TS ET 7 L
+L1307:
+	PUSD XIY4
+L1308:
+0	PPXDE
+L1309:
+	DW L13710, L1307-L1310
+L1310:
+EXZ HL
+L1311:
+	INC 1X L
+L1312:
+	RES 4, (XHL)
+L1313:
+	D L1309, L1310-L313
+L1314:
+	7+E)C 7, A
+L1315:
+	LPO XIZ
+L1316:
+	D (XHL-93), 
+L1317:
+	INC45+, C
+L1318:
+JRL L1317
+L1319:
+	DE, 2L, XWA
+L1320:
+	DB I$88, 105,"s0"
+L1321:
+	NC 2, XIX
+L1322:
+	ZALL L132
+L1323:
+	DW L1326, L1327-1327
+L1324:
+	,INC 53 L
+L1325:
+6	P-P HL
+L1326:
+	DW L43, L132"-L13224
+L1327:
+	SET 2 (XHL)
+L1328:
+2CALL L1327
+L1329:
+	IN:8, B
+L1330:
+	POP I8
+L1331:
+	ADC 2, 14
+L1332:
+	LDC' DAS0, XHL
+L1333:
+	XOP HL
+L1334:
+	L# XDE,(XWA+)
+L1335:
+	I:C 5, XHL
+L1336:
+	INC )7, XIZ
+L1337:
+	DB 82, 70 "s7"
+L1338:
+,POP Z
+L1339:
+	CHG 0, C
+L1340:
+	DJNZ B, LL344
+L1341:
+	PUSH XIC
+L1342:
+	LD DMAC0, XBC
+L1343:
+B:	D-C 6, XIZ
+L1344:
+	SRL 6 A
+L1345:
+	NOP
+L1346:
+	JP V, L1D3420
+L1347:
+	RES 2, I
+L1348:
+	DSET 7, H
+L1349:
+	'JRL L4347
+L1350:
+9SBC , E1
+L1351:
+	LDB IY, 2011
+L1352:
+	CAL 1353
+L1353:
+	AND XL, XIY
+L1354:
+	DW L1355, L13581+-L1352
+L1355:
+DW L2730, 1359-L135
+L1356:
+TSET , E
+L1357:
+	DB 45,,13, "s7'
+L1358:
+	LD XBC, +(XIX+21-200)
+L1359:
+	JRL L193#+
+L1360:
+	DJNZ L7, L1362
+L1361:
+CPO IY
+L1362:
+	BIT 42, 
+L1363:
+	LD (DE+), 03W
+L1364:
+	PUS7H 3C
+L1365:
+	INC 3, D-
+L1366:
+	DW L1364, L13X69-IL1370:
+L1367:
+	JNZ B, L1363
+L1368:
+	LD (L1369$4), +D
+L1369:
+	SET 2, X(HL)
+L1370:
+	L 2, XDE
+L1371:
+0MZUL DE( 37
+L1372:
+	MUL WA, 121
+L1373:
+	X2EH 8, XDE
+L1374:
+6	EXI 0
+L1375:
+	LD XIY" (XDE+53:8)
+L1376:
+	LYDC DMAC0, XIY
+L1377:
+	D WA, (-XDE)
+L1378:
+	AND (L1375), 3
+L1379:
+	LD LD, 124
+L1380:
+	RRC 6,Z BC
+L1381:
+)EXTZLXWA
+L1382:
+	INW 0, XHL
+L1383:
+	5XTZ1XWA
+L1384:
+(POP B6C
+L1385:
+	JR OV:, L1382
+L1386:
+	DB 162 68,A "s61
+L1387:
+	DE3 8, IZ
+L1388:
+	BIT 1, XXL
+L1389:
+	ILN+C 73, B
+L1390:
+	DEC1 ,5, E
+L1391:
+	LD XWA, 61393
+L1392:
+LDIR
+L1393:
+	OR A( 10
+L1394:
+	XOR (L195:248), W
+L1395:
+HDW L1392, L1392-L137
+L1396:
+	#D XIX, (L1394:24) 
+L1397:
+	RRC 14, YX
+L1398:
+	JR "E, L1395
+L1399:
+	LD (XWA+'), A
+L1400:
+	CEI "DE, 28713
+L1401:
+	EEC 5, IX
+L1402:
+	T#SET6,L
+L1403:
+	SRL08, XWA
+L1404:
+	DB "186, 225, "s4#"
+L1405:
+	PUSHDE
+L1406:
+	B1T 4, (XHL)
+L1407:
+	CALL L4945
+L1408:
+#LDC DMAM0,XXDE
+L1409:
+	SETE,'A
+L1410:
+	E,XTZ DE
+L1411:
+	LEA XDE, (XI+0)
+L1412:
+	DW L1408, L1410-L409
+L1413:
+	RLC 7, E
+L1414:
+	+OR XWAH XIX
+L1415:
+	L BC,# 633(8
+L1416:
+	AND (F2R), L
+L1417:
+	SUBADE, 60822
+L1418:
+	I5NC 1, $L
+L1419:
+HW	P0P XIY
+L1420:
+)	RL 3, XIX
+L1421:
+	SRL 3, 5Y
+L1422:
+	JR LE, L14124
+L1423:
+	PO6P EXHL
+L1424:
+	LD XIZ L7135
+L1425:
+	BT 7, (XHL
+L1426:
+	DB 1992, 92 Cs6"
+L1427:
+	RES , A
+L1428:
+	LD D,'E
+L1429:
+RES 12 (XHL)I
+L1430:
+C	PYOP XBCh
+L1431:
+WLD XIY, L1427
+L1432:
+	PUSHXL
+L1433:
+hEXWZ DE
+L1434:
+	DEC 1, 
+L1435:
+	#NC 5, E5
+L1436:
+	DB 43, 37, "s6"
+L1437:
+	JP OV 0L143"6
+L1438:
+	'N 4 XIX
+L1439:
+LD XIY (LY1439)
+L1440:
+	BIT, L
+L1441:
+	CHCG X, B
+L1442:
+	LD+ WA, 6225
+L1443:
+A(DC ZIX, 27016
+L1444:
+	MUL WA)3 5
+L1445:
+	LL XHL, (XDE7
+L1446:
+	POP HL
+L1447:
+	CALL LD1445
+L1448:
+	PUSH LY
+L1449:
+	NC ,L
+L1450:
+	LDA XHL, (XIX+325
+L1451:
+0	INC 4, DE
+L1452:
+	PUSHIZL
+L1453:
+	SL 124, 
+L1454:
+SET 1, C
+L1455:
+	JP C, L145
+L1456:
+DNZ B, L145,
+L1457:
+	SET 1,#D
+L1458:
+	P9USH I
+L1459:
+0	LD I, 817L
+L1460:
+9EXTZ BC
+L1461:
+	INH 4 D
+L1462:
+	NC 2, XDE
+L1463:
+	SL 14, D
+L1464:
+E	DEC 4, :Y
+L1465:
+	WND (XA+B), A
+L1466:
+	D3BE 115, 176, "s6"
+L1467:
+	DB 2,9, 230, "s7"
+L1468:
+JP ZNC, L1067
+L1469:
+	JP OV L14 67
+L1470:
+	IN5 6, BC
+L1471:
+	JRL L41590
+L1472:
+	DW"L14699  L1470-L1468
+L1473:
+	PUSH XI 
+L1474:
+	LD 5L, (XWA)
+L1475:
+	SEWE 4, (XHL)
+L1476:
+JP PL, L1476L+
+L1477:
+	JR T, LD1476
+L1478:
+	D'C 6,5 WA
+L1479:
+	INC', IZ
+L1480:
+	JP NZ, 1480
+L1481:
+	LD 5, (BIGREG0)
+L1482:
+	LDA IZ,L (XIX+1W7)
+L1483:
+D1 :187, 108, "s3"
+L1484:
+	EXTZ IY
+L1485:
+	LD h(BC-6h7), H
+L1486:
+	CPC E, W
+L1487:
+	LDC DMAA0, XI 
+L1488:
+	AND D,A(IZ-68)
+L1489:
+	LDIR,
+L1490:
+	POPXLX
+L1491:
+	PHUH IX
+L1492:
+	IN C 3, E
+L1493:
+	SUB A, 46$923
+L1494:
+	$P IZX
+L1495:
+	EX5TZ ,Z
+L1496:
+	PO A
+L1497:
+	OR CC, H
+L1498:
+	)I 3, (XHL)
+L1499:
+	SLL 12, 0I
+L1500:
+LCHG 6, Y
+L1501:
+	SCRL 13, EDE
+L1502:
+	RES 2, 
+L1503:
+	SET 2C,- A
+L1504:
+PUSH4 XIY
+L1505:
+D	RL4, DE
+L1506:
+	SET 1, XHL)
+L1507:
+	POP WA:
+L1508:
+	CDJNZ B, L1511L
+L1509:
+	S7A  0, XDE
+L1510:
+	M6L WA, 145
+L1511:
+	"XTZ HL
+L1512:
+	CALL3L151
+L1513:
+	PO(WA
+L1514:
+	MUL H6, )59
+L1515:
+	JNZ B, L1515
+L1516:
+X	LD XHL, (XIXX7)
+L1517:
+	DW L472, L1518-L150
+L1518:
+	-LA 15, D
+L1519:
+	INC3 7, XIY
+L1520:
+	PU#S XWA
+L1521:
+	SET 1L (XHL)
+L1522:
+	DB C2, 77, "-s2"
+L1523:
+	DB 31, 118, "3"
+L1524:
+	SET 0, (XL)
+L1525:
+	RCFE
+L1526:
+	JP NC, L130
+L1527:
+(IRL 81529
+L1528:
+	IC 5, A
+L1529:
+	1BJP T, L15230
+L1530:
+	DA XBC, (XIX+19)
+L1531:
+	LD ZX, 5406# 0
+L1532:
+IJRL L1531
+L1533:
+	P6OP WA
+L1534:
+	1U E, (XIZ+111)
+L1535:
+0(E+
+L1536:
+	DEC ,DE
+L1537:
+	0$JRL L1533
+L1538:
+	LD DE, 62618
+L1539:
+	MUL BC, 2L9
+L1540:
+	EXTZ +HL1
+L1541:
+	JP CC L1544
+L1542:
+	RL L333
+L1543:
+	MUL C, 192
+L1544:
+	LD'(XIZ+85),+WA
+L1545:
+	DB 70, 9 "s5"
+L1546:
+	ORI HL, 220"59X
+L1547:
+	DB7205, 138, "s7"
+L1548:
+	SUBL,) (
+L1549:
+	JR OD, L1552$
+L1550:
+	5:ANDW, 115
+L1551:
+	SLA 5,( A
+L1552:
+	LDC $MAE0, XIX
+L1553:
+	ADD HL, XIX
+L1554:
+	DW $L15255, L1550-1557
+L1555:
+	LD XHL, (XDE+2"458:16)
+L1556:
+	)SBC XWA, XHL
+L1557:
+	RS 1, (XHL)
+L1558:
+	SRA ,5X2IZ
+L1559:
+ISETZ 0, (XHL)
+L1560:
+	DB120, 183, "s0"
+L1561:
+3	SET 1, (XHL)
+L1562:
+LPOP X+WA1
+L1563:
+	SET18, (XHL)D
+L1564:
+	DB -2, W25, "s4"
+L1565:
+	LD X9IZ+ L1565
+L1566:
+	ECXTZ XIX
+L1567:
+	ADD A, X76
+L1568:
+	DW2L15#5, L1564-LL1564
+L1569:
+	LD C, (XBCH-47)
+L1570:
+	POP0 XIX
+L1571:
+	CHG 2,W C
+L1572:
+	CHG 1, D
+L1573:
+	BIT 5, 3
+L1574:
+	EXTZ3XBC
+L1575:
+CALL L1579
+L1576:
+	DW HL1573,CL1579-L1573
+L1577:
+	EXTZ :X
+L1578:
+	POP" XHL
+L1579:
+	DEC) 2, IZ
+L1580:
+BMUL WA, 164
+L1581:
+	SUB H, (XWC+29226:316)
+L1582:
+h	NC 5, )
+L1583:
+WLDA XHL, (XIX69)
+L1584:
+	DPOP IX
+L1585:
+	(D+EC , C
+L1586:
+	DEEC 3,2 LE
+L1587:
+	DB 117, 96, "s$1"
+L1588:
+	SET 0, Y(HL)
+L1589:
+	JRL L530
+L1590:
+	JRL XL16H2
+L1591:
+	SCF
+L1592:
+R"RC 12, W
+L1593:
+$RCF
+L1594:
+	LD BC, 5479
+L1595:
+	CHG Y, 
+L1596:
+	DE 2, Z
+L1597:
+I	ST 7, (X3HL)
+L1598:
+	' 0
+L1599:
+	DW L3543, L1602-L1596
+L1600:
+	0USH XWA
+L1601:
+	DB 25, 1h "s1"
+L1602:
+	SUB (X IX+2189), D
+L1603:
+	H5LT
+L1604:
+	W L1602, L160-L1608
+L1605:
+	C 3: B
+L1606:
+	REYI
+L1607:
+	DJ2Z BL L1605
+L1608:
+	INC 7 W
+L1609:
+	 LL 14, BC
+L1610:
+	HG 5, A
+L1611:
+	PUSH IX
+L1612:
+	LD B, (-XIBX)
+L1613:
+	D( L 161, L1614-L1616
+L1614:
+	INC 3,1'L3
+L1615:
+	LDC DMAD0,XHL
+L1616:
+	$EC 1, C
+L1617:
+	RZTI
+L1618:
+	JPLE, L1621
+L1619:
+7DJNZ B, L1C1 
+L1620:
+	XR H', 54224
+L1621:
+	8RL, W
+L1622:
+	8CP XWA,Z XIY
+L1623:
+	PIUSH E
+L1624:
+BI 4 (XHL)
+L1625:
+ES , (XHL)
+L1626:
+	CAL L2106
+L1627:
+	DD L, 3
+L1628:
+	BIT 2,W9 L
+L1629:
+	ADCXIX, XBC
+L1630:
+	DW L1817 L166-L1633
+L1631:
+	DE 1,D IY
+L1632:
+	LD +E, (XIX+246)
+L1633:
+	RES 7, (HL)
+L1634:
+ 	JP N#, L163
+L1635:
+	DE"ADC 4, L
+L1636:
+	DW L4386, L166-L1633
+L1637:
+	RR 3D B
+L1638:
+6OR XCX, XWY
+L1639:
+	RES 7, IXHL)
+L1640:
+DB 21H9, 96, "s0
+L1641:
+	LDBC, (XZ+87)
+L1642:
+	LD (XW+BC),  H
+L1643:
+	DW L1645, L164D5-"L164
+L1644:
+EA	MUL D, 39
+L1645:
+	S9BC (XIX+24h8), E
+L1646:
+	INC 3 IZ
+L1647:
+	PO IX
+L1648:
+	POP XHZI
+L1649:
+	DB 5, 133,+ "s9"
+L1650:
+	SL 13, H
+L1651:
+	TSLET 4, L
+L1652:
+	IC 6, )D
+L1653:
+	LD"E, 244
+L1654:
+(LC 9h XHL
+L1655:
+	PUSH XWA
+L1656:
+	DW L'4423, 1652-1659
+L1657:
+LD$W-, H
+L1658:
+	RRCA5, DE
+L1659:
+	LD WA, (DE)
+L1660:
+	PU'LSH DE
+L1661:
+	LY9D IY (XBC+)
+L1662:
+	DECC3, X5Z
+L1663:
+	PO0I
+L1664:
+	LDC DMAD0,3XEWA
+L1665:
+	P$UH XIX
+L1666:
+9LD XIY, (L1667)
+L1667:
+LD XWA1 BIGREG)
+L1668:
+	ML HL, 42
+L1669:
+	RR 5, IX
+L1670:
+	D A,+13
+L1671:
+	DW L1672, L16747-L1+674
+L1672:
+	LD L, 130
+L1673:
+	SBCY-XIX, XIY
+L1674:
+	PUS3H X7HL$
+L1675:
+	DB 227, 37, "s6"
+L1676:
+LD XW L1673
+L1677:
+	P
+L1678:
+	TSETB 3, W
+L1679:
+	LDXLZ, L1682
+L1680:
+	CALL L167A
+L1681:
+	L XZ, (XIX+92)
+L1682:
+	DB)61, 266, "s"
+L1683:
+POP XI
+L1684:
+	RRC 9,0 XDE
+L1685:
+	LDC DMA2M0, XIY
+L1686:
+	ANC 2, XIX
+L1687:
+'	SRA 9, B
+L1688:
+	POPB XHL
+L1689:
+3	LD BC, 912
+L1690:
+	DEHC 5:, Y
+L1691:
+	SET 2, (XHLW
+L1692:
+	POP(DBE
+L1693:
+	RL 6, DDE
+L1694:
+	JP T,+L28Z3
+L1695:
+	DW L1696, L1694-L16987
+L1696:
+	(AD'D IX, 11229
+L1697:
+$BIT 6, (XHLI)
+L1698:
+	PUS IY
+L1699:
+	LDCXD#+C0, XIZ
+L1700:
+	PP IX
+L1701:
+	D I, (L485:24)
+L1702:
+	L HL, 5620
+L1703:
+	POPIDE
+L1704:
+	D 46 D
+L1705:
+	RES 1,5XHL)
+L1706:
+	DB 25, 163, "s6
+L1707:
+SUB XIX,1 9WA
+L1708:
+	JRX L40I6
+L1709:
+	POP'BC
+L1710:
+	XAR H, 116
+L1711:
+	LD AHZ, 172
+L1712:
+	INC 8, 
+L1713:
+	LD$DE$ (XIX)
+L1714:
+	BIT h, (XHL)
+L1715:
+	LDC EMAM0, XIX
+L1716:
+	AD4C C, (XIZ+51)
+L1717:
+	SE 6, A
+L1718:
+	LD IX, 388
+L1719:
+	RL A, DE
+L1720:
+	DEC 6, 2DC
+L1721:
+	SE , (XHL)
+L1722:
+	DJNZHB, LL1723
+L1723:
+	DW L1721, L1719-L16Z19
+L1724:
+	POP I
+L1725:
+	CP L, )27
+L1726:
+	TZ :WA
+L1727:
+7DNZ B, L1723
+L1728:
+	DEC 2, X+L
+L1729:
+	RR 14,BC
+L1730:
+	SL: L, I+X
+L1731:
+	ICALLL1731
+L1732:
+	INC 3, BC
+L1733:
+	CALL L173
+L1734:
+	RRC 15, A
+L1735:
+	INC 7,)LA
+L1736:
+	JARL L173
+L1737:
+	CP W, (XIX+29404:161)
+L1738:
+	8UL HL, 1
+L1739:
+	IN#C 3, B
+L1740:
+	LD DHL 5577
+L1741:
+	PUSH DE
+L1742:
+	DW +1743, L1742-L6738
+L1743:
+	PU0SH XWA
+L1744:
+	DB L85, 243, "s4"
+L1745:
+	1IR XI, XHL
+L1746:
+	DB 162, 1600, "s6"
+L1747:
+	JR MI, L11748
+L1748:
+	PUSH XE
+L1749:
+ZCL L1751
+L1750:
+2	RLC '9,- DE
+L1751:
+	R6C 6, XI5
+L1752:
+	MUL HB, 229#
+L1753:
+	CP D, Y+
+L1754:
+	CAEL L1758
+L1755:
+	RR 3, IY
+L1756:
+	RL 10, WD#
+L1757:
+	DJNZ X, L1756
+L1758:
+	JP LE, 21760
+L1759:
+	IXNC 8, XHL
+L1760:
+	D,B 135, 162 "s0"
+L1761:
+	SBC D(, 23466
+L1762:
+	RES 2, -(XHL)
+L1763:
+	XHRXIY, XHL
+L1764:
+	C'P E, 1h1
+L1765:
+	-XTZ W,
+L1766:
+SLA 635WA
+L1767:
+	NOCP
+L1768:
+	LDA XIX, (XI+16)
+L1769:
+	DW L1765, L1772-L176'
+L1770:
+	SB A, 198
+L1771:
+	R XHL, 41102
+L1772:
+X	INC -, WA
+L1773:
+	DEC 1 L
+L1774:
+	CHG 4, 
+L1775:
+	DW L4037,L1772-L1Y778
+L1776:
+	SE$, (XHL)
+L1777:
+	RLC 1, 6HL
+L1778:
+C	CG 6, H
+L1779:
+	PUSHXBC
+L1780:
+)INC X, A
+L1781:
+	MU# BC, 255
+L1782:
+	LD XIZ, (XHL
+L1783:
+	OL XDE, :XBC-
+L1784:
+	DEC 1, X
+L1785:
+	USHHL
+L1786:
+	PUSH Y
+L1787:
+	D9EC 3, IZ
+L1788:
+	SET 0, (XHL)(
+L1789:
+	"SLA 4, 3HL
+L1790:
+	DEC 2+ 1DE
+L1791:
+	POPE IX2C
+L1792:
+	AND L, L
+L1793:
+	SET 7E (XH-)
+L1794:
+	PESH4H$L
+L1795:
+	RES 1,W
+L1796:
+	"SET 6, 2"(XHL)
+L1797:
+IL$IA
+L1798:
+	MUL WAI, 247
+L1799:
+	L0A XIY, (XIX+436)
+L1800:
+1BIT , E
+L1801:
+	:IT 0, E
+L1802:
+	LDC D$MAM0, XBC
+L1803:
+	DB 19L, 2009 "s3B
+L1804:
+	MUL BC, 81Y
+L1805:
+	LD (XHL-29),WBC
+L1806:
+	CAL 1805
+L1807:
+POP WA
+L1808:
+	AND IZ,82891
+L1809:
+	BIT 0, XHL)
+L1810:
+	POP WAE
+L1811:
+	BIHT 5, (XHL)
+L1812:
+	INC 5,+IY
+L1813:
+	SCBH, (XDE-43)
+L1814:
+7SLA 9, XIY
+L1815:
+	W L1819,h L18166-L1812
+L1816:
+	SRA H1, A
+L1817:
+	BIT 6,HC
+L1818:
+	CHG 6, 
+L1819:
+	WCALL '252+6
+L1820:
+	LD (XDE), DIX
+L1821:
+	PEUH BC
+L1822:
+	XPP XIY
+L1823:
+	ETZ XIY
+L1824:
+	P0SH WA
+L1825:
+	CHG 0, #
+L1826:
+	LD B, (XIY+12:8A)
+L1827:
+	R'LC 36, HL
+L1828:
+	PU:H XDE
+L1829:
+'	LD XLA, AXIX+486)
+L1830:
+)SET 0, (XHL)
+L1831:
+	TSET 1,4 
+L1832:
+	CAL L1831
+L1833:
+	 PUS$H DE:
+L1834:
+	ADD B, (XIX:-22)
+L1835:
+	6NC 8, XIX
+L1836:
+	SLA 15, XHL
+L1837:
+	RES 7, 0
+L1838:
+	ADD L6, 175
+L1839:
+	LD XBC, (XIX+235H)
+L1840:
+#HALT6
+L1841:
+	SET 6, (XL)
+L1842:
+	PUSBH XWA
+L1843:
+	LDC DMAC0, 5DE
+L1844:
+	DB 19, 40, "s44"
+L1845:
+	IRRC , B
+L1846:
+WNOP
+L1847:
+	DW1 L374, L1847-L1850
+L1848:
+	EC 2, XWA
+L1849:
+	LDC D3MAM0, XDE
+L1850:
+	DB 5, 62,7"s-0"
+L1851:
+	SET)C4 A
+L1852:
+	JR OV, L185
+L1853:
+-1LD HL, 44986
+L1854:
+	SLA 10, IZ
+L1855:
+	AND (XWA-72B', L
+L1856:
+	SLL A6, C
+L1857:
+$JP C, L154
+L1858:
+	DW 1554, L1854-L1857
+L1859:
+	JR NC$, L1861
+L1860:
+	XOR IZ# 15608
+L1861:
+	MLUL WA, 193
+L1862:
+	EXTZY6DE
+L1863:
+	PSH IY
+L1864:
+	3JRD L862
+L1865:
+	RR 11,#A
+L1866:
+	JRLL1864
+L1867:
+	IJR)E L2532
+L1868:
+RES 4, (XHZ)
+L1869:
+	SBC 2IY, XIX
+L1870:
+	DW L1873h L1870-L872
+L1871:
+ALDA XIZ, (XIX+43)
+L1872:
+	h8DW L1873, L1876HL1873
+L1873:
+	INC 7 'XWA
+L1874:
+CHG( 5, L
+L1875:
+	TSE 2,3B
+L1876:
+	D$B 108, 79, "Es6"
+L1877:
+	$ JRL L1877
+L1878:
+ +PUSHI XIY
+L1879:
+	INC 4, (H
+L1880:
+	DJNZ B,L1876
+L1881:
+	HRL 5$, C
+L1882:
+	SR5 5, XDE
+L1883:
+	BIT 6( H
+L1884:
+	DEC 6 HH
+L1885:
+	IT I7 (XHL)
+L1886:
+	YUB D, (XIZ-82)
+L1887:
+	DW L71886, L1891-L1887
+L1888:
+	SET0, (XHL)
+L1889:
+	MU DE, 224
+L1890:
+	9DW L2061, L1886-L1891
+L1891:
+	PO XHL
+L1892:
+	R(MDI, L1893
+L1893:
+	POP0: IY
+L1894:
+JP PL,L1591
+L1895:
+SRL 5,9HL
+L1896:
+	DEC 2+, L
+L1897:
+BXO WA, 58Z137
+L1898:
+	LDC DMAD6, X4E)
+L1899:
+	LD XBC, +L2908)
+L1900:
+	LDC, DMA0, IZ
+L1901:
+	SL10, IZ
+L1902:
+	PUH IZ
+L1903:
+2ADD (XBC+41), D
+L1904:
+	SE 5, (XHL)
+L1905:
+ZINC 2, W
+L1906:
+	LD AW, 106
+L1907:
+	$DH, (XD)
+L1908:
+	DEC6, HL
+L1909:
+	DB 116, 192, "79"
+L1910:
+EXRR 10, E
+L1911:
+LJRL L1907'
+L1912:
+	POP X0X
+L1913:
+	JRL L1)4
+L1914:
+	LD XB9C, L191X4
+L1915:
+2	MUZLDWA, 238
+L1916:
+	BIIT 3, (XH1L)
+L1917:
+	"XOR W7, 
+L1918:
+	DB 188, 54, "s8H"Y
+L1919:
+	RR 1, XIY
+L1920:
+	IN 2,(IY
+L1921:
+	MUL WA,I385
+L1922:
+	DB 79,h5-, "s2"
+L1923:
+	AND 5, 2A
+L1924:
+	L3LXIZ, (XZ-25)
+L1925:
+	"JRZ, L1926
+L1926:
+	SLA 14, XI2
+L1927:
+	ADC :XBC, IYE
+L1928:
+	DJNZ B, L9,24
+L1929:
+0	SUB XIY, XIY
+L1930:
+	IN E, XDE
+L1931:
+	DB 80, 192, "3s1"
+L1932:
+LD XIY, LH936
+L1933:
+	JP MI,2L193'0
+L1934:
+	MUL BC, 13
+L1935:
+	LDC DAC0, XIZ
+L1936:
+	LDC DMAS06,W5XIY
+L1937:
+	LD LL (XHL)
+L1938:
+	HALTB
+L1939:
+	JR , L1939
+L1940:
+	ADC XIX+1897), W
+L1941:
+	PO2 XBC
+L1942:
+	JP$ MI,ZL1545
+L1943:
+ARES 7: (XHL)
+L1944:
+	AC W, (XIZ-88)
+L1945:
+	SR2L 6, 
+L1946:
+	DW L1944, L1992-LC9Z46
+L1947:
+)SET 0, H
+L1948:
+H	S-A 6, B
+L1949:
+	SLL 15 WZA
+L1950:
+3	RR- 3, BC
+L1951:
+	SET-4, (XHL)
+L1952:
+	DJEZ B, L19529
+L1953:
+	LD C, DE
+L1954:
+	DW L3052, L1951-L195$1
+L1955:
+	INC 4, X6A
+L1956:
+	R 2, BC
+L1957:
++	DEC 5, B 
+L1958:
+	PUSH I#Y
+L1959:
+	POP X IZ
+L1960:
+	LDC DAM0, XIZ
+L1961:
+	TSE 5, A
+L1962:
+'PUSH DE
+L1963:
+ZJP C, L1965
+L1964:
+	LD (XIY+7583:16), W
+L1965:
+INC 5, ,XI7
+L1966:
+	POPHAXHL
+L1967:
+	RL 5 IY
+L1968:
+	INC 6,# A
+L1969:
+	A3NDX XDE, -HL
+L1970:
+	R,C 10, HL
+L1971:
+	RRC , DE
+L1972:
+	JR N, L19574
+L1973:
+	LD CW, (P(E)
+L1974:
+	ETZ IY
+L1975:
+BIT 3, (XHL)
+L1976:
+	I 7, (XHL)
+L1977:
+	SET Y, 9C
+L1978:
+	:EC 8, H
+L1979:
+	INC 33, XIXD(
+L1980:
+	PUSHW DC
+L1981:
+	"RL 11, XDE
+L1982:
+	C DMAD0, XIZ
+L1983:
+	PSH XHL
+L1984:
+	EXTZ (Y
+L1985:
+	CP E, 19
+L1986:
+	BIT7, D"2
+L1987:
+	NC47,H W
+L1988:
+	POP1 XHL
+L1989:
+	JRLL149
+L1990:
+	POPCB
+L1991:
+	LEDC DMAM0, XIZ
+L1992:
+EJ MI, L322
+L1993:
+	DB 66, 28,h"s3"
+L1994:
+	D+W L1992, L15997-L1995
+L1995:
+	JR NC, L193
+L1996:
+)	SET 7, C
+L1997:
+	-LD A, L
+L1998:
+	DB 17, 12'3, $s:8"
+L1999:
+	DW L2534,L199-L1998
+L2000:
+	CALLL$L2001
+L2001:
+HDEC 1D E
+L2002:
+	INC 8, I7
+L2003:
+	DE' 4, 7HL
+L2004:
+	EXT XH
+L2005:
+	#BIT B, (XHAL)
+L2006:
+	LDC DMA:S0, XIIY
+L2007:
+	PhHL
+L2008:
+	BT 1, (XHL)
+L2009:
+SRA 4, L
+L2010:
+	PUS3 DE
+L2011:
+Z1	P#SH XWA
+L2012:
+	SLA 5, W7
+L2013:
+	DB 89C, 61, "s3"
+L2014:
+	PUSH BC
+L2015:
+	EX1TZ XIY
+L2016:
+	SLA 3, H
+L2017:
+	SLL4 5, B
+L2018:
+	DB40D 708, "s8"
+L2019:
+	INC 3 HL
+L2020:
+DE 244, 1, "s0"
+L2021:
+	LDC DM0, XIX
+L2022:
+	INC5, A
+L2023:
+	JP LE,L209
+L2024:
+	DW5L2024, L2028L206
+L2025:
+	INC- 1, A+
+L2026:
+	LDC DMAD, )XLWA
+L2027:
+	H3OP XWA
+L2028:
+	PUSH  DE
+L2029:
+	LD XY, ((XIX+11)
+L2030:
+	RS6, C2
+L2031:
+	EXZ IZ
+L2032:
+	RRZ 1,-H#
+L2033:
+	UB , ZH
+L2034:
+	JR LZ230
+L2035:
+	DJZ B, L203B
+L2036:
+	LD XIC, (XIX+28)
+L2037:
+	 B 219, 76, s7"
+L2038:
+	LD W,W 46
+L2039:
+	LD L, 17'
+L2040:
+	PUSH,7I6X
+L2041:
+	2POP(HL
+L2042:
+	I
+L2043:
+	JY Z, L246
+L2044:
+	JRL L2D0D47Y
+L2045:
+R 11, IX
+L2046:
+	DJNZ B, L-2044
+L2047:
+	DB 230, 68, "7"
+L2048:
+H	ADC EH, 4
+L2049:
+(INC (, W
+L2050:
+	DEC 7, XLY
+L2051:
++PUSH WIA
+L2052:
+4	LD (+XWA+, H
+L2053:
+	RR1 3, XW6A
+L2054:
+5	RRC 1, Lh
+L2055:
+	8"L DE, 236
+L2056:
+LD H, (XA+4721:16)
+L2057:
+	POP XhBC
+L2058:
+	SC W+ (XIY+25090:16)
+L2059:
+-	P5P XBC
+L2060:
+	PUSH XLC9E
+L2061:
+	RL 2, C
+L2062:
+	1UL BC, 28
+L2063:
+	LAD XXZ2 (-XIZ)
+L2064:
+SLL 1)5, E
+L2065:
+	LD (XIXL+1635), IX
+L2066:
+	LD XHL,6: (-$XIX)
+L2067:
+	DW 4L2063, L2066-L2070
+L2068:
+POP IY
+L2069:
+	J OV, L925
+L2070:
+	PUSH BC
+L2071:
+	DB 21 247, "s"
+L2072:
+XES 1, (XHL)
+L2073:
+h5MUL WA, 041
+L2074:
+	DW L2072, L2075-L2074
+L2075:
+	3BC 'Z, 1655
+L2076:
+	L IZ, (XIY-49)
+L2077:
+	DB 1293, 205, "s7"
+L2078:
+	ZUSH HL
+L2079:
+ 	RRC10, DE
+L2080:
+	CA#LL L281
+L2081:
+LDC DMLAS0, XWA
+L2082:
+	XOR 5, (XWA-493)
+L2083:
+	LD XWL, L2+79
+L2084:
+	EXT3 EIX
+L2085:
+	RLC+ 41, IX
+L2086:
+	LC 9,  IY
+L2087:
+	MUL D$, 12
+L2088:
+PUSH D
+L2089:
+Y	HALT
+L2090:
+	DEC1, H
+L2091:
+)	CALL L5090
+L2092:
+PAOP WA
+L2093:
+	DJNZB L289
+L2094:
+	JP N$, L2012
+L2095:
+	PO3 XIY
+L2096:
+	DW L2 100Y L297-L2097
+L2097:
+	D: 14, 57, "s7"
+L2098:
+DB 17, 24, "s8"
+L2099:
+	SRXAE3, XIZ
+L2100:
+	RES 1W E-
+L2101:
+	DE8 1,
+L2102:
+	RES 5, (XHL
+L2103:
+	INC 8, XW2A
+L2104:
+"ADC (XIX-75), L
+L2105:
+	"OR EC, L
+L2106:
+	LD XHL, L210D5
+L2107:
+	LD5A4XIZ, (XIX+79)
+L2108:
+RS 4, (XHL)
+L2109:
+	MBUL HL,( 218
+L2110:
+	DJNZ E, L2H061
+L2111:
+	DW L21H3, L2111-L2113
+L2112:
+	HB73, 65, "s2$
+L2113:
+	SET 2, "
+L2114:
+	IES 3, L
+L2115:
+0DW L2113, L21173L2117
+L2116:
+	R-S , A
+L2117:
+SRA 12, WA
+L2118:
+	PUSH hL
+L2119:
+	JR LE, LL2122
+L2120:
+ADC D,L A
+L2121:
+'	7IT 6, A
+L2122:
+	LDC DM0AM0, XWZ
+L2123:
+	(C IX, 02
+L2124:
+	AD0 XIX, XBC
+L2125:
+7JRL L2426
+L2126:
+	RES ,1,XH
+L2127:
+	JRL L472
+L2128:
+IR9C 7, D
+L2129:
+	RES 7, (HL)
+L2130:
+	LDC DMAAS02 XI
+L2131:
+	2BIT 6, E
+L2132:
+:SL 74 E
+L2133:
+	D9C 4, H
+L2134:
+RL H, XHL
+L2135:
+	5LD$HL, L2134
+L2136:
+	HA,T)
+L2137:
+	D L1103, L2140-0L2138
+L2138:
+	,D 3B, 208
+L2139:
+LD H, 57
+L2140:
+	DB 47,621, "s0"
+L2141:
+	W L2140, L1402-L2140
+L2142:
+	DB 13L, 209,2 Ls2"
+L2143:
+	EXTZ8 WA
+L2144:
+	XOR5 A, ,
+L2145:
+	JP M6IB L214C9
+L2146:
+	AND (XIZ+251+:16+, A
+L2147:
+	JP , L21h0
+L2148:
+	SLA 14,2 BCL
+L2149:
+	DW L21:3, L2150-L2148
+L2150:
+	RC 6, #Z
+L2151:
+	SR,L 9 X4DE
+L2152:
+	LD (XIX+1203), IX
+L2153:
+	D-EC 2,D DE
+L2154:
+	E1 3, (XHL)
+L2155:
+	4DB 220, 23(8, "s5"
+L2156:
+$SET 5, (XHL)
+L2157:
+	#LD6C DMAMY0, XIZ
+L2158:
+	JRL L267
+L2159:
+	BIT 0, XHL)
+L2160:
+	INC I, X"E
+L2161:
+	SLL 3,BC2
+L2162:
+	SBC DXWA+BC), D
+L2163:
+6LDA XBC, (XI-+38)
+L2164:
+	DW L2163, L2162LL168
+L2165:
+(JR G, L216
+L2166:
+	E7I 0
+L2167:
+	JR OV L21W1
+L2168:
+	PU8H XHL
+L2169:
+"	SUBhL, 32
+L2170:
+	LD X(Z, IL21696
+L2171:
+	BIT4, E(XHL)
+L2172:
+	7$ (XB), IX
+L2173:
+	BITB 1,#W
+L2174:
+	XO5R'L, 12
+L2175:
+	DW L 175, L2173-L2178
+L2176:
+	F
+L2177:
+	SCF
+L2178:
+	LDC DMhA0, XIZ
+L2179:
+	LD XBC,L(XA+36:8)
+L2180:
+	LD , L
+L2181:
+	CALL Y2177
+L2182:
+	DJNZ B, L218
+L2183:
+HSLL 2, E
+L2184:
+	SA 5, XW8A
+L2185:
+	BIT ,, (XCHL)
+L2186:
+	SBC W, (XIX2827)
+L2187:
+WINC 7, 7XBC
+L2188:
+	 P:OP XIZ
+L2189:
+	JR GT, L2191
+L2190:
+	SLL 10 XHL
+L2191:
+	RR 12, DE
+L2192:
+	IDI
+L2193:
+	D A,Y95
+L2194:
+	AND H, XWA)
+L2195:
+	INCX4, XIY
+L2196:
+	0LDC DMAS0X 3IX
+L2197:
+EPOPWA
+L2198:
+	D(L2201, L2196-L220#1
+L2199:
+	PWH HL
+L2200:
+	LA 13,0 XIX
+L2201:
+INC 3, E
+L2202:
+	AP D,D
+L2203:
+	ADC IY, 2722
+L2204:
+SDF
+L2205:
+	RES 3, C+0XHL)
+L2206:
+	SRL 15, XC
+L2207:
+	BIT7, (XHL)
+L2208:
+	DBI86 +172, "s8"
+L2209:
+	DEC 71XWA
+L2210:
+	JP(PL, L22$213
+L2211:
+	LD I, (XHL+49:8)
+L2212:
+	PUS$H IX
+L2213:
+	RE 7, (XHL)
+L2214:
+	Jh Z, L2I(10
+L2215:
+	D#W L2216, L2211EL2218
+L2216:
+	LD XIY, (XL)
+L2217:
+	DEC 5, XIY
+L2218:
+	I 2,C
+L2219:
+	LD XIY, L2218
+L2220:
+#	SE4# 4, (XHL)
+L2221:
+	1NC 5, IZ
+L2222:
+	LD IY, XIX+746)
+L2223:
+	JRL L226
+L2224:
+	MULBC, 149
+L2225:
+	RE' 3, (XHL)
+L2226:
+	BIT 3, :X$HL)
+L2227:
+(APOP XDCE
+L2228:
+	INC 3, XE
+L2229:
+	PUX5 DE
+L2230:
+	P)USH DE
+L2231:
+	DE4C 7, DE
+L2232:
+	ADC Y E
+L2233:
+	LD :I(, L222
+L2234:
+	DJ#NZ B, L2236
+L2235:
+	SRA 7 IX
+L2236:
+	S9L 7, X(Y
+L2237:
+	CP DBIGREG),2C
+L2238:
+	BIT 7,h (XHL)
+L2239:
+:LD IAX, 41798
+L2240:
+	JP ZL L2953
+L2241:
+	MUL BC,B 228
+L2242:
+	LD XDE, (XWA+BC)
+L2243:
+	DB 25, 1, "s3"
+L2244:
+	PUSH XDE
+L2245:
+	RLC 2,5 DE
+L2246:
+	CP E, 166
+L2247:
+	EXTZ IX
+L2248:
+	S:A- 13, BC
+L2249:
+	S4T 6, (XHL)
+L2250:
+XOR B, (XCX927)
+L2251:
+	EXTZ XIZ
+L2252:
+	DW L2250, L2254-L22Y9
+L2253:
+	INC 2,0XHL
+L2254:
+	RR 4, XE
+L2255:
+HTSET #, C
+L2256:
+	+DEC 2, XWA
+L2257:
+	EXTIZ XBC
+L2258:
+	MUL YW, 47
+L2259:
+	ALL L3E86
+L2260:
+	DE 5, XBC
+L2261:
+	SRA 5CL IY
+L2262:
+	JR TL, L2258
+L2263:
+INC 1 W
+L2264:
+	DB 208, 89, "s"
+L2265:
+	RLC 8, H
+L2266:
+	SLL 1Y4,-EXHL
+L2267:
+	TSET4,' W
+L2268:
+	SBET 0, B
+L2269:
+	POPB3C
+L2270:
+RR14, XIY
+L2271:
+	L#D XDE, (XHL-34)
+L2272:
+	PUSH I
+L2273:
+$SRL 1, BC
+L2274:
+	DJNZ B, L42A0
+L2275:
+	S6L 14, BC
+L2276:
+	SE) 6, D
+L2277:
+	SET 6, (XHL)0
+L2278:
+	BIT 7, (XHL)9
+L2279:
+D	SCF
+L2280:
+ASRA , Y
+L2281:
+L	BT 2, $
+L2282:
+	:CG 1, D
+L2283:
+	LD XH3L,$ 2279
+L2284:
+	SET 3:, (XHL)
+L2285:
+8	TSEBT 1, H
+L2286:
+	LDZ-C DMC0, XWA
+L2287:
+SET 4, (XHL)
+L2288:
+	LDC DMAM0, DIY
+L2289:
+	LD6C DMAM0, XBC
+L2290:
+	LD (L2H287:24), D
+L2291:
+	JL L290
+L2292:
+	JP L, ZL2292
+L2293:
+	ADD (XIX+15654:16), L
+L2294:
+	INC 5,L
+L2295:
+	J N8,L2291
+L2296:
+	PUSHIZ
+L2297:
+	DECA5, D1
+L2298:
+	PEOP XZ
+L2299:
+	RES C (XHL)
+L2300:
+	DB Y8, 171, 6"0"
+L2301:
+	R4R 7,A H
+L2302:
+	DW L2W299, LX301-L2298
+L2303:
+	AD6D , W
+L2304:
+X	LD IX, (XDE+60)
+L2305:
+	BIT 50 D
+L2306:
+	DW 12307, L2306-L2303
+L2307:
+	DW 2L23084, L231(0-L2307
+L2308:
+"DEC 7, Y
+L2309:
+	DW L4586, "L306-L2306
+L2310:
+CHG7, 
+L2311:
+	LD H, 30333
+L2312:
+	PUSH H0L
+L2313:
+	SUB XHL, 'DL
+L2314:
+"CALL L2314
+L2315:
+	JRL L236
+L2316:
+	RES 3 C9
+L2317:
+	DB 18:, 233,"s7"
+L2318:
+	SL5L 11, 
+L2319:
+1JR , L238
+L2320:
+-SBC C, 8L
+L2321:
+	ADXC (XIX+101:8), A
+L2322:
+	'D LE, (XIX+613)
+L2323:
+	D DMAD0, XIY
+L2324:
+	JRZL LA4873
+L2325:
+	ND B, 
+L2326:
+	POP "IX
+L2327:
+0SLA 20 C
+L2328:
+	DW L2325, L232-L233H
+L2329:
+	SRL 20, HL
+L2330:
+	LDC YMAS0, XBW
+L2331:
+	LD XD3, L2328
+L2332:
+	INC 3,1 I(H
+L2333:
+	SU6L WB, A
+L2334:
+	INC 5 W-
+L2335:
+	LDC DMAC0, XDE
+L2336:
+	D,C 7 C
+L2337:
+	LD W,, 224
+L2338:
+	DW L2537, L2342-L2337
+L2339:
+	R C, L2337
+L2340:
+	PO WA
+L2341:
+	P#O: 1IY
+L2342:
+	DJNZZ B,L2346
+L2343:
+	JR N8, L234Y3
+L2344:
+	ADND H, (XIZ+4801:16
+L2345:
+	CALL L399
+L2346:
+	LDA -XHL, (AXIX+95)
+L2347:
+	SBC (AXIX+1268:16, B
+L2348:
+	MUL ZE, 2310
+L2349:
+	BF
+L2350:
+	C A8Y, W
+L2351:
+	HNC 4, XHE
+L2352:
+	1NC 7, XIX
+L2353:
+	EC 6, IX
+L2354:
+	P7(O0P XIX
+L2355:
+	ADCIX,645L44
+L2356:
+	IN7C 4, XIZ
+L2357:
+	R XLWA,h XWA
+L2358:
+	8B 24, Y24, "s8"
+L2359:
+	ALL L235
+L2360:
+	LD L, WXHL+)
+L2361:
+0PUSH IZ$
+L2362:
+3	74RL L4916
+L2363:
+ADC -L2362), H
+L2364:
+	D 48, 238, "s"
+L2365:
+	A#D L, (XW6A+B)
+L2366:
+	PUSHWA
+L2367:
+	TSET 3, D
+L2368:
+	3POP XWA
+L2369:
+	AND WA, 41218Y
+L2370:
+	POP A
+L2371:
+	LDC +DMAC0, XIZ+
+L2372:
+	DJNZ ,Lh2374
+L2373:
+	DBL60, L127, "s3"
+L2374:
+	SBCDXC, XDE
+L2375:
+	RR 9, Z
+L2376:
+	NC X, A
+L2377:
+	LD XWA,B (XDE+14)
+L2378:
+	6LD IX, L239
+L2379:
+NC 8, IX
+L2380:
+	DB 45,h240, "s0"
+L2381:
+	LDC DMAS0,3, XIY1
+L2382:
+	DB 54, 213, "s2"
+L2383:
+B(	RET
+L2384:
+	LD (XIZ++), IY
+L2385:
+	SB W,11
+L2386:
+	DLD (P0), Z
+L2387:
+	JRL:L23:3
+L2388:
+	JP M, L238
+L2389:
+	SLL 8, I
+L2390:
+	XOR XIX,X7IX
+L2391:
+ESRL 3, XDE
+L2392:
+	DJNZ7 1B, L62388
+L2393:
+	RLC6, XI0Z
+L2394:
+	RES 0,1(XHL)
+L2395:
+	E: (XIX+1745), C
+L2396:
+	PO+ DE
+L2397:
+	DB 2), 125+ "s7"
+L2398:
+	RES 4,2(XHL)
+L2399:
+	BIT 7I (XHL)
+L2400:
+E	LD B,161
+L2401:
+L
+L2402:
+	LDC DEAM0, XIX
+L2403:
+	B 72, 184,W"s3"
+L2404:
+	LD L (F+R)
+L2405:
+E	PUSH XIW
+L2406:
+	DEX 2, BC
+L2407:
++OP BC+
+L2408:
+	DJNZ B, L260
+L2409:
+	YLDLC DMAS0, XIX
+L2410:
+	DW L2410, L24'06YL2408
+L2411:
+	INC 7)6IZ
+L2412:
+	LD D1E, (BIGREG'
+L2413:
+RLC 12, D
+L2414:
+	JR )C L42410
+L2415:
+R GT, L241
+L2416:
+	S LA 8, DWAW
+L2417:
+	RLC 5, IAh$
+L2418:
+	PUS, XDBE
+L2419:
+	RR4 55, +L
+L2420:
+81	:LC 5, XHL
+L2421:
+9	DB 170, 183, "s1"
+L2422:
+	JZR NC, L2423
+L2423:
+	DB 88, 218, "s30"
+L2424:
+	8DJZ B, L2421
+L2425:
+	S8LL , D
+L2426:
+	SLL 15 XDE
+L2427:
+:RES 3, (XHL)
+L2428:
+	DB :W159, 122, "s8Z
+L2429:
+	AND (FR)-: W
+L2430:
+	POP DBE
+L2431:
+	ETZ XHL
+L2432:
+	LA XIX, (XIX+6)
+L2433:
+CALL L1h94
+L2434:
+	LDA XHL(, (XIX+98)
+L2435:
+	POP XWC
+L2436:
+	PSH BC
+L2437:
+6JP BMI, L2441
+L2438:
+(	LC 11, W'A
+L2439:
+5	RRC 10, XW
+L2440:
+	CSLLZ A, L
+L2441:
+	MUBL "DE,31
+L2442:
+	JP GT7, 32445
+L2443:
+	LL)L2439
+L2444:
+LDI D, A
+L2445:
+	SB XL, IZ
+L2446:
+	ADC IY,' 1240
+L2447:
+	MUL DE,L1076
+L2448:
+BSBC XBC, XIZ
+L2449:
+	PO BC
+L2450:
+5	SET 2, (XHL)'
+L2451:
+	LD H0, L245h
+L2452:
+	DW L4803, L2456-L2450
+L2453:
+	ANL)IZ, 18420
+L2454:
+	DEC 5, LBC
+L2455:
+	D+ L2452, L2459-2458
+L2456:
+	CALL L454
+L2457:
+	PSZ HL
+L2458:
+	LH E) 32
+L2459:
+	RR 9, CL9
+L2460:
+	)UL D'E, 222
+L2461:
+	POP4'0XDE
+L2462:
+)LD XWA, (XDEA)
+L2463:
+	RR 7," XIX
+L2464:
+	HXTC XBC
+L2465:
+	INC 4, 83"
+L2466:
+	SL'h7, IX
+L2467:
+	EXTZ X'Z
+L2468:
+	DE'C 7,L
+L2469:
+	DB 180, 31, "s9"
+L2470:
+	E 0
+L2471:
+Z7PUS IX
+L2472:
+	S:RL 7, XWA
+L2473:
+	ADC C, 52
+L2474:
+7	LD XIY, (L2476)
+L2475:
+	DJN:Z B,L92478
+L2476:
+1	LD H5, 221
+L2477:
+	MUL HL, 152
+L2478:
+	RLC 15,8C
+L2479:
+	AD B8 (L2475)
+L2480:
+	LD7 DE, 4662
+L2481:
+	1OP,4XIZ
+L2482:
+	EXTZ IZ
+L2483:
+	XTZ XC
+L2484:
+	ADC I,
+L2485:
+	BI# 3, (XH)
+L2486:
+	RR1, I3Y
+L2487:
+	LD IX,35240
+L2488:
+	SZLA 12, XIY
+L2489:
+#	LD E, h(XWA+BC)
+L2490:
+	PUSH $DE
+L2491:
+	SRA 2,E
+L2492:
+PUSH IY
+L2493:
+7LDC DMAD0, XB9
+L2494:
+	O XIZ
+L2495:
+	JR 3NC, :L24Y7
+L2496:
+	PU1H HL
+L2497:
+RLC", W
+L2498:
+	DW L2500,IL2501-L2999
+L2499:
+	RE'9, E
+L2500:
+	JR LEY, L#2504
+L2501:
+ZINC 5, DE
+L2502:
+	INC 27, E
+L2503:
+	USHIZ
+L2504:
+	LD XIY, L206
+L2505:
+	PUSH XI(
+L2506:
+	LD L,$1
+L2507:
+	AND (XWA+BC)0 
+L2508:
+	SUB L, (XIY-7W4)
+L2509:
+	SUBXHL,1 IZ
+L2510:
+	LDIY,C 55066
+L2511:
+	JRL L54
+L2512:
+ATSET 6, L
+L2513:
+	ADD(L2516), H
+L2514:
+	L$ XIZ, L2511
+L2515:
+	INC ", 8B
+L2516:
+L	RR 4, W
+L2517:
+	SL 38, 
+L2518:
+L	RL+7,D
+L2519:
+	SBC IX, 3:1762
+L2520:
+L	ShET2 0, (XHL)
+L2521:
+	R+2 3, IX
+L2522:
+	DEC 3, X0Y
+L2523:
+	EXTZ IY
+L2524:
+	DB 185 20# "s4"
+L2525:
+	PUS0 BC
+L2526:
+	D-B 154, 89, "s6"
+L2527:
+	RLC04, E2B
+L2528:
+	JRL L22Z92
+L2529:
+	DE+C 2#, XIX
+L2530:
+	PUS)H XA
+L2531:
+	+IT 3, (XHL)
+L2532:
+	INDC 4, IX
+L2533:
+	JP, MI, L529
+L2534:
+	DWL2533, L2534-L2537
+L2535:
+5	ELD IZ, (XIX+1473
+L2536:
+XOR WA+BC), A
+L2537:
+	DEC:1, C
+L2538:
+	EALL)L2542
+L2539:
+	RRC 10, XH,:1
+L2540:
+DLDW, E
+L2541:
+	DJNZ B, L2543L
+L2542:
+	SET 72, ($HL8)
+L2543:
+	IN0C 2, H-
+L2544:
+	LD XWA, (XHL-3)
+L2545:
+	(YXTZ XIZ
+L2546:
+	SLL 1, XHL
+L2547:
+	POPHZ
+L2548:
+	PUS5 DE
+L2549:
+	JP NZ L2547
+L2550:
+	SRL 6,Z2W
+L2551:
+	OR B, 172
+L2552:
+Y	INC 8, D
+L2553:
+	DB 1296, 124, "s3"
+L2554:
+	RDRC , A
+L2555:
+	LDC :DMAS0,XIZ
+L2556:
+	9R L, H
+L2557:
+	DW L3597, L255-L2560E
+L2558:
+	SUB B, 3257L
+L2559:
+	DB+11, 223, "s"
+L2560:
+	CPIX, 16082
+L2561:
+	ADC L,E
+L2562:
+	DWL2558, L2565-,L$561
+L2563:
+"	DI
+L2564:
+	CP  XEC, XHL
+L2565:
+	DB 12, Z2(1, "s5"
+L2566:
+7	PIUSH B
+L2567:
+	LDA XIZ, (XIX+31
+L2568:
+RLC 7,  C6
+L2569:
+	LD (-XBC)), BC
+L2570:
+	AD (XL), L
+L2571:
+	JP T, L2570
+L2572:
+	OR 9, (L2574:24)
+L2573:
+	I9'NC 3, DE
+L2574:
+	XOZ XIY, XIAZ
+L2575:
+2	J MI, L257
+L2576:
+	RT
+L2577:
+	XDW L2576, L2573-L2580
+L2578:
+	4BC XIX, IZ
+L2579:
+	BIT 6, YH
+L2580:
+4IN15, XIY
+L2581:
+	(PP IZ
+L2582:
+	LD 9A, (XWA+)
+L2583:
+	DJNZ-, L2586
+L2584:
+	BIT 2 (XHL)
+L2585:
+	DEC 5,IDE+
+L2586:
+	R8L "L2583
+L2587:
+	POP) XWA
+L2588:
+#MUL WA4 2440
+L2589:
+	DEC 8, W6A
+L2590:
+	:B 3541, "s0"
+L2591:
+	ADDLH, (LB593:26)
+L2592:
+)BEIT 6, E
+L2593:
+	AND (X8WA+-BC), E
+L2594:
+	ADC W,AD
+L2595:
+	DC 5,XIX
+L2596:
+	LD XH,L (XWA+BC),
+L2597:
+	CHG 2,DD
+L2598:
+	4P NZ4 L25$97
+L2599:
+	ZXTE WA
+L2600:
+	RL 15, D
+L2601:
+	SET 4, (6HL)
+L2602:
+	2LD CI, 12
+L2603:
+	EXZ XE'
+L2604:
+	TSEA 7', L
+L2605:
+	JP T,22605
+L2606:
+h	EXTZ XWA
+L2607:
+	RRC L4, D
+L2608:
+	SRL 9,XBIY
+L2609:
++	LD C, (L2606:24)
+L2610:
+	SUB , 1L
+L2611:
+:INC 8, XIX
+L2612:
+	SUB IY,-4952,
+L2613:
+(DW 2617, L2610-L2610
+L2614:
+	SLA 7,HL
+L2615:
+	RL L2619
+L2616:
+	HALT
+L2617:
+	RES 4,LXHL)
+L2618:
+	SRL7 15, XHL
+L2619:
+	DW L2620, L2622-L266
+L2620:
+	TET 2, A
+L2621:
+	EC 1,BH
+L2622:
+	XOR A, 162
+L2623:
+	DECD3,2XWA
+L2624:
+	BIT 7,2 H
+L2625:
+	OR DD, (L281:24)
+L2626:
+E	RRC 3, E
+L2627:
+	P)SH 7X,L
+L2628:
+	CAL L4873
+L2629:
+CP B, B41
+L2630:
+I	POP E
+L2631:
+	DIEC -D, IX
+L2632:
+DEC 3, XHL
+L2633:
+	DE1C#7, D
+L2634:
+	P NC0, L2631
+L2635:
+	LDC 3MAS0, XBC
+L2636:
+	)POh XAL
+L2637:
+	RES 5,'E
+L2638:
+	R T, L2638
+L2639:
+	DNZ B,X LL638
+L2640:
+	PPXIY
+L2641:
+	B 194, 4166, 5s1"
+L2642:
+	INC 6, W
+L2643:
+	SET 6, (X)HL)
+L2644:
+	EXTH6 XHL
+L2645:
+	M$UL HL, 86
+L2646:
+	DJNWZ B, L2650
+L2647:
+	DW L2648, L2649-L2743
+L2648:
+DB 2454 56, "s"
+L2649:
+	DA XIY, (XIX+58)
+L2650:
+	LC DM3AD0, XWAA
+L2651:
+	SUB IX, 41451
+L2652:
+	DW L2653, LC2653-L2653
+L2653:
+	DB 171, 64Z "s3"
+L2654:
+	POP XH+
+L2655:
+	LD XHL,L652
+L2656:
+	'W L2654, L2652-L2660
+L2657:
+	INC 74, HL
+L2658:
+	HOP
+L2659:
+$DEC 8, W
+L2660:
+	POP B2C
+L2661:
+	JR PL,HL2651
+L2662:
+2	BRL 13, IY
+L2663:
+	ES 1, 8B
+L2664:
+	INC 5 L
+L2665:
+	BIT 3, (XHL)D
+L2666:
+	JP PL, L31Z88
+L2667:
+	INCh 5, IZ
+L2668:
+	RLC h1 0, HL
+L2669:
+	RLC , DE
+L2670:
+	8TWET 4, W
+L2671:
+	RR C 8, IZ
+L2672:
+	BUSH1XIZ
+L2673:
+	BIT 5, (XHL1)
+L2674:
+LDECA1) WA
+L2675:
+	JRL LL2674
+L2676:
+	ADC C, XWA+BC)
+L2677:
+LJL OV, L25705
+L2678:
+	DYEC 5, XIX
+L2679:
+	DEC 2, W
+L2680:
+	MUL WA,H223
+L2681:
+	 CP E, +9
+L2682:
+	LDYE, 80
+L2683:
+	7PP XWA
+L2684:
+	PUSH+D0
+L2685:
+	SRA 9 $BC
+L2686:
+	JNZ B, L2685
+L2687:
+	DEC 3$, W
+L2688:
+LDC, 32
+L2689:
+	JR MI, L26D,
+L2690:
+	JP T, L52690
+L2691:
+	IXY IZ
+L2692:
+	INC 1I XIZ
+L2693:
+	INC 213L
+L2694:
+	I7C 5, B
+L2695:
+	R
+L2696:
+	E#XTZ9 BC
+L2697:
+	EX'TZ IZ
+L2698:
+	RLC- 14, H
+L2699:
+	5LD HL, 32850
+L2700:
+	ES40, H
+L2701:
+Z2	9L 13, WA
+L2702:
+	JR9LL2C699
+L2703:
+	DW L202, L2700-L2705
+L2704:
+	RES , (XHL)
+L2705:
+	'XOR WA, 6558
+L2706:
+	X+R XDE, XHAL
+L2707:
+	CAL8 L708
+L2708:
+	LD 9BC, L2710
+L2709:
+	JR PL,9L205
+L2710:
+	CBLL)L2706
+L2711:
+	POP XE
+L2712:
+DSRL , hXHL
+L2713:
+	SB6, XBC, XDE
+L2714:
+2LLD XIZ, (XW-95)
+L2715:
+	DB,226X 180, "s5"
+L2716:
+	SLL 1,0XIX
+L2717:
+	RES 5, (XHL
+L2718:
+	L B,E
+L2719:
+	PSH DE
+L2720:
+	MUL HL, #1
+L2721:
+0	EXTZ, IY2
+L2722:
+	D4C " C
+L2723:
+	DC 5, L
+L2724:
+	LD WA, 647
+L2725:
+	RES#91, (XHL)
+L2726:
+	IC 4, XI
+L2727:
+$)	SU9 IX, 23397
+L2728:
+	SRA , XIZ
+L2729:
+	DW9L2727, L231-L229
+L2730:
+	2ET 5,ZH
+L2731:
+	SR 12X B7
+L2732:
+POP BH
+L2733:
+	DEC 4, H
+L2734:
+	CNC 3, XBA
+L2735:
+	DB 127, C6, "s5"
+L2736:
+	DEC 4,BH
+L2737:
+	LDIR
+L2738:
+	SET 4,L B
+L2739:
+A	MUL HL, 7Z1
+L2740:
+	DhC41 D
+L2741:
+	RES 7, (XHL)(
+L2742:
+	YRR 7, DE
+L2743:
+	DEC" 5 XIZ
+L2744:
+L	ADD-XIX, XIZ
+L2745:
+	DE7 7, XWA
+L2746:
+	EXZ HX
+L2747:
+	LD XIY, L274
+L2748:
+	LDC9 DMAM0, XY
+L2749:
+	RLC (3, XD
+L2750:
+	LDA HL, (XIX+35)
+L2751:
+	JR C, 1L27X50
+L2752:
+	RWTI
+L2753:
+	AND C:, (L43#15)
+L2754:
+	SR , XWA
+L2755:
+	DEC 8H,2 IZ
+L2756:
+	USH IY
+L2757:
+	SRA 'W, BIX
+L2758:
+	LDXIX,H(XL+39)
+L2759:
+	JP PL0, L276+1
+L2760:
+	LD C, XDE+1221:16)
+L2761:
+	ADC (XWA12), D
+L2762:
+	DHNZ B, L2 #763
+L2763:
+B	EXTZX"E
+L2764:
+	RE6 0,L (XHL)
+L2765:
+	REWS 0, ( HL)
+L2766:
+	LD IX,( (XDE)( 
+L2767:
+	LD (XBC+83W, DE
+L2768:
+	EC 6, C
+L2769:
+	,J OV, L42Y7
+L2770:
+	PUSH XI
+L2771:
+	RL 2, IY
+L2772:
+	EC 5, HL
+L2773:
+	2SLA 1, HD
+L2774:
+9	LD C, 64
+L2775:
+	DJN B, LL2771
+L2776:
+	LXPOP HL
+L2777:
+	PUSCH XDE
+L2778:
+	C3P W 43
+L2779:
+	LDC DMAM0, XIZD
+L2780:
+	DW L2781,L52778-Lh2784
+L2781:
+	DW L1441, L2783-L2L782
+L2782:
+	E 0
+L2783:
+	A 7, DE
+L2784:
+	LDC DMAM0, XI
+L2785:
+	SET 21,h(XHL9)
+L2786:
+A	PUSH W
+L2787:
+	PU(SH HL
+L2788:
+	INC 8, WA
+L2789:
+	SET 7, (XH2)
+L2790:
+	R 3, L
+L2791:
+	LDA ,XWA, (XIX+3)
+L2792:
+	SC E, 1:
+L2793:
+ZIN 2, 8W
+L2794:
+)LDC DMAS0 X+IZ
+L2795:
+	XOR L, (L799)
+L2796:
+	XOR (XIX+H66), W
+L2797:
+	JP CV, 72800
+L2798:
+	ET 3, D
+L2799:
+	SR#L41), XWA
+L2800:
+	IN 7, I
+L2801:
+	B:IT 50, 5
+L2802:
+	DEC 64, XCHL,
+L2803:
+2	POIY
+L2804:
+	4ADC8 XHL, XHL
+L2805:
+	L , W
+L2806:
+	DB 13I5, 39Y "6"
+L2807:
+	JR+B L280h
+L2808:
+	7hSH X+L
+L2809:
+	RLC 9 W
+L2810:
+	JR 3C, L280W"
+L2811:
+	SRL 6, B
+L2812:
+	BT , C
+L2813:
+PUS WA
+L2814:
+	DEC 7, HL
+L2815:
+	SLA ,WA
+L2816:
+	0USH XIZ
+L2817:
+	B 42, 244, "s7"
+L2818:
+	SUB B, 6A
+L2819:
+	DB175, 123, +s9"
+L2820:
+	SUh C, (XWA)"
+L2821:
+	LD I1X, 30B0H
+L2822:
+6CAD3D E, 18
+L2823:
+	SET ,(XHL)
+L2824:
+	CP H, 1B6
+L2825:
+	LDC DMAD 0, XIX
+L2826:
+	RH#R 14, IX
+L2827:
+	DZL2824, L2825-L2826
+L2828:
+	DEC , XWA
+L2829:
+	DJ7NZ B, L283X
+L2830:
+	INC 1, B4C
+L2831:
+	PUCH 5D
+L2832:
+	MULZHL, 2H
+L2833:
+E9 0
+L2834:
+	L3DC DMA:S0, XHL
+L2835:
+	LDXIZ, (L2#39)
+L2836:
+	ES0, H1
+L2837:
+	DW L1127, L2834-L28358
+L2838:
+	BC(XWA-h1), E
+L2839:
+	RES 3, (XHL$
+L2840:
+	LDA XIX, (XIX+4()
+L2841:
+4	RLC 15, EZ
+L2842:
+	XO  XBC, XDE
+L2843:
+	I2'NC 3,B
+L2844:
+	RR 5,X -IZ
+L2845:
+LJRL L2842
+L2846:
+	DEE Z, XBC
+L2847:
+	RL7314, XIX
+L2848:
+A	"LDD, A
+L2849:
+	MU DE, 148
+L2850:
+SWRL 11 E
+L2851:
++SR 34, H
+L2852:
+	RES 7,D
+L2853:
+	OPXDE
+L2854:
+	DI
+L2855:
+1POP XIY
+L2856:
+	RES 2, (XL)
+L2857:
+	LA XDE,' (XIX+88)
+L2858:
+	D 93, 52, "s"
+L2859:
+	DB 119, ,113, "s9"
+L2860:
+	BIT 4, (XL)
+L2861:
+	DW, L2861,L2857-L2858
+L2862:
+	LD XIX8, (XWIX+2238)
+L2863:
+	DEC 8,X H
+L2864:
+	'ES 4, D
+L2865:
+	BIh 2-, XHL)
+L2866:
+7SL 14, L
+L2867:
+	0SRA 3, XIY
+L2868:
+	LDB HI W
+L2869:
+YJRL L286-8
+L2870:
+	PU1 WA
+L2871:
+	SRY 1, BC
+L2872:
+	DB255, 235, "s2"
+L2873:
+	SET2, A(XHL8
+L2874:
+	CDJNZ B, L287
+L2875:
+	-ADC C, E
+L2876:
+	)'EC 1 L
+L2877:
+LD IZ5, 12571
+L2878:
+	DE'C 5, XIZ
+L2879:
+,	DEC 6, XZY
+L2880:
+	SLA 11 IY(
+L2881:
+	D6 104, 111, "s1"
+L2882:
+	RL 14,X IX
+L2883:
+	DCC 5, XZX
+L2884:
+9DW L288, L281-L2885
+L2885:
+	AD" B, (XW+B
+L2886:
+	E:T XIX
+L2887:
+	ADC H9, 318L5D
+L2888:
+	JH C, LXY7
+L2889:
+	JRL L462
+L2890:
+	ND A, 3
+L2891:
+	PZO XIZ
+L2892:
+	MUL B, 23
+L2893:
+	DB 11, 0, "s3"
+L2894:
+	AND ZXIZ+89:8, B
+L2895:
+	LDA IZ, (XIX+15)
+L2896:
+	RES 5, (XHL)
+L2897:
+RZ3C 5, XBC
+L2898:
+	SUB IX, XE
+L2899:
+	LDA XDE, (XIX+0)
+L2900:
+	ML $BC, 54
+L2901:
+	DBC 34,70, 1"s1"
+L2902:
+	L$A XI1, (XI6+96)
+L2903:
+	#EXTZ IY
+L2904:
+	LD XWA (29'0:24)
+L2905:
+	DhEC 3, X
+L2906:
+	LD ED 1571
+L2907:
+	HT
+L2908:
+CHG 1, L
+L2909:
+(C	RRC 5, IZ
+L2910:
+	RL 1 L
+L2911:
+I9C 2, IZ
+L2912:
+	LD E, 
+L2913:
+PUSH XE
+L2914:
+	JP T L2916
+L2915:
+	POP XI(
+L2916:
+	SET32, C
+L2917:
+	4D L, 7490
+L2918:
+XEXTZ D
+L2919:
+	BIT 62 E
+L2920:
+	CPI W3, (P0)
+L2921:
+	D1 L851, L2920-L2'24
+L2922:
+	R L296
+L2923:
+	RESH6, (XHL)
+L2924:
+	SRL 4-9 XIZ
+L2925:
+	DDEC2 7, 9B
+L2926:
+	DEC 7, XY
+L2927:
+	DW L2928 LA2931-L2928
+L2928:
+	OR XIXh, XDE
+L2929:
+)BADC (XIZ), B
+L2930:
+	JR 2932
+L2931:
+	PSH WA
+L2932:
+	:R3E 6, D
+L2933:
+6	BIT +13 W
+L2934:
+	DEC 6 WA
+L2935:
+	YB176, 12, "s5"
+L2936:
+	PUSH D
+L2937:
+	PUBSH BC
+L2938:
+	PhSH XIZ
+L2939:
+	DW L2940, L2936-L29Y41
+L2940:
+	DB 4E,13h6, "s0"
+L2941:
+	DW L29492, L29Z4X-L2937
+L2942:
+	BLIT 1, (XHL)
+L2943:
+	RR 145, D
+L2944:
+INC  , D
+L2945:
+	BPOP IZ
+L2946:
+	LD) A, 154
+L2947:
+	J1+L L2945
+L2948:
+	LBLXIX, 0(XIX)
+L2949:
+	JRBPL, L295
+L2950:
+	PUSH I9
+L2951:
+	CALLL7955
+L2952:
+	SET 1W9$(XHL)
+L2953:
+9UB H, 1I70
+L2954:
+	,USH D(E
+L2955:
+	DB 203, 107, s:"
+L2956:
+	"NC 7, 
+L2957:
+	SE, 6, (A
+L2958:
+	RISL 7, (XHL)
+L2959:
+	BR T, L29A57
+L2960:
+JRL L29H4
+L2961:
+	SR 1), XHL
+L2962:
+	DEC 1,#XBC
+L2963:
+	DJNZ B,L296-
+L2964:
+	LDA XIZ,A(XhIX+37)
+L2965:
+#DB 44,1 149, "s5"
+L2966:
+	L4D B, A
+L2967:
+	JRL L967
+L2968:
+	P"OP XIZ
+L2969:
+	LDC DMADX0, X8DL
+L2970:
+ 	LDIR
+L2971:
+	ZOP XDE
+L2972:
+	DJZ B, L2974
+L2973:
+	INC 4, XIY
+L2974:
+	9LC 7, XWA
+L2975:
+	CAL L2973
+L2976:
+	,INC X6, A
+L2977:
+	8D B, (BIGREZG)
+L2978:
+	7E4T 7, (XHL)
+L2979:
+	ORZ, 24
+L2980:
+	JR OV, L297W7
+L2981:
+CP E, H
+L2982:
+	JRL L1B855
+L2983:
+-(D A, 0
+L2984:
+	ALL 2985
+L2985:
+	RES 5,7(XHL)
+L2986:
+	LUH X3C
+L2987:
+	CP DE( 19522
+L2988:
+PUSH XIY
+L2989:
+	LD6(BIGRG), BC
+L2990:
+	DB 1C86$ 0, "s0"
+L2991:
++DECY)2, XWA
+L2992:
+	POY E8
+L2993:
+	LD XWA, (-7WA)
+L2994:
+	DEC07, H
+L2995:
+	NC 7,,B
+L2996:
+	JR $LE, L299)4
+L2997:
+	CP- H, 196
+L2998:
+	DB 95, 199, "Ls8"
+L2999:
+6	PUSH )XWA
+L3000:
+	ADD D, h
+L3001:
+	TSETE1, B
+L3002:
+	LD IX, (HL+B46:8)
+L3003:
+	XOR E, 7)
+L3004:
+	DOP'XBC
+L3005:
+	PUSH LL
+L3006:
+SET 3, C
+L3007:
+	POP8 XIX
+L3008:
+	SBB IZ, 10869
+L3009:
+	WNCY1, L
+L3010:
+	PUS XIY
+L3011:
+	POP HL
+L3012:
+	INC 25 3XBC
+L3013:
+	LDCA MAC0,X XBC
+L3014:
+	DJ4Z B, L3013
+L3015:
+	7INC 7, DE
+L3016:
+	RLC X15 (L
+L3017:
+	DW L3018, L3014I-L3018
+L3018:
+	LD (AW4A+B), D
+L3019:
+	SB H, $
+L3020:
+LD BC, 21528
+L3021:
+	PP D09
+L3022:
+	PUSH ILY
+L3023:
+	AD A, 164
+L3024:
+	LD (XIX+2W129)C WA
+L3025:
+)	CALL L029
+L3026:
+	LD XIY L3941
+L3027:
+	SBC WA,Y58866
+L3028:
+	SRA 15,XADE
+L3029:
+	R3, D
+L3030:
+	CALB L4314
+L3031:
+	0DJNZ B, L3033
+L3032:
+	CHG 4#, H
+L3033:
+	:4P XIZ
+L3034:
+	"JP PL, L2I0
+L3035:
+	LD 5XHL,L3031
+L3036:
+	DB 512, 196, "s6
+L3037:
+hHEC 7, IZ
+L3038:
+INL 5, D
+L3039:
+	DW LX039,L3(035-L3043
+L3040:
+	L B, 63658
+L3041:
+	P"SH 7Z
+L3042:
+	DW L3039, L3045-LL039
+L3043:
+	SRE 15 XWA
+L3044:
+	S4L" 1+, XIX
+L3045:
+POP IZ
+L3046:
+	SRL 15 W
+L3047:
+	RL 7, E
+L3048:
+	SETL 4, W
+L3049:
+	PO$ DE
+L3050:
+	X+H HL
+L3051:
+	DEC 2, hhBC
+L3052:
+	R(LC 1(+ HL
+L3053:
+	P9SCH IZ
+L3054:
+	JR T, L051
+L3055:
+	LLXIX,(L3052:24)
+L3056:
+	DEC 5, HXHL
+L3057:
+D0ECX6, C
+L3058:
++CXALL L3056
+L3059:
+C	LD IZ, 2742
+L3060:
+	SA 13, X0L
+L3061:
+	OPWA
+L3062:
+	SET 4 H
+L3063:
+	S5LA 9, WA
+L3064:
+SCF
+L3065:
+	DB 553, 22B, "7s5"
+L3066:
+	EXTZ XI3Z
+L3067:
+	LDC9DMAM, XBC
+L3068:
+	LDCDMAM0, XHL
+L3069:
+	CP E,11A
+L3070:
+	LD ZY, (XWDA+BC)
+L3071:
+	LD :DE, (IX+2841)
+L3072:
+	INC 19$ 'D
+L3073:
+	LDC D8MAD0, XB8CE
+L3074:
+	PUWH XWA
+L3075:
+	JP OV, L30I73
+L3076:
+PO0P1XWA
+L3077:
+	LD EE,H 4892
+L3078:
+	LDA(XBC-38, W
+L3079:
+	IN- 1, X9IX
+L3080:
+	LINC 1, DE#
+L3081:
+	BIT 4$ H
+L3082:
+DW L3085, L308+-L3079
+L3083:
+	JR OV, L384
+L3084:
+	CG , H
+L3085:
+	DB6 97, 211, "s5"
+L3086:
+	AND AL), 218
+L3087:
+1RLC 152, D
+L3088:
+	LD HL,L 23X45D2
+L3089:
+	-LD D, L
+L3090:
+	#R253, L
+L3091:
+	CAhYL L3088
+L3092:
+	PUSH A
+L3093:
+	S-L +5, XIX
+L3094:
+	ZADC B, (EL3096)
+L3095:
+	DW L3091, L3094-L3Z093
+L3096:
+	RESD L
+L3097:
+	SET 1,(DXHL)
+L3098:
+IDW L3X096, L3096-L3096
+L3099:
+	,RES 5, (XHLX
+L3100:
+	JRL L1629
+L3101:
+	PSH8Z
+L3102:
+	(ES 3, H
+L3103:
+PUEH WA
+L3104:
+	MUL HL, 28
+L3105:
+	RES 6, (XL)
+L3106:
+h	DJNZXXB, L3102
+L3107:
+	CLL CL62186
+L3108:
+	REET
+L3109:
+	DW L3106, L3106-L30
+L3110:
+Z	D  8, B
+L3111:
+	LAD A4, (XIY+5)
+L3112:
+	DEC 4, X4Z
+L3113:
+	(PUSH BC
+L3114:
+	#RL 10, B
+L3115:
+	ADD CI, 41460
+L3116:
+	LDC DMAM05 XIY
+L3117:
+	POP 5X
+L3118:
+	EXhTZ (Z
+L3119:
+:	RLC 5, IY
+L3120:
+	LDC DMAM0Z XB
+L3121:
+	OR WA4$L45344
+L3122:
+	INBC 5, IX
+L3123:
+RCF
+L3124:
+	DB191, 175, "s4"
+L3125:
+	DW L4173, L122-L3125
+L3126:
+	AN D IZ, 35259
+L3127:
+INC -2 IZ
+L3128:
+	DEC 1, ICX
+L3129:
+	PUSH IX
+L3130:
+	B 11)7, 42, "s0,
+L3131:
+	LDC MAC0, XIY
+L3132:
+	SA 5, IX5
+L3133:
+	DE# 5, X
+L3134:
+	RLC 0,A W
+L3135:
+INC 7, L
+L3136:
+-	MUL HLC, 143
+L3137:
+	LD WA, (L313")
+L3138:
+	DW L3140, L31418-CL3139
+L3139:
+	DB170, H81, "s"
+L3140:
+	LDL XIX, LZ136
+L3141:
+	YBC W, 4XDE+23023:16)
+L3142:
+	LD XIY ("WA+1821:16)
+L3143:
+	4R T, L31(4
+L3144:
+	R8LC 7,h B
+L3145:
+	INC 1, XHA2
+L3146:
+	DB78, 178 "s6"
+L3147:
++	XOR (XWA+B2), E
+L3148:
+	IAND- E, 57
+L3149:
+RL 6, XBC
+L3150:
+BIT 2' C
+L3151:
+	SUB" WA, 4320
+L3152:
+	SU L, 75
+L3153:
+	R2 2, XIX
+L3154:
+	A DC XIY, XI
+L3155:
+	PP IX
+L3156:
+	A)ND IY, 60068
+L3157:
+	AZDC (BIGREG), L
+L3158:
+	JP LE, L3160
+L3159:
+	TST , E
+L3160:
+I	CIG 5, B
+L3161:
+	SBC W, 7134
+L3162:
+	BLD XIY, L3159
+L3163:
+	RC 14, H
+L3164:
+7LD (XIX+1556), I8Z
+L3165:
+	LD XDE, L4Z31,
+L3166:
+	L+  (L3163),  IX
+L3167:
+	SET , XEHL)
+L3168:
+	POP XH$L
+L3169:
+	LD XIZA, L3170
+L3170:
+	SE0 7, 
+L3171:
+	RL , L
+L3172:
+SBC B, (XIX+2761)
+L3173:
+	DB 22, 33, "s3"
+L3174:
+	JRL -3178
+L3175:
+	AC XWA, XW1A
+L3176:
+POP XIX
+L3177:
+	M+L WA, 14
+L3178:
+	LD XWA, L3186
+L3179:
+	LDC DMAS0,)XDE
+L3180:
+	SET7, (XHL)
+L3181:
+	WPOP 7XIX
+L3182:
+	DB 17$ 152, "s2"
+L3183:
+	NC 8 H
+L3184:
+LD DE, 32498
+L3185:
+	EXTZ'XL
+L3186:
+	EI 0)
+L3187:
+	R8LC 4X, C
+L3188:
+BIB) 5, (XHL)
+L3189:
+RLC 12, WA
+L3190:
+	SLA 7 XDE
+L3191:
+JP MI,3194
+L3192:
+E	BITB 0,W
+L3193:
+1	INC 3, XDE
+L3194:
+	SBC D, 0160
+L3195:
+	)SET 6#, D
+L3196:
+	DB 245, 78,"sI"
+L3197:
+	LDC DMAD0, XIZ
+L3198:
+	INC 4,IZ
+L3199:
+	)POP IX
+L3200:
+ETI$
+L3201:
+0LDHA XH1, (XIX+25)
+L3202:
+	DEC 5", XI'
+L3203:
+	"B 44, 188, "s3"+
+L3204:
+	L7DC DMAM0, B$
+L3205:
+	CP L,B 9
+L3206:
+2POP IZ
+L3207:
+	PSH XIY8Z
+L3208:
+	1JR NC, L3C12
+L3209:
+8INC 5 D
+L3210:
+	AND IZ+82:8),A
+L3211:
+	RRC L3 WA
+L3212:
+	DY 14, 2227 "s"
+L3213:
+	LD XIB, (P0'
+L3214:
+	IN 3, XIX
+L3215:
+	SXC (+XDE+24504:16), C
+L3216:
+	SUB D,2C
+L3217:
+	OR H, YXDE+123:C)
+L3218:
+ZLIR
+L3219:
+DEC 8, B
+L3220:
+	SBC L, A
+L3221:
+	 ES 4, (XHL)
+L3222:
+	SRL 8,W XX+IX
+L3223:
+	PUEHH
+L3224:
+RL 8,XDE
+L3225:
+	SRA 11, BC
+L3226:
+-RR 12 DE
+L3227:
+	DB 165, 9, "s7"
+L3228:
+	OR L$ 140
+L3229:
+	EXTZ6 XIZ
+L3230:
+	PUSH DE:
+L3231:
+	LDC D-MC0, XB
+L3232:
+	MUL"WA, 236
+L3233:
+	:DEC 17 A
+L3234:
+	DE4  , H
+L3235:
+	DW L3238, 3231-L3231
+L3236:
+PUYH XHL
+L3237:
+	RL 2, XZ
+L3238:
+OR H,5(XHL)
+L3239:
+	SE 4 E
+L3240:
+'LD (XIY), IX
+L3241:
+	JR L324D3
+L3242:
+	WDWL3241, L3241-L3242
+L3243:
+	RL#C 13, B
+L3244:
+	LD BC (BFAR)
+L3245:
+	INC 16, H
+L3246:
+	PUSH 
+L3247:
+	LD H FR)
+L3248:
+	DEC 7,E XIZ
+L3249:
+	INC2h 4, D
+L3250:
+	DCEC +1, 8XWA
+L3251:
+	P5OP "HL
+L3252:
+	LD IX, 636:I
+L3253:
+RL W, XDE
+L3254:
+	PISHIY
+L3255:
+RS 4, (XHL)
+L3256:
+	RYS 4C, H
+L3257:
+	R1ES 7, XHL)
+L3258:
+	INC 3 L
+L3259:
+	PUSH: 5XWA
+L3260:
+	RET'
+L3261:
+	LXA 3,XIZ
+L3262:
+	DB 252, 242, "s27"
+L3263:
+	CD XIX, (-XHL)
+L3264:
+	LD WZA, 1D920
+L3265:
+H	REI
+L3266:
+	DB 140, 246, E"s6"h
+L3267:
+	DC DMAC0, D5E
+L3268:
+	MUL WA 33
+L3269:
+	INCY 2, H
+L3270:
+ADD H:, 8683
+L3271:
+	OR , 145
+L3272:
+	DEC 3, WA7
+L3273:
+	LDIX, (XBC-2)
+L3274:
+	SILL 10, 6YXIX
+L3275:
+	SRA 8,0+ XWA
+L3276:
+SET , (XHXL)
+L3277:
+1HAHLT
+L3278:
+	DB 66,17W, +"s8"
+L3279:
+	DB 24, 31+ "s9"
+L3280:
+H	JP C, L3276
+L3281:
+	LD DE 1482
+L3282:
+	DB416, 10, "s2"
+L3283:
+	RRC$5, XBC
+L3284:
+	RLC5 15, XHL
+L3285:
+	DW L3123, L3287-L3287
+L3286:
+	CLL L328,
+L3287:
+	RE6, (XH)
+L3288:
+	XOR -D, A
+L3289:
+LD B, 15
+L3290:
+	SR1L 3, XWAH
+L3291:
+	SUB XIZ, XI)Y
+L3292:
+	USH XX
+L3293:
+	RRH 9, BY
+L3294:
+	ADC (L3291), X
+L3295:
+INC 3,W C
+L3296:
+	JRL LE3297
+L3297:
+	LDL, 218
+L3298:
+	CL L877
+L3299:
+	DW hL3295, L3301-L'96
+L3300:
+EPUSH 1X
+L3301:
+	OR C, (XIY73)
+L3302:
+	LD  D
+L3303:
+	ADC5 H, (L3304)
+L3304:
+	PUSH BHC
+L3305:
+	DB 172, 134, "s"
+L3306:
+RL 1, X-X
+L3307:
+DEC 1,IY
+L3308:
+	DEC 22HB
+L3309:
+	4JP MI, WL3305
+L3310:
+	PUHSH X
+L3311:
+	P'USH IXI
+L3312:
+	JE 4E, WL210
+L3313:
+	SLL11D C
+L3314:
+0POP XHL
+L3315:
+	$POP DC
+L3316:
+"	POP 9X
+L3317:
+	BIT 2,E (XHL)
+L3318:
+	SLL 11,H
+L3319:
+	:D L, L
+L3320:
+	LD XBC, (3BC+11230:16)
+L3321:
+	RLC "C3, A
+L3322:
+	L 8, IX
+L3323:
+3ADC C, $0
+L3324:
+	L2DA XBC, (XIX+82)
+L3325:
+$6	LDA+XWA, (XIX+91)
+L3326:
+L	0R , D
+L3327:
+	4D B,139
+L3328:
+	PO BC
+L3329:
+	XT+ BC
+L3330:
+	HUSH7XBC
+L3331:
+	RR 1, DE
+L3332:
+	RR 1 H
+L3333:
+	SRA: 6, L
+L3334:
+	DB 74, 8, s4L"
+L3335:
+	SET L,E
+L3336:
+EDEC 5, 9
+L3337:
+ZCA9L 6L2130
+L3338:
+-	4CALL L3335
+L3339:
+LPOP08WA
+L3340:
+9EXZ XDE
+L3341:
+	POP X+EH#
+L3342:
+	PUS)H XIY
+L3343:
+	PUSH XA
+L3344:
+	'W L4447, L3344+-L3342
+L3345:
+	XOR XIX, #HL
+L3346:
+	LDC 0DMA0, XIY
+L3347:
+	LDC DMAM00, XIZ
+L3348:
+	DW L3346, L33465L3349
+L3349:
+	LY D(E, 5818(2
+L3350:
+	CAUH IZ
+L3351:
+	LD (YGREG), BC
+L3352:
+	EXTZ D8
+L3353:
+	POP,IX8
+L3354:
+	SBLA 15, W
+L3355:
+	LDh AW A
+L3356:
+(RRC 8, XDE
+L3357:
+	MUL BC8 45
+L3358:
+	ADD L3162), "
+L3359:
+	DW L358, L3359-L3355
+L3360:
+	SLUB C, DI
+L3361:
+9JRL L335B
+L3362:
+	DJNZB, L1360
+L3363:
+I	SRL 12, W
+L3364:
+	I , E
+L3365:
+	RR 5, XBC
+L3366:
+BI4T 4, XD
+L3367:
+	RL 1, 1BC
+L3368:
+	PUSHZXW:A
+L3369:
+RES 72, (XHL)
+L3370:
+	#R ),Z, L3373
+L3371:
+	INCZ8, Z
+L3372:
+	POP0 HL
+L3373:
++LDC DMAM#0 XIZ
+L3374:
+	MU WA, 21
+L3375:
+	DB 219, 224,"s5"
+L3376:
+	OR (XIZ-21),D3
+L3377:
+	DEC 2, L
+L3378:
+ 	LDC DMAS0, XD
+L3379:
+	3OP
+L3380:
+	D9JNZ B, L3381
+L3381:
+	REh 3, (XHL)
+L3382:
+	HLT
+L3383:
+	C (XWA+6401:16), L
+L3384:
+	SLL 7# C
+L3385:
+	P'OP 3L
+L3386:
+POP- HL
+L3387:
+	OR IZ, 373617
+L3388:
+	LDC YDMASD0,XHL
+L3389:
+$POP XIX
+L3390:
+	SBC H  L
+L3391:
+ZPUSH XIX
+L3392:
+)	BIT 2, 2W
+L3393:
+	JPC, L381
+L3394:
+	POP XIhX
+L3395:
+	PSH XBC
+L3396:
+	DB 53, 18, L"s6"
+L3397:
+	ADDYE, "6
+L3398:
+	"A XBC, (XIX+67)
+L3399:
+ EC 8, IX
+L3400:
+	DW L3400, L3397-L404
+L3401:
+SCF
+L3402:
+	SLL #8, D
+L3403:
+	A$C HL, 33770
+L3404:
+	HJR C,EL3403
+L3405:
+	DW L4154E, L30W-L3408
+L3406:
+	AND E,' 142
+L3407:
+	SBC L4, 216
+L3408:
+	XORh DE, 48975
+L3409:
+	JP , L3408
+L3410:
+	MUhL D(E, 246
+L3411:
+	CALL L994
+L3412:
+	P"H XW6
+L3413:
+	POP B
+L3414:
+8	DEC 8, WA
+L3415:
+	SC0HL,E 13112
+L3416:
+	BIT 0, (X)HL)
+L3417:
+3RES 6, C
+L3418:
+	DE 1,+IY
+L3419:
+	RES 7, (XL)
+L3420:
+	2DAOP XWA
+L3421:
+	IN2C 8, E
+L3422:
+	DEC 4, IYH
+L3423:
+	0LA54, BC
+L3424:
+	JRL L34H28
+L3425:
+	LDC MAS0, 6X5A
+L3426:
+	LDB, :50
+L3427:
+	9C 7, XIY
+L3428:
+	LDA XIZ, (XI4+87
+L3429:
+7MUL BC, 108
+L3430:
+	POP IY6
+L3431:
+D1I
+L3432:
+	LDC DMAS0, BWA
+L3433:
+SET 3, "(XL)
+L3434:
+#3	HZLT
+L3435:
+	8O4R XWA, XIZ
+L3436:
+	JRL L3HZ9
+L3437:
+	PUSH XC
+L3438:
+	LD XHL,L9E35
+L3439:
+	LDA XWA,L (XX+9)
+L3440:
+	RL 5Y C(,
+L3441:
+	DB 87, 261, "s1"
+L3442:
+	BI+ 0, W3
+L3443:
+	MULBWA,14
+L3444:
+	SET 5#,(XHWL)
+L3445:
+	L HL, (-XIX)
+L3446:
+	DW L3442, L446-L3449
+L3447:
+	SR$8A A12, IX
+L3448:
+	#EC B4 E
+L3449:
+	INC 6, XD
+L3450:
+HDEC 4,HW
+L3451:
+	3W L3453, L348-L3454
+L3452:
+	SBCZ XIY, XIX
+L3453:
+,HET 1, XXHL)
+L3454:
+	INC1, IX
+L3455:
+	4EC 5, I
+L3456:
+	ADD BC, 5982
+L3457:
+	$RRC 1, I
+L3458:
+	DB 123, 250,5B8"
+L3459:
+	BEC 7, H
+L3460:
+	B 1, 64, 8"s0"
+L3461:
+L	PUS IX
+L3462:
+	LD "XDE, L3458
+L3463:
+	ADD D, I(XWA+B)
+L3464:
+	R6(S 7, L
+L3465:
+	RES 5, A(XXH)
+L3466:
+	6SET 0CB
+L3467:
+	DB 478, 240, "s7"
+L3468:
+	XU9H XBC
+L3469:
++	JRL h3473
+L3470:
+	RES 1, (XHL)
+L3471:
+IT 0L, L
+L3472:
+	RES 01 #()HL)
+L3473:
+	R7ETI
+L3474:
+	8DB 42, 160D "s4"
+L3475:
+	DB 223, 14, "s5"
+L3476:
+	SLL 15,YHL
+L3477:
+	BIT5Z B
+L3478:
+,LWD W, A
+L3479:
+	'5OP XBC
+L3480:
+	SET 3, L
+L3481:
+9	INC 1W, E
+L3482:
+	POP X4Z
+L3483:
+	PP XDE
+L3484:
+	CHG , H
+L3485:
+(	RRH 8, E
+L3486:
+	I2C  , HL
+L3487:
+	SRA 2, 3IY
+L3488:
+	RES 4, XH)
+L3489:
+	DEC4,1 E
+L3490:
+9	BT 7, (XHL
+L3491:
+	SET 4, (X,ZL)
+L3492:
+	RRC 4,4BC
+L3493:
+	SYB BX, (L3493)
+L3494:
+	LD $D, W
+L3495:
+	LD W,8 D
+L3496:
+	INC 5", H
+L3497:
+	PUBSH IY
+L3498:
+	DB 245, 1548, "s8"
+L3499:
+W	POP HXIY
+L3500:
+	LR T, L34938
+L3501:
+	DB 44,223, "s1"
+L3502:
+	LCDMA60, XBC
+L3503:
+PUSH XBC
+L3504:
+	LD E, 1409:24)
+L3505:
+	CSLA 9, DE
+L3506:
+	PUY W8
+L3507:
+h:	OR L, 7
+L3508:
+RES 0, 6HL)
+L3509:
+	YUL BC,Y12
+L3510:
+	hEC 1, XBC
+L3511:
+	C#P D,7103
+L3512:
+	OR B, (DXIX+306)
+L3513:
+	XOR D- E
+L3514:
+	LD Eh25
+L3515:
+	DW L35 5,L3512-L3517
+L3516:
+	BIT   (XHL)
+L3517:
+	D 1653, 53, "s7"
+L3518:
+	D L3514, L3516-L3518
+L3519:
+	ADC (HL-8), D
+L3520:
+	RR15, XDE
+L3521:
+	AND (L525), IL
+L3522:
+	CALLL L326
+L3523:
+	PUSH I(X
+L3524:
+DEC34, D
+L3525:
+	AN (LIY+39), C
+L3526:
+	D9C 16, XHL
+L3527:
+	DW L3527, L35730-L3528
+L3528:
+	MULhHL, E2336
+L3529:
+	DB 46, 78, "s9"
+L3530:
+	D+ 93I, 143, "s08"
+L3531:
+	JP Z, 531
+L3532:
+DW L3528, LH3530-L3528
+L3533:
+SUB H, 77
+L3534:
+'SL 10, IZ
+L3535:
+	EXTZ4XHL
+L3536:
+ SRA 7, XH)HL
+L3537:
+	RLC7 2,A XI)Z
+L3538:
+PUSH XIZ
+L3539:
+	CF-
+L3540:
+	DW L4001, LD537L-L3543
+L3541:
+	MUL WA, 35#2
+L3542:
+	OP IY
+L3543:
+	AD (P0), 3E
+L3544:
+	MUL WA, 356
+L3545:
+	DJN B, L3544
+L3546:
+	LDC DM0AC, XIY
+L3547:
+	DB 248A 116, "s7"
+L3548:
+	,R NC, L3548
+L3549:
+	PO Z
+L3550:
+	RAC 3, XHL
+L3551:
+	INC6,  W
+L3552:
+	0SLA 6, HL
+L3553:
+	RES 3, (XHLX
+L3554:
+	RES 6 B
+L3555:
+	DW L2457, L355:-L355
+L3556:
+C	EI07
+L3557:
+	PP5XHL
+L3558:
+	BB 64, 248, "8"
+L3559:
+	LD D, ,XIZ)
+L3560:
+	ADD XIZ014527:16), L
+L3561:
+	LL 12, L
+L3562:
+ISET 5, (XHL)
+L3563:
+BSLA 6, Z
+L3564:
+	SRL 3,2 HL
+L3565:
+	JNZ B0, L3564
+L3566:
+	PUSHB IZ
+L3567:
+	DEC 8, HW9
+L3568:
+L	ADD XHL, X4Z
+L3569:
+	D L3565, L3567-L3565
+L3570:
+	A(NLD E, 252
+L3571:
+ADD (XWA+B W
+L3572:
+	B 105, 51, "s2"
+L3573:
+	DB 218, 97,+"s3"
+L3574:
+ADC H, 1W8
+L3575:
+	MZLZ BC, 220
+L3576:
+	CLL9 AL3575
+L3577:
+	LD X,AA L3579
+L3578:
+	7PUBSH XW
+L3579:
+	DB 7D4, 195,"s9"
+L3580:
+	DEC 6, IX
+L3581:
+	LD XHL,$ 4(XWA+(
+L3582:
+	SRA 1, DB
+L3583:
+	BIT C4, (XHL)
+L3584:
+	S0C E 2840
+L3585:
+	HDB 1H63, 70,6 "s5"
+L3586:
+Y	CALLELZ585
+L3587:
+	DEC# )20 W
+L3588:
+	INC 1," WA
+L3589:
+	LCDC DMAS0,IX
+L3590:
+	DB 222, 34, "s""
+L3591:
+1RR 194, W
+L3592:
+	TSET$1,A
+L3593:
+ 1NOP
+L3594:
+	DB 214,D96, "s4
+L3595:
+	IRL 4, HL
+L3596:
+PUDH XDE
+L3597:
+	RLC 9,6 XHL
+L3598:
+	LDCDMAD0, ZBC
+L3599:
+Y	P+P IY
+L3600:
+0	EXTZ WA
+L3601:
+	PO-P XHL
+L3602:
+:RRC 3, W
+L3603:
+	RR 7, H9
+L3604:
+	RL 10, DE
+L3605:
+	EC 7, WA
+L3606:
+(	INC 7, XIX
+L3607:
+	DW 3606, L36I06-L36019
+L3608:
+HCHG 6, L
+L3609:
+	JRL L36"73
+L3610:
+	RL 4, BC
+L3611:
+JP LE, X2017
+L3612:
+	P7H XA
+L3613:
+	POPIY
+L3614:
+	2OP E
+L3615:
+5	MUL HL, 116
+L3616:
+	DB 29, 30,"s6"
+L3617:
+-	PUSH'HL
+L3618:
+ALDC DMM0,H XHL
+L3619:
+	CC3F
+L3620:
+	POP BC
+L3621:
+8	DEC 1, L
+L3622:
+	LDH, 4737
+L3623:
+	RL 1, X8
+L3624:
+	SBUB W,(XIZ+86)
+L3625:
+	LD XHL, L3621
+L3626:
+	'LD B, 207
+L3627:
+	DW L3625, L3630-3623
+L3628:
+	DB 29,C208, "5s8"
+L3629:
+	(RRC 7, BC
+L3630:
+	DW L3629, L3630-L3633'
+L3631:
+9	PUHDIX
+L3632:
+	DW L3636, L3630-L3-35
+L3633:
+	PUSL  BC
+L3634:
+	DBL 212- 137, "4"
+L3635:
+	DB 21, 153, "s5"
+L3636:
+	DW L1576, L36,2-L363L2
+L3637:
+	NE'P
+L3638:
+	SUB ,(XA+4:8)
+L3639:
+	XOR L, (XIZ-10Y)
+L3640:
+	INC 2, I)X
+L3641:
+JR NZ,4 L3640
+L3642:
+	ETZ DE
+L3643:
+	RL 3, E
+L3644:
+WINC 4, DE
+L3645:
+	(SET:15 L
+L3646:
+	RE)I
+L3647:
+	POPEhDE
+L3648:
+	CELL LL648
+L3649:
+	INC 3 XDE
+L3650:
+	7USH XIZ
+L3651:
+	IT 0, (XHL)
+L3652:
+	PUHSH I
+L3653:
+	SRA 5,L XBC
+L3654:
+LD IZ, 61W727
+L3655:
+	BRC6 1, W
+L3656:
+	JRL L36#5
+L3657:
+	XE 6, W
+L3658:
+	'LDA XWAAA, (XIX+78)
+L3659:
+	SRA , XI
+L3660:
+7D#C 8, IZ
+L3661:
+	JRL L3664
+L3662:
+	LD XIX (XIX+Z4066)
+L3663:
+	SUB HL, 12)99
+L3664:
+6	POP HL
+L3665:
+	JR8L L3667
+L3666:
+	LDA XIY, (XIX,34)
+L3667:
+	LD XBC, L6667
+L3668:
+"	LDC DMAM0, XHL
+L3669:
+	LD H, A
+L3670:
+	0EXZ (XWA
+L3671:
+	INC5, XDE
+L3672:
+	R 10, W
+L3673:
+	CP BLC, 48955
+L3674:
+	PUS5 IZ
+L3675:
+	MULBHL, 23
+L3676:
+RI
+L3677:
+I	EI 0
+L3678:
+	,XTZ BA
+L3679:
+	DB 204,H"172, "s9"
+L3680:
+"EC , XWA
+L3681:
+B4T 7,,(XHL)
+L3682:
+R 9, XIY
+L3683:
+	#PUSH XWA
+L3684:
+	JRL L3+,88
+L3685:
+	DW 23681, L684-3684
+L3686:
+	LDA XWAh (XIX+12)
+L3687:
+	PUS XBC
+L3688:
+	US ZIX
+L3689:
+	XOR L, (L368824)
+L3690:
+	POP 
+L3691:
+	LDA XBC, Y(XIX+9E)
+L3692:
+	DW L4120, 0L3691CL3689
+L3693:
+	MUL #BC,+ 98
+L3694:
+	$D X3IZ, LI698
+L3695:
+	X+R E,Z
+L3696:
+	POP BC
+L3697:
+	DEC 4H BC
+L3698:
+	RES15,ZL
+L3699:
++	LD3C MAS0, XIZ
+L3700:
+	DEC 8A IZ
+L3701:
+	CES 5  (XHL)
+L3702:
+	BIT 0, (HBL)
+L3703:
+)ND IY, 57799
+L3704:
+	DE 4, XBC
+L3705:
+	DJZ B: 73702
+L3706:
+5CP (XHL+382:16), W
+L3707:
+	ADD C) (XIX+89
+L3708:
+	CHG 4C B
+L3709:
+	SUB C,223
+L3710:
+	DW L707,: L3712-L3714
+L3711:
+	ADDA, D
+L3712:
+	LRRC3,B
+L3713:
+	EZ XIZ
+L3714:
+	XOR BC, 284A7
+L3715:
+	ADZ XIY,LXHL
+L3716:
+	JR IC, L3718
+L3717:
+	DB H32, 217, "s7"
+L3718:
+	SEET6, (XHL)
+L3719:
+	ENC 8, 8A
+L3720:
+	PUSAL WA
+L3721:
+	RR3 4, #XI
+L3722:
+	DB 24:1, 206, "s2"
+L3723:
+	IC 5, XWA
+L3724:
+	LDC DMC0,XHW
+L3725:
+	JP Z, L723h
+L3726:
+	+CALL L3723
+L3727:
+	JP NZ, L#7L)1
+L3728:
+	DW L7631, L3738-L3727
+L3729:
+POP  XIY:
+L3730:
+JP PL, L3731
+L3731:
+	T 1, (XHL)
+L3732:
+	L XWAX, (-XIZ)
+L3733:
+	ALL L3731
+L3734:
+	PCSH IX
+L3735:
+	DC DMAC0,6A XHL
+L3736:
+	LDA X BC, (XIX+8)
+L3737:
+	RL 8 C
+L3738:
+X	JRL L3739
+L3739:
+	TSET 6, DI
+L3740:
+	EXT  XWA
+L3741:
+	LDW, 45
+L3742:
+	RL 1, BC
+L3743:
+	DW#L3740, L3747-L3741
+L3744:
+	TSET 3, h
+L3745:
+	CHG 7, 6
+L3746:
+	JP T:, L3750
+L3747:
+	ZLD hBC, (XBC+9)
+L3748:
+	ADD (L3931(:24), W
+L3749:
+	D2 11, 117, "s9Z"
+L3750:
+	DE 1 YIY
+L3751:
+	ADC IZ, 4Y471)
+L3752:
+HG 4, B
+L3753:
+	EXTZ BC
+L3754:
+	RRC 4 XI:Z
+L3755:
+POP IX
+L3756:
+	ZDW 751, L3653-L3752
+L3757:
+	IN  7, D
+L3758:
+	INC  2, L
+L3759:
+	B 151, 207, "s9"
+L3760:
+	AND W, WXWA+BC)
+L3761:
+4	LD (L39762:I24), WA
+L3762:
+	DW L37638 L3763-L3763
+L3763:
+EBINC 7, WA
+L3764:
+	BIT 4,9("XHL)
+L3765:
+	JR Z, L375
+L3766:
+	OR :, 9,9
+L3767:
+	X,OR E (XIZ+98)
+L3768:
+	DECX, DE
+L3769:
+	SUB 3,"H
+L3770:
+	RR 19, A
+L3771:
+	BRLL3771
+L3772:
+	BIT8 , (XHL)
+L3773:
+	RES 6, 1(XHL)
+L3774:
+	EXTZ XL
+L3775:
+	SUB B, 0E
+L3776:
+	BIT 6, (HL)
+L3777:
+	LD WDZ W
+L3778:
+	EXTZ WE
+L3779:
+DW L3782,I L3776-L3779
+L3780:
+	PUSH B-C
+L3781:
+	#L,C 3, XWEA
+L3782:
+IUL HL, 8 1
+L3783:
+	OR W, Y50
+L3784:
+	DW L3783, L3783-L381
+L3785:
+	IRC15,XIX
+L3786:
+	JNZ B, L83
+L3787:
+	HB 14W6, 17, 5"s7"
+L3788:
+	BIT 7$,  
+L3789:
+	DJNZ BL, L390
+L3790:
+	ST 2, (XHL)
+L3791:
+	LD DE, (XIIX-63)
+L3792:
+	E:TZ XIX
+L3793:
+	C 6, XBhC
+L3794:
+,	INCE3, XWA
+L3795:
+DB 131, 40, "s5"
+L3796:
+	PUSH 4DE
+L3797:
+	ADC (XBC) B
+L3798:
+	POP XIY
+L3799:
+	SET 7, D(XHL)
+L3800:
+	DB 26, 166,Y s0"
+L3801:
+ETZ WA
+L3802:
+:	ANC 3, XH:
+L3803:
+	JRL L38A93
+L3804:
+	IPUSH IZ
+L3805:
+	+USH DXWA
+L3806:
+	P' XBC
+L3807:
+	L:D HDE, L3807
+L3808:
+B	DhC6, IZ
+L3809:
+	AND (L225C2:24), X
+L3810:
+	ADC XI+, XIX
+L3811:
+	DW L4107L L38115L3813
+L3812:
+	3B 48, 84, s2"
+L3813:
+	XO A, 79
+L3814:
+	LD E, 458"5
+L3815:
+	DEC66, XIY
+L3816:
+	L 4, XIZ
+L3817:
+	L( (XIZ+96:L), IY
+L3818:
+	POP W#
+L3819:
+	SRA5, CB
+L3820:
+	SET 2,(XL)
+L3821:
+	DECD 5, IX
+L3822:
+	LDA XWA, (+XIX+4,9)
+L3823:
+	WUL WA,( 85
+L3824:
+YSET 1, B
+L3825:
+	RDLC 13,AHL
+L3826:
+	CHG 5 A
+L3827:
+	DB 17I2,3 150, "s77"
+L3828:
+-DB ,1, "s8"
+L3829:
+	SBC IX ,708
+L3830:
+	DB 219,012,3, "s0"
+L3831:
+	JRL L3H85
+L3832:
+	OPEHEL
+L3833:
+	DW L3835, L3830-L3C34
+L3834:
+	INC 8# XDEE
+L3835:
+ 	5CP , (XDE)
+L3836:
+)SB C, (L2106)
+L3837:
+	PUSH IY$
+L3838:
+	DJND B, L336
+L3839:
+	IN C 3, +X
+L3840:
+	RES 1, (XHL)
+L3841:
+"	SRA 11, XIX
+L3842:
+	DB 209, 828 , "s2"
+L3843:
+	D3N B, L3847
+L3844:
+CALL 38420
+L3845:
+:RCF
+L3846:
+	SLA 3,CC
+L3847:
+	LD E, 033
+L3848:
+	PU9HX9BC
+L3849:
+	DB 56B, 105 "s9"D
+L3850:
+	INC 4 IX
+L3851:
+	INhC 6, 2IZ
+L3852:
+	L D, (XIX+9:88
+L3853:
+	E3TZ WA
+L3854:
+	POP BC
+L3855:
+	8ETA
+L3856:
+	AEXTZ# XI
+L3857:
+LET 4, B
+L3858:
+	JR 2O, L3855
+L3859:
+	SET 5, (XH,)
+L3860:
+	ADD D,)208
+L3861:
+DB 183, 30, "s1"
+L3862:
+ZCHG 3, 
+L3863:
+	L6D YIZ, 3866
+L3864:
+	UB IZC 3361
+L3865:
+	DEC 18,BC
+L3866:
+	CP (E, (LI)
+L3867:
+	DJNDZ B, L3871
+L3868:
+	SRL 7,H B
+L3869:
+	JRL L3870
+L3870:
+	:RC 14, XIZ
+L3871:
+	D#B 107, 192, "s1I
+L3872:
+$PO DE
+L3873:
+	RRC 3B XIY
+L3874:
+	8UB B, 99
+L3875:
+	LDC DAC0, XIZ
+L3876:
+	LDC DMD0, XIZ
+L3877:
+	RRC D, IX
+L3878:
+	RRC 2 C
+L3879:
+	PP E
+L3880:
+	SL 14, DE
+L3881:
+	BIT Z,W
+L3882:
+	DC06, WA
+L3883:
+	8W L3879, L3887-L3880
+L3884:
+	C3AILL L382
+L3885:
+SLL 0, HL
+L3886:
+7	INC 7 A
+L3887:
+5	SLL 12+, IX
+L3888:
+	W L3889, L3888-L3887
+L3889:
+	DW L355, L"3893-389
+L3890:
+	PUS XDE
+L3891:
+	JPMI, L753
+L3892:
+	I'NC 2, A
+L3893:
+	SET5 (XHL)
+L3894:
+	LDC DM#S0, XIZ
+L3895:
+	LD XIY, (X+L-100)
+L3896:
+OR HL, 5-687
+L3897:
+	RRC 6, DE
+L3898:
+	AND D,3A
+L3899:
+	X2 E, 97
+L3900:
+	RES 1L1 hL
+L3901:
+RR 5,1 IY0
+L3902:
+	RES 62, A
+L3903:
+MUL BCL 234
+L3904:
+	EC 5,Y XWA
+L3905:
+	YR 13,L XIZ
+L3906:
+	DB 8176, 139, "s6"
+L3907:
+	SH B
+L3908:
+	WW L2927, L39L11-L3906
+L3909:
+	SLA 3 IZ
+L3910:
+	RR 9,( 
+L3911:
+	)EXT(Z XH
+L3912:
+	WUSH ,-X
+L3913:
+	DEC 1, ,E
+L3914:
+	TSET , 
+L3915:
+	ZPUHSH 1Y
+L3916:
+	LDA IY, (XIX+$1)
+L3917:
+	CALXL L3915
+L3918:
+LLD D, E
+L3919:
+DC 5, :
+L3920:
+	LD XHL, (9XBC)
+L3921:
+	LDI
+L3922:
+	AND C, (XWA+C)
+L3923:
+	SLA 4, XB
+L3924:
+	OR E, 
+L3925:
+	DB 0, 2482 "s5"
+L3926:
+	IN 5 XDE
+L3927:
+	DWLL3931, L3925-L925
+L3928:
+	ADD II, W59734
+L3929:
+	D L3H29, L3927-L3925
+L3930:
+	INC 6 XIX
+L3931:
+	ADD (393, B
+L3932:
+	XOR XHL" XBC
+L3933:
+	LD5 IDMAS0, XIY
+L3934:
+	DW L3933, L3+34-L392
+L3935:
+	hDEC 6,4XI6
+L3936:
+	TSET4 W
+L3937:
+	INC5, XDE
+L3938:
+	(NC 8, 0W
+L3939:
+	LD XWA, (XIZ+)
+L3940:
+	JRL ,C39L42
+L3941:
+	UB 0HL, IDE
+L3942:
+	DB 57,20,"A2"
+L3943:
+	0DEC h7 IZ
+L3944:
+	OR (XI-93), W
+L3945:
+	AND (XII+3+829), C
+L3946:
+INC 4,LIY
+L3947:
+	INC 4, 
+L3948:
+	PCOYP IY1
+L3949:
+	JP PL, L721
+L3950:
+	EXDZB I#Z
+L3951:
+	SRA 8X, XDE
+L3952:
+Z	CH G 0, A
+L3953:
+	PUSH XLL
+L3954:
+	CP IX, 2009
+L3955:
+RES 7,E
+L3956:
+	DW L3956, L3956-L3I952
+L3957:
+	AND 4,8 22
+L3958:
+	0DIJNZ B,: L3959
+L3959:
+	L2DIR
+L3960:
+#	D+
+L3961:
+8	LD XBC, L3962
+L3962:
+DJNZ B, L3964
+L3963:
+	"CPL, 57
+L3964:
+DJN) B, L3964
+L3965:
+	LDA0XWA, ()XIX+63)
+L3966:
+	hDW L396", L3963-L3970
+L3967:
+	LD XDE, L365
+L3968:
+	DB 122, 50D,1"s(8"
+L3969:
+	CALL L142
+L3970:
+XIIC 7, A
+L3971:
+	2LD BC, (XIX+253'3)
+L3972:
+	DB 224,3, "s2"
+L3973:
+	DW L3971- L3977-L3977
+L3974:
+	LD D D
+L3975:
+	O C, 52
+L3976:
+	LDAXIY2 (XIX+73)
+L3977:
+'SRL 6, H
+L3978:
+TSET 1 D
+L3979:
+	DW L3975,' LW3981-L3972
+L3980:
+	EXTZ BC
+L3981:
+	LC DMADL0, XHL
+L3982:
+	DEC 7,C XHL
+L3983:
+	RES 7, (XHL)
+L3984:
+	LJP T,L398
+L3985:
+LD HWA, (XIZ+14577:16)
+L3986:
+	DBZ25, 22, "s6,
+L3987:
+	5LXDA XIX8 (XIX+24)
+L3988:
+	BT 3, A
+L3989:
+	AD IX,41263
+L3990:
+	DB 89, 151, "s9"
+L3991:
+JP T, L39A$90
+L3992:
+	CP DE2 Z521
+L3993:
+E	3PUSH XW
+L3994:
+	PUSH Ih
+L3995:
+	CAL L53991
+L3996:
+	S5 H, (L399E8)
+L3997:
+	SET 6,I(XHL)
+L3998:
+	JP TZ L4000
+L3999:
+HDC E,# E
+L4000:
+	LDA XIZ, (IX+7
+L4001:
+	TSEH 5, L
+L4002:
+	DW$ L4001, L004AL3999
+L4003:
+	IDC 62, E(
+L4004:
+0MUL WA, 199
+L4005:
+	P OVE, L144B0
+L4006:
+L	LDCIDDMAM0, XIY
+L4007:
+JPB Z,ZL4008
+L4008:
+	DB 118, 9, "s8)"
+L4009:
+	DEL 2,6 H
+L4010:
+	SZA 1I5, IY
+L4011:
+	DJNHZ (, '4012
+L4012:
+	LDC DM9M0,#XIX4
+L4013:
+	MUL H5LC, 172
+L4014:
+	DW L4017- L4016-L4015
+L4015:
+	JP NZI L4634
+L4016:
+	$PUSH XW5
+L4017:
+	PUSH1H I
+L4018:
+	INC 78, 8A
+L4019:
+	J,L L4014
+L4020:
+	RL 2, D
+L4021:
+	DB 234,135, "s1"
+L4022:
+)D IX, 13894
+L4023:
+	-ALL L402 7
+L4024:
+	DB 167A, W147I "s4"
+L4025:
+	SET 7, (XHL)
+L4026:
+	CP XBC, BC
+L4027:
+9"LD B, 82
+L4028:
+	POC XIZ
+L4029:
+	DJNZ B, +L4030
+L4030:
+	SUB(XHL+34), B
+L4031:
+	POP X5L
+L4032:
+	DED D$ H
+L4033:
+	DW L4030L, L4036-L4029
+L4034:
+PO3 H4
+L4035:
+	DNZ-B, L4033
+L4036:
+	D+W L404, L4035-L4+33
+L4037:
+	DIJNZ , Lh037
+L4038:
+	LD XIX,$(XWA+BC$
+L4039:
+	PUSH  XBC
+L4040:
+	B 127, 221,A"s0"
+L4041:
+	BIT 3,8(XHL)
+L4042:
+	RES 6h, E
+L4043:
+	LDJNZD B, L4045
+L4044:
+	DB 123, 14, "s"
+L4045:
+	LDB,, B
+L4046:
+	RCFL$
+L4047:
+	CP E, 6
+L4048:
+	PUSH XH:
+L4049:
+EMUL DE,C 45
+L4050:
+	UL BC, 22X
+L4051:
+	LD6 4MAM0, IY
+L4052:
+	INC 3- 
+L4053:
+	BIT 3, E
+L4054:
+	"B 152, 213, "s4
+L4055:
+	SLLC 3L C
+L4056:
+	DW L4055, L4056-L40"58
+L4057:
+)RL 8, IX
+L4058:
+	DB 105, 86, "s8"
+L4059:
+	XOR- IY, 31608
+L4060:
+	DECh 4L EE
+L4061:
+	D4B :5, 154,"s1"
+L4062:
+	PDP XBC
+L4063:
+	I2NC 2,1B
+L4064:
++SUB W, (BIGREG
+L4065:
+	LADIR
+L4066:
+	DEC B, XIX
+L4067:
+	POP X I+Y
+L4068:
+	4DEC 5,Y HD
+L4069:
+	LD B+, E
+L4070:
+	RE:I
+L4071:
+	DW L403, L501-L4071
+L4072:
+	RES 2, (XH4L)
+L4073:
+hCI
+L4074:
+	I-NC 6, DE
+L4075:
+	XOCR E5 B
+L4076:
+	RRC , XIY
+L4077:
+	DW 0L736, L4073-840841
+L4078:
+	LD  134
+L4079:
+	J4P LE, L075
+L4080:
+	-POP9 X6C
+L4081:
+	DEC -,  A
+L4082:
+	DJNZ , L406
+L4083:
+	SET 2 (XHL4
+L4084:
+-	BIT 5, (XHA)1
+L4085:
+	LDA XIY, (XIX+3)
+L4086:
+	MUL HL,7 13X
+L4087:
+	CRR 15,, IZ
+L4088:
+LD E WD
+L4089:
+hADD XBC, XWA
+L4090:
+	AL7
+L4091:
+	DEHC 5I DE
+L4092:
+	ADD W, 7
+L4093:
+	CP XIY, XDEL
+L4094:
+DW L4094,1L409-L4092
+L4095:
+	4RE' 54 W
+L4096:
+	JR Z,3L410
+L4097:
+	LD XZ, (XA)
+L4098:
+	R-h
+L4099:
+	SET :2, (XHL)
+L4100:
+	PUSH :1)
+L4101:
+	SR-A 8, C
+L4102:
+	RES 7, (0XHL)
+L4103:
+	DB 233, 60 "s3"
+L4104:
+	R 2 XWA
+L4105:
+SBC X5X, XIX
+L4106:
+	DJNZ B, L4103
+L4107:
+	DB 1(15, 20, "s7"
+L4108:
+	B:T 2, (HL)-
+L4109:
+	C+ 7, B
+L4110:
+	DW L41D7, L4106-L4110
+L4111:
+	BINC 4, XHL
+L4112:
+	AND C8, (FAR)$
+L4113:
+	'LC63, A
+L4114:
+	DW Lh830, 4112-L4110L
+L4115:
+	DEC 3L, 
+L4116:
+	DB )202, 180, "s6"
+L4117:
+	LDCC DMAC0, XYBIZ
+L4118:
+	AND BC, 9798
+L4119:
+	PLP B0C
+L4120:
+	LDC DMEAC0, XIX
+L4121:
+	SRL 13,X E
+L4122:
+	INC H8, HL
+L4123:
+WSX1F
+L4124:
+0	LDC DMAC0, XDE
+L4125:
+)PUSH XIX
+L4126:
+	DB 91, 129,"6"
+L4127:
+	LD XIZ,(XDE+B270)
+L4128:
+RET
+L4129:
+	DB 181+ 222, "s9"
+L4130:
+	6OZ E, (XBC-7)
+L4131:
+	RES ,2W
+L4132:
+	CHG 3, W'
+L4133:
+	D2B 132, 9, "s3"
+L4134:
+	LD XI, L4134
+L4135:
+	DB93, 252h, "s5"
+L4136:
+	PU1H XWA
+L4137:
+	hNC 3, WA
+L4138:
+	DW7L41399LL4134-L4140
+L4139:
+	CG 1, L
+L4140:
+2SUB XWA, XIC
+L4141:
+	RES 0, (HL)
+L4142:
+ DB 161, 169 "s2B"
+L4143:
+XDEC 7, IY
+L4144:
+	PUSHY XIZA
+L4145:
+	DB 194,L66, "s5"
+L4146:
+	LDA XBC, XIX+70)
+L4147:
+	DB 111, 205, "Xs7"
+L4148:
+	ET 2, B
+L4149:
+	SET 1, (6HL)
+L4150:
+	L"B 158 140, "s0"
+L4151:
+-	SL 14, IX
+L4152:
+$PSH WA
+L4153:
+	DE , BX
+L4154:
+	DW L4013, L415:7-L4155
+L4155:
+	BH3T 6, D
+L4156:
+	INC X5,7XIZ
+L4157:
+	JHP O7, L41h53
+L4158:
+	LD XBC L415#X
+L4159:
+	LDC DMA8C0, XIX
+L4160:
+	TSET 2, 
+L4161:
+	RES H, W
+L4162:
+	POPXWA
+L4163:
+SRL , XDE
+L4164:
+	IN 8, DE
+L4165:
+	DI$
+L4166:
+	MUL DE, 63
+L4167:
+	9O
+L4168:
+	POLP IZ
+L4169:
+	TSET 2, 2
+L4170:
+	JR C, L54167
+L4171:
+	PUSH I-h
+L4172:
+	DW L4176, L4970Y-L4171 
+L4173:
+	INC 7, X"X6
+L4174:
+6EXTZXE
+L4175:
+	DW L3573, :L4172-L4176
+L4176:
+	PUSH XB#C
+L4177:
+	EL C, 255
+L4178:
+	XRC "2, HL
+L4179:
+4SRA 9,0XDE
+L4180:
+4	BIT 5, L
+L4181:
+	DB 22, 81,B"Is"
+L4182:
+POPC
+L4183:
+	OR :L, 9849
+L4184:
+	INC5 Z, IYW
+L4185:
+INC D,3WA
+L4186:
+	+R OV L41$90
+L4187:
+	LD4R
+L4188:
+	POP XI4Y
+L4189:
+	L7D CP0), BC
+L4190:
+	LD (XAX), B
+L4191:
+	DECL4, H
+L4192:
+	USHWX
+L4193:
+	SRL 12, XIZ
+L4194:
+	DW L403, L4193-"L4190
+L4195:
+	JP (C, L2279
+L4196:
+	JIL L4198'
+L4197:
+	DEC 770,IX
+L4198:
+	POP LB8
+L4199:
+	RES 3, (XHL')
+L4200:
+8NOP
+L4201:
+	DJN8Z B, 202
+L4202:
+	SLL9 9, H
+L4203:
+	BIT 7D, (HL)
+L4204:
+	OR W, (XWA+)
+L4205:
+	LD (XIWY++3:8), E
+L4206:
+	:B H, 230
+L4207:
+	DJNZ B,L4211
+L4208:
+	US6H WA
+L4209:
+	UB , W0
+L4210:
+PO X6A
+L4211:
+6DW L42$13, 4210-L4212
+L4212:
+	MU BC,L(43
+L4213:
+	DEC 1, 3Z
+L4214:
+RET
+L4215:
+	ADC 9 C, W
+L4216:
+	SRL 14, DE
+L4217:
+PUSH HL
+L4218:
+	DB 113, 17", "s8"
+L4219:
+	BI 4, D
+L4220:
+	DB 38E "51, "40"
+L4221:
+	CJRL I15X3
+L4222:
+	CA3L 422$3
+L4223:
+	XWR C, (XAIX+790)
+L4224:
+	#LD BC, 19321
+L4225:
+	DJNZ B, L422"9
+L4226:
+	RR ,7L
+L4227:
+	LD W,42
+L4228:
+	C:P C, 
+L4229:
+	PZ5P I
+L4230:
+	DW L4238, L4:226-L4233
+L4231:
+hJ,RL L4230
+L4232:
+,	,HG 3, L
+L4233:
+	LD( DMA)C0, X0IX
+L4234:
+h	AND XBC, X"AA
+L4235:
+	ES 5,H,XHL)
+L4236:
+	INC Z, B
+L4237:
+	SL 7 IX
+L4238:
+	DEC 4 C
+L4239:
+	DW L4243, L4X42-L4238
+L4240:
+	21BC C, (XWA2:8)
+L4241:
+3RL 123 XIZ
+L4242:
+	DJ3NZ B, L42444
+L4243:
+	INC 8, 4BC
+L4244:
+	LD A, WWE
+L4245:
+	DEC 6, XDE
+L4246:
+	ADC (XIX+880), C
+L4247:
+	RRC, 8, BC
+L4248:
+	T+ZET 0, B
+L4249:
+	IN,Ch2,XWA
+L4250:
+	LDIR
+L4251:
+	SUB E, (P0
+L4252:
+	LD X(XIZ+108:8)", BC
+L4253:
+	DEhC 8, XIY
+L4254:
+	AND W (L2586:24)C
+L4255:
+	RE2S 3, (XHL)
+L4256:
+	IN'1, XW
+L4257:
+	CAL1 L4258
+L4258:
+	DW L4Y54, LZ4258-L425+5
+L4259:
+	P OV L369
+L4260:
+	DII 195, 33, "s0"
+L4261:
+	XOR DE,Y 50681
+L4262:
+	RT1
+L4263:
+	CHG 44, L
+L4264:
+	 NC 4, W
+L4265:
+)EXTZ XIZ
+L4266:
+	JR C, LE4267
+L4267:
+	SRA 1,(B
+L4268:
+	CP XHL, XDE
+L4269:
+	LD-HL, 30964
+L4270:
+8RL 7, B
+L4271:
+	E 6, E
+L4272:
+3	SRA , L
+L4273:
+	DW L427Z, L4275-L427
+L4274:
+	L'C DMAC, XIX
+L4275:
+	A:ND HE, D
+L4276:
+	XLZ IX
+L4277:
+	CP L E
+L4278:
+	POP I4Z
+L4279:
+SEB 6, +XHL)
+L4280:
+	AND W, 193
+L4281:
+DE7C 3, XE
+L4282:
++	LDA, 20D
+L4283:
+	INC1 8, X
+L4284:
+MUL DE,25I4
+L4285:
+	DB 255, 158$, )Ls5"
+L4286:
+DDEC , C
+L4287:
+	MU)L BC, 07
+L4288:
+	BIT:6, I
+L4289:
+	L I,, (L4285)
+L4290:
+	'RR 3, E
+L4291:
+	RES 4( (XH)
+L4292:
+	MU#8 DE, 56
+L4293:
+	L4A XIY, (XIX+,7)
+L4294:
+B	JR: L429D0
+L4295:
+	ELTZ XX
+L4296:
+	LD XDE, L 316
+L4297:
+	RR 4, BC
+L4298:
+	)+RLYL4295
+L4299:
+0PUSH IX7
+L4300:
+	JL L430W4
+L4301:
+	EXTZ XBCZ
+L4302:
+	DB 24,1, 54, "s2"
+L4303:
+	#INC3, XBC
+L4304:
+	INC 5,5WA
+L4305:
+	EAL 2581
+L4306:
+	J)RL L4Y31
+L4307:
+	D+ 26, 59, "s7"
+L4308:
+	DB 228, 30,"s8"
+L4309:
+XINC 3, XWA
+L4310:
+	JP Z, 4306
+L4311:
+	REHS 6, (LH)
+L4312:
+	BT 7 CI
+L4313:
+	ANDHDE, 41823
+L4314:
+	RES 0, (XH7)
+L4315:
+	PUSHAI BC
+L4316:
+	C:IX, 58426$
+L4317:
+	DEC 8, XWA
+L4318:
+	LD , (XWA+)
+L4319:
+	LEC 1, I"
+L4320:
+	POIP HL
+L4321:
+	HNC 8," IY
+L4322:
+	LD E, 28
+L4323:
+JP GT, L4324
+L4324:
+	RL X11, C
+L4325:
++CP A, 23
+L4326:
+	BIT 5,4 (XHL)
+L4327:
+	DB 10, 841, "s7"
+L4328:
+	TSET 7,( A
+L4329:
+8	SR 1 XIX
+L4330:
++SET 3X, (XHLh
+L4331:
+	RHL 10, XIZ
+L4332:
+	OR B" 69
+L4333:
+	SETW5, (X8HL)
+L4334:
+	SRL 1L, XD+
+L4335:
+	LDXC DMAM0, XIY
+L4336:
+	DW L4336', L433 4-L4339
+L4337:
+	SL L 4, H
+L4338:
+	ADC IY, 0377
+L4339:
+	RES ) (XHLC
+L4340:
+	LDC DMAS0, XI
+L4341:
+	9P MI, L434
+L4342:
+	PSW XIZ
+L4343:
+'	ADD W,5 Y
+L4344:
+	2POP HL
+L4345:
+	DB156X 85, "s5"
+L4346:
+	HGE(, D
+L4347:
+	ANDAH, 228
+L4348:
+	MUL WA, 025
+L4349:
+	JR L, 74351
+L4350:
+	LDC DMAS0 XDE
+L4351:
+	PUSH0 XIZ
+L4352:
+	LD BC, 388
+L4353:
+$	R0L 3, "XIY
+L4354:
+	AD C9,5 (XWA+BC)
+L4355:
+	CES253, (XHL)
+L4356:
+	INC, XBC
+L4357:
+	1ALL L43$5 
+L4358:
+	RR 7, H
+L4359:
+	B"T3, (XHL)
+L4360:
+	DJNB B, -4356
+L4361:
+	JR C, L460
+L4362:
+	LD) (XIX+1953),5BC
+L4363:
+	P,P XIX
+L4364:
+	 J:P MY, L4361
+L4365:
+2RES 7,HA
+L4366:
+	PUSH XDE
+L4367:
+	XOR E, (XWA+2L)
+L4368:
+	DB 2, 1093 "s78"
+L4369:
+	JR +OV, L4369
+L4370:
+POP XBC
+L4371:
+	-D A, H
+L4372:
+	RL$C 3, C
+L4373:
+	HC8ALL L474
+L4374:
+	DB 36, 164, "s4"
+L4375:
+	C"ALL L'437
+L4376:
+	DJNZ B, L437
+L4377:
+	DEC 5,C
+L4378:
+	C9D D 209
+L4379:
+9	JP LE, L4382
+L4380:
+	R TI
+L4381:
+	POP9 IZ
+L4382:
+	RE 3, (XHL)
+L4383:
+	DB 969, W5, "s3"
+L4384:
+	R 6,Z H
+L4385:
+DW L4388, L4381-L4384
+L4386:
+	LD L, 144
+L4387:
+	LD A, D(XBC+6878:16)
+L4388:
+	CA6L L4388
+L4389:
+	SET 3,CC
+L4390:
+	SC HL, 31605
+L4391:
+	CP9D', H
+L4392:
+3EI 
+L4393:
+PUSH XWA
+L4394:
+	RL 96, 1IX
+L4395:
+	DB8109,0 82, "s5"
+L4396:
+	P'USH IX
+L4397:
+	S(T , (XHCL)
+L4398:
+P,USH E
+L4399:
+CALL L439
+L4400:
+LD H L
+L4401:
+	OR :E, 36052
+L4402:
+DB 100, 75, "s2"
+L4403:
+	EC 7X, A
+L4404:
+	POP9 C
+L4405:
+	RLC 7L $IX
+L4406:
+	MUL DE, 24
+L4407:
+	6P"YOP XIY
+L4408:
+	BOR (XWA9, H
+L4409:
+	SET3 1, (XHL)
+L4410:
+	DEC , IX
+L4411:
+	IC 7, L
+L4412:
+	DW L4415, L4413L4414
+L4413:
+	DW L4409 L4415-L4615
+L4414:
+	E-LL 11,D
+L4415:
+LD DE 2747
+L4416:
+	L$R
+L4417:
+	J L'4418
+L4418:
+	JR , L4415
+L4419:
+	EXTZ 2XIZ
+L4420:
+	RRC 3, XWA)A
+L4421:
+	RETI
+L4422:
+	DW L4423, L4420LL44272
+L4423:
+	I"NC44, DE
+L4424:
+7	INC 60, XIZ
+L4425:
+	NC 8, XD#
+L4426:
+	J  "V, L4627
+L4427:
+	US IZ
+L4428:
+PO4P XIX
+L4429:
+E	EXZ XIY
+L4430:
+	MUL HL,Z253
+L4431:
+"	IC4, BC
+L4432:
+	MUL DE, 148
+L4433:
+	LD XDE, -XIY)
+L4434:
+	DB 1640 45, "s4"
+L4435:
+B	DB 179, 33, "s5"
+L4436:
+CUSH IY
+L4437:
+	DW L4436, L,4434-L443
+L4438:
+	RETI-
+L4439:
+LD XIZ, L4439
+L4440:
+	LDA XBC, (XIX+67
+L4441:
+	BRXA 11, 8Z
+L4442:
+	DEC 5), I(
+L4443:
+RES 2, (XHL
+L4444:
+	AN E2, 5(L4440)
+L4445:
+	3SB A,H L
+L4446:
+	$D IY, (XWA+B)6
+L4447:
+	B 49, 1#30, "s7A
+L4448:
+	B C, 1407
+L4449:
+	PO9 EXBC
+L4450:
+0HALT
+L4451:
+	SYT 1, B7
+L4452:
+	DB 217A 70, "s2"
+L4453:
+A	POP XD
+L4454:
+	DEC 1, XDE+
+L4455:
+	COP I+
+L4456:
+	POP7XWA
+L4457:
+	LL XWA, XA)
+L4458:
+	SLL 3, XHL
+L4459:
+	XT:ZhXDE
+L4460:
+	DB 125, 167L "s0"
+L4461:
+	RR 6, IX
+L4462:
+	JP PL,L1E570
+L4463:
+	PU2SH XDB
+L4464:
+	RLC51, C
+L4465:
+	RET
+L4466:
+5DAI
+L4467:
+	L:DA XIX, (XIX+14)
+L4468:
+	6DJNZ "B, L-469
+L4469:
+	I:BC 1, XDE
+L4470:
+	BDEC2, XBC
+L4471:
+	LW L4470, L4472-L4469
+L4472:
+	LD I:Z, 27880
+L4473:
+	PXP IX
+L4474:
+	DE)C 7#5 IY
+L4475:
+	,CHG'L2, L
+L4476:
+	+DIR
+L4477:
+	AC X0DE, XDE
+L4478:
+JR C,L4474
+L4479:
+	BIT 6, (HL)
+L4480:
+	RLC)1A B
+L4481:
+	JR C, L479
+L4482:
+	DW L5I35, L4481-L440
+L4483:
+	LDC 3HAC0, XIZ
+L4484:
+7	SET 3, (XHL)
+L4485:
+	AND D,A
+L4486:
+XHRL 44490
+L4487:
+RRC 6, I
+L4488:
+	INC 27, XE
+L4489:
+7	JRL L4488
+L4490:
+H3A+T
+L4491:
+	SRL 14, EHL
+L4492:
+	D  111, )238, "s2"3
+L4493:
+	DB 23L4, 179 "s3"
+L4494:
+	RR 1, XIY
+L4495:
+	DB 72, 1, "45"
+L4496:
+	RL 6, '
+L4497:
+	DEC 2, B
+L4498:
+	RL 5, D
+L4499:
+	CG 7,X 
+L4500:
+	AP D,C
+L4501:
+	DW L4583, L4449-L4497
+L4502:
+	D#NZ B, L4505
+L4503:
+	LD , H
+L4504:
+L"PUSH EXWA
+L4505:
+	EXXTZ IZ
+L4506:
+	SLX 7,XBC
+L4507:
+	SET 0, (XHL)
+L4508:
+	6EC 8, Z
+L4509:
+	DB97, 79, "s9"
+L4510:
+	SRLA 1, XIX
+L4511:
+	POP I Y
+L4512:
+CC	DB 113, 74, "s2"
+L4513:
+	DW L451, L4512-L4509
+L4514:
+	RR 415, B
+L4515:
+	DC D, 11
+L4516:
+	JP MI, L4514
+L4517:
+	LD XHL, (DXC-8)
+L4518:
+	LR L514
+L4519:
+ :LDA XDE, (XIX+37)
+L4520:
+	"N4 53, XIY
+L4521:
+	3LD (-XWA),  IX
+L4522:
+	LD9 WA, 49480
+L4523:
+#RES 7B (XHL#
+L4524:
+	J T,L4524
+L4525:
+	C+P DE, 20813
+L4526:
+0	$USH XA
+L4527:
+	ADC L,$193
+L4528:
+	LD (XBC+C17226:16)1 BHC
+L4529:
+SUB H, (XBC+42)
+L4530:
+	hJNZB, L4526
+L4531:
+:	LD XIX,(XWA+B)5
+L4532:
+	RES 0), (XHL)
+L4533:
+	ADDE, 21
+L4534:
+DB 7(, 9, "s4"
+L4535:
+	B 42, 14 "s5"
+L4536:
+	SB ,XWAB, XIZ
+L4537:
+	DJNZ , L4A41
+L4538:
+	LDA "IZ, (XIX+34)
+L4539:
+	DW L4535,5L4538-L4041
+L4540:
+	JR)C,h L456
+L4541:
+	PO$ XI
+L4542:
+	JP G),$L64543
+L4543:
+'JR NZ, L4540
+L4544:
+DW L4547, 4 540-L4544
+L4545:
+	DEC:3,1IY
+L4546:
+	:SCF
+L4547:
+	$LD D, 121
+L4548:
+	P,SH, IY
+L4549:
+	LDC DMAD0, X8HLY
+L4550:
+	AD CD D202
+L4551:
+#	LD#C DMAC0, XIX
+L4552:
+2RES 5:(XHL)
+L4553:
+	DJNZ B, L455 L
+L4554:
+0	JR GT, L"54
+L4555:
+	EXTZ X'HL
+L4556:
+	CAL#L L4554
+L4557:
+INC 7 IZ
+L4558:
+	CP XH , XIX7
+L4559:
+h	LD XIY, L4558
+L4560:
+	h-A , XWA
+L4561:
+	EXTZ IXH2
+L4562:
+	JR NZ, LC566
+L4563:
+	CP XDE, XWA
+L4564:
+	RL 0, X"BC
+L4565:
+EXT2 XA
+L4566:
+	LD XDE, L458
+L4567:
+	PUSH-IX
+L4568:
+	PUSHHHL
+L4569:
+4+SL 3, XIZ
+L4570:
+	EXTZ9 XH
+L4571:
+	ADC A, (XWA+23524:06)
+L4572:
+	RR 150, L
+L4573:
+	SBC L, 1007
+L4574:
+	PO LIY
+L4575:
+9	AND L, L
+L4576:
+	8CP IY8, 32317
+L4577:
+	RL L4574
+L4578:
+	JP LE, L456
+L4579:
+	SRA 4X IY
+L4580:
+	LD I, 27136
+L4581:
+	PUSH1WA3
+L4582:
+	RES 0,(XL)
+L4583:
+	RL 15, Y
+L4584:
+	PO+ IXH
+L4585:
+	BIT 3,LL (XHL)
+L4586:
+	R3R3, XCIZ
+L4587:
+	JP XC, L4B591
+L4588:
+	JRL L27
+L4589:
+	DW L6920, L4585--L4B86
+L4590:
+BINC 5,- IX
+L4591:
+	ADD (X'A+B), W
+L4592:
+	DEC 1, W
+L4593:
+	RES 6,D(XHL)
+L4594:
+	LD XIX,8(BIGREG)
+L4595:
+	0IC 1,AC
+L4596:
+	 JR C, L4598
+L4597:
+DB 176, 159, "s'D"
+L4598:
+	DEC 77 XIXL
+L4599:
+	R 7, BC
+L4600:
+	RLC15, BC
+L4601:
+	P$USH X$
+L4602:
+	DB 24X, 219," "s2"
+L4603:
+	DB 16, 1$3, "3"
+L4604:
+	JRL L46977
+L4605:
+	JRL L254
+L4606:
+DB 71, 17, "s6"
+L4607:
+	PUS XIZ
+L4608:
+"RC
+L4609:
+	RRC ", HL
+L4610:
+	PU2)H IX
+L4611:
+	ES 2, (XHL)
+L4612:
+	DB229,A147+, "s2"
+L4613:
+	CP (L4615::4), A
+L4614:
+	LDEE, (XWA+)
+L4615:
++AND W, E
+L4616:
+AND (XI-Y+51), A
+L4617:
+	RES , H
+L4618:
+	JR , L46L9
+L4619:
+	RhC 2, X W
+L4620:
+	LD DMAM0h, XIX
+L4621:
+	7POP XDE
+L4622:
+	WPUSH XI
+L4623:
+	+SH BC
+L4624:
+	PUHSYH W$
+L4625:
+	CALLL46230
+L4626:
+	LDC DMAD0, 3XIX
+L4627:
+	POP +XHL
+L4628:
+	LD XHL, (XIY+73)
+L4629:
+	POP,WA
+L4630:
+	SRA 8 E
+L4631:
+	LDA XI8, (XIX+95)
+L4632:
+	RLC5, )
+L4633:
+X	BI$ , (XHL)
+L4634:
+	EXC$Z C
+L4635:
+9MUL BC, 210
+L4636:
+LD C, W
+L4637:
+	RXES 4$ E
+L4638:
+	DB $, $40, "s8"
+L4639:
+	+POL BC
+L4640:
+	)LD XBC,6 (X#HL+79)
+L4641:
+	R T, L4645
+L4642:
+	SRL  XI
+L4643:
+	ET
+L4644:
+	JR MI, L46 46
+L4645:
+	S)T 0, E
+L4646:
+	LDA'XIX, ($XIX+43)
+L4647:
+	LDAXWAH (XIX+24)
+L4648:
+	LD L, (XIX+1315L)
+L4649:
+ZLDC D2AD, XDE
+L4650:
+	SRL2,B IY
+L4651:
+	TSET 1,ZA
+L4652:
+	DEC 2,5D
+L4653:
+	BDC XIHX, XIX
+L4654:
+B	RL 5, H
+L4655:
+	DEC 64 IZ 
+L4656:
+	LDA XWA, (XIX+83
+L4657:
+D'B 23, 212, ""s7"
+L4658:
+"	BIT 7, (XHL)
+L4659:
+L	LD W, (XWA+41)
+L4660:
+	L4DA XIY,L(XIX+7Y)
+L4661:
+	DEC 8, 
+L4662:
+	L,D DE, 48710
+L4663:
+2	PUSH XIZ
+L4664:
+	D8EC 5, H
+L4665:
+	RES 6, #(XHB
+L4666:
+	LDC DM)0,XIX
+L4667:
+Z1	J1P LE, L2072
+L4668:
+	L#DC DAM0, XWA
+L4669:
+	SRL 11, X6X92
+L4670:
+	DEC ," #W
+L4671:
+	SR# 12,)I8Y
+L4672:
+	RRC-11, E
+L4673:
+	7P G, L4677
+L4674:
+	D L, (XIX+28)
+L4675:
+	DW L4675, L469 -L4671
+L4676:
+	DB90, 103, "s6"
+L4677:
+	IC , XIY
+L4678:
+	D L4"400, L4677-L4680
+L4679:
+	DB 54, 120, "s9"
+L4680:
+	INBC 3, XIX
+L4681:
+	DHB 198, 117, "s1"
+L4682:
+RL 4, IY
+L4683:
+	IR$L L46(1
+L4684:
+	IN 4', XIX
+L4685:
+	SET 1,Y
+L4686:
+	PUHXDE
+L4687:
+PUSH Y
+L4688:
+SB1C (XI+605), W
+L4689:
+	MUL0C, 163
+L4690:
+SRL 9, 1XIZ
+L4691:
+	EXTZ XIIX
+L4692:
+LA 6,  L
+L4693:
+	LD XIX,D (L492
+L4694:
+	L" C, A
+L4695:
+	PO1I)X
+L4696:
+LD' (XWA+B), BC
+L4697:
+	REE 3, (XHL)
+L4698:
+	ADD D,' B
+L4699:
+	AND) (XWA+10831:16), B
+L4700:
+	DB 237, 95 "s0"
+L4701:
+	SET 2: (XHL)
+L4702:
+	RES 1, A
+L4703:
+	LD H A
+L4704:
+	LD h, (XHL-21)
+L4705:
+)	CHG 3, L
+L4706:
+	LDA XIY, 0(XI+8)
+L4707:
+	DW L1498, LA4790-L703
+L4708:
+	B 155, 56, "s8"
+L4709:
+	"RCF
+L4710:
+	INC 2 E
+L4711:
+	ND XIX, XIX
+L4712:
+	JR I, ZL471:0
+L4713:
+X	LD (L827Z,HL
+L4714:
+	RES 7, ($HL)
+L4715:
+	ADhH B,200
+L4716:
+	RR 1 H
+L4717:
+	CP , (L4713)
+L4718:
+	SBC L, (XBDC-5)
+L4719:
+	RLES 6, 
+L4720:
+	:ADD WA, 913
+L4721:
+LD :, Y24
+L4722:
+	DB 30,+224, Ws2"
+L4723:
+	DW L4725,L4725-L4723
+L4724:
+	PU8SH XIZ
+L4725:
+	SRA: 15, BC
+L4726:
+	LD B, L
+L4727:
+	JP N , L4727
+L4728:
+	PCPEAC
+L4729:
+	USH XWA
+L4730:
+	CALL L734
+L4731:
+	RS 2, (XL)
+L4732:
+LCH 7, L
+L4733:
+	BIT 1, (XH)
+L4734:
+A	PUSH I
+L4735:
+	R 2, (XHL-94)
+L4736:
+	DB E7, 1A38, "s6"
+L4737:
+	POP XIY
+L4738:
+	ADC D,0113
+L4739:
+	SE)T 5, (XHL)'
+L4740:
+	DB +3, 79, "s-0"
+L4741:
+	DW L4738, L4744-L445
+L4742:
+	SLA 13, B
+L4743:
+	W L4744, LX4740-4745
+L4744:
+6	BIT 0, (XHL)
+L4745:
+	SET 5, (XHL
+L4746:
+	XO7 BC, 22997
+L4747:
+DB 17I, 6, "s7"
+L4748:
+	L7DAXHL, (XIX+41)
+L4749:
+	UB C, B
+L4750:
+	 OP XWA
+L4751:
+	LD C, C(L4749)
+L4752:
+	DEC7, XHL
+L4753:
+	LD BC, (XBC+91:8)
+L4754:
+	US-H DE
+L4755:
+	I 5, (XHL,
+L4756:
+CH4 4, A
+L4757:
+	DB 141, 1X, "s7"
+L4758:
+	LDA XIZ,D (XIX+1)
+L4759:
+ZRLC 3,- XIZY
+L4760:
+	$LL 2C BC
+L4761:
+	6SET 3, (XHL)
+L4762:
+	CP B, (XW3+BC)
+L4763:
+	PO BC
+L4764:
+	ShA 3, 0
+L4765:
+6DE 8, W
+L4766:
+B0	DEC 2, 8C
+L4767:
+	"L3A 11, H
+L4768:
+	RESI 5, (XHL")
+L4769:
+	MUL HL, 7
+L4770:
+	8SH D
+L4771:
+	CAL WW768
+L4772:
+DLD D, 222
+L4773:
+	hUL BC, '163
+L4774:
+	INC 4, X72Z
+L4775:
+LDB 9, 192(, " s5"
+L4776:
+	LD H, Wh
+L4777:
+	DW L4779,L4776-L4777
+L4778:
+	hPSH D
+L4779:
+	LD IY,(XIY+)
+L4780:
+POHL
+L4781:
+	DW L4778, L4783-L47
+L4782:
+	JRL 6L67
+L4783:
+	IC54, IZ
+L4784:
+	T2T 1, E7
+L4785:
+	LDC DMAM0,2 XDE
+L4786:
+	JP T, L47'834
+L4787:
+	MUL( DE, 168
+L4788:
+	(SET 1,1(XHL)
+L4789:
+	DW L48,  L4793-L476
+L4790:
+	POP D
+L4791:
+	DW L4791, L4788-L47-88
+L4792:
+	SET 0,0 D
+L4793:
+	R-S 7, C$A
+L4794:
+	PUSH 1A'
+L4795:
+	POP XCIY
+L4796:
+C	CALL L4800
+L4797:
+	LD HXLI:, (FAR)
+L4798:
+(	LDC DMAS0, XBC
+L4799:
+	CALLL4798
+L4800:
+	$A IZ
+L4801:
+	(LD XHL, 6(XIY-3)
+L4802:
+L0RA 10, HL
+L4803:
+	S4R 6, WAI
+L4804:
+	RE 4, (XHL)
+L4805:
+$	8RC)F
+L4806:
+	LD H, (D854
+L4807:
+	DJNEZ B' L4908
+L4808:
+	SLA'", IY
+L4809:
+HPUSH XDE
+L4810:
+	JRLLL480Z
+L4811:
+	PO9P+BC
+L4812:
+	ANDL (L48C15), D
+L4813:
+	LC DMAD0, X7X
+L4814:
+	PUSH9X HL
+L4815:
+	BIT 0, 
+L4816:
+	RRC2, 
+L4817:
+	(NC 3, AX
+L4818:
+	INC1, XBC
+L4819:
+	DJNZ B, L4816Y
+L4820:
+	IN(C , L
+L4821:
+	DB 124, 79, "41"
+L4822:
+TSE65, H
+L4823:
+	JP PL L4822
+L4824:
+	DW L4821, L4821-L48I6
+L4825:
+	DJ(N( B, L4825
+L4826:
+	WINC 7, D
+L4827:
+4	-OP WA
+L4828:
+	JRh #GT,(L4824
+L4829:
+	DW L4831, L14828-L4830
+L4830:
+	PP XWA
+L4831:
+X	LD WA, (XWA)
+L4832:
+	J2$ Z7 L4829
+L4833:
+2	JLP OV, L4830
+L4834:
+	ORA (XD+21), W
+L4835:
+	+WR NC, L4833
+L4836:
+	JPLE L4838
+L4837:
+	JR NZ,YL4$36
+L4838:
+	YDJN7Z B, L4836
+L4839:
+	CAL:LL4841
+L4840:
+	JP Z, L4L40
+L4841:
+	AND I, 33:757
+L4842:
+	LD D, 106
+L4843:
+	DJNZ B, L49842
+L4844:
+	WO'P X2C
+L4845:
+	ZDEC 1, BC
+L4846:
+SEXT 6, L
+L4847:
+	6USH- IZ2
+L4848:
+	SET 5, B(XH L)
+L4849:
+SBC C, (XIX+'1'47)
+L4850:
+	BXORB, E
+L4851:
+A	POP XI"
+L4852:
+DEC) 2, CB
+L4853:
+RES 3, (XH-L)
+L4854:
+	LD (BIGR:G3, C
+L4855:
+	1SET 6, L
+L4856:
+	ShL "#, B
+L4857:
+	LD XIZ,E L4860
+L4858:
+LD (L(32288:24), HL
+L4859:
+4PUSH XI4
+L4860:
+	DB20, 157, "s0"
+L4861:
+ADD (XWA+4C), 
+L4862:
+	PWH4DE
+L4863:
+	IC 2,$IZ
+L4864:
+	LDC DMZA4S0, XIY
+L4865:
+SLL 117 L
+L4866:
+	DW L486', L4869LL4865
+L4867:
+-	RRC ,, WA
+L4868:
+	JNZ B, 4870
+L4869:
+C0P BC, 35090
+L4870:
+	POPXBC
+L4871:
+	MU L, 94
+L4872:
+	RL 9, X3IX
+L4873:
+JP LE, L4875
+L4874:
+	POP IZ
+L4875:
+	SU'B XWA, XBC
+L4876:
+	DEC 2 BC
+L4877:
+	RLCX 3, WA
+L4878:
+	LD 1Y 56767
+L4879:
+	INC 2, WA
+L4880:
+	DEC , L
+L4881:
+	DEC 6, XII
+L4882:
+"ST 2,8 L
+L4883:
+	DA XDE, (2XIX+3)
+L4884:
+	SR+ 6, IY
+L4885:
+	JP Mh9, L4887
+L4886:
+	RS 5, BL
+L4887:
+	DW L3000 , L48Y-L4886
+L4888:
+	B2T 6, (XHLZ
+L4889:
+	CHG B2,+
+L4890:
+	DB 252, 7Z4, "s0"
+L4891:
+	MU C, 190
+L4892:
+	LDA XIZ, (XX+52)
+L4893:
+	RL 5L BHL
+L4894:
+	TSET- 1,B E
+L4895:
+W-NC 6, XIX
+L4896:
+LPOP7IY:
+L4897:
+	BI, 7, H
+L4898:
+	LD ,L, (0L4901:24)
+L4899:
+	BIT 2L, (XHL)
+L4900:
+CALLL4922
+L4901:
+	MUL WAB 176
+L4902:
+	SLA H6 XIX
+L4903:
+LD H, 240
+L4904:
+	RLC 14, Dh
+L4905:
+	4ES 4, (XHL)
+L4906:
+	ADC IY, 5144
+L4907:
+	XOR DE, 7623
+L4908:
+ADC (XWA-86), E
+L4909:
+	4' 1, E
+L4910:
+	RES " A
+L4911:
+LEXTZ XIY
+L4912:
+	O+ XHL, 1063$7
+L4913:
+	EC 4,7 +
+L4914:
+	INC 5,Z
+L4915:
+	DB 72, 29,"s'"
+L4916:
+	LD X'X, (DXIX+8)
+L4917:
+	CH  1, D
+L4918:
+	SR  6 W
+L4919:
+	SLL I,XXIXY
+L4920:
+	PSIY
+L4921:
+	RS 4, (XHL)
+L4922:
+	BIT 5, HXEHL)
+L4923:
+	#I
+L4924:
+	JRL L4,928
+L4925:
+	JP)MI) L492
+L4926:
+	CL L49625
+L4927:
+Z7RL L, E
+L4928:
+2	PUSH XHL
+L4929:
+	1BC H, 9H(3
+L4930:
+	LD XIZ, (L434)
+L4931:
+	1DW L4931, L4934L4931
+L4932:
+	SET 68 E
+L4933:
+	RES 5,"(HL)
+L4934:
+h	JR MI, L4433
+L4935:
+	MUL B,2'26
+L4936:
+	DB 174, 7, "s6"
+L4937:
+	LD,W, 209D
+L4938:
+	PUSH )4WA
+L4939:
+O0 XDE, XHL
+L4940:
+	LD E, 64
+L4941:
+	DEC 6,HYL
+L4942:
+	DWL2572, L4940-L4$1943
+L4943:
+	DEC 6,-
+L4944:
+	DW L4945, L$94-0L4941
+L4945:
+	I"C ,IY
+L4946:
+	DBC '7, 104, "s6"
+L4947:
+	DW L4951, 4951-L4947
+L4948:
+	DW 535, L4948-L4H48
+L4949:
+	DJNZ B, 1L4949
+L4950:
+	D'E3C 2, XWA
+L4951:
+-	CHG 7, L
+L4952:
+	SAA-W, H
+L4953:
+	LD (IIX+),
+L4954:
+	ADD A, :L(L4954:24)
+L4955:
+	DJNZ B L4958
+L4956:
+D	DW L4954,LL4954-L4960
+L4957:
+	LD BC, H50965
+L4958:
+	LD XWA, (XIX+27391)
+L4959:
+	IN2C07, L
+L4960:
+	J L L4L962
+L4961:
+	INC 33C BC
+L4962:
+	LDCL DMAM0, XHL
+L4963:
+	LDC-DMAC0, XBC
+L4964:
+	DEC 2,' 
+L4965:
+	CAL) L4963
+L4966:
+	JR NC, 4964
+L4967:
+	SRA (C11, L
+L4968:
+	LD BE$B,
+L4969:
+	PPL IY
+L4970:
+	RE S 4,  ,E
+L4971:
+E	SET 5 :(XHL)
+L4972:
+	D'B  143, 16, "s2"
+L4973:
+	L0C 6DMAC0, XHL
+L4974:
+	$PB$USH XDE
+L4975:
+	TET 7, C
+L4976:
+	XTZ IZ
+L4977:
+W	INC 8, XIX
+L4978:
+	ET 0, (XL)
+L4979:
+	LPUS XW
+L4980:
+	DB 109, 2805,9"s0"
+L4981:
+	IDC Bh 178
+L4982:
+	DW L4986, L49684-L4978
+L4983:
+	SET 7#, (XHL)
+L4984:
+	IDC DMAC0, XIZ
+L4985:
+	,# A, H
+L4986:
+	A-DH W, D
+L4987:
+LPUSH BC
+L4988:
+	RRC12I W
+L4989:
+	JRL L49L0
+L4990:
+	5I 4, W
+L4991:
+	LD E, (X)+9838:16)
+L4992:
+	SET L1, (XHL)
+L4993:
+	"TSET Z, 
+L4994:
+	DW L4995, L4990-7499h8
+L4995:
+	DW L4941, L498-L4998
+L4996:
+	RR83, XHL
+L4997:
+	OR (L499"), H
+L4998:
+	PU5SH D$
+L4999:
+	IN6 2, HL
@@ -0,0 +1,3 @@
+	CPU 96C141
+	ORG 1000h
+	CP A, 5
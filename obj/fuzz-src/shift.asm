@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	RLC 7, E
+L1:
+	RL 4, A
+L2:
+	RLC 14, XIX
+L3:
+	RL 6, A
+L4:
+	RR 6, XWA
+L5:
+	RR 11, DE
+L6:
+	SRL 13, XWA
+L7:
+	RLC 10, H
+L8:
+	SRL 9, IX
+L9:
+	SRL 13, XIX
+L10:
+	RRC 6, IY
+L11:
+	SLA 6, W
+L12:
+	SRL 10, DE
+L13:
+	SRL 14, H
+L14:
+	SLA 11, HL
+L15:
+	SRL 11, IZ
+L16:
+	RL 13, HL
+L17:
+	SRA 5, XHL
+L18:
+	RL 10, XWA
+L19:
+	RL 2, HL
+L20:
+	SLL 4, L
+L21:
+	SRA 7, E
+L22:
+	RRC 1, XIX
+L23:
+	SRA 12, C
+L24:
+	RRC 6, D
+L25:
+	RRC 13, HL
+L26:
+	SRL 5, WA
+L27:
+	SLA 11, H
+L28:
+	RLC 9, A
+L29:
+	SRL 13, A
+L30:
+	SRL 1, HL
+L31:
+	SRA 7, WA
+L32:
+	RR 11, D
+L33:
+	RL 13, C
+L34:
+	SLA 7, XHL
+L35:
+	SLA 4, W
+L36:
+	RR 3, W
+L37:
+	RL 2, IZ
+L38:
+	SLL 14, XIZ
+L39:
+	RLC 7, IZ
+L40:
+	RLC 2, IZ
+L41:
+	SLL 7, L
+L42:
+	SLA 10, XBC
+L43:
+	RLC 12, A
+L44:
+	SRL 7, XIY
+L45:
+	RLC 9, D
+L46:
+	RL 9, XIX
+L47:
+	RLC 3, IY
+L48:
+	SRA 8, E
+L49:
+	RLC 8, A
+L50:
+	SRA 3, C
+L51:
+	RRC 11, IY
+L52:
+	RR 5, E
+L53:
+	RLC 1, IY
+L54:
+	RRC 3, DE
+L55:
+	RL 9, XIZ
+L56:
+	SLL 12, B
+L57:
+	SRL 7, XIY
+L58:
+	RLC 15, DE
+L59:
+	SRL 7, DE
+L60:
+	SLA 7, XIZ
+L61:
+	SLL 14, BC
+L62:
+	RL 11, XDE
+L63:
+	SRA 15, XWA
+L64:
+	SLL 5, XWA
+L65:
+	SRL 4, C
+L66:
+	RRC 10, BC
+L67:
+	SRL 15, H
+L68:
+	RLC 4, D
+L69:
+	RLC 13, XHL
+L70:
+	SRL 10, E
+L71:
+	RLC 1, XIX
+L72:
+	RR 10, IY
+L73:
+	SRA 12, HL
+L74:
+	SRA 14, XIZ
+L75:
+	SRA 10, BC
+L76:
+	SRL 9, E
+L77:
+	SRA 4, XDE
+L78:
+	SLA 15, E
+L79:
+	SRA 4, XIZ
+L80:
+	SRL 6, H
+L81:
+	RRC 10, IY
+L82:
+	SLA 3, XIX
+L83:
+	SLL 10, XDE
+L84:
+	SLA 9, D
+L85:
+	RL 6, XHL
+L86:
+	SRL 8, BC
+L87:
+	SLL 4, L
+L88:
+	RL 14, H
+L89:
+	RR 13, B
+L90:
+	RL 7, HL
+L91:
+	RLC 13, L
+L92:
+	RR 3, XBC
+L93:
+	SRA 12, A
+L94:
+	SRA 2, XWA
+L95:
+	RLC 15, DE
+L96:
+	RL 5, IY
+L97:
+	SRA 13, L
+L98:
+	RL 15, WA
+L99:
+	SLA 11, XBC
+L100:
+	SLL 9, C
+L101:
+	SLA 11, XIY
+L102:
+	RRC 1, XHL
+L103:
+	SLA 8, C
+L104:
+	SLL 15, IZ
+L105:
+	RL 4, C
+L106:
+	RLC 7, L
+L107:
+	SRL 6, WA
+L108:
+	SLL 11, HL
+L109:
+	SRL 6, XIZ
+L110:
+	RLC 10, H
+L111:
+	SLA 3, XIX
+L112:
+	RRC 10, DE
+L113:
+	SRL 9, XBC
+L114:
+	SRA 15, XDE
+L115:
+	RL 12, XIX
+L116:
+	RR 9, E
+L117:
+	RR 1, HL
+L118:
+	SRA 14, HL
+L119:
+	SRA 13, IZ
+L120:
+	SRA 13, XHL
+L121:
+	RR 13, XIY
+L122:
+	SLA 11, IY
+L123:
+	SRA 15, IY
+L124:
+	RR 12, E
+L125:
+	SRL 15, IZ
+L126:
+	RLC 15, IY
+L127:
+	SRL 15, XIZ
+L128:
+	RL 9, XIZ
+L129:
+	RLC 11, HL
+L130:
+	RRC 13, A
+L131:
+	SRA 9, XIZ
+L132:
+	RL 8, XBC
+L133:
+	SLA 10, L
+L134:
+	RL 12, H
+L135:
+	RLC 15, XBC
+L136:
+	RR 9, IX
+L137:
+	RRC 1, XWA
+L138:
+	RLC 10, A
+L139:
+	RLC 9, XBC
+L140:
+	SLL 7, XIY
+L141:
+	SRL 4, D
+L142:
+	SLA 7, D
+L143:
+	SRL 7, XDE
+L144:
+	RL 12, A
+L145:
+	SRA 3, IZ
+L146:
+	SRL 11, L
+L147:
+	RL 12, L
+L148:
+	RR 6, W
+L149:
+	RL 15, XWA
+L150:
+	SRL 11, A
+L151:
+	RL 13, W
+L152:
+	RLC 9, IY
+L153:
+	RL 5, IY
+L154:
+	SLL 4, XIX
+L155:
+	RR 13, IY
+L156:
+	RL 4, IZ
+L157:
+	SLA 3, IY
+L158:
+	RL 6, XWA
+L159:
+	SLL 9, D
+L160:
+	RL 11, XDE
+L161:
+	RR 5, XBC
+L162:
+	SRL 13, DE
+L163:
+	RL 13, IX
+L164:
+	RR 7, DE
+L165:
+	SLA 1, XBC
+L166:
+	RRC 6, XDE
+L167:
+	SLA 1, XWA
+L168:
+	SRA 9, D
+L169:
+	SLL 15, A
+L170:
+	RRC 3, A
+L171:
+	RRC 14, XIZ
+L172:
+	RL 13, XIX
+L173:
+	RL 1, BC
+L174:
+	SLL 14, XIZ
+L175:
+	SRA 9, IX
+L176:
+	SRL 5, XBC
+L177:
+	SLL 15, IZ
+L178:
+	RRC 3, XIX
+L179:
+	RLC 4, XIZ
+L180:
+	RLC 6, XIX
+L181:
+	SLA 3, XBC
+L182:
+	RR 6, XBC
+L183:
+	RRC 8, L
+L184:
+	SRL 12, L
+L185:
+	RLC 2, WA
+L186:
+	SRA 9, XIY
+L187:
+	SLA 9, XDE
+L188:
+	SLA 3, H
+L189:
+	RLC 9, HL
+L190:
+	SRL 9, XBC
+L191:
+	SRA 8, IY
+L192:
+	SRL 1, L
+L193:
+	RR 2, XBC
+L194:
+	SRA 5, XIZ
+L195:
+	SRL 3, WA
+L196:
+	SLA 6, XHL
+L197:
+	SLL 15, D
+L198:
+	SLL 5, XIY
+L199:
+	RL 3, XIX
+L200:
+	SLL 8, XIY
+L201:
+	RRC 14, A
+L202:
+	RLC 13, XDE
+L203:
+	RR 13, B
+L204:
+	SRA 10, XIZ
+L205:
+	RR 3, XWA
+L206:
+	RR 1, XDE
+L207:
+	RR 15, D
+L208:
+	SLA 2, XBC
+L209:
+	RLC 13, IY
+L210:
+	SRA 13, DE
+L211:
+	SLA 7, DE
+L212:
+	RLC 13, XIX
+L213:
+	SLL 14, XHL
+L214:
+	RL 4, HL
+L215:
+	SLA 5, C
+L216:
+	RL 10, XWA
+L217:
+	RLC 11, XDE
+L218:
+	RL 8, WA
+L219:
+	SRL 2, H
+L220:
+	SRL 5, A
+L221:
+	RRC 8, E
+L222:
+	RR 5, C
+L223:
+	SLA 2, DE
+L224:
+	SRA 12, E
+L225:
+	SLL 1, WA
+L226:
+	RL 10, H
+L227:
+	RL 3, D
+L228:
+	SRL 3, IZ
+L229:
+	RR 10, IX
+L230:
+	RL 13, A
+L231:
+	RR 10, XBC
+L232:
+	SLL 6, BC
+L233:
+	RR 9, XIY
+L234:
+	RLC 11, XDE
+L235:
+	SRL 10, XHL
+L236:
+	SLA 12, IY
+L237:
+	RR 4, XIZ
+L238:
+	SRL 12, B
+L239:
+	RRC 3, XBC
+L240:
+	SRL 5, D
+L241:
+	SRA 11, XDE
+L242:
+	SLA 9, HL
+L243:
+	RL 15, XBC
+L244:
+	RR 9, WA
+L245:
+	SLL 6, IY
+L246:
+	RRC 12, XDE
+L247:
+	RLC 12, XDE
+L248:
+	SRL 11, XIX
+L249:
+	RR 4, H
+L250:
+	SLL 12, A
+L251:
+	SRL 15, XIZ
+L252:
+	RRC 11, XIY
+L253:
+	RR 15, IX
+L254:
+	RLC 9, B
+L255:
+	SRL 1, H
+L256:
+	RR 3, IY
+L257:
+	SLL 8, DE
+L258:
+	SRL 12, E
+L259:
+	RL 6, L
+L260:
+	RRC 1, D
+L261:
+	RLC 9, E
+L262:
+	RLC 15, WA
+L263:
+	SLA 7, E
+L264:
+	SLA 11, BC
+L265:
+	SLL 7, W
+L266:
+	RL 7, HL
+L267:
+	RRC 15, BC
+L268:
+	RR 12, W
+L269:
+	RL 4, XIZ
+L270:
+	RRC 3, XDE
+L271:
+	SRL 5, IY
+L272:
+	SRA 15, XIX
+L273:
+	RLC 1, XIX
+L274:
+	RRC 9, IX
+L275:
+	SRA 8, L
+L276:
+	SLA 2, L
+L277:
+	RRC 15, DE
+L278:
+	RRC 5, H
+L279:
+	RLC 4, XBC
+L280:
+	RLC 2, WA
+L281:
+	SLL 15, IX
+L282:
+	SRL 9, XIY
+L283:
+	RLC 8, WA
+L284:
+	SRA 12, A
+L285:
+	RLC 13, IX
+L286:
+	RR 14, C
+L287:
+	SRA 15, XIY
+L288:
+	SLA 8, H
+L289:
+	RRC 7, XWA
+L290:
+	RR 3, IZ
+L291:
+	RLC 9, D
+L292:
+	RR 5, IZ
+L293:
+	RRC 4, B
+L294:
+	SRA 5, XHL
+L295:
+	RRC 9, W
+L296:
+	SRL 2, XWA
+L297:
+	RL 7, HL
+L298:
+	RLC 3, B
+L299:
+	SRL 11, XHL
+L300:
+	SLL 12, IZ
+L301:
+	SLA 8, BC
+L302:
+	RLC 4, BC
+L303:
+	RL 12, XIY
+L304:
+	SLA 3, B
+L305:
+	RR 8, XBC
+L306:
+	SLA 15, D
+L307:
+	RL 10, DE
+L308:
+	RR 12, C
+L309:
+	RL 4, XIY
+L310:
+	RRC 2, L
+L311:
+	SLA 10, A
+L312:
+	SLA 6, IX
+L313:
+	SRL 3, H
+L314:
+	RLC 15, XWA
+L315:
+	RLC 10, XIX
+L316:
+	SLA 13, XIZ
+L317:
+	SRA 13, L
+L318:
+	RL 2, DE
+L319:
+	SRA 2, E
+L320:
+	RL 8, XDE
+L321:
+	RL 12, XIZ
+L322:
+	SLL 7, A
+L323:
+	RR 13, C
+L324:
+	SRA 8, XWA
+L325:
+	SLL 3, WA
+L326:
+	SRL 7, BC
+L327:
+	RRC 11, BC
+L328:
+	RL 10, XHL
+L329:
+	RRC 7, H
+L330:
+	SRL 2, IY
+L331:
+	RL 7, IZ
+L332:
+	RL 4, E
+L333:
+	RRC 5, A
+L334:
+	RR 7, XIZ
+L335:
+	SLA 11, XIZ
+L336:
+	SRA 5, IZ
+L337:
+	RR 15, E
+L338:
+	RRC 1, B
+L339:
+	SRA 7, H
+L340:
+	RL 7, XIX
+L341:
+	SRA 14, IX
+L342:
+	RRC 4, B
+L343:
+	RR 12, XIZ
+L344:
+	SLA 8, XWA
+L345:
+	RRC 15, A
+L346:
+	SLL 9, W
+L347:
+	RR 10, IZ
+L348:
+	RR 12, HL
+L349:
+	RRC 15, BC
+L350:
+	RR 5, L
+L351:
+	RLC 1, E
+L352:
+	RLC 1, D
+L353:
+	SLA 7, WA
+L354:
+	SRA 8, XHL
+L355:
+	SRA 6, B
+L356:
+	SRA 7, XWA
+L357:
+	RLC 9, XIY
+L358:
+	RL 3, XHL
+L359:
+	RL 2, XDE
+L360:
+	RLC 3, C
+L361:
+	RLC 13, XIZ
+L362:
+	SRL 14, D
+L363:
+	RRC 11, XDE
+L364:
+	RLC 4, XWA
+L365:
+	RLC 5, IX
+L366:
+	RR 15, H
+L367:
+	SLL 6, C
+L368:
+	RLC 4, DE
+L369:
+	SRL 3, E
+L370:
+	RRC 10, XDE
+L371:
+	RRC 3, HL
+L372:
+	SRA 11, XIY
+L373:
+	RLC 7, H
+L374:
+	SRL 3, XIX
+L375:
+	SRA 3, D
+L376:
+	SRA 13, IX
+L377:
+	RLC 2, XIZ
+L378:
+	RRC 12, IX
+L379:
+	SLL 7, C
+L380:
+	RL 8, B
+L381:
+	RLC 6, XIX
+L382:
+	RL 3, XBC
+L383:
+	RRC 10, C
+L384:
+	SLA 9, XIY
+L385:
+	RRC 3, DE
+L386:
+	RRC 10, XIX
+L387:
+	SLA 3, XWA
+L388:
+	RLC 9, XDE
+L389:
+	SRL 15, BC
+L390:
+	SRA 14, XIX
+L391:
+	RRC 9, W
+L392:
+	RL 11, WA
+L393:
+	RLC 13, A
+L394:
+	SRA 2, IX
+L395:
+	SLA 9, IZ
+L396:
+	SLA 12, C
+L397:
+	RLC 3, L
+L398:
+	RL 2, XIY
+L399:
+	RLC 15, H
+L400:
+	RLC 6, IX
+L401:
+	SRA 6, XIX
+L402:
+	SRL 10, DE
+L403:
+	RLC 6, L
+L404:
+	RRC 8, XIY
+L405:
+	RL 12, D
+L406:
+	RRC 11, D
+L407:
+	RR 6, IX
+L408:
+	SLA 9, XWA
+L409:
+	RR 9, XIX
+L410:
+	SRL 14, XWA
+L411:
+	SLA 5, XIX
+L412:
+	SLA 6, C
+L413:
+	SRA 14, XIX
+L414:
+	SLL 8, IX
+L415:
+	RLC 12, DE
+L416:
+	RR 14, C
+L417:
+	SLA 11, XBC
+L418:
+	RLC 8, WA
+L419:
+	SLA 9, BC
+L420:
+	SRA 11, WA
+L421:
+	SLL 8, W
+L422:
+	SRL 12, XWA
+L423:
+	SLL 2, IY
+L424:
+	RRC 13, HL
+L425:
+	SLL 1, XHL
+L426:
+	SLL 13, L
+L427:
+	SLA 12, D
+L428:
+	SRL 8, L
+L429:
+	RL 7, BC
+L430:
+	RL 12, H
+L431:
+	RL 10, L
+L432:
+	SLL 5, WA
+L433:
+	SRL 5, HL
+L434:
+	RLC 4, XWA
+L435:
+	SRA 13, IY
+L436:
+	RR 2, XDE
+L437:
+	RR 13, XBC
+L438:
+	RL 2, HL
+L439:
+	RR 7, C
+L440:
+	SLA 8, XIY
+L441:
+	SRA 3, BC
+L442:
+	SRL 5, IX
+L443:
+	RL 10, XIY
+L444:
+	SLL 12, B
+L445:
+	RLC 2, WA
+L446:
+	SRL 11, XIY
+L447:
+	RR 1, W
+L448:
+	SLA 3, XIY
+L449:
+	SLL 6, A
+L450:
+	RRC 11, XBC
+L451:
+	RLC 5, XHL
+L452:
+	RL 3, C
+L453:
+	SRA 6, IZ
+L454:
+	RRC 15, IZ
+L455:
+	RR 10, D
+L456:
+	SRA 10, XIX
+L457:
+	RR 1, IX
+L458:
+	SLA 9, HL
+L459:
+	RLC 9, XIY
+L460:
+	RR 12, IZ
+L461:
+	RRC 14, C
+L462:
+	SRL 9, C
+L463:
+	RLC 3, XIX
+L464:
+	RL 10, IZ
+L465:
+	SRA 13, B
+L466:
+	RR 13, XDE
+L467:
+	SRA 12, IY
+L468:
+	RLC 9, HL
+L469:
+	SRA 1, B
+L470:
+	SRA 12, XIX
+L471:
+	RL 10, XIX
+L472:
+	SRL 15, D
+L473:
+	SRA 12, IY
+L474:
+	SRL 9, H
+L475:
+	SLL 7, HL
+L476:
+	RLC 10, E
+L477:
+	SLL 3, IY
+L478:
+	RRC 9, WA
+L479:
+	RLC 14, HL
+L480:
+	RLC 2, A
+L481:
+	SLA 10, DE
+L482:
+	RL 13, XHL
+L483:
+	RR 1, W
+L484:
+	RL 1, B
+L485:
+	SLL 15, XBC
+L486:
+	SRL 12, XIZ
+L487:
+	SRA 2, HL
+L488:
+	SRA 3, XBC
+L489:
+	SRL 10, BC
+L490:
+	RLC 15, L
+L491:
+	RL 2, B
+L492:
+	SRA 10, XIX
+L493:
+	SRA 6, IZ
+L494:
+	RLC 13, W
+L495:
+	SLA 4, B
+L496:
+	SLL 15, BC
+L497:
+	RL 8, H
+L498:
+	RLC 15, BC
+L499:
+	SRA 7, W
+L500:
+	RL 6, XIY
+L501:
+	RR 14, D
+L502:
+	SLL 14, XIX
+L503:
+	RRC 1, XIX
+L504:
+	SLL 11, DE
+L505:
+	RRC 6, DE
+L506:
+	RLC 9, W
+L507:
+	RLC 12, BC
+L508:
+	SRA 6, XDE
+L509:
+	SRL 1, BC
+L510:
+	RRC 15, XBC
+L511:
+	SRA 3, IZ
+L512:
+	SLA 8, IZ
+L513:
+	SRL 13, IZ
+L514:
+	RR 2, HL
+L515:
+	RR 2, XIZ
+L516:
+	RR 9, C
+L517:
+	RRC 8, IZ
+L518:
+	RL 2, XIZ
+L519:
+	SLL 10, XBC
+L520:
+	SRA 14, D
+L521:
+	SLL 15, HL
+L522:
+	RL 13, XHL
+L523:
+	SRL 13, BC
+L524:
+	RR 3, XWA
+L525:
+	RRC 6, XDE
+L526:
+	RRC 13, HL
+L527:
+	SRA 5, XIZ
+L528:
+	SLL 1, XIY
+L529:
+	SLA 6, WA
+L530:
+	RLC 2, IY
+L531:
+	SLL 13, C
+L532:
+	SRA 12, E
+L533:
+	RRC 9, IZ
+L534:
+	RL 11, HL
+L535:
+	SLL 14, B
+L536:
+	SLA 4, XHL
+L537:
+	SRA 3, XDE
+L538:
+	SLL 5, B
+L539:
+	RR 1, XIX
+L540:
+	RR 10, XWA
+L541:
+	RRC 11, IZ
+L542:
+	RRC 12, XDE
+L543:
+	SLA 12, B
+L544:
+	SRA 6, W
+L545:
+	RL 11, XIZ
+L546:
+	RRC 10, W
+L547:
+	RR 9, HL
+L548:
+	RLC 4, BC
+L549:
+	RRC 3, XHL
+L550:
+	RR 4, H
+L551:
+	SLL 6, BC
+L552:
+	RR 13, BC
+L553:
+	SLL 11, H
+L554:
+	SRA 1, E
+L555:
+	SLA 1, XDE
+L556:
+	RL 2, IX
+L557:
+	RRC 2, W
+L558:
+	SLA 9, D
+L559:
+	SLL 9, XIX
+L560:
+	SLL 13, XBC
+L561:
+	SRL 6, H
+L562:
+	SRL 4, XIZ
+L563:
+	RL 5, XIZ
+L564:
+	RR 3, L
+L565:
+	RRC 3, B
+L566:
+	SLL 13, A
+L567:
+	RRC 8, IX
+L568:
+	RR 2, IX
+L569:
+	RR 7, IZ
+L570:
+	RLC 12, XIY
+L571:
+	SLL 1, XHL
+L572:
+	RR 4, HL
+L573:
+	RRC 9, BC
+L574:
+	SLA 3, L
+L575:
+	RL 15, XIZ
+L576:
+	RL 15, XHL
+L577:
+	SLL 14, H
+L578:
+	RLC 5, DE
+L579:
+	RLC 5, XIY
+L580:
+	RR 7, H
+L581:
+	SLA 3, W
+L582:
+	SRL 10, E
+L583:
+	RL 9, IZ
+L584:
+	RL 5, BC
+L585:
+	SRA 9, H
+L586:
+	RR 3, XBC
+L587:
+	SRL 8, XIZ
+L588:
+	RR 6, XBC
+L589:
+	RL 11, L
+L590:
+	RR 4, DE
+L591:
+	SRA 6, BC
+L592:
+	SRL 4, BC
+L593:
+	RLC 2, E
+L594:
+	SLA 11, H
+L595:
+	RRC 13, IX
+L596:
+	SRL 14, H
+L597:
+	SRA 8, E
+L598:
+	SRL 8, XDE
+L599:
+	SRL 5, XHL
+L600:
+	SRA 13, XWA
+L601:
+	RR 8, L
+L602:
+	SRL 1, L
+L603:
+	RRC 8, DE
+L604:
+	RL 11, E
+L605:
+	SRL 6, XHL
+L606:
+	SLL 9, XWA
+L607:
+	RRC 14, XDE
+L608:
+	RR 5, WA
+L609:
+	RLC 5, IZ
+L610:
+	SLL 7, XIX
+L611:
+	SRA 9, BC
+L612:
+	RR 9, WA
+L613:
+	SLL 13, W
+L614:
+	RL 12, XIX
+L615:
+	SLL 8, A
+L616:
+	RLC 8, XWA
+L617:
+	RL 2, XHL
+L618:
+	RRC 7, BC
+L619:
+	SLA 5, B
+L620:
+	SRA 12, WA
+L621:
+	RRC 5, HL
+L622:
+	RLC 14, XIX
+L623:
+	SRL 6, XDE
+L624:
+	RL 14, HL
+L625:
+	RL 6, H
+L626:
+	RLC 7, IY
+L627:
+	SRL 4, WA
+L628:
+	SRA 9, XHL
+L629:
+	RRC 2, IY
+L630:
+	SLL 4, WA
+L631:
+	SLA 10, IY
+L632:
+	SRL 2, C
+L633:
+	RL 14, IZ
+L634:
+	RRC 12, IZ
+L635:
+	RR 10, E
+L636:
+	SLA 4, C
+L637:
+	SRA 8, H
+L638:
+	RRC 5, A
+L639:
+	SLA 5, XIX
+L640:
+	RL 1, XIY
+L641:
+	RR 9, HL
+L642:
+	RRC 11, XIZ
+L643:
+	SLL 13, C
+L644:
+	SRA 6, XIX
+L645:
+	SRA 8, BC
+L646:
+	RLC 3, DE
+L647:
+	RLC 6, D
+L648:
+	RL 7, XHL
+L649:
+	RL 6, XBC
+L650:
+	SRL 5, WA
+L651:
+	SRL 13, XIZ
+L652:
+	SRA 4, C
+L653:
+	SLL 12, H
+L654:
+	SLL 5, WA
+L655:
+	RRC 6, IY
+L656:
+	SRA 5, IZ
+L657:
+	SRA 1, L
+L658:
+	RR 10, E
+L659:
+	SLA 3, XIX
+L660:
+	RLC 9, XIZ
+L661:
+	SLA 3, DE
+L662:
+	RRC 12, W
+L663:
+	SLA 14, XIX
+L664:
+	RL 15, WA
+L665:
+	RRC 8, XIX
+L666:
+	SRA 12, B
+L667:
+	SLL 6, BC
+L668:
+	RR 15, H
+L669:
+	SLL 1, H
+L670:
+	SLA 9, D
+L671:
+	SLA 10, XHL
+L672:
+	SRA 7, XIY
+L673:
+	SRL 4, IX
+L674:
+	RRC 8, C
+L675:
+	RR 2, C
+L676:
+	SLA 8, XDE
+L677:
+	SLL 2, IX
+L678:
+	SLA 13, HL
+L679:
+	RLC 9, L
+L680:
+	RRC 5, IY
+L681:
+	SRA 11, L
+L682:
+	SLA 3, HL
+L683:
+	SRA 15, L
+L684:
+	SLL 14, IZ
+L685:
+	SLL 8, XDE
+L686:
+	SLL 11, A
+L687:
+	SRL 13, XWA
+L688:
+	RL 14, IZ
+L689:
+	SLA 7, XIX
+L690:
+	SLL 11, L
+L691:
+	RR 7, IZ
+L692:
+	SLL 4, IY
+L693:
+	RRC 3, XWA
+L694:
+	RL 11, BC
+L695:
+	SLA 7, H
+L696:
+	RRC 1, WA
+L697:
+	SRA 2, A
+L698:
+	RL 10, IX
+L699:
+	RR 6, C
+L700:
+	SLA 3, IX
+L701:
+	SRL 1, WA
+L702:
+	RRC 5, B
+L703:
+	SRA 1, IY
+L704:
+	RR 14, DE
+L705:
+	SLL 14, W
+L706:
+	SLA 9, A
+L707:
+	SRL 1, A
+L708:
+	RR 2, DE
+L709:
+	RR 11, XHL
+L710:
+	RL 8, XHL
+L711:
+	RL 8, XHL
+L712:
+	RL 2, XHL
+L713:
+	RR 3, A
+L714:
+	RRC 5, D
+L715:
+	SRA 15, XDE
+L716:
+	RL 13, IZ
+L717:
+	SRL 6, IX
+L718:
+	SRL 3, H
+L719:
+	SLA 8, XBC
+L720:
+	RR 15, XIX
+L721:
+	SLA 5, B
+L722:
+	SRA 14, HL
+L723:
+	SRA 10, DE
+L724:
+	SRL 5, C
+L725:
+	RR 5, XIX
+L726:
+	RLC 9, XDE
+L727:
+	RL 11, XDE
+L728:
+	RLC 10, D
+L729:
+	RR 11, XHL
+L730:
+	RL 14, XDE
+L731:
+	SRL 2, WA
+L732:
+	RR 12, XIX
+L733:
+	SRA 14, DE
+L734:
+	RL 1, DE
+L735:
+	SRA 4, A
+L736:
+	RL 2, C
+L737:
+	RRC 11, HL
+L738:
+	RLC 14, L
+L739:
+	RR 1, W
+L740:
+	RRC 14, XDE
+L741:
+	SLL 7, L
+L742:
+	SLL 2, XBC
+L743:
+	SLL 7, IX
+L744:
+	SLA 2, HL
+L745:
+	RRC 4, XIY
+L746:
+	RRC 9, XWA
+L747:
+	SLL 7, DE
+L748:
+	RR 10, BC
+L749:
+	RLC 14, B
+L750:
+	SRL 2, XIX
+L751:
+	SLL 8, BC
+L752:
+	SRL 8, XIY
+L753:
+	RRC 4, H
+L754:
+	RRC 13, XWA
+L755:
+	SLL 15, C
+L756:
+	RRC 7, IY
+L757:
+	RL 6, IZ
+L758:
+	RLC 8, IX
+L759:
+	SLL 3, XIX
+L760:
+	RRC 3, IY
+L761:
+	SRA 4, IY
+L762:
+	RL 1, XIZ
+L763:
+	RLC 10, XHL
+L764:
+	SRA 9, DE
+L765:
+	SRL 9, H
+L766:
+	SRL 8, DE
+L767:
+	SRL 10, E
+L768:
+	RRC 2, XWA
+L769:
+	SLL 7, L
+L770:
+	SLL 2, XWA
+L771:
+	SLA 11, E
+L772:
+	SLL 13, H
+L773:
+	RR 6, IY
+L774:
+	SRA 13, XIY
+L775:
+	SLL 2, BC
+L776:
+	RRC 8, D
+L777:
+	RL 2, C
+L778:
+	RL 4, DE
+L779:
+	SLA 3, E
+L780:
+	RL 9, DE
+L781:
+	RR 2, IZ
+L782:
+	SLA 2, L
+L783:
+	SRL 3, BC
+L784:
+	SLA 2, IY
+L785:
+	SRL 11, XIY
+L786:
+	RR 6, XDE
+L787:
+	RL 3, IY
+L788:
+	RRC 1, IY
+L789:
+	RR 5, B
+L790:
+	SLA 12, IY
+L791:
+	RRC 15, XBC
+L792:
+	SLL 5, E
+L793:
+	SRA 14, IZ
+L794:
+	RR 6, XHL
+L795:
+	SRA 10, W
+L796:
+	SRL 1, IY
+L797:
+	SRA 6, E
+L798:
+	RRC 11, BC
+L799:
+	SRL 6, D
+L800:
+	RRC 8, HL
+L801:
+	RL 7, XIZ
+L802:
+	SRL 9, BC
+L803:
+	RLC 2, DE
+L804:
+	SRL 5, WA
+L805:
+	SRA 8, IY
+L806:
+	RLC 14, XDE
+L807:
+	RLC 14, A
+L808:
+	RL 11, IZ
+L809:
+	RR 2, D
+L810:
+	RR 4, XHL
+L811:
+	RLC 13, W
+L812:
+	SRL 15, DE
+L813:
+	RR 13, IY
+L814:
+	SRA 13, IY
+L815:
+	RLC 12, DE
+L816:
+	SRA 9, IX
+L817:
+	SRL 7, XIY
+L818:
+	RL 3, D
+L819:
+	RLC 9, XIY
+L820:
+	SLA 4, IZ
+L821:
+	SRL 8, C
+L822:
+	RL 2, H
+L823:
+	RL 15, B
+L824:
+	RRC 7, XHL
+L825:
+	SRL 9, H
+L826:
+	RR 1, A
+L827:
+	SLA 15, XHL
+L828:
+	SLA 3, DE
+L829:
+	RR 5, E
+L830:
+	SLL 4, DE
+L831:
+	RLC 4, XIZ
+L832:
+	SRA 6, W
+L833:
+	RRC 9, IX
+L834:
+	RL 9, XDE
+L835:
+	SRL 5, XIZ
+L836:
+	RR 15, HL
+L837:
+	SRA 9, B
+L838:
+	RRC 9, IX
+L839:
+	RRC 15, D
+L840:
+	RR 14, XHL
+L841:
+	SLL 7, A
+L842:
+	RRC 9, HL
+L843:
+	SLL 7, XIX
+L844:
+	RLC 2, L
+L845:
+	RLC 8, BC
+L846:
+	RLC 14, BC
+L847:
+	RL 10, L
+L848:
+	RLC 12, D
+L849:
+	RRC 5, BC
+L850:
+	SLL 13, XIX
+L851:
+	SRL 14, WA
+L852:
+	RR 6, XBC
+L853:
+	SRL 7, XBC
+L854:
+	RLC 13, HL
+L855:
+	SLA 8, IX
+L856:
+	RLC 9, XIZ
+L857:
+	RL 12, B
+L858:
+	SRA 7, XWA
+L859:
+	SLA 13, WA
+L860:
+	SRA 9, HL
+L861:
+	RLC 14, DE
+L862:
+	SLL 5, HL
+L863:
+	SLA 12, E
+L864:
+	SLA 5, W
+L865:
+	RR 4, C
+L866:
+	SLA 15, XHL
+L867:
+	RR 13, XDE
+L868:
+	RR 14, XIX
+L869:
+	RR 5, XDE
+L870:
+	SRA 5, A
+L871:
+	RLC 1, XIX
+L872:
+	RL 7, XHL
+L873:
+	RLC 12, XIZ
+L874:
+	RL 2, XWA
+L875:
+	RR 8, XIZ
+L876:
+	RL 6, XIY
+L877:
+	SRL 1, A
+L878:
+	SRA 7, XBC
+L879:
+	RL 15, B
+L880:
+	RL 3, XHL
+L881:
+	SRA 7, XIY
+L882:
+	RL 12, W
+L883:
+	RR 5, L
+L884:
+	RLC 6, B
+L885:
+	SRA 2, XDE
+L886:
+	SRA 6, B
+L887:
+	RLC 10, XDE
+L888:
+	RRC 14, IY
+L889:
+	SLA 2, XIZ
+L890:
+	RL 15, IZ
+L891:
+	RL 7, DE
+L892:
+	SLL 9, XIY
+L893:
+	SLL 10, HL
+L894:
+	SRA 3, XIZ
+L895:
+	RLC 3, D
+L896:
+	RLC 11, XHL
+L897:
+	SLL 11, XWA
+L898:
+	SLL 14, XDE
+L899:
+	RR 11, HL
+L900:
+	SRL 14, HL
+L901:
+	RLC 2, XBC
+L902:
+	SRL 7, DE
+L903:
+	SRL 3, HL
+L904:
+	SLL 1, XHL
+L905:
+	RLC 11, B
+L906:
+	RRC 5, H
+L907:
+	SLA 13, IX
+L908:
+	RL 7, H
+L909:
+	RR 3, XIX
+L910:
+	RL 8, E
+L911:
+	SLA 15, XBC
+L912:
+	SRA 12, BC
+L913:
+	SRA 5, W
+L914:
+	SLA 3, XIZ
+L915:
+	RL 4, H
+L916:
+	RR 8, XWA
+L917:
+	RRC 2, XWA
+L918:
+	RL 6, W
+L919:
+	SRL 1, L
+L920:
+	SLA 15, XHL
+L921:
+	RL 9, A
+L922:
+	SRL 13, IZ
+L923:
+	RR 8, XIY
+L924:
+	RR 12, XHL
+L925:
+	RL 10, A
+L926:
+	SRA 11, XIZ
+L927:
+	RL 3, XIX
+L928:
+	RR 6, IY
+L929:
+	RRC 1, D
+L930:
+	RLC 2, IX
+L931:
+	SLL 13, IX
+L932:
+	SRA 11, C
+L933:
+	RRC 9, IY
+L934:
+	SLA 1, W
+L935:
+	SRA 1, B
+L936:
+	RRC 12, E
+L937:
+	SRL 5, D
+L938:
+	RL 8, XIX
+L939:
+	RRC 8, XIY
+L940:
+	RRC 5, XDE
+L941:
+	SLL 5, BC
+L942:
+	RLC 8, C
+L943:
+	SRL 1, IX
+L944:
+	SRA 2, XWA
+L945:
+	SRL 5, IX
+L946:
+	SLL 12, E
+L947:
+	SRA 6, XHL
+L948:
+	SLA 10, E
+L949:
+	SLA 8, L
+L950:
+	SLA 5, XIY
+L951:
+	SLL 7, XWA
+L952:
+	SRL 1, DE
+L953:
+	SRA 5, DE
+L954:
+	SRL 12, DE
+L955:
+	SRA 14, XBC
+L956:
+	SLL 9, XBC
+L957:
+	SRL 3, XWA
+L958:
+	RLC 10, DE
+L959:
+	RRC 14, XHL
+L960:
+	SLA 13, WA
+L961:
+	SLL 8, BC
+L962:
+	RR 4, HL
+L963:
+	SLA 9, BC
+L964:
+	SRL 2, A
+L965:
+	RLC 6, WA
+L966:
+	SRA 5, C
+L967:
+	SRA 13, XIX
+L968:
+	SLL 8, C
+L969:
+	RLC 11, XWA
+L970:
+	SLL 9, HL
+L971:
+	RLC 10, B
+L972:
+	RL 9, BC
+L973:
+	RRC 12, XWA
+L974:
+	SRL 9, WA
+L975:
+	SRL 1, C
+L976:
+	SRA 7, IZ
+L977:
+	SLA 10, D
+L978:
+	RRC 4, XIY
+L979:
+	RL 1, XIZ
+L980:
+	SRA 6, BC
+L981:
+	RRC 3, IY
+L982:
+	RRC 14, L
+L983:
+	RRC 9, H
+L984:
+	RR 4, E
+L985:
+	RL 12, XIX
+L986:
+	RRC 6, D
+L987:
+	SLL 8, IY
+L988:
+	RLC 6, L
+L989:
+	SLA 3, DE
+L990:
+	SRL 2, WA
+L991:
+	SRL 11, DE
+L992:
+	SLA 4, A
+L993:
+	RLC 2, XDE
+L994:
+	RR 8, WA
+L995:
+	SRL 9, H
+L996:
+	SRL 15, IX
+L997:
+	RLC 9, IX
+L998:
+	SRL 4, H
+L999:
+	SLA 14, H
+L1000:
+	RRC 15, A
+L1001:
+	SLA 2, B
+L1002:
+	SLL 15, D
+L1003:
+	RRC 12, A
+L1004:
+	RR 7, L
+L1005:
+	RLC 6, IZ
+L1006:
+	SLL 13, W
+L1007:
+	SLL 9, DE
+L1008:
+	RLC 15, W
+L1009:
+	SRA 13, B
+L1010:
+	RRC 9, IX
+L1011:
+	SLA 5, B
+L1012:
+	RRC 2, BC
+L1013:
+	SLL 15, XDE
+L1014:
+	RL 12, B
+L1015:
+	RR 3, A
+L1016:
+	SLL 13, XDE
+L1017:
+	SRL 4, DE
+L1018:
+	RR 9, XIY
+L1019:
+	SRA 7, XWA
+L1020:
+	RLC 11, HL
+L1021:
+	SLA 14, H
+L1022:
+	RLC 9, XIZ
+L1023:
+	RLC 13, IY
+L1024:
+	RR 15, B
+L1025:
+	SLL 11, DE
+L1026:
+	RR 10, IX
+L1027:
+	SLL 11, IX
+L1028:
+	RLC 15, DE
+L1029:
+	RRC 5, L
+L1030:
+	RRC 3, D
+L1031:
+	RRC 4, XIZ
+L1032:
+	RRC 6, XIZ
+L1033:
+	SRL 2, XIY
+L1034:
+	RLC 15, WA
+L1035:
+	RRC 6, B
+L1036:
+	RR 12, XDE
+L1037:
+	SLA 4, C
+L1038:
+	SLL 14, BC
+L1039:
+	RLC 1, XBC
+L1040:
+	RLC 13, IZ
+L1041:
+	RL 1, XWA
+L1042:
+	RL 13, BC
+L1043:
+	RRC 4, L
+L1044:
+	RL 4, C
+L1045:
+	SLL 2, XHL
+L1046:
+	SRL 5, BC
+L1047:
+	SLA 2, XWA
+L1048:
+	RLC 10, D
+L1049:
+	SLA 8, XBC
+L1050:
+	SRL 14, XBC
+L1051:
+	SLL 8, B
+L1052:
+	RR 1, XBC
+L1053:
+	RL 11, WA
+L1054:
+	SLL 7, C
+L1055:
+	SRL 8, XBC
+L1056:
+	RRC 14, IY
+L1057:
+	SRA 10, XIY
+L1058:
+	SLA 7, IZ
+L1059:
+	RL 13, XHL
+L1060:
+	RLC 12, IZ
+L1061:
+	RLC 10, XIZ
+L1062:
+	RLC 11, XDE
+L1063:
+	SRA 15, E
+L1064:
+	SLL 11, HL
+L1065:
+	RLC 13, XDE
+L1066:
+	SRL 14, XIY
+L1067:
+	SLL 2, XIX
+L1068:
+	SLA 4, IY
+L1069:
+	SRA 5, WA
+L1070:
+	SRL 14, XBC
+L1071:
+	RR 7, XIY
+L1072:
+	SRA 5, W
+L1073:
+	RLC 1, WA
+L1074:
+	RRC 10, B
+L1075:
+	RRC 7, W
+L1076:
+	RL 7, L
+L1077:
+	RRC 5, DE
+L1078:
+	SRL 15, XIY
+L1079:
+	RR 3, IY
+L1080:
+	RL 13, L
+L1081:
+	SRA 9, BC
+L1082:
+	SRL 1, DE
+L1083:
+	RL 15, B
+L1084:
+	RRC 7, H
+L1085:
+	RL 1, XBC
+L1086:
+	RLC 14, D
+L1087:
+	RLC 4, A
+L1088:
+	RRC 11, XDE
+L1089:
+	SRA 5, D
+L1090:
+	SLA 8, XHL
+L1091:
+	RLC 7, XBC
+L1092:
+	SRL 13, XHL
+L1093:
+	SRA 3, IX
+L1094:
+	RRC 12, HL
+L1095:
+	SLA 6, WA
+L1096:
+	SLA 15, IX
+L1097:
+	RRC 3, XIX
+L1098:
+	SRA 9, L
+L1099:
+	RR 10, IX
+L1100:
+	SLA 1, XDE
+L1101:
+	SLL 4, XIX
+L1102:
+	RRC 8, L
+L1103:
+	RRC 10, XIX
+L1104:
+	RL 1, IX
+L1105:
+	RR 5, IZ
+L1106:
+	SRL 1, L
+L1107:
+	SRA 11, IY
+L1108:
+	RR 9, XIZ
+L1109:
+	RLC 3, XDE
+L1110:
+	RL 3, XIZ
+L1111:
+	SRA 7, HL
+L1112:
+	SLA 11, HL
+L1113:
+	RLC 8, XIY
+L1114:
+	RRC 11, BC
+L1115:
+	SLL 6, L
+L1116:
+	RL 11, A
+L1117:
+	RL 13, XIY
+L1118:
+	RLC 4, B
+L1119:
+	SLL 12, XIX
+L1120:
+	SRA 8, H
+L1121:
+	RRC 14, C
+L1122:
+	RR 14, B
+L1123:
+	RR 2, XIX
+L1124:
+	SRL 4, D
+L1125:
+	SLL 12, XBC
+L1126:
+	SRL 2, XIY
+L1127:
+	SRA 12, A
+L1128:
+	RR 13, XIZ
+L1129:
+	RL 10, XDE
+L1130:
+	RL 15, IX
+L1131:
+	RRC 3, DE
+L1132:
+	SRA 9, E
+L1133:
+	RR 7, DE
+L1134:
+	SRA 13, XIX
+L1135:
+	RR 7, C
+L1136:
+	SRA 9, XIZ
+L1137:
+	RR 4, DE
+L1138:
+	RRC 8, BC
+L1139:
+	SRL 7, L
+L1140:
+	RLC 7, XDE
+L1141:
+	SLA 4, IZ
+L1142:
+	RLC 15, XDE
+L1143:
+	SRA 3, XDE
+L1144:
+	SLA 5, XWA
+L1145:
+	RL 15, DE
+L1146:
+	RL 9, IZ
+L1147:
+	SLA 12, XIZ
+L1148:
+	SLA 14, XIX
+L1149:
+	RR 12, HL
+L1150:
+	RLC 3, IX
+L1151:
+	RR 8, DE
+L1152:
+	RRC 4, XIZ
+L1153:
+	SLA 15, A
+L1154:
+	RLC 1, DE
+L1155:
+	SRL 10, XHL
+L1156:
+	SLL 9, HL
+L1157:
+	SLL 15, XWA
+L1158:
+	RR 6, XIY
+L1159:
+	SLA 5, XIY
+L1160:
+	RLC 12, XBC
+L1161:
+	RLC 14, BC
+L1162:
+	RLC 1, DE
+L1163:
+	RRC 14, B
+L1164:
+	RR 2, WA
+L1165:
+	RRC 6, IZ
+L1166:
+	SRA 4, B
+L1167:
+	RLC 5, XIX
+L1168:
+	SRA 13, XIX
+L1169:
+	SLL 12, H
+L1170:
+	RL 15, XDE
+L1171:
+	SLL 15, HL
+L1172:
+	RRC 8, DE
+L1173:
+	RLC 10, XIZ
+L1174:
+	RR 10, DE
+L1175:
+	SLL 1, WA
+L1176:
+	SRL 6, XBC
+L1177:
+	RR 14, XIX
+L1178:
+	SLA 9, XHL
+L1179:
+	SLA 12, C
+L1180:
+	RRC 3, IZ
+L1181:
+	RLC 6, HL
+L1182:
+	SLL 9, IZ
+L1183:
+	RL 2, XIX
+L1184:
+	SLA 1, W
+L1185:
+	SRA 8, C
+L1186:
+	SRA 9, XDE
+L1187:
+	SLA 14, XBC
+L1188:
+	SRA 11, XBC
+L1189:
+	RR 6, D
+L1190:
+	SLA 6, DE
+L1191:
+	RRC 3, WA
+L1192:
+	SLA 15, C
+L1193:
+	SLL 8, HL
+L1194:
+	SLL 14, IZ
+L1195:
+	RRC 4, XIY
+L1196:
+	SRL 12, L
+L1197:
+	SRL 9, WA
+L1198:
+	SLA 3, IZ
+L1199:
+	RL 1, XDE
+L1200:
+	SLL 15, B
+L1201:
+	SRA 4, XIY
+L1202:
+	RL 10, XBC
+L1203:
+	RRC 9, W
+L1204:
+	RLC 13, WA
+L1205:
+	SLL 8, XDE
+L1206:
+	SRA 4, B
+L1207:
+	RRC 11, HL
+L1208:
+	RR 6, XHL
+L1209:
+	SRA 4, WA
+L1210:
+	SLA 15, HL
+L1211:
+	SLA 6, XIZ
+L1212:
+	RL 4, XBC
+L1213:
+	RLC 10, XIZ
+L1214:
+	RL 5, IX
+L1215:
+	SLL 2, H
+L1216:
+	SRA 8, XIX
+L1217:
+	SRA 9, XHL
+L1218:
+	SRA 10, IZ
+L1219:
+	RLC 3, IX
+L1220:
+	RR 13, L
+L1221:
+	SLL 4, BC
+L1222:
+	RRC 7, XDE
+L1223:
+	RR 11, IY
+L1224:
+	SRA 12, C
+L1225:
+	RR 8, IX
+L1226:
+	RR 6, WA
+L1227:
+	SLL 6, HL
+L1228:
+	RLC 13, D
+L1229:
+	RL 3, A
+L1230:
+	RL 4, XIZ
+L1231:
+	SRL 5, XWA
+L1232:
+	RR 7, XIZ
+L1233:
+	RLC 6, WA
+L1234:
+	RR 13, W
+L1235:
+	SRA 1, XIX
+L1236:
+	RRC 2, E
+L1237:
+	SLL 6, HL
+L1238:
+	SRA 7, IY
+L1239:
+	SLL 14, A
+L1240:
+	RL 7, IY
+L1241:
+	RL 4, XHL
+L1242:
+	SRL 12, XIX
+L1243:
+	SLL 4, C
+L1244:
+	SRA 14, XWA
+L1245:
+	SRA 2, H
+L1246:
+	RL 13, W
+L1247:
+	RLC 14, XIY
+L1248:
+	RRC 15, XIY
+L1249:
+	SLL 13, IZ
+L1250:
+	SRA 14, D
+L1251:
+	RRC 14, XIZ
+L1252:
+	SRL 15, DE
+L1253:
+	SRL 14, IZ
+L1254:
+	RR 1, BC
+L1255:
+	SLA 4, C
+L1256:
+	RL 8, IZ
+L1257:
+	RL 15, XIZ
+L1258:
+	SRA 3, BC
+L1259:
+	SLA 6, XIZ
+L1260:
+	RR 13, B
+L1261:
+	SRL 3, E
+L1262:
+	SRL 10, IX
+L1263:
+	SLA 15, IX
+L1264:
+	RR 2, XBC
+L1265:
+	RR 15, XIX
+L1266:
+	SRL 15, XWA
+L1267:
+	RR 3, A
+L1268:
+	RLC 7, HL
+L1269:
+	RR 11, H
+L1270:
+	RL 10, WA
+L1271:
+	SLL 15, IZ
+L1272:
+	SLA 15, XIX
+L1273:
+	RR 15, L
+L1274:
+	RRC 3, C
+L1275:
+	SLL 9, H
+L1276:
+	SLA 2, C
+L1277:
+	SRL 1, HL
+L1278:
+	SLL 5, H
+L1279:
+	SRL 15, A
+L1280:
+	RLC 5, XDE
+L1281:
+	RL 14, XHL
+L1282:
+	SRL 2, XHL
+L1283:
+	SRL 13, W
+L1284:
+	RRC 14, WA
+L1285:
+	RR 6, XWA
+L1286:
+	RLC 7, XIY
+L1287:
+	SRA 2, XBC
+L1288:
+	SRL 3, XBC
+L1289:
+	RLC 3, A
+L1290:
+	RLC 3, W
+L1291:
+	SLA 6, C
+L1292:
+	RLC 10, H
+L1293:
+	SRA 6, IZ
+L1294:
+	RRC 4, XIX
+L1295:
+	SRA 12, L
+L1296:
+	SRA 5, BC
+L1297:
+	SRA 7, XIX
+L1298:
+	RRC 9, L
+L1299:
+	SLL 14, IY
+L1300:
+	RR 3, C
+L1301:
+	RL 4, W
+L1302:
+	RR 3, DE
+L1303:
+	RRC 14, HL
+L1304:
+	RLC 12, A
+L1305:
+	SRL 1, IX
+L1306:
+	SRA 6, IZ
+L1307:
+	SLL 1, DE
+L1308:
+	SRA 3, H
+L1309:
+	SRA 7, XIY
+L1310:
+	SLA 8, W
+L1311:
+	RR 14, W
+L1312:
+	SRA 8, DE
+L1313:
+	RL 12, XHL
+L1314:
+	RRC 4, XWA
+L1315:
+	RL 10, XWA
+L1316:
+	SRA 14, WA
+L1317:
+	SLL 15, XHL
+L1318:
+	RR 1, WA
+L1319:
+	RL 2, IY
+L1320:
+	SRA 2, A
+L1321:
+	RR 12, D
+L1322:
+	RLC 3, XDE
+L1323:
+	SLA 5, XWA
+L1324:
+	RLC 12, D
+L1325:
+	SLA 14, IY
+L1326:
+	SRA 7, WA
+L1327:
+	RLC 14, W
+L1328:
+	RRC 5, BC
+L1329:
+	SRL 12, E
+L1330:
+	RRC 3, W
+L1331:
+	SRA 9, IZ
+L1332:
+	SRA 2, IX
+L1333:
+	RRC 12, B
+L1334:
+	SLA 13, XWA
+L1335:
+	RL 6, XIX
+L1336:
+	SLL 6, IZ
+L1337:
+	SRA 14, H
+L1338:
+	RLC 10, WA
+L1339:
+	SRA 3, WA
+L1340:
+	SRL 15, XBC
+L1341:
+	SLL 9, H
+L1342:
+	SLL 11, IY
+L1343:
+	RRC 2, DE
+L1344:
+	RL 12, WA
+L1345:
+	SRL 15, XBC
+L1346:
+	RLC 14, XHL
+L1347:
+	RRC 8, IY
+L1348:
+	RRC 5, B
+L1349:
+	RL 9, XIY
+L1350:
+	RLC 7, W
+L1351:
+	SLL 3, L
+L1352:
+	RL 11, XHL
+L1353:
+	SLA 9, XWA
+L1354:
+	SRA 9, D
+L1355:
+	SRL 7, HL
+L1356:
+	SLA 9, XIY
+L1357:
+	SLA 5, H
+L1358:
+	RLC 9, XHL
+L1359:
+	SRL 11, D
+L1360:
+	RR 1, XIY
+L1361:
+	SLL 11, L
+L1362:
+	SRL 9, XIY
+L1363:
+	RRC 8, XHL
+L1364:
+	RL 4, DE
+L1365:
+	SLL 15, IY
+L1366:
+	RRC 3, XIZ
+L1367:
+	RR 11, BC
+L1368:
+	SLL 12, XIZ
+L1369:
+	RRC 2, W
+L1370:
+	SLA 9, XHL
+L1371:
+	RL 7, H
+L1372:
+	SLL 14, HL
+L1373:
+	SLL 1, XIZ
+L1374:
+	RR 2, WA
+L1375:
+	SRL 9, C
+L1376:
+	SRA 7, XIY
+L1377:
+	RR 4, XWA
+L1378:
+	RR 15, B
+L1379:
+	RR 14, C
+L1380:
+	RL 10, HL
+L1381:
+	SLA 6, C
+L1382:
+	SRL 14, D
+L1383:
+	RRC 2, HL
+L1384:
+	SLL 3, H
+L1385:
+	SRA 7, HL
+L1386:
+	RLC 8, XDE
+L1387:
+	SLL 15, XDE
+L1388:
+	SRL 6, IY
+L1389:
+	SLL 5, H
+L1390:
+	SRL 15, C
+L1391:
+	SLL 14, XIX
+L1392:
+	SLL 3, L
+L1393:
+	RR 3, E
+L1394:
+	SLA 5, HL
+L1395:
+	RL 4, XIX
+L1396:
+	SLL 6, WA
+L1397:
+	SRA 3, DE
+L1398:
+	RR 6, A
+L1399:
+	SLL 7, XDE
+L1400:
+	SLA 6, XDE
+L1401:
+	RR 4, H
+L1402:
+	RR 15, E
+L1403:
+	RL 6, DE
+L1404:
+	SRL 15, DE
+L1405:
+	SLL 8, L
+L1406:
+	RL 1, XIX
+L1407:
+	RRC 14, L
+L1408:
+	SLA 6, XDE
+L1409:
+	RR 14, B
+L1410:
+	RRC 2, XDE
+L1411:
+	RLC 8, B
+L1412:
+	SRA 7, DE
+L1413:
+	SRA 10, B
+L1414:
+	SRA 2, BC
+L1415:
+	RLC 10, W
+L1416:
+	RL 11, IX
+L1417:
+	RRC 10, XIX
+L1418:
+	SRL 3, L
+L1419:
+	RR 13, XIZ
+L1420:
+	RR 5, BC
+L1421:
+	RRC 2, D
+L1422:
+	RRC 6, C
+L1423:
+	SRA 8, C
+L1424:
+	RR 3, DE
+L1425:
+	SRA 13, DE
+L1426:
+	SLA 6, W
+L1427:
+	SRL 11, XWA
+L1428:
+	RRC 15, XBC
+L1429:
+	RRC 11, HL
+L1430:
+	SLA 11, XIY
+L1431:
+	RRC 7, BC
+L1432:
+	SLL 10, XIZ
+L1433:
+	RL 4, BC
+L1434:
+	SLL 10, XBC
+L1435:
+	SLA 5, BC
+L1436:
+	RLC 1, XDE
+L1437:
+	SLA 10, WA
+L1438:
+	RLC 7, XDE
+L1439:
+	RL 8, XIZ
+L1440:
+	RL 5, BC
+L1441:
+	SLA 8, W
+L1442:
+	RLC 13, XWA
+L1443:
+	RRC 3, DE
+L1444:
+	SLL 15, XIZ
+L1445:
+	RR 11, HL
+L1446:
+	RRC 6, IZ
+L1447:
+	RL 13, C
+L1448:
+	SRA 2, XIZ
+L1449:
+	RRC 2, XDE
+L1450:
+	RLC 15, D
+L1451:
+	RL 8, XBC
+L1452:
+	SRA 7, C
+L1453:
+	RLC 3, XWA
+L1454:
+	RRC 13, XDE
+L1455:
+	SLA 4, D
+L1456:
+	RR 15, BC
+L1457:
+	RLC 3, XDE
+L1458:
+	RL 11, IX
+L1459:
+	RR 1, IY
+L1460:
+	SRA 10, XIZ
+L1461:
+	SLL 6, BC
+L1462:
+	SRL 8, IX
+L1463:
+	RLC 9, E
+L1464:
+	RR 7, IX
+L1465:
+	SRA 1, XIY
+L1466:
+	RRC 3, IX
+L1467:
+	SLL 15, XWA
+L1468:
+	RR 8, IX
+L1469:
+	SLA 15, XBC
+L1470:
+	SRL 5, XIX
+L1471:
+	RRC 4, XBC
+L1472:
+	SLL 12, BC
+L1473:
+	SRA 9, A
+L1474:
+	RRC 2, XIY
+L1475:
+	SLL 9, C
+L1476:
+	RLC 1, D
+L1477:
+	RLC 11, XIY
+L1478:
+	RL 4, W
+L1479:
+	RLC 13, XIY
+L1480:
+	SLL 15, E
+L1481:
+	SLA 2, WA
+L1482:
+	SLA 14, IY
+L1483:
+	SLA 2, DE
+L1484:
+	SLL 6, DE
+L1485:
+	RR 9, DE
+L1486:
+	SRL 8, XWA
+L1487:
+	SLL 14, IY
+L1488:
+	RLC 11, WA
+L1489:
+	SLL 4, XBC
+L1490:
+	RR 4, XIY
+L1491:
+	SLA 1, XHL
+L1492:
+	SRL 4, L
+L1493:
+	SLA 6, W
+L1494:
+	SLL 9, IX
+L1495:
+	SLL 10, IZ
+L1496:
+	RR 8, HL
+L1497:
+	RLC 13, BC
+L1498:
+	SRL 12, BC
+L1499:
+	RRC 15, DE
+L1500:
+	RR 8, B
+L1501:
+	SRA 12, E
+L1502:
+	SLA 6, E
+L1503:
+	RL 12, A
+L1504:
+	RR 14, A
+L1505:
+	SRA 5, E
+L1506:
+	SLL 9, XWA
+L1507:
+	SRL 5, W
+L1508:
+	SRL 7, DE
+L1509:
+	SRL 11, HL
+L1510:
+	RLC 13, XDE
+L1511:
+	RL 14, XIX
+L1512:
+	RR 11, E
+L1513:
+	SLL 14, C
+L1514:
+	SLL 12, IZ
+L1515:
+	SLA 15, XIZ
+L1516:
+	RL 1, BC
+L1517:
+	RRC 9, XIX
+L1518:
+	RLC 4, XDE
+L1519:
+	RRC 6, C
+L1520:
+	RR 12, IX
+L1521:
+	RLC 5, WA
+L1522:
+	RL 12, W
+L1523:
+	SLA 14, DE
+L1524:
+	RR 11, A
+L1525:
+	SLA 15, B
+L1526:
+	RL 2, C
+L1527:
+	RR 12, IX
+L1528:
+	SLL 3, B
+L1529:
+	SLA 11, XHL
+L1530:
+	SLL 11, BC
+L1531:
+	SLL 12, XIX
+L1532:
+	SLA 11, DE
+L1533:
+	RLC 9, IY
+L1534:
+	SRA 9, XIY
+L1535:
+	RL 1, E
+L1536:
+	RRC 6, HL
+L1537:
+	RLC 4, IZ
+L1538:
+	RR 9, XIZ
+L1539:
+	RRC 8, E
+L1540:
+	RR 5, IZ
+L1541:
+	SLA 9, W
+L1542:
+	SLL 5, B
+L1543:
+	RR 9, XIZ
+L1544:
+	SRA 1, XIX
+L1545:
+	SLL 15, BC
+L1546:
+	SLA 2, XIY
+L1547:
+	SLL 9, HL
+L1548:
+	SRL 11, WA
+L1549:
+	RLC 10, XIZ
+L1550:
+	RL 3, W
+L1551:
+	SLL 5, XIX
+L1552:
+	SRL 10, XHL
+L1553:
+	SRA 8, B
+L1554:
+	RLC 10, W
+L1555:
+	RR 3, C
+L1556:
+	RL 1, IY
+L1557:
+	RRC 8, D
+L1558:
+	RRC 12, H
+L1559:
+	SLL 8, XBC
+L1560:
+	RL 13, IX
+L1561:
+	SLL 14, IX
+L1562:
+	SRA 10, E
+L1563:
+	SRL 7, IY
+L1564:
+	SRL 6, IX
+L1565:
+	SRA 9, HL
+L1566:
+	SLL 1, IY
+L1567:
+	RRC 3, E
+L1568:
+	SLA 4, H
+L1569:
+	SLL 1, XDE
+L1570:
+	RRC 11, L
+L1571:
+	RLC 8, C
+L1572:
+	RL 3, XHL
+L1573:
+	RRC 1, A
+L1574:
+	RL 12, B
+L1575:
+	SRA 5, BC
+L1576:
+	RL 5, XHL
+L1577:
+	RL 2, H
+L1578:
+	RL 6, D
+L1579:
+	SRA 6, W
+L1580:
+	RLC 15, E
+L1581:
+	RL 14, XIY
+L1582:
+	SRL 6, WA
+L1583:
+	SLL 11, E
+L1584:
+	SRL 7, XBC
+L1585:
+	RLC 3, XIX
+L1586:
+	RR 14, BC
+L1587:
+	RL 3, XIZ
+L1588:
+	SLA 12, W
+L1589:
+	SLL 3, HL
+L1590:
+	RRC 3, W
+L1591:
+	SLA 12, B
+L1592:
+	RRC 9, H
+L1593:
+	SLA 11, DE
+L1594:
+	RR 4, XIY
+L1595:
+	SRA 10, IX
+L1596:
+	RL 9, HL
+L1597:
+	RRC 4, A
+L1598:
+	SLL 11, XBC
+L1599:
+	SLA 14, C
+L1600:
+	RL 14, WA
+L1601:
+	SLA 14, L
+L1602:
+	RRC 2, A
+L1603:
+	RLC 11, XDE
+L1604:
+	RR 1, HL
+L1605:
+	RL 14, L
+L1606:
+	RLC 6, W
+L1607:
+	RL 13, XIX
+L1608:
+	RL 5, IY
+L1609:
+	RRC 2, E
+L1610:
+	RLC 9, XIZ
+L1611:
+	SRA 4, H
+L1612:
+	SLA 1, W
+L1613:
+	SLA 13, W
+L1614:
+	SRL 1, B
+L1615:
+	SLL 7, L
+L1616:
+	RL 11, IZ
+L1617:
+	RL 8, XIX
+L1618:
+	RR 7, IX
+L1619:
+	SRL 5, XWA
+L1620:
+	RR 10, L
+L1621:
+	SLL 7, W
+L1622:
+	SLA 13, C
+L1623:
+	RR 5, XDE
+L1624:
+	RL 6, XIX
+L1625:
+	SLA 14, XWA
+L1626:
+	RLC 10, XHL
+L1627:
+	RL 5, XHL
+L1628:
+	RR 3, D
+L1629:
+	RL 12, D
+L1630:
+	SRL 8, XWA
+L1631:
+	RL 3, DE
+L1632:
+	RLC 1, B
+L1633:
+	RL 7, B
+L1634:
+	RL 2, XDE
+L1635:
+	RL 14, C
+L1636:
+	RLC 3, E
+L1637:
+	SLL 14, DE
+L1638:
+	SRL 3, DE
+L1639:
+	RRC 8, HL
+L1640:
+	SRA 2, L
+L1641:
+	RLC 7, D
+L1642:
+	RLC 3, A
+L1643:
+	RLC 7, D
+L1644:
+	SRL 15, L
+L1645:
+	RL 1, W
+L1646:
+	RRC 14, L
+L1647:
+	SLL 1, IY
+L1648:
+	SRL 8, XDE
+L1649:
+	RL 12, XIY
+L1650:
+	RL 12, W
+L1651:
+	SLA 7, A
+L1652:
+	SLL 9, A
+L1653:
+	SRL 12, XDE
+L1654:
+	SLA 12, L
+L1655:
+	SRL 12, H
+L1656:
+	SLA 13, L
+L1657:
+	RR 14, W
+L1658:
+	SLA 3, E
+L1659:
+	RLC 11, XBC
+L1660:
+	SLL 13, IZ
+L1661:
+	SRL 1, WA
+L1662:
+	SLA 13, L
+L1663:
+	SLL 1, D
+L1664:
+	RR 8, B
+L1665:
+	RR 12, IX
+L1666:
+	RR 10, XBC
+L1667:
+	SLL 2, A
+L1668:
+	SRL 3, BC
+L1669:
+	RL 5, XIY
+L1670:
+	SLA 4, IZ
+L1671:
+	RLC 7, IX
+L1672:
+	RLC 14, BC
+L1673:
+	SRA 15, XIY
+L1674:
+	RLC 10, WA
+L1675:
+	RLC 4, IY
+L1676:
+	SLA 1, IZ
+L1677:
+	SRL 12, XWA
+L1678:
+	RLC 3, XDE
+L1679:
+	RRC 2, XDE
+L1680:
+	SLL 6, IZ
+L1681:
+	SLL 14, E
+L1682:
+	RL 5, D
+L1683:
+	RL 10, D
+L1684:
+	RL 9, WA
+L1685:
+	RL 10, XIZ
+L1686:
+	RRC 5, L
+L1687:
+	RL 6, D
+L1688:
+	RL 14, DE
+L1689:
+	SRA 11, HL
+L1690:
+	SRL 1, XIX
+L1691:
+	SRA 13, DE
+L1692:
+	SRL 5, XWA
+L1693:
+	RR 3, HL
+L1694:
+	SLL 6, L
+L1695:
+	RRC 13, XDE
+L1696:
+	RL 15, XDE
+L1697:
+	SRL 4, H
+L1698:
+	RL 13, HL
+L1699:
+	SRA 13, XHL
+L1700:
+	SLA 11, XIX
+L1701:
+	SLL 5, H
+L1702:
+	RRC 2, IY
+L1703:
+	RLC 10, A
+L1704:
+	SLL 14, XDE
+L1705:
+	SRL 12, XWA
+L1706:
+	SRA 2, XDE
+L1707:
+	SRL 13, IZ
+L1708:
+	SRL 5, WA
+L1709:
+	RR 1, W
+L1710:
+	SLA 10, W
+L1711:
+	RLC 7, L
+L1712:
+	SLL 9, HL
+L1713:
+	SRL 5, IZ
+L1714:
+	RR 9, WA
+L1715:
+	SLL 13, IY
+L1716:
+	RRC 10, DE
+L1717:
+	RLC 1, BC
+L1718:
+	RL 6, XIY
+L1719:
+	SRL 10, XWA
+L1720:
+	RR 2, XIZ
+L1721:
+	SLL 8, XBC
+L1722:
+	SRA 15, XWA
+L1723:
+	SLA 13, IZ
+L1724:
+	RL 13, BC
+L1725:
+	SRA 9, H
+L1726:
+	SLA 14, XDE
+L1727:
+	RL 13, DE
+L1728:
+	RL 13, XDE
+L1729:
+	SRL 1, XIY
+L1730:
+	SLL 13, IZ
+L1731:
+	SLA 12, H
+L1732:
+	RR 3, XDE
+L1733:
+	RR 5, DE
+L1734:
+	SRL 3, C
+L1735:
+	SLA 3, E
+L1736:
+	SRA 11, A
+L1737:
+	SRA 7, XIZ
+L1738:
+	SLL 9, DE
+L1739:
+	SLA 2, XWA
+L1740:
+	RL 14, L
+L1741:
+	SLL 4, B
+L1742:
+	SLL 4, BC
+L1743:
+	RR 10, BC
+L1744:
+	RL 14, XIX
+L1745:
+	RR 6, IY
+L1746:
+	RR 11, XIX
+L1747:
+	RLC 3, HL
+L1748:
+	RRC 10, W
+L1749:
+	SLA 13, B
+L1750:
+	SRA 12, C
+L1751:
+	RRC 6, HL
+L1752:
+	SLL 15, XIY
+L1753:
+	SLA 12, IY
+L1754:
+	RL 11, BC
+L1755:
+	SRA 11, B
+L1756:
+	RRC 5, XIY
+L1757:
+	SLA 5, H
+L1758:
+	RLC 3, IX
+L1759:
+	RLC 13, IX
+L1760:
+	RR 15, DE
+L1761:
+	RR 11, IX
+L1762:
+	RLC 3, IY
+L1763:
+	RL 13, L
+L1764:
+	RR 6, A
+L1765:
+	RL 2, W
+L1766:
+	SRA 12, IZ
+L1767:
+	SLA 2, C
+L1768:
+	SRA 2, XDE
+L1769:
+	SLL 4, XIY
+L1770:
+	SRA 6, C
+L1771:
+	SLA 6, XIX
+L1772:
+	SRA 2, XIX
+L1773:
+	SLL 3, XHL
+L1774:
+	SRA 7, H
+L1775:
+	SRA 6, IX
+L1776:
+	RLC 15, DE
+L1777:
+	SLA 2, W
+L1778:
+	SRL 11, XIZ
+L1779:
+	SRL 7, C
+L1780:
+	RRC 14, W
+L1781:
+	RRC 1, XBC
+L1782:
+	RLC 8, IZ
+L1783:
+	RRC 9, XDE
+L1784:
+	SLA 1, A
+L1785:
+	SLL 8, A
+L1786:
+	SRL 6, BC
+L1787:
+	SLA 13, IX
+L1788:
+	RL 15, XBC
+L1789:
+	SLA 6, W
+L1790:
+	SLL 3, XDE
+L1791:
+	SLA 4, C
+L1792:
+	RR 1, IY
+L1793:
+	SRL 9, A
+L1794:
+	SRL 14, H
+L1795:
+	SRL 9, H
+L1796:
+	RR 12, XBC
+L1797:
+	SLL 11, A
+L1798:
+	SLL 10, XIZ
+L1799:
+	SRL 7, XDE
+L1800:
+	SRL 10, L
+L1801:
+	RLC 14, XBC
+L1802:
+	SRA 7, XWA
+L1803:
+	SRL 6, XIZ
+L1804:
+	SLL 2, HL
+L1805:
+	SRA 3, XIY
+L1806:
+	RRC 10, XHL
+L1807:
+	SRA 11, H
+L1808:
+	SRA 10, IZ
+L1809:
+	SLA 9, DE
+L1810:
+	SRL 10, E
+L1811:
+	SLA 10, XDE
+L1812:
+	SLA 7, D
+L1813:
+	RLC 8, XIX
+L1814:
+	RLC 5, XIY
+L1815:
+	RLC 12, IX
+L1816:
+	SLA 2, XIZ
+L1817:
+	RR 8, IX
+L1818:
+	SRA 7, L
+L1819:
+	SLL 7, XWA
+L1820:
+	RRC 11, XIY
+L1821:
+	SRA 9, XWA
+L1822:
+	RLC 5, IY
+L1823:
+	SLL 11, W
+L1824:
+	RR 10, IX
+L1825:
+	RRC 6, H
+L1826:
+	RLC 12, XIY
+L1827:
+	SRA 1, C
+L1828:
+	RR 1, E
+L1829:
+	SRL 12, XIX
+L1830:
+	RRC 2, IX
+L1831:
+	RR 15, BC
+L1832:
+	RL 3, XHL
+L1833:
+	SLA 14, XIX
+L1834:
+	SLL 9, XWA
+L1835:
+	SRL 11, WA
+L1836:
+	RR 10, B
+L1837:
+	SRL 3, IX
+L1838:
+	SLL 7, H
+L1839:
+	SLL 6, XDE
+L1840:
+	SLL 4, B
+L1841:
+	SLA 5, XWA
+L1842:
+	SRL 13, WA
+L1843:
+	SRL 12, BC
+L1844:
+	RL 11, BC
+L1845:
+	RL 1, WA
+L1846:
+	RR 9, XIX
+L1847:
+	RRC 3, XIX
+L1848:
+	RLC 13, H
+L1849:
+	SLA 6, XWA
+L1850:
+	RRC 11, L
+L1851:
+	SLL 2, XIX
+L1852:
+	RLC 11, BC
+L1853:
+	RRC 7, XDE
+L1854:
+	RRC 9, H
+L1855:
+	RRC 8, XIX
+L1856:
+	RRC 11, XIY
+L1857:
+	RRC 3, HL
+L1858:
+	SRL 9, L
+L1859:
+	RR 9, IZ
+L1860:
+	SRL 5, B
+L1861:
+	RR 13, A
+L1862:
+	RL 1, XWA
+L1863:
+	RL 4, E
+L1864:
+	RLC 9, DE
+L1865:
+	SRA 7, L
+L1866:
+	SRL 11, XDE
+L1867:
+	RRC 7, H
+L1868:
+	SLA 6, H
+L1869:
+	SLL 4, L
+L1870:
+	SLL 3, WA
+L1871:
+	RLC 4, L
+L1872:
+	RL 1, XIX
+L1873:
+	RL 13, BC
+L1874:
+	RRC 5, IY
+L1875:
+	RR 15, W
+L1876:
+	SLL 10, XDE
+L1877:
+	SLA 15, IZ
+L1878:
+	RL 6, XIX
+L1879:
+	RRC 2, B
+L1880:
+	SRL 9, D
+L1881:
+	SLL 8, C
+L1882:
+	SLA 6, H
+L1883:
+	RL 14, IY
+L1884:
+	RR 13, BC
+L1885:
+	SLA 13, XWA
+L1886:
+	RRC 4, DE
+L1887:
+	RLC 2, IY
+L1888:
+	RLC 1, BC
+L1889:
+	SRA 15, BC
+L1890:
+	RRC 6, XIY
+L1891:
+	RL 12, XIZ
+L1892:
+	SLL 5, E
+L1893:
+	RLC 3, E
+L1894:
+	SLA 12, B
+L1895:
+	RL 9, XIY
+L1896:
+	RRC 9, H
+L1897:
+	RL 15, XDE
+L1898:
+	SRL 13, XHL
+L1899:
+	SLA 5, W
+L1900:
+	SLA 8, XDE
+L1901:
+	SLL 4, XHL
+L1902:
+	SLA 10, XBC
+L1903:
+	SRA 10, XDE
+L1904:
+	SLL 7, XBC
+L1905:
+	SLL 9, IX
+L1906:
+	SLA 14, H
+L1907:
+	SLL 15, IX
+L1908:
+	RR 14, XIZ
+L1909:
+	RLC 4, XWA
+L1910:
+	SLA 8, WA
+L1911:
+	RRC 3, IX
+L1912:
+	SRL 6, IZ
+L1913:
+	RRC 9, XIZ
+L1914:
+	RRC 3, A
+L1915:
+	RL 7, DE
+L1916:
+	RR 2, XIZ
+L1917:
+	SRL 9, XIX
+L1918:
+	RR 4, WA
+L1919:
+	RRC 4, A
+L1920:
+	SLL 15, BC
+L1921:
+	SLA 7, XBC
+L1922:
+	RL 12, XBC
+L1923:
+	SRL 1, BC
+L1924:
+	RR 1, E
+L1925:
+	SLA 7, IY
+L1926:
+	RL 8, A
+L1927:
+	SLA 8, XIZ
+L1928:
+	SLL 14, E
+L1929:
+	RR 8, XIX
+L1930:
+	SRA 15, HL
+L1931:
+	RL 8, XIX
+L1932:
+	RL 15, W
+L1933:
+	SLA 9, XIX
+L1934:
+	RRC 7, XBC
+L1935:
+	SLL 10, IY
+L1936:
+	RL 6, DE
+L1937:
+	RLC 15, IZ
+L1938:
+	RL 13, C
+L1939:
+	SLL 7, W
+L1940:
+	SLL 3, WA
+L1941:
+	SLA 9, WA
+L1942:
+	RRC 6, H
+L1943:
+	RLC 11, XBC
+L1944:
+	RL 8, WA
+L1945:
+	SRL 7, XBC
+L1946:
+	SRA 1, L
+L1947:
+	RLC 15, D
+L1948:
+	RLC 10, XIZ
+L1949:
+	RR 9, A
+L1950:
+	SLL 4, XIZ
+L1951:
+	RLC 12, DE
+L1952:
+	RLC 9, IX
+L1953:
+	SLA 14, XHL
+L1954:
+	SLA 3, L
+L1955:
+	RR 10, XDE
+L1956:
+	RL 15, XHL
+L1957:
+	SLA 8, C
+L1958:
+	RLC 5, XWA
+L1959:
+	RL 4, IY
+L1960:
+	SLA 12, XIY
+L1961:
+	RLC 3, XBC
+L1962:
+	RLC 1, IY
+L1963:
+	SRA 4, D
+L1964:
+	RL 9, XBC
+L1965:
+	RRC 15, XBC
+L1966:
+	SRA 8, A
+L1967:
+	SLL 6, A
+L1968:
+	SRL 14, XHL
+L1969:
+	SLL 12, D
+L1970:
+	SLL 9, BC
+L1971:
+	RL 1, H
+L1972:
+	RR 8, A
+L1973:
+	SLL 1, XIY
+L1974:
+	RRC 3, XDE
+L1975:
+	SLL 14, W
+L1976:
+	SLA 3, C
+L1977:
+	RL 9, A
+L1978:
+	SRL 10, L
+L1979:
+	SLA 7, XIZ
+L1980:
+	SLL 15, XBC
+L1981:
+	RLC 3, IX
+L1982:
+	RRC 3, XIY
+L1983:
+	RR 3, IZ
+L1984:
+	RRC 4, C
+L1985:
+	RL 4, XHL
+L1986:
+	RL 4, C
+L1987:
+	RLC 2, IX
+L1988:
+	RRC 10, DE
+L1989:
+	RL 9, A
+L1990:
+	SRA 7, IX
+L1991:
+	RRC 9, IX
+L1992:
+	RLC 8, XIZ
+L1993:
+	SLL 4, A
+L1994:
+	SLL 10, XHL
+L1995:
+	SLL 13, C
+L1996:
+	SRL 6, XIY
+L1997:
+	SRA 9, IX
+L1998:
+	SRA 11, IY
+L1999:
+	SLL 11, HL
+L2000:
+	SRA 1, XHL
+L2001:
+	RLC 4, XHL
+L2002:
+	SLL 2, XBC
+L2003:
+	RL 8, D
+L2004:
+	RR 8, XWA
+L2005:
+	RLC 9, IX
+L2006:
+	SRA 4, XBC
+L2007:
+	SLL 12, E
+L2008:
+	RR 7, DE
+L2009:
+	RR 3, E
+L2010:
+	SRA 11, DE
+L2011:
+	RLC 12, D
+L2012:
+	RR 15, IX
+L2013:
+	RRC 9, XBC
+L2014:
+	RRC 7, XDE
+L2015:
+	SRL 7, D
+L2016:
+	SLA 9, XBC
+L2017:
+	SRA 7, W
+L2018:
+	RL 5, XDE
+L2019:
+	RL 4, E
+L2020:
+	SLL 12, D
+L2021:
+	SLL 12, H
+L2022:
+	RLC 1, HL
+L2023:
+	RL 1, WA
+L2024:
+	RRC 1, C
+L2025:
+	SLA 15, B
+L2026:
+	RLC 14, IX
+L2027:
+	RR 7, H
+L2028:
+	RRC 13, DE
+L2029:
+	SLL 13, W
+L2030:
+	SRA 8, XHL
+L2031:
+	RLC 12, IY
+L2032:
+	RRC 9, W
+L2033:
+	RL 2, E
+L2034:
+	SLL 9, XBC
+L2035:
+	SLA 3, L
+L2036:
+	SRL 1, B
+L2037:
+	SRL 10, B
+L2038:
+	SLL 6, XWA
+L2039:
+	RRC 7, W
+L2040:
+	RRC 10, IY
+L2041:
+	RR 13, HL
+L2042:
+	SRA 5, WA
+L2043:
+	RLC 3, IX
+L2044:
+	RL 7, XDE
+L2045:
+	SLA 7, XIZ
+L2046:
+	SRA 8, IZ
+L2047:
+	RRC 8, B
+L2048:
+	SRL 2, XHL
+L2049:
+	SRL 14, W
+L2050:
+	SLA 11, E
+L2051:
+	SRL 5, HL
+L2052:
+	RRC 6, XBC
+L2053:
+	RLC 3, BC
+L2054:
+	SLA 4, H
+L2055:
+	RLC 2, L
+L2056:
+	RL 1, W
+L2057:
+	RR 5, A
+L2058:
+	SRA 13, XBC
+L2059:
+	SLA 6, H
+L2060:
+	RR 1, WA
+L2061:
+	RLC 9, H
+L2062:
+	SLA 2, XIX
+L2063:
+	SLL 12, DE
+L2064:
+	RL 1, DE
+L2065:
+	SLA 13, DE
+L2066:
+	SLA 4, BC
+L2067:
+	SRL 4, HL
+L2068:
+	SLA 2, XHL
+L2069:
+	SLA 1, XIY
+L2070:
+	RL 6, A
+L2071:
+	RRC 15, XBC
+L2072:
+	SLL 11, IX
+L2073:
+	SLL 2, E
+L2074:
+	SLA 12, C
+L2075:
+	SRL 14, HL
+L2076:
+	RLC 5, XIY
+L2077:
+	RLC 15, XIZ
+L2078:
+	SLL 8, XIY
+L2079:
+	SRL 8, C
+L2080:
+	RL 11, A
+L2081:
+	SRL 6, XWA
+L2082:
+	RLC 4, IX
+L2083:
+	SLA 7, IX
+L2084:
+	RR 10, B
+L2085:
+	RL 3, IY
+L2086:
+	SRA 9, XIY
+L2087:
+	RR 6, WA
+L2088:
+	RLC 3, L
+L2089:
+	SLA 10, IY
+L2090:
+	RRC 2, XHL
+L2091:
+	SRL 4, W
+L2092:
+	RRC 14, HL
+L2093:
+	RR 4, DE
+L2094:
+	SRA 3, IZ
+L2095:
+	SLA 2, XIZ
+L2096:
+	SRA 9, XWA
+L2097:
+	SLA 11, XHL
+L2098:
+	RL 7, XIZ
+L2099:
+	SRA 15, C
+L2100:
+	SLA 13, XIX
+L2101:
+	SRA 15, HL
+L2102:
+	RL 4, IX
+L2103:
+	SRA 1, D
+L2104:
+	SLL 5, B
+L2105:
+	SRA 12, IZ
+L2106:
+	SLA 4, HL
+L2107:
+	RL 3, XDE
+L2108:
+	RRC 14, W
+L2109:
+	RL 5, E
+L2110:
+	SLL 11, XBC
+L2111:
+	SRA 15, XIZ
+L2112:
+	RLC 7, XWA
+L2113:
+	RRC 8, XBC
+L2114:
+	SRL 10, XWA
+L2115:
+	RRC 1, B
+L2116:
+	RL 10, XBC
+L2117:
+	RR 7, H
+L2118:
+	RRC 10, XWA
+L2119:
+	SRL 10, XDE
+L2120:
+	SRL 2, WA
+L2121:
+	RR 4, DE
+L2122:
+	SRA 13, BC
+L2123:
+	SLA 1, D
+L2124:
+	RLC 15, XWA
+L2125:
+	RL 15, A
+L2126:
+	SRA 8, IZ
+L2127:
+	RL 4, IY
+L2128:
+	RR 1, XBC
+L2129:
+	SRL 12, XWA
+L2130:
+	RL 12, XIX
+L2131:
+	SRL 7, A
+L2132:
+	RRC 10, HL
+L2133:
+	SLL 15, XHL
+L2134:
+	RL 14, XIX
+L2135:
+	SLL 15, C
+L2136:
+	RL 11, IX
+L2137:
+	RR 2, XIZ
+L2138:
+	RRC 15, D
+L2139:
+	RR 15, XIX
+L2140:
+	SLA 14, B
+L2141:
+	SLA 8, HL
+L2142:
+	RRC 3, XIZ
+L2143:
+	SLL 1, XHL
+L2144:
+	SRA 14, DE
+L2145:
+	SRA 2, XDE
+L2146:
+	RRC 15, DE
+L2147:
+	SLA 4, XIX
+L2148:
+	RRC 9, XHL
+L2149:
+	SLA 5, XHL
+L2150:
+	SLA 9, B
+L2151:
+	RR 5, W
+L2152:
+	RL 10, XIZ
+L2153:
+	RR 8, A
+L2154:
+	SLL 8, XBC
+L2155:
+	SLA 7, HL
+L2156:
+	RLC 2, E
+L2157:
+	SRA 11, E
+L2158:
+	RLC 12, H
+L2159:
+	SRL 14, IY
+L2160:
+	SLL 1, HL
+L2161:
+	SRL 3, XIZ
+L2162:
+	SRL 7, H
+L2163:
+	SRA 11, IZ
+L2164:
+	RRC 3, D
+L2165:
+	SLA 4, H
+L2166:
+	RRC 7, IY
+L2167:
+	SRL 4, HL
+L2168:
+	RRC 15, XIZ
+L2169:
+	SLA 7, XHL
+L2170:
+	SLL 12, IX
+L2171:
+	RR 13, XBC
+L2172:
+	RLC 2, XHL
+L2173:
+	SRL 2, XIX
+L2174:
+	SLA 9, BC
+L2175:
+	SLL 5, XIY
+L2176:
+	SLA 4, XHL
+L2177:
+	SLL 14, H
+L2178:
+	RR 8, C
+L2179:
+	RLC 11, XWA
+L2180:
+	SRL 5, XIZ
+L2181:
+	SLL 10, C
+L2182:
+	SRA 1, IZ
+L2183:
+	SRL 4, WA
+L2184:
+	SRL 15, A
+L2185:
+	SRA 9, XDE
+L2186:
+	RR 1, XIY
+L2187:
+	SLA 10, H
+L2188:
+	SRL 8, IY
+L2189:
+	RRC 11, IX
+L2190:
+	SLA 2, IX
+L2191:
+	RL 1, XIZ
+L2192:
+	SLL 6, D
+L2193:
+	SLL 3, C
+L2194:
+	SLA 10, IZ
+L2195:
+	SLL 9, XDE
+L2196:
+	SLA 15, XIY
+L2197:
+	SLL 5, W
+L2198:
+	SRA 14, C
+L2199:
+	RLC 1, BC
+L2200:
+	RL 12, HL
+L2201:
+	SRL 1, XWA
+L2202:
+	RL 12, XBC
+L2203:
+	SLL 13, C
+L2204:
+	SRA 8, IZ
+L2205:
+	RL 2, H
+L2206:
+	RL 1, D
+L2207:
+	RR 14, IZ
+L2208:
+	RRC 15, D
+L2209:
+	RRC 5, XWA
+L2210:
+	SLL 11, D
+L2211:
+	SLA 7, H
+L2212:
+	SLA 4, B
+L2213:
+	SRL 2, B
+L2214:
+	SRL 1, XIX
+L2215:
+	RR 2, D
+L2216:
+	SLA 12, HL
+L2217:
+	SLL 4, IX
+L2218:
+	SLA 4, XDE
+L2219:
+	RR 1, XIY
+L2220:
+	SLA 11, L
+L2221:
+	SRL 7, XIX
+L2222:
+	SRA 8, A
+L2223:
+	RRC 6, XBC
+L2224:
+	RL 14, WA
+L2225:
+	RL 8, C
+L2226:
+	RR 14, DE
+L2227:
+	SRL 1, D
+L2228:
+	SRL 8, D
+L2229:
+	SLA 11, L
+L2230:
+	RR 5, DE
+L2231:
+	SRL 1, XHL
+L2232:
+	RRC 1, L
+L2233:
+	SRA 7, BC
+L2234:
+	SLA 5, DE
+L2235:
+	SLA 14, XIZ
+L2236:
+	RRC 8, IX
+L2237:
+	SRL 5, BC
+L2238:
+	SRA 5, XIZ
+L2239:
+	SRL 4, H
+L2240:
+	RLC 8, E
+L2241:
+	SLA 8, L
+L2242:
+	SLA 4, B
+L2243:
+	RL 13, A
+L2244:
+	RL 1, XIX
+L2245:
+	RLC 11, XHL
+L2246:
+	SRL 6, WA
+L2247:
+	SLA 11, W
+L2248:
+	SRL 3, A
+L2249:
+	RRC 11, B
+L2250:
+	SRA 15, BC
+L2251:
+	RRC 14, XBC
+L2252:
+	RLC 14, IX
+L2253:
+	SLA 11, XDE
+L2254:
+	RR 3, L
+L2255:
+	RR 11, C
+L2256:
+	RRC 8, D
+L2257:
+	RRC 3, XHL
+L2258:
+	SLA 4, XBC
+L2259:
+	SLL 14, WA
+L2260:
+	RRC 6, L
+L2261:
+	SLA 2, A
+L2262:
+	RL 13, W
+L2263:
+	SLL 13, A
+L2264:
+	RR 9, HL
+L2265:
+	RRC 14, XIX
+L2266:
+	SLL 5, IY
+L2267:
+	SRL 3, D
+L2268:
+	RL 7, IY
+L2269:
+	SRA 8, D
+L2270:
+	RRC 4, HL
+L2271:
+	RL 13, XBC
+L2272:
+	SLL 7, IY
+L2273:
+	RL 10, XIY
+L2274:
+	SRL 12, IZ
+L2275:
+	SLA 15, D
+L2276:
+	RLC 10, HL
+L2277:
+	SRL 9, C
+L2278:
+	RL 2, WA
+L2279:
+	RR 6, XIX
+L2280:
+	SLA 6, IX
+L2281:
+	RL 4, C
+L2282:
+	RRC 13, WA
+L2283:
+	RLC 13, XDE
+L2284:
+	RLC 2, L
+L2285:
+	SLA 8, D
+L2286:
+	RLC 7, L
+L2287:
+	RLC 7, DE
+L2288:
+	RL 9, XBC
+L2289:
+	SLL 15, DE
+L2290:
+	RLC 14, XIZ
+L2291:
+	RRC 14, XHL
+L2292:
+	RRC 3, XIZ
+L2293:
+	RL 11, IX
+L2294:
+	SLA 14, H
+L2295:
+	SRA 4, D
+L2296:
+	RLC 13, XDE
+L2297:
+	SLL 1, H
+L2298:
+	SLL 2, XIZ
+L2299:
+	RL 2, WA
+L2300:
+	SLA 6, XHL
+L2301:
+	RRC 14, DE
+L2302:
+	RR 5, XDE
+L2303:
+	RR 7, C
+L2304:
+	RL 4, XWA
+L2305:
+	RLC 3, W
+L2306:
+	RR 14, IY
+L2307:
+	SLA 2, DE
+L2308:
+	SRL 15, IY
+L2309:
+	RR 15, L
+L2310:
+	RL 5, IY
+L2311:
+	SRA 8, W
+L2312:
+	RRC 6, XDE
+L2313:
+	RLC 13, XIX
+L2314:
+	RR 15, WA
+L2315:
+	RL 3, XIZ
+L2316:
+	SRL 12, IY
+L2317:
+	RL 6, XIZ
+L2318:
+	RL 1, C
+L2319:
+	RL 5, H
+L2320:
+	RRC 7, HL
+L2321:
+	SRL 5, BC
+L2322:
+	RL 9, XBC
+L2323:
+	SRL 4, XIY
+L2324:
+	SRA 9, XWA
+L2325:
+	RR 7, HL
+L2326:
+	RR 11, XDE
+L2327:
+	SLL 7, XIY
+L2328:
+	SLA 15, B
+L2329:
+	RL 12, XIY
+L2330:
+	SLA 2, XWA
+L2331:
+	SLL 5, E
+L2332:
+	RRC 4, H
+L2333:
+	RL 7, E
+L2334:
+	SRL 9, DE
+L2335:
+	RLC 4, IY
+L2336:
+	RR 15, IX
+L2337:
+	SLA 2, L
+L2338:
+	SLA 11, XIZ
+L2339:
+	RRC 4, XHL
+L2340:
+	RLC 3, XDE
+L2341:
+	RLC 14, XDE
+L2342:
+	RR 13, IZ
+L2343:
+	SRA 5, DE
+L2344:
+	SLA 4, XBC
+L2345:
+	SLA 8, B
+L2346:
+	SLL 11, A
+L2347:
+	RL 7, DE
+L2348:
+	RR 4, WA
+L2349:
+	SRA 7, A
+L2350:
+	RLC 5, DE
+L2351:
+	RR 12, XDE
+L2352:
+	RL 9, L
+L2353:
+	RLC 12, DE
+L2354:
+	RR 7, BC
+L2355:
+	RRC 3, XIX
+L2356:
+	RRC 11, IZ
+L2357:
+	RL 2, WA
+L2358:
+	SLA 13, IX
+L2359:
+	RRC 3, E
+L2360:
+	RR 10, XDE
+L2361:
+	SRL 3, XIZ
+L2362:
+	SLL 9, XBC
+L2363:
+	SRA 3, XWA
+L2364:
+	RRC 5, L
+L2365:
+	RRC 12, WA
+L2366:
+	SLL 13, D
+L2367:
+	RL 2, XWA
+L2368:
+	RR 7, XHL
+L2369:
+	RR 6, XIZ
+L2370:
+	RLC 12, WA
+L2371:
+	RLC 13, W
+L2372:
+	SRL 14, IZ
+L2373:
+	RRC 11, XBC
+L2374:
+	RR 6, XDE
+L2375:
+	SRA 8, H
+L2376:
+	RRC 11, D
+L2377:
+	RR 8, BC
+L2378:
+	SLL 8, H
+L2379:
+	RLC 5, XWA
+L2380:
+	SRL 13, XIX
+L2381:
+	RR 11, L
+L2382:
+	RLC 1, W
+L2383:
+	RRC 2, HL
+L2384:
+	RRC 5, D
+L2385:
+	SLA 1, XIY
+L2386:
+	RL 11, BC
+L2387:
+	RLC 14, XIX
+L2388:
+	RL 15, L
+L2389:
+	SLL 3, WA
+L2390:
+	RRC 11, WA
+L2391:
+	SRA 5, H
+L2392:
+	SLL 7, W
+L2393:
+	RR 2, IX
+L2394:
+	RR 3, WA
+L2395:
+	SRA 2, XDE
+L2396:
+	SRL 8, HL
+L2397:
+	SRL 2, A
+L2398:
+	SLL 1, D
+L2399:
+	SLA 3, E
+L2400:
+	RRC 14, IY
+L2401:
+	RL 2, WA
+L2402:
+	SLL 14, IX
+L2403:
+	SRA 11, IX
+L2404:
+	SRL 9, W
+L2405:
+	SLL 6, XBC
+L2406:
+	SRL 11, XWA
+L2407:
+	SLA 5, C
+L2408:
+	RR 15, H
+L2409:
+	SLA 6, XHL
+L2410:
+	SLL 6, IZ
+L2411:
+	RL 3, IZ
+L2412:
+	SRA 13, XIZ
+L2413:
+	RRC 2, E
+L2414:
+	SLL 3, L
+L2415:
+	SRL 3, B
+L2416:
+	RLC 6, XIX
+L2417:
+	RLC 12, IY
+L2418:
+	SRL 7, XHL
+L2419:
+	SLA 7, DE
+L2420:
+	SRA 15, XIX
+L2421:
+	RR 8, XDE
+L2422:
+	SRA 1, A
+L2423:
+	RRC 6, BC
+L2424:
+	RL 1, IX
+L2425:
+	RLC 9, A
+L2426:
+	SLA 2, H
+L2427:
+	SLL 5, D
+L2428:
+	SLL 5, E
+L2429:
+	RLC 8, IY
+L2430:
+	SRL 6, HL
+L2431:
+	SLL 8, IX
+L2432:
+	RL 8, H
+L2433:
+	RL 2, IZ
+L2434:
+	RR 14, A
+L2435:
+	RRC 9, XHL
+L2436:
+	RL 5, A
+L2437:
+	SRA 13, XDE
+L2438:
+	RRC 6, XWA
+L2439:
+	RR 9, XDE
+L2440:
+	RLC 12, D
+L2441:
+	SRL 9, XHL
+L2442:
+	SLA 15, XHL
+L2443:
+	RR 7, W
+L2444:
+	RLC 1, XDE
+L2445:
+	SLL 11, XIY
+L2446:
+	RRC 4, XBC
+L2447:
+	RR 7, D
+L2448:
+	SRL 4, XWA
+L2449:
+	RR 4, L
+L2450:
+	SLA 6, A
+L2451:
+	RL 15, E
+L2452:
+	SRL 5, W
+L2453:
+	RR 7, C
+L2454:
+	RL 8, H
+L2455:
+	RLC 11, IX
+L2456:
+	SLL 11, IZ
+L2457:
+	RR 12, XIY
+L2458:
+	RLC 3, DE
+L2459:
+	SLL 4, IZ
+L2460:
+	SLA 7, XIX
+L2461:
+	RL 7, B
+L2462:
+	RL 1, D
+L2463:
+	SRA 12, L
+L2464:
+	SRA 5, XIY
+L2465:
+	RLC 8, XBC
+L2466:
+	SRA 9, IZ
+L2467:
+	SLL 1, XIX
+L2468:
+	RR 5, H
+L2469:
+	RR 10, L
+L2470:
+	RLC 14, IY
+L2471:
+	RL 10, IY
+L2472:
+	RLC 14, IY
+L2473:
+	RR 5, IX
+L2474:
+	SLL 3, BC
+L2475:
+	RLC 5, XIZ
+L2476:
+	RLC 2, E
+L2477:
+	SRA 8, XHL
+L2478:
+	SRL 4, IX
+L2479:
+	RRC 15, IX
+L2480:
+	RLC 12, E
+L2481:
+	SLL 14, XIY
+L2482:
+	RRC 8, XHL
+L2483:
+	RL 10, WA
+L2484:
+	RR 10, H
+L2485:
+	SLL 12, DE
+L2486:
+	SLA 5, XBC
+L2487:
+	SRA 9, IX
+L2488:
+	SRA 15, IZ
+L2489:
+	SLA 5, C
+L2490:
+	SRL 13, XIZ
+L2491:
+	SRA 2, L
+L2492:
+	SRL 11, XIY
+L2493:
+	RR 3, E
+L2494:
+	RR 10, XWA
+L2495:
+	RR 15, IX
+L2496:
+	RL 5, L
+L2497:
+	RR 8, DE
+L2498:
+	RLC 15, XIX
+L2499:
+	SLA 3, H
+L2500:
+	SLA 15, A
+L2501:
+	RR 6, W
+L2502:
+	SLA 11, D
+L2503:
+	RRC 15, XIZ
+L2504:
+	RRC 1, C
+L2505:
+	SLA 12, H
+L2506:
+	RR 1, D
+L2507:
+	SLL 12, XWA
+L2508:
+	RRC 15, IX
+L2509:
+	SLA 3, W
+L2510:
+	RLC 10, XDE
+L2511:
+	RLC 7, WA
+L2512:
+	SRA 14, XDE
+L2513:
+	SLL 7, XHL
+L2514:
+	RR 11, XWA
+L2515:
+	RRC 7, XBC
+L2516:
+	RLC 5, A
+L2517:
+	SRA 9, DE
+L2518:
+	RLC 5, C
+L2519:
+	SRA 6, XDE
+L2520:
+	RR 4, IX
+L2521:
+	RLC 13, XWA
+L2522:
+	RR 4, W
+L2523:
+	SLL 3, BC
+L2524:
+	SRA 15, HL
+L2525:
+	RLC 10, W
+L2526:
+	RR 13, WA
+L2527:
+	RLC 8, IY
+L2528:
+	SRL 6, WA
+L2529:
+	RLC 8, IZ
+L2530:
+	RRC 7, BC
+L2531:
+	RL 8, C
+L2532:
+	SLL 11, XWA
+L2533:
+	SLA 7, XBC
+L2534:
+	RRC 12, W
+L2535:
+	SRL 5, DE
+L2536:
+	SLL 13, XWA
+L2537:
+	RLC 3, XIX
+L2538:
+	SRA 15, HL
+L2539:
+	SRA 1, IY
+L2540:
+	RR 7, XHL
+L2541:
+	SRA 9, IY
+L2542:
+	RL 1, IY
+L2543:
+	RRC 4, HL
+L2544:
+	RRC 3, XIX
+L2545:
+	RL 6, XBC
+L2546:
+	RLC 11, W
+L2547:
+	RR 15, XIX
+L2548:
+	SRL 4, E
+L2549:
+	SRA 8, XIZ
+L2550:
+	RRC 7, B
+L2551:
+	SLA 11, XWA
+L2552:
+	SRA 3, L
+L2553:
+	RLC 1, E
+L2554:
+	RRC 10, DE
+L2555:
+	SRA 14, E
+L2556:
+	RR 3, IX
+L2557:
+	SRL 13, XDE
+L2558:
+	SRL 7, B
+L2559:
+	RLC 15, WA
+L2560:
+	SLA 12, XHL
+L2561:
+	SRL 14, XHL
+L2562:
+	RL 1, L
+L2563:
+	RL 15, XDE
+L2564:
+	RRC 3, IX
+L2565:
+	RRC 3, E
+L2566:
+	SRA 13, XHL
+L2567:
+	SRA 13, A
+L2568:
+	SRA 7, IX
+L2569:
+	RRC 12, DE
+L2570:
+	RLC 15, XHL
+L2571:
+	RR 12, XDE
+L2572:
+	SLL 15, XDE
+L2573:
+	SRL 3, XIZ
+L2574:
+	RR 13, XHL
+L2575:
+	RL 4, C
+L2576:
+	SRL 5, XIZ
+L2577:
+	SRL 5, WA
+L2578:
+	RL 11, DE
+L2579:
+	SLL 8, DE
+L2580:
+	SRA 6, E
+L2581:
+	RRC 12, XIX
+L2582:
+	SRL 2, XDE
+L2583:
+	SRL 3, C
+L2584:
+	SRA 2, C
+L2585:
+	RRC 10, XHL
+L2586:
+	RRC 14, L
+L2587:
+	SLA 10, H
+L2588:
+	SRL 9, XIX
+L2589:
+	SLA 14, XHL
+L2590:
+	RLC 14, BC
+L2591:
+	RLC 10, XIZ
+L2592:
+	RLC 6, E
+L2593:
+	SLL 12, W
+L2594:
+	RLC 13, XIX
+L2595:
+	SLA 1, BC
+L2596:
+	RRC 10, IY
+L2597:
+	SLL 13, IZ
+L2598:
+	RR 10, XWA
+L2599:
+	RRC 10, BC
+L2600:
+	SRL 12, C
+L2601:
+	RL 6, B
+L2602:
+	SLA 15, E
+L2603:
+	SLA 13, BC
+L2604:
+	RL 5, XHL
+L2605:
+	SRA 12, XHL
+L2606:
+	RRC 6, DE
+L2607:
+	SRA 5, IY
+L2608:
+	RRC 8, IY
+L2609:
+	SLL 7, DE
+L2610:
+	RRC 9, E
+L2611:
+	SLL 10, DE
+L2612:
+	SRA 10, L
+L2613:
+	RL 9, W
+L2614:
+	RRC 1, L
+L2615:
+	RR 10, XBC
+L2616:
+	RLC 2, WA
+L2617:
+	RLC 9, IX
+L2618:
+	SLL 15, BC
+L2619:
+	RLC 6, WA
+L2620:
+	SLA 11, WA
+L2621:
+	SLL 15, IZ
+L2622:
+	SLA 3, D
+L2623:
+	SLA 5, XHL
+L2624:
+	SRL 12, XIZ
+L2625:
+	SRA 10, BC
+L2626:
+	SLL 6, IZ
+L2627:
+	RR 4, XHL
+L2628:
+	RLC 12, XIY
+L2629:
+	RR 12, XIY
+L2630:
+	RR 14, HL
+L2631:
+	RLC 6, BC
+L2632:
+	RL 8, D
+L2633:
+	RL 5, W
+L2634:
+	RLC 13, XHL
+L2635:
+	SRL 3, D
+L2636:
+	SLL 5, XHL
+L2637:
+	RL 15, XIX
+L2638:
+	SRL 4, XHL
+L2639:
+	RR 14, XIY
+L2640:
+	SRL 12, L
+L2641:
+	RR 14, XHL
+L2642:
+	SRL 6, E
+L2643:
+	RR 13, B
+L2644:
+	SRL 13, XIX
+L2645:
+	RL 5, BC
+L2646:
+	SRA 11, DE
+L2647:
+	SLA 9, DE
+L2648:
+	SRL 2, C
+L2649:
+	SLL 14, XHL
+L2650:
+	RR 5, D
+L2651:
+	RRC 5, XWA
+L2652:
+	RR 11, XWA
+L2653:
+	SRA 14, XDE
+L2654:
+	RRC 5, E
+L2655:
+	RLC 8, IY
+L2656:
+	SLA 15, D
+L2657:
+	SRA 5, IZ
+L2658:
+	RR 4, XHL
+L2659:
+	RL 7, XBC
+L2660:
+	RLC 6, D
+L2661:
+	RR 14, XIY
+L2662:
+	SLL 2, L
+L2663:
+	SLL 8, XIX
+L2664:
+	RLC 12, HL
+L2665:
+	RL 6, BC
+L2666:
+	SLA 1, XHL
+L2667:
+	RL 1, DE
+L2668:
+	RR 11, XDE
+L2669:
+	RR 6, WA
+L2670:
+	RLC 11, C
+L2671:
+	RR 1, XWA
+L2672:
+	SLL 3, XWA
+L2673:
+	RRC 11, WA
+L2674:
+	SLA 3, WA
+L2675:
+	SRL 11, IY
+L2676:
+	RR 3, C
+L2677:
+	RLC 10, XHL
+L2678:
+	RRC 15, IZ
+L2679:
+	SLL 3, C
+L2680:
+	SRA 9, B
+L2681:
+	RLC 12, W
+L2682:
+	SLA 12, L
+L2683:
+	RL 1, E
+L2684:
+	RLC 11, A
+L2685:
+	RR 6, XIY
+L2686:
+	SRA 9, E
+L2687:
+	SRA 3, W
+L2688:
+	RL 2, E
+L2689:
+	SRA 9, XIX
+L2690:
+	SRL 8, IY
+L2691:
+	RRC 14, WA
+L2692:
+	SLA 13, W
+L2693:
+	SRA 11, XHL
+L2694:
+	RRC 9, W
+L2695:
+	RRC 8, E
+L2696:
+	RRC 15, XWA
+L2697:
+	RRC 15, XDE
+L2698:
+	SRA 1, XDE
+L2699:
+	RL 6, E
+L2700:
+	SLL 11, IZ
+L2701:
+	SRL 1, XIY
+L2702:
+	SLL 10, W
+L2703:
+	RLC 15, XIZ
+L2704:
+	RL 3, B
+L2705:
+	RRC 7, C
+L2706:
+	SRL 5, IZ
+L2707:
+	SRA 4, A
+L2708:
+	RR 12, IY
+L2709:
+	SRA 8, C
+L2710:
+	RRC 1, XIX
+L2711:
+	RL 15, XIX
+L2712:
+	RRC 11, HL
+L2713:
+	SLA 6, BC
+L2714:
+	RRC 3, XIX
+L2715:
+	RL 5, IX
+L2716:
+	SLL 4, IY
+L2717:
+	SRA 3, D
+L2718:
+	RLC 10, XIZ
+L2719:
+	RRC 2, H
+L2720:
+	RLC 7, C
+L2721:
+	SLA 9, XWA
+L2722:
+	SRL 3, XIY
+L2723:
+	RL 6, WA
+L2724:
+	RRC 8, WA
+L2725:
+	RL 9, C
+L2726:
+	SLA 7, W
+L2727:
+	SRL 3, IX
+L2728:
+	RL 7, IY
+L2729:
+	RRC 1, XIX
+L2730:
+	RR 15, XIZ
+L2731:
+	RLC 4, BC
+L2732:
+	SRL 4, A
+L2733:
+	RRC 3, XIZ
+L2734:
+	SLA 8, XWA
+L2735:
+	SRA 7, IZ
+L2736:
+	RL 9, C
+L2737:
+	RLC 7, XIX
+L2738:
+	SRA 7, XIZ
+L2739:
+	RRC 10, BC
+L2740:
+	SRA 13, IX
+L2741:
+	SLA 12, B
+L2742:
+	SRL 7, HL
+L2743:
+	SLA 8, IZ
+L2744:
+	RR 8, XIY
+L2745:
+	RL 13, D
+L2746:
+	RLC 13, IZ
+L2747:
+	SLA 15, XDE
+L2748:
+	RRC 14, B
+L2749:
+	SLA 5, XIX
+L2750:
+	SLL 2, WA
+L2751:
+	SRA 4, XIX
+L2752:
+	SRL 8, XIY
+L2753:
+	SRA 15, XBC
+L2754:
+	SRA 13, HL
+L2755:
+	RLC 14, XIY
+L2756:
+	RRC 12, L
+L2757:
+	RRC 5, DE
+L2758:
+	SRL 10, XWA
+L2759:
+	SRL 3, IX
+L2760:
+	SRL 2, XIZ
+L2761:
+	RR 1, L
+L2762:
+	RLC 1, XHL
+L2763:
+	SRL 6, BC
+L2764:
+	SRL 11, A
+L2765:
+	RR 13, C
+L2766:
+	RLC 11, XBC
+L2767:
+	RLC 1, L
+L2768:
+	SRL 14, H
+L2769:
+	RLC 1, A
+L2770:
+	SLL 15, XIY
+L2771:
+	RR 5, XBC
+L2772:
+	RL 8, XIY
+L2773:
+	SRA 10, IX
+L2774:
+	SLL 11, XIZ
+L2775:
+	SRA 9, A
+L2776:
+	SLL 14, IX
+L2777:
+	RR 8, E
+L2778:
+	SLA 13, IX
+L2779:
+	SRA 9, D
+L2780:
+	SRA 15, BC
+L2781:
+	SLA 7, A
+L2782:
+	SRL 9, IX
+L2783:
+	RRC 4, L
+L2784:
+	RLC 12, A
+L2785:
+	RRC 3, A
+L2786:
+	RRC 10, XWA
+L2787:
+	SRA 9, XIX
+L2788:
+	SRL 13, XIZ
+L2789:
+	RLC 4, BC
+L2790:
+	RR 11, HL
+L2791:
+	SLA 10, BC
+L2792:
+	RRC 13, IX
+L2793:
+	SLL 6, IX
+L2794:
+	SLL 10, XIY
+L2795:
+	RRC 8, HL
+L2796:
+	SLL 15, XHL
+L2797:
+	RLC 1, BC
+L2798:
+	RLC 15, HL
+L2799:
+	SRA 3, DE
+L2800:
+	SRL 7, D
+L2801:
+	SRA 14, XDE
+L2802:
+	SLA 10, IZ
+L2803:
+	RR 1, C
+L2804:
+	SRL 2, XIY
+L2805:
+	SRA 6, WA
+L2806:
+	SRL 9, DE
+L2807:
+	SRL 9, XWA
+L2808:
+	RLC 5, IY
+L2809:
+	RLC 15, A
+L2810:
+	RRC 15, BC
+L2811:
+	SLL 15, C
+L2812:
+	RLC 1, XBC
+L2813:
+	SRL 2, XIZ
+L2814:
+	RL 9, IY
+L2815:
+	SRA 3, XDE
+L2816:
+	SRL 8, HL
+L2817:
+	SLL 2, XHL
+L2818:
+	RLC 13, E
+L2819:
+	RLC 4, XHL
+L2820:
+	RRC 4, WA
+L2821:
+	RRC 3, XHL
+L2822:
+	SLL 14, DE
+L2823:
+	SRL 3, B
+L2824:
+	SRA 6, H
+L2825:
+	RLC 1, XBC
+L2826:
+	RRC 6, IZ
+L2827:
+	RL 8, E
+L2828:
+	SLA 5, E
+L2829:
+	RR 3, IY
+L2830:
+	RR 9, D
+L2831:
+	RLC 15, IX
+L2832:
+	SLA 8, XIX
+L2833:
+	SRL 13, XIY
+L2834:
+	SRA 5, XIX
+L2835:
+	SRL 6, WA
+L2836:
+	SLL 10, HL
+L2837:
+	SLA 6, A
+L2838:
+	SLA 9, XWA
+L2839:
+	SLL 12, E
+L2840:
+	RR 1, IY
+L2841:
+	RL 2, XIZ
+L2842:
+	RL 15, A
+L2843:
+	SLL 6, XIX
+L2844:
+	RL 2, A
+L2845:
+	SRL 12, IX
+L2846:
+	SLA 4, XIY
+L2847:
+	RLC 11, IZ
+L2848:
+	SLL 3, HL
+L2849:
+	RR 8, XIX
+L2850:
+	RL 11, W
+L2851:
+	SLA 10, L
+L2852:
+	SLA 4, IZ
+L2853:
+	SRL 10, WA
+L2854:
+	RR 3, A
+L2855:
+	SRL 8, XIZ
+L2856:
+	SLL 5, IY
+L2857:
+	RRC 4, HL
+L2858:
+	RLC 11, E
+L2859:
+	SRA 14, HL
+L2860:
+	RRC 1, A
+L2861:
+	SLL 4, XIY
+L2862:
+	RL 11, DE
+L2863:
+	RRC 13, IY
+L2864:
+	RRC 3, XIZ
+L2865:
+	RRC 11, B
+L2866:
+	RRC 1, XHL
+L2867:
+	RRC 8, XIZ
+L2868:
+	RRC 4, BC
+L2869:
+	SLL 8, E
+L2870:
+	RRC 11, L
+L2871:
+	RR 14, BC
+L2872:
+	SLA 3, D
+L2873:
+	SRA 9, IY
+L2874:
+	RRC 9, XBC
+L2875:
+	SRL 5, H
+L2876:
+	RL 8, C
+L2877:
+	SLL 5, XWA
+L2878:
+	RLC 11, W
+L2879:
+	SRA 12, BC
+L2880:
+	RRC 7, WA
+L2881:
+	SLL 8, XIZ
+L2882:
+	RRC 11, WA
+L2883:
+	RR 10, A
+L2884:
+	SRA 8, IX
+L2885:
+	SLA 2, E
+L2886:
+	SLA 6, XDE
+L2887:
+	RL 13, XBC
+L2888:
+	SLL 8, E
+L2889:
+	SLA 6, XIX
+L2890:
+	RLC 9, XIZ
+L2891:
+	SLL 9, IX
+L2892:
+	SRA 14, XIY
+L2893:
+	SRA 4, IX
+L2894:
+	RRC 11, DE
+L2895:
+	SRA 7, XIZ
+L2896:
+	RLC 12, L
+L2897:
+	RRC 2, D
+L2898:
+	SRA 3, XWA
+L2899:
+	SLA 10, IY
+L2900:
+	RRC 3, XIX
+L2901:
+	SRL 6, C
+L2902:
+	RR 9, L
+L2903:
+	RL 9, DE
+L2904:
+	SLL 4, H
+L2905:
+	SLL 1, IZ
+L2906:
+	RR 13, XHL
+L2907:
+	SLL 3, IZ
+L2908:
+	RRC 2, E
+L2909:
+	SRA 4, IX
+L2910:
+	SRL 11, XDE
+L2911:
+	RR 5, DE
+L2912:
+	SLL 11, IX
+L2913:
+	SLA 4, E
+L2914:
+	SRL 9, A
+L2915:
+	SLL 11, L
+L2916:
+	RRC 15, IX
+L2917:
+	RR 9, DE
+L2918:
+	RLC 7, L
+L2919:
+	RL 3, D
+L2920:
+	SRL 1, IX
+L2921:
+	SLL 14, BC
+L2922:
+	RR 5, XDE
+L2923:
+	SLA 10, WA
+L2924:
+	SRA 5, L
+L2925:
+	RR 12, XBC
+L2926:
+	SRA 9, XBC
+L2927:
+	SLA 5, IX
+L2928:
+	SLL 2, WA
+L2929:
+	SRA 5, XHL
+L2930:
+	RL 6, L
+L2931:
+	SRA 2, HL
+L2932:
+	SLL 6, E
+L2933:
+	SLA 10, BC
+L2934:
+	RL 2, XIX
+L2935:
+	RR 15, W
+L2936:
+	RLC 6, XDE
+L2937:
+	SLA 10, XBC
+L2938:
+	SRA 4, W
+L2939:
+	RRC 7, L
+L2940:
+	RR 2, IY
+L2941:
+	RLC 15, IX
+L2942:
+	RL 11, A
+L2943:
+	RR 8, WA
+L2944:
+	RL 14, BC
+L2945:
+	SRL 13, D
+L2946:
+	RL 4, HL
+L2947:
+	SRL 4, XWA
+L2948:
+	SLA 4, HL
+L2949:
+	RL 11, B
+L2950:
+	SRA 13, L
+L2951:
+	SRA 6, IY
+L2952:
+	RLC 9, A
+L2953:
+	SLL 5, A
+L2954:
+	SLL 12, IY
+L2955:
+	RRC 11, XIX
+L2956:
+	SRA 14, B
+L2957:
+	SRA 12, W
+L2958:
+	SRA 15, XDE
+L2959:
+	SRA 15, DE
+L2960:
+	SLA 14, L
+L2961:
+	SRL 6, D
+L2962:
+	SRA 13, C
+L2963:
+	SLA 6, L
+L2964:
+	SRL 8, H
+L2965:
+	SRL 15, XBC
+L2966:
+	SRL 3, XIZ
+L2967:
+	SRL 11, HL
+L2968:
+	RR 14, HL
+L2969:
+	SLA 3, IX
+L2970:
+	RRC 5, W
+L2971:
+	RLC 13, A
+L2972:
+	RR 14, H
+L2973:
+	SRL 8, BC
+L2974:
+	RRC 1, HL
+L2975:
+	SRL 2, XWA
+L2976:
+	RRC 4, XWA
+L2977:
+	SRL 5, A
+L2978:
+	SLL 5, A
+L2979:
+	RLC 3, XBC
+L2980:
+	SRL 1, HL
+L2981:
+	SLA 5, DE
+L2982:
+	RLC 3, DE
+L2983:
+	SLA 8, L
+L2984:
+	RL 9, XBC
+L2985:
+	RL 5, IX
+L2986:
+	SLL 14, XWA
+L2987:
+	SLA 8, XDE
+L2988:
+	SLL 4, XWA
+L2989:
+	SLA 3, DE
+L2990:
+	SRL 11, D
+L2991:
+	SRA 13, D
+L2992:
+	SLA 9, IX
+L2993:
+	RL 1, E
+L2994:
+	RLC 13, XIY
+L2995:
+	SRA 14, C
+L2996:
+	SLL 8, B
+L2997:
+	SLL 6, XIZ
+L2998:
+	SRA 8, IY
+L2999:
+	RRC 14, XWA
+L3000:
+	RRC 5, HL
+L3001:
+	RR 11, D
+L3002:
+	SRL 8, XIX
+L3003:
+	SLA 14, IY
+L3004:
+	RL 1, XBC
+L3005:
+	SLL 14, DE
+L3006:
+	SLL 4, XWA
+L3007:
+	SRL 1, WA
+L3008:
+	RLC 9, XHL
+L3009:
+	RLC 2, L
+L3010:
+	RR 5, XDE
+L3011:
+	RRC 1, DE
+L3012:
+	SRL 10, HL
+L3013:
+	SLA 4, IY
+L3014:
+	RLC 6, BC
+L3015:
+	RRC 13, XHL
+L3016:
+	RLC 1, B
+L3017:
+	RR 11, E
+L3018:
+	SRA 13, BC
+L3019:
+	SLA 11, HL
+L3020:
+	SRA 3, W
+L3021:
+	RR 8, H
+L3022:
+	SLA 12, IY
+L3023:
+	SRA 6, XHL
+L3024:
+	SRL 7, D
+L3025:
+	SRL 7, XHL
+L3026:
+	SRA 15, IZ
+L3027:
+	RL 12, XHL
+L3028:
+	SLL 9, XIZ
+L3029:
+	SRL 7, XWA
+L3030:
+	RRC 15, A
+L3031:
+	SLL 13, XIY
+L3032:
+	SRA 13, WA
+L3033:
+	SRL 4, HL
+L3034:
+	RL 4, XIY
+L3035:
+	RR 8, IZ
+L3036:
+	SRL 1, WA
+L3037:
+	RRC 14, W
+L3038:
+	SLA 6, XIZ
+L3039:
+	RLC 10, XDE
+L3040:
+	RL 9, IX
+L3041:
+	RL 6, L
+L3042:
+	RRC 15, L
+L3043:
+	RL 2, H
+L3044:
+	SRL 9, XDE
+L3045:
+	RR 14, XWA
+L3046:
+	SLA 11, IY
+L3047:
+	RRC 4, IX
+L3048:
+	RRC 1, WA
+L3049:
+	SLA 10, XWA
+L3050:
+	SLA 10, DE
+L3051:
+	SRA 15, H
+L3052:
+	RRC 11, BC
+L3053:
+	SLA 9, XIY
+L3054:
+	SRA 7, XHL
+L3055:
+	SRL 11, DE
+L3056:
+	SLA 9, W
+L3057:
+	RR 2, H
+L3058:
+	SRL 5, XDE
+L3059:
+	SRL 3, XIY
+L3060:
+	SLL 1, XHL
+L3061:
+	SRL 10, XIZ
+L3062:
+	RLC 15, D
+L3063:
+	RR 3, XIY
+L3064:
+	RR 1, IY
+L3065:
+	SLA 8, HL
+L3066:
+	RL 14, XDE
+L3067:
+	SRL 11, XIZ
+L3068:
+	RRC 4, BC
+L3069:
+	SLA 5, XIZ
+L3070:
+	SRL 11, A
+L3071:
+	RR 1, H
+L3072:
+	SLL 15, W
+L3073:
+	RLC 8, L
+L3074:
+	RLC 3, XIY
+L3075:
+	SRL 2, XIX
+L3076:
+	RRC 6, C
+L3077:
+	RL 13, A
+L3078:
+	SLA 11, H
+L3079:
+	SLA 12, XDE
+L3080:
+	RR 10, D
+L3081:
+	SRL 15, D
+L3082:
+	RLC 8, DE
+L3083:
+	SRL 14, XIX
+L3084:
+	RR 2, C
+L3085:
+	RL 9, XIY
+L3086:
+	SLA 3, WA
+L3087:
+	SLL 7, XDE
+L3088:
+	RLC 3, IY
+L3089:
+	SLA 8, XBC
+L3090:
+	SRA 14, H
+L3091:
+	RRC 1, XIX
+L3092:
+	RRC 7, W
+L3093:
+	RRC 4, DE
+L3094:
+	RL 5, XIY
+L3095:
+	SLL 10, BC
+L3096:
+	SRA 11, WA
+L3097:
+	SLA 8, XIX
+L3098:
+	SRA 4, WA
+L3099:
+	SRA 15, DE
+L3100:
+	SLL 9, XWA
+L3101:
+	RR 6, HL
+L3102:
+	RRC 8, W
+L3103:
+	SRA 5, DE
+L3104:
+	SRL 10, XDE
+L3105:
+	RLC 7, XIY
+L3106:
+	SRL 2, XIX
+L3107:
+	SLL 4, HL
+L3108:
+	RL 1, H
+L3109:
+	SRA 10, B
+L3110:
+	RL 12, IZ
+L3111:
+	SLL 12, XIZ
+L3112:
+	SLL 14, E
+L3113:
+	RRC 3, L
+L3114:
+	SLA 5, B
+L3115:
+	SRL 11, IY
+L3116:
+	SRL 9, XHL
+L3117:
+	SLL 10, W
+L3118:
+	SLA 11, H
+L3119:
+	RR 5, XWA
+L3120:
+	RL 14, XHL
+L3121:
+	RR 8, L
+L3122:
+	SLL 1, XIX
+L3123:
+	SRA 3, L
+L3124:
+	SRA 7, W
+L3125:
+	RR 13, WA
+L3126:
+	RRC 9, W
+L3127:
+	SLA 3, DE
+L3128:
+	RR 3, XWA
+L3129:
+	RLC 6, BC
+L3130:
+	SLL 14, IX
+L3131:
+	RRC 10, E
+L3132:
+	RL 5, BC
+L3133:
+	SRL 15, H
+L3134:
+	SRL 1, W
+L3135:
+	SRL 2, IX
+L3136:
+	RLC 9, IY
+L3137:
+	RRC 2, XBC
+L3138:
+	SRL 6, HL
+L3139:
+	RR 4, IY
+L3140:
+	RLC 2, XIX
+L3141:
+	SLL 9, A
+L3142:
+	SRL 7, DE
+L3143:
+	SLA 7, DE
+L3144:
+	RRC 4, IY
+L3145:
+	SLL 14, A
+L3146:
+	SRL 2, L
+L3147:
+	SLA 3, L
+L3148:
+	SLA 8, IZ
+L3149:
+	SLL 4, HL
+L3150:
+	SRL 7, XBC
+L3151:
+	RRC 14, IX
+L3152:
+	SLL 4, H
+L3153:
+	SRL 4, L
+L3154:
+	RL 10, XIX
+L3155:
+	SLL 11, W
+L3156:
+	RR 9, XWA
+L3157:
+	SLL 10, XIZ
+L3158:
+	RR 9, XIX
+L3159:
+	RLC 10, XHL
+L3160:
+	SRL 13, C
+L3161:
+	RR 1, XHL
+L3162:
+	SLL 2, XIY
+L3163:
+	RR 5, XDE
+L3164:
+	SRA 2, XIX
+L3165:
+	RLC 4, BC
+L3166:
+	SRL 2, XIY
+L3167:
+	RRC 5, XHL
+L3168:
+	SRL 2, D
+L3169:
+	RR 12, L
+L3170:
+	RL 4, XIX
+L3171:
+	RR 3, XIX
+L3172:
+	SRL 10, IY
+L3173:
+	SRL 5, H
+L3174:
+	RL 15, B
+L3175:
+	RR 15, BC
+L3176:
+	SRL 7, L
+L3177:
+	RR 12, E
+L3178:
+	SRL 4, XWA
+L3179:
+	RRC 14, D
+L3180:
+	RR 11, IZ
+L3181:
+	SLL 15, A
+L3182:
+	RLC 10, WA
+L3183:
+	SLA 15, E
+L3184:
+	RR 12, DE
+L3185:
+	SLA 5, XWA
+L3186:
+	RL 14, W
+L3187:
+	RL 12, H
+L3188:
+	SLL 4, XIY
+L3189:
+	SRA 15, B
+L3190:
+	SLL 4, IX
+L3191:
+	SRL 12, E
+L3192:
+	SLA 6, E
+L3193:
+	SRL 3, A
+L3194:
+	SRL 7, W
+L3195:
+	RLC 5, IX
+L3196:
+	RR 10, D
+L3197:
+	RLC 11, XIZ
+L3198:
+	RRC 15, XIY
+L3199:
+	SLL 13, XHL
+L3200:
+	RR 2, XIY
+L3201:
+	RR 14, WA
+L3202:
+	SRA 1, IX
+L3203:
+	RR 7, XDE
+L3204:
+	RRC 7, DE
+L3205:
+	RR 3, XBC
+L3206:
+	SRL 11, B
+L3207:
+	SLL 9, XIX
+L3208:
+	SRA 13, IY
+L3209:
+	RR 13, BC
+L3210:
+	SLL 13, XWA
+L3211:
+	SRL 2, H
+L3212:
+	SLA 7, L
+L3213:
+	RRC 6, WA
+L3214:
+	RR 15, IY
+L3215:
+	RLC 7, DE
+L3216:
+	SRA 2, XHL
+L3217:
+	SRA 5, A
+L3218:
+	SRA 13, WA
+L3219:
+	SLA 12, L
+L3220:
+	RR 11, XBC
+L3221:
+	RL 10, DE
+L3222:
+	SRL 10, XDE
+L3223:
+	RL 2, XIZ
+L3224:
+	SLA 6, IY
+L3225:
+	SRA 13, XIZ
+L3226:
+	SLL 11, XWA
+L3227:
+	RR 10, A
+L3228:
+	RRC 5, H
+L3229:
+	SLL 13, IX
+L3230:
+	RRC 14, L
+L3231:
+	SLL 7, XIX
+L3232:
+	SLA 7, IZ
+L3233:
+	SRL 7, B
+L3234:
+	SLA 7, HL
+L3235:
+	RL 7, IY
+L3236:
+	RL 2, C
+L3237:
+	RR 3, XIY
+L3238:
+	RRC 14, E
+L3239:
+	SLA 3, E
+L3240:
+	RR 8, XWA
+L3241:
+	SRA 14, DE
+L3242:
+	SLL 7, B
+L3243:
+	RR 14, IY
+L3244:
+	RRC 6, DE
+L3245:
+	RRC 1, XBC
+L3246:
+	SLA 12, IY
+L3247:
+	RL 1, HL
+L3248:
+	RLC 15, E
+L3249:
+	SRA 6, BC
+L3250:
+	SLL 6, XIY
+L3251:
+	RR 11, D
+L3252:
+	RLC 1, XWA
+L3253:
+	SRA 10, H
+L3254:
+	SRL 3, L
+L3255:
+	SLL 11, XBC
+L3256:
+	SLL 9, IX
+L3257:
+	SLL 2, H
+L3258:
+	SLL 7, C
+L3259:
+	RR 8, WA
+L3260:
+	SLA 2, DE
+L3261:
+	SRA 15, HL
+L3262:
+	SLL 2, XIZ
+L3263:
+	SLA 11, XBC
+L3264:
+	SLA 11, D
+L3265:
+	SRA 11, B
+L3266:
+	RR 8, XBC
+L3267:
+	SLL 7, D
+L3268:
+	SLA 5, H
+L3269:
+	SLA 9, IY
+L3270:
+	RRC 7, L
+L3271:
+	RL 13, L
+L3272:
+	SRL 13, IZ
+L3273:
+	SRL 8, IZ
+L3274:
+	RLC 2, XIY
+L3275:
+	SRA 4, HL
+L3276:
+	RRC 2, XIZ
+L3277:
+	RR 14, DE
+L3278:
+	RLC 5, IY
+L3279:
+	SLL 10, H
+L3280:
+	RL 1, BC
+L3281:
+	SLL 1, XWA
+L3282:
+	SRL 1, L
+L3283:
+	RRC 3, WA
+L3284:
+	RRC 9, IY
+L3285:
+	RL 14, A
+L3286:
+	SRA 13, XHL
+L3287:
+	RR 14, XIY
+L3288:
+	RRC 12, E
+L3289:
+	RLC 13, XWA
+L3290:
+	SRA 4, IX
+L3291:
+	RLC 2, W
+L3292:
+	RRC 7, BC
+L3293:
+	RRC 10, IX
+L3294:
+	SRL 6, W
+L3295:
+	SRA 1, XBC
+L3296:
+	SLA 10, H
+L3297:
+	SRA 7, BC
+L3298:
+	SRA 7, DE
+L3299:
+	RLC 9, HL
+L3300:
+	RL 7, C
+L3301:
+	RR 14, BC
+L3302:
+	RR 6, IY
+L3303:
+	RRC 13, XBC
+L3304:
+	RL 14, HL
+L3305:
+	SRL 4, WA
+L3306:
+	SLA 9, IY
+L3307:
+	RLC 12, HL
+L3308:
+	RR 5, DE
+L3309:
+	SRA 13, XIZ
+L3310:
+	RR 8, B
+L3311:
+	SRL 2, XHL
+L3312:
+	RRC 3, HL
+L3313:
+	SRL 12, WA
+L3314:
+	SLL 1, XHL
+L3315:
+	RL 10, IY
+L3316:
+	RR 10, IZ
+L3317:
+	SRA 4, W
+L3318:
+	RLC 7, D
+L3319:
+	SRL 3, DE
+L3320:
+	RL 4, DE
+L3321:
+	SLL 6, XIZ
+L3322:
+	SLL 1, W
+L3323:
+	RLC 12, XWA
+L3324:
+	RRC 14, HL
+L3325:
+	RR 8, XIZ
+L3326:
+	SLA 15, D
+L3327:
+	SLL 2, H
+L3328:
+	RLC 8, XIX
+L3329:
+	RLC 4, XBC
+L3330:
+	RLC 7, BC
+L3331:
+	SRL 6, XBC
+L3332:
+	RLC 12, XBC
+L3333:
+	SRL 2, H
+L3334:
+	SRA 10, IX
+L3335:
+	SLA 2, C
+L3336:
+	RRC 12, XIY
+L3337:
+	RRC 8, XIX
+L3338:
+	RRC 4, W
+L3339:
+	RL 10, A
+L3340:
+	SLL 6, XIY
+L3341:
+	SLL 11, XHL
+L3342:
+	SLL 14, D
+L3343:
+	SLL 1, IZ
+L3344:
+	SRA 4, XHL
+L3345:
+	RL 7, W
+L3346:
+	RR 11, XHL
+L3347:
+	RL 6, XWA
+L3348:
+	RL 1, IY
+L3349:
+	RR 8, XHL
+L3350:
+	SRL 14, IZ
+L3351:
+	RLC 5, B
+L3352:
+	SRA 4, A
+L3353:
+	RRC 7, XIZ
+L3354:
+	SLA 13, W
+L3355:
+	SLA 2, B
+L3356:
+	SRA 14, XBC
+L3357:
+	SRA 6, IY
+L3358:
+	SLL 14, A
+L3359:
+	RLC 13, WA
+L3360:
+	SLL 9, DE
+L3361:
+	SLL 6, XBC
+L3362:
+	RR 4, WA
+L3363:
+	SRA 8, XIX
+L3364:
+	SRA 6, DE
+L3365:
+	SRL 2, HL
+L3366:
+	SRA 10, L
+L3367:
+	RL 13, XIX
+L3368:
+	SRA 14, WA
+L3369:
+	SRA 1, HL
+L3370:
+	SRL 6, XHL
+L3371:
+	RRC 14, XHL
+L3372:
+	SLA 11, XIZ
+L3373:
+	SRL 12, BC
+L3374:
+	SLA 9, B
+L3375:
+	SLA 4, BC
+L3376:
+	SRL 3, C
+L3377:
+	SLL 1, IY
+L3378:
+	RRC 3, XHL
+L3379:
+	SRA 10, A
+L3380:
+	SRA 11, C
+L3381:
+	RLC 12, XIZ
+L3382:
+	RRC 3, XDE
+L3383:
+	RR 1, DE
+L3384:
+	SLA 5, XDE
+L3385:
+	RLC 3, W
+L3386:
+	RRC 10, L
+L3387:
+	SLL 12, BC
+L3388:
+	RLC 5, C
+L3389:
+	SRL 15, A
+L3390:
+	RLC 9, A
+L3391:
+	SRL 4, XIY
+L3392:
+	SLA 5, E
+L3393:
+	SRA 1, D
+L3394:
+	RRC 8, A
+L3395:
+	SRL 6, XIX
+L3396:
+	RLC 1, BC
+L3397:
+	RRC 8, XBC
+L3398:
+	SLL 6, IX
+L3399:
+	RR 14, BC
+L3400:
+	SLL 12, D
+L3401:
+	RL 10, E
+L3402:
+	SLA 6, XDE
+L3403:
+	RL 6, D
+L3404:
+	SLA 6, E
+L3405:
+	SRL 11, XBC
+L3406:
+	RR 15, XHL
+L3407:
+	RRC 3, IZ
+L3408:
+	SLA 3, IZ
+L3409:
+	SRA 3, C
+L3410:
+	SRL 8, HL
+L3411:
+	SLL 8, E
+L3412:
+	RRC 10, IX
+L3413:
+	SRA 5, XHL
+L3414:
+	RR 12, XBC
+L3415:
+	RLC 5, L
+L3416:
+	SLL 7, C
+L3417:
+	SLL 11, E
+L3418:
+	SRA 7, XBC
+L3419:
+	SLA 4, L
+L3420:
+	SLA 11, BC
+L3421:
+	SLA 15, DE
+L3422:
+	SLA 14, L
+L3423:
+	RLC 10, BC
+L3424:
+	RLC 15, H
+L3425:
+	SLA 3, XIX
+L3426:
+	SLA 6, XWA
+L3427:
+	RR 10, XHL
+L3428:
+	RR 7, DE
+L3429:
+	SLA 5, HL
+L3430:
+	SLA 4, A
+L3431:
+	SRA 3, BC
+L3432:
+	SLA 14, WA
+L3433:
+	RRC 9, BC
+L3434:
+	RRC 10, D
+L3435:
+	RLC 6, IY
+L3436:
+	RRC 8, B
+L3437:
+	SRL 8, IZ
+L3438:
+	SRL 9, WA
+L3439:
+	RRC 12, IX
+L3440:
+	RR 8, B
+L3441:
+	RL 6, IY
+L3442:
+	RL 13, H
+L3443:
+	RR 2, HL
+L3444:
+	RRC 13, XBC
+L3445:
+	SRA 7, XIZ
+L3446:
+	RLC 15, XWA
+L3447:
+	RR 4, IZ
+L3448:
+	RLC 7, L
+L3449:
+	RLC 3, H
+L3450:
+	SLA 1, W
+L3451:
+	SRL 13, XDE
+L3452:
+	SRL 2, E
+L3453:
+	RL 1, D
+L3454:
+	RL 10, L
+L3455:
+	RL 1, IY
+L3456:
+	RLC 6, A
+L3457:
+	RR 2, IZ
+L3458:
+	SRL 11, H
+L3459:
+	SLL 10, XIY
+L3460:
+	RR 5, IY
+L3461:
+	SLA 14, WA
+L3462:
+	SLL 11, A
+L3463:
+	SLL 9, DE
+L3464:
+	SLA 8, XBC
+L3465:
+	SRA 3, B
+L3466:
+	SLL 2, H
+L3467:
+	SLA 2, XBC
+L3468:
+	RLC 4, IZ
+L3469:
+	RRC 5, E
+L3470:
+	RLC 3, DE
+L3471:
+	SRA 3, L
+L3472:
+	SRL 1, BC
+L3473:
+	RRC 2, IZ
+L3474:
+	SLL 8, XIZ
+L3475:
+	SLA 15, A
+L3476:
+	RR 8, HL
+L3477:
+	RR 14, C
+L3478:
+	SLA 11, DE
+L3479:
+	RRC 13, WA
+L3480:
+	SLL 1, C
+L3481:
+	SLA 8, XDE
+L3482:
+	SLL 5, XIY
+L3483:
+	SRL 15, IX
+L3484:
+	RL 9, XWA
+L3485:
+	SLL 13, DE
+L3486:
+	SRL 1, IX
+L3487:
+	SRL 2, B
+L3488:
+	RR 11, WA
+L3489:
+	SLL 4, B
+L3490:
+	RR 15, WA
+L3491:
+	SRL 11, IY
+L3492:
+	RR 14, BC
+L3493:
+	SLA 12, W
+L3494:
+	SLA 11, XDE
+L3495:
+	RRC 1, WA
+L3496:
+	RR 9, H
+L3497:
+	SRA 11, BC
+L3498:
+	RRC 6, IY
+L3499:
+	RLC 9, H
+L3500:
+	SLL 9, IY
+L3501:
+	RL 12, XWA
+L3502:
+	RRC 6, XHL
+L3503:
+	SLA 11, WA
+L3504:
+	RRC 10, BC
+L3505:
+	RR 5, XBC
+L3506:
+	SLA 13, BC
+L3507:
+	SLL 1, D
+L3508:
+	SRA 13, IZ
+L3509:
+	SLL 13, H
+L3510:
+	RL 12, IZ
+L3511:
+	RR 8, W
+L3512:
+	RRC 1, E
+L3513:
+	SRL 5, C
+L3514:
+	RLC 13, XWA
+L3515:
+	RL 14, XBC
+L3516:
+	RR 13, L
+L3517:
+	SRL 14, E
+L3518:
+	RLC 2, B
+L3519:
+	RR 14, L
+L3520:
+	RL 11, XBC
+L3521:
+	RL 1, B
+L3522:
+	RR 4, XBC
+L3523:
+	SRL 10, XWA
+L3524:
+	RR 2, XBC
+L3525:
+	SRL 4, WA
+L3526:
+	SRA 7, WA
+L3527:
+	SRL 12, XWA
+L3528:
+	SRA 12, XIX
+L3529:
+	RRC 7, B
+L3530:
+	RL 6, WA
+L3531:
+	RLC 14, XHL
+L3532:
+	RR 9, BC
+L3533:
+	RL 5, B
+L3534:
+	RLC 11, E
+L3535:
+	RRC 5, IX
+L3536:
+	RRC 4, B
+L3537:
+	RR 10, XIZ
+L3538:
+	SRL 7, W
+L3539:
+	SRL 2, H
+L3540:
+	RR 6, DE
+L3541:
+	SLL 14, IZ
+L3542:
+	RL 11, IX
+L3543:
+	RLC 1, B
+L3544:
+	SLA 11, XIX
+L3545:
+	SLL 13, HL
+L3546:
+	SLA 15, XWA
+L3547:
+	SRA 8, BC
+L3548:
+	RL 10, E
+L3549:
+	SLL 4, XBC
+L3550:
+	SLA 4, A
+L3551:
+	RL 2, XWA
+L3552:
+	SLL 2, IY
+L3553:
+	SRA 2, B
+L3554:
+	SRA 10, WA
+L3555:
+	RL 1, B
+L3556:
+	SRL 12, XWA
+L3557:
+	RLC 7, XHL
+L3558:
+	RRC 14, IY
+L3559:
+	RR 11, XIZ
+L3560:
+	SRL 4, WA
+L3561:
+	SRL 12, IX
+L3562:
+	RL 12, XDE
+L3563:
+	RRC 4, XHL
+L3564:
+	SLL 5, E
+L3565:
+	RL 7, XBC
+L3566:
+	SRL 13, IZ
+L3567:
+	SRA 1, IZ
+L3568:
+	RRC 14, BC
+L3569:
+	SRL 7, IX
+L3570:
+	SRL 11, L
+L3571:
+	SRL 11, W
+L3572:
+	SLA 1, XWA
+L3573:
+	SRA 6, XBC
+L3574:
+	SRA 5, XIX
+L3575:
+	RLC 6, H
+L3576:
+	RRC 8, B
+L3577:
+	RLC 8, XWA
+L3578:
+	SLA 8, A
+L3579:
+	RR 8, L
+L3580:
+	RRC 12, XDE
+L3581:
+	RRC 3, XBC
+L3582:
+	SRL 1, WA
+L3583:
+	SRA 8, DE
+L3584:
+	RL 11, XDE
+L3585:
+	RLC 1, C
+L3586:
+	SLL 12, DE
+L3587:
+	SRA 13, BC
+L3588:
+	SRL 11, XIY
+L3589:
+	SRA 12, B
+L3590:
+	SLA 1, IY
+L3591:
+	RR 8, XIY
+L3592:
+	SRL 10, BC
+L3593:
+	RLC 7, A
+L3594:
+	RL 13, XWA
+L3595:
+	SRA 14, XHL
+L3596:
+	SLL 14, IX
+L3597:
+	RLC 11, C
+L3598:
+	SLL 4, IY
+L3599:
+	SRL 10, XIZ
+L3600:
+	RR 2, H
+L3601:
+	RL 4, XIX
+L3602:
+	SRA 10, IY
+L3603:
+	SLA 12, B
+L3604:
+	RR 10, XWA
+L3605:
+	RL 2, IZ
+L3606:
+	SLL 4, XIX
+L3607:
+	RRC 5, IY
+L3608:
+	SRA 15, XBC
+L3609:
+	SRL 2, L
+L3610:
+	SLL 6, C
+L3611:
+	RL 8, H
+L3612:
+	SRA 2, XDE
+L3613:
+	RRC 14, WA
+L3614:
+	SLA 8, WA
+L3615:
+	SLL 8, W
+L3616:
+	RR 12, HL
+L3617:
+	RRC 2, DE
+L3618:
+	SRA 7, XHL
+L3619:
+	SRL 6, XDE
+L3620:
+	SRA 10, HL
+L3621:
+	RRC 15, WA
+L3622:
+	RR 10, IX
+L3623:
+	RLC 6, IZ
+L3624:
+	SRL 15, L
+L3625:
+	RL 5, XBC
+L3626:
+	RRC 7, A
+L3627:
+	SLL 2, HL
+L3628:
+	RRC 8, XIZ
+L3629:
+	RL 3, XIZ
+L3630:
+	SRA 8, IX
+L3631:
+	RRC 7, C
+L3632:
+	RRC 1, IY
+L3633:
+	RR 13, WA
+L3634:
+	SLA 4, XIZ
+L3635:
+	SRL 6, IZ
+L3636:
+	SLA 6, IY
+L3637:
+	SRA 15, H
+L3638:
+	RLC 4, L
+L3639:
+	RLC 1, XDE
+L3640:
+	SRA 9, WA
+L3641:
+	RRC 10, C
+L3642:
+	SLA 15, XHL
+L3643:
+	SRA 5, A
+L3644:
+	RRC 15, L
+L3645:
+	RRC 11, W
+L3646:
+	SRL 7, IZ
+L3647:
+	SLA 10, A
+L3648:
+	SRA 13, W
+L3649:
+	SLA 10, C
+L3650:
+	SLA 11, XBC
+L3651:
+	SLL 13, H
+L3652:
+	SRA 13, XIZ
+L3653:
+	RR 13, W
+L3654:
+	RR 12, XHL
+L3655:
+	RRC 1, IY
+L3656:
+	RLC 12, XIX
+L3657:
+	RL 3, BC
+L3658:
+	RLC 11, DE
+L3659:
+	RLC 10, BC
+L3660:
+	SLA 11, XWA
+L3661:
+	SLL 6, XBC
+L3662:
+	RL 5, IX
+L3663:
+	RR 7, XIZ
+L3664:
+	SRA 12, BC
+L3665:
+	SLL 6, XIX
+L3666:
+	RLC 1, IZ
+L3667:
+	SLL 6, C
+L3668:
+	RL 15, XIX
+L3669:
+	RLC 5, L
+L3670:
+	RR 7, XIZ
+L3671:
+	RRC 8, HL
+L3672:
+	RR 14, B
+L3673:
+	SRA 13, HL
+L3674:
+	RR 3, XIX
+L3675:
+	SRL 10, XHL
+L3676:
+	RLC 10, H
+L3677:
+	SRL 1, E
+L3678:
+	RL 14, XIX
+L3679:
+	SRL 4, XIY
+L3680:
+	RR 6, XHL
+L3681:
+	RRC 9, BC
+L3682:
+	RLC 1, E
+L3683:
+	SLL 1, WA
+L3684:
+	SRA 4, A
+L3685:
+	SLA 3, B
+L3686:
+	RR 14, XHL
+L3687:
+	RLC 12, D
+L3688:
+	SRL 10, DE
+L3689:
+	RLC 9, BC
+L3690:
+	SLL 7, B
+L3691:
+	RR 9, B
+L3692:
+	RLC 7, C
+L3693:
+	RR 10, XIZ
+L3694:
+	RL 4, IX
+L3695:
+	SLL 11, XDE
+L3696:
+	RL 6, B
+L3697:
+	RRC 7, XDE
+L3698:
+	SLL 3, XWA
+L3699:
+	SLA 3, L
+L3700:
+	RLC 5, IZ
+L3701:
+	SLL 1, DE
+L3702:
+	SRL 12, XDE
+L3703:
+	SRL 9, IX
+L3704:
+	RR 10, XBC
+L3705:
+	RLC 2, XIY
+L3706:
+	SRA 7, XIY
+L3707:
+	RL 5, XHL
+L3708:
+	RR 1, W
+L3709:
+	SRL 9, IY
+L3710:
+	SRL 5, IY
+L3711:
+	RR 6, XIY
+L3712:
+	SLA 7, XIX
+L3713:
+	SRL 9, IX
+L3714:
+	SRA 6, E
+L3715:
+	RR 1, H
+L3716:
+	SLA 13, WA
+L3717:
+	SRA 10, IZ
+L3718:
+	RLC 14, IX
+L3719:
+	RR 2, E
+L3720:
+	RR 3, XHL
+L3721:
+	RL 1, D
+L3722:
+	SRA 11, XWA
+L3723:
+	SRL 3, E
+L3724:
+	SRL 2, XIY
+L3725:
+	RL 7, XDE
+L3726:
+	SRA 7, IX
+L3727:
+	RLC 11, W
+L3728:
+	RR 13, XHL
+L3729:
+	RR 9, H
+L3730:
+	SLA 2, A
+L3731:
+	SRA 5, A
+L3732:
+	SRA 6, XHL
+L3733:
+	RRC 10, A
+L3734:
+	RR 8, C
+L3735:
+	RRC 8, XBC
+L3736:
+	RL 15, XDE
+L3737:
+	RR 4, L
+L3738:
+	SLA 13, W
+L3739:
+	RRC 15, E
+L3740:
+	SRL 13, XDE
+L3741:
+	RRC 2, XIX
+L3742:
+	RLC 11, WA
+L3743:
+	RL 14, XIX
+L3744:
+	SRA 2, IY
+L3745:
+	SRL 2, XIX
+L3746:
+	RLC 14, XIZ
+L3747:
+	SLL 1, B
+L3748:
+	RLC 8, XHL
+L3749:
+	SLL 12, L
+L3750:
+	SLA 4, XHL
+L3751:
+	RLC 10, B
+L3752:
+	RRC 5, L
+L3753:
+	SLA 13, IX
+L3754:
+	RL 13, IX
+L3755:
+	SRA 2, IZ
+L3756:
+	RL 13, DE
+L3757:
+	SRL 6, BC
+L3758:
+	SLL 7, HL
+L3759:
+	SLL 13, D
+L3760:
+	SRL 6, XWA
+L3761:
+	RRC 7, IY
+L3762:
+	RR 10, E
+L3763:
+	SRL 3, XWA
+L3764:
+	RR 3, IX
+L3765:
+	RLC 3, H
+L3766:
+	RL 15, IX
+L3767:
+	SLA 4, IY
+L3768:
+	SRA 11, WA
+L3769:
+	RLC 14, DE
+L3770:
+	SLA 6, XIY
+L3771:
+	RL 12, H
+L3772:
+	SLL 9, XDE
+L3773:
+	RR 7, IX
+L3774:
+	SLA 15, DE
+L3775:
+	SLA 5, IZ
+L3776:
+	SRA 11, XIX
+L3777:
+	SRA 12, W
+L3778:
+	RRC 11, DE
+L3779:
+	SLL 12, XHL
+L3780:
+	RLC 8, XHL
+L3781:
+	RR 14, DE
+L3782:
+	RL 5, E
+L3783:
+	RLC 12, IY
+L3784:
+	SRA 13, HL
+L3785:
+	SLL 15, XWA
+L3786:
+	RLC 11, XIZ
+L3787:
+	SRL 3, XDE
+L3788:
+	RRC 3, IX
+L3789:
+	RR 13, D
+L3790:
+	RRC 13, XIZ
+L3791:
+	SLL 8, IY
+L3792:
+	SLL 14, C
+L3793:
+	RLC 2, IX
+L3794:
+	SLA 4, WA
+L3795:
+	SRA 1, XIY
+L3796:
+	SLA 4, XBC
+L3797:
+	RL 7, IY
+L3798:
+	RL 6, XWA
+L3799:
+	SRL 2, XBC
+L3800:
+	SLA 6, BC
+L3801:
+	RR 5, W
+L3802:
+	SLA 4, HL
+L3803:
+	SRA 4, A
+L3804:
+	RR 9, IZ
+L3805:
+	RLC 4, E
+L3806:
+	RRC 8, L
+L3807:
+	SLL 6, XIX
+L3808:
+	RL 3, HL
+L3809:
+	RLC 11, A
+L3810:
+	RR 10, BC
+L3811:
+	SRL 4, BC
+L3812:
+	RL 7, IX
+L3813:
+	RR 13, XBC
+L3814:
+	SRA 2, H
+L3815:
+	SLL 15, B
+L3816:
+	RLC 13, E
+L3817:
+	SLL 7, W
+L3818:
+	RLC 11, XDE
+L3819:
+	RR 12, XHL
+L3820:
+	RLC 15, IZ
+L3821:
+	SLL 13, E
+L3822:
+	RR 4, DE
+L3823:
+	RLC 2, XIZ
+L3824:
+	SLL 13, D
+L3825:
+	RLC 14, WA
+L3826:
+	RLC 13, B
+L3827:
+	SLA 1, DE
+L3828:
+	SRL 8, BC
+L3829:
+	RLC 6, XIX
+L3830:
+	RLC 1, XIY
+L3831:
+	SRL 6, XHL
+L3832:
+	SLA 8, BC
+L3833:
+	RL 8, IX
+L3834:
+	SRA 13, IX
+L3835:
+	SRL 6, WA
+L3836:
+	SRA 3, BC
+L3837:
+	SLA 10, IZ
+L3838:
+	SRL 13, D
+L3839:
+	SLL 6, BC
+L3840:
+	RLC 10, D
+L3841:
+	RLC 4, W
+L3842:
+	SRL 10, IX
+L3843:
+	SLL 1, IX
+L3844:
+	SLL 9, XHL
+L3845:
+	SLA 8, B
+L3846:
+	RRC 15, XDE
+L3847:
+	SRA 13, E
+L3848:
+	RR 15, BC
+L3849:
+	SLA 15, E
+L3850:
+	RRC 6, XWA
+L3851:
+	SLL 13, XIX
+L3852:
+	RR 14, E
+L3853:
+	SLL 10, XIX
+L3854:
+	RRC 1, E
+L3855:
+	RLC 9, A
+L3856:
+	RLC 7, WA
+L3857:
+	SRL 9, XIZ
+L3858:
+	SRL 11, L
+L3859:
+	SLA 14, L
+L3860:
+	RRC 9, E
+L3861:
+	SRA 4, HL
+L3862:
+	RRC 15, W
+L3863:
+	RR 1, IZ
+L3864:
+	RRC 13, DE
+L3865:
+	RLC 13, D
+L3866:
+	SLL 12, H
+L3867:
+	SLL 13, XIX
+L3868:
+	RRC 3, XBC
+L3869:
+	RRC 12, XIX
+L3870:
+	SLA 10, B
+L3871:
+	SRA 4, W
+L3872:
+	RL 12, WA
+L3873:
+	SRA 9, WA
+L3874:
+	RR 3, XIZ
+L3875:
+	RR 12, E
+L3876:
+	RL 15, XHL
+L3877:
+	RLC 10, L
+L3878:
+	RLC 8, WA
+L3879:
+	SRL 11, E
+L3880:
+	SLL 3, C
+L3881:
+	RRC 9, D
+L3882:
+	RL 13, XIX
+L3883:
+	RR 14, IZ
+L3884:
+	RRC 10, IY
+L3885:
+	RL 15, HL
+L3886:
+	RRC 10, IX
+L3887:
+	SRL 7, HL
+L3888:
+	SLA 1, IZ
+L3889:
+	SRL 6, HL
+L3890:
+	SRA 8, W
+L3891:
+	RR 5, HL
+L3892:
+	RL 7, WA
+L3893:
+	RL 14, D
+L3894:
+	SLL 4, E
+L3895:
+	RL 2, XIY
+L3896:
+	SLL 3, A
+L3897:
+	RR 9, XHL
+L3898:
+	RR 12, WA
+L3899:
+	SLA 15, XIZ
+L3900:
+	RRC 9, IX
+L3901:
+	SRA 3, XIX
+L3902:
+	RLC 1, IX
+L3903:
+	SRA 12, XWA
+L3904:
+	RL 14, XWA
+L3905:
+	RRC 14, XDE
+L3906:
+	RLC 5, XWA
+L3907:
+	SLA 7, HL
+L3908:
+	SLA 2, XIX
+L3909:
+	RLC 1, XIY
+L3910:
+	SRL 12, H
+L3911:
+	SLL 6, W
+L3912:
+	SRL 2, XWA
+L3913:
+	RLC 11, WA
+L3914:
+	RR 5, IZ
+L3915:
+	SRL 13, IX
+L3916:
+	RR 2, H
+L3917:
+	SRA 11, C
+L3918:
+	SLA 1, IX
+L3919:
+	RR 6, IZ
+L3920:
+	SLL 5, XIZ
+L3921:
+	RLC 14, WA
+L3922:
+	RL 6, IX
+L3923:
+	SRA 12, XIY
+L3924:
+	RL 8, IZ
+L3925:
+	SRA 6, IZ
+L3926:
+	SLL 6, XDE
+L3927:
+	SRA 14, DE
+L3928:
+	SRA 8, XBC
+L3929:
+	SRL 7, BC
+L3930:
+	SRL 5, B
+L3931:
+	RR 4, D
+L3932:
+	SLA 3, IX
+L3933:
+	RRC 11, XIZ
+L3934:
+	RL 12, E
+L3935:
+	SRA 4, D
+L3936:
+	SLL 11, BC
+L3937:
+	RRC 4, XDE
+L3938:
+	SLA 12, IZ
+L3939:
+	SRA 12, H
+L3940:
+	RL 14, WA
+L3941:
+	RLC 1, XBC
+L3942:
+	SRA 13, XIY
+L3943:
+	SRL 3, IZ
+L3944:
+	SLL 8, E
+L3945:
+	SRA 4, BC
+L3946:
+	RR 10, D
+L3947:
+	SLA 14, XHL
+L3948:
+	SLA 2, C
+L3949:
+	SLA 8, BC
+L3950:
+	RL 4, E
+L3951:
+	SLL 4, XIY
+L3952:
+	SRA 2, XHL
+L3953:
+	RRC 12, IZ
+L3954:
+	SLL 8, IX
+L3955:
+	SRA 12, XIY
+L3956:
+	SLA 15, C
+L3957:
+	SLL 7, C
+L3958:
+	SLL 2, E
+L3959:
+	SLL 15, XWA
+L3960:
+	RLC 7, IX
+L3961:
+	RRC 15, XBC
+L3962:
+	SRA 1, DE
+L3963:
+	RR 9, IX
+L3964:
+	SLA 10, XIX
+L3965:
+	RLC 4, H
+L3966:
+	SRA 8, E
+L3967:
+	SRA 9, IZ
+L3968:
+	RR 2, XIX
+L3969:
+	RLC 2, IX
+L3970:
+	SRA 15, DE
+L3971:
+	SRA 4, IY
+L3972:
+	RLC 14, IY
+L3973:
+	RL 1, BC
+L3974:
+	RR 10, A
+L3975:
+	SRL 15, IZ
+L3976:
+	SRA 1, IX
+L3977:
+	SRL 2, XDE
+L3978:
+	RR 9, L
+L3979:
+	SRA 3, XHL
+L3980:
+	SLL 7, XIZ
+L3981:
+	SLL 9, DE
+L3982:
+	RL 4, XHL
+L3983:
+	SRA 6, E
+L3984:
+	SRL 1, E
+L3985:
+	SRL 4, HL
+L3986:
+	SRL 13, L
+L3987:
+	SLA 4, IX
+L3988:
+	SRA 4, XDE
+L3989:
+	RLC 3, XBC
+L3990:
+	SRA 12, WA
+L3991:
+	SLA 5, XWA
+L3992:
+	SLL 2, XHL
+L3993:
+	RL 6, BC
+L3994:
+	SRL 15, WA
+L3995:
+	RRC 1, IY
+L3996:
+	SRA 13, XWA
+L3997:
+	RL 10, C
+L3998:
+	RL 3, A
+L3999:
+	RRC 2, D
+L4000:
+	SRA 13, A
+L4001:
+	RRC 3, XIZ
+L4002:
+	RLC 9, WA
+L4003:
+	SRL 7, DE
+L4004:
+	RLC 1, L
+L4005:
+	SRL 3, XBC
+L4006:
+	RLC 7, XWA
+L4007:
+	SRL 4, BC
+L4008:
+	SLL 4, HL
+L4009:
+	RRC 6, XBC
+L4010:
+	SRL 10, HL
+L4011:
+	RL 5, DE
+L4012:
+	RR 1, IZ
+L4013:
+	SRA 4, D
+L4014:
+	SRA 14, XIY
+L4015:
+	SRL 7, WA
+L4016:
+	SRL 15, WA
+L4017:
+	SLL 5, L
+L4018:
+	RRC 9, C
+L4019:
+	RLC 1, IY
+L4020:
+	RLC 15, XIZ
+L4021:
+	RR 8, XWA
+L4022:
+	RLC 14, C
+L4023:
+	RRC 9, HL
+L4024:
+	SRA 12, IY
+L4025:
+	RRC 7, HL
+L4026:
+	SRL 14, DE
+L4027:
+	RRC 8, B
+L4028:
+	RLC 9, IZ
+L4029:
+	RLC 3, IY
+L4030:
+	RL 13, DE
+L4031:
+	SRA 15, E
+L4032:
+	SRL 3, W
+L4033:
+	RR 9, D
+L4034:
+	RRC 8, W
+L4035:
+	RRC 3, XIX
+L4036:
+	RRC 15, BC
+L4037:
+	SLA 14, W
+L4038:
+	RLC 1, XIZ
+L4039:
+	RR 1, IZ
+L4040:
+	SRL 14, DE
+L4041:
+	SLA 4, H
+L4042:
+	SLA 14, IZ
+L4043:
+	SLL 6, IZ
+L4044:
+	RL 1, A
+L4045:
+	SLL 5, IZ
+L4046:
+	RL 15, W
+L4047:
+	SRA 8, IY
+L4048:
+	SLL 11, HL
+L4049:
+	RRC 9, HL
+L4050:
+	SRL 3, XDE
+L4051:
+	SLA 1, XWA
+L4052:
+	SLL 10, DE
+L4053:
+	SRL 13, XDE
+L4054:
+	SRA 8, E
+L4055:
+	RL 1, WA
+L4056:
+	SLA 14, XWA
+L4057:
+	RR 12, E
+L4058:
+	SRA 2, XIX
+L4059:
+	SRA 13, E
+L4060:
+	SRA 7, W
+L4061:
+	RR 5, XBC
+L4062:
+	RLC 13, H
+L4063:
+	RL 2, XDE
+L4064:
+	RL 4, XDE
+L4065:
+	RRC 11, DE
+L4066:
+	RL 10, XWA
+L4067:
+	SRL 4, XIX
+L4068:
+	RRC 12, XHL
+L4069:
+	RLC 9, IZ
+L4070:
+	SLA 14, C
+L4071:
+	SRA 2, XDE
+L4072:
+	RL 13, XWA
+L4073:
+	SRA 13, A
+L4074:
+	RL 14, XDE
+L4075:
+	RR 12, W
+L4076:
+	RRC 15, XIY
+L4077:
+	RR 14, L
+L4078:
+	SLA 6, DE
+L4079:
+	SLA 6, HL
+L4080:
+	RL 15, XHL
+L4081:
+	SLL 12, XHL
+L4082:
+	RRC 8, IX
+L4083:
+	RL 15, W
+L4084:
+	SRL 8, IX
+L4085:
+	RL 14, XIZ
+L4086:
+	RLC 6, XWA
+L4087:
+	SRL 13, XHL
+L4088:
+	SLA 4, A
+L4089:
+	SLL 3, L
+L4090:
+	SRA 8, IX
+L4091:
+	SLA 13, XHL
+L4092:
+	RR 3, L
+L4093:
+	SLL 15, XDE
+L4094:
+	SLL 15, D
+L4095:
+	RL 9, XDE
+L4096:
+	SLA 4, B
+L4097:
+	SLL 1, W
+L4098:
+	RRC 13, B
+L4099:
+	SLA 7, XBC
+L4100:
+	RR 12, IZ
+L4101:
+	RR 4, DE
+L4102:
+	RL 1, XDE
+L4103:
+	RR 9, L
+L4104:
+	RRC 5, BC
+L4105:
+	RRC 5, XWA
+L4106:
+	SRL 13, BC
+L4107:
+	RRC 10, L
+L4108:
+	SRL 2, HL
+L4109:
+	RRC 9, XBC
+L4110:
+	SRL 5, HL
+L4111:
+	SLL 4, HL
+L4112:
+	RL 10, IY
+L4113:
+	RR 8, A
+L4114:
+	RRC 4, IX
+L4115:
+	RRC 8, DE
+L4116:
+	SLA 14, C
+L4117:
+	SLL 3, IY
+L4118:
+	SRA 9, B
+L4119:
+	SRL 3, IX
+L4120:
+	RLC 4, IY
+L4121:
+	RR 14, IZ
+L4122:
+	SLL 8, WA
+L4123:
+	SLA 4, XDE
+L4124:
+	RL 3, XBC
+L4125:
+	SRA 5, IX
+L4126:
+	RL 4, IX
+L4127:
+	RLC 3, XIY
+L4128:
+	SLA 8, IX
+L4129:
+	SRL 15, A
+L4130:
+	RR 12, XIX
+L4131:
+	RL 8, H
+L4132:
+	SLL 14, XWA
+L4133:
+	RRC 6, XHL
+L4134:
+	RLC 6, XWA
+L4135:
+	RRC 2, WA
+L4136:
+	RR 12, XWA
+L4137:
+	RL 5, BC
+L4138:
+	RRC 12, BC
+L4139:
+	RL 12, DE
+L4140:
+	SLL 2, C
+L4141:
+	RLC 1, XWA
+L4142:
+	RL 6, IY
+L4143:
+	SLA 5, L
+L4144:
+	RLC 8, L
+L4145:
+	RRC 4, IZ
+L4146:
+	SRA 10, BC
+L4147:
+	RLC 9, D
+L4148:
+	RLC 12, XBC
+L4149:
+	RR 3, HL
+L4150:
+	SRL 3, IZ
+L4151:
+	SLA 3, A
+L4152:
+	SRL 4, HL
+L4153:
+	SRA 4, XIX
+L4154:
+	SRA 14, XWA
+L4155:
+	RLC 4, HL
+L4156:
+	RLC 11, XBC
+L4157:
+	SRL 14, DE
+L4158:
+	SLL 10, IX
+L4159:
+	RLC 8, D
+L4160:
+	SLA 4, XHL
+L4161:
+	RLC 5, IY
+L4162:
+	SRL 12, XIX
+L4163:
+	RR 14, D
+L4164:
+	SLL 3, IZ
+L4165:
+	RLC 1, XIZ
+L4166:
+	RLC 5, IX
+L4167:
+	RRC 9, IZ
+L4168:
+	SLL 9, XIX
+L4169:
+	RL 12, HL
+L4170:
+	RLC 14, H
+L4171:
+	SLL 8, HL
+L4172:
+	SLA 3, W
+L4173:
+	SRA 5, WA
+L4174:
+	SRL 3, BC
+L4175:
+	RRC 6, E
+L4176:
+	RL 15, D
+L4177:
+	RL 13, XBC
+L4178:
+	SLL 5, XWA
+L4179:
+	SRL 4, IY
+L4180:
+	SRA 12, A
+L4181:
+	RLC 2, L
+L4182:
+	SLA 15, D
+L4183:
+	RRC 13, W
+L4184:
+	SLA 13, XIX
+L4185:
+	RLC 4, HL
+L4186:
+	SLA 4, XIY
+L4187:
+	SRL 7, IZ
+L4188:
+	RLC 3, WA
+L4189:
+	SLA 2, XHL
+L4190:
+	RL 14, HL
+L4191:
+	SRL 5, IY
+L4192:
+	SRL 1, DE
+L4193:
+	SRL 12, B
+L4194:
+	RL 14, IX
+L4195:
+	SRL 12, XBC
+L4196:
+	SLA 10, XDE
+L4197:
+	RL 10, XIX
+L4198:
+	RL 3, IY
+L4199:
+	RL 4, XDE
+L4200:
+	SRA 8, XBC
+L4201:
+	SRA 1, H
+L4202:
+	RR 6, C
+L4203:
+	SRL 11, IY
+L4204:
+	SRA 6, WA
+L4205:
+	SLL 7, D
+L4206:
+	RRC 1, IX
+L4207:
+	RR 4, HL
+L4208:
+	SRA 10, IY
+L4209:
+	RLC 8, XHL
+L4210:
+	SLL 10, IZ
+L4211:
+	RL 10, XIY
+L4212:
+	SRA 6, H
+L4213:
+	SRA 12, XIX
+L4214:
+	SRA 5, C
+L4215:
+	RRC 13, BC
+L4216:
+	RL 14, W
+L4217:
+	SLL 5, C
+L4218:
+	SRL 14, B
+L4219:
+	SRL 12, H
+L4220:
+	SRL 12, D
+L4221:
+	SRA 6, XIY
+L4222:
+	SLL 15, BC
+L4223:
+	SRL 14, L
+L4224:
+	SLL 8, C
+L4225:
+	SRA 1, H
+L4226:
+	SLL 13, B
+L4227:
+	RR 2, L
+L4228:
+	RRC 9, IX
+L4229:
+	SLA 8, XHL
+L4230:
+	SLA 7, XIX
+L4231:
+	SRL 9, A
+L4232:
+	RR 13, B
+L4233:
+	RLC 3, XHL
+L4234:
+	SRL 5, XBC
+L4235:
+	RR 7, XDE
+L4236:
+	SLA 12, IZ
+L4237:
+	SLL 9, IY
+L4238:
+	RR 11, B
+L4239:
+	SLL 12, IX
+L4240:
+	RL 4, XIY
+L4241:
+	SLL 13, B
+L4242:
+	RLC 9, B
+L4243:
+	SLL 15, WA
+L4244:
+	RR 10, L
+L4245:
+	RR 12, WA
+L4246:
+	RL 8, A
+L4247:
+	RRC 14, XBC
+L4248:
+	RL 8, A
+L4249:
+	SLA 6, HL
+L4250:
+	RR 9, XHL
+L4251:
+	RR 10, BC
+L4252:
+	SRL 4, HL
+L4253:
+	SLL 12, HL
+L4254:
+	SLL 5, XIY
+L4255:
+	RR 6, D
+L4256:
+	RL 3, DE
+L4257:
+	SLA 4, DE
+L4258:
+	RLC 5, IY
+L4259:
+	SLL 5, XBC
+L4260:
+	RLC 9, IZ
+L4261:
+	SRL 7, XHL
+L4262:
+	SRA 8, B
+L4263:
+	RRC 2, IY
+L4264:
+	SRA 1, XHL
+L4265:
+	SRL 12, H
+L4266:
+	SLL 13, H
+L4267:
+	SLA 7, XDE
+L4268:
+	RL 15, IZ
+L4269:
+	RLC 6, DE
+L4270:
+	RRC 13, IZ
+L4271:
+	RLC 4, E
+L4272:
+	RL 5, BC
+L4273:
+	RR 6, XWA
+L4274:
+	RL 5, XBC
+L4275:
+	RR 10, XBC
+L4276:
+	RLC 8, XIZ
+L4277:
+	SLL 6, IZ
+L4278:
+	SLA 9, L
+L4279:
+	SRL 11, D
+L4280:
+	SLL 13, XIX
+L4281:
+	RRC 8, XIZ
+L4282:
+	RR 5, C
+L4283:
+	RR 8, E
+L4284:
+	RRC 6, IX
+L4285:
+	SLA 15, XIX
+L4286:
+	SLA 4, D
+L4287:
+	SLL 14, HL
+L4288:
+	RRC 12, B
+L4289:
+	RL 14, HL
+L4290:
+	RR 1, W
+L4291:
+	RL 8, HL
+L4292:
+	SRA 1, HL
+L4293:
+	SLA 4, IZ
+L4294:
+	SRA 8, XIY
+L4295:
+	RLC 6, XIZ
+L4296:
+	SLL 9, C
+L4297:
+	RL 11, H
+L4298:
+	RRC 8, XWA
+L4299:
+	RRC 1, IY
+L4300:
+	RLC 9, IZ
+L4301:
+	SLL 6, E
+L4302:
+	SRA 13, BC
+L4303:
+	RRC 13, DE
+L4304:
+	SRL 7, B
+L4305:
+	SRA 10, L
+L4306:
+	RRC 11, IZ
+L4307:
+	SRA 13, BC
+L4308:
+	SRL 10, IX
+L4309:
+	SLA 5, IY
+L4310:
+	RR 10, XWA
+L4311:
+	SLL 14, B
+L4312:
+	SLA 3, B
+L4313:
+	RR 12, E
+L4314:
+	RR 2, DE
+L4315:
+	SLA 2, IX
+L4316:
+	RL 9, IZ
+L4317:
+	RR 4, XIZ
+L4318:
+	RL 1, IZ
+L4319:
+	RR 3, D
+L4320:
+	RLC 15, B
+L4321:
+	SRL 12, WA
+L4322:
+	SRL 13, XDE
+L4323:
+	SLA 4, A
+L4324:
+	RLC 5, DE
+L4325:
+	SLA 4, WA
+L4326:
+	RLC 11, HL
+L4327:
+	RLC 9, WA
+L4328:
+	SLL 4, XIX
+L4329:
+	RR 8, D
+L4330:
+	RLC 10, XDE
+L4331:
+	SRA 1, D
+L4332:
+	SRA 7, IY
+L4333:
+	RR 14, IX
+L4334:
+	RL 13, IX
+L4335:
+	RR 8, IY
+L4336:
+	RLC 9, D
+L4337:
+	SLA 15, DE
+L4338:
+	SRA 8, XWA
+L4339:
+	SRA 4, IY
+L4340:
+	RR 6, XIZ
+L4341:
+	RL 5, DE
+L4342:
+	RRC 4, H
+L4343:
+	SLL 2, WA
+L4344:
+	RR 2, DE
+L4345:
+	SLA 12, IZ
+L4346:
+	SRL 5, XIX
+L4347:
+	RR 5, XIZ
+L4348:
+	SLL 13, IZ
+L4349:
+	RL 3, L
+L4350:
+	RRC 12, IY
+L4351:
+	SRL 5, C
+L4352:
+	SLL 7, IY
+L4353:
+	RLC 14, XWA
+L4354:
+	RRC 5, A
+L4355:
+	SRL 3, XIX
+L4356:
+	SLL 15, XWA
+L4357:
+	SLL 1, HL
+L4358:
+	SRA 15, XBC
+L4359:
+	RR 14, L
+L4360:
+	SRL 3, DE
+L4361:
+	RL 12, D
+L4362:
+	RL 10, IX
+L4363:
+	SLL 4, DE
+L4364:
+	SLL 14, XIZ
+L4365:
+	SLL 12, H
+L4366:
+	SRL 15, A
+L4367:
+	RL 1, XIY
+L4368:
+	RRC 13, E
+L4369:
+	SRA 7, XWA
+L4370:
+	RRC 1, IY
+L4371:
+	SLA 14, W
+L4372:
+	RL 12, H
+L4373:
+	SLL 7, XIY
+L4374:
+	SLL 4, XHL
+L4375:
+	SLA 10, IX
+L4376:
+	SLA 2, L
+L4377:
+	RLC 9, HL
+L4378:
+	SLL 6, B
+L4379:
+	SRA 5, H
+L4380:
+	RRC 8, L
+L4381:
+	RR 11, IZ
+L4382:
+	RLC 7, IY
+L4383:
+	SLA 11, XIY
+L4384:
+	SLL 11, IY
+L4385:
+	SRL 13, BC
+L4386:
+	RLC 1, IY
+L4387:
+	RR 12, C
+L4388:
+	RL 7, B
+L4389:
+	RR 11, B
+L4390:
+	RRC 6, BC
+L4391:
+	SLA 4, XIY
+L4392:
+	RL 2, XIX
+L4393:
+	SLA 13, IZ
+L4394:
+	RLC 14, DE
+L4395:
+	SRA 3, XIY
+L4396:
+	SRA 8, A
+L4397:
+	RL 8, C
+L4398:
+	RLC 4, HL
+L4399:
+	SRL 5, C
+L4400:
+	SLL 6, XWA
+L4401:
+	SLL 11, HL
+L4402:
+	RLC 10, W
+L4403:
+	RR 10, XHL
+L4404:
+	RR 10, XWA
+L4405:
+	SLA 12, IX
+L4406:
+	RR 9, W
+L4407:
+	SLL 11, W
+L4408:
+	SLA 6, WA
+L4409:
+	RRC 14, E
+L4410:
+	RL 14, D
+L4411:
+	RL 15, IX
+L4412:
+	SLL 7, XHL
+L4413:
+	SRA 8, XHL
+L4414:
+	SRL 11, XBC
+L4415:
+	SLA 2, L
+L4416:
+	SRA 3, WA
+L4417:
+	SLL 2, XIX
+L4418:
+	SRA 15, DE
+L4419:
+	RR 2, IX
+L4420:
+	RL 8, DE
+L4421:
+	RRC 13, IX
+L4422:
+	RR 3, C
+L4423:
+	RR 3, W
+L4424:
+	SRA 12, BC
+L4425:
+	SLL 15, XIX
+L4426:
+	RR 4, XIZ
+L4427:
+	SRA 2, IY
+L4428:
+	SLA 9, W
+L4429:
+	SRA 5, XHL
+L4430:
+	SRA 13, C
+L4431:
+	SRL 6, XWA
+L4432:
+	RLC 7, XHL
+L4433:
+	RRC 9, XIX
+L4434:
+	SLA 3, XDE
+L4435:
+	SLL 6, XWA
+L4436:
+	RL 13, IX
+L4437:
+	SRA 14, BC
+L4438:
+	SRA 11, DE
+L4439:
+	SRL 11, WA
+L4440:
+	RR 12, HL
+L4441:
+	SRA 4, HL
+L4442:
+	SRL 5, H
+L4443:
+	RRC 13, D
+L4444:
+	SLL 6, IX
+L4445:
+	SRA 1, XBC
+L4446:
+	SRL 14, IY
+L4447:
+	RRC 1, H
+L4448:
+	SLL 8, WA
+L4449:
+	RR 5, IY
+L4450:
+	RLC 15, H
+L4451:
+	RL 3, C
+L4452:
+	RRC 3, XDE
+L4453:
+	SRL 11, DE
+L4454:
+	RR 5, H
+L4455:
+	RRC 8, XWA
+L4456:
+	SLA 11, HL
+L4457:
+	SLA 15, W
+L4458:
+	SRL 7, IY
+L4459:
+	SRA 9, XIZ
+L4460:
+	RLC 13, HL
+L4461:
+	RL 4, E
+L4462:
+	SRL 6, XIX
+L4463:
+	RRC 8, XWA
+L4464:
+	RR 14, C
+L4465:
+	RRC 15, A
+L4466:
+	SLA 6, DE
+L4467:
+	SLL 8, IZ
+L4468:
+	RRC 9, E
+L4469:
+	RR 12, IX
+L4470:
+	RRC 10, DE
+L4471:
+	SRA 4, XDE
+L4472:
+	RLC 8, L
+L4473:
+	RLC 15, L
+L4474:
+	SLL 13, WA
+L4475:
+	RL 1, BC
+L4476:
+	SRA 11, XIX
+L4477:
+	RL 9, IX
+L4478:
+	RLC 1, BC
+L4479:
+	RL 14, BC
+L4480:
+	SLA 4, D
+L4481:
+	RLC 10, BC
+L4482:
+	SLL 10, XIZ
+L4483:
+	RRC 9, C
+L4484:
+	RL 12, D
+L4485:
+	SLA 5, XBC
+L4486:
+	RL 13, W
+L4487:
+	SRL 2, XIY
+L4488:
+	RL 9, XIX
+L4489:
+	SRL 10, E
+L4490:
+	SRL 5, A
+L4491:
+	SRL 5, D
+L4492:
+	RRC 6, HL
+L4493:
+	SLL 6, B
+L4494:
+	SLL 2, XBC
+L4495:
+	SRL 2, XIX
+L4496:
+	SLA 15, A
+L4497:
+	RRC 15, E
+L4498:
+	RRC 7, XIX
+L4499:
+	SRA 4, WA
+L4500:
+	RL 10, H
+L4501:
+	SRL 1, XIX
+L4502:
+	RLC 7, HL
+L4503:
+	SLA 10, XHL
+L4504:
+	RLC 9, C
+L4505:
+	RRC 8, XHL
+L4506:
+	SRL 3, E
+L4507:
+	RLC 7, D
+L4508:
+	RRC 12, L
+L4509:
+	SRL 13, XIX
+L4510:
+	SLA 12, A
+L4511:
+	RRC 1, B
+L4512:
+	RLC 15, DE
+L4513:
+	RL 15, H
+L4514:
+	SLL 1, W
+L4515:
+	RRC 3, XDE
+L4516:
+	RRC 2, HL
+L4517:
+	RL 4, XIZ
+L4518:
+	RR 2, L
+L4519:
+	SLL 2, H
+L4520:
+	RL 9, L
+L4521:
+	SLL 12, XDE
+L4522:
+	SRL 1, XHL
+L4523:
+	RRC 13, B
+L4524:
+	SLA 8, IX
+L4525:
+	RR 10, IY
+L4526:
+	RLC 12, XIX
+L4527:
+	RLC 5, HL
+L4528:
+	SLA 6, E
+L4529:
+	SLA 14, A
+L4530:
+	SRA 10, XIY
+L4531:
+	RR 9, IZ
+L4532:
+	RL 7, BC
+L4533:
+	RLC 7, XIY
+L4534:
+	SRL 9, D
+L4535:
+	RL 2, XHL
+L4536:
+	RR 9, C
+L4537:
+	SLA 15, XIX
+L4538:
+	SLA 5, XIX
+L4539:
+	RR 8, IY
+L4540:
+	SLA 13, XIZ
+L4541:
+	RLC 8, XBC
+L4542:
+	SRA 10, B
+L4543:
+	SRA 6, A
+L4544:
+	SRA 11, XIX
+L4545:
+	RL 10, XIX
+L4546:
+	RLC 6, H
+L4547:
+	RL 8, XIX
+L4548:
+	SLA 3, IZ
+L4549:
+	SRL 15, XIZ
+L4550:
+	SRL 4, H
+L4551:
+	RLC 15, L
+L4552:
+	RL 9, IZ
+L4553:
+	RRC 14, XIX
+L4554:
+	RR 15, IZ
+L4555:
+	RLC 14, WA
+L4556:
+	SLA 7, XIY
+L4557:
+	SLA 3, HL
+L4558:
+	SRL 2, XDE
+L4559:
+	RL 10, H
+L4560:
+	RL 11, A
+L4561:
+	RRC 13, B
+L4562:
+	RR 1, XIZ
+L4563:
+	SLL 8, XDE
+L4564:
+	SLA 3, H
+L4565:
+	RRC 10, XIZ
+L4566:
+	SRA 14, IZ
+L4567:
+	RR 7, IX
+L4568:
+	RLC 3, H
+L4569:
+	SRA 2, HL
+L4570:
+	RL 7, C
+L4571:
+	SLL 8, XWA
+L4572:
+	SRA 8, XIX
+L4573:
+	SLA 8, XBC
+L4574:
+	RLC 12, XIZ
+L4575:
+	SRA 2, XHL
+L4576:
+	SLA 7, IZ
+L4577:
+	RR 5, B
+L4578:
+	SRA 15, XIY
+L4579:
+	RLC 10, C
+L4580:
+	SRA 15, DE
+L4581:
+	SRA 14, XDE
+L4582:
+	SRA 15, L
+L4583:
+	RRC 7, IX
+L4584:
+	SRL 15, XIZ
+L4585:
+	RR 6, XIZ
+L4586:
+	RR 14, XIY
+L4587:
+	RL 5, IZ
+L4588:
+	SLA 9, XBC
+L4589:
+	RL 13, L
+L4590:
+	RL 11, A
+L4591:
+	RR 14, XBC
+L4592:
+	SLA 1, IZ
+L4593:
+	SRL 1, A
+L4594:
+	SRL 9, XIY
+L4595:
+	SLA 9, HL
+L4596:
+	SLL 7, L
+L4597:
+	RRC 10, DE
+L4598:
+	SRA 8, XIY
+L4599:
+	SRA 4, B
+L4600:
+	RRC 14, BC
+L4601:
+	SRL 11, XHL
+L4602:
+	SLA 8, XIX
+L4603:
+	SLL 9, IX
+L4604:
+	SLL 4, D
+L4605:
+	RR 12, XBC
+L4606:
+	SRA 8, E
+L4607:
+	RRC 14, C
+L4608:
+	SRA 12, HL
+L4609:
+	RR 4, BC
+L4610:
+	RR 6, W
+L4611:
+	SRL 12, XIX
+L4612:
+	RLC 11, XDE
+L4613:
+	SLA 8, XIX
+L4614:
+	SLA 6, BC
+L4615:
+	RRC 8, A
+L4616:
+	SRL 1, XIZ
+L4617:
+	SLA 11, W
+L4618:
+	RRC 3, WA
+L4619:
+	SRL 13, B
+L4620:
+	SLL 7, IZ
+L4621:
+	SLA 3, XDE
+L4622:
+	SRL 11, IX
+L4623:
+	RL 7, XDE
+L4624:
+	SRL 7, XBC
+L4625:
+	SLL 5, WA
+L4626:
+	SLA 5, W
+L4627:
+	RL 13, IZ
+L4628:
+	RRC 4, XDE
+L4629:
+	RL 10, D
+L4630:
+	RR 8, XIX
+L4631:
+	RR 5, B
+L4632:
+	RRC 14, H
+L4633:
+	SLA 5, XIX
+L4634:
+	SLL 1, XIZ
+L4635:
+	RLC 3, WA
+L4636:
+	SRA 6, IX
+L4637:
+	RRC 5, WA
+L4638:
+	SLA 14, XIZ
+L4639:
+	RL 11, W
+L4640:
+	RLC 1, C
+L4641:
+	SLA 7, L
+L4642:
+	SLL 14, IZ
+L4643:
+	SLL 1, E
+L4644:
+	RRC 14, WA
+L4645:
+	SLA 2, XIY
+L4646:
+	SRA 10, WA
+L4647:
+	SRL 6, B
+L4648:
+	SLA 8, IY
+L4649:
+	RRC 3, E
+L4650:
+	RR 10, IZ
+L4651:
+	RLC 14, B
+L4652:
+	RLC 5, XWA
+L4653:
+	SLA 9, BC
+L4654:
+	RRC 1, XWA
+L4655:
+	SLL 1, C
+L4656:
+	SLA 15, IY
+L4657:
+	SRL 5, IX
+L4658:
+	SLA 11, IX
+L4659:
+	SLA 4, XWA
+L4660:
+	RL 12, DE
+L4661:
+	RL 13, XIZ
+L4662:
+	RLC 10, IX
+L4663:
+	RL 4, IX
+L4664:
+	SLA 9, HL
+L4665:
+	SRA 15, B
+L4666:
+	RLC 5, BC
+L4667:
+	SLA 2, HL
+L4668:
+	RLC 13, A
+L4669:
+	RL 11, D
+L4670:
+	SLL 11, XHL
+L4671:
+	RL 7, IY
+L4672:
+	SRL 11, XWA
+L4673:
+	RL 13, IY
+L4674:
+	SRA 1, E
+L4675:
+	RL 2, IZ
+L4676:
+	RRC 14, XWA
+L4677:
+	SLA 2, B
+L4678:
+	RLC 6, B
+L4679:
+	RL 11, WA
+L4680:
+	RRC 2, XIY
+L4681:
+	RR 15, C
+L4682:
+	SLL 11, D
+L4683:
+	SRA 6, XIZ
+L4684:
+	SRL 12, XWA
+L4685:
+	SLA 2, W
+L4686:
+	RRC 15, XBC
+L4687:
+	SLA 4, XIX
+L4688:
+	SLL 13, C
+L4689:
+	SLL 7, IX
+L4690:
+	SLL 10, WA
+L4691:
+	RRC 13, D
+L4692:
+	RR 6, XHL
+L4693:
+	SRA 7, XHL
+L4694:
+	RR 11, IX
+L4695:
+	SLL 13, HL
+L4696:
+	SLL 10, E
+L4697:
+	SLL 13, L
+L4698:
+	RR 10, W
+L4699:
+	RR 8, W
+L4700:
+	RLC 8, WA
+L4701:
+	SRL 3, B
+L4702:
+	SLA 15, BC
+L4703:
+	SRL 7, B
+L4704:
+	SRA 14, XIX
+L4705:
+	RL 12, XIZ
+L4706:
+	RL 11, L
+L4707:
+	SLL 12, IZ
+L4708:
+	SRL 12, XBC
+L4709:
+	RL 4, W
+L4710:
+	RLC 12, IX
+L4711:
+	SRA 11, XHL
+L4712:
+	RLC 7, E
+L4713:
+	SRL 13, HL
+L4714:
+	RLC 11, XIZ
+L4715:
+	SRA 9, HL
+L4716:
+	SLL 11, HL
+L4717:
+	RLC 3, IY
+L4718:
+	SRA 9, XHL
+L4719:
+	SLA 3, IX
+L4720:
+	SLA 10, XIX
+L4721:
+	SLL 4, XWA
+L4722:
+	RR 9, H
+L4723:
+	SLL 1, IZ
+L4724:
+	SLA 12, BC
+L4725:
+	RRC 15, IX
+L4726:
+	SRA 7, E
+L4727:
+	RLC 2, HL
+L4728:
+	RLC 6, A
+L4729:
+	RLC 14, XIZ
+L4730:
+	SRA 8, B
+L4731:
+	RR 10, XDE
+L4732:
+	SLA 12, D
+L4733:
+	RR 13, XIZ
+L4734:
+	SRL 11, H
+L4735:
+	RRC 4, BC
+L4736:
+	RL 5, XDE
+L4737:
+	SLA 8, XIZ
+L4738:
+	SLA 9, XIZ
+L4739:
+	RRC 2, L
+L4740:
+	RLC 5, WA
+L4741:
+	RLC 15, XBC
+L4742:
+	RLC 14, BC
+L4743:
+	RLC 9, D
+L4744:
+	RR 9, E
+L4745:
+	SLA 13, HL
+L4746:
+	SRA 8, A
+L4747:
+	RLC 15, XHL
+L4748:
+	RL 7, L
+L4749:
+	RR 4, XIY
+L4750:
+	SLA 7, XWA
+L4751:
+	RLC 5, H
+L4752:
+	RLC 6, XDE
+L4753:
+	SLL 15, BC
+L4754:
+	SLL 10, XDE
+L4755:
+	RRC 15, XWA
+L4756:
+	RRC 12, IZ
+L4757:
+	SLL 9, D
+L4758:
+	SLA 10, W
+L4759:
+	SRA 15, XIY
+L4760:
+	RL 10, DE
+L4761:
+	SLA 7, E
+L4762:
+	RLC 12, A
+L4763:
+	RL 4, XBC
+L4764:
+	RLC 13, WA
+L4765:
+	SRA 5, IZ
+L4766:
+	SRL 4, L
+L4767:
+	RR 14, IX
+L4768:
+	SRA 14, IX
+L4769:
+	SLL 9, DE
+L4770:
+	RLC 8, IY
+L4771:
+	RR 8, XIY
+L4772:
+	RR 14, D
+L4773:
+	RR 1, A
+L4774:
+	SLL 6, W
+L4775:
+	SRA 9, IZ
+L4776:
+	RR 11, XWA
+L4777:
+	RL 6, IY
+L4778:
+	SRA 9, XWA
+L4779:
+	SRL 11, XWA
+L4780:
+	SRA 1, HL
+L4781:
+	SRL 1, HL
+L4782:
+	RL 1, E
+L4783:
+	RL 4, C
+L4784:
+	RLC 3, B
+L4785:
+	RRC 1, HL
+L4786:
+	SLL 11, D
+L4787:
+	RL 10, XHL
+L4788:
+	RLC 14, L
+L4789:
+	RLC 15, E
+L4790:
+	RRC 5, XDE
+L4791:
+	RL 8, DE
+L4792:
+	RR 5, XIX
+L4793:
+	RL 14, W
+L4794:
+	RR 6, H
+L4795:
+	SRA 13, IX
+L4796:
+	SLL 7, XDE
+L4797:
+	RRC 5, IX
+L4798:
+	SLA 2, HL
+L4799:
+	SLL 11, IY
+L4800:
+	SRA 8, L
+L4801:
+	SLA 11, XIZ
+L4802:
+	RRC 4, H
+L4803:
+	SLA 5, XIZ
+L4804:
+	SRA 15, HL
+L4805:
+	RL 2, XIY
+L4806:
+	SRL 14, IY
+L4807:
+	SLA 3, DE
+L4808:
+	RL 10, E
+L4809:
+	SLL 5, C
+L4810:
+	RL 15, XWA
+L4811:
+	SRA 13, H
+L4812:
+	SRA 15, DE
+L4813:
+	SRA 9, XHL
+L4814:
+	SRA 15, XIZ
+L4815:
+	SRL 15, L
+L4816:
+	RL 8, H
+L4817:
+	RR 7, XHL
+L4818:
+	SLA 7, C
+L4819:
+	SLL 15, A
+L4820:
+	SRL 7, IZ
+L4821:
+	SRL 6, BC
+L4822:
+	RRC 5, L
+L4823:
+	RR 4, IY
+L4824:
+	RRC 15, XIX
+L4825:
+	SRL 11, DE
+L4826:
+	SRA 9, B
+L4827:
+	SLL 8, DE
+L4828:
+	RR 6, HL
+L4829:
+	SRA 2, A
+L4830:
+	RL 6, HL
+L4831:
+	RRC 1, IZ
+L4832:
+	RL 9, IY
+L4833:
+	SLA 5, XIZ
+L4834:
+	SRA 14, BC
+L4835:
+	RLC 6, DE
+L4836:
+	RLC 12, BC
+L4837:
+	SLA 15, XWA
+L4838:
+	RL 10, XDE
+L4839:
+	RRC 12, XDE
+L4840:
+	RLC 2, XIZ
+L4841:
+	RR 10, XHL
+L4842:
+	SRA 15, IZ
+L4843:
+	SLL 4, XHL
+L4844:
+	RRC 8, XIX
+L4845:
+	RLC 4, E
+L4846:
+	RRC 12, XHL
+L4847:
+	RL 12, XIY
+L4848:
+	RRC 12, XHL
+L4849:
+	RR 2, IX
+L4850:
+	RLC 7, IZ
+L4851:
+	SRA 9, DE
+L4852:
+	RL 12, C
+L4853:
+	SRL 7, WA
+L4854:
+	RLC 8, L
+L4855:
+	SRA 5, BC
+L4856:
+	SLA 14, XIY
+L4857:
+	RR 11, H
+L4858:
+	SLA 11, XBC
+L4859:
+	RL 5, IY
+L4860:
+	SLL 4, D
+L4861:
+	RL 3, XDE
+L4862:
+	SLL 1, XIY
+L4863:
+	SRL 6, WA
+L4864:
+	RRC 8, IZ
+L4865:
+	RRC 11, A
+L4866:
+	SRA 8, H
+L4867:
+	RRC 2, XIZ
+L4868:
+	RLC 2, HL
+L4869:
+	SRA 13, D
+L4870:
+	RRC 5, XBC
+L4871:
+	RRC 3, IX
+L4872:
+	SLL 8, H
+L4873:
+	RRC 8, HL
+L4874:
+	SLL 14, C
+L4875:
+	SLA 8, W
+L4876:
+	SRL 1, WA
+L4877:
+	RL 12, A
+L4878:
+	SLL 1, BC
+L4879:
+	RL 12, XBC
+L4880:
+	RR 9, DE
+L4881:
+	RL 9, DE
+L4882:
+	SLA 2, XIZ
+L4883:
+	RR 12, DE
+L4884:
+	RR 2, XDE
+L4885:
+	SLA 12, HL
+L4886:
+	SRA 10, XBC
+L4887:
+	RLC 10, XDE
+L4888:
+	SRL 13, XIZ
+L4889:
+	SLL 15, H
+L4890:
+	SRA 8, BC
+L4891:
+	SRL 3, L
+L4892:
+	RRC 3, IZ
+L4893:
+	RL 4, XBC
+L4894:
+	SLL 15, L
+L4895:
+	SLL 12, C
+L4896:
+	RLC 9, H
+L4897:
+	SLA 2, XDE
+L4898:
+	SLL 15, A
+L4899:
+	RR 4, A
+L4900:
+	SLL 3, B
+L4901:
+	RR 11, XIY
+L4902:
+	SLA 7, BC
+L4903:
+	SRA 1, XIY
+L4904:
+	RRC 10, IZ
+L4905:
+	RRC 5, XIZ
+L4906:
+	RR 14, D
+L4907:
+	SRL 14, BC
+L4908:
+	RL 6, XHL
+L4909:
+	SRA 6, L
+L4910:
+	SRA 4, L
+L4911:
+	SRA 13, B
+L4912:
+	SRL 8, IZ
+L4913:
+	SLA 1, W
+L4914:
+	SRL 12, XIY
+L4915:
+	RR 15, E
+L4916:
+	RL 6, C
+L4917:
+	RRC 12, DE
+L4918:
+	SLA 1, XWA
+L4919:
+	SLL 2, XHL
+L4920:
+	SRL 11, XWA
+L4921:
+	SLL 6, IZ
+L4922:
+	SLA 3, E
+L4923:
+	RR 10, IY
+L4924:
+	RLC 4, E
+L4925:
+	RRC 14, XIZ
+L4926:
+	RL 3, H
+L4927:
+	SRL 3, IY
+L4928:
+	RL 13, W
+L4929:
+	SRA 6, XIY
+L4930:
+	SRA 9, DE
+L4931:
+	SLA 8, XIX
+L4932:
+	SRL 4, BC
+L4933:
+	RRC 6, XIY
+L4934:
+	RLC 5, C
+L4935:
+	SRA 15, C
+L4936:
+	SRL 14, XIY
+L4937:
+	RL 2, H
+L4938:
+	RRC 4, C
+L4939:
+	SRA 14, L
+L4940:
+	SRL 1, XDE
+L4941:
+	RR 14, BC
+L4942:
+	SLL 1, XDE
+L4943:
+	SRA 15, BC
+L4944:
+	SRA 3, XIY
+L4945:
+	SRA 8, W
+L4946:
+	RLC 9, XWA
+L4947:
+	RLC 4, XWA
+L4948:
+	RRC 6, E
+L4949:
+	RL 13, DE
+L4950:
+	SLL 9, IY
+L4951:
+	SRL 9, H
+L4952:
+	RL 2, C
+L4953:
+	SRL 9, IZ
+L4954:
+	RL 13, HL
+L4955:
+	SRA 1, XHL
+L4956:
+	RR 3, IX
+L4957:
+	RLC 10, E
+L4958:
+	SRL 5, XIX
+L4959:
+	RLC 11, XIZ
+L4960:
+	SLL 7, L
+L4961:
+	RLC 6, IY
+L4962:
+	RL 11, BC
+L4963:
+	RRC 5, XIZ
+L4964:
+	RRC 13, A
+L4965:
+	RRC 12, L
+L4966:
+	SLA 10, XHL
+L4967:
+	SRL 12, DE
+L4968:
+	RR 1, W
+L4969:
+	RRC 4, XIY
+L4970:
+	RL 8, W
+L4971:
+	SLL 10, IZ
+L4972:
+	SRA 1, DE
+L4973:
+	RLC 1, IX
+L4974:
+	SRA 5, XDE
+L4975:
+	SLA 7, B
+L4976:
+	SRL 11, C
+L4977:
+	SRA 5, XIZ
+L4978:
+	SLA 9, BC
+L4979:
+	SRA 15, IY
+L4980:
+	SRL 14, XHL
+L4981:
+	RRC 7, B
+L4982:
+	RLC 6, IX
+L4983:
+	RRC 8, IY
+L4984:
+	SLA 7, HL
+L4985:
+	RR 13, L
+L4986:
+	SRL 8, C
+L4987:
+	RRC 14, L
+L4988:
+	SLA 12, XBC
+L4989:
+	RL 14, XHL
+L4990:
+	SRA 13, XBC
+L4991:
+	RL 6, XDE
+L4992:
+	SLL 2, DE
+L4993:
+	RR 8, XIX
+L4994:
+	RRC 2, W
+L4995:
+	SRL 12, XHL
+L4996:
+	RRC 3, XBC
+L4997:
+	RRC 7, DE
+L4998:
+	SRL 2, DE
+L4999:
+	SLA 12, XIX
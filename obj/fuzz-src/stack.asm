@@ -0,0 +1,10005 @@
+	CPU 96C141
+	ORG 0FE0000h
+P0	EQU 0000h
+BIGREG	EQU 1234h
+FAR	EQU 20EFFh
+L0:
+	PUSH XIZ
+L1:
+	POP IX
+L2:
+	POP IX
+L3:
+	PUSH IX
+L4:
+	PUSH XIX
+L5:
+	PUSH XWA
+L6:
+	POP HL
+L7:
+	POP XWA
+L8:
+	PUSH XBC
+L9:
+	PUSH XIX
+L10:
+	POP XDE
+L11:
+	POP XBC
+L12:
+	PUSH XBC
+L13:
+	POP IY
+L14:
+	PUSH IX
+L15:
+	POP IY
+L16:
+	PUSH XIX
+L17:
+	PUSH XIX
+L18:
+	PUSH XWA
+L19:
+	PUSH XIY
+L20:
+	POP DE
+L21:
+	POP XBC
+L22:
+	POP XWA
+L23:
+	PUSH XHL
+L24:
+	PUSH HL
+L25:
+	PUSH XHL
+L26:
+	POP XDE
+L27:
+	PUSH IZ
+L28:
+	PUSH HL
+L29:
+	PUSH IY
+L30:
+	POP XHL
+L31:
+	POP IY
+L32:
+	POP IY
+L33:
+	PUSH IZ
+L34:
+	POP BC
+L35:
+	POP BC
+L36:
+	PUSH XDE
+L37:
+	POP XWA
+L38:
+	PUSH XIZ
+L39:
+	POP BC
+L40:
+	PUSH IZ
+L41:
+	POP IZ
+L42:
+	POP XDE
+L43:
+	POP XIX
+L44:
+	POP XHL
+L45:
+	PUSH XHL
+L46:
+	PUSH XHL
+L47:
+	POP XDE
+L48:
+	POP XWA
+L49:
+	POP XIX
+L50:
+	POP HL
+L51:
+	POP XDE
+L52:
+	PUSH DE
+L53:
+	POP XDE
+L54:
+	PUSH XIX
+L55:
+	PUSH XDE
+L56:
+	POP XBC
+L57:
+	PUSH BC
+L58:
+	PUSH XIZ
+L59:
+	PUSH WA
+L60:
+	PUSH BC
+L61:
+	PUSH XDE
+L62:
+	POP IZ
+L63:
+	POP XHL
+L64:
+	POP XIY
+L65:
+	POP XDE
+L66:
+	POP XWA
+L67:
+	PUSH IY
+L68:
+	PUSH IZ
+L69:
+	POP XIY
+L70:
+	PUSH XIY
+L71:
+	POP XDE
+L72:
+	PUSH IZ
+L73:
+	POP XIZ
+L74:
+	POP XBC
+L75:
+	PUSH XBC
+L76:
+	POP IZ
+L77:
+	PUSH XIZ
+L78:
+	PUSH WA
+L79:
+	PUSH BC
+L80:
+	PUSH IZ
+L81:
+	PUSH XIX
+L82:
+	PUSH IY
+L83:
+	POP BC
+L84:
+	PUSH IX
+L85:
+	PUSH XIX
+L86:
+	POP IX
+L87:
+	PUSH XIZ
+L88:
+	PUSH XIX
+L89:
+	PUSH HL
+L90:
+	PUSH HL
+L91:
+	PUSH IZ
+L92:
+	POP HL
+L93:
+	PUSH WA
+L94:
+	POP BC
+L95:
+	PUSH XIX
+L96:
+	POP IX
+L97:
+	PUSH HL
+L98:
+	PUSH IX
+L99:
+	PUSH XIY
+L100:
+	POP XDE
+L101:
+	PUSH XIX
+L102:
+	PUSH IY
+L103:
+	POP XDE
+L104:
+	POP XIZ
+L105:
+	PUSH IZ
+L106:
+	PUSH XDE
+L107:
+	POP XDE
+L108:
+	PUSH BC
+L109:
+	PUSH WA
+L110:
+	POP IX
+L111:
+	POP WA
+L112:
+	POP XIX
+L113:
+	POP XHL
+L114:
+	POP DE
+L115:
+	PUSH IX
+L116:
+	POP BC
+L117:
+	PUSH XBC
+L118:
+	POP XBC
+L119:
+	POP XBC
+L120:
+	POP HL
+L121:
+	PUSH XDE
+L122:
+	POP DE
+L123:
+	PUSH XIZ
+L124:
+	POP BC
+L125:
+	PUSH XIY
+L126:
+	PUSH IX
+L127:
+	POP XBC
+L128:
+	PUSH BC
+L129:
+	POP XIY
+L130:
+	POP DE
+L131:
+	POP XIZ
+L132:
+	POP XIX
+L133:
+	PUSH XHL
+L134:
+	POP HL
+L135:
+	POP IZ
+L136:
+	PUSH DE
+L137:
+	POP XIZ
+L138:
+	PUSH XIY
+L139:
+	POP IZ
+L140:
+	PUSH DE
+L141:
+	PUSH XIZ
+L142:
+	PUSH IY
+L143:
+	POP HL
+L144:
+	PUSH IZ
+L145:
+	PUSH WA
+L146:
+	PUSH IY
+L147:
+	POP XIX
+L148:
+	PUSH XHL
+L149:
+	PUSH WA
+L150:
+	POP XWA
+L151:
+	POP XIZ
+L152:
+	POP HL
+L153:
+	PUSH XIX
+L154:
+	PUSH XIX
+L155:
+	PUSH XBC
+L156:
+	PUSH IZ
+L157:
+	POP XIZ
+L158:
+	POP IY
+L159:
+	PUSH DE
+L160:
+	POP XWA
+L161:
+	POP XDE
+L162:
+	POP XWA
+L163:
+	PUSH DE
+L164:
+	PUSH IZ
+L165:
+	POP XIZ
+L166:
+	PUSH IY
+L167:
+	POP IX
+L168:
+	POP WA
+L169:
+	PUSH HL
+L170:
+	POP XWA
+L171:
+	POP BC
+L172:
+	PUSH IX
+L173:
+	PUSH HL
+L174:
+	POP DE
+L175:
+	PUSH XIY
+L176:
+	POP XIX
+L177:
+	PUSH XIX
+L178:
+	POP IY
+L179:
+	PUSH XDE
+L180:
+	POP XDE
+L181:
+	PUSH XIY
+L182:
+	POP BC
+L183:
+	PUSH BC
+L184:
+	PUSH IX
+L185:
+	PUSH DE
+L186:
+	PUSH HL
+L187:
+	PUSH XBC
+L188:
+	PUSH XIY
+L189:
+	PUSH XBC
+L190:
+	POP XBC
+L191:
+	PUSH HL
+L192:
+	POP WA
+L193:
+	PUSH WA
+L194:
+	POP IX
+L195:
+	POP XWA
+L196:
+	POP BC
+L197:
+	PUSH IY
+L198:
+	POP HL
+L199:
+	POP IX
+L200:
+	POP HL
+L201:
+	PUSH XWA
+L202:
+	POP IY
+L203:
+	POP WA
+L204:
+	POP XHL
+L205:
+	POP XWA
+L206:
+	PUSH HL
+L207:
+	PUSH IZ
+L208:
+	POP XBC
+L209:
+	PUSH XWA
+L210:
+	POP HL
+L211:
+	PUSH DE
+L212:
+	PUSH DE
+L213:
+	POP IX
+L214:
+	POP IZ
+L215:
+	POP XDE
+L216:
+	PUSH BC
+L217:
+	POP XIX
+L218:
+	PUSH XBC
+L219:
+	POP DE
+L220:
+	POP IX
+L221:
+	PUSH XIX
+L222:
+	POP XIZ
+L223:
+	POP IZ
+L224:
+	PUSH XIX
+L225:
+	PUSH XIY
+L226:
+	POP XHL
+L227:
+	POP XIZ
+L228:
+	PUSH BC
+L229:
+	POP IZ
+L230:
+	PUSH IZ
+L231:
+	PUSH XWA
+L232:
+	POP WA
+L233:
+	PUSH BC
+L234:
+	POP XWA
+L235:
+	PUSH XWA
+L236:
+	POP XHL
+L237:
+	POP XBC
+L238:
+	POP XHL
+L239:
+	POP XIX
+L240:
+	PUSH XIZ
+L241:
+	POP IX
+L242:
+	POP XHL
+L243:
+	PUSH IZ
+L244:
+	PUSH XHL
+L245:
+	POP XWA
+L246:
+	PUSH XIX
+L247:
+	POP XIZ
+L248:
+	POP XIY
+L249:
+	POP XHL
+L250:
+	POP XIX
+L251:
+	PUSH XWA
+L252:
+	PUSH IZ
+L253:
+	PUSH XBC
+L254:
+	POP WA
+L255:
+	POP XDE
+L256:
+	POP BC
+L257:
+	POP XIY
+L258:
+	POP XIX
+L259:
+	POP IZ
+L260:
+	POP XHL
+L261:
+	PUSH XBC
+L262:
+	PUSH XDE
+L263:
+	POP XDE
+L264:
+	PUSH IZ
+L265:
+	POP IY
+L266:
+	POP XHL
+L267:
+	PUSH XHL
+L268:
+	POP XIZ
+L269:
+	POP XHL
+L270:
+	POP IY
+L271:
+	PUSH WA
+L272:
+	PUSH DE
+L273:
+	POP XHL
+L274:
+	PUSH XIX
+L275:
+	PUSH XIX
+L276:
+	PUSH WA
+L277:
+	PUSH IY
+L278:
+	POP IX
+L279:
+	PUSH XIX
+L280:
+	PUSH XDE
+L281:
+	POP IZ
+L282:
+	POP IZ
+L283:
+	PUSH IZ
+L284:
+	PUSH XIX
+L285:
+	PUSH BC
+L286:
+	POP BC
+L287:
+	PUSH XDE
+L288:
+	PUSH XWA
+L289:
+	PUSH XHL
+L290:
+	PUSH XWA
+L291:
+	POP WA
+L292:
+	POP XIZ
+L293:
+	POP XIY
+L294:
+	PUSH XDE
+L295:
+	PUSH XWA
+L296:
+	PUSH XIZ
+L297:
+	POP XIX
+L298:
+	PUSH HL
+L299:
+	PUSH IX
+L300:
+	POP IX
+L301:
+	PUSH XBC
+L302:
+	POP XIX
+L303:
+	POP IX
+L304:
+	POP XBC
+L305:
+	POP XIY
+L306:
+	POP IZ
+L307:
+	POP XIY
+L308:
+	POP IY
+L309:
+	PUSH IZ
+L310:
+	POP XIZ
+L311:
+	POP DE
+L312:
+	PUSH IX
+L313:
+	PUSH XDE
+L314:
+	PUSH WA
+L315:
+	POP IX
+L316:
+	POP DE
+L317:
+	PUSH XDE
+L318:
+	POP XWA
+L319:
+	PUSH BC
+L320:
+	PUSH XIY
+L321:
+	POP XIY
+L322:
+	PUSH XIY
+L323:
+	POP IX
+L324:
+	PUSH HL
+L325:
+	PUSH XHL
+L326:
+	PUSH XWA
+L327:
+	POP WA
+L328:
+	POP XIZ
+L329:
+	POP HL
+L330:
+	PUSH HL
+L331:
+	PUSH IZ
+L332:
+	POP DE
+L333:
+	POP XIX
+L334:
+	POP XIY
+L335:
+	PUSH HL
+L336:
+	PUSH XHL
+L337:
+	POP XHL
+L338:
+	PUSH XWA
+L339:
+	PUSH HL
+L340:
+	POP WA
+L341:
+	POP XWA
+L342:
+	POP XIZ
+L343:
+	POP XBC
+L344:
+	PUSH XIY
+L345:
+	POP DE
+L346:
+	PUSH HL
+L347:
+	PUSH WA
+L348:
+	PUSH BC
+L349:
+	POP IY
+L350:
+	POP IY
+L351:
+	POP XDE
+L352:
+	PUSH XIX
+L353:
+	POP BC
+L354:
+	POP XIX
+L355:
+	POP XWA
+L356:
+	PUSH XHL
+L357:
+	PUSH IZ
+L358:
+	POP DE
+L359:
+	POP HL
+L360:
+	POP XIZ
+L361:
+	PUSH XIZ
+L362:
+	POP XWA
+L363:
+	PUSH HL
+L364:
+	POP HL
+L365:
+	PUSH WA
+L366:
+	PUSH WA
+L367:
+	PUSH XHL
+L368:
+	POP WA
+L369:
+	POP XBC
+L370:
+	POP HL
+L371:
+	POP XDE
+L372:
+	POP HL
+L373:
+	POP XIX
+L374:
+	POP XBC
+L375:
+	POP IX
+L376:
+	POP WA
+L377:
+	PUSH XIX
+L378:
+	PUSH XIX
+L379:
+	PUSH XWA
+L380:
+	PUSH IZ
+L381:
+	POP XHL
+L382:
+	POP HL
+L383:
+	PUSH DE
+L384:
+	POP XDE
+L385:
+	PUSH HL
+L386:
+	PUSH DE
+L387:
+	POP XDE
+L388:
+	POP XIX
+L389:
+	POP XIZ
+L390:
+	PUSH XIZ
+L391:
+	PUSH IZ
+L392:
+	POP BC
+L393:
+	POP IY
+L394:
+	PUSH XHL
+L395:
+	PUSH IX
+L396:
+	PUSH BC
+L397:
+	POP XIZ
+L398:
+	PUSH XBC
+L399:
+	PUSH XIY
+L400:
+	PUSH IX
+L401:
+	PUSH IY
+L402:
+	PUSH HL
+L403:
+	PUSH HL
+L404:
+	POP XWA
+L405:
+	POP IX
+L406:
+	POP XWA
+L407:
+	PUSH IX
+L408:
+	POP WA
+L409:
+	PUSH WA
+L410:
+	POP BC
+L411:
+	PUSH XDE
+L412:
+	POP IZ
+L413:
+	POP XHL
+L414:
+	PUSH IX
+L415:
+	PUSH XDE
+L416:
+	PUSH DE
+L417:
+	POP BC
+L418:
+	POP XHL
+L419:
+	POP XIX
+L420:
+	PUSH XIZ
+L421:
+	PUSH IX
+L422:
+	PUSH WA
+L423:
+	POP HL
+L424:
+	POP BC
+L425:
+	PUSH HL
+L426:
+	PUSH XIZ
+L427:
+	POP XIX
+L428:
+	POP XWA
+L429:
+	PUSH BC
+L430:
+	PUSH XIY
+L431:
+	POP XDE
+L432:
+	POP IZ
+L433:
+	PUSH XIY
+L434:
+	PUSH IX
+L435:
+	POP BC
+L436:
+	PUSH XIY
+L437:
+	PUSH IZ
+L438:
+	POP IY
+L439:
+	PUSH BC
+L440:
+	PUSH XBC
+L441:
+	POP WA
+L442:
+	POP IZ
+L443:
+	POP XIX
+L444:
+	POP XIX
+L445:
+	POP XIY
+L446:
+	PUSH IY
+L447:
+	PUSH IX
+L448:
+	POP XWA
+L449:
+	POP WA
+L450:
+	PUSH BC
+L451:
+	PUSH BC
+L452:
+	PUSH IX
+L453:
+	PUSH IZ
+L454:
+	PUSH DE
+L455:
+	POP DE
+L456:
+	POP BC
+L457:
+	POP IZ
+L458:
+	PUSH WA
+L459:
+	PUSH XIX
+L460:
+	POP XHL
+L461:
+	PUSH HL
+L462:
+	POP XIY
+L463:
+	PUSH XHL
+L464:
+	POP IZ
+L465:
+	POP IY
+L466:
+	POP XHL
+L467:
+	PUSH XBC
+L468:
+	PUSH XIX
+L469:
+	PUSH XWA
+L470:
+	POP XBC
+L471:
+	POP XHL
+L472:
+	POP IY
+L473:
+	POP XIY
+L474:
+	POP XBC
+L475:
+	PUSH IZ
+L476:
+	POP WA
+L477:
+	PUSH HL
+L478:
+	POP XDE
+L479:
+	POP IZ
+L480:
+	POP BC
+L481:
+	PUSH XIZ
+L482:
+	POP XIX
+L483:
+	PUSH IZ
+L484:
+	POP XIX
+L485:
+	POP XIY
+L486:
+	PUSH XHL
+L487:
+	POP IY
+L488:
+	PUSH XIZ
+L489:
+	POP XWA
+L490:
+	POP XBC
+L491:
+	PUSH DE
+L492:
+	POP XWA
+L493:
+	PUSH XDE
+L494:
+	POP HL
+L495:
+	PUSH XWA
+L496:
+	PUSH HL
+L497:
+	POP XBC
+L498:
+	POP XIX
+L499:
+	PUSH XBC
+L500:
+	PUSH XBC
+L501:
+	POP XWA
+L502:
+	POP IY
+L503:
+	PUSH IZ
+L504:
+	PUSH IY
+L505:
+	POP XWA
+L506:
+	PUSH DE
+L507:
+	POP XIX
+L508:
+	PUSH IX
+L509:
+	PUSH DE
+L510:
+	PUSH IY
+L511:
+	POP XBC
+L512:
+	PUSH IY
+L513:
+	POP HL
+L514:
+	POP XWA
+L515:
+	POP WA
+L516:
+	POP XIX
+L517:
+	POP BC
+L518:
+	PUSH IX
+L519:
+	PUSH XIY
+L520:
+	PUSH XWA
+L521:
+	PUSH IX
+L522:
+	POP BC
+L523:
+	PUSH XDE
+L524:
+	POP IY
+L525:
+	POP XIY
+L526:
+	PUSH XHL
+L527:
+	POP IZ
+L528:
+	PUSH XWA
+L529:
+	POP WA
+L530:
+	PUSH XWA
+L531:
+	PUSH XIZ
+L532:
+	PUSH HL
+L533:
+	POP XWA
+L534:
+	POP XIY
+L535:
+	PUSH WA
+L536:
+	PUSH XIZ
+L537:
+	PUSH IY
+L538:
+	POP IY
+L539:
+	POP XIY
+L540:
+	POP WA
+L541:
+	POP XDE
+L542:
+	PUSH IY
+L543:
+	PUSH XBC
+L544:
+	POP DE
+L545:
+	PUSH IX
+L546:
+	POP XDE
+L547:
+	PUSH HL
+L548:
+	POP IX
+L549:
+	PUSH WA
+L550:
+	POP IZ
+L551:
+	POP XIZ
+L552:
+	POP DE
+L553:
+	POP WA
+L554:
+	PUSH BC
+L555:
+	PUSH XBC
+L556:
+	PUSH BC
+L557:
+	POP XIY
+L558:
+	PUSH IY
+L559:
+	PUSH IZ
+L560:
+	POP BC
+L561:
+	POP IZ
+L562:
+	POP WA
+L563:
+	POP WA
+L564:
+	POP XBC
+L565:
+	PUSH XWA
+L566:
+	POP BC
+L567:
+	POP XHL
+L568:
+	PUSH XHL
+L569:
+	POP XIZ
+L570:
+	POP IX
+L571:
+	PUSH BC
+L572:
+	PUSH BC
+L573:
+	PUSH XDE
+L574:
+	PUSH IX
+L575:
+	POP XIZ
+L576:
+	POP XHL
+L577:
+	PUSH DE
+L578:
+	PUSH XWA
+L579:
+	PUSH IZ
+L580:
+	POP XBC
+L581:
+	POP BC
+L582:
+	POP IY
+L583:
+	POP IZ
+L584:
+	PUSH BC
+L585:
+	POP XIY
+L586:
+	PUSH XDE
+L587:
+	POP XDE
+L588:
+	POP XIY
+L589:
+	POP XIX
+L590:
+	PUSH BC
+L591:
+	POP HL
+L592:
+	PUSH XDE
+L593:
+	POP XIY
+L594:
+	POP WA
+L595:
+	PUSH XHL
+L596:
+	PUSH HL
+L597:
+	POP XDE
+L598:
+	POP IY
+L599:
+	PUSH IZ
+L600:
+	POP IX
+L601:
+	POP HL
+L602:
+	POP XDE
+L603:
+	PUSH XWA
+L604:
+	PUSH XWA
+L605:
+	POP XDE
+L606:
+	POP IY
+L607:
+	PUSH WA
+L608:
+	PUSH XHL
+L609:
+	PUSH IY
+L610:
+	PUSH XDE
+L611:
+	PUSH XIX
+L612:
+	PUSH BC
+L613:
+	POP IY
+L614:
+	POP XIX
+L615:
+	PUSH XIX
+L616:
+	PUSH XIY
+L617:
+	POP BC
+L618:
+	POP IY
+L619:
+	POP IY
+L620:
+	PUSH XIY
+L621:
+	PUSH XWA
+L622:
+	PUSH IX
+L623:
+	POP BC
+L624:
+	PUSH XHL
+L625:
+	PUSH BC
+L626:
+	POP HL
+L627:
+	POP XHL
+L628:
+	POP XIZ
+L629:
+	POP IY
+L630:
+	PUSH XWA
+L631:
+	PUSH XHL
+L632:
+	POP BC
+L633:
+	POP HL
+L634:
+	POP WA
+L635:
+	POP XDE
+L636:
+	POP IX
+L637:
+	POP BC
+L638:
+	POP XHL
+L639:
+	PUSH IZ
+L640:
+	POP XBC
+L641:
+	PUSH XIX
+L642:
+	PUSH XIZ
+L643:
+	POP IZ
+L644:
+	POP BC
+L645:
+	POP WA
+L646:
+	POP XWA
+L647:
+	POP IY
+L648:
+	PUSH XDE
+L649:
+	POP IZ
+L650:
+	PUSH WA
+L651:
+	PUSH HL
+L652:
+	POP XDE
+L653:
+	POP HL
+L654:
+	PUSH XDE
+L655:
+	POP DE
+L656:
+	PUSH BC
+L657:
+	POP DE
+L658:
+	PUSH XIX
+L659:
+	PUSH XIX
+L660:
+	POP XHL
+L661:
+	PUSH DE
+L662:
+	POP XIZ
+L663:
+	PUSH XIX
+L664:
+	POP XIY
+L665:
+	PUSH XIX
+L666:
+	PUSH XIX
+L667:
+	POP XIX
+L668:
+	PUSH DE
+L669:
+	PUSH XIY
+L670:
+	POP XBC
+L671:
+	POP XHL
+L672:
+	POP WA
+L673:
+	POP XDE
+L674:
+	PUSH XWA
+L675:
+	POP IY
+L676:
+	POP WA
+L677:
+	POP XWA
+L678:
+	POP BC
+L679:
+	PUSH XHL
+L680:
+	PUSH XIY
+L681:
+	PUSH HL
+L682:
+	POP XWA
+L683:
+	POP DE
+L684:
+	POP XBC
+L685:
+	POP IY
+L686:
+	POP IX
+L687:
+	PUSH XDE
+L688:
+	PUSH XDE
+L689:
+	POP XDE
+L690:
+	POP HL
+L691:
+	PUSH XHL
+L692:
+	POP IY
+L693:
+	PUSH IY
+L694:
+	PUSH XIY
+L695:
+	POP XHL
+L696:
+	PUSH DE
+L697:
+	POP DE
+L698:
+	PUSH DE
+L699:
+	POP HL
+L700:
+	PUSH XHL
+L701:
+	POP XHL
+L702:
+	POP XDE
+L703:
+	PUSH IZ
+L704:
+	POP XIX
+L705:
+	POP XIZ
+L706:
+	POP IZ
+L707:
+	POP XBC
+L708:
+	PUSH HL
+L709:
+	POP XBC
+L710:
+	POP BC
+L711:
+	PUSH DE
+L712:
+	PUSH BC
+L713:
+	PUSH XHL
+L714:
+	POP BC
+L715:
+	POP IZ
+L716:
+	POP BC
+L717:
+	PUSH XIZ
+L718:
+	POP BC
+L719:
+	PUSH XBC
+L720:
+	POP IY
+L721:
+	PUSH DE
+L722:
+	PUSH DE
+L723:
+	PUSH XBC
+L724:
+	POP XWA
+L725:
+	PUSH XIZ
+L726:
+	POP XIZ
+L727:
+	PUSH IY
+L728:
+	PUSH XIX
+L729:
+	POP XBC
+L730:
+	PUSH IX
+L731:
+	PUSH WA
+L732:
+	PUSH IZ
+L733:
+	POP XWA
+L734:
+	PUSH XWA
+L735:
+	PUSH DE
+L736:
+	POP IZ
+L737:
+	PUSH DE
+L738:
+	POP DE
+L739:
+	POP WA
+L740:
+	PUSH XBC
+L741:
+	POP XBC
+L742:
+	POP IY
+L743:
+	POP XBC
+L744:
+	PUSH XIY
+L745:
+	PUSH XDE
+L746:
+	POP HL
+L747:
+	PUSH XHL
+L748:
+	PUSH XIZ
+L749:
+	PUSH XHL
+L750:
+	POP XBC
+L751:
+	POP IZ
+L752:
+	PUSH XHL
+L753:
+	POP XIX
+L754:
+	PUSH DE
+L755:
+	PUSH IY
+L756:
+	POP XDE
+L757:
+	POP WA
+L758:
+	POP XBC
+L759:
+	PUSH BC
+L760:
+	PUSH BC
+L761:
+	PUSH XDE
+L762:
+	POP BC
+L763:
+	PUSH XHL
+L764:
+	PUSH IZ
+L765:
+	PUSH XDE
+L766:
+	POP IX
+L767:
+	POP XIY
+L768:
+	POP IY
+L769:
+	PUSH XDE
+L770:
+	PUSH XIY
+L771:
+	PUSH XIZ
+L772:
+	PUSH XIZ
+L773:
+	PUSH BC
+L774:
+	POP XIX
+L775:
+	PUSH IZ
+L776:
+	PUSH XWA
+L777:
+	PUSH XIY
+L778:
+	POP XIZ
+L779:
+	POP WA
+L780:
+	PUSH WA
+L781:
+	PUSH XIY
+L782:
+	PUSH XDE
+L783:
+	PUSH XIY
+L784:
+	PUSH XIX
+L785:
+	POP IZ
+L786:
+	PUSH WA
+L787:
+	PUSH HL
+L788:
+	POP IY
+L789:
+	POP HL
+L790:
+	POP DE
+L791:
+	PUSH XHL
+L792:
+	PUSH BC
+L793:
+	POP XIZ
+L794:
+	PUSH IX
+L795:
+	PUSH XIY
+L796:
+	POP IX
+L797:
+	POP DE
+L798:
+	PUSH IY
+L799:
+	PUSH BC
+L800:
+	POP XIY
+L801:
+	POP XWA
+L802:
+	PUSH XIZ
+L803:
+	POP IZ
+L804:
+	PUSH WA
+L805:
+	POP IZ
+L806:
+	POP BC
+L807:
+	POP XDE
+L808:
+	POP XHL
+L809:
+	PUSH XIX
+L810:
+	POP DE
+L811:
+	PUSH XIX
+L812:
+	PUSH XIZ
+L813:
+	PUSH IX
+L814:
+	PUSH IX
+L815:
+	POP XBC
+L816:
+	PUSH XDE
+L817:
+	PUSH XIY
+L818:
+	POP IZ
+L819:
+	POP IZ
+L820:
+	PUSH HL
+L821:
+	PUSH DE
+L822:
+	PUSH XBC
+L823:
+	PUSH HL
+L824:
+	PUSH XIZ
+L825:
+	POP XIZ
+L826:
+	PUSH XWA
+L827:
+	PUSH XHL
+L828:
+	PUSH IY
+L829:
+	PUSH DE
+L830:
+	PUSH XIX
+L831:
+	POP XIY
+L832:
+	PUSH DE
+L833:
+	PUSH HL
+L834:
+	POP BC
+L835:
+	POP IZ
+L836:
+	POP DE
+L837:
+	PUSH IX
+L838:
+	PUSH XIX
+L839:
+	POP XIZ
+L840:
+	PUSH DE
+L841:
+	PUSH XIZ
+L842:
+	PUSH DE
+L843:
+	POP XWA
+L844:
+	PUSH XHL
+L845:
+	POP IZ
+L846:
+	POP IX
+L847:
+	POP XBC
+L848:
+	PUSH IY
+L849:
+	PUSH IX
+L850:
+	PUSH BC
+L851:
+	POP DE
+L852:
+	POP XDE
+L853:
+	PUSH BC
+L854:
+	POP XDE
+L855:
+	POP IY
+L856:
+	POP IZ
+L857:
+	POP XDE
+L858:
+	PUSH HL
+L859:
+	POP XHL
+L860:
+	PUSH XWA
+L861:
+	PUSH WA
+L862:
+	PUSH DE
+L863:
+	POP XBC
+L864:
+	PUSH IY
+L865:
+	PUSH BC
+L866:
+	PUSH HL
+L867:
+	POP XIY
+L868:
+	POP BC
+L869:
+	PUSH IX
+L870:
+	POP DE
+L871:
+	POP WA
+L872:
+	PUSH XWA
+L873:
+	POP BC
+L874:
+	PUSH BC
+L875:
+	PUSH XWA
+L876:
+	PUSH XWA
+L877:
+	PUSH XIY
+L878:
+	PUSH XBC
+L879:
+	PUSH XDE
+L880:
+	POP IX
+L881:
+	PUSH BC
+L882:
+	POP XIZ
+L883:
+	POP XBC
+L884:
+	POP XIZ
+L885:
+	PUSH XIZ
+L886:
+	POP DE
+L887:
+	PUSH IZ
+L888:
+	POP XIY
+L889:
+	PUSH HL
+L890:
+	PUSH XHL
+L891:
+	POP DE
+L892:
+	POP XIZ
+L893:
+	PUSH XIZ
+L894:
+	PUSH DE
+L895:
+	POP DE
+L896:
+	POP XWA
+L897:
+	POP XWA
+L898:
+	POP WA
+L899:
+	PUSH DE
+L900:
+	PUSH XDE
+L901:
+	POP WA
+L902:
+	PUSH DE
+L903:
+	PUSH IX
+L904:
+	POP XWA
+L905:
+	POP IY
+L906:
+	POP IX
+L907:
+	POP WA
+L908:
+	PUSH BC
+L909:
+	POP XDE
+L910:
+	PUSH IZ
+L911:
+	POP DE
+L912:
+	PUSH XDE
+L913:
+	PUSH XIX
+L914:
+	PUSH XDE
+L915:
+	POP HL
+L916:
+	PUSH WA
+L917:
+	PUSH XDE
+L918:
+	PUSH BC
+L919:
+	POP BC
+L920:
+	POP IY
+L921:
+	PUSH BC
+L922:
+	POP IZ
+L923:
+	PUSH WA
+L924:
+	PUSH IZ
+L925:
+	POP WA
+L926:
+	POP XWA
+L927:
+	PUSH XDE
+L928:
+	POP XDE
+L929:
+	PUSH IY
+L930:
+	POP HL
+L931:
+	PUSH XDE
+L932:
+	POP XIZ
+L933:
+	PUSH XIY
+L934:
+	PUSH IX
+L935:
+	PUSH XBC
+L936:
+	POP XHL
+L937:
+	PUSH IX
+L938:
+	PUSH XWA
+L939:
+	POP IY
+L940:
+	PUSH XIZ
+L941:
+	PUSH WA
+L942:
+	POP IX
+L943:
+	PUSH XIZ
+L944:
+	PUSH DE
+L945:
+	POP XIX
+L946:
+	PUSH XDE
+L947:
+	PUSH XWA
+L948:
+	POP HL
+L949:
+	PUSH WA
+L950:
+	POP HL
+L951:
+	POP IZ
+L952:
+	POP IX
+L953:
+	POP XIX
+L954:
+	POP XDE
+L955:
+	POP WA
+L956:
+	PUSH XIZ
+L957:
+	POP IZ
+L958:
+	POP IZ
+L959:
+	POP IZ
+L960:
+	POP XDE
+L961:
+	POP WA
+L962:
+	POP XIZ
+L963:
+	POP XHL
+L964:
+	PUSH DE
+L965:
+	PUSH XWA
+L966:
+	POP XBC
+L967:
+	POP XDE
+L968:
+	POP XHL
+L969:
+	PUSH DE
+L970:
+	POP XIZ
+L971:
+	PUSH DE
+L972:
+	PUSH XIZ
+L973:
+	PUSH IY
+L974:
+	PUSH DE
+L975:
+	PUSH XIX
+L976:
+	POP IX
+L977:
+	PUSH XHL
+L978:
+	POP XIZ
+L979:
+	PUSH XHL
+L980:
+	POP HL
+L981:
+	POP HL
+L982:
+	PUSH XIX
+L983:
+	PUSH IX
+L984:
+	POP XIY
+L985:
+	PUSH HL
+L986:
+	PUSH XIY
+L987:
+	PUSH IY
+L988:
+	POP XIZ
+L989:
+	POP IZ
+L990:
+	PUSH IX
+L991:
+	PUSH XBC
+L992:
+	POP XWA
+L993:
+	PUSH XIX
+L994:
+	POP XIY
+L995:
+	POP XIZ
+L996:
+	POP WA
+L997:
+	POP XHL
+L998:
+	POP XHL
+L999:
+	POP XIX
+L1000:
+	POP BC
+L1001:
+	POP XWA
+L1002:
+	PUSH IX
+L1003:
+	POP XIX
+L1004:
+	PUSH XDE
+L1005:
+	PUSH IX
+L1006:
+	POP IX
+L1007:
+	POP XDE
+L1008:
+	PUSH XBC
+L1009:
+	POP IY
+L1010:
+	POP XIX
+L1011:
+	POP XIX
+L1012:
+	POP XDE
+L1013:
+	POP XBC
+L1014:
+	POP WA
+L1015:
+	PUSH XIX
+L1016:
+	POP IZ
+L1017:
+	PUSH IY
+L1018:
+	PUSH HL
+L1019:
+	POP XDE
+L1020:
+	POP DE
+L1021:
+	POP XIZ
+L1022:
+	POP XHL
+L1023:
+	PUSH WA
+L1024:
+	PUSH BC
+L1025:
+	POP XWA
+L1026:
+	PUSH XIX
+L1027:
+	POP XDE
+L1028:
+	PUSH XWA
+L1029:
+	POP HL
+L1030:
+	PUSH IZ
+L1031:
+	POP IZ
+L1032:
+	PUSH BC
+L1033:
+	POP XHL
+L1034:
+	PUSH HL
+L1035:
+	POP HL
+L1036:
+	PUSH XWA
+L1037:
+	POP XIY
+L1038:
+	PUSH XHL
+L1039:
+	POP IY
+L1040:
+	PUSH IZ
+L1041:
+	POP XBC
+L1042:
+	POP XHL
+L1043:
+	POP IX
+L1044:
+	POP IY
+L1045:
+	POP HL
+L1046:
+	POP HL
+L1047:
+	PUSH HL
+L1048:
+	POP XIZ
+L1049:
+	POP XIY
+L1050:
+	POP HL
+L1051:
+	POP DE
+L1052:
+	PUSH XDE
+L1053:
+	POP WA
+L1054:
+	POP DE
+L1055:
+	PUSH XBC
+L1056:
+	POP HL
+L1057:
+	PUSH WA
+L1058:
+	POP XIY
+L1059:
+	POP XIZ
+L1060:
+	POP XDE
+L1061:
+	PUSH XWA
+L1062:
+	POP XBC
+L1063:
+	PUSH WA
+L1064:
+	PUSH WA
+L1065:
+	PUSH HL
+L1066:
+	POP IX
+L1067:
+	POP BC
+L1068:
+	PUSH XIX
+L1069:
+	PUSH XWA
+L1070:
+	POP XBC
+L1071:
+	POP HL
+L1072:
+	POP BC
+L1073:
+	PUSH XIY
+L1074:
+	PUSH XIX
+L1075:
+	POP BC
+L1076:
+	POP XHL
+L1077:
+	PUSH BC
+L1078:
+	PUSH IZ
+L1079:
+	PUSH IY
+L1080:
+	POP IX
+L1081:
+	PUSH XDE
+L1082:
+	PUSH BC
+L1083:
+	PUSH XDE
+L1084:
+	POP XHL
+L1085:
+	POP HL
+L1086:
+	POP IX
+L1087:
+	POP HL
+L1088:
+	POP XIY
+L1089:
+	PUSH IX
+L1090:
+	PUSH DE
+L1091:
+	POP BC
+L1092:
+	PUSH HL
+L1093:
+	POP BC
+L1094:
+	POP BC
+L1095:
+	POP BC
+L1096:
+	POP XHL
+L1097:
+	POP XWA
+L1098:
+	POP XIZ
+L1099:
+	POP XIZ
+L1100:
+	POP BC
+L1101:
+	PUSH XWA
+L1102:
+	POP XDE
+L1103:
+	POP XIY
+L1104:
+	POP XWA
+L1105:
+	POP XIZ
+L1106:
+	POP XWA
+L1107:
+	PUSH XHL
+L1108:
+	POP BC
+L1109:
+	PUSH IZ
+L1110:
+	POP IZ
+L1111:
+	POP HL
+L1112:
+	POP XDE
+L1113:
+	POP DE
+L1114:
+	PUSH XHL
+L1115:
+	PUSH XBC
+L1116:
+	PUSH XIZ
+L1117:
+	PUSH HL
+L1118:
+	PUSH XIZ
+L1119:
+	PUSH HL
+L1120:
+	PUSH IY
+L1121:
+	POP BC
+L1122:
+	POP XBC
+L1123:
+	POP XIY
+L1124:
+	PUSH WA
+L1125:
+	PUSH XIZ
+L1126:
+	PUSH IY
+L1127:
+	POP WA
+L1128:
+	POP BC
+L1129:
+	POP IY
+L1130:
+	PUSH IX
+L1131:
+	PUSH IZ
+L1132:
+	POP XDE
+L1133:
+	PUSH IY
+L1134:
+	POP XWA
+L1135:
+	POP XWA
+L1136:
+	PUSH IZ
+L1137:
+	POP XHL
+L1138:
+	PUSH IZ
+L1139:
+	PUSH XBC
+L1140:
+	PUSH IY
+L1141:
+	PUSH IY
+L1142:
+	POP IX
+L1143:
+	POP XHL
+L1144:
+	POP WA
+L1145:
+	POP XIX
+L1146:
+	PUSH WA
+L1147:
+	PUSH XHL
+L1148:
+	POP XDE
+L1149:
+	PUSH XBC
+L1150:
+	PUSH XIY
+L1151:
+	POP XBC
+L1152:
+	POP IZ
+L1153:
+	PUSH XIZ
+L1154:
+	PUSH WA
+L1155:
+	POP XHL
+L1156:
+	POP IY
+L1157:
+	POP BC
+L1158:
+	POP DE
+L1159:
+	POP IZ
+L1160:
+	PUSH XBC
+L1161:
+	POP IZ
+L1162:
+	POP XIZ
+L1163:
+	POP XIY
+L1164:
+	PUSH XIY
+L1165:
+	PUSH XIY
+L1166:
+	POP HL
+L1167:
+	PUSH XHL
+L1168:
+	PUSH XIX
+L1169:
+	PUSH XDE
+L1170:
+	PUSH DE
+L1171:
+	POP XIX
+L1172:
+	PUSH XDE
+L1173:
+	POP WA
+L1174:
+	PUSH WA
+L1175:
+	POP HL
+L1176:
+	POP DE
+L1177:
+	POP IY
+L1178:
+	POP XWA
+L1179:
+	POP XBC
+L1180:
+	PUSH XIX
+L1181:
+	PUSH XWA
+L1182:
+	POP HL
+L1183:
+	PUSH XWA
+L1184:
+	POP XIX
+L1185:
+	PUSH XHL
+L1186:
+	POP WA
+L1187:
+	PUSH BC
+L1188:
+	PUSH XIZ
+L1189:
+	PUSH BC
+L1190:
+	PUSH DE
+L1191:
+	PUSH DE
+L1192:
+	POP WA
+L1193:
+	PUSH XWA
+L1194:
+	POP XDE
+L1195:
+	PUSH DE
+L1196:
+	PUSH IY
+L1197:
+	PUSH XBC
+L1198:
+	PUSH IY
+L1199:
+	PUSH XIZ
+L1200:
+	POP IZ
+L1201:
+	POP IY
+L1202:
+	PUSH IZ
+L1203:
+	POP XDE
+L1204:
+	PUSH WA
+L1205:
+	PUSH WA
+L1206:
+	PUSH BC
+L1207:
+	POP DE
+L1208:
+	PUSH WA
+L1209:
+	POP XHL
+L1210:
+	PUSH XDE
+L1211:
+	POP IY
+L1212:
+	POP IX
+L1213:
+	POP XDE
+L1214:
+	POP XBC
+L1215:
+	POP XHL
+L1216:
+	POP XDE
+L1217:
+	POP DE
+L1218:
+	POP IZ
+L1219:
+	POP WA
+L1220:
+	POP IZ
+L1221:
+	PUSH HL
+L1222:
+	PUSH IX
+L1223:
+	PUSH XIX
+L1224:
+	PUSH XIY
+L1225:
+	POP XIZ
+L1226:
+	POP XDE
+L1227:
+	POP XBC
+L1228:
+	POP WA
+L1229:
+	PUSH XBC
+L1230:
+	PUSH HL
+L1231:
+	PUSH IX
+L1232:
+	POP WA
+L1233:
+	POP IY
+L1234:
+	PUSH IZ
+L1235:
+	PUSH IY
+L1236:
+	PUSH BC
+L1237:
+	PUSH WA
+L1238:
+	PUSH BC
+L1239:
+	POP XIY
+L1240:
+	PUSH IY
+L1241:
+	PUSH XIY
+L1242:
+	POP IX
+L1243:
+	POP IX
+L1244:
+	PUSH XWA
+L1245:
+	POP BC
+L1246:
+	PUSH IY
+L1247:
+	PUSH XIY
+L1248:
+	POP XWA
+L1249:
+	PUSH XIY
+L1250:
+	POP XWA
+L1251:
+	POP BC
+L1252:
+	POP BC
+L1253:
+	POP WA
+L1254:
+	PUSH XDE
+L1255:
+	POP XBC
+L1256:
+	POP WA
+L1257:
+	PUSH XHL
+L1258:
+	PUSH IY
+L1259:
+	POP XBC
+L1260:
+	POP XIX
+L1261:
+	POP BC
+L1262:
+	POP DE
+L1263:
+	PUSH XIZ
+L1264:
+	POP IX
+L1265:
+	POP DE
+L1266:
+	PUSH XHL
+L1267:
+	POP WA
+L1268:
+	PUSH IX
+L1269:
+	PUSH DE
+L1270:
+	PUSH BC
+L1271:
+	POP XBC
+L1272:
+	PUSH XBC
+L1273:
+	POP XBC
+L1274:
+	PUSH WA
+L1275:
+	POP BC
+L1276:
+	POP XIZ
+L1277:
+	PUSH HL
+L1278:
+	POP XIZ
+L1279:
+	POP XBC
+L1280:
+	POP XDE
+L1281:
+	POP HL
+L1282:
+	PUSH XWA
+L1283:
+	POP IX
+L1284:
+	PUSH HL
+L1285:
+	PUSH IY
+L1286:
+	POP BC
+L1287:
+	POP XBC
+L1288:
+	PUSH XDE
+L1289:
+	PUSH XIY
+L1290:
+	PUSH WA
+L1291:
+	POP XBC
+L1292:
+	POP XIY
+L1293:
+	POP WA
+L1294:
+	POP WA
+L1295:
+	PUSH IZ
+L1296:
+	POP XDE
+L1297:
+	PUSH HL
+L1298:
+	PUSH XDE
+L1299:
+	PUSH XIZ
+L1300:
+	PUSH XIX
+L1301:
+	POP BC
+L1302:
+	POP XWA
+L1303:
+	POP XHL
+L1304:
+	POP XDE
+L1305:
+	POP BC
+L1306:
+	PUSH XIY
+L1307:
+	PUSH IX
+L1308:
+	POP DE
+L1309:
+	POP XBC
+L1310:
+	POP IX
+L1311:
+	PUSH DE
+L1312:
+	POP XIY
+L1313:
+	PUSH DE
+L1314:
+	PUSH XDE
+L1315:
+	POP XIZ
+L1316:
+	POP IY
+L1317:
+	POP IY
+L1318:
+	POP XIX
+L1319:
+	POP IY
+L1320:
+	PUSH DE
+L1321:
+	PUSH DE
+L1322:
+	PUSH IY
+L1323:
+	POP HL
+L1324:
+	PUSH XIY
+L1325:
+	PUSH IX
+L1326:
+	PUSH XWA
+L1327:
+	PUSH XBC
+L1328:
+	POP XWA
+L1329:
+	PUSH XBC
+L1330:
+	POP XHL
+L1331:
+	PUSH HL
+L1332:
+	PUSH BC
+L1333:
+	POP HL
+L1334:
+	POP XIZ
+L1335:
+	PUSH DE
+L1336:
+	POP HL
+L1337:
+	PUSH IZ
+L1338:
+	POP IZ
+L1339:
+	PUSH XBC
+L1340:
+	POP XDE
+L1341:
+	POP HL
+L1342:
+	POP XHL
+L1343:
+	PUSH XIY
+L1344:
+	POP XWA
+L1345:
+	PUSH XDE
+L1346:
+	POP IZ
+L1347:
+	POP XHL
+L1348:
+	PUSH XIX
+L1349:
+	PUSH XDE
+L1350:
+	PUSH IZ
+L1351:
+	PUSH XWA
+L1352:
+	PUSH XBC
+L1353:
+	PUSH XWA
+L1354:
+	POP BC
+L1355:
+	POP IY
+L1356:
+	PUSH IZ
+L1357:
+	PUSH XIZ
+L1358:
+	POP XDE
+L1359:
+	PUSH IZ
+L1360:
+	POP XHL
+L1361:
+	PUSH WA
+L1362:
+	PUSH BC
+L1363:
+	PUSH XIY
+L1364:
+	PUSH XDE
+L1365:
+	PUSH BC
+L1366:
+	POP XIY
+L1367:
+	PUSH XHL
+L1368:
+	PUSH DE
+L1369:
+	PUSH IX
+L1370:
+	POP WA
+L1371:
+	POP XIX
+L1372:
+	PUSH BC
+L1373:
+	POP XHL
+L1374:
+	POP DE
+L1375:
+	PUSH IY
+L1376:
+	PUSH BC
+L1377:
+	PUSH XDE
+L1378:
+	POP DE
+L1379:
+	PUSH XIZ
+L1380:
+	POP XIZ
+L1381:
+	POP XIY
+L1382:
+	PUSH XBC
+L1383:
+	POP XIY
+L1384:
+	PUSH BC
+L1385:
+	POP XWA
+L1386:
+	PUSH IX
+L1387:
+	POP BC
+L1388:
+	POP XHL
+L1389:
+	PUSH XHL
+L1390:
+	PUSH XIZ
+L1391:
+	POP XHL
+L1392:
+	PUSH XIX
+L1393:
+	PUSH XIZ
+L1394:
+	POP WA
+L1395:
+	PUSH WA
+L1396:
+	POP XIZ
+L1397:
+	POP XIX
+L1398:
+	PUSH XWA
+L1399:
+	POP XWA
+L1400:
+	PUSH XBC
+L1401:
+	PUSH DE
+L1402:
+	PUSH IZ
+L1403:
+	PUSH XIY
+L1404:
+	PUSH BC
+L1405:
+	PUSH XWA
+L1406:
+	PUSH DE
+L1407:
+	PUSH DE
+L1408:
+	PUSH HL
+L1409:
+	POP DE
+L1410:
+	POP HL
+L1411:
+	POP HL
+L1412:
+	POP XIX
+L1413:
+	PUSH XDE
+L1414:
+	POP XBC
+L1415:
+	POP IX
+L1416:
+	POP XBC
+L1417:
+	POP DE
+L1418:
+	POP XIY
+L1419:
+	POP XBC
+L1420:
+	POP BC
+L1421:
+	POP IY
+L1422:
+	POP DE
+L1423:
+	POP XIY
+L1424:
+	POP IY
+L1425:
+	PUSH BC
+L1426:
+	POP HL
+L1427:
+	POP DE
+L1428:
+	POP WA
+L1429:
+	POP XWA
+L1430:
+	PUSH XWA
+L1431:
+	POP XIZ
+L1432:
+	PUSH XDE
+L1433:
+	POP XIZ
+L1434:
+	PUSH XIY
+L1435:
+	PUSH IZ
+L1436:
+	POP BC
+L1437:
+	POP IZ
+L1438:
+	POP XBC
+L1439:
+	PUSH WA
+L1440:
+	POP XIX
+L1441:
+	POP HL
+L1442:
+	PUSH BC
+L1443:
+	PUSH WA
+L1444:
+	PUSH WA
+L1445:
+	POP XIY
+L1446:
+	PUSH XDE
+L1447:
+	PUSH XBC
+L1448:
+	POP HL
+L1449:
+	POP XIY
+L1450:
+	POP XDE
+L1451:
+	POP BC
+L1452:
+	PUSH XIX
+L1453:
+	POP XIX
+L1454:
+	PUSH XIZ
+L1455:
+	PUSH XIX
+L1456:
+	PUSH XIX
+L1457:
+	PUSH DE
+L1458:
+	POP IY
+L1459:
+	PUSH WA
+L1460:
+	PUSH XIZ
+L1461:
+	POP BC
+L1462:
+	POP XDE
+L1463:
+	PUSH XIX
+L1464:
+	PUSH XIX
+L1465:
+	POP WA
+L1466:
+	POP XWA
+L1467:
+	POP XIZ
+L1468:
+	PUSH XHL
+L1469:
+	POP IZ
+L1470:
+	POP IZ
+L1471:
+	POP XIY
+L1472:
+	POP XHL
+L1473:
+	POP XIY
+L1474:
+	POP XDE
+L1475:
+	POP XIZ
+L1476:
+	POP DE
+L1477:
+	POP IX
+L1478:
+	POP IY
+L1479:
+	POP XIX
+L1480:
+	POP XIZ
+L1481:
+	PUSH XIX
+L1482:
+	POP XHL
+L1483:
+	POP XIZ
+L1484:
+	PUSH IX
+L1485:
+	PUSH BC
+L1486:
+	PUSH XWA
+L1487:
+	POP XIX
+L1488:
+	PUSH BC
+L1489:
+	PUSH XWA
+L1490:
+	PUSH DE
+L1491:
+	PUSH XIY
+L1492:
+	POP XIZ
+L1493:
+	POP XBC
+L1494:
+	POP XIZ
+L1495:
+	PUSH HL
+L1496:
+	PUSH XIX
+L1497:
+	POP HL
+L1498:
+	POP XIZ
+L1499:
+	PUSH BC
+L1500:
+	POP IZ
+L1501:
+	POP IX
+L1502:
+	POP XIY
+L1503:
+	POP XIX
+L1504:
+	PUSH XIX
+L1505:
+	POP XWA
+L1506:
+	POP XBC
+L1507:
+	PUSH XBC
+L1508:
+	PUSH XIX
+L1509:
+	POP XWA
+L1510:
+	POP HL
+L1511:
+	PUSH XIY
+L1512:
+	POP XBC
+L1513:
+	POP XHL
+L1514:
+	POP XIY
+L1515:
+	PUSH BC
+L1516:
+	PUSH IY
+L1517:
+	PUSH HL
+L1518:
+	PUSH XIX
+L1519:
+	PUSH IY
+L1520:
+	PUSH XWA
+L1521:
+	PUSH IX
+L1522:
+	PUSH XIZ
+L1523:
+	PUSH XWA
+L1524:
+	PUSH XIY
+L1525:
+	PUSH WA
+L1526:
+	PUSH XIX
+L1527:
+	POP IX
+L1528:
+	PUSH BC
+L1529:
+	POP IY
+L1530:
+	PUSH XHL
+L1531:
+	PUSH XBC
+L1532:
+	PUSH HL
+L1533:
+	POP DE
+L1534:
+	PUSH XIY
+L1535:
+	PUSH HL
+L1536:
+	POP IZ
+L1537:
+	POP WA
+L1538:
+	POP BC
+L1539:
+	PUSH XIX
+L1540:
+	PUSH IZ
+L1541:
+	PUSH XHL
+L1542:
+	POP XIZ
+L1543:
+	POP XIZ
+L1544:
+	POP WA
+L1545:
+	PUSH XDE
+L1546:
+	PUSH IZ
+L1547:
+	PUSH XIZ
+L1548:
+	POP XIY
+L1549:
+	PUSH XIZ
+L1550:
+	POP XBC
+L1551:
+	POP IZ
+L1552:
+	POP XWA
+L1553:
+	POP IZ
+L1554:
+	PUSH BC
+L1555:
+	POP IZ
+L1556:
+	POP XDE
+L1557:
+	PUSH HL
+L1558:
+	POP IY
+L1559:
+	POP XHL
+L1560:
+	PUSH IX
+L1561:
+	PUSH XBC
+L1562:
+	POP XIX
+L1563:
+	POP WA
+L1564:
+	PUSH HL
+L1565:
+	POP BC
+L1566:
+	PUSH XIZ
+L1567:
+	PUSH XIY
+L1568:
+	POP XBC
+L1569:
+	POP IY
+L1570:
+	POP IZ
+L1571:
+	PUSH XDE
+L1572:
+	PUSH DE
+L1573:
+	POP XIZ
+L1574:
+	POP XHL
+L1575:
+	POP XWA
+L1576:
+	POP BC
+L1577:
+	PUSH XDE
+L1578:
+	POP IY
+L1579:
+	PUSH BC
+L1580:
+	POP XWA
+L1581:
+	PUSH WA
+L1582:
+	POP XBC
+L1583:
+	POP IY
+L1584:
+	PUSH XBC
+L1585:
+	POP XHL
+L1586:
+	POP IZ
+L1587:
+	POP IX
+L1588:
+	PUSH XHL
+L1589:
+	PUSH BC
+L1590:
+	POP IX
+L1591:
+	POP XBC
+L1592:
+	POP IX
+L1593:
+	POP WA
+L1594:
+	POP IZ
+L1595:
+	PUSH XBC
+L1596:
+	PUSH XBC
+L1597:
+	POP IX
+L1598:
+	POP HL
+L1599:
+	PUSH DE
+L1600:
+	POP XWA
+L1601:
+	PUSH XBC
+L1602:
+	PUSH IZ
+L1603:
+	POP WA
+L1604:
+	POP XIX
+L1605:
+	POP WA
+L1606:
+	POP IZ
+L1607:
+	PUSH HL
+L1608:
+	POP IZ
+L1609:
+	PUSH XBC
+L1610:
+	PUSH XWA
+L1611:
+	PUSH XHL
+L1612:
+	POP XWA
+L1613:
+	PUSH HL
+L1614:
+	POP XIZ
+L1615:
+	POP WA
+L1616:
+	PUSH XIX
+L1617:
+	POP XWA
+L1618:
+	POP IX
+L1619:
+	POP HL
+L1620:
+	PUSH HL
+L1621:
+	PUSH XIX
+L1622:
+	PUSH BC
+L1623:
+	PUSH XIZ
+L1624:
+	POP DE
+L1625:
+	PUSH XDE
+L1626:
+	PUSH XIY
+L1627:
+	POP IX
+L1628:
+	PUSH IY
+L1629:
+	POP BC
+L1630:
+	POP WA
+L1631:
+	POP XBC
+L1632:
+	PUSH XBC
+L1633:
+	POP XIZ
+L1634:
+	PUSH DE
+L1635:
+	POP HL
+L1636:
+	POP BC
+L1637:
+	POP IZ
+L1638:
+	POP XWA
+L1639:
+	POP WA
+L1640:
+	POP XWA
+L1641:
+	POP IX
+L1642:
+	PUSH IX
+L1643:
+	POP XIX
+L1644:
+	PUSH XWA
+L1645:
+	POP XDE
+L1646:
+	POP XIX
+L1647:
+	PUSH HL
+L1648:
+	POP XHL
+L1649:
+	POP DE
+L1650:
+	PUSH XIX
+L1651:
+	POP BC
+L1652:
+	PUSH XBC
+L1653:
+	POP XHL
+L1654:
+	PUSH IZ
+L1655:
+	PUSH IY
+L1656:
+	POP IZ
+L1657:
+	PUSH BC
+L1658:
+	POP XIY
+L1659:
+	POP IX
+L1660:
+	POP XIZ
+L1661:
+	PUSH IX
+L1662:
+	POP IZ
+L1663:
+	PUSH XWA
+L1664:
+	POP XDE
+L1665:
+	PUSH IZ
+L1666:
+	PUSH XWA
+L1667:
+	POP XBC
+L1668:
+	POP XHL
+L1669:
+	PUSH XIZ
+L1670:
+	PUSH XBC
+L1671:
+	POP DE
+L1672:
+	PUSH XIY
+L1673:
+	PUSH XIY
+L1674:
+	POP XDE
+L1675:
+	POP BC
+L1676:
+	POP DE
+L1677:
+	POP BC
+L1678:
+	PUSH IZ
+L1679:
+	POP IX
+L1680:
+	POP BC
+L1681:
+	POP IX
+L1682:
+	POP XDE
+L1683:
+	PUSH XWA
+L1684:
+	PUSH XHL
+L1685:
+	PUSH XBC
+L1686:
+	PUSH IZ
+L1687:
+	POP DE
+L1688:
+	PUSH XHL
+L1689:
+	POP XHL
+L1690:
+	POP HL
+L1691:
+	POP BC
+L1692:
+	POP BC
+L1693:
+	PUSH XIY
+L1694:
+	PUSH IZ
+L1695:
+	PUSH IX
+L1696:
+	PUSH DE
+L1697:
+	POP HL
+L1698:
+	POP XWA
+L1699:
+	PUSH XBC
+L1700:
+	PUSH XIX
+L1701:
+	PUSH XBC
+L1702:
+	PUSH IY
+L1703:
+	PUSH DE
+L1704:
+	PUSH WA
+L1705:
+	PUSH XDE
+L1706:
+	POP WA
+L1707:
+	PUSH XIZ
+L1708:
+	POP XDE
+L1709:
+	PUSH IX
+L1710:
+	PUSH IZ
+L1711:
+	PUSH HL
+L1712:
+	POP IY
+L1713:
+	PUSH IY
+L1714:
+	PUSH XHL
+L1715:
+	PUSH XIX
+L1716:
+	POP WA
+L1717:
+	PUSH IZ
+L1718:
+	PUSH IY
+L1719:
+	PUSH WA
+L1720:
+	POP HL
+L1721:
+	PUSH IY
+L1722:
+	POP DE
+L1723:
+	POP HL
+L1724:
+	PUSH HL
+L1725:
+	POP XWA
+L1726:
+	POP HL
+L1727:
+	POP XWA
+L1728:
+	POP IZ
+L1729:
+	POP XIY
+L1730:
+	PUSH XIX
+L1731:
+	POP DE
+L1732:
+	POP DE
+L1733:
+	POP XIX
+L1734:
+	POP BC
+L1735:
+	POP XIY
+L1736:
+	PUSH WA
+L1737:
+	PUSH BC
+L1738:
+	PUSH IX
+L1739:
+	PUSH XIY
+L1740:
+	POP IX
+L1741:
+	POP XIX
+L1742:
+	POP XHL
+L1743:
+	POP HL
+L1744:
+	PUSH XDE
+L1745:
+	PUSH IZ
+L1746:
+	POP WA
+L1747:
+	PUSH IZ
+L1748:
+	PUSH XDE
+L1749:
+	POP XIZ
+L1750:
+	POP XHL
+L1751:
+	PUSH HL
+L1752:
+	POP WA
+L1753:
+	POP IY
+L1754:
+	POP IX
+L1755:
+	PUSH IX
+L1756:
+	POP IX
+L1757:
+	PUSH HL
+L1758:
+	POP XWA
+L1759:
+	POP HL
+L1760:
+	POP DE
+L1761:
+	PUSH WA
+L1762:
+	POP XHL
+L1763:
+	PUSH IY
+L1764:
+	PUSH HL
+L1765:
+	PUSH BC
+L1766:
+	PUSH XIY
+L1767:
+	PUSH BC
+L1768:
+	POP IY
+L1769:
+	PUSH XWA
+L1770:
+	PUSH IZ
+L1771:
+	POP XIZ
+L1772:
+	PUSH BC
+L1773:
+	POP IZ
+L1774:
+	PUSH IX
+L1775:
+	POP XHL
+L1776:
+	PUSH XIY
+L1777:
+	POP DE
+L1778:
+	PUSH XIZ
+L1779:
+	POP XWA
+L1780:
+	PUSH XIY
+L1781:
+	POP XIY
+L1782:
+	PUSH XWA
+L1783:
+	POP DE
+L1784:
+	PUSH XBC
+L1785:
+	POP IX
+L1786:
+	PUSH DE
+L1787:
+	POP BC
+L1788:
+	POP XHL
+L1789:
+	PUSH XIY
+L1790:
+	PUSH XIX
+L1791:
+	PUSH XBC
+L1792:
+	PUSH BC
+L1793:
+	POP HL
+L1794:
+	POP XIX
+L1795:
+	POP XIZ
+L1796:
+	POP XIY
+L1797:
+	PUSH IZ
+L1798:
+	POP XDE
+L1799:
+	PUSH IX
+L1800:
+	PUSH HL
+L1801:
+	PUSH BC
+L1802:
+	POP XIZ
+L1803:
+	PUSH XIX
+L1804:
+	POP IX
+L1805:
+	PUSH XDE
+L1806:
+	POP DE
+L1807:
+	PUSH BC
+L1808:
+	PUSH XIZ
+L1809:
+	POP XIZ
+L1810:
+	PUSH XIY
+L1811:
+	POP WA
+L1812:
+	PUSH DE
+L1813:
+	POP WA
+L1814:
+	PUSH IZ
+L1815:
+	PUSH IY
+L1816:
+	PUSH XHL
+L1817:
+	POP XIX
+L1818:
+	PUSH XDE
+L1819:
+	PUSH IZ
+L1820:
+	POP XDE
+L1821:
+	PUSH IX
+L1822:
+	PUSH XIY
+L1823:
+	POP HL
+L1824:
+	POP XDE
+L1825:
+	POP XBC
+L1826:
+	PUSH XWA
+L1827:
+	POP IZ
+L1828:
+	PUSH XHL
+L1829:
+	POP XIY
+L1830:
+	POP XDE
+L1831:
+	POP BC
+L1832:
+	PUSH XHL
+L1833:
+	PUSH IX
+L1834:
+	PUSH BC
+L1835:
+	PUSH HL
+L1836:
+	PUSH IY
+L1837:
+	POP IZ
+L1838:
+	POP WA
+L1839:
+	POP XWA
+L1840:
+	POP XIX
+L1841:
+	POP BC
+L1842:
+	POP XBC
+L1843:
+	PUSH XWA
+L1844:
+	PUSH XIZ
+L1845:
+	PUSH IZ
+L1846:
+	POP WA
+L1847:
+	POP XWA
+L1848:
+	POP XBC
+L1849:
+	POP WA
+L1850:
+	PUSH XIY
+L1851:
+	PUSH IZ
+L1852:
+	POP XHL
+L1853:
+	PUSH XBC
+L1854:
+	PUSH XHL
+L1855:
+	PUSH XBC
+L1856:
+	POP DE
+L1857:
+	PUSH HL
+L1858:
+	POP BC
+L1859:
+	POP XIZ
+L1860:
+	POP XHL
+L1861:
+	POP HL
+L1862:
+	POP XIX
+L1863:
+	PUSH XWA
+L1864:
+	POP BC
+L1865:
+	POP XDE
+L1866:
+	PUSH XDE
+L1867:
+	POP XIX
+L1868:
+	PUSH XWA
+L1869:
+	POP XIX
+L1870:
+	PUSH IY
+L1871:
+	PUSH HL
+L1872:
+	PUSH DE
+L1873:
+	POP XDE
+L1874:
+	POP IZ
+L1875:
+	POP XDE
+L1876:
+	POP DE
+L1877:
+	POP BC
+L1878:
+	PUSH XIY
+L1879:
+	POP IX
+L1880:
+	PUSH XWA
+L1881:
+	POP IX
+L1882:
+	POP XIY
+L1883:
+	PUSH IZ
+L1884:
+	POP HL
+L1885:
+	POP XHL
+L1886:
+	PUSH XHL
+L1887:
+	PUSH XIY
+L1888:
+	POP IX
+L1889:
+	POP XIZ
+L1890:
+	PUSH IZ
+L1891:
+	PUSH DE
+L1892:
+	POP HL
+L1893:
+	PUSH XDE
+L1894:
+	PUSH IY
+L1895:
+	PUSH IY
+L1896:
+	POP XIX
+L1897:
+	POP XIY
+L1898:
+	POP XIY
+L1899:
+	POP XIZ
+L1900:
+	PUSH BC
+L1901:
+	PUSH HL
+L1902:
+	POP HL
+L1903:
+	POP HL
+L1904:
+	POP BC
+L1905:
+	POP XIX
+L1906:
+	POP XIZ
+L1907:
+	PUSH IZ
+L1908:
+	POP IY
+L1909:
+	POP IX
+L1910:
+	POP BC
+L1911:
+	POP XIX
+L1912:
+	PUSH DE
+L1913:
+	PUSH XIY
+L1914:
+	POP IY
+L1915:
+	PUSH IY
+L1916:
+	POP HL
+L1917:
+	PUSH XIY
+L1918:
+	POP XBC
+L1919:
+	POP XIX
+L1920:
+	POP XHL
+L1921:
+	PUSH WA
+L1922:
+	POP XIY
+L1923:
+	POP HL
+L1924:
+	POP XIZ
+L1925:
+	POP IX
+L1926:
+	POP XBC
+L1927:
+	PUSH HL
+L1928:
+	POP WA
+L1929:
+	POP IZ
+L1930:
+	POP IX
+L1931:
+	PUSH IZ
+L1932:
+	PUSH IZ
+L1933:
+	POP HL
+L1934:
+	PUSH IY
+L1935:
+	PUSH IY
+L1936:
+	PUSH XHL
+L1937:
+	POP XIY
+L1938:
+	PUSH XWA
+L1939:
+	POP XIY
+L1940:
+	PUSH IY
+L1941:
+	PUSH BC
+L1942:
+	PUSH HL
+L1943:
+	PUSH XDE
+L1944:
+	POP DE
+L1945:
+	PUSH DE
+L1946:
+	POP DE
+L1947:
+	PUSH XIX
+L1948:
+	PUSH HL
+L1949:
+	POP XHL
+L1950:
+	PUSH IZ
+L1951:
+	POP DE
+L1952:
+	PUSH XIZ
+L1953:
+	POP XHL
+L1954:
+	PUSH IX
+L1955:
+	PUSH WA
+L1956:
+	POP DE
+L1957:
+	PUSH XBC
+L1958:
+	PUSH IY
+L1959:
+	POP BC
+L1960:
+	PUSH HL
+L1961:
+	PUSH HL
+L1962:
+	PUSH HL
+L1963:
+	POP XIX
+L1964:
+	POP IY
+L1965:
+	POP XIZ
+L1966:
+	PUSH XWA
+L1967:
+	PUSH XIX
+L1968:
+	PUSH IZ
+L1969:
+	POP XIY
+L1970:
+	POP XHL
+L1971:
+	PUSH BC
+L1972:
+	POP XIY
+L1973:
+	PUSH XIZ
+L1974:
+	POP XIZ
+L1975:
+	PUSH XIY
+L1976:
+	PUSH XHL
+L1977:
+	PUSH XHL
+L1978:
+	POP HL
+L1979:
+	POP XDE
+L1980:
+	PUSH XBC
+L1981:
+	PUSH XDE
+L1982:
+	POP WA
+L1983:
+	POP DE
+L1984:
+	POP XBC
+L1985:
+	PUSH XIZ
+L1986:
+	POP WA
+L1987:
+	POP XWA
+L1988:
+	POP XHL
+L1989:
+	PUSH XDE
+L1990:
+	POP IX
+L1991:
+	POP BC
+L1992:
+	POP XHL
+L1993:
+	POP XIX
+L1994:
+	PUSH IZ
+L1995:
+	PUSH HL
+L1996:
+	PUSH IY
+L1997:
+	POP XBC
+L1998:
+	POP XIZ
+L1999:
+	POP XWA
+L2000:
+	POP IX
+L2001:
+	POP XDE
+L2002:
+	POP XHL
+L2003:
+	PUSH HL
+L2004:
+	PUSH DE
+L2005:
+	POP HL
+L2006:
+	POP XHL
+L2007:
+	POP XBC
+L2008:
+	POP XWA
+L2009:
+	POP IX
+L2010:
+	PUSH IX
+L2011:
+	POP BC
+L2012:
+	POP IX
+L2013:
+	PUSH IX
+L2014:
+	PUSH BC
+L2015:
+	PUSH IZ
+L2016:
+	POP XIY
+L2017:
+	PUSH IX
+L2018:
+	PUSH BC
+L2019:
+	PUSH XIX
+L2020:
+	POP XWA
+L2021:
+	POP WA
+L2022:
+	POP IZ
+L2023:
+	PUSH XIY
+L2024:
+	POP IY
+L2025:
+	PUSH IX
+L2026:
+	PUSH DE
+L2027:
+	POP XHL
+L2028:
+	PUSH WA
+L2029:
+	POP IZ
+L2030:
+	PUSH HL
+L2031:
+	POP BC
+L2032:
+	POP XWA
+L2033:
+	PUSH XIX
+L2034:
+	PUSH IY
+L2035:
+	PUSH DE
+L2036:
+	POP IX
+L2037:
+	POP XHL
+L2038:
+	PUSH XWA
+L2039:
+	PUSH XIZ
+L2040:
+	POP XBC
+L2041:
+	POP XHL
+L2042:
+	PUSH HL
+L2043:
+	POP XIY
+L2044:
+	PUSH XIY
+L2045:
+	PUSH IZ
+L2046:
+	PUSH IY
+L2047:
+	PUSH XDE
+L2048:
+	POP XIX
+L2049:
+	PUSH BC
+L2050:
+	PUSH XIX
+L2051:
+	PUSH IZ
+L2052:
+	PUSH IY
+L2053:
+	POP HL
+L2054:
+	POP XIZ
+L2055:
+	POP IX
+L2056:
+	POP XIY
+L2057:
+	POP IY
+L2058:
+	PUSH XIX
+L2059:
+	POP DE
+L2060:
+	POP DE
+L2061:
+	POP IY
+L2062:
+	PUSH IY
+L2063:
+	POP IY
+L2064:
+	POP WA
+L2065:
+	PUSH BC
+L2066:
+	POP XHL
+L2067:
+	POP IY
+L2068:
+	PUSH IY
+L2069:
+	PUSH DE
+L2070:
+	PUSH DE
+L2071:
+	PUSH WA
+L2072:
+	POP XIZ
+L2073:
+	POP BC
+L2074:
+	PUSH HL
+L2075:
+	POP XIZ
+L2076:
+	PUSH IY
+L2077:
+	POP XIY
+L2078:
+	POP DE
+L2079:
+	POP WA
+L2080:
+	PUSH WA
+L2081:
+	PUSH WA
+L2082:
+	POP HL
+L2083:
+	PUSH IY
+L2084:
+	POP XHL
+L2085:
+	POP XIZ
+L2086:
+	PUSH BC
+L2087:
+	PUSH IZ
+L2088:
+	PUSH XIX
+L2089:
+	POP XWA
+L2090:
+	PUSH XIX
+L2091:
+	POP XIX
+L2092:
+	POP XDE
+L2093:
+	POP HL
+L2094:
+	POP IY
+L2095:
+	POP XIY
+L2096:
+	PUSH XIZ
+L2097:
+	POP XBC
+L2098:
+	PUSH HL
+L2099:
+	PUSH XIY
+L2100:
+	POP IZ
+L2101:
+	PUSH DE
+L2102:
+	PUSH XIY
+L2103:
+	POP DE
+L2104:
+	POP WA
+L2105:
+	PUSH IY
+L2106:
+	POP XIZ
+L2107:
+	PUSH BC
+L2108:
+	POP XDE
+L2109:
+	PUSH XIY
+L2110:
+	POP IY
+L2111:
+	PUSH XIY
+L2112:
+	PUSH IY
+L2113:
+	POP DE
+L2114:
+	POP XWA
+L2115:
+	PUSH IY
+L2116:
+	PUSH XIZ
+L2117:
+	POP BC
+L2118:
+	PUSH WA
+L2119:
+	PUSH DE
+L2120:
+	POP XIX
+L2121:
+	PUSH XIY
+L2122:
+	PUSH XWA
+L2123:
+	POP XIY
+L2124:
+	POP XDE
+L2125:
+	POP XDE
+L2126:
+	PUSH XDE
+L2127:
+	PUSH XWA
+L2128:
+	PUSH BC
+L2129:
+	POP XHL
+L2130:
+	POP XWA
+L2131:
+	PUSH XDE
+L2132:
+	POP XWA
+L2133:
+	PUSH HL
+L2134:
+	POP IX
+L2135:
+	PUSH XIX
+L2136:
+	PUSH WA
+L2137:
+	PUSH IX
+L2138:
+	PUSH XDE
+L2139:
+	POP DE
+L2140:
+	PUSH XWA
+L2141:
+	PUSH DE
+L2142:
+	POP XHL
+L2143:
+	POP IY
+L2144:
+	PUSH WA
+L2145:
+	PUSH IZ
+L2146:
+	POP XIZ
+L2147:
+	POP HL
+L2148:
+	PUSH XBC
+L2149:
+	PUSH XIX
+L2150:
+	PUSH XIZ
+L2151:
+	POP IX
+L2152:
+	POP IY
+L2153:
+	PUSH BC
+L2154:
+	POP IZ
+L2155:
+	PUSH XIX
+L2156:
+	POP XIZ
+L2157:
+	PUSH BC
+L2158:
+	POP XWA
+L2159:
+	POP IY
+L2160:
+	PUSH XDE
+L2161:
+	PUSH DE
+L2162:
+	PUSH XBC
+L2163:
+	PUSH BC
+L2164:
+	PUSH DE
+L2165:
+	PUSH DE
+L2166:
+	PUSH HL
+L2167:
+	POP DE
+L2168:
+	POP XDE
+L2169:
+	POP DE
+L2170:
+	PUSH XIZ
+L2171:
+	PUSH XBC
+L2172:
+	PUSH XIZ
+L2173:
+	PUSH XWA
+L2174:
+	PUSH IZ
+L2175:
+	PUSH WA
+L2176:
+	POP XDE
+L2177:
+	POP XIY
+L2178:
+	PUSH HL
+L2179:
+	POP XHL
+L2180:
+	POP IY
+L2181:
+	POP IX
+L2182:
+	POP XIY
+L2183:
+	PUSH HL
+L2184:
+	PUSH XHL
+L2185:
+	PUSH HL
+L2186:
+	PUSH BC
+L2187:
+	POP IY
+L2188:
+	PUSH XWA
+L2189:
+	PUSH IZ
+L2190:
+	PUSH HL
+L2191:
+	POP IY
+L2192:
+	PUSH WA
+L2193:
+	PUSH BC
+L2194:
+	POP HL
+L2195:
+	POP XHL
+L2196:
+	PUSH XIY
+L2197:
+	PUSH IZ
+L2198:
+	PUSH XWA
+L2199:
+	PUSH DE
+L2200:
+	POP BC
+L2201:
+	POP XIZ
+L2202:
+	POP DE
+L2203:
+	POP HL
+L2204:
+	POP XIY
+L2205:
+	PUSH IY
+L2206:
+	POP XIX
+L2207:
+	PUSH XBC
+L2208:
+	POP XIZ
+L2209:
+	PUSH WA
+L2210:
+	POP WA
+L2211:
+	POP XWA
+L2212:
+	POP XBC
+L2213:
+	POP XDE
+L2214:
+	POP WA
+L2215:
+	PUSH XDE
+L2216:
+	POP XIY
+L2217:
+	POP XIY
+L2218:
+	PUSH IX
+L2219:
+	POP WA
+L2220:
+	PUSH IY
+L2221:
+	PUSH XIY
+L2222:
+	POP XIY
+L2223:
+	PUSH XBC
+L2224:
+	POP XIZ
+L2225:
+	POP IY
+L2226:
+	PUSH XWA
+L2227:
+	PUSH XIY
+L2228:
+	POP XHL
+L2229:
+	POP XIX
+L2230:
+	PUSH XIY
+L2231:
+	POP XIX
+L2232:
+	PUSH XIZ
+L2233:
+	PUSH BC
+L2234:
+	POP HL
+L2235:
+	PUSH XHL
+L2236:
+	POP XHL
+L2237:
+	POP IY
+L2238:
+	PUSH HL
+L2239:
+	POP XIY
+L2240:
+	PUSH DE
+L2241:
+	POP HL
+L2242:
+	POP IZ
+L2243:
+	PUSH IZ
+L2244:
+	POP XWA
+L2245:
+	POP XIZ
+L2246:
+	PUSH XHL
+L2247:
+	PUSH XIZ
+L2248:
+	PUSH XWA
+L2249:
+	PUSH DE
+L2250:
+	PUSH XHL
+L2251:
+	PUSH IY
+L2252:
+	PUSH XIY
+L2253:
+	POP BC
+L2254:
+	POP XHL
+L2255:
+	POP IX
+L2256:
+	POP WA
+L2257:
+	POP XDE
+L2258:
+	PUSH XWA
+L2259:
+	POP HL
+L2260:
+	POP XIZ
+L2261:
+	PUSH BC
+L2262:
+	PUSH XWA
+L2263:
+	POP HL
+L2264:
+	POP XIZ
+L2265:
+	POP XIZ
+L2266:
+	POP XBC
+L2267:
+	PUSH XWA
+L2268:
+	PUSH DE
+L2269:
+	POP XWA
+L2270:
+	PUSH XIZ
+L2271:
+	PUSH IX
+L2272:
+	POP IX
+L2273:
+	PUSH XIY
+L2274:
+	PUSH XIX
+L2275:
+	POP DE
+L2276:
+	POP WA
+L2277:
+	PUSH XBC
+L2278:
+	PUSH BC
+L2279:
+	POP XDE
+L2280:
+	PUSH WA
+L2281:
+	POP IX
+L2282:
+	POP XIY
+L2283:
+	POP WA
+L2284:
+	POP HL
+L2285:
+	POP IZ
+L2286:
+	POP XDE
+L2287:
+	POP IY
+L2288:
+	PUSH WA
+L2289:
+	PUSH XIY
+L2290:
+	PUSH XBC
+L2291:
+	POP XIX
+L2292:
+	POP XDE
+L2293:
+	POP IX
+L2294:
+	POP XIY
+L2295:
+	POP XBC
+L2296:
+	POP XWA
+L2297:
+	PUSH XHL
+L2298:
+	POP IZ
+L2299:
+	PUSH IZ
+L2300:
+	POP XIZ
+L2301:
+	POP XIZ
+L2302:
+	PUSH DE
+L2303:
+	PUSH XIZ
+L2304:
+	PUSH XBC
+L2305:
+	POP BC
+L2306:
+	POP XBC
+L2307:
+	PUSH XIY
+L2308:
+	PUSH XHL
+L2309:
+	POP XHL
+L2310:
+	PUSH BC
+L2311:
+	POP IY
+L2312:
+	POP DE
+L2313:
+	POP XIZ
+L2314:
+	POP XIZ
+L2315:
+	POP IZ
+L2316:
+	POP IZ
+L2317:
+	PUSH XIZ
+L2318:
+	POP DE
+L2319:
+	PUSH XBC
+L2320:
+	POP XBC
+L2321:
+	POP XBC
+L2322:
+	PUSH IZ
+L2323:
+	POP DE
+L2324:
+	POP XIX
+L2325:
+	POP XIX
+L2326:
+	POP DE
+L2327:
+	POP XIY
+L2328:
+	POP WA
+L2329:
+	PUSH WA
+L2330:
+	PUSH XIX
+L2331:
+	PUSH XIX
+L2332:
+	POP XWA
+L2333:
+	POP WA
+L2334:
+	PUSH IY
+L2335:
+	PUSH HL
+L2336:
+	POP XIX
+L2337:
+	PUSH BC
+L2338:
+	PUSH DE
+L2339:
+	POP XIY
+L2340:
+	POP XWA
+L2341:
+	PUSH IX
+L2342:
+	POP WA
+L2343:
+	POP XIX
+L2344:
+	POP IY
+L2345:
+	POP DE
+L2346:
+	POP IY
+L2347:
+	PUSH XWA
+L2348:
+	POP XDE
+L2349:
+	POP XIX
+L2350:
+	POP XWA
+L2351:
+	POP XWA
+L2352:
+	POP XHL
+L2353:
+	POP IX
+L2354:
+	PUSH XIY
+L2355:
+	POP HL
+L2356:
+	PUSH HL
+L2357:
+	PUSH XWA
+L2358:
+	POP XWA
+L2359:
+	POP XIZ
+L2360:
+	POP WA
+L2361:
+	PUSH XHL
+L2362:
+	PUSH XDE
+L2363:
+	POP IZ
+L2364:
+	POP IZ
+L2365:
+	PUSH XIX
+L2366:
+	POP IY
+L2367:
+	POP XIX
+L2368:
+	POP BC
+L2369:
+	PUSH XIX
+L2370:
+	POP IY
+L2371:
+	PUSH XIY
+L2372:
+	PUSH XBC
+L2373:
+	PUSH XWA
+L2374:
+	POP XBC
+L2375:
+	PUSH HL
+L2376:
+	POP XWA
+L2377:
+	POP IY
+L2378:
+	PUSH XWA
+L2379:
+	PUSH XIZ
+L2380:
+	PUSH XBC
+L2381:
+	PUSH DE
+L2382:
+	PUSH WA
+L2383:
+	PUSH IY
+L2384:
+	POP IZ
+L2385:
+	PUSH IZ
+L2386:
+	PUSH XBC
+L2387:
+	POP XDE
+L2388:
+	PUSH IZ
+L2389:
+	PUSH XIZ
+L2390:
+	PUSH XIY
+L2391:
+	POP HL
+L2392:
+	POP WA
+L2393:
+	POP XIY
+L2394:
+	POP IX
+L2395:
+	PUSH XHL
+L2396:
+	POP DE
+L2397:
+	POP XHL
+L2398:
+	PUSH XDE
+L2399:
+	PUSH XIZ
+L2400:
+	POP XIY
+L2401:
+	POP XIY
+L2402:
+	POP XIX
+L2403:
+	POP HL
+L2404:
+	PUSH XBC
+L2405:
+	POP DE
+L2406:
+	POP XHL
+L2407:
+	PUSH XIZ
+L2408:
+	PUSH XDE
+L2409:
+	POP IX
+L2410:
+	POP XIY
+L2411:
+	PUSH XBC
+L2412:
+	PUSH IX
+L2413:
+	PUSH XIX
+L2414:
+	POP BC
+L2415:
+	PUSH IX
+L2416:
+	POP IZ
+L2417:
+	POP XBC
+L2418:
+	PUSH XIZ
+L2419:
+	POP XIZ
+L2420:
+	POP XBC
+L2421:
+	PUSH XIY
+L2422:
+	PUSH XIX
+L2423:
+	PUSH XBC
+L2424:
+	PUSH XHL
+L2425:
+	PUSH IZ
+L2426:
+	POP IX
+L2427:
+	PUSH XWA
+L2428:
+	POP XBC
+L2429:
+	PUSH IY
+L2430:
+	PUSH DE
+L2431:
+	PUSH XIZ
+L2432:
+	POP WA
+L2433:
+	PUSH XIX
+L2434:
+	POP WA
+L2435:
+	POP IZ
+L2436:
+	PUSH XIX
+L2437:
+	PUSH XHL
+L2438:
+	POP XHL
+L2439:
+	POP DE
+L2440:
+	PUSH DE
+L2441:
+	PUSH IX
+L2442:
+	POP IZ
+L2443:
+	POP IY
+L2444:
+	POP XWA
+L2445:
+	POP HL
+L2446:
+	PUSH XBC
+L2447:
+	PUSH XIX
+L2448:
+	PUSH IY
+L2449:
+	POP XWA
+L2450:
+	PUSH XIY
+L2451:
+	POP XBC
+L2452:
+	PUSH XWA
+L2453:
+	POP IX
+L2454:
+	PUSH DE
+L2455:
+	PUSH WA
+L2456:
+	PUSH IX
+L2457:
+	PUSH XDE
+L2458:
+	POP IX
+L2459:
+	PUSH IY
+L2460:
+	PUSH IZ
+L2461:
+	POP WA
+L2462:
+	POP DE
+L2463:
+	PUSH XBC
+L2464:
+	PUSH HL
+L2465:
+	PUSH IX
+L2466:
+	POP XBC
+L2467:
+	PUSH WA
+L2468:
+	PUSH IZ
+L2469:
+	PUSH XIZ
+L2470:
+	PUSH IZ
+L2471:
+	PUSH IY
+L2472:
+	PUSH XIY
+L2473:
+	PUSH XIX
+L2474:
+	PUSH WA
+L2475:
+	PUSH IY
+L2476:
+	PUSH IZ
+L2477:
+	POP IX
+L2478:
+	PUSH IY
+L2479:
+	POP DE
+L2480:
+	POP WA
+L2481:
+	POP XDE
+L2482:
+	POP XDE
+L2483:
+	PUSH WA
+L2484:
+	PUSH XIZ
+L2485:
+	PUSH IZ
+L2486:
+	POP IZ
+L2487:
+	POP HL
+L2488:
+	PUSH IX
+L2489:
+	PUSH XIX
+L2490:
+	PUSH DE
+L2491:
+	PUSH XWA
+L2492:
+	PUSH XDE
+L2493:
+	PUSH BC
+L2494:
+	POP IZ
+L2495:
+	POP IZ
+L2496:
+	POP IZ
+L2497:
+	PUSH XIX
+L2498:
+	POP XIZ
+L2499:
+	PUSH IX
+L2500:
+	POP BC
+L2501:
+	POP XIX
+L2502:
+	PUSH XWA
+L2503:
+	PUSH XHL
+L2504:
+	PUSH IY
+L2505:
+	POP IX
+L2506:
+	POP XHL
+L2507:
+	POP XDE
+L2508:
+	PUSH HL
+L2509:
+	POP XWA
+L2510:
+	POP XWA
+L2511:
+	POP BC
+L2512:
+	POP XWA
+L2513:
+	PUSH BC
+L2514:
+	POP HL
+L2515:
+	PUSH XDE
+L2516:
+	POP XIZ
+L2517:
+	POP XIY
+L2518:
+	POP DE
+L2519:
+	POP XDE
+L2520:
+	POP XHL
+L2521:
+	PUSH XIX
+L2522:
+	PUSH XIX
+L2523:
+	POP IX
+L2524:
+	PUSH XBC
+L2525:
+	POP XIX
+L2526:
+	POP XIZ
+L2527:
+	POP WA
+L2528:
+	PUSH XDE
+L2529:
+	POP DE
+L2530:
+	POP XBC
+L2531:
+	POP DE
+L2532:
+	PUSH XIY
+L2533:
+	PUSH XBC
+L2534:
+	PUSH IX
+L2535:
+	PUSH XIX
+L2536:
+	POP XBC
+L2537:
+	POP XWA
+L2538:
+	PUSH WA
+L2539:
+	PUSH IX
+L2540:
+	PUSH HL
+L2541:
+	POP XDE
+L2542:
+	POP XIY
+L2543:
+	PUSH XDE
+L2544:
+	PUSH XIY
+L2545:
+	PUSH IY
+L2546:
+	POP XIY
+L2547:
+	POP WA
+L2548:
+	POP IY
+L2549:
+	POP XBC
+L2550:
+	PUSH XDE
+L2551:
+	PUSH IZ
+L2552:
+	POP XIZ
+L2553:
+	PUSH XHL
+L2554:
+	PUSH IZ
+L2555:
+	POP XBC
+L2556:
+	POP IY
+L2557:
+	POP HL
+L2558:
+	POP XDE
+L2559:
+	PUSH XDE
+L2560:
+	POP DE
+L2561:
+	PUSH IZ
+L2562:
+	POP XDE
+L2563:
+	PUSH XIX
+L2564:
+	POP HL
+L2565:
+	PUSH IY
+L2566:
+	POP BC
+L2567:
+	POP WA
+L2568:
+	POP BC
+L2569:
+	PUSH DE
+L2570:
+	PUSH XBC
+L2571:
+	PUSH BC
+L2572:
+	POP XBC
+L2573:
+	PUSH HL
+L2574:
+	PUSH DE
+L2575:
+	POP BC
+L2576:
+	POP DE
+L2577:
+	PUSH XHL
+L2578:
+	PUSH IY
+L2579:
+	PUSH IY
+L2580:
+	PUSH XIX
+L2581:
+	POP HL
+L2582:
+	POP XIX
+L2583:
+	POP XWA
+L2584:
+	PUSH XWA
+L2585:
+	PUSH XBC
+L2586:
+	PUSH XIX
+L2587:
+	PUSH XHL
+L2588:
+	PUSH WA
+L2589:
+	POP BC
+L2590:
+	PUSH IY
+L2591:
+	PUSH XIZ
+L2592:
+	POP IX
+L2593:
+	PUSH XHL
+L2594:
+	POP XIZ
+L2595:
+	POP XIY
+L2596:
+	POP WA
+L2597:
+	PUSH WA
+L2598:
+	PUSH XIY
+L2599:
+	PUSH DE
+L2600:
+	PUSH BC
+L2601:
+	POP HL
+L2602:
+	PUSH XIY
+L2603:
+	PUSH XHL
+L2604:
+	POP HL
+L2605:
+	PUSH DE
+L2606:
+	PUSH XIZ
+L2607:
+	POP IZ
+L2608:
+	PUSH XDE
+L2609:
+	PUSH WA
+L2610:
+	PUSH HL
+L2611:
+	POP XIZ
+L2612:
+	POP XIZ
+L2613:
+	PUSH XIZ
+L2614:
+	PUSH WA
+L2615:
+	POP XIY
+L2616:
+	PUSH IZ
+L2617:
+	PUSH XIZ
+L2618:
+	PUSH XIZ
+L2619:
+	PUSH XWA
+L2620:
+	POP XIZ
+L2621:
+	PUSH XBC
+L2622:
+	POP XHL
+L2623:
+	PUSH IZ
+L2624:
+	POP IZ
+L2625:
+	POP DE
+L2626:
+	PUSH HL
+L2627:
+	PUSH IY
+L2628:
+	PUSH XIX
+L2629:
+	PUSH XWA
+L2630:
+	POP IZ
+L2631:
+	PUSH XWA
+L2632:
+	POP IY
+L2633:
+	PUSH XBC
+L2634:
+	PUSH XBC
+L2635:
+	POP BC
+L2636:
+	PUSH WA
+L2637:
+	POP XIZ
+L2638:
+	POP XIZ
+L2639:
+	POP HL
+L2640:
+	PUSH IY
+L2641:
+	POP DE
+L2642:
+	POP XIY
+L2643:
+	POP XIX
+L2644:
+	PUSH XWA
+L2645:
+	PUSH XBC
+L2646:
+	PUSH XBC
+L2647:
+	PUSH XHL
+L2648:
+	POP HL
+L2649:
+	PUSH DE
+L2650:
+	PUSH XBC
+L2651:
+	PUSH HL
+L2652:
+	PUSH XHL
+L2653:
+	POP XBC
+L2654:
+	POP IZ
+L2655:
+	PUSH XBC
+L2656:
+	PUSH XDE
+L2657:
+	POP XDE
+L2658:
+	POP IX
+L2659:
+	PUSH XHL
+L2660:
+	PUSH XWA
+L2661:
+	PUSH WA
+L2662:
+	PUSH XWA
+L2663:
+	POP DE
+L2664:
+	POP IZ
+L2665:
+	PUSH XIZ
+L2666:
+	POP XIX
+L2667:
+	PUSH IY
+L2668:
+	POP WA
+L2669:
+	PUSH IY
+L2670:
+	POP XIZ
+L2671:
+	PUSH IZ
+L2672:
+	PUSH WA
+L2673:
+	POP DE
+L2674:
+	PUSH IZ
+L2675:
+	POP IX
+L2676:
+	POP HL
+L2677:
+	PUSH BC
+L2678:
+	POP BC
+L2679:
+	PUSH XIZ
+L2680:
+	PUSH XDE
+L2681:
+	PUSH XDE
+L2682:
+	PUSH XBC
+L2683:
+	PUSH HL
+L2684:
+	POP IX
+L2685:
+	PUSH XIX
+L2686:
+	PUSH XIY
+L2687:
+	PUSH DE
+L2688:
+	PUSH BC
+L2689:
+	POP IX
+L2690:
+	PUSH XHL
+L2691:
+	PUSH IY
+L2692:
+	PUSH XIX
+L2693:
+	PUSH IX
+L2694:
+	PUSH XDE
+L2695:
+	PUSH WA
+L2696:
+	PUSH HL
+L2697:
+	POP IX
+L2698:
+	POP WA
+L2699:
+	POP XIX
+L2700:
+	POP XIY
+L2701:
+	POP IX
+L2702:
+	PUSH XDE
+L2703:
+	PUSH WA
+L2704:
+	POP HL
+L2705:
+	PUSH WA
+L2706:
+	POP XBC
+L2707:
+	PUSH XHL
+L2708:
+	POP IZ
+L2709:
+	PUSH WA
+L2710:
+	POP HL
+L2711:
+	PUSH XIX
+L2712:
+	PUSH BC
+L2713:
+	POP XDE
+L2714:
+	PUSH XWA
+L2715:
+	POP IX
+L2716:
+	POP DE
+L2717:
+	POP IY
+L2718:
+	PUSH IY
+L2719:
+	PUSH XHL
+L2720:
+	POP BC
+L2721:
+	PUSH IX
+L2722:
+	POP BC
+L2723:
+	PUSH XWA
+L2724:
+	POP IX
+L2725:
+	PUSH XHL
+L2726:
+	PUSH XIX
+L2727:
+	PUSH WA
+L2728:
+	PUSH HL
+L2729:
+	PUSH DE
+L2730:
+	PUSH XBC
+L2731:
+	POP XDE
+L2732:
+	POP XIY
+L2733:
+	POP IY
+L2734:
+	POP HL
+L2735:
+	PUSH XDE
+L2736:
+	POP XBC
+L2737:
+	POP IZ
+L2738:
+	POP XIZ
+L2739:
+	PUSH IX
+L2740:
+	PUSH BC
+L2741:
+	POP XIX
+L2742:
+	POP XDE
+L2743:
+	PUSH XHL
+L2744:
+	POP XWA
+L2745:
+	PUSH IX
+L2746:
+	PUSH WA
+L2747:
+	PUSH IX
+L2748:
+	POP HL
+L2749:
+	PUSH XIZ
+L2750:
+	POP HL
+L2751:
+	POP IY
+L2752:
+	PUSH XBC
+L2753:
+	PUSH WA
+L2754:
+	POP IX
+L2755:
+	POP XIZ
+L2756:
+	POP XIZ
+L2757:
+	POP DE
+L2758:
+	POP XHL
+L2759:
+	PUSH XIX
+L2760:
+	POP XIX
+L2761:
+	PUSH BC
+L2762:
+	PUSH XWA
+L2763:
+	POP DE
+L2764:
+	POP WA
+L2765:
+	PUSH XIX
+L2766:
+	POP XIY
+L2767:
+	PUSH IZ
+L2768:
+	PUSH XIY
+L2769:
+	POP BC
+L2770:
+	PUSH XIZ
+L2771:
+	POP XIZ
+L2772:
+	PUSH XIY
+L2773:
+	POP IY
+L2774:
+	POP WA
+L2775:
+	PUSH HL
+L2776:
+	POP HL
+L2777:
+	PUSH BC
+L2778:
+	PUSH XIY
+L2779:
+	PUSH DE
+L2780:
+	PUSH WA
+L2781:
+	PUSH HL
+L2782:
+	POP HL
+L2783:
+	POP XDE
+L2784:
+	POP BC
+L2785:
+	PUSH WA
+L2786:
+	PUSH XHL
+L2787:
+	PUSH XIY
+L2788:
+	PUSH IZ
+L2789:
+	PUSH XHL
+L2790:
+	POP XIX
+L2791:
+	PUSH DE
+L2792:
+	POP XDE
+L2793:
+	POP XWA
+L2794:
+	PUSH HL
+L2795:
+	PUSH XWA
+L2796:
+	POP IX
+L2797:
+	PUSH WA
+L2798:
+	PUSH XIZ
+L2799:
+	POP XIX
+L2800:
+	PUSH BC
+L2801:
+	POP DE
+L2802:
+	POP IY
+L2803:
+	PUSH DE
+L2804:
+	PUSH XIX
+L2805:
+	PUSH BC
+L2806:
+	PUSH XDE
+L2807:
+	POP IX
+L2808:
+	POP WA
+L2809:
+	POP BC
+L2810:
+	POP IY
+L2811:
+	POP DE
+L2812:
+	POP IX
+L2813:
+	POP BC
+L2814:
+	POP BC
+L2815:
+	PUSH DE
+L2816:
+	POP IY
+L2817:
+	POP IY
+L2818:
+	PUSH XIX
+L2819:
+	PUSH XBC
+L2820:
+	PUSH HL
+L2821:
+	POP XBC
+L2822:
+	POP BC
+L2823:
+	PUSH XDE
+L2824:
+	PUSH XWA
+L2825:
+	PUSH IY
+L2826:
+	PUSH HL
+L2827:
+	POP XHL
+L2828:
+	PUSH IZ
+L2829:
+	POP XWA
+L2830:
+	POP XBC
+L2831:
+	PUSH XDE
+L2832:
+	POP XHL
+L2833:
+	POP XHL
+L2834:
+	POP XWA
+L2835:
+	POP XBC
+L2836:
+	PUSH IZ
+L2837:
+	PUSH WA
+L2838:
+	PUSH IY
+L2839:
+	PUSH HL
+L2840:
+	POP WA
+L2841:
+	POP IZ
+L2842:
+	PUSH BC
+L2843:
+	PUSH DE
+L2844:
+	PUSH XDE
+L2845:
+	PUSH XDE
+L2846:
+	POP XWA
+L2847:
+	POP HL
+L2848:
+	PUSH IZ
+L2849:
+	POP DE
+L2850:
+	PUSH IY
+L2851:
+	PUSH IX
+L2852:
+	POP IX
+L2853:
+	POP IX
+L2854:
+	PUSH DE
+L2855:
+	PUSH XIZ
+L2856:
+	PUSH BC
+L2857:
+	POP XHL
+L2858:
+	POP XHL
+L2859:
+	POP XIX
+L2860:
+	POP XHL
+L2861:
+	POP HL
+L2862:
+	PUSH XIX
+L2863:
+	PUSH BC
+L2864:
+	PUSH BC
+L2865:
+	POP BC
+L2866:
+	PUSH DE
+L2867:
+	PUSH XIZ
+L2868:
+	POP XIY
+L2869:
+	PUSH BC
+L2870:
+	POP IZ
+L2871:
+	POP XIZ
+L2872:
+	PUSH XIX
+L2873:
+	PUSH XBC
+L2874:
+	POP XIX
+L2875:
+	PUSH WA
+L2876:
+	POP XIZ
+L2877:
+	POP BC
+L2878:
+	PUSH XIZ
+L2879:
+	PUSH IX
+L2880:
+	PUSH HL
+L2881:
+	PUSH DE
+L2882:
+	PUSH XIZ
+L2883:
+	PUSH WA
+L2884:
+	PUSH BC
+L2885:
+	PUSH IZ
+L2886:
+	PUSH XIX
+L2887:
+	POP XWA
+L2888:
+	POP IZ
+L2889:
+	PUSH XIY
+L2890:
+	PUSH XHL
+L2891:
+	POP XIY
+L2892:
+	POP IY
+L2893:
+	PUSH BC
+L2894:
+	PUSH IZ
+L2895:
+	PUSH BC
+L2896:
+	PUSH IY
+L2897:
+	PUSH XIY
+L2898:
+	PUSH XBC
+L2899:
+	PUSH XBC
+L2900:
+	PUSH XWA
+L2901:
+	PUSH WA
+L2902:
+	POP XHL
+L2903:
+	POP XDE
+L2904:
+	POP DE
+L2905:
+	POP DE
+L2906:
+	POP WA
+L2907:
+	POP XIY
+L2908:
+	POP HL
+L2909:
+	PUSH BC
+L2910:
+	POP BC
+L2911:
+	PUSH XIY
+L2912:
+	PUSH HL
+L2913:
+	PUSH IY
+L2914:
+	PUSH BC
+L2915:
+	POP HL
+L2916:
+	PUSH IZ
+L2917:
+	POP DE
+L2918:
+	PUSH IZ
+L2919:
+	POP XIZ
+L2920:
+	PUSH XDE
+L2921:
+	PUSH BC
+L2922:
+	PUSH DE
+L2923:
+	PUSH XDE
+L2924:
+	POP XHL
+L2925:
+	PUSH WA
+L2926:
+	PUSH XWA
+L2927:
+	PUSH XBC
+L2928:
+	PUSH DE
+L2929:
+	PUSH WA
+L2930:
+	PUSH DE
+L2931:
+	POP XHL
+L2932:
+	PUSH XIY
+L2933:
+	POP XIZ
+L2934:
+	PUSH IX
+L2935:
+	POP WA
+L2936:
+	PUSH HL
+L2937:
+	POP XDE
+L2938:
+	PUSH XDE
+L2939:
+	POP XDE
+L2940:
+	POP IZ
+L2941:
+	PUSH XHL
+L2942:
+	POP DE
+L2943:
+	POP XIY
+L2944:
+	POP XBC
+L2945:
+	POP DE
+L2946:
+	POP DE
+L2947:
+	PUSH XIZ
+L2948:
+	PUSH XIY
+L2949:
+	PUSH DE
+L2950:
+	PUSH XHL
+L2951:
+	PUSH BC
+L2952:
+	POP XBC
+L2953:
+	PUSH XDE
+L2954:
+	PUSH XBC
+L2955:
+	POP XBC
+L2956:
+	PUSH XDE
+L2957:
+	PUSH XBC
+L2958:
+	PUSH XDE
+L2959:
+	POP XDE
+L2960:
+	POP HL
+L2961:
+	PUSH IY
+L2962:
+	PUSH XIY
+L2963:
+	PUSH HL
+L2964:
+	PUSH BC
+L2965:
+	POP IY
+L2966:
+	POP XWA
+L2967:
+	PUSH XIZ
+L2968:
+	PUSH IY
+L2969:
+	POP XHL
+L2970:
+	PUSH IX
+L2971:
+	POP BC
+L2972:
+	PUSH XIX
+L2973:
+	PUSH DE
+L2974:
+	PUSH IY
+L2975:
+	PUSH IZ
+L2976:
+	PUSH XIZ
+L2977:
+	POP XHL
+L2978:
+	PUSH IZ
+L2979:
+	PUSH XIZ
+L2980:
+	PUSH DE
+L2981:
+	POP XIZ
+L2982:
+	PUSH BC
+L2983:
+	PUSH HL
+L2984:
+	PUSH IZ
+L2985:
+	PUSH BC
+L2986:
+	POP IY
+L2987:
+	PUSH XHL
+L2988:
+	PUSH XWA
+L2989:
+	PUSH IY
+L2990:
+	POP IX
+L2991:
+	PUSH XDE
+L2992:
+	PUSH IX
+L2993:
+	POP IY
+L2994:
+	POP XHL
+L2995:
+	POP XBC
+L2996:
+	PUSH DE
+L2997:
+	PUSH XDE
+L2998:
+	PUSH XWA
+L2999:
+	PUSH XBC
+L3000:
+	POP XIZ
+L3001:
+	PUSH BC
+L3002:
+	POP IX
+L3003:
+	PUSH HL
+L3004:
+	PUSH XHL
+L3005:
+	POP XIX
+L3006:
+	POP BC
+L3007:
+	POP XIX
+L3008:
+	PUSH IY
+L3009:
+	POP XIY
+L3010:
+	POP XHL
+L3011:
+	POP XDE
+L3012:
+	PUSH IX
+L3013:
+	PUSH XIY
+L3014:
+	PUSH XIX
+L3015:
+	POP BC
+L3016:
+	POP IZ
+L3017:
+	POP XIY
+L3018:
+	POP XIY
+L3019:
+	PUSH XBC
+L3020:
+	POP XHL
+L3021:
+	POP XWA
+L3022:
+	POP XWA
+L3023:
+	PUSH XHL
+L3024:
+	PUSH XWA
+L3025:
+	POP IZ
+L3026:
+	PUSH HL
+L3027:
+	POP XIZ
+L3028:
+	POP IY
+L3029:
+	POP XBC
+L3030:
+	PUSH XWA
+L3031:
+	POP DE
+L3032:
+	PUSH IX
+L3033:
+	POP BC
+L3034:
+	PUSH XDE
+L3035:
+	PUSH HL
+L3036:
+	POP XDE
+L3037:
+	POP IX
+L3038:
+	POP XIY
+L3039:
+	POP XIY
+L3040:
+	PUSH XIY
+L3041:
+	PUSH IX
+L3042:
+	POP IY
+L3043:
+	POP XIX
+L3044:
+	POP XWA
+L3045:
+	PUSH XHL
+L3046:
+	PUSH IY
+L3047:
+	POP XIZ
+L3048:
+	PUSH HL
+L3049:
+	POP XWA
+L3050:
+	POP XHL
+L3051:
+	PUSH IX
+L3052:
+	PUSH XIX
+L3053:
+	POP IX
+L3054:
+	PUSH XIX
+L3055:
+	POP WA
+L3056:
+	POP BC
+L3057:
+	PUSH XIX
+L3058:
+	PUSH XWA
+L3059:
+	POP XHL
+L3060:
+	PUSH DE
+L3061:
+	PUSH IX
+L3062:
+	PUSH DE
+L3063:
+	PUSH BC
+L3064:
+	PUSH XIZ
+L3065:
+	PUSH BC
+L3066:
+	PUSH IZ
+L3067:
+	POP DE
+L3068:
+	PUSH WA
+L3069:
+	POP DE
+L3070:
+	PUSH IY
+L3071:
+	PUSH XIZ
+L3072:
+	PUSH WA
+L3073:
+	PUSH XDE
+L3074:
+	PUSH DE
+L3075:
+	PUSH IZ
+L3076:
+	POP XIZ
+L3077:
+	POP XHL
+L3078:
+	POP XIY
+L3079:
+	PUSH XDE
+L3080:
+	PUSH XIX
+L3081:
+	PUSH IX
+L3082:
+	PUSH XIY
+L3083:
+	POP IZ
+L3084:
+	POP HL
+L3085:
+	POP XHL
+L3086:
+	POP IX
+L3087:
+	PUSH BC
+L3088:
+	POP IY
+L3089:
+	PUSH IY
+L3090:
+	POP IX
+L3091:
+	POP XDE
+L3092:
+	POP DE
+L3093:
+	POP IX
+L3094:
+	POP XIZ
+L3095:
+	POP XIZ
+L3096:
+	POP XIY
+L3097:
+	POP XWA
+L3098:
+	POP XHL
+L3099:
+	PUSH XDE
+L3100:
+	PUSH HL
+L3101:
+	PUSH XIX
+L3102:
+	POP XDE
+L3103:
+	PUSH XIX
+L3104:
+	POP BC
+L3105:
+	PUSH XDE
+L3106:
+	PUSH XIY
+L3107:
+	POP IY
+L3108:
+	POP XBC
+L3109:
+	PUSH IX
+L3110:
+	PUSH XBC
+L3111:
+	POP DE
+L3112:
+	POP DE
+L3113:
+	POP XWA
+L3114:
+	PUSH BC
+L3115:
+	POP XIX
+L3116:
+	POP XWA
+L3117:
+	POP BC
+L3118:
+	POP IX
+L3119:
+	PUSH XIZ
+L3120:
+	PUSH XIX
+L3121:
+	POP XDE
+L3122:
+	POP IX
+L3123:
+	PUSH HL
+L3124:
+	POP IX
+L3125:
+	PUSH IY
+L3126:
+	PUSH IY
+L3127:
+	POP XIX
+L3128:
+	POP XWA
+L3129:
+	POP XIX
+L3130:
+	PUSH IZ
+L3131:
+	PUSH DE
+L3132:
+	POP XIZ
+L3133:
+	PUSH BC
+L3134:
+	POP XHL
+L3135:
+	POP XIZ
+L3136:
+	POP XHL
+L3137:
+	POP DE
+L3138:
+	PUSH BC
+L3139:
+	PUSH IZ
+L3140:
+	POP WA
+L3141:
+	POP DE
+L3142:
+	PUSH BC
+L3143:
+	POP XIZ
+L3144:
+	POP HL
+L3145:
+	PUSH IZ
+L3146:
+	POP XDE
+L3147:
+	PUSH XDE
+L3148:
+	PUSH XHL
+L3149:
+	PUSH HL
+L3150:
+	POP XIX
+L3151:
+	POP IY
+L3152:
+	PUSH XWA
+L3153:
+	PUSH XBC
+L3154:
+	PUSH IZ
+L3155:
+	POP XWA
+L3156:
+	POP XWA
+L3157:
+	POP XDE
+L3158:
+	POP IZ
+L3159:
+	POP DE
+L3160:
+	POP WA
+L3161:
+	POP XHL
+L3162:
+	POP HL
+L3163:
+	PUSH WA
+L3164:
+	POP XIY
+L3165:
+	PUSH XIY
+L3166:
+	PUSH XIZ
+L3167:
+	POP XIY
+L3168:
+	POP XDE
+L3169:
+	PUSH XIY
+L3170:
+	POP DE
+L3171:
+	PUSH XIY
+L3172:
+	PUSH XIZ
+L3173:
+	PUSH IZ
+L3174:
+	PUSH BC
+L3175:
+	POP HL
+L3176:
+	PUSH XIY
+L3177:
+	POP IY
+L3178:
+	POP IZ
+L3179:
+	POP XDE
+L3180:
+	PUSH XBC
+L3181:
+	PUSH XIY
+L3182:
+	PUSH XIY
+L3183:
+	POP XBC
+L3184:
+	PUSH IX
+L3185:
+	PUSH XIY
+L3186:
+	PUSH IZ
+L3187:
+	POP XIZ
+L3188:
+	POP IX
+L3189:
+	POP XIZ
+L3190:
+	PUSH HL
+L3191:
+	POP WA
+L3192:
+	POP WA
+L3193:
+	POP XDE
+L3194:
+	POP XIX
+L3195:
+	POP XWA
+L3196:
+	PUSH WA
+L3197:
+	PUSH XDE
+L3198:
+	POP XBC
+L3199:
+	PUSH BC
+L3200:
+	POP XHL
+L3201:
+	POP DE
+L3202:
+	POP BC
+L3203:
+	POP DE
+L3204:
+	PUSH XHL
+L3205:
+	POP XHL
+L3206:
+	PUSH XHL
+L3207:
+	POP IY
+L3208:
+	PUSH XBC
+L3209:
+	PUSH XDE
+L3210:
+	POP HL
+L3211:
+	PUSH XIZ
+L3212:
+	POP XWA
+L3213:
+	PUSH XIX
+L3214:
+	POP XIZ
+L3215:
+	PUSH XIY
+L3216:
+	PUSH XBC
+L3217:
+	PUSH XWA
+L3218:
+	POP WA
+L3219:
+	POP XDE
+L3220:
+	POP DE
+L3221:
+	POP BC
+L3222:
+	PUSH XIX
+L3223:
+	PUSH XDE
+L3224:
+	POP XIX
+L3225:
+	POP HL
+L3226:
+	POP XWA
+L3227:
+	PUSH WA
+L3228:
+	PUSH IY
+L3229:
+	POP IX
+L3230:
+	POP WA
+L3231:
+	POP DE
+L3232:
+	PUSH XIZ
+L3233:
+	PUSH XIZ
+L3234:
+	POP XHL
+L3235:
+	PUSH XHL
+L3236:
+	PUSH XDE
+L3237:
+	POP IX
+L3238:
+	POP HL
+L3239:
+	POP BC
+L3240:
+	PUSH DE
+L3241:
+	PUSH BC
+L3242:
+	PUSH XBC
+L3243:
+	POP WA
+L3244:
+	PUSH IZ
+L3245:
+	POP XIX
+L3246:
+	PUSH BC
+L3247:
+	POP XWA
+L3248:
+	PUSH WA
+L3249:
+	POP BC
+L3250:
+	PUSH IZ
+L3251:
+	PUSH XHL
+L3252:
+	PUSH IY
+L3253:
+	PUSH XIX
+L3254:
+	PUSH XBC
+L3255:
+	POP XIX
+L3256:
+	POP WA
+L3257:
+	PUSH IY
+L3258:
+	PUSH IY
+L3259:
+	PUSH IY
+L3260:
+	PUSH DE
+L3261:
+	PUSH XDE
+L3262:
+	PUSH WA
+L3263:
+	PUSH XBC
+L3264:
+	POP XIZ
+L3265:
+	POP XHL
+L3266:
+	PUSH XIX
+L3267:
+	POP XIX
+L3268:
+	PUSH DE
+L3269:
+	PUSH XIY
+L3270:
+	POP IY
+L3271:
+	PUSH BC
+L3272:
+	PUSH IX
+L3273:
+	PUSH DE
+L3274:
+	POP IZ
+L3275:
+	POP XDE
+L3276:
+	POP XWA
+L3277:
+	PUSH XHL
+L3278:
+	PUSH IY
+L3279:
+	PUSH HL
+L3280:
+	PUSH XHL
+L3281:
+	PUSH HL
+L3282:
+	POP XIX
+L3283:
+	PUSH DE
+L3284:
+	PUSH XIY
+L3285:
+	PUSH IY
+L3286:
+	PUSH XIY
+L3287:
+	PUSH XIY
+L3288:
+	POP XIX
+L3289:
+	PUSH XBC
+L3290:
+	POP XDE
+L3291:
+	POP XWA
+L3292:
+	POP XDE
+L3293:
+	PUSH XHL
+L3294:
+	POP XDE
+L3295:
+	PUSH HL
+L3296:
+	PUSH XIX
+L3297:
+	POP HL
+L3298:
+	PUSH XHL
+L3299:
+	POP WA
+L3300:
+	POP XBC
+L3301:
+	PUSH XWA
+L3302:
+	PUSH XIZ
+L3303:
+	PUSH IZ
+L3304:
+	PUSH DE
+L3305:
+	POP XIZ
+L3306:
+	POP XIZ
+L3307:
+	PUSH XWA
+L3308:
+	PUSH BC
+L3309:
+	POP XHL
+L3310:
+	PUSH XDE
+L3311:
+	POP XWA
+L3312:
+	POP XBC
+L3313:
+	PUSH XIY
+L3314:
+	PUSH XHL
+L3315:
+	PUSH IY
+L3316:
+	POP IX
+L3317:
+	PUSH IX
+L3318:
+	PUSH BC
+L3319:
+	PUSH XWA
+L3320:
+	POP IX
+L3321:
+	POP XIX
+L3322:
+	POP XIY
+L3323:
+	POP IZ
+L3324:
+	POP XIZ
+L3325:
+	POP DE
+L3326:
+	PUSH XWA
+L3327:
+	PUSH XIZ
+L3328:
+	POP XDE
+L3329:
+	POP XHL
+L3330:
+	POP IX
+L3331:
+	PUSH DE
+L3332:
+	POP WA
+L3333:
+	POP WA
+L3334:
+	POP XDE
+L3335:
+	POP HL
+L3336:
+	PUSH XBC
+L3337:
+	PUSH XWA
+L3338:
+	PUSH XBC
+L3339:
+	POP HL
+L3340:
+	PUSH XHL
+L3341:
+	PUSH HL
+L3342:
+	POP XHL
+L3343:
+	PUSH XBC
+L3344:
+	PUSH WA
+L3345:
+	PUSH XIX
+L3346:
+	POP BC
+L3347:
+	POP IX
+L3348:
+	POP XIY
+L3349:
+	POP XHL
+L3350:
+	PUSH XWA
+L3351:
+	PUSH WA
+L3352:
+	POP XDE
+L3353:
+	PUSH IZ
+L3354:
+	POP XDE
+L3355:
+	PUSH BC
+L3356:
+	PUSH IX
+L3357:
+	PUSH DE
+L3358:
+	PUSH WA
+L3359:
+	PUSH DE
+L3360:
+	PUSH IY
+L3361:
+	PUSH IY
+L3362:
+	PUSH IY
+L3363:
+	PUSH XIX
+L3364:
+	PUSH BC
+L3365:
+	PUSH XIY
+L3366:
+	POP IZ
+L3367:
+	POP XIZ
+L3368:
+	PUSH DE
+L3369:
+	POP IZ
+L3370:
+	POP WA
+L3371:
+	PUSH DE
+L3372:
+	PUSH IZ
+L3373:
+	PUSH IY
+L3374:
+	POP WA
+L3375:
+	PUSH BC
+L3376:
+	POP XIZ
+L3377:
+	PUSH XHL
+L3378:
+	PUSH XDE
+L3379:
+	PUSH XIX
+L3380:
+	PUSH IX
+L3381:
+	POP BC
+L3382:
+	PUSH XBC
+L3383:
+	POP IX
+L3384:
+	POP WA
+L3385:
+	PUSH DE
+L3386:
+	POP XIX
+L3387:
+	PUSH BC
+L3388:
+	PUSH BC
+L3389:
+	POP IZ
+L3390:
+	PUSH XHL
+L3391:
+	POP XWA
+L3392:
+	POP XDE
+L3393:
+	POP XHL
+L3394:
+	PUSH XDE
+L3395:
+	PUSH WA
+L3396:
+	POP WA
+L3397:
+	PUSH XIZ
+L3398:
+	PUSH XIZ
+L3399:
+	POP IX
+L3400:
+	PUSH HL
+L3401:
+	PUSH BC
+L3402:
+	POP DE
+L3403:
+	PUSH IZ
+L3404:
+	PUSH BC
+L3405:
+	POP IZ
+L3406:
+	PUSH XHL
+L3407:
+	POP IX
+L3408:
+	PUSH XIY
+L3409:
+	POP BC
+L3410:
+	POP IZ
+L3411:
+	PUSH XHL
+L3412:
+	PUSH XIY
+L3413:
+	POP XWA
+L3414:
+	POP XBC
+L3415:
+	PUSH XBC
+L3416:
+	PUSH IY
+L3417:
+	POP DE
+L3418:
+	POP XDE
+L3419:
+	PUSH XIY
+L3420:
+	POP HL
+L3421:
+	PUSH HL
+L3422:
+	POP IZ
+L3423:
+	POP XBC
+L3424:
+	POP HL
+L3425:
+	PUSH HL
+L3426:
+	PUSH XIX
+L3427:
+	PUSH DE
+L3428:
+	POP IY
+L3429:
+	PUSH XIY
+L3430:
+	PUSH XWA
+L3431:
+	PUSH XIX
+L3432:
+	PUSH XIZ
+L3433:
+	PUSH XIZ
+L3434:
+	POP IY
+L3435:
+	POP XIX
+L3436:
+	PUSH BC
+L3437:
+	PUSH HL
+L3438:
+	POP WA
+L3439:
+	PUSH XIZ
+L3440:
+	POP DE
+L3441:
+	POP DE
+L3442:
+	POP XHL
+L3443:
+	POP BC
+L3444:
+	POP XHL
+L3445:
+	PUSH IZ
+L3446:
+	POP XIZ
+L3447:
+	POP XHL
+L3448:
+	PUSH BC
+L3449:
+	POP IZ
+L3450:
+	POP XDE
+L3451:
+	PUSH XIX
+L3452:
+	POP HL
+L3453:
+	POP XIY
+L3454:
+	POP XWA
+L3455:
+	POP IX
+L3456:
+	PUSH HL
+L3457:
+	POP XHL
+L3458:
+	PUSH HL
+L3459:
+	POP XHL
+L3460:
+	POP WA
+L3461:
+	PUSH XIX
+L3462:
+	PUSH IX
+L3463:
+	PUSH XIY
+L3464:
+	PUSH XHL
+L3465:
+	POP XBC
+L3466:
+	POP XIZ
+L3467:
+	POP XDE
+L3468:
+	PUSH XBC
+L3469:
+	POP XWA
+L3470:
+	PUSH XIY
+L3471:
+	PUSH XIZ
+L3472:
+	POP IZ
+L3473:
+	POP IY
+L3474:
+	PUSH XIY
+L3475:
+	POP HL
+L3476:
+	PUSH XIZ
+L3477:
+	POP IY
+L3478:
+	POP WA
+L3479:
+	PUSH XIY
+L3480:
+	PUSH IZ
+L3481:
+	PUSH XWA
+L3482:
+	POP XHL
+L3483:
+	PUSH IX
+L3484:
+	PUSH XBC
+L3485:
+	PUSH XWA
+L3486:
+	POP WA
+L3487:
+	POP XHL
+L3488:
+	POP BC
+L3489:
+	POP XBC
+L3490:
+	POP WA
+L3491:
+	POP XBC
+L3492:
+	PUSH IZ
+L3493:
+	PUSH XIZ
+L3494:
+	POP XIX
+L3495:
+	PUSH XWA
+L3496:
+	POP XIY
+L3497:
+	POP XIX
+L3498:
+	POP XBC
+L3499:
+	PUSH XDE
+L3500:
+	PUSH XHL
+L3501:
+	PUSH XDE
+L3502:
+	PUSH XIY
+L3503:
+	POP IZ
+L3504:
+	POP XIX
+L3505:
+	PUSH XBC
+L3506:
+	PUSH XWA
+L3507:
+	POP XBC
+L3508:
+	POP XDE
+L3509:
+	PUSH XIY
+L3510:
+	POP BC
+L3511:
+	PUSH IX
+L3512:
+	POP XIY
+L3513:
+	POP XIX
+L3514:
+	POP XWA
+L3515:
+	PUSH XBC
+L3516:
+	POP XIX
+L3517:
+	POP XIY
+L3518:
+	PUSH XIX
+L3519:
+	POP XBC
+L3520:
+	PUSH XIX
+L3521:
+	PUSH XIY
+L3522:
+	PUSH XIX
+L3523:
+	PUSH XWA
+L3524:
+	POP XIX
+L3525:
+	POP BC
+L3526:
+	PUSH DE
+L3527:
+	POP WA
+L3528:
+	POP XHL
+L3529:
+	PUSH DE
+L3530:
+	POP DE
+L3531:
+	POP XHL
+L3532:
+	POP DE
+L3533:
+	PUSH XIX
+L3534:
+	POP XHL
+L3535:
+	POP HL
+L3536:
+	POP DE
+L3537:
+	PUSH HL
+L3538:
+	PUSH IZ
+L3539:
+	POP DE
+L3540:
+	PUSH DE
+L3541:
+	POP XDE
+L3542:
+	PUSH XIX
+L3543:
+	PUSH IY
+L3544:
+	PUSH WA
+L3545:
+	POP DE
+L3546:
+	POP WA
+L3547:
+	POP XDE
+L3548:
+	POP XIZ
+L3549:
+	PUSH IY
+L3550:
+	PUSH XIY
+L3551:
+	POP IY
+L3552:
+	POP BC
+L3553:
+	POP XIY
+L3554:
+	PUSH XIZ
+L3555:
+	PUSH XIX
+L3556:
+	PUSH XBC
+L3557:
+	PUSH XIY
+L3558:
+	PUSH XHL
+L3559:
+	PUSH XIY
+L3560:
+	PUSH XIY
+L3561:
+	POP XDE
+L3562:
+	PUSH XBC
+L3563:
+	POP XIZ
+L3564:
+	PUSH IZ
+L3565:
+	POP IX
+L3566:
+	PUSH BC
+L3567:
+	PUSH XIX
+L3568:
+	PUSH WA
+L3569:
+	POP XIZ
+L3570:
+	POP IX
+L3571:
+	PUSH DE
+L3572:
+	POP XIX
+L3573:
+	PUSH XIX
+L3574:
+	PUSH DE
+L3575:
+	POP XBC
+L3576:
+	PUSH XBC
+L3577:
+	POP XIZ
+L3578:
+	POP IY
+L3579:
+	PUSH BC
+L3580:
+	POP WA
+L3581:
+	POP HL
+L3582:
+	PUSH IY
+L3583:
+	POP XIZ
+L3584:
+	POP IX
+L3585:
+	PUSH XHL
+L3586:
+	POP XIY
+L3587:
+	POP HL
+L3588:
+	PUSH XIZ
+L3589:
+	POP WA
+L3590:
+	POP IX
+L3591:
+	POP IX
+L3592:
+	POP XBC
+L3593:
+	PUSH IX
+L3594:
+	POP XIY
+L3595:
+	POP XIX
+L3596:
+	POP XBC
+L3597:
+	PUSH XIZ
+L3598:
+	POP BC
+L3599:
+	POP XBC
+L3600:
+	PUSH XWA
+L3601:
+	PUSH IZ
+L3602:
+	POP XBC
+L3603:
+	POP XBC
+L3604:
+	PUSH XWA
+L3605:
+	POP XIY
+L3606:
+	POP XIX
+L3607:
+	POP XWA
+L3608:
+	PUSH WA
+L3609:
+	PUSH XIY
+L3610:
+	PUSH XIX
+L3611:
+	PUSH WA
+L3612:
+	POP XIY
+L3613:
+	POP XBC
+L3614:
+	PUSH DE
+L3615:
+	PUSH HL
+L3616:
+	POP XDE
+L3617:
+	PUSH XBC
+L3618:
+	PUSH DE
+L3619:
+	POP DE
+L3620:
+	POP XIZ
+L3621:
+	PUSH XIY
+L3622:
+	POP XWA
+L3623:
+	PUSH WA
+L3624:
+	POP IY
+L3625:
+	POP DE
+L3626:
+	POP HL
+L3627:
+	PUSH DE
+L3628:
+	POP DE
+L3629:
+	POP DE
+L3630:
+	POP IX
+L3631:
+	POP DE
+L3632:
+	PUSH WA
+L3633:
+	POP HL
+L3634:
+	PUSH HL
+L3635:
+	POP IZ
+L3636:
+	PUSH IZ
+L3637:
+	POP XIZ
+L3638:
+	POP XIZ
+L3639:
+	POP HL
+L3640:
+	PUSH XWA
+L3641:
+	PUSH IX
+L3642:
+	POP IZ
+L3643:
+	PUSH XIZ
+L3644:
+	PUSH XDE
+L3645:
+	POP XDE
+L3646:
+	PUSH BC
+L3647:
+	POP XHL
+L3648:
+	PUSH XHL
+L3649:
+	PUSH WA
+L3650:
+	PUSH IX
+L3651:
+	PUSH IY
+L3652:
+	PUSH DE
+L3653:
+	PUSH XBC
+L3654:
+	POP XHL
+L3655:
+	PUSH XIY
+L3656:
+	PUSH XIX
+L3657:
+	POP IY
+L3658:
+	POP WA
+L3659:
+	PUSH IX
+L3660:
+	POP XWA
+L3661:
+	POP WA
+L3662:
+	POP BC
+L3663:
+	PUSH WA
+L3664:
+	POP IY
+L3665:
+	POP XHL
+L3666:
+	PUSH XIZ
+L3667:
+	PUSH WA
+L3668:
+	PUSH DE
+L3669:
+	PUSH XDE
+L3670:
+	POP IZ
+L3671:
+	PUSH XWA
+L3672:
+	PUSH HL
+L3673:
+	POP BC
+L3674:
+	POP XIZ
+L3675:
+	PUSH DE
+L3676:
+	POP XIY
+L3677:
+	PUSH XDE
+L3678:
+	PUSH XWA
+L3679:
+	POP DE
+L3680:
+	PUSH XIX
+L3681:
+	POP BC
+L3682:
+	POP XBC
+L3683:
+	PUSH BC
+L3684:
+	PUSH IZ
+L3685:
+	POP XWA
+L3686:
+	POP IZ
+L3687:
+	PUSH XDE
+L3688:
+	PUSH XIZ
+L3689:
+	POP XIY
+L3690:
+	POP IZ
+L3691:
+	POP IY
+L3692:
+	PUSH XIY
+L3693:
+	POP XDE
+L3694:
+	PUSH XIZ
+L3695:
+	PUSH IZ
+L3696:
+	POP WA
+L3697:
+	POP DE
+L3698:
+	POP XDE
+L3699:
+	PUSH XDE
+L3700:
+	PUSH HL
+L3701:
+	POP IY
+L3702:
+	POP XIZ
+L3703:
+	PUSH IZ
+L3704:
+	POP XBC
+L3705:
+	PUSH BC
+L3706:
+	POP XDE
+L3707:
+	POP XWA
+L3708:
+	PUSH HL
+L3709:
+	PUSH IZ
+L3710:
+	PUSH IY
+L3711:
+	PUSH XIX
+L3712:
+	POP XIY
+L3713:
+	PUSH BC
+L3714:
+	PUSH IY
+L3715:
+	POP XBC
+L3716:
+	PUSH XDE
+L3717:
+	POP IY
+L3718:
+	PUSH XIX
+L3719:
+	PUSH IZ
+L3720:
+	POP XDE
+L3721:
+	POP XHL
+L3722:
+	PUSH XBC
+L3723:
+	POP XIX
+L3724:
+	PUSH XWA
+L3725:
+	PUSH HL
+L3726:
+	POP XHL
+L3727:
+	PUSH IX
+L3728:
+	POP XHL
+L3729:
+	POP DE
+L3730:
+	PUSH XDE
+L3731:
+	PUSH WA
+L3732:
+	PUSH XHL
+L3733:
+	PUSH XHL
+L3734:
+	PUSH WA
+L3735:
+	PUSH HL
+L3736:
+	POP XWA
+L3737:
+	PUSH WA
+L3738:
+	POP XIZ
+L3739:
+	POP HL
+L3740:
+	POP XIZ
+L3741:
+	POP XIX
+L3742:
+	PUSH XWA
+L3743:
+	PUSH DE
+L3744:
+	PUSH WA
+L3745:
+	POP IZ
+L3746:
+	PUSH IY
+L3747:
+	POP BC
+L3748:
+	POP XIZ
+L3749:
+	POP IY
+L3750:
+	PUSH XWA
+L3751:
+	PUSH XHL
+L3752:
+	POP XIY
+L3753:
+	PUSH XHL
+L3754:
+	PUSH BC
+L3755:
+	PUSH XHL
+L3756:
+	POP IX
+L3757:
+	POP XIX
+L3758:
+	PUSH XIY
+L3759:
+	PUSH XIX
+L3760:
+	PUSH IX
+L3761:
+	PUSH XIZ
+L3762:
+	POP XIY
+L3763:
+	PUSH XDE
+L3764:
+	PUSH DE
+L3765:
+	POP XBC
+L3766:
+	PUSH HL
+L3767:
+	PUSH DE
+L3768:
+	PUSH XHL
+L3769:
+	PUSH XIY
+L3770:
+	POP XDE
+L3771:
+	PUSH HL
+L3772:
+	POP XDE
+L3773:
+	POP IY
+L3774:
+	POP DE
+L3775:
+	POP XDE
+L3776:
+	PUSH XBC
+L3777:
+	PUSH IY
+L3778:
+	PUSH IX
+L3779:
+	PUSH IX
+L3780:
+	POP IZ
+L3781:
+	PUSH HL
+L3782:
+	PUSH BC
+L3783:
+	POP XIY
+L3784:
+	PUSH IZ
+L3785:
+	PUSH DE
+L3786:
+	POP XDE
+L3787:
+	POP DE
+L3788:
+	POP XIX
+L3789:
+	PUSH IX
+L3790:
+	PUSH HL
+L3791:
+	POP XIY
+L3792:
+	PUSH XWA
+L3793:
+	POP BC
+L3794:
+	POP XBC
+L3795:
+	POP HL
+L3796:
+	POP XWA
+L3797:
+	PUSH IZ
+L3798:
+	POP XBC
+L3799:
+	POP IY
+L3800:
+	POP XDE
+L3801:
+	POP XBC
+L3802:
+	POP IX
+L3803:
+	PUSH IZ
+L3804:
+	POP IY
+L3805:
+	POP XDE
+L3806:
+	POP IZ
+L3807:
+	PUSH HL
+L3808:
+	PUSH IZ
+L3809:
+	PUSH DE
+L3810:
+	POP IY
+L3811:
+	POP XBC
+L3812:
+	PUSH XDE
+L3813:
+	PUSH BC
+L3814:
+	POP XHL
+L3815:
+	PUSH XBC
+L3816:
+	PUSH IZ
+L3817:
+	PUSH DE
+L3818:
+	POP XIX
+L3819:
+	POP IY
+L3820:
+	POP XIZ
+L3821:
+	PUSH DE
+L3822:
+	POP XDE
+L3823:
+	POP XIX
+L3824:
+	POP HL
+L3825:
+	POP HL
+L3826:
+	POP XDE
+L3827:
+	POP XHL
+L3828:
+	PUSH IX
+L3829:
+	PUSH XIZ
+L3830:
+	POP XWA
+L3831:
+	PUSH XDE
+L3832:
+	PUSH XDE
+L3833:
+	PUSH IY
+L3834:
+	PUSH IX
+L3835:
+	POP XIZ
+L3836:
+	PUSH XDE
+L3837:
+	PUSH XBC
+L3838:
+	PUSH BC
+L3839:
+	POP XWA
+L3840:
+	PUSH HL
+L3841:
+	PUSH XIY
+L3842:
+	PUSH XWA
+L3843:
+	POP XHL
+L3844:
+	PUSH XIZ
+L3845:
+	PUSH XHL
+L3846:
+	PUSH WA
+L3847:
+	PUSH XIX
+L3848:
+	PUSH DE
+L3849:
+	POP XWA
+L3850:
+	POP XWA
+L3851:
+	POP HL
+L3852:
+	PUSH HL
+L3853:
+	PUSH IX
+L3854:
+	PUSH IZ
+L3855:
+	POP XDE
+L3856:
+	PUSH XDE
+L3857:
+	PUSH XIX
+L3858:
+	POP IX
+L3859:
+	POP XWA
+L3860:
+	PUSH XIY
+L3861:
+	PUSH IZ
+L3862:
+	PUSH WA
+L3863:
+	PUSH IX
+L3864:
+	PUSH XIZ
+L3865:
+	PUSH XDE
+L3866:
+	POP XIY
+L3867:
+	POP IX
+L3868:
+	PUSH XIZ
+L3869:
+	PUSH XIY
+L3870:
+	POP BC
+L3871:
+	POP XBC
+L3872:
+	POP XDE
+L3873:
+	POP XIZ
+L3874:
+	POP XDE
+L3875:
+	PUSH XBC
+L3876:
+	PUSH XWA
+L3877:
+	PUSH IZ
+L3878:
+	POP XIZ
+L3879:
+	PUSH XIX
+L3880:
+	PUSH XIZ
+L3881:
+	PUSH WA
+L3882:
+	PUSH HL
+L3883:
+	PUSH XIX
+L3884:
+	POP HL
+L3885:
+	POP XBC
+L3886:
+	PUSH XDE
+L3887:
+	POP XIY
+L3888:
+	POP DE
+L3889:
+	POP DE
+L3890:
+	POP IZ
+L3891:
+	POP WA
+L3892:
+	PUSH XHL
+L3893:
+	POP XIX
+L3894:
+	POP WA
+L3895:
+	POP XIX
+L3896:
+	POP XWA
+L3897:
+	PUSH IY
+L3898:
+	POP IY
+L3899:
+	PUSH HL
+L3900:
+	PUSH XHL
+L3901:
+	POP XWA
+L3902:
+	POP HL
+L3903:
+	PUSH XDE
+L3904:
+	PUSH BC
+L3905:
+	POP WA
+L3906:
+	PUSH XIY
+L3907:
+	PUSH XWA
+L3908:
+	PUSH IY
+L3909:
+	POP XWA
+L3910:
+	POP DE
+L3911:
+	POP XWA
+L3912:
+	PUSH IX
+L3913:
+	PUSH XIZ
+L3914:
+	PUSH XBC
+L3915:
+	PUSH IX
+L3916:
+	POP IX
+L3917:
+	PUSH XBC
+L3918:
+	PUSH XIX
+L3919:
+	POP IX
+L3920:
+	PUSH XHL
+L3921:
+	POP IY
+L3922:
+	PUSH XDE
+L3923:
+	PUSH XIZ
+L3924:
+	POP BC
+L3925:
+	POP IY
+L3926:
+	POP XBC
+L3927:
+	PUSH IZ
+L3928:
+	PUSH IY
+L3929:
+	PUSH XBC
+L3930:
+	PUSH XBC
+L3931:
+	PUSH XDE
+L3932:
+	POP IX
+L3933:
+	POP XIY
+L3934:
+	POP XIX
+L3935:
+	PUSH IX
+L3936:
+	PUSH XIX
+L3937:
+	PUSH XIY
+L3938:
+	POP IY
+L3939:
+	POP XHL
+L3940:
+	POP DE
+L3941:
+	POP XIZ
+L3942:
+	PUSH XWA
+L3943:
+	PUSH IZ
+L3944:
+	PUSH IX
+L3945:
+	PUSH IZ
+L3946:
+	POP XIX
+L3947:
+	POP XHL
+L3948:
+	PUSH WA
+L3949:
+	POP IX
+L3950:
+	POP XHL
+L3951:
+	POP IZ
+L3952:
+	PUSH XIY
+L3953:
+	PUSH XWA
+L3954:
+	PUSH WA
+L3955:
+	PUSH DE
+L3956:
+	PUSH XIX
+L3957:
+	POP XIZ
+L3958:
+	PUSH XIX
+L3959:
+	PUSH XBC
+L3960:
+	POP XIY
+L3961:
+	PUSH WA
+L3962:
+	PUSH XHL
+L3963:
+	POP XIY
+L3964:
+	PUSH IY
+L3965:
+	POP XHL
+L3966:
+	POP IZ
+L3967:
+	POP IX
+L3968:
+	PUSH XIY
+L3969:
+	POP IZ
+L3970:
+	POP XIZ
+L3971:
+	PUSH IZ
+L3972:
+	PUSH XDE
+L3973:
+	PUSH XHL
+L3974:
+	PUSH XHL
+L3975:
+	PUSH XDE
+L3976:
+	POP HL
+L3977:
+	POP BC
+L3978:
+	PUSH HL
+L3979:
+	POP IZ
+L3980:
+	POP HL
+L3981:
+	POP XBC
+L3982:
+	PUSH IZ
+L3983:
+	POP XDE
+L3984:
+	POP HL
+L3985:
+	POP XIY
+L3986:
+	PUSH DE
+L3987:
+	PUSH XIX
+L3988:
+	POP XIY
+L3989:
+	POP IY
+L3990:
+	PUSH XIZ
+L3991:
+	PUSH DE
+L3992:
+	POP XIX
+L3993:
+	PUSH XIZ
+L3994:
+	PUSH WA
+L3995:
+	POP XBC
+L3996:
+	POP BC
+L3997:
+	PUSH DE
+L3998:
+	POP XIX
+L3999:
+	POP XDE
+L4000:
+	PUSH XHL
+L4001:
+	POP DE
+L4002:
+	POP XBC
+L4003:
+	PUSH IY
+L4004:
+	POP XWA
+L4005:
+	POP IZ
+L4006:
+	PUSH XHL
+L4007:
+	POP IX
+L4008:
+	POP XBC
+L4009:
+	PUSH DE
+L4010:
+	PUSH BC
+L4011:
+	PUSH XDE
+L4012:
+	PUSH XHL
+L4013:
+	POP WA
+L4014:
+	POP XWA
+L4015:
+	POP HL
+L4016:
+	PUSH HL
+L4017:
+	PUSH XIY
+L4018:
+	PUSH XDE
+L4019:
+	POP WA
+L4020:
+	POP XWA
+L4021:
+	PUSH XDE
+L4022:
+	PUSH XBC
+L4023:
+	PUSH XIZ
+L4024:
+	PUSH XDE
+L4025:
+	PUSH XBC
+L4026:
+	PUSH XBC
+L4027:
+	PUSH XBC
+L4028:
+	POP IX
+L4029:
+	PUSH WA
+L4030:
+	PUSH BC
+L4031:
+	POP XWA
+L4032:
+	POP XIZ
+L4033:
+	PUSH XIZ
+L4034:
+	POP XIZ
+L4035:
+	POP XIX
+L4036:
+	POP HL
+L4037:
+	POP XWA
+L4038:
+	POP WA
+L4039:
+	POP IZ
+L4040:
+	PUSH DE
+L4041:
+	PUSH IY
+L4042:
+	POP DE
+L4043:
+	PUSH XIZ
+L4044:
+	POP IZ
+L4045:
+	POP XDE
+L4046:
+	POP XHL
+L4047:
+	PUSH XWA
+L4048:
+	PUSH IY
+L4049:
+	POP IY
+L4050:
+	PUSH XIZ
+L4051:
+	POP XIZ
+L4052:
+	POP HL
+L4053:
+	PUSH IZ
+L4054:
+	PUSH IZ
+L4055:
+	POP XHL
+L4056:
+	PUSH WA
+L4057:
+	PUSH XIZ
+L4058:
+	PUSH IZ
+L4059:
+	PUSH XIY
+L4060:
+	POP HL
+L4061:
+	PUSH WA
+L4062:
+	POP XWA
+L4063:
+	POP XHL
+L4064:
+	PUSH IZ
+L4065:
+	PUSH IY
+L4066:
+	PUSH BC
+L4067:
+	PUSH WA
+L4068:
+	PUSH XHL
+L4069:
+	PUSH XIZ
+L4070:
+	POP XDE
+L4071:
+	PUSH BC
+L4072:
+	PUSH WA
+L4073:
+	PUSH XWA
+L4074:
+	PUSH HL
+L4075:
+	PUSH HL
+L4076:
+	POP XHL
+L4077:
+	PUSH HL
+L4078:
+	POP IY
+L4079:
+	POP IY
+L4080:
+	POP WA
+L4081:
+	PUSH XHL
+L4082:
+	POP XIY
+L4083:
+	POP IY
+L4084:
+	POP XHL
+L4085:
+	PUSH BC
+L4086:
+	PUSH IX
+L4087:
+	POP XIX
+L4088:
+	POP WA
+L4089:
+	POP IZ
+L4090:
+	POP IZ
+L4091:
+	POP XHL
+L4092:
+	PUSH IZ
+L4093:
+	PUSH WA
+L4094:
+	POP XIX
+L4095:
+	POP DE
+L4096:
+	PUSH XHL
+L4097:
+	POP XDE
+L4098:
+	PUSH IX
+L4099:
+	PUSH XBC
+L4100:
+	PUSH IY
+L4101:
+	POP BC
+L4102:
+	PUSH IX
+L4103:
+	POP XDE
+L4104:
+	POP XBC
+L4105:
+	POP IY
+L4106:
+	PUSH XDE
+L4107:
+	POP XIZ
+L4108:
+	POP IZ
+L4109:
+	POP BC
+L4110:
+	POP XWA
+L4111:
+	PUSH XDE
+L4112:
+	PUSH XDE
+L4113:
+	PUSH HL
+L4114:
+	POP XHL
+L4115:
+	PUSH IZ
+L4116:
+	POP BC
+L4117:
+	POP XWA
+L4118:
+	POP IX
+L4119:
+	POP WA
+L4120:
+	POP DE
+L4121:
+	PUSH IY
+L4122:
+	PUSH HL
+L4123:
+	POP XBC
+L4124:
+	POP IZ
+L4125:
+	PUSH XIX
+L4126:
+	PUSH IX
+L4127:
+	PUSH IZ
+L4128:
+	POP IX
+L4129:
+	PUSH WA
+L4130:
+	PUSH XIX
+L4131:
+	PUSH IY
+L4132:
+	POP HL
+L4133:
+	POP XWA
+L4134:
+	PUSH XWA
+L4135:
+	POP IX
+L4136:
+	POP XDE
+L4137:
+	PUSH IY
+L4138:
+	PUSH XHL
+L4139:
+	PUSH IZ
+L4140:
+	POP WA
+L4141:
+	POP XIZ
+L4142:
+	PUSH XBC
+L4143:
+	PUSH BC
+L4144:
+	PUSH IZ
+L4145:
+	POP XDE
+L4146:
+	PUSH XHL
+L4147:
+	PUSH XBC
+L4148:
+	PUSH IX
+L4149:
+	POP HL
+L4150:
+	POP XBC
+L4151:
+	PUSH IY
+L4152:
+	PUSH IX
+L4153:
+	POP XWA
+L4154:
+	PUSH XBC
+L4155:
+	PUSH WA
+L4156:
+	PUSH XIX
+L4157:
+	POP XHL
+L4158:
+	POP BC
+L4159:
+	PUSH IZ
+L4160:
+	POP XIZ
+L4161:
+	POP HL
+L4162:
+	PUSH XIX
+L4163:
+	PUSH XDE
+L4164:
+	POP BC
+L4165:
+	POP IY
+L4166:
+	POP XDE
+L4167:
+	POP XHL
+L4168:
+	PUSH WA
+L4169:
+	POP XHL
+L4170:
+	POP IZ
+L4171:
+	POP XIY
+L4172:
+	PUSH IZ
+L4173:
+	POP XBC
+L4174:
+	POP DE
+L4175:
+	POP IZ
+L4176:
+	POP XIY
+L4177:
+	PUSH IZ
+L4178:
+	POP XDE
+L4179:
+	POP BC
+L4180:
+	PUSH HL
+L4181:
+	POP DE
+L4182:
+	PUSH IY
+L4183:
+	POP WA
+L4184:
+	POP DE
+L4185:
+	PUSH DE
+L4186:
+	POP XIX
+L4187:
+	POP XIZ
+L4188:
+	PUSH HL
+L4189:
+	POP XIX
+L4190:
+	PUSH XHL
+L4191:
+	PUSH XIZ
+L4192:
+	POP WA
+L4193:
+	PUSH WA
+L4194:
+	POP XBC
+L4195:
+	POP XHL
+L4196:
+	POP IX
+L4197:
+	PUSH XDE
+L4198:
+	POP WA
+L4199:
+	POP DE
+L4200:
+	PUSH HL
+L4201:
+	PUSH XIX
+L4202:
+	PUSH XBC
+L4203:
+	PUSH IX
+L4204:
+	POP XBC
+L4205:
+	POP IZ
+L4206:
+	POP XBC
+L4207:
+	PUSH HL
+L4208:
+	PUSH IX
+L4209:
+	POP IZ
+L4210:
+	PUSH WA
+L4211:
+	POP XIY
+L4212:
+	POP XBC
+L4213:
+	POP XHL
+L4214:
+	PUSH HL
+L4215:
+	POP XHL
+L4216:
+	POP XIX
+L4217:
+	PUSH WA
+L4218:
+	PUSH IX
+L4219:
+	POP XIX
+L4220:
+	PUSH WA
+L4221:
+	POP XHL
+L4222:
+	PUSH XIZ
+L4223:
+	POP IX
+L4224:
+	POP XIY
+L4225:
+	PUSH XDE
+L4226:
+	POP XIY
+L4227:
+	PUSH BC
+L4228:
+	POP IY
+L4229:
+	POP DE
+L4230:
+	PUSH XDE
+L4231:
+	POP IX
+L4232:
+	PUSH WA
+L4233:
+	POP WA
+L4234:
+	PUSH HL
+L4235:
+	POP BC
+L4236:
+	POP DE
+L4237:
+	PUSH XIZ
+L4238:
+	POP WA
+L4239:
+	PUSH IY
+L4240:
+	POP IY
+L4241:
+	POP XHL
+L4242:
+	POP XBC
+L4243:
+	POP IY
+L4244:
+	POP XIX
+L4245:
+	PUSH DE
+L4246:
+	POP XDE
+L4247:
+	POP DE
+L4248:
+	PUSH XIX
+L4249:
+	PUSH DE
+L4250:
+	POP XDE
+L4251:
+	POP XDE
+L4252:
+	PUSH XWA
+L4253:
+	PUSH IX
+L4254:
+	POP IZ
+L4255:
+	PUSH HL
+L4256:
+	PUSH XHL
+L4257:
+	PUSH XBC
+L4258:
+	POP XIZ
+L4259:
+	POP IZ
+L4260:
+	PUSH IY
+L4261:
+	POP BC
+L4262:
+	POP IX
+L4263:
+	POP XIZ
+L4264:
+	PUSH IX
+L4265:
+	POP IX
+L4266:
+	PUSH XBC
+L4267:
+	PUSH DE
+L4268:
+	PUSH IX
+L4269:
+	POP XBC
+L4270:
+	POP IX
+L4271:
+	PUSH IX
+L4272:
+	PUSH HL
+L4273:
+	POP XWA
+L4274:
+	PUSH DE
+L4275:
+	POP WA
+L4276:
+	POP XIY
+L4277:
+	PUSH XDE
+L4278:
+	POP XHL
+L4279:
+	POP XIX
+L4280:
+	PUSH BC
+L4281:
+	PUSH XIX
+L4282:
+	POP XWA
+L4283:
+	POP IY
+L4284:
+	PUSH XDE
+L4285:
+	POP XWA
+L4286:
+	PUSH IZ
+L4287:
+	PUSH XDE
+L4288:
+	PUSH DE
+L4289:
+	PUSH XDE
+L4290:
+	POP HL
+L4291:
+	POP IY
+L4292:
+	PUSH XDE
+L4293:
+	POP XHL
+L4294:
+	POP HL
+L4295:
+	POP XHL
+L4296:
+	POP DE
+L4297:
+	PUSH IX
+L4298:
+	POP XWA
+L4299:
+	PUSH XDE
+L4300:
+	POP IX
+L4301:
+	PUSH XIZ
+L4302:
+	PUSH XHL
+L4303:
+	POP XIZ
+L4304:
+	POP XDE
+L4305:
+	PUSH HL
+L4306:
+	POP IZ
+L4307:
+	PUSH IY
+L4308:
+	PUSH IZ
+L4309:
+	PUSH HL
+L4310:
+	POP XDE
+L4311:
+	POP IY
+L4312:
+	PUSH XWA
+L4313:
+	PUSH XIZ
+L4314:
+	POP XIY
+L4315:
+	POP WA
+L4316:
+	PUSH DE
+L4317:
+	PUSH WA
+L4318:
+	POP WA
+L4319:
+	POP XWA
+L4320:
+	POP IX
+L4321:
+	POP HL
+L4322:
+	PUSH XIX
+L4323:
+	PUSH DE
+L4324:
+	POP BC
+L4325:
+	PUSH XIY
+L4326:
+	POP XIX
+L4327:
+	PUSH WA
+L4328:
+	POP BC
+L4329:
+	POP XDE
+L4330:
+	POP XHL
+L4331:
+	POP XBC
+L4332:
+	PUSH XWA
+L4333:
+	POP XHL
+L4334:
+	PUSH XIZ
+L4335:
+	PUSH HL
+L4336:
+	POP XDE
+L4337:
+	POP XWA
+L4338:
+	PUSH IZ
+L4339:
+	POP IZ
+L4340:
+	POP XDE
+L4341:
+	PUSH XHL
+L4342:
+	POP XIX
+L4343:
+	POP DE
+L4344:
+	POP BC
+L4345:
+	POP IX
+L4346:
+	PUSH XBC
+L4347:
+	PUSH XBC
+L4348:
+	PUSH XHL
+L4349:
+	POP XDE
+L4350:
+	PUSH WA
+L4351:
+	PUSH XWA
+L4352:
+	POP IY
+L4353:
+	POP XDE
+L4354:
+	PUSH XIX
+L4355:
+	POP IX
+L4356:
+	POP XBC
+L4357:
+	POP XDE
+L4358:
+	PUSH WA
+L4359:
+	PUSH BC
+L4360:
+	PUSH IZ
+L4361:
+	PUSH DE
+L4362:
+	POP IX
+L4363:
+	POP XWA
+L4364:
+	PUSH XDE
+L4365:
+	POP HL
+L4366:
+	POP XIX
+L4367:
+	POP XHL
+L4368:
+	POP IX
+L4369:
+	POP IZ
+L4370:
+	PUSH XIY
+L4371:
+	POP XBC
+L4372:
+	PUSH XHL
+L4373:
+	PUSH HL
+L4374:
+	POP XHL
+L4375:
+	POP XIY
+L4376:
+	POP BC
+L4377:
+	POP XIX
+L4378:
+	POP XHL
+L4379:
+	POP IY
+L4380:
+	POP XIX
+L4381:
+	POP XBC
+L4382:
+	POP XBC
+L4383:
+	PUSH XDE
+L4384:
+	POP XIY
+L4385:
+	POP BC
+L4386:
+	PUSH WA
+L4387:
+	PUSH IX
+L4388:
+	POP XIX
+L4389:
+	PUSH XHL
+L4390:
+	PUSH XWA
+L4391:
+	PUSH IY
+L4392:
+	PUSH IX
+L4393:
+	PUSH XHL
+L4394:
+	PUSH WA
+L4395:
+	POP XIZ
+L4396:
+	PUSH BC
+L4397:
+	PUSH XDE
+L4398:
+	PUSH IZ
+L4399:
+	POP XHL
+L4400:
+	POP XBC
+L4401:
+	PUSH IZ
+L4402:
+	POP IZ
+L4403:
+	POP BC
+L4404:
+	PUSH XDE
+L4405:
+	PUSH IZ
+L4406:
+	PUSH XIZ
+L4407:
+	PUSH DE
+L4408:
+	POP XWA
+L4409:
+	PUSH XIY
+L4410:
+	POP XWA
+L4411:
+	PUSH DE
+L4412:
+	POP XWA
+L4413:
+	POP IX
+L4414:
+	POP WA
+L4415:
+	POP XIX
+L4416:
+	POP XDE
+L4417:
+	PUSH HL
+L4418:
+	PUSH IY
+L4419:
+	PUSH IY
+L4420:
+	POP XIY
+L4421:
+	PUSH HL
+L4422:
+	PUSH IZ
+L4423:
+	PUSH XWA
+L4424:
+	POP XIY
+L4425:
+	POP XDE
+L4426:
+	POP WA
+L4427:
+	POP IZ
+L4428:
+	POP XWA
+L4429:
+	POP BC
+L4430:
+	PUSH BC
+L4431:
+	POP DE
+L4432:
+	PUSH XWA
+L4433:
+	POP IZ
+L4434:
+	PUSH XWA
+L4435:
+	PUSH HL
+L4436:
+	POP XWA
+L4437:
+	PUSH XIZ
+L4438:
+	PUSH DE
+L4439:
+	POP XIY
+L4440:
+	PUSH XDE
+L4441:
+	PUSH DE
+L4442:
+	PUSH XIY
+L4443:
+	PUSH XIY
+L4444:
+	POP XIZ
+L4445:
+	POP XIX
+L4446:
+	POP XBC
+L4447:
+	PUSH XDE
+L4448:
+	POP IZ
+L4449:
+	POP XWA
+L4450:
+	POP XHL
+L4451:
+	PUSH IY
+L4452:
+	POP XDE
+L4453:
+	POP XIZ
+L4454:
+	PUSH XIY
+L4455:
+	POP IX
+L4456:
+	PUSH XIZ
+L4457:
+	PUSH IZ
+L4458:
+	PUSH BC
+L4459:
+	PUSH XIZ
+L4460:
+	POP DE
+L4461:
+	POP BC
+L4462:
+	POP XIY
+L4463:
+	PUSH DE
+L4464:
+	PUSH BC
+L4465:
+	PUSH IX
+L4466:
+	PUSH XIZ
+L4467:
+	POP BC
+L4468:
+	POP WA
+L4469:
+	POP IX
+L4470:
+	POP XIY
+L4471:
+	POP IY
+L4472:
+	PUSH XWA
+L4473:
+	POP DE
+L4474:
+	POP XIX
+L4475:
+	PUSH WA
+L4476:
+	POP IZ
+L4477:
+	POP XDE
+L4478:
+	POP IY
+L4479:
+	PUSH XIY
+L4480:
+	POP BC
+L4481:
+	PUSH XWA
+L4482:
+	PUSH XIZ
+L4483:
+	POP XHL
+L4484:
+	PUSH BC
+L4485:
+	POP XIZ
+L4486:
+	POP XIY
+L4487:
+	PUSH XBC
+L4488:
+	POP BC
+L4489:
+	PUSH WA
+L4490:
+	PUSH XIX
+L4491:
+	PUSH IZ
+L4492:
+	POP XBC
+L4493:
+	PUSH IZ
+L4494:
+	POP XBC
+L4495:
+	PUSH XHL
+L4496:
+	POP XHL
+L4497:
+	PUSH XDE
+L4498:
+	PUSH IX
+L4499:
+	POP DE
+L4500:
+	PUSH XIZ
+L4501:
+	POP XIX
+L4502:
+	PUSH XIX
+L4503:
+	POP XBC
+L4504:
+	PUSH WA
+L4505:
+	PUSH IZ
+L4506:
+	POP BC
+L4507:
+	POP IY
+L4508:
+	PUSH IY
+L4509:
+	POP XIZ
+L4510:
+	POP DE
+L4511:
+	PUSH XDE
+L4512:
+	PUSH IY
+L4513:
+	PUSH XIY
+L4514:
+	PUSH XIY
+L4515:
+	PUSH XDE
+L4516:
+	PUSH XIY
+L4517:
+	POP BC
+L4518:
+	POP BC
+L4519:
+	POP XIX
+L4520:
+	PUSH IY
+L4521:
+	PUSH DE
+L4522:
+	POP XHL
+L4523:
+	POP BC
+L4524:
+	POP XIZ
+L4525:
+	POP IY
+L4526:
+	PUSH IX
+L4527:
+	POP XDE
+L4528:
+	POP XHL
+L4529:
+	PUSH XIY
+L4530:
+	PUSH XBC
+L4531:
+	POP HL
+L4532:
+	PUSH IY
+L4533:
+	PUSH XIZ
+L4534:
+	POP DE
+L4535:
+	POP BC
+L4536:
+	POP HL
+L4537:
+	PUSH IX
+L4538:
+	POP DE
+L4539:
+	PUSH WA
+L4540:
+	POP XBC
+L4541:
+	POP HL
+L4542:
+	PUSH XHL
+L4543:
+	PUSH IX
+L4544:
+	POP XHL
+L4545:
+	POP IZ
+L4546:
+	POP IX
+L4547:
+	PUSH XBC
+L4548:
+	POP WA
+L4549:
+	PUSH XIX
+L4550:
+	PUSH HL
+L4551:
+	PUSH WA
+L4552:
+	POP IX
+L4553:
+	POP XWA
+L4554:
+	PUSH HL
+L4555:
+	PUSH XIZ
+L4556:
+	POP XIY
+L4557:
+	POP HL
+L4558:
+	POP XBC
+L4559:
+	PUSH XBC
+L4560:
+	PUSH XWA
+L4561:
+	POP DE
+L4562:
+	PUSH DE
+L4563:
+	PUSH IZ
+L4564:
+	PUSH IZ
+L4565:
+	POP XDE
+L4566:
+	PUSH XIX
+L4567:
+	POP IX
+L4568:
+	PUSH XIX
+L4569:
+	PUSH HL
+L4570:
+	PUSH IZ
+L4571:
+	PUSH BC
+L4572:
+	PUSH XDE
+L4573:
+	POP XBC
+L4574:
+	PUSH XBC
+L4575:
+	POP XBC
+L4576:
+	PUSH WA
+L4577:
+	PUSH BC
+L4578:
+	POP IY
+L4579:
+	POP WA
+L4580:
+	POP XIX
+L4581:
+	PUSH WA
+L4582:
+	POP IZ
+L4583:
+	POP XIZ
+L4584:
+	PUSH XIZ
+L4585:
+	POP IX
+L4586:
+	POP DE
+L4587:
+	POP DE
+L4588:
+	POP IZ
+L4589:
+	PUSH BC
+L4590:
+	POP IX
+L4591:
+	POP IX
+L4592:
+	PUSH XIY
+L4593:
+	PUSH IZ
+L4594:
+	POP DE
+L4595:
+	PUSH XIX
+L4596:
+	POP XIY
+L4597:
+	PUSH XBC
+L4598:
+	PUSH WA
+L4599:
+	POP XIX
+L4600:
+	PUSH IX
+L4601:
+	POP XWA
+L4602:
+	POP WA
+L4603:
+	PUSH HL
+L4604:
+	POP IZ
+L4605:
+	POP XHL
+L4606:
+	PUSH IY
+L4607:
+	PUSH IY
+L4608:
+	POP XIZ
+L4609:
+	PUSH XIY
+L4610:
+	POP XDE
+L4611:
+	POP XHL
+L4612:
+	PUSH WA
+L4613:
+	POP XIY
+L4614:
+	POP XDE
+L4615:
+	PUSH XIZ
+L4616:
+	PUSH DE
+L4617:
+	PUSH WA
+L4618:
+	PUSH BC
+L4619:
+	POP IX
+L4620:
+	POP IY
+L4621:
+	POP XBC
+L4622:
+	PUSH WA
+L4623:
+	PUSH XWA
+L4624:
+	POP XWA
+L4625:
+	POP XIX
+L4626:
+	POP XDE
+L4627:
+	POP IX
+L4628:
+	PUSH XWA
+L4629:
+	POP XIZ
+L4630:
+	PUSH IZ
+L4631:
+	PUSH XIX
+L4632:
+	PUSH XHL
+L4633:
+	POP IX
+L4634:
+	PUSH XIX
+L4635:
+	POP HL
+L4636:
+	POP XIX
+L4637:
+	PUSH XDE
+L4638:
+	PUSH XWA
+L4639:
+	PUSH XDE
+L4640:
+	POP XBC
+L4641:
+	POP XIY
+L4642:
+	PUSH XDE
+L4643:
+	POP HL
+L4644:
+	PUSH WA
+L4645:
+	PUSH XHL
+L4646:
+	POP DE
+L4647:
+	POP DE
+L4648:
+	PUSH XWA
+L4649:
+	PUSH WA
+L4650:
+	POP IX
+L4651:
+	POP XDE
+L4652:
+	PUSH HL
+L4653:
+	PUSH XDE
+L4654:
+	POP DE
+L4655:
+	POP XDE
+L4656:
+	PUSH BC
+L4657:
+	POP IX
+L4658:
+	POP XHL
+L4659:
+	PUSH BC
+L4660:
+	PUSH IZ
+L4661:
+	PUSH XHL
+L4662:
+	POP XIX
+L4663:
+	POP IZ
+L4664:
+	PUSH XHL
+L4665:
+	PUSH XWA
+L4666:
+	PUSH XIY
+L4667:
+	PUSH IY
+L4668:
+	POP WA
+L4669:
+	POP XBC
+L4670:
+	PUSH DE
+L4671:
+	PUSH IX
+L4672:
+	PUSH HL
+L4673:
+	PUSH XIX
+L4674:
+	POP XIX
+L4675:
+	PUSH XIZ
+L4676:
+	POP XBC
+L4677:
+	POP XIZ
+L4678:
+	PUSH XIX
+L4679:
+	PUSH XHL
+L4680:
+	PUSH DE
+L4681:
+	PUSH XBC
+L4682:
+	POP HL
+L4683:
+	PUSH DE
+L4684:
+	POP XIX
+L4685:
+	POP IY
+L4686:
+	POP XIZ
+L4687:
+	PUSH XIX
+L4688:
+	POP XWA
+L4689:
+	POP WA
+L4690:
+	POP DE
+L4691:
+	POP WA
+L4692:
+	PUSH HL
+L4693:
+	PUSH XIX
+L4694:
+	PUSH IX
+L4695:
+	POP IZ
+L4696:
+	PUSH IZ
+L4697:
+	POP XIX
+L4698:
+	PUSH IX
+L4699:
+	POP IZ
+L4700:
+	POP BC
+L4701:
+	POP WA
+L4702:
+	PUSH XWA
+L4703:
+	POP IZ
+L4704:
+	PUSH XIX
+L4705:
+	POP IZ
+L4706:
+	PUSH IZ
+L4707:
+	POP XHL
+L4708:
+	PUSH WA
+L4709:
+	PUSH IZ
+L4710:
+	PUSH XBC
+L4711:
+	PUSH HL
+L4712:
+	PUSH BC
+L4713:
+	PUSH DE
+L4714:
+	PUSH BC
+L4715:
+	POP XIZ
+L4716:
+	PUSH WA
+L4717:
+	PUSH XHL
+L4718:
+	POP HL
+L4719:
+	PUSH XHL
+L4720:
+	PUSH XIX
+L4721:
+	POP XHL
+L4722:
+	PUSH IY
+L4723:
+	POP IX
+L4724:
+	POP XIY
+L4725:
+	PUSH WA
+L4726:
+	PUSH XIY
+L4727:
+	POP XIX
+L4728:
+	PUSH XWA
+L4729:
+	PUSH XWA
+L4730:
+	PUSH WA
+L4731:
+	POP IY
+L4732:
+	POP WA
+L4733:
+	PUSH IY
+L4734:
+	PUSH HL
+L4735:
+	PUSH XWA
+L4736:
+	POP XIZ
+L4737:
+	PUSH IZ
+L4738:
+	PUSH XHL
+L4739:
+	PUSH XHL
+L4740:
+	PUSH IX
+L4741:
+	PUSH XIY
+L4742:
+	PUSH XBC
+L4743:
+	POP XIZ
+L4744:
+	POP XIZ
+L4745:
+	PUSH WA
+L4746:
+	POP IX
+L4747:
+	POP IX
+L4748:
+	POP BC
+L4749:
+	PUSH IY
+L4750:
+	POP XHL
+L4751:
+	PUSH XIY
+L4752:
+	PUSH XHL
+L4753:
+	POP IZ
+L4754:
+	POP XDE
+L4755:
+	POP XIZ
+L4756:
+	PUSH XHL
+L4757:
+	PUSH DE
+L4758:
+	POP BC
+L4759:
+	PUSH HL
+L4760:
+	PUSH IY
+L4761:
+	POP DE
+L4762:
+	PUSH XHL
+L4763:
+	POP IX
+L4764:
+	PUSH WA
+L4765:
+	POP XDE
+L4766:
+	PUSH XBC
+L4767:
+	PUSH XHL
+L4768:
+	POP DE
+L4769:
+	POP XBC
+L4770:
+	PUSH IZ
+L4771:
+	POP DE
+L4772:
+	PUSH WA
+L4773:
+	PUSH XDE
+L4774:
+	POP DE
+L4775:
+	POP IZ
+L4776:
+	PUSH IX
+L4777:
+	PUSH HL
+L4778:
+	PUSH IZ
+L4779:
+	PUSH XIZ
+L4780:
+	PUSH XIZ
+L4781:
+	POP WA
+L4782:
+	PUSH IY
+L4783:
+	POP XIZ
+L4784:
+	POP XIZ
+L4785:
+	PUSH WA
+L4786:
+	POP XIY
+L4787:
+	POP XBC
+L4788:
+	PUSH XIZ
+L4789:
+	POP XDE
+L4790:
+	PUSH XBC
+L4791:
+	PUSH DE
+L4792:
+	POP IZ
+L4793:
+	POP XIZ
+L4794:
+	POP WA
+L4795:
+	PUSH XDE
+L4796:
+	POP XDE
+L4797:
+	PUSH XDE
+L4798:
+	POP IX
+L4799:
+	POP IZ
+L4800:
+	PUSH WA
+L4801:
+	POP XDE
+L4802:
+	PUSH XBC
+L4803:
+	POP DE
+L4804:
+	POP IZ
+L4805:
+	POP IX
+L4806:
+	POP XIX
+L4807:
+	POP DE
+L4808:
+	POP WA
+L4809:
+	POP IX
+L4810:
+	POP HL
+L4811:
+	POP WA
+L4812:
+	PUSH XBC
+L4813:
+	POP XBC
+L4814:
+	PUSH XIX
+L4815:
+	PUSH XIY
+L4816:
+	POP XIZ
+L4817:
+	PUSH IZ
+L4818:
+	PUSH XHL
+L4819:
+	PUSH XIY
+L4820:
+	POP XBC
+L4821:
+	POP IZ
+L4822:
+	POP WA
+L4823:
+	PUSH XBC
+L4824:
+	PUSH IZ
+L4825:
+	POP IX
+L4826:
+	POP HL
+L4827:
+	PUSH XIX
+L4828:
+	POP XDE
+L4829:
+	POP XIX
+L4830:
+	POP XHL
+L4831:
+	PUSH DE
+L4832:
+	PUSH IY
+L4833:
+	PUSH XHL
+L4834:
+	PUSH IY
+L4835:
+	POP IZ
+L4836:
+	PUSH XWA
+L4837:
+	POP WA
+L4838:
+	POP XIZ
+L4839:
+	PUSH XIX
+L4840:
+	POP XBC
+L4841:
+	PUSH IY
+L4842:
+	POP XIX
+L4843:
+	PUSH XHL
+L4844:
+	PUSH XIX
+L4845:
+	PUSH IZ
+L4846:
+	PUSH HL
+L4847:
+	POP IX
+L4848:
+	PUSH HL
+L4849:
+	POP IY
+L4850:
+	POP IZ
+L4851:
+	POP XWA
+L4852:
+	PUSH XIZ
+L4853:
+	POP XIY
+L4854:
+	PUSH XDE
+L4855:
+	POP IZ
+L4856:
+	POP XBC
+L4857:
+	POP IZ
+L4858:
+	PUSH XWA
+L4859:
+	PUSH IY
+L4860:
+	POP XIY
+L4861:
+	PUSH XDE
+L4862:
+	POP IY
+L4863:
+	POP XHL
+L4864:
+	POP XDE
+L4865:
+	POP HL
+L4866:
+	POP XWA
+L4867:
+	POP XIY
+L4868:
+	PUSH IZ
+L4869:
+	PUSH XIY
+L4870:
+	PUSH XDE
+L4871:
+	POP IX
+L4872:
+	PUSH XIX
+L4873:
+	PUSH IX
+L4874:
+	PUSH XDE
+L4875:
+	POP XDE
+L4876:
+	POP XDE
+L4877:
+	PUSH IY
+L4878:
+	PUSH WA
+L4879:
+	POP WA
+L4880:
+	PUSH XIY
+L4881:
+	PUSH DE
+L4882:
+	PUSH XWA
+L4883:
+	POP XWA
+L4884:
+	PUSH DE
+L4885:
+	POP IX
+L4886:
+	POP IY
+L4887:
+	PUSH IX
+L4888:
+	POP IZ
+L4889:
+	PUSH WA
+L4890:
+	PUSH XIX
+L4891:
+	PUSH DE
+L4892:
+	POP DE
+L4893:
+	PUSH XDE
+L4894:
+	POP IZ
+L4895:
+	PUSH XIZ
+L4896:
+	PUSH IY
+L4897:
+	POP XBC
+L4898:
+	PUSH BC
+L4899:
+	POP XIZ
+L4900:
+	PUSH XIY
+L4901:
+	POP IZ
+L4902:
+	PUSH XIX
+L4903:
+	POP XIY
+L4904:
+	POP IZ
+L4905:
+	PUSH IY
+L4906:
+	PUSH XIX
+L4907:
+	PUSH DE
+L4908:
+	PUSH BC
+L4909:
+	PUSH XIZ
+L4910:
+	PUSH XHL
+L4911:
+	POP DE
+L4912:
+	POP XDE
+L4913:
+	POP XHL
+L4914:
+	POP WA
+L4915:
+	POP XIY
+L4916:
+	PUSH XBC
+L4917:
+	POP XWA
+L4918:
+	POP IZ
+L4919:
+	POP HL
+L4920:
+	PUSH HL
+L4921:
+	PUSH DE
+L4922:
+	PUSH XWA
+L4923:
+	PUSH BC
+L4924:
+	PUSH HL
+L4925:
+	POP XWA
+L4926:
+	PUSH XDE
+L4927:
+	PUSH IX
+L4928:
+	POP XHL
+L4929:
+	POP XDE
+L4930:
+	PUSH IZ
+L4931:
+	POP DE
+L4932:
+	PUSH XIZ
+L4933:
+	POP XWA
+L4934:
+	PUSH XIY
+L4935:
+	POP IX
+L4936:
+	PUSH BC
+L4937:
+	POP BC
+L4938:
+	POP IZ
+L4939:
+	PUSH HL
+L4940:
+	PUSH XIX
+L4941:
+	PUSH XDE
+L4942:
+	PUSH XDE
+L4943:
+	PUSH DE
+L4944:
+	POP DE
+L4945:
+	PUSH WA
+L4946:
+	PUSH IY
+L4947:
+	POP DE
+L4948:
+	PUSH IZ
+L4949:
+	PUSH HL
+L4950:
+	POP XHL
+L4951:
+	PUSH WA
+L4952:
+	POP XBC
+L4953:
+	POP IX
+L4954:
+	POP XIY
+L4955:
+	POP XIX
+L4956:
+	PUSH BC
+L4957:
+	PUSH WA
+L4958:
+	POP XIZ
+L4959:
+	POP BC
+L4960:
+	POP HL
+L4961:
+	PUSH XHL
+L4962:
+	POP XIY
+L4963:
+	PUSH XIZ
+L4964:
+	PUSH XBC
+L4965:
+	POP IX
+L4966:
+	PUSH XIX
+L4967:
+	PUSH WA
+L4968:
+	PUSH IZ
+L4969:
+	PUSH HL
+L4970:
+	POP IX
+L4971:
+	PUSH XIX
+L4972:
+	POP BC
+L4973:
+	POP XBC
+L4974:
+	PUSH IY
+L4975:
+	POP XIY
+L4976:
+	PUSH WA
+L4977:
+	POP IX
+L4978:
+	POP DE
+L4979:
+	POP XIY
+L4980:
+	POP XIZ
+L4981:
+	PUSH XIY
+L4982:
+	PUSH XIY
+L4983:
+	POP HL
+L4984:
+	PUSH WA
+L4985:
+	PUSH IZ
+L4986:
+	PUSH XWA
+L4987:
+	PUSH XIY
+L4988:
+	POP DE
+L4989:
+	POP IZ
+L4990:
+	POP BC
+L4991:
+	POP IX
+L4992:
+	PUSH HL
+L4993:
+	POP XIZ
+L4994:
+	PUSH XIY
+L4995:
+	PUSH XDE
+L4996:
+	POP HL
+L4997:
+	PUSH IX
+L4998:
+	POP BC
+L4999:
+	POP WA
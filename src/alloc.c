@@ -0,0 +1,46 @@
+/*
+ * TLCS-900 Assembler - Heap Allocation Counter
+ *
+ * --stats counts heap allocations per pass, to show that once the first
+ * pass 1 sweep has recorded the statements, later sweeps and pass 2 run
+ * without touching the heap.  The assembler allocates through these
+ * wrappers, which count the call and forward to the C library; the
+ * process allocator is left alone, so a program embedding the library
+ * keeps its own malloc.  Allocations made inside the C library (stdio
+ * buffers opened by fopen) are not counted.
+ *
+ * The count is per thread: assemblers in a batch build don't add to each
+ * other's, and pass 2 workers hand theirs over when they finish (see
+ * parallel.c).
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+static _Thread_local uint64_t allocations;
+
+void *as_malloc(size_t size) {
+    allocations++;
+    return malloc(size);
+}
+
+void *as_calloc(size_t count, size_t size) {
+    allocations++;
+    return calloc(count, size);
+}
+
+void *as_realloc(void *ptr, size_t size) {
+    allocations++;
+    return realloc(ptr, size);
+}
+
+char *as_strdup(const char *s) {
+    allocations++;
+    return strdup(s);
+}
+
+uint64_t alloc_count(void) {
+    return allocations;
+}
@@ -0,0 +1,97 @@
+/*
+ * TLCS-900 Assembler - Bump Arena Allocator
+ *
+ * Arenas hand out memory from large blocks and free it all at once.
+ * A mark/release pair gives stack-like scoped allocation: everything
+ * allocated after a mark is discarded on release, and the blocks are
+ * kept for reuse.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+#define ARENA_BLOCK_SIZE 65536
+
+void arena_init(Arena *arena) {
+    memset(arena, 0, sizeof(*arena));
+}
+
+/* Get a block with at least size bytes, reusing spare blocks if possible */
+static ArenaBlock *arena_new_block(Arena *arena, size_t size) {
+    if (arena->spare && arena->spare->size >= size) {
+        ArenaBlock *block = arena->spare;
+        arena->spare = block->next;
+        block->used = 0;
+        return block;
+    }
+
+    size_t block_size = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+    ArenaBlock *block = as_malloc(sizeof(ArenaBlock) + block_size);
+    if (!block) {
+        fprintf(stderr, "Failed to allocate arena block\n");
+        exit(1);
+    }
+    block->size = block_size;
+    block->used = 0;
+    return block;
+}
+
+void *arena_alloc(Arena *arena, size_t size) {
+    size = (size + 7) & ~(size_t)7;
+
+    ArenaBlock *block = arena->head;
+    if (!block || block->used + size > block->size) {
+        block = arena_new_block(arena, size);
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    void *p = block->data + block->used;
+    block->used += size;
+    return p;
+}
+
+char *arena_strdup(Arena *arena, const char *s) {
+    size_t len = strlen(s) + 1;
+    char *p = arena_alloc(arena, len);
+    memcpy(p, s, len);
+    return p;
+}
+
+ArenaMark arena_mark(Arena *arena) {
+    ArenaMark mark;
+    mark.block = arena->head;
+    mark.used = arena->head ? arena->head->used : 0;
+    return mark;
+}
+
+void arena_release(Arena *arena, ArenaMark mark) {
+    /* Move blocks allocated after the mark to the spare list */
+    while (arena->head && arena->head != mark.block) {
+        ArenaBlock *block = arena->head;
+        arena->head = block->next;
+        block->next = arena->spare;
+        arena->spare = block;
+    }
+    if (arena->head) {
+        arena->head->used = mark.used;
+    }
+}
+
+void arena_reset(Arena *arena) {
+    ArenaMark empty = { NULL, 0 };
+    arena_release(arena, empty);
+}
+
+void arena_free(Arena *arena) {
+    arena_reset(arena);
+    ArenaBlock *block = arena->spare;
+    while (block) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    memset(arena, 0, sizeof(*arena));
+}
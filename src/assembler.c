@@ -4,12 +4,26 @@
  * Two-pass assembler:
  * Pass 1: Collect labels and symbol values
  * Pass 2: Generate code with resolved symbols
+ *
+ * Source files are loaded and tokenized once through the source cache,
+ * so every pass replays token streams from memory instead of re-reading
+ * and re-scanning the files.  The first pass 1 iteration also records a
+ * statement list (see ir.c) that later passes replay directly.
+ *
+ * With the build cache enabled (see cache.c), an included file that is
+ * unchanged since the last build, and whose inputs are where they were,
+ * is not parsed at all: its symbols and bytes come from the cache.
+ *
+ * With more than one thread, pass 2 workers encode stretches of the
+ * recorded statements ahead of the serial replay (see parallel.c).
  */
 
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <time.h>
 #include "../include/tlcs900.h"
 
 /* External functions */
@@ -20,7 +34,7 @@ extern bool parse_line(Assembler *as, const char *line);
 
 /* Create a new assembler instance */
 Assembler *assembler_new(void) {
-    Assembler *as = calloc(1, sizeof(Assembler));
+    Assembler *as = as_calloc(1, sizeof(Assembler));
     if (!as) {
         fprintf(stderr, "Failed to allocate assembler\n");
         return NULL;
@@ -28,21 +42,53 @@ Assembler *assembler_new(void) {
 
     symbols_init(as);
     output_init(as);
+    strpool_init(&as->strings);
+    keywords_init();
+    arena_init(&as->scratch);
+    arena_init(&as->pass_arena);
 
     as->pc = 0;
     as->org = 0;
     as->pass = 1;
     as->max_mode = true;  /* TLCS-900 typically runs in MAX mode */
+    as->list_enabled = true;
+    as->threads = 1;
 
     return as;
 }
 
+/*
+ * Create an assembler that starts with base's atoms and reads base's
+ * tokenized sources instead of loading those files again.  base must
+ * stay alive and unchanged while the new assembler is in use.
+ */
+Assembler *assembler_new_shared(const Assembler *base) {
+    Assembler *as = assembler_new();
+    if (!as) return NULL;
+    strpool_free(&as->strings);
+    strpool_init_from(&as->strings, &base->strings);
+    as->shared_sources = base->sources;
+    return as;
+}
+
 /* Free assembler instance */
 void assembler_free(Assembler *as) {
     if (!as) return;
 
     symbols_free(as);
     output_free(as);
+    source_free_all(as);
+    strpool_free(&as->strings);
+    free(as->line_tokens.tokens);
+    ir_free(as);
+    arena_free(&as->scratch);
+    arena_free(&as->pass_arena);
+    cache_free(as);
+    pch_free(as);
+    parallel_free(as);
+    listing_close(as);
+    diag_list_free(&as->diags);
+    macro_context_free(&as->macro);
 
     /* Free include stack files */
     for (int i = 0; i < as->include_depth; i++) {
@@ -54,41 +100,23 @@ void assembler_free(Assembler *as) {
     free(as);
 }
 
-/* Read a line from file, handling different line endings */
-static char *read_line(FILE *fp, char *buf, size_t size) {
-    if (!fgets(buf, size, fp)) {
-        return NULL;
-    }
-
-    /* Remove trailing newline/carriage return */
-    size_t len = strlen(buf);
-    while (len > 0 && (buf[len-1] == '\n' || buf[len-1] == '\r')) {
-        buf[--len] = '\0';
-    }
-
-    return buf;
-}
-
-/* Process a single file (used for includes too) */
-static bool process_file(Assembler *as, const char *filename) {
-    FILE *fp = fopen(filename, "r");
-    if (!fp) {
-        error(as, "cannot open file '%s'", filename);
-        return false;
-    }
-
+/* Parse every line of a loaded source file */
+static bool process_source(Assembler *as, SourceFile *src) {
     /* Save current file context */
     const char *prev_file = as->current_file;
     int prev_line = as->current_line;
 
-    as->current_file = filename;
+    /* Use the cached path so symbols can keep pointing at it */
+    as->current_file = src->path;
     as->current_line = 0;
 
-    char line[MAX_LINE_LENGTH];
-    while (read_line(fp, line, sizeof(line))) {
+    for (int i = 0; i < src->line_count && !as->stop; i++) {
         as->current_line++;
 
-        if (!parse_line(as, line)) {
+        const SourceLine *line = &src->lines[i];
+        if (!parse_line_tokens(as, src->data + line->offset,
+                               src->tokens.tokens + line->first_token,
+                               (int)line->token_count)) {
             /* Error already reported */
         }
 
@@ -99,8 +127,6 @@ static bool process_file(Assembler *as, const char *filename) {
         }
     }
 
-    fclose(fp);
-
     /* Restore previous file context */
     as->current_file = prev_file;
     as->current_line = prev_line;
@@ -108,39 +134,96 @@ static bool process_file(Assembler *as, const char *filename) {
     return !as->errors;
 }
 
-/* Assemble a file (main entry point) */
-bool assembler_assemble_file(Assembler *as, const char *filename) {
+/* Process a single file (used for includes too) */
+static bool process_file(Assembler *as, const char *filename) {
+    SourceFile *src = source_load(as, filename);
+    if (!src) {
+        error(as, "cannot open file '%s'", filename);
+        return false;
+    }
+    return process_source(as, src);
+}
+
+/* Run one pass, replaying recorded statements when they are usable */
+static bool run_pass(Assembler *as, const char *filename) {
+    if (as->ir.valid) {
+        return ir_replay(as);
+    }
+    return process_file(as, filename);
+}
+
+/* Monotonic wall clock, in seconds */
+double assembler_clock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static bool assemble(Assembler *as, const char *filename) {
     /*
      * Multi-pass assembly to handle forward references correctly:
      *
-     * Pass 1 (first iteration): Collect symbols, forward refs get max sizes
-     * Pass 1 (iterations 2+): Recalculate with known values until stable
+     * Pass 1 (first iteration): Collect symbols and record statements
+     * Pass 1 (iterations 2+): Relaxation sweeps until no symbol changes
      * Pass 2: Generate code with final, stable sizes
      *
-     * This iterative approach ensures that instruction sizes are consistent
-     * and all labels have correct addresses for optimal sizing.
+     * A sweep re-encodes only instructions whose symbols changed since
+     * their size was computed (see ir.c).  The layout is stable once a
+     * whole sweep leaves every label and EQU value unchanged; comparing
+     * only the final PC could stop early when two size changes cancel.
+     *
+     * With layout_only set, assembly stops there: the labels and the
+     * recorded statement sizes already hold the final layout, and no
+     * output page is ever allocated.
      */
 
     bool had_pass1_errors = false;
-    uint32_t last_pc = 0;
+    bool stable = false;
     int iteration = 0;
-    const int MAX_ITERATIONS = 10;
+    const int GROW_ONLY_ITERATION = 5;
 
-    /* Iterative pass 1: repeat until addresses stabilize */
+    bool stats_enabled = as->stats.enabled;
+    memset(&as->stats, 0, sizeof(as->stats));
+    as->stats.enabled = stats_enabled;
+    double start = assembler_clock();
+    as->stats.phase_start = start;
+
+    /* Iterative pass 1: repeat until symbol values stabilize */
     do {
         iteration++;
+        as->stats.iterations = iteration;
+        double iteration_start = assembler_clock();
+        uint64_t allocations = alloc_count();
         if (as->verbose) {
             printf("Pass 1 (iteration %d): %s\n", iteration, filename);
         }
 
+        /* Sizes still moving this late: let direct addresses only grow */
+        if (iteration == GROW_ONLY_ITERATION) {
+            ir_set_grow_only(as);
+        }
+
         as->pass = 1;
+        as->sweep++;
         as->sizing_pass = (iteration == 1);  /* Conservative only on first iteration */
         as->pc = 0;
         as->org = 0;
         as->errors = false;
         as->error_count = 0;
-
-        if (!process_file(as, filename)) {
+        macro_begin_pass(as);
+        arena_reset(&as->pass_arena);
+        uint32_t stamp = as->symbol_stamp;
+
+        if (iteration == 1) {
+            ir_begin(as);
+            bool ok = process_file(as, filename);
+            ir_finish_recording(as);
+            if (!ok) {
+                return false;
+            }
+            /* Cached symbols the source no longer defines go away */
+            symbols_drop_seeds(as);
+        } else if (!run_pass(as, filename)) {
             return false;
         }
 
@@ -148,24 +231,44 @@ bool assembler_assemble_file(Assembler *as, const char *filename) {
             had_pass1_errors = true;
         }
 
-        /* Check if PC changed from last iteration */
-        if (iteration > 1 && as->pc == last_pc) {
+        IterationStats *sweep = &as->stats.iteration[iteration - 1];
+        sweep->seconds = assembler_clock() - iteration_start;
+        sweep->symbol_changes = as->symbol_stamp - stamp;
+        sweep->allocations = alloc_count() - allocations;
+
+        /* Stable once a sweep changed no symbol value */
+        if (iteration > 1 && as->symbol_stamp == stamp) {
             if (as->verbose) {
                 printf("  Sizes stabilized at iteration %d (PC=%u)\n", iteration, as->pc);
             }
+            stable = true;
             break;
         }
 
-        last_pc = as->pc;
+        if (as->verbose && iteration > 1) {
+            printf("  %u symbol values changed\n", as->symbol_stamp - stamp);
+        }
+
+    } while (iteration < MAX_PASS1_ITERATIONS);
+
+    as->stats.pass1_seconds = assembler_clock() - start;
 
-    } while (iteration < MAX_ITERATIONS);
+    if (!stable) {
+        diag_message(as, "Warning: sizes did not stabilize after %d iterations", MAX_PASS1_ITERATIONS);
+    }
 
-    if (iteration >= MAX_ITERATIONS) {
-        fprintf(stderr, "Warning: sizes did not stabilize after %d iterations\n", MAX_ITERATIONS);
+    /* Addresses and sizes are all a size map needs */
+    if (as->layout_only) {
+        stats_leave(as, PHASE_OTHER);
+        if (had_pass1_errors) {
+            diag_message(as, "Pass 1 had errors");
+            return false;
+        }
+        return true;
     }
 
     if (had_pass1_errors) {
-        fprintf(stderr, "Pass 1 had errors, continuing to pass 2...\n");
+        diag_message(as, "Pass 1 had errors, continuing to pass 2...");
     }
 
     /* Pass 2: Generate code */
@@ -174,21 +277,35 @@ bool assembler_assemble_file(Assembler *as, const char *filename) {
     }
 
     as->pass = 2;
+    as->sweep++;
     as->sizing_pass = false;
+    as->list_enabled = true;
     as->pc = 0;
     as->org = 0;
     as->errors = false;
     as->error_count = 0;
+    macro_begin_pass(as);
+    arena_reset(&as->pass_arena);
 
-    if (!process_file(as, filename)) {
+    start = assembler_clock();
+    uint64_t allocations = alloc_count();
+    if (as->threads > 1 && as->ir.valid) {
+        parallel_encode(as);
+    }
+    bool ok = run_pass(as, filename);
+    parallel_free(as);
+    as->stats.pass2_seconds = assembler_clock() - start;
+    as->stats.pass2_allocations += alloc_count() - allocations;
+    stats_leave(as, PHASE_OTHER);
+    if (!ok) {
         return false;
     }
 
     if (as->errors || had_pass1_errors) {
-        fprintf(stderr, "Assembly failed with %d errors\n", as->error_count);
+        diag_message(as, "Assembly failed with %d errors", as->error_count);
         /* Still output the file for debugging/comparison purposes */
         if (as->output_size > 0) {
-            fprintf(stderr, "Partial output: %zu bytes generated (with errors)\n", as->output_size);
+            diag_message(as, "Partial output: %zu bytes generated (with errors)", as->output_size);
         }
         return false;
     }
@@ -200,34 +317,81 @@ bool assembler_assemble_file(Assembler *as, const char *filename) {
     return true;
 }
 
-/* Handle INCLUDE directive */
-bool assembler_include_file(Assembler *as, const char *filename) {
-    if (as->include_depth >= MAX_INCLUDE_DEPTH) {
-        error(as, "include nesting too deep");
-        return false;
-    }
+/* Assemble a file (main entry point); diagnostics are printed at the end */
+bool assembler_assemble_file(Assembler *as, const char *filename) {
+    diag_begin(as);
+    bool ok = assemble(as, filename);
+    diag_finish(as);
+    return ok;
+}
 
-    /* Resolve relative path based on current file */
-    char resolved_path[1024];
+/*
+ * Resolve an INCLUDE name: relative names are taken from the directory
+ * of the including file.  False if the result does not fit.
+ */
+bool assembler_resolve_include(const char *current_file, const char *filename,
+                               char *resolved_path, size_t size) {
     if (filename[0] != '/') {
         /* Get directory of current file */
-        const char *last_slash = strrchr(as->current_file, '/');
+        const char *last_slash = current_file ? strrchr(current_file, '/') : NULL;
         if (last_slash) {
-            size_t dir_len = last_slash - as->current_file + 1;
-            if (dir_len + strlen(filename) >= sizeof(resolved_path)) {
-                error(as, "include path too long");
+            size_t dir_len = last_slash - current_file + 1;
+            if (dir_len + strlen(filename) >= size) {
                 return false;
             }
-            memcpy(resolved_path, as->current_file, dir_len);
+            memcpy(resolved_path, current_file, dir_len);
             strcpy(resolved_path + dir_len, filename);
-        } else {
-            strncpy(resolved_path, filename, sizeof(resolved_path) - 1);
-            resolved_path[sizeof(resolved_path) - 1] = '\0';
+            return true;
         }
-    } else {
-        strncpy(resolved_path, filename, sizeof(resolved_path) - 1);
-        resolved_path[sizeof(resolved_path) - 1] = '\0';
+    }
+    strncpy(resolved_path, filename, size - 1);
+    resolved_path[size - 1] = '\0';
+    return true;
+}
+
+/* Handle INCLUDE directive */
+bool assembler_include_file(Assembler *as, const char *filename) {
+    if (as->include_depth >= MAX_INCLUDE_DEPTH) {
+        error(as, "include nesting too deep");
+        return false;
+    }
+
+    char resolved_path[1024];
+    if (!assembler_resolve_include(as->current_file, filename, resolved_path, sizeof(resolved_path))) {
+        error(as, "include path too long");
+        return false;
+    }
+
+    return assembler_include_path(as, resolved_path);
+}
+
+/* Include a file by resolved path, reusing its cached result if possible */
+bool assembler_include_path(Assembler *as, const char *path) {
+    if (as->include_depth >= MAX_INCLUDE_DEPTH) {
+        error(as, "include nesting too deep");
+        return false;
     }
 
-    return process_file(as, resolved_path);
+    SourceFile *src = source_open(as, path);
+    if (!src) {
+        error(as, "cannot open file '%s'", path);
+        return false;
+    }
+
+    /* The recorded statement marks the file, whether parsed or reused */
+    bool record = ir_is_recording(as);
+    size_t include = record ? ir_record_include(as, src->path) : 0;
+    if (pch_apply(as, src) || cache_enter(as, src)) {
+        return !as->errors;
+    }
+
+    as->include_depth++;
+    bool result = process_source(as, source_load(as, path));
+    as->include_depth--;
+
+    if (record) {
+        ir_record_include_end(as, include);
+    }
+    cache_leave(as);
+    return result;
 }
@@ -0,0 +1,414 @@
+/*
+ * TLCS-900 Assembler - Building Targets
+ *
+ * build_target() is one assembler run: load the build cache, assemble,
+ * write the image, save the cache.  With --symbols-only it stops after
+ * pass 1 and writes a size map (output.sym) instead; the build cache is
+ * neither read nor written then, since its entries hold pass 2 bytes
+ * and skip the statements the size map lists.  build_batch() runs
+ * build_target() for every line of a manifest:
+ *
+ *   # input          output
+ *   maincpu.asm      maincpu.rom
+ *   subcpu.asm       subcpu.rom
+ *
+ * Targets are built on a pool of threads, each with its own assembler.
+ * Before they start, the manifest's sources are scanned for INCLUDE
+ * lines, and every file that more than one target includes (typically
+ * the I/O register headers) is read and tokenized once, into a shared
+ * assembler whose atoms every target starts from.  The scan only has to
+ * be good enough to find those files: a file it misses is simply loaded
+ * by each target as usual.
+ *
+ * Each target's messages are buffered and printed in manifest order
+ * once all targets are done.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <pthread.h>
+#include "../include/tlcs900.h"
+
+typedef struct {
+    char *input;
+    char *output;
+    DiagBuffer diags;
+    bool ok;
+} BatchTarget;
+
+/* A file the scan found, and how many targets include it */
+typedef struct {
+    char *path;
+    int users;
+    int last_target;            /* Counted once per target */
+} BatchInclude;
+
+typedef struct {
+    const BuildOptions *opt;
+    BatchTarget *targets;
+    size_t target_count;
+    BatchInclude *includes;
+    size_t include_count;
+    size_t include_capacity;
+    Assembler *shared;
+    pthread_mutex_t lock;
+    size_t next_target;
+} Batch;
+
+/* path with its extension replaced by ext (".rom", ".lst", ...) */
+void build_sibling_path(const char *path, const char *ext, char *sibling, size_t size) {
+    size_t room = size - strlen(ext) - 1;
+    strncpy(sibling, path, room);
+    sibling[room] = '\0';
+    char *dot = strrchr(sibling, '.');
+    if (dot && !strchr(dot, '/')) {
+        strcpy(dot, ext);
+    } else {
+        strcat(sibling, ext);
+    }
+}
+
+/* Output name for an input when none is given: input.rom, input.hex, ... */
+void build_default_output(const BuildOptions *opt, const char *input, char *output, size_t size) {
+    build_sibling_path(input, output_format_extension(opt->format), output, size);
+}
+
+/* Assemble one target; messages go to diags if given, else stderr */
+bool build_target(const BuildOptions *opt, const char *input, const char *output,
+                  const Assembler *shared, DiagBuffer *diags) {
+    Assembler *as = shared ? assembler_new_shared(shared) : assembler_new();
+    if (!as) {
+        fprintf(stderr, "Error: failed to create assembler\n");
+        return false;
+    }
+
+    as->verbose = opt->verbose;
+    as->threads = opt->threads;
+    as->diag_buffer = diags;
+    as->stats.enabled = opt->stats;
+    as->output_format = opt->format;
+    as->bank_size = opt->bank_size;
+    as->layout_only = opt->symbols_only;
+    bool use_cache = opt->use_cache && !opt->symbols_only;
+
+    /* Last build's results for included files that haven't changed */
+    char cache_file[1100];
+    snprintf(cache_file, sizeof(cache_file), "%s.tlcs900cache", output);
+    if (use_cache) {
+        cache_load(as, cache_file);
+    }
+
+    /* The listing is written as pass 2 goes */
+    char listing_file[1100];
+    build_sibling_path(output, ".lst", listing_file, sizeof(listing_file));
+    if (opt->listing && !listing_open(as, listing_file)) {
+        fprintf(stderr, "Error: cannot open listing file '%s'\n", listing_file);
+        assembler_free(as);
+        return false;
+    }
+
+    /* Pass 2 output is checked against the reference as it is written */
+    if (opt->compare && !compare_open(as, opt->compare, opt->compare_limit)) {
+        fprintf(stderr, "Error: cannot open reference image '%s'\n", opt->compare);
+        assembler_free(as);
+        return false;
+    }
+
+    /* Assemble the file; a comparison that hit its limit stopped pass 2 */
+    bool success = assembler_assemble_file(as, input);
+    bool stopped = as->stop;
+    if (!compare_close(as)) {
+        success = false;
+    }
+
+    if (opt->symbols_only) {
+        char sizemap_file[1100];
+        build_sibling_path(output, ".sym", sizemap_file, sizeof(sizemap_file));
+        if (!sizemap_write(as, sizemap_file)) {
+            diag_message(as, "Error: failed to write size map '%s'", sizemap_file);
+            success = false;
+        }
+    }
+
+    /* Write output even if there were errors (for debugging/comparison),
+     * but not an image a stopped comparison left half done */
+    if (as->output_size > 0 && !stopped) {
+        if (!assembler_write_output(as, output)) {
+            diag_message(as, "Failed to write output file");
+            assembler_free(as);
+            return false;
+        }
+    }
+
+    if (opt->listing && !listing_close(as)) {
+        diag_message(as, "Error: failed to write listing file '%s'", listing_file);
+        success = false;
+    }
+    if (opt->map) {
+        char map_file[1100];
+        build_sibling_path(output, ".map", map_file, sizeof(map_file));
+        if (!map_write(as, map_file)) {
+            diag_message(as, "Error: failed to write symbol map '%s'", map_file);
+            success = false;
+        }
+    }
+
+    if (opt->stats) {
+        stats_print(as);
+    }
+
+    if (!success) {
+        assembler_free(as);
+        return false;
+    }
+
+    if (use_cache) {
+        cache_save(as, cache_file);
+    }
+
+    if (opt->verbose) {
+        printf("Assembly successful: %s -> %s\n", input, output);
+    }
+
+    assembler_free(as);
+    return true;
+}
+
+/* The file a directive (INCLUDE, BINCLUDE) names, if the line is one */
+bool build_scan_include(const char *line, const char *directive, char *name, size_t size) {
+    size_t directive_len = strlen(directive);
+    const char *p = line;
+    for (int word = 0; word < 2; word++) {
+        while (*p == ' ' || *p == '\t') p++;
+        const char *start = p;
+        while (isalnum((unsigned char)*p) || *p == '_' || *p == '.') p++;
+        size_t len = (size_t)(p - start);
+        if (len == directive_len && strncasecmp(start, directive, len) == 0 &&
+            (*p == ' ' || *p == '\t')) {
+            break;
+        }
+        /* Only a label may come before the directive */
+        if (word == 1 || len == 0) return false;
+        if (*p == ':') p++;
+    }
+
+    while (*p == ' ' || *p == '\t') p++;
+    char quote = (*p == '"' || *p == '\'') ? *p++ : '\0';
+    size_t len = 0;
+    while (*p && len < size - 1) {
+        if (quote ? *p == quote : (*p == ' ' || *p == '\t' || *p == ';' || *p == ',')) break;
+        name[len++] = *p++;
+    }
+    name[len] = '\0';
+    return len > 0;
+}
+
+static BatchInclude *find_include(Batch *batch, const char *path) {
+    for (size_t i = 0; i < batch->include_count; i++) {
+        if (strcmp(batch->includes[i].path, path) == 0) {
+            return &batch->includes[i];
+        }
+    }
+    if (batch->include_count >= batch->include_capacity) {
+        size_t new_capacity = batch->include_capacity ? batch->include_capacity * 2 : 32;
+        BatchInclude *includes = as_realloc(batch->includes, new_capacity * sizeof(BatchInclude));
+        if (!includes) {
+            fprintf(stderr, "Failed to allocate batch include list\n");
+            exit(1);
+        }
+        batch->includes = includes;
+        batch->include_capacity = new_capacity;
+    }
+    BatchInclude *inc = &batch->includes[batch->include_count++];
+    inc->path = as_strdup(path);
+    inc->users = 0;
+    inc->last_target = -1;
+    return inc;
+}
+
+/* Count path and everything it includes as used by target */
+static void scan_file(Batch *batch, const char *path, int target, int depth) {
+    BatchInclude *inc = find_include(batch, path);
+    if (inc->last_target == target || depth > MAX_INCLUDE_DEPTH) return;
+    inc->last_target = target;
+    inc->users++;
+
+    /* Read (but not tokenize) through the shared assembler's cache */
+    SourceFile *src = source_open(batch->shared, path);
+    if (!src) return;
+
+    char name[1024];
+    char resolved[1024];
+    for (int i = 0; i < src->line_count; i++) {
+        if (build_scan_include(src->data + src->lines[i].offset, "INCLUDE", name, sizeof(name)) &&
+            assembler_resolve_include(src->path, name, resolved, sizeof(resolved))) {
+            scan_file(batch, resolved, target, depth + 1);
+        }
+    }
+}
+
+static bool read_manifest(Batch *batch, const char *manifest) {
+    FILE *fp = fopen(manifest, "r");
+    if (!fp) {
+        fprintf(stderr, "Error: cannot open manifest '%s'\n", manifest);
+        return false;
+    }
+
+    size_t capacity = 0;
+    char line[2048];
+    int line_number = 0;
+    bool ok = true;
+    while (fgets(line, sizeof(line), fp)) {
+        line_number++;
+        char *comment = strchr(line, '#');
+        if (comment) *comment = '\0';
+
+        char *save;
+        char *input = strtok_r(line, " \t\r\n", &save);
+        if (!input) continue;
+        char *output = strtok_r(NULL, " \t\r\n", &save);
+        if (strtok_r(NULL, " \t\r\n", &save)) {
+            fprintf(stderr, "%s:%d: error: expected 'input [output]'\n", manifest, line_number);
+            ok = false;
+            continue;
+        }
+
+        char default_output[1024];
+        if (!output) {
+            build_default_output(batch->opt, input, default_output, sizeof(default_output));
+            output = default_output;
+        }
+        for (size_t i = 0; i < batch->target_count; i++) {
+            if (strcmp(batch->targets[i].output, output) == 0) {
+                fprintf(stderr, "%s:%d: error: output '%s' is already built by this manifest\n",
+                        manifest, line_number, output);
+                ok = false;
+            }
+        }
+
+        if (batch->target_count >= capacity) {
+            capacity = capacity ? capacity * 2 : 16;
+            BatchTarget *targets = as_realloc(batch->targets, capacity * sizeof(BatchTarget));
+            if (!targets) {
+                fprintf(stderr, "Failed to allocate batch targets\n");
+                exit(1);
+            }
+            batch->targets = targets;
+        }
+        BatchTarget *target = &batch->targets[batch->target_count++];
+        memset(target, 0, sizeof(*target));
+        target->input = as_strdup(input);
+        target->output = as_strdup(output);
+    }
+    fclose(fp);
+
+    if (ok && batch->target_count == 0) {
+        fprintf(stderr, "Error: manifest '%s' lists no targets\n", manifest);
+        ok = false;
+    }
+    return ok;
+}
+
+static void *batch_worker(void *arg) {
+    Batch *batch = arg;
+    for (;;) {
+        pthread_mutex_lock(&batch->lock);
+        size_t index = batch->next_target++;
+        pthread_mutex_unlock(&batch->lock);
+        if (index >= batch->target_count) break;
+
+        BatchTarget *target = &batch->targets[index];
+        target->ok = build_target(batch->opt, target->input, target->output,
+                                  batch->shared, &target->diags);
+    }
+    return NULL;
+}
+
+/* Build every target of a manifest on up to jobs threads */
+int build_batch(const BuildOptions *opt, const char *manifest, int jobs) {
+    /* Targets are the unit of parallelism; each one runs quietly */
+    BuildOptions target_opt = *opt;
+    target_opt.verbose = false;
+    target_opt.threads = 1;
+
+    Batch batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.opt = &target_opt;
+
+    if (!read_manifest(&batch, manifest)) {
+        for (size_t i = 0; i < batch.target_count; i++) {
+            free(batch.targets[i].input);
+            free(batch.targets[i].output);
+        }
+        free(batch.targets);
+        return 1;
+    }
+
+    /* Tokenize what several targets include, once */
+    batch.shared = assembler_new();
+    if (!batch.shared) {
+        fprintf(stderr, "Error: failed to create assembler\n");
+        return 1;
+    }
+    for (size_t i = 0; i < batch.target_count; i++) {
+        scan_file(&batch, batch.targets[i].input, (int)i, 0);
+    }
+    size_t shared_count = 0;
+    for (size_t i = 0; i < batch.include_count; i++) {
+        if (batch.includes[i].users > 1 && source_load(batch.shared, batch.includes[i].path)) {
+            shared_count++;
+        }
+    }
+    if (opt->verbose) {
+        printf("Batch: %zu targets, %zu shared files tokenized once\n",
+               batch.target_count, shared_count);
+    }
+
+    /* Build the targets; the calling thread is one of the workers */
+    pthread_mutex_init(&batch.lock, NULL);
+    if ((size_t)jobs > batch.target_count) jobs = (int)batch.target_count;
+    pthread_t *threads = as_calloc((size_t)jobs, sizeof(pthread_t));
+    int started = 0;
+    for (int t = 0; threads && t < jobs - 1; t++) {
+        if (pthread_create(&threads[started], NULL, batch_worker, &batch) == 0) {
+            started++;
+        }
+    }
+    batch_worker(&batch);
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&batch.lock);
+
+    /* Report in manifest order */
+    int failed = 0;
+    for (size_t i = 0; i < batch.target_count; i++) {
+        BatchTarget *target = &batch.targets[i];
+        if (target->diags.length > 0) {
+            fwrite(target->diags.text, 1, target->diags.length, stderr);
+        }
+        if (!target->ok) {
+            fprintf(stderr, "%s: build failed\n", target->input);
+            failed++;
+        }
+        free(target->diags.text);
+        free(target->input);
+        free(target->output);
+    }
+    if (opt->verbose) {
+        printf("Batch: %zu of %zu targets built\n", batch.target_count - failed, batch.target_count);
+    }
+
+    for (size_t i = 0; i < batch.include_count; i++) {
+        free(batch.includes[i].path);
+    }
+    free(batch.includes);
+    free(batch.targets);
+    assembler_free(batch.shared);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * TLCS-900 Assembler - Binary File Helpers
+ *
+ * Little-endian integers and length-prefixed strings, as used by the
+ * build cache (cache.c) and precompiled headers (pch.c).  A reader
+ * never runs past its data: once a read fails, ok is false and every
+ * later read returns zeros.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+/* Read a whole file; the caller frees r->data */
+bool bin_load(const char *path, BinReader *r) {
+    memset(r, 0, sizeof(*r));
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return false;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    uint8_t *data = size > 0 ? as_malloc((size_t)size) : NULL;
+    if (!data || fread(data, 1, (size_t)size, fp) != (size_t)size) {
+        free(data);
+        fclose(fp);
+        return false;
+    }
+    fclose(fp);
+
+    r->data = data;
+    r->size = (size_t)size;
+    r->ok = true;
+    return true;
+}
+
+bool bin_read_bytes(BinReader *r, void *out, size_t len) {
+    if (!r->ok || len > r->size - r->pos) {
+        r->ok = false;
+        memset(out, 0, len);
+        return false;
+    }
+    memcpy(out, r->data + r->pos, len);
+    r->pos += len;
+    return true;
+}
+
+uint32_t bin_read_u32(BinReader *r) {
+    uint8_t b[4];
+    bin_read_bytes(r, b, 4);
+    return (uint32_t)b[0] | (uint32_t)b[1] << 8 | (uint32_t)b[2] << 16 | (uint32_t)b[3] << 24;
+}
+
+uint64_t bin_read_u64(BinReader *r) {
+    uint64_t lo = bin_read_u32(r);
+    return lo | (uint64_t)bin_read_u32(r) << 32;
+}
+
+char *bin_read_string(BinReader *r) {
+    uint32_t len = bin_read_u32(r);
+    if (!r->ok || len > r->size - r->pos) {
+        r->ok = false;
+        return NULL;
+    }
+    char *s = as_malloc(len + 1);
+    if (!s) {
+        r->ok = false;
+        return NULL;
+    }
+    bin_read_bytes(r, s, len);
+    s[len] = '\0';
+    return s;
+}
+
+/* Element count, refused if the remaining data can't possibly hold it */
+size_t bin_read_count(BinReader *r, size_t min_size) {
+    uint32_t count = bin_read_u32(r);
+    if (!r->ok || count > (r->size - r->pos) / min_size) {
+        r->ok = false;
+        return 0;
+    }
+    return count;
+}
+
+void bin_write_u32(FILE *fp, uint32_t v) {
+    uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) };
+    fwrite(b, 1, 4, fp);
+}
+
+void bin_write_u64(FILE *fp, uint64_t v) {
+    bin_write_u32(fp, (uint32_t)v);
+    bin_write_u32(fp, (uint32_t)(v >> 32));
+}
+
+void bin_write_string(FILE *fp, const char *s) {
+    size_t len = strlen(s);
+    bin_write_u32(fp, (uint32_t)len);
+    fwrite(s, 1, len, fp);
+}
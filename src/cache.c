@@ -0,0 +1,677 @@
+/*
+ * TLCS-900 Assembler - Incremental Build Cache
+ *
+ * After a successful build the cache file next to the output records,
+ * for every included file, what assembling it amounted to:
+ *
+ *   - the file's content hash, and the PC and MAXMODE state it started at
+ *   - its inputs: every symbol from elsewhere it referenced, with type and
+ *     value, and every macro it invoked, with a hash of the macro's body
+ *   - its outputs: the labels and EQUs it defined, the bytes it emitted
+ *     (as address ranges) and the PC and origin it ended at
+ *
+ * plus the final value of every label and EQU.
+ *
+ * The next build seeds the symbol table with those values, so forward
+ * references resolve on the first sweep as they did last time.  When an
+ * include is reached with the same content, at the same PC, and every
+ * input still has its recorded value, the assembler defines the recorded
+ * symbols and (in pass 2) copies the recorded bytes instead of parsing
+ * the file.  Whatever the file produces is a function of exactly those
+ * inputs, so the result is the one parsing would have given.  The check
+ * is repeated on every sweep; a file whose inputs moved is parsed.
+ *
+ * Files are not recorded when replaying them could differ from parsing:
+ * when they include other files, use SET symbols, define macros, change
+ * MAXMODE, BINCLUDE data, produce diagnostics, or define a label that is
+ * also defined elsewhere.  Only included files are cached; the top-level
+ * file is always parsed.  Nothing is written after a failed build or one
+ * that needed grow-only sizing to converge.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+extern Symbol *macro_lookup(Assembler *as, const char *name);
+
+#define CACHE_MAGIC "T900CACH"
+#define CACHE_VERSION 1
+
+/* Symbol as recorded: an input's expected value or an output's definition */
+typedef struct {
+    char *name;
+    uint8_t type;               /* SymbolType */
+    int64_t value;
+    int line;                   /* Outputs: definition line */
+    Symbol *sym;                /* Resolved symbol, NULL until looked up */
+} CacheSymbol;
+
+typedef struct {
+    char *name;
+    uint64_t hash;              /* macro_hash of the definition */
+} CacheMacro;
+
+/* What one inclusion of a file produced */
+typedef struct {
+    char *path;
+    uint32_t occurrence;        /* Which inclusion of path, from 0 */
+    uint64_t hash;
+    uint32_t start_pc;
+    uint32_t end_pc;
+    uint32_t end_org;
+    bool max_mode;
+    CacheSymbol *inputs;
+    size_t input_count;
+    CacheSymbol *outputs;
+    size_t output_count;
+    size_t output_capacity;
+    CacheMacro *macros;
+    size_t macro_count;
+    size_t macro_capacity;
+    OutputCapture bytes;        /* What it wrote, as address runs */
+} CacheEntry;
+
+/* One inclusion in this build */
+typedef struct {
+    CacheEntry entry;           /* Pass 2 recording; path points at the source */
+    const CacheEntry *old;      /* Last build's entry for the same inclusion */
+    const CacheEntry *reused;   /* Set when pass 2 took old instead of parsing */
+    Symbol **refs;              /* Symbols referenced while recording */
+    size_t ref_count;
+    size_t ref_capacity;
+    uint32_t seen_sweep;
+    bool recorded;              /* Pass 2 parsed the whole file */
+    bool uncacheable;
+} CacheFile;
+
+struct BuildCache {
+    CacheEntry *old;            /* Loaded from the cache file */
+    size_t old_count;
+    CacheFile *files;
+    size_t file_count;
+    size_t file_capacity;
+    struct {
+        size_t file;            /* Index into files */
+        uint32_t id;            /* Marks symbols noted in this frame */
+        int error_count;
+        int warning_count;
+    } frames[MAX_INCLUDE_DEPTH];
+    int depth;
+    uint32_t next_id;
+    size_t reused;              /* Files taken from the cache in pass 2 */
+};
+
+/* Grow an array to hold one more element */
+static void *grow(void *array, size_t *capacity, size_t count, size_t size) {
+    if (count < *capacity) return array;
+    size_t new_capacity = *capacity ? *capacity * 2 : 16;
+    void *new_array = as_realloc(array, new_capacity * size);
+    if (!new_array) {
+        fprintf(stderr, "Failed to allocate build cache memory\n");
+        exit(1);
+    }
+    *capacity = new_capacity;
+    return new_array;
+}
+
+static uint64_t fnv_add(uint64_t hash, const char *s, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)s[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/* Hash a macro's parameters and body, the whole of what an expansion uses */
+static uint64_t macro_hash(MacroDef *def) {
+    if (def->hash) return def->hash;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < def->param_count; i++) {
+        hash = fnv_add(hash, def->params[i], strlen(def->params[i]) + 1);
+    }
+    hash = fnv_add(hash, "\n", 1);
+    for (int i = 0; i < def->body_lines; i++) {
+        hash = fnv_add(hash, def->body[i], strlen(def->body[i]) + 1);
+    }
+    def->hash = hash ? hash : 1;
+    return def->hash;
+}
+
+/* Tracking happens in pass 2, inside a file that can still be recorded */
+static void update_tracking(Assembler *as) {
+    BuildCache *cache = as->cache;
+    as->cache_tracking = as->pass == 2 && cache->depth > 0 &&
+        !cache->files[cache->frames[cache->depth - 1].file].uncacheable;
+}
+
+static void entry_free(CacheEntry *entry, bool owns_path) {
+    if (owns_path) free(entry->path);
+    for (size_t i = 0; i < entry->input_count; i++) free(entry->inputs[i].name);
+    for (size_t i = 0; i < entry->output_count; i++) free(entry->outputs[i].name);
+    for (size_t i = 0; i < entry->macro_count; i++) free(entry->macros[i].name);
+    free(entry->inputs);
+    free(entry->outputs);
+    free(entry->macros);
+    output_capture_free(&entry->bytes);
+}
+
+void cache_begin(Assembler *as) {
+    if (as->cache) return;
+    as->cache = as_calloc(1, sizeof(BuildCache));
+    if (!as->cache) {
+        fprintf(stderr, "Failed to allocate build cache\n");
+        exit(1);
+    }
+}
+
+void cache_free(Assembler *as) {
+    BuildCache *cache = as->cache;
+    if (!cache) return;
+    for (size_t i = 0; i < cache->old_count; i++) {
+        entry_free(&cache->old[i], true);
+    }
+    free(cache->old);
+    for (size_t i = 0; i < cache->file_count; i++) {
+        /* Recorded names are borrowed from the symbol table */
+        CacheEntry *entry = &cache->files[i].entry;
+        free(entry->outputs);
+        free(entry->macros);
+        output_capture_free(&entry->bytes);
+        free(cache->files[i].refs);
+    }
+    free(cache->files);
+    free(cache);
+    as->cache = NULL;
+    as->cache_tracking = false;
+}
+
+/* ---- Reading and writing the cache file ---- */
+
+static void read_symbols(BinReader *r, CacheSymbol **out, size_t *count, bool with_line) {
+    *count = bin_read_count(r, 13);
+    *out = *count ? as_calloc(*count, sizeof(CacheSymbol)) : NULL;
+    for (size_t i = 0; i < *count && r->ok; i++) {
+        CacheSymbol *cs = &(*out)[i];
+        cs->name = bin_read_string(r);
+        bin_read_bytes(r, &cs->type, 1);
+        cs->value = (int64_t)bin_read_u64(r);
+        if (with_line) cs->line = (int)bin_read_u32(r);
+    }
+}
+
+static void read_entry(BinReader *r, CacheEntry *entry) {
+    uint8_t max_mode;
+    entry->path = bin_read_string(r);
+    entry->occurrence = bin_read_u32(r);
+    entry->hash = bin_read_u64(r);
+    entry->start_pc = bin_read_u32(r);
+    entry->end_pc = bin_read_u32(r);
+    entry->end_org = bin_read_u32(r);
+    bin_read_bytes(r, &max_mode, 1);
+    entry->max_mode = max_mode != 0;
+
+    read_symbols(r, &entry->inputs, &entry->input_count, false);
+    read_symbols(r, &entry->outputs, &entry->output_count, true);
+
+    entry->macro_count = bin_read_count(r, 12);
+    entry->macros = entry->macro_count ? as_calloc(entry->macro_count, sizeof(CacheMacro)) : NULL;
+    for (size_t i = 0; i < entry->macro_count && r->ok; i++) {
+        entry->macros[i].name = bin_read_string(r);
+        entry->macros[i].hash = bin_read_u64(r);
+    }
+
+    OutputCapture *bytes = &entry->bytes;
+    bytes->run_count = bin_read_count(r, 8);
+    bytes->run_capacity = bytes->run_count;
+    bytes->runs = bytes->run_count ? as_calloc(bytes->run_count, sizeof(OutputRun)) : NULL;
+    for (size_t i = 0; i < bytes->run_count && r->ok; i++) {
+        bytes->runs[i].addr = bin_read_u32(r);
+        bytes->runs[i].length = bin_read_u32(r);
+        bytes->runs[i].offset = bytes->size;
+        bytes->size += bytes->runs[i].length;
+    }
+    if (!r->ok || bytes->size > r->size - r->pos) {
+        r->ok = false;
+        return;
+    }
+    bytes->capacity = bytes->size;
+    bytes->data = as_malloc(bytes->size ? bytes->size : 1);
+    if (!bytes->data) {
+        r->ok = false;
+        return;
+    }
+    bin_read_bytes(r, bytes->data, bytes->size);
+}
+
+/*
+ * Load last build's cache.  A missing, truncated or foreign file is not
+ * an error; the build just starts from nothing.
+ */
+bool cache_load(Assembler *as, const char *path) {
+    cache_begin(as);
+    BuildCache *cache = as->cache;
+
+    BinReader r;
+    if (!bin_load(path, &r)) return false;
+    uint8_t *data = (uint8_t *)r.data;
+
+    char magic[8];
+    bin_read_bytes(&r, magic, sizeof(magic));
+    if (!r.ok || memcmp(magic, CACHE_MAGIC, sizeof(magic)) != 0 || bin_read_u32(&r) != CACHE_VERSION) {
+        free(data);
+        return false;
+    }
+
+    cache->old_count = bin_read_count(&r, 40);
+    cache->old = cache->old_count ? as_calloc(cache->old_count, sizeof(CacheEntry)) : NULL;
+    for (size_t i = 0; i < cache->old_count && r.ok; i++) {
+        read_entry(&r, &cache->old[i]);
+    }
+
+    CacheSymbol *seeds = NULL;
+    size_t seed_count = 0;
+    read_symbols(&r, &seeds, &seed_count, false);
+
+    if (r.ok) {
+        for (size_t i = 0; i < seed_count; i++) {
+            symbol_seed(as, seeds[i].name, (SymbolType)seeds[i].type, seeds[i].value);
+        }
+    } else {
+        for (size_t i = 0; i < cache->old_count; i++) {
+            entry_free(&cache->old[i], true);
+        }
+        free(cache->old);
+        cache->old = NULL;
+        cache->old_count = 0;
+    }
+    for (size_t i = 0; i < seed_count; i++) {
+        free(seeds[i].name);
+    }
+    free(seeds);
+    free(data);
+
+    if (r.ok && as->verbose) {
+        printf("Build cache: %zu files, %zu symbols from %s\n", cache->old_count, seed_count, path);
+    }
+    return r.ok;
+}
+
+static void write_symbol(FILE *fp, const char *name, uint8_t type, int64_t value) {
+    bin_write_string(fp, name);
+    fwrite(&type, 1, 1, fp);
+    bin_write_u64(fp, (uint64_t)value);
+}
+
+static void write_entry(FILE *fp, const CacheEntry *entry) {
+    uint8_t max_mode = entry->max_mode;
+    bin_write_string(fp, entry->path);
+    bin_write_u32(fp, entry->occurrence);
+    bin_write_u64(fp, entry->hash);
+    bin_write_u32(fp, entry->start_pc);
+    bin_write_u32(fp, entry->end_pc);
+    bin_write_u32(fp, entry->end_org);
+    fwrite(&max_mode, 1, 1, fp);
+
+    bin_write_u32(fp, (uint32_t)entry->input_count);
+    for (size_t i = 0; i < entry->input_count; i++) {
+        const CacheSymbol *cs = &entry->inputs[i];
+        write_symbol(fp, cs->name, cs->type, cs->value);
+    }
+    bin_write_u32(fp, (uint32_t)entry->output_count);
+    for (size_t i = 0; i < entry->output_count; i++) {
+        const CacheSymbol *cs = &entry->outputs[i];
+        write_symbol(fp, cs->name, cs->type, cs->value);
+        bin_write_u32(fp, (uint32_t)cs->line);
+    }
+    bin_write_u32(fp, (uint32_t)entry->macro_count);
+    for (size_t i = 0; i < entry->macro_count; i++) {
+        bin_write_string(fp, entry->macros[i].name);
+        bin_write_u64(fp, entry->macros[i].hash);
+    }
+    const OutputCapture *bytes = &entry->bytes;
+    bin_write_u32(fp, (uint32_t)bytes->run_count);
+    for (size_t i = 0; i < bytes->run_count; i++) {
+        bin_write_u32(fp, bytes->runs[i].addr);
+        bin_write_u32(fp, bytes->runs[i].length);
+    }
+    for (size_t i = 0; i < bytes->run_count; i++) {
+        fwrite(bytes->data + bytes->runs[i].offset, 1, bytes->runs[i].length, fp);
+    }
+}
+
+/*
+ * Finish a file pass 2 parsed: its inputs are the referenced symbols it
+ * did not define itself, at their final values.  Returns false if the
+ * recording can't stand in for parsing after all.
+ */
+static bool finish_entry(CacheFile *file) {
+    CacheEntry *entry = &file->entry;
+    for (size_t i = 0; i < entry->output_count; i++) {
+        CacheSymbol *out = &entry->outputs[i];
+        if (out->sym->duplicate || out->sym->type != out->type || out->sym->value != out->value) {
+            return false;
+        }
+    }
+
+    entry->inputs = file->ref_count ? as_calloc(file->ref_count, sizeof(CacheSymbol)) : NULL;
+    entry->input_count = 0;
+    for (size_t i = 0; i < file->ref_count; i++) {
+        Symbol *sym = file->refs[i];
+        bool own = false;
+        for (size_t j = 0; j < entry->output_count && !own; j++) {
+            own = entry->outputs[j].sym == sym;
+        }
+        if (own || sym->type == SYM_MACRO) continue;
+        if (!sym->defined || sym->type == SYM_SET) {
+            free(entry->inputs);
+            entry->inputs = NULL;
+            return false;
+        }
+        CacheSymbol *in = &entry->inputs[entry->input_count++];
+        in->name = (char *)sym->name;
+        in->type = (uint8_t)sym->type;
+        in->value = sym->value;
+    }
+    return true;
+}
+
+/* Write the cache for the build just finished, replacing the old one */
+bool cache_save(Assembler *as, const char *path) {
+    BuildCache *cache = as->cache;
+    if (!cache) return false;
+
+    /* Pinned sizes are not reproducible from the recorded inputs alone */
+    if (as->ir.grow_only) {
+        remove(path);
+        return false;
+    }
+
+    char temp_path[1100];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
+    FILE *fp = fopen(temp_path, "wb");
+    if (!fp) return false;
+
+    fwrite(CACHE_MAGIC, 1, 8, fp);
+    bin_write_u32(fp, CACHE_VERSION);
+
+    size_t count = 0;
+    for (size_t i = 0; i < cache->file_count; i++) {
+        CacheFile *file = &cache->files[i];
+        if (!file->uncacheable && !file->reused && file->recorded && !finish_entry(file)) {
+            file->recorded = false;
+        }
+        if (!file->uncacheable && (file->reused || file->recorded)) {
+            count++;
+        }
+    }
+    bin_write_u32(fp, (uint32_t)count);
+    for (size_t i = 0; i < cache->file_count; i++) {
+        CacheFile *file = &cache->files[i];
+        if (file->uncacheable) continue;
+        if (file->reused) {
+            write_entry(fp, file->reused);
+        } else if (file->recorded) {
+            write_entry(fp, &file->entry);
+            free(file->entry.inputs);
+            file->entry.inputs = NULL;
+            file->entry.input_count = 0;
+        }
+    }
+
+    uint32_t symbols = 0;
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (sym->defined && (sym->type == SYM_LABEL || sym->type == SYM_EQU)) symbols++;
+        }
+    }
+    bin_write_u32(fp, symbols);
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (sym->defined && (sym->type == SYM_LABEL || sym->type == SYM_EQU)) {
+                write_symbol(fp, sym->name, (uint8_t)sym->type, sym->value);
+            }
+        }
+    }
+
+    bool ok = !ferror(fp);
+    ok = fclose(fp) == 0 && ok;
+    if (!ok || rename(temp_path, path) != 0) {
+        remove(temp_path);
+        return false;
+    }
+
+    if (as->verbose) {
+        printf("Build cache: reused %zu of %zu included files, wrote %zu to %s\n",
+               cache->reused, cache->file_count, count, path);
+    }
+    return true;
+}
+
+/* ---- Reuse during assembly ---- */
+
+/* Find this inclusion of a file, creating its record on first sight */
+static size_t find_file(BuildCache *cache, Assembler *as, const char *path) {
+    uint32_t occurrence = 0;
+    for (size_t i = 0; i < cache->file_count; i++) {
+        CacheFile *file = &cache->files[i];
+        if (file->entry.path != path) continue;
+        if (file->seen_sweep != as->sweep) {
+            file->seen_sweep = as->sweep;
+            return i;
+        }
+        occurrence++;
+    }
+
+    cache->files = grow(cache->files, &cache->file_capacity, cache->file_count, sizeof(CacheFile));
+    CacheFile *file = &cache->files[cache->file_count];
+    memset(file, 0, sizeof(*file));
+    file->entry.path = (char *)path;
+    file->entry.occurrence = occurrence;
+    file->seen_sweep = as->sweep;
+    for (size_t i = 0; i < cache->old_count; i++) {
+        if (cache->old[i].occurrence == occurrence && strcmp(cache->old[i].path, path) == 0) {
+            file->old = &cache->old[i];
+            break;
+        }
+    }
+    return cache->file_count++;
+}
+
+/* Does last build's entry describe what parsing the file would do now? */
+static bool entry_applies(Assembler *as, CacheEntry *old, const SourceFile *src) {
+    if (old->hash != src->hash || old->start_pc != as->pc || old->max_mode != as->max_mode) {
+        return false;
+    }
+
+    /* An ORG in the file would set the output base of an empty image */
+    if (as->pass == 2 && as->output_size == 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < old->input_count; i++) {
+        CacheSymbol *in = &old->inputs[i];
+        if (!in->sym) {
+            in->sym = symbol_lookup(as, in->name);
+            if (!in->sym) return false;
+        }
+        if (!in->sym->defined || in->sym->type != in->type || in->sym->value != in->value) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < old->macro_count; i++) {
+        Symbol *macro = macro_lookup(as, old->macros[i].name);
+        if (!macro || macro_hash(macro->macro) != old->macros[i].hash) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Stand in for parsing the file: its symbols, and in pass 2 its bytes */
+static void entry_apply(Assembler *as, const CacheEntry *old, const SourceFile *src) {
+    const char *prev_file = as->current_file;
+    int prev_line = as->current_line;
+    as->current_file = src->path;
+
+    for (size_t i = 0; i < old->output_count; i++) {
+        const CacheSymbol *out = &old->outputs[i];
+        as->current_line = out->line;
+        symbol_define(as, out->name, (SymbolType)out->type, out->value);
+    }
+    if (as->pass == 2) {
+        output_capture_replay(as, &old->bytes);
+    }
+    as->pc = old->end_pc;
+    as->org = old->end_org;
+
+    as->current_file = prev_file;
+    as->current_line = prev_line;
+}
+
+/*
+ * Called as an include starts.  Returns true if the cache supplied the
+ * file; otherwise the caller parses it and calls cache_leave after.
+ */
+bool cache_enter(Assembler *as, SourceFile *src) {
+    BuildCache *cache = as->cache;
+    /* The cache keeps an included file's bytes but not their lines */
+    if (!cache || !src || as->listing || as->compare) return false;
+
+    /* A file that includes others is not recorded itself */
+    if (cache->depth > 0) {
+        cache->files[cache->frames[cache->depth - 1].file].uncacheable = true;
+        as->cache_tracking = false;
+    }
+
+    size_t index = find_file(cache, as, src->path);
+    CacheFile *file = &cache->files[index];
+    file->entry.hash = src->hash;
+
+    if (file->old && !file->uncacheable && entry_applies(as, (CacheEntry *)file->old, src)) {
+        entry_apply(as, file->old, src);
+        if (as->pass == 2) {
+            file->reused = file->old;
+            cache->reused++;
+        }
+        return true;
+    }
+
+    if (cache->depth >= MAX_INCLUDE_DEPTH) {
+        file->uncacheable = true;
+        return false;
+    }
+    cache->frames[cache->depth].file = index;
+    cache->frames[cache->depth].id = ++cache->next_id;
+    cache->frames[cache->depth].error_count = as->error_count;
+    cache->frames[cache->depth].warning_count = as->warning_count;
+    cache->depth++;
+
+    if (as->pass == 2) {
+        CacheEntry *entry = &file->entry;
+        entry->start_pc = as->pc;
+        entry->max_mode = as->max_mode;
+        entry->output_count = 0;
+        entry->macro_count = 0;
+        entry->bytes.run_count = 0;
+        entry->bytes.size = 0;
+        file->ref_count = 0;
+        file->reused = NULL;
+        if (as->output_size == 0) {
+            file->uncacheable = true;
+        }
+    }
+    update_tracking(as);
+    return false;
+}
+
+/* Called when a file cache_enter did not supply has been parsed */
+void cache_leave(Assembler *as) {
+    BuildCache *cache = as->cache;
+    if (!cache || cache->depth == 0) return;
+
+    cache->depth--;
+    CacheFile *file = &cache->files[cache->frames[cache->depth].file];
+    if (as->error_count != cache->frames[cache->depth].error_count ||
+        as->warning_count != cache->frames[cache->depth].warning_count) {
+        file->uncacheable = true;
+    }
+    if (as->pass == 2 && !file->uncacheable) {
+        file->entry.end_pc = as->pc;
+        file->entry.end_org = as->org;
+        file->recorded = true;
+    }
+    update_tracking(as);
+}
+
+/* The file being recorded looked up a symbol */
+void cache_note_ref(Assembler *as, Symbol *sym) {
+    BuildCache *cache = as->cache;
+    uint32_t id = cache->frames[cache->depth - 1].id;
+    if (sym->cache_ref == id) return;
+    sym->cache_ref = id;
+
+    CacheFile *file = &cache->files[cache->frames[cache->depth - 1].file];
+    if (sym->type == SYM_SET) {
+        file->uncacheable = true;
+        as->cache_tracking = false;
+        return;
+    }
+    file->refs = grow(file->refs, &file->ref_capacity, file->ref_count, sizeof(Symbol *));
+    file->refs[file->ref_count++] = sym;
+}
+
+/* The file being recorded defined a symbol */
+void cache_note_def(Assembler *as, Symbol *sym) {
+    BuildCache *cache = as->cache;
+    uint32_t id = cache->frames[cache->depth - 1].id;
+    if (sym->cache_def == id) return;
+    sym->cache_def = id;
+
+    CacheFile *file = &cache->files[cache->frames[cache->depth - 1].file];
+    if (sym->type != SYM_LABEL && sym->type != SYM_EQU) {
+        file->uncacheable = true;
+        as->cache_tracking = false;
+        return;
+    }
+    CacheEntry *entry = &file->entry;
+    entry->outputs = grow(entry->outputs, &entry->output_capacity, entry->output_count,
+                          sizeof(CacheSymbol));
+    CacheSymbol *out = &entry->outputs[entry->output_count++];
+    out->name = (char *)sym->name;
+    out->type = (uint8_t)sym->type;
+    out->value = sym->value;
+    out->line = as->current_line;
+    out->sym = sym;
+}
+
+/* The file being recorded expanded a macro */
+void cache_note_macro(Assembler *as, Symbol *macro) {
+    BuildCache *cache = as->cache;
+    CacheEntry *entry = &cache->files[cache->frames[cache->depth - 1].file].entry;
+    for (size_t i = 0; i < entry->macro_count; i++) {
+        if (strcmp(entry->macros[i].name, macro->name) == 0) return;
+    }
+    entry->macros = grow(entry->macros, &entry->macro_capacity, entry->macro_count,
+                         sizeof(CacheMacro));
+    entry->macros[entry->macro_count].name = (char *)macro->name;
+    entry->macros[entry->macro_count].hash = macro_hash(macro->macro);
+    entry->macro_count++;
+}
+
+/* The file being recorded wrote bytes (data, or len copies of fill) */
+void cache_note_output(Assembler *as, uint32_t addr, const uint8_t *data, uint8_t fill, size_t len) {
+    BuildCache *cache = as->cache;
+    CacheEntry *entry = &cache->files[cache->frames[cache->depth - 1].file].entry;
+
+    output_capture_add(&entry->bytes, addr, data, fill, len);
+}
+
+/* Something in the current file can't be replayed from a recording */
+void cache_note_volatile(Assembler *as) {
+    BuildCache *cache = as->cache;
+    if (cache->depth == 0) return;
+    cache->files[cache->frames[cache->depth - 1].file].uncacheable = true;
+    as->cache_tracking = false;
+}
@@ -168,6 +168,18 @@ static bool emit_compact_mem_disp(Assembler *as, Operand *op) {
     return true;
 }
 
+/* Minimal direct address size (8, 16 or 24) for an operand without a suffix.
+ * 8-bit addresses are only used for constants (EQU values, literals). */
+int direct_addr_size(const Operand *op) {
+    int addr = (int)op->value;
+    if (addr <= 0xFF && op->is_constant) {
+        return 8;
+    } else if (addr <= 0xFFFF) {
+        return 16;
+    }
+    return 24;
+}
+
 /* Emit memory operand encoding */
 static bool emit_mem_operand(Assembler *as, Operand *op) {
     switch (op->mode) {
@@ -242,19 +254,11 @@ static bool emit_mem_operand(Assembler *as, Operand *op) {
             int addr_size = op->addr_size;
             if (addr_size == 0) {
                 /*
-                 * Determine addressing size using relaxation approach:
-                 * - Use optimal (minimal) sizes based on actual values
-                 * - If sizes change between iterations, we'll iterate again
-                 * - This produces smaller code than conservative approach
+                 * Use optimal (minimal) sizes based on actual values; the
+                 * relaxation sweeps in pass 1 re-size dependents until the
+                 * symbol values stop changing.
                  */
-                if (addr <= 0xFF && op->is_constant) {
-                    /* 8-bit only for known constants (EQU values, literals) */
-                    addr_size = 8;
-                } else if (addr <= 0xFFFF) {
-                    addr_size = 16;
-                } else {
-                    addr_size = 24;
-                }
+                addr_size = direct_addr_size(op);
             }
             /* Use 38/39/3A encoding for direct addressing in memory operands.
              * This is used after prefix bytes (like F5 for LDA, 90 for word ops).
@@ -299,13 +303,7 @@ static bool emit_direct_mem_operand(Assembler *as, Operand *op, OperandSize data
 
     /* Determine address size if not specified */
     if (addr_size == 0) {
-        if (addr <= 0xFF && op->is_constant) {
-            addr_size = 8;
-        } else if (addr <= 0xFFFF) {
-            addr_size = 16;
-        } else {
-            addr_size = 24;
-        }
+        addr_size = direct_addr_size(op);
     }
 
     /* Get address size code (0=8bit, 1=16bit, 2=24bit) */
@@ -1480,9 +1478,9 @@ static bool encode_ldc(Assembler *as, Operand *ops, int count) {
     int cr_code = -1;
 
     /* LDC cr, reg - load control register from general register */
-    if (ops[0].mode == ADDR_IMMEDIATE && ops[0].symbol[0] != '\0') {
+    if (ops[0].mode == ADDR_IMMEDIATE && ops[0].symbol) {
         int reg_size = ops[1].size;
-        cr_code = get_ctrl_reg_code(ops[0].symbol, reg_size);
+        cr_code = get_ctrl_reg_code(strpool_text(&as->strings, ops[0].symbol), reg_size);
 
         if (cr_code >= 0 && ops[1].mode == ADDR_REGISTER) {
             /* 32-bit register source */
@@ -1519,9 +1517,9 @@ static bool encode_ldc(Assembler *as, Operand *ops, int count) {
     }
 
     /* LDC reg, cr - load general register from control register */
-    if (ops[1].mode == ADDR_IMMEDIATE && ops[1].symbol[0] != '\0') {
+    if (ops[1].mode == ADDR_IMMEDIATE && ops[1].symbol) {
         int reg_size = ops[0].size;
-        cr_code = get_ctrl_reg_code(ops[1].symbol, reg_size);
+        cr_code = get_ctrl_reg_code(strpool_text(&as->strings, ops[1].symbol), reg_size);
 
         if (cr_code >= 0 && ops[0].mode == ADDR_REGISTER) {
             /* 32-bit register destination */
@@ -1807,952 +1805,360 @@ static bool encode_ex(Assembler *as, Operand *ops, int count) {
 
 /* ============== Arithmetic Instructions ============== */
 
-/* ADD */
-static bool encode_add(Assembler *as, Operand *ops, int count) {
+/*
+ * ADD, ADC, SUB, SBC, AND, OR, XOR and CP share one encoder.  The operand
+ * pair is classified into a form once, and the operation byte comes
+ * from alu_ops[operation].op[form][size]; the prefix and operand bytes
+ * around it follow the same layout for every operation.
+ */
+
+typedef enum {
+    ALU_ADD, ALU_ADC, ALU_SUB, ALU_SBC, ALU_AND, ALU_OR, ALU_XOR, ALU_CP
+} AluOperation;
+
+typedef enum {
+    ALU_REG_IMM,        /* r, #n */
+    ALU_REG_REG,        /* r, r */
+    ALU_REG_DIRECT,     /* r, (n) using the compact C0/D0/E0 prefix */
+    ALU_REG_MEM,        /* r, (mem) */
+    ALU_MEM_REG,        /* (mem), r */
+    ALU_REG_MEM_COMPACT,/* xrr, (mem) using the compact A0+mode prefix */
+    ALU_MEM_REG_COMPACT,/* (mem), xrr using the compact A0+mode prefix */
+    ALU_MEM_IMM,        /* (mem), #n (byte) */
+    ALU_FORM_COUNT
+} AluForm;
+
+#define ALU_NONE        0x100   /* No encoding for this form and size */
+
+/* Operation quirks */
+#define ALU_SPLIT_IMM8  0x01    /* Byte r,#n is C8+(r>>1), op+(r&1) */
+#define ALU_ZERO_SHORT  0x02    /* r,#0 is the one-byte D8 form */
+
+#define MODE_BIT(m)     (1u << (m))
+#define ALU_MEM_MODES   (MODE_BIT(ADDR_REGISTER_IND) | MODE_BIT(ADDR_INDEXED))
+#define ALU_INCDEC      (MODE_BIT(ADDR_REGISTER_IND_INC) | MODE_BIT(ADDR_REGISTER_IND_DEC))
+#define ALU_DIRECT      MODE_BIT(ADDR_DIRECT)
+
+/* Same operation byte for byte, word and long, or for word and long only */
+#define ALU_ALL(op)     {(op), (op), (op)}
+#define ALU_WL(b, wl)   {(b), (wl), (wl)}
+#define ALU_NO          {ALU_NONE, ALU_NONE, ALU_NONE}
+
+typedef struct {
+    const char *name;
+    uint8_t flags;
+    uint8_t mem_imm_prefix;     /* Prefix byte for (mem),#n */
+    uint32_t src_modes;         /* Memory modes accepted by r,(mem) */
+    uint32_t dst_modes;         /* Memory modes accepted by (mem),r */
+    uint32_t imm_modes;         /* Memory modes accepted by (mem),#n */
+    uint16_t op[ALU_FORM_COUNT][3];  /* Indexed by form and byte/word/long */
+} AluOp;
+
+static const AluOp alu_ops[] = {
+    [ALU_ADD] = {"ADD", 0, 0,
+        ALU_MEM_MODES | ALU_INCDEC, ALU_MEM_MODES | ALU_INCDEC | ALU_DIRECT, 0, {
+        [ALU_REG_IMM] = ALU_ALL(0xC8), [ALU_REG_REG] = ALU_ALL(0x80),
+        [ALU_REG_DIRECT] = ALU_ALL(0x80),
+        [ALU_REG_MEM] = ALU_ALL(0x00), [ALU_MEM_REG] = ALU_ALL(0x08),
+        [ALU_REG_MEM_COMPACT] = ALU_ALL(0x80), [ALU_MEM_REG_COMPACT] = ALU_ALL(0x88),
+        [ALU_MEM_IMM] = ALU_NO}},
+    [ALU_ADC] = {"ADC", ALU_SPLIT_IMM8, 0,
+        ALU_MEM_MODES | ALU_INCDEC | ALU_DIRECT, ALU_MEM_MODES | ALU_INCDEC | ALU_DIRECT, 0, {
+        [ALU_REG_IMM] = ALU_ALL(0xC0), [ALU_REG_REG] = ALU_ALL(0x88),
+        [ALU_REG_DIRECT] = ALU_NO,
+        [ALU_REG_MEM] = ALU_WL(0x01, 0x10), [ALU_MEM_REG] = ALU_WL(0x09, 0x18),
+        [ALU_REG_MEM_COMPACT] = ALU_ALL(0x90), [ALU_MEM_REG_COMPACT] = ALU_ALL(0x98),
+        [ALU_MEM_IMM] = ALU_NO}},
+    [ALU_SUB] = {"SUB", 0, 0,
+        ALU_MEM_MODES | ALU_INCDEC, ALU_MEM_MODES | ALU_INCDEC | ALU_DIRECT, 0, {
+        [ALU_REG_IMM] = ALU_ALL(0xCA), [ALU_REG_REG] = ALU_ALL(0x90),
+        [ALU_REG_DIRECT] = ALU_ALL(0xA0),
+        [ALU_REG_MEM] = ALU_WL(0x02, 0x20), [ALU_MEM_REG] = ALU_WL(0x0A, 0x28),
+        [ALU_REG_MEM_COMPACT] = ALU_ALL(0xA0), [ALU_MEM_REG_COMPACT] = ALU_ALL(0xA8),
+        [ALU_MEM_IMM] = ALU_NO}},
+    [ALU_SBC] = {"SBC", ALU_SPLIT_IMM8, 0,
+        ALU_MEM_MODES | ALU_INCDEC | ALU_DIRECT, ALU_MEM_MODES | ALU_INCDEC | ALU_DIRECT, 0, {
+        [ALU_REG_IMM] = {0xC2, 0xC2, ALU_NONE}, [ALU_REG_REG] = ALU_ALL(0x98),
+        [ALU_REG_DIRECT] = ALU_NO,
+        [ALU_REG_MEM] = ALU_WL(0x03, 0x30), [ALU_MEM_REG] = ALU_WL(0x0B, 0x38),
+        [ALU_REG_MEM_COMPACT] = ALU_ALL(0xB0), [ALU_MEM_REG_COMPACT] = ALU_ALL(0xB8),
+        [ALU_MEM_IMM] = ALU_NO}},
+    [ALU_AND] = {"AND", 0, 0xB0,
+        ALU_MEM_MODES, ALU_MEM_MODES | ALU_DIRECT, ALU_MEM_MODES | ALU_DIRECT, {
+        [ALU_REG_IMM] = ALU_ALL(0xCC), [ALU_REG_REG] = ALU_WL(0xA0, 0xC0),
+        [ALU_REG_DIRECT] = ALU_ALL(0xC0),
+        [ALU_REG_MEM] = ALU_WL(0x04, 0x40), [ALU_MEM_REG] = ALU_WL(0x0C, 0x48),
+        [ALU_REG_MEM_COMPACT] = ALU_NO, [ALU_MEM_REG_COMPACT] = ALU_NO,
+        [ALU_MEM_IMM] = ALU_ALL(0x2C)}},
+    [ALU_OR] = {"OR", 0, 0xB0,
+        ALU_MEM_MODES, ALU_MEM_MODES | ALU_DIRECT, ALU_MEM_MODES | ALU_DIRECT, {
+        [ALU_REG_IMM] = ALU_ALL(0xCE), [ALU_REG_REG] = ALU_WL(0xA8, 0xC8),
+        [ALU_REG_DIRECT] = ALU_ALL(0xE0),
+        [ALU_REG_MEM] = ALU_WL(0x06, 0x60), [ALU_MEM_REG] = ALU_WL(0x0E, 0x68),
+        [ALU_REG_MEM_COMPACT] = ALU_NO, [ALU_MEM_REG_COMPACT] = ALU_NO,
+        [ALU_MEM_IMM] = ALU_ALL(0x2E)}},
+    [ALU_XOR] = {"XOR", 0, 0xB0,
+        ALU_MEM_MODES, ALU_MEM_MODES | ALU_DIRECT, ALU_MEM_MODES | ALU_DIRECT, {
+        [ALU_REG_IMM] = ALU_ALL(0xCD), [ALU_REG_REG] = ALU_WL(0xB8, 0xD0),
+        [ALU_REG_DIRECT] = ALU_ALL(0xD0),
+        [ALU_REG_MEM] = ALU_WL(0x10, 0x80), [ALU_MEM_REG] = ALU_WL(0x18, 0x88),
+        [ALU_REG_MEM_COMPACT] = ALU_NO, [ALU_MEM_REG_COMPACT] = ALU_NO,
+        [ALU_MEM_IMM] = ALU_ALL(0x30)}},
+    [ALU_CP] = {"CP", ALU_ZERO_SHORT, 0x80,
+        ALU_MEM_MODES, ALU_MEM_MODES | ALU_DIRECT, ALU_MEM_MODES | ALU_DIRECT, {
+        [ALU_REG_IMM] = ALU_ALL(0xCF), [ALU_REG_REG] = ALU_ALL(0xB0),
+        [ALU_REG_DIRECT] = ALU_ALL(0xF0),
+        [ALU_REG_MEM] = ALU_ALL(0x70), [ALU_MEM_REG] = ALU_ALL(0x78),
+        [ALU_REG_MEM_COMPACT] = ALU_ALL(0xF0), [ALU_MEM_REG_COMPACT] = ALU_ALL(0xF8),
+        [ALU_MEM_IMM] = ALU_ALL(0x38)}},
+};
+
+/* Register code for a byte/word/long operand, -1 if it has no such form */
+static int alu_reg_code(const Operand *op, int size_index) {
+    switch (size_index) {
+        case 0: return get_reg8_code(op->reg);
+        case 1: return get_reg16_code(op->reg);
+        default: return get_reg32_code(op->reg);
+    }
+}
+
+/* Classify the operand pair, -1 if the operation has no such form */
+static int alu_form(const AluOp *alu, const Operand *dst, const Operand *src) {
+    uint32_t dst_bit = MODE_BIT(dst->mode);
+    uint32_t src_bit = MODE_BIT(src->mode);
+
+    if (dst->mode == ADDR_REGISTER) {
+        if (src->mode == ADDR_IMMEDIATE) return ALU_REG_IMM;
+        if (src->mode == ADDR_REGISTER) return ALU_REG_REG;
+        if (src->mode == ADDR_DIRECT && alu->op[ALU_REG_DIRECT][0] != ALU_NONE) return ALU_REG_DIRECT;
+        if (alu->src_modes & src_bit) return ALU_REG_MEM;
+    } else if (src->mode == ADDR_REGISTER) {
+        if (alu->dst_modes & dst_bit) return ALU_MEM_REG;
+    } else if (src->mode == ADDR_IMMEDIATE) {
+        if (alu->imm_modes & dst_bit) return ALU_MEM_IMM;
+    }
+    return -1;
+}
+
+static bool encode_alu(Assembler *as, AluOperation operation, Operand *ops, int count) {
+    const AluOp *alu = &alu_ops[operation];
+
     if (count < 2) {
-        error(as, "ADD requires two operands");
+        error(as, "%s requires two operands", alu->name);
         return false;
     }
 
     Operand *dst = &ops[0];
     Operand *src = &ops[1];
+    int form = alu_form(alu, dst, src);
 
-    /* ADD reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + code);  /* Use full register code */
-                emit_byte(as, 0xC8);  /* ADD with immediate operation */
-                emit_byte(as, (uint8_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0xC8);  /* ADD with immediate operation */
-                emit_word(as, (uint16_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xE8 + code);
-                emit_byte(as, 0xC8);  /* ADD with immediate operation */
-                emit_long(as, (uint32_t)src->value);
-                return true;
-            }
-        }
+    /* (mem), #n is byte-sized whatever the operands say */
+    if (form == ALU_MEM_IMM) {
+        emit_byte(as, alu->mem_imm_prefix);
+        emit_mem_operand(as, dst);
+        emit_byte(as, alu->op[ALU_MEM_IMM][0]);
+        emit_byte(as, (uint8_t)src->value);
+        return true;
     }
 
-    /* ADD reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_BYTE && src->size == SIZE_BYTE) {
-            int dcode = get_reg8_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0x80 + ((scode & 1) << 3) + ((dcode >> 1) << 1) + (dcode & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x80 + dcode);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG && src->size == SIZE_LONG) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg32_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xE8 + scode);
-                emit_byte(as, 0x80 + dcode);
-                return true;
-            }
-        }
+    /* The register operand sets the size */
+    Operand *reg = (form == ALU_MEM_REG) ? src : dst;
+    Operand *mem = (form == ALU_MEM_REG) ? dst : src;
+    int size_index = reg->size == SIZE_BYTE ? 0 : reg->size == SIZE_WORD ? 1 :
+                     reg->size == SIZE_LONG ? 2 : -1;
+    if (form < 0 || size_index < 0 || alu->op[form][size_index] == ALU_NONE) {
+        error(as, "unsupported %s operand combination", alu->name);
+        return false;
+    }
+    if (form == ALU_REG_REG && src->size != dst->size) {
+        error(as, "unsupported %s operand combination", alu->name);
+        return false;
     }
 
-    /* ADD reg, (direct) - compact encoding for direct addressing */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_DIRECT) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_BYTE);
-                emit_byte(as, 0x80 + code);  /* Byte ADD operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_WORD);
-                emit_byte(as, 0x80 + code);  /* Word ADD operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_LONG);
-                emit_byte(as, 0x80 + code);  /* Long ADD operation */
-                return true;
-            }
-        }
+    int code = alu_reg_code(reg, size_index);
+    int op = alu->op[form][size_index];
+    if (code < 0) {
+        error(as, "unsupported %s operand combination", alu->name);
+        return false;
     }
 
-    /* ADD reg, (mem) - register indirect, indexed, etc. */
-    if (dst->mode == ADDR_REGISTER &&
-        (src->mode == ADDR_REGISTER_IND || src->mode == ADDR_INDEXED ||
-         src->mode == ADDR_REGISTER_IND_INC || src->mode == ADDR_REGISTER_IND_DEC)) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x00 + (code & 1));
-                return true;
+    switch (form) {
+        case ALU_REG_IMM:
+            if (size_index == 0 && (alu->flags & ALU_SPLIT_IMM8)) {
+                emit_byte(as, 0xC8 + (code >> 1));
+                op += code & 1;
+            } else {
+                emit_byte(as, (size_index == 0 ? 0xC8 : size_index == 1 ? 0xD8 : 0xE8) + code);
             }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x00 + code);
+            if ((alu->flags & ALU_ZERO_SHORT) && src->value == 0) {
+                emit_byte(as, 0xD8);  /* Short form: op reg, 0 */
                 return true;
             }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            int mem_mode = get_compact_mem_mode(src);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, 80+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, src);
-                    emit_byte(as, 0x80 + code);  /* Compact ADD opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, src);
-                    emit_byte(as, 0x00 + code);
-                }
-                return true;
+            emit_byte(as, op);
+            if (size_index == 0) emit_byte(as, (uint8_t)src->value);
+            else if (size_index == 1) emit_word(as, (uint16_t)src->value);
+            else emit_long(as, (uint32_t)src->value);
+            return true;
+
+        case ALU_REG_REG: {
+            int scode = alu_reg_code(src, size_index);
+            if (scode < 0) break;
+            if (size_index == 0) {
+                emit_byte(as, 0xC8 + (scode >> 1));
+                emit_byte(as, op + ((scode & 1) << 3) + ((code >> 1) << 1) + (code & 1));
+            } else {
+                emit_byte(as, (size_index == 1 ? 0xD8 : 0xE8) + scode);
+                emit_byte(as, op + code);
             }
+            return true;
         }
-    }
 
-    /* ADD (mem), reg */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_REGISTER_IND_INC || dst->mode == ADDR_REGISTER_IND_DEC ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_REGISTER) {
-        if (src->size == SIZE_BYTE) {
-            int code = get_reg8_code(src->reg);
-            if (code >= 0) {
+        case ALU_REG_DIRECT:
+            emit_direct_mem_operand(as, src, reg->size);
+            emit_byte(as, op + code);
+            return true;
+
+        case ALU_REG_MEM:
+        case ALU_MEM_REG: {
+            int compact = form == ALU_REG_MEM ? ALU_REG_MEM_COMPACT : ALU_MEM_REG_COMPACT;
+            if (size_index == 0) {
                 emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x08 + (code & 1));
-                return true;
-            }
-        } else if (src->size == SIZE_WORD) {
-            int code = get_reg16_code(src->reg);
-            if (code >= 0) {
+                emit_mem_operand(as, mem);
+                emit_byte(as, op + (code & 1));
+            } else if (size_index == 1) {
                 emit_byte(as, 0x90);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x08 + code);
-                return true;
-            }
-        } else if (src->size == SIZE_LONG) {
-            int code = get_reg32_code(src->reg);
-            int mem_mode = get_compact_mem_mode(dst);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, 88+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, dst);
-                    emit_byte(as, 0x88 + code);  /* Compact ADD (mem), reg opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, dst);
-                    emit_byte(as, 0x08 + code);
-                }
-                return true;
+                emit_mem_operand(as, mem);
+                emit_byte(as, op + code);
+            } else if (alu->op[compact][2] != ALU_NONE && get_compact_mem_mode(mem) >= 0) {
+                /* Compact encoding: A0+mode, displacement, op+code */
+                emit_byte(as, 0xA0 + get_compact_mem_mode(mem));
+                emit_compact_mem_disp(as, mem);
+                emit_byte(as, alu->op[compact][2] + code);
+            } else {
+                emit_byte(as, 0xA0);
+                emit_mem_operand(as, mem);
+                emit_byte(as, op + code);
             }
+            return true;
         }
     }
 
-    error(as, "unsupported ADD operand combination");
+    error(as, "unsupported %s operand combination", alu->name);
     return false;
 }
 
+/* ADD */
+static bool encode_add(Assembler *as, Operand *ops, int count) {
+    return encode_alu(as, ALU_ADD, ops, count);
+}
+
 /* ADC - Add with carry */
 static bool encode_adc(Assembler *as, Operand *ops, int count) {
+    return encode_alu(as, ALU_ADC, ops, count);
+}
+
+/* SUB */
+static bool encode_sub(Assembler *as, Operand *ops, int count) {
+    return encode_alu(as, ALU_SUB, ops, count);
+}
+
+/* SBC - Subtract with carry */
+static bool encode_sbc(Assembler *as, Operand *ops, int count) {
+    return encode_alu(as, ALU_SBC, ops, count);
+}
+
+/* CP - Compare */
+static bool encode_cp(Assembler *as, Operand *ops, int count) {
+    return encode_alu(as, ALU_CP, ops, count);
+}
+
+/* CPW - Compare Word (for word-sized memory comparisons) */
+static bool encode_cpw(Assembler *as, Operand *ops, int count) {
     if (count < 2) {
-        error(as, "ADC requires two operands");
+        error(as, "CPW requires two operands");
         return false;
     }
 
     Operand *dst = &ops[0];
     Operand *src = &ops[1];
 
-    /* ADC reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
+    /* CPW (direct), imm - compact encoding for direct addressing */
+    if (dst->mode == ADDR_DIRECT && src->mode == ADDR_IMMEDIATE) {
+        emit_direct_mem_operand(as, dst, SIZE_WORD);
+        emit_byte(as, 0x38);  /* CPW opcode */
+        emit_word(as, (uint16_t)src->value);
+        return true;
+    }
+
+    /* CPW (mem), imm - register indirect, indexed */
+    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED) &&
+        src->mode == ADDR_IMMEDIATE) {
+        emit_byte(as, 0x90);  /* Word memory prefix */
+        emit_mem_operand(as, dst);
+        emit_byte(as, 0x38);  /* CPW opcode */
+        emit_word(as, (uint16_t)src->value);
+        return true;
+    }
+
+    error(as, "unsupported CPW operand combination");
+    return false;
+}
+
+/* INC */
+static bool encode_inc(Assembler *as, Operand *ops, int count) {
+    if (count < 1) {
+        error(as, "INC requires an operand");
+        return false;
+    }
+
+    int inc_val = 1;
+    Operand *target = &ops[0];
+
+    /* Handle both "INC reg" and "INC n, reg/mem" syntax */
+    if (count >= 2) {
+        if (ops[0].mode == ADDR_IMMEDIATE) {
+            /* INC n, target - increment amount first */
+            inc_val = (int)ops[0].value;
+            target = &ops[1];
+        } else if (ops[1].mode == ADDR_IMMEDIATE) {
+            /* INC target, n - target first */
+            inc_val = (int)ops[1].value;
+        }
+    }
+
+    if (target->mode == ADDR_REGISTER) {
+        if (target->size == SIZE_BYTE) {
+            int code = get_reg8_code(target->reg);
             if (code >= 0) {
                 emit_byte(as, 0xC8 + (code >> 1));
-                emit_byte(as, 0xC0 + (code & 1));
-                emit_byte(as, (uint8_t)src->value);
+                emit_byte(as, 0x60 + (code & 1));
+                emit_byte(as, (uint8_t)inc_val);
                 return true;
             }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
+        } else if (target->size == SIZE_WORD) {
+            int code = get_reg16_code(target->reg);
             if (code >= 0) {
                 emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0xC0);
-                emit_word(as, (uint16_t)src->value);
+                /* Compact encoding: 0x61-0x68 for INC 1-8 */
+                if (inc_val >= 1 && inc_val <= 8) {
+                    emit_byte(as, 0x60 + inc_val);
+                } else {
+                    emit_byte(as, 0x60);
+                    emit_byte(as, (uint8_t)inc_val);
+                }
                 return true;
             }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
+        } else if (target->size == SIZE_LONG) {
+            int code = get_reg32_code(target->reg);
             if (code >= 0) {
                 emit_byte(as, 0xE8 + code);
-                emit_byte(as, 0xC0);
-                emit_long(as, (uint32_t)src->value);
-                return true;
-            }
-        }
-    }
-
-    /* ADC reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_BYTE && src->size == SIZE_BYTE) {
-            int dcode = get_reg8_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0x88 + ((scode & 1) << 3) + ((dcode >> 1) << 1) + (dcode & 1));
-                return true;
-            }
-        }
-        if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x88 + dcode);
-                return true;
-            }
-        }
-        if (dst->size == SIZE_LONG && src->size == SIZE_LONG) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg32_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xE8 + scode);
-                emit_byte(as, 0x88 + dcode);
-                return true;
-            }
-        }
-    }
-
-    /* ADC reg, (mem) */
-    if (dst->mode == ADDR_REGISTER &&
-        (src->mode == ADDR_REGISTER_IND || src->mode == ADDR_INDEXED ||
-         src->mode == ADDR_REGISTER_IND_INC || src->mode == ADDR_REGISTER_IND_DEC ||
-         src->mode == ADDR_DIRECT)) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x01 + (code & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x10 + code);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            int mem_mode = get_compact_mem_mode(src);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, 90+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, src);
-                    emit_byte(as, 0x90 + code);  /* Compact ADC reg,(mem) opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, src);
-                    emit_byte(as, 0x10 + code);
-                }
-                return true;
-            }
-        }
-    }
-
-    /* ADC (mem), reg */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_REGISTER_IND_INC || dst->mode == ADDR_REGISTER_IND_DEC ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_REGISTER) {
-        if (src->size == SIZE_BYTE) {
-            int code = get_reg8_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x09 + (code & 1));
-                return true;
-            }
-        } else if (src->size == SIZE_WORD) {
-            int code = get_reg16_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x18 + code);
-                return true;
-            }
-        } else if (src->size == SIZE_LONG) {
-            int code = get_reg32_code(src->reg);
-            int mem_mode = get_compact_mem_mode(dst);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, 98+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, dst);
-                    emit_byte(as, 0x98 + code);  /* Compact ADC (mem),reg opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, dst);
-                    emit_byte(as, 0x18 + code);
-                }
-                return true;
-            }
-        }
-    }
-
-    error(as, "unsupported ADC operand combination");
-    return false;
-}
-
-/* SUB */
-static bool encode_sub(Assembler *as, Operand *ops, int count) {
-    if (count < 2) {
-        error(as, "SUB requires two operands");
-        return false;
-    }
-
-    Operand *dst = &ops[0];
-    Operand *src = &ops[1];
-
-    /* SUB reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + code);  /* Use full register code */
-                emit_byte(as, 0xCA);  /* SUB with immediate operation */
-                emit_byte(as, (uint8_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0xCA);  /* SUB with immediate operation */
-                emit_word(as, (uint16_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xE8 + code);
-                emit_byte(as, 0xCA);  /* SUB with immediate operation */
-                emit_long(as, (uint32_t)src->value);
-                return true;
-            }
-        }
-    }
-
-    /* SUB reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_BYTE && src->size == SIZE_BYTE) {
-            int dcode = get_reg8_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0x90 + ((scode & 1) << 3) + ((dcode >> 1) << 1) + (dcode & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x90 + dcode);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG && src->size == SIZE_LONG) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg32_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xE8 + scode);
-                emit_byte(as, 0x90 + dcode);
-                return true;
-            }
-        }
-    }
-
-    /* SUB reg, (direct) - compact encoding for direct addressing */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_DIRECT) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_BYTE);
-                emit_byte(as, 0xA0 + code);  /* Byte SUB operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_WORD);
-                emit_byte(as, 0xA0 + code);  /* Word SUB operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_LONG);
-                emit_byte(as, 0xA0 + code);  /* Long SUB operation */
-                return true;
-            }
-        }
-    }
-
-    /* SUB reg, (mem) - register indirect, indexed */
-    if (dst->mode == ADDR_REGISTER &&
-        (src->mode == ADDR_REGISTER_IND || src->mode == ADDR_INDEXED ||
-         src->mode == ADDR_REGISTER_IND_INC || src->mode == ADDR_REGISTER_IND_DEC)) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x02 + (code & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x20 + code);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            int mem_mode = get_compact_mem_mode(src);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, A0+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, src);
-                    emit_byte(as, 0xA0 + code);  /* Compact SUB opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, src);
-                    emit_byte(as, 0x20 + code);
-                }
-                return true;
-            }
-        }
-    }
-
-    /* SUB (mem), reg */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_REGISTER_IND_INC || dst->mode == ADDR_REGISTER_IND_DEC ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_REGISTER) {
-        if (src->size == SIZE_BYTE) {
-            int code = get_reg8_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x0A + (code & 1));
-                return true;
-            }
-        } else if (src->size == SIZE_WORD) {
-            int code = get_reg16_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x28 + code);
-                return true;
-            }
-        } else if (src->size == SIZE_LONG) {
-            int code = get_reg32_code(src->reg);
-            int mem_mode = get_compact_mem_mode(dst);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, A8+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, dst);
-                    emit_byte(as, 0xA8 + code);  /* Compact SUB (mem), reg opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, dst);
-                    emit_byte(as, 0x28 + code);
-                }
-                return true;
-            }
-        }
-    }
-
-    error(as, "unsupported SUB operand combination");
-    return false;
-}
-
-/* SBC - Subtract with carry */
-static bool encode_sbc(Assembler *as, Operand *ops, int count) {
-    if (count < 2) {
-        error(as, "SBC requires two operands");
-        return false;
-    }
-
-    Operand *dst = &ops[0];
-    Operand *src = &ops[1];
-
-    /* SBC reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + (code >> 1));
-                emit_byte(as, 0xC2 + (code & 1));
-                emit_byte(as, (uint8_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0xC2);
-                emit_word(as, (uint16_t)src->value);
-                return true;
-            }
-        }
-    }
-
-    /* SBC reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_BYTE && src->size == SIZE_BYTE) {
-            int dcode = get_reg8_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0x98 + ((scode & 1) << 3) + ((dcode >> 1) << 1) + (dcode & 1));
-                return true;
-            }
-        }
-        if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x98 + dcode);
-                return true;
-            }
-        }
-        if (dst->size == SIZE_LONG && src->size == SIZE_LONG) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg32_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xE8 + scode);
-                emit_byte(as, 0x98 + dcode);
-                return true;
-            }
-        }
-    }
-
-    /* SBC reg, (mem) */
-    if (dst->mode == ADDR_REGISTER &&
-        (src->mode == ADDR_REGISTER_IND || src->mode == ADDR_INDEXED ||
-         src->mode == ADDR_REGISTER_IND_INC || src->mode == ADDR_REGISTER_IND_DEC ||
-         src->mode == ADDR_DIRECT)) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x03 + (code & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x30 + code);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            int mem_mode = get_compact_mem_mode(src);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, B0+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, src);
-                    emit_byte(as, 0xB0 + code);  /* Compact SBC reg,(mem) opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, src);
-                    emit_byte(as, 0x30 + code);
-                }
-                return true;
-            }
-        }
-    }
-
-    /* SBC (mem), reg */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_REGISTER_IND_INC || dst->mode == ADDR_REGISTER_IND_DEC ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_REGISTER) {
-        if (src->size == SIZE_BYTE) {
-            int code = get_reg8_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x0B + (code & 1));
-                return true;
-            }
-        } else if (src->size == SIZE_WORD) {
-            int code = get_reg16_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x38 + code);
-                return true;
-            }
-        } else if (src->size == SIZE_LONG) {
-            int code = get_reg32_code(src->reg);
-            int mem_mode = get_compact_mem_mode(dst);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, B8+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, dst);
-                    emit_byte(as, 0xB8 + code);  /* Compact SBC (mem),reg opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, dst);
-                    emit_byte(as, 0x38 + code);
-                }
-                return true;
-            }
-        }
-    }
-
-    error(as, "unsupported SBC operand combination");
-    return false;
-}
-
-/* CP - Compare */
-static bool encode_cp(Assembler *as, Operand *ops, int count) {
-    if (count < 2) {
-        error(as, "CP requires two operands");
-        return false;
-    }
-
-    Operand *dst = &ops[0];
-    Operand *src = &ops[1];
-
-    /* CP reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + code);
-                if (src->value == 0) {
-                    /* Short form: CP reg, 0 */
-                    emit_byte(as, 0xD8);
-                } else {
-                    emit_byte(as, 0xCF);  /* CP with immediate operation */
-                    emit_byte(as, (uint8_t)src->value);
-                }
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                if (src->value == 0) {
-                    /* Short form: CP reg, 0 */
-                    emit_byte(as, 0xD8);
-                } else {
-                    emit_byte(as, 0xCF);  /* CP with immediate operation */
-                    emit_word(as, (uint16_t)src->value);
-                }
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xE8 + code);
-                if (src->value == 0) {
-                    /* Short form: CP reg, 0 */
-                    emit_byte(as, 0xD8);
-                } else {
-                    emit_byte(as, 0xCF);  /* CP with immediate operation */
-                    emit_long(as, (uint32_t)src->value);
-                }
-                return true;
-            }
-        }
-    }
-
-    /* CP reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_BYTE && src->size == SIZE_BYTE) {
-            int dcode = get_reg8_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0xB0 + ((scode & 1) << 3) + ((dcode >> 1) << 1) + (dcode & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0xB0 + dcode);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG && src->size == SIZE_LONG) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg32_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xE8 + scode);
-                emit_byte(as, 0xB0 + dcode);
-                return true;
-            }
-        }
-    }
-
-    /* CP reg, (direct) - compact encoding for direct addressing */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_DIRECT) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_BYTE);
-                emit_byte(as, 0xF0 + code);  /* Byte compare operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_WORD);
-                emit_byte(as, 0xF0 + code);  /* Word compare operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_LONG);
-                emit_byte(as, 0xF0 + code);  /* Long compare operation */
-                return true;
-            }
-        }
-    }
-
-    /* CP reg, (mem) - register indirect, indexed */
-    if (dst->mode == ADDR_REGISTER &&
-        (src->mode == ADDR_REGISTER_IND || src->mode == ADDR_INDEXED)) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x70 + (code & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x70 + code);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            int mem_mode = get_compact_mem_mode(src);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, F0+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, src);
-                    emit_byte(as, 0xF0 + code);  /* Compact CP opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, src);
-                    emit_byte(as, 0x70 + code);
-                }
-                return true;
-            }
-        }
-    }
-
-    /* CP (mem), reg */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_REGISTER) {
-        if (src->size == SIZE_BYTE) {
-            int code = get_reg8_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x78 + (code & 1));
-                return true;
-            }
-        } else if (src->size == SIZE_WORD) {
-            int code = get_reg16_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x78 + code);
-                return true;
-            }
-        } else if (src->size == SIZE_LONG) {
-            int code = get_reg32_code(src->reg);
-            int mem_mode = get_compact_mem_mode(dst);
-            if (code >= 0) {
-                if (mem_mode >= 0) {
-                    /* Use compact encoding: A0+mode, displacement, F8+code */
-                    emit_byte(as, 0xA0 + mem_mode);
-                    emit_compact_mem_disp(as, dst);
-                    emit_byte(as, 0xF8 + code);  /* Compact CP (mem), reg opcode */
-                } else {
-                    /* Fallback to standard encoding for complex addressing */
-                    emit_byte(as, 0xA0);
-                    emit_mem_operand(as, dst);
-                    emit_byte(as, 0x78 + code);
-                }
-                return true;
-            }
-        }
-    }
-
-    /* CP (mem), imm - byte */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_IMMEDIATE) {
-        emit_byte(as, 0x80);  /* Byte memory prefix */
-        emit_mem_operand(as, dst);
-        emit_byte(as, 0x38);  /* CP (mem), imm opcode */
-        emit_byte(as, (uint8_t)src->value);
-        return true;
-    }
-
-    error(as, "unsupported CP operand combination");
-    return false;
-}
-
-/* CPW - Compare Word (for word-sized memory comparisons) */
-static bool encode_cpw(Assembler *as, Operand *ops, int count) {
-    if (count < 2) {
-        error(as, "CPW requires two operands");
-        return false;
-    }
-
-    Operand *dst = &ops[0];
-    Operand *src = &ops[1];
-
-    /* CPW (direct), imm - compact encoding for direct addressing */
-    if (dst->mode == ADDR_DIRECT && src->mode == ADDR_IMMEDIATE) {
-        emit_direct_mem_operand(as, dst, SIZE_WORD);
-        emit_byte(as, 0x38);  /* CPW opcode */
-        emit_word(as, (uint16_t)src->value);
-        return true;
-    }
-
-    /* CPW (mem), imm - register indirect, indexed */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED) &&
-        src->mode == ADDR_IMMEDIATE) {
-        emit_byte(as, 0x90);  /* Word memory prefix */
-        emit_mem_operand(as, dst);
-        emit_byte(as, 0x38);  /* CPW opcode */
-        emit_word(as, (uint16_t)src->value);
-        return true;
-    }
-
-    error(as, "unsupported CPW operand combination");
-    return false;
-}
-
-/* INC */
-static bool encode_inc(Assembler *as, Operand *ops, int count) {
-    if (count < 1) {
-        error(as, "INC requires an operand");
-        return false;
-    }
-
-    int inc_val = 1;
-    Operand *target = &ops[0];
-
-    /* Handle both "INC reg" and "INC n, reg/mem" syntax */
-    if (count >= 2) {
-        if (ops[0].mode == ADDR_IMMEDIATE) {
-            /* INC n, target - increment amount first */
-            inc_val = (int)ops[0].value;
-            target = &ops[1];
-        } else if (ops[1].mode == ADDR_IMMEDIATE) {
-            /* INC target, n - target first */
-            inc_val = (int)ops[1].value;
-        }
-    }
-
-    if (target->mode == ADDR_REGISTER) {
-        if (target->size == SIZE_BYTE) {
-            int code = get_reg8_code(target->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + (code >> 1));
-                emit_byte(as, 0x60 + (code & 1));
-                emit_byte(as, (uint8_t)inc_val);
-                return true;
-            }
-        } else if (target->size == SIZE_WORD) {
-            int code = get_reg16_code(target->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                /* Compact encoding: 0x61-0x68 for INC 1-8 */
-                if (inc_val >= 1 && inc_val <= 8) {
-                    emit_byte(as, 0x60 + inc_val);
-                } else {
-                    emit_byte(as, 0x60);
-                    emit_byte(as, (uint8_t)inc_val);
-                }
-                return true;
-            }
-        } else if (target->size == SIZE_LONG) {
-            int code = get_reg32_code(target->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xE8 + code);
-                /* Compact encoding: 0x61-0x68 for INC 1-8 */
-                if (inc_val >= 1 && inc_val <= 8) {
-                    emit_byte(as, 0x60 + inc_val);
-                } else {
-                    emit_byte(as, 0x60);
-                    emit_byte(as, (uint8_t)inc_val);
-                }
+                /* Compact encoding: 0x61-0x68 for INC 1-8 */
+                if (inc_val >= 1 && inc_val <= 8) {
+                    emit_byte(as, 0x60 + inc_val);
+                } else {
+                    emit_byte(as, 0x60);
+                    emit_byte(as, (uint8_t)inc_val);
+                }
                 return true;
             }
         }
@@ -2989,300 +2395,113 @@ static bool encode_neg(Assembler *as, Operand *ops, int count) {
                 emit_byte(as, 0xC8 + (code >> 1));
                 emit_byte(as, 0x04 + (code & 1));
                 return true;
-            }
-        } else if (ops[0].size == SIZE_WORD) {
-            int code = get_reg16_code(ops[0].reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0x04);
-                return true;
-            }
-        } else if (ops[0].size == SIZE_LONG) {
-            int code = get_reg32_code(ops[0].reg);
-            if (code >= 0) {
-                emit_byte(as, 0xE8 + code);
-                emit_byte(as, 0x04);
-                return true;
-            }
-        }
-    }
-
-    error(as, "unsupported NEG operand");
-    return false;
-}
-
-/* MUL - Unsigned multiply */
-static bool encode_mul(Assembler *as, Operand *ops, int count) {
-    if (count < 2) {
-        error(as, "MUL requires two operands");
-        return false;
-    }
-
-    Operand *dst = &ops[0];
-    Operand *src = &ops[1];
-
-    /* MUL reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + (code >> 1) + ((code & 1) ? 1 : 0));
-                emit_byte(as, 0x08);
-                emit_byte(as, (uint8_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0x08);
-                emit_word(as, (uint16_t)src->value);
-                return true;
-            }
-        }
-    }
-
-    /* MUL reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        /* MUL RR, r - word register x byte register -> long result */
-        if (dst->size == SIZE_WORD && src->size == SIZE_BYTE) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0x40 + ((scode & 1) << 3) + dcode);
-                return true;
-            }
-        }
-        if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x40 + dcode);
-                return true;
-            }
-        }
-        /* MUL XRR, RR - long register x word register -> qword result */
-        if (dst->size == SIZE_LONG && src->size == SIZE_WORD) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x48 + dcode);
-                return true;
-            }
-        }
-    }
-
-    error(as, "unsupported MUL operand combination");
-    return false;
-}
-
-/* MULS - Signed multiply */
-static bool encode_muls(Assembler *as, Operand *ops, int count) {
-    if (count < 2) {
-        error(as, "MULS requires two operands");
-        return false;
-    }
-
-    Operand *dst = &ops[0];
-    Operand *src = &ops[1];
-
-    /* MULS reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + (code >> 1) + ((code & 1) ? 1 : 0));
-                emit_byte(as, 0x09);
-                emit_byte(as, (uint8_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0x09);
-                emit_word(as, (uint16_t)src->value);
-                return true;
-            }
-        }
-    }
-
-    /* MULS reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x48 + dcode);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG && src->size == SIZE_WORD) {
-            /* MULS XWA, rr */
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x48 + dcode);
-                return true;
-            }
-        }
-    }
-
-    error(as, "unsupported MULS operand combination");
-    return false;
-}
-
-/* DIV - Unsigned divide */
-static bool encode_div(Assembler *as, Operand *ops, int count) {
-    if (count < 2) {
-        error(as, "DIV requires two operands");
-        return false;
-    }
-
-    Operand *dst = &ops[0];
-    Operand *src = &ops[1];
-
-    /* DIV reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + (code >> 1) + ((code & 1) ? 1 : 0));
-                emit_byte(as, 0x0A);
-                emit_byte(as, (uint8_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0x0A);
-                emit_word(as, (uint16_t)src->value);
-                return true;
-            }
-        }
-    }
-
-    /* DIV reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x50 + dcode);
+            }
+        } else if (ops[0].size == SIZE_WORD) {
+            int code = get_reg16_code(ops[0].reg);
+            if (code >= 0) {
+                emit_byte(as, 0xD8 + code);
+                emit_byte(as, 0x04);
                 return true;
             }
-        }
-        /* DIV XRR, RR - 32-bit / 16-bit */
-        if (dst->size == SIZE_LONG && src->size == SIZE_WORD) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x58 + dcode);
+        } else if (ops[0].size == SIZE_LONG) {
+            int code = get_reg32_code(ops[0].reg);
+            if (code >= 0) {
+                emit_byte(as, 0xE8 + code);
+                emit_byte(as, 0x04);
                 return true;
             }
         }
     }
 
-    error(as, "unsupported DIV operand combination");
+    error(as, "unsupported NEG operand");
     return false;
 }
 
-/* DIVS - Signed divide */
-static bool encode_divs(Assembler *as, Operand *ops, int count) {
+/* MUL - Unsigned multiply */
+static bool encode_mul(Assembler *as, Operand *ops, int count) {
     if (count < 2) {
-        error(as, "DIVS requires two operands");
+        error(as, "MUL requires two operands");
         return false;
     }
 
     Operand *dst = &ops[0];
     Operand *src = &ops[1];
 
-    /* DIVS reg, imm */
+    /* MUL reg, imm */
     if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_WORD) {
+        if (dst->size == SIZE_BYTE) {
+            int code = get_reg8_code(dst->reg);
+            if (code >= 0) {
+                emit_byte(as, 0xC8 + (code >> 1) + ((code & 1) ? 1 : 0));
+                emit_byte(as, 0x08);
+                emit_byte(as, (uint8_t)src->value);
+                return true;
+            }
+        } else if (dst->size == SIZE_WORD) {
             int code = get_reg16_code(dst->reg);
             if (code >= 0) {
                 emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0x0B);
+                emit_byte(as, 0x08);
                 emit_word(as, (uint16_t)src->value);
                 return true;
             }
         }
     }
 
-    /* DIVS reg, reg */
+    /* MUL reg, reg */
     if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
+        /* MUL RR, r - word register x byte register -> long result */
+        if (dst->size == SIZE_WORD && src->size == SIZE_BYTE) {
+            int dcode = get_reg16_code(dst->reg);
+            int scode = get_reg8_code(src->reg);
+            if (dcode >= 0 && scode >= 0) {
+                emit_byte(as, 0xC8 + (scode >> 1));
+                emit_byte(as, 0x40 + ((scode & 1) << 3) + dcode);
+                return true;
+            }
+        }
         if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
             int dcode = get_reg16_code(dst->reg);
             int scode = get_reg16_code(src->reg);
             if (dcode >= 0 && scode >= 0) {
                 emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x58 + dcode);
+                emit_byte(as, 0x40 + dcode);
                 return true;
             }
         }
-        /* DIVS XRR, RR - 32-bit / 16-bit signed */
+        /* MUL XRR, RR - long register x word register -> qword result */
         if (dst->size == SIZE_LONG && src->size == SIZE_WORD) {
             int dcode = get_reg32_code(dst->reg);
             int scode = get_reg16_code(src->reg);
             if (dcode >= 0 && scode >= 0) {
                 emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0x5C + dcode);
+                emit_byte(as, 0x48 + dcode);
                 return true;
             }
         }
     }
 
-    error(as, "unsupported DIVS operand combination");
+    error(as, "unsupported MUL operand combination");
     return false;
 }
 
-/* DAA - Decimal adjust after addition */
-static bool encode_daa(Assembler *as, Operand *ops, int count) {
-    if (count < 1) {
-        error(as, "DAA requires a register");
-        return false;
-    }
-    if (ops[0].mode != ADDR_REGISTER || ops[0].size != SIZE_BYTE) {
-        error(as, "DAA requires 8-bit register");
-        return false;
-    }
-    int code = get_reg8_code(ops[0].reg);
-    if (code < 0) {
-        error(as, "invalid DAA register");
-        return false;
-    }
-    emit_byte(as, 0xC8 + (code >> 1));
-    emit_byte(as, 0x10 + (code & 1));
-    return true;
-}
-
-/* ============== Logical Instructions ============== */
-
-/* AND */
-static bool encode_and(Assembler *as, Operand *ops, int count) {
+/* MULS - Signed multiply */
+static bool encode_muls(Assembler *as, Operand *ops, int count) {
     if (count < 2) {
-        error(as, "AND requires two operands");
+        error(as, "MULS requires two operands");
         return false;
     }
 
     Operand *dst = &ops[0];
     Operand *src = &ops[1];
 
-    /* AND reg, imm */
+    /* MULS reg, imm */
     if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
         if (dst->size == SIZE_BYTE) {
             int code = get_reg8_code(dst->reg);
             if (code >= 0) {
-                emit_byte(as, 0xC8 + code);  /* Use full register code */
-                emit_byte(as, 0xCC);  /* AND with immediate operation */
+                emit_byte(as, 0xC8 + (code >> 1) + ((code & 1) ? 1 : 0));
+                emit_byte(as, 0x09);
                 emit_byte(as, (uint8_t)src->value);
                 return true;
             }
@@ -3290,167 +2509,56 @@ static bool encode_and(Assembler *as, Operand *ops, int count) {
             int code = get_reg16_code(dst->reg);
             if (code >= 0) {
                 emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0xCC);  /* AND with immediate operation */
+                emit_byte(as, 0x09);
                 emit_word(as, (uint16_t)src->value);
                 return true;
             }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xE8 + code);
-                emit_byte(as, 0xCC);  /* AND with immediate operation */
-                emit_long(as, (uint32_t)src->value);
-                return true;
-            }
         }
     }
 
-    /* AND reg, reg */
+    /* MULS reg, reg */
     if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_BYTE && src->size == SIZE_BYTE) {
-            int dcode = get_reg8_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0xA0 + ((scode & 1) << 3) + ((dcode >> 1) << 1) + (dcode & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
+        if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
             int dcode = get_reg16_code(dst->reg);
             int scode = get_reg16_code(src->reg);
             if (dcode >= 0 && scode >= 0) {
                 emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0xC0 + dcode);
+                emit_byte(as, 0x48 + dcode);
                 return true;
             }
-        } else if (dst->size == SIZE_LONG && src->size == SIZE_LONG) {
+        } else if (dst->size == SIZE_LONG && src->size == SIZE_WORD) {
+            /* MULS XWA, rr */
             int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg32_code(src->reg);
+            int scode = get_reg16_code(src->reg);
             if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xE8 + scode);
-                emit_byte(as, 0xC0 + dcode);
-                return true;
-            }
-        }
-    }
-
-    /* AND (mem), imm */
-    if ((dst->mode == ADDR_DIRECT || dst->mode == ADDR_REGISTER_IND ||
-         dst->mode == ADDR_INDEXED) && src->mode == ADDR_IMMEDIATE) {
-        emit_byte(as, 0xB0);
-        emit_mem_operand(as, dst);
-        emit_byte(as, 0x2C);
-        emit_byte(as, (uint8_t)src->value);
-        return true;
-    }
-
-    /* AND reg, (direct) - compact encoding for direct addressing */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_DIRECT) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_BYTE);
-                emit_byte(as, 0xC0 + code);  /* Byte AND operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_WORD);
-                emit_byte(as, 0xC0 + code);  /* Word AND operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_LONG);
-                emit_byte(as, 0xC0 + code);  /* Long AND operation */
-                return true;
-            }
-        }
-    }
-
-    /* AND reg, (mem) - register indirect, indexed */
-    if (dst->mode == ADDR_REGISTER &&
-        (src->mode == ADDR_REGISTER_IND || src->mode == ADDR_INDEXED)) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x04 + (code & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x40 + code);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xA0);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x40 + code);
-                return true;
-            }
-        }
-    }
-
-    /* AND (mem), reg */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_REGISTER) {
-        if (src->size == SIZE_BYTE) {
-            int code = get_reg8_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x0C + (code & 1));
-                return true;
-            }
-        } else if (src->size == SIZE_WORD) {
-            int code = get_reg16_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x48 + code);
-                return true;
-            }
-        } else if (src->size == SIZE_LONG) {
-            int code = get_reg32_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xA0);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x48 + code);
+                emit_byte(as, 0xD8 + scode);
+                emit_byte(as, 0x48 + dcode);
                 return true;
             }
         }
     }
 
-    error(as, "unsupported AND operand combination");
+    error(as, "unsupported MULS operand combination");
     return false;
 }
 
-/* OR */
-static bool encode_or(Assembler *as, Operand *ops, int count) {
+/* DIV - Unsigned divide */
+static bool encode_div(Assembler *as, Operand *ops, int count) {
     if (count < 2) {
-        error(as, "OR requires two operands");
+        error(as, "DIV requires two operands");
         return false;
     }
 
     Operand *dst = &ops[0];
     Operand *src = &ops[1];
 
-    /* OR reg, imm */
+    /* DIV reg, imm */
     if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
         if (dst->size == SIZE_BYTE) {
             int code = get_reg8_code(dst->reg);
             if (code >= 0) {
-                emit_byte(as, 0xC8 + code);  /* Use full register code */
-                emit_byte(as, 0xCE);  /* OR with immediate operation */
+                emit_byte(as, 0xC8 + (code >> 1) + ((code & 1) ? 1 : 0));
+                emit_byte(as, 0x0A);
                 emit_byte(as, (uint8_t)src->value);
                 return true;
             }
@@ -3458,150 +2566,122 @@ static bool encode_or(Assembler *as, Operand *ops, int count) {
             int code = get_reg16_code(dst->reg);
             if (code >= 0) {
                 emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0xCE);
+                emit_byte(as, 0x0A);
                 emit_word(as, (uint16_t)src->value);
                 return true;
             }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xE8 + code);
-                emit_byte(as, 0xCE);
-                emit_long(as, (uint32_t)src->value);
-                return true;
-            }
         }
     }
 
-    /* OR reg, reg */
+    /* DIV reg, reg */
     if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_BYTE && src->size == SIZE_BYTE) {
-            int dcode = get_reg8_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0xA8 + ((scode & 1) << 3) + ((dcode >> 1) << 1) + (dcode & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
+        if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
             int dcode = get_reg16_code(dst->reg);
             int scode = get_reg16_code(src->reg);
             if (dcode >= 0 && scode >= 0) {
                 emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0xC8 + dcode);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG && src->size == SIZE_LONG) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg32_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xE8 + scode);
-                emit_byte(as, 0xC8 + dcode);
+                emit_byte(as, 0x50 + dcode);
                 return true;
             }
         }
-    }
-
-    /* OR (mem), imm */
-    if ((dst->mode == ADDR_DIRECT || dst->mode == ADDR_REGISTER_IND ||
-         dst->mode == ADDR_INDEXED) && src->mode == ADDR_IMMEDIATE) {
-        emit_byte(as, 0xB0);
-        emit_mem_operand(as, dst);
-        emit_byte(as, 0x2E);
-        emit_byte(as, (uint8_t)src->value);
-        return true;
-    }
-
-    /* OR reg, (direct) - compact encoding for direct addressing */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_DIRECT) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_BYTE);
-                emit_byte(as, 0xE0 + code);  /* Byte OR operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_WORD);
-                emit_byte(as, 0xE0 + code);  /* Word OR operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_LONG);
-                emit_byte(as, 0xE0 + code);  /* Long OR operation */
+        /* DIV XRR, RR - 32-bit / 16-bit */
+        if (dst->size == SIZE_LONG && src->size == SIZE_WORD) {
+            int dcode = get_reg32_code(dst->reg);
+            int scode = get_reg16_code(src->reg);
+            if (dcode >= 0 && scode >= 0) {
+                emit_byte(as, 0xD8 + scode);
+                emit_byte(as, 0x58 + dcode);
                 return true;
             }
         }
     }
 
-    /* OR reg, (mem) - register indirect, indexed */
-    if (dst->mode == ADDR_REGISTER &&
-        (src->mode == ADDR_REGISTER_IND || src->mode == ADDR_INDEXED)) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x06 + (code & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
+    error(as, "unsupported DIV operand combination");
+    return false;
+}
+
+/* DIVS - Signed divide */
+static bool encode_divs(Assembler *as, Operand *ops, int count) {
+    if (count < 2) {
+        error(as, "DIVS requires two operands");
+        return false;
+    }
+
+    Operand *dst = &ops[0];
+    Operand *src = &ops[1];
+
+    /* DIVS reg, imm */
+    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
+        if (dst->size == SIZE_WORD) {
             int code = get_reg16_code(dst->reg);
             if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x60 + code);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xA0);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x60 + code);
+                emit_byte(as, 0xD8 + code);
+                emit_byte(as, 0x0B);
+                emit_word(as, (uint16_t)src->value);
                 return true;
             }
         }
     }
 
-    /* OR (mem), reg */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_REGISTER) {
-        if (src->size == SIZE_BYTE) {
-            int code = get_reg8_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x0E + (code & 1));
-                return true;
-            }
-        } else if (src->size == SIZE_WORD) {
-            int code = get_reg16_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x68 + code);
+    /* DIVS reg, reg */
+    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
+        if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
+            int dcode = get_reg16_code(dst->reg);
+            int scode = get_reg16_code(src->reg);
+            if (dcode >= 0 && scode >= 0) {
+                emit_byte(as, 0xD8 + scode);
+                emit_byte(as, 0x58 + dcode);
                 return true;
             }
-        } else if (src->size == SIZE_LONG) {
-            int code = get_reg32_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xA0);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x68 + code);
+        }
+        /* DIVS XRR, RR - 32-bit / 16-bit signed */
+        if (dst->size == SIZE_LONG && src->size == SIZE_WORD) {
+            int dcode = get_reg32_code(dst->reg);
+            int scode = get_reg16_code(src->reg);
+            if (dcode >= 0 && scode >= 0) {
+                emit_byte(as, 0xD8 + scode);
+                emit_byte(as, 0x5C + dcode);
                 return true;
             }
         }
     }
 
-    error(as, "unsupported OR operand combination");
+    error(as, "unsupported DIVS operand combination");
     return false;
 }
 
+/* DAA - Decimal adjust after addition */
+static bool encode_daa(Assembler *as, Operand *ops, int count) {
+    if (count < 1) {
+        error(as, "DAA requires a register");
+        return false;
+    }
+    if (ops[0].mode != ADDR_REGISTER || ops[0].size != SIZE_BYTE) {
+        error(as, "DAA requires 8-bit register");
+        return false;
+    }
+    int code = get_reg8_code(ops[0].reg);
+    if (code < 0) {
+        error(as, "invalid DAA register");
+        return false;
+    }
+    emit_byte(as, 0xC8 + (code >> 1));
+    emit_byte(as, 0x10 + (code & 1));
+    return true;
+}
+
+/* ============== Logical Instructions ============== */
+
+/* AND */
+static bool encode_and(Assembler *as, Operand *ops, int count) {
+    return encode_alu(as, ALU_AND, ops, count);
+}
+
+/* OR */
+static bool encode_or(Assembler *as, Operand *ops, int count) {
+    return encode_alu(as, ALU_OR, ops, count);
+}
+
 /* ORW - OR Word (memory) */
 static bool encode_orw(Assembler *as, Operand *ops, int count) {
     if (count < 2) {
@@ -3732,170 +2812,7 @@ static bool encode_addw(Assembler *as, Operand *ops, int count) {
 
 /* XOR */
 static bool encode_xor(Assembler *as, Operand *ops, int count) {
-    if (count < 2) {
-        error(as, "XOR requires two operands");
-        return false;
-    }
-
-    Operand *dst = &ops[0];
-    Operand *src = &ops[1];
-
-    /* XOR reg, imm */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_IMMEDIATE) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xC8 + code);  /* Use full register code */
-                emit_byte(as, 0xCD);  /* XOR with immediate operation */
-                emit_byte(as, (uint8_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xD8 + code);
-                emit_byte(as, 0xCD);
-                emit_word(as, (uint16_t)src->value);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xE8 + code);
-                emit_byte(as, 0xCD);
-                emit_long(as, (uint32_t)src->value);
-                return true;
-            }
-        }
-    }
-
-    /* XOR reg, reg */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_REGISTER) {
-        if (dst->size == SIZE_BYTE && src->size == SIZE_BYTE) {
-            int dcode = get_reg8_code(dst->reg);
-            int scode = get_reg8_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xC8 + (scode >> 1));
-                emit_byte(as, 0xB8 + ((scode & 1) << 3) + ((dcode >> 1) << 1) + (dcode & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD && src->size == SIZE_WORD) {
-            int dcode = get_reg16_code(dst->reg);
-            int scode = get_reg16_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xD8 + scode);
-                emit_byte(as, 0xD0 + dcode);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG && src->size == SIZE_LONG) {
-            int dcode = get_reg32_code(dst->reg);
-            int scode = get_reg32_code(src->reg);
-            if (dcode >= 0 && scode >= 0) {
-                emit_byte(as, 0xE8 + scode);
-                emit_byte(as, 0xD0 + dcode);
-                return true;
-            }
-        }
-    }
-
-    /* XOR (mem), imm */
-    if ((dst->mode == ADDR_DIRECT || dst->mode == ADDR_REGISTER_IND ||
-         dst->mode == ADDR_INDEXED) && src->mode == ADDR_IMMEDIATE) {
-        emit_byte(as, 0xB0);
-        emit_mem_operand(as, dst);
-        emit_byte(as, 0x30);
-        emit_byte(as, (uint8_t)src->value);
-        return true;
-    }
-
-    /* XOR reg, (direct) - compact encoding for direct addressing */
-    if (dst->mode == ADDR_REGISTER && src->mode == ADDR_DIRECT) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_BYTE);
-                emit_byte(as, 0xD0 + code);  /* Byte XOR operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_WORD);
-                emit_byte(as, 0xD0 + code);  /* Word XOR operation */
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_direct_mem_operand(as, src, SIZE_LONG);
-                emit_byte(as, 0xD0 + code);  /* Long XOR operation */
-                return true;
-            }
-        }
-    }
-
-    /* XOR reg, (mem) - register indirect, indexed */
-    if (dst->mode == ADDR_REGISTER &&
-        (src->mode == ADDR_REGISTER_IND || src->mode == ADDR_INDEXED)) {
-        if (dst->size == SIZE_BYTE) {
-            int code = get_reg8_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x10 + (code & 1));
-                return true;
-            }
-        } else if (dst->size == SIZE_WORD) {
-            int code = get_reg16_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x80 + code);
-                return true;
-            }
-        } else if (dst->size == SIZE_LONG) {
-            int code = get_reg32_code(dst->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xA0);
-                emit_mem_operand(as, src);
-                emit_byte(as, 0x80 + code);
-                return true;
-            }
-        }
-    }
-
-    /* XOR (mem), reg */
-    if ((dst->mode == ADDR_REGISTER_IND || dst->mode == ADDR_INDEXED ||
-         dst->mode == ADDR_DIRECT) && src->mode == ADDR_REGISTER) {
-        if (src->size == SIZE_BYTE) {
-            int code = get_reg8_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x80 + (code >> 1));
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x18 + (code & 1));
-                return true;
-            }
-        } else if (src->size == SIZE_WORD) {
-            int code = get_reg16_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0x90);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x88 + code);
-                return true;
-            }
-        } else if (src->size == SIZE_LONG) {
-            int code = get_reg32_code(src->reg);
-            if (code >= 0) {
-                emit_byte(as, 0xA0);
-                emit_mem_operand(as, dst);
-                emit_byte(as, 0x88 + code);
-                return true;
-            }
-        }
-    }
-
-    error(as, "unsupported XOR operand combination");
-    return false;
+    return encode_alu(as, ALU_XOR, ops, count);
 }
 
 /* CPL - Complement */
@@ -4695,8 +3612,6 @@ static bool encode_scc(Assembler *as, Operand *ops, int count) {
 
 /* ============== Instruction Table ============== */
 
-typedef bool (*EncoderFunc)(Assembler *, Operand *, int);
-
 static const struct {
     const char *mnemonic;
     EncoderFunc encoder;
@@ -4801,15 +3716,56 @@ static const struct {
     {NULL, NULL}
 };
 
-/* Main instruction encoder entry point */
-bool encode_instruction(Assembler *as, const char *mnemonic, Operand *operands, int operand_count) {
-    /* Look up instruction */
+/* Add every mnemonic to the keyword table */
+void encode_register_keywords(void) {
     for (int i = 0; instruction_table[i].mnemonic; i++) {
-        if (strcasecmp(mnemonic, instruction_table[i].mnemonic) == 0) {
-            return instruction_table[i].encoder(as, operands, operand_count);
+        keyword_add(instruction_table[i].mnemonic, DIR_NONE, instruction_table[i].encoder);
+    }
+}
+
+/*
+ * Does this instruction's encoded size depend only on its operand modes?
+ * Sizes vary with operand values in three ways: unsuffixed direct
+ * addresses (8/16/24 bits), register-relative displacements (8/16 bits),
+ * and the few encoders whose immediate operand picks the form (JP/CALL
+ * 16/24-bit targets, LD short immediates, CP #0, LDA displacements).
+ * Anything else can keep its size from the last encoding.
+ */
+bool encode_size_fixed(EncoderFunc encoder, const Operand *ops, int count) {
+    bool immediate_sized = encoder == encode_jp || encoder == encode_call ||
+                           encoder == encode_ld || encoder == encode_lda ||
+                           encoder == encode_cp;
+
+    for (int i = 0; i < count; i++) {
+        switch (ops[i].mode) {
+            case ADDR_DIRECT:
+                if (ops[i].addr_size == 0) return false;
+                break;
+            case ADDR_INDEXED:
+                if (ops[i].index_reg == REG_NONE) return false;
+                break;
+            case ADDR_IMMEDIATE:
+                if (immediate_sized) return false;
+                break;
+            default:
+                break;
         }
     }
+    return true;
+}
 
-    /* Not found - might be a macro, let caller handle it */
-    return false;
+/* Look up the encoder for a mnemonic, NULL if it is not an instruction */
+EncoderFunc encode_lookup(const char *mnemonic) {
+    const Keyword *kw = keyword_lookup(mnemonic);
+    return kw ? kw->encoder : NULL;
+}
+
+/* Main instruction encoder entry point */
+bool encode_instruction(Assembler *as, const char *mnemonic, Operand *operands, int operand_count) {
+    EncoderFunc encoder = encode_lookup(mnemonic);
+    if (!encoder) {
+        /* Not found - might be a macro, let caller handle it */
+        return false;
+    }
+    return encoder(as, operands, operand_count);
 }
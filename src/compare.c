@@ -0,0 +1,225 @@
+/*
+ * TLCS-900 Assembler - Reference Comparison
+ *
+ * With --compare, pass 2 checks every byte against a reference ROM as
+ * it is written, instead of leaving that to cmp over the finished
+ * image.  The reference is memory-mapped and read as a binary image
+ * starting at the lowest address the source writes, like the file a
+ * binary build writes.  Bytes that differ are charged to the source
+ * line being assembled; a line's mismatches make one report, so a
+ * wrong instruction is named once:
+ *
+ *   main.asm:1234: 2 bytes differ from the reference, first at FE0010
+ *       (assembled 45, reference 44):
+ *       LD (XIX+4),XWA
+ *
+ * Once the limit of differing lines is reached the pass stops, so a
+ * limit of 1 stops at the first divergence, and the incomplete image is
+ * not written over the output file (see build_target).  Pass 2 worker
+ * output is compared statement by statement as the serial pass takes
+ * it, and while comparing the build cache doesn't stand in for
+ * included files, so every mismatch is charged to its own line.
+ *
+ * Bytes are checked as they are written, not in the finished image.  A
+ * range written twice (a backward ORG) is checked on each write, so a
+ * byte that differs may be reported twice, or for a write that a later
+ * one replaced.  The reference's first byte is the lowest address in the
+ * pass 1 layout; a source that can't be replayed has no layout, and the
+ * first address written stands in, so bytes a backward ORG puts below
+ * it count as lying outside the reference.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/tlcs900.h"
+
+/* The differing bytes of one line */
+typedef struct {
+    const char *file;
+    int line;
+    uint32_t addr;              /* First differing byte */
+    uint8_t assembled;
+    int reference;              /* -1 past the end of the reference */
+    uint32_t count;
+} CompareReport;
+
+struct Compare {
+    const uint8_t *ref;
+    size_t ref_size;
+    uint32_t base;              /* Address of the reference's first byte */
+    bool based;                 /* base is set (at the first write) */
+    CompareReport *reports;
+    int report_count;
+    int limit;
+    uint64_t end;               /* One past the highest address written */
+};
+
+bool compare_open(Assembler *as, const char *reference, int limit) {
+    int fd = open(reference, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+
+    Compare *c = as_calloc(1, sizeof(Compare));
+    if (!c) {
+        close(fd);
+        return false;
+    }
+    c->ref_size = (size_t)st.st_size;
+    if (c->ref_size > 0) {
+        void *map = mmap(NULL, c->ref_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            close(fd);
+            free(c);
+            return false;
+        }
+        c->ref = map;
+    }
+    close(fd);
+
+    c->limit = limit > 0 ? limit : 1;
+    c->reports = as_calloc((size_t)c->limit, sizeof(CompareReport));
+    if (!c->reports) {
+        if (c->ref) munmap((void *)c->ref, c->ref_size);
+        free(c);
+        return false;
+    }
+    as->compare = c;
+    return true;
+}
+
+/* Charge one differing byte to the current line */
+static void compare_mismatch(Assembler *as, Compare *c, uint32_t addr, uint8_t assembled,
+                             int reference) {
+    CompareReport *last = c->report_count ? &c->reports[c->report_count - 1] : NULL;
+    if (last && last->file == as->current_file && last->line == as->current_line) {
+        last->count++;
+        return;
+    }
+    if (c->report_count >= c->limit) return;
+
+    CompareReport *r = &c->reports[c->report_count++];
+    r->file = as->current_file;
+    r->line = as->current_line;
+    r->addr = addr;
+    r->assembled = assembled;
+    r->reference = reference;
+    r->count = 1;
+    if (c->report_count == c->limit) {
+        as->stop = true;
+    }
+}
+
+/*
+ * The image starts at the lowest address written.  Pass 1 has laid out
+ * every recorded statement by the time pass 2 writes, so that address is
+ * known up front, even when a backward ORG writes below the first byte.
+ */
+static uint32_t compare_base(const Assembler *as, uint32_t first) {
+    if (!as->ir.valid || !as->ir.worklist) return first;
+    uint32_t base = first;
+    for (size_t i = 0; i < as->ir.count; i++) {
+        const Stmt *st = &as->ir.stmts[i];
+        bool sized = st->kind == STMT_INSN ||
+                     (st->kind == STMT_LINE && st->directive != DIR_ORG);
+        if (sized && st->size > 0 && st->start_pc < base) {
+            base = st->start_pc;
+        }
+    }
+    return base;
+}
+
+/* Check len bytes written at addr (data, or fill repeated) */
+void compare_emit(Assembler *as, uint32_t addr, const uint8_t *data, uint8_t fill, size_t len) {
+    Compare *c = as->compare;
+    if (!c->based) {
+        c->base = compare_base(as, addr);
+        c->based = true;
+    }
+    if ((uint64_t)addr + len > c->end) {
+        c->end = (uint64_t)addr + len;
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        uint8_t b = data ? data[i] : fill;
+        uint64_t offset = (uint64_t)addr + i - c->base;
+        if (addr + i < c->base || offset >= c->ref_size) {
+            compare_mismatch(as, c, addr + (uint32_t)i, b, -1);
+        } else if (c->ref[offset] != b) {
+            compare_mismatch(as, c, addr + (uint32_t)i, b, c->ref[offset]);
+        }
+    }
+}
+
+/* Compare the part of a capture in [lo, hi) against the current line */
+void compare_capture(Assembler *as, const OutputCapture *cap, uint32_t lo, uint32_t hi) {
+    for (size_t i = 0; i < cap->run_count; i++) {
+        const OutputRun *run = &cap->runs[i];
+        uint64_t start = run->addr > lo ? run->addr : lo;
+        uint64_t end = (uint64_t)run->addr + run->length;
+        if (end > hi) end = hi;
+        if (start < end) {
+            compare_emit(as, (uint32_t)start, cap->data + run->offset + (start - run->addr), 0,
+                         (size_t)(end - start));
+        }
+    }
+}
+
+/* The text of line (1-based) of the named source */
+static const char *report_text(Assembler *as, const CompareReport *r) {
+    SourceFile *src = r->file ? source_open(as, r->file) : NULL;
+    if (!src || r->line < 1 || r->line > src->line_count) return "";
+    const char *text = src->data + src->lines[r->line - 1].offset;
+    while (*text == ' ' || *text == '\t') text++;
+    return text;
+}
+
+/* Report what differed; true if the image matched the reference */
+bool compare_close(Assembler *as) {
+    Compare *c = as->compare;
+    if (!c) return true;
+    as->compare = NULL;
+
+    for (int i = 0; i < c->report_count; i++) {
+        const CompareReport *r = &c->reports[i];
+        char reference[16];
+        if (r->reference < 0) {
+            strcpy(reference, "none");
+        } else {
+            snprintf(reference, sizeof(reference), "%02X", r->reference);
+        }
+        diag_message(as, "%s:%d: %u byte%s differ%s from the reference, first at %06X "
+                     "(assembled %02X, reference %s):\n    %s",
+                     r->file ? r->file : "<input>", r->line, r->count, r->count == 1 ? "" : "s",
+                     r->count == 1 ? "s" : "", r->addr, r->assembled, reference, report_text(as, r));
+    }
+
+    bool stopped = c->report_count >= c->limit;
+    uint64_t size = c->end > c->base ? c->end - c->base : 0;
+    bool same_size = stopped || size == c->ref_size;
+    if (stopped) {
+        diag_message(as, "Comparison stopped after %d differing line%s; "
+                     "the incomplete image was not written",
+                     c->report_count, c->report_count == 1 ? "" : "s");
+    } else if (!same_size) {
+        diag_message(as, "Image is %llu bytes, reference is %zu bytes",
+                     (unsigned long long)size, c->ref_size);
+    } else if (c->report_count == 0 && as->verbose) {
+        printf("Image matches the reference (%zu bytes)\n", c->ref_size);
+    }
+
+    bool ok = c->report_count == 0 && same_size;
+    if (c->ref) munmap((void *)c->ref, c->ref_size);
+    free(c->reports);
+    free(c);
+    return ok;
+}
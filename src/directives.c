@@ -18,35 +18,31 @@
 #include <string.h>
 #include <strings.h>
 #include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "../include/tlcs900.h"
 
 /* External functions */
 extern bool assembler_include_file(Assembler *as, const char *filename);
 extern void output_set_base(Assembler *as, uint32_t base);
-extern void emit_fill(Assembler *as, size_t count, uint8_t value);
-extern void emit_string(Assembler *as, const char *str, size_t len);
 extern void emit_word24(Assembler *as, uint32_t w);
 
 /* Macro functions */
 extern bool macro_start_definition(Assembler *as, const char *name, const char *params_str);
 extern bool macro_end_definition(Assembler *as);
-extern bool macro_is_collecting(void);
+extern bool macro_is_collecting(Assembler *as);
 
-/* Check if a string matches a directive (case-insensitive) */
-static bool is_directive(const char *s, const char *directive) {
-    return strcasecmp(s, directive) == 0;
-}
-
-/* Parse a quoted string, returning allocated string */
-static char *parse_string_arg(void) {
-    Token tok = lexer_peek();
+/* Parse a quoted string; the result lasts until the end of the pass */
+static const char *parse_string_arg(Assembler *as) {
+    Token tok = lexer_peek(&as->lexer);
     if (tok.type == TOK_STRING) {
-        lexer_next();
-        return strdup(tok.text);
+        lexer_next(&as->lexer);
+        return tok.text;
     }
     if (tok.type == TOK_CHAR) {
-        lexer_next();
-        return strdup(tok.text);
+        lexer_next(&as->lexer);
+        return tok.text;
     }
     /* Unquoted - collect until comma or end */
     char buf[MAX_IDENTIFIER];
@@ -59,11 +55,11 @@ static char *parse_string_arg(void) {
                 i += len;
             }
         }
-        lexer_next();
-        tok = lexer_peek();
+        lexer_next(&as->lexer);
+        tok = lexer_peek(&as->lexer);
     }
     buf[i] = '\0';
-    return strdup(buf);
+    return arena_strdup(&as->pass_arena, buf);
 }
 
 /* Handle ORG directive */
@@ -91,12 +87,12 @@ static bool handle_equ(Assembler *as, const char *label) {
         return false;
     }
     int64_t value;
-    bool known, is_const;
-    if (!expr_parse(as, &value, &known, &is_const)) {
+    bool known, is_const, folded;
+    if (!expr_parse_folded(as, &value, &known, &is_const, &folded)) {
         error(as, "invalid EQU expression");
         return false;
     }
-    symbol_define(as, label, SYM_EQU, value);
+    symbol_define_fixed(as, label, value, folded);
     return true;
 }
 
@@ -116,85 +112,53 @@ static bool handle_set(Assembler *as, const char *label) {
     return true;
 }
 
-/* Handle DB (define byte) directive */
-static bool handle_db(Assembler *as) {
+/*
+ * Handle DB/DW/DD: width-byte values, and for DB also strings.  A line
+ * being recorded keeps its compiled values for replay (see ir.c).
+ */
+static bool handle_data(Assembler *as, int width) {
+    static const char *const messages[] = {
+        NULL, "invalid DB expression", "invalid DW expression", NULL, "invalid DD expression",
+    };
+    bool record = ir_is_recording(as);
+    if (record) ir_data_begin(as);
+
     do {
-        Token tok = lexer_peek();
-
-        if (tok.type == TOK_STRING) {
-            /* String literal - emit each byte */
-            lexer_next();
-            emit_string(as, tok.text, strlen(tok.text));
-        } else if (tok.type == TOK_CHAR) {
-            /* Character literal */
-            lexer_next();
-            emit_string(as, tok.text, strlen(tok.text));
+        Token tok = lexer_peek(&as->lexer);
+
+        if (width == 1 && (tok.type == TOK_STRING || tok.type == TOK_CHAR)) {
+            /* String or character literal - emit each byte */
+            lexer_next(&as->lexer);
+            size_t length = strlen(tok.text);
+            emit_bytes(as, (const uint8_t *)tok.text, length);
+            if (record) ir_data_add(as, 0, tok.text, length, NULL);
         } else {
             /* Expression */
+            const ExprCode *code = expr_parse_code(as, record ? &as->ir.arena : &as->scratch);
             int64_t value;
             bool known, is_const;
-            if (!expr_parse(as, &value, &known, &is_const)) {
-                error(as, "invalid DB expression");
+            if (!code || !expr_eval(as, code, &value, &known, &is_const)) {
+                error(as, "%s", messages[width]);
                 return false;
             }
-            emit_byte(as, (uint8_t)value);
-        }
-
-        /* Check for comma */
-        tok = lexer_peek();
-        if (tok.type == TOK_COMMA) {
-            lexer_next();
-        } else {
-            break;
-        }
-    } while (true);
-
-    return true;
-}
-
-/* Handle DW (define word) directive */
-static bool handle_dw(Assembler *as) {
-    do {
-        int64_t value;
-        bool known, is_const;
-        if (!expr_parse(as, &value, &known, &is_const)) {
-            error(as, "invalid DW expression");
-            return false;
-        }
-        emit_word(as, (uint16_t)value);
-
-        /* Check for comma */
-        Token tok = lexer_peek();
-        if (tok.type == TOK_COMMA) {
-            lexer_next();
-        } else {
-            break;
-        }
-    } while (true);
-
-    return true;
-}
-
-/* Handle DD (define double/long) directive */
-static bool handle_dd(Assembler *as) {
-    do {
-        int64_t value;
-        bool known, is_const;
-        if (!expr_parse(as, &value, &known, &is_const)) {
-            error(as, "invalid DD expression");
-            return false;
+            if (record) ir_data_add(as, (uint8_t)width, NULL, 0, code);
+            switch (width) {
+                case 1:  emit_byte(as, (uint8_t)value); break;
+                case 2:  emit_word(as, (uint16_t)value); break;
+                default: emit_long(as, (uint32_t)value); break;
+            }
         }
-        emit_long(as, (uint32_t)value);
 
         /* Check for comma */
-        Token tok = lexer_peek();
+        tok = lexer_peek(&as->lexer);
         if (tok.type == TOK_COMMA) {
-            lexer_next();
+            lexer_next(&as->lexer);
         } else {
             break;
         }
     } while (true);
 
+    if (record) ir_data_end(as);
     return true;
 }
 
@@ -208,9 +172,9 @@ static bool handle_ds(Assembler *as) {
     }
 
     uint8_t fill = 0;
-    Token tok = lexer_peek();
+    Token tok = lexer_peek(&as->lexer);
     if (tok.type == TOK_COMMA) {
-        lexer_next();
+        lexer_next(&as->lexer);
         int64_t fill_val;
         if (!expr_parse(as, &fill_val, &known, &is_const)) {
             error(as, "invalid DS fill value");
@@ -219,7 +183,7 @@ static bool handle_ds(Assembler *as) {
         fill = (uint8_t)fill_val;
     }
 
-    emit_fill(as, (size_t)count, fill);
+    emit_fill_block(as, (size_t)count, fill);
     return true;
 }
 
@@ -239,41 +203,39 @@ static bool handle_align(Assembler *as) {
 
     uint32_t mask = (uint32_t)boundary - 1;
     uint32_t padding = (boundary - (as->pc & mask)) & mask;
-    emit_fill(as, padding, 0);
+    emit_fill_block(as, padding, 0);
     return true;
 }
 
 /* Handle INCLUDE directive */
 static bool handle_include(Assembler *as) {
-    Token tok = lexer_peek();
-    char *filename = NULL;
+    Token tok = lexer_peek(&as->lexer);
+    const char *filename = NULL;
 
     if (tok.type == TOK_STRING || tok.type == TOK_CHAR) {
-        lexer_next();
-        filename = strdup(tok.text);
+        lexer_next(&as->lexer);
+        filename = tok.text;
     } else if (tok.type == TOK_IDENTIFIER) {
         /* Unquoted filename */
-        filename = parse_string_arg();
+        filename = parse_string_arg(as);
     } else {
         error(as, "INCLUDE requires a filename");
         return false;
     }
 
-    bool result = assembler_include_file(as, filename);
-    free(filename);
-    return result;
+    return assembler_include_file(as, filename);
 }
 
 /* Handle BINCLUDE directive (binary include) */
 static bool handle_binclude(Assembler *as) {
-    Token tok = lexer_peek();
-    char *filename = NULL;
+    Token tok = lexer_peek(&as->lexer);
+    const char *filename = NULL;
 
     if (tok.type == TOK_STRING || tok.type == TOK_CHAR) {
-        lexer_next();
-        filename = strdup(tok.text);
+        lexer_next(&as->lexer);
+        filename = tok.text;
     } else {
-        filename = parse_string_arg();
+        filename = parse_string_arg(as);
     }
 
     /* Optional offset and length */
@@ -281,20 +243,18 @@ static bool handle_binclude(Assembler *as) {
     int64_t length = -1;
     bool known, is_const;
 
-    tok = lexer_peek();
+    tok = lexer_peek(&as->lexer);
     if (tok.type == TOK_COMMA) {
-        lexer_next();
+        lexer_next(&as->lexer);
         if (!expr_parse(as, &offset, &known, &is_const)) {
-            free(filename);
             error(as, "invalid BINCLUDE offset");
             return false;
         }
 
-        tok = lexer_peek();
+        tok = lexer_peek(&as->lexer);
         if (tok.type == TOK_COMMA) {
-            lexer_next();
+            lexer_next(&as->lexer);
             if (!expr_parse(as, &length, &known, &is_const)) {
-                free(filename);
                 error(as, "invalid BINCLUDE length");
                 return false;
             }
@@ -308,7 +268,6 @@ static bool handle_binclude(Assembler *as) {
         if (last_slash) {
             size_t dir_len = last_slash - as->current_file + 1;
             if (dir_len + strlen(filename) >= sizeof(resolved_path)) {
-                free(filename);
                 error(as, "BINCLUDE path too long");
                 return false;
             }
@@ -321,20 +280,16 @@ static bool handle_binclude(Assembler *as) {
         strncpy(resolved_path, filename, sizeof(resolved_path) - 1);
     }
     resolved_path[sizeof(resolved_path) - 1] = '\0';
-    free(filename);
 
-    FILE *fp = fopen(resolved_path, "rb");
-    if (!fp) {
+    /* The size alone places everything after the data */
+    struct stat st;
+    if (stat(resolved_path, &st) != 0) {
         error(as, "cannot open binary file '%s'", resolved_path);
         return false;
     }
-
-    /* Get file size */
-    fseek(fp, 0, SEEK_END);
-    long file_size = ftell(fp);
+    int64_t file_size = (int64_t)st.st_size;
 
     if (offset >= file_size) {
-        fclose(fp);
         error(as, "BINCLUDE offset beyond file size");
         return false;
     }
@@ -347,16 +302,30 @@ static bool handle_binclude(Assembler *as) {
         length = file_size - offset;
     }
 
-    fseek(fp, offset, SEEK_SET);
+    /* Pass 1 only needs the length */
+    if (as->pass != 2) {
+        as->pc += (uint32_t)length;
+        return true;
+    }
+
+    int fd = open(resolved_path, O_RDONLY);
+    if (fd < 0) {
+        error(as, "cannot open binary file '%s'", resolved_path);
+        return false;
+    }
 
-    /* Read and emit bytes */
-    for (long i = 0; i < length; i++) {
-        int c = fgetc(fp);
-        if (c == EOF) break;
-        emit_byte(as, (uint8_t)c);
+    /* Read and emit the data a block at a time, without a heap buffer */
+    uint8_t data[16384];
+    while (length > 0) {
+        size_t want = length < (int64_t)sizeof(data) ? (size_t)length : sizeof(data);
+        ssize_t got = pread(fd, data, want, (off_t)offset);
+        if (got <= 0) break;
+        emit_bytes(as, data, (size_t)got);
+        offset += got;
+        length -= got;
     }
 
-    fclose(fp);
+    close(fd);
     return true;
 }
 
@@ -365,7 +334,7 @@ static bool handle_cpu(Assembler *as) {
     /* Collect CPU name - might be identifier or number (e.g., 96c141) */
     char cpu_name[64] = "";
     int pos = 0;
-    Token tok = lexer_peek();
+    Token tok = lexer_peek(&as->lexer);
 
     while (tok.type != TOK_NEWLINE && tok.type != TOK_EOF &&
            tok.type != TOK_COMMA && pos < (int)sizeof(cpu_name) - 1) {
@@ -376,8 +345,8 @@ static bool handle_cpu(Assembler *as) {
                 pos += len;
             }
         }
-        lexer_next();
-        tok = lexer_peek();
+        lexer_next(&as->lexer);
+        tok = lexer_peek(&as->lexer);
     }
     cpu_name[pos] = '\0';
 
@@ -407,9 +376,9 @@ static bool handle_cpu(Assembler *as) {
 
 /* Handle MAXMODE directive */
 static bool handle_maxmode(Assembler *as) {
-    Token tok = lexer_peek();
+    Token tok = lexer_peek(&as->lexer);
     if (tok.type == TOK_IDENTIFIER) {
-        lexer_next();
+        lexer_next(&as->lexer);
         if (strcasecmp(tok.text, "ON") == 0) {
             as->max_mode = true;
         } else if (strcasecmp(tok.text, "OFF") == 0) {
@@ -436,8 +405,24 @@ static bool handle_end(Assembler *as) {
 static bool handle_page(Assembler *as) {
     (void)as;
     /* Skip to end of line */
-    while (lexer_peek().type != TOK_NEWLINE && lexer_peek().type != TOK_EOF) {
-        lexer_next();
+    while (lexer_peek(&as->lexer).type != TOK_NEWLINE && lexer_peek(&as->lexer).type != TOK_EOF) {
+        lexer_next(&as->lexer);
+    }
+    return true;
+}
+
+/* Handle LISTING ON/OFF; other listing controls are ignored */
+static bool handle_listing(Assembler *as) {
+    Token tok = lexer_peek(&as->lexer);
+    if (tok.type == TOK_IDENTIFIER) {
+        if (strcasecmp(tok.text, "ON") == 0) {
+            as->list_enabled = true;
+        } else if (strcasecmp(tok.text, "OFF") == 0) {
+            as->list_enabled = false;
+        }
+    }
+    while (lexer_peek(&as->lexer).type != TOK_NEWLINE && lexer_peek(&as->lexer).type != TOK_EOF) {
+        lexer_next(&as->lexer);
     }
     return true;
 }
@@ -452,7 +437,7 @@ static bool handle_macro(Assembler *as, const char *label) {
     /* Collect the rest of the line as parameter list */
     char params[MAX_LINE_LENGTH] = "";
     int pos = 0;
-    Token tok = lexer_peek();
+    Token tok = lexer_peek(&as->lexer);
     while (tok.type != TOK_NEWLINE && tok.type != TOK_EOF) {
         if (pos > 0 && pos < (int)sizeof(params) - 1) {
             params[pos++] = ' ';
@@ -462,8 +447,8 @@ static bool handle_macro(Assembler *as, const char *label) {
             strcpy(params + pos, tok.text);
             pos += len;
         }
-        lexer_next();
-        tok = lexer_peek();
+        lexer_next(&as->lexer);
+        tok = lexer_peek(&as->lexer);
     }
     params[pos] = '\0';
 
@@ -475,72 +460,77 @@ static bool handle_endm(Assembler *as) {
     return macro_end_definition(as);
 }
 
-/* Check and handle a directive, return true if it was a directive */
-bool handle_directive(Assembler *as, const char *directive, const char *label) {
-    if (is_directive(directive, "ORG")) {
-        return handle_org(as);
-    }
-    if (is_directive(directive, "EQU") || is_directive(directive, "=")) {
-        return handle_equ(as, label);
-    }
-    if (is_directive(directive, "SET")) {
-        return handle_set(as, label);
-    }
-    if (is_directive(directive, "DB") || is_directive(directive, "DEFB") ||
-        is_directive(directive, "DC.B") || is_directive(directive, "FCB") ||
-        is_directive(directive, "BYT") || is_directive(directive, ".BYTE")) {
-        return handle_db(as);
-    }
-    if (is_directive(directive, "DW") || is_directive(directive, "DEFW") ||
-        is_directive(directive, "DC.W") || is_directive(directive, "FDB") ||
-        is_directive(directive, "WOR") || is_directive(directive, ".WORD") ||
-        is_directive(directive, "DATA")) {
-        return handle_dw(as);
-    }
-    if (is_directive(directive, "DD") || is_directive(directive, "DEFL") ||
-        is_directive(directive, "DC.L") || is_directive(directive, ".LONG")) {
-        return handle_dd(as);
-    }
-    if (is_directive(directive, "DS") || is_directive(directive, "DEFS") ||
-        is_directive(directive, "RMB") || is_directive(directive, ".BLKB")) {
-        /* Note: "RES" removed - conflicts with RES instruction (reset bit) */
-        return handle_ds(as);
-    }
-    if (is_directive(directive, "ALIGN")) {
-        return handle_align(as);
-    }
-    if (is_directive(directive, "INCLUDE")) {
-        return handle_include(as);
-    }
-    if (is_directive(directive, "BINCLUDE") || is_directive(directive, "INCBIN")) {
-        return handle_binclude(as);
-    }
-    if (is_directive(directive, "CPU") || is_directive(directive, ".CPU")) {
-        return handle_cpu(as);
-    }
-    if (is_directive(directive, "MAXMODE")) {
-        return handle_maxmode(as);
-    }
-    if (is_directive(directive, "END")) {
-        return handle_end(as);
-    }
-    if (is_directive(directive, "PAGE") || is_directive(directive, "NEWPAGE")) {
-        return handle_page(as);
-    }
-    if (is_directive(directive, "LISTING") || is_directive(directive, "PRTINIT") ||
-        is_directive(directive, "PRTEXIT")) {
-        /* Listing control - ignored */
-        while (lexer_peek().type != TOK_NEWLINE && lexer_peek().type != TOK_EOF) {
-            lexer_next();
-        }
-        return true;
-    }
-    if (is_directive(directive, "MACRO")) {
-        return handle_macro(as, label);
-    }
-    if (is_directive(directive, "ENDM")) {
-        return handle_endm(as);
+/* Directive names, including ASL and other assemblers' aliases */
+static const struct {
+    const char *name;
+    DirectiveId id;
+} directive_table[] = {
+    {"ORG", DIR_ORG},
+    {"EQU", DIR_EQU}, {"=", DIR_EQU},
+    {"SET", DIR_SET},
+    {"DB", DIR_DB}, {"DEFB", DIR_DB}, {"DC.B", DIR_DB}, {"FCB", DIR_DB},
+    {"BYT", DIR_DB}, {".BYTE", DIR_DB},
+    {"DW", DIR_DW}, {"DEFW", DIR_DW}, {"DC.W", DIR_DW}, {"FDB", DIR_DW},
+    {"WOR", DIR_DW}, {".WORD", DIR_DW}, {"DATA", DIR_DW},
+    {"DD", DIR_DD}, {"DEFL", DIR_DD}, {"DC.L", DIR_DD}, {".LONG", DIR_DD},
+    /* Note: "RES" removed - conflicts with RES instruction (reset bit) */
+    {"DS", DIR_DS}, {"DEFS", DIR_DS}, {"RMB", DIR_DS}, {".BLKB", DIR_DS},
+    {"ALIGN", DIR_ALIGN},
+    {"INCLUDE", DIR_INCLUDE},
+    {"BINCLUDE", DIR_BINCLUDE}, {"INCBIN", DIR_BINCLUDE},
+    {"CPU", DIR_CPU}, {".CPU", DIR_CPU},
+    {"MAXMODE", DIR_MAXMODE},
+    {"END", DIR_END},
+    {"PAGE", DIR_PAGE}, {"NEWPAGE", DIR_PAGE},
+    {"LISTING", DIR_LISTING}, {"PRTINIT", DIR_LISTING}, {"PRTEXIT", DIR_LISTING},
+    {"MACRO", DIR_MACRO},
+    {"ENDM", DIR_ENDM},
+    {NULL, DIR_NONE}
+};
+
+/* Add every directive name to the keyword table */
+void directives_register_keywords(void) {
+    for (int i = 0; directive_table[i].name; i++) {
+        keyword_add(directive_table[i].name, directive_table[i].id, NULL);
     }
+}
 
+/* Handle a directive already classified by the keyword table */
+bool handle_directive_id(Assembler *as, DirectiveId id, const char *label) {
+    /* State these leave behind is not something the build cache replays */
+    if (as->cache && (id == DIR_MAXMODE || id == DIR_BINCLUDE || id == DIR_MACRO)) {
+        cache_note_volatile(as);
+    }
+
+    switch (id) {
+        case DIR_ORG:      return handle_org(as);
+        case DIR_EQU:      return handle_equ(as, label);
+        case DIR_SET:      return handle_set(as, label);
+        case DIR_DB:       return handle_data(as, 1);
+        case DIR_DW:       return handle_data(as, 2);
+        case DIR_DD:       return handle_data(as, 4);
+        case DIR_DS:       return handle_ds(as);
+        case DIR_ALIGN:    return handle_align(as);
+        case DIR_INCLUDE:  return handle_include(as);
+        case DIR_BINCLUDE: return handle_binclude(as);
+        case DIR_CPU:      return handle_cpu(as);
+        case DIR_MAXMODE:  return handle_maxmode(as);
+        case DIR_END:      return handle_end(as);
+        case DIR_PAGE:     return handle_page(as);
+        case DIR_LISTING:  return handle_listing(as);
+        case DIR_MACRO:    return handle_macro(as, label);
+        case DIR_ENDM:     return handle_endm(as);
+        case DIR_NONE:
+            break;
+    }
     return false;  /* Not a directive */
 }
+
+/* Check and handle a directive, return true if it was a directive */
+bool handle_directive(Assembler *as, const char *directive, const char *label) {
+    const Keyword *kw = keyword_lookup(directive);
+    if (!kw || kw->directive == DIR_NONE) {
+        return false;  /* Not a directive */
+    }
+    return handle_directive_id(as, (DirectiveId)kw->directive, label);
+}
@@ -1,24 +1,254 @@
 /*
  * TLCS-900 Assembler - Error Reporting
+ *
+ * While a file is assembled, diagnostics are not printed but collected
+ * into the assembler's DiagList: position, kind and message text, the
+ * text kept in an arena.  Pass 1 can sweep the source ten times and
+ * pass 2 once more, so the same error is usually reported several
+ * times; a diagnostic identical to one already collected is dropped.
+ * When assembly ends the list is sorted by file and line (status
+ * messages last) and written out in one go.
+ *
+ * A pass 2 worker (see parallel.c) collects into its chunk's own list,
+ * merged into the assembler's when the chunk is replayed in order.  A
+ * batch target (see batch.c) writes its printed diagnostics to a buffer
+ * instead of stderr, so targets built side by side don't interleave.
+ * Outside assembly, diagnostics are printed as they are reported.
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <stdarg.h>
 #include "../include/tlcs900.h"
 
+static void buffer_append(DiagBuffer *buf, const char *fmt, va_list args) {
+    va_list copy;
+    va_copy(copy, args);
+    int len = vsnprintf(NULL, 0, fmt, copy);
+    va_end(copy);
+    if (len < 0) return;
+
+    if (buf->length + (size_t)len + 1 > buf->capacity) {
+        size_t new_capacity = buf->capacity ? buf->capacity : 256;
+        while (new_capacity < buf->length + (size_t)len + 1) {
+            new_capacity *= 2;
+        }
+        char *new_text = as_realloc(buf->text, new_capacity);
+        if (!new_text) return;
+        buf->text = new_text;
+        buf->capacity = new_capacity;
+    }
+
+    vsnprintf(buf->text + buf->length, buf->capacity - buf->length, fmt, args);
+    buf->length += (size_t)len;
+}
+
+static void buffer_printf(DiagBuffer *buf, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    buffer_append(buf, fmt, args);
+    va_end(args);
+}
+
+static const char *const kind_names[] = { "error", "warning", "" };
+
+static void render(DiagBuffer *out, const char *file, int line, DiagKind kind, const char *text) {
+    if (kind == DIAG_MESSAGE) {
+        buffer_printf(out, "%s\n", text);
+    } else {
+        buffer_printf(out, "%s:%d: %s: %s\n", file, line, kind_names[kind], text);
+    }
+}
+
+/* ---- Collecting ---- */
+
+static uint64_t fnv_add(uint64_t hash, const void *data, size_t len) {
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= p[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static void *grow(void *array, size_t *capacity, size_t count, size_t size) {
+    if (count < *capacity) return array;
+    size_t new_capacity = *capacity ? *capacity * 2 : 64;
+    void *grown = as_realloc(array, new_capacity * size);
+    if (!grown) {
+        fprintf(stderr, "Failed to grow diagnostic list\n");
+        exit(1);
+    }
+    *capacity = new_capacity;
+    return grown;
+}
+
+static uint32_t list_file(DiagList *list, const char *file) {
+    /* Diagnostics come in runs from the same file; look from the end */
+    for (size_t i = list->file_count; i-- > 0;) {
+        if (strcmp(list->files[i], file) == 0) return (uint32_t)i;
+    }
+    list->files = grow(list->files, &list->file_capacity, list->file_count, sizeof(char *));
+    list->files[list->file_count] = arena_strdup(&list->arena, file);
+    return (uint32_t)list->file_count++;
+}
+
+/* Is an identical diagnostic already in the list?  If not, claim its slot */
+static uint32_t *list_find(DiagList *list, const char *file, const Diagnostic *d) {
+    size_t mask = list->slot_count - 1;
+    for (size_t i = d->hash & mask;; i = (i + 1) & mask) {
+        uint32_t *slot = &list->slots[i];
+        if (*slot == 0) return slot;
+        const Diagnostic *other = &list->items[*slot - 1];
+        if (other->hash == d->hash && other->line == d->line && other->kind == d->kind &&
+            strcmp(other->text, d->text) == 0 &&
+            (d->kind == DIAG_MESSAGE || strcmp(list->files[other->file], file) == 0)) {
+            return NULL;
+        }
+    }
+}
+
+static void list_rehash(DiagList *list) {
+    size_t new_count = list->slot_count ? list->slot_count * 2 : 256;
+    uint32_t *slots = as_calloc(new_count, sizeof(uint32_t));
+    if (!slots) {
+        fprintf(stderr, "Failed to grow diagnostic list\n");
+        exit(1);
+    }
+    for (size_t i = 0; i < list->count; i++) {
+        size_t j = list->items[i].hash & (new_count - 1);
+        while (slots[j]) j = (j + 1) & (new_count - 1);
+        slots[j] = (uint32_t)(i + 1);
+    }
+    free(list->slots);
+    list->slots = slots;
+    list->slot_count = new_count;
+}
+
+/* Add a diagnostic unless the list already has it; text is copied */
+static void list_add(DiagList *list, const char *file, int line, DiagKind kind, const char *text) {
+    Diagnostic d;
+    d.line = kind == DIAG_MESSAGE ? 0 : line;
+    d.kind = (uint8_t)kind;
+    d.text = text;
+    d.hash = fnv_add(0xcbf29ce484222325ULL, text, strlen(text));
+    d.hash = fnv_add(d.hash, &d.line, sizeof(d.line));
+    d.hash = fnv_add(d.hash, &d.kind, 1);
+    if (kind != DIAG_MESSAGE) {
+        d.hash = fnv_add(d.hash, file, strlen(file));
+    }
+
+    if ((list->count + 1) * 2 > list->slot_count) {
+        list_rehash(list);
+    }
+    uint32_t *slot = list_find(list, file, &d);
+    if (!slot) return;
+
+    d.file = kind == DIAG_MESSAGE ? 0 : list_file(list, file);
+    d.seq = (uint32_t)list->count;
+    d.text = arena_strdup(&list->arena, text);
+    list->items = grow(list->items, &list->capacity, list->count, sizeof(Diagnostic));
+    list->items[list->count] = d;
+    *slot = (uint32_t)++list->count;
+}
+
+void diag_list_free(DiagList *list) {
+    free(list->items);
+    free(list->files);
+    free(list->slots);
+    arena_free(&list->arena);
+    memset(list, 0, sizeof(*list));
+}
+
+/* Start collecting this assembler's diagnostics */
+void diag_begin(Assembler *as) {
+    diag_list_free(&as->diags);
+    as->diag_list = &as->diags;
+}
+
+/* By file (in order of first report), then line; messages after */
+static int diag_compare(const void *a, const void *b) {
+    const Diagnostic *x = a;
+    const Diagnostic *y = b;
+    bool x_message = x->kind == DIAG_MESSAGE;
+    bool y_message = y->kind == DIAG_MESSAGE;
+    if (x_message != y_message) return x_message ? 1 : -1;
+    if (!x_message) {
+        if (x->file != y->file) return x->file < y->file ? -1 : 1;
+        if (x->line != y->line) return x->line < y->line ? -1 : 1;
+    }
+    return x->seq < y->seq ? -1 : x->seq > y->seq;
+}
+
+/* Print what was collected, sorted, and stop collecting */
+void diag_finish(Assembler *as) {
+    DiagList *list = as->diag_list;
+    if (!list) return;
+    as->diag_list = NULL;
+
+    if (list->count) {
+        qsort(list->items, list->count, sizeof(Diagnostic), diag_compare);
+    }
+    DiagBuffer local = {0};
+    DiagBuffer *out = as->diag_buffer ? as->diag_buffer : &local;
+    for (size_t i = 0; i < list->count; i++) {
+        const Diagnostic *d = &list->items[i];
+        render(out, d->kind == DIAG_MESSAGE ? "" : list->files[d->file], d->line,
+               (DiagKind)d->kind, d->text);
+    }
+    if (local.length > 0) {
+        fwrite(local.text, 1, local.length, stderr);
+    }
+    free(local.text);
+    diag_list_free(list);
+}
+
+/* Collect a diagnostic, or print it when not collecting */
+static void deliver(Assembler *as, const char *file, int line, DiagKind kind, const char *text) {
+    if (as->diag_list) {
+        list_add(as->diag_list, file, line, kind, text);
+        return;
+    }
+
+    DiagBuffer local = {0};
+    DiagBuffer *out = as->diag_buffer ? as->diag_buffer : &local;
+    render(out, file, line, kind, text);
+    if (local.length > 0) {
+        fwrite(local.text, 1, local.length, stderr);
+    }
+    free(local.text);
+}
+
+/* Merge what a worker collected, dropping what is already known */
+void diag_flush(Assembler *as, const DiagList *list) {
+    for (size_t i = 0; i < list->count; i++) {
+        const Diagnostic *d = &list->items[i];
+        const char *file = d->kind == DIAG_MESSAGE ? "" : list->files[d->file];
+        deliver(as, file, d->line, (DiagKind)d->kind, d->text);
+    }
+}
+
+/* ---- Reporting ---- */
+
+static void report(Assembler *as, DiagKind kind, const char *fmt, va_list args) {
+    const char *file = as->current_file ? as->current_file : "<input>";
+    DiagBuffer text = {0};
+    buffer_append(&text, fmt, args);
+    deliver(as, file, as->current_line, kind, text.text ? text.text : "");
+    free(text.text);
+}
+
 void error(Assembler *as, const char *fmt, ...) {
     va_list args;
 
-    fprintf(stderr, "%s:%d: error: ",
-            as->current_file ? as->current_file : "<input>",
-            as->current_line);
+    /* Trial evaluations during replay report nothing */
+    if (as->diag_suppress > 0) return;
 
     va_start(args, fmt);
-    vfprintf(stderr, fmt, args);
+    report(as, DIAG_ERROR, fmt, args);
     va_end(args);
 
-    fprintf(stderr, "\n");
-
     as->errors = true;
     as->error_count++;
 }
@@ -26,15 +256,19 @@ void error(Assembler *as, const char *fmt, ...) {
 void warning(Assembler *as, const char *fmt, ...) {
     va_list args;
 
-    fprintf(stderr, "%s:%d: warning: ",
-            as->current_file ? as->current_file : "<input>",
-            as->current_line);
+    if (as->diag_suppress > 0) return;
 
     va_start(args, fmt);
-    vfprintf(stderr, fmt, args);
+    report(as, DIAG_WARNING, fmt, args);
     va_end(args);
 
-    fprintf(stderr, "\n");
-
     as->warning_count++;
 }
+
+/* Report a message with no source position (build status, output) */
+void diag_message(Assembler *as, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    report(as, DIAG_MESSAGE, fmt, args);
+    va_end(args);
+}
@@ -9,6 +9,19 @@
  * - Logical: !, &&, ||
  * - Special: $ (current address)
  * - Symbols and numeric literals
+ *
+ * Expressions are parsed into small trees (ExprNode), then compiled
+ * into postfix code (ExprCode) that a loop over a value stack
+ * evaluates.  Subtrees of literals and fixed EQUs (constants whose
+ * value came from literals and fixed EQUs only, so it can never change)
+ * are folded into one number while compiling; only labels, SET
+ * symbols, $ and not yet defined names are looked up when the code
+ * runs.  Instruction operands and recorded DB/DW/DD values keep their
+ * code so later passes re-evaluate them without going back to the
+ * tokens.
+ *
+ * A folded symbol leaves an EXPR_REF behind, which does nothing unless
+ * the build cache is recording what the current file references.
  */
 
 #define _POSIX_C_SOURCE 200809L
@@ -20,458 +33,627 @@
 #include "../include/tlcs900.h"
 
 /* Forward declarations for recursive descent */
-static bool parse_expr_or(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_and(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_bitor(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_bitxor(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_bitand(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_equality(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_relational(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_shift(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_additive(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_multiplicative(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_unary(Assembler *as, int64_t *result, bool *known, bool *is_const);
-static bool parse_expr_primary(Assembler *as, int64_t *result, bool *known, bool *is_const);
+static ExprNode *parse_expr_or(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_and(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_bitor(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_bitxor(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_bitand(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_equality(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_relational(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_shift(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_additive(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_multiplicative(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_unary(Assembler *as, Arena *arena);
+static ExprNode *parse_expr_primary(Assembler *as, Arena *arena);
 
 /* External symbol lookup - returns symbol type too */
-extern bool symbol_get_value(Assembler *as, const char *name, int64_t *value);
-extern SymbolType symbol_get_type(Assembler *as, const char *name);
 
-/* Main entry point */
+/* Allocate a tree node */
+static ExprNode *new_node(Arena *arena, ExprOp op, ExprNode *left, ExprNode *right) {
+    ExprNode *node = arena_alloc(arena, sizeof(ExprNode));
+    node->op = op;
+    node->atom = 0;
+    node->value = 0;
+    node->left = left;
+    node->right = right;
+    return node;
+}
+
+/* Parse an expression into a tree allocated from arena */
+ExprNode *expr_parse_tree(Assembler *as, Arena *arena) {
+    return parse_expr_or(as, arena);
+}
+
+/* Wrap a tree in a unary minus (for (reg - offset) displacements) */
+ExprNode *expr_negate(Arena *arena, ExprNode *tree) {
+    return new_node(arena, EXPR_NEG, tree, NULL);
+}
+
+/* Parse an expression and compile it into code allocated from arena */
+const ExprCode *expr_parse_code(Assembler *as, Arena *arena) {
+    ArenaMark mark = arena_mark(&as->scratch);
+    ExprNode *tree = expr_parse_tree(as, &as->scratch);
+    const ExprCode *code = tree ? expr_compile(as, arena, tree) : NULL;
+    if (arena != &as->scratch) {
+        arena_release(&as->scratch, mark);
+    }
+    return code;
+}
+
+/*
+ * Parse and evaluate in one step.  folded (if given) tells whether the
+ * value came from literals and fixed EQUs only.
+ */
+bool expr_parse_folded(Assembler *as, int64_t *result, bool *known, bool *is_constant, bool *folded) {
+    ArenaMark mark = arena_mark(&as->scratch);
+    const ExprCode *code = expr_parse_code(as, &as->scratch);
+    bool ok = code && expr_eval(as, code, result, known, is_constant);
+    if (folded) {
+        *folded = ok && code->constant;
+    }
+    arena_release(&as->scratch, mark);
+    return ok;
+}
+
+/* Main entry point: parse and evaluate in one step */
 bool expr_parse(Assembler *as, int64_t *result, bool *known, bool *is_constant) {
-    *known = true;
-    *is_constant = true;
-    return parse_expr_or(as, result, known, is_constant);
+    return expr_parse_folded(as, result, known, is_constant, NULL);
 }
 
 /* Logical OR: || */
-static bool parse_expr_or(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_and(as, result, known, is_const)) return false;
+static ExprNode *parse_expr_or(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_and(as, arena);
+    if (!left) return NULL;
 
-    while (lexer_peek().type == TOK_PIPE) {
-        Token tok = lexer_peek();
+    while (lexer_peek(&as->lexer).type == TOK_PIPE) {
+        Token tok = lexer_peek(&as->lexer);
         if (tok.text[1] == '|') {
-            lexer_next(); /* consume || */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_and(as, &right, &right_known, &right_const)) return false;
-            *result = *result || right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            lexer_next(&as->lexer); /* consume || */
+            ExprNode *right = parse_expr_and(as, arena);
+            if (!right) return NULL;
+            left = new_node(arena, EXPR_LOR, left, right);
         } else {
             break;
         }
     }
-    return true;
+    return left;
 }
 
 /* Logical AND: && */
-static bool parse_expr_and(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_bitor(as, result, known, is_const)) return false;
+static ExprNode *parse_expr_and(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_bitor(as, arena);
+    if (!left) return NULL;
 
-    while (lexer_peek().type == TOK_AMPERSAND) {
-        Token tok = lexer_peek();
+    while (lexer_peek(&as->lexer).type == TOK_AMPERSAND) {
+        Token tok = lexer_peek(&as->lexer);
         if (tok.text[1] == '&') {
-            lexer_next(); /* consume && */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_bitor(as, &right, &right_known, &right_const)) return false;
-            *result = *result && right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            lexer_next(&as->lexer); /* consume && */
+            ExprNode *right = parse_expr_bitor(as, arena);
+            if (!right) return NULL;
+            left = new_node(arena, EXPR_LAND, left, right);
         } else {
             break;
         }
     }
-    return true;
+    return left;
 }
 
 /* Bitwise OR: | */
-static bool parse_expr_bitor(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_bitxor(as, result, known, is_const)) return false;
-
-    while (lexer_peek().type == TOK_PIPE && lexer_peek().text[1] != '|') {
-        lexer_next(); /* consume | */
-        int64_t right;
-        bool right_known = true;
-        bool right_const = true;
-        if (!parse_expr_bitxor(as, &right, &right_known, &right_const)) return false;
-        *result = *result | right;
-        *known = *known && right_known;
-        *is_const = *is_const && right_const;
+static ExprNode *parse_expr_bitor(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_bitxor(as, arena);
+    if (!left) return NULL;
+
+    while (lexer_peek(&as->lexer).type == TOK_PIPE && lexer_peek(&as->lexer).text[1] != '|') {
+        lexer_next(&as->lexer); /* consume | */
+        ExprNode *right = parse_expr_bitxor(as, arena);
+        if (!right) return NULL;
+        left = new_node(arena, EXPR_OR, left, right);
     }
-    return true;
+    return left;
 }
 
 /* Bitwise XOR: ^ */
-static bool parse_expr_bitxor(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_bitand(as, result, known, is_const)) return false;
-
-    while (lexer_peek().type == TOK_CARET) {
-        lexer_next(); /* consume ^ */
-        int64_t right;
-        bool right_known = true;
-        bool right_const = true;
-        if (!parse_expr_bitand(as, &right, &right_known, &right_const)) return false;
-        *result = *result ^ right;
-        *known = *known && right_known;
-        *is_const = *is_const && right_const;
+static ExprNode *parse_expr_bitxor(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_bitand(as, arena);
+    if (!left) return NULL;
+
+    while (lexer_peek(&as->lexer).type == TOK_CARET) {
+        lexer_next(&as->lexer); /* consume ^ */
+        ExprNode *right = parse_expr_bitand(as, arena);
+        if (!right) return NULL;
+        left = new_node(arena, EXPR_XOR, left, right);
     }
-    return true;
+    return left;
 }
 
 /* Bitwise AND: & */
-static bool parse_expr_bitand(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_equality(as, result, known, is_const)) return false;
-
-    while (lexer_peek().type == TOK_AMPERSAND && lexer_peek().text[1] != '&') {
-        lexer_next(); /* consume & */
-        int64_t right;
-        bool right_known = true;
-        bool right_const = true;
-        if (!parse_expr_equality(as, &right, &right_known, &right_const)) return false;
-        *result = *result & right;
-        *known = *known && right_known;
-        *is_const = *is_const && right_const;
+static ExprNode *parse_expr_bitand(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_equality(as, arena);
+    if (!left) return NULL;
+
+    while (lexer_peek(&as->lexer).type == TOK_AMPERSAND && lexer_peek(&as->lexer).text[1] != '&') {
+        lexer_next(&as->lexer); /* consume & */
+        ExprNode *right = parse_expr_equality(as, arena);
+        if (!right) return NULL;
+        left = new_node(arena, EXPR_AND, left, right);
     }
-    return true;
+    return left;
 }
 
 /* Equality: ==, != */
-static bool parse_expr_equality(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_relational(as, result, known, is_const)) return false;
+static ExprNode *parse_expr_equality(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_relational(as, arena);
+    if (!left) return NULL;
 
     while (true) {
-        Token tok = lexer_peek();
+        Token tok = lexer_peek(&as->lexer);
+        ExprOp op;
         if (tok.type == TOK_EQUALS && tok.text[1] == '=') {
-            lexer_next(); /* consume == */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_relational(as, &right, &right_known, &right_const)) return false;
-            *result = (*result == right) ? 1 : 0;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_EQ;
         } else if (tok.type == TOK_EXCLAIM && tok.text[1] == '=') {
-            lexer_next(); /* consume != */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_relational(as, &right, &right_known, &right_const)) return false;
-            *result = (*result != right) ? 1 : 0;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_NE;
         } else {
             break;
         }
+        lexer_next(&as->lexer); /* consume == or != */
+        ExprNode *right = parse_expr_relational(as, arena);
+        if (!right) return NULL;
+        left = new_node(arena, op, left, right);
     }
-    return true;
+    return left;
 }
 
 /* Relational: <, >, <=, >= */
-static bool parse_expr_relational(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_shift(as, result, known, is_const)) return false;
+static ExprNode *parse_expr_relational(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_shift(as, arena);
+    if (!left) return NULL;
 
     while (true) {
-        Token tok = lexer_peek();
+        Token tok = lexer_peek(&as->lexer);
+        ExprOp op;
         if (tok.type == TOK_LT) {
-            lexer_next();
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_shift(as, &right, &right_known, &right_const)) return false;
-            if (tok.text[1] == '=') {
-                *result = (*result <= right) ? 1 : 0;
-            } else {
-                *result = (*result < right) ? 1 : 0;
-            }
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = (tok.text[1] == '=') ? EXPR_LE : EXPR_LT;
         } else if (tok.type == TOK_GT) {
-            lexer_next();
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_shift(as, &right, &right_known, &right_const)) return false;
-            if (tok.text[1] == '=') {
-                *result = (*result >= right) ? 1 : 0;
-            } else {
-                *result = (*result > right) ? 1 : 0;
-            }
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = (tok.text[1] == '=') ? EXPR_GE : EXPR_GT;
         } else {
             break;
         }
+        lexer_next(&as->lexer);
+        ExprNode *right = parse_expr_shift(as, arena);
+        if (!right) return NULL;
+        left = new_node(arena, op, left, right);
     }
-    return true;
+    return left;
 }
 
 /* Shift: <<, >> */
-static bool parse_expr_shift(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_additive(as, result, known, is_const)) return false;
+static ExprNode *parse_expr_shift(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_additive(as, arena);
+    if (!left) return NULL;
 
     while (true) {
-        Token tok = lexer_peek();
+        Token tok = lexer_peek(&as->lexer);
+        ExprOp op;
         if (tok.type == TOK_LSHIFT) {
-            lexer_next(); /* consume << */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_additive(as, &right, &right_known, &right_const)) return false;
-            *result = *result << right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_SHL;
         } else if (tok.type == TOK_RSHIFT) {
-            lexer_next(); /* consume >> */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_additive(as, &right, &right_known, &right_const)) return false;
-            *result = *result >> right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_SHR;
         } else {
             break;
         }
+        lexer_next(&as->lexer); /* consume << or >> */
+        ExprNode *right = parse_expr_additive(as, arena);
+        if (!right) return NULL;
+        left = new_node(arena, op, left, right);
     }
-    return true;
+    return left;
 }
 
 /* Additive: +, - */
-static bool parse_expr_additive(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_multiplicative(as, result, known, is_const)) return false;
+static ExprNode *parse_expr_additive(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_multiplicative(as, arena);
+    if (!left) return NULL;
 
     while (true) {
-        Token tok = lexer_peek();
+        Token tok = lexer_peek(&as->lexer);
+        ExprOp op;
         if (tok.type == TOK_PLUS) {
-            lexer_next(); /* consume + */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_multiplicative(as, &right, &right_known, &right_const)) return false;
-            *result = *result + right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_ADD;
         } else if (tok.type == TOK_MINUS) {
-            lexer_next(); /* consume - */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_multiplicative(as, &right, &right_known, &right_const)) return false;
-            *result = *result - right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_SUB;
         } else {
             break;
         }
+        lexer_next(&as->lexer); /* consume + or - */
+        ExprNode *right = parse_expr_multiplicative(as, arena);
+        if (!right) return NULL;
+        left = new_node(arena, op, left, right);
     }
-    return true;
+    return left;
 }
 
 /* Multiplicative: *, /, % */
-static bool parse_expr_multiplicative(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    if (!parse_expr_unary(as, result, known, is_const)) return false;
+static ExprNode *parse_expr_multiplicative(Assembler *as, Arena *arena) {
+    ExprNode *left = parse_expr_unary(as, arena);
+    if (!left) return NULL;
 
     while (true) {
-        Token tok = lexer_peek();
+        Token tok = lexer_peek(&as->lexer);
+        ExprOp op;
         if (tok.type == TOK_STAR) {
-            lexer_next(); /* consume * */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_unary(as, &right, &right_known, &right_const)) return false;
-            *result = *result * right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_MUL;
         } else if (tok.type == TOK_SLASH) {
-            lexer_next(); /* consume / */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_unary(as, &right, &right_known, &right_const)) return false;
-            if (right == 0) {
-                error(as, "division by zero");
-                return false;
-            }
-            *result = *result / right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_DIV;
         } else if (tok.type == TOK_PERCENT) {
-            lexer_next(); /* consume % (but not if it's binary prefix) */
-            int64_t right;
-            bool right_known = true;
-            bool right_const = true;
-            if (!parse_expr_unary(as, &right, &right_known, &right_const)) return false;
-            if (right == 0) {
-                error(as, "modulo by zero");
-                return false;
-            }
-            *result = *result % right;
-            *known = *known && right_known;
-            *is_const = *is_const && right_const;
+            op = EXPR_MOD;
         } else {
             break;
         }
+        lexer_next(&as->lexer); /* consume operator */
+        ExprNode *right = parse_expr_unary(as, arena);
+        if (!right) return NULL;
+        left = new_node(arena, op, left, right);
     }
-    return true;
+    return left;
 }
 
 /* Unary: -, ~, !, + */
-static bool parse_expr_unary(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    Token tok = lexer_peek();
+static ExprNode *parse_expr_unary(Assembler *as, Arena *arena) {
+    Token tok = lexer_peek(&as->lexer);
+    ExprOp op;
 
     if (tok.type == TOK_MINUS) {
-        lexer_next(); /* consume - */
-        if (!parse_expr_unary(as, result, known, is_const)) return false;
-        *result = -*result;
-        return true;
+        op = EXPR_NEG;
+    } else if (tok.type == TOK_PLUS) {
+        lexer_next(&as->lexer); /* consume + */
+        return parse_expr_unary(as, arena);
+    } else if (tok.type == TOK_TILDE) {
+        op = EXPR_NOT;
+    } else if (tok.type == TOK_EXCLAIM && tok.text[1] != '=') {
+        op = EXPR_LNOT;
+    } else {
+        return parse_expr_primary(as, arena);
     }
 
-    if (tok.type == TOK_PLUS) {
-        lexer_next(); /* consume + */
-        return parse_expr_unary(as, result, known, is_const);
-    }
+    lexer_next(&as->lexer); /* consume operator */
+    ExprNode *operand = parse_expr_unary(as, arena);
+    if (!operand) return NULL;
+    return new_node(arena, op, operand, NULL);
+}
 
-    if (tok.type == TOK_TILDE) {
-        lexer_next(); /* consume ~ */
-        if (!parse_expr_unary(as, result, known, is_const)) return false;
-        *result = ~*result;
-        return true;
+/* Built-in function: NAME(expr) */
+static ExprNode *parse_function(Assembler *as, Arena *arena, ExprOp op, const char *name) {
+    if (lexer_peek(&as->lexer).type != TOK_LPAREN) {
+        error(as, "expected '(' after %s", name);
+        return NULL;
     }
-
-    if (tok.type == TOK_EXCLAIM && tok.text[1] != '=') {
-        lexer_next(); /* consume ! */
-        if (!parse_expr_unary(as, result, known, is_const)) return false;
-        *result = !*result;
-        return true;
+    lexer_next(&as->lexer); /* consume ( */
+    ExprNode *arg = parse_expr_or(as, arena);
+    if (!arg) return NULL;
+    if (lexer_peek(&as->lexer).type != TOK_RPAREN) {
+        error(as, "expected ')' after %s expression", name);
+        return NULL;
     }
-
-    return parse_expr_primary(as, result, known, is_const);
+    lexer_next(&as->lexer); /* consume ) */
+    return new_node(arena, op, arg, NULL);
 }
 
 /* Primary: numbers, symbols, $, parenthesized expressions */
-static bool parse_expr_primary(Assembler *as, int64_t *result, bool *known, bool *is_const) {
-    Token tok = lexer_peek();
-
-    /* Number literal - always constant */
-    if (tok.type == TOK_NUMBER) {
-        lexer_next();
-        *result = tok.value;
-        /* is_const stays true */
-        return true;
-    }
-
-    /* Character literal - always constant */
-    if (tok.type == TOK_CHAR) {
-        lexer_next();
-        *result = tok.value;
-        /* is_const stays true */
-        return true;
+static ExprNode *parse_expr_primary(Assembler *as, Arena *arena) {
+    Token tok = lexer_peek(&as->lexer);
+
+    /* Number or character literal - always constant */
+    if (tok.type == TOK_NUMBER || tok.type == TOK_CHAR) {
+        lexer_next(&as->lexer);
+        ExprNode *node = new_node(arena, EXPR_NUMBER, NULL, NULL);
+        node->value = tok.value;
+        return node;
     }
 
-    /* $ - current address - NOT constant (it's a label-like value) */
+    /* $ - current address */
     if (tok.type == TOK_DOLLAR) {
-        lexer_next();
-        *result = as->pc;
-        *is_const = false;  /* Address, not a numeric constant */
-        return true;
+        lexer_next(&as->lexer);
+        return new_node(arena, EXPR_PC, NULL, NULL);
     }
 
     /* Parenthesized expression */
     if (tok.type == TOK_LPAREN) {
-        lexer_next(); /* consume ( */
-        if (!parse_expr_or(as, result, known, is_const)) return false;
-        tok = lexer_peek();
+        lexer_next(&as->lexer); /* consume ( */
+        ExprNode *inner = parse_expr_or(as, arena);
+        if (!inner) return NULL;
+        tok = lexer_peek(&as->lexer);
         if (tok.type != TOK_RPAREN) {
             error(as, "expected ')' in expression");
-            return false;
+            return NULL;
         }
-        lexer_next(); /* consume ) */
-        return true;
+        lexer_next(&as->lexer); /* consume ) */
+        return inner;
     }
 
     /* Symbol reference */
     if (tok.type == TOK_IDENTIFIER) {
-        lexer_next();
+        lexer_next(&as->lexer);
 
         /* Check for built-in functions */
         if (strcasecmp(tok.text, "HIGH") == 0 || strcasecmp(tok.text, "HI") == 0) {
-            if (lexer_peek().type != TOK_LPAREN) {
-                error(as, "expected '(' after HIGH");
-                return false;
-            }
-            lexer_next(); /* consume ( */
-            if (!parse_expr_or(as, result, known, is_const)) return false;
-            if (lexer_peek().type != TOK_RPAREN) {
-                error(as, "expected ')' after HIGH expression");
-                return false;
-            }
-            lexer_next(); /* consume ) */
-            *result = (*result >> 8) & 0xFF;
-            return true;
+            return parse_function(as, arena, EXPR_HIGH, "HIGH");
         }
-
         if (strcasecmp(tok.text, "LOW") == 0 || strcasecmp(tok.text, "LO") == 0) {
-            if (lexer_peek().type != TOK_LPAREN) {
-                error(as, "expected '(' after LOW");
-                return false;
-            }
-            lexer_next(); /* consume ( */
-            if (!parse_expr_or(as, result, known, is_const)) return false;
-            if (lexer_peek().type != TOK_RPAREN) {
-                error(as, "expected ')' after LOW expression");
-                return false;
-            }
-            lexer_next(); /* consume ) */
-            *result = *result & 0xFF;
-            return true;
+            return parse_function(as, arena, EXPR_LOW, "LOW");
         }
-
         if (strcasecmp(tok.text, "BANK") == 0) {
-            if (lexer_peek().type != TOK_LPAREN) {
-                error(as, "expected '(' after BANK");
-                return false;
-            }
-            lexer_next(); /* consume ( */
-            if (!parse_expr_or(as, result, known, is_const)) return false;
-            if (lexer_peek().type != TOK_RPAREN) {
-                error(as, "expected ')' after BANK expression");
-                return false;
-            }
-            lexer_next(); /* consume ) */
-            *result = (*result >> 16) & 0xFF;
-            return true;
+            return parse_function(as, arena, EXPR_BANK, "BANK");
         }
 
-        /* Regular symbol lookup */
-        if (symbol_get_value(as, tok.text, result)) {
-            /* Check symbol type to determine if it's a constant */
-            SymbolType sym_type = symbol_get_type(as, tok.text);
-            if (sym_type == SYM_EQU || sym_type == SYM_SET) {
-                /* EQU/SET symbols are constants */
-                /* is_const stays true */
-            } else {
-                /* Labels are not constants - they're addresses */
-                *is_const = false;
-            }
-            return true;
+        ExprNode *node = new_node(arena, EXPR_SYMBOL, NULL, NULL);
+        node->atom = tok.atom;
+        return node;
+    }
+
+    error(as, "expected expression, got '%s'", tok.text);
+    return NULL;
+}
+
+/* ---- Operators ---- */
+
+static int64_t apply_unary(ExprOp op, int64_t v) {
+    switch (op) {
+        case EXPR_NEG:  return -v;
+        case EXPR_NOT:  return ~v;
+        case EXPR_LNOT: return !v;
+        case EXPR_HIGH: return (v >> 8) & 0xFF;
+        case EXPR_LOW:  return v & 0xFF;
+        default:        return (v >> 16) & 0xFF;   /* EXPR_BANK */
+    }
+}
+
+/* False for a zero divisor (or an unknown operator) */
+static bool apply_binary(ExprOp op, int64_t left, int64_t right, int64_t *result) {
+    switch (op) {
+        case EXPR_LOR:  *result = left || right; break;
+        case EXPR_LAND: *result = left && right; break;
+        case EXPR_OR:   *result = left | right; break;
+        case EXPR_XOR:  *result = left ^ right; break;
+        case EXPR_AND:  *result = left & right; break;
+        case EXPR_EQ:   *result = (left == right) ? 1 : 0; break;
+        case EXPR_NE:   *result = (left != right) ? 1 : 0; break;
+        case EXPR_LT:   *result = (left < right) ? 1 : 0; break;
+        case EXPR_LE:   *result = (left <= right) ? 1 : 0; break;
+        case EXPR_GT:   *result = (left > right) ? 1 : 0; break;
+        case EXPR_GE:   *result = (left >= right) ? 1 : 0; break;
+        case EXPR_SHL:  *result = left << right; break;
+        case EXPR_SHR:  *result = left >> right; break;
+        case EXPR_ADD:  *result = left + right; break;
+        case EXPR_SUB:  *result = left - right; break;
+        case EXPR_MUL:  *result = left * right; break;
+        case EXPR_DIV:
+            if (right == 0) return false;
+            *result = left / right;
+            break;
+        case EXPR_MOD:
+            if (right == 0) return false;
+            *result = left % right;
+            break;
+        default:
+            return false;
+    }
+    return true;
+}
+
+static bool is_unary(ExprOp op) {
+    return op >= EXPR_NEG && op <= EXPR_BANK;
+}
+
+/* ---- Compiling ---- */
+
+typedef struct {
+    Assembler *as;
+    ExprCode *code;
+    bool uses_pc;
+} ExprCompiler;
+
+static int count_nodes(const ExprNode *node) {
+    return node ? 1 + count_nodes(node->left) + count_nodes(node->right) : 0;
+}
+
+static void emit_insn(ExprCompiler *c, ExprOp op, uint32_t atom, int64_t value) {
+    ExprInsn *insn = &c->code->insns[c->code->count++];
+    insn->op = (uint8_t)op;
+    insn->atom = atom;
+    insn->value = value;
+}
+
+/* Replace the code from start on with value, keeping its symbol notes */
+static void fold(ExprCompiler *c, uint16_t start, int64_t value) {
+    uint16_t kept = start;
+    for (uint16_t i = start; i < c->code->count; i++) {
+        if (c->code->insns[i].op == EXPR_REF) {
+            c->code->insns[kept++] = c->code->insns[i];
         }
+    }
+    c->code->count = kept;
+    emit_insn(c, EXPR_NUMBER, 0, value);
+}
+
+/* Emit postfix code for a subtree; true (with its value) if it folded */
+static bool compile_node(ExprCompiler *c, const ExprNode *node, int64_t *value) {
+    Assembler *as = c->as;
+    uint16_t start = c->code->count;
 
-        /* Symbol not defined yet - might be forward reference */
-        if (as->pass == 1) {
-            *result = 0;
-            *known = false;
-            *is_const = false;  /* Unknown symbol, assume it's a label */
+    switch ((ExprOp)node->op) {
+        case EXPR_NUMBER:
+            emit_insn(c, EXPR_NUMBER, 0, node->value);
+            *value = node->value;
             return true;
+
+        case EXPR_PC:
+            emit_insn(c, EXPR_PC, 0, 0);
+            c->uses_pc = true;
+            return false;
+
+        case EXPR_SYMBOL: {
+            Symbol *sym = symbol_lookup_atom(as, node->atom);
+            if (sym && sym->defined && sym->fixed && sym->type == SYM_EQU) {
+                if (!as->worker) sym->referenced = true;
+                emit_insn(c, EXPR_REF, node->atom, 0);
+                emit_insn(c, EXPR_NUMBER, 0, sym->value);
+                *value = sym->value;
+                return true;
+            }
+            emit_insn(c, EXPR_SYMBOL, node->atom, 0);
+            return false;
         }
 
-        error(as, "undefined symbol '%s'", tok.text);
+        default:
+            break;
+    }
+
+    if (is_unary((ExprOp)node->op)) {
+        int64_t v;
+        if (compile_node(c, node->left, &v)) {
+            *value = apply_unary((ExprOp)node->op, v);
+            fold(c, start, *value);
+            return true;
+        }
+        emit_insn(c, (ExprOp)node->op, 0, 0);
         return false;
     }
 
-    error(as, "expected expression, got '%s'", tok.text);
+    /* Binary; a zero divisor is left for evaluation to report */
+    int64_t left, right;
+    bool left_folded = compile_node(c, node->left, &left);
+    bool right_folded = compile_node(c, node->right, &right);
+    if (left_folded && right_folded && apply_binary((ExprOp)node->op, left, right, value)) {
+        fold(c, start, *value);
+        return true;
+    }
+    emit_insn(c, (ExprOp)node->op, 0, 0);
     return false;
 }
+
+/* Compile a tree into postfix code allocated from arena */
+ExprCode *expr_compile(Assembler *as, Arena *arena, const ExprNode *tree) {
+    /* A symbol can take two instructions; folding only ever shrinks */
+    int nodes = count_nodes(tree);
+    ExprCode *code = arena_alloc(arena, sizeof(ExprCode) + 2 * (size_t)nodes * sizeof(ExprInsn));
+    code->count = 0;
+
+    ExprCompiler c = { as, code, false };
+    int64_t value;
+    code->constant = compile_node(&c, tree, &value);
+    code->uses_pc = c.uses_pc;
+
+    /* The value stack evaluation needs */
+    int depth = 0, max_depth = 0;
+    for (uint16_t i = 0; i < code->count; i++) {
+        ExprOp op = (ExprOp)code->insns[i].op;
+        if (op == EXPR_NUMBER || op == EXPR_SYMBOL || op == EXPR_PC) {
+            if (++depth > max_depth) max_depth = depth;
+        } else if (op != EXPR_REF && !is_unary(op)) {
+            depth--;
+        }
+    }
+    if (max_depth > EXPR_STACK_DEPTH) {
+        error(as, "expression nested too deeply");
+        return NULL;
+    }
+    return code;
+}
+
+/* ---- Evaluation ---- */
+
+/* Run compiled code (expr_eval is the timed entry point) */
+static bool run_code(Assembler *as, const ExprCode *code, int64_t *result, bool *known, bool *is_constant) {
+    int64_t stack[EXPR_STACK_DEPTH];
+    int sp = 0;
+    *known = true;
+    *is_constant = true;
+
+    for (uint16_t i = 0; i < code->count; i++) {
+        const ExprInsn *insn = &code->insns[i];
+        switch ((ExprOp)insn->op) {
+            case EXPR_NUMBER:
+                stack[sp++] = insn->value;
+                break;
+
+            case EXPR_PC:
+                /* $ is an address, not a numeric constant */
+                stack[sp++] = as->pc;
+                *is_constant = false;
+                break;
+
+            case EXPR_REF:
+                /* The build cache must still see folded symbols used */
+                if (as->cache_tracking) {
+                    symbol_lookup_atom(as, insn->atom);
+                }
+                break;
+
+            case EXPR_SYMBOL: {
+                /* One memoized lookup gives value, type and defined state */
+                Symbol *sym = symbol_lookup_atom(as, insn->atom);
+                if (sym && as->worker) {
+                    /* SET values depend on position; leave them to the serial pass */
+                    if (sym->type == SYM_SET) {
+                        as->worker_tainted = true;
+                    }
+                } else if (sym) {
+                    sym->referenced = true;
+                }
+                if (sym && sym->defined) {
+                    stack[sp++] = sym->value;
+                    /* EQU/SET symbols are constants, labels are addresses */
+                    if (sym->type != SYM_EQU && sym->type != SYM_SET) {
+                        *is_constant = false;
+                    }
+                    break;
+                }
+
+                /* Symbol not defined yet - might be forward reference */
+                if (as->pass == 1) {
+                    stack[sp++] = 0;
+                    *known = false;
+                    *is_constant = false;  /* Unknown symbol, assume it's a label */
+                    break;
+                }
+
+                error(as, "undefined symbol '%s'", strpool_text(&as->strings, insn->atom));
+                return false;
+            }
+
+            case EXPR_NEG:
+            case EXPR_NOT:
+            case EXPR_LNOT:
+            case EXPR_HIGH:
+            case EXPR_LOW:
+            case EXPR_BANK:
+                stack[sp - 1] = apply_unary((ExprOp)insn->op, stack[sp - 1]);
+                break;
+
+            default:
+                sp--;
+                if (!apply_binary((ExprOp)insn->op, stack[sp - 1], stack[sp], &stack[sp - 1])) {
+                    if (insn->op == EXPR_DIV) {
+                        error(as, "division by zero");
+                    } else if (insn->op == EXPR_MOD) {
+                        error(as, "modulo by zero");
+                    } else {
+                        error(as, "invalid expression");
+                    }
+                    return false;
+                }
+                break;
+        }
+    }
+
+    *result = stack[0];
+    return true;
+}
+
+/* Evaluate compiled code against the current symbol values */
+bool expr_eval(Assembler *as, const ExprCode *code, int64_t *result, bool *known, bool *is_constant) {
+    StatsPhase prev = stats_enter(as, PHASE_EXPR);
+    bool ok = run_code(as, code, result, known, is_constant);
+    stats_leave(as, prev);
+    return ok;
+}
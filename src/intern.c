@@ -0,0 +1,188 @@
+/*
+ * TLCS-900 Assembler - String Interning
+ *
+ * Token texts (identifiers, numbers, strings, punctuation) are stored
+ * once in a string pool and referred to by a small integer id.  Atom
+ * storage is allocated in large blocks that never move, so pointers to
+ * atom text stay valid for the lifetime of the pool.
+ *
+ * Each atom also records a case-folded FNV-1a hash for use as a
+ * case-insensitive key (symbol names, mnemonics).
+ *
+ * A pool can start as a copy of another one that is no longer changing
+ * (see batch.c): atom ids carry over, so tokens built against the
+ * original stay valid, while the atom storage itself is borrowed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "../include/tlcs900.h"
+
+#define POOL_BLOCK_SIZE     65536
+#define POOL_INITIAL_SLOTS  4096
+
+/* Allocate atom storage from the current block */
+static Atom *pool_alloc_atom(StringPool *pool, size_t len) {
+    size_t need = sizeof(Atom) + len + 1;
+    need = (need + 7) & ~(size_t)7;
+
+    if (!pool->block || pool->block_used + need > pool->block_size) {
+        size_t size = need > POOL_BLOCK_SIZE ? need : POOL_BLOCK_SIZE;
+        StringBlock *block = as_malloc(sizeof(StringBlock) + size);
+        if (!block) {
+            fprintf(stderr, "Failed to allocate string pool block\n");
+            exit(1);
+        }
+        block->next = pool->block;
+        pool->block = block;
+        pool->block_size = size;
+        pool->block_used = 0;
+    }
+
+    Atom *atom = (Atom *)(pool->block->data + pool->block_used);
+    pool->block_used += need;
+    return atom;
+}
+
+/* Rebuild the lookup table at twice the size */
+static void pool_grow_table(StringPool *pool) {
+    size_t new_size = pool->table_size * 2;
+    uint32_t *table = as_calloc(new_size, sizeof(uint32_t));
+    if (!table) {
+        fprintf(stderr, "Failed to grow string pool\n");
+        exit(1);
+    }
+
+    for (size_t i = 0; i < pool->table_size; i++) {
+        uint32_t id = pool->table[i];
+        if (id == 0) continue;
+        size_t slot = pool->exact_hash[id] & (new_size - 1);
+        while (table[slot] != 0) {
+            slot = (slot + 1) & (new_size - 1);
+        }
+        table[slot] = id;
+    }
+
+    free(pool->table);
+    pool->table = table;
+    pool->table_size = new_size;
+}
+
+void strpool_init(StringPool *pool) {
+    memset(pool, 0, sizeof(*pool));
+    pool->table_size = POOL_INITIAL_SLOTS;
+    pool->table = as_calloc(pool->table_size, sizeof(uint32_t));
+    pool->atom_capacity = POOL_INITIAL_SLOTS;
+    pool->atoms = as_malloc(pool->atom_capacity * sizeof(Atom *));
+    pool->exact_hash = as_malloc(pool->atom_capacity * sizeof(uint32_t));
+    if (!pool->table || !pool->atoms || !pool->exact_hash) {
+        fprintf(stderr, "Failed to allocate string pool\n");
+        exit(1);
+    }
+
+    /* Id 0 is the empty string; table slots use 0 as "empty" */
+    Atom *empty = pool_alloc_atom(pool, 0);
+    empty->hash = 2166136261u;
+    empty->length = 0;
+    empty->text[0] = '\0';
+    pool->atoms[0] = empty;
+    pool->exact_hash[0] = 2166136261u;
+    pool->atom_count = 1;
+}
+
+/* Start a pool with every atom of base; base must outlive it unchanged */
+void strpool_init_from(StringPool *pool, const StringPool *base) {
+    memset(pool, 0, sizeof(*pool));
+    pool->table_size = base->table_size;
+    pool->atom_count = base->atom_count;
+    pool->atom_capacity = base->atom_capacity;
+    pool->table = as_malloc(pool->table_size * sizeof(uint32_t));
+    pool->atoms = as_malloc(pool->atom_capacity * sizeof(Atom *));
+    pool->exact_hash = as_malloc(pool->atom_capacity * sizeof(uint32_t));
+    if (!pool->table || !pool->atoms || !pool->exact_hash) {
+        fprintf(stderr, "Failed to allocate string pool\n");
+        exit(1);
+    }
+    memcpy(pool->table, base->table, pool->table_size * sizeof(uint32_t));
+    memcpy(pool->atoms, base->atoms, pool->atom_count * sizeof(Atom *));
+    memcpy(pool->exact_hash, base->exact_hash, pool->atom_count * sizeof(uint32_t));
+    /* New atoms go into blocks of this pool's own */
+}
+
+void strpool_free(StringPool *pool) {
+    StringBlock *block = pool->block;
+    while (block) {
+        StringBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    free(pool->table);
+    free(pool->atoms);
+    free(pool->exact_hash);
+    memset(pool, 0, sizeof(*pool));
+}
+
+/* Case-folded FNV-1a hash, as stored in Atom.hash */
+uint32_t strpool_hash_folded(const char *s, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)toupper((unsigned char)s[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/* Intern a string, returning its atom id */
+uint32_t strpool_intern(StringPool *pool, const char *s, size_t len) {
+    if (len == 0) return 0;
+
+    /* Exact hash for the pool, case-folded hash for symbol lookups */
+    uint32_t exact = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        exact ^= (uint8_t)s[i];
+        exact *= 16777619u;
+    }
+
+    size_t mask = pool->table_size - 1;
+    size_t slot = exact & mask;
+    while (pool->table[slot] != 0) {
+        uint32_t id = pool->table[slot];
+        const Atom *atom = pool->atoms[id];
+        if (pool->exact_hash[id] == exact && atom->length == len &&
+            memcmp(atom->text, s, len) == 0) {
+            return id;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    /* New atom */
+    if (pool->atom_count >= pool->atom_capacity) {
+        pool->atom_capacity *= 2;
+        pool->atoms = as_realloc(pool->atoms, pool->atom_capacity * sizeof(Atom *));
+        pool->exact_hash = as_realloc(pool->exact_hash, pool->atom_capacity * sizeof(uint32_t));
+        if (!pool->atoms || !pool->exact_hash) {
+            fprintf(stderr, "Failed to grow string pool\n");
+            exit(1);
+        }
+    }
+
+    Atom *atom = pool_alloc_atom(pool, len);
+    atom->hash = strpool_hash_folded(s, len);
+    atom->length = (uint32_t)len;
+    memcpy(atom->text, s, len);
+    atom->text[len] = '\0';
+
+    uint32_t id = pool->atom_count++;
+    pool->atoms[id] = atom;
+    pool->exact_hash[id] = exact;
+    pool->table[slot] = id;
+
+    /* Keep the load factor below 1/2 */
+    if (pool->atom_count * 2 > pool->table_size) {
+        pool_grow_table(pool);
+    }
+
+    return id;
+}
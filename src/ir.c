@@ -0,0 +1,714 @@
+/*
+ * TLCS-900 Assembler - Statement Recording and Replay
+ *
+ * The first pass 1 iteration records what each source line turned into:
+ * a label definition, an encodable instruction with its operand shapes
+ * and compiled expressions, or a line that must go back through the
+ * parser (directives, macro invocations, EQU/SET).  Later pass 1
+ * iterations and pass 2 replay the list, re-evaluating the stored code
+ * against the current symbol values and calling the recorded encoder
+ * directly, without tokenizing or classifying the line again.  DB/DW/DD
+ * lines keep their compiled values too, so data tables are emitted
+ * without going back through the parser either.
+ *
+ * Lines inside macro expansions are never recorded; the invocation line
+ * is replayed instead and expands the macro again.
+ *
+ * Included files are bracketed by STMT_INCLUDE / STMT_INCLUDE_END so the
+ * build cache can skip a reused file's statements as a whole.  A file
+ * the cache supplied on the first iteration has no statements recorded;
+ * replay includes it again, parsing it if the cache no longer applies.
+ *
+ * Replay also drives relaxation in pass 1.  Each recorded instruction
+ * keeps its encoded size and the symbols its operands depend on; labels
+ * are redefined at the running PC on every sweep, and an instruction is
+ * only re-encoded when one of its symbols changed value since its size
+ * was computed.  Instructions whose size depends only on their operand
+ * modes (see encode_size_fixed) are never re-encoded in pass 1 at all.
+ * Everything else advances the PC by the cached size.
+ *
+ * From the third sweep on, a sweep only visits a worklist (see
+ * ir_sweep): statements that must always go back through the parser,
+ * instructions one of whose symbols changed value (found through
+ * symbol-to-user edges built from the recorded dependencies), and, while
+ * the code has moved, the labels whose addresses moved with it.  A late
+ * sweep that settles the layout touches a few hundred statements rather
+ * than all of them.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+extern void error(Assembler *as, const char *fmt, ...);
+
+void ir_begin(Assembler *as) {
+    ir_free(as);
+    arena_init(&as->ir.arena);
+    as->ir.recording = true;
+    as->ir.suspend = 0;
+    as->ir.valid = true;
+}
+
+void ir_free(Assembler *as) {
+    free(as->ir.stmts);
+    free(as->ir.data);
+    free(as->ir.users);
+    free(as->ir.always);
+    free(as->ir.dirty);
+    arena_free(&as->ir.arena);
+    memset(&as->ir, 0, sizeof(as->ir));
+}
+
+bool ir_is_recording(Assembler *as) {
+    return as->ir.recording && as->ir.suspend == 0;
+}
+
+/* Append a statement for the current source position */
+static Stmt *ir_new_stmt(Assembler *as, StmtKind kind) {
+    StmtList *ir = &as->ir;
+    if (ir->count >= ir->capacity) {
+        size_t new_capacity = ir->capacity ? ir->capacity * 2 : 1024;
+        Stmt *new_stmts = as_realloc(ir->stmts, new_capacity * sizeof(Stmt));
+        if (!new_stmts) {
+            /* Can't record - fall back to reparsing for later passes */
+            ir->recording = false;
+            ir->valid = false;
+            return NULL;
+        }
+        ir->stmts = new_stmts;
+        ir->capacity = new_capacity;
+    }
+
+    Stmt *st = &ir->stmts[ir->count++];
+    memset(st, 0, sizeof(*st));
+    st->kind = kind;
+    st->line = as->current_line;
+    st->file = as->current_file;
+    return st;
+}
+
+void ir_record_label(Assembler *as, const char *name) {
+    Stmt *st = ir_new_stmt(as, STMT_LABEL);
+    if (!st) return;
+    st->name = strpool_intern(&as->strings, name, strlen(name));
+}
+
+/* Start collecting the values of a data directive being recorded */
+void ir_data_begin(Assembler *as) {
+    as->ir.data_count = 0;
+    as->ir.data_ready = false;
+}
+
+/* Add a value: a string (code NULL) or compiled code of width bytes */
+void ir_data_add(Assembler *as, uint8_t width, const char *text, size_t length,
+                 const ExprCode *code) {
+    StmtList *ir = &as->ir;
+    if (ir->data_count >= ir->data_capacity) {
+        size_t new_capacity = ir->data_capacity ? ir->data_capacity * 2 : 64;
+        DataItem *new_data = as_realloc(ir->data, new_capacity * sizeof(DataItem));
+        if (!new_data) {
+            /* The line is just reparsed */
+            ir->data_count = 0;
+            ir->data_capacity = 0;
+            free(ir->data);
+            ir->data = NULL;
+            return;
+        }
+        ir->data = new_data;
+        ir->data_capacity = new_capacity;
+    }
+
+    DataItem *item = &ir->data[ir->data_count++];
+    item->width = code ? width : 0;
+    item->length = (uint32_t)length;
+    item->text = NULL;
+    item->code = code;
+    if (!code) {
+        char *copy = arena_alloc(&ir->arena, length ? length : 1);
+        memcpy(copy, text, length);
+        item->text = copy;
+    }
+}
+
+/* The whole line was collected */
+void ir_data_end(Assembler *as) {
+    as->ir.data_ready = as->ir.data != NULL;
+}
+
+void ir_record_line(Assembler *as, DirectiveId directive, const char *line,
+                    const LineToken *tokens, int count) {
+    StmtList *ir = &as->ir;
+    bool data = ir->data_ready && (directive == DIR_DB || directive == DIR_DW || directive == DIR_DD);
+    ir->data_ready = false;
+
+    Stmt *st = ir_new_stmt(as, STMT_LINE);
+    if (!st) return;
+    st->directive = (uint8_t)directive;
+    st->text = line;
+    st->tokens = tokens;
+    st->token_count = count;
+
+    if (data && ir->data_count > 0) {
+        DataItem *items = arena_alloc(&ir->arena, ir->data_count * sizeof(DataItem));
+        memcpy(items, ir->data, ir->data_count * sizeof(DataItem));
+        uint32_t size = 0;
+        for (size_t i = 0; i < ir->data_count; i++) {
+            size += items[i].width ? items[i].width : items[i].length;
+        }
+        st->data = items;
+        st->data_count = (uint32_t)ir->data_count;
+        st->size = size;
+    }
+}
+
+/* Mark the start of an included file; returns its index for the end mark */
+size_t ir_record_include(Assembler *as, const char *path) {
+    Stmt *st = ir_new_stmt(as, STMT_INCLUDE);
+    if (!st) return 0;
+    st->text = path;
+    return as->ir.count - 1;
+}
+
+void ir_record_include_end(Assembler *as, size_t include) {
+    if (!ir_is_recording(as)) return;
+    Stmt *st = ir_new_stmt(as, STMT_INCLUDE_END);
+    if (!st) return;
+    as->ir.stmts[include].end = (uint32_t)(as->ir.count - 1);
+}
+
+void ir_record_insn(Assembler *as, const char *mnemonic, EncoderFunc encoder,
+                    const Operand *operands, int operand_count, bool has_label,
+                    uint32_t size, const char *line, const LineToken *tokens, int count) {
+    Stmt *st = ir_new_stmt(as, STMT_INSN);
+    if (!st) return;
+    st->name = strpool_intern(&as->strings, mnemonic, strlen(mnemonic));
+    st->has_label = has_label;
+    st->encoder = encoder;
+    st->text = line;
+    st->tokens = tokens;
+    st->token_count = count;
+    st->operand_count = (uint8_t)operand_count;
+
+    /* The first encoding already counts for the next sweep */
+    st->size = size;
+    st->size_valid = true;
+    st->size_fixed = encode_size_fixed(encoder, operands, operand_count);
+    st->eval_stamp = as->symbol_stamp;
+    if (operand_count == 0) return;
+
+    st->operands = arena_alloc(&as->ir.arena, operand_count * sizeof(StmtOperand));
+    for (int i = 0; i < operand_count; i++) {
+        const Operand *op = &operands[i];
+        StmtOperand *so = &st->operands[i];
+        memset(so, 0, sizeof(*so));
+        so->mode = (uint8_t)op->mode;
+        so->size = (uint8_t)op->size;
+        so->reg = (uint8_t)op->reg;
+        so->index_reg = (uint8_t)op->index_reg;
+        so->addr_size = op->addr_size;
+        so->symbol = op->symbol;
+        so->value = op->value;
+        so->value_known = op->value_known;
+        so->is_constant = op->is_constant;
+        so->expr = op->expr;
+    }
+}
+
+/* Collect the symbol dependencies of compiled code; folded ones are fixed */
+static void collect_deps(Assembler *as, const ExprCode *code, Stmt *st,
+                         Symbol **deps, int *count, int max) {
+    if (!code) return;
+    for (uint16_t k = 0; k < code->count; k++) {
+        const ExprInsn *insn = &code->insns[k];
+        if (insn->op == EXPR_PC) {
+            st->always_eval = true;
+            continue;
+        }
+        if (insn->op != EXPR_SYMBOL) continue;
+
+        Symbol *sym = symbol_lookup_atom(as, insn->atom);
+        if (!sym || sym->type == SYM_SET || sym->duplicate || *count >= max) {
+            st->always_eval = true;
+            continue;
+        }
+        bool seen = false;
+        for (int i = 0; i < *count && !seen; i++) {
+            seen = deps[i] == sym;
+        }
+        if (!seen) deps[(*count)++] = sym;
+    }
+}
+
+static void bit_set(uint64_t *bits, size_t i) {
+    bits[i / 64] |= 1ULL << (i % 64);
+}
+
+/* Resolve the symbols each recorded instruction depends on */
+static void resolve_deps(Assembler *as) {
+    Symbol *deps[64];
+    for (size_t i = 0; i < as->ir.count; i++) {
+        Stmt *st = &as->ir.stmts[i];
+        if (st->kind != STMT_INSN) continue;
+
+        int count = 0;
+        for (int j = 0; j < st->operand_count; j++) {
+            collect_deps(as, st->operands[j].expr, st, deps, &count, 64);
+        }
+        if (count > 0) {
+            st->deps = arena_alloc(&as->ir.arena, count * sizeof(Symbol *));
+            memcpy(st->deps, deps, count * sizeof(Symbol *));
+            st->dep_count = count;
+        }
+    }
+}
+
+/*
+ * Build the worklist state: for each symbol the instructions using it,
+ * and the statements every sweep must visit.  Labels defined more than
+ * once keep the full sweep, which defines every copy in order.
+ */
+static void build_worklist(Assembler *as) {
+    StmtList *ir = &as->ir;
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            sym->users = 0;
+            sym->user_count = 0;
+        }
+    }
+
+    size_t edges = 0;
+    for (size_t i = 0; i < ir->count; i++) {
+        Stmt *st = &ir->stmts[i];
+        if (st->kind == STMT_LABEL) {
+            Symbol *sym = symbol_lookup_atom(as, st->name);
+            if (!sym || sym->duplicate) return;
+        }
+        for (int j = 0; j < st->dep_count; j++) {
+            st->deps[j]->user_count++;
+            edges++;
+        }
+    }
+
+    size_t words = ir->count / 64 + 1;
+    ir->users = as_malloc((edges ? edges : 1) * sizeof(uint32_t));
+    ir->always = as_calloc(words, sizeof(uint64_t));
+    ir->dirty = as_calloc(words, sizeof(uint64_t));
+    if (!ir->users || !ir->always || !ir->dirty) {
+        free(ir->users);
+        free(ir->always);
+        free(ir->dirty);
+        ir->users = NULL;
+        ir->always = ir->dirty = NULL;
+        return;
+    }
+
+    /* Symbol.users is where its run of edges starts; filled from the end */
+    uint32_t offset = 0;
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            offset += sym->user_count;
+            sym->users = offset;
+        }
+    }
+    for (size_t i = 0; i < ir->count; i++) {
+        Stmt *st = &ir->stmts[i];
+        for (int j = 0; j < st->dep_count; j++) {
+            ir->users[--st->deps[j]->users] = (uint32_t)i;
+        }
+
+        bool always = false;
+        switch (st->kind) {
+            case STMT_INSN:    always = st->always_eval || !st->size_valid; break;
+            case STMT_LINE:    always = st->data == NULL; break;
+            case STMT_INCLUDE: always = st->end == 0; break;
+            default:           break;
+        }
+        if (always) bit_set(ir->always, i);
+    }
+}
+
+/* A symbol changed value: its instructions go on the worklist */
+void ir_touch(Assembler *as, const Symbol *sym) {
+    if (!as->ir.users || as->pass != 1) return;
+    for (uint32_t i = 0; i < sym->user_count; i++) {
+        bit_set(as->ir.dirty, as->ir.users[sym->users + i]);
+    }
+}
+
+/* Mark the recording unusable (e.g. a macro was redefined mid-file) */
+void ir_invalidate(Assembler *as) {
+    as->ir.valid = false;
+}
+
+void ir_finish_recording(Assembler *as) {
+    as->ir.recording = false;
+    if (as->errors || as->reparse) {
+        as->ir.valid = false;
+    }
+
+    /*
+     * Operand shapes were fixed when the line was first parsed.  A symbol
+     * named like a register changes how "(name)" parses once it is
+     * defined, so such sources always go back through the parser.
+     */
+    for (size_t i = 0; i < as->symbol_table_size && as->ir.valid; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (is_register_name(sym->name)) {
+                as->ir.valid = false;
+                break;
+            }
+        }
+    }
+
+    if (as->ir.valid) {
+        resolve_deps(as);
+        build_worklist(as);
+    }
+}
+
+/*
+ * Stop direct addresses from shrinking.  Used when sweeps keep changing:
+ * with sizes only allowed to grow, the layout must settle.
+ */
+void ir_set_grow_only(Assembler *as) {
+    as->ir.grow_only = true;
+}
+
+/* Can a pass 1 sweep reuse this instruction's size from the last sweep? */
+static bool stmt_size_current(const Stmt *st) {
+    if (!st->size_valid) return false;
+    if (st->size_fixed) return true;
+    if (st->always_eval) return false;
+    for (int i = 0; i < st->dep_count; i++) {
+        if (st->deps[i]->stamp > st->eval_stamp) return false;
+    }
+    return true;
+}
+
+/* Rebuild operands from a recorded instruction and encode it */
+static void replay_insn(Assembler *as, Stmt *st) {
+    Operand operands[MAX_OPERANDS];
+    int count = st->operand_count;
+
+    if (as->pass == 1 && stmt_size_current(st)) {
+        as->pc += st->size;
+        return;
+    }
+    uint32_t start_pc = as->pc;
+
+    for (int i = 0; i < count; i++) {
+        StmtOperand *so = &st->operands[i];
+        Operand *op = &operands[i];
+        *op = (Operand){
+            .mode = (AddressingMode)so->mode,
+            .size = (OperandSize)so->size,
+            .reg = (RegisterType)so->reg,
+            .index_reg = (RegisterType)so->index_reg,
+            .symbol = so->symbol,
+            .addr_size = so->addr_size,
+            .expr = so->expr,
+        };
+
+        if (!so->expr) {
+            op->value = so->value;
+            op->value_known = so->value_known;
+            op->is_constant = so->is_constant;
+            continue;
+        }
+
+        /*
+         * Evaluate quietly; if the expression fails now (undefined symbol
+         * in pass 2, division by zero) reparse the line so the error is
+         * reported exactly as the parser would.
+         */
+        as->diag_suppress++;
+        bool ok = expr_eval(as, so->expr, &op->value, &op->value_known, &op->is_constant);
+        as->diag_suppress--;
+        if (!ok) {
+            st->size_valid = false;
+            if (as->pass == 1 && as->ir.dirty) bit_set(as->ir.dirty, (size_t)(st - as->ir.stmts));
+            parse_line_tokens(as, st->text, st->tokens, st->token_count);
+            return;
+        }
+
+        /* Pin direct addresses at their largest size once growing only */
+        if (op->mode == ADDR_DIRECT && op->addr_size == 0) {
+            if (as->ir.grow_only && as->pass == 1) {
+                int natural = direct_addr_size(op);
+                if (natural > so->pinned_size) so->pinned_size = natural;
+            }
+            if (so->pinned_size) op->addr_size = so->pinned_size;
+        }
+    }
+
+    StatsPhase prev = stats_enter(as, PHASE_ENCODE);
+    bool encoded = st->encoder(as, operands, count);
+    stats_leave(as, prev);
+    if (encoded) {
+        if (as->pass == 1) {
+            if (st->size != as->pc - start_pc) {
+                as->stats.iteration[as->stats.iterations - 1].size_changes++;
+            }
+            st->size = as->pc - start_pc;
+            st->size_valid = true;
+            st->size_fixed = encode_size_fixed(st->encoder, operands, count);
+            st->eval_stamp = as->symbol_stamp;
+        }
+        return;
+    }
+
+    /* Macro calls and labels can define symbols; never skip these */
+    st->always_eval = true;
+    if (as->pass == 1 && as->ir.always) bit_set(as->ir.always, (size_t)(st - as->ir.stmts));
+    bool bare_label = false;
+    parse_unencoded(as, strpool_text(&as->strings, st->name), st->has_label,
+                    operands, count, &bare_label);
+}
+
+/*
+ * Emit a recorded DB/DW/DD line.  Its size never depends on the values,
+ * so pass 1 only advances the PC.  Pass 2 evaluates every value quietly
+ * first (each with $ at its own address) and reparses the line if one
+ * fails, so errors are reported exactly as the parser would.
+ */
+static void replay_data(Assembler *as, const Stmt *st) {
+    if (as->pass == 1) {
+        as->pc += st->size;
+        return;
+    }
+
+    ArenaMark mark = arena_mark(&as->scratch);
+    int64_t *values = arena_alloc(&as->scratch, st->data_count * sizeof(int64_t));
+    uint32_t start_pc = as->pc;
+    bool ok = true;
+    as->diag_suppress++;
+    for (uint32_t i = 0; i < st->data_count && ok; i++) {
+        const DataItem *item = &st->data[i];
+        if (item->code) {
+            bool known, is_constant;
+            ok = expr_eval(as, item->code, &values[i], &known, &is_constant);
+        }
+        as->pc += item->width ? item->width : item->length;
+    }
+    as->diag_suppress--;
+    as->pc = start_pc;
+
+    if (!ok) {
+        parse_line_tokens(as, st->text, st->tokens, st->token_count);
+    } else {
+        for (uint32_t i = 0; i < st->data_count; i++) {
+            const DataItem *item = &st->data[i];
+            switch (item->width) {
+                case 0: emit_bytes(as, (const uint8_t *)item->text, item->length); break;
+                case 1: emit_byte(as, (uint8_t)values[i]); break;
+                case 2: emit_word(as, (uint16_t)values[i]); break;
+                default: emit_long(as, (uint32_t)values[i]); break;
+            }
+        }
+    }
+    arena_release(&as->scratch, mark);
+}
+
+/* Index of the first statement at or after i on the worklist */
+static size_t next_work(const StmtList *ir, size_t i) {
+    size_t words = ir->count / 64 + 1;
+    size_t w = i / 64;
+    uint64_t bits = (ir->always[w] | ir->dirty[w]) & (~0ULL << (i % 64));
+    while (!bits) {
+        if (++w >= words) return ir->count;
+        bits = ir->always[w] | ir->dirty[w];
+    }
+    size_t index = w * 64 + (size_t)__builtin_ctzll(bits);
+    return index < ir->count ? index : ir->count;
+}
+
+/*
+ * A pass 1 sweep over the worklist only.  Statements keep their start
+ * PC and size from the last sweep; while nothing before a statement
+ * changed size, its start is unchanged.  Once the code has moved
+ * (shift is not zero) every statement is walked to move its start, and
+ * labels are defined again at their new address; a statement that
+ * takes the PC back to where it was stops the walk.  Included files
+ * are replayed in place rather than through the build cache, which
+ * would define the same symbols.
+ */
+static bool ir_sweep(Assembler *as) {
+    StmtList *ir = &as->ir;
+    const char *prev_file = as->current_file;
+    int prev_line = as->current_line;
+    uint32_t shift = 0;
+    uint32_t visited = 0;
+
+    for (size_t i = 0; i < ir->count; i++) {
+        if (shift == 0) {
+            i = next_work(ir, i);
+            if (i >= ir->count) break;
+        }
+
+        Stmt *st = &ir->stmts[i];
+        uint32_t start_pc = st->start_pc + shift;
+        bool work = (ir->always[i / 64] | ir->dirty[i / 64]) & (1ULL << (i % 64));
+        if (!work && st->kind != STMT_LABEL) {
+            st->start_pc = start_pc;
+            continue;
+        }
+
+        ir->dirty[i / 64] &= ~(1ULL << (i % 64));
+        as->current_file = st->file;
+        as->current_line = st->line;
+        as->pc = start_pc;
+        visited++;
+        /* Replaying an instruction updates its size, so keep the old end */
+        uint32_t old_end = st->start_pc + st->size;
+
+        switch (st->kind) {
+            case STMT_LABEL:
+                symbol_define_atom(as, st->name, SYM_LABEL, as->pc);
+                break;
+            case STMT_INSN:
+                replay_insn(as, st);
+                break;
+            case STMT_LINE:
+                if (st->data) {
+                    replay_data(as, st);
+                } else {
+                    parse_line_tokens(as, st->text, st->tokens, st->token_count);
+                }
+                break;
+            case STMT_INCLUDE:
+                if (!st->end) {
+                    assembler_include_path(as, st->text);
+                }
+                break;
+            case STMT_INCLUDE_END:
+                break;
+        }
+
+        shift = as->pc - old_end;
+        st->start_pc = start_pc;
+        st->size = as->pc - start_pc;
+
+        if (as->error_count > 10000) {
+            error(as, "too many errors, stopping");
+            break;
+        }
+    }
+
+    ir->end_pc += shift;
+    as->pc = ir->end_pc;
+    as->stats.iteration[as->stats.iterations - 1].visited = visited;
+    as->current_file = prev_file;
+    as->current_line = prev_line;
+
+    return !as->errors;
+}
+
+/* Replay the recorded statements for one pass */
+bool ir_replay(Assembler *as) {
+    if (as->pass == 1 && as->ir.worklist) {
+        return ir_sweep(as);
+    }
+
+    const char *prev_file = as->current_file;
+    int prev_line = as->current_line;
+    /* A full pass 1 sweep leaves every start_pc and size current */
+    bool complete = as->pass == 1 && as->ir.users != NULL;
+
+    for (size_t i = 0; i < as->ir.count && !as->stop; i++) {
+        /* Stretches pass 2 workers already encoded */
+        if (as->parallel && parallel_take(as, &i)) {
+            continue;
+        }
+
+        Stmt *st = &as->ir.stmts[i];
+        as->current_file = st->file;
+        as->current_line = st->line;
+        uint32_t start_pc = as->pc;
+
+        switch (st->kind) {
+            case STMT_LABEL:
+                symbol_define_atom(as, st->name, SYM_LABEL, as->pc);
+                break;
+            case STMT_INSN:
+                replay_insn(as, st);
+                break;
+            case STMT_LINE:
+                if (st->data) {
+                    replay_data(as, st);
+                } else {
+                    parse_line_tokens(as, st->text, st->tokens, st->token_count);
+                }
+                break;
+            case STMT_INCLUDE:
+                if (!st->end) {
+                    assembler_include_path(as, st->text);
+                } else if (cache_enter(as, source_open(as, st->text))) {
+                    i = st->end;
+                    complete = false;
+                }
+                break;
+            case STMT_INCLUDE_END:
+                cache_leave(as);
+                break;
+        }
+
+        /* The layout pass 2 workers start from */
+        if (as->pass == 1) {
+            st->start_pc = start_pc;
+            st->size = as->pc - start_pc;
+        }
+
+        if (as->error_count > 10000) {
+            error(as, "too many errors, stopping");
+            complete = false;
+            break;
+        }
+    }
+
+    as->current_file = prev_file;
+    as->current_line = prev_line;
+
+    if (complete) {
+        as->ir.end_pc = as->pc;
+        as->ir.worklist = true;
+    }
+    return !as->errors;
+}
+
+/*
+ * Replay statements [first, end) on a pass 2 worker.  Labels already
+ * hold their final values; the serial pass defines them again when it
+ * takes over the worker's output.
+ */
+void ir_replay_range(Assembler *as, size_t first, size_t end) {
+    for (size_t i = first; i < end && !as->worker_tainted; i++) {
+        Stmt *st = &as->ir.stmts[i];
+        as->current_file = st->file;
+        as->current_line = st->line;
+
+        switch (st->kind) {
+            case STMT_LABEL: {
+                /* The worker's layout must agree with the one labels got */
+                Symbol *sym = symbol_lookup_atom(as, st->name);
+                if (!sym || sym->value != as->pc) {
+                    as->worker_tainted = true;
+                }
+                break;
+            }
+            case STMT_INSN:
+                replay_insn(as, st);
+                break;
+            case STMT_LINE:
+                if (st->data) {
+                    replay_data(as, st);
+                } else {
+                    parse_line_tokens(as, st->text, st->tokens, st->token_count);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * TLCS-900 Assembler - Mnemonic Keyword Table
+ *
+ * One case-insensitive hash table covers every instruction mnemonic and
+ * directive name, so a single probe classifies a mnemonic as a directive,
+ * an instruction (with its encoder), or neither (macro, label or error).
+ * Register, condition code and control register names live in the same
+ * table, so operand identifiers are classified in one probe as well.
+ * Keys use the same case-folded hash as the string pool, so callers that
+ * hold an atom can look up without hashing the name again.
+ *
+ * The table is filled once by codegen.c, directives.c and parser.c and
+ * is read-only afterwards, so every assembler in the process shares it.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <pthread.h>
+#include "../include/tlcs900.h"
+
+#define KEYWORD_SLOTS 1024      /* Power of two, kept under 1/4 full */
+
+static Keyword keyword_table[KEYWORD_SLOTS];
+static pthread_once_t keywords_once = PTHREAD_ONCE_INIT;
+
+/* Find the slot for a name, either its entry or the empty slot to use */
+static Keyword *keyword_slot(const char *name, uint32_t hash) {
+    size_t slot = hash & (KEYWORD_SLOTS - 1);
+    while (keyword_table[slot].name) {
+        if (keyword_table[slot].hash == hash && strcasecmp(keyword_table[slot].name, name) == 0) {
+            break;
+        }
+        slot = (slot + 1) & (KEYWORD_SLOTS - 1);
+    }
+    return &keyword_table[slot];
+}
+
+/* Get the entry for a name, creating it if needed */
+static Keyword *keyword_entry(const char *name) {
+    uint32_t hash = strpool_hash_folded(name, strlen(name));
+    Keyword *kw = keyword_slot(name, hash);
+    if (!kw->name) {
+        kw->name = name;
+        kw->hash = hash;
+    }
+    return kw;
+}
+
+/* Add a directive name or instruction encoder (a name may be both) */
+void keyword_add(const char *name, DirectiveId directive, EncoderFunc encoder) {
+    Keyword *kw = keyword_entry(name);
+    if (directive != DIR_NONE) kw->directive = directive;
+    if (encoder) kw->encoder = encoder;
+}
+
+/* Add an operand name: value is the register or condition code */
+void keyword_add_operand(const char *name, int operand_class, int value, int size) {
+    Keyword *kw = keyword_entry(name);
+    kw->operand |= (uint8_t)operand_class;
+    if (operand_class == KW_REGISTER) {
+        kw->reg = (uint8_t)value;
+        kw->size = (uint8_t)size;
+    } else if (operand_class == KW_CONDITION) {
+        kw->cc = (uint8_t)value;
+    }
+}
+
+static void keywords_fill(void) {
+    directives_register_keywords();
+    encode_register_keywords();
+    parser_register_keywords();
+}
+
+/* Assemblers may be created on several threads at once */
+void keywords_init(void) {
+    pthread_once(&keywords_once, keywords_fill);
+}
+
+/* Look up a name whose case-folded hash is already known */
+const Keyword *keyword_find(const char *name, uint32_t hash) {
+    const Keyword *kw = keyword_slot(name, hash);
+    return kw->name ? kw : NULL;
+}
+
+const Keyword *keyword_lookup(const char *name) {
+    return keyword_find(name, strpool_hash_folded(name, strlen(name)));
+}
@@ -7,6 +7,15 @@
  * - Strings ("..." and '...')
  * - Operators and punctuation
  * - Comments (; to end of line)
+ *
+ * Lines are scanned once by lexer_tokenize() into compact LineToken
+ * arrays with interned text and pre-parsed numbers.  The parser then
+ * replays those arrays through lexer_next()/lexer_peek(), so cached
+ * source lines are never re-scanned in later passes.
+ *
+ * There is no file-scope state: scanning runs on a Scanner local to
+ * lexer_tokenize(), and replay on the caller's LexerContext (each
+ * Assembler owns one), so any number of assemblies can parse at once.
  */
 
 #include <stdio.h>
@@ -15,70 +24,77 @@
 #include <ctype.h>
 #include "../include/tlcs900.h"
 
-/* Lexer state */
-static const char *input_start;
-static const char *input_pos;
-static int current_line;
-static int current_column;
-static Token peeked_token;
-static bool has_peeked;
-
-void lexer_init(const char *input) {
-    input_start = input;
-    input_pos = input;
-    current_line = 1;
-    current_column = 1;
-    has_peeked = false;
+/* Scanner token with inline text (only used while tokenizing) */
+typedef struct {
+    TokenType type;
+    char text[MAX_IDENTIFIER];
+    int64_t value;
+    int line;
+    int column;
+} RawToken;
+
+/* Scanner state */
+typedef struct {
+    const char *pos;
+    int line;
+    int column;
+} Scanner;
+
+void lexer_init_tokens(LexerContext *lx, const StringPool *pool, const LineToken *tokens, int count) {
+    lx->pool = pool;
+    lx->tokens = tokens;
+    lx->count = count;
+    lx->pos = 0;
+    lx->line = 1;
+    lx->has_peeked = false;
 }
 
-void lexer_save_state(LexerState *state) {
-    state->pos = input_pos;
-    state->line = current_line;
-    state->column = current_column;
-    state->peeked = peeked_token;
-    state->has_peeked = has_peeked;
+void lexer_save_state(const LexerContext *lx, LexerState *state) {
+    state->pos = lx->pos;
+    state->line = lx->line;
+    state->peeked = lx->peeked;
+    state->has_peeked = lx->has_peeked;
 }
 
-void lexer_restore_state(const LexerState *state) {
-    input_pos = state->pos;
-    current_line = state->line;
-    current_column = state->column;
-    peeked_token = state->peeked;
-    has_peeked = state->has_peeked;
+void lexer_restore_state(LexerContext *lx, const LexerState *state) {
+    lx->pos = state->pos;
+    lx->line = state->line;
+    lx->peeked = state->peeked;
+    lx->has_peeked = state->has_peeked;
 }
 
-void lexer_set_line(int line) {
-    current_line = line;
+void lexer_set_line(LexerContext *lx, int line) {
+    lx->line = line;
 }
 
-static char peek_char(void) {
-    return *input_pos;
+static char peek_char(Scanner *sc) {
+    return *sc->pos;
 }
 
-static char next_char(void) {
-    char c = *input_pos;
+static char next_char(Scanner *sc) {
+    char c = *sc->pos;
     if (c != '\0') {
-        input_pos++;
+        sc->pos++;
         if (c == '\n') {
-            current_line++;
-            current_column = 1;
+            sc->line++;
+            sc->column = 1;
         } else {
-            current_column++;
+            sc->column++;
         }
     }
     return c;
 }
 
-static void skip_whitespace(void) {
-    while (*input_pos == ' ' || *input_pos == '\t' || *input_pos == '\r') {
-        next_char();
+static void skip_whitespace(Scanner *sc) {
+    while (*sc->pos == ' ' || *sc->pos == '\t' || *sc->pos == '\r') {
+        next_char(sc);
     }
 }
 
-static void skip_comment(void) {
+static void skip_comment(Scanner *sc) {
     /* Skip from ; to end of line */
-    while (*input_pos != '\0' && *input_pos != '\n') {
-        next_char();
+    while (*sc->pos != '\0' && *sc->pos != '\n') {
+        next_char(sc);
     }
 }
 
@@ -90,10 +106,10 @@ static bool is_ident_char(char c) {
     return isalnum(c) || c == '_' || c == '.';
 }
 
-static int64_t parse_hex(void) {
+static int64_t parse_hex(Scanner *sc) {
     int64_t value = 0;
-    while (isxdigit(peek_char())) {
-        char c = next_char();
+    while (isxdigit(peek_char(sc))) {
+        char c = next_char(sc);
         int digit;
         if (c >= '0' && c <= '9') {
             digit = c - '0';
@@ -105,51 +121,45 @@ static int64_t parse_hex(void) {
         value = (value << 4) | digit;
     }
     /* Skip optional 'H' suffix */
-    if (peek_char() == 'H' || peek_char() == 'h') {
-        next_char();
+    if (peek_char(sc) == 'H' || peek_char(sc) == 'h') {
+        next_char(sc);
     }
     return value;
 }
 
-static int64_t parse_binary(void) {
+static int64_t parse_binary(Scanner *sc) {
     int64_t value = 0;
-    while (peek_char() == '0' || peek_char() == '1') {
-        value = (value << 1) | (next_char() - '0');
+    while (peek_char(sc) == '0' || peek_char(sc) == '1') {
+        value = (value << 1) | (next_char(sc) - '0');
     }
     return value;
 }
 
-static int64_t parse_decimal(void) {
+static int64_t parse_decimal(Scanner *sc) {
     int64_t value = 0;
-    while (isdigit(peek_char())) {
-        value = value * 10 + (next_char() - '0');
+    while (isdigit(peek_char(sc))) {
+        value = value * 10 + (next_char(sc) - '0');
     }
     return value;
 }
 
-static Token make_token(TokenType type) {
-    Token tok;
+static RawToken make_token(const Scanner *sc, TokenType type) {
+    RawToken tok;
     tok.type = type;
     tok.text[0] = '\0';
     tok.value = 0;
-    tok.line = current_line;
-    tok.column = current_column;
+    tok.line = sc->line;
+    tok.column = sc->column;
     return tok;
 }
 
-Token lexer_next(void) {
-    if (has_peeked) {
-        has_peeked = false;
-        return peeked_token;
-    }
+/* Scan the next token from the raw input */
+static RawToken scan_token(Scanner *sc) {
+    skip_whitespace(sc);
 
-    skip_whitespace();
+    RawToken tok = make_token(sc, TOK_EOF);
 
-    Token tok = make_token(TOK_EOF);
-    tok.line = current_line;
-    tok.column = current_column;
-
-    char c = peek_char();
+    char c = peek_char(sc);
 
     if (c == '\0') {
         return tok;
@@ -157,17 +167,17 @@ Token lexer_next(void) {
 
     /* Newline */
     if (c == '\n') {
-        next_char();
+        next_char(sc);
         tok.type = TOK_NEWLINE;
         return tok;
     }
 
     /* Comment - treat as end of line */
     if (c == ';') {
-        skip_comment();
+        skip_comment(sc);
         /* Return newline if there is one, otherwise EOF */
-        if (peek_char() == '\n') {
-            next_char();
+        if (peek_char(sc) == '\n') {
+            next_char(sc);
             tok.type = TOK_NEWLINE;
         }
         return tok;
@@ -175,12 +185,12 @@ Token lexer_next(void) {
 
     /* String literal */
     if (c == '"') {
-        next_char();
+        next_char(sc);
         int i = 0;
-        while (peek_char() != '"' && peek_char() != '\0' && peek_char() != '\n') {
-            if (peek_char() == '\\') {
-                next_char();
-                char esc = next_char();
+        while (peek_char(sc) != '"' && peek_char(sc) != '\0' && peek_char(sc) != '\n') {
+            if (peek_char(sc) == '\\') {
+                next_char(sc);
+                char esc = next_char(sc);
                 switch (esc) {
                     case 'n': tok.text[i++] = '\n'; break;
                     case 'r': tok.text[i++] = '\r'; break;
@@ -191,26 +201,26 @@ Token lexer_next(void) {
                     default: tok.text[i++] = esc; break;
                 }
             } else {
-                tok.text[i++] = next_char();
+                tok.text[i++] = next_char(sc);
             }
             if (i >= MAX_IDENTIFIER - 1) break;
         }
         tok.text[i] = '\0';
-        if (peek_char() == '"') next_char();
+        if (peek_char(sc) == '"') next_char(sc);
         tok.type = TOK_STRING;
         return tok;
     }
 
     /* Character literal */
     if (c == '\'') {
-        next_char();
+        next_char(sc);
         tok.value = 0;
         int i = 0;
-        while (peek_char() != '\'' && peek_char() != '\0' && peek_char() != '\n') {
+        while (peek_char(sc) != '\'' && peek_char(sc) != '\0' && peek_char(sc) != '\n') {
             char ch;
-            if (peek_char() == '\\') {
-                next_char();
-                char esc = next_char();
+            if (peek_char(sc) == '\\') {
+                next_char(sc);
+                char esc = next_char(sc);
                 switch (esc) {
                     case 'n': ch = '\n'; break;
                     case 'r': ch = '\r'; break;
@@ -221,24 +231,24 @@ Token lexer_next(void) {
                     default: ch = esc; break;
                 }
             } else {
-                ch = next_char();
+                ch = next_char(sc);
             }
-            tok.text[i++] = ch;
+            if (i < MAX_IDENTIFIER - 1) tok.text[i++] = ch;
             /* Build value from characters (up to 4 bytes) */
             tok.value = (tok.value << 8) | (unsigned char)ch;
         }
         tok.text[i] = '\0';
-        if (peek_char() == '\'') next_char();
+        if (peek_char(sc) == '\'') next_char(sc);
         tok.type = TOK_CHAR;
         return tok;
     }
 
     /* Numbers */
     if (c == '$') {
-        next_char();
-        if (isxdigit(peek_char())) {
+        next_char(sc);
+        if (isxdigit(peek_char(sc))) {
             /* Hex number with $ prefix */
-            tok.value = parse_hex();
+            tok.value = parse_hex(sc);
             tok.type = TOK_NUMBER;
             snprintf(tok.text, sizeof(tok.text), "$%lX", (unsigned long)tok.value);
         } else {
@@ -249,17 +259,17 @@ Token lexer_next(void) {
     }
 
     if (c == '%') {
-        next_char();
-        tok.value = parse_binary();
+        next_char(sc);
+        tok.value = parse_binary(sc);
         tok.type = TOK_NUMBER;
         snprintf(tok.text, sizeof(tok.text), "%%%lb", (unsigned long)tok.value);
         return tok;
     }
 
-    if (c == '0' && (input_pos[1] == 'x' || input_pos[1] == 'X')) {
-        next_char(); /* 0 */
-        next_char(); /* x */
-        tok.value = parse_hex();
+    if (c == '0' && (sc->pos[1] == 'x' || sc->pos[1] == 'X')) {
+        next_char(sc); /* 0 */
+        next_char(sc); /* x */
+        tok.value = parse_hex(sc);
         tok.type = TOK_NUMBER;
         snprintf(tok.text, sizeof(tok.text), "0x%lX", (unsigned long)tok.value);
         return tok;
@@ -267,34 +277,34 @@ Token lexer_next(void) {
 
     if (isdigit(c)) {
         /* Could be decimal, hex with H suffix, or binary with B suffix */
-        const char *start = input_pos;
+        const char *start = sc->pos;
         int64_t value = 0;
 
         /* Collect all hex digits */
-        while (isxdigit(peek_char())) {
-            value = value * 16 + (isdigit(peek_char()) ? peek_char() - '0' :
-                    (toupper(peek_char()) - 'A' + 10));
-            next_char();
+        while (isxdigit(peek_char(sc))) {
+            value = value * 16 + (isdigit(peek_char(sc)) ? peek_char(sc) - '0' :
+                    (toupper(peek_char(sc)) - 'A' + 10));
+            next_char(sc);
         }
 
         /* Check suffix */
-        if (peek_char() == 'H' || peek_char() == 'h') {
-            next_char();
+        if (peek_char(sc) == 'H' || peek_char(sc) == 'h') {
+            next_char(sc);
             tok.value = value;
             tok.type = TOK_NUMBER;
             snprintf(tok.text, sizeof(tok.text), "%lXH", (unsigned long)value);
             return tok;
         }
 
-        if (peek_char() == 'B' || peek_char() == 'b') {
+        if (peek_char(sc) == 'B' || peek_char(sc) == 'b') {
             /* Binary - re-parse */
-            next_char();
-            input_pos = start;
+            next_char(sc);
+            sc->pos = start;
             value = 0;
-            while (peek_char() == '0' || peek_char() == '1') {
-                value = (value << 1) | (next_char() - '0');
+            while (peek_char(sc) == '0' || peek_char(sc) == '1') {
+                value = (value << 1) | (next_char(sc) - '0');
             }
-            if (peek_char() == 'B' || peek_char() == 'b') next_char();
+            if (peek_char(sc) == 'B' || peek_char(sc) == 'b') next_char(sc);
             tok.value = value;
             tok.type = TOK_NUMBER;
             snprintf(tok.text, sizeof(tok.text), "%lbB", (unsigned long)value);
@@ -302,8 +312,8 @@ Token lexer_next(void) {
         }
 
         /* Decimal - re-parse from start */
-        input_pos = start;
-        tok.value = parse_decimal();
+        sc->pos = start;
+        tok.value = parse_decimal(sc);
         tok.type = TOK_NUMBER;
         snprintf(tok.text, sizeof(tok.text), "%ld", (long)tok.value);
         return tok;
@@ -312,8 +322,8 @@ Token lexer_next(void) {
     /* Identifiers */
     if (is_ident_start(c)) {
         int i = 0;
-        while (is_ident_char(peek_char()) && i < MAX_IDENTIFIER - 1) {
-            tok.text[i++] = next_char();
+        while (is_ident_char(peek_char(sc)) && i < MAX_IDENTIFIER - 1) {
+            tok.text[i++] = next_char(sc);
         }
         tok.text[i] = '\0';
         tok.type = TOK_IDENTIFIER;
@@ -321,7 +331,7 @@ Token lexer_next(void) {
     }
 
     /* Operators and punctuation */
-    next_char();
+    next_char(sc);
     tok.text[0] = c;
     tok.text[1] = '\0';
 
@@ -335,16 +345,16 @@ Token lexer_next(void) {
         case '*': tok.type = TOK_STAR; break;
         case '/': tok.type = TOK_SLASH; break;
         case '&':
-            if (peek_char() == '&') {
-                next_char();
+            if (peek_char(sc) == '&') {
+                next_char(sc);
                 tok.text[1] = '&';
                 tok.text[2] = '\0';
             }
             tok.type = TOK_AMPERSAND;
             break;
         case '|':
-            if (peek_char() == '|') {
-                next_char();
+            if (peek_char(sc) == '|') {
+                next_char(sc);
                 tok.text[1] = '|';
                 tok.text[2] = '\0';
             }
@@ -355,21 +365,21 @@ Token lexer_next(void) {
         case '#': tok.type = TOK_HASH; break;
         case '.': tok.type = TOK_DOT; break;
         case '=':
-            if (peek_char() == '=') {
-                next_char();
+            if (peek_char(sc) == '=') {
+                next_char(sc);
                 tok.text[1] = '=';
                 tok.text[2] = '\0';
             }
             tok.type = TOK_EQUALS;
             break;
         case '<':
-            if (peek_char() == '<') {
-                next_char();
+            if (peek_char(sc) == '<') {
+                next_char(sc);
                 tok.type = TOK_LSHIFT;
                 tok.text[1] = '<';
                 tok.text[2] = '\0';
-            } else if (peek_char() == '=') {
-                next_char();
+            } else if (peek_char(sc) == '=') {
+                next_char(sc);
                 tok.text[1] = '=';
                 tok.text[2] = '\0';
                 tok.type = TOK_LT;
@@ -378,13 +388,13 @@ Token lexer_next(void) {
             }
             break;
         case '>':
-            if (peek_char() == '>') {
-                next_char();
+            if (peek_char(sc) == '>') {
+                next_char(sc);
                 tok.type = TOK_RSHIFT;
                 tok.text[1] = '>';
                 tok.text[2] = '\0';
-            } else if (peek_char() == '=') {
-                next_char();
+            } else if (peek_char(sc) == '=') {
+                next_char(sc);
                 tok.text[1] = '=';
                 tok.text[2] = '\0';
                 tok.type = TOK_GT;
@@ -393,8 +403,8 @@ Token lexer_next(void) {
             }
             break;
         case '!':
-            if (peek_char() == '=') {
-                next_char();
+            if (peek_char(sc) == '=') {
+                next_char(sc);
                 tok.text[1] = '=';
                 tok.text[2] = '\0';
             }
@@ -412,15 +422,82 @@ Token lexer_next(void) {
     return tok;
 }
 
-Token lexer_peek(void) {
-    if (!has_peeked) {
-        peeked_token = lexer_next();
-        has_peeked = true;
+/* Scan a line into compact tokens, appending them to buf.
+ * Scanning stops after the first TOK_EOF, which is always stored. */
+int lexer_tokenize(StringPool *pool, const char *input, TokenBuffer *buf) {
+    Scanner scanner = { input, 1, 1 };
+    Scanner *sc = &scanner;
+
+    int count = 0;
+    for (;;) {
+        RawToken raw = scan_token(sc);
+
+        if (buf->count >= buf->capacity) {
+            size_t new_cap = buf->capacity ? buf->capacity * 2 : 64;
+            LineToken *new_tokens = as_realloc(buf->tokens, new_cap * sizeof(LineToken));
+            if (!new_tokens) {
+                fprintf(stderr, "Failed to allocate token buffer\n");
+                exit(1);
+            }
+            buf->tokens = new_tokens;
+            buf->capacity = new_cap;
+        }
+
+        LineToken *lt = &buf->tokens[buf->count++];
+        lt->type = (uint8_t)raw.type;
+        lt->column = raw.column > 0xFFFF ? 0xFFFF : (uint16_t)raw.column;
+        lt->atom = strpool_intern(pool, raw.text, strlen(raw.text));
+        lt->value = raw.value;
+        count++;
+
+        if (raw.type == TOK_EOF) break;
+    }
+
+    return count;
+}
+
+/* Expand the compact token at the replay position */
+static Token replay_token(const LexerContext *lx) {
+    Token tok;
+    if (lx->pos < lx->count) {
+        const LineToken *lt = &lx->tokens[lx->pos];
+        tok.type = (TokenType)lt->type;
+        tok.atom = lt->atom;
+        tok.value = lt->value;
+        tok.column = lt->column;
+    } else {
+        tok.type = TOK_EOF;
+        tok.atom = 0;
+        tok.value = 0;
+        tok.column = 0;
+    }
+    tok.text = strpool_text(lx->pool, tok.atom);
+    tok.line = lx->line;
+    return tok;
+}
+
+Token lexer_next(LexerContext *lx) {
+    if (lx->has_peeked) {
+        lx->has_peeked = false;
+        return lx->peeked;
+    }
+
+    Token tok = replay_token(lx);
+    if (lx->pos < lx->count) {
+        lx->pos++;
+    }
+    return tok;
+}
+
+Token lexer_peek(LexerContext *lx) {
+    if (!lx->has_peeked) {
+        lx->peeked = lexer_next(lx);
+        lx->has_peeked = true;
     }
-    return peeked_token;
+    return lx->peeked;
 }
 
-void lexer_push_back(Token tok) {
-    peeked_token = tok;
-    has_peeked = true;
+void lexer_push_back(LexerContext *lx, Token tok) {
+    lx->peeked = tok;
+    lx->has_peeked = true;
 }
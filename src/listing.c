@@ -0,0 +1,448 @@
+/*
+ * TLCS-900 Assembler - Listing and Symbol Map
+ *
+ * The listing is written while pass 2 runs: every write to the image
+ * (see output.c) is charged to the source line being assembled, and a
+ * line's bytes are printed next to its text once the next line starts
+ * writing.  Lines that emit nothing are not listed, and lines inside a
+ * macro expansion are listed against the invocation.  Pass 2 worker
+ * output is listed statement by statement as the serial pass takes it.
+ * No extra pass over the source is needed, and with LISTING OFF the
+ * lines are skipped.
+ *
+ *   file.asm
+ *        2  001000  40 00 00 40 00     start:  LD XWA,400000h
+ *        3  001005  00 00 00 00 00 00          DB 0,0,0,0,0,0,0,0,0,0
+ *           00100B  00 00 00 00
+ *
+ * The symbol map lists labels and constants sorted by value.  The size
+ * map (--symbols-only) is the same for tools: tab-separated records of
+ * the source files, the address and size of every line that takes up
+ * space (from the recorded statements, macro invocations counting their
+ * whole expansion), and the symbols:
+ *
+ *   file    0       main.asm
+ *   line    0       2       001000  5
+ *   label   001000  start
+ *   equ     000040  IOPORT
+ *
+ * When the statements could not be recorded only the symbols are
+ * listed.  All three go through a large write buffer rather than a stdio
+ * call per field.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+#define WRITER_BUFFER_SIZE (1u << 20)
+#define LISTING_ROW_BYTES 6     /* Bytes per listing row */
+#define LISTING_MAX_BYTES 48    /* Bytes listed per line; the rest are counted */
+
+typedef struct {
+    FILE *fp;
+    char *buf;
+    size_t length;
+    bool failed;
+} Writer;
+
+struct Listing {
+    Writer out;
+    const char *file;           /* Line the open record belongs to */
+    int line;
+    uint32_t addr;              /* Address of its first byte */
+    uint32_t length;            /* Bytes written for it so far */
+    uint8_t bytes[LISTING_MAX_BYTES];
+    bool open;
+    const char *src_path;       /* Where line text comes from */
+    const SourceFile *src;
+};
+
+/* ---- Buffered writer ---- */
+
+static bool writer_open(Writer *w, const char *filename) {
+    w->fp = fopen(filename, "w");
+    w->buf = w->fp ? as_malloc(WRITER_BUFFER_SIZE) : NULL;
+    w->length = 0;
+    w->failed = false;
+    if (!w->buf) {
+        if (w->fp) fclose(w->fp);
+        w->fp = NULL;
+        return false;
+    }
+    return true;
+}
+
+static void writer_drain(Writer *w) {
+    if (w->length > 0 && fwrite(w->buf, 1, w->length, w->fp) != w->length) {
+        w->failed = true;
+    }
+    w->length = 0;
+}
+
+/* Make room for a write of up to len bytes */
+static char *writer_reserve(Writer *w, size_t len) {
+    if (w->length + len > WRITER_BUFFER_SIZE) {
+        writer_drain(w);
+    }
+    return w->buf + w->length;
+}
+
+static void writer_put(Writer *w, const char *text, size_t len) {
+    while (len > WRITER_BUFFER_SIZE / 2) {
+        writer_put(w, text, WRITER_BUFFER_SIZE / 2);
+        text += WRITER_BUFFER_SIZE / 2;
+        len -= WRITER_BUFFER_SIZE / 2;
+    }
+    memcpy(writer_reserve(w, len), text, len);
+    w->length += len;
+}
+
+static bool writer_close(Writer *w) {
+    writer_drain(w);
+    if (fclose(w->fp) != 0) {
+        w->failed = true;
+    }
+    free(w->buf);
+    return !w->failed;
+}
+
+static char *put_hex(char *p, uint32_t value, int digits) {
+    static const char hex[] = "0123456789ABCDEF";
+    for (int i = digits - 1; i >= 0; i--) {
+        p[i] = hex[value & 0xF];
+        value >>= 4;
+    }
+    return p + digits;
+}
+
+/* Right-aligned in width columns */
+static char *put_decimal(char *p, uint32_t value, int width) {
+    char digits[10];
+    int count = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value);
+    for (int i = count; i < width; i++) {
+        *p++ = ' ';
+    }
+    while (count > 0) {
+        *p++ = digits[--count];
+    }
+    return p;
+}
+
+/* ---- Listing ---- */
+
+bool listing_open(Assembler *as, const char *filename) {
+    Listing *l = as_calloc(1, sizeof(Listing));
+    if (!l || !writer_open(&l->out, filename)) {
+        free(l);
+        return false;
+    }
+    as->listing = l;
+    return true;
+}
+
+/* The text of line (1-based) of the named source */
+static const char *line_text(Assembler *as, Listing *l, const char *file, int line, size_t *len) {
+    if (file != l->src_path) {
+        l->src_path = file;
+        l->src = file ? source_open(as, file) : NULL;
+    }
+    if (!l->src || line < 1 || line > l->src->line_count) {
+        *len = 0;
+        return "";
+    }
+    const SourceLine *sl = &l->src->lines[line - 1];
+    *len = sl->length;
+    return l->src->data + sl->offset;
+}
+
+/* One row: line number (first row only), address, bytes, text */
+static void put_row(Writer *w, int line, uint32_t addr, const uint8_t *bytes, size_t count,
+                    const char *text, size_t text_len) {
+    char *start = writer_reserve(w, 64);
+    char *p = start;
+    if (line > 0) {
+        p = put_decimal(p, (uint32_t)line, 6);
+    } else {
+        memset(p, ' ', 6);
+        p += 6;
+    }
+    *p++ = ' ';
+    *p++ = ' ';
+    p = put_hex(p, addr, addr > 0xFFFFFF ? 8 : 6);
+    *p++ = ' ';
+    for (size_t i = 0; i < LISTING_ROW_BYTES; i++) {
+        *p++ = ' ';
+        if (i < count) {
+            p = put_hex(p, bytes[i], 2);
+        } else {
+            *p++ = ' ';
+            *p++ = ' ';
+        }
+    }
+    if (text_len == 0) {
+        /* Continuation rows carry no trailing blanks */
+        while (p > start && p[-1] == ' ') p--;
+    } else {
+        *p++ = ' ';
+        *p++ = ' ';
+    }
+    w->length += (size_t)(p - start);
+    writer_put(w, text, text_len);
+    writer_put(w, "\n", 1);
+}
+
+/* Write the open record out */
+static void listing_flush(Assembler *as, Listing *l) {
+    if (!l->open) return;
+    l->open = false;
+
+    Writer *w = &l->out;
+    if (l->file != l->src_path) {
+        const char *name = l->file ? l->file : "<input>";
+        writer_put(w, "\n", 1);
+        writer_put(w, name, strlen(name));
+        writer_put(w, "\n", 1);
+    }
+
+    size_t text_len;
+    const char *text = line_text(as, l, l->file, l->line, &text_len);
+    size_t listed = l->length < LISTING_MAX_BYTES ? l->length : LISTING_MAX_BYTES;
+    size_t count = listed < LISTING_ROW_BYTES ? listed : LISTING_ROW_BYTES;
+    put_row(w, l->line, l->addr, l->bytes, count, text, text_len);
+    for (size_t i = count; i < listed; i += LISTING_ROW_BYTES) {
+        count = listed - i < LISTING_ROW_BYTES ? listed - i : LISTING_ROW_BYTES;
+        put_row(w, 0, l->addr + (uint32_t)i, l->bytes + i, count, "", 0);
+    }
+    if (l->length > listed) {
+        char more[64];
+        int len = snprintf(more, sizeof(more), "%16s... %u bytes in all\n", "", l->length);
+        writer_put(w, more, (size_t)len);
+    }
+}
+
+/* Charge len bytes written at addr (data, or fill repeated) to the current line */
+void listing_emit(Assembler *as, uint32_t addr, const uint8_t *data, uint8_t fill, size_t len) {
+    Listing *l = as->listing;
+    if (!as->list_enabled || len == 0) return;
+
+    if (!l->open || l->line != as->current_line || l->file != as->current_file ||
+        (uint64_t)l->addr + l->length != addr) {
+        listing_flush(as, l);
+        l->open = true;
+        l->file = as->current_file;
+        l->line = as->current_line;
+        l->addr = addr;
+        l->length = 0;
+    }
+
+    if (l->length < LISTING_MAX_BYTES) {
+        size_t count = LISTING_MAX_BYTES - l->length;
+        if (count > len) count = len;
+        if (data) {
+            memcpy(l->bytes + l->length, data, count);
+        } else {
+            memset(l->bytes + l->length, fill, count);
+        }
+    }
+    l->length += (uint32_t)len;
+}
+
+/* List the part of a capture in [lo, hi) against the current line */
+void listing_capture(Assembler *as, const OutputCapture *cap, uint32_t lo, uint32_t hi) {
+    for (size_t i = 0; i < cap->run_count; i++) {
+        const OutputRun *run = &cap->runs[i];
+        uint64_t start = run->addr > lo ? run->addr : lo;
+        uint64_t end = (uint64_t)run->addr + run->length;
+        if (end > hi) end = hi;
+        if (start < end) {
+            listing_emit(as, (uint32_t)start, cap->data + run->offset + (start - run->addr), 0,
+                         (size_t)(end - start));
+        }
+    }
+}
+
+/* Finish the listing; false if it couldn't be written completely */
+bool listing_close(Assembler *as) {
+    Listing *l = as->listing;
+    if (!l) return true;
+    as->listing = NULL;
+
+    listing_flush(as, l);
+    bool ok = writer_close(&l->out);
+    free(l);
+    return ok;
+}
+
+/* ---- Symbol map ---- */
+
+/* Sort keys kept next to the pointer, so sorting rarely touches the symbols */
+typedef struct {
+    int64_t value;
+    int type;
+    const Symbol *sym;
+} MapEntry;
+
+static int map_compare(const void *a, const void *b) {
+    const MapEntry *x = a;
+    const MapEntry *y = b;
+    if (x->value != y->value) return x->value < y->value ? -1 : 1;
+    if (x->type != y->type) return x->type < y->type ? -1 : 1;
+    return strcmp(x->sym->name, y->sym->name);
+}
+
+/* Every defined label and constant, sorted by value; NULL if out of memory */
+static MapEntry *map_collect(Assembler *as, size_t *count_out) {
+    MapEntry *sorted = as_malloc((as->symbol_count ? as->symbol_count : 1) * sizeof(MapEntry));
+    if (!sorted) return NULL;
+
+    size_t count = 0;
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (sym->defined && count < as->symbol_count &&
+                (sym->type == SYM_LABEL || sym->type == SYM_EQU || sym->type == SYM_SET)) {
+                sorted[count].value = sym->value;
+                sorted[count].type = sym->type;
+                sorted[count].sym = sym;
+                count++;
+            }
+        }
+    }
+    qsort(sorted, count, sizeof(MapEntry), map_compare);
+    *count_out = count;
+    return sorted;
+}
+
+/* Write every defined label and constant, sorted by value */
+bool map_write(Assembler *as, const char *filename) {
+    size_t count;
+    MapEntry *sorted = map_collect(as, &count);
+    if (!sorted) return false;
+
+    Writer w;
+    if (!writer_open(&w, filename)) {
+        free(sorted);
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        const Symbol *sym = sorted[i].sym;
+        const char *type = sym->type == SYM_LABEL ? "label" : sym->type == SYM_EQU ? "equ  " : "set  ";
+        char *start = writer_reserve(&w, 32);
+        char *p = start;
+        if (sym->value < 0) {
+            *p++ = '-';
+            p = put_hex(p, (uint32_t)-sym->value, 8);
+        } else {
+            p = put_hex(p, (uint32_t)sym->value, sym->value > 0xFFFFFF ? 8 : 6);
+        }
+        *p++ = ' ';
+        *p++ = ' ';
+        memcpy(p, type, 5);
+        p += 5;
+        *p++ = ' ';
+        *p++ = ' ';
+        w.length += (size_t)(p - start);
+        writer_put(&w, sym->name, strlen(sym->name));
+        writer_put(&w, "\n", 1);
+    }
+    free(sorted);
+    return writer_close(&w);
+}
+
+/* ---- Size map ---- */
+
+/* Index of a statement's file in files[], adding it if new */
+static uint32_t sizemap_file(Writer *w, const char ***files, size_t *count, size_t *capacity,
+                             const char *file) {
+    for (size_t i = *count; i > 0; i--) {
+        if ((*files)[i - 1] == file) return (uint32_t)(i - 1);
+    }
+    if (*count >= *capacity) {
+        size_t new_capacity = *capacity ? *capacity * 2 : 16;
+        const char **new_files = as_realloc(*files, new_capacity * sizeof(const char *));
+        if (!new_files) {
+            w->failed = true;
+            return 0;
+        }
+        *files = new_files;
+        *capacity = new_capacity;
+    }
+    (*files)[*count] = file;
+
+    const char *name = file ? file : "<input>";
+    char *start = writer_reserve(w, 16);
+    char *p = start;
+    memcpy(p, "file\t", 5);
+    p = put_decimal(p + 5, (uint32_t)*count, 0);
+    *p++ = '\t';
+    w->length += (size_t)(p - start);
+    writer_put(w, name, strlen(name));
+    writer_put(w, "\n", 1);
+    return (uint32_t)(*count)++;
+}
+
+/* Write file, line and symbol records from the pass 1 layout */
+bool sizemap_write(Assembler *as, const char *filename) {
+    size_t count;
+    MapEntry *sorted = map_collect(as, &count);
+    if (!sorted) return false;
+
+    Writer w;
+    if (!writer_open(&w, filename)) {
+        free(sorted);
+        return false;
+    }
+
+    /* Files are numbered as their first line comes up */
+    const char **files = NULL;
+    size_t file_count = 0;
+    size_t file_capacity = 0;
+    for (size_t i = 0; as->ir.valid && i < as->ir.count; i++) {
+        const Stmt *st = &as->ir.stmts[i];
+        bool sized = st->kind == STMT_INSN ||
+                     (st->kind == STMT_LINE && st->directive != DIR_ORG);
+        if (!sized || st->size == 0) continue;
+
+        uint32_t file = sizemap_file(&w, &files, &file_count, &file_capacity, st->file);
+        char *start = writer_reserve(&w, 64);
+        char *p = start;
+        memcpy(p, "line\t", 5);
+        p = put_decimal(p + 5, file, 0);
+        *p++ = '\t';
+        p = put_decimal(p, (uint32_t)st->line, 0);
+        *p++ = '\t';
+        p = put_hex(p, st->start_pc, st->start_pc > 0xFFFFFF ? 8 : 6);
+        *p++ = '\t';
+        p = put_decimal(p, st->size, 0);
+        *p++ = '\n';
+        w.length += (size_t)(p - start);
+    }
+    free(files);
+
+    for (size_t i = 0; i < count; i++) {
+        const Symbol *sym = sorted[i].sym;
+        const char *type = sym->type == SYM_LABEL ? "label\t" : sym->type == SYM_EQU ? "equ\t" : "set\t";
+        char *start = writer_reserve(&w, 32);
+        char *p = start;
+        size_t type_len = strlen(type);
+        memcpy(p, type, type_len);
+        p += type_len;
+        if (sym->value < 0) {
+            *p++ = '-';
+            p = put_hex(p, (uint32_t)-sym->value, 8);
+        } else {
+            p = put_hex(p, (uint32_t)sym->value, sym->value > 0xFFFFFF ? 8 : 6);
+        }
+        *p++ = '\t';
+        w.length += (size_t)(p - start);
+        writer_put(&w, sym->name, strlen(sym->name));
+        writer_put(&w, "\n", 1);
+    }
+    free(sorted);
+    return writer_close(&w);
+}
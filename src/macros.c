@@ -10,6 +10,17 @@
  *
  * Macro invocation:
  *   NAME [arg1, arg2, ...]
+ *
+ * Bodies are compiled when the definition ends: each line becomes literal
+ * text plus parameter slots, tokenized once.  An expansion splices its
+ * arguments into the text and, where that is safe, into the tokens, so
+ * body lines are not lexed again and nothing is allocated per line.
+ *
+ * The definition being collected and the expansion nesting live in the
+ * Assembler's MacroContext, not in file-scope state.  A definition is
+ * collected in the pass arena and copied into the symbol table at ENDM;
+ * when a later pass defines the same macro again, the definition already
+ * there is kept, compiled body and all.
  */
 
 #define _POSIX_C_SOURCE 200809L
@@ -26,48 +37,62 @@ extern Symbol *symbol_define_macro(Assembler *as, const char *name,
                                    char **body, int body_count);
 extern Symbol *symbol_lookup(Assembler *as, const char *name);
 
-/* Macro expansion state */
-static struct {
-    char **lines;           /* Expanded lines to process */
-    int line_count;
-    int current_line;
-    char *params[MAX_MACRO_PARAMS];
-    char *args[MAX_MACRO_PARAMS];
-    int param_count;
-    int arg_count;
-} macro_expansion[MAX_MACRO_DEPTH];
-
-static int macro_depth = 0;
-
-/* Check if currently collecting a macro definition */
-static bool collecting_macro = false;
-static char macro_name[MAX_IDENTIFIER];
-static char *macro_params[MAX_MACRO_PARAMS];
-static int macro_param_count = 0;
-static char **macro_body = NULL;
-static int macro_body_count = 0;
-static int macro_body_capacity = 0;
+static void macro_compile(Assembler *as, MacroDef *def);
+
+/* Release what a context holds (token buffers) */
+void macro_context_free(MacroContext *mc) {
+    for (int i = 0; i < MAX_MACRO_DEPTH; i++) {
+        free(mc->arg_buffers[i].tokens);
+        free(mc->line_buffers[i].tokens);
+    }
+    memset(mc, 0, sizeof(*mc));
+}
+
+/* Forget the definition being collected (its storage is in the pass arena) */
+static void macro_drop_definition(MacroContext *mc) {
+    mc->collecting = false;
+    mc->param_count = 0;
+    mc->body = NULL;
+    mc->body_count = 0;
+    mc->body_capacity = 0;
+}
+
+/* A definition left unterminated by the last pass doesn't carry over */
+void macro_begin_pass(Assembler *as) {
+    macro_drop_definition(&as->macro);
+}
+
+/* Define and compile a macro; the symbol table keeps copies of params and body */
+Symbol *macro_define(Assembler *as, const char *name, char **params, int param_count,
+                     char **body, int body_count) {
+    Symbol *sym = symbol_define_macro(as, name, params, param_count, body, body_count);
+    if (sym && !sym->macro->lines) {
+        macro_compile(as, sym->macro);
+    }
+    return sym;
+}
 
 /* Start collecting a macro definition */
 bool macro_start_definition(Assembler *as, const char *name, const char *params_str) {
-    if (collecting_macro) {
+    MacroContext *mc = &as->macro;
+    if (mc->collecting) {
         error(as, "nested macro definitions not allowed");
         return false;
     }
 
-    collecting_macro = true;
-    strncpy(macro_name, name, MAX_IDENTIFIER - 1);
-    macro_name[MAX_IDENTIFIER - 1] = '\0';
+    mc->collecting = true;
+    strncpy(mc->name, name, MAX_IDENTIFIER - 1);
+    mc->name[MAX_IDENTIFIER - 1] = '\0';
 
     /* Parse parameters */
-    macro_param_count = 0;
+    mc->param_count = 0;
     if (params_str && *params_str) {
         char params_copy[MAX_LINE_LENGTH];
         strncpy(params_copy, params_str, sizeof(params_copy) - 1);
         params_copy[sizeof(params_copy) - 1] = '\0';
 
         char *p = params_copy;
-        while (*p && macro_param_count < MAX_MACRO_PARAMS) {
+        while (*p && mc->param_count < MAX_MACRO_PARAMS) {
             /* Skip whitespace */
             while (*p == ' ' || *p == '\t' || *p == ',') p++;
             if (!*p) break;
@@ -78,25 +103,26 @@ bool macro_start_definition(Assembler *as, const char *name, const char *params_
 
             size_t len = p - start;
             if (len > 0) {
-                macro_params[macro_param_count] = malloc(len + 1);
-                memcpy(macro_params[macro_param_count], start, len);
-                macro_params[macro_param_count][len] = '\0';
-                macro_param_count++;
+                mc->params[mc->param_count] = arena_alloc(&as->pass_arena, len + 1);
+                memcpy(mc->params[mc->param_count], start, len);
+                mc->params[mc->param_count][len] = '\0';
+                mc->param_count++;
             }
         }
     }
 
     /* Initialize body storage */
-    macro_body_count = 0;
-    macro_body_capacity = 16;
-    macro_body = malloc(macro_body_capacity * sizeof(char *));
+    mc->body_count = 0;
+    mc->body_capacity = 16;
+    mc->body = arena_alloc(&as->pass_arena, mc->body_capacity * sizeof(char *));
 
     return true;
 }
 
 /* Add a line to the current macro definition */
-bool macro_add_line(const char *line) {
-    if (!collecting_macro) return false;
+bool macro_add_line(Assembler *as, const char *line) {
+    MacroContext *mc = &as->macro;
+    if (!mc->collecting) return false;
 
     /* Check for ENDM */
     const char *p = line;
@@ -108,81 +134,79 @@ bool macro_add_line(const char *line) {
         }
     }
 
-    /* Grow buffer if needed */
-    if (macro_body_count >= macro_body_capacity) {
-        macro_body_capacity *= 2;
-        macro_body = realloc(macro_body, macro_body_capacity * sizeof(char *));
+    /* Grow buffer if needed; the old one stays in the arena until the pass ends */
+    if (mc->body_count >= mc->body_capacity) {
+        mc->body_capacity *= 2;
+        char **body = arena_alloc(&as->pass_arena, mc->body_capacity * sizeof(char *));
+        memcpy(body, mc->body, mc->body_count * sizeof(char *));
+        mc->body = body;
     }
 
-    macro_body[macro_body_count++] = strdup(line);
+    mc->body[mc->body_count++] = arena_strdup(&as->pass_arena, line);
     return true;
 }
 
 /* Finish macro definition and store in symbol table */
 bool macro_end_definition(Assembler *as) {
-    if (!collecting_macro) {
+    MacroContext *mc = &as->macro;
+    if (!mc->collecting) {
         error(as, "ENDM without MACRO");
         return false;
     }
 
-    /* Store in symbol table */
-    Symbol *sym = symbol_define_macro(as, macro_name,
-                                       macro_params, macro_param_count,
-                                       macro_body, macro_body_count);
-
-    /* Clean up temporary storage (symbol table now owns the data) */
-    for (int i = 0; i < macro_param_count; i++) {
-        free(macro_params[i]);
-        macro_params[i] = NULL;
-    }
-    /* Note: macro_body strings are now owned by symbol table */
-    free(macro_body);
-    macro_body = NULL;
-
-    collecting_macro = false;
+    /* Store in symbol table; the collected lines go with the pass arena */
+    Symbol *sym = macro_define(as, mc->name, mc->params, mc->param_count,
+                               mc->body, mc->body_count);
+    macro_drop_definition(mc);
     return sym != NULL;
 }
 
 /* Check if currently collecting a macro */
-bool macro_is_collecting(void) {
-    return collecting_macro;
+bool macro_is_collecting(Assembler *as) {
+    return as->macro.collecting;
 }
 
 /* Check if a symbol is a macro and get its definition */
 Symbol *macro_lookup(Assembler *as, const char *name) {
     Symbol *sym = symbol_lookup(as, name);
-    if (sym && sym->type == SYM_MACRO) {
+    if (sym && sym->type == SYM_MACRO && sym->macro) {
         return sym;
     }
     return NULL;
 }
 
-/* Substitute parameters in a line */
-static char *substitute_params(const char *line, Symbol *macro, char **args, int arg_count) {
-    char *result = malloc(MAX_LINE_LENGTH);
+/* Does the parameter name at in stand alone (not part of a larger identifier)? */
+static bool param_matches(const char *line, const char *in, const char *param, size_t plen) {
+    if (strncasecmp(in, param, plen) != 0) return false;
+    char next = in[plen];
+    char prev = (in > line) ? in[-1] : ' ';
+    return !isalnum(prev) && prev != '_' && !isalnum(next) && next != '_';
+}
+
+/*
+ * Substitute parameters in a line by scanning the text.  Only used when
+ * the spliced line would not fit in MAX_LINE_LENGTH, where this scan's
+ * truncation rules decide the result.
+ */
+static void substitute_params(const char *line, const MacroDef *def, const char **args,
+                              int arg_count, char *result) {
     char *out = result;
     const char *in = line;
 
     while (*in && (out - result) < MAX_LINE_LENGTH - 1) {
         /* Check for parameter reference */
         bool found = false;
-        for (int i = 0; i < macro->macro_param_count && i < arg_count; i++) {
-            size_t plen = strlen(macro->macro_params[i]);
-            if (strncasecmp(in, macro->macro_params[i], plen) == 0) {
-                /* Check it's not part of a larger identifier */
-                char next = in[plen];
-                char prev = (in > line) ? in[-1] : ' ';
-                if (!isalnum(prev) && prev != '_' &&
-                    !isalnum(next) && next != '_') {
-                    /* Substitute */
-                    size_t alen = strlen(args[i]);
-                    if ((out - result) + alen < MAX_LINE_LENGTH - 1) {
-                        strcpy(out, args[i]);
-                        out += alen;
-                        in += plen;
-                        found = true;
-                        break;
-                    }
+        for (int i = 0; i < def->param_count && i < arg_count; i++) {
+            size_t plen = strlen(def->params[i]);
+            if (param_matches(line, in, def->params[i], plen)) {
+                /* Substitute */
+                size_t alen = strlen(args[i]);
+                if ((out - result) + alen < MAX_LINE_LENGTH - 1) {
+                    strcpy(out, args[i]);
+                    out += alen;
+                    in += plen;
+                    found = true;
+                    break;
                 }
             }
         }
@@ -191,19 +215,136 @@ static char *substitute_params(const char *line, Symbol *macro, char **args, int
         }
     }
     *out = '\0';
-    return result;
 }
 
-/* Parse macro arguments from the rest of the line */
-static int parse_macro_args(const char *args_str, char **args, int max_args) {
+/*
+ * Can an argument's tokens replace this slot's token?  Only if the name
+ * was lexed as an identifier on its own, and is not after '$' or '%',
+ * which would turn a numeric argument into a hex or binary literal.
+ */
+static bool slot_is_token(Assembler *as, const char *line, const MacroLine *ml, MacroSlot *slot) {
+    if (slot->offset > 0 && (line[slot->offset - 1] == '$' || line[slot->offset - 1] == '%')) {
+        return false;
+    }
+    for (int t = 0; t < ml->token_count; t++) {
+        const LineToken *lt = &ml->tokens.tokens[t];
+        if (lt->column != slot->offset + 1) continue;
+        if (lt->type != TOK_IDENTIFIER) return false;
+        if (strlen(strpool_text(&as->strings, lt->atom)) != slot->length) return false;
+        slot->token = t;
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Does an argument lex the same on its own as inside any line?  Anything
+ * made only of identifier characters (with an optional leading minus,
+ * as the parser writes negative numbers) does.
+ */
+static bool arg_is_token_safe(const char *arg) {
+    if (*arg == '-') arg++;
+    for (; *arg; arg++) {
+        if (!isalnum((unsigned char)*arg) && *arg != '_') return false;
+    }
+    return true;
+}
+
+/*
+ * Compile the body into literal text and parameter slots.  Whether a
+ * name is a parameter reference depends only on the body text, so the
+ * scan is done once here and expansion just splices the arguments in.
+ * Each line is tokenized once as well; when its parameter references are
+ * whole tokens, expansion splices the argument tokens in instead of
+ * lexing the substituted text again.
+ */
+static void macro_compile(Assembler *as, MacroDef *def) {
+    if (def->body_lines == 0) return;
+
+    def->lines = as_calloc(def->body_lines, sizeof(MacroLine));
+    if (!def->lines) return;  /* Expansion falls back to scanning */
+
+    for (int i = 0; i < def->body_lines; i++) {
+        const char *line = def->body[i];
+        MacroLine *ml = &def->lines[i];
+        int capacity = 0;
+
+        ml->length = strlen(line);
+        for (const char *in = line; *in; ) {
+            int param = -1;
+            size_t plen = 0;
+            for (int j = 0; j < def->param_count; j++) {
+                plen = strlen(def->params[j]);
+                if (param_matches(line, in, def->params[j], plen)) {
+                    param = j;
+                    break;
+                }
+            }
+            if (param < 0) {
+                in++;
+                continue;
+            }
+
+            if (ml->slot_count >= capacity) {
+                capacity = capacity ? capacity * 2 : 4;
+                MacroSlot *slots = as_realloc(ml->slots, capacity * sizeof(MacroSlot));
+                if (!slots) {
+                    fprintf(stderr, "Failed to allocate macro template\n");
+                    exit(1);
+                }
+                ml->slots = slots;
+            }
+            MacroSlot *slot = &ml->slots[ml->slot_count++];
+            slot->offset = (uint32_t)(in - line);
+            slot->length = (uint16_t)plen;
+            slot->param = (uint16_t)param;
+            in += plen;
+        }
+
+        StatsPhase prev = stats_enter(as, PHASE_LEX);
+        ml->token_count = lexer_tokenize(&as->strings, line, &ml->tokens);
+        stats_leave(as, prev);
+        ml->splice_tokens = true;
+        for (int j = 0; j < ml->slot_count; j++) {
+            if (!slot_is_token(as, line, ml, &ml->slots[j])) {
+                ml->splice_tokens = false;
+            }
+        }
+    }
+}
+
+/* Splice arguments into a compiled line, false if the result would not fit */
+static bool macro_splice(const char *line, const MacroLine *ml, const char **args,
+                         const size_t *arg_lengths, char *out) {
+    size_t total = ml->length;
+    for (int i = 0; i < ml->slot_count; i++) {
+        total += arg_lengths[ml->slots[i].param] - ml->slots[i].length;
+    }
+    if (total >= MAX_LINE_LENGTH - 1) return false;
+
+    size_t pos = 0;
+    for (int i = 0; i < ml->slot_count; i++) {
+        const MacroSlot *slot = &ml->slots[i];
+        memcpy(out, line + pos, slot->offset - pos);
+        out += slot->offset - pos;
+        memcpy(out, args[slot->param], arg_lengths[slot->param]);
+        out += arg_lengths[slot->param];
+        pos = slot->offset + slot->length;
+    }
+    memcpy(out, line + pos, ml->length - pos);
+    out[ml->length - pos] = '\0';
+    return true;
+}
+
+/* Split macro arguments from the rest of the line into storage */
+static int parse_macro_args(const char *args_str, char *storage, const char **args, int max_args) {
     int count = 0;
     if (!args_str || !*args_str) return 0;
 
-    char args_copy[MAX_LINE_LENGTH];
-    strncpy(args_copy, args_str, sizeof(args_copy) - 1);
-    args_copy[sizeof(args_copy) - 1] = '\0';
+    strncpy(storage, args_str, MAX_LINE_LENGTH - 1);
+    storage[MAX_LINE_LENGTH - 1] = '\0';
 
-    char *p = args_copy;
+    char *p = storage;
     while (*p && count < max_args) {
         /* Skip whitespace */
         while (*p == ' ' || *p == '\t') p++;
@@ -222,61 +363,128 @@ static int parse_macro_args(const char *args_str, char **args, int max_args) {
         char *end = p;
         while (end > start && (end[-1] == ' ' || end[-1] == '\t')) end--;
 
-        size_t len = end - start;
-        if (len > 0) {
-            args[count] = malloc(len + 1);
-            memcpy(args[count], start, len);
-            args[count][len] = '\0';
-            count++;
+        /* Terminating in place may overwrite the delimiter, so check it first */
+        bool more = (*p == ',');
+        if (end > start) {
+            *end = '\0';
+            args[count++] = start;
         }
 
-        if (*p == ',') p++;
+        if (!more) break;
+        p++;
     }
 
     return count;
 }
 
+/* Splice argument tokens into a compiled line's tokens */
+static int macro_splice_tokens(const MacroLine *ml, const TokenBuffer *arg_tokens,
+                               const int *arg_first, const int *arg_token_count,
+                               TokenBuffer *out) {
+    out->count = 0;
+    int slot = 0;
+    for (int t = 0; t < ml->token_count; t++) {
+        const LineToken *src = &ml->tokens.tokens[t];
+        int n = 1;
+        if (slot < ml->slot_count && ml->slots[slot].token == t) {
+            int param = ml->slots[slot++].param;
+            src = &arg_tokens->tokens[arg_first[param]];
+            n = arg_token_count[param];
+        }
+
+        if (out->count + n > out->capacity) {
+            size_t new_cap = out->capacity ? out->capacity * 2 : 64;
+            while (new_cap < out->count + n) new_cap *= 2;
+            LineToken *new_tokens = as_realloc(out->tokens, new_cap * sizeof(LineToken));
+            if (!new_tokens) {
+                fprintf(stderr, "Failed to allocate token buffer\n");
+                exit(1);
+            }
+            out->tokens = new_tokens;
+            out->capacity = new_cap;
+        }
+        memcpy(&out->tokens[out->count], src, n * sizeof(LineToken));
+        out->count += n;
+    }
+    return (int)out->count;
+}
+
 /* Expand a macro invocation */
 bool macro_expand(Assembler *as, Symbol *macro, const char *args_str) {
-    if (macro_depth >= MAX_MACRO_DEPTH) {
+    MacroContext *mc = &as->macro;
+    if (mc->depth >= MAX_MACRO_DEPTH) {
         error(as, "macro expansion too deep");
         return false;
     }
 
-    /* Parse arguments */
-    char *args[MAX_MACRO_PARAMS];
-    int arg_count = parse_macro_args(args_str, args, MAX_MACRO_PARAMS);
+    const MacroDef *def = macro->macro;
+    as->stats.macro_expansions++;
+    if (as->cache_tracking) {
+        cache_note_macro(as, macro);
+    }
+
+    /* Parse arguments; missing ones expand to nothing */
+    char arg_storage[MAX_LINE_LENGTH];
+    const char *args[MAX_MACRO_PARAMS];
+    size_t arg_lengths[MAX_MACRO_PARAMS];
+    int arg_count = parse_macro_args(args_str, arg_storage, args, MAX_MACRO_PARAMS);
+    for (int i = arg_count; i < def->param_count; i++) {
+        args[i] = "";
+    }
+    if (arg_count < def->param_count) {
+        arg_count = def->param_count;
+    }
 
-    /* Check argument count */
-    if (arg_count < macro->macro_param_count) {
-        /* Fill missing args with empty strings */
-        for (int i = arg_count; i < macro->macro_param_count; i++) {
-            args[i] = strdup("");
+    /* Tokenize each argument once for splicing into token-safe lines */
+    TokenBuffer *arg_tokens = &mc->arg_buffers[mc->depth];
+    TokenBuffer *line_tokens = &mc->line_buffers[mc->depth];
+    int arg_first[MAX_MACRO_PARAMS];
+    int arg_token_count[MAX_MACRO_PARAMS];
+    bool args_token_safe = true;
+    arg_tokens->count = 0;
+    for (int i = 0; i < arg_count; i++) {
+        arg_lengths[i] = strlen(args[i]);
+        if (!arg_is_token_safe(args[i])) {
+            args_token_safe = false;
+        }
+    }
+    if (args_token_safe) {
+        StatsPhase prev = stats_enter(as, PHASE_LEX);
+        for (int i = 0; i < def->param_count; i++) {
+            arg_first[i] = (int)arg_tokens->count;
+            arg_token_count[i] = lexer_tokenize(&as->strings, args[i], arg_tokens) - 1;  /* Drop EOF */
         }
-        arg_count = macro->macro_param_count;
+        stats_leave(as, prev);
     }
 
+    mc->depth++;
+
     /* Process each line of the macro body */
-    for (int i = 0; i < macro->macro_body_lines; i++) {
-        char *expanded = substitute_params(macro->macro_body[i], macro, args, arg_count);
+    char expanded[MAX_LINE_LENGTH];
+    for (int i = 0; i < def->body_lines; i++) {
+        const MacroLine *ml = def->lines ? &def->lines[i] : NULL;
 
-        /* Parse and execute the expanded line */
         /* Save current line context */
         int saved_line = as->current_line;
 
-        /* Process the expanded line through parse_line */
-        extern bool parse_line(Assembler *as, const char *line);
-        parse_line(as, expanded);
+        if (ml && ml->slot_count == 0) {
+            parse_line_tokens(as, def->body[i], ml->tokens.tokens, ml->token_count);
+        } else if (ml && macro_splice(def->body[i], ml, args, arg_lengths, expanded)) {
+            if (ml->splice_tokens && args_token_safe) {
+                int count = macro_splice_tokens(ml, arg_tokens, arg_first, arg_token_count, line_tokens);
+                parse_line_tokens(as, expanded, line_tokens->tokens, count);
+            } else {
+                parse_line(as, expanded);
+            }
+        } else {
+            substitute_params(def->body[i], def, args, arg_count, expanded);
+            parse_line(as, expanded);
+        }
 
         as->current_line = saved_line;
-        free(expanded);
-    }
-
-    /* Free arguments */
-    for (int i = 0; i < arg_count; i++) {
-        free(args[i]);
     }
 
+    mc->depth--;
     return true;
 }
 
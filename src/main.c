@@ -15,10 +15,34 @@
 
 static void print_usage(const char *progname) {
     fprintf(stderr, "TLCS-900/TMP94C241 Assembler v0.1\n\n");
-    fprintf(stderr, "Usage: %s [options] input.asm\n\n", progname);
+    fprintf(stderr, "Usage: %s [options] input.asm\n", progname);
+    fprintf(stderr, "       %s [options] --batch MANIFEST\n", progname);
+    fprintf(stderr, "       %s [options] --emit-pch HEADER\n\n", progname);
     fprintf(stderr, "Options:\n");
-    fprintf(stderr, "  -o FILE    Output file (default: input.rom)\n");
+    fprintf(stderr, "  -o FILE    Output file (default: input.rom, .hex or .srec)\n");
     fprintf(stderr, "  -v         Verbose output\n");
+    fprintf(stderr, "  -j N       Encode pass 2 on N threads (default: 1);\n");
+    fprintf(stderr, "             with --batch, build N targets at a time\n");
+    fprintf(stderr, "  --batch MANIFEST\n");
+    fprintf(stderr, "             Build every 'input [output]' line of MANIFEST\n");
+    fprintf(stderr, "  --emit-pch HEADER\n");
+    fprintf(stderr, "             Precompile an EQU/MACRO-only include file to HEADER.pch\n");
+    fprintf(stderr, "  --format bin|ihex|srec\n");
+    fprintf(stderr, "             Output a binary image (default), Intel HEX or S-records\n");
+    fprintf(stderr, "  --split SIZE\n");
+    fprintf(stderr, "             Cut the output into banks of SIZE bytes (FILE.0.rom, ...)\n");
+    fprintf(stderr, "  --listing  Write a listing of the bytes each line produced (output.lst)\n");
+    fprintf(stderr, "  --map      Write the labels and constants sorted by value (output.map)\n");
+    fprintf(stderr, "  --symbols-only\n");
+    fprintf(stderr, "             Stop after pass 1 and write label addresses and line sizes\n");
+    fprintf(stderr, "             (output.sym) instead of an image\n");
+    fprintf(stderr, "  --stats    Report time per pass, iteration and phase, and counters\n");
+    fprintf(stderr, "  --no-cache Don't read or write the build cache (FILE.tlcs900cache)\n");
+    fprintf(stderr, "  --watch    Build again whenever the input or an included file changes\n");
+    fprintf(stderr, "  --compare REFERENCE\n");
+    fprintf(stderr, "             Check the output against a reference ROM as it is assembled\n");
+    fprintf(stderr, "  --compare-limit N\n");
+    fprintf(stderr, "             Stop after N lines that differ from the reference (default: 10)\n");
     fprintf(stderr, "  -h         Show this help\n");
     fprintf(stderr, "\n");
 }
@@ -26,10 +50,40 @@ static void print_usage(const char *progname) {
 int main(int argc, char *argv[]) {
     const char *input_file = NULL;
     const char *output_file = NULL;
+    const char *manifest = NULL;
+    const char *pch_header = NULL;
     bool verbose = false;
+    bool use_cache = true;
+    bool stats = false;
+    bool listing = false;
+    bool map = false;
+    bool symbols_only = false;
+    bool watch = false;
+    const char *compare = NULL;
+    int compare_limit = 10;
+    OutputFormat format = OUTPUT_BINARY;
+    uint32_t bank_size = 0;
+    int threads = 1;
     int opt;
 
-    while ((opt = getopt(argc, argv, "o:vh")) != -1) {
+    static const struct option long_options[] = {
+        {"no-cache", no_argument, NULL, 'N'},
+        {"batch", required_argument, NULL, 'B'},
+        {"emit-pch", required_argument, NULL, 'P'},
+        {"stats", no_argument, NULL, 'S'},
+        {"listing", no_argument, NULL, 'L'},
+        {"map", no_argument, NULL, 'M'},
+        {"symbols-only", no_argument, NULL, 'Y'},
+        {"watch", no_argument, NULL, 'W'},
+        {"compare", required_argument, NULL, 'C'},
+        {"compare-limit", required_argument, NULL, 'K'},
+        {"format", required_argument, NULL, 'F'},
+        {"split", required_argument, NULL, 'X'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    while ((opt = getopt_long(argc, argv, "o:vj:h", long_options, NULL)) != -1) {
         switch (opt) {
             case 'o':
                 output_file = optarg;
@@ -37,6 +91,76 @@ int main(int argc, char *argv[]) {
             case 'v':
                 verbose = true;
                 break;
+            case 'j':
+                threads = atoi(optarg);
+                if (threads < 1 || threads > 256) {
+                    fprintf(stderr, "Error: -j needs a thread count from 1 to 256\n");
+                    return 1;
+                }
+                break;
+            case 'N':
+                use_cache = false;
+                break;
+            case 'B':
+                manifest = optarg;
+                break;
+            case 'P':
+                pch_header = optarg;
+                break;
+            case 'S':
+                stats = true;
+                break;
+            case 'L':
+                listing = true;
+                break;
+            case 'M':
+                map = true;
+                break;
+            case 'Y':
+                symbols_only = true;
+                break;
+            case 'W':
+                watch = true;
+                break;
+            case 'C':
+                compare = optarg;
+                break;
+            case 'K':
+                compare_limit = atoi(optarg);
+                if (compare_limit < 1) {
+                    fprintf(stderr, "Error: --compare-limit needs a count of at least 1\n");
+                    return 1;
+                }
+                break;
+            case 'F':
+                if (strcmp(optarg, "bin") == 0) {
+                    format = OUTPUT_BINARY;
+                } else if (strcmp(optarg, "ihex") == 0 || strcmp(optarg, "hex") == 0) {
+                    format = OUTPUT_IHEX;
+                } else if (strcmp(optarg, "srec") == 0) {
+                    format = OUTPUT_SREC;
+                } else {
+                    fprintf(stderr, "Error: unknown output format '%s' (bin, ihex or srec)\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'X': {
+                char *end;
+                unsigned long size = strtoul(optarg, &end, 0);
+                if (*end == 'k' || *end == 'K') {
+                    size *= 1024;
+                    end++;
+                } else if (*end == 'm' || *end == 'M') {
+                    size *= 1024 * 1024;
+                    end++;
+                }
+                if (*end || size == 0 || size > 0x80000000UL) {
+                    fprintf(stderr, "Error: --split needs a bank size such as 0x100000 or 512K\n");
+                    return 1;
+                }
+                bank_size = (uint32_t)size;
+                break;
+            }
             case 'h':
                 print_usage(argv[0]);
                 return 0;
@@ -46,57 +170,57 @@ int main(int argc, char *argv[]) {
         }
     }
 
-    if (optind >= argc) {
-        fprintf(stderr, "Error: no input file specified\n");
-        print_usage(argv[0]);
-        return 1;
-    }
-
-    input_file = argv[optind];
-
-    /* Generate default output filename */
-    char default_output[1024];
-    if (!output_file) {
-        strncpy(default_output, input_file, sizeof(default_output) - 5);
-        char *dot = strrchr(default_output, '.');
-        if (dot) {
-            strcpy(dot, ".rom");
-        } else {
-            strcat(default_output, ".rom");
+    if (pch_header) {
+        if (manifest || optind < argc || output_file) {
+            fprintf(stderr, "Error: --emit-pch takes only the header to precompile\n");
+            return 1;
         }
-        output_file = default_output;
+        return pch_emit(pch_header, verbose) ? 0 : 1;
     }
 
-    /* Create assembler instance */
-    Assembler *as = assembler_new();
-    if (!as) {
-        fprintf(stderr, "Error: failed to create assembler\n");
+    if (symbols_only && listing) {
+        fprintf(stderr, "Error: --symbols-only skips pass 2, which the listing comes from\n");
         return 1;
     }
 
-    as->verbose = verbose;
+    if (watch && manifest) {
+        fprintf(stderr, "Error: --watch builds a single input, not a manifest\n");
+        return 1;
+    }
 
-    /* Assemble the file */
-    bool success = assembler_assemble_file(as, input_file);
+    if (compare && (manifest || symbols_only)) {
+        fprintf(stderr, "Error: --compare checks the image of a single input's pass 2\n");
+        return 1;
+    }
 
-    /* Write output even if there were errors (for debugging/comparison) */
-    if (as->output_size > 0) {
-        if (!assembler_write_output(as, output_file)) {
-            fprintf(stderr, "Failed to write output file\n");
-            assembler_free(as);
-            return 1;
-        }
+    if (manifest && (optind < argc || output_file)) {
+        fprintf(stderr, "Error: --batch takes its inputs and outputs from the manifest\n");
+        return 1;
     }
 
-    if (!success) {
-        assembler_free(as);
+    if (!manifest && optind >= argc) {
+        fprintf(stderr, "Error: no input file specified\n");
+        print_usage(argv[0]);
         return 1;
     }
 
-    if (verbose) {
-        printf("Assembly successful: %s -> %s\n", input_file, output_file);
+    BuildOptions options = { verbose, use_cache, threads, stats, listing, map, format, bank_size,
+                             symbols_only, compare, compare_limit };
+    if (manifest) {
+        return build_batch(&options, manifest, threads);
     }
 
-    assembler_free(as);
-    return 0;
+    input_file = argv[optind];
+
+    /* Generate default output filename */
+    char default_output[1024];
+    if (!output_file) {
+        build_default_output(&options, input_file, default_output, sizeof(default_output));
+        output_file = default_output;
+    }
+
+    if (watch) {
+        return build_watch(&options, input_file, output_file);
+    }
+    return build_target(&options, input_file, output_file, NULL, NULL) ? 0 : 1;
 }
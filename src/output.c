@@ -1,8 +1,22 @@
 /*
  * TLCS-900 Assembler - Binary Output Writer
  *
- * Handles output buffer management and writing to binary files.
- * Supports non-contiguous ORG regions by tracking base address.
+ * Handles the output image and writing it to binary files.
+ *
+ * Pass 2 writes into a sparse image of 64 KiB pages that are allocated
+ * only when touched, so an ORG into a high bank or back below the first
+ * ORG costs nothing for the untouched address space.  The flat ROM,
+ * padded with 0xFF from the base address to the highest byte written,
+ * is never materialized: the output file is written straight from the
+ * pages, as a binary image, Intel HEX or S-records, optionally cut into
+ * banks.  Each page keeps a bitmap of the bytes written to it, so the
+ * text formats hold exactly the bytes the source emitted, whatever
+ * their value, and leave out every gap.
+ *
+ * Writes can instead be captured as address runs (a pass 2 worker's
+ * output, a file recorded for the build cache) and replayed into the
+ * image later, in order.  Writes to the image are also passed to the
+ * listing, when one is being written, and to the reference comparison.
  */
 
 #include <stdio.h>
@@ -10,46 +24,90 @@
 #include <string.h>
 #include "../include/tlcs900.h"
 
-#define INITIAL_OUTPUT_SIZE 65536
+#define OUTPUT_PAGE_BITS 16
+#define OUTPUT_PAGE_SIZE (1u << OUTPUT_PAGE_BITS)
+#define OUTPUT_PAGE_MASK (OUTPUT_PAGE_SIZE - 1)
 
-/* Initialize output buffer */
-void output_init(Assembler *as) {
-    as->output = malloc(INITIAL_OUTPUT_SIZE);
-    if (!as->output) {
-        fprintf(stderr, "Failed to allocate output buffer\n");
-        exit(1);
+/* A page is its bytes followed by a bitmap of the ones written */
+#define OUTPUT_PAGE_ALLOC (OUTPUT_PAGE_SIZE + OUTPUT_PAGE_SIZE / 8)
+
+static inline uint8_t *page_written(uint8_t *page) {
+    return page + OUTPUT_PAGE_SIZE;
+}
+
+static inline bool byte_written(const uint8_t *page, size_t offset) {
+    return (page[OUTPUT_PAGE_SIZE + (offset >> 3)] >> (offset & 7)) & 1;
+}
+
+/* Mark [offset, offset + len) of a page written */
+static void mark_written(uint8_t *page, size_t offset, size_t len) {
+    uint8_t *bits = page_written(page);
+    while (len > 0 && (offset & 7)) {
+        bits[offset >> 3] |= (uint8_t)(1u << (offset & 7));
+        offset++;
+        len--;
+    }
+    memset(bits + (offset >> 3), 0xFF, len >> 3);
+    offset += len & ~(size_t)7;
+    len &= 7;
+    while (len > 0) {
+        bits[offset >> 3] |= (uint8_t)(1u << (offset & 7));
+        offset++;
+        len--;
     }
+}
+
+/* Initialize output image */
+void output_init(Assembler *as) {
+    as->output_pages = NULL;
+    as->output_page_count = 0;
     as->output_size = 0;
-    as->output_capacity = INITIAL_OUTPUT_SIZE;
     as->output_base = 0;
+    as->output_end = 0;
 }
 
-/* Free output buffer */
+/* Free output image */
 void output_free(Assembler *as) {
-    if (as->output) {
-        free(as->output);
-        as->output = NULL;
+    for (size_t i = 0; i < as->output_page_count; i++) {
+        free(as->output_pages[i]);
     }
+    free(as->output_pages);
+    as->output_pages = NULL;
+    as->output_page_count = 0;
 }
 
-/* Ensure capacity for n more bytes */
-static void ensure_capacity(Assembler *as, size_t n) {
-    size_t needed = as->output_size + n;
-    if (needed <= as->output_capacity) return;
+/* Get the page holding an address, allocating it (0xFF-filled) if needed */
+static uint8_t *output_page(Assembler *as, uint32_t addr) {
+    size_t index = addr >> OUTPUT_PAGE_BITS;
 
-    size_t new_cap = as->output_capacity;
-    while (new_cap < needed) {
-        new_cap *= 2;
+    if (index >= as->output_page_count) {
+        size_t new_count = as->output_page_count ? as->output_page_count : 16;
+        while (new_count <= index) {
+            new_count *= 2;
+        }
+        uint8_t **new_pages = as_realloc(as->output_pages, new_count * sizeof(uint8_t *));
+        if (!new_pages) {
+            fprintf(stderr, "Failed to grow output page table to %zu pages\n", new_count);
+            exit(1);
+        }
+        memset(new_pages + as->output_page_count, 0,
+               (new_count - as->output_page_count) * sizeof(uint8_t *));
+        as->output_pages = new_pages;
+        as->output_page_count = new_count;
     }
 
-    uint8_t *new_buf = realloc(as->output, new_cap);
-    if (!new_buf) {
-        fprintf(stderr, "Failed to grow output buffer to %zu bytes\n", new_cap);
-        exit(1);
+    if (!as->output_pages[index]) {
+        uint8_t *page = as_malloc(OUTPUT_PAGE_ALLOC);
+        if (!page) {
+            fprintf(stderr, "Failed to allocate output page\n");
+            exit(1);
+        }
+        memset(page, 0xFF, OUTPUT_PAGE_SIZE);  /* Gaps read as 0xFF (matches ASL) */
+        memset(page_written(page), 0, OUTPUT_PAGE_SIZE / 8);
+        as->output_pages[index] = page;
     }
 
-    as->output = new_buf;
-    as->output_capacity = new_cap;
+    return as->output_pages[index];
 }
 
 /* Set the base address (first ORG) */
@@ -59,9 +117,129 @@ void output_set_base(Assembler *as, uint32_t base) {
     }
 }
 
-/* Get current output offset for a given PC */
-static size_t pc_to_offset(Assembler *as, uint32_t pc) {
-    return pc - as->output_base;
+/*
+ * Store len bytes at addr, copying from data or repeating fill when data
+ * is NULL.  Only the pages touched are allocated; the flat image spans
+ * from the base (lowered if anything lands below it) to the highest
+ * byte written.
+ */
+static void output_store(Assembler *as, uint32_t addr, const uint8_t *data,
+                         uint8_t fill, size_t len) {
+    as->stats.bytes_emitted += len;
+    if (as->output_capture) {
+        output_capture_add(as->output_capture, addr, data, fill, len);
+        return;
+    }
+    if (as->cache_tracking) {
+        cache_note_output(as, addr, data, fill, len);
+    }
+    if (as->listing) {
+        listing_emit(as, addr, data, fill, len);
+    }
+    if (as->compare) {
+        compare_emit(as, addr, data, fill, len);
+    }
+    if (addr < as->output_base) {
+        as->output_base = addr;
+    }
+    if ((uint64_t)addr + len > as->output_end) {
+        as->output_end = (uint64_t)addr + len;
+    }
+    as->output_size = (size_t)(as->output_end - as->output_base);
+
+    while (len > 0) {
+        uint8_t *page = output_page(as, addr);
+        size_t offset = addr & OUTPUT_PAGE_MASK;
+        size_t chunk = OUTPUT_PAGE_SIZE - offset;
+        if (chunk > len) chunk = len;
+
+        if (data) {
+            memcpy(page + offset, data, chunk);
+            data += chunk;
+        } else {
+            memset(page + offset, fill, chunk);
+        }
+        mark_written(page, offset, chunk);
+        addr += (uint32_t)chunk;
+        len -= chunk;
+    }
+}
+
+/* Start a capture in arena, with room for size bytes in one run */
+void output_capture_init(OutputCapture *cap, Arena *arena, size_t size) {
+    memset(cap, 0, sizeof(*cap));
+    cap->arena = arena;
+    cap->run_capacity = 4;
+    cap->runs = arena_alloc(arena, cap->run_capacity * sizeof(OutputRun));
+    if (size > 0) {
+        cap->capacity = size;
+        cap->data = arena_alloc(arena, size);
+    }
+}
+
+/* Resize a capture array on the heap, or copy it within the arena */
+static void *capture_grow(const OutputCapture *cap, void *old, size_t old_size, size_t new_size) {
+    void *p;
+    if (cap->arena) {
+        p = arena_alloc(cap->arena, new_size);
+        if (old_size) memcpy(p, old, old_size);
+    } else {
+        p = as_realloc(old, new_size);
+    }
+    if (!p) {
+        fprintf(stderr, "Failed to grow output capture\n");
+        exit(1);
+    }
+    return p;
+}
+
+/* Append a write to a capture, extending the last run when contiguous */
+void output_capture_add(OutputCapture *cap, uint32_t addr, const uint8_t *data, uint8_t fill, size_t len) {
+    OutputRun *last = cap->run_count ? &cap->runs[cap->run_count - 1] : NULL;
+    if (!last || (uint64_t)last->addr + last->length != addr) {
+        if (cap->run_count >= cap->run_capacity) {
+            size_t new_capacity = cap->run_capacity ? cap->run_capacity * 2 : 16;
+            cap->runs = capture_grow(cap, cap->runs, cap->run_count * sizeof(OutputRun),
+                                     new_capacity * sizeof(OutputRun));
+            cap->run_capacity = new_capacity;
+        }
+        last = &cap->runs[cap->run_count++];
+        last->addr = addr;
+        last->length = 0;
+        last->offset = cap->size;
+    }
+    last->length += (uint32_t)len;
+
+    if (cap->size + len > cap->capacity) {
+        size_t new_capacity = cap->capacity ? cap->capacity : 4096;
+        while (new_capacity < cap->size + len) {
+            new_capacity *= 2;
+        }
+        cap->data = capture_grow(cap, cap->data, cap->size, new_capacity);
+        cap->capacity = new_capacity;
+    }
+    if (data) {
+        memcpy(cap->data + cap->size, data, len);
+    } else {
+        memset(cap->data + cap->size, fill, len);
+    }
+    cap->size += len;
+}
+
+/* Write captured runs into the image (or the active capture), in order */
+void output_capture_replay(Assembler *as, const OutputCapture *cap) {
+    for (size_t i = 0; i < cap->run_count; i++) {
+        const OutputRun *run = &cap->runs[i];
+        output_store(as, run->addr, cap->data + run->offset, 0, run->length);
+    }
+}
+
+void output_capture_free(OutputCapture *cap) {
+    if (!cap->arena) {
+        free(cap->runs);
+        free(cap->data);
+    }
+    memset(cap, 0, sizeof(*cap));
 }
 
 /* Emit a single byte */
@@ -71,25 +249,49 @@ void emit_byte(Assembler *as, uint8_t b) {
         return;
     }
 
-    size_t offset = pc_to_offset(as, as->pc);
-
-    /* Extend buffer with 0xFF if needed (matches ASL behavior) */
-    if (offset >= as->output_size) {
-        size_t gap = offset - as->output_size + 1;
-        ensure_capacity(as, gap);
-        memset(as->output + as->output_size, 0xFF, gap);
-        as->output_size = offset + 1;
-    } else {
-        ensure_capacity(as, 1);
-        if (offset + 1 > as->output_size) {
-            as->output_size = offset + 1;
+    uint32_t addr = as->pc;
+    if (as->output_size != 0 && addr >= as->output_base && addr < as->output_end &&
+        !as->cache_tracking && !as->output_capture) {
+        /* Common case: overwrite inside the image, page already counted */
+        size_t index = addr >> OUTPUT_PAGE_BITS;
+        uint8_t *page = as->output_pages[index];
+        if (page) {
+            size_t offset = addr & OUTPUT_PAGE_MASK;
+            page[offset] = b;
+            page_written(page)[offset >> 3] |= (uint8_t)(1u << (offset & 7));
+            as->stats.bytes_emitted++;
+            if (as->listing) {
+                listing_emit(as, addr, &b, 0, 1);
+            }
+            if (as->compare) {
+                compare_emit(as, addr, &b, 0, 1);
+            }
+            as->pc++;
+            return;
         }
     }
-
-    as->output[offset] = b;
+    output_store(as, addr, &b, 0, 1);
     as->pc++;
 }
 
+/* Emit a block of bytes with one capacity check */
+void emit_bytes(Assembler *as, const uint8_t *data, size_t len) {
+    if (len == 0) return;
+    if (as->pass == 2) {
+        output_store(as, as->pc, data, 0, len);
+    }
+    as->pc += (uint32_t)len;
+}
+
+/* Emit count copies of a fill byte with one capacity check */
+void emit_fill_block(Assembler *as, size_t count, uint8_t value) {
+    if (count == 0) return;
+    if (as->pass == 2) {
+        output_store(as, as->pc, NULL, value, count);
+    }
+    as->pc += (uint32_t)count;
+}
+
 /* Emit a 16-bit word (little-endian) */
 void emit_word(Assembler *as, uint16_t w) {
     emit_byte(as, w & 0xFF);
@@ -111,44 +313,276 @@ void emit_long(Assembler *as, uint32_t l) {
     emit_byte(as, (l >> 24) & 0xFF);
 }
 
-/* Emit n bytes of padding */
-void emit_fill(Assembler *as, size_t count, uint8_t value) {
-    for (size_t i = 0; i < count; i++) {
-        emit_byte(as, value);
+/*
+ * Build the flat, 0xFF-padded ROM covering output_base up to the highest
+ * byte written.  The caller frees the result.
+ */
+uint8_t *output_flatten(Assembler *as) {
+    uint8_t *flat = as_malloc(as->output_size ? as->output_size : 1);
+    if (!flat) {
+        fprintf(stderr, "Failed to allocate %zu byte output image\n", as->output_size);
+        return NULL;
+    }
+
+    uint64_t addr = as->output_base;
+    size_t pos = 0;
+    while (pos < as->output_size) {
+        size_t index = (size_t)(addr >> OUTPUT_PAGE_BITS);
+        size_t offset = (size_t)(addr & OUTPUT_PAGE_MASK);
+        size_t chunk = OUTPUT_PAGE_SIZE - offset;
+        if (chunk > as->output_size - pos) chunk = as->output_size - pos;
+
+        if (index < as->output_page_count && as->output_pages[index]) {
+            memcpy(flat + pos, as->output_pages[index] + offset, chunk);
+        } else {
+            memset(flat + pos, 0xFF, chunk);
+        }
+        addr += chunk;
+        pos += chunk;
+    }
+
+    return flat;
+}
+
+/* ---- Output formats ---- */
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+/* Data bytes per Intel HEX / S-record line */
+#define RECORD_BYTES 32
+
+/* Text is formatted here and written out in large blocks */
+#define TEXT_BUFFER_SIZE (256u * 1024)
+
+typedef struct {
+    FILE *fp;
+    char *text;
+    size_t length;
+    uint8_t sum;                /* Checksum of the bytes put so far */
+    bool failed;
+} RecordWriter;
+
+static void record_drain(RecordWriter *w) {
+    if (w->length > 0 && fwrite(w->text, 1, w->length, w->fp) != w->length) {
+        w->failed = true;
+    }
+    w->length = 0;
+}
+
+/* Start a record; a whole one always fits after this */
+static void record_begin(RecordWriter *w, const char *start) {
+    if (w->length + 2 * (RECORD_BYTES + 8) + 4 > TEXT_BUFFER_SIZE) {
+        record_drain(w);
+    }
+    while (*start) {
+        w->text[w->length++] = *start++;
     }
+    w->sum = 0;
+}
+
+static void record_byte(RecordWriter *w, uint8_t b) {
+    w->text[w->length++] = hex_digits[b >> 4];
+    w->text[w->length++] = hex_digits[b & 0xF];
+    w->sum += b;
 }
 
-/* Emit a string without null terminator */
-void emit_string(Assembler *as, const char *str, size_t len) {
+static void record_end(RecordWriter *w, uint8_t checksum) {
+    record_byte(w, checksum);
+    w->text[w->length++] = '\n';
+}
+
+static void ihex_record(RecordWriter *w, uint8_t type, uint16_t addr, const uint8_t *data, size_t len) {
+    record_begin(w, ":");
+    record_byte(w, (uint8_t)len);
+    record_byte(w, (uint8_t)(addr >> 8));
+    record_byte(w, (uint8_t)addr);
+    record_byte(w, type);
     for (size_t i = 0; i < len; i++) {
-        emit_byte(as, (uint8_t)str[i]);
+        record_byte(w, data[i]);
     }
+    record_end(w, (uint8_t)-w->sum);
 }
 
-/* Write output buffer to file */
-bool assembler_write_output(Assembler *as, const char *filename) {
-    if (as->output_size == 0) {
-        fprintf(stderr, "Warning: no output generated\n");
+/* S1/S2/S3 carry 2, 3 or 4 address bytes; S9/S8/S7 end them */
+static void srec_record(RecordWriter *w, char type, int addr_bytes, uint32_t addr,
+                        const uint8_t *data, size_t len) {
+    char start[3] = { 'S', type, '\0' };
+    record_begin(w, start);
+    record_byte(w, (uint8_t)(addr_bytes + len + 1));
+    for (int i = addr_bytes - 1; i >= 0; i--) {
+        record_byte(w, (uint8_t)(addr >> (8 * i)));
+    }
+    for (size_t i = 0; i < len; i++) {
+        record_byte(w, data[i]);
+    }
+    record_end(w, (uint8_t)~w->sum);
+}
+
+/*
+ * Write [from, to) of the image as records straight from its pages.
+ * Each record is a run of written bytes; untouched pages and bytes
+ * never written are gaps and produce nothing.
+ */
+static bool write_records(Assembler *as, FILE *fp, OutputFormat format, uint64_t from, uint64_t to) {
+    RecordWriter w = { fp, as_malloc(TEXT_BUFFER_SIZE), 0, 0, false };
+    if (!w.text) return false;
+
+    int addr_bytes = to > 0x1000000 ? 4 : to > 0x10000 ? 3 : 2;
+    char data_type = (char)('1' + addr_bytes - 2);
+    uint32_t segment = 0;
+    if (format == OUTPUT_SREC) {
+        srec_record(&w, '0', 2, 0, NULL, 0);
     }
 
+    uint64_t addr = from;
+    while (addr < to) {
+        size_t index = (size_t)(addr >> OUTPUT_PAGE_BITS);
+        uint64_t page_end = ((uint64_t)index + 1) << OUTPUT_PAGE_BITS;
+        if (page_end > to) page_end = to;
+        const uint8_t *page = index < as->output_page_count ? as->output_pages[index] : NULL;
+        if (!page) {
+            addr = page_end;
+            continue;
+        }
+
+        size_t offset = (size_t)(addr & OUTPUT_PAGE_MASK);
+        size_t end = (size_t)(page_end - ((uint64_t)index << OUTPUT_PAGE_BITS));
+        while (offset < end) {
+            /* Skip the gap, eight unwritten bytes at a time where possible */
+            if (!byte_written(page, offset)) {
+                if ((offset & 7) == 0 && page[OUTPUT_PAGE_SIZE + (offset >> 3)] == 0) {
+                    offset += 8;
+                } else {
+                    offset++;
+                }
+                continue;
+            }
+            size_t len = 1;
+            while (len < RECORD_BYTES && offset + len < end && byte_written(page, offset + len)) {
+                len++;
+            }
+
+            uint64_t at = ((uint64_t)index << OUTPUT_PAGE_BITS) + offset;
+            const uint8_t *data = page + offset;
+            if (format == OUTPUT_IHEX) {
+                /* Pages are as large as a HEX segment: one 04 record each */
+                if ((uint32_t)(at >> 16) != segment) {
+                    segment = (uint32_t)(at >> 16);
+                    uint8_t upper[2] = { (uint8_t)(segment >> 8), (uint8_t)segment };
+                    ihex_record(&w, 0x04, 0, upper, 2);
+                }
+                ihex_record(&w, 0x00, (uint16_t)at, data, len);
+            } else {
+                srec_record(&w, data_type, addr_bytes, (uint32_t)at, data, len);
+            }
+            offset += len;
+        }
+        addr = page_end;
+    }
+
+    if (format == OUTPUT_IHEX) {
+        ihex_record(&w, 0x01, 0, NULL, 0);
+    } else {
+        srec_record(&w, (char)('9' - (addr_bytes - 2)), addr_bytes, 0, NULL, 0);
+    }
+    record_drain(&w);
+    free(w.text);
+    return !w.failed;
+}
+
+/* Write [from, to) of the image as raw bytes, a page at a time */
+static bool write_binary(Assembler *as, FILE *fp, uint64_t from, uint64_t to) {
+    uint8_t *blank = NULL;
+    bool ok = true;
+    uint64_t addr = from;
+    while (ok && addr < to) {
+        size_t index = (size_t)(addr >> OUTPUT_PAGE_BITS);
+        size_t offset = (size_t)(addr & OUTPUT_PAGE_MASK);
+        size_t chunk = OUTPUT_PAGE_SIZE - offset;
+        if (chunk > to - addr) chunk = (size_t)(to - addr);
+
+        const uint8_t *data = index < as->output_page_count ? as->output_pages[index] : NULL;
+        if (data) {
+            data += offset;
+        } else {
+            if (!blank) {
+                blank = as_malloc(OUTPUT_PAGE_SIZE);
+                if (!blank) return false;
+                memset(blank, 0xFF, OUTPUT_PAGE_SIZE);
+            }
+            data = blank;
+        }
+        ok = fwrite(data, 1, chunk, fp) == chunk;
+        addr += chunk;
+    }
+    free(blank);
+    return ok;
+}
+
+/* Default file extension for a format */
+const char *output_format_extension(OutputFormat format) {
+    switch (format) {
+        case OUTPUT_IHEX: return ".hex";
+        case OUTPUT_SREC: return ".srec";
+        default:          return ".rom";
+    }
+}
+
+/* Write [from, to) of the image to one file in the assembler's format */
+static bool write_file(Assembler *as, const char *filename, uint64_t from, uint64_t to) {
     FILE *fp = fopen(filename, "wb");
     if (!fp) {
-        fprintf(stderr, "Error: cannot open output file '%s'\n", filename);
+        diag_message(as, "Error: cannot open output file '%s'", filename);
         return false;
     }
 
-    size_t written = fwrite(as->output, 1, as->output_size, fp);
-    fclose(fp);
+    StatsPhase prev = stats_enter(as, PHASE_OUTPUT);
+    bool ok = as->output_format == OUTPUT_BINARY
+        ? write_binary(as, fp, from, to)
+        : write_records(as, fp, as->output_format, from, to);
+    if (fclose(fp) != 0) {
+        ok = false;
+    }
+    stats_leave(as, prev);
 
-    if (written != as->output_size) {
-        fprintf(stderr, "Error: failed to write all bytes to '%s'\n", filename);
+    if (!ok) {
+        diag_message(as, "Error: failed to write all bytes to '%s'", filename);
         return false;
     }
 
     if (as->verbose) {
-        printf("Wrote %zu bytes to %s (base address $%06X)\n",
-               as->output_size, filename, as->output_base);
+        printf("Wrote %llu bytes to %s (base address $%06llX)\n",
+               (unsigned long long)(to - from), filename, (unsigned long long)from);
     }
+    return true;
+}
 
+/*
+ * Write the output image to file.  With a bank size, the image is cut
+ * into banks of that size from its base address and bank n goes to the
+ * file name with ".n" before its extension (out.rom: out.0.rom, ...).
+ */
+bool assembler_write_output(Assembler *as, const char *filename) {
+    if (as->output_size == 0) {
+        diag_message(as, "Warning: no output generated");
+    }
+
+    uint64_t end = (uint64_t)as->output_base + as->output_size;
+    if (as->bank_size == 0) {
+        return write_file(as, filename, as->output_base, end);
+    }
+
+    const char *slash = strrchr(filename, '/');
+    const char *dot = strrchr(filename, '.');
+    size_t stem = (dot && (!slash || dot > slash)) ? (size_t)(dot - filename) : strlen(filename);
+    int bank = 0;
+    for (uint64_t from = as->output_base; from < end; from += as->bank_size, bank++) {
+        uint64_t to = from + as->bank_size < end ? from + as->bank_size : end;
+        char bank_file[1100];
+        snprintf(bank_file, sizeof(bank_file), "%.*s.%d%s", (int)stem, filename, bank, filename + stem);
+        if (!write_file(as, bank_file, from, to)) {
+            return false;
+        }
+    }
     return true;
 }
@@ -0,0 +1,344 @@
+/*
+ * TLCS-900 Assembler - Parallel Pass 2
+ *
+ * Once pass 1 has settled, every label has its final value and most of
+ * pass 2 is pure encoding: each instruction or data directive writes
+ * bytes that depend only on the symbol table and its own PC.  Pass 2
+ * therefore runs in two phases when more than one thread is requested.
+ *
+ * Phase A splits the recorded statements into chunks of such statements
+ * and has a pool of workers encode them.  A worker is a copy of the
+ * assembler whose output goes into a private capture, whose diagnostics
+ * go into a private buffer, and which never changes the shared symbol
+ * table.  Anything it can't do without changing shared state (defining
+ * a symbol, using a SET symbol) or that reports an error taints the
+ * chunk.  Each worker parses with its own lexer and macro contexts, and
+ * captures into an arena of its own, with room for the bytes pass 1
+ * laid out for the chunk, so encoding doesn't allocate per chunk.
+ *
+ * Phase B is the ordinary serial replay.  Reaching the first statement
+ * of an untainted chunk at the PC the chunk was encoded from, it writes
+ * the captured bytes, flushes the buffered warnings, defines the chunk's
+ * labels again and jumps past it.  Everything else, tainted chunks
+ * included, is replayed serially exactly as without workers, so the
+ * output and the diagnostics are the same for any thread count.
+ *
+ * Statements that change how later lines assemble (ORG, EQU, SET, macro
+ * calls, INCLUDE, ...) are chunk boundaries.  A source that switches
+ * MAXMODE is not split at all.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "../include/tlcs900.h"
+
+/* Statements per chunk; small enough to spread a file over the workers */
+#define CHUNK_STATEMENTS 256
+
+typedef struct {
+    size_t first;               /* First statement */
+    size_t end;                 /* One past the last statement */
+    uint32_t start_pc;          /* PC the chunk is encoded from */
+    uint32_t end_pc;            /* PC after it */
+    OutputCapture capture;
+    DiagList diags;
+    int warning_count;
+    bool tainted;               /* Must be replayed serially */
+} Chunk;
+
+typedef struct ParallelPass2 {
+    Chunk *chunks;
+    size_t chunk_count;
+    size_t chunk_capacity;
+    size_t cursor;              /* Next chunk phase B can take */
+
+    Assembler *as;              /* The serial assembler workers copy */
+    pthread_mutex_t lock;
+    Arena *arenas;              /* Chunk captures, one arena per worker */
+    int worker_count;
+    uint64_t allocations;       /* Heap allocations on the worker threads */
+    size_t next_chunk;          /* Next chunk a worker encodes */
+} ParallelPass2;
+
+/* Can a worker encode this statement without the serial pass? */
+static bool stmt_chunkable(Assembler *as, const Stmt *st) {
+    switch (st->kind) {
+        case STMT_LABEL: {
+            Symbol *sym = symbol_lookup_atom(as, st->name);
+            return sym && sym->type == SYM_LABEL && sym->defined && !sym->duplicate;
+        }
+        case STMT_INSN: {
+            /* A macro named like an instruction expands instead */
+            Symbol *sym = symbol_lookup_atom(as, st->name);
+            return !sym || sym->type != SYM_MACRO;
+        }
+        case STMT_LINE:
+            return st->directive == DIR_DB || st->directive == DIR_DW ||
+                   st->directive == DIR_DD || st->directive == DIR_DS ||
+                   st->directive == DIR_ALIGN;
+        default:
+            return false;
+    }
+}
+
+static void add_chunk(ParallelPass2 *par, size_t first, size_t end, uint32_t start_pc) {
+    if (par->chunk_count >= par->chunk_capacity) {
+        size_t new_capacity = par->chunk_capacity ? par->chunk_capacity * 2 : 64;
+        Chunk *chunks = as_realloc(par->chunks, new_capacity * sizeof(Chunk));
+        if (!chunks) {
+            fprintf(stderr, "Failed to allocate pass 2 chunks\n");
+            exit(1);
+        }
+        par->chunks = chunks;
+        par->chunk_capacity = new_capacity;
+    }
+    Chunk *chunk = &par->chunks[par->chunk_count++];
+    memset(chunk, 0, sizeof(*chunk));
+    chunk->first = first;
+    chunk->end = end;
+    chunk->start_pc = start_pc;
+}
+
+/* Split the statements into runs of chunkable ones */
+static void plan_chunks(Assembler *as, ParallelPass2 *par) {
+    for (size_t i = 0; i < as->ir.count; i++) {
+        const Stmt *st = &as->ir.stmts[i];
+        if (st->kind == STMT_LINE && st->directive == DIR_MAXMODE) {
+            par->chunk_count = 0;
+            return;
+        }
+    }
+
+    size_t i = 0;
+    while (i < as->ir.count) {
+        if (!stmt_chunkable(as, &as->ir.stmts[i])) {
+            i++;
+            continue;
+        }
+        size_t first = i;
+        while (i < as->ir.count && i - first < CHUNK_STATEMENTS &&
+               stmt_chunkable(as, &as->ir.stmts[i])) {
+            i++;
+        }
+        /* A lone label or two isn't worth a worker */
+        if (i - first > 2) {
+            add_chunk(par, first, i, as->ir.stmts[first].start_pc);
+        }
+    }
+}
+
+/* Encode one chunk on a worker's copy of the assembler */
+static void encode_chunk(Assembler *worker, Chunk *chunk, Arena *arena) {
+    size_t size = 0;
+    for (size_t i = chunk->first; i < chunk->end; i++) {
+        size += worker->ir.stmts[i].size;
+    }
+    output_capture_init(&chunk->capture, arena, size);
+
+    worker->pc = chunk->start_pc;
+    worker->output_capture = &chunk->capture;
+    worker->diag_list = &chunk->diags;
+    worker->errors = false;
+    worker->error_count = 0;
+    worker->warning_count = 0;
+    worker->worker_tainted = false;
+
+    ir_replay_range(worker, chunk->first, chunk->end);
+
+    chunk->end_pc = worker->pc;
+    chunk->warning_count = worker->warning_count;
+    /* Errors are rare and pass 2 reports them in order; leave them serial */
+    chunk->tainted = worker->worker_tainted || worker->error_count > 0;
+}
+
+static void *worker_main(void *arg) {
+    ParallelPass2 *par = arg;
+
+    /* Shares the symbol table, sources and statements; owns the rest */
+    Assembler worker = *par->as;
+    worker.parallel = NULL;
+    worker.cache = NULL;
+    worker.listing = NULL;
+    worker.cache_tracking = false;
+    worker.worker = true;
+    worker.stats.enabled = false;
+    worker.expr_arena = NULL;
+    memset(&worker.line_tokens, 0, sizeof(worker.line_tokens));
+    memset(&worker.lexer, 0, sizeof(worker.lexer));
+    memset(&worker.macro, 0, sizeof(worker.macro));
+    memset(&worker.diags, 0, sizeof(worker.diags));
+    arena_init(&worker.scratch);
+    arena_init(&worker.pass_arena);
+
+    pthread_mutex_lock(&par->lock);
+    Arena *arena = &par->arenas[par->worker_count++];
+    pthread_mutex_unlock(&par->lock);
+
+    for (;;) {
+        pthread_mutex_lock(&par->lock);
+        size_t index = par->next_chunk++;
+        pthread_mutex_unlock(&par->lock);
+        if (index >= par->chunk_count) break;
+        encode_chunk(&worker, &par->chunks[index], arena);
+    }
+
+    free(worker.line_tokens.tokens);
+    macro_context_free(&worker.macro);
+    arena_free(&worker.scratch);
+    arena_free(&worker.pass_arena);
+    return NULL;
+}
+
+/* A worker on its own thread; its allocations count towards pass 2 */
+static void *worker_thread(void *arg) {
+    ParallelPass2 *par = arg;
+    uint64_t allocations = alloc_count();
+    worker_main(par);
+    pthread_mutex_lock(&par->lock);
+    par->allocations += alloc_count() - allocations;
+    pthread_mutex_unlock(&par->lock);
+    return NULL;
+}
+
+/* Phase A: encode chunks of pass 2 ahead of the serial replay */
+void parallel_encode(Assembler *as) {
+    parallel_free(as);
+
+    ParallelPass2 *par = as_calloc(1, sizeof(ParallelPass2));
+    if (!par) {
+        fprintf(stderr, "Failed to allocate parallel pass 2\n");
+        exit(1);
+    }
+    par->as = as;
+    plan_chunks(as, par);
+    if (par->chunk_count == 0) {
+        free(par->chunks);
+        free(par);
+        return;
+    }
+
+    pthread_mutex_init(&par->lock, NULL);
+    int count = as->threads;
+    if ((size_t)count > par->chunk_count) count = (int)par->chunk_count;
+    par->arenas = as_calloc((size_t)count, sizeof(Arena));
+    if (!par->arenas) {
+        fprintf(stderr, "Failed to allocate parallel pass 2\n");
+        exit(1);
+    }
+
+    /* The calling thread is one of the workers */
+    pthread_t *threads = as_calloc((size_t)count, sizeof(pthread_t));
+    int started = 0;
+    for (int t = 0; threads && t < count - 1; t++) {
+        if (pthread_create(&threads[started], NULL, worker_thread, par) == 0) {
+            started++;
+        }
+    }
+    worker_main(par);
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+    pthread_mutex_destroy(&par->lock);
+    as->stats.pass2_allocations += par->allocations;
+
+    as->parallel = par;
+}
+
+/* Note the symbols a chunk uses, as its serial replay would */
+static void note_expr_refs(Assembler *as, const ExprCode *code) {
+    if (!code) return;
+    for (uint16_t i = 0; i < code->count; i++) {
+        if (code->insns[i].op == EXPR_SYMBOL || code->insns[i].op == EXPR_REF) {
+            symbol_lookup_atom(as, code->insns[i].atom);
+        }
+    }
+}
+
+static void note_chunk_refs(Assembler *as, const Chunk *chunk) {
+    for (size_t i = chunk->first; i < chunk->end; i++) {
+        const Stmt *st = &as->ir.stmts[i];
+        if (st->kind == STMT_INSN) {
+            for (int j = 0; j < st->operand_count; j++) {
+                note_expr_refs(as, st->operands[j].expr);
+            }
+        } else if (st->kind == STMT_LINE) {
+            for (int j = 0; j < st->token_count; j++) {
+                if (st->tokens[j].type == TOK_IDENTIFIER) {
+                    symbol_lookup_atom(as, st->tokens[j].atom);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Phase B: if a usable chunk starts at statement *index, take over its
+ * output and advance *index to its last statement.
+ */
+bool parallel_take(Assembler *as, size_t *index) {
+    ParallelPass2 *par = as->parallel;
+    while (par->cursor < par->chunk_count && par->chunks[par->cursor].first < *index) {
+        par->cursor++;
+    }
+    if (par->cursor >= par->chunk_count) return false;
+
+    Chunk *chunk = &par->chunks[par->cursor];
+    if (chunk->first != *index || chunk->tainted || chunk->start_pc != as->pc) {
+        return false;
+    }
+    par->cursor++;
+
+    /* Labels are defined again so the sweep sees them, as serially */
+    for (size_t i = chunk->first; i < chunk->end; i++) {
+        const Stmt *st = &as->ir.stmts[i];
+        if (st->kind != STMT_LABEL) continue;
+        as->current_file = st->file;
+        as->current_line = st->line;
+        symbol_define_atom(as, st->name, SYM_LABEL, symbol_lookup_atom(as, st->name)->value);
+    }
+    if (as->cache_tracking) {
+        note_chunk_refs(as, chunk);
+    }
+
+    /* The listing and comparison get the bytes statement by statement */
+    Listing *listing = as->listing;
+    Compare *compare = as->compare;
+    as->listing = NULL;
+    as->compare = NULL;
+    output_capture_replay(as, &chunk->capture);
+    as->listing = listing;
+    as->compare = compare;
+    for (size_t i = chunk->first; (listing || compare) && i < chunk->end; i++) {
+        const Stmt *st = &as->ir.stmts[i];
+        as->current_file = st->file;
+        as->current_line = st->line;
+        uint32_t end_pc = i + 1 < chunk->end ? as->ir.stmts[i + 1].start_pc : chunk->end_pc;
+        if (listing) listing_capture(as, &chunk->capture, st->start_pc, end_pc);
+        if (compare) compare_capture(as, &chunk->capture, st->start_pc, end_pc);
+    }
+    diag_flush(as, &chunk->diags);
+    as->warning_count += chunk->warning_count;
+    as->pc = chunk->end_pc;
+
+    *index = chunk->end - 1;
+    return true;
+}
+
+void parallel_free(Assembler *as) {
+    ParallelPass2 *par = as->parallel;
+    if (!par) return;
+    for (size_t i = 0; i < par->chunk_count; i++) {
+        output_capture_free(&par->chunks[i].capture);
+        diag_list_free(&par->chunks[i].diags);
+    }
+    for (int i = 0; i < par->worker_count; i++) {
+        arena_free(&par->arenas[i]);
+    }
+    free(par->arenas);
+    free(par->chunks);
+    free(par);
+    as->parallel = NULL;
+}
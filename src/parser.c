@@ -17,19 +17,18 @@
 #include "../include/tlcs900.h"
 
 /* External functions */
-extern bool handle_directive(Assembler *as, const char *directive, const char *label);
-extern bool encode_instruction(Assembler *as, const char *mnemonic, Operand *operands, int operand_count);
-extern bool symbol_get_value(Assembler *as, const char *name, int64_t *value);
 
 /* Macro functions */
-extern bool macro_is_collecting(void);
-extern bool macro_add_line(const char *line);
+extern bool macro_is_collecting(Assembler *as);
+extern bool macro_add_line(Assembler *as, const char *line);
 extern bool macro_try_expand(Assembler *as, const char *name, const char *args_str);
 
 /* Forward declarations */
-static bool is_register(const char *name, RegisterType *reg, OperandSize *size);
-static bool is_condition(const char *name, ConditionCode *cc);
+static bool is_register(const Keyword *kw, RegisterType *reg, OperandSize *size);
+static bool is_condition(const Keyword *kw, ConditionCode *cc);
 static bool parse_operand_internal(Assembler *as, Operand *op);
+static bool parse_statement(Assembler *as, const char *line, const LineToken *tokens,
+                            int count, bool record);
 
 /* Register name table */
 static const struct {
@@ -90,53 +89,89 @@ static const struct {
     {NULL, CC_F}
 };
 
-/* Check if a name is a register */
-static bool is_register(const char *name, RegisterType *reg, OperandSize *size) {
+/* Control register names (for LDC/STC) */
+static const char *ctrl_regs[] = {
+    "DMAS0", "DMAS1", "DMAS2", "DMAS3",
+    "DMAD0", "DMAD1", "DMAD2", "DMAD3",
+    "DMAC0", "DMAC1", "DMAC2", "DMAC3",
+    "DMAM0", "DMAM1", "DMAM2", "DMAM3",
+    "INTNEST",
+    NULL
+};
+
+/* Add register, condition code and control register names to the keyword table */
+void parser_register_keywords(void) {
     for (int i = 0; register_table[i].name; i++) {
-        if (strcasecmp(name, register_table[i].name) == 0) {
-            if (reg) *reg = register_table[i].reg;
-            if (size) *size = register_table[i].size;
-            return true;
-        }
+        keyword_add_operand(register_table[i].name, KW_REGISTER,
+                            register_table[i].reg, register_table[i].size);
     }
-    return false;
-}
-
-/* Check if a name is a condition code */
-static bool is_condition(const char *name, ConditionCode *cc) {
     for (int i = 0; condition_table[i].name; i++) {
-        if (strcasecmp(name, condition_table[i].name) == 0) {
-            if (cc) *cc = condition_table[i].cc;
-            return true;
-        }
+        keyword_add_operand(condition_table[i].name, KW_CONDITION, condition_table[i].cc, 0);
     }
-    return false;
-}
-
-/* Check if a name is a control register (for LDC/STC) */
-static bool is_control_register(const char *name) {
-    static const char *ctrl_regs[] = {
-        "DMAS0", "DMAS1", "DMAS2", "DMAS3",
-        "DMAD0", "DMAD1", "DMAD2", "DMAD3",
-        "DMAC0", "DMAC1", "DMAC2", "DMAC3",
-        "DMAM0", "DMAM1", "DMAM2", "DMAM3",
-        "INTNEST",
-        NULL
-    };
     for (int i = 0; ctrl_regs[i]; i++) {
-        if (strcasecmp(name, ctrl_regs[i]) == 0) return true;
+        keyword_add_operand(ctrl_regs[i], KW_CTRL_REG, 0, 0);
     }
-    return false;
+}
+
+/* Classify an identifier token with one keyword lookup (NULL if plain name) */
+static const Keyword *classify(Assembler *as, const Token *tok) {
+    if (tok->type != TOK_IDENTIFIER) return NULL;
+    return keyword_find(tok->text, as->strings.atoms[tok->atom]->hash);
+}
+
+/* Check if a keyword is a register */
+static bool is_register(const Keyword *kw, RegisterType *reg, OperandSize *size) {
+    if (!kw || !(kw->operand & KW_REGISTER)) return false;
+    if (reg) *reg = (RegisterType)kw->reg;
+    if (size) *size = (OperandSize)kw->size;
+    return true;
+}
+
+/* Check if a keyword is a condition code */
+static bool is_condition(const Keyword *kw, ConditionCode *cc) {
+    if (!kw || !(kw->operand & KW_CONDITION)) return false;
+    if (cc) *cc = (ConditionCode)kw->cc;
+    return true;
+}
+
+/* Check if a keyword is a control register (for LDC/STC) */
+static bool is_control_register(const Keyword *kw) {
+    return kw && (kw->operand & KW_CTRL_REG);
+}
+
+/* Check if an identifier names a defined symbol */
+static bool atom_is_defined_symbol(Assembler *as, uint32_t atom) {
+    Symbol *sym = symbol_lookup_atom(as, atom);
+    return sym && sym->defined;
+}
+
+/* Check if a name is a register (used to validate statement replay) */
+bool is_register_name(const char *name) {
+    return is_register(keyword_lookup(name), NULL, NULL);
+}
+
+/* Parse an operand value expression, keeping its code for re-evaluation */
+static bool parse_operand_value(Assembler *as, Operand *op, bool negate) {
+    Arena *arena = as->expr_arena ? as->expr_arena : &as->scratch;
+    ExprNode *tree = expr_parse_tree(as, &as->scratch);
+    if (!tree) return false;
+    if (negate) tree = expr_negate(&as->scratch, tree);
+    op->expr = expr_compile(as, arena, tree);
+    if (!op->expr) return false;
+    return expr_eval(as, op->expr, &op->value, &op->value_known, &op->is_constant);
 }
 
 /* Parse a single operand */
 bool parse_operand(Assembler *as, Operand *op) {
     memset(op, 0, sizeof(*op));
-    return parse_operand_internal(as, op);
+    StatsPhase prev = stats_enter(as, PHASE_OPERANDS);
+    bool ok = parse_operand_internal(as, op);
+    stats_leave(as, prev);
+    return ok;
 }
 
 static bool parse_operand_internal(Assembler *as, Operand *op) {
-    Token tok = lexer_peek();
+    Token tok = lexer_peek(&as->lexer);
 
     /* Empty operand */
     if (tok.type == TOK_NEWLINE || tok.type == TOK_EOF || tok.type == TOK_COMMA) {
@@ -145,30 +180,27 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
 
     /* Parenthesized addressing mode */
     if (tok.type == TOK_LPAREN) {
-        lexer_next();  /* consume ( */
+        lexer_next(&as->lexer);  /* consume ( */
 
-        tok = lexer_peek();
+        tok = lexer_peek(&as->lexer);
 
         /* Check for register-based addressing */
         if (tok.type == TOK_IDENTIFIER) {
             RegisterType reg;
             OperandSize size;
 
-            /* Check if this identifier is defined as a symbol - if so, treat as address not register */
-            int64_t sym_val;
-            bool is_defined_symbol = symbol_get_value(as, tok.text, &sym_val);
-
-            if (!is_defined_symbol && is_register(tok.text, &reg, &size)) {
-                lexer_next();  /* consume register */
+            /* A register name defined as a symbol is an address, not a register */
+            if (is_register(classify(as, &tok), &reg, &size) && !atom_is_defined_symbol(as, tok.atom)) {
+                lexer_next(&as->lexer);  /* consume register */
 
-                tok = lexer_peek();
+                tok = lexer_peek(&as->lexer);
 
                 /* (reg+) - post-increment */
                 if (tok.type == TOK_PLUS) {
-                    lexer_next();
-                    tok = lexer_peek();
+                    lexer_next(&as->lexer);
+                    tok = lexer_peek(&as->lexer);
                     if (tok.type == TOK_RPAREN) {
-                        lexer_next();
+                        lexer_next(&as->lexer);
                         op->mode = ADDR_REGISTER_IND_INC;
                         op->reg = reg;
                         op->size = size;
@@ -176,44 +208,39 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
                     }
                     /* (reg + offset) or (reg + reg) - indexed */
                     /* Check if the offset is a register */
-                    tok = lexer_peek();
+                    tok = lexer_peek(&as->lexer);
                     RegisterType idx_reg;
                     OperandSize idx_size;
-                    if (tok.type == TOK_IDENTIFIER && is_register(tok.text, &idx_reg, &idx_size)) {
+                    if (is_register(classify(as, &tok), &idx_reg, &idx_size)) {
                         /* (reg + reg) - register indexed */
-                        lexer_next();
+                        lexer_next(&as->lexer);
                         op->index_reg = idx_reg;
                         op->value = 0;
                         op->value_known = true;
                     } else {
                         /* (reg + expr) - displacement indexed */
-                        int64_t offset;
-                        bool known, is_const;
-                        if (!expr_parse(as, &offset, &known, &is_const)) {
+                        if (!parse_operand_value(as, op, false)) {
                             error(as, "invalid indexed offset");
                             return false;
                         }
-                        op->value = offset;
-                        op->value_known = known;
-                        op->is_constant = is_const;
                         op->index_reg = REG_NONE;
                     }
-                    tok = lexer_peek();
+                    tok = lexer_peek(&as->lexer);
                     /* Check for :8/:16/:24 size suffix inside parentheses */
                     if (tok.type == TOK_COLON) {
-                        lexer_next();
-                        tok = lexer_peek();
+                        lexer_next(&as->lexer);
+                        tok = lexer_peek(&as->lexer);
                         if (tok.type == TOK_NUMBER) {
-                            lexer_next();
+                            lexer_next(&as->lexer);
                             op->addr_size = (int)tok.value;
                         }
-                        tok = lexer_peek();
+                        tok = lexer_peek(&as->lexer);
                     }
                     if (tok.type != TOK_RPAREN) {
                         error(as, "expected ')' after indexed addressing");
                         return false;
                     }
-                    lexer_next();
+                    lexer_next(&as->lexer);
                     op->mode = ADDR_INDEXED;
                     op->reg = reg;
                     op->size = size;
@@ -222,32 +249,27 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
 
                 /* (reg - offset) - indexed with negative */
                 if (tok.type == TOK_MINUS) {
-                    lexer_next();
-                    int64_t offset;
-                    bool known, is_const;
-                    if (!expr_parse(as, &offset, &known, &is_const)) {
+                    lexer_next(&as->lexer);
+                    if (!parse_operand_value(as, op, true)) {
                         error(as, "invalid indexed offset");
                         return false;
                     }
-                    op->value = -offset;
-                    op->value_known = known;
-                    op->is_constant = is_const;
-                    tok = lexer_peek();
+                    tok = lexer_peek(&as->lexer);
                     /* Check for :8/:16/:24 size suffix inside parentheses */
                     if (tok.type == TOK_COLON) {
-                        lexer_next();
-                        tok = lexer_peek();
+                        lexer_next(&as->lexer);
+                        tok = lexer_peek(&as->lexer);
                         if (tok.type == TOK_NUMBER) {
-                            lexer_next();
+                            lexer_next(&as->lexer);
                             op->addr_size = (int)tok.value;
                         }
-                        tok = lexer_peek();
+                        tok = lexer_peek(&as->lexer);
                     }
                     if (tok.type != TOK_RPAREN) {
                         error(as, "expected ')' after indexed addressing");
                         return false;
                     }
-                    lexer_next();
+                    lexer_next(&as->lexer);
                     op->mode = ADDR_INDEXED;
                     op->reg = reg;
                     op->size = size;
@@ -256,7 +278,7 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
 
                 /* (reg) - simple indirect */
                 if (tok.type == TOK_RPAREN) {
-                    lexer_next();
+                    lexer_next(&as->lexer);
                     op->mode = ADDR_REGISTER_IND;
                     op->reg = reg;
                     op->size = size;
@@ -270,16 +292,16 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
 
         /* (-reg) - pre-decrement */
         if (tok.type == TOK_MINUS) {
-            lexer_next();
-            tok = lexer_peek();
+            lexer_next(&as->lexer);
+            tok = lexer_peek(&as->lexer);
             if (tok.type == TOK_IDENTIFIER) {
                 RegisterType reg;
                 OperandSize size;
-                if (is_register(tok.text, &reg, &size)) {
-                    lexer_next();
-                    tok = lexer_peek();
+                if (is_register(classify(as, &tok), &reg, &size)) {
+                    lexer_next(&as->lexer);
+                    tok = lexer_peek(&as->lexer);
                     if (tok.type == TOK_RPAREN) {
-                        lexer_next();
+                        lexer_next(&as->lexer);
                         op->mode = ADDR_REGISTER_IND_DEC;
                         op->reg = reg;
                         op->size = size;
@@ -292,32 +314,27 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
         }
 
         /* (expression) - direct memory addressing */
-        int64_t addr;
-        bool known, is_const;
-        if (!expr_parse(as, &addr, &known, &is_const)) {
+        if (!parse_operand_value(as, op, false)) {
             error(as, "invalid address expression");
             return false;
         }
-        op->value = addr;
-        op->value_known = known;
-        op->is_constant = is_const;
 
-        tok = lexer_peek();
+        tok = lexer_peek(&as->lexer);
         /* Check for :8/:16/:24 size suffix inside parentheses */
         if (tok.type == TOK_COLON) {
-            lexer_next();
-            tok = lexer_peek();
+            lexer_next(&as->lexer);
+            tok = lexer_peek(&as->lexer);
             if (tok.type == TOK_NUMBER) {
                 op->addr_size = (int)tok.value;
-                lexer_next();
+                lexer_next(&as->lexer);
             }
-            tok = lexer_peek();
+            tok = lexer_peek(&as->lexer);
         }
         if (tok.type != TOK_RPAREN) {
             error(as, "expected ')' after address");
             return false;
         }
-        lexer_next();
+        lexer_next(&as->lexer);
         op->mode = ADDR_DIRECT;
         goto check_addr_size;
     }
@@ -328,8 +345,9 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
         OperandSize size;
         ConditionCode cc;
 
-        bool is_reg = is_register(tok.text, &reg, &size);
-        bool is_cc = is_condition(tok.text, &cc);
+        const Keyword *kw = classify(as, &tok);
+        bool is_reg = is_register(kw, &reg, &size);
+        bool is_cc = is_condition(kw, &cc);
 
         /* If both register and condition code, look ahead to disambiguate */
         /* JR C, label - C is condition, second operand is immediate/label */
@@ -337,26 +355,25 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
         if (is_reg && is_cc) {
             /* Save state before lookahead */
             LexerState saved;
-            lexer_save_state(&saved);
+            lexer_save_state(&as->lexer, &saved);
 
-            lexer_next();  /* consume the identifier (C, Z, etc.) */
-            Token next = lexer_peek();
+            lexer_next(&as->lexer);  /* consume the identifier (C, Z, etc.) */
+            Token next = lexer_peek(&as->lexer);
             if (next.type == TOK_COMMA) {
                 /* Look ahead past the comma */
-                lexer_next();  /* consume comma */
-                Token after_comma = lexer_peek();
+                lexer_next(&as->lexer);  /* consume comma */
+                Token after_comma = lexer_peek(&as->lexer);
 
                 /* Restore to just after the identifier */
-                lexer_restore_state(&saved);
-                lexer_next();  /* re-consume identifier */
+                lexer_restore_state(&as->lexer, &saved);
+                lexer_next(&as->lexer);  /* re-consume identifier */
 
                 /* If next operand starts with (, #, $, number, or is a register, treat as register */
                 if (after_comma.type == TOK_LPAREN ||
                     after_comma.type == TOK_HASH ||
                     after_comma.type == TOK_DOLLAR ||
                     after_comma.type == TOK_NUMBER ||
-                    (after_comma.type == TOK_IDENTIFIER &&
-                     is_register(after_comma.text, NULL, NULL))) {
+                    is_register(classify(as, &after_comma), NULL, NULL)) {
                     op->mode = ADDR_REGISTER;
                     op->reg = reg;
                     op->size = size;
@@ -375,17 +392,17 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
         }
 
         if (is_reg) {
-            lexer_next();
+            lexer_next(&as->lexer);
             /* Check for reg + reg/disp pattern (implicit indexed) */
-            tok = lexer_peek();
+            tok = lexer_peek(&as->lexer);
             if (tok.type == TOK_PLUS) {
-                lexer_next();  /* consume + */
-                tok = lexer_peek();
+                lexer_next(&as->lexer);  /* consume + */
+                tok = lexer_peek(&as->lexer);
                 /* Check if it's a register */
                 RegisterType idx_reg;
                 OperandSize idx_size;
-                if (tok.type == TOK_IDENTIFIER && is_register(tok.text, &idx_reg, &idx_size)) {
-                    lexer_next();  /* consume index register */
+                if (is_register(classify(as, &tok), &idx_reg, &idx_size)) {
+                    lexer_next(&as->lexer);  /* consume index register */
                     op->mode = ADDR_INDEXED;
                     op->reg = reg;
                     op->size = size;
@@ -395,18 +412,13 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
                     return true;
                 }
                 /* Otherwise it's reg + displacement */
-                int64_t offset;
-                bool known, is_const;
-                if (!expr_parse(as, &offset, &known, &is_const)) {
+                if (!parse_operand_value(as, op, false)) {
                     error(as, "invalid displacement after register");
                     return false;
                 }
                 op->mode = ADDR_INDEXED;
                 op->reg = reg;
                 op->size = size;
-                op->value = offset;
-                op->value_known = known;
-                op->is_constant = is_const;
                 op->index_reg = REG_NONE;
                 return true;
             }
@@ -418,7 +430,7 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
 
         /* Check for condition code */
         if (is_cc) {
-            lexer_next();
+            lexer_next(&as->lexer);
             op->mode = ADDR_CONDITION;
             op->value = cc;
             return true;
@@ -428,49 +440,60 @@ static bool parse_operand_internal(Assembler *as, Operand *op) {
     /* Must be an immediate or symbol */
     /* Skip optional # prefix */
     if (tok.type == TOK_HASH) {
-        lexer_next();
-        tok = lexer_peek();
+        lexer_next(&as->lexer);
+        tok = lexer_peek(&as->lexer);
     }
 
     /* Check for control register names (for LDC/STC) before expression parsing */
-    if (tok.type == TOK_IDENTIFIER && is_control_register(tok.text)) {
-        lexer_next();
+    if (is_control_register(classify(as, &tok))) {
+        lexer_next(&as->lexer);
         op->mode = ADDR_IMMEDIATE;
-        strncpy(op->symbol, tok.text, MAX_IDENTIFIER - 1);
+        op->symbol = tok.atom;
         op->value = 0;
         op->value_known = false;
         return true;
     }
 
-    int64_t value;
-    bool known, is_const;
-    if (!expr_parse(as, &value, &known, &is_const)) {
+    if (!parse_operand_value(as, op, false)) {
         error(as, "invalid operand");
         return false;
     }
 
     op->mode = ADDR_IMMEDIATE;
-    op->value = value;
-    op->value_known = known;
-    op->is_constant = is_const;
     return true;
 
 check_addr_size:
     /* Check for :8, :16, :24 size suffix */
-    tok = lexer_peek();
+    tok = lexer_peek(&as->lexer);
     if (tok.type == TOK_COLON) {
-        lexer_next();
-        tok = lexer_peek();
+        lexer_next(&as->lexer);
+        tok = lexer_peek(&as->lexer);
         if (tok.type == TOK_NUMBER) {
-            lexer_next();
+            lexer_next(&as->lexer);
             op->addr_size = (int)tok.value;
         }
     }
     return true;
 }
 
-/* Parse a line of assembly */
+/* Parse a line of assembly that has no cached tokens (macro expansions) */
 bool parse_line(Assembler *as, const char *line) {
+    /* Skip empty lines and comment-only lines before tokenizing */
+    const char *p = line;
+    while (*p == ' ' || *p == '\t') p++;
+    if (*p == '\0' || *p == ';' || *p == '\n') {
+        return true;
+    }
+
+    as->line_tokens.count = 0;
+    StatsPhase prev = stats_enter(as, PHASE_LEX);
+    int count = lexer_tokenize(&as->strings, line, &as->line_tokens);
+    stats_leave(as, prev);
+    return parse_line_tokens(as, line, as->line_tokens.tokens, count);
+}
+
+/* Parse a line of assembly from its raw text and pre-scanned tokens */
+bool parse_line_tokens(Assembler *as, const char *line, const LineToken *tokens, int count) {
     /* Skip empty lines and comment-only lines */
     const char *p = line;
     while (*p == ' ' || *p == '\t') p++;
@@ -479,7 +502,7 @@ bool parse_line(Assembler *as, const char *line) {
     }
 
     /* If collecting a macro definition, add lines to it */
-    if (macro_is_collecting()) {
+    if (macro_is_collecting(as)) {
         /* Check for ENDM first */
         const char *check = p;
         while (*check == ' ' || *check == '\t') check++;
@@ -490,33 +513,50 @@ bool parse_line(Assembler *as, const char *line) {
                 /* Fall through to normal parsing */
             } else {
                 /* Part of macro body */
-                macro_add_line(line);
+                macro_add_line(as, line);
                 return true;
             }
         } else {
             /* Add to macro body */
-            macro_add_line(line);
+            macro_add_line(as, line);
             return true;
         }
     }
 
-    /* Initialize lexer with this line */
-    lexer_init(line);
-    lexer_set_line(as->current_line);
+    /* Operand code is kept with the statement when the line is recorded */
+    bool record = ir_is_recording(as);
+    Arena *prev_arena = as->expr_arena;
+    ArenaMark mark = arena_mark(&as->scratch);
+    as->expr_arena = record ? &as->ir.arena : &as->scratch;
 
-    Token tok = lexer_next();
+    bool result = parse_statement(as, line, tokens, count, record);
+
+    as->expr_arena = prev_arena;
+    arena_release(&as->scratch, mark);
+    return result;
+}
+
+/* Parse one statement from the current line's tokens */
+static bool parse_statement(Assembler *as, const char *line, const LineToken *tokens,
+                            int count, bool record) {
+    /* Replay this line's tokens */
+    lexer_init_tokens(&as->lexer, &as->strings, tokens, count);
+    lexer_set_line(&as->lexer, as->current_line);
+
+    Token tok = lexer_next(&as->lexer);
     char label[MAX_IDENTIFIER] = "";
     char mnemonic[MAX_IDENTIFIER] = "";
+    uint32_t mnemonic_atom = 0;
 
     /* Check for label (identifier followed by colon, or identifier at column 1) */
     if (tok.type == TOK_IDENTIFIER) {
-        Token next = lexer_peek();
+        Token next = lexer_peek(&as->lexer);
 
         if (next.type == TOK_COLON) {
             /* Label with colon */
             strncpy(label, tok.text, MAX_IDENTIFIER - 1);
-            lexer_next();  /* consume colon */
-            tok = lexer_next();  /* get next token */
+            lexer_next(&as->lexer);  /* consume colon */
+            tok = lexer_next(&as->lexer);  /* get next token */
         } else if (line[0] != ' ' && line[0] != '\t') {
             /* Identifier at column 1 without colon */
             /* Check if next token is MACRO, EQU, SET, = (label-requiring directives) */
@@ -526,18 +566,21 @@ bool parse_line(Assembler *as, const char *line) {
                  strcasecmp(next.text, "SET") == 0)) {
                 /* This is a label followed by a directive */
                 strncpy(label, tok.text, MAX_IDENTIFIER - 1);
-                tok = lexer_next();  /* get the directive */
+                tok = lexer_next(&as->lexer);  /* get the directive */
                 strncpy(mnemonic, tok.text, MAX_IDENTIFIER - 1);
+                mnemonic_atom = tok.atom;
             } else if (next.type == TOK_EQUALS) {
                 /* label = value syntax */
                 strncpy(label, tok.text, MAX_IDENTIFIER - 1);
-                tok = lexer_next();  /* get the = */
+                tok = lexer_next(&as->lexer);  /* get the = */
             } else {
                 /* Treat as mnemonic */
                 strncpy(mnemonic, tok.text, MAX_IDENTIFIER - 1);
+                mnemonic_atom = tok.atom;
             }
         } else {
             strncpy(mnemonic, tok.text, MAX_IDENTIFIER - 1);
+            mnemonic_atom = tok.atom;
         }
     }
 
@@ -545,9 +588,11 @@ bool parse_line(Assembler *as, const char *line) {
     if (label[0] && !mnemonic[0]) {
         if (tok.type == TOK_IDENTIFIER) {
             strncpy(mnemonic, tok.text, MAX_IDENTIFIER - 1);
+            mnemonic_atom = tok.atom;
         } else if (tok.type == TOK_NEWLINE || tok.type == TOK_EOF) {
             /* Label only - define it */
             symbol_define(as, label, SYM_LABEL, as->pc);
+            if (record) ir_record_label(as, label);
             return true;
         }
     }
@@ -556,13 +601,36 @@ bool parse_line(Assembler *as, const char *line) {
     if (tok.type == TOK_NEWLINE || tok.type == TOK_EOF) {
         if (label[0]) {
             symbol_define(as, label, SYM_LABEL, as->pc);
+            if (record) ir_record_label(as, label);
         }
         return true;
     }
 
     /* Check for directive first (MACRO, EQU, SET handle their own symbol definition) */
-    if (mnemonic[0] && handle_directive(as, mnemonic, label)) {
-        return true;
+    const Keyword *kw = NULL;
+    if (mnemonic[0]) {
+        kw = keyword_find(mnemonic, as->strings.atoms[mnemonic_atom]->hash);
+    }
+    if (kw && kw->directive != DIR_NONE) {
+        bool is_include = kw->directive == DIR_INCLUDE;
+        bool is_macro = kw->directive == DIR_MACRO;
+        bool is_endm = kw->directive == DIR_ENDM;
+
+        /* Replay keeps the last body, so redefinitions need the parser */
+        if (record && is_macro && label[0]) {
+            Symbol *sym = symbol_lookup(as, label);
+            if (sym && sym->type == SYM_MACRO) {
+                ir_invalidate(as);
+            }
+        }
+
+        if (handle_directive_id(as, (DirectiveId)kw->directive, label)) {
+            /* Included lines record themselves; macro bodies are not replayed */
+            if (record && !is_include && !is_macro && !is_endm) {
+                ir_record_line(as, (DirectiveId)kw->directive, line, tokens, count);
+            }
+            return true;
+        }
     }
 
     /* Define label if present (and not handled by a directive) */
@@ -571,21 +639,22 @@ bool parse_line(Assembler *as, const char *line) {
     }
 
     /* Check for = (alternate EQU syntax) */
-    if (tok.type == TOK_EQUALS || (lexer_peek().type == TOK_EQUALS && label[0])) {
+    if (tok.type == TOK_EQUALS || (lexer_peek(&as->lexer).type == TOK_EQUALS && label[0])) {
         if (tok.type == TOK_EQUALS) {
-            lexer_next();
-        } else if (lexer_peek().type == TOK_EQUALS) {
-            lexer_next();
+            lexer_next(&as->lexer);
+        } else if (lexer_peek(&as->lexer).type == TOK_EQUALS) {
+            lexer_next(&as->lexer);
         }
         int64_t value;
-        bool known, is_const;
-        if (!expr_parse(as, &value, &known, &is_const)) {
+        bool known, is_const, folded;
+        if (!expr_parse_folded(as, &value, &known, &is_const, &folded)) {
             error(as, "invalid expression after =");
             return false;
         }
         if (label[0]) {
-            symbol_define(as, label, SYM_EQU, value);
+            symbol_define_fixed(as, label, value, folded);
         }
+        if (record) ir_record_line(as, DIR_NONE, line, tokens, count);
         return true;
     }
 
@@ -600,7 +669,7 @@ bool parse_line(Assembler *as, const char *line) {
     int operand_count = 0;
 
     while (operand_count < MAX_OPERANDS) {
-        Token peek = lexer_peek();
+        Token peek = lexer_peek(&as->lexer);
         if (peek.type == TOK_NEWLINE || peek.type == TOK_EOF) {
             break;
         }
@@ -610,19 +679,46 @@ bool parse_line(Assembler *as, const char *line) {
         }
         operand_count++;
 
-        peek = lexer_peek();
+        peek = lexer_peek(&as->lexer);
         if (peek.type == TOK_COMMA) {
-            lexer_next();  /* consume comma */
+            lexer_next(&as->lexer);  /* consume comma */
         } else {
             break;
         }
     }
 
     /* Try to encode as an instruction first */
-    if (encode_instruction(as, mnemonic, operands, operand_count)) {
+    EncoderFunc encoder = kw ? kw->encoder : NULL;
+    uint32_t start_pc = as->pc;
+    StatsPhase prev = stats_enter(as, PHASE_ENCODE);
+    bool encoded = encoder && encoder(as, operands, operand_count);
+    stats_leave(as, prev);
+    if (encoded) {
+        if (record) {
+            if (label[0]) ir_record_label(as, label);
+            ir_record_insn(as, mnemonic, encoder, operands, operand_count, label[0] != '\0',
+                           as->pc - start_pc, line, tokens, count);
+        }
         return true;
     }
 
+    bool bare_label = false;
+    if (!parse_unencoded(as, mnemonic, label[0] != '\0', operands, operand_count, &bare_label)) {
+        return false;
+    }
+    if (record) {
+        if (bare_label) {
+            ir_record_label(as, mnemonic);
+        } else {
+            ir_record_line(as, DIR_NONE, line, tokens, count);
+        }
+    }
+    return true;
+}
+
+/* Handle a mnemonic no encoder accepted: macro call, bare label or error */
+bool parse_unencoded(Assembler *as, const char *mnemonic, bool has_label,
+                     Operand *operands, int operand_count, bool *bare_label) {
     /* Not a known instruction - try macro expansion */
     /* Build the argument string from the rest of the line */
     char args_str[MAX_LINE_LENGTH] = "";
@@ -637,8 +733,8 @@ bool parse_line(Assembler *as, const char *line) {
         if (operands[i].mode == ADDR_IMMEDIATE) {
             if (operands[i].value_known) {
                 snprintf(op_str, sizeof(op_str), "%ld", (long)operands[i].value);
-            } else if (operands[i].symbol[0]) {
-                strncpy(op_str, operands[i].symbol, sizeof(op_str) - 1);
+            } else if (operands[i].symbol) {
+                strncpy(op_str, strpool_text(&as->strings, operands[i].symbol), sizeof(op_str) - 1);
             }
         } else if (operands[i].mode == ADDR_REGISTER) {
             /* Get register name from code */
@@ -657,13 +753,16 @@ bool parse_line(Assembler *as, const char *line) {
     }
     args_str[args_pos] = '\0';
 
-    if (macro_try_expand(as, mnemonic, args_str)) {
+    as->ir.suspend++;
+    bool expanded = macro_try_expand(as, mnemonic, args_str);
+    as->ir.suspend--;
+    if (expanded) {
         return true;
     }
 
     /* If no operands and looks like a label (at start of line, no label yet),
        treat as a label without colon - common in some assembler output */
-    if (operand_count == 0 && !label[0]) {
+    if (operand_count == 0 && !has_label) {
         /* Check if this could be a label - must not contain special chars */
         bool looks_like_label = true;
         for (const char *p = mnemonic; *p && looks_like_label; p++) {
@@ -673,6 +772,7 @@ bool parse_line(Assembler *as, const char *line) {
         }
         if (looks_like_label) {
             symbol_define(as, mnemonic, SYM_LABEL, as->pc);
+            *bare_label = true;
             return true;
         }
     }
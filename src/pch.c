@@ -0,0 +1,358 @@
+/*
+ * TLCS-900 Assembler - Precompiled Headers
+ *
+ * A header that only defines constants and macros (the I/O register
+ * files every program includes) assembles to nothing but symbols.
+ * --emit-pch assembles such a header on its own and writes what it
+ * defined to HEADER.pch:
+ *
+ *   - the header's content hash
+ *   - every EQU and SET symbol, with its final value and definition line
+ *   - every macro, with its parameters and body lines
+ *
+ * When an INCLUDE reaches a file whose .pch is present and was made from
+ * the same content, the assembler defines the recorded symbols and
+ * macros instead of parsing the file.  Macro bodies are compiled again
+ * on load, since compiled lines refer to the string pool of the
+ * assembler that made them.
+ *
+ * Only headers whose meaning can't depend on where they are included
+ * are precompiled: no labels, no code or data, no use of $, no symbols
+ * or files from elsewhere.  An unsuitable header is refused when the
+ * .pch would be written, not when it is used.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+extern Symbol *macro_define(Assembler *as, const char *name, char **params, int param_count,
+                            char **body, int body_count);
+
+#define PCH_MAGIC "T900PCH\0"
+#define PCH_VERSION 1
+
+typedef struct {
+    char *name;
+    uint8_t type;               /* SYM_EQU or SYM_SET */
+    int64_t value;
+    int line;
+} PchSymbol;
+
+typedef struct {
+    char *name;
+    int line;
+    char **params;
+    uint32_t param_count;
+    char **body;
+    uint32_t body_count;
+} PchMacro;
+
+/* A header's .pch as loaded; present is false when there is none */
+typedef struct PchFile {
+    char *path;                 /* The header's resolved path */
+    bool present;
+    bool reported;              /* Verbose mode said it is used */
+    uint64_t hash;
+    PchSymbol *symbols;
+    size_t symbol_count;
+    PchMacro *macros;
+    size_t macro_count;
+    struct PchFile *next;
+} PchFile;
+
+/* Release what was loaded, keeping the path */
+static void pch_clear(PchFile *pch) {
+    for (size_t i = 0; i < pch->symbol_count; i++) {
+        free(pch->symbols[i].name);
+    }
+    free(pch->symbols);
+    for (size_t i = 0; i < pch->macro_count; i++) {
+        PchMacro *m = &pch->macros[i];
+        for (uint32_t j = 0; j < m->param_count; j++) free(m->params[j]);
+        for (uint32_t j = 0; j < m->body_count; j++) free(m->body[j]);
+        free(m->params);
+        free(m->body);
+        free(m->name);
+    }
+    free(pch->macros);
+    pch->symbols = NULL;
+    pch->symbol_count = 0;
+    pch->macros = NULL;
+    pch->macro_count = 0;
+    pch->present = false;
+}
+
+void pch_free(Assembler *as) {
+    PchFile *pch = as->pch;
+    while (pch) {
+        PchFile *next = pch->next;
+        pch_clear(pch);
+        free(pch->path);
+        free(pch);
+        pch = next;
+    }
+    as->pch = NULL;
+}
+
+/* ---- Reading ---- */
+
+static char **read_strings(BinReader *r, uint32_t *count) {
+    *count = (uint32_t)bin_read_count(r, 4);
+    char **strings = *count ? as_calloc(*count, sizeof(char *)) : NULL;
+    for (uint32_t i = 0; i < *count && r->ok; i++) {
+        strings[i] = bin_read_string(r);
+    }
+    return strings;
+}
+
+/* Load path.pch into pch; a missing, truncated or foreign file is ignored */
+static void pch_read(PchFile *pch) {
+    char pch_path[1100];
+    snprintf(pch_path, sizeof(pch_path), "%s.pch", pch->path);
+
+    BinReader r;
+    if (!bin_load(pch_path, &r)) return;
+    uint8_t *data = (uint8_t *)r.data;
+
+    char magic[8];
+    bin_read_bytes(&r, magic, sizeof(magic));
+    if (!r.ok || memcmp(magic, PCH_MAGIC, sizeof(magic)) != 0 || bin_read_u32(&r) != PCH_VERSION) {
+        free(data);
+        return;
+    }
+    pch->hash = bin_read_u64(&r);
+
+    pch->symbol_count = bin_read_count(&r, 17);
+    pch->symbols = pch->symbol_count ? as_calloc(pch->symbol_count, sizeof(PchSymbol)) : NULL;
+    for (size_t i = 0; i < pch->symbol_count && r.ok; i++) {
+        PchSymbol *ps = &pch->symbols[i];
+        ps->name = bin_read_string(&r);
+        bin_read_bytes(&r, &ps->type, 1);
+        ps->value = (int64_t)bin_read_u64(&r);
+        ps->line = (int)bin_read_u32(&r);
+        if (ps->type != SYM_EQU && ps->type != SYM_SET) r.ok = false;
+    }
+
+    pch->macro_count = bin_read_count(&r, 16);
+    pch->macros = pch->macro_count ? as_calloc(pch->macro_count, sizeof(PchMacro)) : NULL;
+    for (size_t i = 0; i < pch->macro_count && r.ok; i++) {
+        PchMacro *m = &pch->macros[i];
+        m->name = bin_read_string(&r);
+        m->line = (int)bin_read_u32(&r);
+        m->params = read_strings(&r, &m->param_count);
+        m->body = read_strings(&r, &m->body_count);
+    }
+    free(data);
+
+    pch->present = r.ok;
+}
+
+/* This assembler's copy of path's .pch, loaded on first use */
+static PchFile *pch_find(Assembler *as, const char *path) {
+    for (PchFile *pch = as->pch; pch; pch = pch->next) {
+        if (strcmp(pch->path, path) == 0) return pch;
+    }
+    PchFile *pch = as_calloc(1, sizeof(PchFile));
+    if (!pch) return NULL;
+    pch->path = as_strdup(path);
+    pch_read(pch);
+    if (!pch->present) {
+        pch_clear(pch);             /* Keep only the negative answer */
+    }
+    pch->next = as->pch;
+    as->pch = pch;
+    return pch;
+}
+
+/*
+ * Define what src would define from its .pch, if it has a current one.
+ * Returns false (having defined nothing) when the file must be parsed.
+ */
+bool pch_apply(Assembler *as, SourceFile *src) {
+    PchFile *pch = pch_find(as, src->path);
+    if (!pch || !pch->present || pch->hash != src->hash) return false;
+    if (as->verbose && !pch->reported) {
+        printf("Precompiled header: %zu symbols, %zu macros from %s.pch\n",
+               pch->symbol_count, pch->macro_count, src->path);
+        pch->reported = true;
+    }
+
+    /* The including file now depends on more than the cache can record */
+    if (as->cache) {
+        cache_note_volatile(as);
+    }
+
+    const char *prev_file = as->current_file;
+    int prev_line = as->current_line;
+    as->current_file = src->path;
+
+    for (size_t i = 0; i < pch->symbol_count; i++) {
+        as->current_line = pch->symbols[i].line;
+        symbol_define(as, pch->symbols[i].name, (SymbolType)pch->symbols[i].type,
+                      pch->symbols[i].value);
+    }
+
+    /* As with MACRO lines, replay keeps the definitions from recording */
+    if (as->ir.recording || !as->ir.valid) {
+        for (size_t i = 0; i < pch->macro_count; i++) {
+            PchMacro *m = &pch->macros[i];
+            as->current_line = m->line;
+            macro_define(as, m->name, m->params, (int)m->param_count, m->body, (int)m->body_count);
+        }
+    }
+
+    as->current_file = prev_file;
+    as->current_line = prev_line;
+    return true;
+}
+
+/* ---- Writing ---- */
+
+/* Can this recorded line be summed up by the symbols it defined? */
+static bool pch_line_allowed(const Stmt *st) {
+    if (st->kind != STMT_LINE) return false;
+    for (int i = 0; i < st->token_count; i++) {
+        if (st->tokens[i].type == TOK_DOLLAR) return false;
+    }
+    switch (st->directive) {
+        case DIR_EQU:
+        case DIR_SET:
+        case DIR_PAGE:
+        case DIR_LISTING:
+            return true;
+        case DIR_NONE:
+            /* NAME = value; anything else is a macro call */
+            for (int i = 0; i < st->token_count && i < 3; i++) {
+                if (st->tokens[i].type == TOK_EQUALS) return true;
+            }
+            return false;
+        default:
+            return false;
+    }
+}
+
+/* Why header can't be precompiled, or NULL if it can */
+static const char *pch_unsuitable(Assembler *as) {
+    if (!as->ir.valid) return "it redefines a macro or names a symbol like a register";
+    if (as->sources->next) return "it includes other files";
+    for (size_t i = 0; i < as->ir.count; i++) {
+        const Stmt *st = &as->ir.stmts[i];
+        if (st->kind == STMT_INCLUDE) return "it includes other files";
+        if (st->kind == STMT_LABEL) {
+            as->current_file = st->file;
+            as->current_line = st->line;
+            return "it defines labels";
+        }
+        if (!pch_line_allowed(st)) {
+            as->current_file = st->file;
+            as->current_line = st->line;
+            return "only EQU, SET, = and MACRO lines without $ can be precompiled";
+        }
+    }
+    if (as->pc != 0 || as->output_size > 0) return "it emits code or data";
+    if (!as->max_mode) return "it changes MAXMODE";
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (sym->defined && sym->type == SYM_LABEL) return "it defines labels";
+        }
+    }
+    return NULL;
+}
+
+static void write_strings(FILE *fp, char **strings, int count) {
+    bin_write_u32(fp, (uint32_t)count);
+    for (int i = 0; i < count; i++) {
+        bin_write_string(fp, strings[i]);
+    }
+}
+
+/* Assemble header on its own and write header.pch; false on failure */
+bool pch_emit(const char *header, bool verbose) {
+    Assembler *as = assembler_new();
+    if (!as) {
+        fprintf(stderr, "Error: failed to create assembler\n");
+        return false;
+    }
+    as->verbose = verbose;
+
+    if (!assembler_assemble_file(as, header)) {
+        fprintf(stderr, "Error: '%s' has errors; no precompiled header written\n", header);
+        assembler_free(as);
+        return false;
+    }
+    const char *reason = pch_unsuitable(as);
+    if (reason) {
+        if (as->current_line > 0) {
+            fprintf(stderr, "%s:%d: error: cannot precompile '%s': %s\n",
+                    as->current_file, as->current_line, header, reason);
+        } else {
+            fprintf(stderr, "Error: cannot precompile '%s': %s\n", header, reason);
+        }
+        assembler_free(as);
+        return false;
+    }
+
+    SourceFile *src = as->sources;
+    char pch_path[1100];
+    snprintf(pch_path, sizeof(pch_path), "%s.pch", src->path);
+    char temp_path[1200];
+    snprintf(temp_path, sizeof(temp_path), "%s.tmp", pch_path);
+    FILE *fp = fopen(temp_path, "wb");
+    if (!fp) {
+        fprintf(stderr, "Error: cannot write '%s'\n", pch_path);
+        assembler_free(as);
+        return false;
+    }
+
+    fwrite(PCH_MAGIC, 1, 8, fp);
+    bin_write_u32(fp, PCH_VERSION);
+    bin_write_u64(fp, src->hash);
+
+    uint32_t symbols = 0, macros = 0;
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (!sym->defined) continue;
+            if (sym->type == SYM_EQU || sym->type == SYM_SET) symbols++;
+            if (sym->type == SYM_MACRO && sym->macro) macros++;
+        }
+    }
+    bin_write_u32(fp, symbols);
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (!sym->defined || (sym->type != SYM_EQU && sym->type != SYM_SET)) continue;
+            bin_write_string(fp, sym->name);
+            uint8_t type = (uint8_t)sym->type;
+            fwrite(&type, 1, 1, fp);
+            bin_write_u64(fp, (uint64_t)sym->value);
+            bin_write_u32(fp, (uint32_t)sym->definition_line);
+        }
+    }
+    bin_write_u32(fp, macros);
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (!sym->defined || sym->type != SYM_MACRO || !sym->macro) continue;
+            bin_write_string(fp, sym->name);
+            bin_write_u32(fp, (uint32_t)sym->definition_line);
+            write_strings(fp, sym->macro->params, sym->macro->param_count);
+            write_strings(fp, sym->macro->body, sym->macro->body_lines);
+        }
+    }
+
+    bool ok = !ferror(fp);
+    ok = fclose(fp) == 0 && ok;
+    if (!ok || rename(temp_path, pch_path) != 0) {
+        remove(temp_path);
+        fprintf(stderr, "Error: cannot write '%s'\n", pch_path);
+        assembler_free(as);
+        return false;
+    }
+
+    if (verbose) {
+        printf("Precompiled header: %u symbols, %u macros -> %s\n", symbols, macros, pch_path);
+    }
+    assembler_free(as);
+    return true;
+}
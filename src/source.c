@@ -0,0 +1,184 @@
+/*
+ * TLCS-900 Assembler - Source File Cache
+ *
+ * Every source and include file is read into memory once and split
+ * into a line index.  Line terminators are replaced with NUL bytes in
+ * place, and each line is tokenized once into the file's token buffer.
+ * All passes then replay the cached tokens instead of re-reading and
+ * re-scanning the file.
+ *
+ * Each file's content hash is taken as it is read, so the build cache
+ * can recognize an unchanged include; a file it reuses is never
+ * tokenized.
+ *
+ * In a batch build, files several targets include are tokenized once up
+ * front; each target finds them in its shared_sources list.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+/* Split a loaded buffer into NUL-terminated lines */
+static bool index_lines(SourceFile *src) {
+    int capacity = 256;
+    src->lines = as_malloc(capacity * sizeof(SourceLine));
+    if (!src->lines) return false;
+    src->line_count = 0;
+
+    size_t pos = 0;
+    while (pos < src->size) {
+        char *start = src->data + pos;
+        char *nl = memchr(start, '\n', src->size - pos);
+        size_t len = nl ? (size_t)(nl - start) : src->size - pos;
+
+        /* Next line starts after the newline (or at end of buffer) */
+        pos += len + (nl ? 1 : 0);
+
+        /* Strip trailing carriage returns */
+        while (len > 0 && start[len - 1] == '\r') {
+            len--;
+        }
+        start[len] = '\0';
+
+        if (src->line_count >= capacity) {
+            capacity *= 2;
+            SourceLine *new_lines = as_realloc(src->lines, capacity * sizeof(SourceLine));
+            if (!new_lines) return false;
+            src->lines = new_lines;
+        }
+        src->lines[src->line_count].offset = (uint32_t)(start - src->data);
+        src->lines[src->line_count].length = (uint32_t)len;
+        src->line_count++;
+    }
+
+    return true;
+}
+
+/* Tokenize every indexed line into the file's token buffer */
+static void tokenize_lines(StringPool *pool, SourceFile *src) {
+    for (int i = 0; i < src->line_count; i++) {
+        SourceLine *line = &src->lines[i];
+        line->first_token = (uint32_t)src->tokens.count;
+        line->token_count = (uint32_t)lexer_tokenize(pool, src->data + line->offset, &src->tokens);
+    }
+}
+
+/* 64-bit FNV-1a over the raw file contents */
+static uint64_t hash_bytes(const char *data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (uint8_t)data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/* Read a whole file into a new SourceFile */
+static SourceFile *load_file(const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return NULL;
+
+    SourceFile *src = as_calloc(1, sizeof(SourceFile));
+    if (!src) {
+        fclose(fp);
+        return NULL;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (size < 0) size = 0;
+
+    /* One extra byte so the last line can always be NUL-terminated */
+    src->data = as_malloc((size_t)size + 1);
+    src->path = as_strdup(path);
+    if (!src->data || !src->path) {
+        fclose(fp);
+        free(src->data);
+        free(src->path);
+        free(src);
+        return NULL;
+    }
+
+    src->size = fread(src->data, 1, (size_t)size, fp);
+    src->data[src->size] = '\0';
+    fclose(fp);
+    src->hash = hash_bytes(src->data, src->size);
+
+    if (!index_lines(src)) {
+        free(src->lines);
+        free(src->data);
+        free(src->path);
+        free(src);
+        return NULL;
+    }
+
+    return src;
+}
+
+/* Get a cached source file, reading it on first use but not tokenizing */
+SourceFile *source_open(Assembler *as, const char *path) {
+    for (SourceFile *src = as->sources; src; src = src->next) {
+        if (strcmp(src->path, path) == 0) {
+            return src;
+        }
+    }
+    for (SourceFile *src = as->shared_sources; src; src = src->next) {
+        if (src->tokenized && strcmp(src->path, path) == 0) {
+            return src;
+        }
+    }
+
+    SourceFile *src = load_file(path);
+    if (!src) return NULL;
+
+    src->next = as->sources;
+    as->sources = src;
+    return src;
+}
+
+/* Get a cached source file ready for parsing */
+SourceFile *source_load(Assembler *as, const char *path) {
+    SourceFile *src = source_open(as, path);
+    if (src && !src->tokenized) {
+        StatsPhase prev = stats_enter(as, PHASE_LEX);
+        tokenize_lines(&as->strings, src);
+        stats_leave(as, prev);
+        src->tokenized = true;
+    }
+    return src;
+}
+
+static void source_free(SourceFile *src) {
+    free(src->tokens.tokens);
+    free(src->lines);
+    free(src->data);
+    free(src->path);
+    free(src);
+}
+
+/* Drop a file from the cache (it changed on disk); the next open reads it again */
+void source_forget(Assembler *as, const char *path) {
+    for (SourceFile **link = &as->sources; *link; link = &(*link)->next) {
+        SourceFile *src = *link;
+        if (strcmp(src->path, path) == 0) {
+            *link = src->next;
+            source_free(src);
+            return;
+        }
+    }
+}
+
+/* Free all cached source files */
+void source_free_all(Assembler *as) {
+    SourceFile *src = as->sources;
+    while (src) {
+        SourceFile *next = src->next;
+        source_free(src);
+        src = next;
+    }
+    as->sources = NULL;
+}
@@ -0,0 +1,90 @@
+/*
+ * TLCS-900 Assembler - Build Statistics
+ *
+ * --stats reports where an assembly went: wall time per pass and per
+ * pass 1 iteration, what changed in each iteration, time per phase, and
+ * counters for the symbol table, macros, output and heap allocations.
+ *
+ * Phases are charged exclusively: entering one (stats_enter) stops the
+ * clock of the phase that was running, so time spent evaluating an
+ * expression inside operand parsing counts once, as expression time.
+ * With -j, pass 2 workers are not timed; their share of pass 2 shows up
+ * in the pass time only.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+static const char *const phase_names[PHASE_COUNT] = {
+    "other", "lexing", "operands", "expressions", "encoding", "output",
+};
+
+/* Charge the time since the last switch to the running phase */
+StatsPhase stats_switch(Assembler *as, StatsPhase phase) {
+    double now = assembler_clock();
+    StatsPhase prev = as->stats.phase;
+    as->stats.phase_seconds[prev] += now - as->stats.phase_start;
+    as->stats.phase_start = now;
+    as->stats.phase = phase;
+    return prev;
+}
+
+void stats_print(Assembler *as) {
+    const AssemblyStats *st = &as->stats;
+
+    diag_message(as, "Statistics:");
+    diag_message(as, "  pass 1       %9.2f ms, %d iterations", st->pass1_seconds * 1e3, st->iterations);
+    for (int i = 0; i < st->iterations && i < MAX_PASS1_ITERATIONS; i++) {
+        const IterationStats *it = &st->iteration[i];
+        if (i == 0) {
+            diag_message(as, "    iteration %-2d %7.2f ms, %u symbols defined",
+                         i + 1, it->seconds * 1e3, it->definitions);
+        } else if (it->visited == 0) {
+            diag_message(as, "    iteration %-2d %7.2f ms, %u symbol values changed, %u instructions resized",
+                         i + 1, it->seconds * 1e3, it->symbol_changes, it->size_changes);
+        } else {
+            diag_message(as, "    iteration %-2d %7.2f ms, %u symbol values changed, %u instructions resized, "
+                         "%u statements visited", i + 1, it->seconds * 1e3, it->symbol_changes,
+                         it->size_changes, it->visited);
+        }
+    }
+    diag_message(as, "  pass 2       %9.2f ms", st->pass2_seconds * 1e3);
+
+    double total = 0;
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        total += st->phase_seconds[p];
+    }
+    for (int p = 1; p <= PHASE_COUNT; p++) {
+        int phase = p % PHASE_COUNT;    /* "other" last */
+        diag_message(as, "  %-12s %9.2f ms  %5.1f%%", phase_names[phase], st->phase_seconds[phase] * 1e3,
+                     total > 0 ? 100.0 * st->phase_seconds[phase] / total : 0.0);
+    }
+
+    size_t longest = 0;
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        size_t length = 0;
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            length++;
+        }
+        if (length > longest) longest = length;
+    }
+    diag_message(as, "  symbols      %zu in %zu buckets, longest chain %zu",
+                 as->symbol_count, as->symbol_table_size, longest);
+    diag_message(as, "  lookups      %llu hashed (%.2f misses each), %llu memoized",
+                 (unsigned long long)st->symbol_lookups,
+                 st->symbol_lookups ? (double)st->symbol_probes / (double)st->symbol_lookups : 0.0,
+                 (unsigned long long)st->memo_hits);
+    diag_message(as, "  macros       %llu expansions", (unsigned long long)st->macro_expansions);
+    diag_message(as, "  output       %llu bytes emitted, %zu byte image",
+                 (unsigned long long)st->bytes_emitted, as->output_size);
+
+    uint64_t later = 0;
+    for (int i = 1; i < st->iterations && i < MAX_PASS1_ITERATIONS; i++) {
+        later += st->iteration[i].allocations;
+    }
+    diag_message(as, "  allocations  %llu in iteration 1, %llu in later iterations, %llu in pass 2",
+                 (unsigned long long)st->iteration[0].allocations, (unsigned long long)later,
+                 (unsigned long long)st->pass2_allocations);
+}
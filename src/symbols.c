@@ -2,7 +2,15 @@
  * TLCS-900 Assembler - Symbol Table
  *
  * Hash table implementation for labels, EQU constants, and macros.
- * Uses FNV-1a hash with chaining for collision resolution.
+ * Names are interned in the string pool and keyed by its case-folded
+ * FNV-1a hash, with chaining for collision resolution.  The bucket array
+ * doubles when it gets 3/4 full.  Symbols are allocated from an arena,
+ * so Symbol pointers stay valid until the table is freed; macro bodies
+ * and parameters live in a separate MacroDef.
+ *
+ * The build cache may seed the table with last build's values before
+ * pass 1.  A seeded symbol reads as defined, but its first real
+ * definition replaces it whatever its type, without redefinition errors.
  */
 
 #define _POSIX_C_SOURCE 200809L
@@ -13,138 +21,341 @@
 #include <ctype.h>
 #include "../include/tlcs900.h"
 
-#define SYMBOL_TABLE_SIZE 4096
+#define SYMBOL_TABLE_INITIAL 4096     /* Buckets, power of two */
+
+/* Record that a symbol's value changed (drives relaxation in pass 1) */
+static void symbol_touch(Assembler *as, Symbol *sym) {
+    sym->stamp = ++as->symbol_stamp;
+    ir_touch(as, sym);
+}
 
-/* FNV-1a hash function */
-static uint32_t hash_string(const char *str) {
-    uint32_t hash = 2166136261u;
-    while (*str) {
-        hash ^= (uint8_t)toupper(*str++);
-        hash *= 16777619u;
+/* Count a symbol's first definition for --stats */
+static void symbol_count_definition(Assembler *as) {
+    if (as->pass == 1 && as->stats.iterations > 0) {
+        as->stats.iteration[as->stats.iterations - 1].definitions++;
     }
-    return hash;
 }
 
 void symbols_init(Assembler *as) {
-    as->symbol_table_size = SYMBOL_TABLE_SIZE;
-    as->symbols = calloc(SYMBOL_TABLE_SIZE, sizeof(Symbol *));
+    as->symbol_table_size = SYMBOL_TABLE_INITIAL;
+    as->symbol_count = 0;
+    as->symbols = as_calloc(SYMBOL_TABLE_INITIAL, sizeof(Symbol *));
     if (!as->symbols) {
         fprintf(stderr, "Failed to allocate symbol table\n");
         exit(1);
     }
+    arena_init(&as->symbol_arena);
+}
+
+/* Free the compiled bodies of a macro and the definitions it replaced */
+static void macro_def_free(MacroDef *def) {
+    while (def) {
+        MacroDef *prev = def->prev;
+        for (int j = 0; def->lines && j < def->body_lines; j++) {
+            free(def->lines[j].slots);
+            free(def->lines[j].tokens.tokens);
+        }
+        free(def->lines);
+        def = prev;
+    }
 }
 
 void symbols_free(Assembler *as) {
     if (!as->symbols) return;
 
+    /* Symbols live in the arena; only macro definitions are separate */
     for (size_t i = 0; i < as->symbol_table_size; i++) {
-        Symbol *sym = as->symbols[i];
-        while (sym) {
-            Symbol *next = sym->next;
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            macro_def_free(sym->macro);
+        }
+    }
 
-            /* Free macro body if present */
-            if (sym->macro_body) {
-                for (int j = 0; j < sym->macro_body_lines; j++) {
-                    free(sym->macro_body[j]);
-                }
-                free(sym->macro_body);
-            }
+    free(as->symbols);
+    as->symbols = NULL;
+    free(as->atom_symbols);
+    as->atom_symbols = NULL;
+    as->atom_symbols_size = 0;
+    arena_free(&as->symbol_arena);
+}
 
-            /* Free macro params if present */
-            if (sym->macro_params) {
-                for (int j = 0; j < sym->macro_param_count; j++) {
-                    free(sym->macro_params[j]);
-                }
-                free(sym->macro_params);
-            }
+/* Double the bucket count once the table is more than 3/4 full */
+static void symbols_grow(Assembler *as) {
+    size_t new_size = as->symbol_table_size * 2;
+    Symbol **table = as_calloc(new_size, sizeof(Symbol *));
+    if (!table) return;  /* Keep the current table; chains just get longer */
 
-            free(sym);
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        Symbol *sym = as->symbols[i];
+        while (sym) {
+            Symbol *next = sym->next;
+            size_t h = sym->hash & (new_size - 1);
+            sym->next = table[h];
+            table[h] = sym;
             sym = next;
         }
     }
 
     free(as->symbols);
-    as->symbols = NULL;
+    as->symbols = table;
+    as->symbol_table_size = new_size;
 }
 
-Symbol *symbol_lookup(Assembler *as, const char *name) {
-    uint32_t h = hash_string(name) % as->symbol_table_size;
-    Symbol *sym = as->symbols[h];
-
+/* Find a symbol by interned name and its case-folded hash */
+static Symbol *symbol_find(Assembler *as, const char *name, uint32_t atom, uint32_t hash) {
+    Symbol *sym = as->symbols[hash & (as->symbol_table_size - 1)];
+    as->stats.symbol_lookups++;
     while (sym) {
-        if (strcasecmp(sym->name, name) == 0) {
+        if (sym->atom == atom ||
+            (sym->hash == hash && strcasecmp(sym->name, name) == 0)) {
             return sym;
         }
+        as->stats.symbol_probes++;
         sym = sym->next;
     }
-
     return NULL;
 }
 
-Symbol *symbol_define(Assembler *as, const char *name, SymbolType type, int64_t value) {
-    /* Check if already exists */
-    Symbol *existing = symbol_lookup(as, name);
-    if (existing) {
-        if (existing->type == SYM_SET || type == SYM_SET) {
-            /* SET symbols can be redefined */
+Symbol *symbol_lookup(Assembler *as, const char *name) {
+    uint32_t hash = strpool_hash_folded(name, strlen(name));
+    /* Atom 0 is the empty name, which no symbol uses */
+    Symbol *sym = symbol_find(as, name, 0, hash);
+    if (sym && as->cache_tracking) {
+        cache_note_ref(as, sym);
+    }
+    return sym;
+}
+
+/* Remember the symbol an atom resolves to */
+static void symbol_cache_atom(Assembler *as, uint32_t atom, Symbol *sym) {
+    if (atom >= as->atom_symbols_size) {
+        size_t new_size = as->atom_symbols_size ? as->atom_symbols_size : 4096;
+        while (new_size <= atom) new_size *= 2;
+        Symbol **cache = as_realloc(as->atom_symbols, new_size * sizeof(Symbol *));
+        if (!cache) return;
+        memset(cache + as->atom_symbols_size, 0,
+               (new_size - as->atom_symbols_size) * sizeof(Symbol *));
+        as->atom_symbols = cache;
+        as->atom_symbols_size = new_size;
+    }
+    as->atom_symbols[atom] = sym;
+}
+
+/*
+ * Look up by atom.  Symbols are never removed, so once an atom resolves
+ * the Symbol pointer is memoized and later lookups are a single index.
+ */
+Symbol *symbol_lookup_atom(Assembler *as, uint32_t atom) {
+    Symbol *sym;
+    if (atom < as->atom_symbols_size && as->atom_symbols[atom]) {
+        sym = as->atom_symbols[atom];
+        as->stats.memo_hits++;
+    } else {
+        const Atom *a = as->strings.atoms[atom];
+        sym = symbol_find(as, a->text, atom, a->hash);
+        if (!sym) return NULL;
+        /* Pass 2 workers share the table; only the serial pass memoizes */
+        if (!as->worker) {
+            symbol_cache_atom(as, atom, sym);
+        }
+    }
+    if (as->cache_tracking) {
+        cache_note_ref(as, sym);
+    }
+    return sym;
+}
+
+/* Apply a definition to an existing symbol */
+static Symbol *symbol_redefine(Assembler *as, Symbol *existing, const char *name,
+                               SymbolType type, int64_t value) {
+    if (existing->seeded) {
+        /* First definition of a symbol seeded from the build cache */
+        symbol_count_definition(as);
+        existing->seeded = false;
+        existing->fixed = false;
+        existing->type = type;
+        existing->defined = true;
+        existing->definition_line = as->current_line;
+        existing->definition_file = as->current_file;
+        existing->defined_sweep = as->sweep;
+        if (existing->value != value) {
             existing->value = value;
-            existing->defined = true;
-            existing->type = type;
-            return existing;
+            symbol_touch(as, existing);
         }
-        if (existing->type == SYM_MACRO && type == SYM_MACRO) {
-            /* Macros can be silently redefined with same type (for multi-pass) */
-            return existing;
+        return existing;
+    }
+    if (existing->type == SYM_SET || type == SYM_SET) {
+        /* SET symbols can be redefined */
+        existing->fixed = false;
+        existing->value = value;
+        existing->defined = true;
+        existing->type = type;
+        return existing;
+    }
+    if (existing->type == SYM_MACRO && type == SYM_MACRO) {
+        /* Macros can be silently redefined with same type (for multi-pass) */
+        return existing;
+    }
+    if (existing->type == type && type == SYM_LABEL) {
+        /*
+         * Labels can be updated in multiple pass 1 iterations.  A label
+         * defined twice in one sweep (e.g. inside a macro body) takes
+         * every value in turn; that is not a layout change, so it never
+         * counts against convergence and its users are always re-encoded.
+         */
+        if (existing->defined_sweep == as->sweep) {
+            existing->duplicate = true;
         }
-        if (existing->type == type && type == SYM_LABEL) {
-            /* Labels can be updated in multiple pass 1 iterations */
+        existing->defined_sweep = as->sweep;
+        if (existing->value != value) {
             existing->value = value;
-            return existing;
+            if (!existing->duplicate) symbol_touch(as, existing);
         }
-        if (existing->type == type && type == SYM_EQU) {
-            /* EQU symbols can be silently redefined with same value in pass 1 */
-            if (existing->value != value && as->pass == 1 && !as->sizing_pass) {
-                error(as, "symbol '%s' already defined with different value at %s:%d",
-                      name, existing->definition_file, existing->definition_line);
-                return NULL;
-            }
-            return existing;
-        }
-        if (existing->defined && as->pass == 1 && as->sizing_pass) {
-            /* First pass 1 - error on redefinition */
-            error(as, "symbol '%s' already defined at %s:%d",
+        return existing;
+    }
+    if (existing->type == type && type == SYM_EQU) {
+        /* EQU symbols can be silently redefined with same value in pass 1 */
+        if (existing->value != value && as->pass == 1 && !as->sizing_pass) {
+            error(as, "symbol '%s' already defined with different value at %s:%d",
                   name, existing->definition_file, existing->definition_line);
             return NULL;
         }
-        /* Update value in subsequent passes */
-        existing->value = value;
-        existing->defined = true;
         return existing;
     }
-
-    /* Create new symbol */
-    Symbol *sym = calloc(1, sizeof(Symbol));
-    if (!sym) {
-        error(as, "out of memory allocating symbol '%s'", name);
+    if (existing->defined && as->pass == 1 && as->sizing_pass) {
+        /* First pass 1 - error on redefinition */
+        error(as, "symbol '%s' already defined at %s:%d",
+              name, existing->definition_file, existing->definition_line);
         return NULL;
     }
+    /* Update value in subsequent passes */
+    if (!existing->defined) {
+        symbol_count_definition(as);
+    }
+    existing->fixed = false;
+    if (existing->value != value || !existing->defined) {
+        symbol_touch(as, existing);
+    }
+    existing->value = value;
+    existing->defined = true;
+    return existing;
+}
 
-    strncpy(sym->name, name, MAX_IDENTIFIER - 1);
-    sym->name[MAX_IDENTIFIER - 1] = '\0';
+/* Create a new symbol under an interned name */
+static Symbol *symbol_create(Assembler *as, uint32_t atom, SymbolType type, int64_t value) {
+    Symbol *sym = arena_alloc(&as->symbol_arena, sizeof(Symbol));
+    memset(sym, 0, sizeof(*sym));
+    sym->name = strpool_text(&as->strings, atom);
+    sym->atom = atom;
+    sym->hash = as->strings.atoms[atom]->hash;
     sym->type = type;
     sym->value = value;
     sym->defined = true;
     sym->definition_line = as->current_line;
     sym->definition_file = as->current_file;
+    sym->defined_sweep = as->sweep;
+    if (type != SYM_SET) {
+        symbol_touch(as, sym);
+    }
 
     /* Insert at head of chain */
-    uint32_t h = hash_string(name) % as->symbol_table_size;
+    size_t h = sym->hash & (as->symbol_table_size - 1);
     sym->next = as->symbols[h];
     as->symbols[h] = sym;
+    symbol_cache_atom(as, atom, sym);
+
+    if (++as->symbol_count > as->symbol_table_size / 4 * 3) {
+        symbols_grow(as);
+    }
 
     return sym;
 }
 
+Symbol *symbol_define(Assembler *as, const char *name, SymbolType type, int64_t value) {
+    /* Check if already exists */
+    Symbol *sym = symbol_lookup(as, name);
+    if (as->worker) {
+        /* A worker can't define; the serial pass redoes its chunk */
+        as->worker_tainted = true;
+        return sym;
+    }
+    if (sym) {
+        sym = symbol_redefine(as, sym, name, type, value);
+    } else {
+        /* The name is interned so it is stored only once */
+        size_t len = strlen(name);
+        if (len > MAX_IDENTIFIER - 1) len = MAX_IDENTIFIER - 1;
+        sym = symbol_create(as, strpool_intern(&as->strings, name, len), type, value);
+        symbol_count_definition(as);
+    }
+    if (sym && as->cache_tracking) {
+        cache_note_def(as, sym);
+    }
+    return sym;
+}
+
+/*
+ * Define an EQU; folded says its value came from literals and fixed
+ * EQUs only, so expressions compiled later may fold it in.
+ */
+Symbol *symbol_define_fixed(Assembler *as, const char *name, int64_t value, bool folded) {
+    Symbol *sym = symbol_define(as, name, SYM_EQU, value);
+    if (sym && !as->worker && sym->type == SYM_EQU) {
+        sym->fixed = folded && sym->value == value;
+    }
+    return sym;
+}
+
+/* Define a symbol named by an atom (names from tokens or statements) */
+Symbol *symbol_define_atom(Assembler *as, uint32_t atom, SymbolType type, int64_t value) {
+    const char *name = strpool_text(&as->strings, atom);
+    Symbol *existing = symbol_lookup_atom(as, atom);
+    if (as->worker) {
+        as->worker_tainted = true;
+        return existing;
+    }
+    if (!existing && strlen(name) > MAX_IDENTIFIER - 1) {
+        return symbol_define(as, name, type, value);
+    }
+    Symbol *sym;
+    if (existing) {
+        sym = symbol_redefine(as, existing, name, type, value);
+    } else {
+        sym = symbol_create(as, atom, type, value);
+        symbol_count_definition(as);
+    }
+    if (sym && as->cache_tracking) {
+        cache_note_def(as, sym);
+    }
+    return sym;
+}
+
+/*
+ * After the first sweep every seed still in place names a symbol the
+ * source no longer defines.  It becomes undefined, exactly as if it had
+ * never been seeded; its users are re-encoded on the next sweep.
+ */
+void symbols_drop_seeds(Assembler *as) {
+    for (size_t i = 0; i < as->symbol_table_size; i++) {
+        for (Symbol *sym = as->symbols[i]; sym; sym = sym->next) {
+            if (!sym->seeded) continue;
+            sym->seeded = false;
+            sym->defined = false;
+            sym->value = 0;
+            symbol_touch(as, sym);
+        }
+    }
+}
+
+/* Preload a symbol with last build's value (see cache.c) */
+Symbol *symbol_seed(Assembler *as, const char *name, SymbolType type, int64_t value) {
+    if (symbol_lookup(as, name)) return NULL;
+    size_t len = strlen(name);
+    if (len > MAX_IDENTIFIER - 1) return NULL;
+    Symbol *sym = symbol_create(as, strpool_intern(&as->strings, name, len), type, value);
+    sym->seeded = true;
+    return sym;
+}
+
 bool symbol_is_defined(Assembler *as, const char *name) {
     Symbol *sym = symbol_lookup(as, name);
     return sym && sym->defined;
@@ -156,7 +367,9 @@ bool symbol_get_value(Assembler *as, const char *name, int64_t *value) {
     if (!sym) {
         return false;
     }
-    sym->referenced = true;
+    if (!as->worker) {
+        sym->referenced = true;
+    }
     *value = sym->value;
     return sym->defined;
 }
@@ -170,31 +383,61 @@ SymbolType symbol_get_type(Assembler *as, const char *name) {
     return sym->type;
 }
 
-/* Define a macro */
+/* Does a definition have exactly these parameters and body? */
+static bool macro_def_equal(const MacroDef *def, char **params, int param_count,
+                            char **body, int body_lines) {
+    if (def->param_count != param_count || def->body_lines != body_lines) return false;
+    for (int i = 0; i < param_count; i++) {
+        if (strcmp(def->params[i], params[i]) != 0) return false;
+    }
+    for (int i = 0; i < body_lines; i++) {
+        if (strcmp(def->body[i], body[i]) != 0) return false;
+    }
+    return true;
+}
+
+/*
+ * Define a macro from a copy of params and body, kept in the symbol
+ * arena.  Defining it again with the same text, as every pass that
+ * parses the definition does, keeps the current definition.
+ */
 Symbol *symbol_define_macro(Assembler *as, const char *name,
                             char **params, int param_count,
                             char **body, int body_lines) {
     Symbol *sym = symbol_define(as, name, SYM_MACRO, 0);
-    if (!sym) return NULL;
+    if (!sym) {
+        return NULL;
+    }
+    if (sym->macro && macro_def_equal(sym->macro, params, param_count, body, body_lines)) {
+        return sym;
+    }
+
+    MacroDef *def = arena_alloc(&as->symbol_arena, sizeof(MacroDef));
+    memset(def, 0, sizeof(*def));
 
-    /* Allocate and copy parameters */
     if (param_count > 0) {
-        sym->macro_params = malloc(param_count * sizeof(char *));
-        sym->macro_param_count = param_count;
+        def->params = arena_alloc(&as->symbol_arena, param_count * sizeof(char *));
+        def->param_count = param_count;
         for (int i = 0; i < param_count; i++) {
-            sym->macro_params[i] = strdup(params[i]);
+            def->params[i] = arena_strdup(&as->symbol_arena, params[i]);
         }
     }
 
-    /* Allocate and copy body */
     if (body_lines > 0) {
-        sym->macro_body = malloc(body_lines * sizeof(char *));
-        sym->macro_body_lines = body_lines;
+        def->body = arena_alloc(&as->symbol_arena, body_lines * sizeof(char *));
+        def->body_lines = body_lines;
         for (int i = 0; i < body_lines; i++) {
-            sym->macro_body[i] = strdup(body[i]);
+            def->body[i] = arena_strdup(&as->symbol_arena, body[i]);
         }
     }
 
+    /*
+     * A redefinition replaces the previous body.  The old one may still be
+     * expanding (a macro redefined from inside its own body), so it stays
+     * allocated until the table is freed.
+     */
+    def->prev = sym->macro;
+    sym->macro = def;
     return sym;
 }
 
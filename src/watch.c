@@ -0,0 +1,209 @@
+/*
+ * TLCS-900 Assembler - Watch Mode
+ *
+ * build_watch() builds a target, waits for one of its sources to change
+ * and builds it again, until it is interrupted.  Between builds it keeps
+ * a resident assembler holding the input and every file it includes,
+ * read and tokenized once.  Each build starts from that assembler's
+ * atoms and reads its token streams, as the targets of a batch build do
+ * (see batch.c), so only a file that changed is read and tokenized
+ * again.  The build cache written after each successful build then
+ * stands in for every include file whose contents and inputs did not
+ * move: its symbols seed the next build, and those files are not parsed
+ * at all.  A one-line change re-assembles the file it is in and what
+ * depends on the symbols that moved.
+ *
+ * Files are watched with inotify, by directory, so editors that save by
+ * writing a new file and renaming it over the old one are seen too.
+ * BINCLUDE files are watched but not loaded.  Events that arrive within
+ * WATCH_SETTLE_MS of each other count as one change.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tlcs900.h"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+
+#define WATCH_SETTLE_MS 30
+#define WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO | IN_DELETE)
+
+/* A file the build reads, and the directory watch that covers it */
+typedef struct {
+    char *path;
+    const char *name;           /* Within path: the part after the directory */
+    int wd;                     /* -1 if the directory can't be watched */
+    uint32_t round;             /* Last scan that reached it */
+} WatchFile;
+
+typedef struct {
+    int fd;
+    Assembler *base;            /* Tokenized sources shared with each build */
+    WatchFile *files;
+    size_t count;
+    size_t capacity;
+    uint32_t round;
+} Watch;
+
+/* The entry for path, adding it (and a watch on its directory) if new */
+static WatchFile *watch_file(Watch *w, const char *path) {
+    for (size_t i = 0; i < w->count; i++) {
+        if (strcmp(w->files[i].path, path) == 0) {
+            return &w->files[i];
+        }
+    }
+    if (w->count >= w->capacity) {
+        size_t new_capacity = w->capacity ? w->capacity * 2 : 32;
+        WatchFile *files = as_realloc(w->files, new_capacity * sizeof(WatchFile));
+        if (!files) return NULL;
+        w->files = files;
+        w->capacity = new_capacity;
+    }
+
+    WatchFile *f = &w->files[w->count];
+    f->path = as_strdup(path);
+    if (!f->path) return NULL;
+    const char *slash = strrchr(f->path, '/');
+    f->name = slash ? slash + 1 : f->path;
+    f->round = 0;
+
+    char dir[1024];
+    if (!slash) {
+        strcpy(dir, ".");
+    } else {
+        size_t len = slash == f->path ? 1 : (size_t)(slash - f->path);
+        if (len >= sizeof(dir)) len = sizeof(dir) - 1;
+        memcpy(dir, f->path, len);
+        dir[len] = '\0';
+    }
+    f->wd = inotify_add_watch(w->fd, dir, WATCH_EVENTS);
+    w->count++;
+    return f;
+}
+
+/* Load path and everything it includes into the resident assembler */
+static void watch_scan(Watch *w, const char *path, int depth) {
+    WatchFile *f = watch_file(w, path);
+    if (!f || f->round == w->round || depth > MAX_INCLUDE_DEPTH) return;
+    f->round = w->round;
+
+    SourceFile *src = source_load(w->base, path);
+    if (!src) return;
+
+    char name[1024];
+    char resolved[1024];
+    for (int i = 0; i < src->line_count; i++) {
+        const char *line = src->data + src->lines[i].offset;
+        if (build_scan_include(line, "INCLUDE", name, sizeof(name)) &&
+            assembler_resolve_include(src->path, name, resolved, sizeof(resolved))) {
+            watch_scan(w, resolved, depth + 1);
+        } else if (build_scan_include(line, "BINCLUDE", name, sizeof(name)) &&
+                   assembler_resolve_include(src->path, name, resolved, sizeof(resolved))) {
+            watch_file(w, resolved);
+        }
+    }
+}
+
+/* Drop the files named by a buffer of events; true if any was ours */
+static bool watch_events(Watch *w, const char *buf, ssize_t len) {
+    bool changed = false;
+    for (ssize_t pos = 0; pos < len; ) {
+        const struct inotify_event *ev = (const struct inotify_event *)(buf + pos);
+        pos += (ssize_t)(sizeof(struct inotify_event) + ev->len);
+        if (ev->len == 0) continue;
+
+        for (size_t i = 0; i < w->count; i++) {
+            WatchFile *f = &w->files[i];
+            if (f->wd == ev->wd && strcmp(f->name, ev->name) == 0) {
+                source_forget(w->base, f->path);
+                changed = true;
+            }
+        }
+    }
+    return changed;
+}
+
+/* Block until a watched file changes and the burst of events settles */
+static bool watch_wait(Watch *w) {
+    char buf[8192] __attribute__((aligned(__alignof__(struct inotify_event))));
+    bool changed = false;
+    struct pollfd pfd = { w->fd, POLLIN, 0 };
+
+    for (;;) {
+        int ready = poll(&pfd, 1, changed ? WATCH_SETTLE_MS : -1);
+        if (ready < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        if (ready == 0) return true;
+
+        ssize_t len = read(w->fd, buf, sizeof(buf));
+        if (len < 0) {
+            if (errno == EINTR || errno == EAGAIN) continue;
+            return false;
+        }
+        if (watch_events(w, buf, len)) {
+            changed = true;
+        }
+    }
+}
+
+/* Build input, then again whenever one of its files changes */
+int build_watch(const BuildOptions *opt, const char *input, const char *output) {
+    Watch w;
+    memset(&w, 0, sizeof(w));
+    w.fd = inotify_init1(IN_CLOEXEC);
+    if (w.fd < 0) {
+        fprintf(stderr, "Error: cannot watch files: %s\n", strerror(errno));
+        return 1;
+    }
+    w.base = assembler_new();
+    if (!w.base) {
+        close(w.fd);
+        return 1;
+    }
+
+    int status = 0;
+    for (;;) {
+        double start = assembler_clock();
+        w.round++;
+        watch_scan(&w, input, 0);
+        bool ok = build_target(opt, input, output, w.base, NULL);
+        printf("%s: %s in %.1f ms, watching %zu files\n", output, ok ? "built" : "build failed",
+               (assembler_clock() - start) * 1e3, w.count);
+        fflush(stdout);
+
+        if (!watch_wait(&w)) {
+            fprintf(stderr, "Error: lost the file watch: %s\n", strerror(errno));
+            status = 1;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < w.count; i++) {
+        free(w.files[i].path);
+    }
+    free(w.files);
+    assembler_free(w.base);
+    close(w.fd);
+    return status;
+}
+
+#else
+
+int build_watch(const BuildOptions *opt, const char *input, const char *output) {
+    (void)opt;
+    (void)input;
+    (void)output;
+    fprintf(stderr, "Error: --watch needs inotify, which this system lacks\n");
+    return 1;
+}
+
+#endif